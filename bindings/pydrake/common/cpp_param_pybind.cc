@@ -33,16 +33,25 @@ Object& Object::operator=(Object&& other) {
 }
 
 Object Object::Clone() const {
+  py::gil_scoped_acquire guard;
   py::object py_copy = py::module::import("copy").attr("deepcopy");
   py::object copied = py_copy(to_pyobject<py::object>());
   return from_pyobject(copied);
 }
 
+// C++ code that runs with the GIL released (e.g., Simulator::AdvanceTo()) may
+// still copy or destroy an Object, e.g., when cloning a Value[object].
 void Object::inc_ref() {
-  py::handle(ptr_).inc_ref();
+  if (ptr_ != nullptr) {
+    py::gil_scoped_acquire guard;
+    py::handle(ptr_).inc_ref();
+  }
 }
 void Object::dec_ref() {
-  py::handle(ptr_).dec_ref();
+  if (ptr_ != nullptr) {
+    py::gil_scoped_acquire guard;
+    py::handle(ptr_).dec_ref();
+  }
 }
 
 namespace internal {
@@ -296,6 +296,10 @@ void DoScalarIndependentDefinitions(py::module m) {
       py::arg("slab_thickness"), py::arg("hydroelastic_modulus"),
       py::arg("properties"),
       doc.AddCompliantHydroelasticPropertiesForHalfSpace.doc);
+
+  m.def("AddSignedDistanceFieldProperties", &AddSignedDistanceFieldProperties,
+      py::arg("resolution"), py::arg("properties"),
+      doc.AddSignedDistanceFieldProperties.doc);
 }
 
 }  // namespace
@@ -25,6 +25,7 @@
 #include "drake/geometry/optimization/cspace_separating_plane.h"
 #include "drake/geometry/optimization/graph_of_convex_sets.h"
 #include "drake/geometry/optimization/hpolyhedron.h"
+#include "drake/geometry/optimization/hpolyhedron_index.h"
 #include "drake/geometry/optimization/hyperellipsoid.h"
 #include "drake/geometry/optimization/intersection.h"
 #include "drake/geometry/optimization/iris.h"
@@ -98,6 +99,8 @@ void DefineGeometryOptimization(py::module m) {
             cls_doc.MaybeGetFeasiblePoint.doc)
         .def("PointInSet", &ConvexSet::PointInSet, py::arg("x"),
             py::arg("tol") = 1e-8, cls_doc.PointInSet.doc)
+        .def("PointsInSet", &ConvexSet::PointsInSet, py::arg("points"),
+            py::arg("tol") = 1e-8, cls_doc.PointsInSet.doc)
         .def("AddPointInSetConstraints", &ConvexSet::AddPointInSetConstraints,
             py::arg("prog"), py::arg("vars"),
             cls_doc.AddPointInSetConstraints.doc)
@@ -245,9 +248,13 @@ void DefineGeometryOptimization(py::module m) {
             py::arg("check_for_redundancy") = false, py::arg("tol") = 1E-9,
             cls_doc.Intersection.doc)
         .def("ReduceInequalities", &HPolyhedron::ReduceInequalities,
-            py::arg("tol") = 1E-9, cls_doc.ReduceInequalities.doc)
+            py::arg("tol") = 1E-9,
+            py::arg("parallelism") = Parallelism::None(),
+            cls_doc.ReduceInequalities.doc)
         .def("FindRedundant", &HPolyhedron::FindRedundant,
-            py::arg("tol") = 1E-9, cls_doc.FindRedundant.doc)
+            py::arg("tol") = 1E-9,
+            py::arg("parallelism") = Parallelism::None(),
+            cls_doc.FindRedundant.doc)
         .def("MaximumVolumeInscribedEllipsoid",
             &HPolyhedron::MaximumVolumeInscribedEllipsoid,
             cls_doc.MaximumVolumeInscribedEllipsoid.doc)
@@ -271,6 +278,10 @@ void DefineGeometryOptimization(py::module m) {
             overload_cast_explicit<Eigen::VectorXd, RandomGenerator*>(
                 &HPolyhedron::UniformSample),
             py::arg("generator"), cls_doc.UniformSample.doc_1args)
+        .def("UniformSamples", &HPolyhedron::UniformSamples,
+            py::arg("generator"), py::arg("initial_samples"),
+            py::arg("num_samples_per_chain"), py::arg("mixing_steps") = 10,
+            py::arg("thinning_steps") = 1, cls_doc.UniformSamples.doc)
         .def_static("MakeBox", &HPolyhedron::MakeBox, py::arg("lb"),
             py::arg("ub"), cls_doc.MakeBox.doc)
         .def_static("MakeUnitBox", &HPolyhedron::MakeUnitBox, py::arg("dim"),
@@ -324,6 +335,26 @@ void DefineGeometryOptimization(py::module m) {
             }));
   }
 
+  // HPolyhedronIndex
+  {
+    const auto& cls_doc = doc.HPolyhedronIndex;
+    py::class_<HPolyhedronIndex>(m, "HPolyhedronIndex", cls_doc.doc)
+        .def(py::init<std::vector<HPolyhedron>>(), py::arg("regions"),
+            cls_doc.ctor.doc)
+        .def("regions", &HPolyhedronIndex::regions, cls_doc.regions.doc)
+        .def("ambient_dimension", &HPolyhedronIndex::ambient_dimension,
+            cls_doc.ambient_dimension.doc)
+        .def("FindRegionsContainingPoint",
+            &HPolyhedronIndex::FindRegionsContainingPoint, py::arg("x"),
+            py::arg("tol") = 0.0, cls_doc.FindRegionsContainingPoint.doc)
+        .def("FindRegionsContainingPoints",
+            &HPolyhedronIndex::FindRegionsContainingPoints, py::arg("points"),
+            py::arg("tol") = 0.0,
+            py::arg("parallelism") = Parallelism::None(),
+            py::call_guard<py::gil_scoped_release>(),
+            cls_doc.FindRegionsContainingPoints.doc);
+  }
+
   // Intersection
   {
     const auto& cls_doc = doc.Intersection;
@@ -462,6 +493,8 @@ void DefineGeometryOptimization(py::module m) {
             cls_doc.num_additional_constraint_infeasible_samples.doc)
         .def_readwrite(
             "random_seed", &IrisOptions::random_seed, cls_doc.random_seed.doc)
+        .def_readwrite("parallelism", &IrisOptions::parallelism,
+            cls_doc.parallelism.doc)
         .def("__repr__", [](const IrisOptions& self) {
           return py::str(
               "IrisOptions("
@@ -501,7 +534,8 @@ void DefineGeometryOptimization(py::module m) {
         return Iris(CloneConvexSets(obstacles), sample, domain, options);
       },
       py::arg("obstacles"), py::arg("sample"), py::arg("domain"),
-      py::arg("options") = IrisOptions(), doc.Iris.doc);
+      py::arg("options") = IrisOptions(),
+      py::call_guard<py::gil_scoped_release>(), doc.Iris.doc);
 
   m.def(
       "MakeIrisObstacles",
@@ -522,8 +556,35 @@ void DefineGeometryOptimization(py::module m) {
           const systems::Context<double>&, const IrisOptions&>(
           &IrisInConfigurationSpace),
       py::arg("plant"), py::arg("context"), py::arg("options") = IrisOptions(),
+      py::call_guard<py::gil_scoped_release>(),
       doc.IrisInConfigurationSpace.doc);
 
+  {
+    const auto& cls_doc = doc.IrisFromSeedsOptions;
+    py::class_<IrisFromSeedsOptions> cls(
+        m, "IrisFromSeedsOptions", cls_doc.doc);
+    cls.def(py::init<>())
+        .def_readwrite("parallelism", &IrisFromSeedsOptions::parallelism,
+            cls_doc.parallelism.doc)
+        .def_readwrite("avoid_completed_regions",
+            &IrisFromSeedsOptions::avoid_completed_regions,
+            cls_doc.avoid_completed_regions.doc)
+        .def_readwrite("completed_region_scale",
+            &IrisFromSeedsOptions::completed_region_scale,
+            cls_doc.completed_region_scale.doc);
+    DefCopyAndDeepCopy(&cls);
+  }
+
+  // The seeds are processed with the GIL released, so that the worker threads
+  // can log (the Python log sink reacquires the GIL).
+  m.def("IrisInConfigurationSpaceFromSeeds",
+      &IrisInConfigurationSpaceFromSeeds, py::arg("plant"),
+      py::arg("root_context"), py::arg("seeds"),
+      py::arg("options") = IrisOptions(),
+      py::arg("seeds_options") = IrisFromSeedsOptions(),
+      py::call_guard<py::gil_scoped_release>(),
+      doc.IrisInConfigurationSpaceFromSeeds.doc);
+
   // TODO(#19597) Deprecate and remove these functions once Python
   // can natively handle the file I/O.
   m.def(
@@ -567,6 +628,11 @@ void DefineGeometryOptimization(py::module m) {
             cls_doc.flow_tolerance.doc)
         .def_readwrite("rounding_seed",
             &GraphOfConvexSetsOptions::rounding_seed, cls_doc.rounding_seed.doc)
+        .def_readwrite("parallelism", &GraphOfConvexSetsOptions::parallelism,
+            cls_doc.parallelism.doc)
+        .def_readwrite("reuse_program",
+            &GraphOfConvexSetsOptions::reuse_program,
+            cls_doc.reuse_program.doc)
         .def_property("solver_options",
             py::cpp_function(
                 [](GraphOfConvexSetsOptions& self) {
@@ -888,7 +954,9 @@ void DefineGeometryOptimization(py::module m) {
       options_cls  // BR
           .def(py::init<>(), options_cls_doc.ctor.doc)
           .def_readwrite("with_cross_y", &BaseClass::Options::with_cross_y,
-              options_cls_doc.with_cross_y.doc);
+              options_cls_doc.with_cross_y.doc)
+          .def_readwrite("parallelism", &BaseClass::Options::parallelism,
+              options_cls_doc.parallelism.doc);
       DefReprUsingSerialize(&options_cls);
     }
 
@@ -238,16 +238,19 @@ void DoScalarIndependentDefinitions(py::module m) {
             static_cast<void (Class::*)(ColorRenderCamera const&, ImageRgba8U*)
                     const>(&Class::RenderColorImage),
             py::arg("camera"), py::arg("color_image_out"),
+            py::call_guard<py::gil_scoped_release>(),
             cls_doc.RenderColorImage.doc)
         .def("RenderDepthImage",
             static_cast<void (Class::*)(DepthRenderCamera const&,
                 ImageDepth32F*) const>(&Class::RenderDepthImage),
             py::arg("camera"), py::arg("depth_image_out"),
+            py::call_guard<py::gil_scoped_release>(),
             cls_doc.RenderDepthImage.doc)
         .def("RenderLabelImage",
             static_cast<void (Class::*)(ColorRenderCamera const&,
                 ImageLabel16I*) const>(&Class::RenderLabelImage),
             py::arg("camera"), py::arg("label_image_out"),
+            py::call_guard<py::gil_scoped_release>(),
             cls_doc.RenderLabelImage.doc)
         .def("default_render_label",
             static_cast<RenderLabel (Class::*)() const>(
@@ -438,6 +438,7 @@ void DoScalarDependentDefinitions(py::module m, T) {
         .def("ComputeSignedDistancePairwiseClosestPoints",
             &QueryObject<T>::ComputeSignedDistancePairwiseClosestPoints,
             py::arg("max_distance") = std::numeric_limits<double>::infinity(),
+            py::arg("parallelize") = false,
             cls_doc.ComputeSignedDistancePairwiseClosestPoints.doc)
         .def("ComputeSignedDistancePairClosestPoints",
             &QueryObject<T>::ComputeSignedDistancePairClosestPoints,
@@ -445,16 +446,27 @@ void DoScalarDependentDefinitions(py::module m, T) {
             cls_doc.ComputeSignedDistancePairClosestPoints.doc)
         .def("ComputePointPairPenetration",
             &QueryObject<T>::ComputePointPairPenetration,
+            py::arg("parallelize") = false,
             cls_doc.ComputePointPairPenetration.doc)
         .def("ComputeSignedDistanceToPoint",
             &QueryObject<T>::ComputeSignedDistanceToPoint, py::arg("p_WQ"),
             py::arg("threshold") = std::numeric_limits<double>::infinity(),
             cls_doc.ComputeSignedDistanceToPoint.doc)
         .def("FindCollisionCandidates",
-            &QueryObject<T>::FindCollisionCandidates,
-            cls_doc.FindCollisionCandidates.doc)
-        .def("HasCollisions", &QueryObject<T>::HasCollisions,
-            cls_doc.HasCollisions.doc)
+            overload_cast_explicit<std::vector<SortedPair<GeometryId>>>(
+                &QueryObject<T>::FindCollisionCandidates),
+            cls_doc.FindCollisionCandidates.doc_0args)
+        .def("FindCollisionCandidates",
+            overload_cast_explicit<std::vector<SortedPair<GeometryId>>,
+                const GeometrySet&>(&QueryObject<T>::FindCollisionCandidates),
+            py::arg("geometry_set"), cls_doc.FindCollisionCandidates.doc_1args)
+        .def("HasCollisions",
+            overload_cast_explicit<bool>(&QueryObject<T>::HasCollisions),
+            cls_doc.HasCollisions.doc_0args)
+        .def("HasCollisions",
+            overload_cast_explicit<bool, const GeometrySet&>(
+                &QueryObject<T>::HasCollisions),
+            py::arg("geometry_set"), cls_doc.HasCollisions.doc_1args)
         .def(
             "RenderColorImage",
             [](const Class* self, const render::ColorRenderCamera& camera,
@@ -466,6 +478,7 @@ void DoScalarDependentDefinitions(py::module m, T) {
               return img;
             },
             py::arg("camera"), py::arg("parent_frame"), py::arg("X_PC"),
+            py::call_guard<py::gil_scoped_release>(),
             cls_doc.RenderColorImage.doc)
         .def(
             "RenderDepthImage",
@@ -478,6 +491,7 @@ void DoScalarDependentDefinitions(py::module m, T) {
               return img;
             },
             py::arg("camera"), py::arg("parent_frame"), py::arg("X_PC"),
+            py::call_guard<py::gil_scoped_release>(),
             cls_doc.RenderDepthImage.doc)
         .def(
             "RenderLabelImage",
@@ -490,27 +504,30 @@ void DoScalarDependentDefinitions(py::module m, T) {
               return img;
             },
             py::arg("camera"), py::arg("parent_frame"), py::arg("X_PC"),
+            py::call_guard<py::gil_scoped_release>(),
             cls_doc.RenderLabelImage.doc);
 
     if constexpr (scalar_predicate<T>::is_bool) {
       cls  // BR
           .def("ComputeContactSurfaces",
               &Class::template ComputeContactSurfaces<T>,
-              py::arg("representation"), cls_doc.ComputeContactSurfaces.doc)
+              py::arg("representation"), py::arg("parallelize") = false,
+              cls_doc.ComputeContactSurfaces.doc)
           .def(
               "ComputeContactSurfacesWithFallback",
               [](const Class* self,
-                  HydroelasticContactRepresentation representation) {
+                  HydroelasticContactRepresentation representation,
+                  Parallelism parallelize) {
                 // For the Python bindings, we'll use return values instead of
                 // output pointers.
                 std::vector<ContactSurface<T>> surfaces;
                 std::vector<PenetrationAsPointPair<T>> point_pairs;
                 self->template ComputeContactSurfacesWithFallback<T>(
-                    representation, &surfaces, &point_pairs);
+                    representation, &surfaces, &point_pairs, parallelize);
                 return std::make_pair(
                     std::move(surfaces), std::move(point_pairs));
               },
-              py::arg("representation"),
+              py::arg("representation"), py::arg("parallelize") = false,
               cls_doc.ComputeContactSurfacesWithFallback.doc);
     }
 
@@ -284,6 +284,10 @@ void DoScalarIndependentDefinitions(py::module m) {
             py::overload_cast<std::string_view,
                 const Eigen::Ref<const Eigen::Matrix4d>&>(&Class::SetTransform),
             py::arg("path"), py::arg("matrix"), cls_doc.SetTransform.doc_matrix)
+        .def("SetTransforms", &Class::SetTransforms, py::arg("paths"),
+            py::arg("X_ParentPaths"),
+            py::arg("time_in_recording") = std::nullopt,
+            cls_doc.SetTransforms.doc)
         .def("Delete", &Class::Delete, py::arg("path") = "", cls_doc.Delete.doc)
         .def("SetRealtimeRate", &Class::SetRealtimeRate, py::arg("rate"),
             cls_doc.SetRealtimeRate.doc)
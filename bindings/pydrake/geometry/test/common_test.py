@@ -297,6 +297,11 @@ class TestGeometryCore(unittest.TestCase):
         self.assertEqual(props.GetProperty("hydroelastic",
                                            "hydroelastic_modulus"), E)
 
+        props = mut.ProximityProperties()
+        mut.AddSignedDistanceFieldProperties(resolution=0.01, properties=props)
+        self.assertEqual(
+            props.GetProperty("signed_distance_field", "resolution"), 0.01)
+
     def test_rgba_api(self):
         default_white = mut.Rgba()
         self.assertEqual(default_white, mut.Rgba(1, 1, 1, 1))
@@ -6,7 +6,7 @@ import copy
 
 import numpy as np
 
-from pydrake.common import RandomGenerator, temp_directory
+from pydrake.common import Parallelism, RandomGenerator, temp_directory
 from pydrake.common.test_utilities.pickle_compare import assert_pickle
 from pydrake.geometry import (
     Box, Capsule, Cylinder, Convex, Ellipsoid, FramePoseVector, GeometryFrame,
@@ -175,6 +175,8 @@ class TestGeometryOptimization(unittest.TestCase):
         np.testing.assert_array_equal(hpoly.A(), self.A)
         np.testing.assert_array_equal(hpoly.b(), self.b)
         self.assertTrue(hpoly.PointInSet(x=[0, 0, 0], tol=0.0))
+        self.assertEqual(
+            hpoly.PointsInSet(points=np.zeros((3, 2)), tol=0.0), [True, True])
         self.assertFalse(hpoly.IsEmpty())
         self.assertFalse(hpoly.MaybeGetFeasiblePoint() is None)
         self.assertTrue(hpoly.PointInSet(hpoly.MaybeGetFeasiblePoint()))
@@ -243,6 +245,10 @@ class TestGeometryOptimization(unittest.TestCase):
         self.assertEqual(
             h_box.UniformSample(generator=generator,
                                 previous_sample=sample).shape, (3, ))
+        samples = h_box.UniformSamples(
+            generator=generator, initial_samples=np.zeros((3, 4)),
+            num_samples_per_chain=5, mixing_steps=3, thinning_steps=2)
+        self.assertEqual(samples.shape, (3, 20))
 
         h_half_box = mut.HPolyhedron.MakeBox(
             lb=[-0.5, -0.5, -0.5], ub=[0.5, 0.5, 0.5])
@@ -283,6 +289,19 @@ class TestGeometryOptimization(unittest.TestCase):
         self.assertEqual(hpoly.ambient_dimension(), 3)
         self.assertEqual(hpoly.A().shape, (4, 3))
 
+    def test_h_polyhedron_index(self):
+        boxes = [mut.HPolyhedron.MakeBox(lb=[i, 0], ub=[i + 1.5, 1])
+                 for i in range(3)]
+        dut = mut.HPolyhedronIndex(regions=boxes)
+        self.assertEqual(len(dut.regions()), 3)
+        self.assertEqual(dut.ambient_dimension(), 2)
+        self.assertEqual(dut.FindRegionsContainingPoint(x=[1.2, 0.5]), [0, 1])
+        self.assertEqual(
+            dut.FindRegionsContainingPoints(
+                points=np.array([[1.2, 5.0], [0.5, 0.5]]), tol=0.0,
+                parallelism=Parallelism(2)),
+            [[0, 1], []])
+
     def test_hyper_ellipsoid(self):
         mut.Hyperellipsoid()
         ellipsoid = mut.Hyperellipsoid(A=self.A, center=self.b)
@@ -556,6 +575,7 @@ class TestGeometryOptimization(unittest.TestCase):
         options.termination_threshold = 0.1
         options.relative_termination_threshold = 0.01
         options.random_seed = 1314
+        options.parallelism = Parallelism(2)
         options.starting_ellipse = mut.Hyperellipsoid.MakeUnitBall(3)
         options.bounding_region = mut.HPolyhedron.MakeBox(
             lb=[-6, -6, -6], ub=[6, 6, 6])
@@ -611,6 +631,16 @@ class TestGeometryOptimization(unittest.TestCase):
         self.assertEqual(region.ambient_dimension(), 1)
         self.assertTrue(region.PointInSet([1.0]))
         self.assertFalse(region.PointInSet([3.0]))
+        seeds_options = mut.IrisFromSeedsOptions()
+        seeds_options.parallelism = Parallelism(2)
+        seeds_options.avoid_completed_regions = True
+        seeds_options.completed_region_scale = 0.9
+        regions = mut.IrisInConfigurationSpaceFromSeeds(
+            plant=plant, root_context=context, seeds=[[0.0], [1.0]],
+            options=options, seeds_options=seeds_options)
+        self.assertEqual(len(regions), 2)
+        self.assertIsInstance(regions[0], mut.HPolyhedron)
+        self.assertIsNone(regions[1])
         options.configuration_obstacles = [mut.Point([-0.5])]
         point, = options.configuration_obstacles
         self.assertEqual(point.x(), [-0.5])
@@ -655,6 +685,8 @@ class TestGeometryOptimization(unittest.TestCase):
         options.max_rounding_trials = 5
         options.flow_tolerance = 1e-6
         options.rounding_seed = 1
+        options.parallelism = Parallelism(2)
+        options.reuse_program = True
         options.solver = ClpSolver()
         options.solver_options = SolverOptions()
         options.solver_options.SetOption(ClpSolver.id(), "scaling", 2)
@@ -986,6 +1018,8 @@ class TestCspaceFreePolytope(unittest.TestCase):
         self.assertFalse(options.with_cross_y)
         options.with_cross_y = True
         self.assertTrue(options.with_cross_y)
+        options.parallelism = Parallelism(2)
+        self.assertEqual(options.parallelism.num_threads(), 2)
         self.assertIn("with_cross_y", repr(options))
         self.assertNotIn("object at 0x", repr(options))
 
@@ -3,6 +3,7 @@ import pydrake.geometry as mut
 import unittest
 from math import pi
 
+from pydrake.common import Parallelism
 from pydrake.common.test_utilities import numpy_compare
 from pydrake.common.value import Value
 from pydrake.math import RigidTransform_
@@ -553,8 +554,14 @@ class TestGeometrySceneGraph(unittest.TestCase):
         # Proximity queries -- all of these will produce empty results.
         results = query_object.ComputeSignedDistancePairwiseClosestPoints()
         self.assertEqual(len(results), 0)
+        results = query_object.ComputeSignedDistancePairwiseClosestPoints(
+            max_distance=1.0, parallelize=Parallelism(2))
+        self.assertEqual(len(results), 0)
         results = query_object.ComputePointPairPenetration()
         self.assertEqual(len(results), 0)
+        results = query_object.ComputePointPairPenetration(
+            parallelize=Parallelism(2))
+        self.assertEqual(len(results), 0)
         if T != Expression:
             hydro_rep = mut.HydroelasticContactRepresentation.kTriangle
             results = query_object.ComputeContactSurfaces(
@@ -564,11 +571,23 @@ class TestGeometrySceneGraph(unittest.TestCase):
                 representation=hydro_rep)
             self.assertEqual(len(surfaces), 0)
             self.assertEqual(len(results), 0)
+            results = query_object.ComputeContactSurfaces(
+                representation=hydro_rep, parallelize=Parallelism(2))
+            self.assertEqual(len(results), 0)
+            surfaces, results = query_object.ComputeContactSurfacesWithFallback(  # noqa
+                representation=hydro_rep, parallelize=Parallelism(2))
+            self.assertEqual(len(surfaces), 0)
+            self.assertEqual(len(results), 0)
         results = query_object.ComputeSignedDistanceToPoint(p_WQ=(1, 2, 3))
         self.assertEqual(len(results), 0)
         results = query_object.FindCollisionCandidates()
         self.assertEqual(len(results), 0)
         self.assertFalse(query_object.HasCollisions())
+        results = query_object.FindCollisionCandidates(
+            geometry_set=mut.GeometrySet())
+        self.assertEqual(len(results), 0)
+        self.assertFalse(
+            query_object.HasCollisions(geometry_set=mut.GeometrySet()))
 
         # ComputeSignedDistancePairClosestPoints() requires two valid geometry
         # ids. There are none in this SceneGraph instance. Rather than
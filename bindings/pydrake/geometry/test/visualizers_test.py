@@ -109,6 +109,9 @@ class TestGeometryVisualizers(unittest.TestCase):
                              X_ParentPath=RigidTransform(),
                              time_in_recording=0.2)
         meshcat.SetTransform(path="/test/box", matrix=np.eye(4))
+        meshcat.SetTransforms(paths=["/test/box"],
+                              X_ParentPaths=[RigidTransform()],
+                              time_in_recording=0.2)
         self.assertTrue(meshcat.HasPath("/test/box"))
         cloud = PointCloud(4)
         cloud.mutable_xyzs()[:] = np.zeros((3, 4))
@@ -1183,6 +1183,10 @@ PYBIND11_MODULE(inverse_kinematics, m) {
             },
             py::arg("body_index"), py::arg("desired_orientation"),
             py::arg("angle_tol"), cls_doc.AddWorldOrientationConstraint.doc)
+        .def("UpdateWorldOrientationConstraint",
+            &Class::UpdateWorldOrientationConstraint, py::arg("binding"),
+            py::arg("desired_orientation"), py::arg("angle_tol"),
+            cls_doc.UpdateWorldOrientationConstraint.doc)
         .def(
             "AddPostureCost",
             [](Class* self, const Eigen::Ref<const Eigen::VectorXd>& q_desired,
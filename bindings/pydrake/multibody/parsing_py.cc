@@ -119,7 +119,11 @@ PYBIND11_MODULE(parsing, m) {
         .def("SetAutoRenaming", &Class::SetAutoRenaming, py::arg("value"),
             cls_doc.SetAutoRenaming.doc)
         .def("GetAutoRenaming", &Class::GetAutoRenaming,
-            cls_doc.GetAutoRenaming.doc);
+            cls_doc.GetAutoRenaming.doc)
+        .def("SetParallelism", &Class::SetParallelism,
+            py::arg("parallelism"), cls_doc.SetParallelism.doc)
+        .def("GetParallelism", &Class::GetParallelism,
+            cls_doc.GetParallelism.doc);
 
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wdeprecated-declarations"
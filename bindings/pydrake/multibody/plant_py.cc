@@ -476,6 +476,10 @@ void DoScalarDependentDefinitions(py::module m, T) {
             &Class::GetUniqueFreeBaseBodyOrThrow, py::arg("model_instance"),
             py_rvp::reference_internal,
             cls_doc.GetUniqueFreeBaseBodyOrThrow.doc)
+        .def("set_tree_parallelism", &Class::set_tree_parallelism,
+            py::arg("parallelism"), cls_doc.set_tree_parallelism.doc)
+        .def("get_tree_parallelism", &Class::get_tree_parallelism,
+            cls_doc.get_tree_parallelism.doc)
         .def(
             "EvalBodyPoseInWorld",
             [](const Class* self, const Context<T>& context,
@@ -484,6 +488,17 @@ void DoScalarDependentDefinitions(py::module m, T) {
             },
             py::arg("context"), py::arg("body"),
             cls_doc.EvalBodyPoseInWorld.doc)
+        .def(
+            "CalcAllBodyPosesInWorldBatch",
+            [](const Class* self, const Context<T>& context,
+                const Eigen::Ref<const MatrixX<T>>& q_batch) {
+              std::vector<std::vector<RigidTransform<T>>> X_WB_batch;
+              self->CalcAllBodyPosesInWorldBatch(
+                  context, q_batch, &X_WB_batch);
+              return X_WB_batch;
+            },
+            py::arg("context"), py::arg("q_batch"),
+            cls_doc.CalcAllBodyPosesInWorldBatch.doc)
         .def(
             "EvalBodySpatialVelocityInWorld",
             [](const Class* self, const Context<T>& context,
@@ -507,6 +522,22 @@ void DoScalarDependentDefinitions(py::module m, T) {
             py::arg("context"), py::arg("with_respect_to"), py::arg("frame_B"),
             py::arg("p_BoBp_B"), py::arg("frame_A"), py::arg("frame_E"),
             cls_doc.CalcJacobianSpatialVelocity.doc)
+        .def(
+            "CalcJacobiansSpatialVelocity",
+            [](const Class* self, const Context<T>& context,
+                JacobianWrtVariable with_respect_to,
+                const std::vector<const Frame<T>*>& frames_B,
+                const Eigen::Ref<const Matrix3X<T>>& p_BoBp_B,
+                const Frame<T>& frame_A, const Frame<T>& frame_E) {
+              MatrixX<T> Js_V_ABp_E(6 * frames_B.size(),
+                  GetVariableSize<T>(*self, with_respect_to));
+              self->CalcJacobiansSpatialVelocity(context, with_respect_to,
+                  frames_B, p_BoBp_B, frame_A, frame_E, &Js_V_ABp_E);
+              return Js_V_ABp_E;
+            },
+            py::arg("context"), py::arg("with_respect_to"),
+            py::arg("frames_B"), py::arg("p_BoBp_B"), py::arg("frame_A"),
+            py::arg("frame_E"), cls_doc.CalcJacobiansSpatialVelocity.doc)
         .def(
             "CalcJacobianAngularVelocity",
             [](const Class* self, const Context<T>& context,
@@ -606,6 +637,9 @@ void DoScalarDependentDefinitions(py::module m, T) {
               return H;
             },
             py::arg("context"), cls_doc.CalcMassMatrix.doc)
+        .def("CalcMassMatrixFactorization",
+            &Class::CalcMassMatrixFactorization, py::arg("context"),
+            cls_doc.CalcMassMatrixFactorization.doc)
         .def(
             "CalcBiasSpatialAcceleration",
             [](const Class* self, const systems::Context<T>& context,
@@ -641,6 +675,34 @@ void DoScalarDependentDefinitions(py::module m, T) {
         .def("CalcGravityGeneralizedForces",
             &Class::CalcGravityGeneralizedForces, py::arg("context"),
             cls_doc.CalcGravityGeneralizedForces.doc)
+        .def(
+            "CalcInverseDynamicsDerivatives",
+            [](const Class* self, const Context<T>& context,
+                const VectorX<T>& known_vdot) {
+              const int nv = self->num_velocities();
+              MatrixX<T> dtau_dq(nv, self->num_positions());
+              MatrixX<T> dtau_dv(nv, nv);
+              self->CalcInverseDynamicsDerivatives(
+                  context, known_vdot, &dtau_dq, &dtau_dv);
+              return std::make_pair(dtau_dq, dtau_dv);
+            },
+            py::arg("context"), py::arg("known_vdot"),
+            cls_doc.CalcInverseDynamicsDerivatives.doc)
+        .def(
+            "CalcForwardDynamicsDerivatives",
+            [](const Class* self, const Context<T>& context,
+                const VectorX<T>& tau) {
+              const int nv = self->num_velocities();
+              VectorX<T> vdot(nv);
+              MatrixX<T> dvdot_dq(nv, self->num_positions());
+              MatrixX<T> dvdot_dv(nv, nv);
+              MatrixX<T> dvdot_dtau(nv, nv);
+              self->CalcForwardDynamicsDerivatives(
+                  context, tau, &vdot, &dvdot_dq, &dvdot_dv, &dvdot_dtau);
+              return std::make_tuple(vdot, dvdot_dq, dvdot_dv, dvdot_dtau);
+            },
+            py::arg("context"), py::arg("tau"),
+            cls_doc.CalcForwardDynamicsDerivatives.doc)
         .def(
             "CalcGeneralizedForces",
             [](const Class* self, const Context<T>& context,
@@ -1034,6 +1096,12 @@ void DoScalarDependentDefinitions(py::module m, T) {
         .def("get_adjacent_bodies_collision_filters",
             &Class::get_adjacent_bodies_collision_filters,
             cls_doc.get_adjacent_bodies_collision_filters.doc)
+        .def("set_report_hydroelastic_quadrature_data",
+            &Class::set_report_hydroelastic_quadrature_data, py::arg("value"),
+            cls_doc.set_report_hydroelastic_quadrature_data.doc)
+        .def("get_report_hydroelastic_quadrature_data",
+            &Class::get_report_hydroelastic_quadrature_data,
+            cls_doc.get_report_hydroelastic_quadrature_data.doc)
         .def("AddPhysicalModel", &Class::AddPhysicalModel, py::arg("model"),
             cls_doc.AddPhysicalModel.doc)
         .def("physical_models", &Class::physical_models,
@@ -1558,6 +1626,9 @@ PYBIND11_MODULE(plant, m) {
         .def("SetWallBoundaryCondition", &Class::SetWallBoundaryCondition,
             py::arg("id"), py::arg("p_WQ"), py::arg("n_W"),
             cls_doc.SetWallBoundaryCondition.doc)
+        .def("SetParallelism", &Class::SetParallelism,
+            py::arg("parallelism"), cls_doc.SetParallelism.doc)
+        .def("parallelism", &Class::parallelism, cls_doc.parallelism.doc)
         .def("GetDiscreteStateIndex", &Class::GetDiscreteStateIndex,
             py::arg("id"), cls_doc.GetDiscreteStateIndex.doc)
         .def("GetReferencePositions", &Class::GetReferencePositions,
@@ -975,10 +975,16 @@ class TestGlobalInverseKinematics(unittest.TestCase):
             box_lb_F=[-np.inf, -np.inf, -np.inf],
             box_ub_F=[np.inf, np.inf, np.inf],
             X_WF=RigidTransform())
-        global_ik.AddWorldOrientationConstraint(
+        orientation = global_ik.AddWorldOrientationConstraint(
             body_index=body_index_A,
             desired_orientation=Quaternion(),
             angle_tol=np.inf)
+        global_ik.UpdateWorldOrientationConstraint(
+            binding=orientation,
+            desired_orientation=Quaternion(),
+            angle_tol=0.1)
+        self.assertAlmostEqual(
+            orientation.evaluator().lower_bound()[0], 2 * np.cos(0.1) + 1)
         global_ik.AddPostureCost(
             q_desired=plant.GetPositions(context),
             body_position_cost=[1] * plant.num_bodies(),
@@ -23,7 +23,7 @@ import os
 import re
 import unittest
 
-from pydrake.common import FindResourceOrThrow
+from pydrake.common import FindResourceOrThrow, Parallelism
 from pydrake.common.test_utilities.deprecation import catch_drake_warnings
 from pydrake.geometry import SceneGraph
 from pydrake.multibody.tree import (
@@ -230,6 +230,12 @@ class TestParsing(unittest.TestCase):
         results = parser.AddModelsFromString(model, 'urdf')
         self.assertTrue(plant.HasModelInstanceNamed('robot_1'))
 
+    def test_parallelism(self):
+        parser = Parser(plant=MultibodyPlant(time_step=0.01))
+        self.assertEqual(parser.GetParallelism().num_threads(), 1)
+        parser.SetParallelism(parallelism=Parallelism(2))
+        self.assertEqual(parser.GetParallelism().num_threads(), 2)
+
     def test_model_instance_info(self):
         """Checks that ModelInstanceInfo bindings exist."""
         ModelInstanceInfo.model_name
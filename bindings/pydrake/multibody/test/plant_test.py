@@ -37,6 +37,7 @@ from pydrake.multibody.tree import (
     JointIndex,
     LinearBushingRollPitchYaw_,
     LinearSpringDamper_,
+    MassMatrixFactorization_,
     ModelInstanceIndex,
     MultibodyForces_,
     PdControllerGains,
@@ -95,7 +96,7 @@ from pydrake.multibody.benchmarks.acrobot import (
     MakeAcrobotPlant,
 )
 from pydrake.common.cpp_param import List
-from pydrake.common import FindResourceOrThrow
+from pydrake.common import FindResourceOrThrow, Parallelism
 from pydrake.common.deprecation import install_numpy_warning_filters
 from pydrake.common.eigen_geometry import Quaternion_
 from pydrake.common.test_utilities import numpy_compare
@@ -1097,6 +1098,12 @@ class TestPlant(unittest.TestCase):
         X_WL = plant.CalcRelativeTransform(
             context, frame_A=world_frame, frame_B=base_frame)
         self.assertIsInstance(X_WL, RigidTransform)
+        q_batch = np.tile(plant.GetPositions(context), (3, 1)).T
+        X_WB_batch = plant.CalcAllBodyPosesInWorldBatch(
+            context=context, q_batch=q_batch)
+        self.assertEqual(len(X_WB_batch), plant.num_bodies())
+        self.assertEqual(len(X_WB_batch[base.index()]), 3)
+        self.assertIsInstance(X_WB_batch[base.index()][0], RigidTransform)
         free_bodies = plant.GetFloatingBaseBodies()
         self.assertEqual(len(free_bodies), 1)
         self.assertTrue(base.index() in free_bodies)
@@ -1158,6 +1165,13 @@ class TestPlant(unittest.TestCase):
             self.assert_sane(Js_V_ABp_E)
 
             self.assertEqual(Js_V_ABp_E.shape, (6, nw))
+            Js_V_ABp_E = plant.CalcJacobiansSpatialVelocity(
+                context=context, with_respect_to=wrt,
+                frames_B=[base_frame, world_frame],
+                p_BoBp_B=np.zeros((3, 2)), frame_A=world_frame,
+                frame_E=world_frame)
+            self.assert_sane(Js_V_ABp_E)
+            self.assertEqual(Js_V_ABp_E.shape, (12, nw))
             Js_w_AB_E = plant.CalcJacobianAngularVelocity(
                 context=context, with_respect_to=wrt, frame_B=base_frame,
                 frame_A=world_frame, frame_E=world_frame)
@@ -2582,6 +2596,11 @@ class TestPlant(unittest.TestCase):
         self.assert_sane(M)
         self.assertTrue(Cv.shape == (2, ))
         self.assert_sane(Cv, nonzero=False)
+        M_ltdl = plant.CalcMassMatrixFactorization(context)
+        self.assertIsInstance(M_ltdl, MassMatrixFactorization_[T])
+        self.assertEqual(M_ltdl.size(), 2)
+        self.assertEqual(M_ltdl.parents(), [-1, 0])
+        self.assertEqual(M_ltdl.Solve(b=M).shape, (2, 2))
         nv = plant.num_velocities()
         vd_d = np.zeros(nv)
         tau = plant.CalcInverseDynamics(
@@ -2597,6 +2616,18 @@ class TestPlant(unittest.TestCase):
         self.assertEqual(tau_g.shape, (nv,))
         self.assert_sane(tau_g, nonzero=True)
         plant.gravity_field().CalcGravityGeneralizedForces(context=context)
+        dtau_dq, dtau_dv = plant.CalcInverseDynamicsDerivatives(
+            context=context, known_vdot=vd_d)
+        self.assertEqual(dtau_dq.shape, (nv, 2))
+        self.assertEqual(dtau_dv.shape, (nv, nv))
+        if T != Expression:
+            vdot, dvdot_dq, dvdot_dv, dvdot_dtau = (
+                plant.CalcForwardDynamicsDerivatives(
+                    context=context, tau=np.zeros(nv)))
+            self.assertEqual(vdot.shape, (nv,))
+            self.assertEqual(dvdot_dq.shape, (nv, 2))
+            self.assertEqual(dvdot_dv.shape, (nv, nv))
+            self.assertEqual(dvdot_dtau.shape, (nv, nv))
 
         # Gravity is the only force element
         self.assertEqual(plant.num_force_elements(), 1)
@@ -2749,6 +2780,29 @@ class TestPlant(unittest.TestCase):
             self.assertEqual(plant.get_adjacent_bodies_collision_filters(),
                              value)
 
+    def test_report_hydroelastic_quadrature_data(self):
+        plant = MultibodyPlant_[float](0.1)
+        self.assertTrue(plant.get_report_hydroelastic_quadrature_data())
+        plant.set_report_hydroelastic_quadrature_data(value=False)
+        self.assertFalse(plant.get_report_hydroelastic_quadrature_data())
+
+    def test_mass_matrix_factorization(self):
+        M = np.array([[2., 1.], [1., 3.]])
+        dut = MassMatrixFactorization_[float](M=M, parents=[-1, 0])
+        self.assertEqual(dut.size(), 2)
+        self.assertEqual(dut.parents(), [-1, 0])
+        L = dut.CalcL()
+        D = dut.CalcD()
+        numpy_compare.assert_float_allclose(L.T @ np.diag(D) @ L, M)
+        numpy_compare.assert_float_allclose(dut.Solve(b=M), np.eye(2))
+        copy.copy(dut)
+
+    def test_tree_parallelism(self):
+        plant = MultibodyPlant_[float](0.0)
+        self.assertEqual(plant.get_tree_parallelism().num_threads(), 1)
+        plant.set_tree_parallelism(parallelism=Parallelism(2))
+        self.assertEqual(plant.get_tree_parallelism().num_threads(), 2)
+
     def test_contact_results_to_lcm(self):
         # ContactResultsToLcmSystem
         file_name = FindResourceOrThrow(
@@ -3052,6 +3106,9 @@ class TestPlant(unittest.TestCase):
         geometry_id = dut.GetGeometryId(body_id)
         self.assertEqual(dut.GetBodyId(geometry_id), body_id)
         dut.SetWallBoundaryCondition(body_id, [1, 1, -1], [0, 0, 1])
+        self.assertEqual(dut.parallelism().num_threads(), 1)
+        dut.SetParallelism(parallelism=Parallelism(2))
+        self.assertEqual(dut.parallelism().num_threads(), 2)
 
         # Verify that a body has been added to the model.
         self.assertEqual(dut.num_bodies(), 1)
@@ -21,6 +21,7 @@
 #include "drake/multibody/tree/joint_actuator.h"
 #include "drake/multibody/tree/linear_bushing_roll_pitch_yaw.h"
 #include "drake/multibody/tree/linear_spring_damper.h"
+#include "drake/multibody/tree/mass_matrix_factorization.h"
 #include "drake/multibody/tree/multibody_forces.h"
 #include "drake/multibody/tree/multibody_tree.h"
 #include "drake/multibody/tree/multibody_tree_indexes.h"
@@ -1068,6 +1069,23 @@ void DoScalarDependentDefinitions(py::module m, T) {
     DefCopyAndDeepCopy(&cls);
   }
 
+  // MassMatrixFactorization
+  {
+    using Class = MassMatrixFactorization<T>;
+    constexpr auto& cls_doc = doc.MassMatrixFactorization;
+    auto cls = DefineTemplateClassWithDefault<Class>(
+        m, "MassMatrixFactorization", param, cls_doc.doc);
+    cls  // BR
+        .def(py::init<MatrixX<T>, std::vector<int>>(), py::arg("M"),
+            py::arg("parents"), cls_doc.ctor.doc)
+        .def("size", &Class::size, cls_doc.size.doc)
+        .def("parents", &Class::parents, cls_doc.parents.doc)
+        .def("CalcL", &Class::CalcL, cls_doc.CalcL.doc)
+        .def("CalcD", &Class::CalcD, cls_doc.CalcD.doc)
+        .def("Solve", &Class::Solve, py::arg("b"), cls_doc.Solve.doc);
+    DefCopyAndDeepCopy(&cls);
+  }
+
   // Inertias
   {
     using Class = RotationalInertia<T>;
@@ -5,6 +5,8 @@
 #include "drake/perception/depth_image_to_point_cloud.h"
 #include "drake/perception/point_cloud.h"
 #include "drake/perception/point_cloud_to_lcm.h"
+#include "drake/perception/tsdf_integrator.h"
+#include "drake/perception/tsdf_volume.h"
 
 namespace drake {
 namespace pydrake {
@@ -139,11 +141,11 @@ void init_perception(py::module m) {
     py::class_<Class, LeafSystem<double>>(
         m, "DepthImageToPointCloud", cls_doc.doc)
         .def(py::init<const CameraInfo&, PixelType, float,
-                 pc_flags::BaseFieldT>(),
+                 pc_flags::BaseFieldT, Parallelism>(),
             py::arg("camera_info"),
             py::arg("pixel_type") = PixelType::kDepth32F,
             py::arg("scale") = 1.0, py::arg("fields") = pc_flags::kXYZs,
-            cls_doc.ctor.doc)
+            py::arg("parallelism") = false, cls_doc.ctor.doc)
         .def("depth_image_input_port", &Class::depth_image_input_port,
             py_rvp::reference_internal, cls_doc.depth_image_input_port.doc)
         .def("color_image_input_port", &Class::color_image_input_port,
@@ -154,6 +156,60 @@ void init_perception(py::module m) {
             py_rvp::reference_internal, cls_doc.point_cloud_output_port.doc);
   }
 
+  {
+    using Class = TsdfVolume;
+    constexpr auto& cls_doc = doc.TsdfVolume;
+    py::class_<Class> cls(m, "TsdfVolume", cls_doc.doc);
+    cls.def(py::init<double, double, double>(), py::arg("voxel_size"),
+           py::arg("truncation_distance"), py::arg("max_weight") = 64.0,
+           cls_doc.ctor.doc)
+        .def("voxel_size", &Class::voxel_size, cls_doc.voxel_size.doc)
+        .def("truncation_distance", &Class::truncation_distance,
+            cls_doc.truncation_distance.doc)
+        .def("max_weight", &Class::max_weight, cls_doc.max_weight.doc)
+        .def("num_blocks", &Class::num_blocks, cls_doc.num_blocks.doc)
+        .def("num_observed_voxels", &Class::num_observed_voxels,
+            cls_doc.num_observed_voxels.doc)
+        .def("Clear", &Class::Clear, cls_doc.Clear.doc)
+        .def("Integrate", &Class::Integrate, py::arg("camera_info"),
+            py::arg("X_WC"), py::arg("depth_image"),
+            py::arg("parallelism") = false, cls_doc.Integrate.doc)
+        .def("GetSignedDistance", &Class::GetSignedDistance, py::arg("p_WQ"),
+            cls_doc.GetSignedDistance.doc)
+        .def("ExtractSurfacePoints", &Class::ExtractSurfacePoints,
+            py::arg("parallelism") = false, cls_doc.ExtractSurfacePoints.doc);
+    DefCopyAndDeepCopy(&cls);
+  }
+
+  AddValueInstantiation<TsdfVolume>(m);
+
+  {
+    using Class = TsdfIntegrator;
+    constexpr auto& cls_doc = doc.TsdfIntegrator;
+    py::class_<Class, LeafSystem<double>>(m, "TsdfIntegrator", cls_doc.doc)
+        .def(py::init<std::vector<CameraInfo>, double, double, double,
+                 Parallelism>(),
+            py::arg("camera_infos"), py::arg("period_sec"),
+            py::arg("voxel_size"), py::arg("truncation_distance"),
+            py::arg("parallelism") = false, cls_doc.ctor.doc)
+        .def("num_cameras", &Class::num_cameras, cls_doc.num_cameras.doc)
+        .def("depth_image_input_port", &Class::depth_image_input_port,
+            py::arg("camera_index"), py_rvp::reference_internal,
+            cls_doc.depth_image_input_port.doc)
+        .def("camera_pose_input_port", &Class::camera_pose_input_port,
+            py::arg("camera_index"), py_rvp::reference_internal,
+            cls_doc.camera_pose_input_port.doc)
+        .def("tsdf_volume_output_port", &Class::tsdf_volume_output_port,
+            py_rvp::reference_internal, cls_doc.tsdf_volume_output_port.doc)
+        .def("point_cloud_output_port", &Class::point_cloud_output_port,
+            py_rvp::reference_internal, cls_doc.point_cloud_output_port.doc)
+        .def("get_tsdf_volume", &Class::get_tsdf_volume, py::arg("context"),
+            py_rvp::reference_internal, cls_doc.get_tsdf_volume.doc)
+        .def("get_mutable_tsdf_volume", &Class::get_mutable_tsdf_volume,
+            py::arg("context"), py_rvp::reference_internal,
+            cls_doc.get_mutable_tsdf_volume.doc);
+  }
+
   {
     using Class = PointCloudToLcm;
     constexpr auto& cls_doc = doc.PointCloudToLcm;
@@ -23,6 +23,11 @@ void DefinePlanningCollisionChecker(py::module m) {
   {
     using Class = CollisionChecker;
     constexpr auto& cls_doc = doc.CollisionChecker;
+    // The batch queries release the GIL, so that other Python threads can run
+    // meanwhile. This also lets worker threads call a configuration distance
+    // or interpolation function implemented in Python (which reacquires the
+    // GIL), instead of deadlocking on the GIL held by the calling thread.
+    using ReleaseGil = py::call_guard<py::gil_scoped_release>;
     py::class_<Class> cls(m, "CollisionChecker", cls_doc.doc);
     cls  // BR
         .def("model", &Class::model, py_rvp::reference_internal,
@@ -79,6 +84,12 @@ void DefinePlanningCollisionChecker(py::module m) {
                 std::vector<BodyShapeDescription>>&>(
                 &Class::AddCollisionShapes),
             py::arg("geometry_groups"), cls_doc.AddCollisionShapes.doc_1args)
+        .def("UpdateCollisionShapes", &Class::UpdateCollisionShapes,
+            py::arg("groups_to_remove"), py::arg("groups_to_add"),
+            cls_doc.UpdateCollisionShapes.doc)
+        .def("ReplaceCollisionShapes", &Class::ReplaceCollisionShapes,
+            py::arg("group_name"), py::arg("descriptions"),
+            cls_doc.ReplaceCollisionShapes.doc)
         .def("AddCollisionShapeToFrame", &Class::AddCollisionShapeToFrame,
             py::arg("group_name"), py::arg("frameA"), py::arg("shape"),
             py::arg("X_AG"), cls_doc.AddCollisionShapeToFrame.doc)
@@ -179,6 +190,13 @@ void DefinePlanningCollisionChecker(py::module m) {
                 &Class::SetCollisionFilteredWithAllBodies),
             py::arg("body"),
             cls_doc.SetCollisionFilteredWithAllBodies.doc_1args_body)
+        .def("LockJoints", &Class::LockJoints, py::arg("joints"), py::arg("q"),
+            cls_doc.LockJoints.doc)
+        .def("UnlockJoints", &Class::UnlockJoints, cls_doc.UnlockJoints.doc)
+        .def("GetLockedJoints", &Class::GetLockedJoints,
+            cls_doc.GetLockedJoints.doc)
+        .def("IsBodyLocked", &Class::IsBodyLocked, py::arg("body_index"),
+            cls_doc.IsBodyLocked.doc)
         .def("CheckConfigCollisionFree", &Class::CheckConfigCollisionFree,
             py::arg("q"), py::arg("context_number") = std::nullopt,
             cls_doc.CheckConfigCollisionFree.doc)
@@ -186,7 +204,7 @@ void DefinePlanningCollisionChecker(py::module m) {
             &Class::CheckContextConfigCollisionFree, py::arg("model_context"),
             py::arg("q"), cls_doc.CheckContextConfigCollisionFree.doc)
         .def("CheckConfigsCollisionFree", &Class::CheckConfigsCollisionFree,
-            py::arg("configs"), py::arg("parallelize") = true,
+            py::arg("configs"), py::arg("parallelize") = true, ReleaseGil(),
             cls_doc.CheckConfigsCollisionFree.doc)
         .def("SetDistanceAndInterpolationProvider",
             &Class::SetDistanceAndInterpolationProvider, py::arg("provider"),
@@ -229,10 +247,10 @@ void DefinePlanningCollisionChecker(py::module m) {
             py::arg("q1"), py::arg("q2"))
         .def("CheckEdgeCollisionFreeParallel",
             &Class::CheckEdgeCollisionFreeParallel, py::arg("q1"),
-            py::arg("q2"), py::arg("parallelize") = true,
+            py::arg("q2"), py::arg("parallelize") = true, ReleaseGil(),
             cls_doc.CheckEdgeCollisionFreeParallel.doc)
         .def("CheckEdgesCollisionFree", &Class::CheckEdgesCollisionFree,
-            py::arg("edges"), py::arg("parallelize") = true,
+            py::arg("edges"), py::arg("parallelize") = true, ReleaseGil(),
             cls_doc.CheckEdgesCollisionFree.doc)
         .def("MeasureEdgeCollisionFree", &Class::MeasureEdgeCollisionFree,
             py::arg("q1"), py::arg("q2"),
@@ -244,15 +262,22 @@ void DefinePlanningCollisionChecker(py::module m) {
             cls_doc.MeasureContextEdgeCollisionFree.doc)
         .def("MeasureEdgeCollisionFreeParallel",
             &Class::MeasureEdgeCollisionFreeParallel, py::arg("q1"),
-            py::arg("q2"), py::arg("parallelize") = true,
+            py::arg("q2"), py::arg("parallelize") = true, ReleaseGil(),
             cls_doc.MeasureEdgeCollisionFreeParallel.doc)
         .def("MeasureEdgesCollisionFree", &Class::MeasureEdgesCollisionFree,
-            py::arg("edges"), py::arg("parallelize") = true,
+            py::arg("edges"), py::arg("parallelize") = true, ReleaseGil(),
             cls_doc.MeasureEdgesCollisionFree.doc)
         .def("CalcRobotClearance", &Class::CalcRobotClearance, py::arg("q"),
             py::arg("influence_distance"),
             py::arg("context_number") = std::nullopt,
             cls_doc.CalcRobotClearance.doc)
+        .def("CalcRobotClearances",
+            overload_cast_explicit<std::vector<RobotClearance>,
+                const std::vector<Eigen::VectorXd>&, double, Parallelism>(
+                &Class::CalcRobotClearances),
+            py::arg("configs"), py::arg("influence_distance"),
+            py::arg("parallelize") = true, ReleaseGil(),
+            cls_doc.CalcRobotClearances.doc_3args)
         .def("CalcContextRobotClearance", &Class::CalcContextRobotClearance,
             py::arg("model_context"), py::arg("q"),
             py::arg("influence_distance"),
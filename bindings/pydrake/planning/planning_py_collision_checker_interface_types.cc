@@ -72,8 +72,16 @@ void DefinePlanningCollisionCheckerInterfaceTypes(py::module m) {
             &Class::ComputeConfigurationDistance,
             cls_doc.ComputeConfigurationDistance.doc)
         .def("InterpolateBetweenConfigurations",
-            &Class::InterpolateBetweenConfigurations,
-            cls_doc.InterpolateBetweenConfigurations.doc);
+            overload_cast_explicit<Eigen::VectorXd, const Eigen::VectorXd&,
+                const Eigen::VectorXd&, double>(
+                &Class::InterpolateBetweenConfigurations),
+            cls_doc.InterpolateBetweenConfigurations.doc_3args_from_to_ratio)
+        .def("InterpolateBetweenConfigurations",
+            overload_cast_explicit<std::vector<Eigen::VectorXd>,
+                const Eigen::VectorXd&, const Eigen::VectorXd&,
+                const std::vector<double>&>(
+                &Class::InterpolateBetweenConfigurations),
+            cls_doc.InterpolateBetweenConfigurations.doc_3args_from_to_ratios);
   }
 
   {
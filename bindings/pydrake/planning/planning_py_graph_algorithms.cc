@@ -1,6 +1,8 @@
 #include "drake/bindings/pydrake/documentation_pybind.h"
 #include "drake/bindings/pydrake/pydrake_pybind.h"
 #include "drake/planning/graph_algorithms/max_clique_solver_base.h"
+#include "drake/planning/graph_algorithms/max_clique_solver_via_branch_and_bound.h"
+#include "drake/planning/graph_algorithms/max_clique_solver_via_greedy.h"
 #include "drake/planning/graph_algorithms/max_clique_solver_via_mip.h"
 
 namespace drake {
@@ -48,6 +50,26 @@ void DefinePlanningGraphAlgorithms(py::module m) {
         .def("GetInitialGuess", &MaxCliqueSolverViaMip::GetInitialGuess,
             cls_doc.GetInitialGuess.doc);
   }
+  {
+    const auto& cls_doc = doc.MaxCliqueSolverViaBranchAndBound;
+    py::class_<MaxCliqueSolverViaBranchAndBound, MaxCliqueSolverBase>(
+        m, "MaxCliqueSolverViaBranchAndBound", cls_doc.doc)
+        .def(py::init<>(), cls_doc.ctor.doc)
+        .def(py::init<Parallelism>(), py::arg("parallelism"),
+            cls_doc.ctor.doc)
+        .def("SetParallelism",
+            &MaxCliqueSolverViaBranchAndBound::SetParallelism,
+            py::arg("parallelism"), cls_doc.SetParallelism.doc)
+        .def("GetParallelism",
+            &MaxCliqueSolverViaBranchAndBound::GetParallelism,
+            cls_doc.GetParallelism.doc);
+  }
+  {
+    const auto& cls_doc = doc.MaxCliqueSolverViaGreedy;
+    py::class_<MaxCliqueSolverViaGreedy, MaxCliqueSolverBase>(
+        m, "MaxCliqueSolverViaGreedy", cls_doc.doc)
+        .def(py::init<>(), cls_doc.ctor.doc);
+  }
 }
 
 }  // namespace internal
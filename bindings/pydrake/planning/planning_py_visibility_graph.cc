@@ -1,3 +1,5 @@
+#include <limits>
+
 #include "drake/bindings/pydrake/documentation_pybind.h"
 #include "drake/bindings/pydrake/pydrake_pybind.h"
 #include "drake/planning/visibility_graph.h"
@@ -13,6 +15,7 @@ void DefinePlanningVisibilityGraph(py::module m) {
 
   m.def("VisibilityGraph", &planning::VisibilityGraph, py::arg("checker"),
       py::arg("points"), py::arg("parallelize") = true,
+      py::arg("max_distance") = std::numeric_limits<double>::infinity(),
       doc.VisibilityGraph.doc);
 }
 
@@ -302,6 +302,11 @@ class TestCollisionChecker(unittest.TestCase):
             group_name="bar", descriptions=[body_shape_description])
         dut.AddCollisionShapes(
             geometry_groups={"baz": [body_shape_description]})
+        dut.UpdateCollisionShapes(
+            groups_to_remove=["baz"],
+            groups_to_add={"baz": [body_shape_description]})
+        dut.ReplaceCollisionShapes(
+            group_name="bar", descriptions=[body_shape_description])
         dut.AddCollisionShapeToFrame(
             group_name="quux", frameA=frame, shape=shape, X_AG=X)
         dut.AddCollisionShapeToBody(
@@ -345,6 +350,10 @@ class TestCollisionChecker(unittest.TestCase):
             bodyA=env_body, bodyB=body, filter_collision=True)
         dut.SetCollisionFilteredWithAllBodies(body_index=body.index())
         dut.SetCollisionFilteredWithAllBodies(body=body)
+        dut.LockJoints(joints=[], q=q)
+        self.assertEqual(dut.GetLockedJoints(), [])
+        self.assertFalse(dut.IsBodyLocked(body_index=body.index()))
+        dut.UnlockJoints()
 
         dut.CheckConfigCollisionFree(q=q)
         dut.CheckConfigCollisionFree(q=q, context_number=1)
@@ -408,6 +417,11 @@ class TestCollisionChecker(unittest.TestCase):
         clearance = dut.CalcContextRobotClearance(
             model_context=ccc, q=q, influence_distance=10)
         self.assertIsInstance(clearance, mut.RobotClearance)
+        clearances = dut.CalcRobotClearances(
+            configs=[q]*3, influence_distance=10, parallelize=False)
+        self.assertEqual(len(clearances), 3)
+        self.assertIsInstance(clearances[0], mut.RobotClearance)
+        dut.CalcRobotClearances([q], 10)  # Omit the defaulted arg.
 
         dut.MaxNumDistances()
         dut.MaxNumDistances(context_number=1)
@@ -474,3 +488,8 @@ class TestCollisionChecker(unittest.TestCase):
                                 parallelize=False)
         self.assertEqual(A.shape, (num_points, num_points))
         self.assertIsInstance(A, scipy.sparse.csc_matrix)
+        A = mut.VisibilityGraph(checker=checker,
+                                points=points,
+                                parallelize=False,
+                                max_distance=0.01)
+        self.assertEqual(A.shape, (num_points, num_points))
@@ -3,6 +3,7 @@ import unittest
 import numpy as np
 import scipy.sparse as sp
 
+from pydrake.common import Parallelism
 import pydrake.planning as mut
 from pydrake.solvers import (SolverOptions, CommonSolverOption,
                              MosekSolver, GurobiSolver)
@@ -89,3 +90,26 @@ class TestGraphAlgorithms(unittest.TestCase):
             max_clique = solver.SolveMaxClique(graph)
             # Butteryfly graph has a max clique of 3.
             self.assertEqual(max_clique.sum(), 3)
+
+    def test_max_clique_solver_via_branch_and_bound_methods(self):
+        graph = self._butteryfly_graph()
+
+        solver_default = mut.MaxCliqueSolverViaBranchAndBound()
+        self.assertEqual(solver_default.GetParallelism().num_threads(),
+                         Parallelism.Max().num_threads())
+
+        solver = mut.MaxCliqueSolverViaBranchAndBound(
+            parallelism=Parallelism(2))
+        self.assertEqual(solver.GetParallelism().num_threads(), 2)
+        solver.SetParallelism(parallelism=Parallelism(1))
+        self.assertEqual(solver.GetParallelism().num_threads(), 1)
+
+        max_clique = solver.SolveMaxClique(graph)
+        # Butteryfly graph has a max clique of 3.
+        self.assertEqual(max_clique.sum(), 3)
+
+    def test_max_clique_solver_via_greedy(self):
+        graph = self._butteryfly_graph()
+        solver = mut.MaxCliqueSolverViaGreedy()
+        max_clique = solver.SolveMaxClique(graph)
+        self.assertEqual(max_clique.sum(), 3)
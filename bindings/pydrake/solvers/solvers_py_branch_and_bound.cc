@@ -24,6 +24,8 @@ void DefineSolversBranchAndBound(py::module m) {
       py::class_<Nested> options_cls(bnb_cls, "Options", options_doc.doc);
       options_cls.def(ParamInit<Nested>());
       DefAttributesUsingSerialize(&options_cls, options_doc);
+      options_cls.def_readwrite("parallelism", &Nested::parallelism,
+          options_doc.parallelism.doc);
       DefReprUsingSerialize(&options_cls);
       DefCopyAndDeepCopy(&options_cls);
     }
@@ -307,7 +307,8 @@ void BindSolverInterfaceAndFlags(py::module m) {
             self.Solve(prog, initial_guess, solver_options, result);
           },
           py::arg("prog"), py::arg("initial_guess"), py::arg("solver_options"),
-          py::arg("result"), doc.SolverInterface.Solve.doc)
+          py::arg("result"), py::call_guard<py::gil_scoped_release>(),
+          doc.SolverInterface.Solve.doc)
       .def(
           "Solve",
           // This method really lives on SolverBase, but we manually write it
@@ -320,7 +321,8 @@ void BindSolverInterfaceAndFlags(py::module m) {
             return result;
           },
           py::arg("prog"), py::arg("initial_guess") = std::nullopt,
-          py::arg("solver_options") = std::nullopt, doc.SolverBase.Solve.doc)
+          py::arg("solver_options") = std::nullopt,
+          py::call_guard<py::gil_scoped_release>(), doc.SolverBase.Solve.doc)
       // TODO(m-chaturvedi) Add Pybind11 documentation.
       .def("solver_type",
           [](const SolverInterface& self) {
@@ -425,6 +427,8 @@ void BindSolverInterfaceAndFlags(py::module m) {
           doc.SolverOptions.get_print_file_name.doc)
       .def("get_print_to_console", &SolverOptions::get_print_to_console,
           doc.SolverOptions.get_print_to_console.doc)
+      .def("get_max_threads", &SolverOptions::get_max_threads,
+          doc.SolverOptions.get_max_threads.doc)
       .def("__repr__", [](const SolverOptions&) -> std::string {
         // This is a minimal implementation that serves to avoid displaying
         // memory addresses in pydrake docs and help strings. In the future,
@@ -437,7 +441,9 @@ void BindSolverInterfaceAndFlags(py::module m) {
       .value("kPrintFileName", CommonSolverOption::kPrintFileName,
           doc.CommonSolverOption.kPrintFileName.doc)
       .value("kPrintToConsole", CommonSolverOption::kPrintToConsole,
-          doc.CommonSolverOption.kPrintToConsole.doc);
+          doc.CommonSolverOption.kPrintToConsole.doc)
+      .value("kMaxThreads", CommonSolverOption::kMaxThreads,
+          doc.CommonSolverOption.kMaxThreads.doc);
 }
 
 void BindMathematicalProgram(py::module m) {
@@ -1437,8 +1443,11 @@ void BindMathematicalProgram(py::module m) {
           &MathematicalProgram::FindDecisionVariableIndex, py::arg("var"),
           doc.MathematicalProgram.FindDecisionVariableIndex.doc)
       .def("FindDecisionVariableIndices",
-          &MathematicalProgram::FindDecisionVariableIndices, py::arg("vars"),
-          doc.MathematicalProgram.FindDecisionVariableIndices.doc)
+          overload_cast_explicit<std::vector<int>,
+              const Eigen::Ref<const VectorXDecisionVariable>&>(
+              &MathematicalProgram::FindDecisionVariableIndices),
+          py::arg("vars"),
+          doc.MathematicalProgram.FindDecisionVariableIndices.doc_1args_vars)
       .def("FindIndeterminateIndex",
           &MathematicalProgram::FindIndeterminateIndex, py::arg("var"),
           doc.MathematicalProgram.FindIndeterminateIndex.doc)
@@ -1620,7 +1629,14 @@ void BindFreeFunctions(py::module m) {
               const std::optional<Eigen::VectorXd>&,
               const std::optional<SolverOptions>&>(&solvers::Solve),
           py::arg("prog"), py::arg("initial_guess") = py::none(),
-          py::arg("solver_options") = py::none(), doc.Solve.doc_3args)
+          py::arg("solver_options") = py::none(),
+          py::call_guard<py::gil_scoped_release>(), doc.Solve.doc_3args)
+      .def("SolveInParallel", &solvers::SolveInParallel, py::arg("progs"),
+          py::arg("initial_guesses") =
+              std::vector<std::optional<Eigen::VectorXd>>{},
+          py::arg("solver_options") = py::none(),
+          py::arg("parallelism") = Parallelism::Max(),
+          py::call_guard<py::gil_scoped_release>(), doc.SolveInParallel.doc)
       .def("GetProgramType", &solvers::GetProgramType, doc.GetProgramType.doc);
 }
 
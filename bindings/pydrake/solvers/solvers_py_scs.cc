@@ -15,7 +15,11 @@ void DefineSolversScs(py::module m) {
 
   py::class_<ScsSolver, SolverInterface>(m, "ScsSolver", doc.ScsSolver.doc)
       .def(py::init<>(), doc.ScsSolver.ctor.doc)
-      .def_static("id", &ScsSolver::id, doc.ScsSolver.id.doc);
+      .def_static("id", &ScsSolver::id, doc.ScsSolver.id.doc)
+      .def("set_reuse_workspace", &ScsSolver::set_reuse_workspace,
+          py::arg("reuse_workspace"), doc.ScsSolver.set_reuse_workspace.doc)
+      .def("reuse_workspace", &ScsSolver::reuse_workspace,
+          doc.ScsSolver.reuse_workspace.doc);
 
   py::class_<ScsSolverDetails>(m, "ScsSolverDetails", doc.ScsSolverDetails.doc)
       .def_readonly("scs_status", &ScsSolverDetails::scs_status,
@@ -44,7 +48,9 @@ void DefineSolversScs(py::module m) {
       .def_readonly("scs_solve_time", &ScsSolverDetails::scs_solve_time,
           doc.ScsSolverDetails.scs_solve_time.doc)
       .def_readonly("y", &ScsSolverDetails::y, doc.ScsSolverDetails.y.doc)
-      .def_readonly("s", &ScsSolverDetails::s, doc.ScsSolverDetails.s.doc);
+      .def_readonly("s", &ScsSolverDetails::s, doc.ScsSolverDetails.s.doc)
+      .def_readonly("reused_workspace", &ScsSolverDetails::reused_workspace,
+          doc.ScsSolverDetails.reused_workspace.doc);
   AddValueInstantiation<ScsSolverDetails>(m);
 }
 
@@ -14,6 +14,9 @@ void DefineSolversSemidefiniteRelaxation(py::module m) {
 
   m.def("MakeSemidefiniteRelaxation", &solvers::MakeSemidefiniteRelaxation,
       py::arg("prog"), doc.MakeSemidefiniteRelaxation.doc);
+  m.def("DecomposePsdConstraintsByChordalSparsity",
+      &solvers::DecomposePsdConstraintsByChordalSparsity, py::arg("prog"),
+      doc.DecomposePsdConstraintsByChordalSparsity.doc);
 }
 
 }  // namespace internal
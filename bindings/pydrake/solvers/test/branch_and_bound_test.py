@@ -3,6 +3,7 @@ import unittest
 
 import numpy as np
 
+from pydrake.common import Parallelism
 from pydrake.solvers import (
     MathematicalProgram,
     MixedIntegerBranchAndBound,
@@ -51,6 +52,8 @@ class TestMixedIntegerBranchAndBound(unittest.TestCase):
         options.max_explored_nodes = 1
         self.assertEqual(options.max_explored_nodes, 1)
         self.assertIn("max_explored_nodes=", repr(options))
+        options.parallelism = Parallelism(2)
+        self.assertEqual(options.parallelism.num_threads(), 2)
         copy.copy(options)
 
         dut2 = MixedIntegerBranchAndBound(
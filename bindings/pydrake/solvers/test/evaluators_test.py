@@ -17,6 +17,7 @@ class TestCost(unittest.TestCase):
         cost = mp.LinearCost(a, b)
         np.testing.assert_allclose(cost.a(), a)
         self.assertEqual(cost.b(), b)
+        self.assertTrue(cost.is_thread_safe())
 
     def test_quadratic_cost(self):
         Q = np.array([[1., 2.], [2., 3.]])
@@ -81,6 +82,7 @@ class TestCost(unittest.TestCase):
         cost = mp.ExpressionCost(e=e)
         self.assertTrue(e.EqualTo(cost.expression()))
         self.assertEqual(sym.Variables(cost.vars()), sym.Variables([x, y]))
+        self.assertFalse(cost.is_thread_safe())
 
     def test_to_latex(self):
         x = sym.Variable("x")
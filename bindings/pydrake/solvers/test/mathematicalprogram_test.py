@@ -7,7 +7,7 @@ import numpy as np
 import scipy.sparse
 
 from pydrake.autodiffutils import AutoDiffXd
-from pydrake.common import kDrakeAssertIsArmed
+from pydrake.common import kDrakeAssertIsArmed, Parallelism
 from pydrake.common.test_utilities import numpy_compare
 from pydrake.forwarddiff import jacobian
 from pydrake.math import ge
@@ -219,6 +219,22 @@ class TestMathematicalProgram(unittest.TestCase):
         x_expected = np.array([1, 1])
         self.assertTrue(np.allclose(result.GetSolution(x), x_expected))
 
+    def test_solve_in_parallel(self):
+        progs = []
+        for i in range(4):
+            prog = mp.MathematicalProgram()
+            x = prog.NewContinuousVariables(2, "x")
+            prog.AddLinearEqualityConstraint(np.eye(2), [i, 1], x)
+            progs.append(prog)
+        results = mp.SolveInParallel(
+            progs=progs, initial_guesses=[np.zeros(2)] * 4,
+            solver_options=None, parallelism=Parallelism(2))
+        self.assertEqual(len(results), 4)
+        for i, result in enumerate(results):
+            self.assertTrue(result.is_success())
+            np.testing.assert_allclose(result.get_x_val(), [i, 1])
+        self.assertEqual(len(mp.SolveInParallel(progs=progs)), 4)
+
     def test_symbolic_qp(self):
         prog = mp.MathematicalProgram()
         x = prog.NewContinuousVariables(2, "x")
@@ -891,6 +907,10 @@ class TestMathematicalProgram(unittest.TestCase):
         self.assertEqual(
             constraint_evaluator.gradient_sparsity_pattern(),
             [(0, 1)])
+        y, dydx = constraint_evaluator.EvalWithSparseGradient(x=[1., 2.])
+        numpy_compare.assert_float_equal(y, [4.])
+        self.assertIsInstance(dydx, scipy.sparse.csc_matrix)
+        numpy_compare.assert_float_equal(dydx.toarray(), [[0., 4.]])
 
     def test_pycost_and_pyconstraint(self):
         prog = mp.MathematicalProgram()
@@ -1287,11 +1307,13 @@ class TestMathematicalProgram(unittest.TestCase):
         options_object.SetOption(mp.CommonSolverOption.kPrintToConsole, 1)
         options_object.SetOption(
             mp.CommonSolverOption.kPrintFileName, "foo.txt")
+        options_object.SetOption(mp.CommonSolverOption.kMaxThreads, 2)
         options = options_object.GetOptions(solver_id)
         self.assertDictEqual(
             options, {"double_key": 1.0, "int_key": 2, "string_key": "3"})
         self.assertEqual(options_object.get_print_to_console(), True)
         self.assertEqual(options_object.get_print_file_name(), "foo.txt")
+        self.assertEqual(options_object.get_max_threads(), 2)
 
         prog.SetSolverOptions(options_object)
         prog_options = prog.GetSolverOptions(solver_id)
@@ -31,6 +31,15 @@ class TestOsqpSolver(unittest.TestCase):
         np.testing.assert_allclose(result.GetDualSolution(constraint1), [1.])
         np.testing.assert_allclose(result.GetDualSolution(constraint2), [1.])
 
+        solver.set_reuse_workspace(reuse_workspace=True)
+        self.assertTrue(solver.reuse_workspace())
+        for i in range(2):
+            result = solver.Solve(prog, None, None)
+            self.assertTrue(result.is_success())
+            self.assertTrue(np.allclose(result.GetSolution(x), x_expected))
+            self.assertEqual(
+                result.get_solver_details().reused_workspace, i == 1)
+
     def unavailable(self):
         """Per the BUILD file, this test is only run when OSQP is disabled."""
         solver = OsqpSolver()
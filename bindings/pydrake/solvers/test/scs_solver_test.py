@@ -41,6 +41,16 @@ class TestScsSolver(unittest.TestCase):
         numpy_compare.assert_float_allclose(
             result.get_solver_details().y, np.array([1., 1.]), atol=atol)
 
+        solver.set_reuse_workspace(reuse_workspace=True)
+        self.assertTrue(solver.reuse_workspace())
+        for i in range(2):
+            result = solver.Solve(prog, None, None)
+            self.assertTrue(result.is_success())
+            numpy_compare.assert_float_allclose(
+                result.GetSolution(x), [1.0, 1.0], atol=atol)
+            self.assertEqual(
+                result.get_solver_details().reused_workspace, i == 1)
+
     def unavailable(self):
         """Per the BUILD file, this test is only run when SCS is disabled."""
         solver = ScsSolver()
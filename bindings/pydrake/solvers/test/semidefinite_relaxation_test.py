@@ -2,6 +2,7 @@ import numpy as np
 import unittest
 
 from pydrake.solvers import (
+    DecomposePsdConstraintsByChordalSparsity,
     MakeSemidefiniteRelaxation,
     MathematicalProgram,
 )
@@ -22,3 +23,12 @@ class TestSemidefiniteRelaxation(unittest.TestCase):
                          1)
         self.assertEqual(len(relaxation.bounding_box_constraints()), 1)
         self.assertEqual(len(relaxation.linear_constraints()), 2)
+
+    def test_DecomposePsdConstraintsByChordalSparsity(self):
+        prog = MathematicalProgram()
+        X = prog.NewSymmetricContinuousVariables(3, "X")
+        prog.AddPositiveSemidefiniteConstraint(X)
+        prog.AddBoundingBoxConstraint(-1, 1, [X[1, 0], X[2, 1]])
+        self.assertEqual(DecomposePsdConstraintsByChordalSparsity(prog=prog),
+                         1)
+        self.assertEqual(len(prog.positive_semidefinite_constraints()), 2)
@@ -6,6 +6,7 @@
 #include "drake/bindings/pydrake/documentation_pybind.h"
 #include "drake/bindings/pydrake/pydrake_pybind.h"
 #include "drake/common/scope_exit.h"
+#include "drake/systems/analysis/batched_simulator.h"
 #include "drake/systems/analysis/integrator_base.h"
 #include "drake/systems/analysis/monte_carlo.h"
 #include "drake/systems/analysis/region_of_attraction.h"
@@ -28,6 +29,8 @@ namespace {
 // https://docs.python.org/3/c-api/exceptions.html#c.PyErr_CheckSignals
 // https://pybind11.readthedocs.io/en/stable/faq.html#how-can-i-properly-handle-ctrl-c-in-long-running-functions
 void ThrowIfPythonHasPendingSignals() {
+  // The simulator runs with the GIL released (see below).
+  py::gil_scoped_acquire guard;
   if (PyErr_CheckSignals() != 0) {
     throw py::error_already_set();
   }
@@ -142,6 +145,13 @@ PYBIND11_MODULE(analysis, m) {
               cls_doc.get_dense_output.doc)
           .def("StopDenseIntegration", &Class::StopDenseIntegration,
               cls_doc.StopDenseIntegration.doc)
+          .def("set_dense_output_history_duration",
+              &Class::set_dense_output_history_duration,
+              py::arg("history_duration"),
+              cls_doc.set_dense_output_history_duration.doc)
+          .def("get_dense_output_history_duration",
+              &Class::get_dense_output_history_duration,
+              cls_doc.get_dense_output_history_duration.doc)
           .def("ResetStatistics", &Class::ResetStatistics,
               cls_doc.ResetStatistics.doc)
           .def("get_num_substep_failures", &Class::get_num_substep_failures,
@@ -211,6 +221,11 @@ PYBIND11_MODULE(analysis, m) {
     using MonitorCallback =
         std::function<std::optional<EventStatus>(const Context<T>&)>;
 
+    // The simulation is advanced with the GIL released, so that several
+    // Python threads can each drive their own Simulator concurrently. Systems
+    // and monitors implemented in Python still work, since their overrides
+    // and callbacks reacquire the GIL.
+    using ReleaseGil = py::call_guard<py::gil_scoped_release>;
     auto cls = DefineTemplateClassWithDefault<Simulator<T>>(
         m, "Simulator", GetPyParam<T>(), doc.Simulator.doc);
     cls  // BR
@@ -220,7 +235,7 @@ PYBIND11_MODULE(analysis, m) {
             py::keep_alive<1, 2>(),
             // Keep alive, ownership: `context` keeps `self` alive.
             py::keep_alive<3, 1>(), doc.Simulator.ctor.doc)
-        .def("Initialize", &Simulator<T>::Initialize,
+        .def("Initialize", &Simulator<T>::Initialize, ReleaseGil(),
             doc.Simulator.Initialize.doc,
             py::arg("params") = InitializeParams{})
         .def(
@@ -239,6 +254,7 @@ PYBIND11_MODULE(analysis, m) {
               return self->AdvanceTo(boundary_time);
             },
             py::arg("boundary_time"), py::arg("interruptible") = true,
+            ReleaseGil(),
             // Amend the docstring with the additional parameter.
             []() {
               std::string new_doc = doc.Simulator.AdvanceTo.doc;
@@ -258,7 +274,7 @@ Parameter ``interruptible``:
             }()
                 .c_str())
         .def("AdvancePendingEvents", &Simulator<T>::AdvancePendingEvents,
-            doc.Simulator.AdvancePendingEvents.doc)
+            ReleaseGil(), doc.Simulator.AdvancePendingEvents.doc)
         .def("set_monitor",
             WrapCallbacks([](Simulator<T>* self, MonitorCallback monitor) {
               self->set_monitor([monitor](const Context<T>& context) {
@@ -366,6 +382,60 @@ Parameter ``interruptible``:
       .def("PrintSimulatorStatistics", &PrintSimulatorStatistics<AutoDiffXd>,
           pydrake_doc.drake.systems.PrintSimulatorStatistics.doc);
 
+  {
+    constexpr auto& doc = pydrake_doc.drake.systems;
+    {
+      using Class = BatchedSimulatorOptions;
+      constexpr auto& cls_doc = doc.BatchedSimulatorOptions;
+      py::class_<Class> cls(m, "BatchedSimulatorOptions", cls_doc.doc);
+      cls  // BR
+          .def(ParamInit<Class>())
+          .def_readwrite(
+              "parallelism", &Class::parallelism, cls_doc.parallelism.doc)
+          .def_readwrite("use_batched_discrete_update",
+              &Class::use_batched_discrete_update,
+              cls_doc.use_batched_discrete_update.doc);
+      DefCopyAndDeepCopy(&cls);
+    }
+    {
+      using Class = BatchedSimulator;
+      constexpr auto& cls_doc = doc.BatchedSimulator;
+      // The environments are advanced with the GIL released, so that systems
+      // implemented in C++ can run concurrently. Systems implemented in Python
+      // still work, since their overrides reacquire the GIL.
+      using ReleaseGil = py::call_guard<py::gil_scoped_release>;
+      py::class_<Class>(m, "BatchedSimulator", cls_doc.doc)
+          .def(py::init<const System<double>&, int,
+                   const BatchedSimulatorOptions&>(),
+              py::arg("system"), py::arg("num_environments"),
+              py::arg("options") = BatchedSimulatorOptions{},
+              // Keep alive, reference: `self` keeps `system` alive.
+              py::keep_alive<1, 2>(), cls_doc.ctor.doc)
+          .def("get_system", &Class::get_system, py_rvp::reference,
+              cls_doc.get_system.doc)
+          .def("get_options", &Class::get_options, cls_doc.get_options.doc)
+          .def("num_environments", &Class::num_environments,
+              cls_doc.num_environments.doc)
+          .def("get_context", &Class::get_context, py::arg("i"),
+              py_rvp::reference_internal, cls_doc.get_context.doc)
+          .def("get_mutable_context", &Class::get_mutable_context,
+              py::arg("i"), py_rvp::reference_internal,
+              cls_doc.get_mutable_context.doc)
+          .def("get_time", &Class::get_time, cls_doc.get_time.doc)
+          .def("Initialize", &Class::Initialize, ReleaseGil(),
+              cls_doc.Initialize.doc)
+          .def("AdvanceTo", &Class::AdvanceTo, py::arg("boundary_time"),
+              ReleaseGil(), cls_doc.AdvanceTo.doc)
+          .def("SetActions", &Class::SetActions, py::arg("port"),
+              py::arg("actions"), ReleaseGil(), cls_doc.SetActions.doc)
+          .def("CalcObservations",
+              overload_cast_explicit<Eigen::MatrixXd,
+                  const OutputPort<double>&>(&Class::CalcObservations),
+              py::arg("port"), ReleaseGil(),
+              cls_doc.CalcObservations.doc_1args);
+    }
+  }
+
   // Monte Carlo Testing
   {
     // NOLINTNEXTLINE(build/namespaces): Emulate placement in namespace.
@@ -418,6 +488,8 @@ Parameter ``interruptible``:
         .def_readwrite("use_implicit_dynamics",
             &RegionOfAttractionOptions::use_implicit_dynamics,
             doc.RegionOfAttractionOptions.use_implicit_dynamics.doc)
+        .def_readwrite("parallelism", &RegionOfAttractionOptions::parallelism,
+            doc.RegionOfAttractionOptions.parallelism.doc)
         .def("__repr__", [](const RegionOfAttractionOptions& self) {
           return py::str(
               "RegionOfAttractionOptions("
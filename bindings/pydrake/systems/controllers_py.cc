@@ -68,7 +68,9 @@ PYBIND11_MODULE(controllers, m) {
             cls_doc.input_port_index.doc)
         .def_readwrite("assume_non_continuous_states_are_fixed",
             &Class::assume_non_continuous_states_are_fixed,
-            cls_doc.assume_non_continuous_states_are_fixed.doc);
+            cls_doc.assume_non_continuous_states_are_fixed.doc)
+        .def_readwrite(
+            "parallelism", &Class::parallelism, cls_doc.parallelism.doc);
   }
 
   // TODO(russt): Bind all default scalars.
@@ -318,6 +320,9 @@ PYBIND11_MODULE(controllers, m) {
             cls_doc.input_port_index.doc)
         .def_readwrite("use_square_root_method", &Class::use_square_root_method,
             cls_doc.use_square_root_method.doc)
+        .def_readwrite("riccati_recursion_time_step",
+            &Class::riccati_recursion_time_step,
+            cls_doc.riccati_recursion_time_step.doc)
         .def_readwrite("simulator_config", &Class::simulator_config,
             cls_doc.simulator_config.doc)
         .def("__repr__", [](const Class& self) {
@@ -327,9 +332,11 @@ PYBIND11_MODULE(controllers, m) {
               "N={}, "
               "input_port_index={}, "
               "use_square_root_method={}, "
+              "riccati_recursion_time_step={}, "
               "simulator_config={})")
               .format(self.Qf, self.N, self.input_port_index,
-                  self.use_square_root_method, self.simulator_config);
+                  self.use_square_root_method,
+                  self.riccati_recursion_time_step, self.simulator_config);
         });
     DefReadWriteKeepAlive(&cls, "x0", &Class::x0, cls_doc.x0.doc);
     DefReadWriteKeepAlive(&cls, "u0", &Class::u0, cls_doc.u0.doc);
@@ -32,8 +32,11 @@ template <typename SomeObject, typename T>
 py::object DoEval(const SomeObject* self, const systems::Context<T>& context) {
   switch (self->get_data_type()) {
     case systems::kVectorValued: {
-      const VectorX<T> eigen_copy = self->Eval(context);
-      return py::cast(eigen_copy);
+      // The result is a snapshot, not a view of the cached value (use
+      // EvalBasicVector().get_value() for that). Casting an rvalue lets
+      // pybind11 adopt the copy instead of copying it a second time.
+      VectorX<T> eigen_copy = self->Eval(context);
+      return py::cast(std::move(eigen_copy));
     }
     case systems::kAbstractValued: {
       const auto& abstract = self->template Eval<AbstractValue>(context);
@@ -52,6 +55,44 @@ py::object DoEval(const SomeObject* self, const systems::Context<T>& context) {
   DRAKE_UNREACHABLE();
 }
 
+// Returns true iff `system`, or any subsystem of it at any depth, is an
+// instance of a Python subclass.
+template <typename T>
+bool ContainsPythonSystem(const systems::System<T>& system) {
+  py::object system_py = py::cast(&system, py_rvp::reference);
+  PyTypeObject* const type = Py_TYPE(system_py.ptr());
+  const py::detail::type_info* const info = py::detail::get_type_info(type);
+  if (info == nullptr || info->type != type) {
+    return true;
+  }
+  const auto* diagram = dynamic_cast<const systems::Diagram<T>*>(&system);
+  if (diagram != nullptr) {
+    for (const systems::System<T>* subsystem : diagram->GetSystems()) {
+      if (ContainsPythonSystem(*subsystem)) {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+// Systems implemented in Python need the GIL, which the thread that evaluates
+// the Diagram holds, so a Diagram containing any of them cannot evaluate its
+// subsystems on worker threads. In that case, the builder's parallelism is
+// reset to none.
+template <typename T>
+void DisableParallelismForPythonSystems(systems::DiagramBuilder<T>* builder) {
+  if (builder->get_parallelism().num_threads() <= 1) {
+    return;
+  }
+  for (const systems::System<T>* system : builder->GetSystems()) {
+    if (ContainsPythonSystem(*system)) {
+      builder->set_parallelism(Parallelism::None());
+      return;
+    }
+  }
+}
+
 void DoScalarIndependentDefinitions(py::module m) {
   // NOLINTNEXTLINE(build/namespaces): Emulate placement in namespace.
   using namespace drake::systems;
@@ -196,7 +237,16 @@ void DoScalarIndependentDefinitions(py::module m) {
       .def("UnfreezeCache", &ContextBase::UnfreezeCache,
           doc.ContextBase.UnfreezeCache.doc)
       .def("is_cache_frozen", &ContextBase::is_cache_frozen,
-          doc.ContextBase.is_cache_frozen.doc);
+          doc.ContextBase.is_cache_frozen.doc)
+      .def("EnableCacheProfiling", &ContextBase::EnableCacheProfiling,
+          doc.ContextBase.EnableCacheProfiling.doc)
+      .def("DisableCacheProfiling", &ContextBase::DisableCacheProfiling,
+          doc.ContextBase.DisableCacheProfiling.doc)
+      .def("ResetCacheProfiling", &ContextBase::ResetCacheProfiling,
+          doc.ContextBase.ResetCacheProfiling.doc)
+      .def("is_cache_profiling_enabled",
+          &ContextBase::is_cache_profiling_enabled,
+          doc.ContextBase.is_cache_profiling_enabled.doc);
   // TODO(russt, eric.cousineau): Add remaining methods from ContextBase here.
 
   {
@@ -617,6 +667,10 @@ void DoScalarDependentDefinitions(py::module m) {
       .def("empty", &DiagramBuilder<T>::empty, doc.DiagramBuilder.empty.doc)
       .def("already_built", &DiagramBuilder<T>::already_built,
           doc.DiagramBuilder.already_built.doc)
+      .def("set_parallelism", &DiagramBuilder<T>::set_parallelism,
+          py::arg("parallelism"), doc.DiagramBuilder.set_parallelism.doc)
+      .def("get_parallelism", &DiagramBuilder<T>::get_parallelism,
+          doc.DiagramBuilder.get_parallelism.doc)
       .def("GetSystems", &DiagramBuilder<T>::GetSystems,
           py_rvp::reference_internal, doc.DiagramBuilder.GetSystems.doc)
       .def("GetMutableSystems", &DiagramBuilder<T>::GetMutableSystems,
@@ -686,10 +740,21 @@ void DoScalarDependentDefinitions(py::module m) {
       .def("ExportOutput", &DiagramBuilder<T>::ExportOutput, py::arg("output"),
           py::arg("name") = kUseDefaultName, py_rvp::reference_internal,
           doc.DiagramBuilder.ExportOutput.doc)
-      .def("Build", &DiagramBuilder<T>::Build,
+      .def(
+          "Build",
+          [](DiagramBuilder<T>* self) {
+            DisableParallelismForPythonSystems(self);
+            return self->Build();
+          },
           // Keep alive, ownership (tr.): `self` keeps `return` alive.
           py::keep_alive<1, 0>(), doc.DiagramBuilder.Build.doc)
-      .def("BuildInto", &DiagramBuilder<T>::BuildInto, py::arg("target"),
+      .def(
+          "BuildInto",
+          [](DiagramBuilder<T>* self, Diagram<T>* target) {
+            DisableParallelismForPythonSystems(self);
+            self->BuildInto(target);
+          },
+          py::arg("target"),
           // Keep alive, ownership (tr.): `target` keeps `self` alive.
           py::keep_alive<2, 1>(), doc.DiagramBuilder.BuildInto.doc)
       .def("IsConnectedOrExported", &DiagramBuilder<T>::IsConnectedOrExported,
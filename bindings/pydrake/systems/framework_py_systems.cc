@@ -1095,7 +1095,14 @@ Note: The above is for the C++ documentation. For Python, use
             py::arg("name"), py_rvp::reference_internal,
             doc.Diagram.GetSubsystemByName.doc)
         .def("GetSystems", &Diagram<T>::GetSystems, py_rvp::reference_internal,
-            doc.Diagram.GetSystems.doc);
+            doc.Diagram.GetSystems.doc)
+        .def("get_parallelism", &Diagram<T>::get_parallelism,
+            doc.Diagram.get_parallelism.doc)
+        .def("GetCacheProfilingReport", &Diagram<T>::GetCacheProfilingReport,
+            py::arg("context"), doc.Diagram.GetCacheProfilingReport.doc)
+        .def("GetCacheProfilingTraceEvents",
+            &Diagram<T>::GetCacheProfilingTraceEvents, py::arg("context"),
+            doc.Diagram.GetCacheProfilingTraceEvents.doc);
 
     // N.B. This will effectively allow derived classes of `VectorSystem` to
     // override `LeafSystem` methods, disrespecting `final`-ity.
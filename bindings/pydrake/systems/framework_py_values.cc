@@ -59,6 +59,8 @@ void DoScalarDependentDefinitions(py::module m) {
       .def("SetZero", &VectorBase<T>::SetZero, doc.VectorBase.SetZero.doc)
       .def("CopyToVector", &VectorBase<T>::CopyToVector,
           doc.VectorBase.CopyToVector.doc)
+      .def("CopyToPreSizedVector", &VectorBase<T>::CopyToPreSizedVector,
+          py::arg("vec"), doc.VectorBase.CopyToPreSizedVector.doc)
       .def("PlusEqScaled",
           overload_cast_explicit<VectorBase<T>&, const T&,
               const VectorBase<T>&>(&VectorBase<T>::PlusEqScaled),
@@ -496,6 +496,8 @@ PYBIND11_MODULE(primitives, m) {
         .def("Reserve", &VectorLog<T>::Reserve, doc.VectorLog.Reserve.doc)
         .def("AddData", &VectorLog<T>::AddData, py::arg("time"),
             py::arg("sample"), doc.VectorLog.AddData.doc)
+        .def("AddSamples", &VectorLog<T>::AddSamples, py::arg("times"),
+            py::arg("samples"), doc.VectorLog.AddSamples.doc)
         .def("get_input_size", &VectorLog<T>::get_input_size,
             doc.VectorLog.get_input_size.doc);
 
@@ -756,6 +758,30 @@ PYBIND11_MODULE(primitives, m) {
           systems::OutputPortSelection::kUseFirstOutputIfItExists,
       doc.FirstOrderTaylorApproximation.doc);
 
+  {
+    using Class = FirstOrderTaylorApproximator;
+    constexpr auto& cls_doc = doc.FirstOrderTaylorApproximator;
+    py::class_<Class>(m, "FirstOrderTaylorApproximator", cls_doc.doc)
+        .def(py::init<const System<double>&,
+                 std::variant<InputPortSelection, InputPortIndex>,
+                 std::variant<OutputPortSelection, OutputPortIndex>>(),
+            py::arg("system"),
+            py::arg("input_port_index") =
+                systems::InputPortSelection::kUseFirstInputIfItExists,
+            py::arg("output_port_index") =
+                systems::OutputPortSelection::kUseFirstOutputIfItExists,
+            // Keep alive, reference: `self` keeps `system` alive.
+            py::keep_alive<1, 2>(), cls_doc.ctor.doc)
+        .def("Calc", &Class::Calc, py::arg("context"), cls_doc.Calc.doc)
+        .def("A", &Class::A, py_rvp::reference_internal, cls_doc.A.doc)
+        .def("B", &Class::B, py_rvp::reference_internal, cls_doc.B.doc)
+        .def("f0", &Class::f0, py_rvp::reference_internal, cls_doc.f0.doc)
+        .def("C", &Class::C, py_rvp::reference_internal, cls_doc.C.doc)
+        .def("D", &Class::D, py_rvp::reference_internal, cls_doc.D.doc)
+        .def("y0", &Class::y0, py_rvp::reference_internal, cls_doc.y0.doc)
+        .def("time_period", &Class::time_period, cls_doc.time_period.doc);
+  }
+
   m.def("ControllabilityMatrix", &ControllabilityMatrix,
       doc.ControllabilityMatrix.doc);
 
@@ -41,7 +41,24 @@ void DefineSensorsImageIo(py::module m) {
             py::arg("start_time"), py_rvp::reference_internal,
             cls_doc.DeclareImageInputPort.doc)
         .def("ResetAllImageCounts", &Class::ResetAllImageCounts,
-            cls_doc.ResetAllImageCounts.doc);
+            cls_doc.ResetAllImageCounts.doc)
+        .def("EnableAsyncWriting", &Class::EnableAsyncWriting,
+            py::arg("num_threads"), py::arg("max_queue_size"),
+            py::arg("drop_when_full") = false,
+            cls_doc.EnableAsyncWriting.doc)
+        .def("Flush", &Class::Flush, cls_doc.Flush.doc)
+        .def("get_async_stats", &Class::get_async_stats,
+            cls_doc.get_async_stats.doc)
+        .def("set_compression_level", &Class::set_compression_level,
+            py::arg("level"), cls_doc.set_compression_level.doc);
+
+    py::class_<Class::AsyncStats>(cls, "AsyncStats", cls_doc.AsyncStats.doc)
+        .def_readonly("num_written", &Class::AsyncStats::num_written,
+            cls_doc.AsyncStats.num_written.doc)
+        .def_readonly("num_queue_full", &Class::AsyncStats::num_queue_full,
+            cls_doc.AsyncStats.num_queue_full.doc)
+        .def_readonly("num_dropped", &Class::AsyncStats::num_dropped,
+            cls_doc.AsyncStats.num_dropped.doc);
   }
 }
 
@@ -1,20 +1,28 @@
+import concurrent.futures
 import copy
+import threading
 import unittest
 
+import numpy as np
+
 from pydrake.common.test_utilities import numpy_compare
 from pydrake.math import isnan
 from pydrake.symbolic import Variable, Expression
 from pydrake.autodiffutils import AutoDiffXd
+from pydrake.common import Parallelism
 from pydrake.systems.primitives import (
     ConstantVectorSource,
     ConstantVectorSource_,
     FirstOrderLowPassFilter_,
+    LinearSystem,
     SymbolicVectorSystem,
     SymbolicVectorSystem_,
 )
-from pydrake.systems.framework import Context_, EventStatus
+from pydrake.systems.framework import Context_, EventStatus, LeafSystem
 from pydrake.systems.analysis import (
     ApplySimulatorConfig,
+    BatchedSimulator,
+    BatchedSimulatorOptions,
     ExtractSimulatorConfig,
     InitializeParams,
     IntegratorBase_,
@@ -42,6 +50,8 @@ class TestAnalysis(unittest.TestCase):
         options.state_variables = [x]
         numpy_compare.assert_equal(options.state_variables, [x])
         options.use_implicit_dynamics = False
+        options.parallelism = Parallelism(2)
+        self.assertEqual(options.parallelism.num_threads(), 2)
         V = RegionOfAttraction(system=sys, context=context, options=options)
         self.assertIsInstance(V, Expression)
         self.assertEqual(repr(options), "".join([
@@ -140,6 +150,17 @@ class TestAnalysis(unittest.TestCase):
         self.assertEqual(pp.end_time(), 1.0)
         self.assertIsNone(integrator.get_dense_output())
 
+        # Bound the history to the most recent 0.1 seconds.
+        self.assertEqual(integrator.get_dense_output_history_duration(), np.inf)
+        integrator.set_dense_output_history_duration(history_duration=0.1)
+        self.assertEqual(integrator.get_dense_output_history_duration(), 0.1)
+        integrator.StartDenseIntegration()
+        simulator.AdvanceTo(3.0)
+        pp = integrator.StopDenseIntegration()
+        self.assertGreater(pp.start_time(), 1.0)
+        self.assertLessEqual(pp.start_time(), 2.9)
+        self.assertEqual(pp.end_time(), 3.0)
+
     @numpy_compare.check_nonsymbolic_types
     def test_simulator_api(self, T):
         """Tests basic Simulator API."""
@@ -263,6 +284,28 @@ class TestAnalysis(unittest.TestCase):
             ApplySimulatorConfig(config=config, simulator=simulator)
             self.assertEqual(simulator.get_target_realtime_rate(), 100.0)
 
+    def test_batched_simulator(self):
+        system = LinearSystem(A=[[0.5]], B=[[1.0]], C=[[1.0]], D=[[0.0]],
+                              time_period=0.1)
+        options = BatchedSimulatorOptions(
+            parallelism=Parallelism(2), use_batched_discrete_update=True)
+        self.assertTrue(options.use_batched_discrete_update)
+        copy.copy(options)
+        dut = BatchedSimulator(system=system, num_environments=3,
+                               options=options)
+        self.assertIs(dut.get_system(), system)
+        self.assertTrue(dut.get_options().use_batched_discrete_update)
+        self.assertEqual(dut.num_environments(), 3)
+        dut.get_mutable_context(i=1).SetDiscreteState([1.0])
+        self.assertIsInstance(dut.get_context(i=1), Context_[float])
+        dut.SetActions(port=system.get_input_port(),
+                       actions=np.array([[0.0, 0.0, 2.0]]))
+        dut.Initialize()
+        dut.AdvanceTo(boundary_time=0.05)
+        self.assertEqual(dut.get_time(), 0.05)
+        observations = dut.CalcObservations(port=system.get_output_port())
+        numpy_compare.assert_float_equal(observations, [[0.0, 0.5, 2.0]])
+
     def test_system_monitor(self):
         x = Variable("x")
         sys = SymbolicVectorSystem(state=[x], dynamics=[-x+x**3])
@@ -285,3 +328,57 @@ class TestAnalysis(unittest.TestCase):
         self.assertLess(status.return_time(), 1.1)
         simulator.clear_monitor()
         self.assertIsNone(simulator.get_monitor())
+
+    def test_simulator_threads(self):
+        # Simulators release the GIL while advancing, so several Python threads
+        # can drive independent simulations. A Python monitor (which must
+        # reacquire the GIL) checks that callbacks still work meanwhile.
+        def simulate(initial_state):
+            x = Variable("x")
+            sys = SymbolicVectorSystem(state=[x], dynamics=[-x])
+            simulator = Simulator(sys)
+            simulator.get_mutable_context().SetContinuousState(
+                [initial_state])
+            num_calls = []
+            simulator.set_monitor(lambda context: num_calls.append(1))
+            simulator.AdvanceTo(1.0)
+            self.assertGreater(len(num_calls), 0)
+            return simulator.get_context().get_continuous_state_vector()[0]
+
+        initial_states = [1.0, 2.0, 3.0, 4.0]
+        with concurrent.futures.ThreadPoolExecutor(max_workers=2) as pool:
+            results = list(pool.map(simulate, initial_states))
+        for initial_state, result in zip(initial_states, results):
+            self.assertAlmostEqual(result, initial_state * np.exp(-1.0),
+                                   delta=1e-3)
+
+    def test_simulator_thread_python_system(self):
+        # A Python LeafSystem, whose overrides must reacquire the GIL, can be
+        # simulated from a second thread while the main thread also runs one.
+        class Decay(LeafSystem):
+            def __init__(self):
+                LeafSystem.__init__(self)
+                self.DeclareContinuousState(1)
+
+            def DoCalcTimeDerivatives(self, context, derivatives):
+                x = context.get_continuous_state_vector().GetAtIndex(0)
+                derivatives.get_mutable_vector().SetAtIndex(0, -x)
+
+        def simulate(initial_state, results):
+            simulator = Simulator(Decay())
+            simulator.get_mutable_context().SetContinuousState(
+                [initial_state])
+            simulator.AdvanceTo(1.0)
+            results.append(
+                simulator.get_context().get_continuous_state_vector()[0])
+
+        thread_results = []
+        thread = threading.Thread(target=simulate, args=(2.0, thread_results))
+        thread.start()
+        main_results = []
+        simulate(1.0, main_results)
+        thread.join()
+        self.assertEqual(len(thread_results), 1)
+        self.assertAlmostEqual(thread_results[0], 2.0 * np.exp(-1.0),
+                               delta=1e-3)
+        self.assertAlmostEqual(main_results[0], np.exp(-1.0), delta=1e-3)
@@ -3,7 +3,7 @@ import unittest
 
 import numpy as np
 
-from pydrake.common import FindResourceOrThrow
+from pydrake.common import FindResourceOrThrow, Parallelism
 from pydrake.common.test_utilities.deprecation import catch_drake_warnings
 from pydrake.examples import PendulumPlant
 from pydrake.multibody.tree import MultibodyForces
@@ -72,6 +72,8 @@ class TestControllers(unittest.TestCase):
         options.visualization_callback = callback
         options.input_port_index = InputPortSelection.kUseFirstInputIfItExists
         options.assume_non_continuous_states_are_fixed = False
+        # The cost function is written in Python, so it must run serially.
+        options.parallelism = Parallelism(1)
 
         policy, cost_to_go = FittedValueIteration(simulator,
                                                   quadratic_regulator_cost,
@@ -393,6 +395,7 @@ class TestControllers(unittest.TestCase):
         options.use_square_root_method = False
         options.simulator_config.max_step_size = 0.2
         self.assertIsNone(options.N)
+        self.assertIsNone(options.riccati_recursion_time_step)
         self.assertIsNone(options.x0)
         self.assertIsNone(options.u0)
         self.assertIsNone(options.xd)
@@ -407,6 +410,7 @@ class TestControllers(unittest.TestCase):
             r"input_port_index=",
             r"InputPortSelection.kUseFirstInputIfItExists, ",
             r"use_square_root_method=False, ",
+            r"riccati_recursion_time_step=None, ",
             r"simulator_config=SimulatorConfig\(.*\)\)"]))
 
         context = double_integrator.CreateDefaultContext()
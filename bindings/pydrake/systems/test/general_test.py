@@ -10,7 +10,7 @@ import unittest
 import numpy as np
 
 from pydrake.autodiffutils import AutoDiffXd
-from pydrake.common import RandomGenerator
+from pydrake.common import Parallelism, RandomGenerator
 from pydrake.common.test_utilities import numpy_compare
 from pydrake.common.test_utilities.deprecation import catch_drake_warnings
 from pydrake.common.value import AbstractValue, Value
@@ -150,6 +150,11 @@ class TestGeneral(unittest.TestCase):
         self.assertTrue(context.is_cache_frozen())
         context.UnfreezeCache()
         self.assertFalse(context.is_cache_frozen())
+        context.EnableCacheProfiling()
+        self.assertTrue(context.is_cache_profiling_enabled())
+        context.ResetCacheProfiling()
+        context.DisableCacheProfiling()
+        self.assertFalse(context.is_cache_profiling_enabled())
 
     def test_context_api(self):
         system = Adder(3, 10)
@@ -225,6 +230,10 @@ class TestGeneral(unittest.TestCase):
         np.testing.assert_equal(context.get_time(), 0.3)
         np.testing.assert_equal(
             context.get_continuous_state_vector().CopyToVector(), 2*x)
+        # Copy into a preallocated buffer, to avoid allocating per call.
+        buffer = np.zeros(2)
+        context.get_continuous_state_vector().CopyToPreSizedVector(buffer)
+        np.testing.assert_equal(buffer, 2*x)
         self.assertNotEqual(pendulum.EvalPotentialEnergy(context=context), 0)
         self.assertNotEqual(pendulum.EvalKineticEnergy(context=context), 0)
 
@@ -239,6 +248,15 @@ class TestGeneral(unittest.TestCase):
         context.SetDiscreteState(group_index=0, xd=3 * x)
         np.testing.assert_equal(
             context.get_discrete_state_vector().CopyToVector(), 3 * x)
+        # The values are zero-copy views that keep the context alive.
+        xd = context.get_discrete_state_vector().get_value()
+        xd_mutable = context.get_mutable_discrete_state_vector()\
+            .get_mutable_value()
+        xd_mutable[0] = 4.0
+        self.assertEqual(xd[0], 4.0)
+        del context
+        self.assertEqual(xd[0], 4.0)
+        context = rimless.CreateDefaultContext()
         # Just verify that the third overload is present.
         context.SetDiscreteState(context.get_discrete_state())
 
@@ -919,7 +937,10 @@ class TestGeneral(unittest.TestCase):
             builder.GetSubsystemByName(name="adder1")
             builder.GetMutableSubsystemByName(name="adder2")
             self.assertEqual(len(builder.connection_map()), 1)
+            builder.set_parallelism(parallelism=Parallelism(num_threads=2))
+            self.assertEqual(builder.get_parallelism().num_threads(), 2)
             diagram = builder.Build()
+            self.assertEqual(diagram.get_parallelism().num_threads(), 2)
             return adder1, adder2, diagram
 
         adder1, adder2, diagram = make_diagram()
@@ -950,6 +971,54 @@ class TestGeneral(unittest.TestCase):
         gc.collect()
         self.assertEqual(out_locators[0].get_name(), "adder2")
 
+        adder1, adder2, diagram = make_diagram()
+        context = diagram.CreateDefaultContext()
+        context.EnableCacheProfiling()
+        diagram.get_input_port(0).FixValue(context, np.zeros(2))
+        diagram.get_input_port(1).FixValue(context, np.zeros(2))
+        diagram.get_output_port().Eval(context)
+        self.assertIn("adder2", diagram.GetCacheProfilingReport(context))
+        self.assertIn("traceEvents",
+                      diagram.GetCacheProfilingTraceEvents(context=context))
+
+    def test_diagram_parallelism_with_python_systems(self):
+        # Systems implemented in Python need the GIL, so a Diagram containing
+        # any of them (at any depth) is built without parallelism.
+        class PyGain(LeafSystem):
+            def __init__(self):
+                LeafSystem.__init__(self)
+                self.DeclareVectorInputPort("u", 1)
+                self.DeclareVectorOutputPort("y", 1, self._calc_y)
+
+            def _calc_y(self, context, output):
+                output.SetFromVector(2 * self.get_input_port().Eval(context))
+
+        def make_diagram(nested):
+            builder = DiagramBuilder()
+            for k in range(3):
+                source = builder.AddSystem(ConstantVectorSource([k]))
+                gain = PyGain()
+                if nested:
+                    inner_builder = DiagramBuilder()
+                    inner_builder.AddSystem(gain)
+                    inner_builder.ExportInput(gain.get_input_port())
+                    inner_builder.ExportOutput(gain.get_output_port())
+                    gain = inner_builder.Build()
+                builder.AddSystem(gain)
+                builder.Connect(source.get_output_port(),
+                                gain.get_input_port())
+                builder.ExportOutput(gain.get_output_port())
+            builder.set_parallelism(parallelism=Parallelism(num_threads=2))
+            return builder.Build()
+
+        for nested in (False, True):
+            diagram = make_diagram(nested=nested)
+            self.assertEqual(diagram.get_parallelism().num_threads(), 1)
+            context = diagram.CreateDefaultContext()
+            for k in range(3):
+                self.assertEqual(
+                    diagram.get_output_port(k).Eval(context)[0], 2 * k)
+
     def test_add_named_system(self):
         builder = DiagramBuilder()
         adder1 = builder.AddNamedSystem("adder1", Adder(2, 3))
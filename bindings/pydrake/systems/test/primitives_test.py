@@ -30,6 +30,7 @@ from pydrake.systems.primitives import (
     DiscreteTimeDelay, DiscreteTimeDelay_,
     FirstOrderLowPassFilter,
     FirstOrderTaylorApproximation,
+    FirstOrderTaylorApproximator,
     Gain, Gain_,
     Integrator, Integrator_,
     IsControllable,
@@ -182,6 +183,11 @@ class TestGeneral(unittest.TestCase):
         self.assertTrue((linearized.A() == A).all())
         taylor = FirstOrderTaylorApproximation(system, context)
         self.assertTrue((taylor.y0() == y0).all())
+        approximator = FirstOrderTaylorApproximator(system)
+        approximator.Calc(context)
+        np.testing.assert_equal(approximator.A(), A)
+        np.testing.assert_equal(approximator.y0(), taylor.y0())
+        self.assertEqual(approximator.time_period(), .1)
 
         new_A = np.array([[1, 2], [3, 4]])
         new_B = np.array([[5], [6]])
@@ -819,6 +825,15 @@ class TestGeneral(unittest.TestCase):
         self.assertEqual(dut.num_samples(), 1)
         self.assertEqual(dut.sample_times(), [0.1])
         self.assertEqual(dut.data(), [22.22])
+        dut.AddSamples(times=[0.2, 0.3], samples=[[33.33, 44.44]])
+        self.assertEqual(dut.num_samples(), 3)
+        numpy_compare.assert_float_equal(dut.sample_times(), [0.1, 0.2, 0.3])
+        numpy_compare.assert_float_equal(
+            dut.data(), [[22.22, 33.33, 44.44]])
+        # The data is a read-only view, not a copy.
+        data = dut.data()
+        self.assertFalse(data.flags.writeable)
+        self.assertTrue(np.shares_memory(data, dut.data()))
         dut.Clear()
         self.assertEqual(dut.num_samples(), 0)
         # There is no good way from python to test the semantics of Reserve(),
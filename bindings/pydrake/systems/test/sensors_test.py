@@ -537,3 +537,12 @@ class TestSensors(unittest.TestCase):
             publish_period=0.125,
             start_time=0.0)
         self.assertIsNotNone(input_port)
+        writer.set_compression_level(level=1)
+        self.assertEqual(writer.get_async_stats().num_written, 0)
+        writer.EnableAsyncWriting(
+            num_threads=2, max_queue_size=4, drop_when_full=True)
+        writer.Flush()
+        stats = writer.get_async_stats()
+        self.assertEqual(stats.num_written, 0)
+        self.assertEqual(stats.num_queue_full, 0)
+        self.assertEqual(stats.num_dropped, 0)
@@ -1,11 +1,13 @@
 import pydrake.perception as mut
 
+import copy
 import unittest
 
 import numpy as np
 
 from pydrake.common.value import AbstractValue, Value
-from pydrake.systems.sensors import CameraInfo, PixelType
+from pydrake.math import RigidTransform
+from pydrake.systems.sensors import CameraInfo, ImageDepth32F, PixelType
 from pydrake.systems.framework import InputPort, OutputPort
 
 
@@ -139,6 +141,45 @@ class TestPerception(unittest.TestCase):
             scale=0.001,
             fields=mut.BaseField.kXYZs | mut.BaseField.kRGBs)
 
+    def test_tsdf_volume_api(self):
+        camera_info = CameraInfo(width=64, height=48, fov_y=np.pi / 4)
+        dut = mut.TsdfVolume(voxel_size=0.02, truncation_distance=0.08)
+        self.assertEqual(dut.voxel_size(), 0.02)
+        self.assertEqual(dut.truncation_distance(), 0.08)
+        self.assertEqual(dut.max_weight(), 64.0)
+        self.assertEqual(dut.num_blocks(), 0)
+        depth_image = ImageDepth32F(width=64, height=48, initial_value=1.0)
+        dut.Integrate(camera_info=camera_info, X_WC=RigidTransform(),
+                      depth_image=depth_image, parallelism=True)
+        self.assertGreater(dut.num_observed_voxels(), 0)
+        self.assertAlmostEqual(
+            dut.GetSignedDistance(p_WQ=[0, 0, 0.97]), 0.03, places=6)
+        self.assertIsNone(dut.GetSignedDistance(p_WQ=[0, 0, 2.0]))
+        cloud = dut.ExtractSurfacePoints(parallelism=False)
+        self.assertGreater(cloud.size(), 0)
+        copy.copy(dut).Clear()
+        self.assertGreater(dut.num_blocks(), 0)
+        dut.Clear()
+        self.assertEqual(dut.num_blocks(), 0)
+
+    def test_tsdf_integrator_api(self):
+        camera_info = CameraInfo(width=64, height=48, fov_y=np.pi / 4)
+        dut = mut.TsdfIntegrator(
+            camera_infos=[camera_info], period_sec=0.1, voxel_size=0.02,
+            truncation_distance=0.08, parallelism=False)
+        self.assertEqual(dut.num_cameras(), 1)
+        self.assertIsInstance(dut.depth_image_input_port(camera_index=0),
+                              InputPort)
+        self.assertIsInstance(dut.camera_pose_input_port(camera_index=0),
+                              InputPort)
+        self.assertIsInstance(dut.tsdf_volume_output_port(), OutputPort)
+        self.assertIsInstance(dut.point_cloud_output_port(), OutputPort)
+        context = dut.CreateDefaultContext()
+        self.assertEqual(dut.get_tsdf_volume(context=context).num_blocks(), 0)
+        dut.get_mutable_tsdf_volume(context=context).Clear()
+        volume = dut.tsdf_volume_output_port().Eval(context)
+        self.assertIsInstance(volume, mut.TsdfVolume)
+
     def test_point_cloud_to_lcm(self):
         dut = mut.PointCloudToLcm(frame_name="world")
         dut.get_input_port()
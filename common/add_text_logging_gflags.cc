@@ -1,9 +1,9 @@
 // This is a Drake-internal utility for use only as a direct dependency
 // of executable (drake_cc_binary) targets.
 //
-// To add --spdlog_level and --spdlog_pattern to the gflags command line of any
-// `drake_cc_binary`, add "//common:add_text_logging_gflags" to the `deps`
-// attribute in its BUILD.
+// To add --spdlog_level, --spdlog_pattern, and --spdlog_async to the gflags
+// command line of any `drake_cc_binary`, add "//common:add_text_logging_gflags"
+// to the `deps` attribute in its BUILD.
 
 #include <string>
 
@@ -16,6 +16,9 @@
 DEFINE_string(spdlog_level, drake::logging::kSetLogLevelUnchanged,
               drake::logging::kSetLogLevelHelpMessage);
 DEFINE_string(spdlog_pattern, "%+", drake::logging::kSetLogPatternHelpMessage);
+DEFINE_bool(spdlog_async, false,
+            "writes the log messages from a background thread; see "
+            "drake::logging::enable_async_logging()");
 
 // Validate flags and update Drake's configuration to match their values.
 namespace {
@@ -29,6 +32,16 @@ bool ValidateSpdlogPattern(const char* name, const std::string& value) {
   drake::logging::set_log_pattern(value);
   return true;
 }
+bool ValidateSpdlogAsync(const char* name, bool value) {
+  drake::unused(name);
+  if (value) {
+    drake::logging::enable_async_logging();
+  } else {
+    drake::logging::disable_async_logging();
+  }
+  return true;
+}
 }  // namespace
 DEFINE_validator(spdlog_level, &ValidateSpdlogLevel);
 DEFINE_validator(spdlog_pattern, &ValidateSpdlogPattern);
+DEFINE_validator(spdlog_async, &ValidateSpdlogAsync);
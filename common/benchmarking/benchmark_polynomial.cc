@@ -1,6 +1,7 @@
 #include <fmt/format.h>
 
 #include "drake/common/symbolic/monomial_util.h"
+#include "drake/common/symbolic/numeric_polynomial.h"
 #include "drake/common/symbolic/polynomial.h"
 #include "drake/tools/performance/fixture_common.h"
 
@@ -158,7 +159,40 @@ void GemmEE(benchmark::State& state) {  // NOLINT
   }
 }
 
+/* Creates a dense polynomial with numeric coefficients, containing every
+monomial of `num_vars` variables up to total degree `degree`. */
+Polynomial CreateDensePolynomial(int num_vars, int degree) {
+  const Variables x(MakeVectorContinuousVariable(num_vars, "x"));
+  const auto basis = internal::ComputeMonomialBasis<Eigen::Dynamic>(x, degree);
+  Polynomial p;
+  for (int i = 0; i < basis.rows(); ++i) {
+    p.AddProduct(std::cos(i), basis(i));
+  }
+  return p;
+}
+
+/* A benchmark for p * p + p, where p is a dense polynomial in 4 variables with
+numeric coefficients, of the total degree given by the first argument. The
+second argument selects the representation: 0 for symbolic::Polynomial and 1
+for symbolic::NumericPolynomial. */
+void PolynomialMultiply(benchmark::State& state) {  // NOLINT
+  const int degree = state.range(0);
+  const bool numeric = state.range(1);
+  const Polynomial p = CreateDensePolynomial(4, degree);
+  const NumericPolynomial q(p);
+  for (auto _ : state) {
+    if (numeric) {
+      const NumericPolynomial result = q * q + q;
+    } else {
+      const Polynomial result = p * p + p;
+    }
+  }
+}
+
 BENCHMARK(PolynomialEvaluatePartial)->Unit(benchmark::kMicrosecond);
+BENCHMARK(PolynomialMultiply)
+    ->ArgsProduct({{2, 4, 6}, {false, true}})
+    ->Unit(benchmark::kMillisecond);
 BENCHMARK(MatrixInnerProduct)
     ->ArgsProduct({{10, 50, 100, 200}, {false, true}})
     ->Unit(benchmark::kSecond);
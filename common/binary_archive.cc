@@ -0,0 +1,106 @@
+#include "drake/common/binary_archive.h"
+
+#include <bit>
+#include <cstring>
+#include <stdexcept>
+
+#include <fmt/format.h>
+
+namespace drake {
+namespace internal {
+namespace {
+
+// Scalars are stored as their native bytes, which are only portable between
+// little-endian machines (i.e., all of the platforms that Drake supports).
+static_assert(std::endian::native == std::endian::little);
+
+constexpr std::string_view kMagic{"DRAKEBIN", 8};
+constexpr uint32_t kVersion = 1;
+constexpr size_t kHeaderSize = kMagic.size() + sizeof(kVersion);
+
+}  // namespace
+
+BinaryWriteArchive::BinaryWriteArchive() {
+  data_.append(kMagic);
+  WriteValue(kVersion);
+}
+
+std::string BinaryWriteArchive::Finish() && {
+  WriteValue(checksum_.value());
+  return std::move(data_);
+}
+
+void BinaryWriteArchive::WriteBytes(const void* data, size_t size) {
+  data_.append(static_cast<const char*>(data), size);
+}
+
+BinaryReadArchive::BinaryReadArchive(std::string_view data) : data_(data) {
+  if (data_.size() < kHeaderSize || data_.substr(0, kMagic.size()) != kMagic) {
+    throw std::runtime_error(
+        "BinaryReadArchive: the data does not have a Drake binary header");
+  }
+  position_ = kMagic.size();
+  const uint32_t version = ReadValue<uint32_t>("header");
+  if (version != kVersion) {
+    throw std::runtime_error(fmt::format(
+        "BinaryReadArchive: the data has unsupported version {} (wanted {})",
+        version, kVersion));
+  }
+}
+
+void BinaryReadArchive::Finish() const {
+  uint64_t checksum{};
+  if (remaining() < sizeof(checksum)) {
+    ThrowError("checksum", "is truncated");
+  }
+  std::memcpy(&checksum, data_.data() + position_, sizeof(checksum));
+  if (checksum != checksum_.value()) {
+    throw std::runtime_error(
+        "BinaryReadArchive: the data was written with different fields than "
+        "the ones that were read");
+  }
+  if (remaining() != sizeof(checksum)) {
+    throw std::runtime_error(fmt::format(
+        "BinaryReadArchive: the data has {} unread byte(s) at the end",
+        remaining() - sizeof(checksum)));
+  }
+}
+
+void BinaryReadArchive::ReadBytes(const char* name, void* data, size_t size) {
+  if (size > remaining()) {
+    ThrowError(name, "is truncated");
+  }
+  if (size > 0) {
+    std::memcpy(data, data_.data() + position_, size);
+  }
+  position_ += size;
+}
+
+size_t BinaryReadArchive::ReadSize(const char* name, size_t min_element_size) {
+  const uint64_t size = ReadValue<uint64_t>(name);
+  if (min_element_size > 0 && size > remaining() / min_element_size) {
+    ThrowError(name, "is truncated");
+  }
+  return size;
+}
+
+void BinaryReadArchive::ThrowError(const char* name,
+                                   std::string_view message) const {
+  throw std::runtime_error(
+      fmt::format("BinaryReadArchive: the data for '{}' {} (at byte {} of {})",
+                  name, message, position_, data_.size()));
+}
+
+void BinaryReadArchive::ThrowMatrixSizeError(const char* name, size_t rows,
+                                             size_t cols, int wanted_rows,
+                                             int wanted_cols) const {
+  const auto dim = [](int n) {
+    return (n == Eigen::Dynamic) ? std::string("N") : std::to_string(n);
+  };
+  ThrowError(name,
+             fmt::format("has dimension {}x{} (wanted {}x{})", rows, cols,
+                         dim(wanted_rows), dim(wanted_cols)));
+}
+
+}  // namespace internal
+}  // namespace drake
@@ -0,0 +1,518 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/name_value.h"
+
+namespace drake {
+namespace internal {
+
+// The binary archives below implement the same Serialize() visitor protocol as
+// yaml::internal::YamlWriteArchive and YamlReadArchive, for the same set of
+// types (scalars, std::string, std::vector, std::array, std::map,
+// std::unordered_map, std::optional, std::variant, Eigen::Matrix, and nested
+// Serializable structs), but store the data in a compact binary form:
+//
+// - The data starts with a fixed header (a magic string and a version).
+// - The visited values follow in visit order, without their names. Scalars
+//   are stored as their native little-endian bytes; strings, containers and
+//   matrices are prefixed by their sizes (as uint64); optionals by a "has
+//   value" byte; and variants by their index (as uint32). The elements of
+//   arithmetic vectors, arrays and (column-major) matrices are stored
+//   contiguously, and are written and read in bulk.
+// - The data ends with a checksum of the names of the visited fields, so
+//   that reading data with a different Serialize() than the one that wrote it
+//   is reported as an error instead of producing garbage.
+//
+// Because the names are not stored, there is no equivalent of the YAML
+// options for missing or extra fields: the reader must visit exactly the same
+// fields as the writer. Use YAML for data that must stay readable across
+// changes to the Serialize() functions.
+
+// Accumulates the checksum of the visited field names (64-bit FNV-1a).
+class BinaryArchiveChecksum {
+ public:
+  void Update(std::string_view name) {
+    for (const char c : name) {
+      hash_ = (hash_ ^ static_cast<uint8_t>(c)) * kPrime;
+    }
+    // Separate the names, so that e.g. "ab" + "c" differs from "a" + "bc".
+    hash_ = (hash_ ^ 0xff) * kPrime;
+  }
+
+  uint64_t value() const { return hash_; }
+
+ private:
+  static constexpr uint64_t kPrime = 0x100000001b3;
+  uint64_t hash_{0xcbf29ce484222325};
+};
+
+// Saves data from a C++ structure into a binary string.
+class BinaryWriteArchive final {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(BinaryWriteArchive)
+
+  // Creates an archive, which starts with the binary header.
+  BinaryWriteArchive();
+
+  // Appends the contents of `serializable` to this archive.
+  template <typename Serializable>
+  void Accept(const Serializable& serializable) {
+    auto* serializable_mutable = const_cast<Serializable*>(&serializable);
+    this->DoAccept(serializable_mutable, static_cast<int32_t>(0));
+  }
+
+  // Appends the checksum and returns the finished binary data. The archive
+  // must not be used afterwards.
+  std::string Finish() &&;
+
+  // Appends the value pointed to by `nvp.value()` to this archive. Most users
+  // should call Accept, not Visit.
+  template <typename NameValuePair>
+  void Visit(const NameValuePair& nvp) {
+    checksum_.Update(nvp.name());
+    // Use int32_t for the final argument to prefer the specialized overload.
+    this->DoVisit(nvp, *nvp.value(), static_cast<int32_t>(0));
+  }
+
+ private:
+  // N.B. In the private details below, we use "NVP" to abbreviate the
+  // "NameValuePair<T>" template concept.
+
+  void WriteBytes(const void* data, size_t size);
+
+  template <typename T>
+  void WriteValue(const T& value) {
+    static_assert(std::is_arithmetic_v<T>);
+    WriteBytes(&value, sizeof(T));
+  }
+
+  void WriteSize(size_t size) { WriteValue(static_cast<uint64_t>(size)); }
+
+  // --------------------------------------------------------------------------
+  // @name Overloads for the Accept() implementation
+
+  // This version applies when Serialize is member function.
+  template <typename Serializable>
+  auto DoAccept(Serializable* serializable, int32_t)
+      -> decltype(serializable->Serialize(this)) {
+    return serializable->Serialize(this);
+  }
+
+  // This version applies when Serialize is an ADL free function.
+  template <typename Serializable>
+  void DoAccept(Serializable* serializable, int64_t) {
+    Serialize(this, serializable);
+  }
+
+  // --------------------------------------------------------------------------
+  // @name Overloads for the Visit() implementation
+
+  // This version applies when the type has a Serialize member function.
+  template <typename NVP, typename T>
+  auto DoVisit(const NVP& nvp, const T&, int32_t)
+      -> decltype(nvp.value()->Serialize(
+          static_cast<BinaryWriteArchive*>(nullptr))) {
+    return this->Accept(*nvp.value());
+  }
+
+  // This version applies when the type has an ADL Serialize function.
+  template <typename NVP, typename T>
+  auto DoVisit(const NVP& nvp, const T&, int32_t)
+      -> decltype(Serialize(static_cast<BinaryWriteArchive*>(nullptr),
+                            nvp.value())) {
+    return this->Accept(*nvp.value());
+  }
+
+  // For std::vector.
+  template <typename NVP, typename T>
+  void DoVisit(const NVP& nvp, const std::vector<T>&, int32_t) {
+    std::vector<T>& data = *nvp.value();
+    WriteSize(data.size());
+    this->VisitArrayLike<T>(nvp.name(), data.size(), data.data());
+  }
+
+  // For std::array.
+  template <typename NVP, typename T, std::size_t N>
+  void DoVisit(const NVP& nvp, const std::array<T, N>&, int32_t) {
+    this->VisitArrayLike<T>(nvp.name(), N, nvp.value()->data());
+  }
+
+  // For std::map.
+  template <typename NVP, typename K, typename V, typename C>
+  void DoVisit(const NVP& nvp, const std::map<K, V, C>&, int32_t) {
+    this->VisitMap<K>(nvp);
+  }
+
+  // For std::unordered_map.
+  template <typename NVP, typename K, typename V, typename C>
+  void DoVisit(const NVP& nvp, const std::unordered_map<K, V, C>&, int32_t) {
+    this->VisitMap<K>(nvp);
+  }
+
+  // For std::optional.
+  template <typename NVP, typename T>
+  void DoVisit(const NVP& nvp, const std::optional<T>&, int32_t) {
+    auto& optional = *nvp.value();
+    WriteValue(static_cast<uint8_t>(optional.has_value()));
+    if (optional.has_value()) {
+      this->Visit(drake::MakeNameValue(nvp.name(), &optional.value()));
+    }
+  }
+
+  // For std::variant.
+  template <typename NVP, typename... Types>
+  void DoVisit(const NVP& nvp, const std::variant<Types...>&, int32_t) {
+    auto& variant = *nvp.value();
+    WriteValue(static_cast<uint32_t>(variant.index()));
+    const char* const name = nvp.name();
+    std::visit(
+        [this, name](auto&& unwrapped) {
+          this->Visit(drake::MakeNameValue(name, &unwrapped));
+        },
+        variant);
+  }
+
+  // For Eigen::Matrix or Eigen::Vector.
+  template <typename NVP, typename T, int Rows, int Cols, int Options = 0,
+            int MaxRows = Rows, int MaxCols = Cols>
+  void DoVisit(const NVP& nvp,
+               const Eigen::Matrix<T, Rows, Cols, Options, MaxRows, MaxCols>&,
+               int32_t) {
+    static_assert(std::is_arithmetic_v<T>,
+                  "Only matrices of arithmetic types can be serialized");
+    const auto& matrix = *nvp.value();
+    WriteSize(matrix.rows());
+    WriteSize(matrix.cols());
+    if constexpr (std::decay_t<decltype(matrix)>::IsRowMajor) {
+      for (int j = 0; j < matrix.cols(); ++j) {
+        for (int i = 0; i < matrix.rows(); ++i) {
+          WriteValue(matrix(i, j));
+        }
+      }
+    } else {
+      WriteBytes(matrix.data(), matrix.size() * sizeof(T));
+    }
+  }
+
+  // If no other DoVisit matched, we'll treat the value as a scalar.
+  template <typename NVP, typename T>
+  void DoVisit(const NVP& nvp, const T&, int64_t) {
+    const T& value = *nvp.value();
+    if constexpr (std::is_same_v<T, std::string>) {
+      WriteSize(value.size());
+      WriteBytes(value.data(), value.size());
+    } else if constexpr (std::is_same_v<T, bool>) {
+      WriteValue(static_cast<uint8_t>(value));
+    } else {
+      static_assert(std::is_arithmetic_v<T>,
+                    "Only arithmetic types and std::string can be serialized");
+      WriteValue(value);
+    }
+  }
+
+  // --------------------------------------------------------------------------
+  // @name Implementations of Visit() once the shape is known
+
+  // This is used for std::array, std::vector, or similar. The elements are
+  // not named, so they do not contribute to the checksum (although the fields
+  // of Serializable elements do).
+  template <typename T>
+  void VisitArrayLike(const char* name, size_t size, T* data) {
+    if constexpr (std::is_arithmetic_v<T> && !std::is_same_v<T, bool>) {
+      WriteBytes(data, size * sizeof(T));
+    } else {
+      for (size_t i = 0; i < size; ++i) {
+        this->DoVisit(drake::MakeNameValue(name, &data[i]), data[i],
+                      static_cast<int32_t>(0));
+      }
+    }
+  }
+
+  // This is used for std::map, std::unordered_map, or similar. As with YAML,
+  // the map key must be a string. The entries are written in their iteration
+  // order.
+  template <typename Key, typename NVP>
+  void VisitMap(const NVP& nvp) {
+    static_assert(std::is_same_v<Key, std::string>, "Map keys must be strings");
+    auto& map = *nvp.value();
+    WriteSize(map.size());
+    for (auto&& [key, value] : map) {
+      WriteSize(key.size());
+      WriteBytes(key.data(), key.size());
+      this->DoVisit(drake::MakeNameValue(nvp.name(), &value), value,
+                    static_cast<int32_t>(0));
+    }
+  }
+
+  std::string data_;
+  BinaryArchiveChecksum checksum_;
+};
+
+// Loads data from a binary string (as written by BinaryWriteArchive) into a
+// C++ structure. The data is read in place; it is not copied.
+class BinaryReadArchive final {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(BinaryReadArchive)
+
+  // Creates an archive that reads the given `data`, which must remain valid
+  // for the lifetime of this archive.
+  // @throws std::exception if the data does not start with the binary header.
+  explicit BinaryReadArchive(std::string_view data);
+
+  // Sets the contents of `serializable` from the next data in this archive.
+  // @throws std::exception if the data is malformed.
+  template <typename Serializable>
+  void Accept(Serializable* serializable) {
+    this->DoAccept(serializable, static_cast<int32_t>(0));
+  }
+
+  // Confirms that the data ends with the checksum of the fields visited so
+  // far, and nothing else.
+  // @throws std::exception if not.
+  void Finish() const;
+
+  // Sets the value pointed to by `nvp.value()` from the next data in this
+  // archive. Most users should call Accept, not Visit.
+  template <typename NameValuePair>
+  void Visit(const NameValuePair& nvp) {
+    checksum_.Update(nvp.name());
+    // Use int32_t for the final argument to prefer the specialized overload.
+    this->DoVisit(nvp, *nvp.value(), static_cast<int32_t>(0));
+  }
+
+ private:
+  // Copies the next `size` bytes into `data`.
+  // @throws std::exception if there are fewer bytes left.
+  void ReadBytes(const char* name, void* data, size_t size);
+
+  template <typename T>
+  T ReadValue(const char* name) {
+    static_assert(std::is_arithmetic_v<T>);
+    T result{};
+    ReadBytes(name, &result, sizeof(T));
+    return result;
+  }
+
+  // Reads a size, confirming that at least `size * min_element_size` bytes
+  // remain (to guard against allocating huge containers for corrupt data).
+  size_t ReadSize(const char* name, size_t min_element_size);
+
+  [[noreturn]] void ThrowError(const char* name,
+                               std::string_view message) const;
+
+  // --------------------------------------------------------------------------
+  // @name Overloads for the Accept() implementation
+
+  // This version applies when Serialize is member function.
+  template <typename Serializable>
+  auto DoAccept(Serializable* serializable, int32_t)
+      -> decltype(serializable->Serialize(this)) {
+    return serializable->Serialize(this);
+  }
+
+  // This version applies when Serialize is an ADL free function.
+  template <typename Serializable>
+  void DoAccept(Serializable* serializable, int64_t) {
+    Serialize(this, serializable);
+  }
+
+  // --------------------------------------------------------------------------
+  // @name Overloads for the Visit() implementation
+
+  // This version applies when the type has a Serialize member function.
+  template <typename NVP, typename T>
+  auto DoVisit(const NVP& nvp, const T&, int32_t)
+      -> decltype(nvp.value()->Serialize(
+          static_cast<BinaryReadArchive*>(nullptr))) {
+    return this->Accept(nvp.value());
+  }
+
+  // This version applies when the type has an ADL Serialize function.
+  template <typename NVP, typename T>
+  auto DoVisit(const NVP& nvp, const T&, int32_t)
+      -> decltype(Serialize(static_cast<BinaryReadArchive*>(nullptr),
+                            nvp.value())) {
+    return this->Accept(nvp.value());
+  }
+
+  // For std::vector.
+  template <typename NVP, typename T>
+  void DoVisit(const NVP& nvp, const std::vector<T>&, int32_t) {
+    std::vector<T>& data = *nvp.value();
+    constexpr size_t min_element_size =
+        std::is_arithmetic_v<T> ? sizeof(T) : 0;
+    data.resize(ReadSize(nvp.name(), min_element_size));
+    this->VisitArrayLike<T>(nvp.name(), data.size(), data.data());
+  }
+
+  // For std::array.
+  template <typename NVP, typename T, std::size_t N>
+  void DoVisit(const NVP& nvp, const std::array<T, N>&, int32_t) {
+    this->VisitArrayLike<T>(nvp.name(), N, nvp.value()->data());
+  }
+
+  // For std::map.
+  template <typename NVP, typename K, typename V, typename C>
+  void DoVisit(const NVP& nvp, const std::map<K, V, C>&, int32_t) {
+    this->VisitMap<K, V>(nvp);
+  }
+
+  // For std::unordered_map.
+  template <typename NVP, typename K, typename V, typename C>
+  void DoVisit(const NVP& nvp, const std::unordered_map<K, V, C>&, int32_t) {
+    this->VisitMap<K, V>(nvp);
+  }
+
+  // For std::optional.
+  template <typename NVP, typename T>
+  void DoVisit(const NVP& nvp, const std::optional<T>&, int32_t) {
+    auto& optional = *nvp.value();
+    if (ReadValue<uint8_t>(nvp.name()) == 0) {
+      optional.reset();
+      return;
+    }
+    if (!optional.has_value()) {
+      optional.emplace();
+    }
+    this->Visit(drake::MakeNameValue(nvp.name(), &optional.value()));
+  }
+
+  // For std::variant.
+  template <typename NVP, typename... Types>
+  void DoVisit(const NVP& nvp, const std::variant<Types...>&, int32_t) {
+    const uint32_t index = ReadValue<uint32_t>(nvp.name());
+    this->VisitVariantAlternative(nvp.name(), index, nvp.value());
+  }
+
+  // For Eigen::Matrix or Eigen::Vector.
+  template <typename NVP, typename T, int Rows, int Cols, int Options = 0,
+            int MaxRows = Rows, int MaxCols = Cols>
+  void DoVisit(const NVP& nvp,
+               const Eigen::Matrix<T, Rows, Cols, Options, MaxRows, MaxCols>&,
+               int32_t) {
+    static_assert(std::is_arithmetic_v<T>,
+                  "Only matrices of arithmetic types can be serialized");
+    const char* const name = nvp.name();
+    auto& matrix = *nvp.value();
+    const size_t rows = ReadSize(name, 0);
+    const size_t cols = ReadSize(name, 0);
+    const auto mismatched = [](size_t actual, int wanted, int max) {
+      return (wanted != Eigen::Dynamic && actual != static_cast<size_t>(wanted))
+          || (max != Eigen::Dynamic && actual > static_cast<size_t>(max));
+    };
+    if (mismatched(rows, Rows, MaxRows) || mismatched(cols, Cols, MaxCols)) {
+      ThrowMatrixSizeError(name, rows, cols, Rows, Cols);
+    }
+    if (rows != 0 && cols > remaining() / sizeof(T) / rows) {
+      ThrowError(name, "is truncated");
+    }
+    matrix.resize(rows, cols);
+    if constexpr (std::decay_t<decltype(matrix)>::IsRowMajor) {
+      for (size_t j = 0; j < cols; ++j) {
+        for (size_t i = 0; i < rows; ++i) {
+          matrix(i, j) = ReadValue<T>(name);
+        }
+      }
+    } else {
+      ReadBytes(name, matrix.data(), matrix.size() * sizeof(T));
+    }
+  }
+
+  // If no other DoVisit matched, we'll treat the value as a scalar.
+  template <typename NVP, typename T>
+  void DoVisit(const NVP& nvp, const T&, int64_t) {
+    T& value = *nvp.value();
+    if constexpr (std::is_same_v<T, std::string>) {
+      value.resize(ReadSize(nvp.name(), 1));
+      ReadBytes(nvp.name(), value.data(), value.size());
+    } else if constexpr (std::is_same_v<T, bool>) {
+      value = ReadValue<uint8_t>(nvp.name()) != 0;
+    } else {
+      static_assert(std::is_arithmetic_v<T>,
+                    "Only arithmetic types and std::string can be serialized");
+      value = ReadValue<T>(nvp.name());
+    }
+  }
+
+  // --------------------------------------------------------------------------
+  // @name Implementations of Visit() once the shape is known
+
+  // This is used for std::array, std::vector, or similar.
+  template <typename T>
+  void VisitArrayLike(const char* name, size_t size, T* data) {
+    if constexpr (std::is_arithmetic_v<T> && !std::is_same_v<T, bool>) {
+      ReadBytes(name, data, size * sizeof(T));
+    } else {
+      for (size_t i = 0; i < size; ++i) {
+        this->DoVisit(drake::MakeNameValue(name, &data[i]), data[i],
+                      static_cast<int32_t>(0));
+      }
+    }
+  }
+
+  // This is used for std::map, std::unordered_map, or similar.
+  template <typename Key, typename Value, typename NVP>
+  void VisitMap(const NVP& nvp) {
+    static_assert(std::is_same_v<Key, std::string>, "Map keys must be strings");
+    auto& map = *nvp.value();
+    map.clear();
+    const size_t size = ReadSize(nvp.name(), sizeof(uint64_t));
+    for (size_t i = 0; i < size; ++i) {
+      std::string key;
+      key.resize(ReadSize(nvp.name(), 1));
+      ReadBytes(nvp.name(), key.data(), key.size());
+      auto [iter, inserted] = map.emplace(std::move(key), Value{});
+      if (!inserted) {
+        ThrowError(nvp.name(), "has a duplicate map key");
+      }
+      Value& value = iter->second;
+      this->DoVisit(drake::MakeNameValue(nvp.name(), &value), value,
+                    static_cast<int32_t>(0));
+    }
+  }
+
+  // Emplaces the alternative with the given `index` into `variant`, and reads
+  // it.
+  template <size_t I = 0, typename Variant>
+  void VisitVariantAlternative(const char* name, uint32_t index,
+                               Variant* variant) {
+    if constexpr (I < std::variant_size_v<Variant>) {
+      if (index == I) {
+        auto& unwrapped = variant->template emplace<I>();
+        this->Visit(drake::MakeNameValue(name, &unwrapped));
+      } else {
+        this->VisitVariantAlternative<I + 1>(name, index, variant);
+      }
+    } else {
+      ThrowError(name, "has an invalid variant index");
+    }
+  }
+
+  [[noreturn]] void ThrowMatrixSizeError(const char* name, size_t rows,
+                                         size_t cols, int wanted_rows,
+                                         int wanted_cols) const;
+
+  size_t remaining() const { return data_.size() - position_; }
+
+  const std::string_view data_;
+  size_t position_{0};
+  BinaryArchiveChecksum checksum_;
+};
+
+}  // namespace internal
+}  // namespace drake
@@ -0,0 +1,71 @@
+#include "drake/common/binary_io.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+#include <fmt/format.h>
+
+namespace drake {
+namespace internal {
+namespace {
+
+[[noreturn]] void ThrowFileError(const std::string& filename,
+                                 const char* action) {
+  throw std::runtime_error(fmt::format("Could not {} binary file '{}': {}",
+                                       action, filename,
+                                       std::strerror(errno)));
+}
+
+}  // namespace
+
+void WriteBinaryFile(const std::string& filename, std::string_view contents) {
+  std::ofstream output(filename, std::ios::binary | std::ios::trunc);
+  if (!output.is_open()) {
+    ThrowFileError(filename, "open");
+  }
+  output.write(contents.data(), contents.size());
+  output.close();
+  if (output.fail()) {
+    ThrowFileError(filename, "write");
+  }
+}
+
+MappedFile::MappedFile(const std::string& filename) {
+  const int fd = ::open(filename.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    ThrowFileError(filename, "open");
+  }
+  struct stat status {};
+  if (::fstat(fd, &status) != 0) {
+    ::close(fd);
+    ThrowFileError(filename, "stat");
+  }
+  size_ = status.st_size;
+  // An empty file cannot be mapped; its contents are simply empty.
+  if (size_ > 0) {
+    void* const data = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (data == MAP_FAILED) {
+      ::close(fd);
+      ThrowFileError(filename, "map");
+    }
+    data_ = static_cast<const char*>(data);
+  }
+  // The mapping remains valid after the descriptor is closed.
+  ::close(fd);
+}
+
+MappedFile::~MappedFile() {
+  if (data_ != nullptr) {
+    ::munmap(const_cast<char*>(data_), size_);
+  }
+}
+
+}  // namespace internal
+}  // namespace drake
@@ -0,0 +1,109 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "drake/common/binary_archive.h"
+#include "drake/common/drake_copyable.h"
+
+namespace drake {
+
+/** Saves data as a compact binary string.
+
+The binary format is an alternative to @ref yaml_serialization "YAML
+Serialization" for large data (e.g., long vectors or big matrices) that is
+written and read back by the same program, where YAML's text conversions
+dominate the cost. It uses the same @ref implementing_serialize "Serialize"
+functions as YAML, but stores only the values (not the field names), in visit
+order. Arithmetic vectors, arrays and matrices are stored as contiguous blocks
+that are copied in bulk.
+
+The data is only readable by a Serialize() function that visits exactly the
+same fields (with the same types and in the same order) as the one that wrote
+it; a checksum of the field names detects most mismatches. It is only portable
+between little-endian machines. Prefer YAML for long-lived data.
+
+@tparam Serializable must implement a @ref implementing_serialize "Serialize"
+  function. */
+template <typename Serializable>
+std::string SaveBinaryString(const Serializable& data) {
+  internal::BinaryWriteArchive archive;
+  archive.Accept(data);
+  return std::move(archive).Finish();
+}
+
+/** Loads data from a binary string, as written by SaveBinaryString().
+
+@throws std::exception if the data is malformed, or was written by a different
+  Serialize() function.
+
+@tparam Serializable must implement a @ref implementing_serialize "Serialize"
+  function and be default constructible. */
+template <typename Serializable>
+Serializable LoadBinaryString(std::string_view data) {
+  Serializable result{};
+  internal::BinaryReadArchive archive(data);
+  archive.Accept(&result);
+  archive.Finish();
+  return result;
+}
+
+/** Saves data as a binary file. See SaveBinaryString() for the format.
+
+@throws std::exception if the file cannot be written. */
+template <typename Serializable>
+void SaveBinaryFile(const std::string& filename, const Serializable& data);
+
+/** Loads data from a binary file, as written by SaveBinaryFile(). The file is
+memory-mapped (not read into a buffer), so large arrays are copied once,
+directly from the page cache into the result.
+
+@throws std::exception if the file cannot be read, or as LoadBinaryString()
+  does.
+
+@tparam Serializable must implement a @ref implementing_serialize "Serialize"
+  function and be default constructible. */
+template <typename Serializable>
+Serializable LoadBinaryFile(const std::string& filename);
+
+namespace internal {
+
+/* Writes `contents` to the given file, replacing it.
+@throws std::exception on failure. */
+void WriteBinaryFile(const std::string& filename, std::string_view contents);
+
+/* A read-only memory mapping of a whole file. */
+class MappedFile final {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(MappedFile)
+
+  /* Maps the given file.
+  @throws std::exception if it cannot be opened or mapped. */
+  explicit MappedFile(const std::string& filename);
+
+  ~MappedFile();
+
+  /* Returns the contents of the file, which remain valid for the lifetime of
+  this object. */
+  std::string_view contents() const { return {data_, size_}; }
+
+ private:
+  const char* data_{};
+  size_t size_{};
+};
+
+}  // namespace internal
+
+template <typename Serializable>
+void SaveBinaryFile(const std::string& filename, const Serializable& data) {
+  internal::WriteBinaryFile(filename, SaveBinaryString(data));
+}
+
+template <typename Serializable>
+Serializable LoadBinaryFile(const std::string& filename) {
+  const internal::MappedFile file(filename);
+  return LoadBinaryString<Serializable>(file.contents());
+}
+
+}  // namespace drake
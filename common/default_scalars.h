@@ -26,6 +26,16 @@
 /// Alternatively, reference to "default nonsymbolic scalars" means all except
 /// `drake::symbolic::Expression`.
 ///
+/// Other scalar types, such as the fixed-size drake::AutoDiffd<N>, work with
+/// the header-only templates (e.g., math::InitializeAutoDiff), but not with
+/// classes that are instantiated using the macros below. In particular,
+/// MultibodyPlant would require its whole dependency stack (the systems
+/// framework, SceneGraph, and the math and multibody tree types) to be
+/// instantiated on the new scalar, so it is only available for the default
+/// scalars. When the number of derivatives is small, seeding only the
+/// derivatives of interest (see math::InitializeAutoDiffTuple) keeps the cost
+/// of AutoDiffXd down.
+///
 /// For code within Drake, we offer Doxygen custom commands to document the
 /// `<T>` template parameter in the conventional cases:
 ///
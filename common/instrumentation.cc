@@ -0,0 +1,352 @@
+#include "drake/common/instrumentation.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+#include <fmt/ranges.h>
+
+#include "drake/common/never_destroyed.h"
+
+namespace drake {
+namespace instrumentation {
+namespace internal {
+
+std::atomic<bool> g_enabled{false};
+
+}  // namespace internal
+
+namespace {
+
+// Each thread keeps at most this many zone events for the Chrome trace.
+constexpr int kMaxEventsPerThread = 1'000'000;
+
+int64_t NowNs() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+struct ZoneStats {
+  void Add(int64_t duration_ns) {
+    ++count;
+    total_ns += duration_ns;
+    min_ns = std::min(min_ns, duration_ns);
+    max_ns = std::max(max_ns, duration_ns);
+  }
+
+  void Merge(const ZoneStats& other) {
+    count += other.count;
+    total_ns += other.total_ns;
+    min_ns = std::min(min_ns, other.min_ns);
+    max_ns = std::max(max_ns, other.max_ns);
+  }
+
+  int64_t count{};
+  int64_t total_ns{};
+  int64_t min_ns{std::numeric_limits<int64_t>::max()};
+  int64_t max_ns{};
+};
+
+struct HistogramStats {
+  // The bucket of non-positive values; positive values v fall into the bucket
+  // ⌊log₂(v)⌋, i.e., [2ᵏ, 2ᵏ⁺¹).
+  static constexpr int kNonPositiveBucket = std::numeric_limits<int>::min();
+
+  void Add(double value) {
+    ++count;
+    sum += value;
+    min = std::min(min, value);
+    max = std::max(max, value);
+    ++buckets[value > 0 ? std::ilogb(value) : kNonPositiveBucket];
+  }
+
+  void Merge(const HistogramStats& other) {
+    count += other.count;
+    sum += other.sum;
+    min = std::min(min, other.min);
+    max = std::max(max, other.max);
+    for (const auto& [bucket, bucket_count] : other.buckets) {
+      buckets[bucket] += bucket_count;
+    }
+  }
+
+  int64_t count{};
+  double sum{};
+  double min{std::numeric_limits<double>::infinity()};
+  double max{-std::numeric_limits<double>::infinity()};
+  std::map<int, int64_t> buckets;
+};
+
+// A node in a thread's tree of nested zones. The root (index 0) has no name.
+struct ZoneNode {
+  const char* name{};
+  int parent{-1};
+  std::vector<int> children;
+  ZoneStats stats;
+};
+
+struct ZoneEvent {
+  const char* name{};
+  int64_t start_ns{};
+  int64_t duration_ns{};
+};
+
+// The data recorded by one thread. Only its own thread writes to it, so the
+// mutex is uncontended except while the data is being exported or reset.
+struct ThreadData {
+  explicit ThreadData(int id) : thread_id(id) { Clear(); }
+
+  void Clear() {
+    nodes.assign(1, ZoneNode{});
+    current = 0;
+    events.clear();
+    counters.clear();
+    histograms.clear();
+  }
+
+  // Returns the index of the child of `current` with the given name, adding
+  // it if needed.
+  int FindOrAddChild(const char* name) {
+    for (const int child : nodes[current].children) {
+      if (nodes[child].name == name) {
+        return child;
+      }
+    }
+    const int child = nodes.size();
+    nodes.push_back(ZoneNode{.name = name, .parent = current});
+    nodes[current].children.push_back(child);
+    return child;
+  }
+
+  std::mutex mutex;
+  const int thread_id;
+  std::vector<ZoneNode> nodes;
+  int current{};
+  std::vector<ZoneEvent> events;
+  std::unordered_map<const char*, int64_t> counters;
+  std::unordered_map<const char*, HistogramStats> histograms;
+};
+
+// Owns the data of every thread that has recorded anything, including threads
+// that have since exited.
+class Registry {
+ public:
+  std::shared_ptr<ThreadData> AddThread() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    threads_.push_back(std::make_shared<ThreadData>(threads_.size() + 1));
+    return threads_.back();
+  }
+
+  std::vector<std::shared_ptr<ThreadData>> threads() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return threads_;
+  }
+
+  int64_t epoch_ns() const { return epoch_ns_; }
+  void set_epoch_ns(int64_t epoch_ns) { epoch_ns_ = epoch_ns; }
+
+ private:
+  mutable std::mutex mutex_;
+  std::vector<std::shared_ptr<ThreadData>> threads_;
+  std::atomic<int64_t> epoch_ns_{NowNs()};
+};
+
+Registry& GetRegistry() {
+  static never_destroyed<Registry> registry;
+  return registry.access();
+}
+
+ThreadData& GetThreadData() {
+  thread_local const std::shared_ptr<ThreadData> data =
+      GetRegistry().AddThread();
+  return *data;
+}
+
+// Returns `name` as a JSON string literal.
+std::string JsonString(std::string_view name) {
+  std::string result = "\"";
+  for (const char c : name) {
+    if (c == '"' || c == '\\') {
+      result += '\\';
+    }
+    if (static_cast<unsigned char>(c) < 0x20) {
+      result += fmt::format("\\u{:04x}", c);
+    } else {
+      result += c;
+    }
+  }
+  result += '"';
+  return result;
+}
+
+}  // namespace
+
+namespace internal {
+
+void DoIncrementCounter(const char* name, int64_t amount) {
+  ThreadData& data = GetThreadData();
+  std::lock_guard<std::mutex> lock(data.mutex);
+  data.counters[name] += amount;
+}
+
+void DoRecordSample(const char* name, double value) {
+  ThreadData& data = GetThreadData();
+  std::lock_guard<std::mutex> lock(data.mutex);
+  data.histograms[name].Add(value);
+}
+
+}  // namespace internal
+
+void SetEnabled(bool enabled) {
+  internal::g_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+void Reset() {
+  Registry& registry = GetRegistry();
+  for (const auto& data : registry.threads()) {
+    std::lock_guard<std::mutex> lock(data->mutex);
+    data->Clear();
+  }
+  registry.set_epoch_ns(NowNs());
+}
+
+void ScopedZone::Begin(const char* name) {
+  ThreadData& data = GetThreadData();
+  {
+    std::lock_guard<std::mutex> lock(data.mutex);
+    data.current = data.FindOrAddChild(name);
+  }
+  open_ = true;
+  start_ns_ = NowNs();
+}
+
+void ScopedZone::End() {
+  const int64_t end_ns = NowNs();
+  ThreadData& data = GetThreadData();
+  std::lock_guard<std::mutex> lock(data.mutex);
+  // The data might have been Reset() while this zone was open.
+  if (data.current == 0) {
+    return;
+  }
+  ZoneNode& node = data.nodes[data.current];
+  const int64_t duration_ns = end_ns - start_ns_;
+  node.stats.Add(duration_ns);
+  if (static_cast<int>(data.events.size()) < kMaxEventsPerThread) {
+    data.events.push_back({node.name, start_ns_, duration_ns});
+  }
+  data.current = node.parent;
+}
+
+std::string FormatSummary() {
+  // Merge the data of all threads, keyed by the names (rather than the
+  // pointers) so that the same name from different translation units merges.
+  // The zones are keyed by their path from the root, so that sorting them
+  // lists each zone just after its enclosing zone.
+  std::map<std::vector<std::string>, ZoneStats> zones;
+  std::map<std::string, int64_t> counters;
+  std::map<std::string, HistogramStats> histograms;
+  for (const auto& data : GetRegistry().threads()) {
+    std::lock_guard<std::mutex> lock(data->mutex);
+    std::vector<std::vector<std::string>> paths(data->nodes.size());
+    for (int i = 1; i < static_cast<int>(data->nodes.size()); ++i) {
+      // Parents are always added before their children.
+      const ZoneNode& node = data->nodes[i];
+      paths[i] = paths[node.parent];
+      paths[i].push_back(node.name);
+      zones[paths[i]].Merge(node.stats);
+    }
+    for (const auto& [name, total] : data->counters) {
+      counters[name] += total;
+    }
+    for (const auto& [name, stats] : data->histograms) {
+      histograms[name].Merge(stats);
+    }
+  }
+
+  std::string result;
+  result += "Zones (calls, total [ms], mean [us], min [us], max [us]):\n";
+  for (const auto& [path, stats] : zones) {
+    if (stats.count == 0) {
+      continue;
+    }
+    const std::string indent(2 * path.size(), ' ');
+    result += fmt::format(
+        "{}{}: {}, {:.3f}, {:.3f}, {:.3f}, {:.3f}\n", indent, path.back(),
+        stats.count, stats.total_ns * 1e-6,
+        stats.total_ns * 1e-3 / stats.count, stats.min_ns * 1e-3,
+        stats.max_ns * 1e-3);
+  }
+  result += "Counters:\n";
+  for (const auto& [name, total] : counters) {
+    result += fmt::format("  {}: {}\n", name, total);
+  }
+  result += "Histograms (count, mean, min, max):\n";
+  for (const auto& [name, stats] : histograms) {
+    result += fmt::format("  {}: {}, {}, {}, {}\n", name, stats.count,
+                          stats.sum / stats.count, stats.min, stats.max);
+    for (const auto& [bucket, bucket_count] : stats.buckets) {
+      if (bucket == HistogramStats::kNonPositiveBucket) {
+        result += fmt::format("    (-inf, 0]: {}\n", bucket_count);
+      } else {
+        result += fmt::format("    [{}, {}): {}\n", std::ldexp(1.0, bucket),
+                              std::ldexp(1.0, bucket + 1), bucket_count);
+      }
+    }
+  }
+  return result;
+}
+
+std::string FormatChromeTrace() {
+  const int64_t epoch_ns = GetRegistry().epoch_ns();
+  std::map<std::string, int64_t> counters;
+  int64_t last_ns = epoch_ns;
+  std::vector<std::string> events;
+  for (const auto& data : GetRegistry().threads()) {
+    std::lock_guard<std::mutex> lock(data->mutex);
+    for (const ZoneEvent& event : data->events) {
+      events.push_back(fmt::format(
+          "{{\"name\":{},\"ph\":\"X\",\"ts\":{:.3f},\"dur\":{:.3f},"
+          "\"pid\":0,\"tid\":{}}}",
+          JsonString(event.name), (event.start_ns - epoch_ns) * 1e-3,
+          event.duration_ns * 1e-3, data->thread_id));
+      last_ns = std::max(last_ns, event.start_ns + event.duration_ns);
+    }
+    for (const auto& [name, total] : data->counters) {
+      counters[name] += total;
+    }
+  }
+  for (const auto& [name, total] : counters) {
+    events.push_back(fmt::format(
+        "{{\"name\":{},\"ph\":\"C\",\"ts\":{:.3f},\"pid\":0,\"tid\":0,"
+        "\"args\":{{\"value\":{}}}}}",
+        JsonString(name), (last_ns - epoch_ns) * 1e-3, total));
+  }
+  return fmt::format("{{\"traceEvents\":[\n{}\n]}}\n",
+                     fmt::join(events, ",\n"));
+}
+
+void WriteChromeTrace(const std::string& filename) {
+  std::ofstream output(filename, std::ios::trunc);
+  if (output.is_open()) {
+    output << FormatChromeTrace();
+    output.close();
+  }
+  if (output.fail()) {
+    throw std::runtime_error(
+        fmt::format("Could not write the Chrome trace to '{}'", filename));
+  }
+}
+
+}  // namespace instrumentation
+}  // namespace drake
@@ -0,0 +1,134 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+#include "drake/common/drake_copyable.h"
+
+namespace drake {
+namespace instrumentation {
+
+/** @file
+Provides a lightweight, thread-aware instrumentation API for named timing
+zones, counters, and histograms.
+
+Code annotates its hot paths with ScopedZone (to time a scope), with
+IncrementCounter() (to count events), and with RecordSample() (to collect the
+distribution of a value):
+
+@code
+void ProximityEngine::ComputeContactSurfaces(...) const {
+  instrumentation::ScopedZone zone("ProximityEngine::ComputeContactSurfaces");
+  ...
+  instrumentation::IncrementCounter("ProximityEngine::num_contact_surfaces",
+                                    surfaces.size());
+}
+@endcode
+
+Instrumentation is disabled by default. While disabled, each annotation costs
+a single relaxed atomic load and records nothing, so annotations may be left in
+production code. Once enabled (see SetEnabled()), each thread records into its
+own storage (without contention between threads), and the collected data can
+be exported at any time:
+
+@code
+instrumentation::SetEnabled(true);
+simulator.AdvanceTo(1.0);
+drake::log()->info(instrumentation::FormatSummary());
+instrumentation::WriteChromeTrace("/tmp/trace.json");
+@endcode
+
+Zones nest: the summary reports each zone under the zones that were open on the
+same thread when it was entered (e.g., the time spent in ProximityEngine
+queries during a discrete update). The Chrome trace records every zone as a
+complete event on its thread's track, and can be viewed in chrome://tracing or
+https://ui.perfetto.dev.
+
+All names passed to this API must be string literals (or otherwise outlive all
+uses of this API); they are stored by pointer and compared by value only when
+the data is exported.
+
+All functions in this file are thread-safe. */
+
+namespace internal {
+extern std::atomic<bool> g_enabled;
+void DoIncrementCounter(const char* name, int64_t amount);
+void DoRecordSample(const char* name, double value);
+}  // namespace internal
+
+/** Returns whether instrumentation is currently being recorded. */
+inline bool IsEnabled() {
+  return internal::g_enabled.load(std::memory_order_relaxed);
+}
+
+/** Enables or disables recording. Disabling does not discard the data that
+was recorded so far; see Reset(). A zone is recorded if and only if it was
+opened while recording was enabled. */
+void SetEnabled(bool enabled);
+
+/** Discards all recorded data. Must not be called while any ScopedZone is
+open on any thread. */
+void Reset();
+
+/** Times the scope in which it lives (from construction to destruction) as a
+zone with the given name, on the current thread. */
+class ScopedZone {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(ScopedZone)
+
+  /** Opens the zone `name`, if instrumentation is enabled. */
+  explicit ScopedZone(const char* name) {
+    if (IsEnabled()) {
+      Begin(name);
+    }
+  }
+
+  /** Closes the zone. */
+  ~ScopedZone() {
+    if (open_) {
+      End();
+    }
+  }
+
+ private:
+  void Begin(const char* name);
+  void End();
+
+  bool open_{false};
+  int64_t start_ns_{};
+};
+
+/** Adds `amount` to the counter `name`, if instrumentation is enabled. */
+inline void IncrementCounter(const char* name, int64_t amount = 1) {
+  if (IsEnabled()) {
+    internal::DoIncrementCounter(name, amount);
+  }
+}
+
+/** Adds `value` to the histogram `name`, if instrumentation is enabled. */
+inline void RecordSample(const char* name, double value) {
+  if (IsEnabled()) {
+    internal::DoRecordSample(name, value);
+  }
+}
+
+/** Returns a plain text summary of the recorded data: for each zone (nested
+under its enclosing zones), the number of calls and the total, mean, min, and
+max durations; the total of each counter; and the count, mean, min, max, and a
+coarse (power of two) distribution of each histogram. */
+std::string FormatSummary();
+
+/** Returns the recorded zones and counters in the Chrome trace event JSON
+format. Zones are "complete" ("X") events; each counter is one "C" event with
+its total at the end of the trace. To bound the memory used by long runs, each
+thread keeps at most its first million zone events for the trace (the summary
+is not affected by this limit). */
+std::string FormatChromeTrace();
+
+/** Writes FormatChromeTrace() to the given file.
+@throws std::exception if the file could not be written. */
+void WriteChromeTrace(const std::string& filename);
+
+}  // namespace instrumentation
+}  // namespace drake
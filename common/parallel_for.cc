@@ -0,0 +1,170 @@
+#include "drake/common/parallel_for.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "drake/common/drake_throw.h"
+#include "drake/common/never_destroyed.h"
+
+namespace drake {
+namespace internal {
+namespace {
+
+// Whether the current thread is running iterations of a ParallelFor() loop.
+// This is always true for the workers of the pool.
+thread_local bool is_in_parallel_for = false;
+
+// The state of one call to ParallelFor(), shared by all of the threads that
+// help with it.
+class Loop {
+ public:
+  Loop(int count, const std::function<void(int)>* func)
+      : count_(count), func_(func), errors_(count) {}
+
+  // Calls func for indices that no thread has claimed yet, until there are
+  // none left.
+  void Work() {
+    int num_done = 0;
+    for (int i = next_.fetch_add(1); i < count_; i = next_.fetch_add(1)) {
+      try {
+        (*func_)(i);
+      } catch (...) {
+        errors_[i] = std::current_exception();
+      }
+      ++num_done;
+    }
+    if (num_done > 0) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      num_done_ += num_done;
+      if (num_done_ == count_) {
+        done_.notify_all();
+      }
+    }
+  }
+
+  // Waits until every index has been done, then rethrows the exception of
+  // the lowest index, if any.
+  void Finish() {
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      done_.wait(lock, [this]() {
+        return num_done_ == count_;
+      });
+    }
+    for (const std::exception_ptr& error : errors_) {
+      if (error != nullptr) {
+        std::rethrow_exception(error);
+      }
+    }
+  }
+
+ private:
+  const int count_;
+  // Only dereferenced for claimed indices, all of which are done before
+  // ParallelFor() returns, so it never dangles.
+  const std::function<void(int)>* const func_;
+  std::atomic<int> next_{0};
+  std::vector<std::exception_ptr> errors_;
+
+  std::mutex mutex_;
+  std::condition_variable done_;
+  int num_done_{0};
+};
+
+// The process-wide pool of workers. It is never destroyed, so that its
+// (idle) workers need not be joined at exit.
+class ThreadPool {
+ public:
+  ThreadPool() {
+    const int num_workers = Parallelism::Max().num_threads() - 1;
+    workers_.reserve(num_workers);
+    for (int i = 0; i < num_workers; ++i) {
+      workers_.emplace_back([this]() {
+        RunWorker();
+      });
+    }
+  }
+
+  int num_workers() const { return static_cast<int>(workers_.size()); }
+
+  // Asks `num_helpers` workers (as they become free) to help with `loop`.
+  void Submit(const std::shared_ptr<Loop>& loop, int num_helpers) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      for (int i = 0; i < num_helpers; ++i) {
+        queue_.push_back(loop);
+      }
+    }
+    if (num_helpers == 1) {
+      wake_.notify_one();
+    } else {
+      wake_.notify_all();
+    }
+  }
+
+ private:
+  void RunWorker() {
+    is_in_parallel_for = true;
+    while (true) {
+      std::shared_ptr<Loop> loop;
+      {
+        std::unique_lock<std::mutex> lock(mutex_);
+        wake_.wait(lock, [this]() {
+          return !queue_.empty();
+        });
+        loop = std::move(queue_.front());
+        queue_.pop_front();
+      }
+      // If the other threads have already done all of the loop's indices,
+      // this returns immediately.
+      loop->Work();
+    }
+  }
+
+  std::vector<std::thread> workers_;
+  std::mutex mutex_;
+  std::condition_variable wake_;
+  std::deque<std::shared_ptr<Loop>> queue_;
+};
+
+ThreadPool& GetThreadPool() {
+  static never_destroyed<ThreadPool> pool;
+  return pool.access();
+}
+
+}  // namespace
+
+void ParallelFor(Parallelism parallelism, int count,
+                 const std::function<void(int)>& func) {
+  DRAKE_THROW_UNLESS(count >= 0);
+  if (parallelism.num_threads() == 1 || count < 2 || is_in_parallel_for) {
+    for (int i = 0; i < count; ++i) {
+      func(i);
+    }
+    return;
+  }
+  ThreadPool& pool = GetThreadPool();
+  if (pool.num_workers() == 0) {
+    ParallelFor(false, count, func);
+    return;
+  }
+  const int num_helpers = std::min(
+      {parallelism.num_threads() - 1, count - 1, pool.num_workers()});
+  auto loop = std::make_shared<Loop>(count, &func);
+  pool.Submit(loop, num_helpers);
+  is_in_parallel_for = true;
+  loop->Work();
+  is_in_parallel_for = false;
+  loop->Finish();
+}
+
+}  // namespace internal
+}  // namespace drake
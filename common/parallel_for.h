@@ -0,0 +1,37 @@
+#pragma once
+
+#include <functional>
+
+#include "drake/common/parallelism.h"
+
+namespace drake {
+namespace internal {
+
+/* Calls `func(i)` for every i in [0, count), using up to
+`parallelism.num_threads()` threads: the calling thread plus workers drawn from
+a single thread pool that is shared by the whole process.
+
+All of Drake's parallel loops should go through this function, so that running
+several parallel algorithms at once (or one inside another) does not
+oversubscribe the cores:
+- The pool has Parallelism::Max().num_threads() - 1 workers, which are created
+  the first time they are needed and then reused. Hence no more threads than
+  the configured maximum ever run Drake loops, no matter how many loops run
+  concurrently.
+- A call made from inside `func` (of this or any other loop) runs serially on
+  the thread that made it. The outermost loop is the one that is spread across
+  the threads.
+
+The indices are handed out one at a time, to whichever thread is free next, so
+that iterations of uneven cost are balanced across the threads; the order in
+which they are called is unspecified. `func` must be safe to call concurrently
+for distinct indices.
+
+If any call throws, the exception thrown by the call with the lowest index (the
+one a serial loop would have thrown) is rethrown. When the loop runs in
+parallel, all of the other calls are nonetheless made first. */
+void ParallelFor(Parallelism parallelism, int count,
+                 const std::function<void(int)>& func);
+
+}  // namespace internal
+}  // namespace drake
@@ -1,6 +1,11 @@
 #include "drake/common/random.h"
 
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
 #include "drake/common/autodiff.h"
+#include "drake/common/drake_throw.h"
 
 namespace drake {
 std::unique_ptr<RandomGenerator::Engine> RandomGenerator::CreateEngine(
@@ -8,6 +13,46 @@ std::unique_ptr<RandomGenerator::Engine> RandomGenerator::CreateEngine(
   return std::make_unique<RandomGenerator::Engine>(seed);
 }
 
+std::array<uint32_t, 4> PhiloxRandomGenerator::Philox(
+    const std::array<uint32_t, 4>& counter,
+    const std::array<uint32_t, 2>& key) {
+  // The multipliers and the Weyl sequence increments of Philox4x32.
+  constexpr uint64_t kM0 = 0xD2511F53;
+  constexpr uint64_t kM1 = 0xCD9E8D57;
+  constexpr uint32_t kW0 = 0x9E3779B9;
+  constexpr uint32_t kW1 = 0xBB67AE85;
+  std::array<uint32_t, 4> x = counter;
+  std::array<uint32_t, 2> k = key;
+  for (int round = 0; round < 10; ++round) {
+    const uint64_t product0 = kM0 * x[0];
+    const uint64_t product1 = kM1 * x[2];
+    const auto hi = [](uint64_t product) {
+      return static_cast<uint32_t>(product >> 32);
+    };
+    const auto lo = [](uint64_t product) {
+      return static_cast<uint32_t>(product);
+    };
+    x = {hi(product1) ^ x[1] ^ k[0], lo(product1), hi(product0) ^ x[3] ^ k[1],
+         lo(product0)};
+    k[0] += kW0;
+    k[1] += kW1;
+  }
+  return x;
+}
+
+std::array<uint32_t, 4> PhiloxRandomGenerator::GenerateBlock(uint64_t seed,
+                                                             uint64_t stream,
+                                                             uint64_t block) {
+  const auto lo = [](uint64_t value) {
+    return static_cast<uint32_t>(value);
+  };
+  const auto hi = [](uint64_t value) {
+    return static_cast<uint32_t>(value >> 32);
+  };
+  return Philox({lo(block), hi(block), lo(stream), hi(stream)},
+                {lo(seed), hi(seed)});
+}
+
 template <typename T>
 T CalcProbabilityDensity(RandomDistribution distribution,
                          const Eigen::Ref<const VectorX<T>>& x) {
@@ -36,6 +81,105 @@ T CalcProbabilityDensity(RandomDistribution distribution,
   DRAKE_UNREACHABLE();
 }
 
+void PhiloxRandomGenerator::generate(result_type* first, result_type* last) {
+  // Finish the current block one value at a time.
+  while (first != last && position_ % 4 != 0) {
+    *(first++) = (*this)();
+  }
+  // Then do whole blocks directly.
+  while (last - first >= 4) {
+    const std::array<uint32_t, 4> block =
+        GenerateBlock(seed_, stream_, position_ / 4);
+    std::copy(block.begin(), block.end(), first);
+    first += 4;
+    position_ += 4;
+  }
+  while (first != last) {
+    *(first++) = (*this)();
+  }
+}
+
+namespace {
+
+// Overwrites `bits` with the next values of `generator`.
+void GenerateBits(RandomGenerator* generator, std::vector<uint32_t>* bits) {
+  for (uint32_t& value : *bits) {
+    value = static_cast<uint32_t>((*generator)());
+  }
+}
+
+void GenerateBits(PhiloxRandomGenerator* generator,
+                  std::vector<uint32_t>* bits) {
+  generator->generate(bits->data(), bits->data() + bits->size());
+}
+
+template <typename Generator>
+void FillRandomSamplesImpl(RandomDistribution distribution,
+                           Generator* generator,
+                           EigenPtr<Eigen::MatrixXd> samples) {
+  DRAKE_THROW_UNLESS(generator != nullptr);
+  DRAKE_THROW_UNLESS(samples != nullptr);
+  const int num_samples = samples->size();
+  const bool is_gaussian = distribution == RandomDistribution::kGaussian;
+  // Draw all of the random bits at once. The Box-Muller transform makes the
+  // Gaussian samples in pairs, from three values of the generator per pair.
+  std::vector<uint32_t> bits(is_gaussian ? 3 * ((num_samples + 1) / 2)
+                                         : 2 * num_samples);
+  GenerateBits(generator, &bits);
+  const uint32_t* next_bits = bits.data();
+  // Returns a uniform variate in [0, 1) with 53 random bits.
+  const auto uniform53 = [&next_bits]() {
+    const uint64_t hi = *(next_bits++) >> 5;
+    const uint64_t lo = *(next_bits++) >> 6;
+    return static_cast<double>((hi << 26) | lo) * 0x1.0p-53;
+  };
+  std::vector<double> values(num_samples + 1);
+  switch (distribution) {
+    case RandomDistribution::kUniform: {
+      for (int i = 0; i < num_samples; ++i) {
+        values[i] = uniform53();
+      }
+      break;
+    }
+    case RandomDistribution::kGaussian: {
+      for (int i = 0; i < num_samples; i += 2) {
+        // 1 - u is in (0, 1], so its logarithm is finite. The angle only needs
+        // 32 bits of resolution.
+        const double radius = std::sqrt(-2.0 * std::log(1.0 - uniform53()));
+        const double angle = (2 * M_PI * 0x1.0p-32) * *(next_bits++);
+        values[i] = radius * std::cos(angle);
+        values[i + 1] = radius * std::sin(angle);
+      }
+      break;
+    }
+    case RandomDistribution::kExponential: {
+      for (int i = 0; i < num_samples; ++i) {
+        values[i] = -std::log(1.0 - uniform53());
+      }
+      break;
+    }
+  }
+  const int rows = samples->rows();
+  for (int j = 0; j < samples->cols(); ++j) {
+    samples->col(j) =
+        Eigen::Map<const Eigen::VectorXd>(values.data() + j * rows, rows);
+  }
+}
+
+}  // namespace
+
+void FillRandomSamples(RandomDistribution distribution,
+                       RandomGenerator* generator,
+                       EigenPtr<Eigen::MatrixXd> samples) {
+  FillRandomSamplesImpl(distribution, generator, samples);
+}
+
+void FillRandomSamples(RandomDistribution distribution,
+                       PhiloxRandomGenerator* generator,
+                       EigenPtr<Eigen::MatrixXd> samples) {
+  FillRandomSamplesImpl(distribution, generator, samples);
+}
+
 // TODO(jwnimmer-tri) Use DRAKE_DEFINE_FUNCTION_TEMPLATE_INSTANTIATIONS_...
 // here, once we can break the dependency cycle.
 template double CalcProbabilityDensity<double>(
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <array>
+#include <cstdint>
+#include <limits>
 #include <memory>
 #include <random>
 
@@ -53,6 +56,74 @@ class RandomGenerator {
   copyable_unique_ptr<Engine> generator_;
 };
 
+/// A counter-based pseudo-random number generator, which implements the
+/// UniformRandomBitGenerator C++ concept with the same range as
+/// RandomGenerator. This uses Philox4x32-10 by Salmon et al., "Parallel random
+/// numbers: as easy as 1, 2, 3", 2011.
+///
+/// The n'th value of a generator is a pure function of its (seed, stream, n),
+/// so the generator is tiny (it does not allocate), skipping ahead with
+/// discard() is O(1), and generators with the same seed but different streams
+/// produce statistically independent sequences. This makes it easy to give
+/// each worker of a parallel computation its own reproducible stream, e.g.,
+/// `PhiloxRandomGenerator(seed, worker_index)`, without having to draw seeds
+/// for the workers from a shared generator.
+class PhiloxRandomGenerator {
+ public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(PhiloxRandomGenerator)
+
+  using result_type = uint32_t;
+
+  /// Creates the generator for the given `seed` and `stream`.
+  explicit PhiloxRandomGenerator(uint64_t seed = 0, uint64_t stream = 0)
+      : seed_(seed), stream_(stream) {}
+
+  static constexpr result_type min() { return 0; }
+  static constexpr result_type max() {
+    return std::numeric_limits<result_type>::max();
+  }
+
+  /// Generates a pseudo-random value.
+  result_type operator()() {
+    const uint64_t block = position_ / 4;
+    if (block != block_index_) {
+      block_ = GenerateBlock(seed_, stream_, block);
+      block_index_ = block;
+    }
+    return block_[position_++ % 4];
+  }
+
+  /// Advances the generator by `n` values, in constant time.
+  void discard(uint64_t n) { position_ += n; }
+
+  /// Overwrites [first, last) with the next values of the generator, exactly
+  /// as (but faster than) calling operator() for each element in turn.
+  void generate(result_type* first, result_type* last);
+
+  uint64_t seed() const { return seed_; }
+  uint64_t stream() const { return stream_; }
+
+  /// Returns the four values of the Philox4x32-10 bijection of the given
+  /// 128-bit `counter` under the given 64-bit `key`. The counter and key are
+  /// given as 32-bit words, least significant first. The generator's n'th
+  /// block of four values is Philox(counter = {n, stream}, key = seed).
+  static std::array<uint32_t, 4> Philox(const std::array<uint32_t, 4>& counter,
+                                        const std::array<uint32_t, 2>& key);
+
+ private:
+  static std::array<uint32_t, 4> GenerateBlock(uint64_t seed, uint64_t stream,
+                                               uint64_t block);
+
+  uint64_t seed_{};
+  uint64_t stream_{};
+  // The number of values that have been generated (or discarded) so far.
+  uint64_t position_{0};
+  // The values of block number block_index_, i.e., of the positions
+  // [4 * block_index_, 4 * block_index_ + 4).
+  std::array<uint32_t, 4> block_{};
+  uint64_t block_index_{std::numeric_limits<uint64_t>::max()};
+};
+
 /// Drake supports explicit reasoning about a few carefully chosen random
 /// distributions.
 enum class RandomDistribution {
@@ -78,4 +149,31 @@ enum class RandomDistribution {
 template <typename T>
 T CalcProbabilityDensity(RandomDistribution distribution,
                          const Eigen::Ref<const VectorX<T>>& x);
+
+/**
+ * Fills every element of `samples` with an independent sample of the given
+ * `distribution`, drawing the random bits from `generator`.
+ *
+ * The samples are generated in one pass, without the per-call overhead (and
+ * the hidden state) of the `std::` distributions: the exponential samples use
+ * the inverse transform, and the Gaussian samples use the Box-Muller
+ * transform, which makes them in pairs from fewer random bits than the
+ * rejection sampling of `std::normal_distribution`. Note that the resulting
+ * values differ from the ones that the `std::` distributions would produce
+ * with the same generator.
+ *
+ * The elements are filled in column-major order. Each uniform or exponential
+ * sample uses 53 random bits (two values of the generator); each pair of
+ * Gaussian samples uses 53 random bits for its radius and 32 for its angle.
+ *
+ * @throws std::exception if `generator` or `samples` is nullptr.
+ */
+void FillRandomSamples(RandomDistribution distribution,
+                       RandomGenerator* generator,
+                       EigenPtr<Eigen::MatrixXd> samples);
+
+/** Overload of FillRandomSamples() for a PhiloxRandomGenerator. */
+void FillRandomSamples(RandomDistribution distribution,
+                       PhiloxRandomGenerator* generator,
+                       EigenPtr<Eigen::MatrixXd> samples);
 }  // namespace drake
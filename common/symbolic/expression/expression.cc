@@ -6,6 +6,7 @@
 #include <algorithm>
 #include <ios>
 #include <stdexcept>
+#include <unordered_set>
 
 #include "absl/container/flat_hash_set.h"
 #include "absl/container/inlined_vector.h"
@@ -52,9 +53,17 @@ Expression NegateMultiplication(const Expression& e) {
 Expression::Expression(const Variable& var)
     : Expression{make_unique<ExpressionVar>(var)} {}
 
+namespace {
+// The innermost ExpressionInterningScope of the current thread, if any.
+thread_local ExpressionInterningScope* g_interning_scope{nullptr};
+}  // namespace
+
 // Constructs this taking ownership of the given call.
 Expression::Expression(std::unique_ptr<ExpressionCell> cell) {
   boxed_.SetSharedCell(cell.release());
+  if (g_interning_scope != nullptr) {
+    *this = ExpressionInterningScope::Intern(std::move(*this));
+  }
 }
 
 // Implements the Expression(double) constructor when the constant is NaN.
@@ -197,7 +206,9 @@ Expression Expression::Expand() const {
   }
 
   Expression result = cell().Expand();
-  if (!result.is_expanded()) {
+  // N.B. The result might be shared with other expressions (e.g., when it was
+  // interned by an ExpressionInterningScope), in which case we leave it alone.
+  if (!result.is_expanded() && result.cell().use_count() == 1) {
     result.mutable_cell().set_expanded();
   }
   return result;
@@ -1013,6 +1024,168 @@ Variables GetDistinctVariables(const Eigen::Ref<const MatrixX<Expression>>& v) {
   return visitor.variables;
 }
 
+// The set of interned expressions, where expressions are identified by their
+// kind and the identity of their operands. The operands are hashed and
+// compared as constant values or as cell addresses, so that hashing and
+// comparing an expression does not recurse into its subexpressions.
+class ExpressionInterningScope::Impl {
+ public:
+  // Hashes the expression `e`, which is not a constant.
+  struct ShallowHash {
+    size_t operator()(const Expression& e) const {
+      using drake::hash_append;
+      DefaultHasher hasher;
+      hash_append(hasher, e.get_kind());
+      auto append_operand = [&hasher](const Expression& operand) {
+        if (is_constant(operand)) {
+          hash_append(hasher, get_constant_value(operand));
+        } else {
+          hash_append(hasher,
+                      reinterpret_cast<std::uintptr_t>(&operand.cell()));
+        }
+      };
+      switch (e.get_kind()) {
+        case ExpressionKind::Var:
+          hash_append(hasher, get_variable(e));
+          break;
+        case ExpressionKind::Add:
+          hash_append(hasher, get_constant_in_addition(e));
+          for (const auto& [term, coeff] :
+               get_expr_to_coeff_map_in_addition(e)) {
+            append_operand(term);
+            hash_append(hasher, coeff);
+          }
+          break;
+        case ExpressionKind::Mul:
+          hash_append(hasher, get_constant_in_multiplication(e));
+          for (const auto& [base, exponent] :
+               get_base_to_exponent_map_in_multiplication(e)) {
+            append_operand(base);
+            append_operand(exponent);
+          }
+          break;
+        case ExpressionKind::Div:
+        case ExpressionKind::Pow:
+        case ExpressionKind::Atan2:
+        case ExpressionKind::Min:
+        case ExpressionKind::Max:
+          append_operand(get_first_argument(e));
+          append_operand(get_second_argument(e));
+          break;
+        case ExpressionKind::IfThenElse:
+          hash_append(hasher, get_conditional_formula(e));
+          append_operand(get_then_expression(e));
+          append_operand(get_else_expression(e));
+          break;
+        case ExpressionKind::UninterpretedFunction:
+          hash_append(hasher, get_uninterpreted_function_name(e));
+          for (const Expression& argument :
+               get_uninterpreted_function_arguments(e)) {
+            append_operand(argument);
+          }
+          break;
+        case ExpressionKind::Constant:
+        case ExpressionKind::NaN:
+          break;
+        default:
+          append_operand(get_argument(e));
+      }
+      return static_cast<size_t>(hasher);
+    }
+  };
+
+  // Compares the expressions `a` and `b`, which are not constants.
+  struct ShallowEqual {
+    bool operator()(const Expression& a, const Expression& b) const {
+      if (a.get_kind() != b.get_kind()) {
+        return false;
+      }
+      auto same = [](const Expression& x, const Expression& y) {
+        return x.boxed_.trivially_equals(y.boxed_) ||
+               (is_constant(x) && is_constant(y) &&
+                get_constant_value(x) == get_constant_value(y));
+      };
+      switch (a.get_kind()) {
+        case ExpressionKind::Var:
+          return get_variable(a).equal_to(get_variable(b));
+        case ExpressionKind::Add:
+          return get_constant_in_addition(a) == get_constant_in_addition(b) &&
+                 std::equal(get_expr_to_coeff_map_in_addition(a).begin(),
+                            get_expr_to_coeff_map_in_addition(a).end(),
+                            get_expr_to_coeff_map_in_addition(b).begin(),
+                            get_expr_to_coeff_map_in_addition(b).end(),
+                            [&same](const auto& x, const auto& y) {
+                              return same(x.first, y.first) &&
+                                     x.second == y.second;
+                            });
+        case ExpressionKind::Mul:
+          return get_constant_in_multiplication(a) ==
+                     get_constant_in_multiplication(b) &&
+                 std::equal(
+                     get_base_to_exponent_map_in_multiplication(a).begin(),
+                     get_base_to_exponent_map_in_multiplication(a).end(),
+                     get_base_to_exponent_map_in_multiplication(b).begin(),
+                     get_base_to_exponent_map_in_multiplication(b).end(),
+                     [&same](const auto& x, const auto& y) {
+                       return same(x.first, y.first) &&
+                              same(x.second, y.second);
+                     });
+        case ExpressionKind::Div:
+        case ExpressionKind::Pow:
+        case ExpressionKind::Atan2:
+        case ExpressionKind::Min:
+        case ExpressionKind::Max:
+          return same(get_first_argument(a), get_first_argument(b)) &&
+                 same(get_second_argument(a), get_second_argument(b));
+        case ExpressionKind::IfThenElse:
+          return get_conditional_formula(a).EqualTo(
+                     get_conditional_formula(b)) &&
+                 same(get_then_expression(a), get_then_expression(b)) &&
+                 same(get_else_expression(a), get_else_expression(b));
+        case ExpressionKind::UninterpretedFunction:
+          return get_uninterpreted_function_name(a) ==
+                     get_uninterpreted_function_name(b) &&
+                 std::equal(get_uninterpreted_function_arguments(a).begin(),
+                            get_uninterpreted_function_arguments(a).end(),
+                            get_uninterpreted_function_arguments(b).begin(),
+                            get_uninterpreted_function_arguments(b).end(),
+                            same);
+        case ExpressionKind::Constant:
+        case ExpressionKind::NaN:
+          return true;
+        default:
+          return same(get_argument(a), get_argument(b));
+      }
+    }
+  };
+
+  // Holding the expressions keeps them alive. That also guarantees that the
+  // interned cells are never mutated in place, because their use_count is
+  // never one while they are held by an Expression outside of this set.
+  std::unordered_set<Expression, ShallowHash, ShallowEqual> expressions;
+};
+
+ExpressionInterningScope::ExpressionInterningScope()
+    : impl_(std::make_unique<Impl>()), previous_(g_interning_scope) {
+  g_interning_scope = this;
+}
+
+ExpressionInterningScope::~ExpressionInterningScope() {
+  DRAKE_DEMAND(g_interning_scope == this);
+  // Stop interning before releasing the expressions.
+  g_interning_scope = previous_;
+}
+
+int ExpressionInterningScope::size() const {
+  return impl_->expressions.size();
+}
+
+Expression ExpressionInterningScope::Intern(Expression e) {
+  DRAKE_ASSERT(g_interning_scope != nullptr);
+  DRAKE_ASSERT(!is_constant(e));
+  return *g_interning_scope->impl_->expressions.insert(std::move(e)).first;
+}
+
 }  // namespace symbolic
 
 double ExtractDoubleOrThrow(const symbolic::Expression& e) {
@@ -601,6 +601,7 @@ class Expression {
 
   friend class ExpressionAddFactory;
   friend class ExpressionMulFactory;
+  friend class ExpressionInterningScope;
   template <bool>
   friend struct internal::Gemm;
 
@@ -898,6 +899,57 @@ Expression operator-(const Variable& var);
 ///                  resulting polynomial approximating `f` around `a`.
 Expression TaylorExpand(const Expression& f, const Environment& a, int order);
 
+/** While an object of this class is alive, the expressions constructed on the
+current thread are hash-consed: whenever a new (non-constant) expression is
+structurally identical to one that was already constructed within the scope,
+the new expression shares the existing storage instead. In particular, equal
+expressions built within the scope compare equal by a pointer comparison, and
+repeated subexpressions (e.g., the same monomials appearing in many terms of a
+large polynomial program) are stored only once.
+
+Two expressions are treated as identical when they have the same kind and the
+same operands, where the operands are compared by identity (i.e., constants by
+value and other subexpressions by storage). Therefore, subexpressions that
+were constructed before the scope was created are only shared if they were
+themselves shared.
+
+The scope keeps every interned expression alive until the scope is destroyed.
+Scopes may be nested, in which case only the innermost scope is used.
+
+For example:
+@code
+ExpressionInterningScope scope;
+const Expression e1 = x * y + sin(x);
+const Expression e2 = x * y + sin(x);
+// e1 and e2 share the same storage, and so do the two x * y.
+@endcode */
+class ExpressionInterningScope {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(ExpressionInterningScope)
+
+  /** Starts interning the expressions constructed on the current thread. */
+  ExpressionInterningScope();
+
+  /** Stops interning, and releases this scope's references to the interned
+  expressions. */
+  ~ExpressionInterningScope();
+
+  /** Returns the number of distinct expressions interned by this scope. */
+  int size() const;
+
+ private:
+  friend class Expression;
+
+  class Impl;
+
+  // Returns the canonical representative of `e`, which is either `e` itself
+  // (which is then interned) or a previously interned identical expression.
+  static Expression Intern(Expression e);
+
+  std::unique_ptr<Impl> impl_;
+  ExpressionInterningScope* const previous_;
+};
+
 }  // namespace symbolic
 }  // namespace drake
 
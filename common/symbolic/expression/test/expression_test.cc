@@ -2050,6 +2050,37 @@ TEST_F(SymbolicExpressionTest, GetDistinctVariables) {
             Variables({var_x_, var_z_}));
 }
 
+TEST_F(SymbolicExpressionTest, InterningScope) {
+  ExpressionInterningScope scope;
+  EXPECT_EQ(scope.size(), 0);
+  const Expression e1 = sin(x_ + y_) * cos(x_ + y_);
+  // x + y, sin, cos, and the product.
+  EXPECT_EQ(scope.size(), 4);
+  // Building the same expression again does not intern any new cells.
+  const Expression e2 = sin(x_ + y_) * cos(x_ + y_);
+  EXPECT_EQ(scope.size(), 4);
+  EXPECT_PRED2(ExprEqual, e1, e2);
+  // Nor does a different expression that shares its subexpressions, except
+  // for the new ones.
+  const Expression e3 = sin(x_ + y_) + 2.0;
+  EXPECT_EQ(scope.size(), 5);
+  // Interned expressions are still expanded as usual.
+  EXPECT_PRED2(ExprEqual, ((x_ + y_) * (x_ - y_)).Expand(),
+               pow(x_, 2) - pow(y_, 2));
+  {
+    // Nested scopes intern only into the innermost scope.
+    ExpressionInterningScope inner;
+    const Expression e4 = sin(x_ + y_);
+    EXPECT_EQ(inner.size(), 2);
+    EXPECT_PRED2(ExprEqual, e4, sin(x_ + y_));
+    EXPECT_EQ(inner.size(), 2);
+  }
+  const int size = scope.size();
+  const Expression e5 = cos(x_ + y_);
+  EXPECT_EQ(scope.size(), size);
+  EXPECT_PRED2(ExprEqual, e5 * sin(x_ + y_), e1);
+}
+
 TEST_F(SymbolicExpressionTest, TaylorExpand1) {
   // Test TaylorExpand(exp(-x²-y²), {x:1, y:2}, 2).
   const Expression& x{x_};
@@ -0,0 +1,629 @@
+#include "drake/common/symbolic/expression_tape.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <map>
+#include <stdexcept>
+#include <tuple>
+#include <unordered_map>
+
+#include <fmt/format.h>
+
+#include "drake/common/drake_assert.h"
+#include "drake/common/drake_throw.h"
+
+namespace drake {
+namespace symbolic {
+
+namespace {
+
+// The number of points that EvalBatch() pushes through the tape at once. Each
+// register holds this many values, which keeps the registers in cache.
+constexpr int kBatchSize = 256;
+
+double GetValue(double x) {
+  return x;
+}
+
+double GetValue(const AutoDiffXd& x) {
+  return x.value();
+}
+
+}  // namespace
+
+// Compiles expressions into instructions in two passes. The first pass emits
+// instructions in static single assignment form, i.e., every instruction
+// writes a new value, with common subexpressions emitted only once. The
+// second pass maps the values onto a small set of reusable registers.
+class ExpressionTape::Compiler {
+ public:
+  explicit Compiler(const Eigen::Ref<const VectorX<Variable>>& variables)
+      : num_variables_(variables.size()) {
+    for (int i = 0; i < variables.size(); ++i) {
+      const bool inserted =
+          variable_to_value_.emplace(variables[i].get_id(), i).second;
+      if (!inserted) {
+        throw std::logic_error(fmt::format(
+            "ExpressionTape: The variable {} is listed more than once.",
+            variables[i]));
+      }
+    }
+  }
+
+  // Returns the value of `e`, emitting the instructions to compute it if
+  // needed.
+  int Visit(const Expression& e) {
+    const auto it = expression_to_value_.find(e);
+    if (it != expression_to_value_.end()) {
+      return it->second;
+    }
+    const int value = DoVisit(e);
+    expression_to_value_.emplace(e, value);
+    return value;
+  }
+
+  // Allocates the registers of the tape, whose expressions are the `outputs`,
+  // and stores the result into `tape`.
+  void Finish(const std::vector<int>& outputs, ExpressionTape* tape) const {
+    // The index of the last instruction that reads each value. The outputs
+    // must survive all of the instructions.
+    const int num_values = num_variables_ + ssa_.size();
+    std::vector<int> last_use(num_values, -1);
+    for (int i = 0; i < static_cast<int>(ssa_.size()); ++i) {
+      for (const int operand : {ssa_[i].a, ssa_[i].b, ssa_[i].c}) {
+        if (operand >= 0) last_use[operand] = i;
+      }
+    }
+    for (const int output : outputs) {
+      last_use[output] = std::numeric_limits<int>::max();
+    }
+
+    // The variables keep their registers. Every instruction gets a register
+    // that is not the register of any of its operands, so that evaluating the
+    // instruction never overwrites its own inputs.
+    std::vector<int> value_to_register(num_values, -1);
+    for (int i = 0; i < num_variables_; ++i) {
+      value_to_register[i] = i;
+    }
+    int num_registers = num_variables_;
+    std::vector<int> free_registers;
+    tape->instructions_.clear();
+    tape->instructions_.reserve(ssa_.size());
+    for (int i = 0; i < static_cast<int>(ssa_.size()); ++i) {
+      Instruction instruction = ssa_[i];
+      const int value = num_variables_ + i;
+      int dst;
+      if (free_registers.empty()) {
+        dst = num_registers++;
+      } else {
+        dst = free_registers.back();
+        free_registers.pop_back();
+      }
+      value_to_register[value] = dst;
+      instruction.dst = dst;
+      for (int* operand : {&instruction.a, &instruction.b, &instruction.c}) {
+        if (*operand < 0) continue;
+        const int operand_value = *operand;
+        *operand = value_to_register[operand_value];
+        if (operand_value >= num_variables_ && last_use[operand_value] == i) {
+          // Each value is freed once, even if used twice by this instruction.
+          last_use[operand_value] = -1;
+          free_registers.push_back(*operand);
+        }
+      }
+      if (last_use[value] < 0) {
+        free_registers.push_back(dst);
+      }
+      tape->instructions_.push_back(instruction);
+    }
+    tape->num_variables_ = num_variables_;
+    tape->num_registers_ = num_registers;
+    tape->outputs_.clear();
+    for (const int output : outputs) {
+      tape->outputs_.push_back(value_to_register[output]);
+    }
+  }
+
+ private:
+  using Key = std::tuple<Op, int, int, int, double>;
+
+  // Returns the value of the instruction, emitting it unless an identical
+  // instruction was already emitted.
+  int Emit(Op op, int a = -1, int b = -1, int c = -1, double k = 0.0) {
+    const Key key{op, a, b, c, k};
+    const auto it = instruction_to_value_.find(key);
+    if (it != instruction_to_value_.end()) {
+      return it->second;
+    }
+    Instruction instruction;
+    instruction.op = op;
+    instruction.a = a;
+    instruction.b = b;
+    instruction.c = c;
+    instruction.k = k;
+    ssa_.push_back(instruction);
+    const int value = num_variables_ + ssa_.size() - 1;
+    instruction_to_value_.emplace(key, value);
+    return value;
+  }
+
+  int EmitConstant(double k) { return Emit(Op::kConstant, -1, -1, -1, k); }
+
+  int EmitUnary(Op op, const Expression& e) {
+    return Emit(op, Visit(get_argument(e)));
+  }
+
+  int EmitBinary(Op op, const Expression& e) {
+    return Emit(op, Visit(get_first_argument(e)),
+                Visit(get_second_argument(e)));
+  }
+
+  // Emits base^exponent, with special cases for constant exponents.
+  int EmitPow(const Expression& base, const Expression& exponent) {
+    if (is_constant(exponent)) {
+      const double k = get_constant_value(exponent);
+      if (k == 1.0) {
+        return Visit(base);
+      }
+      const int base_value = Visit(base);
+      if (k == 2.0) {
+        return Emit(Op::kMul, base_value, base_value);
+      }
+      return Emit(Op::kPowConstant, base_value, -1, -1, k);
+    }
+    return Emit(Op::kPow, Visit(base), Visit(exponent));
+  }
+
+  int DoVisit(const Expression& e) {
+    switch (e.get_kind()) {
+      case ExpressionKind::Constant:
+        return EmitConstant(get_constant_value(e));
+      case ExpressionKind::Var: {
+        const Variable& var = get_variable(e);
+        const auto it = variable_to_value_.find(var.get_id());
+        if (it == variable_to_value_.end()) {
+          throw std::logic_error(fmt::format(
+              "ExpressionTape: The variable {} is not in the list of "
+              "variables.",
+              var));
+        }
+        return it->second;
+      }
+      case ExpressionKind::Add: {
+        // c₀ + ∑ᵢ cᵢ eᵢ.
+        const double c0 = get_constant_in_addition(e);
+        int sum = c0 != 0.0 ? EmitConstant(c0) : -1;
+        for (const auto& [e_i, c_i] : get_expr_to_coeff_map_in_addition(e)) {
+          const int term = Visit(e_i);
+          if (sum < 0) {
+            sum = c_i == 1.0 ? term : Emit(Op::kScale, term, -1, -1, c_i);
+          } else if (c_i == 1.0) {
+            sum = Emit(Op::kAdd, sum, term);
+          } else {
+            sum = Emit(Op::kAddScaled, sum, term, -1, c_i);
+          }
+        }
+        return sum;
+      }
+      case ExpressionKind::Mul: {
+        // c₀ ∏ᵢ bᵢ^eᵢ.
+        int product = -1;
+        for (const auto& [base, exponent] :
+             get_base_to_exponent_map_in_multiplication(e)) {
+          const int factor = EmitPow(base, exponent);
+          product = product < 0 ? factor : Emit(Op::kMul, product, factor);
+        }
+        const double c0 = get_constant_in_multiplication(e);
+        return c0 == 1.0 ? product : Emit(Op::kScale, product, -1, -1, c0);
+      }
+      case ExpressionKind::Div:
+        return EmitBinary(Op::kDiv, e);
+      case ExpressionKind::Log:
+        return EmitUnary(Op::kLog, e);
+      case ExpressionKind::Abs:
+        return EmitUnary(Op::kAbs, e);
+      case ExpressionKind::Exp:
+        return EmitUnary(Op::kExp, e);
+      case ExpressionKind::Sqrt:
+        return EmitUnary(Op::kSqrt, e);
+      case ExpressionKind::Pow:
+        return EmitPow(get_first_argument(e), get_second_argument(e));
+      case ExpressionKind::Sin:
+        return EmitUnary(Op::kSin, e);
+      case ExpressionKind::Cos:
+        return EmitUnary(Op::kCos, e);
+      case ExpressionKind::Tan:
+        return EmitUnary(Op::kTan, e);
+      case ExpressionKind::Asin:
+        return EmitUnary(Op::kAsin, e);
+      case ExpressionKind::Acos:
+        return EmitUnary(Op::kAcos, e);
+      case ExpressionKind::Atan:
+        return EmitUnary(Op::kAtan, e);
+      case ExpressionKind::Atan2:
+        return EmitBinary(Op::kAtan2, e);
+      case ExpressionKind::Sinh:
+        return EmitUnary(Op::kSinh, e);
+      case ExpressionKind::Cosh:
+        return EmitUnary(Op::kCosh, e);
+      case ExpressionKind::Tanh:
+        return EmitUnary(Op::kTanh, e);
+      case ExpressionKind::Min:
+        return EmitBinary(Op::kMin, e);
+      case ExpressionKind::Max:
+        return EmitBinary(Op::kMax, e);
+      case ExpressionKind::Ceil:
+        return EmitUnary(Op::kCeil, e);
+      case ExpressionKind::Floor:
+        return EmitUnary(Op::kFloor, e);
+      case ExpressionKind::IfThenElse: {
+        const int condition = VisitFormula(get_conditional_formula(e));
+        return Emit(Op::kSelect, condition, Visit(get_then_expression(e)),
+                    Visit(get_else_expression(e)));
+      }
+      case ExpressionKind::NaN:
+      case ExpressionKind::UninterpretedFunction:
+        break;
+    }
+    throw std::logic_error(
+        fmt::format("ExpressionTape: The expression {} is not supported.", e));
+  }
+
+  int VisitFormula(const Formula& f) {
+    switch (f.get_kind()) {
+      case FormulaKind::False:
+        return EmitConstant(0.0);
+      case FormulaKind::True:
+        return EmitConstant(1.0);
+      case FormulaKind::Eq:
+        return VisitRelational(Op::kEq, f, false);
+      case FormulaKind::Neq:
+        return VisitRelational(Op::kNeq, f, false);
+      case FormulaKind::Gt:
+        return VisitRelational(Op::kLt, f, true);
+      case FormulaKind::Geq:
+        return VisitRelational(Op::kLeq, f, true);
+      case FormulaKind::Lt:
+        return VisitRelational(Op::kLt, f, false);
+      case FormulaKind::Leq:
+        return VisitRelational(Op::kLeq, f, false);
+      case FormulaKind::And:
+      case FormulaKind::Or: {
+        const Op op = f.get_kind() == FormulaKind::And ? Op::kAnd : Op::kOr;
+        int result = -1;
+        for (const Formula& operand : get_operands(f)) {
+          const int value = VisitFormula(operand);
+          result = result < 0 ? value : Emit(op, result, value);
+        }
+        return result;
+      }
+      case FormulaKind::Not:
+        return Emit(Op::kNot, VisitFormula(get_operand(f)));
+      case FormulaKind::Var:
+      case FormulaKind::Forall:
+      case FormulaKind::Isnan:
+      case FormulaKind::PositiveSemidefinite:
+        break;
+    }
+    throw std::logic_error(
+        fmt::format("ExpressionTape: The formula {} is not supported.", f));
+  }
+
+  // Emits `op` on the two sides of the relational formula `f`, swapped if
+  // requested.
+  int VisitRelational(Op op, const Formula& f, bool swap) {
+    const int lhs = Visit(get_lhs_expression(f));
+    const int rhs = Visit(get_rhs_expression(f));
+    return swap ? Emit(op, rhs, lhs) : Emit(op, lhs, rhs);
+  }
+
+  const int num_variables_;
+  std::unordered_map<Variable::Id, int> variable_to_value_;
+  std::unordered_map<Expression, int> expression_to_value_;
+  std::map<Key, int> instruction_to_value_;
+  std::vector<Instruction> ssa_;
+};
+
+ExpressionTape::ExpressionTape() = default;
+
+ExpressionTape::ExpressionTape(
+    const Eigen::Ref<const VectorX<Expression>>& expressions,
+    const Eigen::Ref<const VectorX<Variable>>& variables) {
+  Compiler compiler(variables);
+  std::vector<int> outputs;
+  outputs.reserve(expressions.size());
+  for (int i = 0; i < expressions.size(); ++i) {
+    outputs.push_back(compiler.Visit(expressions[i]));
+  }
+  compiler.Finish(outputs, this);
+}
+
+ExpressionTape::~ExpressionTape() = default;
+
+template <typename T>
+void ExpressionTape::DoEval(const Eigen::Ref<const VectorX<T>>& x,
+                            VectorX<T>* y) const {
+  DRAKE_THROW_UNLESS(x.size() == num_variables_);
+  DRAKE_THROW_UNLESS(y != nullptr);
+  using std::abs;
+  using std::acos;
+  using std::asin;
+  using std::atan;
+  using std::atan2;
+  using std::ceil;
+  using std::cos;
+  using std::cosh;
+  using std::exp;
+  using std::floor;
+  using std::log;
+  using std::max;
+  using std::min;
+  using std::pow;
+  using std::sin;
+  using std::sinh;
+  using std::sqrt;
+  using std::tan;
+  using std::tanh;
+  std::vector<T> r(num_registers_);
+  for (int i = 0; i < num_variables_; ++i) {
+    r[i] = x[i];
+  }
+  for (const Instruction& in : instructions_) {
+    T& dst = r[in.dst];
+    switch (in.op) {
+      case Op::kConstant:
+        dst = in.k;
+        break;
+      case Op::kAdd:
+        dst = r[in.a] + r[in.b];
+        break;
+      case Op::kAddScaled:
+        dst = r[in.a] + in.k * r[in.b];
+        break;
+      case Op::kScale:
+        dst = in.k * r[in.a];
+        break;
+      case Op::kMul:
+        dst = r[in.a] * r[in.b];
+        break;
+      case Op::kDiv:
+        dst = r[in.a] / r[in.b];
+        break;
+      case Op::kPow:
+        dst = pow(r[in.a], r[in.b]);
+        break;
+      case Op::kPowConstant:
+        dst = pow(r[in.a], in.k);
+        break;
+      case Op::kLog:
+        dst = log(r[in.a]);
+        break;
+      case Op::kAbs:
+        dst = abs(r[in.a]);
+        break;
+      case Op::kExp:
+        dst = exp(r[in.a]);
+        break;
+      case Op::kSqrt:
+        dst = sqrt(r[in.a]);
+        break;
+      case Op::kSin:
+        dst = sin(r[in.a]);
+        break;
+      case Op::kCos:
+        dst = cos(r[in.a]);
+        break;
+      case Op::kTan:
+        dst = tan(r[in.a]);
+        break;
+      case Op::kAsin:
+        dst = asin(r[in.a]);
+        break;
+      case Op::kAcos:
+        dst = acos(r[in.a]);
+        break;
+      case Op::kAtan:
+        dst = atan(r[in.a]);
+        break;
+      case Op::kAtan2:
+        dst = atan2(r[in.a], r[in.b]);
+        break;
+      case Op::kSinh:
+        dst = sinh(r[in.a]);
+        break;
+      case Op::kCosh:
+        dst = cosh(r[in.a]);
+        break;
+      case Op::kTanh:
+        dst = tanh(r[in.a]);
+        break;
+      case Op::kMin:
+        dst = min(r[in.a], r[in.b]);
+        break;
+      case Op::kMax:
+        dst = max(r[in.a], r[in.b]);
+        break;
+      case Op::kCeil:
+        dst = ceil(r[in.a]);
+        break;
+      case Op::kFloor:
+        dst = floor(r[in.a]);
+        break;
+      case Op::kEq:
+        dst = GetValue(r[in.a]) == GetValue(r[in.b]) ? 1.0 : 0.0;
+        break;
+      case Op::kNeq:
+        dst = GetValue(r[in.a]) != GetValue(r[in.b]) ? 1.0 : 0.0;
+        break;
+      case Op::kLt:
+        dst = GetValue(r[in.a]) < GetValue(r[in.b]) ? 1.0 : 0.0;
+        break;
+      case Op::kLeq:
+        dst = GetValue(r[in.a]) <= GetValue(r[in.b]) ? 1.0 : 0.0;
+        break;
+      case Op::kAnd:
+        dst = GetValue(r[in.a]) != 0.0 && GetValue(r[in.b]) != 0.0 ? 1.0 : 0.0;
+        break;
+      case Op::kOr:
+        dst = GetValue(r[in.a]) != 0.0 || GetValue(r[in.b]) != 0.0 ? 1.0 : 0.0;
+        break;
+      case Op::kNot:
+        dst = GetValue(r[in.a]) == 0.0 ? 1.0 : 0.0;
+        break;
+      case Op::kSelect:
+        dst = GetValue(r[in.a]) != 0.0 ? r[in.b] : r[in.c];
+        break;
+    }
+  }
+  y->resize(num_expressions());
+  for (int i = 0; i < num_expressions(); ++i) {
+    (*y)[i] = r[outputs_[i]];
+  }
+}
+
+void ExpressionTape::Eval(const Eigen::Ref<const Eigen::VectorXd>& x,
+                          Eigen::VectorXd* y) const {
+  DoEval<double>(x, y);
+}
+
+void ExpressionTape::Eval(const Eigen::Ref<const AutoDiffVecXd>& x,
+                          AutoDiffVecXd* y) const {
+  DoEval<AutoDiffXd>(x, y);
+}
+
+void ExpressionTape::EvalBatch(const Eigen::Ref<const Eigen::MatrixXd>& x,
+                               Eigen::MatrixXd* y) const {
+  DRAKE_THROW_UNLESS(x.rows() == num_variables_);
+  DRAKE_THROW_UNLESS(y != nullptr);
+  const int num_points = x.cols();
+  y->resize(num_expressions(), num_points);
+  // Each row of `registers` holds one register for a batch of points.
+  Eigen::Array<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>
+      registers(num_registers_, std::min(kBatchSize, num_points));
+  for (int start = 0; start < num_points; start += kBatchSize) {
+    const int n = std::min(kBatchSize, num_points - start);
+    auto r = [&registers, n](int i) {
+      return registers.row(i).head(n);
+    };
+    registers.topLeftCorner(num_variables_, n) =
+        x.middleCols(start, n).array();
+    for (const Instruction& in : instructions_) {
+      auto dst = r(in.dst);
+      switch (in.op) {
+        case Op::kConstant:
+          dst.setConstant(in.k);
+          break;
+        case Op::kAdd:
+          dst = r(in.a) + r(in.b);
+          break;
+        case Op::kAddScaled:
+          dst = r(in.a) + in.k * r(in.b);
+          break;
+        case Op::kScale:
+          dst = in.k * r(in.a);
+          break;
+        case Op::kMul:
+          dst = r(in.a) * r(in.b);
+          break;
+        case Op::kDiv:
+          dst = r(in.a) / r(in.b);
+          break;
+        case Op::kPow:
+          dst = r(in.a).binaryExpr(r(in.b), [](double base, double exponent) {
+            return std::pow(base, exponent);
+          });
+          break;
+        case Op::kPowConstant:
+          dst = r(in.a).pow(in.k);
+          break;
+        case Op::kLog:
+          dst = r(in.a).log();
+          break;
+        case Op::kAbs:
+          dst = r(in.a).abs();
+          break;
+        case Op::kExp:
+          dst = r(in.a).exp();
+          break;
+        case Op::kSqrt:
+          dst = r(in.a).sqrt();
+          break;
+        case Op::kSin:
+          dst = r(in.a).sin();
+          break;
+        case Op::kCos:
+          dst = r(in.a).cos();
+          break;
+        case Op::kTan:
+          dst = r(in.a).tan();
+          break;
+        case Op::kAsin:
+          dst = r(in.a).asin();
+          break;
+        case Op::kAcos:
+          dst = r(in.a).acos();
+          break;
+        case Op::kAtan:
+          dst = r(in.a).atan();
+          break;
+        case Op::kAtan2:
+          dst = r(in.a).binaryExpr(r(in.b), [](double y_i, double x_i) {
+            return std::atan2(y_i, x_i);
+          });
+          break;
+        case Op::kSinh:
+          dst = r(in.a).sinh();
+          break;
+        case Op::kCosh:
+          dst = r(in.a).cosh();
+          break;
+        case Op::kTanh:
+          dst = r(in.a).tanh();
+          break;
+        case Op::kMin:
+          dst = r(in.a).min(r(in.b));
+          break;
+        case Op::kMax:
+          dst = r(in.a).max(r(in.b));
+          break;
+        case Op::kCeil:
+          dst = r(in.a).ceil();
+          break;
+        case Op::kFloor:
+          dst = r(in.a).floor();
+          break;
+        case Op::kEq:
+          dst = (r(in.a) == r(in.b)).cast<double>();
+          break;
+        case Op::kNeq:
+          dst = (r(in.a) != r(in.b)).cast<double>();
+          break;
+        case Op::kLt:
+          dst = (r(in.a) < r(in.b)).cast<double>();
+          break;
+        case Op::kLeq:
+          dst = (r(in.a) <= r(in.b)).cast<double>();
+          break;
+        case Op::kAnd:
+          dst = (r(in.a) != 0.0 && r(in.b) != 0.0).cast<double>();
+          break;
+        case Op::kOr:
+          dst = (r(in.a) != 0.0 || r(in.b) != 0.0).cast<double>();
+          break;
+        case Op::kNot:
+          dst = (r(in.a) == 0.0).cast<double>();
+          break;
+        case Op::kSelect:
+          dst = (r(in.a) != 0.0).select(r(in.b), r(in.c));
+          break;
+      }
+    }
+    for (int i = 0; i < num_expressions(); ++i) {
+      y->row(i).segment(start, n) = r(outputs_[i]).matrix();
+    }
+  }
+}
+
+}  // namespace symbolic
+}  // namespace drake
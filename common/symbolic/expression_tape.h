@@ -0,0 +1,172 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "drake/common/autodiff.h"
+#include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
+#include "drake/common/symbolic/expression.h"
+
+namespace drake {
+namespace symbolic {
+
+/// Flattens a vector of symbolic expressions into a linear sequence of
+/// instructions (a "tape") over a fixed ordering of variables, so that the
+/// expressions can be evaluated many times, for different values of the
+/// variables, much faster than with Expression::Evaluate().
+///
+/// The expressions are compiled once, on construction. Structurally equal
+/// subexpressions (including subexpressions shared among the expressions) are
+/// computed only once, and the intermediate values are kept in a small set of
+/// registers that are reused once a value is no longer needed. Evaluating the
+/// tape then requires neither an Environment nor any traversal of the
+/// expression trees.
+///
+/// The tape can be evaluated with `double` or AutoDiffXd values, or with a
+/// whole batch of `double` values at once, in which case each instruction is
+/// applied to many points in a vectorized loop.
+///
+/// Unlike Expression::Evaluate(), the tape follows IEEE floating-point
+/// semantics: a division by zero or the logarithm of a negative number
+/// produces an infinity or a NaN instead of throwing.
+///
+/// The conditions of if-then-else expressions can be relational formulas
+/// (e.g., `x < y`) combined with conjunctions, disjunctions, and negations.
+/// Other formulas, uninterpreted functions, and NaN expressions are not
+/// supported. When evaluating with AutoDiffXd, the condition is evaluated on
+/// the values, and only the derivatives of the chosen branch are propagated.
+///
+/// For example:
+/// @code
+/// const Variable x("x"), y("y");
+/// const ExpressionTape tape(Vector2<Expression>(sin(x) * y, sin(x) + 1),
+///                           Vector2<Variable>(x, y));
+/// Eigen::VectorXd result(2);
+/// tape.Eval(Eigen::Vector2d(0.5, 2.0), &result);
+/// @endcode
+class ExpressionTape {
+ public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(ExpressionTape)
+
+  /// Constructs a tape with no variables and no expressions.
+  ExpressionTape();
+
+  /// Compiles `expressions` as functions of `variables`.
+  /// @throws std::exception if an expression contains a variable that is not
+  /// in `variables`, or an unsupported expression or formula.
+  /// @throws std::exception if `variables` contains duplicates.
+  ExpressionTape(const Eigen::Ref<const VectorX<Expression>>& expressions,
+                 const Eigen::Ref<const VectorX<Variable>>& variables);
+
+  ~ExpressionTape();
+
+  /// Returns the number of variables, i.e., the size of the input of Eval().
+  int num_variables() const { return num_variables_; }
+
+  /// Returns the number of expressions, i.e., the size of the output of
+  /// Eval().
+  int num_expressions() const { return static_cast<int>(outputs_.size()); }
+
+  /// Returns the number of instructions in the tape.
+  int num_instructions() const {
+    return static_cast<int>(instructions_.size());
+  }
+
+  /// Evaluates the expressions at the values `x` of the variables.
+  /// @param[in] x The values of the variables, of size num_variables().
+  /// @param[out] y The values of the expressions. It is resized to
+  ///   num_expressions() if needed.
+  /// @throws std::exception if x.size() != num_variables().
+  void Eval(const Eigen::Ref<const Eigen::VectorXd>& x,
+            Eigen::VectorXd* y) const;
+
+  /// Evaluates the expressions and their derivatives at the values `x` of the
+  /// variables. The derivatives of `y` are the derivatives of `x` propagated
+  /// through the expressions.
+  /// @pydrake_mkdoc_identifier{autodiff}
+  void Eval(const Eigen::Ref<const AutoDiffVecXd>& x, AutoDiffVecXd* y) const;
+
+  /// Evaluates the expressions at each column of `x`.
+  /// @param[in] x The values of the variables, with one column for each point,
+  ///   of size num_variables() x N.
+  /// @param[out] y The values of the expressions, where column j holds the
+  ///   values at x.col(j). It is resized to num_expressions() x N if needed.
+  /// @throws std::exception if x.rows() != num_variables().
+  void EvalBatch(const Eigen::Ref<const Eigen::MatrixXd>& x,
+                 Eigen::MatrixXd* y) const;
+
+ private:
+  // The operations of the instructions, which write register r[dst] given the
+  // operand registers r[a], r[b], r[c] and the constant k.
+  enum class Op : std::uint8_t {
+    // r[dst] = k.
+    kConstant,
+    // r[dst] = r[a] + r[b], r[a] + k * r[b], k * r[a], r[a] * r[b], and
+    // r[a] / r[b], respectively.
+    kAdd,
+    kAddScaled,
+    kScale,
+    kMul,
+    kDiv,
+    // r[dst] = pow(r[a], r[b]) and pow(r[a], k), respectively.
+    kPow,
+    kPowConstant,
+    // r[dst] = f(r[a]) or f(r[a], r[b]).
+    kLog,
+    kAbs,
+    kExp,
+    kSqrt,
+    kSin,
+    kCos,
+    kTan,
+    kAsin,
+    kAcos,
+    kAtan,
+    kAtan2,
+    kSinh,
+    kCosh,
+    kTanh,
+    kMin,
+    kMax,
+    kCeil,
+    kFloor,
+    // Relational and logical operations, which write 1 (true) or 0 (false).
+    kEq,
+    kNeq,
+    kLt,
+    kLeq,
+    kAnd,
+    kOr,
+    kNot,
+    // r[dst] = r[a] != 0 ? r[b] : r[c].
+    kSelect,
+  };
+
+  struct Instruction {
+    Op op{};
+    int dst{};
+    int a{-1};
+    int b{-1};
+    int c{-1};
+    double k{};
+  };
+
+  class Compiler;
+
+  template <typename T>
+  void DoEval(const Eigen::Ref<const VectorX<T>>& x, VectorX<T>* y) const;
+
+  int num_variables_{0};
+  // The total number of registers; the first num_variables_ registers hold the
+  // values of the variables.
+  int num_registers_{0};
+  std::vector<Instruction> instructions_;
+  // The register that holds the value of each expression.
+  std::vector<int> outputs_;
+};
+
+}  // namespace symbolic
+}  // namespace drake
@@ -0,0 +1,367 @@
+#include "drake/common/symbolic/numeric_polynomial.h"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <iterator>
+#include <numeric>
+#include <stdexcept>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include "drake/common/drake_assert.h"
+#include "drake/common/ssize.h"
+
+namespace drake {
+namespace symbolic {
+namespace {
+
+// Returns the union of two lists of variables that are sorted by id.
+std::vector<Variable> UnionOfVariables(const std::vector<Variable>& vars1,
+                                       const std::vector<Variable>& vars2) {
+  std::vector<Variable> result;
+  result.reserve(vars1.size() + vars2.size());
+  std::set_union(vars1.begin(), vars1.end(), vars2.begin(), vars2.end(),
+                 std::back_inserter(result), std::less<Variable>{});
+  return result;
+}
+
+bool EqualVariables(const std::vector<Variable>& vars1,
+                    const std::vector<Variable>& vars2) {
+  return vars1.size() == vars2.size() &&
+         std::equal(vars1.begin(), vars1.end(), vars2.begin(),
+                    [](const Variable& a, const Variable& b) {
+                      return a.equal_to(b);
+                    });
+}
+
+}  // namespace
+
+NumericPolynomial::NumericPolynomial(double c) {
+  if (c != 0) {
+    coefficients_.push_back(c);
+  }
+}
+
+NumericPolynomial::NumericPolynomial(const Monomial& m, double c) {
+  if (c != 0) {
+    for (const auto& [var, degree] : m.get_powers()) {
+      indeterminates_.push_back(var);
+      exponents_.push_back(degree);
+    }
+    coefficients_.push_back(c);
+  }
+}
+
+NumericPolynomial::NumericPolynomial(const Polynomial& p) {
+  std::vector<Variable> vars(p.indeterminates().begin(),
+                             p.indeterminates().end());
+  const int num_vars = ssize(vars);
+  std::vector<int> exponents;
+  std::vector<double> coefficients;
+  exponents.reserve(p.monomial_to_coefficient_map().size() * num_vars);
+  coefficients.reserve(p.monomial_to_coefficient_map().size());
+  for (const auto& [monomial, coefficient] : p.monomial_to_coefficient_map()) {
+    if (!is_constant(coefficient)) {
+      throw std::runtime_error(fmt::format(
+          "NumericPolynomial: the coefficient {} of the monomial {} is not a "
+          "constant.",
+          coefficient, monomial));
+    }
+    for (const Variable& var : vars) {
+      exponents.push_back(monomial.degree(var));
+    }
+    coefficients.push_back(get_constant_value(coefficient));
+  }
+  SetFromTerms(std::move(vars), exponents, coefficients);
+}
+
+Polynomial NumericPolynomial::ToPolynomial() const {
+  const Eigen::Map<const VectorX<Variable>> vars(indeterminates_.data(),
+                                                 ssize(indeterminates_));
+  Polynomial::MapType map;
+  for (int i = 0; i < num_terms(); ++i) {
+    map.emplace(Monomial(vars, exponent(i)), coefficients_[i]);
+  }
+  return Polynomial(std::move(map));
+}
+
+Eigen::Map<const Eigen::VectorXi> NumericPolynomial::exponent(int i) const {
+  DRAKE_ASSERT(0 <= i && i < num_terms());
+  const int num_vars = ssize(indeterminates_);
+  return Eigen::Map<const Eigen::VectorXi>(exponents_.data() + i * num_vars,
+                                           num_vars);
+}
+
+double NumericPolynomial::coefficient(int i) const {
+  DRAKE_ASSERT(0 <= i && i < num_terms());
+  return coefficients_[i];
+}
+
+int NumericPolynomial::TotalDegree() const {
+  int degree = 0;
+  for (int i = 0; i < num_terms(); ++i) {
+    degree = std::max(degree, exponent(i).sum());
+  }
+  return degree;
+}
+
+double NumericPolynomial::Evaluate(const Environment& env) const {
+  std::vector<double> values;
+  values.reserve(indeterminates_.size());
+  for (const Variable& var : indeterminates_) {
+    values.push_back(env[var]);
+  }
+  const int num_vars = ssize(indeterminates_);
+  double result = 0;
+  for (int i = 0; i < num_terms(); ++i) {
+    double term = coefficients_[i];
+    for (int j = 0; j < num_vars; ++j) {
+      const int degree = exponents_[i * num_vars + j];
+      if (degree > 0) {
+        term *= std::pow(values[j], degree);
+      }
+    }
+    result += term;
+  }
+  return result;
+}
+
+bool NumericPolynomial::EqualTo(const NumericPolynomial& p) const {
+  return EqualVariables(indeterminates_, p.indeterminates_) &&
+         exponents_ == p.exponents_ && coefficients_ == p.coefficients_;
+}
+
+NumericPolynomial& NumericPolynomial::operator+=(const NumericPolynomial& p) {
+  if (p.num_terms() == 0) {
+    return *this;
+  }
+  std::vector<Variable> vars =
+      UnionOfVariables(indeterminates_, p.indeterminates_);
+  const int num_vars = ssize(vars);
+  // Inserting columns of zeros keeps the rows sorted, so the sum is a merge of
+  // two sorted lists of terms.
+  const std::vector<int> exponents1 = ExpandExponents(vars);
+  const std::vector<int> exponents2 = p.ExpandExponents(vars);
+  const int n1 = num_terms();
+  const int n2 = p.num_terms();
+  std::vector<int> exponents;
+  std::vector<double> coefficients;
+  exponents.reserve(exponents1.size() + exponents2.size());
+  coefficients.reserve(n1 + n2);
+  auto append = [&](const int* row, double coefficient) {
+    if (coefficient != 0) {
+      exponents.insert(exponents.end(), row, row + num_vars);
+      coefficients.push_back(coefficient);
+    }
+  };
+  int i = 0;
+  int j = 0;
+  while (i < n1 || j < n2) {
+    const int* row1 = exponents1.data() + i * num_vars;
+    const int* row2 = exponents2.data() + j * num_vars;
+    if (j == n2 || (i < n1 && std::lexicographical_compare(
+                                  row1, row1 + num_vars, row2,
+                                  row2 + num_vars))) {
+      append(row1, coefficients_[i++]);
+    } else if (i == n1 || std::lexicographical_compare(row2, row2 + num_vars,
+                                                       row1,
+                                                       row1 + num_vars)) {
+      append(row2, p.coefficients_[j++]);
+    } else {
+      append(row1, coefficients_[i++] + p.coefficients_[j++]);
+    }
+  }
+  indeterminates_ = std::move(vars);
+  exponents_ = std::move(exponents);
+  coefficients_ = std::move(coefficients);
+  RemoveUnusedIndeterminates();
+  return *this;
+}
+
+NumericPolynomial& NumericPolynomial::operator-=(const NumericPolynomial& p) {
+  return *this += -p;
+}
+
+NumericPolynomial& NumericPolynomial::operator*=(const NumericPolynomial& p) {
+  std::vector<Variable> vars =
+      UnionOfVariables(indeterminates_, p.indeterminates_);
+  const int num_vars = ssize(vars);
+  const std::vector<int> exponents1 = ExpandExponents(vars);
+  const std::vector<int> exponents2 = p.ExpandExponents(vars);
+  const int n1 = num_terms();
+  const int n2 = p.num_terms();
+  std::vector<int> exponents(static_cast<size_t>(n1) * n2 * num_vars);
+  std::vector<double> coefficients(static_cast<size_t>(n1) * n2);
+  int* product = exponents.data();
+  for (int i = 0; i < n1; ++i) {
+    const int* row1 = exponents1.data() + i * num_vars;
+    for (int j = 0; j < n2; ++j) {
+      const int* row2 = exponents2.data() + j * num_vars;
+      for (int k = 0; k < num_vars; ++k) {
+        *(product++) = row1[k] + row2[k];
+      }
+      coefficients[i * n2 + j] = coefficients_[i] * p.coefficients_[j];
+    }
+  }
+  SetFromTerms(std::move(vars), exponents, coefficients);
+  return *this;
+}
+
+NumericPolynomial& NumericPolynomial::operator*=(double c) {
+  if (c == 0) {
+    *this = NumericPolynomial();
+  } else {
+    for (double& coefficient : coefficients_) {
+      coefficient *= c;
+    }
+  }
+  return *this;
+}
+
+std::vector<int> NumericPolynomial::ExpandExponents(
+    const std::vector<Variable>& vars) const {
+  if (EqualVariables(indeterminates_, vars)) {
+    return exponents_;
+  }
+  // The column of vars for each of this polynomial's indeterminates.
+  std::vector<int> columns;
+  columns.reserve(indeterminates_.size());
+  for (int j = 0, k = 0; j < ssize(indeterminates_); ++j) {
+    while (!vars[k].equal_to(indeterminates_[j])) {
+      ++k;
+    }
+    columns.push_back(k);
+  }
+  const int num_old_vars = ssize(indeterminates_);
+  const int num_new_vars = ssize(vars);
+  std::vector<int> result(static_cast<size_t>(num_terms()) * num_new_vars, 0);
+  for (int i = 0; i < num_terms(); ++i) {
+    for (int j = 0; j < num_old_vars; ++j) {
+      result[i * num_new_vars + columns[j]] = exponents_[i * num_old_vars + j];
+    }
+  }
+  return result;
+}
+
+void NumericPolynomial::SetFromTerms(std::vector<Variable> vars,
+                                     const std::vector<int>& exponents,
+                                     const std::vector<double>& coefficients) {
+  const int num_vars = ssize(vars);
+  const int num_input_terms = ssize(coefficients);
+  DRAKE_ASSERT(ssize(exponents) == num_input_terms * num_vars);
+  auto row = [&](int i) {
+    return exponents.data() + static_cast<size_t>(i) * num_vars;
+  };
+  std::vector<int> order(num_input_terms);
+  std::iota(order.begin(), order.end(), 0);
+  std::sort(order.begin(), order.end(), [&](int a, int b) {
+    return std::lexicographical_compare(row(a), row(a) + num_vars, row(b),
+                                        row(b) + num_vars);
+  });
+  indeterminates_ = std::move(vars);
+  exponents_.clear();
+  coefficients_.clear();
+  for (int k = 0; k < num_input_terms;) {
+    const int* first = row(order[k]);
+    double coefficient = 0;
+    for (; k < num_input_terms &&
+           std::equal(first, first + num_vars, row(order[k]));
+         ++k) {
+      coefficient += coefficients[order[k]];
+    }
+    if (coefficient != 0) {
+      exponents_.insert(exponents_.end(), first, first + num_vars);
+      coefficients_.push_back(coefficient);
+    }
+  }
+  RemoveUnusedIndeterminates();
+}
+
+void NumericPolynomial::RemoveUnusedIndeterminates() {
+  const int num_vars = ssize(indeterminates_);
+  std::vector<bool> is_used(num_vars, false);
+  for (int i = 0; i < num_terms(); ++i) {
+    for (int j = 0; j < num_vars; ++j) {
+      if (exponents_[i * num_vars + j] > 0) {
+        is_used[j] = true;
+      }
+    }
+  }
+  if (std::all_of(is_used.begin(), is_used.end(), [](bool used) {
+        return used;
+      })) {
+    return;
+  }
+  // Removing columns that are zero in every row keeps the rows sorted.
+  std::vector<Variable> vars;
+  for (int j = 0; j < num_vars; ++j) {
+    if (is_used[j]) {
+      vars.push_back(indeterminates_[j]);
+    }
+  }
+  int index = 0;
+  for (int i = 0; i < num_terms(); ++i) {
+    for (int j = 0; j < num_vars; ++j) {
+      if (is_used[j]) {
+        exponents_[index++] = exponents_[i * num_vars + j];
+      }
+    }
+  }
+  exponents_.resize(index);
+  indeterminates_ = std::move(vars);
+}
+
+NumericPolynomial operator-(const NumericPolynomial& p) {
+  return -1.0 * p;
+}
+
+NumericPolynomial operator+(NumericPolynomial p1,
+                            const NumericPolynomial& p2) {
+  return p1 += p2;
+}
+
+NumericPolynomial operator-(NumericPolynomial p1,
+                            const NumericPolynomial& p2) {
+  return p1 -= p2;
+}
+
+NumericPolynomial operator*(NumericPolynomial p1,
+                            const NumericPolynomial& p2) {
+  return p1 *= p2;
+}
+
+NumericPolynomial operator*(NumericPolynomial p, double c) {
+  return p *= c;
+}
+
+NumericPolynomial operator*(double c, NumericPolynomial p) {
+  return p *= c;
+}
+
+NumericPolynomial pow(const NumericPolynomial& p, int n) {
+  if (n < 0) {
+    throw std::runtime_error(fmt::format(
+        "pow(NumericPolynomial, {}): the exponent must be non-negative.", n));
+  }
+  NumericPolynomial result(1.0);
+  NumericPolynomial base = p;
+  while (n > 0) {
+    if (n % 2 == 1) {
+      result *= base;
+    }
+    n /= 2;
+    if (n > 0) {
+      base *= base;
+    }
+  }
+  return result;
+}
+
+std::ostream& operator<<(std::ostream& os, const NumericPolynomial& p) {
+  return os << p.ToPolynomial();
+}
+
+}  // namespace symbolic
+}  // namespace drake
@@ -0,0 +1,162 @@
+#pragma once
+
+#include <ostream>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/fmt_ostream.h"
+#include "drake/common/hash.h"
+#include "drake/common/symbolic/polynomial.h"
+
+namespace drake {
+namespace symbolic {
+/**
+ * Represents a multivariate polynomial with numeric (double) coefficients,
+ * stored as a sparse list of terms with packed exponent vectors.
+ *
+ * Unlike symbolic::Polynomial, whose coefficients are symbolic::Expression
+ * trees kept in a std::map, this class stores all of the exponents of a
+ * polynomial in a single contiguous integer array (one row per term, one
+ * column per indeterminate) alongside a contiguous array of coefficients. The
+ * terms are kept sorted lexicographically by exponent, with no zero
+ * coefficients, so that addition is a linear-time merge and multiplication
+ * forms all of the pairwise products and then sorts and merges them. This
+ * makes arithmetic on large polynomials with numeric coefficients much faster
+ * and far less allocation-heavy than the symbolic::Polynomial equivalent.
+ *
+ * The indeterminates of a %NumericPolynomial are exactly the variables that
+ * appear in it with a positive degree, ordered by their ids.
+ *
+ * Use the conversions to and from symbolic::Polynomial to interoperate with
+ * the rest of Drake's symbolic and optimization code.
+ */
+class NumericPolynomial {
+ public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(NumericPolynomial)
+
+  /** Constructs the zero polynomial. */
+  NumericPolynomial() = default;
+
+  /** Constructs the constant polynomial `c`. */
+  explicit NumericPolynomial(double c);
+
+  /** Constructs the polynomial `c * m`. */
+  NumericPolynomial(const Monomial& m, double c = 1.0);
+
+  /**
+   * Converts a symbolic::Polynomial.
+   * @throws std::exception if a coefficient of `p` is not a constant (e.g., if
+   * it contains decision variables).
+   */
+  explicit NumericPolynomial(const Polynomial& p);
+
+  /** Returns the equivalent symbolic::Polynomial. */
+  [[nodiscard]] Polynomial ToPolynomial() const;
+
+  /** Returns the indeterminates, sorted by their ids. */
+  [[nodiscard]] const std::vector<Variable>& indeterminates() const {
+    return indeterminates_;
+  }
+
+  /** Returns the number of terms with a non-zero coefficient. */
+  [[nodiscard]] int num_terms() const {
+    return static_cast<int>(coefficients_.size());
+  }
+
+  /** Returns the exponent vector of the i'th term; its j'th entry is the
+   * degree of indeterminates()[j].
+   * @pre 0 <= i < num_terms(). */
+  [[nodiscard]] Eigen::Map<const Eigen::VectorXi> exponent(int i) const;
+
+  /** Returns the coefficient of the i'th term.
+   * @pre 0 <= i < num_terms(). */
+  [[nodiscard]] double coefficient(int i) const;
+
+  /** Returns the highest total degree of the terms, or 0 for the zero
+   * polynomial. */
+  [[nodiscard]] int TotalDegree() const;
+
+  /**
+   * Evaluates this polynomial under the given environment.
+   * @throws std::exception if an indeterminate is not in `env`.
+   */
+  [[nodiscard]] double Evaluate(const Environment& env) const;
+
+  /** Returns true if this polynomial and `p` have the same terms. */
+  [[nodiscard]] bool EqualTo(const NumericPolynomial& p) const;
+
+  NumericPolynomial& operator+=(const NumericPolynomial& p);
+  NumericPolynomial& operator-=(const NumericPolynomial& p);
+  NumericPolynomial& operator*=(const NumericPolynomial& p);
+  NumericPolynomial& operator*=(double c);
+
+  /** Implements the @ref hash_append concept. */
+  template <class HashAlgorithm>
+  friend void hash_append(HashAlgorithm& hasher,
+                          const NumericPolynomial& item) noexcept {
+    using drake::hash_append_range;
+    hash_append_range(hasher, item.indeterminates_.begin(),
+                      item.indeterminates_.end());
+    hash_append_range(hasher, item.exponents_.begin(), item.exponents_.end());
+    hash_append_range(hasher, item.coefficients_.begin(),
+                      item.coefficients_.end());
+  }
+
+ private:
+  // Returns this polynomial's exponents, with the columns rearranged for the
+  // (sorted) superset `vars` of this polynomial's indeterminates.
+  std::vector<int> ExpandExponents(const std::vector<Variable>& vars) const;
+
+  // Sets this polynomial to the sum of the terms with the given (not
+  // necessarily sorted nor distinct) exponents and coefficients, in the given
+  // indeterminates.
+  void SetFromTerms(std::vector<Variable> vars,
+                    const std::vector<int>& exponents,
+                    const std::vector<double>& coefficients);
+
+  // Removes the indeterminates whose degree is zero in every term.
+  void RemoveUnusedIndeterminates();
+
+  std::vector<Variable> indeterminates_;
+  // The exponents of the terms, in row-major order (num_terms() rows of
+  // indeterminates_.size() entries each), sorted lexicographically.
+  std::vector<int> exponents_;
+  std::vector<double> coefficients_;
+};
+
+NumericPolynomial operator-(const NumericPolynomial& p);
+NumericPolynomial operator+(NumericPolynomial p1, const NumericPolynomial& p2);
+NumericPolynomial operator-(NumericPolynomial p1, const NumericPolynomial& p2);
+NumericPolynomial operator*(NumericPolynomial p1, const NumericPolynomial& p2);
+NumericPolynomial operator*(NumericPolynomial p, double c);
+NumericPolynomial operator*(double c, NumericPolynomial p);
+
+/** Returns `p` raised to the power `n`.
+ * @throws std::exception if n is negative. */
+[[nodiscard]] NumericPolynomial pow(const NumericPolynomial& p, int n);
+
+std::ostream& operator<<(std::ostream& os, const NumericPolynomial& p);
+
+}  // namespace symbolic
+}  // namespace drake
+
+namespace std {
+/* Provides std::hash<drake::symbolic::NumericPolynomial>. */
+template <>
+struct hash<drake::symbolic::NumericPolynomial> : public drake::DefaultHash {};
+#if defined(__GLIBCXX__)
+/* Informs GCC that this hash function is not so fast (i.e. for-loop inside).
+This will enforce caching of hash results. */
+template <>
+struct __is_fast_hash<hash<drake::symbolic::NumericPolynomial>>
+    : std::false_type {};
+#endif
+}  // namespace std
+
+namespace fmt {
+template <>
+struct formatter<drake::symbolic::NumericPolynomial>
+    : drake::ostream_formatter {};
+}  // namespace fmt
@@ -0,0 +1,129 @@
+#include "drake/common/symbolic/expression_tape.h"
+
+#include <cmath>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
+
+namespace drake {
+namespace symbolic {
+namespace {
+
+using Eigen::MatrixXd;
+using Eigen::Vector3d;
+using Eigen::VectorXd;
+
+class ExpressionTapeTest : public ::testing::Test {
+ protected:
+  // Returns the values of `expressions` at `values` of {x, y, z}, computed
+  // with Expression::Evaluate().
+  VectorXd EvaluateDirectly(const VectorX<Expression>& expressions,
+                            const Vector3d& values) const {
+    const Environment env{{x_, values[0]}, {y_, values[1]}, {z_, values[2]}};
+    VectorXd result(expressions.size());
+    for (int i = 0; i < expressions.size(); ++i) {
+      result[i] = expressions[i].Evaluate(env);
+    }
+    return result;
+  }
+
+  const Variable x_{"x"};
+  const Variable y_{"y"};
+  const Variable z_{"z"};
+  const Vector3<Variable> vars_{x_, y_, z_};
+};
+
+TEST_F(ExpressionTapeTest, MatchesEvaluate) {
+  VectorX<Expression> e(14);
+  e << 3.0, x_, 2 + 3 * x_ - y_ * z_, pow(x_, 2) * pow(y_, 3) / z_,
+      pow(z_, y_) + sqrt(z_) + abs(y_ - x_), exp(-x_) * log(z_),
+      sin(x_) + cos(y_) * tan(z_), asin(0.5 * x_) + acos(0.5 * y_) + atan(z_),
+      atan2(y_, x_) + sinh(x_) * cosh(y_) - tanh(z_),
+      min(x_, y_) + max(y_, z_), ceil(z_) - floor(-z_),
+      if_then_else(x_ < y_ && !(z_ >= 2.0), x_ * y_, z_),
+      if_then_else(x_ == y_ || x_ != z_, 1.0, -1.0),
+      (x_ * y_ + sin(x_ * y_)) * (x_ * y_);
+  const ExpressionTape dut(e, vars_);
+  EXPECT_EQ(dut.num_variables(), 3);
+  EXPECT_EQ(dut.num_expressions(), e.size());
+
+  MatrixXd points(3, 600);
+  for (int j = 0; j < points.cols(); ++j) {
+    points.col(j) << 0.9 * std::sin(0.1 * j), 0.8 * std::cos(0.3 * j),
+        1.0 + 0.003 * j;
+  }
+  MatrixXd batch;
+  dut.EvalBatch(points, &batch);
+  ASSERT_EQ(batch.rows(), e.size());
+  ASSERT_EQ(batch.cols(), points.cols());
+  VectorXd result;
+  for (int j = 0; j < points.cols(); ++j) {
+    const VectorXd expected = EvaluateDirectly(e, points.col(j));
+    dut.Eval(points.col(j), &result);
+    EXPECT_TRUE(CompareMatrices(result, expected, 1e-14));
+    EXPECT_TRUE(CompareMatrices(batch.col(j), expected, 1e-14));
+  }
+}
+
+TEST_F(ExpressionTapeTest, CommonSubexpressions) {
+  // sin(x * y) is computed once, even though it appears in both expressions.
+  const Expression shared = sin(x_ * y_);
+  const ExpressionTape dut(Vector2<Expression>(shared + z_, shared * z_),
+                           vars_);
+  // x * y, sin(x * y), sin(x * y) + z, and sin(x * y) * z.
+  EXPECT_EQ(dut.num_instructions(), 4);
+}
+
+TEST_F(ExpressionTapeTest, AutoDiff) {
+  const Vector2<Expression> e(x_ * sin(y_) + pow(z_, 3),
+                              if_then_else(x_ > 0, exp(x_ * z_), y_));
+  const ExpressionTape dut(e, vars_);
+  const Vector3d values(0.5, -1.2, 2.0);
+  AutoDiffVecXd x(3);
+  for (int i = 0; i < 3; ++i) {
+    x[i] = AutoDiffXd(values[i], VectorXd::Unit(3, i));
+  }
+  AutoDiffVecXd y;
+  dut.Eval(x, &y);
+  ASSERT_EQ(y.size(), 2);
+  const Environment env{{x_, values[0]}, {y_, values[1]}, {z_, values[2]}};
+  for (int i = 0; i < 2; ++i) {
+    EXPECT_NEAR(y[i].value(), e[i].Evaluate(env), 1e-14);
+    VectorXd expected_gradient(3);
+    for (int j = 0; j < 3; ++j) {
+      expected_gradient[j] = e[i].Differentiate(vars_[j]).Evaluate(env);
+    }
+    EXPECT_TRUE(CompareMatrices(y[i].derivatives(), expected_gradient, 1e-14));
+  }
+}
+
+TEST_F(ExpressionTapeTest, Empty) {
+  const ExpressionTape dut;
+  EXPECT_EQ(dut.num_variables(), 0);
+  EXPECT_EQ(dut.num_expressions(), 0);
+  VectorXd y;
+  dut.Eval(VectorXd(0), &y);
+  EXPECT_EQ(y.size(), 0);
+}
+
+TEST_F(ExpressionTapeTest, Errors) {
+  const Variable w("w");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      ExpressionTape(Vector1<Expression>(x_ + w), vars_),
+      ".*variable w is not in the list.*");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      ExpressionTape(Vector1<Expression>(x_), Vector2<Variable>(x_, x_)),
+      ".*listed more than once.*");
+  const Expression f = uninterpreted_function("f", {x_});
+  DRAKE_EXPECT_THROWS_MESSAGE(ExpressionTape(Vector1<Expression>(f), vars_),
+                              ".*not supported.*");
+  const ExpressionTape dut(Vector1<Expression>(x_), vars_);
+  VectorXd y;
+  EXPECT_THROW(dut.Eval(VectorXd(2), &y), std::exception);
+}
+
+}  // namespace
+}  // namespace symbolic
+}  // namespace drake
@@ -0,0 +1,139 @@
+#include "drake/common/symbolic/numeric_polynomial.h"
+
+#include <algorithm>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/expect_throws_message.h"
+#include "drake/common/test_utilities/symbolic_test_util.h"
+#include "drake/common/unused.h"
+
+namespace drake {
+namespace symbolic {
+namespace {
+using test::PolyEqual;
+
+class NumericPolynomialTest : public ::testing::Test {
+ protected:
+  const Variable var_x_{"x"};
+  const Variable var_y_{"y"};
+  const Variable var_z_{"z"};
+  const Variable var_a_{"a"};
+
+  const Polynomial p1_{2 * var_x_ * var_x_ + var_y_ - 3};
+  const Polynomial p2_{var_x_ * var_z_ - 0.5 * var_y_ * var_y_ + 1};
+  const Polynomial p3_{var_z_ * var_z_ * var_z_ + 4 * var_x_ * var_y_};
+};
+
+TEST_F(NumericPolynomialTest, Constructors) {
+  const NumericPolynomial zero;
+  EXPECT_EQ(zero.num_terms(), 0);
+  EXPECT_TRUE(zero.indeterminates().empty());
+  EXPECT_EQ(zero.TotalDegree(), 0);
+  EXPECT_PRED2(PolyEqual, zero.ToPolynomial(), Polynomial());
+  EXPECT_TRUE(NumericPolynomial(0.0).EqualTo(zero));
+
+  const NumericPolynomial constant(2.5);
+  EXPECT_EQ(constant.num_terms(), 1);
+  EXPECT_EQ(constant.coefficient(0), 2.5);
+  EXPECT_PRED2(PolyEqual, constant.ToPolynomial(), Polynomial(2.5));
+
+  const Monomial m(var_x_ * var_x_ * var_y_);
+  const NumericPolynomial term(m, 3);
+  EXPECT_EQ(term.num_terms(), 1);
+  EXPECT_EQ(term.indeterminates().size(), 2);
+  EXPECT_EQ(term.TotalDegree(), 3);
+  EXPECT_PRED2(PolyEqual, term.ToPolynomial(), Polynomial(3 * m));
+  EXPECT_TRUE(NumericPolynomial(m, 0).EqualTo(zero));
+}
+
+TEST_F(NumericPolynomialTest, Conversion) {
+  for (const Polynomial& p : {p1_, p2_, p3_}) {
+    const NumericPolynomial q(p);
+    EXPECT_PRED2(PolyEqual, q.ToPolynomial(), p);
+  }
+  const NumericPolynomial q1(p1_);
+  EXPECT_EQ(q1.num_terms(), 3);
+  EXPECT_EQ(q1.TotalDegree(), 2);
+
+  // Indeterminates whose terms have zero coefficients are dropped.
+  const Polynomial p(var_x_ * var_y_, {var_x_, var_y_, var_z_});
+  EXPECT_EQ(NumericPolynomial(p).indeterminates().size(), 2);
+
+  // The coefficients must be constants.
+  const Polynomial p_with_a(var_a_ * var_x_, {var_x_});
+  DRAKE_EXPECT_THROWS_MESSAGE(NumericPolynomial{p_with_a},
+                              ".*coefficient a .* is not a constant.*");
+}
+
+TEST_F(NumericPolynomialTest, Arithmetic) {
+  const NumericPolynomial q1(p1_);
+  const NumericPolynomial q2(p2_);
+  const NumericPolynomial q3(p3_);
+  EXPECT_PRED2(PolyEqual, (q1 + q2).ToPolynomial(), p1_ + p2_);
+  EXPECT_PRED2(PolyEqual, (q1 - q3).ToPolynomial(), p1_ - p3_);
+  EXPECT_PRED2(PolyEqual, (-q2).ToPolynomial(), -p2_);
+  EXPECT_PRED2(PolyEqual, (q1 * q2).ToPolynomial(), p1_ * p2_);
+  EXPECT_PRED2(PolyEqual, (q2 * q3 * q1).ToPolynomial(), p2_ * p3_ * p1_);
+  EXPECT_PRED2(PolyEqual, (2 * q3).ToPolynomial(), 2 * p3_);
+  EXPECT_PRED2(PolyEqual, (q3 * 0.5).ToPolynomial(), p3_ * 0.5);
+  EXPECT_PRED2(PolyEqual, pow(q2, 3).ToPolynomial(), pow(p2_, 3));
+  EXPECT_PRED2(PolyEqual, pow(q2, 0).ToPolynomial(), Polynomial(1));
+  DRAKE_EXPECT_THROWS_MESSAGE(pow(q2, -1), ".*must be non-negative.*");
+
+  // Cancellation removes the terms and the indeterminates.
+  const NumericPolynomial difference = q1 - q1;
+  EXPECT_TRUE(difference.EqualTo(NumericPolynomial()));
+  const NumericPolynomial sum = (q1 + q3) - q3;
+  EXPECT_TRUE(sum.EqualTo(q1));
+  EXPECT_EQ(sum.indeterminates().size(), 2);
+  EXPECT_TRUE((q1 * 0.0).EqualTo(NumericPolynomial()));
+
+  // Aliasing.
+  NumericPolynomial q = q2;
+  q *= q;
+  EXPECT_PRED2(PolyEqual, q.ToPolynomial(), p2_ * p2_);
+  q += q;
+  EXPECT_PRED2(PolyEqual, q.ToPolynomial(), 2 * p2_ * p2_);
+}
+
+TEST_F(NumericPolynomialTest, Evaluate) {
+  const Environment env{{var_x_, 1.5}, {var_y_, -2}, {var_z_, 0.25}};
+  for (const Polynomial& p : {p1_, p2_, p3_, Polynomial(4)}) {
+    EXPECT_NEAR(NumericPolynomial(p).Evaluate(env), p.Evaluate(env), 1e-14);
+  }
+  const Environment env_missing_z{{var_x_, 1.5}, {var_y_, -2}};
+  EXPECT_THROW(unused(NumericPolynomial(p2_).Evaluate(env_missing_z)),
+               std::exception);
+}
+
+TEST_F(NumericPolynomialTest, TermAccess) {
+  const NumericPolynomial q(p1_);
+  // The terms are sorted lexicographically by exponent.
+  for (int i = 0; i + 1 < q.num_terms(); ++i) {
+    const Eigen::VectorXi e0 = q.exponent(i);
+    const Eigen::VectorXi e1 = q.exponent(i + 1);
+    EXPECT_TRUE(std::lexicographical_compare(e0.data(), e0.data() + e0.size(),
+                                             e1.data(), e1.data() + e1.size()));
+  }
+  Polynomial rebuilt;
+  for (int i = 0; i < q.num_terms(); ++i) {
+    const Eigen::Map<const VectorX<Variable>> vars(q.indeterminates().data(),
+                                                   q.indeterminates().size());
+    rebuilt.AddProduct(q.coefficient(i), Monomial(vars, q.exponent(i)));
+  }
+  EXPECT_PRED2(PolyEqual, rebuilt, p1_);
+}
+
+TEST_F(NumericPolynomialTest, HashAndPrint) {
+  const NumericPolynomial q1(p1_);
+  const NumericPolynomial q1_again(p1_ + p3_ - p3_);
+  const std::hash<NumericPolynomial> hasher;
+  EXPECT_EQ(hasher(q1), hasher(q1_again));
+  EXPECT_NE(hasher(q1), hasher(NumericPolynomial(p2_)));
+  EXPECT_EQ(fmt::to_string(q1), fmt::to_string(p1_));
+}
+
+}  // namespace
+}  // namespace symbolic
+}  // namespace drake
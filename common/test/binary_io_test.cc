@@ -0,0 +1,193 @@
+#include "drake/common/binary_io.h"
+
+#include <array>
+#include <map>
+#include <optional>
+#include <string>
+#include <variant>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/name_value.h"
+#include "drake/common/temp_directory.h"
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
+
+namespace drake {
+namespace {
+
+struct Inner {
+  template <typename Archive>
+  void Serialize(Archive* a) {
+    a->Visit(DRAKE_NVP(name));
+    a->Visit(DRAKE_NVP(weights));
+  }
+
+  std::string name;
+  std::vector<double> weights;
+};
+
+struct Outer {
+  template <typename Archive>
+  void Serialize(Archive* a) {
+    a->Visit(DRAKE_NVP(flag));
+    a->Visit(DRAKE_NVP(count));
+    a->Visit(DRAKE_NVP(ratio));
+    a->Visit(DRAKE_NVP(indices));
+    a->Visit(DRAKE_NVP(corners));
+    a->Visit(DRAKE_NVP(inners));
+    a->Visit(DRAKE_NVP(named));
+    a->Visit(DRAKE_NVP(maybe));
+    a->Visit(DRAKE_NVP(choice));
+    a->Visit(DRAKE_NVP(points));
+    a->Visit(DRAKE_NVP(pose));
+    a->Visit(DRAKE_NVP(row_major));
+  }
+
+  bool flag{};
+  int count{};
+  float ratio{};
+  std::vector<int64_t> indices;
+  std::array<double, 3> corners{};
+  std::vector<Inner> inners;
+  std::map<std::string, Inner> named;
+  std::optional<std::string> maybe;
+  std::variant<double, std::string, Inner> choice;
+  Eigen::MatrixXd points;
+  Eigen::Matrix3d pose;
+  Eigen::Matrix<double, 2, 3, Eigen::RowMajor> row_major;
+};
+
+// Like Inner, but with a field renamed.
+struct Renamed {
+  template <typename Archive>
+  void Serialize(Archive* a) {
+    a->Visit(DRAKE_NVP(title));
+    a->Visit(DRAKE_NVP(weights));
+  }
+
+  std::string title;
+  std::vector<double> weights;
+};
+
+struct DynamicVector {
+  template <typename Archive>
+  void Serialize(Archive* a) {
+    a->Visit(DRAKE_NVP(value));
+  }
+
+  Eigen::VectorXd value;
+};
+
+struct FixedVector {
+  template <typename Archive>
+  void Serialize(Archive* a) {
+    a->Visit(DRAKE_NVP(value));
+  }
+
+  Eigen::Vector3d value;
+};
+
+Outer MakeOuter() {
+  Outer result;
+  result.flag = true;
+  result.count = -7;
+  result.ratio = 0.25f;
+  result.indices = {1, 22, 333};
+  result.corners = {1.5, 2.5, 3.5};
+  result.inners = {Inner{"a", {1.0}}, Inner{"b", {}}};
+  result.named["x"] = Inner{"c", {2.0, 3.0}};
+  result.maybe = "here";
+  result.choice = Inner{"d", {4.0}};
+  result.points = Eigen::MatrixXd::Random(3, 100);
+  result.pose = Eigen::Matrix3d::Random();
+  result.row_major << 1, 2, 3, 4, 5, 6;
+  return result;
+}
+
+void ExpectSame(const Inner& actual, const Inner& expected) {
+  EXPECT_EQ(actual.name, expected.name);
+  EXPECT_EQ(actual.weights, expected.weights);
+}
+
+void ExpectSame(const Outer& actual, const Outer& expected) {
+  EXPECT_EQ(actual.flag, expected.flag);
+  EXPECT_EQ(actual.count, expected.count);
+  EXPECT_EQ(actual.ratio, expected.ratio);
+  EXPECT_EQ(actual.indices, expected.indices);
+  EXPECT_EQ(actual.corners, expected.corners);
+  ASSERT_EQ(actual.inners.size(), expected.inners.size());
+  for (size_t i = 0; i < actual.inners.size(); ++i) {
+    ExpectSame(actual.inners[i], expected.inners[i]);
+  }
+  ASSERT_EQ(actual.named.size(), expected.named.size());
+  for (const auto& [key, value] : expected.named) {
+    ASSERT_TRUE(actual.named.contains(key));
+    ExpectSame(actual.named.at(key), value);
+  }
+  EXPECT_EQ(actual.maybe, expected.maybe);
+  ASSERT_EQ(actual.choice.index(), expected.choice.index());
+  if (std::holds_alternative<Inner>(expected.choice)) {
+    ExpectSame(std::get<Inner>(actual.choice),
+               std::get<Inner>(expected.choice));
+  } else {
+    EXPECT_EQ(std::get<0>(actual.choice), std::get<0>(expected.choice));
+  }
+  EXPECT_TRUE(CompareMatrices(actual.points, expected.points));
+  EXPECT_TRUE(CompareMatrices(actual.pose, expected.pose));
+  EXPECT_TRUE(CompareMatrices(actual.row_major, expected.row_major));
+}
+
+GTEST_TEST(BinaryIoTest, RoundTripString) {
+  const Outer data = MakeOuter();
+  const std::string binary = SaveBinaryString(data);
+  ExpectSame(LoadBinaryString<Outer>(binary), data);
+
+  // Empty values round-trip too.
+  const Outer empty;
+  ExpectSame(LoadBinaryString<Outer>(SaveBinaryString(empty)), empty);
+}
+
+GTEST_TEST(BinaryIoTest, RoundTripFile) {
+  const std::string filename = temp_directory() + "/data.bin";
+  const Outer data = MakeOuter();
+  SaveBinaryFile(filename, data);
+  ExpectSame(LoadBinaryFile<Outer>(filename), data);
+
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      LoadBinaryFile<Outer>(temp_directory() + "/no_such_file.bin"),
+      ".*Could not open.*no_such_file.*");
+}
+
+GTEST_TEST(BinaryIoTest, BulkArrays) {
+  // Arithmetic arrays are stored without any per-element overhead.
+  Inner data{"", std::vector<double>(1000, 1.0)};
+  EXPECT_LT(SaveBinaryString(data).size(), 1000 * sizeof(double) + 64);
+}
+
+GTEST_TEST(BinaryIoTest, Errors) {
+  const std::string binary = SaveBinaryString(MakeOuter());
+
+  DRAKE_EXPECT_THROWS_MESSAGE(LoadBinaryString<Outer>("not binary data"),
+                              ".*does not have a Drake binary header.*");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      LoadBinaryString<Outer>(binary.substr(0, binary.size() / 2)),
+      ".*'points' is truncated.*");
+  DRAKE_EXPECT_THROWS_MESSAGE(LoadBinaryString<Outer>(binary + "x"),
+                              ".*1 unread byte.*");
+
+  // Reading with a different Serialize() than the writer's is detected.
+  const std::string inner_binary = SaveBinaryString(Inner{"abc", {1.0}});
+  DRAKE_EXPECT_THROWS_MESSAGE(LoadBinaryString<Renamed>(inner_binary),
+                              ".*written with different fields.*");
+
+  // Mismatched matrix sizes are detected.
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      LoadBinaryString<FixedVector>(
+          SaveBinaryString(DynamicVector{Eigen::VectorXd::Zero(2)})),
+      ".*'value' has dimension 2x1 \\(wanted 3x1\\).*");
+}
+
+}  // namespace
+}  // namespace drake
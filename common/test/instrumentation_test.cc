@@ -0,0 +1,134 @@
+#include "drake/common/instrumentation.h"
+
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "drake/common/temp_directory.h"
+
+namespace drake {
+namespace instrumentation {
+namespace {
+
+using testing::HasSubstr;
+using testing::Not;
+
+class InstrumentationTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    Reset();
+    SetEnabled(true);
+  }
+
+  void TearDown() override {
+    SetEnabled(false);
+    Reset();
+  }
+};
+
+TEST_F(InstrumentationTest, Disabled) {
+  SetEnabled(false);
+  EXPECT_FALSE(IsEnabled());
+  {
+    ScopedZone zone("disabled_zone");
+    IncrementCounter("disabled_counter");
+    RecordSample("disabled_histogram", 1.0);
+  }
+  const std::string summary = FormatSummary();
+  EXPECT_THAT(summary, Not(HasSubstr("disabled_zone")));
+  EXPECT_THAT(summary, Not(HasSubstr("disabled_counter")));
+  EXPECT_THAT(summary, Not(HasSubstr("disabled_histogram")));
+  EXPECT_THAT(FormatChromeTrace(), Not(HasSubstr("disabled")));
+}
+
+TEST_F(InstrumentationTest, NestedZones) {
+  EXPECT_TRUE(IsEnabled());
+  for (int i = 0; i < 3; ++i) {
+    ScopedZone outer("outer");
+    ScopedZone inner("inner");
+  }
+  {
+    ScopedZone inner("inner");
+  }
+  // The inner zone is reported twice: nested in the outer zone (three calls),
+  // and at the top level (one call).
+  const std::string summary = FormatSummary();
+  EXPECT_THAT(summary, HasSubstr("\n  outer: 3, "));
+  EXPECT_THAT(summary, HasSubstr("\n    inner: 3, "));
+  EXPECT_THAT(summary, HasSubstr("\n  inner: 1, "));
+
+  const std::string trace = FormatChromeTrace();
+  EXPECT_THAT(trace, HasSubstr("{\"traceEvents\":["));
+  EXPECT_THAT(trace, HasSubstr("{\"name\":\"outer\",\"ph\":\"X\","));
+  EXPECT_THAT(trace, HasSubstr("{\"name\":\"inner\",\"ph\":\"X\","));
+}
+
+TEST_F(InstrumentationTest, CountersAndHistograms) {
+  IncrementCounter("counter");
+  IncrementCounter("counter", 4);
+  for (const double value : {0.0, 1.5, 3.0, 3.5}) {
+    RecordSample("histogram", value);
+  }
+  const std::string summary = FormatSummary();
+  EXPECT_THAT(summary, HasSubstr("\n  counter: 5\n"));
+  EXPECT_THAT(summary, HasSubstr("\n  histogram: 4, 2, 0, 3.5\n"));
+  EXPECT_THAT(summary, HasSubstr("\n    (-inf, 0]: 1\n"));
+  EXPECT_THAT(summary, HasSubstr("\n    [1, 2): 1\n"));
+  EXPECT_THAT(summary, HasSubstr("\n    [2, 4): 2\n"));
+  EXPECT_THAT(FormatChromeTrace(),
+              HasSubstr("{\"name\":\"counter\",\"ph\":\"C\","));
+}
+
+// Each thread records into its own storage; the exports merge them.
+TEST_F(InstrumentationTest, Threads) {
+  const int kNumThreads = 4;
+  std::vector<std::thread> threads;
+  for (int i = 0; i < kNumThreads; ++i) {
+    threads.emplace_back([]() {
+      ScopedZone zone("thread_zone");
+      IncrementCounter("thread_counter", 10);
+    });
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+  const std::string summary = FormatSummary();
+  EXPECT_THAT(summary, HasSubstr("\n  thread_zone: 4, "));
+  EXPECT_THAT(summary, HasSubstr("\n  thread_counter: 40\n"));
+}
+
+TEST_F(InstrumentationTest, Reset) {
+  {
+    ScopedZone zone("zone");
+    IncrementCounter("counter");
+  }
+  Reset();
+  const std::string summary = FormatSummary();
+  EXPECT_THAT(summary, Not(HasSubstr("zone:")));
+  EXPECT_THAT(summary, Not(HasSubstr("counter")));
+}
+
+TEST_F(InstrumentationTest, WriteChromeTrace) {
+  {
+    ScopedZone zone("zone");
+  }
+  const std::filesystem::path filename =
+      std::filesystem::path(temp_directory()) / "trace.json";
+  WriteChromeTrace(filename.string());
+  std::ifstream input(filename);
+  std::stringstream contents;
+  contents << input.rdbuf();
+  EXPECT_EQ(contents.str(), FormatChromeTrace());
+
+  EXPECT_THROW(WriteChromeTrace("/no/such/directory/trace.json"),
+               std::exception);
+}
+
+}  // namespace
+}  // namespace instrumentation
+}  // namespace drake
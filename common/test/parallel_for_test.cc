@@ -0,0 +1,117 @@
+#include "drake/common/parallel_for.h"
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/expect_throws_message.h"
+
+namespace drake {
+namespace internal {
+namespace {
+
+// The test rule asks for 4 threads, but there may be fewer cores.
+int GetMaxThreads() {
+  return Parallelism::Max().num_threads();
+}
+
+// Returns the ids of the threads that called func, while checking that every
+// index in [0, count) was called exactly once.
+std::set<std::thread::id> RunLoop(Parallelism parallelism, int count) {
+  std::vector<std::atomic<int>> num_calls(count);
+  std::mutex mutex;
+  std::set<std::thread::id> thread_ids;
+  ParallelFor(parallelism, count, [&](int i) {
+    ++num_calls[i];
+    // Give the other threads time to pick up some of the indices.
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    std::lock_guard<std::mutex> lock(mutex);
+    thread_ids.insert(std::this_thread::get_id());
+  });
+  for (int i = 0; i < count; ++i) {
+    EXPECT_EQ(num_calls[i], 1) << i;
+  }
+  return thread_ids;
+}
+
+GTEST_TEST(ParallelForTest, Serial) {
+  std::vector<int> order;
+  ParallelFor(false, 5, [&order](int i) {
+    order.push_back(i);
+  });
+  EXPECT_EQ(order, std::vector<int>({0, 1, 2, 3, 4}));
+
+  EXPECT_EQ(RunLoop(Parallelism(1), 10),
+            std::set<std::thread::id>({std::this_thread::get_id()}));
+  EXPECT_TRUE(RunLoop(Parallelism(3), 0).empty());
+}
+
+GTEST_TEST(ParallelForTest, Parallel) {
+  const std::set<std::thread::id> thread_ids = RunLoop(Parallelism(3), 40);
+  EXPECT_EQ(thread_ids.size() > 1, GetMaxThreads() > 1);
+  EXPECT_LE(thread_ids.size(), 3);
+
+  // Asking for more threads than the maximum uses at most the maximum.
+  EXPECT_LE(RunLoop(Parallelism(100), 40).size(), GetMaxThreads());
+}
+
+// Concurrent loops share the pool, so together they never use more than the
+// maximum number of threads.
+GTEST_TEST(ParallelForTest, Concurrent) {
+  std::set<std::thread::id> ids_a, ids_b;
+  std::thread other([&ids_b]() {
+    ids_b = RunLoop(Parallelism::Max(), 20);
+  });
+  ids_a = RunLoop(Parallelism::Max(), 20);
+  other.join();
+  ids_a.insert(ids_b.begin(), ids_b.end());
+  // The workers plus the two calling threads.
+  EXPECT_LE(ids_a.size(), GetMaxThreads() + 1);
+}
+
+// A loop inside a loop runs serially on the thread that calls it.
+GTEST_TEST(ParallelForTest, Nested) {
+  std::atomic<int> num_calls{0};
+  std::atomic<bool> all_on_caller{true};
+  ParallelFor(Parallelism::Max(), 8, [&](int) {
+    const std::thread::id caller = std::this_thread::get_id();
+    ParallelFor(Parallelism::Max(), 8, [&](int) {
+      ++num_calls;
+      if (std::this_thread::get_id() != caller) {
+        all_on_caller = false;
+      }
+    });
+  });
+  EXPECT_EQ(num_calls, 64);
+  EXPECT_TRUE(all_on_caller);
+}
+
+// The exception of the lowest index is the one that is rethrown. In parallel,
+// every index is still called.
+GTEST_TEST(ParallelForTest, Exceptions) {
+  for (const int num_threads : {1, 4}) {
+    std::atomic<int> num_calls{0};
+    DRAKE_EXPECT_THROWS_MESSAGE(
+        ParallelFor(Parallelism(num_threads), 20,
+                    [&num_calls](int i) {
+                      ++num_calls;
+                      if (i % 7 == 3) {
+                        throw std::runtime_error("index " + std::to_string(i));
+                      }
+                    }),
+        "index 3");
+    const bool is_parallel = num_threads > 1 && GetMaxThreads() > 1;
+    EXPECT_EQ(num_calls, is_parallel ? 20 : 4);
+  }
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace drake
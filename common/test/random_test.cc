@@ -1,7 +1,10 @@
 #include "drake/common/random.h"
 
+#include <array>
+#include <cmath>
 #include <limits>
 #include <type_traits>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -240,5 +243,140 @@ GTEST_TEST(RandomTest, CalcProbabilityDensityExponential) {
   CheckCalcProbabilityDensityExponential<AutoDiffXd>();
 }
 
+// The known-answer tests of Philox4x32-10 from the Random123 library.
+GTEST_TEST(PhiloxRandomGeneratorTest, KnownAnswers) {
+  using Block = std::array<uint32_t, 4>;
+  EXPECT_EQ(PhiloxRandomGenerator::Philox({0, 0, 0, 0}, {0, 0}),
+            Block({0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8}));
+  EXPECT_EQ(PhiloxRandomGenerator::Philox(
+                {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+                {0xffffffff, 0xffffffff}),
+            Block({0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd}));
+  EXPECT_EQ(PhiloxRandomGenerator::Philox(
+                {0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344},
+                {0xa4093822, 0x299f31d0}),
+            Block({0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1}));
+
+  // The generator's first block is the counter {0, stream}.
+  PhiloxRandomGenerator dut(0, 0);
+  EXPECT_EQ(dut(), 0x6627e8d5);
+  EXPECT_EQ(dut(), 0xe169c58d);
+}
+
+GTEST_TEST(PhiloxRandomGeneratorTest, Streams) {
+  EXPECT_LE(sizeof(PhiloxRandomGenerator), 64);
+  PhiloxRandomGenerator a(42, 0);
+  PhiloxRandomGenerator b(42, 0);
+  PhiloxRandomGenerator c(42, 1);
+  PhiloxRandomGenerator d(43, 0);
+  std::vector<uint32_t> values_a, values_b, values_c, values_d;
+  for (int i = 0; i < 10; ++i) {
+    values_a.push_back(a());
+    values_b.push_back(b());
+    values_c.push_back(c());
+    values_d.push_back(d());
+  }
+  EXPECT_EQ(values_a, values_b);
+  EXPECT_NE(values_a, values_c);
+  EXPECT_NE(values_a, values_d);
+  EXPECT_EQ(c.seed(), 42);
+  EXPECT_EQ(c.stream(), 1);
+
+  // Discarding skips ahead, across block boundaries.
+  PhiloxRandomGenerator e(42, 0);
+  e.discard(3);
+  EXPECT_EQ(e(), values_a[3]);
+  e.discard(5);
+  EXPECT_EQ(e(), values_a[9]);
+
+  // Copies continue the same sequence.
+  PhiloxRandomGenerator f(7, 3);
+  f.discard(2);
+  PhiloxRandomGenerator g = f;
+  EXPECT_EQ(f(), g());
+  EXPECT_EQ(f(), g());
+
+  // Bulk generation matches one value at a time, from any position.
+  for (const int offset : {0, 1, 3}) {
+    PhiloxRandomGenerator bulk(42, 0);
+    bulk.discard(offset);
+    std::vector<uint32_t> values(9 - offset);
+    bulk.generate(values.data(), values.data() + values.size());
+    EXPECT_EQ(values, std::vector<uint32_t>(values_a.begin() + offset,
+                                            values_a.begin() + 9));
+    EXPECT_EQ(bulk(), values_a[9]);
+  }
+
+  // It works with the std:: distributions.
+  std::uniform_real_distribution<double> uniform;
+  const double x = uniform(a);
+  EXPECT_GE(x, 0.0);
+  EXPECT_LT(x, 1.0);
+}
+
+// Checks the mean and variance of many samples.
+template <typename Generator>
+void CheckFillRandomSamples(Generator* generator) {
+  const int kNumSamples = 100000;
+  struct Moments {
+    RandomDistribution distribution;
+    double mean;
+    double variance;
+  };
+  for (const Moments& moments :
+       {Moments{RandomDistribution::kUniform, 0.5, 1.0 / 12},
+        Moments{RandomDistribution::kGaussian, 0.0, 1.0},
+        Moments{RandomDistribution::kExponential, 1.0, 1.0}}) {
+    Eigen::MatrixXd samples(kNumSamples / 4, 4);
+    FillRandomSamples(moments.distribution, generator, &samples);
+    const double mean = samples.mean();
+    const double variance = (samples.array() - mean).square().mean();
+    // Within about 5 standard errors.
+    EXPECT_NEAR(mean, moments.mean,
+                5 * std::sqrt(moments.variance / kNumSamples));
+    EXPECT_NEAR(variance, moments.variance, 0.05 * moments.variance);
+    if (moments.distribution == RandomDistribution::kUniform) {
+      EXPECT_GE(samples.minCoeff(), 0.0);
+      EXPECT_LT(samples.maxCoeff(), 1.0);
+    }
+    if (moments.distribution == RandomDistribution::kExponential) {
+      EXPECT_GE(samples.minCoeff(), 0.0);
+    }
+  }
+}
+
+GTEST_TEST(RandomTest, FillRandomSamples) {
+  RandomGenerator generator;
+  CheckFillRandomSamples(&generator);
+  PhiloxRandomGenerator philox(1234, 5);
+  CheckFillRandomSamples(&philox);
+
+  // The samples are reproducible, and an odd number of Gaussian samples and a
+  // block of a larger matrix work.
+  Eigen::MatrixXd samples1 = Eigen::MatrixXd::Zero(5, 5);
+  Eigen::MatrixXd samples2 = Eigen::MatrixXd::Zero(5, 5);
+  PhiloxRandomGenerator philox1(1, 1);
+  PhiloxRandomGenerator philox2(1, 1);
+  auto block1 = samples1.block(1, 1, 3, 3);
+  auto block2 = samples2.block(1, 1, 3, 3);
+  FillRandomSamples(RandomDistribution::kGaussian, &philox1, &block1);
+  FillRandomSamples(RandomDistribution::kGaussian, &philox2, &block2);
+  EXPECT_EQ(samples1, samples2);
+  EXPECT_EQ(samples1.row(0).norm(), 0.0);
+  EXPECT_EQ(samples1.col(4).norm(), 0.0);
+  EXPECT_GT(samples1.block(1, 1, 3, 3).cwiseAbs().minCoeff(), 0.0);
+
+  // Vectors work too.
+  Eigen::VectorXd vector(3);
+  FillRandomSamples(RandomDistribution::kUniform, &generator, &vector);
+  EXPECT_THROW(
+      FillRandomSamples(RandomDistribution::kUniform, &generator, nullptr),
+      std::exception);
+  EXPECT_THROW(FillRandomSamples(RandomDistribution::kUniform,
+                                 static_cast<RandomGenerator*>(nullptr),
+                                 &vector),
+               std::exception);
+}
+
 }  // namespace
 }  // namespace drake
@@ -1,11 +1,19 @@
 #include "drake/common/text_logging.h"
 
+#include <memory>
+#include <sstream>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#if TEXT_LOGGING_TEST_SPDLOG
+#include <spdlog/sinks/dist_sink.h>
+#include <spdlog/sinks/ostream_sink.h>
+#endif
+
 // The BUILD.bazel rules must supply this flag.  This test code is compiled and
 // run twice -- once with spdlog, and once without.
 #ifndef TEXT_LOGGING_TEST_SPDLOG
@@ -172,6 +180,93 @@ GTEST_TEST(TextLoggingTest, SetLogPattern) {
   #endif
 }
 
+// Check the asynchronous logging, by adding a sink that records the messages
+// that reach it.
+GTEST_TEST(TextLoggingTest, AsyncLogging) {
+  using drake::logging::AsyncLoggingOptions;
+  using drake::logging::disable_async_logging;
+  using drake::logging::enable_async_logging;
+
+  #if TEXT_LOGGING_TEST_SPDLOG
+    EXPECT_THROW(enable_async_logging({.queue_size = 0}), std::exception);
+    EXPECT_THROW(enable_async_logging({.max_messages_per_second = -1}),
+                 std::exception);
+
+    auto* dist_sink = dynamic_cast<spdlog::sinks::dist_sink_mt*>(
+        drake::logging::get_dist_sink());
+    ASSERT_NE(dist_sink, nullptr);
+    std::ostringstream stream;
+    auto recorder = std::make_shared<spdlog::sinks::ostream_sink_mt>(stream);
+    recorder->set_pattern("%v");
+    const std::vector<std::shared_ptr<drake::logging::sink>> original_sinks =
+        dist_sink->sinks();
+    dist_sink->set_sinks({recorder});
+    const std::string first_level = drake::logging::set_log_level("info");
+
+    // The messages from many threads all arrive, once flushed. Repeats are
+    // collapsed.
+    enable_async_logging();
+    EXPECT_EQ(drake::logging::get_dist_sink(), dist_sink);
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; ++i) {
+      threads.emplace_back([i]() {
+        for (int j = 0; j < 100; ++j) {
+          drake::log()->info("thread {} message {}", i, j);
+        }
+      });
+    }
+    for (std::thread& thread : threads) {
+      thread.join();
+    }
+    for (int j = 0; j < 5; ++j) {
+      drake::log()->info("repeated");
+    }
+    drake::log()->info("last");
+    drake::log()->flush();
+    std::string output = stream.str();
+    for (int i = 0; i < 4; ++i) {
+      for (int j = 0; j < 100; ++j) {
+        EXPECT_NE(output.find(fmt::format("thread {} message {}\n", i, j)),
+                  std::string::npos);
+      }
+    }
+    EXPECT_THAT(output, testing::EndsWith(
+        "repeated\n(the previous message was repeated 4 more times)\n"
+        "last\n"));
+
+    // The rate limit drops messages, and reports the number of them.
+    stream.str("");
+    enable_async_logging(
+        {.max_messages_per_second = 2, .deduplicate = false});
+    for (int j = 0; j < 10; ++j) {
+      drake::log()->info("limited {}", j);
+    }
+    drake::log()->flush();
+    output = stream.str();
+    EXPECT_EQ(output,
+              "limited 0\nlimited 1\n"
+              "Dropped 8 log messages (queue full: 0, rate limit: 8)\n");
+
+    // Disabling writes the pending messages and goes back to writing them
+    // right away.
+    enable_async_logging();
+    stream.str("");
+    drake::log()->info("pending");
+    disable_async_logging();
+    EXPECT_EQ(stream.str(), "pending\n");
+    drake::log()->info("immediate");
+    EXPECT_EQ(stream.str(), "pending\nimmediate\n");
+    disable_async_logging();
+
+    drake::logging::set_log_level(first_level);
+    dist_sink->set_sinks(original_sinks);
+  #else
+    enable_async_logging(AsyncLoggingOptions{});
+    drake::log()->info("nothing");
+    disable_async_logging();
+  #endif
+}
+
 }  // namespace
 
 // To enable compiling without depending on @spdlog, we need to provide our own
@@ -1,10 +1,22 @@
 #include "drake/common/text_logging.h"
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdlib>
 #include <memory>
 #include <mutex>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
 #include <utility>
+#include <vector>
 
 #ifdef HAVE_SPDLOG
+#include <spdlog/details/log_msg_buffer.h>
 #include <spdlog/sinks/dist_sink.h>
 #include <spdlog/sinks/stdout_sinks.h>
 #endif
@@ -35,6 +47,324 @@ std::shared_ptr<logging::logger> onetime_create_log() {
   }
   return result;
 }
+
+// A bounded lock-free queue of log messages. This is Dmitry Vyukov's bounded
+// multi-producer multi-consumer queue: the sequence number of each slot says
+// whether the slot is ready to be written (sequence == position) or read
+// (sequence == position + 1) at a given position of the queue.
+class MessageQueue {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(MessageQueue)
+
+  // Creates a queue with room for at least `capacity` messages.
+  explicit MessageQueue(int capacity) {
+    size_t size = 1;
+    while (size < static_cast<size_t>(capacity)) {
+      size *= 2;
+    }
+    slots_ = std::make_unique<Slot[]>(size);
+    for (size_t i = 0; i < size; ++i) {
+      slots_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+    mask_ = size - 1;
+  }
+
+  // Copies `message` into the queue, or returns false if the queue is full.
+  bool TryPush(const spdlog::details::log_msg& message) {
+    size_t position = push_position_.load(std::memory_order_relaxed);
+    Slot* slot{};
+    while (true) {
+      slot = &slots_[position & mask_];
+      const size_t sequence = slot->sequence.load(std::memory_order_acquire);
+      const intptr_t difference =
+          static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+      if (difference == 0) {
+        if (push_position_.compare_exchange_weak(position, position + 1,
+                                                 std::memory_order_relaxed)) {
+          break;
+        }
+      } else if (difference < 0) {
+        return false;
+      } else {
+        position = push_position_.load(std::memory_order_relaxed);
+      }
+    }
+    slot->message = spdlog::details::log_msg_buffer(message);
+    slot->sequence.store(position + 1, std::memory_order_release);
+    return true;
+  }
+
+  // Moves the oldest message of the queue into `message`, or returns false if
+  // there is none (ready).
+  bool TryPop(spdlog::details::log_msg_buffer* message) {
+    size_t position = pop_position_.load(std::memory_order_relaxed);
+    Slot* slot{};
+    while (true) {
+      slot = &slots_[position & mask_];
+      const size_t sequence = slot->sequence.load(std::memory_order_acquire);
+      const intptr_t difference = static_cast<intptr_t>(sequence) -
+                                  static_cast<intptr_t>(position + 1);
+      if (difference == 0) {
+        if (pop_position_.compare_exchange_weak(position, position + 1,
+                                                std::memory_order_relaxed)) {
+          break;
+        }
+      } else if (difference < 0) {
+        return false;
+      } else {
+        position = pop_position_.load(std::memory_order_relaxed);
+      }
+    }
+    *message = std::move(slot->message);
+    slot->sequence.store(position + mask_ + 1, std::memory_order_release);
+    return true;
+  }
+
+ private:
+  struct Slot {
+    std::atomic<size_t> sequence;
+    spdlog::details::log_msg_buffer message;
+  };
+
+  std::unique_ptr<Slot[]> slots_;
+  size_t mask_{};
+  // The producers and the consumer use separate cache lines.
+  alignas(64) std::atomic<size_t> push_position_{0};
+  alignas(64) std::atomic<size_t> pop_position_{0};
+};
+
+// A sink that passes the messages on to a `target` sink from a background
+// thread, as documented by logging::enable_async_logging().
+class AsyncSink final : public spdlog::sinks::sink {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(AsyncSink)
+
+  AsyncSink(std::shared_ptr<spdlog::sinks::sink> target,
+            const logging::AsyncLoggingOptions& options,
+            std::string logger_name)
+      : target_(std::move(target)),
+        options_(options),
+        logger_name_(std::move(logger_name)),
+        queue_(options.queue_size),
+        last_report_(Clock::now()),
+        tokens_(std::max(1.0, options.max_messages_per_second)) {
+    thread_ = std::thread([this]() {
+      Run();
+    });
+  }
+
+  ~AsyncSink() final {
+    {
+      std::lock_guard<std::mutex> guard(mutex_);
+      stop_ = true;
+    }
+    wake_.notify_one();
+    thread_.join();
+  }
+
+  const std::shared_ptr<spdlog::sinks::sink>& target() const { return target_; }
+
+  void log(const spdlog::details::log_msg& message) final {
+    if (!queue_.TryPush(message)) {
+      num_dropped_full_.fetch_add(1, std::memory_order_relaxed);
+      return;
+    }
+    num_pushed_.fetch_add(1);
+    if (consumer_waiting_.load()) {
+      // The consumer is asleep (or about to be), so the mutex is uncontended.
+      std::lock_guard<std::mutex> guard(mutex_);
+      wake_.notify_one();
+    }
+  }
+
+  void flush() final {
+    const uint64_t target = num_pushed_.load();
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (num_flushed_ < target) {
+      flush_requested_ = true;
+      wake_.notify_one();
+      flushed_.wait(lock);
+    }
+  }
+
+  void set_pattern(const std::string& pattern) final {
+    target_->set_pattern(pattern);
+  }
+
+  void set_formatter(std::unique_ptr<spdlog::formatter> formatter) final {
+    target_->set_formatter(std::move(formatter));
+  }
+
+ private:
+  using Clock = std::chrono::steady_clock;
+
+  // The pending repeats and drops are reported at least this often.
+  static constexpr std::chrono::seconds kReportPeriod{1};
+
+  // The body of the background thread.
+  void Run() {
+    spdlog::details::log_msg_buffer message;
+    while (true) {
+      if (queue_.TryPop(&message)) {
+        ++num_popped_;
+        Write(message);
+        Report(false);
+        continue;
+      }
+      if (num_pushed_.load() != num_popped_) {
+        // A message is ready, but behind a push that is still in progress.
+        std::this_thread::yield();
+        continue;
+      }
+      std::unique_lock<std::mutex> lock(mutex_);
+      if (flush_requested_ || stop_) {
+        const bool stop = stop_;
+        lock.unlock();
+        Report(true);
+        target_->flush();
+        lock.lock();
+        num_flushed_ = num_popped_;
+        flush_requested_ = false;
+        flushed_.notify_all();
+        if (stop) {
+          return;
+        }
+        continue;
+      }
+      consumer_waiting_.store(true);
+      wake_.wait_for(lock, kReportPeriod, [this]() {
+        return stop_ || flush_requested_ || num_pushed_.load() != num_popped_;
+      });
+      consumer_waiting_.store(false);
+      lock.unlock();
+      Report(false);
+    }
+  }
+
+  // Writes the given message to the target, subject to the deduplication and
+  // the rate limit.
+  void Write(const spdlog::details::log_msg& message) {
+    if (options_.deduplicate && num_written_ > 0 && IsRepeat(message)) {
+      if (num_repeats_ == 0) {
+        first_repeat_time_ = Clock::now();
+      }
+      ++num_repeats_;
+      return;
+    }
+    ReportRepeats();
+    if (!TakeToken(message.time)) {
+      ++num_dropped_rate_;
+      return;
+    }
+    target_->log(message);
+    ++num_written_;
+    if (options_.deduplicate) {
+      previous_ = spdlog::details::log_msg_buffer(message);
+    }
+  }
+
+  // Returns true iff `message` is the same as the last one written.
+  bool IsRepeat(const spdlog::details::log_msg& message) const {
+    const auto view = [](spdlog::string_view_t text) {
+      return std::string_view(text.data(), text.size());
+    };
+    return message.level == previous_.level &&
+           view(message.payload) == view(previous_.payload) &&
+           view(message.logger_name) == view(previous_.logger_name);
+  }
+
+  // Returns true iff the rate limit allows one more message, at the given
+  // time.
+  bool TakeToken(spdlog::log_clock::time_point time) {
+    const double rate = options_.max_messages_per_second;
+    if (rate == 0) {
+      return true;
+    }
+    if (num_tokens_taken_ > 0) {
+      const double elapsed =
+          std::chrono::duration<double>(time - last_token_time_).count();
+      tokens_ = std::min(std::max(1.0, rate),
+                         tokens_ + std::max(0.0, elapsed) * rate);
+    }
+    last_token_time_ = time;
+    ++num_tokens_taken_;
+    if (tokens_ < 1) {
+      return false;
+    }
+    tokens_ -= 1;
+    return true;
+  }
+
+  // Writes the count of the suppressed repeats, if any.
+  void ReportRepeats() {
+    if (num_repeats_ > 0) {
+      WriteNote(previous_.level,
+                fmt::format("(the previous message was repeated {} more "
+                            "time{})",
+                            num_repeats_, num_repeats_ == 1 ? "" : "s"));
+      num_repeats_ = 0;
+    }
+  }
+
+  // Writes the pending counts of repeats and drops when they are due, or
+  // unconditionally when `force` is true.
+  void Report(bool force) {
+    const Clock::time_point now = Clock::now();
+    if (num_repeats_ > 0 &&
+        (force || now - first_repeat_time_ >= kReportPeriod)) {
+      ReportRepeats();
+    }
+    if (!force && now - last_report_ < kReportPeriod) {
+      return;
+    }
+    const uint64_t num_dropped_full =
+        num_dropped_full_.exchange(0, std::memory_order_relaxed);
+    if (num_dropped_full + num_dropped_rate_ > 0) {
+      WriteNote(spdlog::level::warn,
+                fmt::format("Dropped {} log messages (queue full: {}, rate "
+                            "limit: {})",
+                            num_dropped_full + num_dropped_rate_,
+                            num_dropped_full, num_dropped_rate_));
+      num_dropped_rate_ = 0;
+    }
+    last_report_ = now;
+  }
+
+  void WriteNote(spdlog::level::level_enum level, const std::string& text) {
+    target_->log(spdlog::details::log_msg(logger_name_, level, text));
+  }
+
+  const std::shared_ptr<spdlog::sinks::sink> target_;
+  const logging::AsyncLoggingOptions options_;
+  const std::string logger_name_;
+  MessageQueue queue_;
+  std::thread thread_;
+
+  // These are shared by the producers and the consumer.
+  std::atomic<uint64_t> num_pushed_{0};
+  std::atomic<uint64_t> num_dropped_full_{0};
+  std::atomic<bool> consumer_waiting_{false};
+
+  // These are guarded by `mutex_`.
+  std::mutex mutex_;
+  std::condition_variable wake_;
+  std::condition_variable flushed_;
+  bool flush_requested_{false};
+  bool stop_{false};
+  uint64_t num_flushed_{0};
+
+  // These belong to the consumer.
+  uint64_t num_popped_{0};
+  uint64_t num_written_{0};
+  spdlog::details::log_msg_buffer previous_;
+  int num_repeats_{0};
+  Clock::time_point first_repeat_time_;
+  uint64_t num_dropped_rate_{0};
+  Clock::time_point last_report_;
+  double tokens_{};
+  spdlog::log_clock::time_point last_token_time_;
+  uint64_t num_tokens_taken_{0};
+};
 }  // namespace
 
 logging::logger* log() {
@@ -46,6 +376,9 @@ logging::logger* log() {
 logging::sink* logging::get_dist_sink() {
   // Extract the dist_sink_mt from Drake's logger instance.
   auto* sink = log()->sinks().empty() ? nullptr : log()->sinks().front().get();
+  if (auto* async = dynamic_cast<AsyncSink*>(sink)) {
+    sink = async->target().get();
+  }
   auto* result = dynamic_cast<spdlog::sinks::dist_sink_mt*>(sink);
   if (result == nullptr) {
     throw std::logic_error(
@@ -121,6 +454,41 @@ const char* const logging::kSetLogPatternHelpMessage =
     "sets the spdlog pattern for formatting; for more information, see "
     "https://github.com/gabime/spdlog/wiki/3.-Custom-formatting";
 
+void logging::enable_async_logging(const AsyncLoggingOptions& options) {
+  if (!(options.queue_size > 0)) {
+    throw std::logic_error(fmt::format(
+        "drake::logging::enable_async_logging(): the queue_size must be "
+        "positive, not {}",
+        options.queue_size));
+  }
+  if (!(options.max_messages_per_second >= 0)) {
+    throw std::logic_error(fmt::format(
+        "drake::logging::enable_async_logging(): the max_messages_per_second "
+        "must be non-negative, not {}",
+        options.max_messages_per_second));
+  }
+  disable_async_logging();
+  // Check that the sink configuration is as expected.
+  get_dist_sink();
+  std::shared_ptr<sink>& front = log()->sinks().front();
+  front = std::make_shared<AsyncSink>(front, options, log()->name());
+  // Write any pending messages at exit.
+  [[maybe_unused]] static const int registered =
+      std::atexit(&disable_async_logging);
+}
+
+void logging::disable_async_logging() {
+  std::vector<std::shared_ptr<sink>>& sinks = log()->sinks();
+  if (sinks.empty()) {
+    return;
+  }
+  if (auto* async = dynamic_cast<AsyncSink*>(sinks.front().get())) {
+    // Destroying the AsyncSink writes its pending messages.
+    std::shared_ptr<sink> target = async->target();
+    sinks.front() = std::move(target);
+  }
+}
+
 #else  // HAVE_SPDLOG
 
 logging::logger::logger() {}
@@ -151,6 +519,10 @@ void logging::set_log_pattern(const std::string&) {}
 const char* const logging::kSetLogPatternHelpMessage =
     "(Text logging is unavailable.)";
 
+void logging::enable_async_logging(const AsyncLoggingOptions&) {}
+
+void logging::disable_async_logging() {}
+
 #endif  // HAVE_SPDLOG
 
 const char* const logging::kSetLogLevelUnchanged = "unchanged";
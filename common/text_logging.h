@@ -230,5 +230,49 @@ void set_log_pattern(const std::string& pattern);
 /// set_log_pattern().
 extern const char* const kSetLogPatternHelpMessage;
 
+/// Options for enable_async_logging().
+struct AsyncLoggingOptions {
+  /// The maximum number of messages waiting to be written. When the queue is
+  /// full, further messages are dropped (and counted) instead of blocking the
+  /// thread that logs them. Must be positive.
+  int queue_size{8192};
+
+  /// The maximum sustained number of messages per second that are written,
+  /// with bursts of up to one second's worth. Further messages are dropped
+  /// (and counted). Zero means no limit.
+  double max_messages_per_second{0};
+
+  /// Whether a run of identical messages (same logger, level, and text) is
+  /// written only once, followed by a count of the repeats.
+  bool deduplicate{true};
+};
+
+/// (Advanced) Moves the writing of Drake's log messages to a background
+/// thread. Logging a message then only formats it and places it on a bounded
+/// lock-free queue, so that the calling thread never waits on I/O, even
+/// during a storm of messages.
+///
+/// The sinks of get_dist_sink() (e.g., stderr) are then called by the
+/// background thread only. Messages that are dropped (because the queue is
+/// full or due to the rate limit) are reported in a periodic warning.
+/// `drake::log()->flush()` waits until every message logged before it has
+/// been written. If asynchronous logging was already enabled, it is first
+/// disabled (see disable_async_logging()). Pending messages are written at
+/// exit.
+///
+/// This is meant to be called once, near the start of a program. It is not
+/// safe to call while other threads might be logging. When spdlog is
+/// disabled, this does nothing.
+///
+/// @throws std::exception if `options.queue_size` is not positive or
+/// `options.max_messages_per_second` is negative.
+void enable_async_logging(const AsyncLoggingOptions& options = {});
+
+/// (Advanced) Writes all pending messages and then returns to writing log
+/// messages on the thread that logs them. Does nothing if asynchronous
+/// logging is not enabled. Like enable_async_logging(), this is not safe to
+/// call while other threads might be logging.
+void disable_async_logging();
+
 }  // namespace logging
 }  // namespace drake
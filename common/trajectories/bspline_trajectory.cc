@@ -38,6 +38,53 @@ MatrixX<T> BsplineTrajectory<T>::value(const T& time) const {
                                clamp(time, start_time(), end_time()));
 }
 
+template <typename T>
+MatrixX<T> BsplineTrajectory<T>::DoVectorValues(
+    const Eigen::Ref<const VectorX<T>>& t) const {
+  if constexpr (!scalar_predicate<T>::is_bool) {
+    return Trajectory<T>::DoVectorValues(t);
+  } else {
+    using std::clamp;
+    const std::vector<T>& knots = basis_.knots();
+    const int k = basis_.order();
+    const Eigen::Index num_elements = rows() * cols();
+    MatrixX<T> values(num_elements, t.size());
+    // The intermediate de Boor points, one per column.
+    MatrixX<T> p(num_elements, k);
+    // The index of the greatest knot that is less than or equal to the time
+    // and strictly less than end_time(); see BsplineBasis::EvaluateCurve().
+    int ell = -1;
+    for (Eigen::Index n = 0; n < t.size(); ++n) {
+      const T t_bar = clamp(t[n], start_time(), end_time());
+      if (ell < 0 || !(t_bar < end_time()) || t_bar < knots[ell]) {
+        ell = basis_.FindContainingInterval(t_bar);
+      } else {
+        while (knots[ell + 1] <= t_bar) {
+          ++ell;
+        }
+      }
+      for (int r = 0; r < k; ++r) {
+        p.col(r) = Eigen::Map<const VectorX<T>>(
+            control_points_[ell - r].data(), num_elements);
+      }
+      for (int j = 1; j < k; ++j) {
+        for (int r = 0; r < k - j; ++r) {
+          const int i = ell - r;
+          const T alpha = (t_bar - knots[i]) / (knots[i + k - j] - knots[i]);
+          p.col(r) = (1.0 - alpha) * p.col(r + 1) + alpha * p.col(r);
+        }
+      }
+      values.col(n) = p.col(0);
+    }
+    // Each column holds one (column-major) value; for a row-valued trajectory,
+    // vector_values() wants each value as a row instead.
+    if (cols() == 1) {
+      return values;
+    }
+    return values.transpose();
+  }
+}
+
 template <typename T>
 bool BsplineTrajectory<T>::do_has_derivative() const {
   return true;
@@ -142,6 +142,13 @@ class BsplineTrajectory final : public trajectories::Trajectory<T> {
   std::unique_ptr<trajectories::Trajectory<T>> DoMakeDerivative(
       int derivative_order) const override;
 
+  // Runs the de Boor recursion of BsplineBasis::EvaluateCurve() on the columns
+  // of a single workspace matrix (rather than on a vector of matrices that is
+  // allocated for each time), and finds the knot interval of each time by
+  // advancing from the previous time's interval.
+  MatrixX<T> DoVectorValues(
+      const Eigen::Ref<const VectorX<T>>& t) const override;
+
   void CheckInvariants() const;
 
   math::BsplineBasis<T> basis_;
@@ -147,19 +147,23 @@ template <typename T>
 PiecewisePolynomial<T> PiecewisePolynomial<T>::derivative(
     int derivative_order) const {
   DRAKE_DEMAND(derivative_order >= 0);
-  PiecewisePolynomial ret = *this;
   if (derivative_order == 0) {
-    return ret;
+    return *this;
   }
-  for (auto it = ret.polynomials_.begin(); it != ret.polynomials_.end(); ++it) {
-    PolynomialMatrix& matrix = *it;
-    for (Eigen::Index row = 0; row < rows(); row++) {
-      for (Eigen::Index col = 0; col < cols(); col++) {
-        matrix(row, col) = matrix(row, col).Derivative(derivative_order);
+  // Build the derivatives directly (rather than copying this and then
+  // overwriting each copied polynomial), to allocate each polynomial once.
+  std::vector<PolynomialMatrix> derivatives;
+  derivatives.reserve(polynomials_.size());
+  for (const PolynomialMatrix& matrix : polynomials_) {
+    PolynomialMatrix& derivative =
+        derivatives.emplace_back(matrix.rows(), matrix.cols());
+    for (Eigen::Index row = 0; row < matrix.rows(); row++) {
+      for (Eigen::Index col = 0; col < matrix.cols(); col++) {
+        derivative(row, col) = matrix(row, col).Derivative(derivative_order);
       }
     }
   }
-  return ret;
+  return MakeFromValidParts(std::move(derivatives), this->breaks());
 }
 
 template <typename T>
@@ -173,25 +177,31 @@ PiecewisePolynomial<T> PiecewisePolynomial<T>::integral(
 template <typename T>
 PiecewisePolynomial<T> PiecewisePolynomial<T>::integral(
     const Eigen::Ref<MatrixX<T>>& value_at_start_time) const {
-  PiecewisePolynomial ret = *this;
+  // As in derivative(), build the integrals directly.
+  std::vector<PolynomialMatrix> integrals;
+  integrals.reserve(polynomials_.size());
   for (int segment_index = 0; segment_index < this->get_number_of_segments();
        segment_index++) {
-    PolynomialMatrix& matrix = ret.polynomials_[segment_index];
+    const PolynomialMatrix& matrix = polynomials_[segment_index];
+    PolynomialMatrix integral(rows(), cols());
     for (Eigen::Index row = 0; row < rows(); row++) {
       for (Eigen::Index col = 0; col < cols(); col++) {
         if (segment_index == 0) {
-          matrix(row, col) =
+          integral(row, col) =
               matrix(row, col).Integral(value_at_start_time(row, col));
         } else {
-          matrix(row, col) =
-              matrix(row, col).Integral(ret.EvaluateSegmentAbsoluteTime(
-                  segment_index - 1, this->start_time(segment_index), row,
-                  col));
+          // Continue from the value of the previous integral at the end of its
+          // segment.
+          integral(row, col) = matrix(row, col).Integral(
+              integrals.back()(row, col).EvaluateUnivariate(
+                  this->start_time(segment_index) -
+                  this->start_time(segment_index - 1)));
         }
       }
     }
+    integrals.push_back(std::move(integral));
   }
-  return ret;
+  return MakeFromValidParts(std::move(integrals), this->breaks());
 }
 
 template <typename T>
@@ -218,6 +228,64 @@ MatrixX<T> PiecewisePolynomial<T>::DoEvalDerivative(
   return ret;
 }
 
+template <typename T>
+MatrixX<T> PiecewisePolynomial<T>::DoVectorValues(
+    const Eigen::Ref<const VectorX<T>>& t) const {
+  if constexpr (!scalar_predicate<T>::is_bool) {
+    return Trajectory<T>::DoVectorValues(t);
+  } else {
+    if (empty()) {
+      return Trajectory<T>::DoVectorValues(t);
+    }
+    const std::vector<T>& breaks = this->get_segment_times();
+    const int num_segments = this->get_number_of_segments();
+    const Eigen::Index num_elements = rows() * cols();
+    MatrixX<T> values(num_elements, t.size());
+    // The coefficients of the current segment, with one row per element and
+    // one column per power of the segment's local time.
+    MatrixX<T> coefficients;
+    int segment_index = -1;
+    for (Eigen::Index i = 0; i < t.size(); ++i) {
+      const T time = clamp(t[i], this->start_time(), this->end_time());
+      int new_segment_index = segment_index;
+      if (segment_index < 0 || time < breaks[segment_index]) {
+        new_segment_index = this->get_segment_index(time);
+      } else {
+        while (new_segment_index + 1 < num_segments &&
+               breaks[new_segment_index + 1] <= time) {
+          ++new_segment_index;
+        }
+      }
+      if (new_segment_index != segment_index) {
+        segment_index = new_segment_index;
+        const PolynomialMatrix& matrix = polynomials_[segment_index];
+        int degree = 0;
+        for (Eigen::Index k = 0; k < num_elements; ++k) {
+          degree = std::max(degree, matrix(k).GetDegree());
+        }
+        coefficients.setZero(num_elements, degree + 1);
+        for (Eigen::Index k = 0; k < num_elements; ++k) {
+          const VectorX<T> element_coefficients = matrix(k).GetCoefficients();
+          coefficients.row(k).head(element_coefficients.size()) =
+              element_coefficients.transpose();
+        }
+      }
+      const T local_time = time - breaks[segment_index];
+      auto value = values.col(i);
+      value = coefficients.col(coefficients.cols() - 1);
+      for (Eigen::Index power = coefficients.cols() - 2; power >= 0; --power) {
+        value = value * local_time + coefficients.col(power);
+      }
+    }
+    // Each column holds one (column-major) value; for a row-valued trajectory,
+    // vector_values() wants each value as a row instead.
+    if (cols() == 1) {
+      return values;
+    }
+    return values.transpose();
+  }
+}
+
 template <typename T>
 const typename PiecewisePolynomial<T>::PolynomialMatrix&
 PiecewisePolynomial<T>::getPolynomialMatrix(int segment_index) const {
@@ -554,7 +622,19 @@ PiecewisePolynomial<T> PiecewisePolynomial<T>::slice(int start_segment_index,
   auto polynomials_slice = vector<PolynomialMatrix>(
       polynomials_start_it, polynomials_start_it + num_segments);
 
-  return PiecewisePolynomial<T>(polynomials_slice, breaks_slice);
+  return MakeFromValidParts(std::move(polynomials_slice),
+                            std::move(breaks_slice));
+}
+
+template <typename T>
+PiecewisePolynomial<T> PiecewisePolynomial<T>::MakeFromValidParts(
+    std::vector<PolynomialMatrix> polynomials, std::vector<T> breaks) {
+  DRAKE_ASSERT(breaks.empty() ? polynomials.empty()
+                              : breaks.size() == polynomials.size() + 1);
+  PiecewisePolynomial<T> result;
+  result.get_mutable_breaks() = std::move(breaks);
+  result.polynomials_ = std::move(polynomials);
+  return result;
 }
 
 template <typename T>
@@ -604,7 +684,7 @@ PiecewisePolynomial<T> PiecewisePolynomial<T>::Transpose() const {
                  [](const PolynomialMatrix& matrix) {
                    return matrix.transpose();
                  });
-  return PiecewisePolynomial<T>(transposed, this->breaks());
+  return MakeFromValidParts(std::move(transposed), this->breaks());
 }
 
 template <typename T>
@@ -625,7 +705,7 @@ PiecewisePolynomial<T> PiecewisePolynomial<T>::Block(int start_row,
                    return matrix.block(start_row, start_col, block_rows,
                                        block_cols);
                  });
-  return PiecewisePolynomial<T>(block_polynomials, this->breaks());
+  return MakeFromValidParts(std::move(block_polynomials), this->breaks());
 }
 
 // Static generators for splines.
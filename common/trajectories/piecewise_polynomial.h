@@ -797,6 +797,18 @@ class PiecewisePolynomial final : public PiecewiseTrajectory<T> {
     return derivative(derivative_order).Clone();
   }
 
+  // Returns a PiecewisePolynomial that takes ownership of `polynomials` and
+  // `breaks`, which must already be consistent (as they are when derived from
+  // an existing PiecewisePolynomial), without copying or re-checking them.
+  static PiecewisePolynomial<T> MakeFromValidParts(
+      std::vector<PolynomialMatrix> polynomials, std::vector<T> breaks);
+
+  // Evaluates each segment's elements together, by Horner's rule on a matrix
+  // of their coefficients (one row per element), and finds the segment of
+  // each time by advancing from the previous time's segment.
+  MatrixX<T> DoVectorValues(
+      const Eigen::Ref<const VectorX<T>>& t) const override;
+
   bool do_has_derivative() const override { return true; }
 
   T EvaluateSegmentAbsoluteTime(int segment_index, const T& t, Eigen::Index row,
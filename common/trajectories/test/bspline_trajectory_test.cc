@@ -128,6 +128,31 @@ TYPED_TEST(BsplineTrajectoryTests, ValueTest) {
   }
 }
 
+// Verifies that vector_values() matches value(), for times that are unsorted,
+// out of range, or exactly on a knot.
+TYPED_TEST(BsplineTrajectoryTests, VectorValuesTest) {
+  using T = TypeParam;
+  BsplineTrajectory<T> trajectory = MakeCircleTrajectory<T>();
+  const std::vector<T> times = {-0.1, 0, 0.2, 0.125, 0.5, 0.3, 1.0, 0.99, 1.1};
+  std::vector<MatrixX<T>> row_control_points;
+  for (const MatrixX<T>& control_point : trajectory.control_points()) {
+    row_control_points.push_back(control_point.transpose());
+  }
+  const BsplineTrajectory<T> row_trajectory(trajectory.basis(),
+                                            row_control_points);
+  const MatrixX<T> col_values = trajectory.vector_values(times);
+  const MatrixX<T> row_values = row_trajectory.vector_values(times);
+  const int num_times = static_cast<int>(times.size());
+  ASSERT_EQ(col_values.cols(), num_times);
+  ASSERT_EQ(row_values.rows(), num_times);
+  for (int i = 0; i < num_times; ++i) {
+    EXPECT_TRUE(CompareMatrices(col_values.col(i), trajectory.value(times[i]),
+                                0));
+    EXPECT_TRUE(CompareMatrices(row_values.row(i),
+                                row_trajectory.value(times[i]), 0));
+  }
+}
+
 // Verifies that MakeDerivative() works as expected.
 TYPED_TEST(BsplineTrajectoryTests, MakeDerivativeTest) {
   using T = TypeParam;
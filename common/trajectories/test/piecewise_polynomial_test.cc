@@ -324,6 +324,33 @@ GTEST_TEST(testPiecewisePolynomial, VectorValueTest) {
       "This method only supports vector-valued trajectories.");
 }
 
+// Checks that vector_values() matches value(), for times that are unsorted,
+// out of range, or exactly on a break.
+GTEST_TEST(testPiecewisePolynomial, VectorValuesMatchesValueTest) {
+  const std::vector<double> breaks = {0, 0.5, 1.0, 2.0, 3.5};
+  std::vector<Eigen::MatrixXd> samples;
+  for (int i = 0; i < 5; ++i) {
+    samples.push_back(Eigen::Vector3d(i, i * i, std::sin(i)));
+  }
+  const std::vector<double> times = {-1,  0,   0.25, 0.5, 0.5, 2.0, 1.0,
+                                     0.1, 3.5, 4.0,  2.7, 1.999};
+  for (const PiecewisePolynomial<double>& pp :
+       {PiecewisePolynomial<double>::ZeroOrderHold(breaks, samples),
+        PiecewisePolynomial<double>::CubicShapePreserving(breaks, samples)}) {
+    const Eigen::MatrixXd col_values = pp.vector_values(times);
+    const Eigen::MatrixXd row_values = pp.Transpose().vector_values(times);
+    const int num_times = static_cast<int>(times.size());
+    ASSERT_EQ(col_values.cols(), num_times);
+    ASSERT_EQ(row_values.rows(), num_times);
+    for (int i = 0; i < num_times; ++i) {
+      EXPECT_TRUE(
+          CompareMatrices(col_values.col(i), pp.value(times[i]), 1e-14));
+      EXPECT_TRUE(CompareMatrices(row_values.row(i).transpose(),
+                                  pp.value(times[i]), 1e-14));
+    }
+  }
+}
+
 GTEST_TEST(testPiecewisePolynomial, RemoveFinalSegmentTest) {
   Eigen::VectorXd breaks(3);
   breaks << 0, .5, 1.;
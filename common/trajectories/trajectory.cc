@@ -17,6 +17,12 @@ MatrixX<T> Trajectory<T>::vector_values(
     throw std::runtime_error(
         "This method only supports vector-valued trajectories.");
   }
+  return DoVectorValues(t);
+}
+
+template <typename T>
+MatrixX<T> Trajectory<T>::DoVectorValues(
+    const Eigen::Ref<const VectorX<T>>& t) const {
   if (cols() == 1) {
     MatrixX<T> values(rows(), t.size());
     for (int i = 0; i < static_cast<int>(t.size()); ++i) {
@@ -98,6 +98,15 @@ class Trajectory {
   DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(Trajectory)
   Trajectory() = default;
 
+  /**
+   * Implements vector_values(), which has already checked that cols()==1 or
+   * rows()==1. The default implementation calls value() for each time;
+   * subclasses may override it to share work between the samples (e.g., the
+   * lookup of the segment that contains each time).
+   */
+  virtual MatrixX<T> DoVectorValues(
+      const Eigen::Ref<const VectorX<T>>& t) const;
+
   virtual bool do_has_derivative() const;
 
   virtual MatrixX<T> DoEvalDerivative(const T& t, int derivative_order) const;
@@ -1,5 +1,6 @@
 #include "drake/common/yaml/yaml_read_archive.h"
 
+#include <limits>
 #include <vector>
 
 #include <gmock/gmock.h>
@@ -201,6 +202,15 @@ TEST_P(YamlReadArchiveTest, StdVector) {
   };
 
   test("[1.0, 2.0, 3.0]", {1.0, 2.0, 3.0});
+
+  // Numbers in plain decimal notation take a faster path than other spellings;
+  // both must work.
+  const double kInf = std::numeric_limits<double>::infinity();
+  test("[1, -2.5e-3, .5, 7E2, +4.0, '6.0', .inf, -.Inf]",
+       {1.0, -2.5e-3, 0.5, 700.0, 4.0, 6.0, kInf, -kInf});
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      AcceptIntoDummy<VectorStruct>(LoadSingleValue("[1.0, 2.0.0]")),
+      ".*could not parse double value.*");
 }
 
 TEST_P(YamlReadArchiveTest, StdVectorMissing) {
@@ -609,6 +619,15 @@ doc:
   - [0.0, 1.0, 2.0, 3.0]
   - [4.0, 5.0, 6.0, 7.0]
   - [8.0, 9.0, 10.0, 11.0]
+)""",
+       (Matrix34d{} << 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11).finished());
+
+  test(R"""(
+doc:
+  value:
+  - [0, 1e0, +2.0, 3.]
+  - [4.0, '5.0', 6.0, 0.7e1]
+  - [8.0, 9.0, 10.0, 11.0]
 )""",
        (Matrix34d{} << 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11).finished());
 }
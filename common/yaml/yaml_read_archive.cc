@@ -1,10 +1,17 @@
 #include "drake/common/yaml/yaml_read_archive.h"
 
-#include <algorithm>
+#include <charconv>
 #include <cstring>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <utility>
+#include <vector>
 
 #include <fmt/format.h>
 #include <fmt/ostream.h>
+#include <yaml-cpp/anchor.h>
+#include <yaml-cpp/eventhandler.h>
 #include <yaml-cpp/yaml.h>
 
 #include "drake/common/nice_type_name.h"
@@ -14,25 +21,20 @@ namespace yaml {
 namespace internal {
 namespace {
 
-// The source and destination are both of type Map.  Copy the key-value pairs
-// from source into destination, but don't overwrite any existing keys.
-void CopyWithMergeKeySemantics(const YAML::Node& source,
-                               YAML::Node* destination) {
-  for (const auto& key_value : source) {
-    const YAML::Node& key = key_value.first;
-    const YAML::Node& value = key_value.second;
-    YAML::Node entry = (*destination)[key.Scalar()];
-    if (!entry) {
-      // N.B. This assignment indirectly mutates the `destination`!  With the
-      // yaml-cpp API, a YAML::Node returned from a mapping lookup (operator[])
-      // is a back-pointer into the mapping -- something akin to an iterator.
-      entry = value;
+// The source and destination are both of type Mapping.  Copy the key-value
+// pairs from source into destination, but don't overwrite any existing keys.
+void CopyWithMergeKeySemantics(const internal::Node& source,
+                               internal::Node* destination) {
+  for (const auto& [key, value] : source.GetMapping()) {
+    if (!destination->GetMapping().contains(key)) {
+      destination->Add(key, value);
     }
   }
 }
 
-// If the given `node` (of type Map) has a YAML merge key defined, then mutates
-// the `node` in place to replace the merge key entry with the merged values.
+// If the given `node` (of type Mapping) has a YAML merge key defined, then
+// mutates the `node` in place to replace the merge key entry with the merged
+// values.
 //
 // See https://yaml.org/type/merge.html for details on syntax and semantics.
 //
@@ -40,119 +42,226 @@ void CopyWithMergeKeySemantics(const YAML::Node& source,
 // exception.  In the future, it might be nice to use the ReportError helper
 // instead of throwing, but that is currently too awkward.
 //
-// The `parent` is only used to provide context during error reporting.
+// The `parent` is only used to provide context during error reporting; it is
+// nullptr for the root of the document.
 //
 // If yaml-cpp adds native support for merge keys during its own parsing, then
 // we should be able to remove this helper.
-void RewriteMergeKeys(const YAML::Node& parent, YAML::Node* node) {
+void RewriteMergeKeys(const internal::Node* parent, internal::Node* node) {
   DRAKE_DEMAND(node != nullptr);
-  DRAKE_DEMAND(node->Type() == YAML::NodeType::Map);
-  const YAML::Node& merge_key = (*node)["<<"];
-  if (!merge_key) {
+  DRAKE_DEMAND(node->IsMapping());
+  const auto iter = node->GetMapping().find("<<");
+  if (iter == node->GetMapping().end()) {
     return;
   }
-  (*node).remove("<<");
+  const internal::Node merge_key = std::move(node->At("<<"));
+  node->Remove("<<");
   const char* error_message = nullptr;
-  YAML::Node error_locus;
-  switch (merge_key.Type()) {
-    case YAML::NodeType::Map: {
-      // Merge `merge_key` Map into `node` Map.
-      CopyWithMergeKeySemantics(merge_key, node);
-      return;
-    }
-    case YAML::NodeType::Sequence: {
-      // Merge each Map in `merge_key` Sequence-of-Maps into the `node` Map.
-      for (const YAML::Node& merge_key_item : merge_key) {
-        if (merge_key_item.Type() != YAML::NodeType::Map) {
-          error_message =
-              "has invalid merge key type (Sequence-of-non-Mapping).";
-          error_locus = *node;
-          break;
-        }
-        CopyWithMergeKeySemantics(merge_key_item, node);
-      }
-      if (error_message != nullptr) {
+  const internal::Node* error_locus = nullptr;
+  if (merge_key.IsMapping()) {
+    // Merge `merge_key` Mapping into `node` Mapping.
+    CopyWithMergeKeySemantics(merge_key, node);
+    return;
+  } else if (merge_key.IsSequence()) {
+    // Merge each Mapping in `merge_key` Sequence-of-Mappings into the `node`
+    // Mapping.
+    for (const internal::Node& merge_key_item : merge_key.GetSequence()) {
+      if (!merge_key_item.IsMapping()) {
+        error_message = "has invalid merge key type (Sequence-of-non-Mapping).";
+        error_locus = node;
         break;
       }
-      return;
-    }
-    case YAML::NodeType::Scalar: {
-      error_message = "has invalid merge key type (Scalar).";
-      error_locus = parent;
-      break;
-    }
-    case YAML::NodeType::Null: {
-      error_message = "has invalid merge key type (Null).";
-      error_locus = parent;
-      break;
+      CopyWithMergeKeySemantics(merge_key_item, node);
     }
-    case YAML::NodeType::Undefined: {
-      // We should never reach here due to the "if (!merge_key)" guard above.
-      DRAKE_UNREACHABLE();
+    if (error_message == nullptr) {
+      return;
     }
+  } else if (merge_key.GetTag() == internal::Node::kTagNull) {
+    error_message = "has invalid merge key type (Null).";
+    error_locus = parent;
+  } else {
+    error_message = "has invalid merge key type (Scalar).";
+    error_locus = parent;
   }
   DRAKE_DEMAND(error_message != nullptr);
-  DRAKE_DEMAND(error_locus.IsDefined());
-  // Sort the keys so that our error message is deterministic.
-  std::vector<std::string> keys;
-  for (const auto& map_pair : error_locus) {
-    keys.push_back(map_pair.first.as<std::string>());
+  if (error_locus == nullptr || !error_locus->IsMapping()) {
+    // The root of the document, or an item of a Sequence, has no meaningful
+    // keys to report for its parent, so we report its own keys instead.
+    error_locus = node;
+  }
+  // The mapping is a std::map, so the ordering here is fully deterministic.
+  std::vector<std::string_view> keys;
+  for (const auto& [key, value] : error_locus->GetMapping()) {
+    unused(value);
+    keys.push_back(key);
   }
-  std::sort(keys.begin(), keys.end());
   throw std::runtime_error(
       fmt::format("YAML node of type Mapping (with size {} and keys {{{}}}) {}",
                   keys.size(), fmt::join(keys, ", "), error_message));
 }
 
-// Convert a jbeder/yaml-cpp YAML::Node `node` to a Drake yaml::internal::Node.
-// See https://github.com/jbeder/yaml-cpp/wiki/Tutorial for a jbeder reference.
-// The `parent` is only used to provide context during error reporting.
-internal::Node ConvertJbederYamlNodeToDrakeYamlNode(const YAML::Node& parent,
-                                                    const YAML::Node& node) {
-  std::optional<Node::Mark> mark;
-  if (node.Mark().line >= 0 && node.Mark().column >= 0) {
-    // The jbeder convention is 0-based numbering; we want 1-based.
-    mark = Node::Mark{.line = node.Mark().line + 1,
-                      .column = node.Mark().column + 1};
-  }
-  switch (node.Type()) {
-    case YAML::NodeType::Undefined: {
-      throw std::runtime_error("A yaml-cpp node was unexpectedly Undefined");
+// Applies RewriteMergeKeys() to the given `node` and all of its descendants,
+// from the top down (so that merged-in values are rewritten as well).
+void RewriteAllMergeKeys(const internal::Node* parent, internal::Node* node) {
+  if (node->IsMapping()) {
+    RewriteMergeKeys(parent, node);
+    std::vector<std::string> keys;
+    keys.reserve(node->GetMapping().size());
+    for (const auto& [key, value] : node->GetMapping()) {
+      unused(value);
+      keys.push_back(key);
     }
-    case YAML::NodeType::Null: {
-      return internal::Node::MakeNull();
+    for (const std::string& key : keys) {
+      RewriteAllMergeKeys(node, &node->At(key));
     }
-    case YAML::NodeType::Scalar: {
-      auto result = internal::Node::MakeScalar(node.Scalar());
-      result.SetTag(node.Tag());
-      result.SetMark(mark);
-      return result;
+  } else if (node->IsSequence()) {
+    // A Sequence offers no mutable access to its items, so we rebuild it.
+    internal::Node rebuilt = internal::Node::MakeSequence();
+    rebuilt.SetTag(std::string{node->GetTag()});
+    rebuilt.SetMark(node->GetMark());
+    for (const internal::Node& item : node->GetSequence()) {
+      internal::Node copy = item;
+      RewriteAllMergeKeys(node, &copy);
+      rebuilt.Add(std::move(copy));
     }
-    case YAML::NodeType::Sequence: {
-      auto result = internal::Node::MakeSequence();
-      result.SetTag(node.Tag());
-      result.SetMark(mark);
-      for (size_t i = 0; i < node.size(); ++i) {
-        result.Add(ConvertJbederYamlNodeToDrakeYamlNode(node, node[i]));
-      }
-      return result;
+    *node = std::move(rebuilt);
+  }
+}
+
+// Builds a Drake yaml::internal::Node directly from the events of a
+// jbeder/yaml-cpp YAML::Parser, without first loading the document into a
+// YAML::Node tree (which for large documents costs as much time and memory as
+// the Drake tree itself). See https://github.com/jbeder/yaml-cpp/wiki for a
+// jbeder reference. Merge keys are not rewritten here; see
+// RewriteAllMergeKeys().
+class NodeBuilder final : public YAML::EventHandler {
+ public:
+  NodeBuilder() = default;
+
+  // Returns the root of the document; a Null node when the document was empty.
+  internal::Node Release() {
+    DRAKE_DEMAND(stack_.empty());
+    return std::move(root_);
+  }
+
+  void OnDocumentStart(const YAML::Mark&) final {}
+  void OnDocumentEnd() final {}
+
+  void OnNull(const YAML::Mark&, YAML::anchor_t anchor) final {
+    Finish(internal::Node::MakeNull(), anchor);
+  }
+
+  void OnAlias(const YAML::Mark&, YAML::anchor_t anchor) final {
+    const auto iter = anchors_.find(anchor);
+    if (iter == anchors_.end()) {
+      throw std::runtime_error(
+          "A YAML alias refers to a node that encloses the alias itself");
     }
-    case YAML::NodeType::Map: {
-      YAML::Node merged_node(node);
-      RewriteMergeKeys(parent, &merged_node);
-      auto result = internal::Node::MakeMapping();
-      result.SetTag(merged_node.Tag());
-      result.SetMark(mark);
-      for (const auto& key_value : merged_node) {
-        const YAML::Node& key = key_value.first;
-        const YAML::Node& value = key_value.second;
-        result.Add(key.Scalar(),
-                   ConvertJbederYamlNodeToDrakeYamlNode(node, value));
-      }
-      return result;
+    Finish(internal::Node(iter->second), YAML::NullAnchor);
+  }
+
+  void OnScalar(const YAML::Mark& mark, const std::string& tag,
+                YAML::anchor_t anchor, const std::string& value) final {
+    internal::Node result = internal::Node::MakeScalar(value);
+    result.SetTag(tag);
+    result.SetMark(ConvertMark(mark));
+    Finish(std::move(result), anchor);
+  }
+
+  void OnSequenceStart(const YAML::Mark& mark, const std::string& tag,
+                       YAML::anchor_t anchor, YAML::EmitterStyle::value) final {
+    internal::Node result = internal::Node::MakeSequence();
+    result.SetTag(tag);
+    result.SetMark(ConvertMark(mark));
+    stack_.push_back({std::move(result), anchor, std::nullopt});
+  }
+
+  void OnSequenceEnd() final { FinishTop(); }
+
+  void OnMapStart(const YAML::Mark& mark, const std::string& tag,
+                  YAML::anchor_t anchor, YAML::EmitterStyle::value) final {
+    internal::Node result = internal::Node::MakeMapping();
+    result.SetTag(tag);
+    result.SetMark(ConvertMark(mark));
+    stack_.push_back({std::move(result), anchor, std::nullopt});
+  }
+
+  void OnMapEnd() final { FinishTop(); }
+
+ private:
+  // A Sequence or Mapping whose items are still being parsed.
+  struct Pending {
+    internal::Node node;
+    YAML::anchor_t anchor{};
+    // For a Mapping, the key whose value is being parsed (if any).
+    std::optional<std::string> key;
+  };
+
+  static std::optional<Node::Mark> ConvertMark(const YAML::Mark& mark) {
+    if (mark.line >= 0 && mark.column >= 0) {
+      // The jbeder convention is 0-based numbering; we want 1-based.
+      return Node::Mark{.line = mark.line + 1, .column = mark.column + 1};
+    }
+    return std::nullopt;
+  }
+
+  void FinishTop() {
+    DRAKE_DEMAND(!stack_.empty());
+    Pending top = std::move(stack_.back());
+    stack_.pop_back();
+    Finish(std::move(top.node), top.anchor);
+  }
+
+  // Adds the completed `node` to the item that encloses it.
+  void Finish(internal::Node node, YAML::anchor_t anchor) {
+    if (anchor != YAML::NullAnchor) {
+      anchors_.insert_or_assign(anchor, node);
+    }
+    if (stack_.empty()) {
+      root_ = std::move(node);
+      return;
+    }
+    Pending& parent = stack_.back();
+    if (parent.node.IsSequence()) {
+      parent.node.Add(std::move(node));
+    } else if (!parent.key.has_value()) {
+      // As with YAML::Node::Scalar(), keys that are not Scalars are empty.
+      const bool is_scalar_key =
+          node.IsScalar() && node.GetTag() != internal::Node::kTagNull;
+      parent.key = is_scalar_key ? node.GetScalar() : std::string{};
+    } else {
+      parent.node.Add(std::move(*parent.key), std::move(node));
+      parent.key.reset();
+    }
+  }
+
+  std::vector<Pending> stack_;
+  std::map<YAML::anchor_t, internal::Node> anchors_;
+  internal::Node root_ = internal::Node::MakeNull();
+};
+
+// Parses the first document in `input` into a Drake yaml::internal::Node,
+// returning either the whole document or (if given) its top-level child named
+// `child_name`. The `description` is only used for error reporting.
+internal::Node ParseDocument(std::istream* input,
+                             const std::optional<std::string>& child_name,
+                             std::string_view description) {
+  NodeBuilder builder;
+  YAML::Parser parser(*input);
+  parser.HandleNextDocument(builder);
+  internal::Node root = builder.Release();
+  if (child_name.has_value()) {
+    if (!root.IsMapping() || !root.GetMapping().contains(*child_name)) {
+      throw std::runtime_error(fmt::format(
+          "When loading {}, there was no such top-level map entry '{}'",
+          description, *child_name));
     }
+    internal::Node child = std::move(root.At(*child_name));
+    RewriteAllMergeKeys(nullptr, &child);
+    return child;
   }
-  DRAKE_UNREACHABLE();
+  RewriteAllMergeKeys(nullptr, &root);
+  return root;
 }
 
 }  // namespace
@@ -180,19 +289,12 @@ YamlReadArchive::YamlReadArchive(internal::Node root,
 // yaml-cpp in our public API makes that difficult.
 internal::Node YamlReadArchive::LoadFileAsNode(
     const std::string& filename, const std::optional<std::string>& child_name) {
-  internal::Node result = internal::Node::MakeNull();
-  YAML::Node root = YAML::LoadFile(filename);
-  if (child_name.has_value()) {
-    YAML::Node child_node = root[*child_name];
-    if (!child_node) {
-      throw std::runtime_error(fmt::format(
-          "When loading '{}', there was no such top-level map entry '{}'",
-          filename, *child_name));
-    }
-    result = ConvertJbederYamlNodeToDrakeYamlNode({}, child_node);
-  } else {
-    result = ConvertJbederYamlNodeToDrakeYamlNode({}, root);
+  std::ifstream input(filename);
+  if (!input) {
+    throw YAML::BadFile(filename);
   }
+  internal::Node result =
+      ParseDocument(&input, child_name, fmt::format("'{}'", filename));
   result.SetFilename(filename);
   return result;
 }
@@ -204,18 +306,8 @@ internal::Node YamlReadArchive::LoadFileAsNode(
 // yaml-cpp in our public API makes that difficult.
 internal::Node YamlReadArchive::LoadStringAsNode(
     const std::string& data, const std::optional<std::string>& child_name) {
-  YAML::Node root = YAML::Load(data);
-  if (child_name.has_value()) {
-    YAML::Node child_node = root[*child_name];
-    if (!child_node) {
-      throw std::runtime_error(fmt::format(
-          "When loading YAML, there was no such top-level map entry '{}'",
-          *child_name));
-    }
-    return ConvertJbederYamlNodeToDrakeYamlNode({}, child_node);
-  } else {
-    return ConvertJbederYamlNodeToDrakeYamlNode({}, root);
-  }
+  std::istringstream input(data);
+  return ParseDocument(&input, child_name, "YAML");
 }
 
 template <typename T>
@@ -239,7 +331,30 @@ void YamlReadArchive::ParseScalar(const std::string& value, float* result) {
 }
 
 void YamlReadArchive::ParseScalar(const std::string& value, double* result) {
-  ParseScalarImpl<double>(value, result);
+  if (!TryParseDecimal(value, result)) {
+    ParseScalarImpl<double>(value, result);
+  }
+}
+
+bool YamlReadArchive::TryParseDecimal(const std::string& value,
+                                      double* result) {
+  DRAKE_DEMAND(result != nullptr);
+  // Only accept the characters of plain decimal notation, so that anything
+  // std::from_chars would read differently than yaml-cpp (e.g., "inf" or
+  // "nan") is left to yaml-cpp.
+  if (value.empty() || value.find_first_not_of("0123456789-.eE") !=
+                           std::string::npos) {
+    return false;
+  }
+  const char* const end = value.data() + value.size();
+  double parsed{};
+  const std::from_chars_result outcome =
+      std::from_chars(value.data(), end, parsed);
+  if (outcome.ec != std::errc{} || outcome.ptr != end) {
+    return false;
+  }
+  *result = parsed;
+  return true;
 }
 
 void YamlReadArchive::ParseScalar(const std::string& value, int32_t* result) {
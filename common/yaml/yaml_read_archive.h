@@ -7,6 +7,7 @@
 #include <optional>
 #include <ostream>
 #include <string>
+#include <type_traits>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
@@ -369,8 +370,13 @@ class YamlReadArchive final {
                               elements.size(), size));
     }
     for (size_t i = 0; i < size; ++i) {
-      const std::string key = fmt::format("{}[{}]", name, i);
       const internal::Node& value = elements[i];
+      if constexpr (std::is_same_v<T, double>) {
+        if (value.IsScalar() && TryParseDecimal(value.GetScalar(), &data[i])) {
+          continue;
+        }
+      }
+      const std::string key = fmt::format("{}[{}]", name, i);
       YamlReadArchive item_archive(key.c_str(), &value, this);
       item_archive.Visit(drake::MakeNameValue(key.c_str(), &data[i]));
     }
@@ -450,8 +456,14 @@ class YamlReadArchive final {
     // Parse.
     for (size_t i = 0; i < rows; ++i) {
       for (size_t j = 0; j < cols; ++j) {
-        const std::string key = fmt::format("{}[{}][{}]", name, i, j);
         const internal::Node& value = elements[i].GetSequence()[j];
+        if constexpr (std::is_same_v<T, double>) {
+          if (value.IsScalar() &&
+              TryParseDecimal(value.GetScalar(), &storage(i, j))) {
+            continue;
+          }
+        }
+        const std::string key = fmt::format("{}[{}][{}]", name, i, j);
         YamlReadArchive item_archive(key.c_str(), &value, this);
         item_archive.Visit(drake::MakeNameValue(key.c_str(), &storage(i, j)));
       }
@@ -511,6 +523,12 @@ class YamlReadArchive final {
   template <typename T>
   void ParseScalarImpl(const std::string& value, T* result);
 
+  // Parses a number in plain decimal notation (e.g., "-1.5e3"), as found in
+  // large numeric arrays and matrices, without the overhead of yaml-cpp (or of
+  // a nested archive). Returns false, leaving `result` unchanged, for any other
+  // value; those must go through ParseScalar() instead.
+  static bool TryParseDecimal(const std::string& value, double* result);
+
   // --------------------------------------------------------------------------
   // @name Helpers, utilities, and member variables.
 
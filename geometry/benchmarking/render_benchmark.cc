@@ -2,7 +2,13 @@
 
 #include <unistd.h>
 
+#include <chrono>
 #include <filesystem>
+#include <future>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
 
 #include <benchmark/benchmark.h>
 #include <fmt/format.h>
@@ -67,6 +73,45 @@ std::unique_ptr<RenderEngine> MakeEngine(const Vector3d& bg_rgb) {
   }
 }
 
+/* Accumulates the wall-clock time spent in each stage (e.g., pose update or
+ rendering) of a benchmark's timed loop, and reports it as counters: the
+ average time per iteration of each stage, in milliseconds, and the
+ throughput in rendered images per second. The time of rendering an image
+ includes drawing it and reading it back into the output image; the
+ RenderEngine API does not expose those separately. */
+class StageTimes {
+ public:
+  /* Invokes `stage()` and adds its duration to the stage with the given
+   name. */
+  template <typename Stage>
+  void Time(const std::string& name, const Stage& stage) {
+    const auto start = std::chrono::steady_clock::now();
+    stage();
+    seconds_[name] += std::chrono::duration<double>(
+                          std::chrono::steady_clock::now() - start)
+                          .count();
+  }
+
+  /* Adds the counters to `state`, given the number of images rendered in each
+   iteration. */
+  void Report(int images_per_iteration, benchmark::State* state) const {
+    double total_seconds = 0;
+    for (const auto& [name, seconds] : seconds_) {
+      state->counters[name] =
+          benchmark::Counter(1e3 * seconds, benchmark::Counter::kAvgIterations);
+      total_seconds += seconds;
+    }
+    if (total_seconds > 0) {
+      state->counters["fps"] = benchmark::Counter(
+          images_per_iteration * static_cast<double>(state->iterations()) /
+          total_seconds);
+    }
+  }
+
+ private:
+  std::map<std::string, double> seconds_;
+};
+
 class RenderBenchmark : public benchmark::Fixture {
  public:
   RenderBenchmark() {
@@ -74,7 +119,10 @@ class RenderBenchmark : public benchmark::Fixture {
     material_.AddProperty("label", "id", RenderLabel::kDontCare);
   }
 
-  void SetUp(::benchmark::State&) { depth_cameras_.clear(); }
+  void SetUp(::benchmark::State&) {
+    depth_cameras_.clear();
+    poses_.clear();
+  }
 
   template <EngineType engine_type>
   // NOLINTNEXTLINE(runtime/references)
@@ -95,14 +143,20 @@ class RenderBenchmark : public benchmark::Fixture {
     }
 
     /* Now the timed loop. */
+    StageTimes times;
     for (auto _ : state) {
-      renderer->UpdatePoses(poses_);
-      for (int i = 0; i < camera_count; ++i) {
-        const ColorRenderCamera color_cam(depth_cameras_[i].core(),
-                                          FLAGS_show_window);
-        renderer->RenderColorImage(color_cam, &color_image);
-      }
+      times.Time("update_ms", [&]() {
+        renderer->UpdatePoses(poses_);
+      });
+      times.Time("render_ms", [&]() {
+        for (int i = 0; i < camera_count; ++i) {
+          const ColorRenderCamera color_cam(depth_cameras_[i].core(),
+                                            FLAGS_show_window);
+          renderer->RenderColorImage(color_cam, &color_image);
+        }
+      });
     }
+    times.Report(camera_count, &state);
     if (!FLAGS_save_image_path.empty()) {
       const std::string path_name = image_path_name(name, state, "png");
       SaveToPng(color_image, path_name);
@@ -126,12 +180,18 @@ class RenderBenchmark : public benchmark::Fixture {
     }
 
     /* Now the timed loop. */
+    StageTimes times;
     for (auto _ : state) {
-      renderer->UpdatePoses(poses_);
-      for (int i = 0; i < camera_count; ++i) {
-        renderer->RenderDepthImage(depth_cameras_[i], &depth_image);
-      }
+      times.Time("update_ms", [&]() {
+        renderer->UpdatePoses(poses_);
+      });
+      times.Time("render_ms", [&]() {
+        for (int i = 0; i < camera_count; ++i) {
+          renderer->RenderDepthImage(depth_cameras_[i], &depth_image);
+        }
+      });
     }
+    times.Report(camera_count, &state);
     if (!FLAGS_save_image_path.empty()) {
       const std::string path_name = image_path_name(name, state, "tiff");
       SaveToTiff(depth_image, path_name);
@@ -157,18 +217,123 @@ class RenderBenchmark : public benchmark::Fixture {
     }
 
     /* Now the timed loop. */
+    StageTimes times;
+    for (auto _ : state) {
+      times.Time("update_ms", [&]() {
+        renderer->UpdatePoses(poses_);
+      });
+      times.Time("render_ms", [&]() {
+        for (int i = 0; i < camera_count; ++i) {
+          const ColorRenderCamera color_cam(depth_cameras_[i].core(),
+                                            FLAGS_show_window);
+          renderer->RenderLabelImage(color_cam, &label_image);
+        }
+      });
+    }
+    times.Report(camera_count, &state);
+    if (!FLAGS_save_image_path.empty()) {
+      const std::string path_name = image_path_name(name, state, "png");
+      SaveToPng(label_image, path_name);
+    }
+  }
+
+  /* Renders the color, depth and label images of every camera in each
+   iteration, as a simulated robot with RGB-D and segmentation sensors would.
+   The cost of each image type is reported as its own stage. */
+  template <EngineType engine_type>
+  // NOLINTNEXTLINE(runtime/references)
+  void AllImages(::benchmark::State& state, const std::string&) {
+    auto renderer = MakeEngine<engine_type>(bg_rgb_);
+    auto [sphere_count, camera_count, width, height] = ReadState(state);
+    SetupScene(sphere_count, camera_count, width, height, renderer.get());
+    ImageRgba8U color_image(width, height);
+    ImageDepth32F depth_image(width, height);
+    ImageLabel16I label_image(width, height);
+
+    /* Warm start, as in the single image type benchmarks. */
+    for (int i = 0; i < 2; ++i) {
+      const ColorRenderCamera color_cam(depth_cameras_[0].core(),
+                                        FLAGS_show_window);
+      renderer->RenderColorImage(color_cam, &color_image);
+      renderer->RenderDepthImage(depth_cameras_[0], &depth_image);
+      renderer->RenderLabelImage(color_cam, &label_image);
+    }
+
+    /* Now the timed loop. */
+    StageTimes times;
     for (auto _ : state) {
-      renderer->UpdatePoses(poses_);
+      times.Time("update_ms", [&]() {
+        renderer->UpdatePoses(poses_);
+      });
       for (int i = 0; i < camera_count; ++i) {
         const ColorRenderCamera color_cam(depth_cameras_[i].core(),
                                           FLAGS_show_window);
-        renderer->RenderLabelImage(color_cam, &label_image);
+        times.Time("color_ms", [&]() {
+          renderer->RenderColorImage(color_cam, &color_image);
+        });
+        times.Time("depth_ms", [&]() {
+          renderer->RenderDepthImage(depth_cameras_[i], &depth_image);
+        });
+        times.Time("label_ms", [&]() {
+          renderer->RenderLabelImage(color_cam, &label_image);
+        });
       }
     }
-    if (!FLAGS_save_image_path.empty()) {
-      const std::string path_name = image_path_name(name, state, "png");
-      SaveToPng(label_image, path_name);
+    times.Report(3 * camera_count, &state);
+  }
+
+  /* Renders the color images of every camera with several independent
+   engines at once, one per thread, as a batch of simulations would. Each
+   engine has its own copy of the scene. The fifth benchmark argument is the
+   number of engines (and threads); the reported throughput counts the images
+   of all of them. */
+  template <EngineType engine_type>
+  // NOLINTNEXTLINE(runtime/references)
+  void ParallelColor(::benchmark::State& state, const std::string&) {
+    auto [sphere_count, camera_count, width, height] = ReadState(state);
+    const int engine_count = state.range(4);
+    std::vector<std::unique_ptr<RenderEngine>> renderers;
+    for (int e = 0; e < engine_count; ++e) {
+      renderers.push_back(MakeEngine<engine_type>(bg_rgb_));
+    }
+    SetupScene(sphere_count, camera_count, width, height, renderers[0].get());
+    for (int e = 1; e < engine_count; ++e) {
+      AddScene(renderers[e].get());
     }
+    std::vector<ImageRgba8U> color_images(engine_count,
+                                          ImageRgba8U(width, height));
+
+    /* Renders all of the cameras with engine `e`. */
+    auto render = [&](int e) {
+      renderers[e]->UpdatePoses(poses_);
+      for (int i = 0; i < camera_count; ++i) {
+        const ColorRenderCamera color_cam(depth_cameras_[i].core(),
+                                          FLAGS_show_window);
+        renderers[e]->RenderColorImage(color_cam, &color_images[e]);
+      }
+    };
+
+    /* Warm start every engine. */
+    for (int e = 0; e < engine_count; ++e) {
+      render(e);
+      render(e);
+    }
+
+    /* Now the timed loop. */
+    StageTimes times;
+    for (auto _ : state) {
+      times.Time("render_ms", [&]() {
+        std::vector<std::future<void>> futures;
+        for (int e = 1; e < engine_count; ++e) {
+          futures.push_back(std::async(std::launch::async, render, e));
+        }
+        render(0);
+        for (auto& future : futures) {
+          future.get();
+        }
+      });
+    }
+    times.Report(engine_count * camera_count, &state);
   }
 
   /* Parse arguments from the benchmark state.
@@ -194,9 +359,9 @@ class RenderBenchmark : public benchmark::Fixture {
                                         height, format));
   }
 
-  /* Computes a compact array of spheres which will remain in view. */
-  void AddSphereArray(int sphere_count, const RenderCameraCore& core,
-                      RenderEngine* engine) {
+  /* Computes a compact array of spheres which will remain in view, storing
+   their radius and poses. */
+  void ComputeSphereArray(int sphere_count, const RenderCameraCore& core) {
     /* We assume the camera is located at (0, 0, c.z) pointing in the -Wz
      direction. We further assume that the camera's "up" direction points in the
      +Wy direction. All spheres will be placed on a plane at z = s.z. Given the
@@ -253,13 +418,9 @@ class RenderBenchmark : public benchmark::Fixture {
     const double distance = h / (2 * rows);
     /* We make the actual radius *slightly* smaller so there's some space
      between the spheres. */
-    Sphere sphere{distance * 0.95};
-    auto add_sphere = [this, engine, &sphere](const Vector3d& p_WS) {
-      GeometryId geometry_id = GeometryId::get_new_id();
-      engine->RegisterVisual(geometry_id, sphere, material_,
-                             RigidTransformd::Identity(),
-                             true /* needs update */);
-      poses_.insert({geometry_id, RigidTransformd{p_WS}});
+    sphere_radius_ = distance * 0.95;
+    auto add_sphere = [this](const Vector3d& p_WS) {
+      poses_.insert({GeometryId::get_new_id(), RigidTransformd{p_WS}});
     };
 
     int count = 0;
@@ -279,6 +440,21 @@ class RenderBenchmark : public benchmark::Fixture {
 
   void SetupScene(const int sphere_count, const int camera_count,
                   const int width, const int height, RenderEngine* engine) {
+    // Add the cameras.
+    for (int i = 0; i < camera_count; ++i) {
+      depth_cameras_.emplace_back(RenderCameraCore{"unused" + std::to_string(i),
+                                                   {width, height, kFovY},
+                                                   {0.01, 100.0},
+                                                   {}},
+                                  DepthRange{kZNear, kZFar});
+    }
+    ComputeSphereArray(sphere_count, depth_cameras_[0].core());
+    AddScene(engine);
+  }
+
+  /* Registers the spheres computed by SetupScene() with the given engine, and
+   sets its viewpoint. */
+  void AddScene(RenderEngine* engine) {
     // Set up the camera so that Cz = -Wz, Cx = Wx, and Cy = -Wy. The camera
     // will look down the Wz axis and have the image U direction aligned with
     // the Wx direction.
@@ -289,45 +465,75 @@ class RenderBenchmark : public benchmark::Fixture {
         RotationMatrixd::MakeFromOrthonormalColumns(Cx_W, Cy_W, Cz_W)};
     engine->UpdateViewpoint(X_WC);
 
-    // Add the cameras.
-    for (int i = 0; i < camera_count; ++i) {
-      depth_cameras_.emplace_back(RenderCameraCore{"unused" + std::to_string(i),
-                                                   {width, height, kFovY},
-                                                   {0.01, 100.0},
-                                                   {}},
-                                  DepthRange{kZNear, kZFar});
+    const Sphere sphere{sphere_radius_};
+    for (const auto& [geometry_id, X_WS] : poses_) {
+      engine->RegisterVisual(geometry_id, sphere, material_,
+                             RigidTransformd::Identity(),
+                             true /* needs update */);
     }
-    AddSphereArray(sphere_count, depth_cameras_[0].core(), engine);
   }
 
   std::vector<DepthRenderCamera> depth_cameras_;
   PerceptionProperties material_;
   const Vector3d bg_rgb_{200 / 255., 0, 250 / 255.};
   const Rgba sphere_rgba_{0, 0.8, 0.5, 1};
+  double sphere_radius_{};
   std::unordered_map<GeometryId, RigidTransformd> poses_;
 };
 
+/* The scene configurations shared by the benchmarks of a single engine. Each
+ is a 4-tuple of: sphere count, camera count, image width, and image height. */
+void SceneArgs(benchmark::internal::Benchmark* benchmark) {
+  benchmark->Args({1, 1, 640, 480})
+      ->Args({12, 1, 640, 480})
+      ->Args({120, 1, 640, 480})
+      ->Args({240, 1, 640, 480})
+      ->Args({480, 1, 640, 480})
+      ->Args({1200, 1, 640, 480})
+      ->Args({1, 10, 640, 480})
+      ->Args({1200, 10, 640, 480})
+      ->Args({1, 1, 320, 240})
+      ->Args({1, 1, 1280, 960})
+      ->Args({1, 1, 2560, 1920})
+      ->Args({1200, 1, 320, 240})
+      ->Args({1200, 1, 1280, 960})
+      ->Args({1200, 1, 2560, 1920});
+}
+
+/* The configurations of the parallel benchmarks: the scene configuration
+ followed by the number of engines. */
+void ParallelArgs(benchmark::internal::Benchmark* benchmark) {
+  for (const int engine_count : {1, 2, 4, 8}) {
+    benchmark->Args({1, 1, 320, 240, engine_count})
+        ->Args({120, 1, 640, 480, engine_count})
+        ->Args({1200, 10, 640, 480, engine_count});
+  }
+}
+
 /* These macros serve the purpose of allowing compact and *consistent*
  declarations of benchmarks. The goal is to create a benchmark for each
  renderer type (e.g., Vtk, Gl) combined with each image type (Color, Depth, and
- Label). Each benchmark instance should be executed using the same parameters.
+ Label), as well as the benchmarks of all image types at once and of parallel
+ engines. Each benchmark instance should be executed using the same parameters.
 
  These macros guarantee that a benchmark is declared, dispatches the right
  benchmark harness and is executed with a common set of parameters.
 
- The macro is invoked as follows:
+ The macros are invoked as follows:
 
    MAKE_BENCHMARK(Foo, ImageType)
+   MAKE_ALL_IMAGES_BENCHMARK(Foo)
+   MAKE_PARALLEL_BENCHMARK(Foo)
 
- such that there must be a `EngineType::Foo` enum and mageType must be one of
+ such that there must be a `EngineType::Foo` enum and ImageType must be one of
  (Color, Depth, or Label). Capitalization matters.
 
  N.B. The macro STR converts a single macro parameter into a string and we use
  it to make a string out of the concatenation of two macro parameters (i.e., we
  get FooColor out of the parameters Foo and Color).
 
- The parameters are 4-tuples of: sphere count, camera count, image width, and
- image height. */
+ The parallel benchmarks measure real (wall-clock) time, since the main
+ thread's CPU time does not account for the work of the other threads. */
 #define STR(s) #s
 #define MAKE_BENCHMARK(Renderer, ImageT)                               \
   BENCHMARK_DEFINE_F(RenderBenchmark, Renderer##ImageT)                \
@@ -336,29 +542,39 @@ class RenderBenchmark : public benchmark::Fixture {
   }                                                                    \
   BENCHMARK_REGISTER_F(RenderBenchmark, Renderer##ImageT)              \
       ->Unit(benchmark::kMillisecond)                                  \
-      ->Args({1, 1, 640, 480})                                         \
-      ->Args({12, 1, 640, 480})                                        \
-      ->Args({120, 1, 640, 480})                                       \
-      ->Args({240, 1, 640, 480})                                       \
-      ->Args({480, 1, 640, 480})                                       \
-      ->Args({1200, 1, 640, 480})                                      \
-      ->Args({1, 10, 640, 480})                                        \
-      ->Args({1200, 10, 640, 480})                                     \
-      ->Args({1, 1, 320, 240})                                         \
-      ->Args({1, 1, 1280, 960})                                        \
-      ->Args({1, 1, 2560, 1920})                                       \
-      ->Args({1200, 1, 320, 240})                                      \
-      ->Args({1200, 1, 1280, 960})                                     \
-      ->Args({1200, 1, 2560, 1920})
+      ->Apply(SceneArgs)
+
+#define MAKE_ALL_IMAGES_BENCHMARK(Renderer)                                   \
+  BENCHMARK_DEFINE_F(RenderBenchmark, Renderer##AllImages)                    \
+  (benchmark::State & state) {                                                \
+    AllImages<EngineType::Renderer>(state, STR(Renderer##AllImages));         \
+  }                                                                           \
+  BENCHMARK_REGISTER_F(RenderBenchmark, Renderer##AllImages)                  \
+      ->Unit(benchmark::kMillisecond)                                         \
+      ->Apply(SceneArgs)
+
+#define MAKE_PARALLEL_BENCHMARK(Renderer)                                     \
+  BENCHMARK_DEFINE_F(RenderBenchmark, Renderer##ParallelColor)                \
+  (benchmark::State & state) {                                                \
+    ParallelColor<EngineType::Renderer>(state, STR(Renderer##ParallelColor)); \
+  }                                                                           \
+  BENCHMARK_REGISTER_F(RenderBenchmark, Renderer##ParallelColor)              \
+      ->Unit(benchmark::kMillisecond)                                         \
+      ->UseRealTime()                                                         \
+      ->Apply(ParallelArgs)
 
 MAKE_BENCHMARK(Vtk, Color);
 MAKE_BENCHMARK(Vtk, Depth);
 MAKE_BENCHMARK(Vtk, Label);
+MAKE_ALL_IMAGES_BENCHMARK(Vtk);
+MAKE_PARALLEL_BENCHMARK(Vtk);
 
 #ifndef __APPLE__
 MAKE_BENCHMARK(Gl, Color);
 MAKE_BENCHMARK(Gl, Depth);
 MAKE_BENCHMARK(Gl, Label);
+MAKE_ALL_IMAGES_BENCHMARK(Gl);
+MAKE_PARALLEL_BENCHMARK(Gl);
 #endif
 
 }  // namespace
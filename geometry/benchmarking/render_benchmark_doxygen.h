@@ -51,7 +51,12 @@ namespace render {
        with both simple and complex scenes.
 
  We examine those same properties for all three image types: color, depth, and
- label.
+ label, and for all three of them rendered together from each camera (as an
+ RGB-D camera with segmentation would).
+
+ Finally, we examine the throughput of several independent engines, each with
+ its own copy of the scene, rendering concurrently in as many threads (as a
+ batch of simulations would).
 
  <h2>Running the benchmark</h2>
 
@@ -134,21 +139,40 @@ namespace render {
      - __VtkColor__: Renders the color image from RenderEngineVtk.
      - __VtkDepth__: Renders the depth image from RenderEngineVtk.
      - __VtkLabel__: Renders the label image from RenderEngineVtk.
-     - __GlColor__: Renders the color image from RenderEngineGl.
-     - __GlDepth__: Renders the depth image from RenderEngineGl.
-     - __GlLabel__: Renders the label image from RenderEngineGl.
+     - __VtkAllImages__: Renders the color, depth and label images from
+       RenderEngineVtk.
+     - __VtkParallelColor__: Renders the color image from several
+       RenderEngineVtk instances in parallel.
+     - __GlColor__, __GlDepth__, __GlLabel__, __GlAllImages__ and
+       __GlParallelColor__: The same, for RenderEngineGl.
    - __sphere_count__: The total number of spheres.
    - __camera_count__: Simply the number of independent cameras being rendered.
      The cameras are all co-located (same position, same view direction) so
      they each render the same image.
    - __image width__ and __image_height__: The dimensions of the output image
      in pixels.
+   - For the ParallelColor tests only, a final __engine_count__: the number of
+     engines, each rendering all of its cameras in its own thread.
 
  The `Time` and `CPU` columns are measures of the average time it took to create
  a single frame for all the specified cameras. The `Iterations` indicates how
  often the action was performed to compute the average value. For more
  information see the [google benchmark
- documentation](https://github.com/google/benchmark).
+ documentation](https://github.com/google/benchmark). (The ParallelColor tests
+ measure the `Time` column in wall-clock time.)
+
+ Each line also reports the following counters:
+   - __fps__: The throughput, in images rendered per second of wall-clock time
+     spent in the measured stages. For AllImages, each camera counts as three
+     images; for ParallelColor, the images of all engines are counted.
+   - __update_ms__: The average time per frame spent updating the poses of the
+     geometries in the engine.
+   - __render_ms__ (or __color_ms__, __depth_ms__ and __label_ms__ for
+     AllImages): The average time per frame spent rendering the images. This
+     includes both drawing the images and reading them back from the engine
+     into the output image; RenderEngine does not expose these separately.
+     For ParallelColor, it also includes the pose updates, which are done by
+     each engine in its own thread.
 
  Now we can analyze the example output and draw some example inferences (not a
  complete set of valid inferences):
@@ -4,6 +4,7 @@
 #include <functional>
 #include <memory>
 #include <string>
+#include <type_traits>
 #include <utility>
 
 #include <fmt/format.h>
@@ -130,6 +131,7 @@ GeometryState<T>::GeometryState()
   frame_index_to_id_map_.push_back(world);
   kinematics_data_.X_WFs.push_back(RigidTransform<T>::Identity());
   kinematics_data_.X_PFs.push_back(RigidTransform<T>::Identity());
+  kinematics_data_.stale_frames.push_back(false);
 
   source_frame_id_map_[self_source_] = {world};
   source_deformable_geometry_id_map_[self_source_] = {};
@@ -202,6 +204,8 @@ GeometryState<T>::GeometryState(const GeometryState<U>& source)
   // handled by the KinematicsData class.
   convert_pose_vector(source.kinematics_data_.X_PFs, &kinematics_data_.X_PFs);
   convert_pose_vector(source.kinematics_data_.X_WFs, &kinematics_data_.X_WFs);
+  kinematics_data_.stale_frames = source.kinematics_data_.stale_frames;
+  kinematics_data_.moved_geometries = source.kinematics_data_.moved_geometries;
 
   // Now convert the id -> pose map.
   {
@@ -780,6 +784,8 @@ FrameId GeometryState<T>::RegisterFrame(SourceId source_id, FrameId parent_id,
   int index(static_cast<int>(kinematics_data_.X_PFs.size()));
   kinematics_data_.X_PFs.emplace_back(RigidTransform<T>::Identity());
   kinematics_data_.X_WFs.emplace_back(RigidTransform<T>::Identity());
+  // The frame's world pose isn't known until its first pose update.
+  kinematics_data_.stale_frames.push_back(true);
   frame_index_to_id_map_.push_back(frame_id);
   f_set.insert(frame_id);
   frames_.emplace(frame_id, InternalFrame(source_id, frame_id, frame.name(),
@@ -936,6 +942,15 @@ void GeometryState<T>::ChangeShape(SourceId source_id, GeometryId geometry_id,
     // As documented on SceneGraph::SetShape(); use the old pose unless
     // explicitly changed.
     geometry->set_pose(*X_FG);
+    // Update the world pose now, so the engines below see it, and mark the
+    // frame stale so that the next pose update recomputes (and propagates) the
+    // poses of its geometries even if the frame itself hasn't moved.
+    const InternalFrame& frame = frames_.at(geometry->frame_id());
+    kinematics_data_.X_WGs[geometry_id] =
+        kinematics_data_.X_WFs[frame.index()] * X_FG->cast<T>();
+    if (geometry->is_dynamic()) {
+      kinematics_data_.stale_frames[frame.index()] = true;
+    }
   }
   // We've changed pose and shape; now we just need to notify the various
   // engines to update themselves.
@@ -1069,17 +1084,15 @@ template <typename T>
 void GeometryState<T>::AssignRole(SourceId source_id, GeometryId geometry_id,
                                   PerceptionProperties properties,
                                   RoleAssign assign) {
-  if (assign == RoleAssign::kReplace) {
-    throw std::logic_error(
-        "AssignRole() with RoleAssign::kReplace does not work for perception "
-        "properties");
-  }
-
   InternalGeometry& geometry =
       ValidateRoleAssign(source_id, geometry_id, Role::kPerception, assign);
 
-  // TODO(SeanCurtis-TRI): To support RoleAssign::kReplace, the render engines
-  //  need to handle these changes.
+  // The render engines have no means to update the properties of a visual in
+  // place, so the geometry is re-registered with the renderers only. Its
+  // registration with SceneGraph and the proximity engine is untouched.
+  if (assign == RoleAssign::kReplace) {
+    RemoveFromAllRenderersUnchecked(geometry_id);
+  }
 
   geometry.SetRole(std::move(properties));
 
@@ -1383,8 +1396,8 @@ void GeometryState<T>::SetFramePoses(
   ValidateFrameIds(source_id, poses);
   const RigidTransform<T> world_pose = RigidTransform<T>::Identity();
   for (auto frame_id : source_root_frame_map_.at(source_id)) {
-    UpdatePosesRecursively(frames_.at(frame_id), world_pose, poses,
-        kinematics_data);
+    UpdatePosesRecursively(frames_.at(frame_id), world_pose,
+                           false /* parent_moved */, poses, kinematics_data);
   }
 }
 
@@ -1460,13 +1473,17 @@ void GeometryState<T>::ValidateRegistrationAndSetTopology(
 
 template <typename T>
 void GeometryState<T>::FinalizePoseUpdate(
-      const internal::KinematicsData<T>& kinematics_data,
+      internal::KinematicsData<T>* kinematics_data,
       internal::ProximityEngine<T>* proximity_engine,
       std::vector<render::RenderEngine*> render_engines) const {
-  proximity_engine->UpdateWorldPoses(kinematics_data.X_WGs);
+  if (kinematics_data->moved_geometries.empty()) return;
+  proximity_engine->UpdateWorldPoses(kinematics_data->X_WGs,
+                                     kinematics_data->moved_geometries);
   for (auto* render_engine : render_engines) {
-    render_engine->UpdatePoses(kinematics_data.X_WGs);
+    render_engine->UpdatePoses(kinematics_data->X_WGs,
+                               kinematics_data->moved_geometries);
   }
+  kinematics_data->moved_geometries.clear();
 }
 
 template <typename T>
@@ -1497,27 +1514,43 @@ SourceId GeometryState<T>::get_source_id(GeometryId id) const {
 template <typename T>
 void GeometryState<T>::UpdatePosesRecursively(
     const internal::InternalFrame& frame, const RigidTransform<T>& X_WP,
-    const FramePoseVector<T>& poses,
+    bool parent_moved, const FramePoseVector<T>& poses,
     internal::KinematicsData<T>* kinematics_data) const {
   const auto frame_id = frame.id();
+  const int index = frame.index();
   const auto& X_PF = poses.value(frame_id);
-  // Cache this transform for later use.
-  kinematics_data->X_PFs[frame.index()] = X_PF;
-  RigidTransform<T> X_WF = X_WP * X_PF;
-  kinematics_data->X_WFs[frame.index()] = X_WF;
-  // Update the geometry which belong to *this* frame.
-  for (auto child_id : frame.child_geometries()) {
-    const auto& child_geometry = geometries_.at(child_id);
-    // X_FG() is always RigidTransform<double>, to account for
-    // GeometryState<AutoDiff>, we need to cast it to the common type T.
-    RigidTransform<double> X_FG(child_geometry.X_FG());
-    kinematics_data->X_WGs[child_id] = X_WF * X_FG.cast<T>();
+  // The frame has moved if its parent has, if its X_PF has changed, or if its
+  // world pose has never been computed. We only compare double-valued poses;
+  // for the other scalars, derivatives (or expressions) may change while the
+  // values don't, so we conservatively treat every frame as moved.
+  bool moved = parent_moved || kinematics_data->stale_frames[index];
+  if constexpr (std::is_same_v<T, double>) {
+    moved = moved || !X_PF.IsExactlyEqualTo(kinematics_data->X_PFs[index]);
+  } else {
+    moved = true;
+  }
+  if (moved) {
+    // Cache this transform for later use.
+    kinematics_data->X_PFs[index] = X_PF;
+    kinematics_data->X_WFs[index] = X_WP * X_PF;
+    kinematics_data->stale_frames[index] = false;
+    const RigidTransform<T>& X_WF = kinematics_data->X_WFs[index];
+    // Update the geometry which belong to *this* frame.
+    for (auto child_id : frame.child_geometries()) {
+      const auto& child_geometry = geometries_.at(child_id);
+      // X_FG() is always RigidTransform<double>, to account for
+      // GeometryState<AutoDiff>, we need to cast it to the common type T.
+      RigidTransform<double> X_FG(child_geometry.X_FG());
+      kinematics_data->X_WGs[child_id] = X_WF * X_FG.cast<T>();
+      kinematics_data->moved_geometries.push_back(child_id);
+    }
   }
 
   // Update each child frame.
   for (auto child_id : frame.child_frames()) {
     const auto& child_frame = frames_.at(child_id);
-    UpdatePosesRecursively(child_frame, X_WF, poses, kinematics_data);
+    UpdatePosesRecursively(child_frame, kinematics_data->X_WFs[index], moved,
+                           poses, kinematics_data);
   }
 }
 
@@ -80,6 +80,18 @@ struct KinematicsData {
   // In other words, it is the full evaluation of the kinematic chain from
   // frame i to the world frame.
   std::vector<math::RigidTransform<T>> X_WFs;
+
+  // Map from a frame's index to whether X_WFs[i] (and the poses of the frame's
+  // geometries) must be recomputed by the next pose update even if the frame's
+  // X_PF is unchanged (e.g., because the frame has just been registered).
+  std::vector<bool> stale_frames;
+
+  // The geometries whose entries in X_WGs have been recomputed since the
+  // proximity and render engines were last updated. A pose update only
+  // recomputes the frames that have moved (for T = double, those whose X_PF
+  // differs from the previous value, or that have a moved ancestor), so that
+  // the engines only update the geometries that have moved.
+  std::vector<GeometryId> moved_geometries;
 };
 
 }  // namespace internal
@@ -469,19 +481,20 @@ class GeometryState {
   //@{
 
   /** Implementation of QueryObject::ComputePointPairPenetration().  */
-  std::vector<PenetrationAsPointPair<T>> ComputePointPairPenetration() const {
-    return geometry_engine_->ComputePointPairPenetration(
-        kinematics_data_.X_WGs);
+  std::vector<PenetrationAsPointPair<T>> ComputePointPairPenetration(
+      Parallelism parallelize = false) const {
+    return geometry_engine_->ComputePointPairPenetration(kinematics_data_.X_WGs,
+                                                         parallelize);
   }
 
   /** Implementation of QueryObject::ComputeContactSurfaces().  */
   template <typename T1 = T>
   typename std::enable_if_t<scalar_predicate<T1>::is_bool,
                             std::vector<ContactSurface<T>>>
-  ComputeContactSurfaces(
-      HydroelasticContactRepresentation representation) const {
-    return geometry_engine_->ComputeContactSurfaces(representation,
-                                                    kinematics_data_.X_WGs);
+  ComputeContactSurfaces(HydroelasticContactRepresentation representation,
+                         Parallelism parallelize = false) const {
+    return geometry_engine_->ComputeContactSurfaces(
+        representation, kinematics_data_.X_WGs, parallelize);
   }
 
   /** Implementation of QueryObject::ComputeContactSurfacesWithFallback().  */
@@ -490,19 +503,22 @@ class GeometryState {
   ComputeContactSurfacesWithFallback(
       HydroelasticContactRepresentation representation,
       std::vector<ContactSurface<T>>* surfaces,
-      std::vector<PenetrationAsPointPair<T>>* point_pairs) const {
+      std::vector<PenetrationAsPointPair<T>>* point_pairs,
+      Parallelism parallelize = false) const {
     DRAKE_DEMAND(surfaces != nullptr);
     DRAKE_DEMAND(point_pairs != nullptr);
     return geometry_engine_->ComputeContactSurfacesWithFallback(
-        representation, kinematics_data_.X_WGs, surfaces, point_pairs);
+        representation, kinematics_data_.X_WGs, surfaces, point_pairs,
+        parallelize);
   }
 
   /** Implementation of QueryObject::ComputeDeformableContact().  */
   template <typename T1 = T>
   typename std::enable_if_t<std::is_same_v<T1, double>, void>
-  ComputeDeformableContact(
-      internal::DeformableContact<T>* deformable_contact) const {
-    return geometry_engine_->ComputeDeformableContact(deformable_contact);
+  ComputeDeformableContact(internal::DeformableContact<T>* deformable_contact,
+                           Parallelism parallelize = false) const {
+    return geometry_engine_->ComputeDeformableContact(deformable_contact,
+                                                      parallelize);
   }
 
   /** Implementation of QueryObject::FindCollisionCandidates().  */
@@ -510,9 +526,22 @@ class GeometryState {
     return geometry_engine_->FindCollisionCandidates();
   }
 
+  /** Implementation of QueryObject::FindCollisionCandidates(geometry_set).  */
+  std::vector<SortedPair<GeometryId>> FindCollisionCandidates(
+      const GeometrySet& geometry_set) const {
+    return geometry_engine_->FindCollisionCandidates(
+        GetGeometryIds(geometry_set, Role::kProximity));
+  }
+
   /** Implementation of QueryObject::HasCollisions().  */
   bool HasCollisions() const { return geometry_engine_->HasCollisions(); }
 
+  /** Implementation of QueryObject::HasCollisions(geometry_set).  */
+  bool HasCollisions(const GeometrySet& geometry_set) const {
+    return geometry_engine_->HasCollisions(
+        GetGeometryIds(geometry_set, Role::kProximity));
+  }
+
   //@}
 
   /** @name        Collision filtering    */
@@ -537,9 +566,9 @@ class GeometryState {
   /** Implementation of
    QueryObject::ComputeSignedDistancePairwiseClosestPoints().  */
   std::vector<SignedDistancePair<T>> ComputeSignedDistancePairwiseClosestPoints(
-      double max_distance) const {
+      double max_distance, Parallelism parallelize = false) const {
     return geometry_engine_->ComputeSignedDistancePairwiseClosestPoints(
-        kinematics_data_.X_WGs, max_distance);
+        kinematics_data_.X_WGs, max_distance, parallelize);
   }
 
   /** Implementation of
@@ -686,9 +715,10 @@ class GeometryState {
                                           GeometryId geometry_id);
 
   // Method that updates the proximity engine and the render engines with the
-  // up-to-date _pose_ data in `kinematics_data`.
+  // up-to-date _pose_ data in `kinematics_data` for the geometries in its
+  // `moved_geometries`, and then clears `moved_geometries`.
   void FinalizePoseUpdate(
-      const internal::KinematicsData<T>& kinematics_data,
+      internal::KinematicsData<T>* kinematics_data,
       internal::ProximityEngine<T>* proximity_engine,
       std::vector<render::RenderEngine*> render_engines) const;
 
@@ -710,10 +740,12 @@ class GeometryState {
 
   // Recursively updates the frame and geometry _pose_ information for the tree
   // rooted at the given frame, whose parent's pose in the world frame is given
-  // as `X_WP`.
+  // as `X_WP`. Only the frames that have moved (see
+  // KinematicsData::moved_geometries) are recomputed; `parent_moved` reports
+  // whether X_WP has changed.
   void UpdatePosesRecursively(
       const internal::InternalFrame& frame, const math::RigidTransform<T>& X_WP,
-      const FramePoseVector<T>& poses,
+      bool parent_moved, const FramePoseVector<T>& poses,
       internal::KinematicsData<T>* kinematics_data) const;
 
   // Reports true if the given id refers to a _dynamic_ geometry. Assumes the
@@ -1,6 +1,7 @@
 #include "drake/geometry/meshcat.h"
 
 #include <algorithm>
+#include <array>
 #include <atomic>
 #include <cctype>
 #include <exception>
@@ -15,7 +16,9 @@
 #include <string>
 #include <thread>
 #include <tuple>
+#include <type_traits>
 #include <utility>
+#include <vector>
 
 #include <App.h>
 #include <common_robotics_utilities/base64_helpers.hpp>
@@ -570,6 +573,51 @@ Eigen::Vector3d MeshcatYUpPosition(const Eigen::Vector3d& p_WP) {
   return Eigen::Vector3d(p_WP.x(), p_WP.z(), -p_WP.y());
 }
 
+// Packs the "times" and "values" of an animation track, where the value of
+// keyframe i is values[i * width] ... values[(i + 1) * width - 1]. A keyframe
+// whose value equals the values of both of its neighbors doesn't change the
+// (interpolated) animation, so it is omitted. Doubles are packed as floats,
+// which is the precision that three.js uses for animations anyway.
+template <typename Element, typename Packer>
+void PackKeyframeTrack(const std::vector<int>& frames,
+                       const std::vector<Element>& values, int width,
+                       Packer* o) {
+  const int num_keys = ssize(frames);
+  auto same_value = [&values, width](int i, int j) {
+    for (int k = 0; k < width; ++k) {
+      if (values[i * width + k] != values[j * width + k]) {
+        return false;
+      }
+    }
+    return true;
+  };
+  std::vector<int> keys;
+  keys.reserve(num_keys);
+  for (int i = 0; i < num_keys; ++i) {
+    if (i > 0 && i + 1 < num_keys && same_value(i, i - 1) &&
+        same_value(i, i + 1)) {
+      continue;
+    }
+    keys.push_back(i);
+  }
+  o->pack("times");
+  o->pack_array(keys.size());
+  for (int i : keys) {
+    o->pack(frames[i]);
+  }
+  o->pack("values");
+  o->pack_array(keys.size() * width);
+  for (int i : keys) {
+    for (int k = 0; k < width; ++k) {
+      if constexpr (std::is_same_v<Element, double>) {
+        o->pack_float(static_cast<float>(values[i * width + k]));
+      } else {
+        o->pack(static_cast<bool>(values[i * width + k]));
+      }
+    }
+  }
+}
+
 }  // namespace
 
 class Meshcat::Impl {
@@ -757,6 +805,7 @@ class Meshcat::Impl {
       std::future<int> f = p.get_future();
       Defer([this, p = std::move(p)]() mutable {
         DRAKE_DEMAND(IsThread(websocket_thread_id_));
+        PublishPendingTransforms();
         int websocket_backpressure = 0;
         for (WebSocket* ws : websockets_) {
           websocket_backpressure += ws->getBufferedAmount();
@@ -1115,6 +1164,46 @@ class Meshcat::Impl {
       app_->publish("all", message, uWS::OpCode::BINARY, false);
       SceneTreeElement& e = scene_tree_root_[data.path];
       e.transform() = std::move(message);
+      // A pose from SetTransforms() that hasn't been sent yet is now stale.
+      pending_transforms_.erase(data.path);
+    });
+  }
+
+  // This function is public via the PIMPL.
+  void SetTransforms(const std::vector<std::string>& paths,
+                     const std::vector<RigidTransformd>& X_ParentPaths) {
+    DRAKE_DEMAND(IsThread(main_thread_id_));
+    DRAKE_DEMAND(paths.size() == X_ParentPaths.size());
+
+    std::vector<internal::SetTransformData> transforms(paths.size());
+    for (int i = 0; i < ssize(paths); ++i) {
+      transforms[i].path = FullPath(paths[i]);
+      Eigen::Map<Eigen::Matrix4d>(transforms[i].matrix) =
+          X_ParentPaths[i].GetAsMatrix4();
+    }
+    const int64_t sequence = ++set_transforms_sequence_;
+
+    Defer([this, sequence, transforms = std::move(transforms)]() {
+      DRAKE_DEMAND(IsThread(websocket_thread_id_));
+      DRAKE_DEMAND(app_ != nullptr);
+      for (const internal::SetTransformData& data : transforms) {
+        std::stringstream message_stream;
+        msgpack::pack(message_stream, data);
+        std::string message = message_stream.str();
+        SceneTreeElement& e = scene_tree_root_[data.path];
+        // Only send the transforms that changed.
+        if (e.transform() == message) {
+          continue;
+        }
+        e.transform() = std::move(message);
+        std::copy(data.matrix, data.matrix + 16,
+                  pending_transforms_[data.path].begin());
+      }
+      // If a newer batch is already queued, leave it to send these transforms
+      // too (unless it overwrites them) rather than sending stale poses now.
+      if (sequence == set_transforms_sequence_.load()) {
+        PublishPendingTransforms();
+      }
     });
   }
 
@@ -1132,6 +1221,14 @@ class Meshcat::Impl {
       msgpack::pack(message_stream, data);
       app_->publish("all", message_stream.str(), uWS::OpCode::BINARY, false);
       scene_tree_root_.Delete(data.path);
+      // Don't send poses (which would re-create the paths) for what was
+      // deleted.
+      std::erase_if(pending_transforms_, [&data](const auto& item) {
+        const std::string& path = item.first;
+        return path.starts_with(data.path) &&
+               (path.size() == data.path.size() ||
+                path[data.path.size()] == '/' || data.path.ends_with('/'));
+      });
     });
   }
 
@@ -1196,24 +1293,19 @@ class Meshcat::Impl {
           {
             o.pack_array(path_track.second.size());
             for (const auto& property_track : path_track.second) {
-              o.pack_map(3);
+              o.pack_map(4);
               o.pack("name");
               o.pack("." + property_track.first);
               o.pack("type");
               o.pack(property_track.second.js_type);
-              o.pack("keys");
+              // We send the flat "times" and "values" arrays of three.js's
+              // KeyframeTrack rather than the (much larger) list of "keys".
               std::visit(
                   [&o](const auto& track) {
                     using T = std::decay_t<decltype(track)>;
                     if constexpr (!std::is_same_v<T, std::monostate>) {
-                      o.pack_array(track.size());
-                      for (const auto& key : track) {
-                        o.pack_map(2);
-                        o.pack("time");
-                        o.pack(key.first);
-                        o.pack("value");
-                        o.pack(key.second);
-                      }
+                      PackKeyframeTrack(track.frames, track.values,
+                                        track.width, &o);
                     }
                   },
                   property_track.second.track);
@@ -1801,6 +1893,10 @@ class Meshcat::Impl {
       // IsThread(websocket_thread_id_) is checked by the Handle... function.
       HandleMessage(ws, message);
     };
+    behavior.drain = [this](WebSocket*) {
+      DRAKE_DEMAND(IsThread(websocket_thread_id_));
+      PublishPendingTransforms();
+    };
 
     uWS::App app =
         uWS::App()
@@ -1864,6 +1960,33 @@ class Meshcat::Impl {
     app.run();
   }
 
+  // Sends all of the pending_transforms_ in a single message, unless a client
+  // is still catching up on earlier messages, in which case the transforms
+  // stay pending (where newer poses replace stale ones) until the drain
+  // callback calls this again.
+  void PublishPendingTransforms() const {
+    DRAKE_DEMAND(IsThread(websocket_thread_id_));
+    if (pending_transforms_.empty()) {
+      return;
+    }
+    for (WebSocket* ws : websockets_) {
+      if (ws->getBufferedAmount() > 0) {
+        return;
+      }
+    }
+    internal::SetTransformsData data;
+    data.paths.reserve(pending_transforms_.size());
+    data.matrices.reserve(16 * pending_transforms_.size());
+    for (const auto& [path, matrix] : pending_transforms_) {
+      data.paths.push_back(path);
+      data.matrices.insert(data.matrices.end(), matrix.begin(), matrix.end());
+    }
+    pending_transforms_.clear();
+    std::stringstream message_stream;
+    msgpack::pack(message_stream, data);
+    app_->publish("all", message_stream.str(), uWS::OpCode::BINARY, false);
+  }
+
   // This function is a callback from a WebSocketBehavior.
   void HandleSocketOpen(WebSocket* ws) {
     DRAKE_DEMAND(IsThread(websocket_thread_id_));
@@ -2066,6 +2189,15 @@ class Meshcat::Impl {
   uWS::App* app_{nullptr};
   us_listen_socket_t* listen_socket_{nullptr};
   std::set<WebSocket*> websockets_{};
+  // The transforms from SetTransforms() that haven't been sent yet, keyed by
+  // full path. See PublishPendingTransforms(). This is mutable so that Flush()
+  // can publish it.
+  mutable std::map<std::string, std::array<double, 16>> pending_transforms_{};
+
+  // This variable is incremented in the main thread by each call to
+  // SetTransforms(), and read in the websocket thread to detect when a newer
+  // batch of transforms is already queued.
+  std::atomic<int64_t> set_transforms_sequence_{0};
 
   // This variable may be accessed from any thread, but should only be modified
   // in the websocket thread.
@@ -2337,6 +2469,21 @@ void Meshcat::SetTransform(std::string_view path,
   impl().SetTransform(path, matrix);
 }
 
+void Meshcat::SetTransforms(const std::vector<std::string>& paths,
+                            const std::vector<RigidTransformd>& X_ParentPaths,
+                            const std::optional<double>& time) {
+  DRAKE_THROW_UNLESS(paths.size() == X_ParentPaths.size());
+  if (recording_ && time) {
+    const int frame = animation_->frame(*time);
+    for (int i = 0; i < ssize(paths); ++i) {
+      animation_->SetTransform(frame, paths[i], X_ParentPaths[i]);
+    }
+  }
+  if (!recording_ || !time || set_visualizations_while_recording_) {
+    impl().SetTransforms(paths, X_ParentPaths);
+  }
+}
+
 void Meshcat::Delete(std::string_view path) {
   impl().Delete(path);
 }
@@ -550,6 +550,27 @@ class Meshcat {
   void SetTransform(std::string_view path,
                     const Eigen::Ref<const Eigen::Matrix4d>& matrix);
 
+  /** Sets the RigidTransform of each of several paths at once. This is
+  equivalent to calling SetTransform(paths[i], X_ParentPaths[i],
+  time_in_recording) for each i, but is much cheaper for the browsers when
+  there are many paths (e.g., all of the frames of a large scene):
+  - only the transforms that differ from the ones previously set are sent,
+  - they are sent to the browsers as a single message, and
+  - if a browser hasn't yet received the previous messages, the transforms are
+    held back and merged with any newer ones, rather than queued up. Only the
+    most recent transform for each path is eventually sent.
+  @param paths "/"-delimited strings indicating the paths in the scene tree.
+               See @ref meshcat_path "Meshcat paths" for the semantics.
+  @param X_ParentPaths the relative transform from each path to its immediate
+               parent.
+  @param time_in_recording (optional). See SetTransform().
+  @throws std::exception if `paths` and `X_ParentPaths` have different sizes.
+  */
+  void SetTransforms(
+      const std::vector<std::string>& paths,
+      const std::vector<math::RigidTransformd>& X_ParentPaths,
+      const std::optional<double>& time_in_recording = std::nullopt);
+
   /** Deletes the object at the given `path` as well as all of its children.
   See @ref meshcat_path for the detailed semantics of deletion. */
   void Delete(std::string_view path = "");
@@ -1,5 +1,9 @@
 #include "drake/geometry/meshcat_animation.h"
 
+#include <fmt/format.h>
+
+#include "drake/common/ssize.h"
+
 namespace drake {
 namespace geometry {
 
@@ -57,7 +61,33 @@ void MeshcatAnimation::SetProperty(int frame, const std::string& path,
         path, property, tt.js_type, js_type));
   }
   // get<T> will also throw bad_variant_access if the types don't match.
-  std::get<Track<T>>(tt.track)[frame] = value;
+  Track<T>& track = std::get<Track<T>>(tt.track);
+  int width = 1;
+  if constexpr (std::is_same_v<T, std::vector<double>>) {
+    width = ssize(value);
+    if (track.frames.empty()) {
+      track.width = width;
+    } else if (track.width != width) {
+      throw std::runtime_error(fmt::format(
+          "{} property {} already has a track with values of size {} != {}",
+          path, property, track.width, width));
+    }
+  }
+  // Recordings set the frames in increasing order, so this is usually an
+  // append.
+  const auto iter =
+      std::lower_bound(track.frames.begin(), track.frames.end(), frame);
+  const int index = iter - track.frames.begin();
+  if (iter == track.frames.end() || *iter != frame) {
+    track.frames.insert(iter, frame);
+    track.values.insert(track.values.begin() + index * width, width, {});
+  }
+  if constexpr (std::is_same_v<T, std::vector<double>>) {
+    std::copy(value.begin(), value.end(),
+              track.values.begin() + index * width);
+  } else {
+    track.values[index] = value;
+  }
 }
 
 }  // namespace geometry
@@ -1,8 +1,10 @@
 #pragma once
 
+#include <algorithm>
 #include <map>
 #include <optional>
 #include <string>
+#include <type_traits>
 #include <variant>
 #include <vector>
 
@@ -158,7 +160,7 @@ class MeshcatAnimation {
   @param property the string name of the property to set
   @param value the new value.
   @throws std::exception if this path/property has already been set with a
-                         different type.
+                         different type, or with a value of a different size.
 
   @pydrake_mkdoc_identifier{vector_double}
   */
@@ -192,10 +194,17 @@ class MeshcatAnimation {
       return std::nullopt;
     }
     const Track<T>& t = std::get<Track<T>>(tt.track);
-    if (t.find(frame) == t.end()) {
+    const auto iter = std::lower_bound(t.frames.begin(), t.frames.end(), frame);
+    if (iter == t.frames.end() || *iter != frame) {
       return std::nullopt;
     }
-    return t.at(frame);
+    const int index = iter - t.frames.begin();
+    if constexpr (std::is_same_v<T, std::vector<double>>) {
+      return std::vector<double>(t.values.begin() + index * t.width,
+                                 t.values.begin() + (index + 1) * t.width);
+    } else {
+      return t.values[index];
+    }
   }
 
   /** Returns the javascript type for a particular path/property, or the empty
@@ -212,9 +221,19 @@ class MeshcatAnimation {
                    const std::string& property, const std::string& js_type,
                    const T& value);
 
-  // A map of frame => value.
+  // The keyframes of one property, stored column-wise (rather than as, e.g., a
+  // std::map<int, T>) to keep long recordings compact: the sorted frame
+  // numbers, and the values of all keyframes concatenated in the same order.
+  // Each value of a std::vector<double> track has `width` elements, and is
+  // stored as that many consecutive doubles.
   template <typename T>
-  using Track = std::map<int, T>;
+  struct Track {
+    using Element = std::conditional_t<std::is_same_v<T, std::vector<double>>,
+                                       double, T>;
+    std::vector<int> frames;
+    std::vector<Element> values;
+    int width{1};
+  };
 
   // All property values in a track must be the same type.
   struct TypedTrack {
@@ -1,19 +1,37 @@
 #include "drake/geometry/meshcat_point_cloud_visualizer.h"
 
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 
 #include <fmt/format.h>
 
+#include "drake/common/drake_throw.h"
 #include "drake/common/extract_double.h"
 #include "drake/geometry/meshcat_graphviz.h"
 #include "drake/geometry/utilities.h"
-#include "drake/perception/point_cloud.h"
 
 namespace drake {
 namespace geometry {
 
+namespace {
+
+// Returns true iff `a` and `b` would be drawn identically by
+// Meshcat::SetObject().
+bool SameDrawnCloud(const perception::PointCloud& a,
+                    const perception::PointCloud& b) {
+  if (a.size() != b.size() || a.has_rgbs() != b.has_rgbs()) {
+    return false;
+  }
+  if (a.xyzs() != b.xyzs()) {
+    return false;
+  }
+  return !a.has_rgbs() || a.rgbs() == b.rgbs();
+}
+
+}  // namespace
+
 template <typename T>
 MeshcatPointCloudVisualizer<T>::MeshcatPointCloudVisualizer(
     std::shared_ptr<Meshcat> meshcat, std::string path, double publish_period)
@@ -48,19 +66,40 @@ MeshcatPointCloudVisualizer<T>::MeshcatPointCloudVisualizer(
                                   other.publish_period_) {
   set_point_size(other.point_size_);
   set_default_rgba(other.default_rgba_);
+  set_voxel_size(other.voxel_size_);
+}
+
+template <typename T>
+void MeshcatPointCloudVisualizer<T>::set_voxel_size(double voxel_size) {
+  DRAKE_THROW_UNLESS(voxel_size >= 0.0);
+  voxel_size_ = voxel_size;
+  sent_cloud_.reset();
 }
 
 template <typename T>
 void MeshcatPointCloudVisualizer<T>::Delete() const {
   meshcat_->Delete(path_);
+  sent_cloud_.reset();
 }
 
 template <typename T>
 systems::EventStatus MeshcatPointCloudVisualizer<T>::UpdateMeshcat(
     const systems::Context<T>& context) const {
-  const auto& cloud =
+  const auto& input =
       cloud_input_port().template Eval<perception::PointCloud>(context);
-  meshcat_->SetObject(path_, cloud, point_size_, default_rgba_);
+  std::optional<perception::PointCloud> downsampled;
+  if (voxel_size_ > 0.0 && input.size() > 0) {
+    downsampled = input.VoxelizedDownSample(voxel_size_);
+  }
+  const perception::PointCloud& cloud = downsampled ? *downsampled : input;
+  if (!sent_cloud_ || !SameDrawnCloud(cloud, *sent_cloud_)) {
+    meshcat_->SetObject(path_, cloud, point_size_, default_rgba_);
+    if (downsampled) {
+      sent_cloud_ = std::move(*downsampled);
+    } else {
+      sent_cloud_ = input;
+    }
+  }
 
   const math::RigidTransformd X_ParentCloud =
       pose_input_port().HasValue(context)
@@ -2,11 +2,13 @@
 
 #include <map>
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 
 #include "drake/geometry/meshcat.h"
 #include "drake/geometry/rgba.h"
+#include "drake/perception/point_cloud.h"
 #include "drake/systems/framework/leaf_system.h"
 
 namespace drake {
@@ -27,6 +29,12 @@ optional.  The optional input port `X_ParentCloud` sets the MeshcatTransform at
 the path representing the `cloud`.  If it is not connected, then we set
 `X_ParentCloud` to the identity transform.
 
+Large clouds can be decimated before they are sent with set_voxel_size(). A
+cloud that is identical to the one most recently sent is not sent again; only
+its transform is updated. (If the object at `path` is deleted directly via
+Meshcat, call Delete() on this visualizer instead, so that the next publish
+sends the cloud again.)
+
 @tparam_nonsymbolic_scalar
 */
 template <typename T>
@@ -56,11 +64,24 @@ class MeshcatPointCloudVisualizer final : public systems::LeafSystem<T> {
    * units are undocumented in threejs
    * (https://threejs.org/docs/index.html?q=PointsMaterial#api/en/materials/PointsMaterial.size),
    * but we believe they are in meters. */
-  void set_point_size(double point_size) { point_size_ = point_size; }
+  void set_point_size(double point_size) {
+    point_size_ = point_size;
+    sent_cloud_.reset();
+  }
 
   /** Sets the default color, which is applied to all points only if
   `has_rgbs() == false` for the cloud on the input port. */
-  void set_default_rgba(const Rgba& rgba) { default_rgba_ = rgba; }
+  void set_default_rgba(const Rgba& rgba) {
+    default_rgba_ = rgba;
+    sent_cloud_.reset();
+  }
+
+  /** Sets the size of the voxels used to down-sample the cloud (via
+  perception::PointCloud::VoxelizedDownSample()) before it is sent, which
+  bounds the number of points sent for dense clouds. The default of 0 sends
+  every point.
+  @throws std::exception if `voxel_size` is negative. */
+  void set_voxel_size(double voxel_size);
 
   /** Calls Meshcat::Delete(path), where `path` is the value passed in the
    constructor. */
@@ -106,6 +127,12 @@ class MeshcatPointCloudVisualizer final : public systems::LeafSystem<T> {
   /* Visualization parameters. */
   double point_size_{0.001};
   Rgba default_rgba_{.9, .9, .9, 1.0};
+  double voxel_size_{0.0};
+
+  /* The cloud most recently sent to Meshcat, so that an unchanged cloud is
+   not sent again. This is a cache of what Meshcat has (not of anything in the
+   Context), and is therefore a mutable member variable. */
+  mutable std::optional<perception::PointCloud> sent_cloud_;
 
   /* We store the arguments passed in the constructor to support scalar
   conversion. */
@@ -393,6 +393,17 @@ struct SetTransformData {
   MSGPACK_DEFINE_MAP(type, path, matrix);
 };
 
+// Note that this struct is unique to Drake's integration of meshcat; it is not
+// part of upstream meshcat.js. We handle it directly within meshcat.html, by
+// forwarding each transform to meshcat.js as a set_transform command.
+struct SetTransformsData {
+  std::string type{"set_transforms"};
+  std::vector<std::string> paths;
+  // The column-major 4x4 matrices of all paths, concatenated.
+  std::vector<double> matrices;
+  MSGPACK_DEFINE_MAP(type, paths, matrices);
+};
+
 // Note that this struct is unique to Drake's integration of meshcat; it is not
 // part of upstream meshcat.js. We handle it directly within meshcat.html,
 // without ever feeding it into meshcat.js.
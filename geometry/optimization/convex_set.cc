@@ -116,6 +116,15 @@ bool ConvexSet::DoIsEmpty() const {
   }
 }
 
+std::vector<bool> ConvexSet::DoPointsInSet(
+    const Eigen::Ref<const Eigen::MatrixXd>& points, double tol) const {
+  std::vector<bool> in_set(points.cols());
+  for (int i = 0; i < points.cols(); ++i) {
+    in_set[i] = DoPointInSet(points.col(i), tol);
+  }
+  return in_set;
+}
+
 std::optional<Eigen::VectorXd> ConvexSet::DoMaybeGetPoint() const {
   return std::nullopt;
 }
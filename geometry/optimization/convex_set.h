@@ -166,6 +166,21 @@ class ConvexSet : public ShapeReifier {
     return DoPointInSet(x, tol);
   }
 
+  /** Returns, for each column of `points`, whether that point is contained in
+  the set; i.e., the result of PointInSet() on each column. Derived classes
+  such as HPolyhedron and Hyperellipsoid check all of the points at once, with
+  a single matrix product, which is much faster than checking them one at a
+  time.
+  @throws std::exception if points.rows() != ambient_dimension(). */
+  std::vector<bool> PointsInSet(const Eigen::Ref<const Eigen::MatrixXd>& points,
+                                double tol = 0) const {
+    DRAKE_THROW_UNLESS(points.rows() == ambient_dimension());
+    if (ambient_dimension() == 0) {
+      return std::vector<bool>(points.cols(), !IsEmpty());
+    }
+    return DoPointsInSet(points, tol);
+  }
+
   /** Adds a constraint to an existing MathematicalProgram enforcing that the
   point defined by vars is inside the set.
   @return (new_vars, new_constraints) Some of the derived class will add new
@@ -336,6 +351,14 @@ class ConvexSet : public ShapeReifier {
   virtual bool DoPointInSet(const Eigen::Ref<const Eigen::VectorXd>& x,
                             double tol) const = 0;
 
+  /** Non-virtual interface implementation for PointsInSet(). The default
+  implementation calls DoPointInSet() on each column of `points`; derived
+  classes can override with a more efficient implementation.
+  @pre points.rows() == ambient_dimension()
+  @pre ambient_dimension() > 0 */
+  virtual std::vector<bool> DoPointsInSet(
+      const Eigen::Ref<const Eigen::MatrixXd>& points, double tol) const;
+
   /** Non-virtual interface implementation for AddPointInSetConstraints().
   @pre vars.size() == ambient_dimension()
   @pre ambient_dimension() > 0 */
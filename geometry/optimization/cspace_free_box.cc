@@ -158,7 +158,8 @@ void CspaceFreeBox::GeneratePolynomialsToCertify(
 
   internal::GenerateRationals(separating_planes_map, y_slack(), q_star,
                               rational_forward_kin(),
-                              &(certify_polynomials->plane_geometries));
+                              &(certify_polynomials->plane_geometries),
+                              parallelism());
 }
 
 CspaceFreeBox::SeparationCertificateProgram
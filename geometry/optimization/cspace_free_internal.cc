@@ -6,6 +6,7 @@
 #include <unordered_map>
 #include <utility>
 
+#include "drake/common/parallel_for.h"
 #include "drake/multibody/rational/rational_forward_kinematics.h"
 #include "drake/multibody/rational/rational_forward_kinematics_internal.h"
 #include "drake/solvers/choose_best_solver.h"
@@ -197,45 +198,74 @@ void GenerateRationals(
     const Vector3<symbolic::Variable>& y_slack,
     const Eigen::Ref<const Eigen::VectorXd>& q_star,
     const multibody::RationalForwardKinematics& rational_forward_kin,
-    std::vector<PlaneSeparatesGeometries>* plane_geometries) {
+    std::vector<PlaneSeparatesGeometries>* plane_geometries,
+    Parallelism parallelism) {
   // There can be multiple geometries on the same pair, hence the body pose will
-  // be reused. We use this map to store the body pose to avoid redundant
-  // computation.
-  std::unordered_map<
-      BodyPair,
-      multibody::RationalForwardKinematics::Pose<symbolic::Polynomial>,
-      BodyPairHash>
-      body_pair_to_X_AB_multilinear;
+  // be reused. We first collect the distinct pairs of bodies, so that each body
+  // pose is computed only once.
+  std::vector<const CSpaceSeparatingPlane<symbolic::Variable>*> planes;
+  planes.reserve(separating_planes.size());
+  std::vector<BodyPair> body_pairs;
+  std::unordered_map<BodyPair, int, BodyPairHash> body_pair_to_pose_index;
   for (const auto& [plane_index, plane_ptr] : separating_planes) {
     DRAKE_ASSERT(plane_ptr != nullptr);
-    const auto& separating_plane = *plane_ptr;
-    // Compute X_AB for both side of the geometries.
-    std::vector<symbolic::RationalFunction> positive_side_rationals;
-    std::vector<symbolic::RationalFunction> negative_side_rationals;
+    planes.push_back(plane_ptr);
+    for (const PlaneSide plane_side :
+         {PlaneSide::kPositive, PlaneSide::kNegative}) {
+      const BodyPair expressed_to_link(
+          plane_ptr->expressed_body,
+          plane_ptr->geometry(plane_side)->body_index());
+      if (body_pair_to_pose_index
+              .emplace(expressed_to_link, static_cast<int>(body_pairs.size()))
+              .second) {
+        body_pairs.push_back(expressed_to_link);
+      }
+    }
+  }
+
+  // Computing the body poses and the rationals only reads the kinematics and
+  // the planes, so we compute them for each pair of bodies (and then for each
+  // plane) in parallel. Any exception is rethrown on the calling thread.
+  const int num_body_pairs = body_pairs.size();
+  std::vector<multibody::RationalForwardKinematics::Pose<symbolic::Polynomial>>
+      X_AB_multilinear(num_body_pairs);
+  drake::internal::ParallelFor(parallelism, num_body_pairs, [&](int i) {
+    X_AB_multilinear[i] =
+        rational_forward_kin.CalcBodyPoseAsMultilinearPolynomial(
+            q_star, body_pairs[i].body2, body_pairs[i].body1);
+  });
+
+  const int num_planes = planes.size();
+  std::vector<std::vector<symbolic::RationalFunction>> all_positive_rationals(
+      num_planes);
+  std::vector<std::vector<symbolic::RationalFunction>> all_negative_rationals(
+      num_planes);
+  drake::internal::ParallelFor(parallelism, num_planes, [&](int k) {
+    const auto& separating_plane = *planes[k];
     for (const PlaneSide plane_side :
          {PlaneSide::kPositive, PlaneSide::kNegative}) {
       const CIrisCollisionGeometry* link_geometry =
           separating_plane.geometry(plane_side);
-
-      const BodyPair expressed_to_link(separating_plane.expressed_body,
-                                       link_geometry->body_index());
-      auto it = body_pair_to_X_AB_multilinear.find(expressed_to_link);
-      if (it == body_pair_to_X_AB_multilinear.end()) {
-        std::tie(it, std::ignore) = body_pair_to_X_AB_multilinear.emplace(
-            expressed_to_link,
-            rational_forward_kin.CalcBodyPoseAsMultilinearPolynomial(
-                q_star, link_geometry->body_index(),
-                separating_plane.expressed_body));
-      }
-      const multibody::RationalForwardKinematics::Pose<symbolic::Polynomial>&
-          X_AB_multilinear = it->second;
+      const int pose_index = body_pair_to_pose_index.at(BodyPair(
+          separating_plane.expressed_body, link_geometry->body_index()));
       auto& rationals = plane_side == PlaneSide::kPositive
-                            ? positive_side_rationals
-                            : negative_side_rationals;
+                            ? all_positive_rationals[k]
+                            : all_negative_rationals[k];
       link_geometry->OnPlaneSide(separating_plane.a, separating_plane.b,
-                                 X_AB_multilinear, rational_forward_kin,
-                                 plane_side, y_slack, &rationals);
+                                 X_AB_multilinear[pose_index],
+                                 rational_forward_kin, plane_side, y_slack,
+                                 &rationals);
     }
+  });
+
+  int k = 0;
+  for (const auto& [plane_index, plane_ptr] : separating_planes) {
+    const auto& separating_plane = *plane_ptr;
+    std::vector<symbolic::RationalFunction> positive_side_rationals =
+        std::move(all_positive_rationals[k]);
+    std::vector<symbolic::RationalFunction> negative_side_rationals =
+        std::move(all_negative_rationals[k]);
+    ++k;
     // For a non-polytopic geometry (sphere, capsule, etc) to be on the positive
     // side of the plane, we require that aᵀ*p_AS + b ≥ r|a|. To avoid a trivial
     // solution (a = b = 0), we also include the constraint that aᵀ*p_AS + b ≥ 1
@@ -306,14 +336,15 @@ void GenerateRationals(
     const Vector3<symbolic::Variable>& y_slack,
     const Eigen::Ref<const Eigen::VectorXd>& q_star,
     const multibody::RationalForwardKinematics& rational_forward_kin,
-    std::vector<PlaneSeparatesGeometries>* plane_geometries) {
+    std::vector<PlaneSeparatesGeometries>* plane_geometries,
+    Parallelism parallelism) {
   std::map<int, const CSpaceSeparatingPlane<symbolic::Variable>*>
       separating_planes_map;
   for (int i = 0; i < static_cast<int>(separating_planes.size()); ++i) {
     separating_planes_map.emplace(i, separating_planes.at(i).get());
   }
   GenerateRationals(separating_planes_map, y_slack, q_star,
-                    rational_forward_kin, plane_geometries);
+                    rational_forward_kin, plane_geometries, parallelism);
 }
 
 void SolveSeparationCertificateProgramBase(
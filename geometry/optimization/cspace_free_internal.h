@@ -7,6 +7,7 @@
 #include <utility>
 #include <vector>
 
+#include "drake/common/parallelism.h"
 #include "drake/geometry/optimization/c_iris_collision_geometry.h"
 #include "drake/geometry/optimization/cspace_free_structs.h"
 #include "drake/geometry/optimization/cspace_separating_plane.h"
@@ -34,6 +35,8 @@ namespace internal {
  taken. See rational_forward_kinematics.h/cc for details.
  @param[in] plane_geometries A non-null pointer to an empty vector.
  @param[out] plane_geometries Contains the separation information.
+ @param[in] parallelism The parallelism used to compute the body poses and the
+ rationals of the planes. The result does not depend on it.
  */
 void GenerateRationals(
     const std::vector<std::unique_ptr<
@@ -41,7 +44,8 @@ void GenerateRationals(
     const Vector3<symbolic::Variable>& y_slack,
     const Eigen::Ref<const Eigen::VectorXd>& q_star,
     const multibody::RationalForwardKinematics& rational_forward_kin,
-    std::vector<PlaneSeparatesGeometries>* plane_geometries);
+    std::vector<PlaneSeparatesGeometries>* plane_geometries,
+    Parallelism parallelism = Parallelism::None());
 
 /*
  Overloads GenerateRationals.
@@ -53,7 +57,8 @@ void GenerateRationals(
     const Vector3<symbolic::Variable>& y_slack,
     const Eigen::Ref<const Eigen::VectorXd>& q_star,
     const multibody::RationalForwardKinematics& rational_forward_kin,
-    std::vector<PlaneSeparatesGeometries>* plane_geometries);
+    std::vector<PlaneSeparatesGeometries>* plane_geometries,
+    Parallelism parallelism = Parallelism::None());
 
 /*
  Returns the number of y_slack variables in `rational`.
@@ -7,6 +7,7 @@
 #include <string>
 #include <thread>
 
+#include "drake/common/parallel_for.h"
 #include "drake/geometry/optimization/cspace_free_internal.h"
 #include "drake/multibody/rational/rational_forward_kinematics.h"
 #include "drake/multibody/rational/rational_forward_kinematics_internal.h"
@@ -44,7 +45,8 @@ CspaceFreePolytope::CspaceFreePolytope(
   }
 
   internal::GenerateRationals(separating_planes_ptrs, y_slack(), q_star_,
-                              rational_forward_kin(), &plane_geometries_);
+                              rational_forward_kin(), &plane_geometries_,
+                              parallelism());
 }
 
 CspaceFreePolytope::SeparatingPlaneLagrangians
@@ -385,6 +387,51 @@ CspaceFreePolytope::InitializePolytopeSearchProgram(
     plane_to_certificate_map.emplace(certificates_vec[i]->plane_index, i);
   }
   const int s_size = rational_forward_kin().s().rows();
+
+  // The products of the polytope Lagrangians with d - C*s are the most
+  // expensive polynomials to compute, and they don't depend on the program.
+  // For all the rationals, compute in parallel
+  // rationals[i].numerator() - lagrangians_vec[i].polytope()ᵀ * (d - C*s),
+  // in the order in which they are consumed below.
+  std::vector<std::pair<int, PlaneSide>> plane_sides;
+  std::vector<int> plane_side_offsets{0};
+  for (int plane_index = 0;
+       plane_index < static_cast<int>(separating_planes().size());
+       ++plane_index) {
+    if (ignored_collision_pairs.count(
+            separating_planes()[plane_index].geometry_pair()) == 0) {
+      const auto& certificate =
+          certificates_vec[plane_to_certificate_map.at(plane_index)];
+      DRAKE_THROW_UNLESS(certificate.has_value());
+      for (PlaneSide plane_side :
+           {PlaneSide::kPositive, PlaneSide::kNegative}) {
+        DRAKE_THROW_UNLESS(
+            plane_geometries_[plane_index].rationals(plane_side).size() ==
+            certificate->lagrangians(plane_side).size());
+        plane_sides.emplace_back(plane_index, plane_side);
+        plane_side_offsets.push_back(
+            plane_side_offsets.back() +
+            ssize(plane_geometries_[plane_index].rationals(plane_side)));
+      }
+    }
+  }
+  std::vector<symbolic::Polynomial> numerator_minus_polytope_terms(
+      plane_side_offsets.back());
+  drake::internal::ParallelFor(parallelism(), ssize(plane_sides), [&](int k) {
+    const auto [plane_index, plane_side] = plane_sides[k];
+    const auto& rationals =
+        plane_geometries_[plane_index].rationals(plane_side);
+    const auto& lagrangians_vec =
+        certificates_vec[plane_to_certificate_map.at(plane_index)]
+            ->lagrangians(plane_side);
+    for (int i = 0; i < ssize(rationals); ++i) {
+      numerator_minus_polytope_terms[plane_side_offsets[k] + i] =
+          rationals[i].numerator() -
+          lagrangians_vec[i].polytope().dot(d_minus_Cs);
+    }
+  });
+  int poly_count = 0;
+
   int gram_var_count = 0;
   for (int plane_index = 0;
        plane_index < static_cast<int>(separating_planes().size());
@@ -460,8 +507,7 @@ CspaceFreePolytope::InitializePolytopeSearchProgram(
           }
 
           const symbolic::Polynomial poly =
-              rationals[i].numerator() -
-              lagrangians_vec[i].polytope().dot(d_minus_Cs) -
+              numerator_minus_polytope_terms[poly_count++] -
               s_lower_lagrangians.dot(this->s_minus_s_lower_) -
               s_upper_lagrangians.dot(this->s_upper_minus_s_);
           symbolic::Polynomial poly_sos;
@@ -476,6 +522,7 @@ CspaceFreePolytope::InitializePolytopeSearchProgram(
     }
   }
   DRAKE_DEMAND(gram_var_count == gram_total_size);
+  DRAKE_DEMAND(poly_count == ssize(numerator_minus_polytope_terms));
   return prog;
 }
 
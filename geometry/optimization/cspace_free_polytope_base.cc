@@ -97,7 +97,8 @@ CspaceFreePolytopeBase::CspaceFreePolytopeBase(
       link_geometries_{internal::GetCollisionGeometries(*plant, *scene_graph)},
       plane_order_{plane_order},
       s_set_{rational_forward_kin_.s()},
-      with_cross_y_{options.with_cross_y} {
+      with_cross_y_{options.with_cross_y},
+      parallelism_{options.parallelism} {
   DRAKE_DEMAND(scene_graph_ != nullptr);
   // Create separating planes.
   // collision_pairs maps each pair of body to the pair of collision geometries
@@ -12,6 +12,7 @@
 #include <vector>
 
 #include "drake/common/name_value.h"
+#include "drake/common/parallelism.h"
 #include "drake/geometry/optimization/c_iris_collision_geometry.h"
 #include "drake/geometry/optimization/cspace_free_structs.h"
 #include "drake/geometry/optimization/cspace_separating_plane.h"
@@ -87,6 +88,15 @@ class CspaceFreePolytopeBase {
      possibly able to certify a larger C-space polytope.
      */
     bool with_cross_y{false};
+
+    /**
+     The parallelism used to construct the polynomials to certify, namely the
+     rationals of the separating planes (on construction) and the polynomials
+     of the polytope search programs. Computing these polynomials often
+     dominates the time spent before any solver is called. The results do
+     not depend on the parallelism.
+     */
+    Parallelism parallelism{Parallelism::None()};
   };
 
   /** Getter for the rational forward kinematics object that computes the
@@ -186,6 +196,9 @@ class CspaceFreePolytopeBase {
   /** Check Options::with_cross_y for more details. */
   [[nodiscard]] bool with_cross_y() const { return with_cross_y_; }
 
+  /** Check Options::parallelism for more details. */
+  [[nodiscard]] Parallelism parallelism() const { return parallelism_; }
+
   /** For a pair of bodies body_pair, returns the indices of all s on the
    kinematics chain from body_pair.first() to body_pair.second().
    For each pair of collidable collision geometry (A, B), we denote their body
@@ -297,6 +310,9 @@ class CspaceFreePolytopeBase {
   // See Options::with_cross_y for its meaning.
   bool with_cross_y_;
 
+  // See Options::parallelism for its meaning.
+  Parallelism parallelism_;
+
   // For a pair of bodies body_pair, returns the indices of all s on the
   // kinematics chain from body_pair.first() to body_pair.second().
   // For each pair of collidable collision geometry (A, B), we denote their body
@@ -4,20 +4,28 @@
 
 #include "drake/geometry/optimization/graph_of_convex_sets.h"
 
+#include <algorithm>
+#include <cstdint>
+#include <exception>
 #include <limits>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <typeinfo>
 #include <unordered_set>
 #include <utility>
 #include <vector>
 
 #include <fmt/format.h>
 
+#include "drake/common/parallel_for.h"
 #include "drake/math/quadratic_form.h"
 #include "drake/solvers/choose_best_solver.h"
 #include "drake/solvers/create_constraint.h"
 #include "drake/solvers/create_cost.h"
+#include "drake/solvers/csdp_solver.h"
 #include "drake/solvers/get_program_type.h"
+#include "drake/solvers/ipopt_solver.h"
 #include "drake/solvers/mosek_solver.h"
 
 namespace drake {
@@ -44,6 +52,7 @@ using solvers::LinearConstraint;
 using solvers::LinearCost;
 using solvers::LinearEqualityConstraint;
 using solvers::LInfNormCost;
+using solvers::LorentzConeConstraint;
 using solvers::MathematicalProgram;
 using solvers::MathematicalProgramResult;
 using solvers::MatrixXDecisionVariable;
@@ -60,11 +69,28 @@ using symbolic::Variable;
 using symbolic::Variables;
 
 namespace {
-MathematicalProgramResult Solve(const MathematicalProgram& prog,
-                                const GraphOfConvexSetsOptions& options) {
+// Returns true iff the solver can't solve programs on multiple threads at
+// the same time.
+bool IsSolverThreadUnsafe(const solvers::SolverId& solver_id) {
+  return solver_id == solvers::IpoptSolver::id() ||
+         solver_id == solvers::CsdpSolver::id();
+}
+
+// Solves `prog`, starting from `initial_guess` (if any). If `solver_mutex` is
+// not null, it is held while solving with a solver that is not thread safe.
+MathematicalProgramResult Solve(
+    const MathematicalProgram& prog, const GraphOfConvexSetsOptions& options,
+    const std::optional<VectorXd>& initial_guess = std::nullopt,
+    std::mutex* solver_mutex = nullptr) {
   MathematicalProgramResult result;
+  std::unique_lock<std::mutex> lock;
   if (options.solver) {
-    options.solver->Solve(prog, {}, options.solver_options, &result);
+    if (solver_mutex != nullptr &&
+        IsSolverThreadUnsafe(options.solver->solver_id())) {
+      lock = std::unique_lock<std::mutex>(*solver_mutex);
+    }
+    options.solver->Solve(prog, initial_guess, options.solver_options,
+                          &result);
   } else {
     std::unique_ptr<solvers::SolverInterface> solver{};
     try {
@@ -92,7 +118,10 @@ MathematicalProgramResult Solve(const MathematicalProgram& prog,
           "GraphOfConvexSetsOptions for more details.");
     }
     DRAKE_DEMAND(solver != nullptr);
-    solver->Solve(prog, {}, options.solver_options, &result);
+    if (solver_mutex != nullptr && IsSolverThreadUnsafe(solver->solver_id())) {
+      lock = std::unique_lock<std::mutex>(*solver_mutex);
+    }
+    solver->Solve(prog, initial_guess, options.solver_options, &result);
   }
   return result;
 }
@@ -109,8 +138,116 @@ struct EdgeIdComparator {
   }
 };
 
+// Returns the coefficients of a cost or constraint supported by
+// AddPerspectiveCost() or AddPerspectiveConstraint(), which determine its
+// perspective.
+VectorXd GetPerspectiveCoefficients(const solvers::EvaluatorBase& evaluator) {
+  auto stack = [](const MatrixXd& A, const VectorXd& b) {
+    VectorXd coefficients(A.size() + b.size());
+    coefficients << A.reshaped(), b;
+    return coefficients;
+  };
+  if (const auto* lc = dynamic_cast<const LinearCost*>(&evaluator)) {
+    return stack(lc->a(), Vector1d(lc->b()));
+  } else if (const auto* qc = dynamic_cast<const QuadraticCost*>(&evaluator)) {
+    return stack(qc->Q(), stack(qc->b(), Vector1d(qc->c())));
+  } else if (const auto* l1c = dynamic_cast<const L1NormCost*>(&evaluator)) {
+    return stack(l1c->A(), l1c->b());
+  } else if (const auto* l2c = dynamic_cast<const L2NormCost*>(&evaluator)) {
+    return stack(l2c->A(), l2c->b());
+  } else if (const auto* linfc =
+                 dynamic_cast<const LInfNormCost*>(&evaluator)) {
+    return stack(linfc->A(), linfc->b());
+  } else if (const auto* pqc =
+                 dynamic_cast<const PerspectiveQuadraticCost*>(&evaluator)) {
+    return stack(pqc->A(), pqc->b());
+  } else if (const auto* lin_c =
+                 dynamic_cast<const LinearConstraint*>(&evaluator)) {
+    return stack(lin_c->GetDenseA(),
+                 stack(lin_c->lower_bound(), lin_c->upper_bound()));
+  }
+  // AddPerspectiveCost() and AddPerspectiveConstraint() reject anything else.
+  DRAKE_UNREACHABLE();
+}
+
+// Copies the coefficients of each of the `sources` into the evaluator of the
+// corresponding `targets`. Returns false if they differ in number, type, or
+// number of variables, in which case `targets` may be partially updated.
+bool CopyCoefficients(const std::vector<Binding<Constraint>>& sources,
+                      const std::vector<Binding<Constraint>>& targets) {
+  if (sources.size() != targets.size()) {
+    return false;
+  }
+  for (int i = 0; i < ssize(sources); ++i) {
+    const Constraint* source = sources[i].evaluator().get();
+    Constraint* target = targets[i].evaluator().get();
+    if (typeid(*source) != typeid(*target) ||
+        source->num_vars() != target->num_vars()) {
+      return false;
+    }
+    if (auto* lec = dynamic_cast<LinearEqualityConstraint*>(target)) {
+      const auto* source_lec =
+          static_cast<const LinearEqualityConstraint*>(source);
+      lec->UpdateCoefficients(source_lec->get_sparse_A(),
+                              source_lec->lower_bound());
+    } else if (auto* lc = dynamic_cast<LinearConstraint*>(target)) {
+      const auto* source_lc = static_cast<const LinearConstraint*>(source);
+      lc->UpdateCoefficients(source_lc->get_sparse_A(),
+                             source_lc->lower_bound(),
+                             source_lc->upper_bound());
+    } else if (auto* lcc = dynamic_cast<LorentzConeConstraint*>(target)) {
+      const auto* source_lcc =
+          static_cast<const LorentzConeConstraint*>(source);
+      lcc->UpdateCoefficients(source_lcc->A_dense(), source_lcc->b());
+    } else if (auto* rlcc =
+                   dynamic_cast<RotatedLorentzConeConstraint*>(target)) {
+      const auto* source_rlcc =
+          static_cast<const RotatedLorentzConeConstraint*>(source);
+      rlcc->UpdateCoefficients(source_rlcc->A_dense(), source_rlcc->b());
+    } else {
+      return false;
+    }
+  }
+  return true;
+}
+
 }  // namespace
 
+struct GraphOfConvexSets::ShortestPathProgram {
+  // The problem that `prog` formulates.
+  VertexId source_id;
+  VertexId target_id;
+  bool convex_relaxation{};
+  bool preprocessing{};
+  std::vector<int64_t> structure;
+  std::set<EdgeId> unusable_edges;
+
+  MathematicalProgram prog;
+  std::map<VertexId, std::vector<Edge*>> incoming_edges;
+  std::map<VertexId, std::vector<Edge*>> outgoing_edges;
+  std::map<VertexId, MatrixXDecisionVariable> vertex_edge_ell;
+  std::vector<Edge*> excluded_edges;
+  std::map<EdgeId, Variable> relaxed_phi;
+  std::vector<Variable> excluded_phi;
+  bool has_edges_out_of_source{false};
+  bool has_edges_into_target{false};
+
+  // The perspective of one of the costs or constraints in the graph; exactly
+  // one of `cost` and `constraint` is set. `coefficients` are the coefficients
+  // of the cost or constraint when `bindings` were last written.
+  struct Perspective {
+    std::optional<Binding<Cost>> cost;
+    std::optional<Binding<Constraint>> constraint;
+    VectorXDecisionVariable vars;
+    VectorXd coefficients;
+    std::vector<Binding<Constraint>> bindings;
+  };
+  // Only populated when the program is kept for reuse.
+  std::vector<Perspective> perspectives;
+};
+
+GraphOfConvexSets::GraphOfConvexSets() = default;
+
 GraphOfConvexSets::~GraphOfConvexSets() = default;
 
 Vertex::Vertex(VertexId id, const ConvexSet& set, std::string name)
@@ -410,6 +547,7 @@ std::set<EdgeId> GraphOfConvexSets::PreprocessShortestPath(
   std::map<VertexId, std::vector<int>> incoming_edges;
   std::map<VertexId, std::vector<int>> outgoing_edges;
   std::set<EdgeId> unusable_edges;
+  std::vector<const Edge*> edges_by_index;
 
   int edge_count = 0;
   for (const auto& [edge_id, e] : edges_) {
@@ -420,146 +558,230 @@ std::set<EdgeId> GraphOfConvexSets::PreprocessShortestPath(
       outgoing_edges[e->u().id()].push_back(edge_count);
       incoming_edges[e->v().id()].push_back(edge_count);
     }
+    edges_by_index.push_back(e.get());
 
     edge_count++;
   }
-
-  int nE = edges_.size();
-
-  // Given an edge (u,v) check if a path from source to u and another from v to
-  // target exist without sharing edges.
-  MathematicalProgram prog;
-
-  // Flow for each edge is between 0 and 1 for both paths.
-  VectorXDecisionVariable f = prog.NewContinuousVariables(nE, "flow_su");
-  Binding<solvers::BoundingBoxConstraint> f_limits =
-      prog.AddBoundingBoxConstraint(0, 1, f);
-  VectorXDecisionVariable g = prog.NewContinuousVariables(nE, "flow_vt");
-  Binding<solvers::BoundingBoxConstraint> g_limits =
-      prog.AddBoundingBoxConstraint(0, 1, g);
-
-  std::map<VertexId, Binding<LinearEqualityConstraint>> conservation_f;
-  std::map<VertexId, Binding<LinearEqualityConstraint>> conservation_g;
-  std::map<VertexId, Binding<LinearConstraint>> degree;
+  // Make sure every vertex has entries, so that the (concurrent) checks below
+  // only read these maps.
   for (const auto& [vertex_id, v] : vertices_) {
-    std::vector<int> Ev_in = incoming_edges[vertex_id];
-    std::vector<int> Ev_out = outgoing_edges[vertex_id];
-    std::vector<int> Ev = Ev_in;
-    Ev.insert(Ev.end(), Ev_out.begin(), Ev_out.end());
-
-    if (Ev.size() > 0) {
-      RowVectorXd A_flow(Ev.size());
-      A_flow << RowVectorXd::Ones(Ev_in.size()),
-          -1 * RowVectorXd::Ones(Ev_out.size());
-      VectorXDecisionVariable fv(Ev.size());
-      VectorXDecisionVariable gv(Ev.size());
-      for (size_t ii = 0; ii < Ev.size(); ++ii) {
-        fv(ii) = f(Ev[ii]);
-        gv(ii) = g(Ev[ii]);
-      }
+    incoming_edges[vertex_id];
+    outgoing_edges[vertex_id];
+  }
 
-      // Conservation of flow for f: ∑ f_in - ∑ f_out = -δ(is_source).
-      if (vertex_id == source_id) {
-        conservation_f.insert(
-            {vertex_id, prog.AddLinearEqualityConstraint(A_flow, -1, fv)});
-      } else {
-        conservation_f.insert(
-            {vertex_id, prog.AddLinearEqualityConstraint(A_flow, 0, fv)});
-      }
+  int nE = edges_.size();
 
-      // Conservation of flow for g: ∑ g_in - ∑ g_out = δ(is_target).
-      if (vertex_id == target_id) {
-        conservation_g.insert(
-            {vertex_id, prog.AddLinearEqualityConstraint(A_flow, 1, gv)});
-      } else {
-        conservation_g.insert(
-            {vertex_id, prog.AddLinearEqualityConstraint(A_flow, 0, gv)});
+  // An edge (u,v) can only be on a path if u is reachable from the source and
+  // the target is reachable from v. Checking this combinatorially first spares
+  // the LPs for edges that fail it (which the LPs would reject as well).
+  const auto find_reachable = [&](VertexId start, bool forward) {
+    std::set<VertexId> reached{start};
+    std::vector<VertexId> frontier{start};
+    const auto& adjacent = forward ? outgoing_edges : incoming_edges;
+    while (!frontier.empty()) {
+      const VertexId w = frontier.back();
+      frontier.pop_back();
+      const auto iter = adjacent.find(w);
+      if (iter == adjacent.end()) {
+        continue;
       }
-    }
-
-    // Degree constraints (redundant if indegree of w is 0):
-    // 0 <= ∑ f_in + ∑ g_in <= 1
-    if (Ev_in.size() > 0) {
-      RowVectorXd A_degree = RowVectorXd::Ones(2 * Ev_in.size());
-      VectorXDecisionVariable fgin(2 * Ev_in.size());
-      for (size_t ii = 0; ii < Ev_in.size(); ++ii) {
-        fgin(ii) = f(Ev_in[ii]);
-        fgin(Ev_in.size() + ii) = g(Ev_in[ii]);
+      for (const int index : iter->second) {
+        const Edge* e = edges_by_index[index];
+        const VertexId next = forward ? e->v().id() : e->u().id();
+        if (reached.insert(next).second) {
+          frontier.push_back(next);
+        }
       }
-      degree.insert(
-          {vertex_id, prog.AddLinearConstraint(A_degree, 0, 1, fgin)});
     }
-  }
-
+    return reached;
+  };
+  const std::set<VertexId> from_source = find_reachable(source_id, true);
+  const std::set<VertexId> to_target = find_reachable(target_id, false);
+  std::vector<const Edge*> candidates;
   for (const auto& [edge_id, e] : edges_) {
     if (unusable_edges.count(edge_id)) {
       continue;
     }
-
-    // Update bounds of conservation of flow:
-    // ∑ f_in,u - ∑ f_out,u = 1 - δ(is_source).
-    if (e->u().id() == source_id) {
-      f_limits.evaluator()->set_bounds(VectorXd::Zero(nE), VectorXd::Zero(nE));
-      conservation_f.at(e->u().id())
-          .evaluator()
-          ->set_bounds(Vector1d(0), Vector1d(0));
-    } else {
-      conservation_f.at(e->u().id())
-          .evaluator()
-          ->set_bounds(Vector1d(1), Vector1d(1));
-    }
-    // ∑ g_in,v - ∑ f_out,v = δ(is_target) - 1.
-    if (e->v().id() == target_id) {
-      g_limits.evaluator()->set_bounds(VectorXd::Zero(nE), VectorXd::Zero(nE));
-      conservation_g.at(e->v().id())
-          .evaluator()
-          ->set_bounds(Vector1d(0), Vector1d(0));
+    if (from_source.count(e->u().id()) == 0 ||
+        to_target.count(e->v().id()) == 0) {
+      unusable_edges.insert(edge_id);
     } else {
-      conservation_g.at(e->v().id())
-          .evaluator()
-          ->set_bounds(Vector1d(-1), Vector1d(-1));
+      candidates.push_back(e.get());
     }
+  }
+  if (candidates.empty()) {
+    return unusable_edges;
+  }
 
-    // Update bounds of degree constraints:
-    // ∑ f_in,v + ∑ g_in,v = 0.
-    degree.at(e->v().id()).evaluator()->set_bounds(Vector1d(0), Vector1d(0));
+  // Checks whether each of the given edges could be on a path from source to
+  // target, by solving one LP per edge. Each call builds its own program, so
+  // that disjoint sets of edges can be checked concurrently.
+  const auto check_edges = [&](const std::vector<const Edge*>& edges,
+                               std::vector<uint8_t>* usable,
+                               std::mutex* solver_mutex) {
+    // Given an edge (u,v) check if a path from source to u and another from v
+    // to target exist without sharing edges.
+    MathematicalProgram prog;
+
+    // Flow for each edge is between 0 and 1 for both paths.
+    VectorXDecisionVariable f = prog.NewContinuousVariables(nE, "flow_su");
+    Binding<solvers::BoundingBoxConstraint> f_limits =
+        prog.AddBoundingBoxConstraint(0, 1, f);
+    VectorXDecisionVariable g = prog.NewContinuousVariables(nE, "flow_vt");
+    Binding<solvers::BoundingBoxConstraint> g_limits =
+        prog.AddBoundingBoxConstraint(0, 1, g);
+
+    std::map<VertexId, Binding<LinearEqualityConstraint>> conservation_f;
+    std::map<VertexId, Binding<LinearEqualityConstraint>> conservation_g;
+    std::map<VertexId, Binding<LinearConstraint>> degree;
+    for (const auto& [vertex_id, v] : vertices_) {
+      const std::vector<int>& Ev_in = incoming_edges.at(vertex_id);
+      const std::vector<int>& Ev_out = outgoing_edges.at(vertex_id);
+      std::vector<int> Ev = Ev_in;
+      Ev.insert(Ev.end(), Ev_out.begin(), Ev_out.end());
+
+      if (Ev.size() > 0) {
+        RowVectorXd A_flow(Ev.size());
+        A_flow << RowVectorXd::Ones(Ev_in.size()),
+            -1 * RowVectorXd::Ones(Ev_out.size());
+        VectorXDecisionVariable fv(Ev.size());
+        VectorXDecisionVariable gv(Ev.size());
+        for (size_t ii = 0; ii < Ev.size(); ++ii) {
+          fv(ii) = f(Ev[ii]);
+          gv(ii) = g(Ev[ii]);
+        }
 
-    // Check if edge e = (u,v) could be on a path from start to goal.
-    auto result = Solve(prog, options);
-    if (!result.is_success()) {
-      unusable_edges.insert(edge_id);
+        // Conservation of flow for f: ∑ f_in - ∑ f_out = -δ(is_source).
+        if (vertex_id == source_id) {
+          conservation_f.insert(
+              {vertex_id, prog.AddLinearEqualityConstraint(A_flow, -1, fv)});
+        } else {
+          conservation_f.insert(
+              {vertex_id, prog.AddLinearEqualityConstraint(A_flow, 0, fv)});
+        }
+
+        // Conservation of flow for g: ∑ g_in - ∑ g_out = δ(is_target).
+        if (vertex_id == target_id) {
+          conservation_g.insert(
+              {vertex_id, prog.AddLinearEqualityConstraint(A_flow, 1, gv)});
+        } else {
+          conservation_g.insert(
+              {vertex_id, prog.AddLinearEqualityConstraint(A_flow, 0, gv)});
+        }
+      }
+
+      // Degree constraints (redundant if indegree of w is 0):
+      // 0 <= ∑ f_in + ∑ g_in <= 1
+      if (Ev_in.size() > 0) {
+        RowVectorXd A_degree = RowVectorXd::Ones(2 * Ev_in.size());
+        VectorXDecisionVariable fgin(2 * Ev_in.size());
+        for (size_t ii = 0; ii < Ev_in.size(); ++ii) {
+          fgin(ii) = f(Ev_in[ii]);
+          fgin(Ev_in.size() + ii) = g(Ev_in[ii]);
+        }
+        degree.insert(
+            {vertex_id, prog.AddLinearConstraint(A_degree, 0, 1, fgin)});
+      }
     }
 
-    // Reset constraint bounds.
-    if (e->u().id() == source_id) {
-      f_limits.evaluator()->set_bounds(VectorXd::Zero(nE), VectorXd::Ones(nE));
-      conservation_f.at(e->u().id())
-          .evaluator()
-          ->set_bounds(Vector1d(-1), Vector1d(-1));
-    } else {
-      conservation_f.at(e->u().id())
+    for (int k = 0; k < ssize(edges); ++k) {
+      const Edge* e = edges[k];
+
+      // Update bounds of conservation of flow:
+      // ∑ f_in,u - ∑ f_out,u = 1 - δ(is_source).
+      if (e->u().id() == source_id) {
+        f_limits.evaluator()->set_bounds(VectorXd::Zero(nE),
+                                         VectorXd::Zero(nE));
+        conservation_f.at(e->u().id())
+            .evaluator()
+            ->set_bounds(Vector1d(0), Vector1d(0));
+      } else {
+        conservation_f.at(e->u().id())
+            .evaluator()
+            ->set_bounds(Vector1d(1), Vector1d(1));
+      }
+      // ∑ g_in,v - ∑ f_out,v = δ(is_target) - 1.
+      if (e->v().id() == target_id) {
+        g_limits.evaluator()->set_bounds(VectorXd::Zero(nE),
+                                         VectorXd::Zero(nE));
+        conservation_g.at(e->v().id())
+            .evaluator()
+            ->set_bounds(Vector1d(0), Vector1d(0));
+      } else {
+        conservation_g.at(e->v().id())
+            .evaluator()
+            ->set_bounds(Vector1d(-1), Vector1d(-1));
+      }
+
+      // Update bounds of degree constraints:
+      // ∑ f_in,v + ∑ g_in,v = 0.
+      degree.at(e->v().id())
           .evaluator()
           ->set_bounds(Vector1d(0), Vector1d(0));
-    }
-    if (e->v().id() == target_id) {
-      g_limits.evaluator()->set_bounds(VectorXd::Zero(nE), VectorXd::Ones(nE));
-      conservation_g.at(e->v().id())
-          .evaluator()
-          ->set_bounds(Vector1d(1), Vector1d(1));
-    } else {
-      conservation_g.at(e->v().id())
+
+      // Check if edge e = (u,v) could be on a path from start to goal.
+      auto result = Solve(prog, options, std::nullopt, solver_mutex);
+      (*usable)[k] = result.is_success();
+
+      // Reset constraint bounds.
+      if (e->u().id() == source_id) {
+        f_limits.evaluator()->set_bounds(VectorXd::Zero(nE),
+                                         VectorXd::Ones(nE));
+        conservation_f.at(e->u().id())
+            .evaluator()
+            ->set_bounds(Vector1d(-1), Vector1d(-1));
+      } else {
+        conservation_f.at(e->u().id())
+            .evaluator()
+            ->set_bounds(Vector1d(0), Vector1d(0));
+      }
+      if (e->v().id() == target_id) {
+        g_limits.evaluator()->set_bounds(VectorXd::Zero(nE),
+                                         VectorXd::Ones(nE));
+        conservation_g.at(e->v().id())
+            .evaluator()
+            ->set_bounds(Vector1d(1), Vector1d(1));
+      } else {
+        conservation_g.at(e->v().id())
+            .evaluator()
+            ->set_bounds(Vector1d(0), Vector1d(0));
+      }
+      degree.at(e->v().id())
           .evaluator()
-          ->set_bounds(Vector1d(0), Vector1d(0));
+          ->set_bounds(Vector1d(0), Vector1d(1));
+    }
+  };
+
+  // Split the candidates into contiguous chunks, one per thread.
+  const int num_candidates = ssize(candidates);
+  const int num_chunks = std::max(
+      1, std::min(options.parallelism.num_threads(), num_candidates));
+  std::vector<std::vector<const Edge*>> chunk_edges(num_chunks);
+  for (int k = 0; k < num_candidates; ++k) {
+    chunk_edges[static_cast<int64_t>(k) * num_chunks / num_candidates]
+        .push_back(candidates[k]);
+  }
+  std::vector<std::vector<uint8_t>> chunk_usable(num_chunks);
+  std::mutex solver_mutex;
+  drake::internal::ParallelFor(Parallelism(num_chunks), num_chunks, [&](int c) {
+    chunk_usable[c].resize(chunk_edges[c].size());
+    check_edges(chunk_edges[c], &chunk_usable[c], &solver_mutex);
+  });
+  for (int c = 0; c < num_chunks; ++c) {
+    for (int k = 0; k < ssize(chunk_edges[c]); ++k) {
+      if (!chunk_usable[c][k]) {
+        unusable_edges.insert(chunk_edges[c][k]->id());
+      }
     }
-    degree.at(e->v().id()).evaluator()->set_bounds(Vector1d(0), Vector1d(1));
   }
   return unusable_edges;
 }
 
-void GraphOfConvexSets::AddPerspectiveCost(
+std::vector<Binding<Constraint>> GraphOfConvexSets::AddPerspectiveCost(
     MathematicalProgram* prog, const Binding<Cost>& binding,
     const VectorXDecisionVariable& vars) const {
   const double inf = std::numeric_limits<double>::infinity();
+  std::vector<Binding<Constraint>> added;
 
   // TODO(russt): Avoid this use of RTTI, which mirrors the current
   // pattern in MathematicalProgram::AddCost.
@@ -576,7 +798,7 @@ void GraphOfConvexSets::AddPerspectiveCost(
     a(0) = lc->b();
     a(1) = -1.0;
     a.tail(lc->a().size()) = lc->a();
-    prog->AddLinearConstraint(a, -inf, 0.0, vars);
+    added.emplace_back(prog->AddLinearConstraint(a, -inf, 0.0, vars));
   } else if (QuadraticCost* qc = dynamic_cast<QuadraticCost*>(cost)) {
     // .5 x'Qx + b'x + c is restated as a rotated Lorentz cone constraint
     // enforcing that ℓ should be lower-bounded by the perspective, with
@@ -607,8 +829,8 @@ void GraphOfConvexSets::AddPerspectiveCost(
     A_cone(1, 0) = -qc->c();
     // z₂ ... z_{n+1} = R x.
     A_cone.block(2, 2, R.rows(), R.cols()) = R;
-    prog->AddRotatedLorentzConeConstraint(A_cone, VectorXd::Zero(A_cone.rows()),
-                                          vars);
+    added.emplace_back(prog->AddRotatedLorentzConeConstraint(
+        A_cone, VectorXd::Zero(A_cone.rows()), vars));
   } else if (L1NormCost* l1c = dynamic_cast<L1NormCost*>(cost)) {
     // |Ax + b|₁ becomes ℓ ≥ Σᵢ δᵢ and δᵢ ≥ |Aᵢx+bᵢϕ|.
     int A_rows = l1c->A().rows();
@@ -634,16 +856,17 @@ void GraphOfConvexSets::AddPerspectiveCost(
     A_linear(2 * A_rows, 1) = -1;
     A_linear.block(2 * A_rows, A_cols + 2, 1, l1c_slack.size()) =
         RowVectorXd::Ones(l1c_slack.size());
-    prog->AddLinearConstraint(A_linear,
-                              VectorXd::Constant(A_linear.rows(), -inf),
-                              VectorXd::Zero(A_linear.rows()), cost_vars);
+    added.emplace_back(prog->AddLinearConstraint(
+        A_linear, VectorXd::Constant(A_linear.rows(), -inf),
+        VectorXd::Zero(A_linear.rows()), cost_vars));
   } else if (L2NormCost* l2c = dynamic_cast<L2NormCost*>(cost)) {
     // |Ax + b|₂ becomes ℓ ≥ |Ax+bϕ|₂.
     MatrixXd A_cone = MatrixXd::Zero(l2c->A().rows() + 1, vars.size());
     A_cone(0, 1) = 1.0;                                 // z₀ = ℓ.
     A_cone.block(1, 0, l2c->A().rows(), 1) = l2c->b();  // bϕ.
     A_cone.block(1, 2, l2c->A().rows(), l2c->A().cols()) = l2c->A();  // Ax.
-    prog->AddLorentzConeConstraint(A_cone, VectorXd::Zero(A_cone.rows()), vars);
+    added.emplace_back(prog->AddLorentzConeConstraint(
+        A_cone, VectorXd::Zero(A_cone.rows()), vars));
   } else if (LInfNormCost* linfc = dynamic_cast<LInfNormCost*>(cost)) {
     // |Ax + b|∞ becomes ℓ ≥ |Aᵢx+bᵢϕ| ∀ i.
     int A_rows = linfc->A().rows();
@@ -654,9 +877,9 @@ void GraphOfConvexSets::AddPerspectiveCost(
     A_linear.block(A_rows, 0, A_rows, 1) = -linfc->b();              // -bϕ.
     A_linear.block(A_rows, 1, A_rows, 1) = -VectorXd::Ones(A_rows);  // -ℓ.
     A_linear.block(A_rows, 2, A_rows, linfc->A().cols()) = -linfc->A();  // -Ax.
-    prog->AddLinearConstraint(A_linear,
-                              VectorXd::Constant(A_linear.rows(), -inf),
-                              VectorXd::Zero(A_linear.rows()), vars);
+    added.emplace_back(prog->AddLinearConstraint(
+        A_linear, VectorXd::Constant(A_linear.rows(), -inf),
+        VectorXd::Zero(A_linear.rows()), vars));
   } else if (PerspectiveQuadraticCost* pqc =
                  dynamic_cast<PerspectiveQuadraticCost*>(cost)) {
     // (z_1^2 + ... + z_{n-1}^2) / z_0 for z = Ax + b becomes
@@ -665,19 +888,21 @@ void GraphOfConvexSets::AddPerspectiveCost(
     A_cone(0, 1) = 1.0;
     A_cone.block(1, 0, pqc->A().rows(), 1) = pqc->b();
     A_cone.block(1, 2, pqc->A().rows(), pqc->A().cols()) = pqc->A();
-    prog->AddRotatedLorentzConeConstraint(
-        A_cone, VectorXd::Zero(pqc->A().rows() + 1), vars);
+    added.emplace_back(prog->AddRotatedLorentzConeConstraint(
+        A_cone, VectorXd::Zero(pqc->A().rows() + 1), vars));
   } else {
     throw std::runtime_error(fmt::format(
         "GraphOfConvexSets::Edge does not support this binding type: {}",
         binding.to_string()));
   }
+  return added;
 }
 
-void GraphOfConvexSets::AddPerspectiveConstraint(
+std::vector<Binding<Constraint>> GraphOfConvexSets::AddPerspectiveConstraint(
     MathematicalProgram* prog, const Binding<Constraint>& binding,
     const VectorXDecisionVariable& vars) const {
   const double inf = std::numeric_limits<double>::infinity();
+  std::vector<Binding<Constraint>> added;
 
   Constraint* constraint = binding.evaluator().get();
   if (LinearEqualityConstraint* lec =
@@ -687,10 +912,10 @@ void GraphOfConvexSets::AddPerspectiveConstraint(
     SparseMatrix<double> Aeq(A.rows(), A.cols() + 1);
     Aeq.col(0) = -lec->lower_bound().sparseView();
     Aeq.rightCols(A.cols()) = A;
-    prog->AddConstraint(
+    added.emplace_back(prog->AddConstraint(
         CreateBinding(std::make_shared<LinearEqualityConstraint>(
                           Aeq, VectorXd::Zero(A.rows())),
-                      vars));
+                      vars)));
     // Note that LinearEqualityConstraint must come before LinearConstraint,
     // because LinearEqualityConstraint isa LinearConstraint.
   } else if (LinearConstraint* lc =
@@ -703,11 +928,11 @@ void GraphOfConvexSets::AddPerspectiveConstraint(
       SparseMatrix<double> Ac(A.rows(), A.cols() + 1);
       Ac.col(0) = -lc->upper_bound().sparseView();
       Ac.rightCols(A.cols()) = A;
-      prog->AddConstraint(
+      added.emplace_back(prog->AddConstraint(
           CreateBinding(std::make_shared<LinearConstraint>(
                             Ac, VectorXd::Constant(Ac.rows(), -inf),
                             VectorXd::Zero(Ac.rows())),
-                        vars));
+                        vars)));
     } else if (lc->upper_bound().array().isInf().all()) {
       // Then do nothing.
     } else {
@@ -719,7 +944,7 @@ void GraphOfConvexSets::AddPerspectiveConstraint(
         if (std::isfinite(lc->upper_bound()[i])) {
           a[0] = -lc->upper_bound()[i];
           a.tail(A.cols()) = A.row(i);
-          prog->AddLinearConstraint(a, -inf, 0, vars);
+          added.emplace_back(prog->AddLinearConstraint(a, -inf, 0, vars));
         }
       }
     }
@@ -729,10 +954,11 @@ void GraphOfConvexSets::AddPerspectiveConstraint(
       SparseMatrix<double> Ac(A.rows(), A.cols() + 1);
       Ac.col(0) = -lc->lower_bound().sparseView();
       Ac.rightCols(A.cols()) = A;
-      prog->AddConstraint(CreateBinding(std::make_shared<LinearConstraint>(
-                                            Ac, VectorXd::Zero(Ac.rows()),
-                                            VectorXd::Constant(Ac.rows(), inf)),
-                                        vars));
+      added.emplace_back(prog->AddConstraint(
+          CreateBinding(std::make_shared<LinearConstraint>(
+                            Ac, VectorXd::Zero(Ac.rows()),
+                            VectorXd::Constant(Ac.rows(), inf)),
+                        vars)));
     } else if (lc->lower_bound().array().isInf().all()) {
       // Then do nothing.
     } else {
@@ -743,7 +969,7 @@ void GraphOfConvexSets::AddPerspectiveConstraint(
         if (std::isfinite(lc->lower_bound()[i])) {
           a[0] = -lc->lower_bound()[i];
           a.tail(A.cols()) = A.row(i);
-          prog->AddLinearConstraint(a, 0, inf, vars);
+          added.emplace_back(prog->AddLinearConstraint(a, 0, inf, vars));
         }
       }
     }
@@ -753,56 +979,68 @@ void GraphOfConvexSets::AddPerspectiveConstraint(
                     "binding type: {}",
                     binding.to_string()));
   }
+  return added;
 }
 
-MathematicalProgramResult GraphOfConvexSets::SolveShortestPath(
-    const Vertex& source, const Vertex& target,
-    const GraphOfConvexSetsOptions& specified_options) const {
-  VertexId source_id = source.id();
-  VertexId target_id = target.id();
-  if (vertices_.find(source_id) == vertices_.end()) {
-    throw std::runtime_error(fmt::format(
-        "Source vertex {} is not a vertex in this GraphOfConvexSets.",
-        source_id));
-  }
-  if (vertices_.find(target_id) == vertices_.end()) {
-    throw std::runtime_error(fmt::format(
-        "Target vertex {} is not a vertex in this GraphOfConvexSets.",
-        target_id));
-  }
-
-  // Fill in default options. Note: if these options change, they must also be
-  // updated in the method documentation.
-  GraphOfConvexSetsOptions options = specified_options;
-  if (!options.convex_relaxation) {
-    options.convex_relaxation = false;
-  }
-  if (!options.preprocessing) {
-    options.preprocessing = false;
-  }
-  if (!options.max_rounded_paths) {
-    options.max_rounded_paths = 0;
+std::unique_ptr<GraphOfConvexSets::ShortestPathProgram>
+GraphOfConvexSets::BuildShortestPathProgram(
+    VertexId source_id, VertexId target_id,
+    const GraphOfConvexSetsOptions& options) const {
+  auto program = std::make_unique<ShortestPathProgram>();
+  program->source_id = source_id;
+  program->target_id = target_id;
+  program->convex_relaxation = *options.convex_relaxation;
+  program->preprocessing = *options.preprocessing;
+  if (options.reuse_program) {
+    program->structure = GetProgramStructure();
   }
 
-  std::set<EdgeId> unusable_edges;
+  std::set<EdgeId>& unusable_edges = program->unusable_edges;
   if (*options.preprocessing) {
     unusable_edges = PreprocessShortestPath(source_id, target_id, options);
   }
 
-  MathematicalProgram prog;
-
-  std::map<VertexId, std::vector<Edge*>> incoming_edges;
-  std::map<VertexId, std::vector<Edge*>> outgoing_edges;
-  std::map<VertexId, MatrixXDecisionVariable> vertex_edge_ell;
-  std::vector<Edge*> excluded_edges;
-
-  std::map<EdgeId, Variable> relaxed_phi;
-  std::vector<Variable> excluded_phi;
+  MathematicalProgram& prog = program->prog;
+
+  std::map<VertexId, std::vector<Edge*>>& incoming_edges =
+      program->incoming_edges;
+  std::map<VertexId, std::vector<Edge*>>& outgoing_edges =
+      program->outgoing_edges;
+  std::map<VertexId, MatrixXDecisionVariable>& vertex_edge_ell =
+      program->vertex_edge_ell;
+  std::vector<Edge*>& excluded_edges = program->excluded_edges;
+
+  std::map<EdgeId, Variable>& relaxed_phi = program->relaxed_phi;
+  std::vector<Variable>& excluded_phi = program->excluded_phi;
+
+  // When the program is kept for reuse, we record the perspective of each cost
+  // and constraint so that changes to their coefficients can be written into
+  // the program later.
+  auto add_perspective_cost = [&](const Binding<Cost>& binding,
+                                  const VectorXDecisionVariable& vars) {
+    std::vector<Binding<Constraint>> added =
+        AddPerspectiveCost(&prog, binding, vars);
+    if (options.reuse_program) {
+      program->perspectives.push_back(
+          {binding, std::nullopt, vars,
+           GetPerspectiveCoefficients(*binding.evaluator()), std::move(added)});
+    }
+  };
+  auto add_perspective_constraint = [&](const Binding<Constraint>& binding,
+                                        const VectorXDecisionVariable& vars) {
+    std::vector<Binding<Constraint>> added =
+        AddPerspectiveConstraint(&prog, binding, vars);
+    if (options.reuse_program) {
+      program->perspectives.push_back(
+          {std::nullopt, binding, vars,
+           GetPerspectiveCoefficients(*binding.evaluator()), std::move(added)});
+    }
+  };
 
   // The flow constraints below assume that we have some edge out of the source
   // and into the target, so we handle that case explicitly.
-  bool has_edges_out_of_source = false;
-  bool has_edges_into_target = false;
+  bool& has_edges_out_of_source = program->has_edges_out_of_source;
+  bool& has_edges_into_target = program->has_edges_into_target;
   for (const auto& [edge_id, e] : edges_) {
     // If an edge is turned off (ϕ = 0) or excluded by preprocessing, don't
     // include it in the optimization.
@@ -865,7 +1103,7 @@ MathematicalProgramResult GraphOfConvexSets::SolveShortestPath(
         vars[j + 2] = e->x_to_yz_.at(old_vars[j]);
       }
 
-      AddPerspectiveCost(&prog, b, vars);
+      add_perspective_cost(b, vars);
     }
 
     // Edge constraints.
@@ -882,20 +1120,11 @@ MathematicalProgramResult GraphOfConvexSets::SolveShortestPath(
       // that the constraints describe a bounded set.  The boundedness is
       // ensured by the intersection of these constraints with the convex sets
       // (on the vertices).
-      AddPerspectiveConstraint(&prog, b, vars);
+      add_perspective_constraint(b, vars);
     }
   }
-  if (!has_edges_out_of_source) {
-    MathematicalProgramResult result;
-    log()->info("Source vertex {} has no outgoing edges.", source_id);
-    result.set_solution_result(SolutionResult::kInfeasibleConstraints);
-    return result;
-  }
-  if (!has_edges_into_target) {
-    MathematicalProgramResult result;
-    log()->info("Target vertex {} has no incoming edges.", target_id);
-    result.set_solution_result(SolutionResult::kInfeasibleConstraints);
-    return result;
+  if (!has_edges_out_of_source || !has_edges_into_target) {
+    return program;
   }
 
   for (const std::pair<const VertexId, std::unique_ptr<Vertex>>& vpair :
@@ -1026,7 +1255,7 @@ MathematicalProgramResult GraphOfConvexSets::SolveShortestPath(
             vars[kk + 2] = e->x_to_yz_.at(old_vars[kk]);
           }
 
-          AddPerspectiveCost(&prog, b, vars);
+          add_perspective_cost(b, vars);
         }
       }
     }
@@ -1051,11 +1280,139 @@ MathematicalProgramResult GraphOfConvexSets::SolveShortestPath(
         // assume) that the constraints describe a bounded set.  The boundedness
         // is ensured by the intersection of these constraints with the convex
         // sets (on the vertices).
-        AddPerspectiveConstraint(&prog, b, vars);
+        add_perspective_constraint(b, vars);
       }
     }
   }
 
+  return program;
+}
+
+std::vector<int64_t> GraphOfConvexSets::GetProgramStructure() const {
+  std::vector<int64_t> structure;
+  structure.reserve(3 * vertices_.size() + 4 * edges_.size());
+  for (const auto& [vertex_id, v] : vertices_) {
+    structure.push_back(vertex_id.get_value());
+    structure.push_back(v->costs_.size());
+    structure.push_back(v->constraints_.size());
+  }
+  for (const auto& [edge_id, e] : edges_) {
+    structure.push_back(edge_id.get_value());
+    structure.push_back(e->costs_.size());
+    structure.push_back(e->constraints_.size());
+    structure.push_back(e->phi_value_.has_value() ? *e->phi_value_ : -1);
+  }
+  return structure;
+}
+
+bool GraphOfConvexSets::UpdateShortestPathProgram(
+    ShortestPathProgram* program) const {
+  DRAKE_DEMAND(program != nullptr);
+  for (ShortestPathProgram::Perspective& perspective : program->perspectives) {
+    VectorXd coefficients =
+        perspective.cost
+            ? GetPerspectiveCoefficients(*perspective.cost->evaluator())
+            : GetPerspectiveCoefficients(*perspective.constraint->evaluator());
+    if (coefficients.size() == perspective.coefficients.size() &&
+        coefficients == perspective.coefficients) {
+      continue;
+    }
+    // Formulate the new perspective on its own, and copy its coefficients into
+    // the program.
+    MathematicalProgram scratch;
+    scratch.AddDecisionVariables(perspective.vars);
+    const std::vector<Binding<Constraint>> updated =
+        perspective.cost ? AddPerspectiveCost(&scratch, *perspective.cost,
+                                              perspective.vars)
+                         : AddPerspectiveConstraint(
+                               &scratch, *perspective.constraint,
+                               perspective.vars);
+    if (!CopyCoefficients(updated, perspective.bindings)) {
+      return false;
+    }
+    perspective.coefficients = std::move(coefficients);
+  }
+  return true;
+}
+
+MathematicalProgramResult GraphOfConvexSets::SolveShortestPath(
+    const Vertex& source, const Vertex& target,
+    const GraphOfConvexSetsOptions& specified_options) const {
+  VertexId source_id = source.id();
+  VertexId target_id = target.id();
+  if (vertices_.find(source_id) == vertices_.end()) {
+    throw std::runtime_error(fmt::format(
+        "Source vertex {} is not a vertex in this GraphOfConvexSets.",
+        source_id));
+  }
+  if (vertices_.find(target_id) == vertices_.end()) {
+    throw std::runtime_error(fmt::format(
+        "Target vertex {} is not a vertex in this GraphOfConvexSets.",
+        target_id));
+  }
+
+  // Fill in default options. Note: if these options change, they must also be
+  // updated in the method documentation.
+  GraphOfConvexSetsOptions options = specified_options;
+  if (!options.convex_relaxation) {
+    options.convex_relaxation = false;
+  }
+  if (!options.preprocessing) {
+    options.preprocessing = false;
+  }
+  if (!options.max_rounded_paths) {
+    options.max_rounded_paths = 0;
+  }
+
+  std::unique_lock<std::mutex> program_lock;
+  std::unique_ptr<ShortestPathProgram> new_program;
+  ShortestPathProgram* program{};
+  if (options.reuse_program) {
+    program_lock =
+        std::unique_lock<std::mutex>(shortest_path_program_mutex_);
+    ShortestPathProgram* kept = shortest_path_program_.get();
+    if (kept == nullptr || kept->source_id != source_id ||
+        kept->target_id != target_id ||
+        kept->convex_relaxation != *options.convex_relaxation ||
+        kept->preprocessing != *options.preprocessing ||
+        kept->structure != GetProgramStructure() ||
+        !UpdateShortestPathProgram(kept)) {
+      shortest_path_program_.reset();
+      shortest_path_program_ =
+          BuildShortestPathProgram(source_id, target_id, options);
+    } else {
+      log()->debug("Reusing the GCS shortest path program.");
+    }
+    program = shortest_path_program_.get();
+  } else {
+    new_program = BuildShortestPathProgram(source_id, target_id, options);
+    program = new_program.get();
+  }
+  if (!program->has_edges_out_of_source) {
+    MathematicalProgramResult result;
+    log()->info("Source vertex {} has no outgoing edges.", source_id);
+    result.set_solution_result(SolutionResult::kInfeasibleConstraints);
+    return result;
+  }
+  if (!program->has_edges_into_target) {
+    MathematicalProgramResult result;
+    log()->info("Target vertex {} has no incoming edges.", target_id);
+    result.set_solution_result(SolutionResult::kInfeasibleConstraints);
+    return result;
+  }
+
+  const std::set<EdgeId>& unusable_edges = program->unusable_edges;
+  const MathematicalProgram& prog = program->prog;
+  std::map<VertexId, std::vector<Edge*>>& incoming_edges =
+      program->incoming_edges;
+  std::map<VertexId, std::vector<Edge*>>& outgoing_edges =
+      program->outgoing_edges;
+  const std::map<VertexId, MatrixXDecisionVariable>& vertex_edge_ell =
+      program->vertex_edge_ell;
+  const std::vector<Edge*>& excluded_edges = program->excluded_edges;
+  std::map<EdgeId, Variable>& relaxed_phi = program->relaxed_phi;
+  const std::vector<Variable>& excluded_phi = program->excluded_phi;
+
   MathematicalProgramResult result = Solve(prog, options);
   log()->info(
       "Solved GCS shortest path using {} with convex_relaxation={} and "
@@ -1088,8 +1445,10 @@ MathematicalProgramResult GraphOfConvexSets::SolveShortestPath(
         flows.emplace(edge_id, result.GetSolution(relaxed_phi[edge_id]));
       }
     }
+    // Sample the candidate paths. The sampling doesn't depend on the results
+    // of the convex restrictions, so the restrictions are solved afterwards,
+    // in parallel.
     int num_trials = 0;
-    MathematicalProgramResult best_rounded_result;
     while (static_cast<int>(paths.size()) < *options.max_rounded_paths &&
            num_trials < options.max_rounding_trials) {
       ++num_trials;
@@ -1140,12 +1499,48 @@ MathematicalProgramResult GraphOfConvexSets::SolveShortestPath(
         continue;
       }
       paths.push_back(new_path);
+    }
 
-      // Optimize path
-      MathematicalProgramResult rounded_result =
-          SolveConvexRestriction(new_path, rounding_options);
+    // Warm-start the restrictions from the relaxation's solution, undoing the
+    // perspective yₑ = ϕₑ xᵤ as below.
+    std::map<VertexId, VectorXd> relaxed_x;
+    for (const auto& [vertex_id, vertex_outgoing_edges] : outgoing_edges) {
+      VectorXd x_v =
+          VectorXd::Zero(vertices_.at(vertex_id)->ambient_dimension());
+      double sum_phi = 0;
+      for (const Edge* e : vertex_outgoing_edges) {
+        x_v += result.GetSolution(e->y_);
+        sum_phi += result.GetSolution(relaxed_phi.at(e->id()));
+      }
+      if (sum_phi >= 100.0 * std::numeric_limits<double>::epsilon()) {
+        relaxed_x.emplace(vertex_id, x_v / sum_phi);
+      }
+    }
+    if (incoming_edges.count(target_id) > 0) {
+      VectorXd x_target =
+          VectorXd::Zero(vertices_.at(target_id)->ambient_dimension());
+      for (const Edge* e : incoming_edges.at(target_id)) {
+        x_target += result.GetSolution(e->z_);
+      }
+      relaxed_x.emplace(target_id, x_target);
+    }
 
-      // Check path quality.
+    // Optimize the paths.
+    const int num_paths = ssize(paths);
+    const int num_threads =
+        std::max(1, std::min(options.parallelism.num_threads(), num_paths));
+    std::vector<MathematicalProgramResult> rounded_results(num_paths);
+    std::mutex solver_mutex;
+    drake::internal::ParallelFor(
+        Parallelism(num_threads), num_paths, [&](int i) {
+          rounded_results[i] = SolveConvexRestriction(
+              paths[i], rounding_options, relaxed_x, &solver_mutex);
+        });
+
+    // Check path quality, in the order that the paths were found.
+    MathematicalProgramResult best_rounded_result;
+    for (int i = 0; i < num_paths; ++i) {
+      const MathematicalProgramResult& rounded_result = rounded_results[i];
       if (rounded_result.is_success() &&
           (!best_rounded_result.is_success() ||
            rounded_result.get_optimal_cost() <
@@ -1415,6 +1810,14 @@ void RewriteForConvexSolver(MathematicalProgram* prog) {
 MathematicalProgramResult GraphOfConvexSets::SolveConvexRestriction(
     const std::vector<const Edge*>& active_edges,
     const GraphOfConvexSetsOptions& options) const {
+  return SolveConvexRestriction(active_edges, options, {}, nullptr);
+}
+
+MathematicalProgramResult GraphOfConvexSets::SolveConvexRestriction(
+    const std::vector<const Edge*>& active_edges,
+    const GraphOfConvexSetsOptions& options,
+    const std::map<VertexId, VectorXd>& initial_guesses,
+    std::mutex* solver_mutex) const {
   MathematicalProgram prog;
 
   std::set<const Vertex*, VertexIdComparator> vertices;
@@ -1457,7 +1860,22 @@ MathematicalProgramResult GraphOfConvexSets::SolveConvexRestriction(
 
   RewriteForConvexSolver(&prog);
 
-  MathematicalProgramResult result = Solve(prog, options);
+  std::optional<VectorXd> initial_guess;
+  for (const auto* v : vertices) {
+    auto guess = initial_guesses.find(v->id());
+    if (guess == initial_guesses.end() || v->x().size() == 0) {
+      continue;
+    }
+    if (!initial_guess) {
+      initial_guess = VectorXd::Constant(
+          prog.num_vars(), std::numeric_limits<double>::quiet_NaN());
+    }
+    prog.SetDecisionVariableValueInVector(v->x(), guess->second,
+                                          &*initial_guess);
+  }
+
+  MathematicalProgramResult result =
+      Solve(prog, options, initial_guess, solver_mutex);
 
   // TODO(russt): Add the dual variables back in for the rewritten costs.
 
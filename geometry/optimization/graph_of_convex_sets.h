@@ -1,8 +1,10 @@
 #pragma once
 
+#include <cstdint>
 #include <limits>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <set>
 #include <string>
@@ -11,6 +13,7 @@
 #include <vector>
 
 #include "drake/common/eigen_types.h"
+#include "drake/common/parallelism.h"
 #include "drake/common/symbolic/expression.h"
 #include "drake/geometry/optimization/convex_set.h"
 #include "drake/solvers/mathematical_program_result.h"
@@ -32,7 +35,9 @@ struct GraphOfConvexSetsOptions {
 
   /** Maximum number of distinct paths to compare during random rounding; only
   the lowest cost path is returned. If convex_relaxation is false or this is
-  less than or equal to zero, rounding is not performed. */
+  less than or equal to zero, rounding is not performed. The convex
+  restriction of each path is warm-started from the solution of the convex
+  relaxation, for solvers that accept an initial guess. */
   std::optional<int> max_rounded_paths{std::nullopt};
 
   /** Performs a preprocessing step to remove edges that cannot lie on the
@@ -71,6 +76,25 @@ struct GraphOfConvexSetsOptions {
   running the relaxed problem and looser (i.e., higher) tolerances for final
   solves during rounding. */
   std::optional<solvers::SolverOptions> rounding_solver_options{std::nullopt};
+
+  /** The convex restrictions of the distinct paths found during random
+  rounding are independent, and are solved concurrently using up to this many
+  threads; so are the per-edge programs of preprocessing. Programs that use a
+  solver that is not thread safe (IPOPT or CSDP) are solved one at a time. The
+  result doesn't depend on this option. */
+  Parallelism parallelism{Parallelism::Max()};
+
+  /** When true, SolveShortestPath() keeps the MathematicalProgram that it
+  formulates, and reuses it for the next call with the same source, target,
+  convex_relaxation, and preprocessing, as long as no vertices, edges, costs,
+  constraints, or phi constraints have been added to or removed from the graph
+  in between. Changes to the coefficients of the existing costs and
+  constraints (e.g., made with LinearCost::UpdateCoefficients() on the
+  evaluator of a binding returned by Edge::AddCost()) are written into the
+  kept program in place, which is much cheaper than formulating it again.
+  Preprocessing only depends on the graph's topology, so its result is reused
+  as well. Only one program is kept per graph. */
+  bool reuse_program{false};
 };
 
 /**
@@ -103,7 +127,7 @@ class GraphOfConvexSets {
   DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(GraphOfConvexSets)
 
   /** Constructs an empty graph. */
-  GraphOfConvexSets() = default;
+  GraphOfConvexSets();
 
   virtual ~GraphOfConvexSets();
 
@@ -546,15 +570,45 @@ class GraphOfConvexSets {
       VertexId source_id, VertexId target_id,
       const GraphOfConvexSetsOptions& options) const;
 
+  // Implements SolveConvexRestriction(). The variables of any vertex found in
+  // `initial_guesses` are initialized to its value. If `solver_mutex` is not
+  // null, it is held while solving with a solver that is not thread safe.
+  solvers::MathematicalProgramResult SolveConvexRestriction(
+      const std::vector<const Edge*>& active_edges,
+      const GraphOfConvexSetsOptions& options,
+      const std::map<VertexId, Eigen::VectorXd>& initial_guesses,
+      std::mutex* solver_mutex) const;
+
+  // The MathematicalProgram formulated by SolveShortestPath(), along with the
+  // bookkeeping needed to interpret its solution and to update it in place.
+  struct ShortestPathProgram;
+
+  // Formulates the shortest path problem from `source_id` to `target_id`.
+  std::unique_ptr<ShortestPathProgram> BuildShortestPathProgram(
+      VertexId source_id, VertexId target_id,
+      const GraphOfConvexSetsOptions& options) const;
+
+  // Returns a summary of the vertices, edges, costs, constraints, and phi
+  // constraints in the graph. A program formulated by
+  // BuildShortestPathProgram() can be reused as long as this doesn't change.
+  std::vector<int64_t> GetProgramStructure() const;
+
+  // Writes any changes to the coefficients of the costs and constraints in the
+  // graph into `program`. Returns false if the changes can't be made in place,
+  // in which case the program must be formulated again.
+  bool UpdateShortestPathProgram(ShortestPathProgram* program) const;
+
   // Adds a perspective constraint to the mathematical program to upper bound
   // the cost below a slack variable, ℓ. Specifically given a cost g(x) to
   // minimize, this method implements it with a slack variable and a constraint:
   // min g(x) ⇒ min ℓ, s.t. ℓ ≥ ϕ g(ϕx)
   // `vars` is a vector of variables to be used in the cost and constraint
   // consisting of ℓ, ϕ, and ϕ times the variables in the original cost.
-  void AddPerspectiveCost(solvers::MathematicalProgram* prog,
-                          const solvers::Binding<solvers::Cost>& binding,
-                          const solvers::VectorXDecisionVariable& vars) const;
+  // Returns the constraints that were added.
+  std::vector<solvers::Binding<solvers::Constraint>> AddPerspectiveCost(
+      solvers::MathematicalProgram* prog,
+      const solvers::Binding<solvers::Cost>& binding,
+      const solvers::VectorXDecisionVariable& vars) const;
 
   // Adds a perspective version of the constraint to the mathematical program.
   // Specifically given a constraint h(x) ≤ b, this method implements its
@@ -562,7 +616,8 @@ class GraphOfConvexSets {
   // h(x) ≤ b ⇒ h(ϕx) ≤ ϕb
   // vars` is a vector of variables to be used in the constraint consisting of
   // ϕ, and ϕ times the variables in the original constraint.
-  void AddPerspectiveConstraint(
+  // Returns the constraints that were added.
+  std::vector<solvers::Binding<solvers::Constraint>> AddPerspectiveConstraint(
       solvers::MathematicalProgram* prog,
       const solvers::Binding<solvers::Constraint>& binding,
       const solvers::VectorXDecisionVariable& vars) const;
@@ -575,6 +630,10 @@ class GraphOfConvexSets {
   // containers (like std::set or std::map) using their default ordering.
   std::map<VertexId, std::unique_ptr<Vertex>> vertices_{};
   std::map<EdgeId, std::unique_ptr<Edge>> edges_{};
+
+  // The program kept by SolveShortestPath() when options.reuse_program is set.
+  mutable std::mutex shortest_path_program_mutex_;
+  mutable std::unique_ptr<ShortestPathProgram> shortest_path_program_;
 };
 
 }  // namespace optimization
@@ -4,10 +4,12 @@
 #include <bitset>
 #include <limits>
 #include <memory>
+#include <optional>
 #include <set>
 #include <stdexcept>
 #include <string>
 #include <tuple>
+#include <vector>
 
 #include <Eigen/Eigenvalues>
 #include <drake/solvers/binding.h>
@@ -386,12 +388,9 @@ HPolyhedron HPolyhedron::Intersection(const HPolyhedron& other,
 VectorXd HPolyhedron::UniformSample(
     RandomGenerator* generator,
     const Eigen::Ref<const Eigen::VectorXd>& previous_sample) const {
-  std::normal_distribution<double> gaussian;
   // Choose a random direction.
   VectorXd direction(ambient_dimension());
-  for (int i = 0; i < direction.size(); ++i) {
-    direction[i] = gaussian(*generator);
-  }
+  FillRandomSamples(RandomDistribution::kGaussian, generator, &direction);
   // Find max and min θ subject to
   //   A(previous_sample + θ*direction) ≤ b,
   // aka ∀i, θ * (A * direction)[i] ≤ (b - A * previous_sample)[i].
@@ -428,6 +427,65 @@ VectorXd HPolyhedron::UniformSample(RandomGenerator* generator) const {
   return UniformSample(generator, center);
 }
 
+MatrixXd HPolyhedron::UniformSamples(
+    RandomGenerator* generator,
+    const Eigen::Ref<const Eigen::MatrixXd>& initial_samples,
+    int num_samples_per_chain, int mixing_steps, int thinning_steps) const {
+  DRAKE_THROW_UNLESS(initial_samples.rows() == ambient_dimension());
+  DRAKE_THROW_UNLESS(num_samples_per_chain >= 0);
+  DRAKE_THROW_UNLESS(mixing_steps >= 0);
+  DRAKE_THROW_UNLESS(thinning_steps >= 1);
+  const int num_chains = initial_samples.cols();
+  MatrixXd x = initial_samples;
+  // The slack b - A * x of each chain, which is updated along with x.
+  MatrixXd slack = (-A_ * x).colwise() + b_;
+  MatrixXd directions(ambient_dimension(), num_chains);
+  MatrixXd line_a(A_.rows(), num_chains);
+  // Advances every chain by one hit and run step.
+  auto step = [&]() {
+    FillRandomSamples(RandomDistribution::kGaussian, generator, &directions);
+    line_a.noalias() = A_ * directions;
+    for (int j = 0; j < num_chains; ++j) {
+      // Find max and min θ subject to
+      //   ∀i, θ * (A * direction)[i] ≤ slack[i],
+      // as in UniformSample().
+      double theta_max = std::numeric_limits<double>::infinity();
+      double theta_min = -theta_max;
+      for (int i = 0; i < line_a.rows(); ++i) {
+        if (line_a(i, j) < 0.0) {
+          theta_min = std::max(theta_min, slack(i, j) / line_a(i, j));
+        } else if (line_a(i, j) > 0.0) {
+          theta_max = std::min(theta_max, slack(i, j) / line_a(i, j));
+        }
+      }
+      if (std::isinf(theta_max) || std::isinf(theta_min) ||
+          theta_max < theta_min) {
+        throw std::invalid_argument(fmt::format(
+            "The Hit and Run algorithm failed to find a feasible point in the "
+            "set. The initial samples must be in the set.\nmax(A * "
+            "initial_samples.col({}) - b) = {}",
+            j, (A_ * initial_samples.col(j) - b_).maxCoeff()));
+      }
+      std::uniform_real_distribution<double> uniform_theta(theta_min,
+                                                           theta_max);
+      const double theta = uniform_theta(*generator);
+      x.col(j) += theta * directions.col(j);
+      // Clamp the slack at zero, so that round-off error in the incremental
+      // update can't move a chain outside of the set.
+      slack.col(j) = (slack.col(j) - theta * line_a.col(j)).cwiseMax(0.0);
+    }
+  };
+  MatrixXd samples(ambient_dimension(), num_chains * num_samples_per_chain);
+  for (int k = 0; k < num_samples_per_chain; ++k) {
+    const int num_steps = (k == 0) ? mixing_steps : thinning_steps;
+    for (int s = 0; s < num_steps; ++s) {
+      step();
+    }
+    samples.middleCols(k * num_chains, num_chains) = x;
+  }
+  return samples;
+}
+
 HPolyhedron HPolyhedron::MakeBox(const Eigen::Ref<const VectorXd>& lb,
                                  const Eigen::Ref<const VectorXd>& ub) {
   DRAKE_THROW_UNLESS(lb.size() == ub.size());
@@ -581,8 +639,9 @@ HPolyhedron HPolyhedron::DoIntersectionWithChecks(const HPolyhedron& other,
   return {A.topRows(num_kept), b.topRows(num_kept)};
 }
 
-HPolyhedron HPolyhedron::ReduceInequalities(double tol) const {
-  const std::set<int> redundant_indices = FindRedundant(tol);
+HPolyhedron HPolyhedron::ReduceInequalities(double tol,
+                                            Parallelism parallelism) const {
+  const std::set<int> redundant_indices = FindRedundant(tol, parallelism);
   const int num_vars = A_.cols();
 
   MatrixXd A_new(A_.rows() - redundant_indices.size(), num_vars);
@@ -598,34 +657,139 @@ HPolyhedron HPolyhedron::ReduceInequalities(double tol) const {
   return {A_new, b_new};
 }
 
-std::set<int> HPolyhedron::FindRedundant(double tol) const {
+namespace {
+
+// Returns the rows of A * x <= b whose maximum over an axis-aligned bounding
+// box of the polyhedron is less than b(i) + min(tol, 0). Such a row is
+// strictly inactive over the whole (convex) polyhedron, so it is redundant, and
+// remains so when the other rows for which this returns true are removed too.
+// Returns no rows if the polyhedron is empty or unbounded, or if there are too
+// few rows for the 2 * A.cols() linear programs to pay off.
+std::vector<bool> FindInactiveOnBoundingBox(const MatrixXd& A,
+                                            const VectorXd& b, double tol) {
+  const int num_vars = A.cols();
+  const int num_cons = A.rows();
+  std::vector<bool> inactive(num_cons, false);
+  if (num_cons <= 2 * num_vars) {
+    return inactive;
+  }
+  MathematicalProgram prog;
+  const auto x = prog.NewContinuousVariables(num_vars, "x");
+  prog.AddLinearConstraint(
+      A, VectorXd::Constant(num_cons, -std::numeric_limits<double>::infinity()),
+      b, x);
+  auto cost = prog.AddLinearCost(VectorXd::Zero(num_vars), 0, x);
+  VectorXd lower(num_vars);
+  VectorXd upper(num_vars);
+  for (int k = 0; k < num_vars; ++k) {
+    for (const double sign : {1.0, -1.0}) {
+      cost.evaluator()->UpdateCoefficients(sign * VectorXd::Unit(num_vars, k),
+                                           0);
+      const auto result = Solve(prog);
+      if (!result.is_success()) {
+        return inactive;
+      }
+      (sign > 0 ? lower : upper)[k] = sign * result.get_optimal_cost();
+    }
+  }
+  const VectorXd center = (upper + lower) / 2;
+  const VectorXd half_width = (upper - lower) / 2;
+  for (int i = 0; i < num_cons; ++i) {
+    const double box_max =
+        A.row(i).dot(center) + A.row(i).cwiseAbs().dot(half_width);
+    inactive[i] = box_max < b[i] + std::min(tol, 0.0);
+  }
+  return inactive;
+}
+
+// Returns true iff `result`, of maximizing the left-hand side of a row subject
+// to the other rows, shows that the row with right-hand side `b_i` is
+// redundant.
+bool IsRedundant(const solvers::MathematicalProgramResult& result, double b_i,
+                 double tol) {
+  return result.is_success() && -result.get_optimal_cost() <= b_i + tol;
+}
+
+}  // namespace
+
+std::set<int> HPolyhedron::FindRedundant(double tol,
+                                         Parallelism parallelism) const {
   // This method is based on removing each constraint and solving the resulting
   // LP. If the optimal cost is greater than the constraint's right hand side,
   // then the constraint is redundant.
-  // Possible future speed up: solve duals instead of primal in parallel,
-  // however this would require building num_threads mathematical programs and
-  // may not be worth it.
   std::set<int> redundant_indices;
-  MathematicalProgram prog;
   const int num_vars = A_.cols();
   const int num_cons = A_.rows();
+
+  std::vector<int> candidates;
+  const std::vector<bool> inactive = FindInactiveOnBoundingBox(A_, b_, tol);
+  for (int i = 0; i < num_cons; ++i) {
+    if (inactive[i]) {
+      redundant_indices.insert(i);
+    } else {
+      candidates.push_back(i);
+    }
+  }
+  const int num_candidates = candidates.size();
+
+  // A row that is not redundant with respect to all of the other candidates
+  // stays that way as rows are removed, so those LPs are independent and can
+  // be solved in parallel.
+  std::vector<bool> necessary(num_cons, false);
+  if (parallelism.num_threads() > 1 && num_candidates > 1) {
+    std::vector<std::unique_ptr<MathematicalProgram>> progs;
+    std::vector<const MathematicalProgram*> prog_ptrs;
+    MatrixXd A_others(num_candidates - 1, num_vars);
+    VectorXd b_others(num_candidates - 1);
+    for (int k = 0; k < num_candidates; ++k) {
+      for (int j = 0, row = 0; j < num_candidates; ++j) {
+        if (j != k) {
+          A_others.row(row) = A_.row(candidates[j]);
+          b_others[row] = b_[candidates[j]];
+          ++row;
+        }
+      }
+      auto& prog = progs.emplace_back(std::make_unique<MathematicalProgram>());
+      const auto x = prog->NewContinuousVariables(num_vars, "x");
+      prog->AddLinearConstraint(
+          A_others,
+          VectorXd::Constant(num_candidates - 1,
+                             -std::numeric_limits<double>::infinity()),
+          b_others, x);
+      prog->AddLinearCost(-A_.row(candidates[k]), 0, x);
+      prog_ptrs.push_back(prog.get());
+    }
+    const std::vector<solvers::MathematicalProgramResult> results =
+        solvers::SolveInParallel(prog_ptrs, {}, std::nullopt, parallelism);
+    for (int k = 0; k < num_candidates; ++k) {
+      const int i = candidates[k];
+      necessary[i] = !IsRedundant(results[k], b_[i], tol);
+    }
+  }
+
+  // Check the remaining candidates one at a time, removing each redundant row
+  // before checking the next one.
+  MathematicalProgram prog;
   const auto x = prog.NewContinuousVariables(num_vars, "x");
   std::vector<Binding<LinearConstraint>> bindings_vec;
-  for (int i = 0; i < num_cons; ++i) {
+  for (const int i : candidates) {
     bindings_vec.push_back(prog.AddLinearConstraint(
         A_.row(i), -std::numeric_limits<double>::infinity(), b_[i], x));
   }
-  auto const_binding = prog.AddLinearCost(-A_.row(0), 0, x);
-  for (int i = 0; i < num_cons; ++i) {
-    prog.RemoveConstraint(bindings_vec.at(i));
+  auto const_binding = prog.AddLinearCost(VectorXd::Zero(num_vars), 0, x);
+  for (int k = 0; k < num_candidates; ++k) {
+    const int i = candidates[k];
+    if (necessary[i]) {
+      continue;
+    }
+    prog.RemoveConstraint(bindings_vec.at(k));
     const_binding.evaluator()->UpdateCoefficients(-A_.row(i), 0);
     const auto result = Solve(prog);
-    if ((result.is_success() && -result.get_optimal_cost() > b_[i] + tol) ||
-        !result.is_success()) {
-      // Bring back the constraint, it is not redundant.
-      prog.AddConstraint(bindings_vec.at(i));
-    } else {
+    if (IsRedundant(result, b_[i], tol)) {
       redundant_indices.insert(i);
+    } else {
+      // Bring back the constraint, it is not redundant.
+      prog.AddConstraint(bindings_vec.at(k));
     }
   }
   return redundant_indices;
@@ -641,6 +805,15 @@ bool HPolyhedron::DoPointInSet(const Eigen::Ref<const VectorXd>& x,
   return ((A_ * x).array() <= b_.array() + tol).all();
 }
 
+std::vector<bool> HPolyhedron::DoPointsInSet(
+    const Eigen::Ref<const MatrixXd>& points, double tol) const {
+  DRAKE_DEMAND(A_.cols() == points.rows());
+  const MatrixXd violation = (A_ * points).colwise() - b_;
+  const Eigen::Array<bool, 1, Eigen::Dynamic> in_set =
+      (violation.array() <= tol).colwise().all();
+  return std::vector<bool>(in_set.begin(), in_set.end());
+}
+
 std::pair<VectorX<Variable>, std::vector<Binding<Constraint>>>
 HPolyhedron::DoAddPointInSetConstraints(
     MathematicalProgram* prog,
@@ -7,6 +7,7 @@
 #include <vector>
 
 #include "drake/common/name_value.h"
+#include "drake/common/parallelism.h"
 #include "drake/geometry/optimization/convex_set.h"
 #include "drake/geometry/optimization/hyperellipsoid.h"
 
@@ -94,8 +95,18 @@ class HPolyhedron final : public ConvexSet {
    programs. We say the jᵗʰ row A.row(j)*x <= b(j) is redundant, if {x |
    A.row(i) * x <= b(i), ∀i ∉ ℑ} implies that A.row(j) * x <= b(j) + tol.
    Note that we do NOT guarantee that we find all the redundant rows.
+
+   When there are many more rows than dimensions, the rows that are strictly
+   inactive over an axis-aligned bounding box of the polyhedron are discarded
+   first, which costs only 2 * ambient_dimension() linear programs.
+
+   @param parallelism The maximum number of threads used to solve the linear
+   programs. The rows that are not redundant with respect to all of the other
+   rows are identified in parallel; the remaining rows are then checked one at
+   a time, so that the result does not depend on `parallelism`.
    */
-  [[nodiscard]] std::set<int> FindRedundant(double tol = 1E-9) const;
+  [[nodiscard]] std::set<int> FindRedundant(
+      double tol = 1E-9, Parallelism parallelism = Parallelism::None()) const;
 
   /** Reduces some (not necessarily all) redundant inequalities in the
   HPolyhedron.  This is not guaranteed to give the minimal representation of
@@ -104,8 +115,10 @@ class HPolyhedron final : public ConvexSet {
   @param tol For a constraint c'x<=d, if the halfspace c'x<=d + tol contains the
   hpolyhedron generated by the rest of the constraints, then we remove this
   inequality. A positive tol means it is more likely to remove a constraint, a
-  negative tol means it is less likely to remote a constraint.  */
-  [[nodiscard]] HPolyhedron ReduceInequalities(double tol = 1E-9) const;
+  negative tol means it is less likely to remote a constraint.
+  @param parallelism As in FindRedundant(). */
+  [[nodiscard]] HPolyhedron ReduceInequalities(
+      double tol = 1E-9, Parallelism parallelism = Parallelism::None()) const;
 
   /** Solves a semi-definite program to compute the inscribed ellipsoid. This is
   also known as the inner Löwner-John ellipsoid. From Section 8.4.2 in Boyd and
@@ -197,6 +210,31 @@ class HPolyhedron final : public ConvexSet {
   previous_sample as a feasible point to start the Markov chain sampling. */
   Eigen::VectorXd UniformSample(RandomGenerator* generator) const;
 
+  /** Draws many (approximately) uniform samples from the set, by running one
+  independent hit and run Markov chain from each column of `initial_samples`.
+  The chains are advanced together, and the slack b - Ax of each chain is
+  updated incrementally along its random direction, so that each step costs a
+  single product of A with the matrix of directions rather than recomputing
+  A * x for every chain.
+
+  Each chain takes `mixing_steps` steps before recording its first sample, and
+  `thinning_steps` steps between subsequent samples. Using fewer chains with
+  more mixing steps gives samples that are closer to uniform; using more
+  chains gives samples that are less correlated with each other.
+
+  @returns a matrix with ambient_dimension() rows and
+  `initial_samples.cols() * num_samples_per_chain` columns. The first
+  `initial_samples.cols()` columns are the first sample of each chain, in
+  order, followed by the second sample of each chain, and so on.
+  @throws std::exception if a hit and run step fails because its chain's
+  initial sample is not in the set, if `num_samples_per_chain` or
+  `mixing_steps` is negative, or if `thinning_steps` is less than one. */
+  Eigen::MatrixXd UniformSamples(
+      RandomGenerator* generator,
+      const Eigen::Ref<const Eigen::MatrixXd>& initial_samples,
+      int num_samples_per_chain, int mixing_steps = 10,
+      int thinning_steps = 1) const;
+
   /** Constructs a polyhedron as an axis-aligned box from the lower and upper
   corners. */
   static HPolyhedron MakeBox(const Eigen::Ref<const Eigen::VectorXd>& lb,
@@ -244,6 +282,10 @@ class HPolyhedron final : public ConvexSet {
   bool DoPointInSet(const Eigen::Ref<const Eigen::VectorXd>& x,
                     double tol) const final;
 
+  std::vector<bool> DoPointsInSet(
+      const Eigen::Ref<const Eigen::MatrixXd>& points,
+      double tol) const final;
+
   std::pair<VectorX<symbolic::Variable>,
             std::vector<solvers::Binding<solvers::Constraint>>>
   DoAddPointInSetConstraints(
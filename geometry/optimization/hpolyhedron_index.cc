@@ -0,0 +1,193 @@
+#include "drake/geometry/optimization/hpolyhedron_index.h"
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <utility>
+
+#include "drake/common/parallel_for.h"
+#include "drake/solvers/choose_best_solver.h"
+
+namespace drake {
+namespace geometry {
+namespace optimization {
+
+using Eigen::MatrixXd;
+using Eigen::VectorXd;
+
+namespace {
+
+// Computes the axis-aligned bounding box of `region`. The bounds in any
+// direction in which the region is unbounded (or in which the linear program
+// fails) are infinite, so the box always contains the region.
+std::pair<VectorXd, VectorXd> CalcBoundingBox(const HPolyhedron& region) {
+  const int n = region.ambient_dimension();
+  const double inf = std::numeric_limits<double>::infinity();
+  VectorXd lower = VectorXd::Constant(n, -inf);
+  VectorXd upper = VectorXd::Constant(n, inf);
+  solvers::MathematicalProgram prog;
+  auto x = prog.NewContinuousVariables(n, "x");
+  region.AddPointInSetConstraints(&prog, x);
+  auto cost = prog.AddLinearCost(VectorXd::Zero(n), x);
+  const std::unique_ptr<solvers::SolverInterface> solver =
+      solvers::MakeSolver(solvers::ChooseBestSolver(prog));
+  for (int i = 0; i < n; ++i) {
+    for (const double direction : {1.0, -1.0}) {
+      VectorXd a = VectorXd::Zero(n);
+      a[i] = direction;
+      cost.evaluator()->UpdateCoefficients(a);
+      solvers::MathematicalProgramResult result;
+      solver->Solve(prog, std::nullopt, std::nullopt, &result);
+      if (result.is_success()) {
+        if (direction > 0) {
+          lower[i] = result.get_optimal_cost();
+        } else {
+          upper[i] = -result.get_optimal_cost();
+        }
+      }
+    }
+  }
+  return {lower, upper};
+}
+
+// Returns true iff `x` is within `tol` of the box [lower, upper].
+bool InBox(const Eigen::Ref<const VectorXd>& x,
+           const Eigen::Ref<const VectorXd>& lower,
+           const Eigen::Ref<const VectorXd>& upper, double tol) {
+  return (x.array() >= lower.array() - tol).all() &&
+         (x.array() <= upper.array() + tol).all();
+}
+
+// The number of regions below which a node is not split.
+constexpr int kMaxLeafSize = 4;
+
+}  // namespace
+
+HPolyhedronIndex::HPolyhedronIndex(std::vector<HPolyhedron> regions)
+    : regions_(std::move(regions)) {
+  if (regions_.empty()) {
+    return;
+  }
+  ambient_dimension_ = regions_[0].ambient_dimension();
+  for (const HPolyhedron& region : regions_) {
+    DRAKE_THROW_UNLESS(region.ambient_dimension() == ambient_dimension_);
+  }
+  const int num_regions = regions_.size();
+  lower_.resize(ambient_dimension_, num_regions);
+  upper_.resize(ambient_dimension_, num_regions);
+  for (int i = 0; i < num_regions; ++i) {
+    const auto [lower, upper] = CalcBoundingBox(regions_[i]);
+    lower_.col(i) = lower;
+    upper_.col(i) = upper;
+  }
+  order_.resize(num_regions);
+  std::iota(order_.begin(), order_.end(), 0);
+  nodes_.reserve(2 * num_regions);
+  BuildTree(0, num_regions);
+}
+
+HPolyhedronIndex::~HPolyhedronIndex() = default;
+
+int HPolyhedronIndex::BuildTree(int begin, int end) {
+  const int index = nodes_.size();
+  nodes_.push_back(Node{});
+  VectorXd lower = lower_.col(order_[begin]);
+  VectorXd upper = upper_.col(order_[begin]);
+  for (int i = begin + 1; i < end; ++i) {
+    lower = lower.cwiseMin(lower_.col(order_[i]));
+    upper = upper.cwiseMax(upper_.col(order_[i]));
+  }
+  nodes_[index].lower = std::move(lower);
+  nodes_[index].upper = std::move(upper);
+  nodes_[index].begin = begin;
+  nodes_[index].end = end;
+  if (end - begin <= kMaxLeafSize) {
+    return index;
+  }
+
+  // Split the regions at the median of their box centers, along the axis in
+  // which the (finite) centers are most spread out. Infinite bounds are
+  // clamped, so that unbounded regions still sort consistently.
+  const double kClamp = 1e10;
+  auto center = [&](int region, int axis) {
+    return std::clamp(lower_(axis, region), -kClamp, kClamp) +
+           std::clamp(upper_(axis, region), -kClamp, kClamp);
+  };
+  int axis = 0;
+  double best_spread = -1;
+  for (int k = 0; k < ambient_dimension_; ++k) {
+    double min_center = std::numeric_limits<double>::infinity();
+    double max_center = -min_center;
+    for (int i = begin; i < end; ++i) {
+      min_center = std::min(min_center, center(order_[i], k));
+      max_center = std::max(max_center, center(order_[i], k));
+    }
+    if (max_center - min_center > best_spread) {
+      best_spread = max_center - min_center;
+      axis = k;
+    }
+  }
+  const int middle = begin + (end - begin) / 2;
+  std::nth_element(order_.begin() + begin, order_.begin() + middle,
+                   order_.begin() + end, [&](int a, int b) {
+                     return center(a, axis) < center(b, axis);
+                   });
+  const int left = BuildTree(begin, middle);
+  const int right = BuildTree(middle, end);
+  nodes_[index].left = left;
+  nodes_[index].right = right;
+  return index;
+}
+
+void HPolyhedronIndex::FindRegions(const Eigen::Ref<const VectorXd>& x,
+                                   double tol, std::vector<int>* found) const {
+  if (nodes_.empty()) {
+    return;
+  }
+  std::vector<int> stack{0};
+  while (!stack.empty()) {
+    const Node& node = nodes_[stack.back()];
+    stack.pop_back();
+    if (!InBox(x, node.lower, node.upper, tol)) {
+      continue;
+    }
+    if (node.left >= 0) {
+      stack.push_back(node.left);
+      stack.push_back(node.right);
+      continue;
+    }
+    for (int i = node.begin; i < node.end; ++i) {
+      const int region = order_[i];
+      if (InBox(x, lower_.col(region), upper_.col(region), tol) &&
+          regions_[region].PointInSet(x, tol)) {
+        found->push_back(region);
+      }
+    }
+  }
+  std::sort(found->begin(), found->end());
+}
+
+std::vector<int> HPolyhedronIndex::FindRegionsContainingPoint(
+    const Eigen::Ref<const VectorXd>& x, double tol) const {
+  DRAKE_THROW_UNLESS(x.size() == ambient_dimension_ || regions_.empty());
+  std::vector<int> found;
+  FindRegions(x, tol, &found);
+  return found;
+}
+
+std::vector<std::vector<int>> HPolyhedronIndex::FindRegionsContainingPoints(
+    const Eigen::Ref<const MatrixXd>& points, double tol,
+    Parallelism parallelism) const {
+  DRAKE_THROW_UNLESS(points.rows() == ambient_dimension_ || regions_.empty());
+  const int num_points = points.cols();
+  std::vector<std::vector<int>> found(num_points);
+  drake::internal::ParallelFor(parallelism, num_points, [&](int i) {
+    FindRegions(points.col(i), tol, &found[i]);
+  });
+  return found;
+}
+
+}  // namespace optimization
+}  // namespace geometry
+}  // namespace drake
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <vector>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/parallelism.h"
+#include "drake/geometry/optimization/hpolyhedron.h"
+
+namespace drake {
+namespace geometry {
+namespace optimization {
+
+/** A spatial index over a collection of HPolyhedron regions (e.g., the regions
+of a GraphOfConvexSets), which quickly finds the regions that contain a point.
+
+The axis-aligned bounding box of each region is computed once, on construction,
+and the boxes are organized in a bounding volume hierarchy. A query only checks
+the halfspaces of the regions whose boxes contain the point, so it takes time
+roughly logarithmic in the number of regions when the regions are spread out.
+Unbounded regions are given infinite boxes, and so are always checked.
+
+@ingroup geometry_optimization */
+class HPolyhedronIndex final {
+ public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(HPolyhedronIndex)
+
+  /** Constructs the index over `regions`, which are stored by the index.
+  Computing the bounding boxes requires solving two linear programs for each
+  dimension of each region.
+  @throws std::exception if the regions don't all have the same ambient
+  dimension. */
+  explicit HPolyhedronIndex(std::vector<HPolyhedron> regions);
+
+  ~HPolyhedronIndex();
+
+  /** Returns the indexed regions. */
+  const std::vector<HPolyhedron>& regions() const { return regions_; }
+
+  /** Returns the ambient dimension of the regions, or zero if there are no
+  regions. */
+  int ambient_dimension() const { return ambient_dimension_; }
+
+  /** Returns the indices into regions(), in increasing order, of the regions
+  that contain `x`, as determined by HPolyhedron::PointInSet(x, tol).
+  @throws std::exception if x.size() != ambient_dimension(). */
+  std::vector<int> FindRegionsContainingPoint(
+      const Eigen::Ref<const Eigen::VectorXd>& x, double tol = 0) const;
+
+  /** Returns FindRegionsContainingPoint() for each column of `points`. The
+  points are processed concurrently using up to the given `parallelism`.
+  @throws std::exception if points.rows() != ambient_dimension(). */
+  std::vector<std::vector<int>> FindRegionsContainingPoints(
+      const Eigen::Ref<const Eigen::MatrixXd>& points, double tol = 0,
+      Parallelism parallelism = Parallelism::None()) const;
+
+ private:
+  // A node of the bounding volume hierarchy, whose box contains the boxes of
+  // the regions order_[begin], ..., order_[end - 1]. Leaves have no children.
+  struct Node {
+    Eigen::VectorXd lower;
+    Eigen::VectorXd upper;
+    int begin{};
+    int end{};
+    int left{-1};
+    int right{-1};
+  };
+
+  // Adds the subtree over order_[begin], ..., order_[end - 1] and returns the
+  // index of its root.
+  int BuildTree(int begin, int end);
+
+  // Appends the regions that contain `x` to `found`.
+  void FindRegions(const Eigen::Ref<const Eigen::VectorXd>& x, double tol,
+                   std::vector<int>* found) const;
+
+  std::vector<HPolyhedron> regions_;
+  int ambient_dimension_{0};
+  // The bounding box of each region.
+  Eigen::MatrixXd lower_;
+  Eigen::MatrixXd upper_;
+  // The region indices, ordered such that each node covers a range of them.
+  std::vector<int> order_;
+  // The nodes of the hierarchy; nodes_[0] is the root, when there are regions.
+  std::vector<Node> nodes_;
+};
+
+}  // namespace optimization
+}  // namespace geometry
+}  // namespace drake
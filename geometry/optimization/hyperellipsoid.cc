@@ -271,6 +271,15 @@ bool Hyperellipsoid::DoPointInSet(const Eigen::Ref<const VectorXd>& x,
   return v.dot(v) <= 1.0 + tol;
 }
 
+std::vector<bool> Hyperellipsoid::DoPointsInSet(
+    const Eigen::Ref<const MatrixXd>& points, double tol) const {
+  DRAKE_DEMAND(A_.cols() == points.rows());
+  const Eigen::Array<bool, 1, Eigen::Dynamic> in_set =
+      (A_ * (points.colwise() - center_)).colwise().squaredNorm().array() <=
+      1.0 + tol;
+  return std::vector<bool>(in_set.begin(), in_set.end());
+}
+
 std::pair<VectorX<Variable>, std::vector<Binding<Constraint>>>
 Hyperellipsoid::DoAddPointInSetConstraints(
     MathematicalProgram* prog,
@@ -1,9 +1,15 @@
 #include "drake/geometry/optimization/intersection.h"
 
+#include <limits>
 #include <memory>
+#include <optional>
 
 #include <fmt/format.h>
 
+#include "drake/geometry/optimization/hpolyhedron.h"
+#include "drake/geometry/optimization/hyperrectangle.h"
+#include "drake/geometry/optimization/point.h"
+
 namespace drake {
 namespace geometry {
 namespace optimization {
@@ -18,6 +24,8 @@ using symbolic::Variable;
 
 namespace {
 
+constexpr double kInf = std::numeric_limits<double>::infinity();
+
 int GetAmbientDimension(const ConvexSets& sets) {
   if (sets.empty()) {
     return 0;
@@ -30,6 +38,25 @@ int GetAmbientDimension(const ConvexSets& sets) {
   return ambient_dimension;
 }
 
+// Returns the intersection of `sets` as a single HPolyhedron, by concatenating
+// their inequalities, if every one of them is an HPolyhedron or Hyperrectangle.
+std::optional<HPolyhedron> MaybeConcatenateHPolyhedra(const ConvexSets& sets) {
+  std::optional<HPolyhedron> result;
+  for (const copyable_unique_ptr<ConvexSet>& set : sets) {
+    std::optional<HPolyhedron> h;
+    if (const auto* hpoly = dynamic_cast<const HPolyhedron*>(set.get())) {
+      h = *hpoly;
+    } else if (const auto* box =
+                   dynamic_cast<const Hyperrectangle*>(set.get())) {
+      h = box->MakeHPolyhedron();
+    } else {
+      return std::nullopt;
+    }
+    result = result.has_value() ? result->Intersection(*h) : std::move(*h);
+  }
+  return result;
+}
+
 }  // namespace
 
 Intersection::Intersection() : Intersection(ConvexSets{}) {}
@@ -61,6 +88,11 @@ std::optional<bool> Intersection::DoIsBoundedShortcut() const {
       return true;
     }
   }
+  // An intersection of polyhedra is a polyhedron; HPolyhedron has a cheaper
+  // boundedness check than the generic one.
+  if (std::optional<HPolyhedron> h = MaybeConcatenateHPolyhedra(sets_)) {
+    return h->IsBounded();
+  }
   return std::nullopt;
 }
 
@@ -74,6 +106,33 @@ bool Intersection::DoIsEmpty() const {
       return true;
     }
   }
+  // The intersection with a point is nonempty iff every set contains it.
+  for (const auto& s : sets_) {
+    if (const auto* point = dynamic_cast<const Point*>(s.get())) {
+      return !PointInSet(point->x());
+    }
+  }
+  // The intersection of boxes is empty iff some lower bound exceeds some upper
+  // bound.
+  VectorXd lb = VectorXd::Constant(ambient_dimension(), -kInf);
+  VectorXd ub = VectorXd::Constant(ambient_dimension(), kInf);
+  bool all_boxes = true;
+  for (const auto& s : sets_) {
+    const auto* box = dynamic_cast<const Hyperrectangle*>(s.get());
+    if (box == nullptr) {
+      all_boxes = false;
+      break;
+    }
+    lb = lb.cwiseMax(box->lb());
+    ub = ub.cwiseMin(box->ub());
+  }
+  if (all_boxes) {
+    return (lb.array() > ub.array()).any();
+  }
+  // The intersection of polyhedra needs only a single LP.
+  if (std::optional<HPolyhedron> h = MaybeConcatenateHPolyhedra(sets_)) {
+    return h->IsEmpty();
+  }
   // Now actually see if the intersection is nonempty.
   return ConvexSet::DoIsEmpty();
 }
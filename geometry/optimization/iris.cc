@@ -1,7 +1,10 @@
 #include "drake/geometry/optimization/iris.h"
 
 #include <algorithm>
+#include <exception>
 #include <limits>
+#include <memory>
+#include <mutex>
 #include <optional>
 #include <tuple>
 #include <unordered_map>
@@ -9,6 +12,8 @@
 #include <utility>
 #include <vector>
 
+#include "drake/common/parallel_for.h"
+#include "drake/common/scope_exit.h"
 #include "drake/common/symbolic/expression.h"
 #include "drake/geometry/optimization/cartesian_product.h"
 #include "drake/geometry/optimization/convex_set.h"
@@ -37,6 +42,7 @@ using multibody::MultibodyPlant;
 using solvers::Binding;
 using solvers::Constraint;
 using solvers::MathematicalProgram;
+using solvers::SnoptSolver;
 using symbolic::Expression;
 using systems::Context;
 
@@ -613,6 +619,28 @@ HPolyhedron IrisInConfigurationSpace(const MultibodyPlant<double>& plant,
 
   VectorXd guess = seed;
 
+  // The counter-example searches for the collision pairs may run in parallel
+  // if the solver is thread safe; IPOPT is not. The SamePointConstraint holds
+  // a mutable context, so each concurrent search borrows its own from
+  // available_same_point_constraints.
+  int num_threads = options.parallelism.num_threads();
+  if (num_threads > 1 && solver->solver_id() != SnoptSolver::id()) {
+    log()->info(
+        "IrisInConfigurationSpace: searching for counter-examples serially "
+        "since SNOPT is not available");
+    num_threads = 1;
+  }
+  std::mutex same_point_constraints_mutex;
+  std::vector<std::shared_ptr<internal::SamePointConstraint>>
+      available_same_point_constraints;
+  if (num_threads > 1) {
+    available_same_point_constraints.push_back(same_point_constraint);
+    for (int i = 1; i < num_threads; ++i) {
+      available_same_point_constraints.push_back(
+          std::make_shared<internal::SamePointConstraint>(&plant, context));
+    }
+  }
+
   // For debugging visualization.
   Vector3d point_to_draw = Vector3d::Zero();
   int num_points_drawn = 0;
@@ -663,109 +691,231 @@ HPolyhedron IrisInConfigurationSpace(const MultibodyPlant<double>& plant,
 
     // Use the fast nonlinear optimizer until it fails
     // num_collision_infeasible_samples consecutive times.
-    for (const auto& pair_w_distance : sorted_pairs) {
-      std::pair<GeometryId, GeometryId> geom_pair(pair_w_distance.geomA,
-                                                  pair_w_distance.geomB);
-      int consecutive_failures = 0;
-      internal::ClosestCollisionProgram prog(
-          same_point_constraint, *frames.at(pair_w_distance.geomA),
-          *frames.at(pair_w_distance.geomB), *sets.at(pair_w_distance.geomA),
-          *sets.at(pair_w_distance.geomB), E, A.topRows(num_constraints),
-          b.head(num_constraints));
-      std::vector<VectorXd> prev_counter_examples =
-          std::move(counter_examples[geom_pair]);
-      // Sort by the current ellipsoid metric.
-      std::sort(prev_counter_examples.begin(), prev_counter_examples.end(),
-                [&E](const VectorXd& x, const VectorXd& y) {
-                  return (E.A() * x - E.center()).squaredNorm() <
-                         (E.A() * y - E.center()).squaredNorm();
-                });
-      std::vector<VectorXd> new_counter_examples;
-      int counter_example_searches_for_this_pair = 0;
-      bool warned_many_searches = false;
-      while (consecutive_failures < options.num_collision_infeasible_samples) {
-        // First use previous counter-examples for this pair as the seeds.
-        if (counter_example_searches_for_this_pair <
-            ssize(prev_counter_examples)) {
-          guess = prev_counter_examples[counter_example_searches_for_this_pair];
-        } else {
-          MakeGuessFeasible(P_candidate, &guess);
-          guess = P_candidate.UniformSample(&generator, guess);
+    if (num_threads > 1) {
+      // Search for counter-examples for all pairs concurrently. Each pair's
+      // search starts from the polytope as of now, and accumulates its own
+      // hyperplanes in a private copy of the polytope. The pairs' counter-
+      // examples are merged below, in the same order as the serial search.
+      // Since every pair is certified within a superset of the final polytope,
+      // the certification is at least as strong as the serial search's.
+      const int num_pairs = ssize(sorted_pairs);
+      std::vector<RandomGenerator::result_type> pair_random_seeds(num_pairs);
+      for (int k = 0; k < num_pairs; ++k) {
+        pair_random_seeds[k] = generator();
+        // Insert any missing entries now, so that the loop only reads the map.
+        counter_examples.try_emplace(
+            std::make_pair(sorted_pairs[k].geomA, sorted_pairs[k].geomB));
+      }
+      std::vector<std::vector<VectorXd>> pair_counter_examples(num_pairs);
+      std::vector<uint8_t> pair_excludes_seed(num_pairs, 0);
+      auto search_pair = [&](int k) {
+        const GeometryPairWithDistance& pair_w_distance = sorted_pairs[k];
+        std::shared_ptr<internal::SamePointConstraint> pair_constraint;
+        {
+          std::lock_guard<std::mutex> lock(same_point_constraints_mutex);
+          DRAKE_DEMAND(!available_same_point_constraints.empty());
+          pair_constraint = std::move(available_same_point_constraints.back());
+          available_same_point_constraints.pop_back();
         }
-        ++counter_example_searches_for_this_pair;
-        if (options.meshcat && nq <= 3) {
-          ++num_points_drawn;
-          point_to_draw.head(nq) = guess;
-          std::string path = fmt::format("iteration{:02}/{:03}/guess",
-                                         iteration, num_points_drawn);
-          options.meshcat->SetObject(path, Sphere(0.01),
-                                     geometry::Rgba(0.1, 0.1, 0.1, 1.0));
-          options.meshcat->SetTransform(path,
-                                        RigidTransform<double>(point_to_draw));
+        ScopeExit return_constraint([&]() {
+          std::lock_guard<std::mutex> lock(same_point_constraints_mutex);
+          available_same_point_constraints.push_back(pair_constraint);
+        });
+        RandomGenerator pair_generator(pair_random_seeds[k]);
+        Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>
+            A_pair = A.topRows(num_constraints);
+        VectorXd b_pair = b.head(num_constraints);
+        int num_pair_constraints = num_constraints;
+        HPolyhedron P_pair = P_candidate;
+        VectorXd pair_guess = guess;
+        internal::ClosestCollisionProgram prog(
+            pair_constraint, *frames.at(pair_w_distance.geomA),
+            *frames.at(pair_w_distance.geomB),
+            *sets.at(pair_w_distance.geomA), *sets.at(pair_w_distance.geomB),
+            E, A_pair, b_pair);
+        // Start from the previous counter-examples for this pair, sorted by
+        // the current ellipsoid metric.
+        std::vector<VectorXd> prev_counter_examples = counter_examples.at(
+            std::make_pair(pair_w_distance.geomA, pair_w_distance.geomB));
+        std::sort(prev_counter_examples.begin(), prev_counter_examples.end(),
+                  [&E](const VectorXd& x, const VectorXd& y) {
+                    return (E.A() * x - E.center()).squaredNorm() <
+                           (E.A() * y - E.center()).squaredNorm();
+                  });
+        int consecutive_failures = 0;
+        int searches = 0;
+        VectorXd pair_closest(nq);
+        while (consecutive_failures <
+               options.num_collision_infeasible_samples) {
+          if (searches < ssize(prev_counter_examples)) {
+            pair_guess = prev_counter_examples[searches];
+          } else {
+            MakeGuessFeasible(P_pair, &pair_guess);
+            pair_guess = P_pair.UniformSample(&pair_generator, pair_guess);
+          }
+          ++searches;
+          if (prog.Solve(*solver, pair_guess, &pair_closest)) {
+            consecutive_failures = 0;
+            pair_counter_examples[k].emplace_back(pair_closest);
+            AddTangentToPolytope(E, pair_closest,
+                                 options.configuration_space_margin, &A_pair,
+                                 &b_pair, &num_pair_constraints);
+            P_pair = HPolyhedron(A_pair.topRows(num_pair_constraints),
+                                 b_pair.head(num_pair_constraints));
+            MakeGuessFeasible(P_pair, &pair_guess);
+            if (options.require_sample_point_is_contained &&
+                A_pair.row(num_pair_constraints - 1) * seed >
+                    b_pair(num_pair_constraints - 1)) {
+              pair_excludes_seed[k] = 1;
+              break;
+            }
+            prog.UpdatePolytope(A_pair.topRows(num_pair_constraints),
+                                b_pair.head(num_pair_constraints));
+          } else if (searches > ssize(prev_counter_examples)) {
+            // Only count the failures once we start the random guesses.
+            ++consecutive_failures;
+          }
         }
-        if (prog.Solve(*solver, guess, &closest)) {
-          if (options.meshcat && nq <= 3) {
-            point_to_draw.head(nq) = closest;
-            std::string path = fmt::format("iteration{:02}/{:03}/found",
-                                           iteration, num_points_drawn);
-            options.meshcat->SetObject(path, Sphere(0.01),
-                                       geometry::Rgba(0.8, 0.1, 0.8, 1.0));
-            options.meshcat->SetTransform(
-                path, RigidTransform<double>(point_to_draw));
+      };
+      drake::internal::ParallelFor(Parallelism(num_threads), num_pairs,
+                                   search_pair);
+
+      // Merge the counter-examples in order. A counter-example that is already
+      // excluded by the hyperplanes of earlier pairs doesn't need its own.
+      for (int k = 0; k < num_pairs && seed_point_requirement; ++k) {
+        for (const VectorXd& point : pair_counter_examples[k]) {
+          if (((A.topRows(num_constraints) * point).array() >
+               b.head(num_constraints).array())
+                  .any()) {
+            continue;
           }
-          consecutive_failures = 0;
-          new_counter_examples.emplace_back(closest);
-          AddTangentToPolytope(E, closest, options.configuration_space_margin,
+          AddTangentToPolytope(E, point, options.configuration_space_margin,
                                &A, &b, &num_constraints);
-          P_candidate =
-              HPolyhedron(A.topRows(num_constraints), b.head(num_constraints));
-          MakeGuessFeasible(P_candidate, &guess);
           if (options.require_sample_point_is_contained) {
             seed_point_requirement =
                 A.row(num_constraints - 1) * seed <= b(num_constraints - 1);
             if (!seed_point_requirement) break;
           }
-          prog.UpdatePolytope(A.topRows(num_constraints),
-                              b.head(num_constraints));
-        } else {
+        }
+        if (pair_excludes_seed[k]) {
+          seed_point_requirement = false;
+        }
+        counter_examples[std::make_pair(sorted_pairs[k].geomA,
+                                        sorted_pairs[k].geomB)] =
+            std::move(pair_counter_examples[k]);
+      }
+      if (seed_point_requirement) {
+        P_candidate =
+            HPolyhedron(A.topRows(num_constraints), b.head(num_constraints));
+        MakeGuessFeasible(P_candidate, &guess);
+      }
+    } else {
+      for (const auto& pair_w_distance : sorted_pairs) {
+        std::pair<GeometryId, GeometryId> geom_pair(pair_w_distance.geomA,
+                                                    pair_w_distance.geomB);
+        int consecutive_failures = 0;
+        internal::ClosestCollisionProgram prog(
+            same_point_constraint, *frames.at(pair_w_distance.geomA),
+            *frames.at(pair_w_distance.geomB), *sets.at(pair_w_distance.geomA),
+            *sets.at(pair_w_distance.geomB), E, A.topRows(num_constraints),
+            b.head(num_constraints));
+        std::vector<VectorXd> prev_counter_examples =
+            std::move(counter_examples[geom_pair]);
+        // Sort by the current ellipsoid metric.
+        std::sort(prev_counter_examples.begin(), prev_counter_examples.end(),
+                  [&E](const VectorXd& x, const VectorXd& y) {
+                    return (E.A() * x - E.center()).squaredNorm() <
+                           (E.A() * y - E.center()).squaredNorm();
+                  });
+        std::vector<VectorXd> new_counter_examples;
+        int counter_example_searches_for_this_pair = 0;
+        bool warned_many_searches = false;
+        while (consecutive_failures <
+               options.num_collision_infeasible_samples) {
+          // First use previous counter-examples for this pair as the seeds.
+          if (counter_example_searches_for_this_pair <
+              ssize(prev_counter_examples)) {
+            guess =
+                prev_counter_examples[counter_example_searches_for_this_pair];
+          } else {
+            MakeGuessFeasible(P_candidate, &guess);
+            guess = P_candidate.UniformSample(&generator, guess);
+          }
+          ++counter_example_searches_for_this_pair;
           if (options.meshcat && nq <= 3) {
-            point_to_draw.head(nq) = closest;
-            std::string path = fmt::format("iteration{:02}/{:03}/closest",
+            ++num_points_drawn;
+            point_to_draw.head(nq) = guess;
+            std::string path = fmt::format("iteration{:02}/{:03}/guess",
                                            iteration, num_points_drawn);
             options.meshcat->SetObject(path, Sphere(0.01),
-                                       geometry::Rgba(0.1, 0.8, 0.8, 1.0));
+                                       geometry::Rgba(0.1, 0.1, 0.1, 1.0));
             options.meshcat->SetTransform(
                 path, RigidTransform<double>(point_to_draw));
           }
-          if (counter_example_searches_for_this_pair >
-              ssize(counter_examples[geom_pair])) {
-            // Only count the failures once we start the random guesses.
-            ++consecutive_failures;
+          if (prog.Solve(*solver, guess, &closest)) {
+            if (options.meshcat && nq <= 3) {
+              point_to_draw.head(nq) = closest;
+              std::string path = fmt::format("iteration{:02}/{:03}/found",
+                                             iteration, num_points_drawn);
+              options.meshcat->SetObject(path, Sphere(0.01),
+                                         geometry::Rgba(0.8, 0.1, 0.8, 1.0));
+              options.meshcat->SetTransform(
+                  path, RigidTransform<double>(point_to_draw));
+            }
+            consecutive_failures = 0;
+            new_counter_examples.emplace_back(closest);
+            AddTangentToPolytope(E, closest, options.configuration_space_margin,
+                                 &A, &b, &num_constraints);
+            P_candidate = HPolyhedron(A.topRows(num_constraints),
+                                      b.head(num_constraints));
+            MakeGuessFeasible(P_candidate, &guess);
+            if (options.require_sample_point_is_contained) {
+              seed_point_requirement =
+                  A.row(num_constraints - 1) * seed <= b(num_constraints - 1);
+              if (!seed_point_requirement) break;
+            }
+            prog.UpdatePolytope(A.topRows(num_constraints),
+                                b.head(num_constraints));
+          } else {
+            if (options.meshcat && nq <= 3) {
+              point_to_draw.head(nq) = closest;
+              std::string path = fmt::format("iteration{:02}/{:03}/closest",
+                                             iteration, num_points_drawn);
+              options.meshcat->SetObject(path, Sphere(0.01),
+                                         geometry::Rgba(0.1, 0.8, 0.8, 1.0));
+              options.meshcat->SetTransform(
+                  path, RigidTransform<double>(point_to_draw));
+            }
+            if (counter_example_searches_for_this_pair >
+                ssize(counter_examples[geom_pair])) {
+              // Only count the failures once we start the random guesses.
+              ++consecutive_failures;
+            }
+          }
+          if (!warned_many_searches &&
+              counter_example_searches_for_this_pair -
+                      ssize(counter_examples[geom_pair]) >=
+                  10 * options.num_collision_infeasible_samples) {
+            warned_many_searches = true;
+            log()->info(
+                " Checking {} against {} has already required {} "
+                "counter-example searches; still searching...",
+                inspector.GetName(pair_w_distance.geomA),
+                inspector.GetName(pair_w_distance.geomB),
+                counter_example_searches_for_this_pair);
           }
         }
-        if (!warned_many_searches &&
-            counter_example_searches_for_this_pair -
-                    ssize(counter_examples[geom_pair]) >=
-                10 * options.num_collision_infeasible_samples) {
-          warned_many_searches = true;
+        counter_examples[geom_pair] = std::move(new_counter_examples);
+        if (warned_many_searches) {
           log()->info(
-              " Checking {} against {} has already required {} counter-example "
-              "searches; still searching...",
+              " Finished checking {} against {} after {} counter-example "
+              "searches.",
               inspector.GetName(pair_w_distance.geomA),
               inspector.GetName(pair_w_distance.geomB),
               counter_example_searches_for_this_pair);
         }
+        if (!seed_point_requirement) break;
       }
-      counter_examples[geom_pair] = std::move(new_counter_examples);
-      if (warned_many_searches) {
-        log()->info(
-            " Finished checking {} against {} after {} counter-example "
-            "searches.",
-            inspector.GetName(pair_w_distance.geomA),
-            inspector.GetName(pair_w_distance.geomB),
-            counter_example_searches_for_this_pair);
-      }
-      if (!seed_point_requirement) break;
     }
 
     if (!seed_point_requirement) break;
@@ -839,6 +989,91 @@ HPolyhedron IrisInConfigurationSpace(const MultibodyPlant<double>& plant,
   return P;
 }
 
+std::vector<std::optional<HPolyhedron>> IrisInConfigurationSpaceFromSeeds(
+    const MultibodyPlant<double>& plant, const Context<double>& root_context,
+    const std::vector<VectorXd>& seeds, const IrisOptions& options,
+    const IrisFromSeedsOptions& seeds_options) {
+  DRAKE_THROW_UNLESS(root_context.is_root_context());
+  plant.ValidateContext(plant.GetMyContextFromRoot(root_context));
+  for (const VectorXd& seed : seeds) {
+    DRAKE_THROW_UNLESS(seed.size() == plant.num_positions());
+  }
+  DRAKE_THROW_UNLESS(seeds_options.completed_region_scale >= 0.0);
+
+  const int num_seeds = ssize(seeds);
+  int num_threads = std::max(
+      1, std::min(seeds_options.parallelism.num_threads(), num_seeds));
+  if (num_threads > 1 && options.prog_with_additional_constraints) {
+    log()->info(
+        "IrisInConfigurationSpaceFromSeeds(): processing seeds serially since "
+        "options.prog_with_additional_constraints is set");
+    num_threads = 1;
+  }
+  if (num_threads > 1 &&
+      !(SnoptSolver::is_enabled() && SnoptSolver::is_available())) {
+    log()->info(
+        "IrisInConfigurationSpaceFromSeeds(): processing seeds serially since "
+        "SNOPT is not available");
+    num_threads = 1;
+  }
+  IrisOptions thread_options = options;
+  if (num_threads > 1) {
+    thread_options.meshcat = nullptr;
+  }
+  log()->debug("IrisInConfigurationSpaceFromSeeds uses {} thread(s)",
+               num_threads);
+
+  std::vector<std::optional<HPolyhedron>> regions(num_seeds);
+  // The regions completed so far, when coordinating seeds.
+  std::mutex completed_regions_mutex;
+  std::vector<HPolyhedron> completed_regions;
+
+  drake::internal::ParallelFor(Parallelism(num_threads), num_seeds, [&](int i) {
+    const VectorXd& seed = seeds[i];
+    IrisOptions seed_options = thread_options;
+    if (seeds_options.avoid_completed_regions) {
+      std::vector<HPolyhedron> completed;
+      {
+        std::lock_guard<std::mutex> lock(completed_regions_mutex);
+        completed = completed_regions;
+      }
+      const bool covered =
+          std::any_of(completed.begin(), completed.end(),
+                      [&seed](const HPolyhedron& region) {
+                        return region.PointInSet(seed);
+                      });
+      if (covered) {
+        log()->info(
+            "IrisInConfigurationSpaceFromSeeds(): skipping seed {}, which is "
+            "inside a completed region",
+            i);
+        return;
+      }
+      for (const HPolyhedron& region : completed) {
+        seed_options.configuration_obstacles.emplace_back(
+            region.Scale(seeds_options.completed_region_scale));
+      }
+    }
+    try {
+      std::unique_ptr<Context<double>> context = root_context.Clone();
+      Context<double>& plant_context =
+          plant.GetMyMutableContextFromRoot(context.get());
+      plant.SetPositions(&plant_context, seed);
+      HPolyhedron region =
+          IrisInConfigurationSpace(plant, plant_context, seed_options);
+      if (seeds_options.avoid_completed_regions) {
+        std::lock_guard<std::mutex> lock(completed_regions_mutex);
+        completed_regions.push_back(region);
+      }
+      regions[i] = std::move(region);
+    } catch (const std::exception& e) {
+      log()->warn("IrisInConfigurationSpaceFromSeeds(): seed {} failed: {}", i,
+                  e.what());
+    }
+  });
+  return regions;
+}
+
 }  // namespace optimization
 }  // namespace geometry
 }  // namespace drake
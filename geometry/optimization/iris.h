@@ -7,6 +7,7 @@
 #include <vector>
 
 #include "drake/common/name_value.h"
+#include "drake/common/parallelism.h"
 #include "drake/geometry/meshcat.h"
 #include "drake/geometry/optimization/convex_set.h"
 #include "drake/geometry/optimization/hpolyhedron.h"
@@ -129,6 +130,16 @@ struct IrisOptions {
   currently only happens in IrisInConfigurationSpace and when the
   configuration space is <= 3 dimensional.*/
   std::shared_ptr<Meshcat> meshcat{};
+
+  /** How many threads IrisInConfigurationSpace may use to search for
+  counter-examples for the collision pairs. With more than one thread, the
+  pairs are searched concurrently, each starting from the region at the start
+  of the search; the counter-examples are then merged in order. The region is
+  certified as thoroughly as with one thread, but it may differ (e.g., have
+  more faces). The searches run serially when SNOPT is not available, since
+  the fallback solver is not thread safe. The meshcat debugging visualizations
+  are only drawn by the serial search. */
+  Parallelism parallelism{Parallelism::None()};
 };
 
 /** The IRIS (Iterative Region Inflation by Semidefinite programming) algorithm,
@@ -210,6 +221,78 @@ HPolyhedron IrisInConfigurationSpace(
     const systems::Context<double>& context,
     const IrisOptions& options = IrisOptions());
 
+/** Configuration options for IrisInConfigurationSpaceFromSeeds().
+
+@ingroup geometry_optimization
+*/
+struct IrisFromSeedsOptions {
+  /** Passes this object to an Archive.
+  Refer to @ref yaml_serialization "YAML Serialization" for background.
+  Note: This only serializes options that are YAML built-in types. */
+  template <typename Archive>
+  void Serialize(Archive* a) {
+    a->Visit(DRAKE_NVP(avoid_completed_regions));
+    a->Visit(DRAKE_NVP(completed_region_scale));
+  }
+
+  /** How many seeds may be processed concurrently. Each thread grows one
+  region at a time, with its own copy of the context and its own optimization
+  programs. */
+  Parallelism parallelism{Parallelism::Max()};
+
+  /** If true, each seed is coordinated with the regions that have already been
+  completed when its processing starts: a seed that lies inside a completed
+  region is skipped, and otherwise the completed regions (scaled by
+  `completed_region_scale`) are added to the `configuration_obstacles` of its
+  IRIS problem, so that its region grows into space that is not yet covered.
+  When seeds are processed in parallel, which regions are complete depends on
+  the timing of the threads, so the results are not deterministic. */
+  bool avoid_completed_regions{false};
+
+  /** The scale (see HPolyhedron::Scale()) applied to completed regions before
+  they become obstacles for later seeds. Scaling them down lets neighboring
+  regions overlap, which is needed to connect them (e.g., in a
+  GraphOfConvexSets). */
+  double completed_region_scale{0.95};
+};
+
+/** Runs IrisInConfigurationSpace() for each of the given @p seeds, growing
+the regions concurrently (see IrisFromSeedsOptions::parallelism).
+
+@param plant describes the kinematics of configuration space.  It must be
+connected to a SceneGraph in a systems::Diagram.
+@param root_context is the root context of the Diagram that contains the
+@p plant. Each region is grown in its own copy of this context, with the plant
+positions set to its seed.
+@param seeds are the seed configurations, each of size
+`plant.num_positions()`.
+@param options are the options passed to IrisInConfigurationSpace() for each
+seed.
+@param seeds_options configures the parallelism and the coordination between
+seeds.
+@returns one entry per seed: the region grown from that seed, or nullopt if the
+seed was skipped (it was inside a completed region) or if
+IrisInConfigurationSpace() threw for that seed (e.g., the seed is in
+collision); the reason is logged as a warning. Other seeds are unaffected.
+
+The seeds are processed serially, whatever the requested parallelism, when
+`options.prog_with_additional_constraints` is set (its constraints, e.g., those
+of an InverseKinematics program, are generally not safe to evaluate
+concurrently) or when SNOPT is not available (the fallback solver is not safe
+to run concurrently). `options.meshcat` is ignored when seeds are processed in
+parallel.
+
+@throws std::exception if any seed has the wrong size, or if @p root_context is
+not a root context.
+@ingroup geometry_optimization
+*/
+std::vector<std::optional<HPolyhedron>> IrisInConfigurationSpaceFromSeeds(
+    const multibody::MultibodyPlant<double>& plant,
+    const systems::Context<double>& root_context,
+    const std::vector<Eigen::VectorXd>& seeds,
+    const IrisOptions& options = IrisOptions(),
+    const IrisFromSeedsOptions& seeds_options = IrisFromSeedsOptions());
+
 /** Defines a standardized representation for (named) IrisRegions, which can be
 serialized in both C++ and Python. */
 typedef std::map<std::string, HPolyhedron> IrisRegions;
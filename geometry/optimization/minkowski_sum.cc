@@ -7,6 +7,8 @@
 #include "drake/common/copyable_unique_ptr.h"
 #include "drake/geometry/optimization/hpolyhedron.h"
 #include "drake/geometry/optimization/hyperellipsoid.h"
+#include "drake/geometry/optimization/hyperrectangle.h"
+#include "drake/geometry/optimization/point.h"
 #include "drake/solvers/mathematical_program.h"
 #include "drake/solvers/solve.h"
 
@@ -149,7 +151,42 @@ std::optional<VectorXd> MinkowskiSum::DoMaybeGetFeasiblePoint() const {
 }
 
 bool MinkowskiSum::DoPointInSet(const Eigen::Ref<const VectorXd>& x,
-                                double) const {
+                                double tol) const {
+  // Fast paths that need no solver: points only shift the sum, so with at
+  // most one term that is not a point we can ask that term directly; and a
+  // sum of boxes (and points) is the box of the summed bounds.
+  VectorXd offset = VectorXd::Zero(ambient_dimension());
+  VectorXd lb = VectorXd::Zero(ambient_dimension());
+  VectorXd ub = VectorXd::Zero(ambient_dimension());
+  const ConvexSet* non_point = nullptr;
+  int num_non_points = 0;
+  bool all_boxes = true;
+  for (const auto& s : sets_) {
+    if (const auto* point = dynamic_cast<const Point*>(s.get())) {
+      offset += point->x();
+      continue;
+    }
+    non_point = s.get();
+    ++num_non_points;
+    if (const auto* box = dynamic_cast<const Hyperrectangle*>(s.get())) {
+      lb += box->lb();
+      ub += box->ub();
+    } else {
+      all_boxes = false;
+    }
+  }
+  if (num_non_points == 0) {
+    return ((x - offset).array().abs() <= tol).all();
+  }
+  if (num_non_points == 1) {
+    return non_point->PointInSet(x - offset, tol);
+  }
+  if (all_boxes) {
+    const VectorXd y = x - offset;
+    return (y.array() >= lb.array() - tol).all() &&
+           (y.array() <= ub.array() + tol).all();
+  }
+
   // TODO(russt): Figure out if there is a general way to communicate tol
   // to/through the solver.
   MathematicalProgram prog;
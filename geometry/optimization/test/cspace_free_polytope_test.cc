@@ -58,6 +58,41 @@ TEST_F(CIrisToyRobotTest, CspaceFreePolytopeGenerateRationals) {
   }
 }
 
+TEST_F(CIrisToyRobotTest, CspaceFreePolytopeGenerateRationalsInParallel) {
+  const Eigen::Vector3d q_star(0, 0, 0);
+  CspaceFreePolytope::Options options;
+  options.parallelism = Parallelism(3);
+  CspaceFreePolytopeTester tester(plant_, scene_graph_,
+                                  SeparatingPlaneOrder::kAffine, q_star,
+                                  options);
+  const CspaceFreePolytope& dut = tester.cspace_free_polytope();
+
+  // The rationals computed in parallel are the same as the ones computed
+  // serially, in the same order.
+  std::map<int, const CSpaceSeparatingPlane<symbolic::Variable>*>
+      separating_planes;
+  for (int i = 0; i < ssize(dut.separating_planes()); ++i) {
+    separating_planes.emplace(i, &(dut.separating_planes()[i]));
+  }
+  std::vector<PlaneSeparatesGeometries> expected;
+  internal::GenerateRationals(separating_planes, dut.y_slack(), q_star,
+                              dut.rational_forward_kin(), &expected);
+  const std::vector<PlaneSeparatesGeometries>& plane_geometries =
+      tester.plane_geometries();
+  ASSERT_EQ(plane_geometries.size(), expected.size());
+  for (int i = 0; i < ssize(expected); ++i) {
+    EXPECT_EQ(plane_geometries[i].plane_index, expected[i].plane_index);
+    for (PlaneSide plane_side : {PlaneSide::kPositive, PlaneSide::kNegative}) {
+      const auto& rationals = plane_geometries[i].rationals(plane_side);
+      const auto& expected_rationals = expected[i].rationals(plane_side);
+      ASSERT_EQ(rationals.size(), expected_rationals.size());
+      for (int j = 0; j < ssize(rationals); ++j) {
+        EXPECT_TRUE(rationals[j].EqualTo(expected_rationals[j]));
+      }
+    }
+  }
+}
+
 TEST_F(CIrisToyRobotTest, FindRedundantInequalities) {
   // Test CspaceFreePolytope::FindRedundantInequalities.
   const Eigen::Vector3d q_star(0, 0, 0);
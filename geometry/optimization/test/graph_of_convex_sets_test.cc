@@ -1140,6 +1140,57 @@ TEST_F(ThreeBoxes, SolveConvexRestriction) {
   }
 }
 
+// Updating the coefficients of costs and constraints in place and reusing the
+// program gives the same results as formulating the program again.
+TEST_F(ThreeBoxes, ReuseProgram) {
+  const Vector2d b{.5, .3};
+  source_->AddConstraint(source_->x() == -b);
+  auto target_constraint = std::make_shared<LinearEqualityConstraint>(
+      Matrix2d::Identity(), b);
+  e_on_->AddConstraint(Binding<solvers::Constraint>(target_constraint,
+                                                    e_on_->xv()));
+  Matrix<double, 2, 4> A;
+  A << -Matrix2d::Identity(), Matrix2d::Identity();
+  auto edge_cost = std::make_shared<solvers::L1NormCost>(A, Vector2d::Zero());
+  e_on_->AddCost(Binding<solvers::Cost>(edge_cost, {e_on_->xu(), e_on_->xv()}));
+  e_off_->AddCost(
+      Binding<solvers::Cost>(edge_cost, {e_off_->xu(), e_off_->xv()}));
+
+  options_.preprocessing = true;
+  options_.reuse_program = true;
+  GraphOfConvexSetsOptions rebuild_options = options_;
+  rebuild_options.reuse_program = false;
+  auto check_reused_result = [&]() {
+    const MathematicalProgramResult result =
+        g_.SolveShortestPath(*source_, *target_, options_);
+    const MathematicalProgramResult expected =
+        g_.SolveShortestPath(*source_, *target_, rebuild_options);
+    EXPECT_TRUE(result.is_success());
+    EXPECT_TRUE(expected.is_success());
+    EXPECT_NEAR(result.get_optimal_cost(), expected.get_optimal_cost(), 1e-6);
+    EXPECT_TRUE(CompareMatrices(target_->GetSolution(result),
+                                target_->GetSolution(expected), 1e-6));
+    return result;
+  };
+
+  MathematicalProgramResult result = check_reused_result();
+  EXPECT_NEAR(result.get_optimal_cost(), 1.6, 1e-6);
+  EXPECT_TRUE(CompareMatrices(target_->GetSolution(result), b, 1e-6));
+
+  // Move the target and double the edge cost.
+  const Vector2d new_b{-.2, .4};
+  target_constraint->UpdateCoefficients(Matrix2d::Identity(), new_b);
+  edge_cost->UpdateCoefficients(2 * A, Vector2d::Zero());
+  result = check_reused_result();
+  EXPECT_NEAR(result.get_optimal_cost(), 2 * 1.0, 1e-6);
+  EXPECT_TRUE(CompareMatrices(target_->GetSolution(result), new_b, 1e-6));
+
+  // Structural changes cause the program to be formulated again.
+  e_on_->AddCost((e_on_->xv() - e_on_->xu()).dot(Vector2d(1, 0)) + 1);
+  result = check_reused_result();
+  EXPECT_NEAR(result.get_optimal_cost(), 2 * 1.0 + 1.3, 1e-6);
+}
+
 // A simple shortest-path problem where the continuous variables do not affect
 // the problem (they are all equality constrained).  The GraphOfConvexSets class
 // should still solve the problem, and the convex relaxation should be optimal.
@@ -1439,6 +1490,15 @@ TEST_F(PreprocessShortestPathTest, CheckEdges) {
   }
 }
 
+// The edges are checked concurrently, with the same result.
+TEST_F(PreprocessShortestPathTest, Parallelism) {
+  options_.parallelism = Parallelism::None();
+  const std::set<EdgeId> serial =
+      PreprocessShortestPath(v_[0]->id(), v_[5]->id());
+  options_.parallelism = Parallelism(3);
+  EXPECT_EQ(PreprocessShortestPath(v_[0]->id(), v_[5]->id()), serial);
+}
+
 TEST_F(PreprocessShortestPathTest, CheckResults) {
   options_.preprocessing = false;
   auto result1 = g_.SolveShortestPath(*v_[0], *v_[5], options_);
@@ -1562,6 +1622,18 @@ GTEST_TEST(ShortestPathTest, RoundedSolution) {
   EXPECT_LT(relaxed_result.get_optimal_cost(),
             rounded_result.get_optimal_cost());
 
+  // Solving the rounded restrictions concurrently does not change the result.
+  options.parallelism = Parallelism(2);
+  auto parallel_result = spp.SolveShortestPath(*source, *target, options);
+  ASSERT_TRUE(parallel_result.is_success());
+  EXPECT_NEAR(parallel_result.get_optimal_cost(),
+              rounded_result.get_optimal_cost(), 1e-6);
+  options.parallelism = Parallelism::None();
+  auto serial_result = spp.SolveShortestPath(*source, *target, options);
+  ASSERT_TRUE(serial_result.is_success());
+  EXPECT_NEAR(serial_result.get_optimal_cost(),
+              rounded_result.get_optimal_cost(), 1e-6);
+
   const auto& edges = spp.Edges();
   for (size_t ii = 0; ii < edges.size(); ++ii) {
     if (ii < 6) {
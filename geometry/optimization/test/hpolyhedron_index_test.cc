@@ -0,0 +1,99 @@
+#include "drake/geometry/optimization/hpolyhedron_index.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/expect_throws_message.h"
+
+namespace drake {
+namespace geometry {
+namespace optimization {
+namespace {
+
+using Eigen::MatrixXd;
+using Eigen::Vector2d;
+using Eigen::Vector3d;
+using testing::ElementsAre;
+using testing::IsEmpty;
+
+// A row of `num_boxes` overlapping boxes along the x axis; box i spans
+// [i, i + 1.5] × [0, 1].
+std::vector<HPolyhedron> MakeBoxes(int num_boxes) {
+  std::vector<HPolyhedron> boxes;
+  for (int i = 0; i < num_boxes; ++i) {
+    boxes.push_back(
+        HPolyhedron::MakeBox(Vector2d(i, 0), Vector2d(i + 1.5, 1.0)));
+  }
+  return boxes;
+}
+
+GTEST_TEST(HPolyhedronIndexTest, FindRegions) {
+  const int kNumBoxes = 20;
+  const HPolyhedronIndex dut(MakeBoxes(kNumBoxes));
+  EXPECT_EQ(dut.regions().size(), kNumBoxes);
+  EXPECT_EQ(dut.ambient_dimension(), 2);
+
+  EXPECT_THAT(dut.FindRegionsContainingPoint(Vector2d(0.5, 0.5)),
+              ElementsAre(0));
+  EXPECT_THAT(dut.FindRegionsContainingPoint(Vector2d(7.2, 0.5)),
+              ElementsAre(6, 7));
+  EXPECT_THAT(dut.FindRegionsContainingPoint(Vector2d(7.2, 1.5)), IsEmpty());
+  EXPECT_THAT(dut.FindRegionsContainingPoint(Vector2d(-1, 0.5)), IsEmpty());
+  // The tolerance is applied as in PointInSet().
+  EXPECT_THAT(dut.FindRegionsContainingPoint(Vector2d(-0.1, 0.5), 0.2),
+              ElementsAre(0));
+
+  // The index agrees with checking every region, for points inside and
+  // outside of the regions, in serial and in parallel.
+  MatrixXd points(2, 200);
+  for (int i = 0; i < points.cols(); ++i) {
+    points.col(i) = Vector2d(-1.0 + 0.113 * i, -0.3 + 0.0079 * i);
+  }
+  for (const Parallelism parallelism :
+       {Parallelism::None(), Parallelism(2)}) {
+    const std::vector<std::vector<int>> found =
+        dut.FindRegionsContainingPoints(points, 0.0, parallelism);
+    ASSERT_EQ(found.size(), points.cols());
+    for (int i = 0; i < points.cols(); ++i) {
+      std::vector<int> expected;
+      for (int j = 0; j < kNumBoxes; ++j) {
+        if (dut.regions()[j].PointInSet(points.col(i))) {
+          expected.push_back(j);
+        }
+      }
+      EXPECT_EQ(found[i], expected);
+    }
+  }
+
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      dut.FindRegionsContainingPoint(Vector3d::Zero()), ".*ambient.*");
+}
+
+GTEST_TEST(HPolyhedronIndexTest, Unbounded) {
+  // The halfspace x ≤ 0 is unbounded, but is still found.
+  std::vector<HPolyhedron> regions = MakeBoxes(6);
+  regions.emplace_back(Eigen::RowVector2d(1, 0), Vector1d(0));
+  const HPolyhedronIndex dut(std::move(regions));
+  EXPECT_THAT(dut.FindRegionsContainingPoint(Vector2d(-100, 1e6)),
+              ElementsAre(6));
+  EXPECT_THAT(dut.FindRegionsContainingPoint(Vector2d(0, 0.5)),
+              ElementsAre(0, 6));
+}
+
+GTEST_TEST(HPolyhedronIndexTest, Empty) {
+  const HPolyhedronIndex dut({});
+  EXPECT_EQ(dut.ambient_dimension(), 0);
+  EXPECT_THAT(dut.FindRegionsContainingPoint(Vector2d::Zero()), IsEmpty());
+}
+
+GTEST_TEST(HPolyhedronIndexTest, MismatchedDimensions) {
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      HPolyhedronIndex({HPolyhedron::MakeUnitBox(2),
+                        HPolyhedron::MakeUnitBox(3)}),
+      ".*ambient_dimension.*");
+}
+
+}  // namespace
+}  // namespace optimization
+}  // namespace geometry
+}  // namespace drake
@@ -7,6 +7,7 @@
 #include "drake/common/eigen_types.h"
 #include "drake/common/fmt_eigen.h"
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
 #include "drake/common/test_utilities/maybe_pause_for_user.h"
 #include "drake/common/yaml/yaml_io.h"
 #include "drake/geometry/geometry_frame.h"
@@ -84,6 +85,13 @@ GTEST_TEST(HPolyhedronTest, UnitBoxTest) {
   EXPECT_TRUE(H.PointInSet(Vector3d(-1.0, 1.0, 1.0)));
   EXPECT_FALSE(H.PointInSet(Vector3d(1.1, 1.2, 0.4)));
 
+  // Test PointsInSet.
+  const Matrix3d points = (Matrix3d() << Vector3d(.8, .3, -.9),
+                           Vector3d(-1.0, 1.0, 1.0), Vector3d(1.1, 1.2, 0.4))
+                              .finished();
+  EXPECT_EQ(H.PointsInSet(points), std::vector<bool>({true, true, false}));
+  EXPECT_EQ(H.PointsInSet(points, 0.2), std::vector<bool>({true, true, true}));
+
   // Test AddPointInSetConstraints.
   EXPECT_TRUE(CheckAddPointInSetConstraints(H, Vector3d(.8, .3, -.9)));
   EXPECT_TRUE(CheckAddPointInSetConstraints(H, Vector3d(-1.0, 1.0, 1.0)));
@@ -893,6 +901,30 @@ GTEST_TEST(HPolyhedronTest, ReduceL1LInfBallIntersection) {
   EXPECT_TRUE(CompareMatrices(reduced_polyhedron.b(), L1_ball.b()));
 }
 
+// The unit box, with each face duplicated and with some rows that are far from
+// the box (which the bounding box check discards without an LP per row).
+GTEST_TEST(HPolyhedronTest, FindRedundantParallel) {
+  const HPolyhedron box = HPolyhedron::MakeUnitBox(3);
+  MatrixXd A(3 * box.A().rows(), 3);
+  VectorXd b(A.rows());
+  A << box.A(), box.A(), box.A();
+  b << box.b(), box.b(), 5 * box.b();
+  const HPolyhedron H(A, b);
+
+  const std::set<int> serial = H.FindRedundant();
+  // One of each pair of duplicates, and all of the far rows.
+  EXPECT_EQ(serial.size(), 12);
+  for (int i = 12; i < 18; ++i) {
+    EXPECT_EQ(serial.count(i), 1);
+  }
+  EXPECT_EQ(H.FindRedundant(1E-9, Parallelism(2)), serial);
+
+  const HPolyhedron reduced = H.ReduceInequalities(1E-9, Parallelism(2));
+  EXPECT_EQ(reduced.A().rows(), 6);
+  EXPECT_TRUE(reduced.ContainedIn(box));
+  EXPECT_TRUE(box.ContainedIn(reduced));
+}
+
 GTEST_TEST(HPolyhedronTest, ReduceToInfeasibleSet) {
   Eigen::MatrixXd A{5, 3};
   Eigen::VectorXd b{5};
@@ -1093,6 +1125,63 @@ GTEST_TEST(HPolyhedronTest, UniformSampleTest) {
               N / 10, kTol);
 }
 
+GTEST_TEST(HPolyhedronTest, UniformSamplesTest) {
+  Matrix<double, 4, 2> A;
+  Vector4d b;
+  // clang-format off
+  A << -2, -1,  // 2x + y ≥ 4
+        2,  1,  // 2x + y ≤ 6
+       -1,  2,  // x - 2y ≥ 2
+        1, -2;  // x - 2y ≤ 8
+  b << -4, 6, -2, 8;
+  // clang-format on
+  HPolyhedron H(A, b);
+
+  // Run 100 chains from the Chebyshev center.
+  RandomGenerator generator(1234);
+  const int kNumChains{100};
+  const int kSamplesPerChain{100};
+  const int N{kNumChains * kSamplesPerChain};
+  const MatrixXd initial_samples =
+      H.ChebyshevCenter().replicate(1, kNumChains);
+  const MatrixXd samples = H.UniformSamples(&generator, initial_samples,
+                                            kSamplesPerChain, 20, 2);
+  ASSERT_EQ(samples.rows(), 2);
+  ASSERT_EQ(samples.cols(), N);
+
+  // Check that they are all in the polyhedron.
+  for (int i = 0; i < A.rows(); ++i) {
+    EXPECT_LE((A.row(i) * samples).maxCoeff(), b(i) + 1e-12);
+  }
+
+  // Check the same statistics as UniformSampleTest.
+  const double kTol = 0.05 * N;
+  EXPECT_NEAR(((2 * samples.row(0) + samples.row(1)).array() >= 5.0).count(),
+              0.5 * N, kTol);
+  EXPECT_NEAR(((samples.row(0) - 2 * samples.row(1)).array() >= 5.0).count(),
+              0.5 * N, kTol);
+  EXPECT_NEAR((samples.row(0).array() >= 3 && samples.row(0).array() <= 3.5 &&
+               samples.row(1).array() >= -1.5 && samples.row(1).array() <= -1)
+                  .count(),
+              N / 10, kTol);
+
+  // With no mixing steps, the first samples are the initial samples.
+  EXPECT_TRUE(CompareMatrices(
+      H.UniformSamples(&generator, initial_samples, 2, 0).leftCols(kNumChains),
+      initial_samples));
+
+  // A sample outside of the set throws.
+  MatrixXd bad_samples = initial_samples.leftCols(2);
+  bad_samples.col(1) << 0, 0;
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      H.UniformSamples(&generator, bad_samples, 1),
+      ".*Hit and Run algorithm failed.*initial_samples.col\\(1\\).*");
+  DRAKE_EXPECT_THROWS_MESSAGE(H.UniformSamples(&generator, initial_samples, 1,
+                                               /* mixing_steps = */ 10,
+                                               /* thinning_steps = */ 0),
+                              ".*thinning_steps.*");
+}
+
 // Test the case where the sample point is outside the region, but the max
 // threshold can be smaller than the min threshold. (This was a bug uncovered
 // by hammering on this code from IRIS).
@@ -82,6 +82,10 @@ GTEST_TEST(HyperellipsoidTest, UnitSphereTest) {
   EXPECT_TRUE(E.PointInSet(in2_W));
   EXPECT_FALSE(E.PointInSet(out1_W));
   EXPECT_FALSE(E.PointInSet(out2_W));
+  Eigen::Matrix<double, 3, 4> points_W;
+  points_W << in1_W, in2_W, out1_W, out2_W;
+  EXPECT_EQ(E.PointsInSet(points_W),
+            std::vector<bool>({true, true, false, false}));
 
   EXPECT_TRUE(CheckAddPointInSetConstraints(E, in1_W));
   EXPECT_TRUE(CheckAddPointInSetConstraints(E, in2_W));
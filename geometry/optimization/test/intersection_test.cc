@@ -10,6 +10,8 @@
 #include "drake/common/test_utilities/expect_throws_message.h"
 #include "drake/geometry/geometry_frame.h"
 #include "drake/geometry/optimization/hpolyhedron.h"
+#include "drake/geometry/optimization/hyperellipsoid.h"
+#include "drake/geometry/optimization/hyperrectangle.h"
 #include "drake/geometry/optimization/point.h"
 #include "drake/geometry/optimization/test_utilities.h"
 #include "drake/geometry/optimization/vpolytope.h"
@@ -147,6 +149,29 @@ GTEST_TEST(IntersectionTest, BoundedTest) {
   EXPECT_FALSE(S2.IsBounded());
 }
 
+// Intersections of boxes, polyhedra, and points are decided without the
+// generic program.
+GTEST_TEST(IntersectionTest, EmptyFastPaths) {
+  const Hyperrectangle B1(Vector2d{0, 0}, Vector2d{1, 1});
+  const Hyperrectangle B2(Vector2d{0.5, 0.5}, Vector2d{2, 2});
+  const Hyperrectangle B3(Vector2d{1.5, 0}, Vector2d{2, 1});
+  EXPECT_FALSE(Intersection(B1, B2).IsEmpty());
+  EXPECT_TRUE(Intersection(B1, B3).IsEmpty());
+
+  const HPolyhedron H = HPolyhedron::MakeL1Ball(2);
+  EXPECT_FALSE(Intersection(B1, H).IsEmpty());
+  EXPECT_TRUE(Intersection(B3, H).IsEmpty());
+
+  const Hyperellipsoid E = Hyperellipsoid::MakeUnitBall(2);
+  EXPECT_FALSE(Intersection(E, Point(Vector2d{0.5, 0.5})).IsEmpty());
+  EXPECT_TRUE(Intersection(E, Point(Vector2d{1, 1})).IsEmpty());
+
+  // Unbounded polyhedra whose intersection is bounded.
+  const HPolyhedron H1(Matrix2d::Identity(), Vector2d{1, 1});
+  const HPolyhedron H2(-Matrix2d::Identity(), Vector2d{1, 1});
+  EXPECT_TRUE(Intersection(MakeConvexSets(H1, H2, H1)).IsBounded());
+}
+
 GTEST_TEST(IntersectionTest, CloneTest) {
   const Point P1(Vector2d{0.1, 1.2});
   HPolyhedron H1 = HPolyhedron::MakeBox(Vector2d{0, 0}, Vector2d{2, 2});
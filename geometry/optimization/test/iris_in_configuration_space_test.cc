@@ -126,6 +126,80 @@ GTEST_TEST(IrisInConfigurationSpaceTest, BoxesPrismatic) {
                               "The seed point is in collision.*");
 }
 
+// The three boxes again, searching for the collision pairs' counter-examples
+// in parallel.
+GTEST_TEST(IrisInConfigurationSpaceTest, BoxesPrismaticParallel) {
+  const Vector1d sample = Vector1d::Zero();
+  IrisOptions options;
+  options.parallelism = Parallelism(2);
+  HPolyhedron region = IrisFromUrdf(boxes_urdf, sample, options);
+
+  EXPECT_EQ(region.ambient_dimension(), 1);
+
+  const double kTol = 1e-3;  // due to ibex's rel_eps_f.
+  const double qmin = -1.0 + options.configuration_space_margin,
+               qmax = 1.0 - options.configuration_space_margin;
+  EXPECT_TRUE(region.PointInSet(Vector1d{qmin + kTol}));
+  EXPECT_TRUE(region.PointInSet(Vector1d{qmax - kTol}));
+  EXPECT_FALSE(region.PointInSet(Vector1d{qmin - kTol}));
+  EXPECT_FALSE(region.PointInSet(Vector1d{qmax + kTol}));
+}
+
+// Several seeds for the three boxes, grown concurrently.
+GTEST_TEST(IrisInConfigurationSpaceTest, FromSeeds) {
+  systems::DiagramBuilder<double> builder;
+  multibody::MultibodyPlant<double>& plant =
+      multibody::AddMultibodyPlantSceneGraph(&builder, 0.0);
+  multibody::Parser(&plant).AddModelsFromString(boxes_urdf, "urdf");
+  plant.Finalize();
+  auto diagram = builder.Build();
+  auto context = diagram->CreateDefaultContext();
+
+  // The last seed is in collision.
+  const std::vector<Eigen::VectorXd> seeds{Vector1d{0.0}, Vector1d{-0.5},
+                                           Vector1d{1.1}};
+  IrisOptions options;
+  IrisFromSeedsOptions seeds_options;
+  seeds_options.parallelism = Parallelism(2);
+  const std::vector<std::optional<HPolyhedron>> regions =
+      IrisInConfigurationSpaceFromSeeds(plant, *context, seeds, options,
+                                        seeds_options);
+  ASSERT_EQ(regions.size(), 3);
+  EXPECT_FALSE(regions[2].has_value());
+
+  // Each region matches the one grown from its seed alone.
+  const double kTol = 1e-3;  // due to ibex's rel_eps_f.
+  const double qmin = -1.0 + options.configuration_space_margin,
+               qmax = 1.0 - options.configuration_space_margin;
+  for (int i = 0; i < 2; ++i) {
+    ASSERT_TRUE(regions[i].has_value());
+    const HPolyhedron expected = IrisFromUrdf(boxes_urdf, seeds[i], options);
+    for (const double q : {qmin, qmax}) {
+      for (const double offset : {-kTol, kTol}) {
+        EXPECT_EQ(regions[i]->PointInSet(Vector1d{q + offset}),
+                  expected.PointInSet(Vector1d{q + offset}));
+      }
+    }
+  }
+
+  // When coordinating the seeds serially, the second seed is inside the first
+  // seed's region, and so is skipped.
+  seeds_options.parallelism = Parallelism::None();
+  seeds_options.avoid_completed_regions = true;
+  const std::vector<std::optional<HPolyhedron>> coordinated =
+      IrisInConfigurationSpaceFromSeeds(plant, *context, seeds, options,
+                                        seeds_options);
+  ASSERT_EQ(coordinated.size(), 3);
+  EXPECT_TRUE(coordinated[0].has_value());
+  EXPECT_FALSE(coordinated[1].has_value());
+  EXPECT_FALSE(coordinated[2].has_value());
+
+  // The context must be the root context.
+  EXPECT_THROW(IrisInConfigurationSpaceFromSeeds(
+                   plant, plant.GetMyContextFromRoot(*context), seeds),
+               std::exception);
+}
+
 // Three boxes again, but the configuration-space margin is larger than 1/2 the
 // gap.
 GTEST_TEST(IrisInConfigurationSpaceTest, ConfigurationSpaceMargin) {
@@ -9,6 +9,8 @@
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
 #include "drake/geometry/geometry_frame.h"
 #include "drake/geometry/optimization/hpolyhedron.h"
+#include "drake/geometry/optimization/hyperellipsoid.h"
+#include "drake/geometry/optimization/hyperrectangle.h"
 #include "drake/geometry/optimization/point.h"
 #include "drake/geometry/optimization/test_utilities.h"
 #include "drake/geometry/optimization/vpolytope.h"
@@ -183,6 +185,29 @@ GTEST_TEST(MinkowskiSumTest, TwoBoxes) {
   EXPECT_TRUE(S.PointInSet(S.MaybeGetFeasiblePoint().value()));
 }
 
+// Sums of points, boxes, and at most one other set are decided without a
+// solver.
+GTEST_TEST(MinkowskiSumTest, PointInSetFastPaths) {
+  const Point P(Vector2d{1, 2});
+  const Hyperrectangle B1(Vector2d{0, 0}, Vector2d{1, 1});
+  const Hyperrectangle B2(Vector2d{-1, 2}, Vector2d{0, 3});
+  const Hyperellipsoid E = Hyperellipsoid::MakeUnitBall(2);
+
+  const MinkowskiSum points(P, P);
+  EXPECT_TRUE(points.PointInSet(Vector2d{2, 4}));
+  EXPECT_FALSE(points.PointInSet(Vector2d{2, 4.1}));
+
+  const MinkowskiSum shifted_ball(E, P);
+  EXPECT_TRUE(shifted_ball.PointInSet(Vector2d{1.5, 2.5}));
+  EXPECT_FALSE(shifted_ball.PointInSet(Vector2d{1.8, 2.8}));
+
+  const MinkowskiSum boxes(MakeConvexSets(B1, B2, P));
+  EXPECT_TRUE(boxes.PointInSet(Vector2d{0.5, 5.5}));
+  EXPECT_TRUE(boxes.PointInSet(Vector2d{1, 4}));
+  EXPECT_FALSE(boxes.PointInSet(Vector2d{2.1, 5}));
+  EXPECT_FALSE(boxes.PointInSet(Vector2d{0.5, 3.9}));
+}
+
 GTEST_TEST(MinkowskiSumTest, CloneTest) {
   const Point P1(Vector2d{1.2, 3.4}), P2(Vector2d{5.6, 7.8});
   const MinkowskiSum S(P1, P2);
@@ -1,6 +1,8 @@
 #include "drake/geometry/optimization/vpolytope.h"
 
+#include <filesystem>
 #include <limits>
+#include <string>
 
 #include <gtest/gtest.h>
 
@@ -69,6 +71,14 @@ GTEST_TEST(VPolytopeTest, TriangleTest) {
     EXPECT_FALSE(V.PointInSet(at_tol, 0.5 * kTol));
   }
 
+  // Test PointsInSet, including a point outside of the bounding box of the
+  // vertices.
+  Eigen::Matrix<double, 2, 4> points;
+  points << center, triangle.col(0), 0.5 * (center + triangle.col(1)),
+      Eigen::Vector2d(10, 10);
+  EXPECT_EQ(V.PointsInSet(points, kTol),
+            std::vector<bool>({true, true, true, false}));
+
   // Test MaybeGetFeasiblePoint.
   ASSERT_TRUE(V.MaybeGetFeasiblePoint().has_value());
   EXPECT_TRUE(V.PointInSet(V.MaybeGetFeasiblePoint().value(), kTol));
@@ -320,6 +330,26 @@ GTEST_TEST(VPolytopeTest, UnsupportedMeshTypes) {
       "GetVertices\\(\\) can only use mesh shapes .* '.*bad_extension.stl'.");
 }
 
+// The hulls of Convex shapes are cached; confirm that repeated queries agree,
+// and that modifying the file is noticed.
+GTEST_TEST(VPolytopeTest, GetVerticesOfModifiedFile) {
+  const std::string filename = temp_directory() + "/hull.obj";
+  std::filesystem::copy(
+      FindResourceOrThrow("drake/geometry/test/octahedron.obj"), filename);
+  const Eigen::Matrix3Xd octahedron = GetVertices(Convex(filename));
+  EXPECT_EQ(octahedron.cols(), 6);
+  EXPECT_TRUE(CompareMatrices(GetVertices(Convex(filename)), octahedron));
+  const Eigen::Matrix3Xd scaled = GetVertices(Convex(filename, 2.0));
+  EXPECT_EQ(scaled.cols(), 6);
+  EXPECT_DOUBLE_EQ(scaled.cwiseAbs().maxCoeff(),
+                   2.0 * octahedron.cwiseAbs().maxCoeff());
+
+  std::filesystem::copy(
+      FindResourceOrThrow("drake/geometry/test/quad_cube.obj"), filename,
+      std::filesystem::copy_options::overwrite_existing);
+  EXPECT_EQ(GetVertices(Convex(filename)).cols(), 8);
+}
+
 GTEST_TEST(VPolytopeTest, UnitBox6DTest) {
   VPolytope V = VPolytope::MakeUnitBox(6);
   EXPECT_EQ(V.ambient_dimension(), 6);
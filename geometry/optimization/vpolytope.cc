@@ -3,18 +3,27 @@
 #include <algorithm>
 #include <array>
 #include <cmath>
+#include <cstdint>
+#include <filesystem>
 #include <fstream>
 #include <limits>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <numeric>
+#include <optional>
 #include <string>
+#include <system_error>
+#include <tuple>
 
 #include <fmt/format.h>
 #include <libqhullcpp/Qhull.h>
 #include <libqhullcpp/QhullVertexSet.h>
 
 #include "drake/common/is_approx_equal_abstol.h"
+#include "drake/common/never_destroyed.h"
 #include "drake/geometry/read_obj.h"
+#include "drake/solvers/choose_best_solver.h"
 #include "drake/solvers/solve.h"
 
 namespace drake {
@@ -80,9 +89,9 @@ MatrixXd OrderCounterClockwise(const MatrixXd& vertices) {
   return sorted_vertices;
 }
 
-MatrixXd GetConvexHullFromObjFile(const std::string& filename,
-                                  const std::string& extension, double scale,
-                                  std::string_view prefix) {
+MatrixXd ComputeConvexHullFromObjFile(const std::string& filename,
+                                      const std::string& extension,
+                                      double scale, std::string_view prefix) {
   if (extension != ".obj") {
     throw std::runtime_error(fmt::format(
         "{} can only use mesh shapes (i.e.., Convex, Mesh) with a .obj file "
@@ -117,6 +126,61 @@ MatrixXd GetConvexHullFromObjFile(const std::string& filename,
   return vertices;
 }
 
+// The hulls computed by ComputeConvexHullFromObjFile(), keyed on the canonical
+// path, size and modification time of the file and on the scale. C-IRIS and
+// the region-building code ask for the vertices of the same Convex shapes over
+// and over; with this cache each file is only read and passed to qhull once
+// (until it is modified). When the cache holds kMaxHullCacheEntries, it is
+// emptied before adding another.
+using HullCacheKey =
+    std::tuple<std::string, std::uintmax_t,
+               std::filesystem::file_time_type::rep, double>;
+constexpr int kMaxHullCacheEntries = 256;
+
+// Returns the key for the named file, or std::nullopt if the file can't be
+// examined (in which case computing the hull reports the error).
+std::optional<HullCacheKey> MakeHullCacheKey(const std::string& filename,
+                                             double scale) {
+  std::error_code error;
+  const std::filesystem::path path =
+      std::filesystem::canonical(filename, error);
+  if (error) return std::nullopt;
+  const std::uintmax_t size = std::filesystem::file_size(path, error);
+  if (error) return std::nullopt;
+  const std::filesystem::file_time_type time =
+      std::filesystem::last_write_time(path, error);
+  if (error) return std::nullopt;
+  return HullCacheKey(path.string(), size, time.time_since_epoch().count(),
+                      scale);
+}
+
+MatrixXd GetConvexHullFromObjFile(const std::string& filename,
+                                  const std::string& extension, double scale,
+                                  std::string_view prefix) {
+  static never_destroyed<std::mutex> mutex;
+  static never_destroyed<std::map<HullCacheKey, MatrixXd>> hulls;
+
+  const std::optional<HullCacheKey> key =
+      extension == ".obj" ? MakeHullCacheKey(filename, scale) : std::nullopt;
+  if (key.has_value()) {
+    std::lock_guard<std::mutex> lock(mutex.access());
+    const auto iter = hulls.access().find(*key);
+    if (iter != hulls.access().end()) {
+      return iter->second;
+    }
+  }
+  MatrixXd vertices =
+      ComputeConvexHullFromObjFile(filename, extension, scale, prefix);
+  if (key.has_value()) {
+    std::lock_guard<std::mutex> lock(mutex.access());
+    if (ssize(hulls.access()) >= kMaxHullCacheEntries) {
+      hulls.access().clear();
+    }
+    hulls.access().insert_or_assign(*key, vertices);
+  }
+  return vertices;
+}
+
 }  // namespace
 
 VPolytope::VPolytope() : VPolytope(MatrixXd(0, 0)) {}
@@ -457,13 +521,36 @@ std::optional<VectorXd> VPolytope::DoMaybeGetFeasiblePoint() const {
 
 bool VPolytope::DoPointInSet(const Eigen::Ref<const VectorXd>& x,
                              double tol) const {
+  return DoPointsInSet(x, tol)[0];
+}
+
+std::vector<bool> VPolytope::DoPointsInSet(
+    const Eigen::Ref<const MatrixXd>& points, double tol) const {
+  std::vector<bool> in_set(points.cols(), false);
   if (vertices_.cols() == 0) {
-    return false;
+    return in_set;
   }
+  // Points farther than `tol` from the bounding box of the vertices are not in
+  // the set, so we only solve the linear program below for the others.
+  const VectorXd lower = vertices_.rowwise().minCoeff().array() - tol;
+  const VectorXd upper = vertices_.rowwise().maxCoeff().array() + tol;
+  std::vector<int> candidates;
+  for (int i = 0; i < points.cols(); ++i) {
+    if ((points.col(i).array() >= lower.array()).all() &&
+        (points.col(i).array() <= upper.array()).all()) {
+      candidates.push_back(i);
+    }
+  }
+  if (candidates.empty()) {
+    return in_set;
+  }
+
   const int n = ambient_dimension();
   const int m = vertices_.cols();
   const double inf = std::numeric_limits<double>::infinity();
   // min z s.t. |(v α - x)ᵢ| ≤ z, αᵢ ≥ 0, ∑ᵢ αᵢ = 1.
+  // The program is formulated once, and only the bounds that depend on x are
+  // updated for each point.
   MathematicalProgram prog;
   VectorXDecisionVariable z = prog.NewContinuousVariables<1>("z");
   VectorXDecisionVariable alpha = prog.NewContinuousVariables(m, "a");
@@ -473,23 +560,35 @@ bool VPolytope::DoPointInSet(const Eigen::Ref<const VectorXd>& x,
   MatrixXd A(n, m + 1);
   A.leftCols(m) = vertices_;
   A.col(m) = -VectorXd::Ones(n);
-  prog.AddLinearConstraint(A, VectorXd::Constant(n, -inf), x, {alpha, z});
+  const VectorXd x0 = points.col(candidates[0]);
+  auto upper_constraint = prog.AddLinearConstraint(
+      A, VectorXd::Constant(n, -inf), x0, {alpha, z});
   A.col(m) = VectorXd::Ones(n);
-  prog.AddLinearConstraint(A, x, VectorXd::Constant(n, inf), {alpha, z});
+  auto lower_constraint = prog.AddLinearConstraint(
+      A, x0, VectorXd::Constant(n, inf), {alpha, z});
   // 0 ≤ αᵢ ≤ 1.  The one is redundant, but may be better than inf for some
   // solvers.
   prog.AddBoundingBoxConstraint(0, 1.0, alpha);
   // ∑ᵢ αᵢ = 1
   prog.AddLinearEqualityConstraint(RowVectorXd::Ones(m), 1.0, alpha);
-  auto result = solvers::Solve(prog);
-  // The formulation was chosen so that it always has a feasible solution.
-  DRAKE_DEMAND(result.is_success());
-  // To decouple the solver tolerance from the requested tolerance, we solve the
-  // LP, but then evaluate the constraints ourselves.
-  // Note: The max(alpha, 0) and normalization were required for Gurobi.
-  const VectorXd alpha_sol = result.GetSolution(alpha).cwiseMax(0);
-  const VectorXd x_sol = vertices_ * alpha_sol / (alpha_sol.sum());
-  return is_approx_equal_abstol(x, x_sol, tol);
+  const std::unique_ptr<solvers::SolverInterface> solver =
+      solvers::MakeSolver(solvers::ChooseBestSolver(prog));
+  for (int i : candidates) {
+    const VectorXd x = points.col(i);
+    upper_constraint.evaluator()->UpdateUpperBound(x);
+    lower_constraint.evaluator()->UpdateLowerBound(x);
+    solvers::MathematicalProgramResult result;
+    solver->Solve(prog, std::nullopt, std::nullopt, &result);
+    // The formulation was chosen so that it always has a feasible solution.
+    DRAKE_DEMAND(result.is_success());
+    // To decouple the solver tolerance from the requested tolerance, we solve
+    // the LP, but then evaluate the constraints ourselves.
+    // Note: The max(alpha, 0) and normalization were required for Gurobi.
+    const VectorXd alpha_sol = result.GetSolution(alpha).cwiseMax(0);
+    const VectorXd x_sol = vertices_ * alpha_sol / (alpha_sol.sum());
+    in_set[i] = is_approx_equal_abstol(x, x_sol, tol);
+  }
+  return in_set;
 }
 
 std::pair<VectorX<Variable>, std::vector<Binding<Constraint>>>
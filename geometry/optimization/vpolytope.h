@@ -113,6 +113,10 @@ class VPolytope final : public ConvexSet {
   bool DoPointInSet(const Eigen::Ref<const Eigen::VectorXd>& x,
                     double tol) const final;
 
+  std::vector<bool> DoPointsInSet(
+      const Eigen::Ref<const Eigen::MatrixXd>& points,
+      double tol) const final;
+
   std::pair<VectorX<symbolic::Variable>,
             std::vector<solvers::Binding<solvers::Constraint>>>
   DoAddPointInSetConstraints(
@@ -25,16 +25,22 @@ Bvh<BvType, SourceMeshType>::Bvh(const SourceMeshType& mesh) {
     element_centroids.emplace_back(i, ComputeCentroid(mesh, i));
   }
 
-  root_node_ =
-      BuildBvTree(mesh, element_centroids.begin(), element_centroids.end());
+  // Bisection never produces a leaf with fewer than half the maximum number of
+  // elements (rounded up), which bounds the number of leaves and, as the tree
+  // is binary, the number of nodes.
+  const int min_leaf_size = (NodeType::kMaxElementPerLeaf + 1) / 2;
+  const int max_num_leaves = (num_elements + min_leaf_size - 1) / min_leaf_size;
+  nodes_.reserve(std::max(1, 2 * max_num_leaves - 1));
+  BuildBvTree(mesh, element_centroids.begin(), element_centroids.end(),
+              &nodes_);
 }
 
 template <class BvType, class SourceMeshType>
-std::unique_ptr<BvNode<BvType, SourceMeshType>>
-Bvh<BvType, SourceMeshType>::BuildBvTree(
+void Bvh<BvType, SourceMeshType>::BuildBvTree(
     const SourceMeshType& mesh_M,
     const typename std::vector<CentroidPair>::iterator& start,
-    const typename std::vector<CentroidPair>::iterator& end) {
+    const typename std::vector<CentroidPair>::iterator& end,
+    std::vector<NodeType>* nodes) {
   // Generate bounding volume.
   BvType bv_M = ComputeBoundingVolume(mesh_M, start, end);
 
@@ -45,7 +51,7 @@ Bvh<BvType, SourceMeshType>::BuildBvTree(
       data.indices[i] = (start + i)->first;
     }
     // Store element indices in this leaf node.
-    return std::make_unique<NodeType>(bv_M, data);
+    nodes->emplace_back(bv_M, data);
   } else {
     // Sort the elements by centroid along the axis of greatest spread.
     // Note: We tried an alternative strategy for building the BVH using a
@@ -95,11 +101,17 @@ Bvh<BvType, SourceMeshType>::BuildBvTree(
                 return Baxis_M.dot(a.second) < Baxis_M.dot(b.second);
               });
 
-    // Continue with the next branches.
+    // Continue with the next branches. The left subtree immediately follows
+    // this node; the right subtree follows the left. The offset to the right
+    // child is only known once the left subtree has been appended, so the
+    // branch starts with a provisional offset.
     const typename std::vector<CentroidPair>::iterator mid =
         start + num_elements / 2;
-    return std::make_unique<NodeType>(bv_M, BuildBvTree(mesh_M, start, mid),
-                                      BuildBvTree(mesh_M, mid, end));
+    const int index = static_cast<int>(nodes->size());
+    nodes->push_back(NodeType(bv_M, 2));
+    BuildBvTree(mesh_M, start, mid, nodes);
+    (*nodes)[index].set_right_offset(static_cast<int>(nodes->size()) - index);
+    BuildBvTree(mesh_M, mid, end, nodes);
   }
 }
 
@@ -7,7 +7,6 @@
 #include <variant>
 #include <vector>
 
-#include "drake/common/copyable_unique_ptr.h"
 #include "drake/common/drake_assert.h"
 #include "drake/common/drake_copyable.h"
 #include "drake/common/eigen_types.h"
@@ -26,6 +25,9 @@ namespace internal {
 template <typename>
 class BvhUpdater;
 
+template <class, class>
+class Bvh;
+
 template <class MeshType>
 struct MeshTraits;
 
@@ -39,7 +41,15 @@ struct MeshTraits<VolumeMesh<T>> {
   static constexpr int kMaxElementPerBvhLeaf = 1;
 };
 
-/* Node of the tree structure representing the Bvh.  */
+/* Node of the tree structure representing the Bvh.
+
+ The nodes of a Bvh are stored contiguously in a single array in depth-first
+ (pre-)order: a branch node's left child immediately follows it and its right
+ child follows the left child's entire subtree. So, a branch node only stores
+ the offset to its right child and the child accessors are simple pointer
+ arithmetic, which keeps traversals cache friendly. As a consequence, a branch
+ node is only meaningful as part of its Bvh's node array; only leaf nodes can
+ be constructed (and used) in isolation.  */
 template <class BvType, class MeshType>
 class BvNode {
  public:
@@ -61,16 +71,6 @@ class BvNode {
   BvNode(BvType bv, LeafData data)
       : bv_(std::move(bv)), child_(std::move(data)) {}
 
-  /* Constructor for branch/internal nodes.
-   @param bv The bounding volume encompassing the elements in child branches.
-   @param left Unique pointer to the left child branch.
-   @param right Unique pointer to the right child branch.
-   @pre Both children must be distinct and not null.   */
-  BvNode(BvType bv, std::unique_ptr<BvNode<BvType, MeshType>> left,
-         std::unique_ptr<BvNode<BvType, MeshType>> right)
-      : bv_(std::move(bv)),
-        child_(NodeChildren(std::move(left), std::move(right))) {}
-
   /* Returns the bounding volume.  */
   const BvType& bv() const { return bv_; }
 
@@ -91,13 +91,15 @@ class BvNode {
   /* Returns the left child branch.
    @pre is_leaf() returns false.  */
   const BvNode<BvType, MeshType>& left() const {
-    return *(std::get<NodeChildren>(child_).left);
+    DRAKE_ASSERT(!is_leaf());
+    return *(this + 1);
   }
 
   /* Returns the right child branch.
    @pre is_leaf() returns false.  */
   const BvNode<BvType, MeshType>& right() const {
-    return *(std::get<NodeChildren>(child_).right);
+    DRAKE_ASSERT(!is_leaf());
+    return *(this + std::get<NodeChildren>(child_).right_offset);
   }
 
   /* Returns whether this is a leaf node as opposed to a branch node.  */
@@ -133,34 +135,39 @@ class BvNode {
   template <typename>
   friend class BvhUpdater;
 
-  /* Provide disciplined access to BvhUpdater to a mutable child node. */
-  BvNode<BvType, MeshType>& left() {
-    return *(std::get<NodeChildren>(child_).left);
+  template <class, class>
+  friend class Bvh;
+
+  struct NodeChildren {
+    // The (positive) distance, in nodes, from this node to its right child in
+    // the Bvh's node array. The left child is always at distance one.
+    int right_offset{};
+  };
+
+  /* Constructor for branch/internal nodes (see the class documentation for
+   the storage layout).
+   @param bv            The bounding volume encompassing the elements in child
+                        branches.
+   @param right_offset  The distance (in nodes) from this node to its right
+                        child; i.e., one more than the number of nodes in the
+                        left child's subtree.
+   @pre right_offset > 1.  */
+  BvNode(BvType bv, int right_offset)
+      : bv_(std::move(bv)), child_(NodeChildren{right_offset}) {
+    DRAKE_DEMAND(right_offset > 1);
   }
 
-  /* Provide disciplined access to BvhUpdater to a mutable child node. */
-  BvNode<BvType, MeshType>& right() {
-    return *(std::get<NodeChildren>(child_).right);
+  /* Sets the distance to the right child, once the Bvh has appended the left
+   child's subtree after this branch node.
+   @pre is_leaf() returns false and right_offset > 1.  */
+  void set_right_offset(int right_offset) {
+    DRAKE_DEMAND(right_offset > 1);
+    std::get<NodeChildren>(child_).right_offset = right_offset;
   }
 
   /* Provide disciplined access to BvhUpdater to a mutable bounding volume. */
   BvType& bv() { return bv_; }
 
-  struct NodeChildren {
-    DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(NodeChildren)
-
-    NodeChildren(std::unique_ptr<BvNode> left_in,
-                 std::unique_ptr<BvNode> right_in)
-        : left(std::move(left_in)), right(std::move(right_in)) {
-      DRAKE_DEMAND(left != nullptr);
-      DRAKE_DEMAND(right != nullptr);
-      DRAKE_DEMAND(left != right);
-    }
-
-    copyable_unique_ptr<BvNode> left;
-    copyable_unique_ptr<BvNode> right;
-  };
-
   BvType bv_;
 
   // If this is a leaf node then the child refers to indices into the mesh's
@@ -205,7 +212,10 @@ class Bvh {
 
   explicit Bvh(const MeshType& mesh);
 
-  const NodeType& root_node() const { return *root_node_; }
+  const NodeType& root_node() const { return nodes_.front(); }
+
+  /* Reports the total number of nodes (branches and leaves) in this %Bvh.  */
+  int num_nodes() const { return static_cast<int>(nodes_.size()); }
 
   /* Perform a query of this %Bvh's mesh elements (measured and expressed in
    Frame A) against the given %Bvh's mesh elements (measured and expressed in
@@ -342,14 +352,20 @@ class Bvh {
   template <typename>
   friend class BvhUpdater;
 
-  NodeType& mutable_root_node() { return *root_node_; }
+  /* Provides BvhUpdater mutable access to all the nodes. They are in
+   depth-first order so that iterating them in reverse visits every child
+   before its parent.  */
+  std::vector<NodeType>& mutable_nodes() { return nodes_; }
 
   using CentroidPair = std::pair<int, Vector3<double>>;
 
-  static std::unique_ptr<NodeType> BuildBvTree(
+  // Appends the subtree for the elements in [start, end) to `nodes` in
+  // depth-first order.
+  static void BuildBvTree(
       const MeshType& mesh,
       const typename std::vector<CentroidPair>::iterator& start,
-      const typename std::vector<CentroidPair>::iterator& end);
+      const typename std::vector<CentroidPair>::iterator& end,
+      std::vector<NodeType>* nodes);
 
   static BvType ComputeBoundingVolume(
       const MeshType& mesh,
@@ -389,7 +405,8 @@ class Bvh {
 
   static constexpr int kElementVertexCount = MeshType::kVertexPerElement;
 
-  copyable_unique_ptr<NodeType> root_node_;
+  // All nodes in depth-first order; the root is the first node.
+  std::vector<NodeType> nodes_;
 };
 
 }  // namespace internal
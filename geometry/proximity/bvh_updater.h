@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <limits>
 #include <vector>
 
@@ -18,6 +19,13 @@ namespace internal {
  This will frequently be combined with a MeshDeformer so that when a mesh is
  updated, the corresponding Bvh can likewise be updated.
 
+ Refitting preserves the topology of the BVH. When only a subset of the
+ vertices has moved, Update(moved_vertices) refits only the nodes whose
+ subtrees reference those vertices. As the mesh deforms, the quality of the
+ (fixed) topology can degrade; CalcSahCost() measures that quality and
+ RebuildIfDegraded() rebuilds the Bvh on the current vertex positions when it
+ has degraded too far.
+
  This current incarnation only supports Bvhs constructed with axis-aligned
  bounding boxes.
 
@@ -46,6 +54,7 @@ class BvhUpdater {
       : mesh_(*mesh_M), bvh_(*bvh_M) {
     DRAKE_DEMAND(mesh_M != nullptr);
     DRAKE_DEMAND(bvh_M != nullptr);
+    ResetTopology();
   }
 
   const MeshType& mesh() const { return mesh_; }
@@ -59,11 +68,163 @@ class BvhUpdater {
     if (vertices.size() == 0) return;
 
     /* This implementation doesn't change the bvh topology; it simply passes
-     through each box in a bottom-up manner refitting the box to the data. */
-    UpdateRecursive(&bvh_.mutable_root_node(), vertices);
+     through each box in a bottom-up manner refitting the box to the data. The
+     nodes are stored in depth-first order (children after their parents), so
+     a reverse sweep over the node array refits every child before its parent
+     without recursion. */
+    auto& nodes = bvh_.mutable_nodes();
+    for (auto node = nodes.rbegin(); node != nodes.rend(); ++node) {
+      UpdateNode(&*node, vertices);
+    }
+  }
+
+  /* Updates the referenced bvh to maintain a good fit on the referenced mesh
+   after only the indicated vertices have moved. Only the leaves referencing one
+   of those vertices and their ancestors are refit; the remaining bounding
+   volumes are left untouched.
+   @pre Every vertex that moved since the last update is listed in
+        `moved_vertices` (duplicates are allowed).
+   @pre 0 <= moved_vertices[i] < mesh().num_vertices() for all i. */
+  void Update(const std::vector<int>& moved_vertices) {
+    if (moved_vertices.empty()) return;
+    const auto& vertices = GetMeshVertices(mesh_.vertices());
+    if (vertices.size() == 0) return;
+    if (vertex_leaf_start_.empty()) BuildTopology();
+
+    /* Mark every leaf containing a moved vertex along with its ancestors. The
+     walk up the tree stops at the first node already marked, so each node is
+     visited at most once per update. */
+    for (int v : moved_vertices) {
+      DRAKE_ASSERT(0 <= v && v < mesh_.num_vertices());
+      for (int i = vertex_leaf_start_[v]; i < vertex_leaf_start_[v + 1]; ++i) {
+        for (int n = vertex_leaves_[i]; n >= 0 && !dirty_[n]; n = parents_[n]) {
+          dirty_[n] = 1;
+        }
+      }
+    }
+
+    /* As with the full update, the reverse sweep refits children before their
+     parents. */
+    auto& nodes = bvh_.mutable_nodes();
+    for (int n = static_cast<int>(nodes.size()) - 1; n >= 0; --n) {
+      if (!dirty_[n]) continue;
+      dirty_[n] = 0;
+      UpdateNode(&nodes[n], vertices);
+    }
+  }
+
+  /* Computes the surface area heuristic (SAH) cost of the referenced bvh's
+   current bounding volumes: the expected cost of a query, normalized by the
+   surface area of the root box, where visiting a branch costs one and testing
+   an element costs one. I.e.,
+
+       C = (∑ₙ A(n) + ∑ₗ A(l)⋅E(l)) / A(root)
+
+   where n ranges over the branch nodes, l over the leaf nodes, A(x) is the
+   surface area of node x's box and E(l) is the number of elements in leaf l.
+   Refitting a fixed topology as the mesh deforms typically increases this
+   cost. Returns zero if the root box has no surface area. */
+  double CalcSahCost() const {
+    /* The nodes are stored contiguously, starting with the root. */
+    const auto* root = &bvh_.root_node();
+    const double root_area = CalcSurfaceArea(root->bv());
+    if (root_area == 0) return 0;
+    double cost = 0;
+    for (int n = 0; n < bvh_.num_nodes(); ++n) {
+      const auto& node = root[n];
+      const double area = CalcSurfaceArea(node.bv());
+      cost += node.is_leaf() ? area * node.num_element_indices() : area;
+    }
+    return cost / root_area;
+  }
+
+  /* Reports the SAH cost (see CalcSahCost()) of the referenced bvh when it was
+   last built (or when this updater was last reset).  */
+  double reference_sah_cost() const { return reference_sah_cost_; }
+
+  /* Replaces the reference SAH cost. This is for a referenced bvh that was
+   copied from another one after refits, so that it is compared against the
+   cost of the original when that was built, rather than its own. */
+  void set_reference_sah_cost(double cost) { reference_sah_cost_ = cost; }
+
+  /* Rebuilds the referenced bvh from scratch on the mesh's current vertex
+   positions. This is more expensive than refitting, but restores the quality
+   of the tree after extensive deformation. */
+  void Rebuild() {
+    bvh_ = Bvh<Aabb, MeshType>(mesh_);
+    ResetTopology();
+  }
+
+  /* Rebuilds the referenced bvh (see Rebuild()) if its SAH cost has grown to
+   more than `max_cost_ratio` times the reference SAH cost.
+   @returns `true` if the bvh was rebuilt.
+   @pre max_cost_ratio >= 1. */
+  bool RebuildIfDegraded(double max_cost_ratio) {
+    DRAKE_DEMAND(max_cost_ratio >= 1);
+    if (reference_sah_cost_ > 0 &&
+        CalcSahCost() > max_cost_ratio * reference_sah_cost_) {
+      Rebuild();
+      return true;
+    }
+    return false;
+  }
+
+  /* Discards all data this updater has cached about the referenced bvh's
+   topology and recomputes the reference SAH cost. This must be invoked
+   whenever the referenced bvh is replaced by another (e.g., by assignment)
+   other than through Rebuild(). */
+  void ResetTopology() {
+    parents_.clear();
+    vertex_leaf_start_.clear();
+    vertex_leaves_.clear();
+    dirty_.clear();
+    reference_sah_cost_ = CalcSahCost();
   }
 
  private:
+  // Surface area of the given box.
+  static double CalcSurfaceArea(const Aabb& box) {
+    const Eigen::Vector3d& h = box.half_width();
+    return 8 * (h.x() * h.y() + h.y() * h.z() + h.z() * h.x());
+  }
+
+  // Computes the parent of each node and, for each vertex, the leaves whose
+  // elements reference it. This data is only required by the partial update;
+  // it is computed on first use.
+  void BuildTopology() {
+    const auto* root = &bvh_.root_node();
+    const int num_nodes = bvh_.num_nodes();
+    parents_.assign(num_nodes, -1);
+    dirty_.assign(num_nodes, 0);
+    std::vector<std::vector<int>> leaves_of_vertex(mesh_.num_vertices());
+    constexpr int kElementVertexCount = MeshType::kVertexPerElement;
+    for (int n = 0; n < num_nodes; ++n) {
+      const auto& node = root[n];
+      if (node.is_leaf()) {
+        for (int e = 0; e < node.num_element_indices(); ++e) {
+          const auto& element = mesh_.element(node.element_index(e));
+          for (int i = 0; i < kElementVertexCount; ++i) {
+            auto& leaves = leaves_of_vertex[element.vertex(i)];
+            // Leaves are visited in order; so duplicates are adjacent.
+            if (leaves.empty() || leaves.back() != n) leaves.push_back(n);
+          }
+        }
+      } else {
+        parents_[&node.left() - root] = n;
+        parents_[&node.right() - root] = n;
+      }
+    }
+    // Flatten the per-vertex lists.
+    vertex_leaf_start_.clear();
+    vertex_leaf_start_.reserve(leaves_of_vertex.size() + 1);
+    vertex_leaves_.clear();
+    for (const auto& leaves : leaves_of_vertex) {
+      vertex_leaf_start_.push_back(static_cast<int>(vertex_leaves_.size()));
+      vertex_leaves_.insert(vertex_leaves_.end(), leaves.begin(), leaves.end());
+    }
+    vertex_leaf_start_.push_back(static_cast<int>(vertex_leaves_.size()));
+  }
+
   // If the mesh type is already double-valued, simply return the mesh vertices.
   static const std::vector<Vector3<double>>& GetMeshVertices(
       const std::vector<Vector3<double>>& vertices) {
@@ -81,9 +242,10 @@ class BvhUpdater {
     return vertices_dbl;
   }
 
-  // Helper function to perform a bottom-up refit.
-  void UpdateRecursive(typename Bvh<Aabb, MeshType>::NodeType* node,
-                       const std::vector<Vector3<double>>& vertices) {
+  // Helper function to refit a single node.
+  // @pre If `node` is a branch, its children have already been refit.
+  void UpdateNode(typename Bvh<Aabb, MeshType>::NodeType* node,
+                  const std::vector<Vector3<double>>& vertices) {
     /* Intentionally uninitialized. */
     Eigen::Vector3d lower, upper;
     constexpr int kElementVertexCount = MeshType::kVertexPerElement;
@@ -105,8 +267,6 @@ class BvhUpdater {
         }
       }
     } else {
-      UpdateRecursive(&node->left(), vertices);
-      UpdateRecursive(&node->right(), vertices);
       // Update box on child boxes.
       lower = node->left().bv().lower().cwiseMin(node->right().bv().lower());
       upper = node->left().bv().upper().cwiseMax(node->right().bv().upper());
@@ -116,6 +276,18 @@ class BvhUpdater {
 
   const MeshType& mesh_;
   Bvh<Aabb, MeshType>& bvh_;
+
+  // Cached topology for the partial update (see BuildTopology()); empty until
+  // first needed. parents_[n] is the index of node n's parent (-1 for the
+  // root). The leaves referencing vertex v are
+  // vertex_leaves_[vertex_leaf_start_[v]], ...,
+  // vertex_leaves_[vertex_leaf_start_[v + 1] - 1].
+  std::vector<int> parents_;
+  std::vector<int> vertex_leaf_start_;
+  std::vector<int> vertex_leaves_;
+  // Per-node scratch flags for the partial update; all zero between updates.
+  std::vector<uint8_t> dirty_;
+  double reference_sah_cost_{};
 };
 
 }  // namespace internal
@@ -3,8 +3,11 @@
 #include <algorithm>
 #include <memory>
 #include <utility>
+#include <vector>
 
 #include "drake/common/drake_assert.h"
+#include "drake/common/parallel_for.h"
+#include "drake/common/ssize.h"
 #include "drake/geometry/proximity/deformable_contact_geometries.h"
 #include "drake/geometry/proximity/deformable_mesh_intersection.h"
 #include "drake/geometry/proximity/hydroelastic_internal.h"
@@ -54,10 +57,22 @@ void Geometries::UpdateDeformableVertexPositions(
 }
 
 DeformableContact<double> Geometries::ComputeDeformableContact(
-    const CollisionFilter& collision_filter) const {
+    const CollisionFilter& collision_filter, Parallelism parallelize) const {
   DeformableContact<double> result;
+  // The deformable-rigid pairs that can collide, in the order in which their
+  // contact surfaces are reported.
+  struct CandidatePair {
+    GeometryId deformable_id;
+    GeometryId rigid_id;
+    const VolumeMeshFieldLinear<double, double>* deformable_sdf;
+    const DeformableVolumeMesh<double>* deformable_mesh;
+    const RigidGeometry* rigid_geometry;
+  };
+  std::vector<CandidatePair> candidates;
   for (const auto& [deformable_id, deformable_geometry] :
        deformable_geometries_) {
+    // N.B. This updates the field in place, so it must not be done by the
+    // worker threads.
     const VolumeMeshFieldLinear<double, double>& deformable_sdf =
         deformable_geometry.CalcSignedDistanceField();
     const DeformableVolumeMesh<double>& deformable_mesh =
@@ -68,16 +83,37 @@ DeformableContact<double> Geometries::ComputeDeformableContact(
     for (const auto& [rigid_id, rigid_geometry] : rigid_geometries_) {
       DRAKE_ASSERT(collision_filter.HasGeometry(rigid_id));
       if (collision_filter.CanCollideWith(deformable_id, rigid_id)) {
-        const math::RigidTransform<double>& X_WR =
-            rigid_geometry.pose_in_world();
-        const auto& rigid_bvh = rigid_geometry.rigid_mesh().bvh();
-        const auto& rigid_tri_mesh = rigid_geometry.rigid_mesh().mesh();
-        AddDeformableRigidContactSurface(
-            deformable_sdf, deformable_mesh, deformable_id, rigid_id,
-            rigid_tri_mesh, rigid_bvh, X_WR, &result);
+        candidates.push_back({deformable_id, rigid_id, &deformable_sdf,
+                              &deformable_mesh, &rigid_geometry});
       }
     }
   }
+
+  // Each pair is intersected into its own slot, so the pairs are independent.
+  std::vector<std::optional<DeformableRigidContactData>> contact_data(
+      candidates.size());
+  drake::internal::ParallelFor(
+      parallelize, ssize(candidates), [&candidates, &contact_data](int i) {
+        const CandidatePair& candidate = candidates[i];
+        const internal::hydroelastic::RigidMesh& rigid_mesh =
+            candidate.rigid_geometry->rigid_mesh();
+        contact_data[i] = ComputeDeformableRigidContactData(
+            *candidate.deformable_sdf, *candidate.deformable_mesh,
+            rigid_mesh.mesh(), rigid_mesh.bvh(),
+            candidate.rigid_geometry->pose_in_world());
+      });
+
+  for (int i = 0; i < ssize(candidates); ++i) {
+    std::optional<DeformableRigidContactData>& data = contact_data[i];
+    if (data.has_value()) {
+      result.AddDeformableRigidContactSurface(
+          candidates[i].deformable_id, candidates[i].rigid_id,
+          data->participating_vertices, std::move(*data->contact_mesh_W),
+          std::move(data->signed_distances),
+          std::move(data->contact_vertex_indexes),
+          std::move(data->barycentric_coordinates));
+    }
+  }
   return result;
 }
 
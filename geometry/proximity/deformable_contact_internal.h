@@ -5,6 +5,7 @@
 #include <unordered_map>
 #include <vector>
 
+#include "drake/common/parallelism.h"
 #include "drake/geometry/geometry_ids.h"
 #include "drake/geometry/proximity/collision_filter.h"
 #include "drake/geometry/proximity/deformable_contact_geometries.h"
@@ -103,9 +104,12 @@ class Geometries final : public ShapeReifier {
   /* For each registered deformable geometry, computes the contact data of it
    with respect to all registered rigid geometries. Assumes the vertex positions
    and poses of all registered deformable and rigid geometries are up to date.
-  */
+   The deformable-rigid pairs are evaluated using up to
+   `parallelize.num_threads()` threads; the results do not depend on the
+   number of threads. */
   DeformableContact<double> ComputeDeformableContact(
-      const CollisionFilter& collision_filter) const;
+      const CollisionFilter& collision_filter,
+      Parallelism parallelize = false) const;
 
  private:
   friend class GeometriesTester;
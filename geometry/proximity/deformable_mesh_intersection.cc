@@ -74,70 +74,88 @@ class DeformableSurfaceVolumeIntersector
   std::vector<VolumeMesh<double>::Barycentric<double>> barycentric_centroids_{};
 };
 
-void AddDeformableRigidContactSurface(
+std::optional<DeformableRigidContactData> ComputeDeformableRigidContactData(
     const VolumeMeshFieldLinear<double, double>& deformable_sdf,
     const DeformableVolumeMesh<double>& deformable_mesh,
-    const GeometryId deformable_id, const GeometryId rigid_id,
     const TriangleSurfaceMesh<double>& rigid_mesh_R,
     const Bvh<Obb, TriangleSurfaceMesh<double>>& rigid_bvh_R,
-    const math::RigidTransform<double>& X_DR,
-    DeformableContact<double>* deformable_contact) {
-  DRAKE_DEMAND(deformable_contact != nullptr);
-
+    const math::RigidTransform<double>& X_DR) {
   DeformableSurfaceVolumeIntersector intersect;
   intersect.SampleVolumeFieldOnSurface(
       deformable_sdf, deformable_mesh.bvh(), rigid_mesh_R, rigid_bvh_R, X_DR,
       false /* don't filter face normal along field gradient */);
 
-  if (intersect.has_intersection()) {
-    std::unique_ptr<PolygonSurfaceMesh<double>> contact_mesh_W =
-        intersect.release_mesh();
-    const PolygonSurfaceMeshFieldLinear<double, double>& signed_distance_field =
-        intersect.mutable_field();
-    const int num_faces = contact_mesh_W->num_faces();
-    /* Compute the penetration distance at the centroid of each contact polygon
-     using the signed distance field. */
-    std::vector<double> penetration_distances(num_faces);
-    for (int i = 0; i < num_faces; ++i) {
-      const Vector3<double>& contact_points_W =
-          contact_mesh_W->element_centroid(i);
-      /* `signed_distance_field` has a gradient, therefore `EvaluateCartesian()`
-       should be cheap. */
-      penetration_distances[i] =
-          signed_distance_field.EvaluateCartesian(i, contact_points_W);
-    }
+  if (!intersect.has_intersection()) {
+    return std::nullopt;
+  }
+  DeformableRigidContactData data;
+  data.contact_mesh_W = intersect.release_mesh();
+  const PolygonSurfaceMesh<double>& contact_mesh_W = *data.contact_mesh_W;
+  const PolygonSurfaceMeshFieldLinear<double, double>& signed_distance_field =
+      intersect.mutable_field();
+  const int num_faces = contact_mesh_W.num_faces();
+  /* Compute the penetration distance at the centroid of each contact polygon
+   using the signed distance field. */
+  std::vector<double>& penetration_distances = data.signed_distances;
+  penetration_distances.resize(num_faces);
+  for (int i = 0; i < num_faces; ++i) {
+    const Vector3<double>& contact_points_W =
+        contact_mesh_W.element_centroid(i);
+    /* `signed_distance_field` has a gradient, therefore `EvaluateCartesian()`
+     should be cheap. */
+    penetration_distances[i] =
+        signed_distance_field.EvaluateCartesian(i, contact_points_W);
+  }
 
-    const VolumeMesh<double>& mesh = deformable_mesh.mesh();
-    // Each contact polygon generates one "participating tetrahedron". Hence
-    // `participating_tetrahedra` contains duplicated entries when a tetrahedron
-    // covers multiple contact polygons.
-    const std::vector<int>& participating_tetrahedra =
-        intersect.mutable_tetrahedron_index_of_polygons();
-    DRAKE_DEMAND(static_cast<int>(participating_tetrahedra.size()) ==
-                 num_faces);
-
-    std::unordered_set<int> participating_vertices;
-    std::vector<Vector4<int>> contact_vertex_indexes;
-    // Each contact point generates 4 participating vertices. We overestimate by
-    // ignoring duplications caused by the possibility of one tet containing
-    // more than one contact point.
-    participating_vertices.reserve(4 * num_faces);
-    contact_vertex_indexes.reserve(num_faces);
-    for (int e : participating_tetrahedra) {
-      Vector4<int> tetrahedron_vertex_indexes;
-      for (int v = 0; v < VolumeMesh<double>::kVertexPerElement; ++v) {
-        const int index = mesh.element(e).vertex(v);
-        tetrahedron_vertex_indexes(v) = index;
-        participating_vertices.insert(index);
-      }
-      contact_vertex_indexes.push_back(tetrahedron_vertex_indexes);
+  const VolumeMesh<double>& mesh = deformable_mesh.mesh();
+  // Each contact polygon generates one "participating tetrahedron". Hence
+  // `participating_tetrahedra` contains duplicated entries when a tetrahedron
+  // covers multiple contact polygons.
+  const std::vector<int>& participating_tetrahedra =
+      intersect.mutable_tetrahedron_index_of_polygons();
+  DRAKE_DEMAND(static_cast<int>(participating_tetrahedra.size()) == num_faces);
+
+  std::unordered_set<int>& participating_vertices = data.participating_vertices;
+  std::vector<Vector4<int>>& contact_vertex_indexes =
+      data.contact_vertex_indexes;
+  // Each contact point generates 4 participating vertices. We overestimate by
+  // ignoring duplications caused by the possibility of one tet containing
+  // more than one contact point.
+  participating_vertices.reserve(4 * num_faces);
+  contact_vertex_indexes.reserve(num_faces);
+  for (int e : participating_tetrahedra) {
+    Vector4<int> tetrahedron_vertex_indexes;
+    for (int v = 0; v < VolumeMesh<double>::kVertexPerElement; ++v) {
+      const int index = mesh.element(e).vertex(v);
+      tetrahedron_vertex_indexes(v) = index;
+      participating_vertices.insert(index);
     }
+    contact_vertex_indexes.push_back(tetrahedron_vertex_indexes);
+  }
+  data.barycentric_coordinates =
+      std::move(intersect.mutable_barycentric_centroids());
+  return data;
+}
+
+void AddDeformableRigidContactSurface(
+    const VolumeMeshFieldLinear<double, double>& deformable_sdf,
+    const DeformableVolumeMesh<double>& deformable_mesh,
+    const GeometryId deformable_id, const GeometryId rigid_id,
+    const TriangleSurfaceMesh<double>& rigid_mesh_R,
+    const Bvh<Obb, TriangleSurfaceMesh<double>>& rigid_bvh_R,
+    const math::RigidTransform<double>& X_DR,
+    DeformableContact<double>* deformable_contact) {
+  DRAKE_DEMAND(deformable_contact != nullptr);
 
+  std::optional<DeformableRigidContactData> data =
+      ComputeDeformableRigidContactData(deformable_sdf, deformable_mesh,
+                                        rigid_mesh_R, rigid_bvh_R, X_DR);
+  if (data.has_value()) {
     deformable_contact->AddDeformableRigidContactSurface(
-        deformable_id, rigid_id, participating_vertices,
-        std::move(*contact_mesh_W), std::move(penetration_distances),
-        std::move(contact_vertex_indexes),
-        std::move(intersect.mutable_barycentric_centroids()));
+        deformable_id, rigid_id, data->participating_vertices,
+        std::move(*data->contact_mesh_W), std::move(data->signed_distances),
+        std::move(data->contact_vertex_indexes),
+        std::move(data->barycentric_coordinates));
   }
 }
 
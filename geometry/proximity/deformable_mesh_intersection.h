@@ -1,6 +1,8 @@
 #pragma once
 
 #include <memory>
+#include <optional>
+#include <unordered_set>
 #include <vector>
 
 #include "drake/geometry/proximity/bvh.h"
@@ -13,6 +15,28 @@ namespace drake {
 namespace geometry {
 namespace internal {
 
+/* The contact data between a deformable geometry and a rigid geometry, as
+ taken by DeformableContact::AddDeformableRigidContactSurface(); see there for
+ the meaning of each member. */
+struct DeformableRigidContactData {
+  std::unordered_set<int> participating_vertices;
+  std::unique_ptr<PolygonSurfaceMesh<double>> contact_mesh_W;
+  std::vector<double> signed_distances;
+  std::vector<Vector4<int>> contact_vertex_indexes;
+  std::vector<Vector4<double>> barycentric_coordinates;
+};
+
+/* Computes the contact data between a deformable geometry and a rigid
+ geometry, or std::nullopt if they don't intersect. The parameters are as
+ documented in AddDeformableRigidContactSurface(). This only reads its inputs,
+ so it may be called concurrently for different pairs of geometries. */
+std::optional<DeformableRigidContactData> ComputeDeformableRigidContactData(
+    const VolumeMeshFieldLinear<double, double>& deformable_sdf,
+    const DeformableVolumeMesh<double>& deformable_mesh,
+    const TriangleSurfaceMesh<double>& rigid_mesh_R,
+    const Bvh<Obb, TriangleSurfaceMesh<double>>& rigid_bvh_R,
+    const math::RigidTransform<double>& X_DR);
+
 /* Computes the contact surface between a deformable geometry and a rigid
  geometry and appends it to existing data.
  @param[in] deformable_sdf_D
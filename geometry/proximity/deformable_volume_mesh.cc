@@ -1,5 +1,7 @@
 #include "drake/geometry/proximity/deformable_volume_mesh.h"
 
+#include "drake/common/ssize.h"
+
 namespace drake {
 namespace geometry {
 namespace internal {
@@ -7,8 +9,29 @@ namespace internal {
 template <typename T>
 void DeformableVolumeMesh<T>::UpdateVertexPositions(
     const Eigen::Ref<const VectorX<T>>& q) {
+  DRAKE_DEMAND(q.size() == 3 * mesh_.num_vertices());
+  moved_vertices_.clear();
+  for (int v = 0; v < mesh_.num_vertices(); ++v) {
+    const Vector3<T> p_MV = q.template segment<3>(3 * v);
+    if (convert_to_double(p_MV) != convert_to_double(mesh_.vertex(v))) {
+      moved_vertices_.push_back(v);
+    }
+  }
   deformer_.SetAllPositions(q);
-  bvh_updater_.Update();
+  if (moved_vertices_.empty()) return;
+  // When most of the mesh moves, the full refit's sequential sweep is cheaper
+  // than tracking the affected subtrees.
+  if (2 * ssize(moved_vertices_) > mesh_.num_vertices()) {
+    bvh_updater_.Update();
+  } else {
+    bvh_updater_.Update(moved_vertices_);
+  }
+  // Measuring the quality costs as much as a full refit, so it is only done
+  // periodically.
+  if (++num_refits_since_quality_check_ >= kQualityCheckInterval) {
+    num_refits_since_quality_check_ = 0;
+    bvh_updater_.RebuildIfDegraded(kMaxSahCostRatio);
+  }
 }
 
 }  // namespace internal
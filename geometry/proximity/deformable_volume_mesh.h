@@ -1,6 +1,7 @@
 #pragma once
 
 #include <utility>
+#include <vector>
 
 #include "drake/geometry/proximity/bvh.h"
 #include "drake/geometry/proximity/bvh_updater.h"
@@ -43,26 +44,37 @@ class DeformableVolumeMesh {
   // and bvh_updater_ are configured to *always* point to the instance's
   // *members* mesh_ and bvh_. That never changes during the entire lifetime of
   // a DeformableVolumeMesh instance. So, the assignment operators only have to
-  // worry about setting the member mesh and bvh to the assigned data; we don't
-  // have to (and can't) make any modifications to the deformer or bvh updater.
+  // worry about setting the member mesh and bvh to the assigned data and
+  // letting the bvh updater know that the bvh's topology has changed. The
+  // bvh's quality bookkeeping (the reference SAH cost and the number of refits
+  // since its last check) is carried over, so that a copy rebuilds its bvh
+  // exactly when the original would.
 
   DeformableVolumeMesh(const DeformableVolumeMesh& other)
-      : DeformableVolumeMesh(other.mesh_, other.bvh_) {}
+      : DeformableVolumeMesh(other.mesh_, other.bvh_) {
+    CopyQualityCheckState(other);
+  }
 
   DeformableVolumeMesh& operator=(const DeformableVolumeMesh& other) {
     if (this == &other) return *this;
     mesh_ = other.mesh();
     bvh_ = other.bvh_;
+    bvh_updater_.ResetTopology();
+    CopyQualityCheckState(other);
     return *this;
   }
 
   DeformableVolumeMesh(DeformableVolumeMesh&& other)
-      : DeformableVolumeMesh(std::move(other.mesh_), std::move(other.bvh_)) {}
+      : DeformableVolumeMesh(std::move(other.mesh_), std::move(other.bvh_)) {
+    CopyQualityCheckState(other);
+  }
 
   DeformableVolumeMesh& operator=(DeformableVolumeMesh&& other) {
     if (this == &other) return *this;
     mesh_ = std::move(other.mesh_);
     bvh_ = std::move(other.bvh_);
+    bvh_updater_.ResetTopology();
+    CopyQualityCheckState(other);
     return *this;
   }
 
@@ -82,12 +94,27 @@ class DeformableVolumeMesh {
 
   /* Updates the vertex positions of the underlying mesh.
 
+  The bvh is refit incrementally: only the bounding volumes containing
+  vertices whose (double-valued) positions changed are refit. Every
+  kQualityCheckInterval refits, if the quality of the refit bvh has degraded
+  too far from that of a freshly-built one (see kMaxSahCostRatio), the bvh is
+  rebuilt on the new vertex positions.
+
   @param q  A vector of 3N values (where this mesh has N vertices). The iᵗʰ
             vertex gets values <q(3i), q(3i + 1), q(3i + 2>. Each vertex is
             assumed to be measured and expressed in the mesh's frame M.
   @pre q.size == 3 * mesh().num_vertices(). */
   void UpdateVertexPositions(const Eigen::Ref<const VectorX<T>>& q);
 
+  /* The bvh is rebuilt when the SAH cost of the refit bvh exceeds this
+   multiple of the cost of the bvh when it was built. See
+   BvhUpdater::CalcSahCost(). */
+  static constexpr double kMaxSahCostRatio = 2.0;
+
+  /* The number of refits (i.e., calls to UpdateVertexPositions() that move
+   some vertex) between two evaluations of the SAH cost of the bvh. */
+  static constexpr int kQualityCheckInterval = 16;
+
  private:
   // The delegate constructor used by move and copy constructors. We can't have
   // all three constructors delegate to this same constructor because the base
@@ -101,10 +128,20 @@ class DeformableVolumeMesh {
         bvh_(std::move(bvh_M)),
         bvh_updater_(&mesh_, &bvh_) {}
 
+  void CopyQualityCheckState(const DeformableVolumeMesh& other) {
+    bvh_updater_.set_reference_sah_cost(
+        other.bvh_updater_.reference_sah_cost());
+    num_refits_since_quality_check_ = other.num_refits_since_quality_check_;
+  }
+
   VolumeMesh<T> mesh_;
   MeshDeformer<VolumeMesh<T>> deformer_;
   Bvh<Aabb, VolumeMesh<T>> bvh_;
   BvhUpdater<VolumeMesh<T>> bvh_updater_;
+  // Scratch space for the indices of the vertices moved by the last update.
+  std::vector<int> moved_vertices_;
+  // The number of refits since the SAH cost was last evaluated.
+  int num_refits_since_quality_check_{0};
 };
 
 }  // namespace internal
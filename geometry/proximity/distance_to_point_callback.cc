@@ -1,5 +1,7 @@
 #include "drake/geometry/proximity/distance_to_point_callback.h"
 
+#include <type_traits>
+
 #include "drake/common/default_scalars.h"
 #include "drake/common/drake_bool.h"
 
@@ -533,6 +535,22 @@ bool Callback(fcl::CollisionObjectd* object_A_ptr,
   const EncodedData encoding(*geometry_object);
   GeometryId geometry_id = encoding.id();
 
+  if constexpr (std::is_same_v<T, double>) {
+    if (data.signed_distance_fields != nullptr) {
+      auto iter = data.signed_distance_fields->find(geometry_id);
+      if (iter != data.signed_distance_fields->end()) {
+        const SignedDistanceToPoint<double> distance =
+            CalcSignedDistanceToPoint(*iter->second, geometry_id,
+                                      data.X_WGs.at(geometry_id), data.p_WQ_W);
+        if (distance.distance <= data.threshold) {
+          data.distances.emplace_back(distance);
+        }
+        // Returning false tells fcl to continue to other objects.
+        return false;
+      }
+    }
+  }
+
   const fcl::CollisionGeometryd* collision_geometry =
       geometry_object->collisionGeometry().get();
   if (ScalarSupport<T>::is_supported(collision_geometry->getNodeType())) {
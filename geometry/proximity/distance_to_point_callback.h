@@ -13,6 +13,7 @@
 #include "drake/common/eigen_types.h"
 #include "drake/geometry/geometry_ids.h"
 #include "drake/geometry/proximity/proximity_utilities.h"
+#include "drake/geometry/proximity/signed_distance_field.h"
 #include "drake/geometry/query_results/signed_distance_to_point.h"
 #include "drake/math/rigid_transform.h"
 
@@ -74,6 +75,10 @@ struct CallbackData {
 
   /* The accumulator for results.  */
   std::vector<SignedDistanceToPoint<T>>& distances;
+
+  /* The precomputed signed distance fields, if any. A geometry with a field
+   is evaluated with its field (for T = double) instead of its fcl shape.  */
+  const SignedDistanceFields* signed_distance_fields{};
 };
 
 /* @name Functions for computing distance from point to primitives
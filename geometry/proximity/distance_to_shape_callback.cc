@@ -261,6 +261,11 @@ bool Callback(fcl::CollisionObjectd* object_A_ptr,
       const fcl::CollisionObjectd& fcl_object_B =
           *(swap_AB ? object_A_ptr : object_B_ptr);
 
+      if (data.candidates != nullptr) {
+        data.candidates->emplace_back(&fcl_object_A, &fcl_object_B);
+        return false;
+      }
+
       const GeometryId id_A = swap_AB ? encoding_b.id() : encoding_a.id();
       const GeometryId id_B = swap_AB ? encoding_a.id() : encoding_b.id();
 
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include <fcl/fcl.h>
@@ -73,6 +74,14 @@ struct CallbackData {
 
   /* The results of the distance query.  */
   std::vector<SignedDistancePair<T>>& nearest_pairs{};
+
+  /* If non-null, the callback defers the narrowphase computation: it performs
+   the collision filtering and scalar support checks as usual, but rather than
+   computing the signed distance it records the (consistently ordered) pair of
+   objects here. The recorded pairs can later be evaluated (e.g., in parallel)
+   with ComputeNarrowPhaseDistance(); `nearest_pairs` is left untouched.  */
+  std::vector<std::pair<const fcl::CollisionObjectd*,
+                        const fcl::CollisionObjectd*>>* candidates{};
 };
 
 /* A functor to support ComputeNarrowPhaseDistance(). It computes the signed
@@ -89,6 +89,14 @@ struct CallbackData {
 
   /* The results of the distance query.  */
   std::vector<ContactSurface<T>>& surfaces;
+
+  /* If non-null, the callbacks defer all work beyond the collision filter:
+   each unfiltered pair reported by the broadphase is recorded here (in the
+   order reported) instead of being evaluated, and `surfaces` is left
+   untouched. The recorded pairs can later be passed (e.g., in parallel) to the
+   callback with a CallbackData whose `candidates` is null.  */
+  std::vector<std::pair<fcl::CollisionObjectd*, fcl::CollisionObjectd*>>*
+      candidates{};
 };
 
 enum class CalcContactSurfaceResult {
@@ -286,6 +294,11 @@ bool Callback(fcl::CollisionObjectd* object_A_ptr,
   const bool can_collide =
       data.collision_filter.CanCollideWith(encoding_a.id(), encoding_b.id());
 
+  if (can_collide && data.candidates != nullptr) {
+    data.candidates->emplace_back(object_A_ptr, object_B_ptr);
+    return false;
+  }
+
   if (can_collide) {
     CalcContactSurfaceResult result =
         MaybeCalcContactSurface(object_A_ptr, object_B_ptr, &data);
@@ -372,6 +385,11 @@ bool CallbackWithFallback(fcl::CollisionObjectd* object_A_ptr,
   const bool can_collide = data.data.collision_filter.CanCollideWith(
       encoding_a.id(), encoding_b.id());
 
+  if (can_collide && data.data.candidates != nullptr) {
+    data.data.candidates->emplace_back(object_A_ptr, object_B_ptr);
+    return false;
+  }
+
   if (can_collide) {
     CalcContactSurfaceResult result =
         MaybeCalcContactSurface(object_A_ptr, object_B_ptr, &data.data);
@@ -1,11 +1,16 @@
 #include "drake/geometry/proximity/hydroelastic_internal.h"
 
 #include <algorithm>
+#include <cstdint>
 #include <filesystem>
 #include <string>
+#include <system_error>
 
 #include <fmt/format.h>
 
+#include "drake/common/never_destroyed.h"
+#include "drake/common/ssize.h"
+
 #include "drake/geometry/proximity/make_box_field.h"
 #include "drake/geometry/proximity/make_box_mesh.h"
 #include "drake/geometry/proximity/make_capsule_field.h"
@@ -31,16 +36,53 @@ namespace hydroelastic {
 
 using std::make_unique;
 
-SoftMesh& SoftMesh::operator=(const SoftMesh& s) {
-  if (this == &s) return *this;
+RepresentationCache::RepresentationCache() = default;
+
+RepresentationCache::~RepresentationCache() = default;
+
+RepresentationCache& RepresentationCache::Shared() {
+  static never_destroyed<RepresentationCache> cache;
+  return cache.access();
+}
+
+template <typename HydroGeometry>
+std::optional<HydroGeometry> RepresentationCache::Find(
+    const std::string& key) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  const auto iter = entries_.find(key);
+  if (iter == entries_.end()) return std::nullopt;
+  const HydroGeometry* geometry = std::get_if<HydroGeometry>(&iter->second);
+  if (geometry == nullptr) return std::nullopt;
+  return *geometry;
+}
 
-  mesh_ = make_unique<VolumeMesh<double>>(s.mesh());
-  // We can't simply copy the mesh field; the copy must contain a pointer to
-  // the new mesh. So, we use CloneAndSetMesh() instead.
-  pressure_ = s.pressure().CloneAndSetMesh(mesh_.get());
-  bvh_ = make_unique<Bvh<Obb, VolumeMesh<double>>>(s.bvh());
+template <typename HydroGeometry>
+void RepresentationCache::Add(const std::string& key,
+                              const HydroGeometry& geometry) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (ssize(entries_) >= kMaxEntries) {
+    entries_.clear();
+  }
+  entries_.insert_or_assign(key, geometry);
+}
+
+template std::optional<SoftGeometry> RepresentationCache::Find<SoftGeometry>(
+    const std::string&) const;
+template std::optional<RigidGeometry> RepresentationCache::Find<RigidGeometry>(
+    const std::string&) const;
+template void RepresentationCache::Add<SoftGeometry>(const std::string&,
+                                                     const SoftGeometry&);
+template void RepresentationCache::Add<RigidGeometry>(const std::string&,
+                                                      const RigidGeometry&);
+
+int RepresentationCache::num_entries() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return ssize(entries_);
+}
 
-  return *this;
+void RepresentationCache::Clear() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  entries_.clear();
 }
 
 HydroelasticType Geometries::hydroelastic_type(GeometryId id) const {
@@ -99,15 +141,125 @@ void Geometries::ImplementGeometry(const Sphere& sphere, void* user_data) {
   MakeShape(sphere, *static_cast<ReifyData*>(user_data));
 }
 
+namespace {
+
+// Describes the parameters of a shape for a RepresentationCache key, or
+// returns std::nullopt for shapes whose representations are not cached.
+std::optional<std::string> DescribeShape(const Box& box) {
+  return fmt::format("Box({}, {}, {})", box.width(), box.depth(),
+                     box.height());
+}
+
+std::optional<std::string> DescribeShape(const Capsule& capsule) {
+  return fmt::format("Capsule({}, {})", capsule.radius(), capsule.length());
+}
+
+std::optional<std::string> DescribeShape(const Cylinder& cylinder) {
+  return fmt::format("Cylinder({}, {})", cylinder.radius(), cylinder.length());
+}
+
+std::optional<std::string> DescribeShape(const Ellipsoid& ellipsoid) {
+  return fmt::format("Ellipsoid({}, {}, {})", ellipsoid.a(), ellipsoid.b(),
+                     ellipsoid.c());
+}
+
+std::optional<std::string> DescribeShape(const HalfSpace&) {
+  // Half spaces are never tessellated, so there is nothing worth caching.
+  return std::nullopt;
+}
+
+std::optional<std::string> DescribeShape(const Sphere& sphere) {
+  return fmt::format("Sphere({})", sphere.radius());
+}
+
+// Mesh files are identified by their canonical path, size and modification
+// time. Files that can't be examined aren't cached; building their
+// representations reports the error.
+std::optional<std::string> DescribeMeshFile(const char* type_name,
+                                            const std::string& filename,
+                                            double scale) {
+  std::error_code error;
+  const std::filesystem::path path =
+      std::filesystem::canonical(filename, error);
+  if (error) return std::nullopt;
+  const std::uintmax_t size = std::filesystem::file_size(path, error);
+  if (error) return std::nullopt;
+  const std::filesystem::file_time_type time =
+      std::filesystem::last_write_time(path, error);
+  if (error) return std::nullopt;
+  return fmt::format("{}({}, {}, {}, {})", type_name, path.string(), size,
+                     time.time_since_epoch().count(), scale);
+}
+
+std::optional<std::string> DescribeShape(const Convex& convex) {
+  return DescribeMeshFile("Convex", convex.filename(), convex.scale());
+}
+
+std::optional<std::string> DescribeShape(const Mesh& mesh) {
+  return DescribeMeshFile("Mesh", mesh.filename(), mesh.scale());
+}
+
+// Returns the RepresentationCache key for the given shape and properties, or
+// std::nullopt if its representation should not be cached. The key includes
+// every hydroelastic property that any representation depends on. Properties
+// of an unexpected type aren't cached; building the representation reports
+// the error.
+template <typename ShapeType>
+std::optional<std::string> MakeCacheKey(const ShapeType& shape,
+                                        HydroelasticType type,
+                                        const ProximityProperties& props) {
+  std::optional<std::string> key = DescribeShape(shape);
+  if (!key.has_value()) return std::nullopt;
+  *key += type == HydroelasticType::kSoft ? " soft" : " rigid";
+  for (const char* name : {kRezHint, kElastic, kSlabThickness}) {
+    if (!props.HasProperty(kHydroGroup, name)) continue;
+    const double* value =
+        props.GetPropertyAbstract(kHydroGroup, name).maybe_get_value<double>();
+    if (value == nullptr) return std::nullopt;
+    *key += fmt::format(" {}={}", name, *value);
+  }
+  if (props.HasProperty(kHydroGroup, kSinglePrecisionGradients)) {
+    const bool* value =
+        props.GetPropertyAbstract(kHydroGroup, kSinglePrecisionGradients)
+            .maybe_get_value<bool>();
+    if (value == nullptr) return std::nullopt;
+    *key += fmt::format(" {}={}", kSinglePrecisionGradients, *value);
+  }
+  if (props.HasProperty(kHydroGroup, "tessellation_strategy")) {
+    const TessellationStrategy* strategy =
+        props.GetPropertyAbstract(kHydroGroup, "tessellation_strategy")
+            .maybe_get_value<TessellationStrategy>();
+    if (strategy == nullptr) return std::nullopt;
+    *key += fmt::format(" tessellation_strategy={}",
+                        static_cast<int>(*strategy));
+  }
+  return key;
+}
+
+}  // namespace
+
 template <typename ShapeType>
 void Geometries::MakeShape(const ShapeType& shape, const ReifyData& data) {
+  RepresentationCache& cache = RepresentationCache::Shared();
+  const std::optional<std::string> key =
+      MakeCacheKey(shape, data.type, data.properties);
   switch (data.type) {
     case HydroelasticType::kRigid: {
-      auto hydro_geometry = MakeRigidRepresentation(shape, data.properties);
+      std::optional<RigidGeometry> hydro_geometry;
+      if (key.has_value()) hydro_geometry = cache.Find<RigidGeometry>(*key);
+      if (!hydro_geometry) {
+        hydro_geometry = MakeRigidRepresentation(shape, data.properties);
+        if (hydro_geometry && key.has_value()) cache.Add(*key, *hydro_geometry);
+      }
       if (hydro_geometry) AddGeometry(data.id, std::move(*hydro_geometry));
     } break;
     case HydroelasticType::kSoft: {
-      auto hydro_geometry = MakeSoftRepresentation(shape, data.properties);
+      std::optional<SoftGeometry> hydro_geometry;
+      if (key.has_value()) hydro_geometry = cache.Find<SoftGeometry>(*key);
+      if (!hydro_geometry) {
+        hydro_geometry = MakeSoftRepresentation(shape, data.properties);
+        if (hydro_geometry && key.has_value()) cache.Add(*key, *hydro_geometry);
+      }
       if (hydro_geometry) AddGeometry(data.id, std::move(*hydro_geometry));
     } break;
     case HydroelasticType::kUndefined:
@@ -294,6 +446,23 @@ std::optional<RigidGeometry> MakeRigidRepresentation(
   return RigidGeometry(RigidMesh(std::move(mesh)));
 }
 
+namespace {
+
+// Makes the SoftMesh of a compliant mesh and its pressure field, storing the
+// pressure gradients in single precision if the properties ask for it.
+SoftMesh MakeSoftMesh(
+    std::unique_ptr<VolumeMesh<double>> mesh,
+    std::unique_ptr<VolumeMeshFieldLinear<double, double>> pressure,
+    const ProximityProperties& props) {
+  if (props.GetPropertyOrDefault(kHydroGroup, kSinglePrecisionGradients,
+                                 false)) {
+    pressure->UseSinglePrecisionGradients();
+  }
+  return SoftMesh(std::move(mesh), std::move(pressure));
+}
+
+}  // namespace
+
 std::optional<SoftGeometry> MakeSoftRepresentation(
     const Sphere& sphere, const ProximityProperties& props) {
   PositiveDouble validator("Sphere", "soft");
@@ -312,7 +481,8 @@ std::optional<SoftGeometry> MakeSoftRepresentation(
   auto pressure = make_unique<VolumeMeshFieldLinear<double, double>>(
       MakeSpherePressureField(sphere, mesh.get(), hydroelastic_modulus));
 
-  return SoftGeometry(SoftMesh(std::move(mesh), std::move(pressure)));
+  return SoftGeometry(
+      MakeSoftMesh(std::move(mesh), std::move(pressure), props));
 }
 
 std::optional<SoftGeometry> MakeSoftRepresentation(
@@ -328,7 +498,8 @@ std::optional<SoftGeometry> MakeSoftRepresentation(
   auto pressure = make_unique<VolumeMeshFieldLinear<double, double>>(
       MakeBoxPressureField(box, mesh.get(), hydroelastic_modulus));
 
-  return SoftGeometry(SoftMesh(std::move(mesh), std::move(pressure)));
+  return SoftGeometry(
+      MakeSoftMesh(std::move(mesh), std::move(pressure), props));
 }
 
 std::optional<SoftGeometry> MakeSoftRepresentation(
@@ -345,7 +516,8 @@ std::optional<SoftGeometry> MakeSoftRepresentation(
   auto pressure = make_unique<VolumeMeshFieldLinear<double, double>>(
       MakeCylinderPressureField(cylinder, mesh.get(), hydroelastic_modulus));
 
-  return SoftGeometry(SoftMesh(std::move(mesh), std::move(pressure)));
+  return SoftGeometry(
+      MakeSoftMesh(std::move(mesh), std::move(pressure), props));
 }
 
 std::optional<SoftGeometry> MakeSoftRepresentation(
@@ -362,7 +534,8 @@ std::optional<SoftGeometry> MakeSoftRepresentation(
   auto pressure = make_unique<VolumeMeshFieldLinear<double, double>>(
       MakeCapsulePressureField(capsule, mesh.get(), hydroelastic_modulus));
 
-  return SoftGeometry(SoftMesh(std::move(mesh), std::move(pressure)));
+  return SoftGeometry(
+      MakeSoftMesh(std::move(mesh), std::move(pressure), props));
 }
 
 std::optional<SoftGeometry> MakeSoftRepresentation(
@@ -383,7 +556,8 @@ std::optional<SoftGeometry> MakeSoftRepresentation(
   auto pressure = make_unique<VolumeMeshFieldLinear<double, double>>(
       MakeEllipsoidPressureField(ellipsoid, mesh.get(), hydroelastic_modulus));
 
-  return SoftGeometry(SoftMesh(std::move(mesh), std::move(pressure)));
+  return SoftGeometry(
+      MakeSoftMesh(std::move(mesh), std::move(pressure), props));
 }
 
 std::optional<SoftGeometry> MakeSoftRepresentation(
@@ -420,7 +594,8 @@ std::optional<SoftGeometry> MakeSoftRepresentation(
   auto pressure = make_unique<VolumeMeshFieldLinear<double, double>>(
       MakeConvexPressureField(mesh.get(), hydroelastic_modulus));
 
-  return SoftGeometry(SoftMesh(std::move(mesh), std::move(pressure)));
+  return SoftGeometry(
+      MakeSoftMesh(std::move(mesh), std::move(pressure), props));
 }
 
 std::optional<SoftGeometry> MakeSoftRepresentation(
@@ -436,7 +611,8 @@ std::optional<SoftGeometry> MakeSoftRepresentation(
   auto pressure = make_unique<VolumeMeshFieldLinear<double, double>>(
       MakeVolumeMeshPressureField(mesh.get(), hydroelastic_modulus));
 
-  return SoftGeometry(SoftMesh(std::move(mesh), std::move(pressure)));
+  return SoftGeometry(
+      MakeSoftMesh(std::move(mesh), std::move(pressure), props));
 }
 
 }  // namespace hydroelastic
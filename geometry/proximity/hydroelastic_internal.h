@@ -1,13 +1,16 @@
 #pragma once
 
+#include <map>
 #include <memory>
+#include <mutex>
 #include <optional>
+#include <string>
 #include <unordered_map>
 #include <utility>
 #include <variant>
 
-#include "drake/common/copyable_unique_ptr.h"
 #include "drake/common/drake_assert.h"
+#include "drake/common/drake_copyable.h"
 #include "drake/common/text_logging.h"
 #include "drake/geometry/geometry_ids.h"
 #include "drake/geometry/geometry_roles.h"
@@ -27,7 +30,9 @@ namespace hydroelastic {
 /* Defines a soft mesh -- a mesh, its linearized pressure field, p̃(e), and its
  bounding volume hierarchy. While this class retains ownership of the mesh,
  we assume that both the pressure field and the bounding volume hierarchy
- are derived from the mesh. */
+ are derived from the mesh. All three are immutable, so copies of a %SoftMesh
+ (e.g., when a SceneGraph is cloned or scalar converted) share them rather
+ than duplicating them. */
 class SoftMesh {
  public:
   SoftMesh() = default;
@@ -36,14 +41,11 @@ class SoftMesh {
            std::unique_ptr<VolumeMeshFieldLinear<double, double>> pressure)
       : mesh_(std::move(mesh)),
         pressure_(std::move(pressure)),
-        bvh_(std::make_unique<Bvh<Obb, VolumeMesh<double>>>(*mesh_)) {
+        bvh_(std::make_shared<const Bvh<Obb, VolumeMesh<double>>>(*mesh_)) {
     DRAKE_ASSERT(mesh_.get() == &pressure_->mesh());
   }
 
-  SoftMesh(const SoftMesh& s) { *this = s; }
-  SoftMesh& operator=(const SoftMesh& s);
-  SoftMesh(SoftMesh&&) = default;
-  SoftMesh& operator=(SoftMesh&&) = default;
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(SoftMesh)
 
   const VolumeMesh<double>& mesh() const {
     DRAKE_DEMAND(mesh_ != nullptr);
@@ -59,9 +61,9 @@ class SoftMesh {
   }
 
  private:
-  std::unique_ptr<VolumeMesh<double>> mesh_;
-  std::unique_ptr<VolumeMeshFieldLinear<double, double>> pressure_;
-  std::unique_ptr<Bvh<Obb, VolumeMesh<double>>> bvh_;
+  std::shared_ptr<const VolumeMesh<double>> mesh_;
+  std::shared_ptr<const VolumeMeshFieldLinear<double, double>> pressure_;
+  std::shared_ptr<const Bvh<Obb, VolumeMesh<double>>> bvh_;
 };
 
 /* Defines a soft half space. The half space is defined such that the half
@@ -178,14 +180,16 @@ class SoftGeometry {
 
 /* Defines a rigid mesh -- a surface mesh and its bounding volume hierarchy.
  This class retains ownership of the mesh, with the bounding volume hierarchy
- just referencing it.  */
+ just referencing it. Both are immutable, so copies of a %RigidMesh share
+ them.  */
 class RigidMesh {
  public:
   RigidMesh() = default;
 
   explicit RigidMesh(std::unique_ptr<TriangleSurfaceMesh<double>> mesh)
       : mesh_(std::move(mesh)),
-        bvh_(std::make_unique<Bvh<Obb, TriangleSurfaceMesh<double>>>(*mesh_)) {}
+        bvh_(std::make_shared<const Bvh<Obb, TriangleSurfaceMesh<double>>>(
+            *mesh_)) {}
 
   DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(RigidMesh)
 
@@ -199,8 +203,8 @@ class RigidMesh {
   }
 
  private:
-  copyable_unique_ptr<TriangleSurfaceMesh<double>> mesh_;
-  copyable_unique_ptr<Bvh<Obb, TriangleSurfaceMesh<double>>> bvh_;
+  std::shared_ptr<const TriangleSurfaceMesh<double>> mesh_;
+  std::shared_ptr<const Bvh<Obb, TriangleSurfaceMesh<double>>> bvh_;
 };
 
 /* The base representation of rigid geometries. Generally, a rigid geometry
@@ -257,6 +261,58 @@ class RigidGeometry {
   std::optional<RigidMesh> geometry_{std::nullopt};
 };
 
+/* A process-wide cache of the hydroelastic representations built by
+ Geometries::MaybeAddGeometry(). Building the representation of a mesh, or of a
+ finely resolved primitive, (tessellation, pressure field and bounding volume
+ hierarchy) can dominate the time to set up a scene. With this cache, a shape
+ that is registered again with the same hydroelastic properties (e.g., in
+ several copies of a model, or in a new SceneGraph for each of a number of
+ simulations in the same process) shares the previously built representation
+ instead.
+
+ Entries are keyed on a string that describes the shape and every property
+ that the representation depends on; for Mesh and Convex, it names the file
+ and includes its size and modification time, so that editing a file between
+ registrations is noticed. When the cache holds kMaxEntries entries, it is
+ emptied before adding another.
+
+ This class is thread-safe.  */
+class RepresentationCache {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(RepresentationCache);
+
+  RepresentationCache();
+
+  ~RepresentationCache();
+
+  /* Returns the cache used by all instances of Geometries.  */
+  static RepresentationCache& Shared();
+
+  /* Returns a copy of the representation stored with the given `key`, or
+   std::nullopt if there is none.
+   @tparam HydroGeometry  Either SoftGeometry or RigidGeometry.  */
+  template <typename HydroGeometry>
+  std::optional<HydroGeometry> Find(const std::string& key) const;
+
+  /* Stores a copy of the given `geometry` with the given `key`, replacing any
+   previous entry.
+   @tparam HydroGeometry  Either SoftGeometry or RigidGeometry.  */
+  template <typename HydroGeometry>
+  void Add(const std::string& key, const HydroGeometry& geometry);
+
+  /* Returns the number of stored representations.  */
+  int num_entries() const;
+
+  /* Removes all stored representations.  */
+  void Clear();
+
+  static constexpr int kMaxEntries = 256;
+
+ private:
+  mutable std::mutex mutex_;
+  std::map<std::string, std::variant<SoftGeometry, RigidGeometry>> entries_;
+};
+
 /* This class stores all instantiated hydroelastic representations of declared
  geometry. They are keyed by the geometry's global GeometryId.
 
@@ -318,6 +374,10 @@ class Geometries final : public ShapeReifier {
    @param id            The unique identifier for the geometry.
    @param properties    The proximity properties which will determine if a
                         hydroelastic representation is requested.
+
+   Representations are looked up in, and added to,
+   RepresentationCache::Shared().
+
    @throws std::exception if the shape is a supported type but the properties
                           are malformed.
    @pre There is no previous representation associated with id.  */
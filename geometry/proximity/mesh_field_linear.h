@@ -4,7 +4,9 @@
 #include <array>
 #include <map>
 #include <memory>
+#include <stdexcept>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -278,12 +280,17 @@ class MeshFieldLinear {
   template <typename C>
   promoted_numerical_t<C, T> EvaluateCartesian(int e,
                                                const Vector3<C>& p_MQ) const {
-    if (gradients_.size() == 0) {
-      return Evaluate(e, this->mesh().CalcBarycentric(p_MQ, e));
-    } else {
+    if (gradients_.size() != 0) {
       DRAKE_ASSERT(e < static_cast<int>(gradients_.size()));
       DRAKE_ASSERT(e < static_cast<int>(values_at_Mo_.size()));
       return gradients_[e].dot(p_MQ) + values_at_Mo_[e];
+    } else if (compact_linear_functions_.size() != 0) {
+      DRAKE_ASSERT(e < static_cast<int>(compact_linear_functions_.size()));
+      const Vector4<float>& linear_function = compact_linear_functions_[e];
+      const Vector3<T> gradient = linear_function.head<3>().cast<T>();
+      return gradient.dot(p_MQ) + T(linear_function[3]);
+    } else {
+      return Evaluate(e, this->mesh().CalcBarycentric(p_MQ, e));
     }
   }
 
@@ -293,10 +300,45 @@ class MeshFieldLinear {
   @throws std::exception if the gradient vector was not calculated.
   */
   Vector3<T> EvaluateGradient(int e) const {
-    if (gradients_.size() == 0) {
-      throw std::runtime_error("Gradient vector was not calculated.");
+    if (gradients_.size() != 0) {
+      return gradients_[e];
+    }
+    if (compact_linear_functions_.size() != 0) {
+      return compact_linear_functions_[e].head<3>().cast<T>();
+    }
+    throw std::runtime_error("Gradient vector was not calculated.");
+  }
+
+  /** (Advanced) Stores the per-element gradients, and the values used by
+   EvaluateCartesian(), in single precision (float) instead of T. This halves
+   the memory of the per-element data of a field on a large mesh (which is
+   most of the memory of the field) and so the memory traffic of evaluating
+   it. The data is still converted to T before any arithmetic.
+
+   The price is the precision of EvaluateGradient() and EvaluateCartesian(),
+   whose results then have a relative error of about 1e-7 (with respect to
+   the magnitudes of the gradient and of the field values). The values at the
+   vertices (EvaluateAtVertex(), Evaluate()) are unchanged.
+
+   Does nothing if the gradients were not calculated.
+   @throws std::exception if T is not double. */
+  void UseSinglePrecisionGradients() {
+    if constexpr (std::is_same_v<T, double>) {
+      if (gradients_.size() == 0) {
+        return;
+      }
+      compact_linear_functions_.resize(gradients_.size());
+      for (size_t i = 0; i < gradients_.size(); ++i) {
+        compact_linear_functions_[i] << gradients_[i].template cast<float>(),
+            static_cast<float>(values_at_Mo_[i]);
+      }
+      std::vector<Vector3<T>>().swap(gradients_);
+      std::vector<T>().swap(values_at_Mo_);
+    } else {
+      throw std::logic_error(
+          "MeshFieldLinear::UseSinglePrecisionGradients() is only supported "
+          "for fields of double.");
     }
-    return gradients_[e];
   }
 
   /** (Advanced) Transforms this mesh field to be measured and expressed in
@@ -313,6 +355,16 @@ class MeshFieldLinear {
       gradients_[i] = X_NM.rotation() * gradients_[i];
       values_at_Mo_[i] -= gradients_[i].dot(X_NM.translation());
     }
+    if constexpr (std::is_same_v<T, double>) {
+      for (Vector4<float>& linear_function : compact_linear_functions_) {
+        const Vector3<T> gradient =
+            X_NM.rotation() * linear_function.head<3>().cast<T>();
+        const T value_at_Mo =
+            T(linear_function[3]) - gradient.dot(X_NM.translation());
+        linear_function << gradient.template cast<float>(),
+            static_cast<float>(value_at_Mo);
+      }
+    }
   }
 
   /** Copy to a new %MeshFieldLinear and set the new %MeshFieldLinear to use a
@@ -349,6 +401,9 @@ class MeshFieldLinear {
     }
     if (gradients_ != field.gradients_) return false;
     if (values_at_Mo_ != field.values_at_Mo_) return false;
+    if (compact_linear_functions_ != field.compact_linear_functions_) {
+      return false;
+    }
     // All checks passed.
     return true;
   }
@@ -418,6 +473,10 @@ class MeshFieldLinear {
   // piecewise linear field on the mesh elements_[i] at Mo the origin of
   // frame M of the mesh. Notice that Mo may or may not lie inside elements_[i].
   std::vector<T> values_at_Mo_;
+  // After UseSinglePrecisionGradients(), the gradients_ and values_at_Mo_
+  // (which are then empty) are stored here instead, in single precision:
+  // compact_linear_functions_[i] = (gradients_[i], values_at_Mo_[i]).
+  std::vector<Vector4<float>> compact_linear_functions_;
 };
 
 }  // namespace geometry
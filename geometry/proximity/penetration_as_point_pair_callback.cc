@@ -399,6 +399,11 @@ bool Callback(fcl::CollisionObjectd* fcl_object_A_ptr,
   // Since we want *all* collisions, we return false.
   if (!can_collide) return false;
 
+  if (data.candidates != nullptr) {
+    data.candidates->emplace_back(fcl_object_A_ptr, fcl_object_B_ptr);
+    return false;
+  }
+
   if (ScalarSupport<T>::is_supported(
           fcl_object_A_ptr->collisionGeometry()->getNodeType(),
           fcl_object_B_ptr->collisionGeometry()->getNodeType())) {
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include <fcl/fcl.h>
@@ -22,7 +23,8 @@ namespace penetration_as_point_pair DRAKE_NO_EXPORT {
     - An fcl collision request. Aliased.
     - The poses. Aliased.
     - A vector of point pairs -- one instance of PenetrationAsPointPair for
-      every supported, unfiltered penetrating pair. Aliased. */
+      every supported, unfiltered penetrating pair. Aliased.
+    - Optionally, a vector of candidate pairs. Aliased. */
 template <typename T>
 struct CallbackData {
   CallbackData(
@@ -57,6 +59,14 @@ struct CallbackData {
 
   /* The results of the collision query.  */
   std::vector<PenetrationAsPointPair<T>>& point_pairs;
+
+  /* If non-null, the callback defers all work beyond the collision filter:
+   each unfiltered pair reported by the broadphase is recorded here (in the
+   order reported) instead of being evaluated, and `point_pairs` is left
+   untouched. The recorded pairs can later be passed (e.g., in parallel) to the
+   callback with a CallbackData whose `candidates` is null.  */
+  std::vector<std::pair<fcl::CollisionObjectd*, fcl::CollisionObjectd*>>*
+      candidates{};
 };
 
 /* Callback function for FCL's collide() function for retrieving a *single*
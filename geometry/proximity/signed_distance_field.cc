@@ -0,0 +1,376 @@
+#include "drake/geometry/proximity/signed_distance_field.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <string>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include "drake/common/drake_throw.h"
+#include "drake/common/fmt_eigen.h"
+#include "drake/common/sorted_pair.h"
+#include "drake/geometry/proximity/aabb.h"
+#include "drake/geometry/proximity/bvh.h"
+#include "drake/geometry/proximity/make_mesh_from_vtk.h"
+#include "drake/geometry/proximity/obj_to_surface_mesh.h"
+#include "drake/geometry/proximity/volume_to_surface_mesh.h"
+#include "drake/geometry/proximity_properties.h"
+
+namespace drake {
+namespace geometry {
+namespace internal {
+
+using Eigen::Vector3d;
+
+namespace {
+
+/* The features of a triangle (with vertices A, B, C) that can be nearest to a
+ point.  */
+enum class Feature { kA, kB, kC, kAB, kAC, kBC, kFace };
+
+/* Returns the point on the triangle ABC nearest to Q and reports the feature
+ it lies on. This is the algorithm of Ericson, Real-Time Collision Detection,
+ Section 5.1.5.  */
+Vector3d CalcNearestPointOnTriangle(const Vector3d& p_Q, const Vector3d& p_A,
+                                    const Vector3d& p_B, const Vector3d& p_C,
+                                    Feature* feature) {
+  const Vector3d p_AB = p_B - p_A;
+  const Vector3d p_AC = p_C - p_A;
+  const Vector3d p_AQ = p_Q - p_A;
+  const double d1 = p_AB.dot(p_AQ);
+  const double d2 = p_AC.dot(p_AQ);
+  if (d1 <= 0 && d2 <= 0) {
+    *feature = Feature::kA;
+    return p_A;
+  }
+  const Vector3d p_BQ = p_Q - p_B;
+  const double d3 = p_AB.dot(p_BQ);
+  const double d4 = p_AC.dot(p_BQ);
+  if (d3 >= 0 && d4 <= d3) {
+    *feature = Feature::kB;
+    return p_B;
+  }
+  const double vc = d1 * d4 - d3 * d2;
+  if (vc <= 0 && d1 >= 0 && d3 <= 0) {
+    *feature = Feature::kAB;
+    return p_A + (d1 / (d1 - d3)) * p_AB;
+  }
+  const Vector3d p_CQ = p_Q - p_C;
+  const double d5 = p_AB.dot(p_CQ);
+  const double d6 = p_AC.dot(p_CQ);
+  if (d6 >= 0 && d5 <= d6) {
+    *feature = Feature::kC;
+    return p_C;
+  }
+  const double vb = d5 * d2 - d1 * d6;
+  if (vb <= 0 && d2 >= 0 && d6 <= 0) {
+    *feature = Feature::kAC;
+    return p_A + (d2 / (d2 - d6)) * p_AC;
+  }
+  const double va = d3 * d6 - d5 * d4;
+  if (va <= 0 && (d4 - d3) >= 0 && (d5 - d6) >= 0) {
+    *feature = Feature::kBC;
+    return p_B + ((d4 - d3) / ((d4 - d3) + (d5 - d6))) * (p_C - p_B);
+  }
+  *feature = Feature::kFace;
+  const double denominator = 1.0 / (va + vb + vc);
+  return p_A + (vb * denominator) * p_AB + (vc * denominator) * p_AC;
+}
+
+/* Returns the squared distance from Q to the box.  */
+double CalcSquaredDistanceToAabb(const Vector3d& p_GQ, const Aabb& box) {
+  const Vector3d excess =
+      ((p_GQ - box.center()).cwiseAbs() - box.half_width()).cwiseMax(0.0);
+  return excess.squaredNorm();
+}
+
+/* Computes the signed distance from points to a closed triangle mesh: the
+ nearest triangle is found with a bounding volume hierarchy and the sign is
+ given by the angle-weighted pseudo-normal of the nearest feature (Bærentzen
+ and Aanæs, "Signed distance computation using the angle weighted
+ pseudonormal", 2005).  */
+class MeshSignedDistance {
+ public:
+  explicit MeshSignedDistance(const TriangleSurfaceMesh<double>& mesh_G)
+      : mesh_G_(mesh_G),
+        bvh_G_(mesh_G),
+        vertex_normals_(mesh_G.num_vertices(), Vector3d::Zero()) {
+    for (int t = 0; t < mesh_G.num_triangles(); ++t) {
+      const Vector3d& normal = mesh_G.face_normal(t);
+      const SurfaceTriangle& triangle = mesh_G.element(t);
+      for (int i = 0; i < 3; ++i) {
+        const int v = triangle.vertex(i);
+        const int v_next = triangle.vertex((i + 1) % 3);
+        const int v_prev = triangle.vertex((i + 2) % 3);
+        edge_normals_.try_emplace(SortedPair<int>(v, v_next), Vector3d::Zero())
+            .first->second += normal;
+        const Vector3d u = mesh_G.vertex(v_next) - mesh_G.vertex(v);
+        const Vector3d w = mesh_G.vertex(v_prev) - mesh_G.vertex(v);
+        const double angle = std::atan2(u.cross(w).norm(), u.dot(w));
+        vertex_normals_[v] += angle * normal;
+      }
+    }
+  }
+
+  double Calc(const Vector3d& p_GQ) {
+    // Start from the nearest triangle of the previous query; consecutive
+    // queries are at adjacent samples, so this culls most of the hierarchy.
+    Feature feature{};
+    Vector3d p_GN = NearestPointOnTriangle(p_GQ, last_triangle_, &feature);
+    double best_squared_distance = (p_GQ - p_GN).squaredNorm();
+    if (std::isnan(best_squared_distance)) {
+      // The previous triangle is degenerate.
+      best_squared_distance = std::numeric_limits<double>::infinity();
+    }
+    int best_triangle = last_triangle_;
+    Feature best_feature = feature;
+
+    nodes_.clear();
+    nodes_.push_back(&bvh_G_.root_node());
+    while (!nodes_.empty()) {
+      const NodeType& node = *nodes_.back();
+      nodes_.pop_back();
+      if (CalcSquaredDistanceToAabb(p_GQ, node.bv()) >=
+          best_squared_distance) {
+        continue;
+      }
+      if (node.is_leaf()) {
+        for (int i = 0; i < node.num_element_indices(); ++i) {
+          const int t = node.element_index(i);
+          const Vector3d p_GM = NearestPointOnTriangle(p_GQ, t, &feature);
+          const double squared_distance = (p_GQ - p_GM).squaredNorm();
+          if (squared_distance < best_squared_distance) {
+            best_squared_distance = squared_distance;
+            best_triangle = t;
+            best_feature = feature;
+            p_GN = p_GM;
+          }
+        }
+        continue;
+      }
+      // Visit the nearer child first.
+      const NodeType* near = &node.left();
+      const NodeType* far = &node.right();
+      if (CalcSquaredDistanceToAabb(p_GQ, far->bv()) <
+          CalcSquaredDistanceToAabb(p_GQ, near->bv())) {
+        std::swap(near, far);
+      }
+      nodes_.push_back(far);
+      nodes_.push_back(near);
+    }
+
+    last_triangle_ = best_triangle;
+    const double distance = std::sqrt(best_squared_distance);
+    const Vector3d normal = PseudoNormal(best_triangle, best_feature);
+    return (p_GQ - p_GN).dot(normal) < 0 ? -distance : distance;
+  }
+
+ private:
+  using NodeType = BvNode<Aabb, TriangleSurfaceMesh<double>>;
+
+  Vector3d NearestPointOnTriangle(const Vector3d& p_GQ, int t,
+                                  Feature* feature) const {
+    const SurfaceTriangle& triangle = mesh_G_.element(t);
+    return CalcNearestPointOnTriangle(
+        p_GQ, mesh_G_.vertex(triangle.vertex(0)),
+        mesh_G_.vertex(triangle.vertex(1)), mesh_G_.vertex(triangle.vertex(2)),
+        feature);
+  }
+
+  Vector3d PseudoNormal(int t, Feature feature) const {
+    const SurfaceTriangle& triangle = mesh_G_.element(t);
+    const int a = triangle.vertex(0);
+    const int b = triangle.vertex(1);
+    const int c = triangle.vertex(2);
+    switch (feature) {
+      case Feature::kA:
+        return vertex_normals_[a];
+      case Feature::kB:
+        return vertex_normals_[b];
+      case Feature::kC:
+        return vertex_normals_[c];
+      case Feature::kAB:
+        return edge_normals_.at(SortedPair<int>(a, b));
+      case Feature::kAC:
+        return edge_normals_.at(SortedPair<int>(a, c));
+      case Feature::kBC:
+        return edge_normals_.at(SortedPair<int>(b, c));
+      case Feature::kFace:
+        return mesh_G_.face_normal(t);
+    }
+    DRAKE_UNREACHABLE();
+  }
+
+  const TriangleSurfaceMesh<double>& mesh_G_;
+  const Bvh<Aabb, TriangleSurfaceMesh<double>> bvh_G_;
+  std::vector<Vector3d> vertex_normals_;
+  std::unordered_map<SortedPair<int>, Vector3d> edge_normals_;
+  // The traversal stack, kept to avoid reallocating it for each query.
+  std::vector<const NodeType*> nodes_;
+  int last_triangle_{0};
+};
+
+/* Reads the surface mesh of a Mesh or Convex.  */
+template <typename MeshShape>
+TriangleSurfaceMesh<double> ReadSurfaceMesh(const MeshShape& shape,
+                                            const char* shape_name) {
+  const std::string extension = shape.extension();
+  if (extension == ".obj") {
+    return ReadObjToTriangleSurfaceMesh(shape.filename(), shape.scale());
+  }
+  if (extension == ".vtk") {
+    return ConvertVolumeToSurfaceMesh(MakeVolumeMeshFromVtk<double>(shape));
+  }
+  throw std::runtime_error(fmt::format(
+      "MakeSignedDistanceField(): signed distance fields of {} shapes can "
+      "only be made from .obj or .vtk files; given: {}",
+      shape_name, shape.filename()));
+}
+
+template <typename MeshShape>
+std::optional<SignedDistanceField> MaybeMakeField(
+    const MeshShape& shape, const ProximityProperties& properties,
+    const char* shape_name) {
+  if (!properties.HasProperty(kSdfGroup, kSdfResolution)) {
+    return std::nullopt;
+  }
+  const double resolution =
+      properties.GetProperty<double>(kSdfGroup, kSdfResolution);
+  return SignedDistanceField(ReadSurfaceMesh(shape, shape_name), resolution);
+}
+
+}  // namespace
+
+SignedDistanceField::SignedDistanceField(
+    const TriangleSurfaceMesh<double>& mesh_G, double resolution)
+    : resolution_(resolution) {
+  DRAKE_THROW_UNLESS(std::isfinite(resolution) && resolution > 0);
+  // A margin of two cells keeps the samples on the grid's boundary outside of
+  // the mesh, which the extrapolation beyond the grid relies on.
+  const double margin = 2 * resolution;
+  Vector3d p_GMin = Vector3d::Constant(std::numeric_limits<double>::infinity());
+  Vector3d p_GMax = -p_GMin;
+  for (const Vector3d& p_GV : mesh_G.vertices()) {
+    p_GMin = p_GMin.cwiseMin(p_GV);
+    p_GMax = p_GMax.cwiseMax(p_GV);
+  }
+  p_GL_ = p_GMin.array() - margin;
+  int64_t total_num_samples = 1;
+  for (int i = 0; i < 3; ++i) {
+    num_samples_(i) = static_cast<int>(
+        std::ceil((p_GMax(i) + margin - p_GL_(i)) / resolution)) + 1;
+    total_num_samples *= num_samples_(i);
+  }
+  if (total_num_samples > kMaxNumSamples) {
+    throw std::logic_error(fmt::format(
+        "SignedDistanceField: a resolution of {} m would require {} samples "
+        "for a mesh with an extent of {} m; the maximum is {}. Use a coarser "
+        "resolution.",
+        resolution, total_num_samples, fmt_eigen((p_GMax - p_GMin).transpose()),
+        kMaxNumSamples));
+  }
+  p_GH_ = p_GL_ + resolution * (num_samples_ - Vector3<int>::Ones())
+                                   .cast<double>();
+
+  MeshSignedDistance signed_distance(mesh_G);
+  samples_.resize(total_num_samples);
+  int index = 0;
+  for (int k = 0; k < num_samples_.z(); ++k) {
+    for (int j = 0; j < num_samples_.y(); ++j) {
+      for (int i = 0; i < num_samples_.x(); ++i) {
+        samples_[index++] =
+            signed_distance.Calc(p_GL_ + resolution * Vector3d(i, j, k));
+      }
+    }
+  }
+}
+
+double SignedDistanceField::Evaluate(const Vector3d& p_GQ,
+                                     Vector3d* grad_G) const {
+  DRAKE_DEMAND(grad_G != nullptr);
+  const Vector3d p_GC = p_GQ.cwiseMax(p_GL_).cwiseMin(p_GH_);
+  if (p_GC == p_GQ) {
+    return EvaluateInGrid(p_GQ, grad_G);
+  }
+  // Q is outside the grid. C, the grid point nearest to Q, lies outside of the
+  // mesh, so N = C - φ(C)∇φ(C) approximates the surface point nearest to C.
+  // We report the distance to N, which is exact when N is also Q's nearest
+  // surface point (e.g., for convex meshes).
+  Vector3d grad_C;
+  const double distance_C = EvaluateInGrid(p_GC, &grad_C);
+  const Vector3d p_NQ = p_GQ - (p_GC - distance_C * grad_C);
+  const double distance = p_NQ.norm();
+  *grad_G = distance > 0 ? Vector3d(p_NQ / distance) : grad_C;
+  return distance;
+}
+
+double SignedDistanceField::EvaluateInGrid(const Vector3d& p_GQ,
+                                           Vector3d* grad_G) const {
+  // The cell containing Q (its lowest sample) and Q's coordinates in it.
+  const Vector3d s = (p_GQ - p_GL_) / resolution_;
+  Vector3<int> cell;
+  Vector3d t;
+  for (int i = 0; i < 3; ++i) {
+    cell(i) = std::clamp(static_cast<int>(std::floor(s(i))), 0,
+                         num_samples_(i) - 2);
+    t(i) = s(i) - cell(i);
+  }
+  const int i = cell.x();
+  const int j = cell.y();
+  const int k = cell.z();
+  const double c000 = sample(i, j, k);
+  const double c100 = sample(i + 1, j, k);
+  const double c010 = sample(i, j + 1, k);
+  const double c110 = sample(i + 1, j + 1, k);
+  const double c001 = sample(i, j, k + 1);
+  const double c101 = sample(i + 1, j, k + 1);
+  const double c011 = sample(i, j + 1, k + 1);
+  const double c111 = sample(i + 1, j + 1, k + 1);
+
+  // Interpolate along x, then y, then z.
+  const double c00 = c000 + t.x() * (c100 - c000);
+  const double c10 = c010 + t.x() * (c110 - c010);
+  const double c01 = c001 + t.x() * (c101 - c001);
+  const double c11 = c011 + t.x() * (c111 - c011);
+  const double c0 = c00 + t.y() * (c10 - c00);
+  const double c1 = c01 + t.y() * (c11 - c01);
+  const double distance = c0 + t.z() * (c1 - c0);
+
+  // The partial derivatives of the trilinear interpolant.
+  const double dx0 = (c100 - c000) + t.y() * ((c110 - c010) - (c100 - c000));
+  const double dx1 = (c101 - c001) + t.y() * ((c111 - c011) - (c101 - c001));
+  const double dx = dx0 + t.z() * (dx1 - dx0);
+  const double dy = (c10 - c00) + t.z() * ((c11 - c01) - (c10 - c00));
+  const double dz = c1 - c0;
+  const Vector3d gradient = Vector3d(dx, dy, dz) / resolution_;
+  const double norm = gradient.norm();
+  *grad_G = norm > 0 ? Vector3d(gradient / norm) : Vector3d::UnitX();
+  return distance;
+}
+
+SignedDistanceToPoint<double> CalcSignedDistanceToPoint(
+    const SignedDistanceField& field, GeometryId id,
+    const math::RigidTransformd& X_WG, const Vector3d& p_WQ) {
+  const Vector3d p_GQ = X_WG.inverse() * p_WQ;
+  Vector3d grad_G;
+  const double distance = field.Evaluate(p_GQ, &grad_G);
+  const Vector3d p_GN = p_GQ - distance * grad_G;
+  return SignedDistanceToPoint<double>(id, p_GN, distance,
+                                       X_WG.rotation() * grad_G);
+}
+
+std::optional<SignedDistanceField> MaybeMakeSignedDistanceField(
+    const Mesh& mesh, const ProximityProperties& properties) {
+  return MaybeMakeField(mesh, properties, "Mesh");
+}
+
+std::optional<SignedDistanceField> MaybeMakeSignedDistanceField(
+    const Convex& convex, const ProximityProperties& properties) {
+  return MaybeMakeField(convex, properties, "Convex");
+}
+
+}  // namespace internal
+}  // namespace geometry
+}  // namespace drake
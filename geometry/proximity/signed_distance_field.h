@@ -0,0 +1,114 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
+#include "drake/geometry/geometry_ids.h"
+#include "drake/geometry/geometry_roles.h"
+#include "drake/geometry/proximity/triangle_surface_mesh.h"
+#include "drake/geometry/query_results/signed_distance_to_point.h"
+#include "drake/geometry/shape_specification.h"
+#include "drake/math/rigid_transform.h"
+
+namespace drake {
+namespace geometry {
+namespace internal {
+
+/* A precomputed signed distance field φ of a closed triangle surface mesh.
+
+ The signed distance to the mesh is sampled at the vertices of a regular grid
+ (with the given resolution) that covers the mesh's bounding box plus a margin
+ of two grid cells. Inside the grid, φ and its gradient are reconstructed by
+ trilinear interpolation of the samples, so that each evaluation costs O(1),
+ independent of the number of triangles. The interpolation error is on the
+ order of the resolution near sharp features and much smaller on smooth
+ regions of the surface. Outside the grid, φ is extrapolated as the distance to
+ the approximate nearest surface point of the closest grid point.
+
+ The samples are computed once, at construction, with a bounding volume
+ hierarchy for the nearest triangle and angle-weighted pseudo-normals for the
+ sign. All quantities are measured and expressed in the mesh's frame G.  */
+class SignedDistanceField {
+ public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(SignedDistanceField);
+
+  /* The maximum number of samples in a field (128 MiB of samples).  */
+  static constexpr int kMaxNumSamples = 1 << 24;
+
+  /* Samples the signed distance to `mesh_G`.
+   @param mesh_G      A closed, consistently oriented (outward normals)
+                      triangle mesh, measured and expressed in frame G.
+   @param resolution  The distance (in meters) between adjacent samples.
+   @throws std::exception if `resolution` is not positive and finite, or if the
+                          field would have more than kMaxNumSamples samples.  */
+  SignedDistanceField(const TriangleSurfaceMesh<double>& mesh_G,
+                      double resolution);
+
+  /* Evaluates the signed distance φ(Q) of the query point Q and its (unit
+   length) gradient ∇φ(Q).
+   @param p_GQ         The position of Q, measured and expressed in G.
+   @param[out] grad_G  The gradient, expressed in G. Where the interpolated
+                       gradient vanishes, it is arbitrarily set to +x.  */
+  double Evaluate(const Vector3<double>& p_GQ, Vector3<double>* grad_G) const;
+
+  double resolution() const { return resolution_; }
+
+  /* The number of samples along each of G's axes.  */
+  const Vector3<int>& num_samples() const { return num_samples_; }
+
+ private:
+  // Evaluates the interpolated field at a point Q inside the grid.
+  double EvaluateInGrid(const Vector3<double>& p_GQ,
+                        Vector3<double>* grad_G) const;
+
+  double sample(int i, int j, int k) const {
+    return samples_[(k * num_samples_.y() + j) * num_samples_.x() + i];
+  }
+
+  // The position of the grid's lowest corner (the sample (0, 0, 0)).
+  Vector3<double> p_GL_;
+  // The position of the grid's highest corner.
+  Vector3<double> p_GH_;
+  double resolution_{};
+  Vector3<int> num_samples_;
+  // The samples, with the x index varying fastest.
+  std::vector<double> samples_;
+};
+
+/* The signed distance fields of the geometries that have one. The fields are
+ immutable, so copies of the owner can share them.  */
+using SignedDistanceFields =
+    std::unordered_map<GeometryId, std::shared_ptr<const SignedDistanceField>>;
+
+/* Computes the signed distance from the query point Q to the geometry G with
+ the given signed distance `field`, as reported by
+ QueryObject::ComputeSignedDistanceToPoint(). The witness point N on G's
+ surface is Q displaced by -φ(Q)∇φ(Q).  */
+SignedDistanceToPoint<double> CalcSignedDistanceToPoint(
+    const SignedDistanceField& field, GeometryId id,
+    const math::RigidTransformd& X_WG, const Vector3<double>& p_WQ);
+
+/* @name Creating signed distance fields from shapes
+ Returns the signed distance field of the given shape if its `properties`
+ request one (see AddSignedDistanceFieldProperties()), or nullopt otherwise.
+ A Mesh's field is of the mesh itself (which must be closed); a Convex's field
+ is of the mesh in its file, which is assumed to be convex.
+ @throws std::exception if a field is requested for a file that is neither
+                        .obj nor .vtk.  */
+//@{
+
+std::optional<SignedDistanceField> MaybeMakeSignedDistanceField(
+    const Mesh& mesh, const ProximityProperties& properties);
+
+std::optional<SignedDistanceField> MaybeMakeSignedDistanceField(
+    const Convex& convex, const ProximityProperties& properties);
+
+//@}
+
+}  // namespace internal
+}  // namespace geometry
+}  // namespace drake
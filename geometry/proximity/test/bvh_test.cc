@@ -246,6 +246,36 @@ TYPED_TEST(BvhTest, TestBuildBvTree) {
   EXPECT_EQ(element_indices.size(), num_elements);
 }
 
+// Tests that the nodes are stored contiguously in depth-first order: each
+// branch's left child immediately follows it and its right child follows the
+// left child's subtree, so the whole tree occupies num_nodes() adjacent nodes
+// starting at the root.
+TYPED_TEST(BvhTest, TestDepthFirstLayout) {
+  using BvType = TypeParam;
+  using NodeType = BvNode<BvType, TriangleSurfaceMesh<double>>;
+  const NodeType* const root = &this->bvh_.root_node();
+  EXPECT_EQ(this->bvh_.num_nodes(), 7);
+
+  // Visits the subtree rooted at `node` and returns the index of the node
+  // following the subtree.
+  std::function<int(const NodeType&)> check_layout;
+  check_layout = [&check_layout, root](const NodeType& node) {
+    const int index = &node - root;
+    if (node.is_leaf()) return index + 1;
+    EXPECT_EQ(&node.left() - root, index + 1);
+    const int right_index = check_layout(node.left());
+    EXPECT_EQ(&node.right() - root, right_index);
+    return check_layout(node.right());
+  };
+  EXPECT_EQ(check_layout(*root), this->bvh_.num_nodes());
+
+  // The layout is preserved by copying.
+  const Bvh<BvType, TriangleSurfaceMesh<double>> bvh_copy(this->bvh_);
+  EXPECT_TRUE(bvh_copy.Equal(this->bvh_));
+  const NodeType& copy_root = bvh_copy.root_node();
+  EXPECT_EQ(&copy_root.right() - &copy_root, &root->right() - root);
+}
+
 // Tests copy constructor.
 TYPED_TEST(BvhTest, TestCopy) {
   // Copy constructor.
@@ -1,5 +1,6 @@
 #include "drake/geometry/proximity/bvh_updater.h"
 
+#include <algorithm>
 #include <utility>
 #include <vector>
 
@@ -193,6 +194,116 @@ TYPED_TEST(BvhUpdaterTest, Update) {
       (R * expected_right_bv.half_width().cast<T>()).cwiseAbs(), 2 * kEps));
 }
 
+/* Tests that the partial update refits exactly the same boxes as the full
+ update when given the moved vertices (and leaves the rest untouched). */
+TYPED_TEST(BvhUpdaterTest, PartialUpdate) {
+  using MeshType = TypeParam;
+  using T = typename MeshType::ScalarType;
+
+  MeshType mesh = this->MakeMesh();
+  Bvh<Aabb, MeshType> bvh_partial(mesh);
+  Bvh<Aabb, MeshType> bvh_full(mesh);
+  BvhUpdater<MeshType> updater_partial(&mesh, &bvh_partial);
+  BvhUpdater<MeshType> updater_full(&mesh, &bvh_full);
+  MeshDeformer<MeshType> deformer(&mesh);
+  const Aabb left_before = bvh_partial.root_node().left().bv();
+
+  /* Move only the vertices of the element on the +x side (vertices 0, 1, 2,
+   and, for volume meshes, 6). */
+  const vector<int> moved{0, 1, 2, 6};
+  VectorX<T> p_MVs(3 * mesh.num_vertices());
+  for (int i = 0; i < mesh.num_vertices(); ++i) {
+    const bool is_moved = std::count(moved.begin(), moved.end(), i) > 0;
+    p_MVs.segment(i * 3, 3)
+        << mesh.vertex(i) + (is_moved ? Vector3<T>(0.5, 1, -2)
+                                      : Vector3<T>::Zero());
+  }
+  deformer.SetAllPositions(p_MVs);
+  updater_partial.Update(moved);
+  updater_full.Update();
+
+  EXPECT_TRUE(bvh_partial.Equal(bvh_full));
+  EXPECT_FALSE(bvh_partial.Equal(Bvh<Aabb, MeshType>(this->MakeMesh())));
+
+  /* The box of the untouched element didn't change. */
+  const auto& left = bvh_partial.root_node().left();
+  EXPECT_TRUE(CompareMatrices(left.bv().center(), left_before.center()));
+  EXPECT_TRUE(
+      CompareMatrices(left.bv().half_width(), left_before.half_width()));
+
+  /* An empty set of moved vertices is a no-op. */
+  updater_partial.Update(vector<int>{});
+  EXPECT_TRUE(bvh_partial.Equal(bvh_full));
+}
+
+/* Tests the SAH cost and the rebuild logic on a mesh large enough that heavy
+ deformation degrades the refit tree. The mesh is a row of small, disjoint
+ tetrahedra along the x-axis; the deformation shuffles the tetrahedra along the
+ row without deforming them. Refitting keeps the original grouping of
+ tetrahedra in the tree (which is now spatially incoherent) while rebuilding
+ groups neighboring tetrahedra again. */
+GTEST_TEST(BvhUpdaterQualityTest, RebuildIfDegraded) {
+  constexpr int kNumTets = 64;
+  auto make_vertices = [](auto position_of_tet) {
+    vector<Vector3d> vertices;
+    for (int i = 0; i < kNumTets; ++i) {
+      const Vector3d offset(position_of_tet(i), 0, 0);
+      vertices.push_back(offset);
+      vertices.push_back(offset + Vector3d(0.5, 0, 0));
+      vertices.push_back(offset + Vector3d(0, 0.5, 0));
+      vertices.push_back(offset + Vector3d(0, 0, 0.5));
+    }
+    return vertices;
+  };
+  vector<VolumeElement> tets;
+  for (int i = 0; i < kNumTets; ++i) {
+    tets.emplace_back(4 * i, 4 * i + 1, 4 * i + 2, 4 * i + 3);
+  }
+  VolumeMesh<double> mesh(std::move(tets),
+                          make_vertices([](int i) { return i; }));
+  Bvh<Aabb, VolumeMesh<double>> bvh(mesh);
+  BvhUpdater<VolumeMesh<double>> updater(&mesh, &bvh);
+  MeshDeformer<VolumeMesh<double>> deformer(&mesh);
+
+  const double initial_cost = updater.CalcSahCost();
+  EXPECT_GT(initial_cost, 0);
+  EXPECT_EQ(updater.reference_sah_cost(), initial_cost);
+  EXPECT_FALSE(updater.RebuildIfDegraded(1.0));
+
+  /* Shuffle the tetrahedra with a fixed permutation (37 and 64 are coprime).
+   */
+  const vector<Vector3d> shuffled =
+      make_vertices([](int i) { return (i * 37) % kNumTets; });
+  VectorX<double> p_MVs(3 * mesh.num_vertices());
+  for (int i = 0; i < mesh.num_vertices(); ++i) {
+    p_MVs.segment(i * 3, 3) << shuffled[i];
+  }
+  deformer.SetAllPositions(p_MVs);
+  updater.Update();
+  const double refit_cost = updater.CalcSahCost();
+  EXPECT_GT(refit_cost, 2 * initial_cost);
+
+  /* A generous ratio doesn't trigger a rebuild. */
+  EXPECT_FALSE(updater.RebuildIfDegraded(1e6));
+  EXPECT_EQ(updater.CalcSahCost(), refit_cost);
+
+  ASSERT_TRUE(updater.RebuildIfDegraded(2.0));
+  EXPECT_TRUE(bvh.Equal(Bvh<Aabb, VolumeMesh<double>>(mesh)));
+  EXPECT_LT(updater.CalcSahCost(), refit_cost);
+  EXPECT_EQ(updater.reference_sah_cost(), updater.CalcSahCost());
+
+  /* The partial update remains correct after the rebuild changed the
+   topology. (We start from fully refit boxes so that the untouched boxes are
+   computed in the same way as those of the reference.) */
+  updater.Update();
+  p_MVs.segment(0, 3) << 0.1, 0.2, 0.3;
+  deformer.SetAllPositions(p_MVs);
+  updater.Update(vector<int>{0});
+  Bvh<Aabb, VolumeMesh<double>> expected(bvh);
+  BvhUpdater<VolumeMesh<double>>(&mesh, &expected).Update();
+  EXPECT_TRUE(bvh.Equal(expected));
+}
+
 }  // namespace
 }  // namespace internal
 }  // namespace geometry
@@ -3,6 +3,7 @@
 #include <gtest/gtest.h>
 
 #include "drake/common/find_resource.h"
+#include "drake/common/ssize.h"
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
 #include "drake/common/test_utilities/expect_no_throw.h"
 #include "drake/common/test_utilities/expect_throws_message.h"
@@ -419,6 +420,60 @@ GTEST_TEST(GeometriesTest, ComputeDeformableContact) {
   EXPECT_EQ(contact_data.contact_surfaces().size(), 0);
 }
 
+/* The contact data doesn't depend on the number of threads used to compute
+ it. */
+GTEST_TEST(GeometriesTest, ComputeDeformableContactInParallel) {
+  Geometries geometries;
+  CollisionFilter collision_filter;
+  /* A row of deformable unit cubes, each overlapped by two rigid boxes. */
+  const int kNumDeformables = 4;
+  std::vector<GeometryId> deformable_ids;
+  for (int i = 0; i < kNumDeformables; ++i) {
+    const GeometryId deformable_id = GeometryId::get_new_id();
+    VolumeMesh<double> mesh =
+        MakeBoxVolumeMesh<double>(Box::MakeCube(1.0), 0.5);
+    mesh.TransformVertices(math::RigidTransformd(Vector3d(3.0 * i, 0, 0)));
+    geometries.AddDeformableGeometry(deformable_id, std::move(mesh));
+    collision_filter.AddGeometry(deformable_id);
+    deformable_ids.push_back(deformable_id);
+
+    for (const double y : {-0.75, 0.75}) {
+      const GeometryId rigid_id = GeometryId::get_new_id();
+      geometries.MaybeAddRigidGeometry(
+          Box::MakeCube(1.0), rigid_id, MakeProximityPropsWithRezHint(0.5),
+          math::RigidTransformd(Vector3d(3.0 * i, y, 0.1 * i)));
+      collision_filter.AddGeometry(rigid_id);
+    }
+  }
+
+  const DeformableContact<double> serial =
+      geometries.ComputeDeformableContact(collision_filter, false);
+  const DeformableContact<double> parallel =
+      geometries.ComputeDeformableContact(collision_filter, Parallelism(4));
+  ASSERT_EQ(serial.contact_surfaces().size(), 2 * kNumDeformables);
+  ASSERT_EQ(parallel.contact_surfaces().size(),
+            serial.contact_surfaces().size());
+  for (int i = 0; i < ssize(serial.contact_surfaces()); ++i) {
+    const DeformableContactSurface<double>& expected =
+        serial.contact_surfaces()[i];
+    const DeformableContactSurface<double>& actual =
+        parallel.contact_surfaces()[i];
+    EXPECT_EQ(actual.id_A(), expected.id_A());
+    EXPECT_EQ(actual.id_B(), expected.id_B());
+    EXPECT_EQ(actual.num_contact_points(), expected.num_contact_points());
+    EXPECT_TRUE(actual.contact_mesh_W().Equal(expected.contact_mesh_W()));
+    EXPECT_EQ(actual.signed_distances(), expected.signed_distances());
+  }
+  for (const GeometryId deformable_id : deformable_ids) {
+    EXPECT_GT(
+        serial.contact_participation(deformable_id).num_vertices_in_contact(),
+        0);
+    EXPECT_EQ(
+        parallel.contact_participation(deformable_id).num_vertices_in_contact(),
+        serial.contact_participation(deformable_id).num_vertices_in_contact());
+  }
+}
+
 }  // namespace
 }  // namespace deformable
 }  // namespace internal
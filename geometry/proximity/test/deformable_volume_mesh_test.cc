@@ -223,6 +223,96 @@ TYPED_TEST(DeformableVolumeMeshTest, MoveAssignment) {
   EXPECT_TRUE(dut.bvh().Equal(scaled_bvh));
 }
 
+/* When only some vertices move, the bvh is refit incrementally. The result
+ must match a full refit of the original bvh. */
+TYPED_TEST(DeformableVolumeMeshTest, UpdateSubsetOfVertices) {
+  using T = TypeParam;
+  /* We start by moving all vertices (a full refit) so that all boxes have been
+   computed by refitting, just like those of the reference bvh. */
+  VectorX<T> q = this->ExtractVertexPositions(this->MakeBox(1.5));
+  this->mesh_.UpdateVertexPositions(q);
+  Bvh<Aabb, VolumeMesh<T>> expected(this->mesh_.bvh());
+
+  /* Move a single vertex well outside the box. */
+  q.segment(0, 3) *= 3;
+  this->mesh_.UpdateVertexPositions(q);
+  EXPECT_TRUE(this->MatchesQ(q));
+
+  BvhUpdater<VolumeMesh<T>>(&this->mesh_.mesh(), &expected).Update();
+  EXPECT_TRUE(this->mesh_.bvh().Equal(expected));
+  const Aabb& root_bv = this->mesh_.bvh().root_node().bv();
+  const Vector3<double> p_MV = convert_to_double(this->mesh_.mesh().vertex(0));
+  EXPECT_TRUE((root_bv.lower().array() <= p_MV.array()).all());
+  EXPECT_TRUE((root_bv.upper().array() >= p_MV.array()).all());
+
+  /* Re-applying the same positions is a no-op. */
+  this->mesh_.UpdateVertexPositions(q);
+  EXPECT_TRUE(this->mesh_.bvh().Equal(expected));
+}
+
+/* The quality of the bvh is only measured every kQualityCheckInterval refits.
+ Splitting the vertices of a finely tessellated box into two distant clusters
+ (by the parity of their indices) stretches nearly every element across both,
+ so refitting yields a badly degraded bvh, which is rebuilt at the next check.
+ */
+TYPED_TEST(DeformableVolumeMeshTest, PeriodicQualityCheck) {
+  using T = TypeParam;
+  constexpr int kInterval = DeformableVolumeMesh<T>::kQualityCheckInterval;
+  const VolumeMesh<T> box = MakeBoxVolumeMesh<T>(this->box(), 0.5);
+  DeformableVolumeMesh<T> dut(box);
+  const VectorX<T> q0 = this->ExtractVertexPositions(box);
+
+  /* Each update also shifts the whole mesh, so that every update moves all of
+   the vertices. */
+  const auto update = [&](int i) {
+    VectorX<T> q = q0;
+    for (int v = 0; v < box.num_vertices(); ++v) {
+      q(3 * v) += 10.0 * (v % 2) + 0.01 * i;
+    }
+    dut.UpdateVertexPositions(q);
+  };
+  for (int i = 1; i < kInterval; ++i) {
+    update(i);
+    EXPECT_FALSE(dut.bvh().Equal(Bvh<Aabb, VolumeMesh<T>>(dut.mesh())));
+  }
+  update(kInterval);
+  EXPECT_TRUE(dut.bvh().Equal(Bvh<Aabb, VolumeMesh<T>>(dut.mesh())));
+}
+
+/* Copies of a mesh whose bvh has been refit carry over its quality
+ bookkeeping: they check the quality at the same refit as the original, and
+ against the cost of the bvh that was originally built, not the cost of the
+ degraded bvh at the time of the copy. */
+TYPED_TEST(DeformableVolumeMeshTest, CopiesKeepQualityCheckState) {
+  using T = TypeParam;
+  constexpr int kInterval = DeformableVolumeMesh<T>::kQualityCheckInterval;
+  const VolumeMesh<T> box = MakeBoxVolumeMesh<T>(this->box(), 0.5);
+  DeformableVolumeMesh<T> dut(box);
+  const VectorX<T> q0 = this->ExtractVertexPositions(box);
+  const auto positions = [&](int i) {
+    VectorX<T> q = q0;
+    for (int v = 0; v < box.num_vertices(); ++v) {
+      q(3 * v) += 10.0 * (v % 2) + 0.01 * i;
+    }
+    return q;
+  };
+  for (int i = 1; i < kInterval; ++i) {
+    dut.UpdateVertexPositions(positions(i));
+  }
+
+  DeformableVolumeMesh<T> copy_constructed(dut);
+  DeformableVolumeMesh<T> copy_assigned(this->MakeBox());
+  copy_assigned = dut;
+  DeformableVolumeMesh<T> move_source(dut);
+  DeformableVolumeMesh<T> move_constructed(std::move(move_source));
+  const VectorX<T> q = positions(kInterval);
+  for (DeformableVolumeMesh<T>* mesh :
+       {&dut, &copy_constructed, &copy_assigned, &move_constructed}) {
+    mesh->UpdateVertexPositions(q);
+    EXPECT_TRUE(mesh->bvh().Equal(Bvh<Aabb, VolumeMesh<T>>(mesh->mesh())));
+  }
+}
+
 }  // namespace
 }  // namespace internal
 }  // namespace geometry
@@ -10,6 +10,7 @@
 
 #include "drake/common/find_resource.h"
 #include "drake/common/temp_directory.h"
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
 #include "drake/common/test_utilities/expect_no_throw.h"
 #include "drake/common/test_utilities/expect_throws_message.h"
 #include "drake/geometry/proximity/make_sphere_field.h"
@@ -45,10 +46,10 @@ GTEST_TEST(SoftMeshTest, TestCopyMoveAssignConstruct) {
     SoftMesh copy;
     copy = original;
 
-    // Test for uniqueness.
-    EXPECT_NE(&original.mesh(), &copy.mesh());
-    EXPECT_NE(&original.pressure(), &copy.pressure());
-    EXPECT_NE(&original.bvh(), &copy.bvh());
+    // Copies share the immutable contents.
+    EXPECT_EQ(&original.mesh(), &copy.mesh());
+    EXPECT_EQ(&original.pressure(), &copy.pressure());
+    EXPECT_EQ(&original.bvh(), &copy.bvh());
 
     EXPECT_TRUE(copy.mesh().Equal(original.mesh()));
 
@@ -67,10 +68,10 @@ GTEST_TEST(SoftMeshTest, TestCopyMoveAssignConstruct) {
   {
     SoftMesh copy(original);
 
-    // Test for uniqueness.
-    EXPECT_NE(&original.mesh(), &copy.mesh());
-    EXPECT_NE(&original.pressure(), &copy.pressure());
-    EXPECT_NE(&original.bvh(), &copy.bvh());
+    // Copies share the immutable contents.
+    EXPECT_EQ(&original.mesh(), &copy.mesh());
+    EXPECT_EQ(&original.pressure(), &copy.pressure());
+    EXPECT_EQ(&original.bvh(), &copy.bvh());
 
     EXPECT_TRUE(copy.mesh().Equal(original.mesh()));
 
@@ -140,10 +141,10 @@ GTEST_TEST(SoftGeometryTest, TestCopyMoveAssignConstruct) {
     SoftGeometry dut(SoftHalfSpace{1e+7});
     dut = original;
 
-    // Test for uniqueness. The contents have different memory addresses.
-    EXPECT_NE(&original.mesh(), &dut.mesh());
-    EXPECT_NE(&original.pressure_field(), &dut.pressure_field());
-    EXPECT_NE(&original.bvh(), &dut.bvh());
+    // Copies share the immutable contents.
+    EXPECT_EQ(&original.mesh(), &dut.mesh());
+    EXPECT_EQ(&original.pressure_field(), &dut.pressure_field());
+    EXPECT_EQ(&original.bvh(), &dut.bvh());
 
     EXPECT_TRUE(dut.mesh().Equal(original.mesh()));
     const auto& copy_pressure =
@@ -160,10 +161,10 @@ GTEST_TEST(SoftGeometryTest, TestCopyMoveAssignConstruct) {
   {
     SoftGeometry copy(original);
 
-    // Test for uniqueness. The contents have different memory addresses.
-    EXPECT_NE(&original.mesh(), &copy.mesh());
-    EXPECT_NE(&original.pressure_field(), &copy.pressure_field());
-    EXPECT_NE(&original.bvh(), &copy.bvh());
+    // Copies share the immutable contents.
+    EXPECT_EQ(&original.mesh(), &copy.mesh());
+    EXPECT_EQ(&original.pressure_field(), &copy.pressure_field());
+    EXPECT_EQ(&original.bvh(), &copy.bvh());
 
     EXPECT_TRUE(copy.mesh().Equal(original.mesh()));
     const auto& copy_pressure =
@@ -221,9 +222,9 @@ GTEST_TEST(RigidMeshTest, TestCopyMoveAssignConstruct) {
     RigidMesh copy;
     copy = original;
 
-    // Test for uniqueness.
-    EXPECT_NE(&original.mesh(), &copy.mesh());
-    EXPECT_NE(&original.bvh(), &copy.bvh());
+    // Copies share the immutable contents.
+    EXPECT_EQ(&original.mesh(), &copy.mesh());
+    EXPECT_EQ(&original.bvh(), &copy.bvh());
 
     EXPECT_TRUE(copy.mesh().Equal(original.mesh()));
     EXPECT_TRUE(copy.bvh().Equal(original.bvh()));
@@ -233,9 +234,9 @@ GTEST_TEST(RigidMeshTest, TestCopyMoveAssignConstruct) {
   {
     RigidMesh copy(original);
 
-    // Test for uniqueness.
-    EXPECT_NE(&original.mesh(), &copy.mesh());
-    EXPECT_NE(&original.bvh(), &copy.bvh());
+    // Copies share the immutable contents.
+    EXPECT_EQ(&original.mesh(), &copy.mesh());
+    EXPECT_EQ(&original.bvh(), &copy.bvh());
 
     EXPECT_TRUE(copy.mesh().Equal(original.mesh()));
     EXPECT_TRUE(copy.bvh().Equal(original.bvh()));
@@ -286,9 +287,9 @@ GTEST_TEST(RigidGeometryTest, TestCopyMoveAssignConstruct) {
     RigidGeometry dut(HalfSpace{});
     dut = original;
 
-    // Test for uniqueness. The contents have different memory addresses.
-    EXPECT_NE(&original.mesh(), &dut.mesh());
-    EXPECT_NE(&original.bvh(), &dut.bvh());
+    // Copies share the immutable contents.
+    EXPECT_EQ(&original.mesh(), &dut.mesh());
+    EXPECT_EQ(&original.bvh(), &dut.bvh());
 
     EXPECT_TRUE(dut.mesh().Equal(original.mesh()));
     EXPECT_TRUE(dut.bvh().Equal(original.bvh()));
@@ -298,9 +299,9 @@ GTEST_TEST(RigidGeometryTest, TestCopyMoveAssignConstruct) {
   {
     RigidGeometry copy(original);
 
-    // Test for uniqueness. Their contents are at different memory addresses.
-    EXPECT_NE(&original.mesh(), &copy.mesh());
-    EXPECT_NE(&original.bvh(), &copy.bvh());
+    // Copies share the immutable contents.
+    EXPECT_EQ(&original.mesh(), &copy.mesh());
+    EXPECT_EQ(&original.bvh(), &copy.bvh());
 
     EXPECT_TRUE(copy.mesh().Equal(original.mesh()));
     EXPECT_TRUE(copy.bvh().Equal(original.bvh()));
@@ -412,6 +413,82 @@ GTEST_TEST(Hydroelastic, RemoveGeometry) {
   }
 }
 
+// Tests that Geometries reuse the representations of shapes that have been
+// registered before with the same properties.
+GTEST_TEST(Hydroelastic, RepresentationCache) {
+  RepresentationCache& cache = RepresentationCache::Shared();
+  cache.Clear();
+
+  ProximityProperties soft_properties;
+  AddCompliantHydroelasticProperties(0.25, 1e8, &soft_properties);
+  Geometries first;
+  const GeometryId first_id = GeometryId::get_new_id();
+  first.MaybeAddGeometry(Sphere(0.5), first_id, soft_properties);
+  EXPECT_EQ(cache.num_entries(), 1);
+
+  // The same shape in another collection shares the cached representation.
+  Geometries second;
+  const GeometryId second_id = GeometryId::get_new_id();
+  second.MaybeAddGeometry(Sphere(0.5), second_id, soft_properties);
+  EXPECT_EQ(cache.num_entries(), 1);
+  const SoftGeometry& first_soft = first.soft_geometry(first_id);
+  const SoftGeometry& second_soft = second.soft_geometry(second_id);
+  EXPECT_EQ(&first_soft.mesh(), &second_soft.mesh());
+  EXPECT_TRUE(second_soft.mesh().Equal(first_soft.mesh()));
+  EXPECT_TRUE(second_soft.pressure_field().Equal(first_soft.pressure_field()));
+  EXPECT_TRUE(second_soft.bvh().Equal(first_soft.bvh()));
+
+  // A different shape, resolution or compliance needs a new entry.
+  second.MaybeAddGeometry(Sphere(0.75), GeometryId::get_new_id(),
+                          soft_properties);
+  EXPECT_EQ(cache.num_entries(), 2);
+  ProximityProperties finer_properties;
+  AddCompliantHydroelasticProperties(0.125, 1e8, &finer_properties);
+  second.MaybeAddGeometry(Sphere(0.5), GeometryId::get_new_id(),
+                          finer_properties);
+  EXPECT_EQ(cache.num_entries(), 3);
+  ProximityProperties rigid_properties;
+  AddRigidHydroelasticProperties(0.25, &rigid_properties);
+  second.MaybeAddGeometry(Sphere(0.5), GeometryId::get_new_id(),
+                          rigid_properties);
+  EXPECT_EQ(cache.num_entries(), 4);
+
+  // Half spaces are not cached.
+  ProximityProperties half_space_properties;
+  AddCompliantHydroelasticPropertiesForHalfSpace(1.0, 1e8,
+                                                 &half_space_properties);
+  second.MaybeAddGeometry(HalfSpace(), GeometryId::get_new_id(),
+                          half_space_properties);
+  EXPECT_EQ(cache.num_entries(), 4);
+
+  // Changing the contents of a mesh file is noticed.
+  const std::string filename = temp_directory() + "/cached.obj";
+  std::filesystem::copy(
+      FindResourceOrThrow("drake/geometry/test/quad_cube.obj"), filename);
+  const GeometryId cube_id = GeometryId::get_new_id();
+  second.MaybeAddGeometry(Mesh(filename), cube_id, rigid_properties);
+  EXPECT_EQ(cache.num_entries(), 5);
+  std::filesystem::copy(
+      FindResourceOrThrow("drake/geometry/test/convex.obj"), filename,
+      std::filesystem::copy_options::overwrite_existing);
+  const GeometryId convex_id = GeometryId::get_new_id();
+  second.MaybeAddGeometry(Mesh(filename), convex_id, rigid_properties);
+  EXPECT_EQ(cache.num_entries(), 6);
+  EXPECT_NE(second.rigid_geometry(convex_id).mesh().num_vertices(),
+            second.rigid_geometry(cube_id).mesh().num_vertices());
+
+  // Malformed properties still throw, and are not cached.
+  ProximityProperties bad_properties;
+  AddRigidHydroelasticProperties(-1.0, &bad_properties);
+  EXPECT_THROW(second.MaybeAddGeometry(Sphere(0.5), GeometryId::get_new_id(),
+                                       bad_properties),
+               std::exception);
+  EXPECT_EQ(cache.num_entries(), 6);
+
+  cache.Clear();
+  EXPECT_EQ(cache.num_entries(), 0);
+}
+
 class HydroelasticRigidGeometryTest : public ::testing::Test {
  protected:
   /* Creates a simple set of properties for generating rigid geometry. */
@@ -1043,6 +1120,36 @@ TEST_F(HydroelasticSoftGeometryTest, Box) {
   }
 }
 
+// The single-precision gradients property produces the same pressure field,
+// up to float rounding.
+TEST_F(HydroelasticSoftGeometryTest, SinglePrecisionGradients) {
+  const Box box_spec(0.2, 0.4, 0.8);
+  const ProximityProperties properties = soft_properties();
+  ProximityProperties compact_properties = soft_properties();
+  compact_properties.AddProperty(kHydroGroup, kSinglePrecisionGradients, true);
+
+  const std::optional<SoftGeometry> box =
+      MakeSoftRepresentation(box_spec, properties);
+  const std::optional<SoftGeometry> compact_box =
+      MakeSoftRepresentation(box_spec, compact_properties);
+  ASSERT_TRUE(box.has_value());
+  ASSERT_TRUE(compact_box.has_value());
+  ASSERT_EQ(compact_box->mesh().num_elements(), box->mesh().num_elements());
+
+  const double E = properties.GetPropertyOrDefault(kHydroGroup, kElastic, 1e8);
+  // The pressure varies by E over the box's half-width (0.1 m).
+  const double kGradientTolerance = 1e-6 * E / 0.1;
+  for (int e = 0; e < box->mesh().num_elements(); ++e) {
+    EXPECT_TRUE(CompareMatrices(
+        compact_box->pressure_field().EvaluateGradient(e),
+        box->pressure_field().EvaluateGradient(e), kGradientTolerance));
+  }
+  for (int v = 0; v < box->mesh().num_vertices(); ++v) {
+    EXPECT_EQ(compact_box->pressure_field().EvaluateAtVertex(v),
+              box->pressure_field().EvaluateAtVertex(v));
+  }
+}
+
 // Test construction of a soft cylinder.
 TEST_F(HydroelasticSoftGeometryTest, Cylinder) {
   const double radius = 1.0;
@@ -308,6 +308,54 @@ GTEST_TEST(MeshFieldLinearTest, EvaluateCartesianWithAndWithoutGradient) {
   }
 }
 
+// Tests that the single-precision gradients give (nearly) the same results as
+// the double-precision ones, before and after Transform(), and leave the
+// values at the vertices alone.
+GTEST_TEST(MeshFieldLinearTest, UseSinglePrecisionGradients) {
+  VolumeMesh<double> mesh_M =
+      internal::MakeBoxVolumeMesh<double>(Box(0.5, 1.5, 2), 0.125);
+  // A field with large values, typical of hydroelastic pressure fields:
+  //     f(x,y,z) = 3.5e6 x - 2.7e6 y + 0.7e6 z + 1.23e6.
+  std::vector<double> values;
+  for (const Vector3d& p_MV : mesh_M.vertices()) {
+    values.push_back(3.5e6 * p_MV.x() - 2.7e6 * p_MV.y() + 0.7e6 * p_MV.z() +
+                     1.23e6);
+  }
+  MeshFieldLinear<double, VolumeMesh<double>> field_double(
+      std::vector<double>(values), &mesh_M);
+  MeshFieldLinear<double, VolumeMesh<double>> field_single(
+      std::vector<double>(values), &mesh_M);
+  field_single.UseSinglePrecisionGradients();
+  EXPECT_FALSE(field_single.Equal(field_double));
+
+  const double kGradientTolerance = 1e-7 * 5e6;
+  const double kValueTolerance = 1e-7 * 1e7;
+  const auto expect_near = [&]() {
+    for (int e = 0; e < mesh_M.num_elements(); ++e) {
+      EXPECT_TRUE(CompareMatrices(field_single.EvaluateGradient(e),
+                                  field_double.EvaluateGradient(e),
+                                  kGradientTolerance));
+      Vector3d p_MQ = Vector3d::Zero();
+      for (int i = 0; i < 4; ++i) {
+        p_MQ += 0.1 * (i + 1) * mesh_M.vertex(mesh_M.element(e).vertex(i));
+      }
+      EXPECT_NEAR(field_single.EvaluateCartesian(e, p_MQ),
+                  field_double.EvaluateCartesian(e, p_MQ), kValueTolerance);
+    }
+  };
+  expect_near();
+  for (int v = 0; v < mesh_M.num_vertices(); ++v) {
+    EXPECT_EQ(field_single.EvaluateAtVertex(v), values[v]);
+  }
+
+  const RigidTransformd X_NM(RollPitchYawd(M_PI_2, M_PI_4, M_PI / 6.),
+                             Vector3d(1.2, 1.3, -4.3));
+  mesh_M.TransformVertices(X_NM);
+  field_double.Transform(X_NM);
+  field_single.Transform(X_NM);
+  expect_near();
+}
+
 /* A double-valued field can produce AutoDiffXd-valued results for
  Evaluate() and EvaluateCartesian() based on the scalar type of the query point.
  This confirms that mixing behavior. The tests work by instantiating fields and
@@ -0,0 +1,163 @@
+#include "drake/geometry/proximity/signed_distance_field.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/find_resource.h"
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
+#include "drake/geometry/proximity_properties.h"
+
+namespace drake {
+namespace geometry {
+namespace internal {
+namespace {
+
+using Eigen::Vector3d;
+using math::RigidTransformd;
+using math::RotationMatrixd;
+
+// The cube [-1, 1]³ with outward-facing triangles.
+TriangleSurfaceMesh<double> MakeCube() {
+  std::vector<Vector3d> vertices;
+  for (int i = 0; i < 8; ++i) {
+    vertices.emplace_back((i & 1) ? 1 : -1, (i & 2) ? 1 : -1, (i & 4) ? 1 : -1);
+  }
+  std::vector<SurfaceTriangle> triangles{
+      {0, 2, 1}, {1, 2, 3},  // -z
+      {4, 5, 6}, {5, 7, 6},  // +z
+      {0, 1, 4}, {1, 5, 4},  // -y
+      {2, 6, 3}, {3, 6, 7},  // +y
+      {0, 4, 2}, {2, 4, 6},  // -x
+      {1, 3, 5}, {3, 7, 5},  // +x
+  };
+  return TriangleSurfaceMesh<double>(std::move(triangles), std::move(vertices));
+}
+
+// The exact signed distance to the cube [-1, 1]³.
+double CubeSignedDistance(const Vector3d& p) {
+  const Vector3d q = p.cwiseAbs() - Vector3d::Ones();
+  return q.cwiseMax(0.0).norm() + std::min(q.maxCoeff(), 0.0);
+}
+
+// With a resolution of 0.25 and a margin of two cells, the grid spans
+// [-1.5, 1.5]³ and has 13 samples along each axis.
+constexpr double kResolution = 0.25;
+
+GTEST_TEST(SignedDistanceFieldTest, Construction) {
+  const SignedDistanceField field(MakeCube(), kResolution);
+  EXPECT_EQ(field.resolution(), kResolution);
+  EXPECT_EQ(field.num_samples(), Vector3<int>(13, 13, 13));
+
+  DRAKE_EXPECT_THROWS_MESSAGE(SignedDistanceField(MakeCube(), 0.0),
+                              ".*resolution.*");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      SignedDistanceField(MakeCube(), std::numeric_limits<double>::infinity()),
+      ".*resolution.*");
+  DRAKE_EXPECT_THROWS_MESSAGE(SignedDistanceField(MakeCube(), 1e-4),
+                              ".*would require .* samples.*coarser.*");
+}
+
+// At the samples, the field is the exact signed distance, including where the
+// nearest feature is a face, an edge, or a vertex, inside and outside.
+GTEST_TEST(SignedDistanceFieldTest, Samples) {
+  const SignedDistanceField field(MakeCube(), kResolution);
+  for (int i = 0; i < 13; ++i) {
+    for (int j = 0; j < 13; j += 3) {
+      for (int k = 0; k < 13; k += 4) {
+        const Vector3d p_GQ =
+            Vector3d::Constant(-1.5) + kResolution * Vector3d(i, j, k);
+        Vector3d grad_G;
+        EXPECT_NEAR(field.Evaluate(p_GQ, &grad_G), CubeSignedDistance(p_GQ),
+                    1e-14)
+            << p_GQ.transpose();
+        EXPECT_NEAR(grad_G.norm(), 1.0, 1e-14);
+      }
+    }
+  }
+}
+
+// Between the samples, the field is interpolated. Near the middle of a face
+// (inside and outside), the exact signed distance is linear, so is reproduced
+// exactly; elsewhere, the error is bounded by the resolution.
+GTEST_TEST(SignedDistanceFieldTest, Interpolation) {
+  const SignedDistanceField field(MakeCube(), kResolution);
+  Vector3d grad_G;
+
+  EXPECT_NEAR(field.Evaluate(Vector3d(1.3, 0.1, -0.2), &grad_G), 0.3, 1e-14);
+  EXPECT_TRUE(CompareMatrices(grad_G, Vector3d::UnitX(), 1e-14));
+  EXPECT_NEAR(field.Evaluate(Vector3d(0.1, 0.05, -0.8), &grad_G), -0.2, 1e-14);
+  EXPECT_TRUE(CompareMatrices(grad_G, -Vector3d::UnitZ(), 1e-14));
+
+  for (const Vector3d& p_GQ :
+       {Vector3d(1.1, 1.2, 0.3), Vector3d(-1.37, 1.21, 1.13),
+        Vector3d(0.55, -0.61, 0.49), Vector3d(0.01, 0.02, 0.03)}) {
+    EXPECT_NEAR(field.Evaluate(p_GQ, &grad_G), CubeSignedDistance(p_GQ),
+                kResolution)
+        << p_GQ.transpose();
+    EXPECT_NEAR(grad_G.norm(), 1.0, 1e-14);
+  }
+}
+
+// Beyond the grid, the field reports the distance to the approximate nearest
+// surface point of the nearest grid point.
+GTEST_TEST(SignedDistanceFieldTest, Extrapolation) {
+  const SignedDistanceField field(MakeCube(), kResolution);
+  Vector3d grad_G;
+  EXPECT_NEAR(field.Evaluate(Vector3d(5, 0.1, 0.2), &grad_G), 4.0, 1e-14);
+  EXPECT_TRUE(CompareMatrices(grad_G, Vector3d::UnitX(), 1e-14));
+  // Beyond a corner of the grid, the nearest surface point is the cube's
+  // corner.
+  const Vector3d p_GQ(3, 4, -5);
+  EXPECT_NEAR(field.Evaluate(p_GQ, &grad_G), CubeSignedDistance(p_GQ), 1e-14);
+  EXPECT_TRUE(CompareMatrices(grad_G, Vector3d(2, 3, -4).normalized(), 1e-14));
+}
+
+GTEST_TEST(SignedDistanceFieldTest, CalcSignedDistanceToPoint) {
+  const SignedDistanceField field(MakeCube(), kResolution);
+  const GeometryId id = GeometryId::get_new_id();
+  const RigidTransformd X_WG(RotationMatrixd::MakeZRotation(M_PI / 2),
+                             Vector3d(10, 0, 0));
+  const Vector3d p_GQ(1.3, 0.1, -0.2);
+  const SignedDistanceToPoint<double> result =
+      CalcSignedDistanceToPoint(field, id, X_WG, X_WG * p_GQ);
+  EXPECT_EQ(result.id_G, id);
+  EXPECT_NEAR(result.distance, 0.3, 1e-14);
+  EXPECT_TRUE(CompareMatrices(result.p_GN, Vector3d(1, 0.1, -0.2), 1e-14));
+  EXPECT_TRUE(CompareMatrices(result.grad_W, Vector3d::UnitY(), 1e-14));
+}
+
+GTEST_TEST(SignedDistanceFieldTest, MaybeMakeSignedDistanceField) {
+  const std::string filename =
+      FindResourceOrThrow("drake/geometry/test/quad_cube.obj");
+  ProximityProperties properties;
+  EXPECT_FALSE(MaybeMakeSignedDistanceField(Mesh(filename), properties)
+                   .has_value());
+  EXPECT_FALSE(MaybeMakeSignedDistanceField(Convex(filename), properties)
+                   .has_value());
+
+  AddSignedDistanceFieldProperties(kResolution, &properties);
+  for (const std::optional<SignedDistanceField>& field :
+       {MaybeMakeSignedDistanceField(Mesh(filename), properties),
+        MaybeMakeSignedDistanceField(Convex(filename), properties)}) {
+    ASSERT_TRUE(field.has_value());
+    EXPECT_EQ(field->resolution(), kResolution);
+    Vector3d grad_G;
+    EXPECT_NEAR(field->Evaluate(Vector3d::Zero(), &grad_G), -1.0, 1e-14);
+  }
+
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      MaybeMakeSignedDistanceField(Mesh("cube.stl"), properties),
+      ".*only be made from .obj or .vtk files.*cube.stl");
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace geometry
+}  // namespace drake
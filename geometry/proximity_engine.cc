@@ -2,7 +2,9 @@
 
 #include <algorithm>
 #include <filesystem>
+#include <iterator>
 #include <limits>
+#include <optional>
 #include <string>
 #include <tuple>
 #include <type_traits>
@@ -15,6 +17,9 @@
 
 #include "drake/common/default_scalars.h"
 #include "drake/common/eigen_types.h"
+#include "drake/common/instrumentation.h"
+#include "drake/common/parallel_for.h"
+#include "drake/common/ssize.h"
 #include "drake/geometry/geometry_ids.h"
 #include "drake/geometry/proximity/collisions_exist_callback.h"
 #include "drake/geometry/proximity/deformable_contact_geometries.h"
@@ -27,6 +32,7 @@
 #include "drake/geometry/proximity/make_mesh_from_vtk.h"
 #include "drake/geometry/proximity/obj_to_surface_mesh.h"
 #include "drake/geometry/proximity/penetration_as_point_pair_callback.h"
+#include "drake/geometry/proximity/signed_distance_field.h"
 #include "drake/geometry/proximity/volume_to_surface_mesh.h"
 #include "drake/geometry/proximity/vtk_to_volume_mesh.h"
 #include "drake/geometry/read_obj.h"
@@ -61,78 +67,61 @@ class FclDynamicAABBTreeCollisionManager
 class MapGeometryIdToFclCollisionObject
     : public unordered_map<GeometryId, unique_ptr<CollisionObjectd>> {};
 
-// Returns a copy of the given fcl collision geometry; throws an exception for
-// unsupported collision geometry types. This supplements the *missing* cloning
-// functionality in FCL. Issue has been submitted to FCL:
-// https://github.com/flexible-collision-library/fcl/issues/246
-shared_ptr<fcl::ShapeBased> CopyShapeOrThrow(
-    const fcl::CollisionGeometryd& geometry) {
-  // NOTE: Returns a shared pointer because of the FCL API in assigning
-  // collision geometry to collision objects.
-  switch (geometry.getNodeType()) {
-    case fcl::GEOM_SPHERE: {
-      const auto& sphere = dynamic_cast<const fcl::Sphered&>(geometry);
-      return make_shared<fcl::Sphered>(sphere.radius);
-    }
-    case fcl::GEOM_CYLINDER: {
-      const auto& cylinder = dynamic_cast<const fcl::Cylinderd&>(geometry);
-      return make_shared<fcl::Cylinderd>(cylinder.radius, cylinder.lz);
-    }
-    case fcl::GEOM_ELLIPSOID: {
-      const auto& ellipsoid = dynamic_cast<const fcl::Ellipsoidd&>(geometry);
-      return make_shared<fcl::Ellipsoidd>(ellipsoid.radii);
-    }
-    case fcl::GEOM_HALFSPACE:
-      // All half spaces are defined exactly the same.
-      return make_shared<fcl::Halfspaced>(0, 0, 1, 0);
-    case fcl::GEOM_BOX: {
-      const auto& box = dynamic_cast<const fcl::Boxd&>(geometry);
-      return make_shared<fcl::Boxd>(box.side);
-    }
-    case fcl::GEOM_CAPSULE: {
-      const auto& capsule = dynamic_cast<const fcl::Capsuled&>(geometry);
-      return make_shared<fcl::Capsuled>(capsule.radius, capsule.lz);
-    }
-    case fcl::GEOM_CONVEX: {
-      const auto& convex = dynamic_cast<const fcl::Convexd&>(geometry);
-      // TODO(DamrongGuoy): Change to the copy constructor Convex(other) when
-      //  we figure out why "Convex(const Convex& other) = default" created
-      //  link errors for Xenial Debug build.  For now we do deep copy of the
-      //  vertices and faces instead of simply copying the shared pointer.
-      return make_shared<fcl::Convexd>(
-          make_shared<const std::vector<Vector3d>>(convex.getVertices()),
-          convex.getFaceCount(),
-          make_shared<const std::vector<int>>(convex.getFaces()));
-    }
-    case fcl::GEOM_CONE:
-    case fcl::GEOM_PLANE:
-    case fcl::GEOM_TRIANGLE:
-      throw std::logic_error(
-          "Trying to copy fcl::CollisionGeometry of unsupported GEOM_* type");
-    default:
-      throw std::logic_error(
-          "Trying to copy fcl::CollisionGeometry of non GEOM_* type");
-  }
+// Helper function that creates a copy of the given collision object. The copy
+// has its own transform, AABB and user data, but shares the collision geometry
+// (e.g., a convex mesh) with `object`; the geometry is never modified after
+// it is reified, so it is safe to share among engines.
+unique_ptr<CollisionObjectd> CopyFclObject(const CollisionObjectd& object) {
+  // Note: Copy constructing (rather than constructing from the geometry) also
+  // avoids recomputing the geometry's local AABB, which would write to the
+  // shared geometry.
+  return make_unique<CollisionObjectd>(object);
 }
 
-// Helper function that creates a *deep* copy of the given collision object.
-unique_ptr<CollisionObjectd> CopyFclObjectOrThrow(
-    const CollisionObjectd& object) {
-  shared_ptr<fcl::ShapeBased> geometry_copy =
-      CopyShapeOrThrow(*object.collisionGeometry());
-  auto copy = make_unique<CollisionObjectd>(geometry_copy);
-  copy->setUserData(object.getUserData());
-  copy->setTransform(object.getTransform());
-  copy->computeAABB();
-  return copy;
+// Reports if `a` and `b` both hold equal values of type ValueType.
+template <typename ValueType>
+bool HaveSameValue(const AbstractValue& a, const AbstractValue& b) {
+  const ValueType* a_value = a.maybe_get_value<ValueType>();
+  const ValueType* b_value = b.maybe_get_value<ValueType>();
+  return a_value != nullptr && b_value != nullptr && *a_value == *b_value;
+}
+
+// Reports if `a` and `b` have the same properties in the group `group_name`.
+// Only values of the types used by the proximity properties that affect a
+// geometry's representation are compared; values of any other type are
+// conservatively reported as different.
+bool HaveSamePropertiesInGroup(const ProximityProperties& a,
+                               const ProximityProperties& b,
+                               const std::string& group_name) {
+  if (!a.HasGroup(group_name) || !b.HasGroup(group_name)) {
+    return a.HasGroup(group_name) == b.HasGroup(group_name);
+  }
+  const ProximityProperties::Group& group_a =
+      a.GetPropertiesInGroup(group_name);
+  const ProximityProperties::Group& group_b =
+      b.GetPropertiesInGroup(group_name);
+  if (group_a.size() != group_b.size()) return false;
+  for (const auto& [name, value_a] : group_a) {
+    const auto iter = group_b.find(name);
+    if (iter == group_b.end()) return false;
+    const AbstractValue& value_b = *iter->second;
+    if (!(HaveSameValue<double>(*value_a, value_b) ||
+          HaveSameValue<bool>(*value_a, value_b) ||
+          HaveSameValue<int>(*value_a, value_b) ||
+          HaveSameValue<std::string>(*value_a, value_b) ||
+          HaveSameValue<HydroelasticType>(*value_a, value_b))) {
+      return false;
+    }
+  }
+  return true;
 }
 
-// Helper function that creates a deep copy of a vector of collision objects.
+// Helper function that copies a vector of collision objects.
 // Assumes the input vector has already been cleared. The `copy_map` parameter
 // serves as a mapping from each source object to its corresponding copy. Used
 // to facilitate copying broadphase culling data structures (see
 // ProximityEngine::operator=()).
-void CopyFclObjectsOrThrow(
+void CopyFclObjects(
     const unordered_map<GeometryId, unique_ptr<CollisionObjectd>>&
         source_objects,
     unordered_map<GeometryId, unique_ptr<CollisionObjectd>>* target_objects,
@@ -141,14 +130,14 @@ void CopyFclObjectsOrThrow(
   for (const auto& source_id_object_pair : source_objects) {
     const GeometryId source_id = source_id_object_pair.first;
     const CollisionObjectd& source_object = *source_id_object_pair.second;
-    (*target_objects)[source_id] = CopyFclObjectOrThrow(source_object);
+    (*target_objects)[source_id] = CopyFclObject(source_object);
     copy_map->insert({&source_object, (*target_objects)[source_id].get()});
   }
 }
 
 // Builds into the target AABB tree manager based on the reference "other"
 // manager and the lookup table from other's collision objects to the target's
-// collision objects (the map populated by CopyFclObjectsOrThrow()).
+// collision objects (the map populated by CopyFclObjects()).
 void BuildTreeFromReference(
     const fcl::DynamicAABBTreeCollisionManager<double>& other,
     const std::unordered_map<const CollisionObjectd*,
@@ -223,6 +212,7 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     hydroelastic_geometries_ = other.hydroelastic_geometries_;
     geometries_for_deformable_contact_ =
         other.geometries_for_deformable_contact_;
+    signed_distance_fields_ = other.signed_distance_fields_;
     dynamic_tree_.clear();
     dynamic_objects_.clear();
     anchored_tree_.clear();
@@ -231,10 +221,8 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     // Copy all of the geometry.
     std::unordered_map<const CollisionObjectd*, CollisionObjectd*>
         object_map;
-    CopyFclObjectsOrThrow(other.anchored_objects_, &anchored_objects_,
-                          &object_map);
-    CopyFclObjectsOrThrow(other.dynamic_objects_, &dynamic_objects_,
-                          &object_map);
+    CopyFclObjects(other.anchored_objects_, &anchored_objects_, &object_map);
+    CopyFclObjects(other.dynamic_objects_, &dynamic_objects_, &object_map);
 
     // Build new AABB trees from the input AABB trees.
     BuildTreeFromReference(other.dynamic_tree_, object_map, &dynamic_tree_);
@@ -259,10 +247,8 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     // Copy all of the geometry.
     std::unordered_map<const CollisionObjectd*, CollisionObjectd*>
         object_map;
-    CopyFclObjectsOrThrow(anchored_objects_, &engine->anchored_objects_,
-                          &object_map);
-    CopyFclObjectsOrThrow(dynamic_objects_, &engine->dynamic_objects_,
-                          &object_map);
+    CopyFclObjects(anchored_objects_, &engine->anchored_objects_, &object_map);
+    CopyFclObjects(dynamic_objects_, &engine->dynamic_objects_, &object_map);
 
     engine->collision_filter_ = this->collision_filter_;
 
@@ -273,6 +259,7 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     engine->hydroelastic_geometries_ = this->hydroelastic_geometries_;
     engine->geometries_for_deformable_contact_ =
         this->geometries_for_deformable_contact_;
+    engine->signed_distance_fields_ = this->signed_distance_fields_;
     engine->distance_tolerance_ = this->distance_tolerance_;
 
     return engine;
@@ -312,8 +299,8 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     const GeometryId id = geometry.id();
     // Note: Currently, the only aspects of a geometry's representation that can
     // be affected by its proximity properties are its hydroelastic
-    // representation and rigid (non-deformable) representation for deformable
-    // contact.
+    // representation, its rigid (non-deformable) representation for deformable
+    // contact, and its signed distance field.
     if (!IsRegisteredAsDeformable(id) && !IsRegisteredAsRigid(id)) {
       throw std::logic_error(
           fmt::format("The proximity engine does not contain a geometry with "
@@ -325,16 +312,20 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
       // properties for anything we simply return.
       return;
     }
-    // TODO(SeanCurtis-TRI): Precondition this with a test -- currently,
-    //  I'm mindlessly replacing the old representation (for hydroelastic and
-    //  for rigid geometries participating in deformable contact) with a new
-    //  one -- even it doesn't actually change. Such an optimization probably
-    //  has limited value as this type of operation would really only be done
-    //  at initialization.
-
-    // We'll simply mindlessly destroy and recreate the hydroelastic and
-    // deformable contact representations of rigid (non-deformable)
-    // geometries.
+    // The representations only depend on the hydroelastic and signed distance
+    // field groups. When those are unchanged (e.g., only the friction changed
+    // while randomizing a scene), rebuilding the meshes and their BVHs would be
+    // wasted work.
+    const ProximityProperties* old_properties = geometry.proximity_properties();
+    if (old_properties != nullptr &&
+        HaveSamePropertiesInGroup(*old_properties, new_properties,
+                                  kHydroGroup) &&
+        HaveSamePropertiesInGroup(*old_properties, new_properties, kSdfGroup)) {
+      return;
+    }
+
+    // Otherwise, we destroy and recreate the hydroelastic and deformable
+    // contact representations of rigid (non-deformable) geometries.
     hydroelastic_geometries_.RemoveGeometry(id);
     hydroelastic_geometries_.MaybeAddGeometry(geometry.shape(), id,
                                               new_properties);
@@ -342,6 +333,13 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     geometries_for_deformable_contact_.RemoveGeometry(id);
     geometries_for_deformable_contact_.MaybeAddRigidGeometry(
         geometry.shape(), id, new_properties, X_WG);
+    signed_distance_fields_.erase(id);
+    if (const auto* mesh = dynamic_cast<const Mesh*>(&geometry.shape())) {
+      ProcessSignedDistanceField(*mesh, id, new_properties);
+    } else if (const auto* convex =
+                   dynamic_cast<const Convex*>(&geometry.shape())) {
+      ProcessSignedDistanceField(*convex, id, new_properties);
+    }
   }
 
   // Returns true if the geometry with the given Id has been registered in
@@ -369,6 +367,7 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     }
     hydroelastic_geometries_.RemoveGeometry(id);
     geometries_for_deformable_contact_.RemoveGeometry(id);
+    signed_distance_fields_.erase(id);
   }
 
   void RemoveDeformableGeometry(GeometryId id) {
@@ -417,6 +416,29 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     dynamic_tree_.update();
   }
 
+  void UpdateWorldPoses(
+      const std::unordered_map<GeometryId, RigidTransform<T>>& X_WGs,
+      const std::vector<GeometryId>& ids) {
+    std::vector<CollisionObjectd*> moved_objects;
+    for (const GeometryId id : ids) {
+      auto iter = dynamic_objects_.find(id);
+      if (iter == dynamic_objects_.end()) continue;
+      const RigidTransform<double>& X_WG_d = convert_to_double(X_WGs.at(id));
+      iter->second->setTransform(X_WG_d.GetAsIsometry3());
+      iter->second->computeAABB();
+      geometries_for_deformable_contact_.UpdateRigidWorldPose(id, X_WG_d);
+      moved_objects.push_back(iter->second.get());
+    }
+    if (moved_objects.empty()) return;
+    // Re-inserting a leaf costs O(log n), while refitting the whole tree costs
+    // O(n); beyond a modest fraction of moved objects, refitting is cheaper.
+    if (4 * moved_objects.size() > dynamic_objects_.size()) {
+      dynamic_tree_.update();
+    } else {
+      dynamic_tree_.update(moved_objects);
+    }
+  }
+
   void UpdateDeformableVertexPositions(
       const std::unordered_map<GeometryId, VectorX<T>>& q_WGs) {
     for (const auto& [id, q_WG] : q_WGs) {
@@ -447,6 +469,19 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
         shape, data.id, data.properties, data.X_WG);
   }
 
+  // Attempts to build a signed distance field for the declared Mesh or Convex
+  // geometry (see AddSignedDistanceFieldProperties()).
+  template <typename MeshShape>
+  void ProcessSignedDistanceField(const MeshShape& shape, GeometryId id,
+                                  const ProximityProperties& properties) {
+    std::optional<SignedDistanceField> field =
+        MaybeMakeSignedDistanceField(shape, properties);
+    if (field.has_value()) {
+      signed_distance_fields_[id] =
+          make_shared<const SignedDistanceField>(std::move(*field));
+    }
+  }
+
   void ImplementGeometry(const Box& box, void* user_data) override {
     auto fcl_box = make_shared<fcl::Boxd>(box.size());
     TakeShapeOwnership(fcl_box, user_data);
@@ -494,6 +529,8 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     TakeShapeOwnership(fcl_convex, user_data);
     ProcessHydroelastic(convex, user_data);
     ProcessGeometriesForDeformableContact(convex, user_data);
+    const ReifyData& data = *static_cast<ReifyData*>(user_data);
+    ProcessSignedDistanceField(convex, data.id, data.properties);
 
     // TODO(DamrongGuoy): Per f2f with SeanCurtis-TRI, we want ProximityEngine
     // to own vertices and face by a map from filename.  This way we won't have
@@ -586,6 +623,7 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     //  (kHydroGroup, kRezHint). We should make exception for Mesh since it
     //  doesn't need resolution hint.
     ProcessGeometriesForDeformableContact(mesh, user_data);
+    ProcessSignedDistanceField(mesh, data.id, data.properties);
   }
 
   void ImplementGeometry(const Sphere& sphere, void* user_data) override {
@@ -598,7 +636,7 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
 
   std::vector<SignedDistancePair<T>> ComputeSignedDistancePairwiseClosestPoints(
       const std::unordered_map<GeometryId, RigidTransform<T>>& X_WGs,
-      const double max_distance) const {
+      const double max_distance, Parallelism parallelize) const {
     std::vector<SignedDistancePair<T>> witness_pairs;
     // All these quantities are aliased in the callback data.
     shape_distance::CallbackData<T> data{&collision_filter_, &X_WGs,
@@ -608,6 +646,14 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     data.request.gjk_solver_type = fcl::GJKSolverType::GST_LIBCCD;
     data.request.distance_tolerance = distance_tolerance_;
 
+    // When running in parallel, the broadphase only collects the candidate
+    // pairs; the narrowphase is evaluated afterwards (see below).
+    std::vector<std::pair<const CollisionObjectd*, const CollisionObjectd*>>
+        candidates;
+    if (parallelize.num_threads() > 1) {
+      data.candidates = &candidates;
+    }
+
     // Perform a query of the dynamic objects against themselves.
     dynamic_tree_.distance(&data, shape_distance::Callback<T>);
 
@@ -615,6 +661,35 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     // anchored against anchored because those pairs are implicitly filtered.
     FclDistance(dynamic_tree_, anchored_tree_, &data,
                 shape_distance::Callback<T>);
+
+    if (data.candidates == nullptr) {
+      return witness_pairs;
+    }
+
+    // The broadphase culling only depends on max_distance (and not on the
+    // narrowphase results), so the candidates are exactly the pairs the serial
+    // traversal would have evaluated, in the same order. Each candidate's
+    // narrowphase result is written to its own slot and the slots are merged in
+    // candidate order so that the result is identical to the serial result.
+    const int num_candidates = ssize(candidates);
+    std::vector<SignedDistancePair<T>> results(num_candidates);
+    std::vector<uint8_t> is_reported(num_candidates, 0);
+    drake::internal::ParallelFor(parallelize, num_candidates, [&](int i) {
+      const CollisionObjectd& object_A = *candidates[i].first;
+      const CollisionObjectd& object_B = *candidates[i].second;
+      const GeometryId id_A = EncodedData(object_A).id();
+      const GeometryId id_B = EncodedData(object_B).id();
+      shape_distance::ComputeNarrowPhaseDistance(
+          object_A, X_WGs.at(id_A), object_B, X_WGs.at(id_B), data.request,
+          &results[i]);
+      is_reported[i] =
+          ExtractDoubleOrThrow(results[i].distance) <= max_distance;
+    });
+    for (int i = 0; i < num_candidates; ++i) {
+      if (is_reported[i]) {
+        witness_pairs.emplace_back(std::move(results[i]));
+      }
+    }
     return witness_pairs;
   }
 
@@ -672,6 +747,7 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
 
     point_distance::CallbackData<T> data{
         &query_point, threshold, p_WQ, &X_WGs, &distances};
+    data.signed_distance_fields = &signed_distance_fields_;
 
     // Perform query of point vs dynamic objects.
     dynamic_tree_.distance(&query_point, &data, point_distance::Callback<T>);
@@ -683,10 +759,13 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
   }
 
   std::vector<PenetrationAsPointPair<T>> ComputePointPairPenetration(
-      const std::unordered_map<GeometryId, RigidTransform<T>>& X_WGs) const {
+      const std::unordered_map<GeometryId, RigidTransform<T>>& X_WGs,
+      Parallelism parallelize) const {
     std::vector<PenetrationAsPointPair<T>> contacts;
     penetration_as_point_pair::CallbackData data{&collision_filter_, &X_WGs,
                                                  &contacts};
+    CollisionCandidates candidates;
+    data.candidates = parallelize.num_threads() > 1 ? &candidates : nullptr;
 
     // Perform a query of the dynamic objects against themselves.
     dynamic_tree_.collide(&data, penetration_as_point_pair::Callback<T>);
@@ -696,6 +775,25 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     FclCollide(dynamic_tree_, anchored_tree_, &data,
                penetration_as_point_pair::Callback<T>);
 
+    if (data.candidates != nullptr) {
+      // Each candidate's narrowphase result goes to its own slot; the slots are
+      // concatenated in candidate order and then sorted below, so the result
+      // is independent of the number of threads.
+      const int num_candidates = ssize(candidates);
+      vector<vector<PenetrationAsPointPair<T>>> candidate_contacts(
+          num_candidates);
+      drake::internal::ParallelFor(parallelize, num_candidates, [&](int i) {
+        penetration_as_point_pair::CallbackData<T> candidate_data{
+            &collision_filter_, &X_WGs, &candidate_contacts[i]};
+        penetration_as_point_pair::Callback<T>(
+            candidates[i].first, candidates[i].second, &candidate_data);
+      });
+      for (auto& candidate_contact : candidate_contacts) {
+        std::move(candidate_contact.begin(), candidate_contact.end(),
+                  std::back_inserter(contacts));
+      }
+    }
+
     std::sort(contacts.begin(), contacts.end(), OrderPointPair<T>);
 
     return contacts;
@@ -714,13 +812,16 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     FclCollide(dynamic_tree_, anchored_tree_, &data,
                find_collision_candidates::Callback);
 
-    std::sort(
-        pairs.begin(), pairs.end(),
-        [](const SortedPair<GeometryId>& p1, const SortedPair<GeometryId>& p2) {
-          if (p1.first() != p2.first()) return p1.first() < p2.first();
-          return p1.second() < p2.second();
-        });
+    SortCandidates(&pairs);
+    return pairs;
+  }
 
+  std::vector<SortedPair<GeometryId>> FindCollisionCandidates(
+      const std::unordered_set<GeometryId>& ids) const {
+    std::vector<SortedPair<GeometryId>> pairs;
+    find_collision_candidates::CallbackData data{&collision_filter_, &pairs};
+    CollideSubset(ids, &data, find_collision_candidates::Callback);
+    SortCandidates(&pairs);
     return pairs;
   }
 
@@ -730,6 +831,7 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
 
     // Perform a query of the dynamic objects against themselves.
     dynamic_tree_.collide(&data, has_collisions::Callback);
+    if (data.collisions_exist) return true;
 
     // Perform a query of the dynamic objects against the anchored. We don't do
     // anchored against anchored because those pairs are implicitly filtered.
@@ -737,17 +839,26 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     return data.collisions_exist;
   }
 
+  bool HasCollisions(const std::unordered_set<GeometryId>& ids) const {
+    has_collisions::CallbackData data{&collision_filter_};
+    CollideSubset(ids, &data, has_collisions::Callback);
+    return data.collisions_exist;
+  }
+
   template <typename T1 = T>
   typename std::enable_if_t<scalar_predicate<T1>::is_bool,
                             std::vector<ContactSurface<T>>>
   ComputeContactSurfaces(
       HydroelasticContactRepresentation representation,
-      const unordered_map<GeometryId, RigidTransform<T>>& X_WGs) const {
+      const unordered_map<GeometryId, RigidTransform<T>>& X_WGs,
+      Parallelism parallelize) const {
     vector<ContactSurface<T>> surfaces;
     // All these quantities are aliased in the callback data.
     hydroelastic::CallbackData<T> data{&collision_filter_, &X_WGs,
                                        &hydroelastic_geometries_,
                                        representation, &surfaces};
+    CollisionCandidates candidates;
+    data.candidates = parallelize.num_threads() > 1 ? &candidates : nullptr;
 
     // Perform a query of the dynamic objects against themselves.
     dynamic_tree_.collide(&data, hydroelastic::Callback<T>);
@@ -756,6 +867,22 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     // anchored against anchored because those pairs are implicitly filtered.
     FclCollide(dynamic_tree_, anchored_tree_, &data, hydroelastic::Callback<T>);
 
+    if (data.candidates != nullptr) {
+      const int num_candidates = ssize(candidates);
+      vector<vector<ContactSurface<T>>> candidate_surfaces(num_candidates);
+      drake::internal::ParallelFor(parallelize, num_candidates, [&](int i) {
+        hydroelastic::CallbackData<T> candidate_data{
+            &collision_filter_, &X_WGs, &hydroelastic_geometries_,
+            representation, &candidate_surfaces[i]};
+        hydroelastic::Callback<T>(candidates[i].first,
+                                  candidates[i].second, &candidate_data);
+      });
+      for (auto& candidate_surface : candidate_surfaces) {
+        std::move(candidate_surface.begin(), candidate_surface.end(),
+                  std::back_inserter(surfaces));
+      }
+    }
+
     std::sort(surfaces.begin(), surfaces.end(), OrderContactSurface<T>);
 
     return surfaces;
@@ -767,7 +894,8 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
       HydroelasticContactRepresentation representation,
       const std::unordered_map<GeometryId, RigidTransform<T>>& X_WGs,
       std::vector<ContactSurface<T>>* surfaces,
-      std::vector<PenetrationAsPointPair<T>>* point_pairs) const {
+      std::vector<PenetrationAsPointPair<T>>* point_pairs,
+      Parallelism parallelize) const {
     DRAKE_DEMAND(surfaces != nullptr);
     DRAKE_DEMAND(point_pairs != nullptr);
 
@@ -777,6 +905,9 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
                                       &hydroelastic_geometries_, representation,
                                       surfaces},
         point_pairs};
+    CollisionCandidates candidates;
+    data.data.candidates =
+        parallelize.num_threads() > 1 ? &candidates : nullptr;
 
     // Dynamic vs dynamic and dynamic vs anchored represent all the geometries
     // that we can support with the point-pair fallback. Do those first.
@@ -785,25 +916,54 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     FclCollide(dynamic_tree_, anchored_tree_, &data,
                hydroelastic::CallbackWithFallback<T>);
 
+    if (data.data.candidates != nullptr) {
+      const int num_candidates = ssize(candidates);
+      vector<vector<ContactSurface<T>>> candidate_surfaces(num_candidates);
+      vector<vector<PenetrationAsPointPair<T>>> candidate_point_pairs(
+          num_candidates);
+      drake::internal::ParallelFor(parallelize, num_candidates, [&](int i) {
+        hydroelastic::CallbackWithFallbackData<T> candidate_data{
+            hydroelastic::CallbackData<T>{
+                &collision_filter_, &X_WGs, &hydroelastic_geometries_,
+                representation, &candidate_surfaces[i]},
+            &candidate_point_pairs[i]};
+        hydroelastic::CallbackWithFallback<T>(
+            candidates[i].first, candidates[i].second, &candidate_data);
+      });
+      for (int i = 0; i < num_candidates; ++i) {
+        std::move(candidate_surfaces[i].begin(), candidate_surfaces[i].end(),
+                  std::back_inserter(*surfaces));
+        std::move(candidate_point_pairs[i].begin(),
+                  candidate_point_pairs[i].end(),
+                  std::back_inserter(*point_pairs));
+      }
+    }
+
     std::sort(surfaces->begin(), surfaces->end(), OrderContactSurface<T>);
 
     std::sort(point_pairs->begin(), point_pairs->end(), OrderPointPair<T>);
   }
 
-  void ComputeDeformableContact(
-      DeformableContact<double>* deformable_contact) const {
+  // The broadphase candidate pairs for the parallel contact queries. When a
+  // query runs with more than one thread, the broadphase merely collects the
+  // unfiltered pairs, which are then evaluated with ParallelFor().
+  using CollisionCandidates =
+      std::vector<std::pair<CollisionObjectd*, CollisionObjectd*>>;
+
+  void ComputeDeformableContact(DeformableContact<double>* deformable_contact,
+                                Parallelism parallelize) const {
     *deformable_contact =
         geometries_for_deformable_contact_.ComputeDeformableContact(
-            collision_filter_);
+            collision_filter_, parallelize);
   }
 
   // Testing utilities
 
-  bool IsDeepCopy(const Impl& other) const {
+  bool IsCopy(const Impl& other) const {
     if (this != &other) {
       // TODO(DamrongGuoy): Consider checking other data members such as
       //  hydroelastic_geometries_.
-      auto are_maps_deep_copy =
+      auto are_maps_copy =
           [](const unordered_map<GeometryId, unique_ptr<CollisionObjectd>>&
                  this_map,
              const unordered_map<GeometryId, unique_ptr<CollisionObjectd>>&
@@ -820,8 +980,11 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
           const CollisionObjectd& ref = *other_map.at(test_id);
           // Validate that two objects are equal. The test isn't exhaustive
           // (for example, the parameters of the particular geometric shape
-          // are not compared--instead, we compare the AABBs).
+          // are not compared--instead, we compare the AABBs). The objects
+          // must be distinct, but share their geometry.
           bool objects_equal =
+              &test != &ref &&
+              test.collisionGeometry() == ref.collisionGeometry() &&
               test.getUserData() == ref.getUserData() &&
               test.getNodeType() == ref.getNodeType() &&
               test.getObjectType() == ref.getObjectType() &&
@@ -834,12 +997,12 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
           }
         }
         return true;
-      };  // are_maps_deep_copy
+      };  // are_maps_copy
 
-      if (!are_maps_deep_copy(this->dynamic_objects_, other.dynamic_objects_)) {
+      if (!are_maps_copy(this->dynamic_objects_, other.dynamic_objects_)) {
         return false;
       }
-      if (!are_maps_deep_copy(this->anchored_objects_,
+      if (!are_maps_copy(this->anchored_objects_,
                               other.anchored_objects_)) {
         return false;
       }
@@ -884,6 +1047,98 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
   template <typename>
   friend class ProximityEngine;
 
+  // Sorts collision candidates so that the results don't depend on the
+  // broadphase traversal order.
+  static void SortCandidates(std::vector<SortedPair<GeometryId>>* pairs) {
+    std::sort(
+        pairs->begin(), pairs->end(),
+        [](const SortedPair<GeometryId>& p1, const SortedPair<GeometryId>& p2) {
+          if (p1.first() != p2.first()) return p1.first() < p2.first();
+          return p1.second() < p2.second();
+        });
+  }
+
+  // Invokes `callback` on each broadphase candidate pair that includes at
+  // least one of the geometries in `ids` (each pair once), stopping as soon as
+  // the callback requests termination. Only those geometries are put into a
+  // dedicated broadphase, which is then queried against itself and against the
+  // full trees; the cost therefore scales with the size of `ids` (times the
+  // logarithm of the scene size) rather than with the whole scene. Ids that
+  // are not registered with this engine are ignored.
+  template <typename DataType>
+  void CollideSubset(const std::unordered_set<GeometryId>& ids,
+                     DataType* data,
+                     fcl::CollisionCallBack<double> callback) const {
+    std::vector<CollisionObjectd*> subset_dynamic_objects;
+    std::vector<CollisionObjectd*> subset_anchored_objects;
+    for (const GeometryId id : ids) {
+      if (auto iter = dynamic_objects_.find(id);
+          iter != dynamic_objects_.end()) {
+        subset_dynamic_objects.push_back(iter->second.get());
+      } else if (auto anchored_iter = anchored_objects_.find(id);
+                 anchored_iter != anchored_objects_.end()) {
+        subset_anchored_objects.push_back(anchored_iter->second.get());
+      }
+    }
+    fcl::DynamicAABBTreeCollisionManager<double> subset_dynamic_tree;
+    if (!subset_dynamic_objects.empty()) {
+      subset_dynamic_tree.registerObjects(subset_dynamic_objects);
+      subset_dynamic_tree.setup();
+    }
+    fcl::DynamicAABBTreeCollisionManager<double> subset_anchored_tree;
+    if (!subset_anchored_objects.empty()) {
+      subset_anchored_tree.registerObjects(subset_anchored_objects);
+      subset_anchored_tree.setup();
+    }
+
+    SubsetCallbackData subset_data{data, callback, &ids};
+    // The subset's dynamic geometries against each other.
+    subset_data.skip_pairs_within_subset = false;
+    subset_dynamic_tree.collide(&subset_data, SubsetCallback);
+    if (subset_data.terminated) return;
+    // The subset's dynamic geometries against all of the anchored geometries.
+    FclCollide(subset_dynamic_tree, anchored_tree_, &subset_data,
+               SubsetCallback);
+    if (subset_data.terminated) return;
+    // The subset's geometries against the dynamic geometries that are not in
+    // the subset (the pairs within the subset were all reported above).
+    subset_data.skip_pairs_within_subset = true;
+    FclCollide(subset_dynamic_tree, dynamic_tree_, &subset_data,
+               SubsetCallback);
+    if (subset_data.terminated) return;
+    FclCollide(subset_anchored_tree, dynamic_tree_, &subset_data,
+               SubsetCallback);
+  }
+
+  // The callback data for CollideSubset(), which wraps the data and callback
+  // of the actual query.
+  struct SubsetCallbackData {
+    void* data{};
+    fcl::CollisionCallBack<double> callback{};
+    const std::unordered_set<GeometryId>* ids{};
+    // When true, the pairs whose dynamic geometries are all in `ids` are
+    // skipped.
+    bool skip_pairs_within_subset{};
+    bool terminated{};
+  };
+
+  static bool SubsetCallback(CollisionObjectd* object_A,
+                             CollisionObjectd* object_B, void* callback_data) {
+    auto& subset_data = *static_cast<SubsetCallbackData*>(callback_data);
+    if (subset_data.skip_pairs_within_subset) {
+      const EncodedData encoding_A(*object_A);
+      const EncodedData encoding_B(*object_B);
+      const auto in_subset = [&subset_data](const EncodedData& encoding) {
+        return !encoding.is_dynamic() ||
+               subset_data.ids->contains(encoding.id());
+      };
+      if (in_subset(encoding_A) && in_subset(encoding_B)) return false;
+    }
+    subset_data.terminated =
+        subset_data.callback(object_A, object_B, subset_data.data);
+    return subset_data.terminated;
+  }
+
   void AddGeometry(
       const Shape& shape, const RigidTransformd& X_WG, GeometryId id,
       const ProximityProperties& props, bool is_dynamic,
@@ -965,6 +1220,10 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
   // The deformable geometries registered here are not included in
   // `dynamic_objects_` and `dynamic_tree_`.
   deformable::Geometries geometries_for_deformable_contact_;
+
+  // The signed distance fields of the Mesh and Convex geometries that request
+  // one. They serve the signed distance queries to points for T = double.
+  SignedDistanceFields signed_distance_fields_;
 };
 
 template <typename T>
@@ -1086,9 +1345,18 @@ CollisionFilter& ProximityEngine<T>::collision_filter() {
 template <typename T>
 void ProximityEngine<T>::UpdateWorldPoses(
     const unordered_map<GeometryId, RigidTransform<T>>& X_WGs) {
+  instrumentation::ScopedZone zone("ProximityEngine::UpdateWorldPoses");
   impl_->UpdateWorldPoses(X_WGs);
 }
 
+template <typename T>
+void ProximityEngine<T>::UpdateWorldPoses(
+    const unordered_map<GeometryId, RigidTransform<T>>& X_WGs,
+    const std::vector<GeometryId>& ids) {
+  instrumentation::ScopedZone zone("ProximityEngine::UpdateWorldPoses");
+  impl_->UpdateWorldPoses(X_WGs, ids);
+}
+
 template <typename T>
 void ProximityEngine<T>::UpdateDeformableVertexPositions(
     const std::unordered_map<GeometryId, VectorX<T>>& q_WGs) {
@@ -1099,8 +1367,11 @@ template <typename T>
 std::vector<SignedDistancePair<T>>
 ProximityEngine<T>::ComputeSignedDistancePairwiseClosestPoints(
     const std::unordered_map<GeometryId, RigidTransform<T>>& X_WGs,
-    const double max_distance) const {
-  return impl_->ComputeSignedDistancePairwiseClosestPoints(X_WGs, max_distance);
+    const double max_distance, Parallelism parallelize) const {
+  instrumentation::ScopedZone zone(
+      "ProximityEngine::ComputeSignedDistancePairwiseClosestPoints");
+  return impl_->ComputeSignedDistancePairwiseClosestPoints(X_WGs, max_distance,
+                                                           parallelize);
 }
 
 template <typename T>
@@ -1118,20 +1389,36 @@ ProximityEngine<T>::ComputeSignedDistanceToPoint(
     const Vector3<T>& query,
     const std::unordered_map<GeometryId, RigidTransform<T>>& X_WGs,
     const double threshold) const {
+  instrumentation::ScopedZone zone(
+      "ProximityEngine::ComputeSignedDistanceToPoint");
   return impl_->ComputeSignedDistanceToPoint(query, X_WGs, threshold);
 }
 
 template <typename T>
 bool ProximityEngine<T>::HasCollisions() const {
+  instrumentation::ScopedZone zone("ProximityEngine::HasCollisions");
   return impl_->HasCollisions();
 }
 
+template <typename T>
+bool ProximityEngine<T>::HasCollisions(
+    const std::unordered_set<GeometryId>& ids) const {
+  instrumentation::ScopedZone zone("ProximityEngine::HasCollisions(subset)");
+  return impl_->HasCollisions(ids);
+}
+
 template <typename T>
 std::vector<PenetrationAsPointPair<T>>
 ProximityEngine<T>::ComputePointPairPenetration(
-    const std::unordered_map<GeometryId, math::RigidTransform<T>>& X_WGs)
-    const {
-  return impl_->ComputePointPairPenetration(X_WGs);
+    const std::unordered_map<GeometryId, math::RigidTransform<T>>& X_WGs,
+    Parallelism parallelize) const {
+  instrumentation::ScopedZone zone(
+      "ProximityEngine::ComputePointPairPenetration");
+  std::vector<PenetrationAsPointPair<T>> point_pairs =
+      impl_->ComputePointPairPenetration(X_WGs, parallelize);
+  instrumentation::IncrementCounter("ProximityEngine::num_point_pairs",
+                                    point_pairs.size());
+  return point_pairs;
 }
 
 template <typename T>
@@ -1140,8 +1427,14 @@ typename std::enable_if_t<scalar_predicate<T1>::is_bool,
                           std::vector<ContactSurface<T>>>
 ProximityEngine<T>::ComputeContactSurfaces(
     HydroelasticContactRepresentation representation,
-    const std::unordered_map<GeometryId, RigidTransform<T>>& X_WGs) const {
-  return impl_->ComputeContactSurfaces(representation, X_WGs);
+    const std::unordered_map<GeometryId, RigidTransform<T>>& X_WGs,
+    Parallelism parallelize) const {
+  instrumentation::ScopedZone zone("ProximityEngine::ComputeContactSurfaces");
+  std::vector<ContactSurface<T>> surfaces =
+      impl_->ComputeContactSurfaces(representation, X_WGs, parallelize);
+  instrumentation::IncrementCounter("ProximityEngine::num_contact_surfaces",
+                                    surfaces.size());
+  return surfaces;
 }
 
 template <typename T>
@@ -1151,30 +1444,43 @@ ProximityEngine<T>::ComputeContactSurfacesWithFallback(
     HydroelasticContactRepresentation representation,
     const std::unordered_map<GeometryId, RigidTransform<T>>& X_WGs,
     std::vector<ContactSurface<T>>* surfaces,
-    std::vector<PenetrationAsPointPair<T>>* point_pairs) const {
-  return impl_->ComputeContactSurfacesWithFallback(representation, X_WGs,
-                                                   surfaces, point_pairs);
+    std::vector<PenetrationAsPointPair<T>>* point_pairs,
+    Parallelism parallelize) const {
+  instrumentation::ScopedZone zone(
+      "ProximityEngine::ComputeContactSurfacesWithFallback");
+  impl_->ComputeContactSurfacesWithFallback(representation, X_WGs, surfaces,
+                                            point_pairs, parallelize);
 }
 
 template <typename T>
 template <typename T1>
 typename std::enable_if_t<std::is_same_v<T1, double>, void>
 ProximityEngine<T>::ComputeDeformableContact(
-    DeformableContact<T>* deformable_contact) const {
-  impl_->ComputeDeformableContact(deformable_contact);
+    DeformableContact<T>* deformable_contact, Parallelism parallelize) const {
+  instrumentation::ScopedZone zone("ProximityEngine::ComputeDeformableContact");
+  impl_->ComputeDeformableContact(deformable_contact, parallelize);
 }
 
 template <typename T>
 std::vector<SortedPair<GeometryId>>
 ProximityEngine<T>::FindCollisionCandidates() const {
+  instrumentation::ScopedZone zone("ProximityEngine::FindCollisionCandidates");
   return impl_->FindCollisionCandidates();
 }
 
+template <typename T>
+std::vector<SortedPair<GeometryId>> ProximityEngine<T>::FindCollisionCandidates(
+    const std::unordered_set<GeometryId>& ids) const {
+  instrumentation::ScopedZone zone(
+      "ProximityEngine::FindCollisionCandidates(subset)");
+  return impl_->FindCollisionCandidates(ids);
+}
+
 // Testing utilities
 
 template <typename T>
-bool ProximityEngine<T>::IsDeepCopy(const ProximityEngine<T>& other) const {
-  return impl_->IsDeepCopy(*other.impl_);
+bool ProximityEngine<T>::IsCopy(const ProximityEngine<T>& other) const {
+  return impl_->IsCopy(*other.impl_);
 }
 
 template <typename T>
@@ -1208,7 +1514,7 @@ DRAKE_DEFINE_FUNCTION_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_NONSYMBOLIC_SCALARS(
      &ProximityEngine<T>::template ComputeContactSurfacesWithFallback<T>))
 
 template void ProximityEngine<double>::ComputeDeformableContact<double>(
-    DeformableContact<double>*) const;
+    DeformableContact<double>*, Parallelism) const;
 
 }  // namespace internal
 }  // namespace geometry
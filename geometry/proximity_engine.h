@@ -9,6 +9,7 @@
 #include <vector>
 
 #include "drake/common/autodiff.h"
+#include "drake/common/parallelism.h"
 #include "drake/common/sorted_pair.h"
 #include "drake/geometry/geometry_ids.h"
 #include "drake/geometry/geometry_roles.h"
@@ -42,10 +43,9 @@ namespace internal {
    - ray-intersection
 
  Not all shape queries are fully supported. To add support for a shape:
- 1. for fcl versions of the specification, modify CopyShapeOrThrow().
- 2. add an instance of the new shape to the CopySemantics test in
+ 1. add an instance of the new shape to the CopySemantics test in
     proximity_engine_test.cc.
- 3. for penetration, test the new shape in the class BoxPenetrationTest of
+ 2. for penetration, test the new shape in the class BoxPenetrationTest of
     proximity_engine_test.cc and document its configuration.
 
  <!-- TODO(SeanCurtis-TRI): Fully document the semantics of the proximity
@@ -64,10 +64,13 @@ class ProximityEngine {
   ProximityEngine();
   ~ProximityEngine();
 
-  /* Construct a deep copy of the provided `other` engine.  */
+  /* Construct a copy of the provided `other` engine. The copy shares the
+   immutable geometry representations (e.g., fcl shapes and hydroelastic
+   meshes) with `other`, but has its own poses and broadphase trees.  */
   ProximityEngine(const ProximityEngine& other);
 
-  /* Set `this` engine to be a deep copy of the `other` engine.  */
+  /* Set `this` engine to be a copy of the `other` engine (see the copy
+   constructor).  */
   ProximityEngine& operator=(const ProximityEngine& other);
 
   /* Construct an engine by moving the data of a source engine. The source
@@ -78,7 +81,7 @@ class ProximityEngine {
    engine will be returned to its default-initialized state.  */
   ProximityEngine& operator=(ProximityEngine&& other) noexcept;
 
-  /* Returns an independent copy of this engine templated on a scalar type. If
+  /* Returns a copy of this engine templated on a scalar type. If
    T=U, it is equivalent to using the copy constructor to create a duplicate on
    the heap. */
   template <typename U>
@@ -185,6 +188,18 @@ class ProximityEngine {
   void UpdateWorldPoses(
       const std::unordered_map<GeometryId, math::RigidTransform<T>>& X_WGs);
 
+  /* Variant of UpdateWorldPoses() that only updates the poses of the
+   _dynamic_ geometries in `ids`; the ids of other geometries are ignored.
+   When only a few geometries have moved, this avoids refitting the whole
+   broadphase tree.
+   @param X_WGs  The poses of (at least) the geometries in `ids`, measured and
+                 expressed in the world frame `W`.
+   @param ids    The ids of the geometries whose poses may have changed since
+                 the last update.  */
+  void UpdateWorldPoses(
+      const std::unordered_map<GeometryId, math::RigidTransform<T>>& X_WGs,
+      const std::vector<GeometryId>& ids);
+
   /* Updates the vertex positions of deformable geometries in the engine.
    @param q_WGs  The mapping from GeometryId `id` to vertex positions of
                  deformable geometry `G` measured and expressed in the the
@@ -205,11 +220,17 @@ class ProximityEngine {
   /* Implementation of
    GeometryState::ComputeSignedDistancePairwiseClosestPoints().
    This includes `X_WGs`, the current poses of all geometries in World in the
-   current scalar type, keyed on each geometry's GeometryId.  */
+   current scalar type, keyed on each geometry's GeometryId.
+
+   When `parallelize` requests more than one thread, the broadphase only
+   collects the candidate pairs and the narrowphase distances are then
+   evaluated in parallel. The results are merged in the order of the serial
+   traversal, so the returned vector is identical to the one computed
+   serially.  */
   std::vector<SignedDistancePair<T>>
   ComputeSignedDistancePairwiseClosestPoints(
       const std::unordered_map<GeometryId, math::RigidTransform<T>>& X_WGs,
-      const double max_distance) const;
+      const double max_distance, Parallelism parallelize = false) const;
 
   /* Implementation of
    GeometryState::ComputeSignedDistancePairClosestPoints().
@@ -245,46 +266,70 @@ class ProximityEngine {
   // be updated).
   /* Implementation of GeometryState::ComputePointPairPenetration().
    This includes `X_WGs`, the current poses of all geometries in World in the
-   current scalar type, keyed on each geometry's GeometryId.  */
+   current scalar type, keyed on each geometry's GeometryId.
+   @param parallelize  When more than one thread is requested, the broadphase
+                       only collects the unfiltered pairs and the per-pair
+                       penetrations are computed in parallel. The results are
+                       identical to the serial results.  */
   std::vector<PenetrationAsPointPair<T>> ComputePointPairPenetration(
-      const std::unordered_map<GeometryId, math::RigidTransform<T>>& X_WGs)
-      const;
+      const std::unordered_map<GeometryId, math::RigidTransform<T>>& X_WGs,
+      Parallelism parallelize = false) const;
 
   /* Implementation of GeometryState::ComputeContactSurfaces().
    @param X_WGs the current poses of all geometries in World in the
-                current scalar type, keyed on each geometry's GeometryId.  */
+                current scalar type, keyed on each geometry's GeometryId.
+   @param parallelize  When more than one thread is requested, the broadphase
+                       only collects the unfiltered pairs and the per-pair
+                       contact surfaces are computed in parallel. The results
+                       are identical to the serial results.  */
   template <typename T1 = T>
   typename std::enable_if_t<scalar_predicate<T1>::is_bool,
                             std::vector<ContactSurface<T>>>
   ComputeContactSurfaces(
       HydroelasticContactRepresentation representation,
-      const std::unordered_map<GeometryId, math::RigidTransform<T>>& X_WGs)
-      const;
+      const std::unordered_map<GeometryId, math::RigidTransform<T>>& X_WGs,
+      Parallelism parallelize = false) const;
 
   /* Implementation of GeometryState::ComputeContactSurfacesWithFallback().
    @param X_WGs the current poses of all geometries in World in the
-                current scalar type, keyed on each geometry's GeometryId.  */
+                current scalar type, keyed on each geometry's GeometryId.
+   @param parallelize  As documented in ComputeContactSurfaces().  */
   template <typename T1 = T>
   typename std::enable_if_t<scalar_predicate<T1>::is_bool, void>
   ComputeContactSurfacesWithFallback(
       HydroelasticContactRepresentation representation,
       const std::unordered_map<GeometryId, math::RigidTransform<T>>& X_WGs,
       std::vector<ContactSurface<T>>* surfaces,
-      std::vector<PenetrationAsPointPair<T>>* point_pairs) const;
+      std::vector<PenetrationAsPointPair<T>>* point_pairs,
+      Parallelism parallelize = false) const;
 
   /* Implementation of GeometryState::ComputeDeformableContact(). Assumes
    the poses of rigid bodies and the vertex positions of the deformable bodies
    are up-to-date. */
   template <typename T1 = T>
   typename std::enable_if_t<std::is_same_v<T1, double>, void>
-  ComputeDeformableContact(DeformableContact<T>* deformable_contact) const;
+  ComputeDeformableContact(DeformableContact<T>* deformable_contact,
+                           Parallelism parallelize = false) const;
 
   /* Implementation of GeometryState::FindCollisionCandidates().  */
   std::vector<SortedPair<GeometryId>> FindCollisionCandidates() const;
 
+  /* Implementation of GeometryState::FindCollisionCandidates(geometry_set).
+   The candidates are only sought among the pairs that include at least one of
+   the given `ids`; those geometries are placed in a dedicated broadphase that
+   is queried against the full scene. Ids not registered with this engine are
+   ignored.  */
+  std::vector<SortedPair<GeometryId>> FindCollisionCandidates(
+      const std::unordered_set<GeometryId>& ids) const;
+
   /* Implementation of GeometryState::HasCollisions().  */
   bool HasCollisions() const;
 
+  /* Implementation of GeometryState::HasCollisions(geometry_set). As with
+   FindCollisionCandidates(ids), only the pairs that include at least one of
+   the given `ids` are considered; the query stops at the first collision.  */
+  bool HasCollisions(const std::unordered_set<GeometryId>& ids) const;
+
   //@}
 
   /* The representation of every geometry that was successfully requested for
@@ -301,8 +346,9 @@ class ProximityEngine {
   // This enables unit tests to make assertions about pre- and post-operation
   // state.
 
-  // Reports true if other is detectably a deep copy of this engine.
-  bool IsDeepCopy(const ProximityEngine<T>& other) const;
+  // Reports true if other is detectably a copy of this engine: it has its own
+  // collision objects, which share their geometry with this engine's.
+  bool IsCopy(const ProximityEngine<T>& other) const;
 
   // Reports the pose (X_WG) of the geometry with the given id.
   const math::RigidTransform<double> GetX_WG(GeometryId id,
@@ -1,5 +1,7 @@
 #include "drake/geometry/proximity_properties.h"
 
+#include <cmath>
+
 namespace drake {
 namespace geometry {
 namespace internal {
@@ -15,6 +17,10 @@ const char* const kElastic = "hydroelastic_modulus";
 const char* const kRezHint = "resolution_hint";
 const char* const kComplianceType = "compliance_type";
 const char* const kSlabThickness = "slab_thickness";
+const char* const kSinglePrecisionGradients = "single_precision_gradients";
+
+const char* const kSdfGroup = "signed_distance_field";
+const char* const kSdfResolution = "resolution";
 
 std::ostream& operator<<(std::ostream& out, const HydroelasticType& type) {
   switch (type) {
@@ -123,5 +129,18 @@ void AddCompliantHydroelasticPropertiesForHalfSpace(
   AddCompliantHydroelasticProperties(hydroelastic_modulus, properties);
 }
 
+void AddSignedDistanceFieldProperties(double resolution,
+                                      ProximityProperties* properties) {
+  DRAKE_DEMAND(properties != nullptr);
+  if (!(std::isfinite(resolution) && resolution > 0)) {
+    throw std::logic_error(fmt::format(
+        "The signed distance field resolution must be positive and finite; "
+        "given {}",
+        resolution));
+  }
+  properties->AddProperty(internal::kSdfGroup, internal::kSdfResolution,
+                          resolution);
+}
+
 }  // namespace geometry
 }  // namespace drake
@@ -69,6 +69,20 @@ extern const char* const kRezHint;          ///< Resolution hint property name.
 extern const char* const kComplianceType;   ///< Compliance type property name.
 extern const char* const kSlabThickness;    ///< Slab thickness property name
                                             ///< (for half spaces).
+extern const char* const kSinglePrecisionGradients;  ///< Property name (bool)
+                                                     ///< to store a compliant
+                                                     ///< mesh's pressure
+                                                     ///< gradients in float.
+
+//@}
+
+/* @name  Declaring signed distance fields.
+ String constants used to request a precomputed signed distance field for a
+ Mesh or Convex geometry (see AddSignedDistanceFieldProperties()).  */
+//@{
+
+extern const char* const kSdfGroup;       ///< Signed distance field group name.
+extern const char* const kSdfResolution;  ///< Sample spacing property name.
 
 //@}
 
@@ -176,6 +190,28 @@ void AddCompliantHydroelasticPropertiesForHalfSpace(
 
 //@}
 
+/** Adds properties to the given set of proximity properties that cause a Mesh
+ or Convex geometry to precompute a signed distance field: the signed distance
+ to the shape is sampled on a regular grid when the geometry is registered,
+ and QueryObject::ComputeSignedDistanceToPoint() then reports the geometry
+ (for T = double) by interpolating the samples, at a cost independent of the
+ number of triangles. This suits environments that are queried with many
+ points (e.g., by motion planners). The properties are ignored for all other
+ shapes.
+
+ The Mesh must be closed (watertight) with outward-facing triangles. The
+ interpolation error is on the order of `resolution` near sharp features, and
+ the memory grows with the mesh's volume divided by `resolution`³.
+
+ @param resolution          The distance (in meters) between adjacent samples.
+ @param[in,out] properties  The properties will be added to this property set.
+ @throws std::exception     If `properties` already has properties with the
+                            names that this function would need to add, or if
+                            `resolution` is not positive and finite.
+ @pre `properties` is not nullptr.  */
+void AddSignedDistanceFieldProperties(double resolution,
+                                      ProximityProperties* properties);
+
 }  // namespace geometry
 }  // namespace drake
 
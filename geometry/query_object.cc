@@ -96,12 +96,12 @@ const VectorX<T>& QueryObject<T>::GetConfigurationsInWorld(
 
 template <typename T>
 std::vector<PenetrationAsPointPair<T>>
-QueryObject<T>::ComputePointPairPenetration() const {
+QueryObject<T>::ComputePointPairPenetration(Parallelism parallelize) const {
   ThrowIfNotCallable();
 
   FullPoseUpdate();
   const GeometryState<T>& state = geometry_state();
-  return state.ComputePointPairPenetration();
+  return state.ComputePointPairPenetration(parallelize);
 }
 
 template <typename T>
@@ -114,6 +114,16 @@ std::vector<SortedPair<GeometryId>> QueryObject<T>::FindCollisionCandidates()
   return state.FindCollisionCandidates();
 }
 
+template <typename T>
+std::vector<SortedPair<GeometryId>> QueryObject<T>::FindCollisionCandidates(
+    const GeometrySet& geometry_set) const {
+  ThrowIfNotCallable();
+
+  FullPoseUpdate();
+  const GeometryState<T>& state = geometry_state();
+  return state.FindCollisionCandidates(geometry_set);
+}
+
 template <typename T>
 bool QueryObject<T>::HasCollisions() const {
   ThrowIfNotCallable();
@@ -123,17 +133,27 @@ bool QueryObject<T>::HasCollisions() const {
   return state.HasCollisions();
 }
 
+template <typename T>
+bool QueryObject<T>::HasCollisions(const GeometrySet& geometry_set) const {
+  ThrowIfNotCallable();
+
+  FullPoseUpdate();
+  const GeometryState<T>& state = geometry_state();
+  return state.HasCollisions(geometry_set);
+}
+
 template <typename T>
 template <typename T1>
 typename std::enable_if_t<scalar_predicate<T1>::is_bool,
                           std::vector<ContactSurface<T>>>
 QueryObject<T>::ComputeContactSurfaces(
-    HydroelasticContactRepresentation representation) const {
+    HydroelasticContactRepresentation representation,
+    Parallelism parallelize) const {
   ThrowIfNotCallable();
 
   FullPoseUpdate();
   const GeometryState<T>& state = geometry_state();
-  return state.ComputeContactSurfaces(representation);
+  return state.ComputeContactSurfaces(representation, parallelize);
 }
 
 template <typename T>
@@ -142,7 +162,8 @@ typename std::enable_if_t<scalar_predicate<T1>::is_bool, void>
 QueryObject<T>::ComputeContactSurfacesWithFallback(
     HydroelasticContactRepresentation representation,
     std::vector<ContactSurface<T>>* surfaces,
-    std::vector<PenetrationAsPointPair<T>>* point_pairs) const {
+    std::vector<PenetrationAsPointPair<T>>* point_pairs,
+    Parallelism parallelize) const {
   DRAKE_DEMAND(surfaces != nullptr);
   DRAKE_DEMAND(point_pairs != nullptr);
 
@@ -151,32 +172,34 @@ QueryObject<T>::ComputeContactSurfacesWithFallback(
   FullPoseUpdate();
   const GeometryState<T>& state = geometry_state();
   state.ComputeContactSurfacesWithFallback(representation, surfaces,
-                                           point_pairs);
+                                           point_pairs, parallelize);
 }
 
 template <typename T>
 template <typename T1>
 typename std::enable_if_t<std::is_same_v<T1, double>, void>
 QueryObject<T>::ComputeDeformableContact(
-    internal::DeformableContact<T>* deformable_contact) const {
+    internal::DeformableContact<T>* deformable_contact,
+    Parallelism parallelize) const {
   DRAKE_DEMAND(deformable_contact != nullptr);
   ThrowIfNotCallable();
 
   FullPoseAndConfigurationUpdate();
 
   const GeometryState<T>& state = geometry_state();
-  state.ComputeDeformableContact(deformable_contact);
+  state.ComputeDeformableContact(deformable_contact, parallelize);
 }
 
 template <typename T>
 std::vector<SignedDistancePair<T>>
 QueryObject<T>::ComputeSignedDistancePairwiseClosestPoints(
-    const double max_distance) const {
+    const double max_distance, Parallelism parallelize) const {
   ThrowIfNotCallable();
 
   FullPoseUpdate();
   const GeometryState<T>& state = geometry_state();
-  return state.ComputeSignedDistancePairwiseClosestPoints(max_distance);
+  return state.ComputeSignedDistancePairwiseClosestPoints(max_distance,
+                                                          parallelize);
 }
 
 template <typename T>
@@ -264,7 +287,7 @@ DRAKE_DEFINE_FUNCTION_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_NONSYMBOLIC_SCALARS(
      &QueryObject<T>::template ComputeContactSurfacesWithFallback<T>))
 
 template void QueryObject<double>::ComputeDeformableContact<double>(
-    internal::DeformableContact<double>*) const;
+    internal::DeformableContact<double>*, Parallelism) const;
 
 }  // namespace geometry
 }  // namespace drake
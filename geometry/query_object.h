@@ -6,6 +6,7 @@
 #include <vector>
 
 #include "drake/common/drake_deprecated.h"
+#include "drake/common/parallelism.h"
 #include "drake/geometry/query_results/contact_surface.h"
 #include "drake/geometry/query_results/deformable_contact.h"
 #include "drake/geometry/query_results/penetration_as_point_pair.h"
@@ -283,6 +284,10 @@ class QueryObject {
    located in penetration_as_point_pair_characterize_test.cc. The values in this
    table should be reflected in the expected values there.  -->
 
+   @param parallelize  Controls the number of threads used to evaluate the
+                       penetrations of the candidate pairs. The results do not
+                       depend on the number of threads.
+
    @returns A vector populated with all detected penetrations characterized as
             point pairs. The ordering of the results is guaranteed to be
             consistent -- for fixed geometry poses, the results will remain
@@ -291,7 +296,8 @@ class QueryObject {
             *not* computationally efficient or particularly accurate.
    @throws std::exception if a Shape-Shape pair is in collision and indicated as
            `throws` in the support table above.  */
-  std::vector<PenetrationAsPointPair<T>> ComputePointPairPenetration() const;
+  std::vector<PenetrationAsPointPair<T>> ComputePointPairPenetration(
+      Parallelism parallelize = false) const;
 
   /** Reports pairwise intersections and characterizes each non-empty
    intersection as a ContactSurface for hydroelastic contact model. The
@@ -360,6 +366,9 @@ class QueryObject {
                           surface. See
                           @ref contact_surface_discrete_representation
                           "contact surface representation" for more details.
+   @param parallelize     Controls the number of threads used to compute the
+                          contact surfaces of the candidate pairs. The results
+                          do not depend on the number of threads.
 
    @returns A vector populated with all detected intersections characterized as
             contact surfaces. The ordering of the results is guaranteed to be
@@ -368,8 +377,8 @@ class QueryObject {
   template <typename T1 = T>
   typename std::enable_if_t<scalar_predicate<T1>::is_bool,
                             std::vector<ContactSurface<T>>>
-  ComputeContactSurfaces(
-      HydroelasticContactRepresentation representation) const;
+  ComputeContactSurfaces(HydroelasticContactRepresentation representation,
+                         Parallelism parallelize = false) const;
 
   /** Reports pairwise intersections and characterizes each non-empty
    intersection as a ContactSurface _where possible_ and as a
@@ -400,6 +409,9 @@ class QueryObject {
                             The vector will _not_ be cleared.
    @param[out] point_pairs  The vector that fall back point pair data will be
                             added to. The vector will _not_ be cleared.
+   @param parallelize       Controls the number of threads used to evaluate
+                            the candidate pairs. The results do not depend on
+                            the number of threads.
    @pre Neither `surfaces` nor `point_pairs` is nullptr.
    @throws std::exception for the reasons described in ComputeContactSurfaces()
                           and ComputePointPairPenetration().
@@ -410,19 +422,24 @@ class QueryObject {
   ComputeContactSurfacesWithFallback(
       HydroelasticContactRepresentation representation,
       std::vector<ContactSurface<T>>* surfaces,
-      std::vector<PenetrationAsPointPair<T>>* point_pairs) const;
+      std::vector<PenetrationAsPointPair<T>>* point_pairs,
+      Parallelism parallelize = false) const;
 
   /** Reports contact information among all deformable geometries. This function
    only supports double as the scalar type.
    @param[out] deformable_contact
      Contains all deformable contact data on output. Any data passed in is
      cleared before the computation.
+   @param parallelize
+     Controls the number of threads used to compute the contact between the
+     pairs of deformable and rigid geometries. The results do not depend on
+     the number of threads.
    @pre deformable_contact != nullptr.
    @experimental */
   template <typename T1 = T>
   typename std::enable_if_t<std::is_same_v<T1, double>, void>
-  ComputeDeformableContact(
-      internal::DeformableContact<T>* deformable_contact) const;
+  ComputeDeformableContact(internal::DeformableContact<T>* deformable_contact,
+                           Parallelism parallelize = false) const;
 
   /** Applies a conservative culling mechanism to create a subset of all
    possible geometry pairs based on non-zero intersections. A geometry pair
@@ -435,12 +452,33 @@ class QueryObject {
             ids are added/removed).  */
   std::vector<SortedPair<GeometryId>> FindCollisionCandidates() const;
 
+  /** Variant of FindCollisionCandidates() that only reports the candidate
+   pairs in which at least one geometry belongs to `geometry_set` (e.g., the
+   geometries of a robot, tested against itself and its environment). Only the
+   geometries with the proximity role in the set are considered.
+
+   The geometries in the set are placed in a dedicated broadphase structure
+   which is then tested against the full scene, so the cost of the query
+   scales with the size of the set rather than with the size of the whole
+   scene. The results are the corresponding subset of the results of
+   FindCollisionCandidates(), in the same order.
+   @throws std::exception if `geometry_set` references invalid ids.  */
+  std::vector<SortedPair<GeometryId>> FindCollisionCandidates(
+      const GeometrySet& geometry_set) const;
+
   /** Reports true if there are _any_ collisions between unfiltered pairs in the
    world.
    @warning For Mesh shapes, their convex hulls are used in this query. It is
             *not* computationally efficient or particularly accurate.  */
   bool HasCollisions() const;
 
+  /** Variant of HasCollisions() that only considers the unfiltered pairs in
+   which at least one geometry belongs to `geometry_set`; see
+   FindCollisionCandidates(const GeometrySet&) for details. The query returns
+   as soon as the first collision is found.
+   @throws std::exception if `geometry_set` references invalid ids.  */
+  bool HasCollisions(const GeometrySet& geometry_set) const;
+
   //@}
 
   //---------------------------------------------------------------------------
@@ -595,6 +633,10 @@ class QueryObject {
    halfspace. See https://github.com/RobotLocomotion/drake/issues/10905 -->
 
    @param max_distance  The maximum distance at which distance data is reported.
+   @param parallelize   Controls the number of threads used to evaluate the
+                        candidate pairs' signed distances. Regardless of the
+                        number of threads, the results (including their order)
+                        are the same as those of the serial computation.
 
    @returns The signed distance (and supporting data) for all unfiltered
             geometry pairs whose distance is less than or equal to
@@ -603,8 +645,8 @@ class QueryObject {
    @warning For Mesh shapes, their convex hulls are used in this query. It is
             *not* computationally efficient or particularly accurate.  */
   std::vector<SignedDistancePair<T>> ComputeSignedDistancePairwiseClosestPoints(
-      const double max_distance =
-          std::numeric_limits<double>::infinity()) const;
+      const double max_distance = std::numeric_limits<double>::infinity(),
+      Parallelism parallelize = false) const;
 
   /** A variant of ComputeSignedDistancePairwiseClosestPoints() which computes
    the signed distance (and witnesses) between a specific pair of geometries
@@ -672,7 +714,7 @@ class QueryObject {
 
    |   Scalar   |   %Box  | %Capsule | %Convex | %Cylinder | %Ellipsoid | %HalfSpace |  %Mesh  | %Sphere |
    | :----: | :-----: | :------: | :-----: | :-------: | :--------: | :--------: | :-----: | :-----: |
-   |   double   |  2e-15  |   4e-15  |    ᵃ    |   3e-15   |    3e-5ᵇ   |    5e-15   |    ᵃ    |  4e-15  |
+   |   double   |  2e-15  |   4e-15  |   ᵃ ᶜ   |   3e-15   |    3e-5ᵇ   |    5e-15   |   ᵃ ᶜ   |  4e-15  |
    | AutoDiffXd |  1e-15  |   4e-15  |    ᵃ    |     ᵃ     |      ᵃ     |    5e-15   |    ᵃ    |  3e-15  |
    | Expression |   ᵃ     |    ᵃ     |    ᵃ    |     ᵃ     |      ᵃ     |      ᵃ     |    ᵃ    |    ᵃ    |
    __*Table 7*__: Worst observed error (in m) for 2mm penetration/separation
@@ -686,6 +728,10 @@ class QueryObject {
        the projection of the query point on the ellipsoid; the closer that point
        is to the high curvature area, the bigger the effect. It is not
        immediately clear how much worse the answer will get.
+   - ᶜ A %Mesh or %Convex whose proximity properties request a signed distance
+       field (see AddSignedDistanceFieldProperties()) is supported for double.
+       Its distance is interpolated from a precomputed field, with an error on
+       the order of the field's resolution near edges and corners of the mesh.
 
    @note For a sphere G, the signed distance function φᵢ(p) has an undefined
    gradient vector at the center of the sphere--every point on the sphere's
@@ -0,0 +1,59 @@
+#include "drake/geometry/query_results/contact_surface_faces.h"
+
+#include <limits>
+
+namespace drake {
+namespace geometry {
+namespace internal {
+
+template <typename T>
+void ContactSurfaceFaces<T>::Set(
+    const std::vector<ContactSurface<T>>& surfaces) {
+  int num_faces = 0;
+  for (const ContactSurface<T>& s : surfaces) {
+    num_faces += s.num_faces();
+  }
+  surface_begin_.resize(surfaces.size() + 1);
+  face_index_.resize(num_faces);
+  area_.resize(num_faces);
+  normal_W_.resize(num_faces);
+  centroid_W_.resize(num_faces);
+  pressure_.resize(num_faces);
+  grad_eM_into_M_.resize(num_faces);
+  grad_eN_into_N_.resize(num_faces);
+
+  const T kInfinity(std::numeric_limits<double>::infinity());
+  // For a triangle, the centroid has fixed barycentric coordinates, which is
+  // cheaper than evaluating the field at the Cartesian centroid.
+  const Vector3<T> tri_centroid_barycentric(1 / 3., 1 / 3., 1 / 3.);
+  int f = 0;
+  for (int i = 0; i < static_cast<int>(surfaces.size()); ++i) {
+    const ContactSurface<T>& s = surfaces[i];
+    surface_begin_[i] = f;
+    const bool has_grad_M = s.HasGradE_M();
+    const bool has_grad_N = s.HasGradE_N();
+    for (int face = 0; face < s.num_faces(); ++face, ++f) {
+      face_index_[f] = face;
+      area_[f] = s.area(face);
+      normal_W_[f] = s.face_normal(face);
+      centroid_W_[f] = s.centroid(face);
+      pressure_[f] =
+          s.is_triangle()
+              ? s.tri_e_MN().Evaluate(face, tri_centroid_barycentric)
+              : s.poly_e_MN().EvaluateCartesian(face, centroid_W_[f]);
+      grad_eM_into_M_[f] =
+          has_grad_M ? s.EvaluateGradE_M_W(face).dot(normal_W_[f]) : kInfinity;
+      grad_eN_into_N_[f] = has_grad_N
+                               ? -s.EvaluateGradE_N_W(face).dot(normal_W_[f])
+                               : kInfinity;
+    }
+  }
+  surface_begin_.back() = f;
+}
+
+}  // namespace internal
+}  // namespace geometry
+}  // namespace drake
+
+DRAKE_DEFINE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_NONSYMBOLIC_SCALARS(
+    class ::drake::geometry::internal::ContactSurfaceFaces)
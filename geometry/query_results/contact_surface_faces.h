@@ -0,0 +1,83 @@
+#pragma once
+
+#include <vector>
+
+#include "drake/common/default_scalars.h"
+#include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
+#include "drake/geometry/query_results/contact_surface.h"
+
+namespace drake {
+namespace geometry {
+namespace internal {
+
+/* A flattened view of the faces of a collection of contact surfaces: the
+ per-face quantities of all of the surfaces are stored one after the other in
+ a handful of contiguous arrays, so that consumers that treat each face as a
+ single (centroid) quadrature point can loop over them without going through
+ each surface's mesh and field objects.
+
+ The faces of the i-th surface are those with indices in the half-open range
+ [surface_begin(i), surface_begin(i + 1)), in the order of the surface's own
+ face indices. Set() reuses the storage of a previous call, so an instance
+ that is refreshed every time step (e.g., as a cache entry value) stops
+ allocating once it has seen its largest set of surfaces.
+
+ @tparam_nonsymbolic_scalar */
+template <typename T>
+class ContactSurfaceFaces {
+ public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(ContactSurfaceFaces);
+
+  ContactSurfaceFaces() = default;
+
+  /* Replaces the contents with the faces of the given `surfaces`. */
+  void Set(const std::vector<ContactSurface<T>>& surfaces);
+
+  int num_surfaces() const {
+    return static_cast<int>(surface_begin_.size()) - 1;
+  }
+
+  int num_faces() const { return static_cast<int>(area_.size()); }
+
+  /* Returns the index of the first face of the i-th surface; surface_begin(
+   num_surfaces()) is num_faces().
+   @pre 0 <= i <= num_surfaces(). */
+  int surface_begin(int i) const { return surface_begin_[i]; }
+
+  /* The index of the f-th face within its own surface. */
+  int face_index(int f) const { return face_index_[f]; }
+
+  const T& area(int f) const { return area_[f]; }
+
+  /* The face's normal; it points out of N and into M. */
+  const Vector3<T>& normal_W(int f) const { return normal_W_[f]; }
+
+  const Vector3<T>& centroid_W(int f) const { return centroid_W_[f]; }
+
+  /* The value of the surface's e_MN field at the face's centroid. */
+  const T& pressure(int f) const { return pressure_[f]; }
+
+  /* The components of ∇eₘ and ∇eₙ along the direction into M and into N,
+   respectively (i.e., ∇eₘ⋅n̂ and -∇eₙ⋅n̂). The component of a geometry whose
+   surface doesn't have its gradient (e.g., because it is rigid) is infinity. */
+  const T& grad_eM_into_M(int f) const { return grad_eM_into_M_[f]; }
+  const T& grad_eN_into_N(int f) const { return grad_eN_into_N_[f]; }
+
+ private:
+  std::vector<int> surface_begin_{0};
+  std::vector<int> face_index_;
+  std::vector<T> area_;
+  std::vector<Vector3<T>> normal_W_;
+  std::vector<Vector3<T>> centroid_W_;
+  std::vector<T> pressure_;
+  std::vector<T> grad_eM_into_M_;
+  std::vector<T> grad_eN_into_N_;
+};
+
+}  // namespace internal
+}  // namespace geometry
+}  // namespace drake
+
+DRAKE_DECLARE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_NONSYMBOLIC_SCALARS(
+    class ::drake::geometry::internal::ContactSurfaceFaces)
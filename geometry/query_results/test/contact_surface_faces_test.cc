@@ -0,0 +1,109 @@
+#include "drake/geometry/query_results/contact_surface_faces.h"
+
+#include <limits>
+#include <memory>
+#include <utility>
+
+#include <gtest/gtest.h>
+
+namespace drake {
+namespace geometry {
+namespace internal {
+namespace {
+
+using Eigen::Vector3d;
+using std::make_unique;
+using std::vector;
+
+/* Makes a contact surface on the unit square in the z = 0 plane, split into
+ two triangles, with e_MN = x + 2y. Only M has a pressure gradient. */
+ContactSurface<double> MakeTriangleSurface() {
+  auto mesh = make_unique<TriangleSurfaceMesh<double>>(
+      vector<SurfaceTriangle>{{0, 1, 2}, {2, 3, 0}},
+      vector<Vector3d>{{0, 0, 0}, {1, 0, 0}, {1, 1, 0}, {0, 1, 0}});
+  auto field = make_unique<TriangleSurfaceMeshFieldLinear<double, double>>(
+      vector<double>{0, 1, 3, 2}, mesh.get());
+  auto grad_eM_W = make_unique<vector<Vector3d>>(
+      vector<Vector3d>{Vector3d(0, 0, 4), Vector3d(1, 0, 5)});
+  const GeometryId id_M = GeometryId::get_new_id();
+  const GeometryId id_N = GeometryId::get_new_id();
+  return ContactSurface<double>(id_M, id_N, std::move(mesh),
+                                std::move(field), std::move(grad_eM_W),
+                                nullptr);
+}
+
+/* Makes a contact surface with a single square polygon in the z = 1 plane,
+ with e_MN = 3x. Only N has a pressure gradient. */
+ContactSurface<double> MakePolygonSurface() {
+  auto mesh = make_unique<PolygonSurfaceMesh<double>>(
+      vector<int>{4, 0, 1, 2, 3},
+      vector<Vector3d>{{0, 0, 1}, {1, 0, 1}, {1, 1, 1}, {0, 1, 1}});
+  auto field = make_unique<PolygonSurfaceMeshFieldLinear<double, double>>(
+      vector<double>{0, 3, 3, 0}, mesh.get(),
+      vector<Vector3d>{Vector3d(3, 0, 0)});
+  auto grad_eN_W =
+      make_unique<vector<Vector3d>>(vector<Vector3d>{Vector3d(0, 0, -6)});
+  const GeometryId id_M = GeometryId::get_new_id();
+  const GeometryId id_N = GeometryId::get_new_id();
+  return ContactSurface<double>(id_M, id_N, std::move(mesh),
+                                std::move(field), nullptr,
+                                std::move(grad_eN_W));
+}
+
+GTEST_TEST(ContactSurfaceFacesTest, Set) {
+  ContactSurfaceFaces<double> faces;
+  EXPECT_EQ(faces.num_surfaces(), 0);
+  EXPECT_EQ(faces.num_faces(), 0);
+
+  vector<ContactSurface<double>> surfaces;
+  surfaces.push_back(MakeTriangleSurface());
+  surfaces.push_back(MakePolygonSurface());
+  faces.Set(surfaces);
+
+  ASSERT_EQ(faces.num_surfaces(), 2);
+  ASSERT_EQ(faces.num_faces(), 3);
+  EXPECT_EQ(faces.surface_begin(0), 0);
+  EXPECT_EQ(faces.surface_begin(1), 2);
+  EXPECT_EQ(faces.surface_begin(2), 3);
+
+  // Every per-face quantity matches the surface it came from.
+  const double kInfinity = std::numeric_limits<double>::infinity();
+  for (int i = 0; i < 2; ++i) {
+    const ContactSurface<double>& s = surfaces[i];
+    for (int f = faces.surface_begin(i); f < faces.surface_begin(i + 1); ++f) {
+      const int face = faces.face_index(f);
+      EXPECT_EQ(face, f - faces.surface_begin(i));
+      EXPECT_EQ(faces.area(f), s.area(face));
+      EXPECT_EQ(faces.normal_W(f), s.face_normal(face));
+      EXPECT_EQ(faces.centroid_W(f), s.centroid(face));
+      const Vector3d& p_WC = faces.centroid_W(f);
+      const double expected_pressure =
+          i == 0 ? p_WC.x() + 2 * p_WC.y() : 3 * p_WC.x();
+      EXPECT_NEAR(faces.pressure(f), expected_pressure, 1e-14);
+      EXPECT_EQ(faces.grad_eM_into_M(f),
+                s.HasGradE_M() ? s.EvaluateGradE_M_W(face).z() : kInfinity);
+      EXPECT_EQ(faces.grad_eN_into_N(f),
+                s.HasGradE_N() ? -s.EvaluateGradE_N_W(face).z() : kInfinity);
+    }
+  }
+  EXPECT_EQ(faces.grad_eM_into_M(1), 5);
+  EXPECT_EQ(faces.grad_eN_into_N(2), 6);
+
+  // Setting a smaller collection replaces the previous contents.
+  surfaces.erase(surfaces.begin());
+  faces.Set(surfaces);
+  ASSERT_EQ(faces.num_surfaces(), 1);
+  ASSERT_EQ(faces.num_faces(), 1);
+  EXPECT_EQ(faces.face_index(0), 0);
+  EXPECT_EQ(faces.grad_eM_into_M(0), kInfinity);
+  EXPECT_EQ(faces.grad_eN_into_N(0), 6);
+
+  faces.Set({});
+  EXPECT_EQ(faces.num_surfaces(), 0);
+  EXPECT_EQ(faces.num_faces(), 0);
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace geometry
+}  // namespace drake
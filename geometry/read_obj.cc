@@ -1,9 +1,18 @@
 #include "drake/geometry/read_obj.h"
 
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
 #include <fmt/format.h>
 #include <tiny_obj_loader.h>
 
 #include "drake/common/drake_assert.h"
+#include "drake/common/drake_copyable.h"
+#include "drake/common/never_destroyed.h"
 #include "drake/common/text_logging.h"
 
 static_assert(std::is_same_v<tinyobj::real_t, double>,
@@ -21,23 +30,23 @@ namespace {
 // Convert vertices from tinyobj format to FCL format.
 //
 // Vertices from tinyobj are in a vector of floating-points like this:
-//     attrib.vertices = {c0,c1,c2, c3,c4,c5, c6,c7,c8,...}
-//                     = {x, y, z,  x, y, z,  x, y, z,...}
+//     coords = {c0,c1,c2, c3,c4,c5, c6,c7,c8,...}
+//            = {x, y, z,  x, y, z,  x, y, z,...}
 // We will convert to a vector of Vector3d for FCL like this:
 //     vertices = {{c0,c1,c2}, {c3,c4,c5}, {c6,c7,c8},...}
 //              = {    v0,         v1,         v2,    ...}
 //
-// The size of `attrib.vertices` is three times the number of vertices.
+// The size of `coords` is three times the number of vertices.
 //
-std::vector<Eigen::Vector3d> TinyObjToFclVertices(
-    const tinyobj::attrib_t& attrib, const double scale) {
-  int num_coords = attrib.vertices.size();
+std::vector<Eigen::Vector3d> ObjToFclVertices(const std::vector<double>& coords,
+                                              const double scale) {
+  int num_coords = coords.size();
   DRAKE_DEMAND(num_coords % 3 == 0);
   std::vector<Eigen::Vector3d> vertices;
   vertices.reserve(num_coords / 3);
 
-  auto iter = attrib.vertices.begin();
-  while (iter != attrib.vertices.end()) {
+  auto iter = coords.begin();
+  while (iter != coords.end()) {
     // We increment `iter` three times for x, y, and z coordinates.
     double x = *(iter++) * scale;
     double y = *(iter++) * scale;
@@ -49,21 +58,21 @@ std::vector<Eigen::Vector3d> TinyObjToFclVertices(
 }
 
 //
-// Returns the `mesh`'s faces re-encoded in a format consistent with what
+// Returns the `shape`'s faces re-encoded in a format consistent with what
 // fcl::Convex expects.
 //
-// A tinyobj mesh has an integer array storing the number of vertices of
-// each polygonal face.
-//     mesh.num_face_vertices = {n0,n1,n2,...}
+// A shape has an integer array storing the number of vertices of each
+// polygonal face.
+//     shape.face_sizes = {n0,n1,n2,...}
 //         face0 has n0 vertices.
 //         face1 has n1 vertices.
 //         face2 has n2 vertices.
 //         ...
-// A tinyobj mesh has a vector of vertices that belong to the faces.
-//     mesh.indices = {v0_0, v0_1,..., v0_n0-1,
-//                     v1_0, v1_1,..., v1_n1-1,
-//                     v2_0, v2_1,..., v2_n2-1,
-//                     ...}
+// A shape has a vector of vertices that belong to the faces.
+//     shape.indices = {v0_0, v0_1,..., v0_n0-1,
+//                      v1_0, v1_1,..., v1_n1-1,
+//                      v2_0, v2_1,..., v2_n2-1,
+//                      ...}
 //         face0 has vertices v0_0, v0_1,...,v0_n0-1.
 //         face1 has vertices v1_0, v1_1,...,v1_n1-1.
 //         face2 has vertices v2_0, v2_1,...,v2_n2-1.
@@ -76,48 +85,197 @@ std::vector<Eigen::Vector3d> TinyObjToFclVertices(
 // where ni is the number of vertices of facei.
 //
 // The actual number of faces returned will be equal to:
-// mesh.num_face_vertices.size() which *cannot* be easily inferred from the
-// *size* of the returned vector.
-std::vector<int> TinyObjToFclFaces(const tinyobj::mesh_t& mesh) {
+// shape.face_sizes.size() which *cannot* be easily inferred from the *size*
+// of the returned vector.
+std::vector<int> ObjToFclFaces(const ObjGeometry::Shape& shape) {
   std::vector<int> faces;
-  faces.reserve(mesh.indices.size() + mesh.num_face_vertices.size());
-  auto iter = mesh.indices.begin();
-  for (int num : mesh.num_face_vertices) {
+  faces.reserve(shape.indices.size() + shape.face_sizes.size());
+  auto iter = shape.indices.begin();
+  for (int num : shape.face_sizes) {
     faces.push_back(num);
-    std::for_each(iter, iter + num, [&faces](const tinyobj::index_t& index) {
-      faces.push_back(index.vertex_index);
-    });
+    faces.insert(faces.end(), iter, iter + num);
     iter += num;
   }
 
   return faces;
 }
+
+// The most recently used parsed OBJ files, up to a total size.
+class ObjCache {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(ObjCache)
+
+  ObjCache() = default;
+
+  // Returns the cached data for the given file, or nullptr if there is none
+  // for the given version of the file.
+  std::shared_ptr<const ObjGeometry> Find(
+      const std::string& filename, bool triangulate,
+      std::filesystem::file_time_type modified, uintmax_t file_size) {
+    std::lock_guard<std::mutex> guard(mutex_);
+    auto iter = entries_.find(Key(filename, triangulate));
+    if (iter == entries_.end() || iter->second.modified != modified ||
+        iter->second.file_size != file_size) {
+      return nullptr;
+    }
+    iter->second.last_use = ++num_uses_;
+    return iter->second.geometry;
+  }
+
+  // Adds (or replaces) the data for the given file, and then evicts the least
+  // recently used data until the cache is within its budget.
+  void Insert(const std::string& filename, bool triangulate,
+              std::filesystem::file_time_type modified, uintmax_t file_size,
+              std::shared_ptr<const ObjGeometry> geometry) {
+    std::lock_guard<std::mutex> guard(mutex_);
+    Entry& entry = entries_[Key(filename, triangulate)];
+    num_bytes_ -= entry.num_bytes;
+    entry.modified = modified;
+    entry.file_size = file_size;
+    entry.num_bytes = CountBytes(*geometry);
+    entry.geometry = std::move(geometry);
+    entry.last_use = ++num_uses_;
+    num_bytes_ += entry.num_bytes;
+    while (num_bytes_ > kMaxBytes && entries_.size() > 1) {
+      auto oldest = entries_.begin();
+      for (auto iter = entries_.begin(); iter != entries_.end(); ++iter) {
+        if (iter->second.last_use < oldest->second.last_use) {
+          oldest = iter;
+        }
+      }
+      num_bytes_ -= oldest->second.num_bytes;
+      entries_.erase(oldest);
+    }
+  }
+
+ private:
+  // The maximum total size of the cached data.
+  static constexpr size_t kMaxBytes = size_t{256} << 20;
+
+  struct Entry {
+    std::filesystem::file_time_type modified;
+    uintmax_t file_size{};
+    std::shared_ptr<const ObjGeometry> geometry;
+    size_t num_bytes{};
+    uint64_t last_use{};
+  };
+
+  // Files are parsed separately with and without triangulation.
+  static std::string Key(const std::string& filename, bool triangulate) {
+    return (triangulate ? "1" : "0") + filename;
+  }
+
+  static size_t CountBytes(const ObjGeometry& geometry) {
+    size_t result = geometry.vertices.size() * sizeof(double);
+    for (const ObjGeometry::Shape& shape : geometry.shapes) {
+      result += (shape.face_sizes.size() + shape.indices.size()) * sizeof(int);
+    }
+    return result;
+  }
+
+  std::mutex mutex_;
+  std::unordered_map<std::string, Entry> entries_;
+  size_t num_bytes_{};
+  uint64_t num_uses_{};
+};
+
+ObjCache& GetObjCache() {
+  static never_destroyed<ObjCache> cache;
+  return cache.access();
+}
+
 }  // namespace
 
-std::tuple<std::shared_ptr<std::vector<Eigen::Vector3d>>,
-           std::shared_ptr<std::vector<int>>, int>
-ReadObjFile(const std::string& filename, double scale, bool triangulate) {
+std::optional<ObjGeometry> ParseObj(
+    std::istream* input_stream, const std::optional<std::string>& mtl_basedir,
+    bool triangulate, std::string* error) {
+  DRAKE_DEMAND(input_stream != nullptr);
+  DRAKE_DEMAND(error != nullptr);
   tinyobj::attrib_t attrib;
   std::vector<tinyobj::shape_t> shapes;
   std::vector<tinyobj::material_t> materials;
   std::string warn;
   std::string err;
+  std::unique_ptr<tinyobj::MaterialReader> material_reader;
+  if (mtl_basedir) {
+    material_reader =
+        std::make_unique<tinyobj::MaterialFileReader>(*mtl_basedir);
+  }
+  const bool ret =
+      tinyobj::LoadObj(&attrib, &shapes, &materials, &warn, &err, input_stream,
+                       material_reader.get(), triangulate);
+  if (!ret || !err.empty()) {
+    *error = std::move(err);
+    return std::nullopt;
+  }
+
+  ObjGeometry result;
+  result.vertices = std::move(attrib.vertices);
+  result.shapes.reserve(shapes.size());
+  for (const tinyobj::shape_t& shape : shapes) {
+    ObjGeometry::Shape& faces = result.shapes.emplace_back();
+    faces.face_sizes.assign(shape.mesh.num_face_vertices.begin(),
+                            shape.mesh.num_face_vertices.end());
+    faces.indices.reserve(shape.mesh.indices.size());
+    for (const tinyobj::index_t& index : shape.mesh.indices) {
+      faces.indices.push_back(index.vertex_index);
+    }
+  }
+  result.warning = std::move(warn);
+  return result;
+}
+
+std::shared_ptr<const ObjGeometry> ReadObjGeometry(const std::string& filename,
+                                                   bool triangulate,
+                                                   std::string* error) {
+  DRAKE_DEMAND(error != nullptr);
+  std::error_code modified_error;
+  std::error_code size_error;
+  const std::filesystem::file_time_type modified =
+      std::filesystem::last_write_time(filename, modified_error);
+  const uintmax_t file_size =
+      std::filesystem::file_size(filename, size_error);
+  std::ifstream input_stream(filename);
+  if (modified_error || size_error || !input_stream.is_open()) {
+    throw std::runtime_error(fmt::format("Cannot open file '{}'", filename));
+  }
+
+  ObjCache& cache = GetObjCache();
+  std::shared_ptr<const ObjGeometry> result =
+      cache.Find(filename, triangulate, modified, file_size);
+  if (result != nullptr) {
+    return result;
+  }
 
   // Tinyobj doesn't infer the search directory from the directory containing
   // the obj file. We have to provide that directory; of course, this assumes
   // that the material library reference is relative to the obj directory.
   const size_t pos = filename.find_last_of('/');
-  const std::string obj_folder = filename.substr(0, pos + 1);
-  const char* mtl_basedir = obj_folder.c_str();
+  const std::string mtl_basedir = filename.substr(0, pos + 1);
+  std::optional<ObjGeometry> parsed =
+      ParseObj(&input_stream, mtl_basedir, triangulate, error);
+  if (!parsed.has_value()) {
+    return nullptr;
+  }
+  result = std::make_shared<const ObjGeometry>(std::move(*parsed));
+  cache.Insert(filename, triangulate, modified, file_size, result);
+  return result;
+}
 
-  bool ret = tinyobj::LoadObj(&attrib, &shapes, &materials, &warn, &err,
-                              filename.c_str(), mtl_basedir, triangulate);
-  if (!ret || !err.empty()) {
+std::tuple<std::shared_ptr<std::vector<Eigen::Vector3d>>,
+           std::shared_ptr<std::vector<int>>, int>
+ReadObjFile(const std::string& filename, double scale, bool triangulate) {
+  std::string err;
+  const std::shared_ptr<const ObjGeometry> obj =
+      ReadObjGeometry(filename, triangulate, &err);
+  if (obj == nullptr) {
     throw std::runtime_error("Error parsing file '" + filename + "' : " + err);
   }
-  if (!warn.empty()) {
-    drake::log()->warn("Warning parsing file '{}' : {}", filename, warn);
+  if (!obj->warning.empty()) {
+    drake::log()->warn("Warning parsing file '{}' : {}", filename,
+                       obj->warning);
   }
+  const std::vector<ObjGeometry::Shape>& shapes = obj->shapes;
 
   if (shapes.size() == 0) {
     throw std::runtime_error(
@@ -133,7 +291,7 @@ ReadObjFile(const std::string& filename, double scale, bool triangulate) {
   }
 
   auto vertices = std::make_shared<std::vector<Eigen::Vector3d>>(
-      TinyObjToFclVertices(attrib, scale));
+      ObjToFclVertices(obj->vertices, scale));
 
   // We will have `faces.size()` larger than the number of faces. For each
   // face_i, the vector `faces` contains both the number and indices of its
@@ -144,9 +302,8 @@ ReadObjFile(const std::string& filename, double scale, bool triangulate) {
   //               ...}
   // where n_i is the number of vertices of face_i.
   //
-  int num_faces = static_cast<int>(shapes[0].mesh.num_face_vertices.size());
-  auto faces =
-      std::make_shared<std::vector<int>>(TinyObjToFclFaces(shapes[0].mesh));
+  int num_faces = static_cast<int>(shapes[0].face_sizes.size());
+  auto faces = std::make_shared<std::vector<int>>(ObjToFclFaces(shapes[0]));
   return {vertices, faces, num_faces};
 }
 }  // namespace internal
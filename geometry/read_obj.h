@@ -1,6 +1,8 @@
 #pragma once
 
+#include <istream>
 #include <memory>
+#include <optional>
 #include <string>
 #include <tuple>
 #include <vector>
@@ -10,6 +12,50 @@
 namespace drake {
 namespace geometry {
 namespace internal {
+
+/* The geometric data of Wavefront OBJ data, as parsed by tinyobjloader. */
+struct ObjGeometry {
+  /* The faces of one shape (i.e., object or group) of the data. */
+  struct Shape {
+    /* The number of vertices of each face. */
+    std::vector<int> face_sizes;
+    /* The indices (into `vertices`) of the vertices of all of the faces,
+     concatenated in order. */
+    std::vector<int> indices;
+  };
+
+  /* The (unscaled) vertex positions, as consecutive (x, y, z) triples. */
+  std::vector<double> vertices;
+  std::vector<Shape> shapes;
+  /* The warnings reported by the parser, if any. */
+  std::string warning;
+};
+
+/* Parses the OBJ data in `input_stream`. Material libraries are looked up in
+ `mtl_basedir` (when given), only to report the ones that are missing.
+ @param triangulate Whether to triangulate the polygonal faces.
+ @returns the parsed data, or std::nullopt (after setting `error` to the
+ parser's message) if the data could not be parsed. */
+std::optional<ObjGeometry> ParseObj(
+    std::istream* input_stream, const std::optional<std::string>& mtl_basedir,
+    bool triangulate, std::string* error);
+
+/* Parses the OBJ file with the given `filename`, like ParseObj() with the
+ material libraries looked up in the file's directory.
+
+ The results are cached, so that reading the same file again (e.g., to
+ register it for another role, or to convert it for another engine) reuses the
+ parsed data, as long as the file's size and modification time are unchanged.
+ The cache is bounded in size; the least recently used data is evicted first.
+ This function is thread-safe.
+
+ @returns the parsed data, or nullptr (after setting `error` to the parser's
+ message) if the file could not be parsed.
+ @throws std::exception if the file cannot be opened. */
+std::shared_ptr<const ObjGeometry> ReadObjGeometry(const std::string& filename,
+                                                   bool triangulate,
+                                                   std::string* error);
+
 /** Reads the OBJ file with the given `filename` into a collection of data. It
  * includes the vertex positions, face encodings (see TinyObjToFclFaces), and
  * number of faces.
@@ -83,6 +83,69 @@ RenderLabel RenderEngine::GetRenderLabelOrThrow(
   return label;
 }
 
+void RenderEngine::RenderImages(const std::vector<ImageRequest>& requests) {
+  instrumentation::ScopedZone zone("RenderEngine::RenderImages");
+  ThrowIfInvalid(requests);
+  DoFinishRenderImages();
+  DoRenderImages(requests);
+}
+
+void RenderEngine::StartRenderImages(
+    const std::vector<ImageRequest>& requests) {
+  instrumentation::ScopedZone zone("RenderEngine::StartRenderImages");
+  ThrowIfInvalid(requests);
+  DoFinishRenderImages();
+  DoStartRenderImages(requests);
+}
+
+void RenderEngine::ThrowIfInvalid(const std::vector<ImageRequest>& requests) {
+  for (const ImageRequest& request : requests) {
+    if (request.color_image != nullptr || request.label_image != nullptr) {
+      if (!request.color_camera.has_value()) {
+        throw std::logic_error(
+            "Can't render a color or label image without a color camera");
+      }
+      const auto& intrinsics = request.color_camera->core().intrinsics();
+      if (request.color_image != nullptr) {
+        ThrowIfInvalid(intrinsics, request.color_image, "color");
+      }
+      if (request.label_image != nullptr) {
+        ThrowIfInvalid(intrinsics, request.label_image, "label");
+      }
+    }
+    if (request.depth_image != nullptr) {
+      if (!request.depth_camera.has_value()) {
+        throw std::logic_error(
+            "Can't render a depth image without a depth camera");
+      }
+      ThrowIfInvalid(request.depth_camera->core().intrinsics(),
+                     request.depth_image, "depth");
+    }
+  }
+}
+
+void RenderEngine::DoRenderImages(const std::vector<ImageRequest>& requests) {
+  for (const ImageRequest& request : requests) {
+    UpdateViewpoint(request.X_WC);
+    if (request.color_image != nullptr) {
+      DoRenderColorImage(*request.color_camera, request.color_image);
+    }
+    if (request.depth_image != nullptr) {
+      DoRenderDepthImage(*request.depth_camera, request.depth_image);
+    }
+    if (request.label_image != nullptr) {
+      DoRenderLabelImage(*request.color_camera, request.label_image);
+    }
+  }
+}
+
+void RenderEngine::DoStartRenderImages(
+    const std::vector<ImageRequest>& requests) {
+  DoRenderImages(requests);
+}
+
+void RenderEngine::DoFinishRenderImages() {}
+
 void RenderEngine::DoRenderColorImage(const ColorRenderCamera&,
                                       ImageRgba8U*) const {
   throw std::runtime_error(
@@ -11,6 +11,7 @@
 
 #include "drake/common/drake_copyable.h"
 #include "drake/common/drake_deprecated.h"
+#include "drake/common/instrumentation.h"
 #include "drake/geometry/geometry_ids.h"
 #include "drake/geometry/geometry_roles.h"
 #include "drake/geometry/render/render_camera.h"
@@ -163,6 +164,27 @@ class RenderEngine : public ShapeReifier {
     }
   }
 
+  /** Variant of UpdatePoses() that only updates the poses of the geometries
+   in `ids` that are marked as "needing update". Ids of geometries that are
+   not registered with `this` engine, or that are anchored, are ignored.
+
+   @param X_WGs  The poses of *all* geometries in SceneGraph (measured and
+                 expressed in the world frame). The pose for a geometry is
+                 accessed by that geometry's id.
+   @param ids    The ids of the geometries whose poses may have changed since
+                 the last update.  */
+  template <typename T>
+  void UpdatePoses(
+      const std::unordered_map<GeometryId, math::RigidTransform<T>>& X_WGs,
+      const std::vector<GeometryId>& ids) {
+    for (const GeometryId& id : ids) {
+      if (update_ids_.count(id) == 0) continue;
+      const math::RigidTransformd X_WG =
+          geometry::internal::convert_to_double(X_WGs.at(id));
+      DoUpdateVisualPose(id, X_WG);
+    }
+  }
+
   /** Updates the renderer's viewpoint with given pose X_WR.
 
    @param X_WR  The pose of renderer's viewpoint in the world coordinate
@@ -187,6 +209,7 @@ class RenderEngine : public ShapeReifier {
                           `camera`.  */
   void RenderColorImage(const ColorRenderCamera& camera,
                         systems::sensors::ImageRgba8U* color_image_out) const {
+    instrumentation::ScopedZone zone("RenderEngine::RenderColorImage");
     ThrowIfInvalid(camera.core().intrinsics(), color_image_out, "color");
     DoRenderColorImage(camera, color_image_out);
   }
@@ -204,6 +227,7 @@ class RenderEngine : public ShapeReifier {
   void RenderDepthImage(
       const DepthRenderCamera& camera,
       systems::sensors::ImageDepth32F* depth_image_out) const {
+    instrumentation::ScopedZone zone("RenderEngine::RenderDepthImage");
     ThrowIfInvalid(camera.core().intrinsics(), depth_image_out, "depth");
     DoRenderDepthImage(camera, depth_image_out);
   }
@@ -222,10 +246,67 @@ class RenderEngine : public ShapeReifier {
   void RenderLabelImage(
       const ColorRenderCamera& camera,
       systems::sensors::ImageLabel16I* label_image_out) const {
+    instrumentation::ScopedZone zone("RenderEngine::RenderLabelImage");
     ThrowIfInvalid(camera.core().intrinsics(), label_image_out, "label");
     DoRenderLabelImage(camera, label_image_out);
   }
 
+  /** The images to render from a single camera pose, for RenderImages().
+   Each image is only rendered if its output pointer is non-null. */
+  struct ImageRequest {
+    /** The pose of the camera in the world frame. */
+    math::RigidTransformd X_WC;
+    /** The camera for the color and label images. It is required if either
+     of those images is requested. */
+    std::optional<ColorRenderCamera> color_camera;
+    /** The camera for the depth image. It is required if the depth image is
+     requested. */
+    std::optional<DepthRenderCamera> depth_camera;
+    /** The rendered color image, if requested. */
+    systems::sensors::ImageRgba8U* color_image{};
+    /** The rendered depth image, if requested. */
+    systems::sensors::ImageDepth32F* depth_image{};
+    /** The rendered label image, if requested. */
+    systems::sensors::ImageLabel16I* label_image{};
+  };
+
+  /** Renders the requested images of many cameras at once.
+
+   The result is the same as calling, for each request in order,
+   UpdateViewpoint() with the request's `X_WC` followed by RenderColorImage(),
+   RenderDepthImage(), and RenderLabelImage() for each requested image, and
+   the viewpoint is left at the pose of the last request. However, a derived
+   render engine may render the batch more efficiently than the individual
+   calls, e.g., by reusing its rendering state across cameras and image
+   types, and by not waiting for an image to be read back before rendering
+   the next one.
+
+   @throws std::exception if an image is requested without its camera, or if
+                          the size of a requested image doesn't match the size
+                          declared in its camera. In that case, nothing is
+                          rendered. */
+  void RenderImages(const std::vector<ImageRequest>& requests);
+
+  /** Starts rendering the requested images, like RenderImages(), but without
+   waiting for them to be written. The images are only guaranteed to be
+   written once FinishRenderImages() returns, so that the caller can do other
+   work (e.g., advance a simulation) while the images are transferred from
+   the render device. The output images must stay alive, and must not be
+   accessed, until then.
+
+   Only one batch can be in flight: calling this function (or RenderImages())
+   again first finishes the previous batch.
+
+   Engines that can't render asynchronously render the images before
+   returning, which is what the default implementation does.
+
+   @throws std::exception under the same conditions as RenderImages(). */
+  void StartRenderImages(const std::vector<ImageRequest>& requests);
+
+  /** Waits until the images of the last call to StartRenderImages() have
+   been written. Does nothing if there is no such batch in flight. */
+  void FinishRenderImages() { DoFinishRenderImages(); }
+
   //@}
 
   /** Reports the render label value this render engine has been configured to
@@ -309,6 +390,26 @@ class RenderEngine : public ShapeReifier {
       const ColorRenderCamera& camera,
       systems::sensors::ImageLabel16I* label_image_out) const;
 
+  /** The NVI-function for rendering a batch of images. When RenderImages
+   calls this, it has already confirmed that every requested image has its
+   camera and a size consistent with the camera intrinsics.
+
+   The default implementation renders each requested image in turn with
+   UpdateViewpoint() and the DoRender*Image() functions. Derived %RenderEngine
+   classes can override it to render the batch more efficiently. */
+  virtual void DoRenderImages(const std::vector<ImageRequest>& requests);
+
+  /** The NVI-function for StartRenderImages(). When StartRenderImages calls
+   this, it has already validated the requests, as for DoRenderImages().
+
+   The default implementation calls DoRenderImages(). Derived %RenderEngine
+   classes that override it must also override DoFinishRenderImages(). */
+  virtual void DoStartRenderImages(const std::vector<ImageRequest>& requests);
+
+  /** The NVI-function for FinishRenderImages(). The default implementation
+   does nothing. */
+  virtual void DoFinishRenderImages();
+
   /** Extracts the `(label, id)` RenderLabel property from the given
    `properties` and validates it (or the configured default if no such
    property is defined).
@@ -376,6 +477,9 @@ class RenderEngine : public ShapeReifier {
                (0, 1, 0).  */
   virtual void SetDefaultLightPosition(const Vector3<double>& X_DL);
 
+  // Throws if any of the requests is invalid; see RenderImages().
+  static void ThrowIfInvalid(const std::vector<ImageRequest>& requests);
+
   template <typename ImageType>
   static void ThrowIfInvalid(const systems::sensors::CameraInfo& intrinsics,
                              const ImageType* image, const char* image_type) {
@@ -2,9 +2,15 @@
 
 #include <algorithm>
 #include <fstream>
+#include <functional>
+#include <iterator>
 #include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
 #include <string>
 #include <tuple>
+#include <unordered_map>
 #include <utility>
 
 #include <fmt/format.h>
@@ -12,6 +18,7 @@
 
 #include "drake/common/drake_assert.h"
 #include "drake/common/eigen_types.h"
+#include "drake/common/never_destroyed.h"
 #include "drake/common/ssize.h"
 #include "drake/common/text_logging.h"
 
@@ -87,14 +94,24 @@ RenderMaterial MakeMaterialFromMtl(const tinyobj::material_t& mat,
   return result;
 }
 
-}  // namespace
+/* The product of parsing an OBJ file; unlike a RenderMesh, it doesn't depend
+ on the geometry properties or the default diffuse color. */
+struct ParsedObj {
+  /* One mesh for each material referenced in the file, lacking its material. */
+  vector<RenderMesh> meshes;
+  /* For each mesh, the material that it references (or nullopt if none). */
+  vector<std::optional<tinyobj::material_t>> materials;
+  /* The warnings reported by the parser, if any. */
+  std::string warning;
+};
 
 // TODO(SeanCurtis-TRI): Add troubleshooting entry on OBJ support and
 // reference it in these errors/warnings.
 
-vector<RenderMesh> LoadRenderMeshesFromObj(
-    const std::filesystem::path& obj_path, const GeometryProperties& properties,
-    const Rgba& default_diffuse, const DiagnosticPolicy& policy) {
+/* Parses the OBJ file.
+ @throws std::exception under the conditions documented for
+         LoadRenderMeshesFromObj(). */
+ParsedObj ParseObj(const std::filesystem::path& obj_path) {
   tinyobj::ObjReaderConfig config;
   config.triangulate = true;
   config.vertex_color = false;
@@ -123,9 +140,8 @@ vector<RenderMesh> LoadRenderMeshesFromObj(
         obj_path.string()));
   }
 
-  if (!reader.Warning().empty()) {
-    policy.Warning(reader.Warning());
-  }
+  ParsedObj result;
+  result.warning = reader.Warning();
 
   const tinyobj::attrib_t& attrib = reader.GetAttrib();
 
@@ -267,24 +283,20 @@ vector<RenderMesh> LoadRenderMeshesFromObj(
    will lead to a unique `RenderMesh` and `RenderMaterial`. Note: the obj may
    have declared distinct *objects*. We are erasing that distinction as
    irrelevant for rendering the mesh as a rigid structure. */
-  vector<RenderMesh> meshes;
   for (const auto& [mat_index, tri_indices] : material_triangles) {
     RenderMesh mesh_data;
 
-    /* Create the material for set of triangles. */
+    /* Record the material for set of triangles; the RenderMaterial is created
+     when the mesh is loaded. Index -1 is the default material; no material was
+     assigned to the faces. */
     mesh_data.uv_state = material_uvs[mat_index] == 0 ? UvState::kNone
                          : material_uvs[mat_index] == ssize(tri_indices) * 3
                              ? UvState::kFull
                              : UvState::kPartial;
     if (mat_index == -1) {
-      /* This is the default material. No material was assigned to the faces.
-       We'll apply the fallback logic. */
-      mesh_data.material = MakeMeshFallbackMaterial(
-          properties, obj_path, default_diffuse, policy, mesh_data.uv_state);
+      result.materials.push_back(std::nullopt);
     } else {
-      mesh_data.material =
-          MakeMaterialFromMtl(reader.GetMaterials().at(mat_index), obj_path,
-                              properties, policy, mesh_data.uv_state);
+      result.materials.push_back(reader.GetMaterials().at(mat_index));
     }
 
     /* Partition the data into distinct RenderMeshes. The triangles in one
@@ -324,9 +336,72 @@ vector<RenderMesh> LoadRenderMeshesFromObj(
       mesh_data.normals.row(part_index) = normals[full_index];
       mesh_data.uvs.row(part_index) = uvs[full_index];
     }
-    meshes.push_back(std::move(mesh_data));
+    result.meshes.push_back(std::move(mesh_data));
   }
 
+  return result;
+}
+
+/* Returns the parsed OBJ file, from a process-wide cache keyed on the file's
+ path and contents. Every engine that loads the same file (and every geometry
+ that instantiates it) shares a single parse. Files that fail to parse aren't
+ cached. */
+std::shared_ptr<const ParsedObj> GetParsedObj(
+    const std::filesystem::path& obj_path) {
+  std::string contents;
+  {
+    std::ifstream file(obj_path, std::ios::binary);
+    if (!file.is_open()) {
+      // Let the parser report the error.
+      return std::make_shared<const ParsedObj>(ParseObj(obj_path));
+    }
+    contents.assign(std::istreambuf_iterator<char>(file),
+                    std::istreambuf_iterator<char>());
+  }
+  const std::string key = fmt::format("{}:{}", obj_path.string(),
+                                      std::hash<std::string>{}(contents));
+
+  static never_destroyed<std::mutex> g_mutex;
+  static never_destroyed<
+      std::unordered_map<std::string, std::shared_ptr<const ParsedObj>>>
+      g_cache;
+  {
+    std::lock_guard<std::mutex> lock(g_mutex.access());
+    auto iter = g_cache.access().find(key);
+    if (iter != g_cache.access().end()) {
+      return iter->second;
+    }
+  }
+  // Parse without holding the lock, so that distinct files can be parsed in
+  // parallel. If two threads race on the same file, the first one wins.
+  auto parsed = std::make_shared<const ParsedObj>(ParseObj(obj_path));
+  std::lock_guard<std::mutex> lock(g_mutex.access());
+  return g_cache.access().emplace(key, std::move(parsed)).first->second;
+}
+
+}  // namespace
+
+vector<RenderMesh> LoadRenderMeshesFromObj(
+    const std::filesystem::path& obj_path, const GeometryProperties& properties,
+    const Rgba& default_diffuse, const DiagnosticPolicy& policy) {
+  const std::shared_ptr<const ParsedObj> parsed = GetParsedObj(obj_path);
+  if (!parsed->warning.empty()) {
+    policy.Warning(parsed->warning);
+  }
+  vector<RenderMesh> meshes = parsed->meshes;
+  for (int i = 0; i < ssize(meshes); ++i) {
+    RenderMesh& mesh_data = meshes[i];
+    const std::optional<tinyobj::material_t>& mat = parsed->materials[i];
+    if (!mat.has_value()) {
+      /* No material was assigned to the faces. We'll apply the fallback
+       logic. */
+      mesh_data.material = MakeMeshFallbackMaterial(
+          properties, obj_path, default_diffuse, policy, mesh_data.uv_state);
+    } else {
+      mesh_data.material = MakeMaterialFromMtl(*mat, obj_path, properties,
+                                               policy, mesh_data.uv_state);
+    }
+  }
   return meshes;
 }
 
@@ -40,6 +40,7 @@ using geometry::internal::DummyRenderEngine;
 using math::RigidTransformd;
 using std::set;
 using std::unordered_map;
+using std::vector;
 using systems::sensors::CameraInfo;
 using systems::sensors::ColorD;
 using systems::sensors::ColorI;
@@ -161,6 +162,25 @@ GTEST_TEST(RenderEngine, RegistrationAndUpdate) {
     EXPECT_TRUE(CompareMatrices(engine.world_pose(id).GetAsMatrix34(),
                                 X_WG_all[id].GetAsMatrix34()));
   }
+
+  {
+    // Case: updating a subset of ids only updates the geometries in the subset
+    // that require updating; the others (anchored, unregistered, or omitted)
+    // are ignored.
+    const GeometryId dynamic_id = (++(X_WG_all.begin()))->first;
+    vector<GeometryId> ids;
+    for (const auto& id_pose_pair : X_WG_all) {
+      if (id_pose_pair.first != dynamic_id) ids.push_back(id_pose_pair.first);
+    }
+    engine.init_test_data();
+    engine.UpdatePoses(X_WG_all, ids);
+    EXPECT_EQ(engine.updated_ids().size(), 0);
+
+    ids.push_back(dynamic_id);
+    engine.UpdatePoses(X_WG_all, ids);
+    EXPECT_EQ(engine.updated_ids().size(), 1);
+    EXPECT_EQ(engine.updated_ids().count(dynamic_id), 1);
+  }
 }
 
 // Tests the removal of geometry from the renderer -- confirms that the
@@ -401,6 +421,62 @@ GTEST_TEST(RenderEngine, UnimplementedRenderErrors) {
       ".*MinimumEngine.* has not implemented DoRenderLabelImage.+");
 }
 
+// Tests the default implementation of rendering a batch of images, which
+// renders each requested image in turn.
+GTEST_TEST(RenderEngine, RenderImages) {
+  DummyRenderEngine engine;
+  const CameraInfo intrinsics{2, 2, M_PI};
+  const CameraInfo big_intrinsics{3, 3, M_PI};
+  const ColorRenderCamera color_camera{
+      {"n/a", intrinsics, {0.1, 10}, RigidTransformd{}}, false};
+  const DepthRenderCamera depth_camera{
+      {"n/a", big_intrinsics, {0.1, 10}, RigidTransformd{}}, {1.0, 5.0}};
+  ImageRgba8U color{2, 2};
+  ImageDepth32F depth{3, 3};
+  ImageLabel16I label{2, 2};
+
+  std::vector<RenderEngine::ImageRequest> requests(2);
+  requests[0].X_WC = RigidTransformd(Vector3d(1, 2, 3));
+  requests[0].color_camera = color_camera;
+  requests[0].color_image = &color;
+  requests[0].label_image = &label;
+  requests[1].X_WC = RigidTransformd(Vector3d(4, 5, 6));
+  requests[1].depth_camera = depth_camera;
+  requests[1].depth_image = &depth;
+  engine.RenderImages(requests);
+  EXPECT_EQ(engine.num_color_renders(), 1);
+  EXPECT_EQ(engine.num_depth_renders(), 1);
+  EXPECT_EQ(engine.num_label_renders(), 1);
+  EXPECT_EQ(engine.last_depth_camera().core().intrinsics().width(), 3);
+  EXPECT_TRUE(CompareMatrices(engine.last_updated_X_WC().translation(),
+                              Vector3d(4, 5, 6)));
+
+  // Invalid requests are rejected before anything is rendered.
+  requests[1].depth_camera.reset();
+  DRAKE_EXPECT_THROWS_MESSAGE(engine.RenderImages(requests),
+                              ".*depth image without a depth camera.*");
+  requests[1].depth_camera = depth_camera;
+  requests[1].color_image = &color;
+  DRAKE_EXPECT_THROWS_MESSAGE(engine.RenderImages(requests),
+                              ".*without a color camera.*");
+  requests[1].color_image = nullptr;
+  requests[0].color_camera = ColorRenderCamera(depth_camera.core(), false);
+  DRAKE_EXPECT_THROWS_MESSAGE(engine.RenderImages(requests),
+                              ".*color image to write has a size.*");
+  EXPECT_EQ(engine.num_color_renders(), 1);
+  EXPECT_EQ(engine.num_depth_renders(), 1);
+  EXPECT_EQ(engine.num_label_renders(), 1);
+
+  // By default, starting to render renders all the images right away.
+  requests[0].color_camera = color_camera;
+  engine.StartRenderImages(requests);
+  EXPECT_EQ(engine.num_color_renders(), 2);
+  EXPECT_EQ(engine.num_depth_renders(), 2);
+  EXPECT_EQ(engine.num_label_renders(), 2);
+  engine.FinishRenderImages();
+  EXPECT_EQ(engine.num_color_renders(), 2);
+}
+
 }  // namespace
 }  // namespace render
 }  // namespace geometry
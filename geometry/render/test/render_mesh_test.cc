@@ -843,6 +843,45 @@ TEST_F(LoadRenderMeshFromObjTest, UvStatePassedToFallback) {
                   ".*'diffuse_map'.* doesn't define a complete set of.*"));
 }
 
+/* Parsed OBJ files are cached, but each load still reports the parser's
+ warnings, applies the given properties to the material, and reflects changes
+ to the file's contents. */
+TEST_F(LoadRenderMeshFromObjTest, CachedParse) {
+  constexpr char kObj[] = R"""(
+        mtllib not_really_a.mtl
+        v 0 0 0
+        v 1 1 1
+        v 2 2 2
+        vn 0 1 0
+        f 1//1 2//1 3//1)""";
+  const fs::path obj_path = WriteFile(kObj, "cached.obj");
+  const vector<RenderMesh> first = LoadRenderMeshesFromObj(
+      obj_path, empty_props(), kDefaultDiffuse, diagnostic_policy_);
+  EXPECT_THAT(TakeWarning(), testing::HasSubstr("not_really_a.mtl"));
+  ASSERT_EQ(first.size(), 1);
+  EXPECT_EQ(first[0].material.diffuse, kDefaultDiffuse);
+
+  PerceptionProperties props;
+  const Rgba diffuse(0.25, 0.5, 0.75);
+  props.AddProperty("phong", "diffuse", diffuse);
+  const vector<RenderMesh> second = LoadRenderMeshesFromObj(
+      obj_path, props, kDefaultDiffuse, diagnostic_policy_);
+  EXPECT_THAT(TakeWarning(), testing::HasSubstr("not_really_a.mtl"));
+  ASSERT_EQ(second.size(), 1);
+  EXPECT_EQ(second[0].positions, first[0].positions);
+  EXPECT_EQ(second[0].indices, first[0].indices);
+  EXPECT_EQ(second[0].material.diffuse, diffuse);
+
+  // Rewriting the file invalidates the cached parse.
+  WriteFile(fmt::format("{}\nv 3 3 3\nf 2//1 3//1 4//1", kObj), "cached.obj");
+  const vector<RenderMesh> third = LoadRenderMeshesFromObj(
+      obj_path, empty_props(), kDefaultDiffuse, diagnostic_policy_);
+  EXPECT_THAT(TakeWarning(), testing::HasSubstr("not_really_a.mtl"));
+  ASSERT_EQ(third.size(), 1);
+  EXPECT_EQ(third[0].positions.rows(), 4);
+  EXPECT_EQ(third[0].indices.rows(), 2);
+}
+
 /* Tests if the `from_mesh_file` flag is correctly propagated. */
 TEST_F(LoadRenderMeshFromObjTest, PropagateFromMeshFileFlag) {
   for (const bool from_mesh_file : {false, true}) {
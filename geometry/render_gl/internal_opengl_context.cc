@@ -2,6 +2,8 @@
 
 #include <algorithm>
 #include <cstring>
+#include <map>
+#include <mutex>
 #include <sstream>
 #include <stdexcept>
 #include <string>
@@ -14,6 +16,7 @@
 
 #include "drake/common/drake_assert.h"
 #include "drake/common/drake_throw.h"
+#include "drake/common/never_destroyed.h"
 #include "drake/common/scope_exit.h"
 #include "drake/common/text_logging.h"
 
@@ -72,29 +75,42 @@ void GlDebugCallback(GLenum, GLenum type, GLuint, GLenum severity, GLsizei,
   }
 }
 
-static Display* display() {
-  // Turn Display into a singleton to make CI happy, since when we close and
+// Returns the X display named `display_name` (see XOpenDisplay()), opening it
+// on first use. An empty name denotes the display named by the DISPLAY
+// environment variable.
+Display* GetDisplay(const std::string& display_name) {
+  // Each Display is a singleton to make CI happy, since when we close and
   // reopen the display on CI, we can't request a new OpenGL context.
   // This pattern won't call the corresponding `XCloseDisplay()` when the
   // program exits, but it seems not so evil to skip that.
   // (https://linux.die.net/man/3/xclosedisplay)
   // If problems crop up in the future, this can/should be investigated.
-  static Display* g_display = []() {
-    XInitThreads();
-    Display* display = XOpenDisplay(0);
-    DRAKE_THROW_UNLESS(display != nullptr);
-    return display;
-  }();
-  return g_display;
+  static never_destroyed<std::mutex> g_mutex;
+  static never_destroyed<std::map<std::string, Display*>> g_displays;
+  std::lock_guard<std::mutex> lock(g_mutex.access());
+  [[maybe_unused]] static const Status g_threads_initialized = XInitThreads();
+  Display*& display = g_displays.access()[display_name];
+  if (display == nullptr) {
+    display = XOpenDisplay(display_name.empty() ? nullptr
+                                                : display_name.c_str());
+    if (display == nullptr) {
+      throw std::runtime_error(fmt::format(
+          "Error initializing OpenGL Context for RenderEngineGL; unable to "
+          "open the X display '{}'.",
+          display_name));
+    }
+  }
+  return display;
 }
 
 }  // namespace
 
 class OpenGlContext::Impl {
  public:
-  // Open an X display and initialize an OpenGL context. The display will be
-  // open and ready for offscreen rendering, but no window is visible.
-  explicit Impl(bool debug, GLXContext source_context = NULL) : debug_(debug) {
+  // Initialize an OpenGL context on the given X display. The display will be
+  // ready for offscreen rendering, but no window is visible.
+  Impl(Display* display, bool debug, GLXContext source_context = NULL)
+      : display_(display), debug_(debug) {
     // See Offscreen Rendering section here:
     // https://sidvind.com/index.php?title=Opengl/windowless
 
@@ -117,7 +133,7 @@ class OpenGlContext::Impl {
                                   True,
                                   None};
     int fb_count = 0;
-    const int screen_id = DefaultScreen(display());
+    const int screen_id = DefaultScreen(display_);
 
     // No matter what, we want to make sure that the context is not current
     // at the conclusion of construction.
@@ -126,7 +142,7 @@ class OpenGlContext::Impl {
     });
 
     GLXFBConfig* fb_configs =
-        glXChooseFBConfig(display(), screen_id, kVisualAttribs, &fb_count);
+        glXChooseFBConfig(display_, screen_id, kVisualAttribs, &fb_count);
     ScopeExit guard([fb_configs]() {
       XFree(fb_configs);
     });
@@ -141,7 +157,7 @@ class OpenGlContext::Impl {
     DRAKE_DEMAND(fb_count > 0);
 
     // Set up window for displaying render results.
-    XVisualInfo* visual = glXGetVisualFromFBConfig(display(), fb_configs[0]);
+    XVisualInfo* visual = glXGetVisualFromFBConfig(display_, fb_configs[0]);
     if (visual == nullptr) {
       throw std::runtime_error(
           "Unable to generate an OpenGl display window; visual info "
@@ -159,22 +175,22 @@ class OpenGlContext::Impl {
 
     // This requires a call to XFreeColormap in the destructor.
     window_attribs.colormap = XCreateColormap(
-        display(), RootWindow(display(), screen_id), visual->visual, AllocNone);
+        display_, RootWindow(display_, screen_id), visual->visual, AllocNone);
     ScopeExit colormap_guard(
-        [colormap = window_attribs.colormap, &is_complete]() {
-          if (!is_complete) XFreeColormap(display(), colormap);
+        [this, colormap = window_attribs.colormap, &is_complete]() {
+          if (!is_complete) XFreeColormap(display_, colormap);
         });
 
     // Enable just the Expose event so we know when the window is ready to be
     // redrawn.
     window_attribs.event_mask = ExposureMask;
     // This requires a call to XDestroyWindow in the destructor.
-    window_ = XCreateWindow(display(), RootWindow(display(), screen_id), 0, 0,
+    window_ = XCreateWindow(display_, RootWindow(display_, screen_id), 0, 0,
                             window_width_, window_height_, 0, visual->depth,
                             InputOutput, visual->visual,
                             CWColormap | CWEventMask, &window_attribs);
-    ScopeExit window_guard([window = window_, &is_complete]() {
-      if (!is_complete) XDestroyWindow(display(), window);
+    ScopeExit window_guard([this, window = window_, &is_complete]() {
+      if (!is_complete) XDestroyWindow(display_, window);
     });
 
     // Create an OpenGL context.
@@ -184,17 +200,17 @@ class OpenGlContext::Impl {
     // ultimately from X11/Xlib.h.
     // This requires a call to glXDestroyContext in the destructor.
     context_ = glXCreateContextAttribsARB(
-        display(), fb_configs[0], source_context, True, kContextAttribs);
+        display_, fb_configs[0], source_context, True, kContextAttribs);
     if (context_ == nullptr) {
       throw std::runtime_error(
           "Error initializing OpenGL Context for RenderEngineGL; failed to "
           "create context via glXCreateContextAttribsARB.");
     }
-    ScopeExit context_guard([context = context_, &is_complete]() {
-      if (!is_complete) glXDestroyContext(display(), context);
+    ScopeExit context_guard([this, context = context_, &is_complete]() {
+      if (!is_complete) glXDestroyContext(display_, context);
     });
 
-    XSync(display(), False);
+    XSync(display_, False);
 
     // Enable debug.
     if (debug) {
@@ -208,20 +224,21 @@ class OpenGlContext::Impl {
   }
 
   // Constructs a copy which shares the OpenGl objects stored on the GPU with
-  // `other`.
-  Impl(const Impl& other) : Impl(other.debug_, other.context_) {}
+  // `other`. Sharing requires that the copy be on the same display.
+  Impl(const Impl& other)
+      : Impl(other.display_, other.debug_, other.context_) {}
 
   ~Impl() {
-    glXDestroyContext(display(), context_);
+    glXDestroyContext(display_, context_);
     XWindowAttributes window_attribs;
-    XGetWindowAttributes(display(), window_, &window_attribs);
-    XFreeColormap(display(), window_attribs.colormap);
-    XDestroyWindow(display(), window_);
+    XGetWindowAttributes(display_, window_, &window_attribs);
+    XFreeColormap(display_, window_attribs.colormap);
+    XDestroyWindow(display_, window_);
   }
 
   void MakeCurrent() const {
     if (glXGetCurrentContext() != context_ &&
-        !glXMakeCurrent(display(), window_, context_)) {
+        !glXMakeCurrent(display_, window_, context_)) {
       throw std::runtime_error("Error making an OpenGL context current");
     }
   }
@@ -230,13 +247,13 @@ class OpenGlContext::Impl {
 
   void DisplayWindow(const int width, const int height) {
     if (width != window_width_ || height != window_height_) {
-      XResizeWindow(display(), window_, width, height);
+      XResizeWindow(display_, window_, width, height);
       WaitForExposeEvent();
       window_width_ = width;
       window_height_ = height;
     }
     if (!IsWindowViewable()) {
-      XMapRaised(display(), window_);
+      XMapRaised(display_, window_);
       WaitForExposeEvent();
     }
     // We wait for confirmation events to make sure we don't attempt to draw
@@ -248,14 +265,14 @@ class OpenGlContext::Impl {
 
   void HideWindow() {
     if (IsWindowViewable()) {
-      XUnmapWindow(display(), window_);
+      XUnmapWindow(display_, window_);
       // Unmapping a window provides no events on that window.
     }
   }
 
   bool IsWindowViewable() const {
     XWindowAttributes attr;
-    const Status status = XGetWindowAttributes(display(), window_, &attr);
+    const Status status = XGetWindowAttributes(display_, window_, &attr);
 
     // In xlib, a zero status implies function failure.
     // https://tronche.com/gui/x/xlib/introduction/errors.html#Status
@@ -268,15 +285,15 @@ class OpenGlContext::Impl {
   }
 
   void UpdateWindow() {
-    XClearWindow(display(), window_);
-    glXSwapBuffers(display(), window_);
+    XClearWindow(display_, window_);
+    glXSwapBuffers(display_, window_);
   }
 
-  // Waits for the display() to transmit an Expose event.
+  // Waits for the display to transmit an Expose event.
   void WaitForExposeEvent() const {
     XEvent event;
     // This blocks until the window gets an "Expose" event.
-    XWindowEvent(display(), window_, ExposureMask, &event);
+    XWindowEvent(display_, window_, ExposureMask, &event);
     DRAKE_DEMAND(event.type == Expose);
   }
 
@@ -298,6 +315,9 @@ class OpenGlContext::Impl {
   }
 
  private:
+  // The display is shared by all contexts opened on it, and never closed.
+  Display* const display_;
+
   GLXContext context_{nullptr};
 
   // The associated window to support display of rendering results.
@@ -313,8 +333,8 @@ class OpenGlContext::Impl {
   const bool debug_{};
 };
 
-OpenGlContext::OpenGlContext(bool debug)
-    : impl_(new OpenGlContext::Impl(debug)) {}
+OpenGlContext::OpenGlContext(bool debug, const std::string& display_name)
+    : impl_(new OpenGlContext::Impl(GetDisplay(display_name), debug)) {}
 
 OpenGlContext::OpenGlContext(const OpenGlContext& other)
     : impl_(std::make_unique<OpenGlContext::Impl>(*other.impl_)) {}
@@ -326,7 +346,12 @@ void OpenGlContext::MakeCurrent() const {
 }
 
 void OpenGlContext::ClearCurrent() {
-  glXMakeCurrent(display(), None, NULL);
+  // Contexts may live on different displays; we release the current context
+  // on whichever display it belongs to.
+  Display* current_display = glXGetCurrentDisplay();
+  if (current_display != nullptr) {
+    glXMakeCurrent(current_display, None, NULL);
+  }
 }
 
 bool OpenGlContext::IsCurrent() const {
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <string>
 
 #include "drake/geometry/render_gl/internal_opengl_includes.h"
 
@@ -21,12 +22,17 @@ class OpenGlContext {
    @param debug  If debug is true, the OpenGl context will be a "debug" context,
    in that the OpenGl implementation's errors will be written to the Drake log.
    See https://www.khronos.org/opengl/wiki/Debug_Output for more information.
-   */
-  explicit OpenGlContext(bool debug = false);
+   @param display_name  The X display on which to create the context, as
+   accepted by XOpenDisplay() (e.g., ":1" or ":0.1"). An empty name denotes the
+   display named by the DISPLAY environment variable.
+   @throws std::exception if the display cannot be opened. */
+  explicit OpenGlContext(bool debug = false,
+                         const std::string& display_name = {});
 
   /* Copy constructs a context that shares OpenGl objects with `other`.
 
-   - All %OpenGlContext instances share a common display.
+   - The copy uses the same display as `other`. All %OpenGlContext instances
+     created on a given display share it.
    - Each instance has a unique window/OpenGL objects for connecting an OpenGl
      context to an X-windows display.
    - Copying an %OpenGlContext is distinct from creating a new instance in that
@@ -1,6 +1,7 @@
 #include "drake/geometry/render_gl/internal_render_engine_gl.h"
 
 #include <algorithm>
+#include <cstring>
 #include <filesystem>
 #include <optional>
 #include <unordered_set>
@@ -698,7 +699,8 @@ RenderEngineGlParams CleanupLights(RenderEngineGlParams params) {
 
 RenderEngineGl::RenderEngineGl(RenderEngineGlParams params)
     : RenderEngine(params.default_label),
-      opengl_context_(make_unique<OpenGlContext>()),
+      opengl_context_(make_unique<OpenGlContext>(/* debug = */ false,
+                                                 params.display_name)),
       texture_library_(make_shared<TextureLibrary>()),
       parameters_(CleanupLights(std::move(params))) {
   if (params.default_label != RenderLabel::kDontCare) {
@@ -749,6 +751,18 @@ RenderEngineGl::~RenderEngineGl() {
 
   opengl_context_->MakeCurrent();
 
+  // Delete the pixel buffers used for reading images back. Any images still
+  // in flight are abandoned.
+  if (pending_fence_ != nullptr) {
+    glDeleteSync(pending_fence_);
+  }
+  for (const PendingImage& image : pending_images_) {
+    glDeleteBuffers(1, &image.pixel_buffer);
+  }
+  for (const auto& [_, buffers] : free_pixel_buffers_) {
+    glDeleteBuffers(buffers.size(), buffers.data());
+  }
+
   // Delete vertex array objects.
   for (auto& geometry : geometries_) {
     glDeleteVertexArrays(1, &geometry.vertex_array);
@@ -925,6 +939,10 @@ unique_ptr<RenderEngine> RenderEngineGl::DoClone() const {
   // The clone still requires some last-minute patching before it can work
   // correctly.
   auto clone = unique_ptr<RenderEngineGl>(new RenderEngineGl(*this));
+  // The pixel buffers (and any images in flight) belong to this engine only.
+  clone->pending_images_.clear();
+  clone->pending_fence_ = nullptr;
+  clone->free_pixel_buffers_.clear();
 
   ScopeExit unbind([]() {
     OpenGlContext::ClearCurrent();
@@ -961,28 +979,47 @@ void RenderEngineGl::RenderAt(const ShaderProgram& shader_program,
   // may be called multiple times per image (based on the number of shaders
   // being used) and, therefore, can't do the clearing itself.
 
+  std::vector<const OpenGlInstance*> instances;
   for (const GeometryId& g_id :
        shader_families_.at(render_type).at(shader_program.shader_id())) {
     for (const auto& part : visuals_.at(g_id).parts) {
       const OpenGlInstance& instance = part.instance;
-      if (instance.shader_data.at(render_type).shader_id() !=
+      if (instance.shader_data.at(render_type).shader_id() ==
           shader_program.shader_id()) {
-        continue;
+        instances.push_back(&instance);
       }
-      const OpenGlGeometry& geometry = geometries_[instance.geometry];
+    }
+  }
+  // Scenes often contain many copies of the same geometry (e.g., a bin of
+  // identical parts). Drawing the instances of each geometry consecutively
+  // lets us bind its vertex array once per geometry instead of once per
+  // instance. Color images blend transparent geometries in draw order, so we
+  // only reorder the draws for the depth and label images, which don't blend.
+  if (render_type != RenderType::kColor) {
+    std::stable_sort(instances.begin(), instances.end(),
+                     [](const OpenGlInstance* a, const OpenGlInstance* b) {
+                       return a->geometry < b->geometry;
+                     });
+  }
+
+  int bound_geometry = -1;
+  for (const OpenGlInstance* instance : instances) {
+    const OpenGlGeometry& geometry = geometries_[instance->geometry];
+    if (instance->geometry != bound_geometry) {
       glBindVertexArray(geometry.vertex_array);
+      bound_geometry = instance->geometry;
+    }
 
-      shader_program.SetInstanceParameters(instance.shader_data[render_type]);
-      // TODO(SeanCurtis-TRI): Consider storing the float-valued pose in the
-      //  OpenGl instance to avoid the conversion every time it is rendered.
-      //  Generally, this wouldn't expect much savings; an instance is only
-      //  rendered once per image type. So, for three image types, I'd cast
-      //  three times. Stored, I'd cast once.
-      shader_program.SetModelViewMatrix(X_CW, instance.X_WG, instance.scale);
+    shader_program.SetInstanceParameters(instance->shader_data[render_type]);
+    // TODO(SeanCurtis-TRI): Consider storing the float-valued pose in the
+    //  OpenGl instance to avoid the conversion every time it is rendered.
+    //  Generally, this wouldn't expect much savings; an instance is only
+    //  rendered once per image type. So, for three image types, I'd cast
+    //  three times. Stored, I'd cast once.
+    shader_program.SetModelViewMatrix(X_CW, instance->X_WG, instance->scale);
 
-      glDrawElements(GL_TRIANGLES, geometry.index_buffer_size, GL_UNSIGNED_INT,
-                     0);
-    }
+    glDrawElements(GL_TRIANGLES, geometry.index_buffer_size, GL_UNSIGNED_INT,
+                   0);
   }
   // Unbind the vertex array back to the default of 0.
   glBindVertexArray(0);
@@ -991,6 +1028,124 @@ void RenderEngineGl::RenderAt(const ShaderProgram& shader_program,
 void RenderEngineGl::DoRenderColorImage(const ColorRenderCamera& camera,
                                         ImageRgba8U* color_image_out) const {
   opengl_context_->MakeCurrent();
+  const RenderTarget render_target = DrawColorImage(camera);
+  glGetTextureImage(render_target.value_texture, 0, GL_RGBA, GL_UNSIGNED_BYTE,
+                    color_image_out->size(), color_image_out->at(0, 0));
+}
+
+void RenderEngineGl::DoRenderDepthImage(const DepthRenderCamera& camera,
+                                        ImageDepth32F* depth_image_out) const {
+  opengl_context_->MakeCurrent();
+  const RenderTarget render_target = DrawDepthImage(camera);
+  glGetTextureImage(render_target.value_texture, 0, GL_RED, GL_FLOAT,
+                    depth_image_out->size() * sizeof(GLfloat),
+                    depth_image_out->at(0, 0));
+}
+
+void RenderEngineGl::DoRenderLabelImage(const ColorRenderCamera& camera,
+                                        ImageLabel16I* label_image_out) const {
+  opengl_context_->MakeCurrent();
+  const RenderTarget render_target = DrawLabelImage(camera);
+  GetLabelImage(label_image_out, render_target);
+}
+
+void RenderEngineGl::DoRenderImages(const vector<ImageRequest>& requests) {
+  DoStartRenderImages(requests);
+  DoFinishRenderImages();
+}
+
+void RenderEngineGl::DoStartRenderImages(const vector<ImageRequest>& requests) {
+  DRAKE_DEMAND(pending_images_.empty());
+  opengl_context_->MakeCurrent();
+
+  // Each image is copied from its render target into a pixel buffer object
+  // right after it is drawn. Those copies are asynchronous: the GPU keeps
+  // drawing the following images (possibly into the same render targets, which
+  // is safe because OpenGL orders the copy before the later draws) while the
+  // earlier images are transferred, and we only wait for the GPU in
+  // DoFinishRenderImages(), when the pixel buffers are mapped.
+  auto copy_to_pixel_buffer = [this](const RenderTarget& target, int size,
+                                     GLenum format, GLenum pixel_type) {
+    PendingImage& image = pending_images_.emplace_back();
+    image.size = size;
+    std::vector<GLuint>& free_buffers = free_pixel_buffers_[size];
+    if (free_buffers.empty()) {
+      glCreateBuffers(1, &image.pixel_buffer);
+      glNamedBufferData(image.pixel_buffer, size, nullptr, GL_STREAM_READ);
+    } else {
+      image.pixel_buffer = free_buffers.back();
+      free_buffers.pop_back();
+    }
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, image.pixel_buffer);
+    // With a pixel pack buffer bound, the last argument is an offset into
+    // that buffer.
+    glGetTextureImage(target.value_texture, 0, format, pixel_type, size,
+                      nullptr);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    return &image;
+  };
+
+  for (const ImageRequest& request : requests) {
+    X_CW_ = request.X_WC.inverse();
+    if (request.color_image != nullptr) {
+      copy_to_pixel_buffer(DrawColorImage(*request.color_camera),
+                           request.color_image->size() * sizeof(GLubyte),
+                           GL_RGBA, GL_UNSIGNED_BYTE)
+          ->color_image = request.color_image;
+    }
+    if (request.depth_image != nullptr) {
+      copy_to_pixel_buffer(DrawDepthImage(*request.depth_camera),
+                           request.depth_image->size() * sizeof(GLfloat),
+                           GL_RED, GL_FLOAT)
+          ->depth_image = request.depth_image;
+    }
+    if (request.label_image != nullptr) {
+      // Labels are rendered as RGBA colors; see GetLabelImage().
+      copy_to_pixel_buffer(DrawLabelImage(*request.color_camera),
+                           request.label_image->size() * 4 * sizeof(GLubyte),
+                           GL_RGBA, GL_UNSIGNED_BYTE)
+          ->label_image = request.label_image;
+    }
+  }
+  if (!pending_images_.empty()) {
+    pending_fence_ = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    // Make sure that the commands are submitted to the GPU now, rather than
+    // when DoFinishRenderImages() waits for them.
+    glFlush();
+  }
+}
+
+void RenderEngineGl::DoFinishRenderImages() {
+  if (pending_images_.empty()) {
+    return;
+  }
+  opengl_context_->MakeCurrent();
+  // Wait (without any time limit) for all the pending copies to complete.
+  glClientWaitSync(pending_fence_, GL_SYNC_FLUSH_COMMANDS_BIT,
+                   GL_TIMEOUT_IGNORED);
+  glDeleteSync(pending_fence_);
+  pending_fence_ = nullptr;
+
+  for (const PendingImage& image : pending_images_) {
+    const void* data = glMapNamedBuffer(image.pixel_buffer, GL_READ_ONLY);
+    DRAKE_DEMAND(data != nullptr);
+    if (image.color_image != nullptr) {
+      std::memcpy(image.color_image->at(0, 0), data, image.size);
+    } else if (image.depth_image != nullptr) {
+      std::memcpy(image.depth_image->at(0, 0), data, image.size);
+    } else {
+      DRAKE_DEMAND(image.label_image != nullptr);
+      ConvertLabelImage(static_cast<const GLubyte*>(data), image.label_image);
+    }
+    glUnmapNamedBuffer(image.pixel_buffer);
+    // Keep the pixel buffer for the following batches.
+    free_pixel_buffers_[image.size].push_back(image.pixel_buffer);
+  }
+  pending_images_.clear();
+}
+
+RenderTarget RenderEngineGl::DrawColorImage(
+    const ColorRenderCamera& camera) const {
   // TODO(SeanCurtis-TRI): For transparency to work properly, I need to
   //  segregate objects with transparency from those without. The transparent
   //  geometries then need to be sorted from farthest to nearest the camera and
@@ -1026,14 +1181,11 @@ void RenderEngineGl::DoRenderColorImage(const ColorRenderCamera& camera,
   // the front buffer; reversing the order means the image we've just rendered
   // wouldn't be visible.
   SetWindowVisibility(camera.core(), camera.show_window(), render_target);
-  glGetTextureImage(render_target.value_texture, 0, GL_RGBA, GL_UNSIGNED_BYTE,
-                    color_image_out->size(), color_image_out->at(0, 0));
+  return render_target;
 }
 
-void RenderEngineGl::DoRenderDepthImage(const DepthRenderCamera& camera,
-                                        ImageDepth32F* depth_image_out) const {
-  opengl_context_->MakeCurrent();
-
+RenderTarget RenderEngineGl::DrawDepthImage(
+    const DepthRenderCamera& camera) const {
   const RenderTarget render_target =
       GetRenderTarget(camera.core(), RenderType::kDepth);
 
@@ -1059,16 +1211,11 @@ void RenderEngineGl::DoRenderDepthImage(const DepthRenderCamera& camera,
 
     shader_program.Unuse();
   }
-
-  glGetTextureImage(render_target.value_texture, 0, GL_RED, GL_FLOAT,
-                    depth_image_out->size() * sizeof(GLfloat),
-                    depth_image_out->at(0, 0));
+  return render_target;
 }
 
-void RenderEngineGl::DoRenderLabelImage(const ColorRenderCamera& camera,
-                                        ImageLabel16I* label_image_out) const {
-  opengl_context_->MakeCurrent();
-
+RenderTarget RenderEngineGl::DrawLabelImage(
+    const ColorRenderCamera& camera) const {
   const RenderTarget render_target =
       GetRenderTarget(camera.core(), RenderType::kLabel);
   // TODO(SeanCurtis-TRI) Consider converting Rgba to float[4] as a member.
@@ -1101,11 +1248,7 @@ void RenderEngineGl::DoRenderLabelImage(const ColorRenderCamera& camera,
   // the front buffer; reversing the order means the image we've just rendered
   // wouldn't be visible.
   SetWindowVisibility(camera.core(), camera.show_window(), render_target);
-  // TODO(SeanCurtis-TRI): Apparently, we *should* be able to create a frame
-  // buffer texture consisting of a single-channel, 16-bit, signed int (to match
-  // the underlying RenderLabel value). Doing so would allow us to render labels
-  // directly and eliminate this additional pass.
-  GetLabelImage(label_image_out, render_target);
+  return render_target;
 }
 
 void RenderEngineGl::AddGeometryInstance(int geometry_index, void* user_data,
@@ -1316,15 +1459,26 @@ RenderTarget RenderEngineGl::CreateRenderTarget(const RenderCameraCore& camera,
 
 void RenderEngineGl::GetLabelImage(ImageLabel16I* label_image_out,
                                    const RenderTarget& target) const {
+  // TODO(SeanCurtis-TRI): Apparently, we *should* be able to create a frame
+  // buffer texture consisting of a single-channel, 16-bit, signed int (to match
+  // the underlying RenderLabel value). Doing so would allow us to render labels
+  // directly and eliminate this additional pass.
   ImageRgba8U image(label_image_out->width(), label_image_out->height());
   glGetTextureImage(target.value_texture, 0, GL_RGBA, GL_UNSIGNED_BYTE,
                     image.size() * sizeof(GLubyte), image.at(0, 0));
+  ConvertLabelImage(image.at(0, 0), label_image_out);
+}
+
+void RenderEngineGl::ConvertLabelImage(const GLubyte* rgba,
+                                       ImageLabel16I* label_image_out) const {
   ColorI color;
-  for (int y = 0; y < image.height(); ++y) {
-    for (int x = 0; x < image.width(); ++x) {
-      color.r = image.at(x, y)[0];
-      color.g = image.at(x, y)[1];
-      color.b = image.at(x, y)[2];
+  const int width = label_image_out->width();
+  for (int y = 0; y < label_image_out->height(); ++y) {
+    for (int x = 0; x < width; ++x) {
+      const GLubyte* pixel = rgba + 4 * (y * width + x);
+      color.r = pixel[0];
+      color.g = pixel[1];
+      color.b = pixel[2];
       *label_image_out->at(x, y) = RenderEngine::LabelFromColor(color);
     }
   }
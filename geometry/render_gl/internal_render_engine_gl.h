@@ -180,6 +180,26 @@ class RenderEngineGl final : public render::RenderEngine {
       const render::ColorRenderCamera& camera,
       systems::sensors::ImageLabel16I* label_image_out) const final;
 
+  // @see RenderEngine::DoRenderImages(). All images are drawn before any of
+  // them is read back from the GPU.
+  void DoRenderImages(const std::vector<ImageRequest>& requests) final;
+
+  // @see RenderEngine::DoStartRenderImages(). The images are drawn, and their
+  // asynchronous copies into pixel buffer objects are queued, followed by a
+  // fence.
+  void DoStartRenderImages(const std::vector<ImageRequest>& requests) final;
+
+  // @see RenderEngine::DoFinishRenderImages(). Waits for the fence, and then
+  // copies the pixel buffers into the images.
+  void DoFinishRenderImages() final;
+
+  // Draws the color, depth, or label image for the given camera from the
+  // current viewpoint into the render target for that camera, and returns the
+  // render target. The OpenGL context must already be current.
+  RenderTarget DrawColorImage(const render::ColorRenderCamera& camera) const;
+  RenderTarget DrawDepthImage(const render::DepthRenderCamera& camera) const;
+  RenderTarget DrawLabelImage(const render::ColorRenderCamera& camera) const;
+
   // Copy constructor used for cloning.
   // Do *not* call this copy constructor directly. The resulting RenderEngineGl
   // is not complete -- it will render nothing except the background color.
@@ -247,6 +267,12 @@ class RenderEngineGl final : public render::RenderEngine {
   void GetLabelImage(drake::systems::sensors::ImageLabel16I* label_image_out,
                      const RenderTarget& target) const;
 
+  // Converts the label image rendered as RGBA colors, given as the row-major
+  // array of its pixels' (r, g, b, a) values, to the label image.
+  void ConvertLabelImage(
+      const GLubyte* rgba,
+      drake::systems::sensors::ImageLabel16I* label_image_out) const;
+
   // Acquires the render target for the given camera. "Acquiring" the render
   // target guarantees that the target will be ready for receiving OpenGL
   // draw commands.
@@ -310,6 +336,26 @@ class RenderEngineGl final : public render::RenderEngine {
   // The cached value transformation between camera and world frames.
   math::RigidTransformd X_CW_;
 
+  // An image being read back into a pixel buffer object by
+  // DoStartRenderImages(). Exactly one of the images is non-null.
+  struct PendingImage {
+    GLuint pixel_buffer{};
+    // The size of the pixel buffer, in bytes.
+    int size{};
+    systems::sensors::ImageRgba8U* color_image{};
+    systems::sensors::ImageDepth32F* depth_image{};
+    systems::sensors::ImageLabel16I* label_image{};
+  };
+
+  // The images whose readback was started by DoStartRenderImages() and not
+  // yet finished, and the fence that signals the end of their readback.
+  std::vector<PendingImage> pending_images_;
+  GLsync pending_fence_{};
+
+  // The pixel buffer objects that are no longer in use, keyed by their size in
+  // bytes, so that they can be reused for the following batches of images.
+  std::unordered_map<int, std::vector<GLuint>> free_pixel_buffers_;
+
   // When the OpenGlContext gets copied, the copy shares the OpenGl objects
   // created in GPU memory.
   copyable_unique_ptr<OpenGlContext> opengl_context_;
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <string>
 #include <vector>
 
 #include "drake/common/name_value.h"
@@ -19,6 +20,7 @@ struct RenderEngineGlParams {
     a->Visit(DRAKE_NVP(default_diffuse));
     a->Visit(DRAKE_NVP(default_clear_color));
     a->Visit(DRAKE_NVP(lights));
+    a->Visit(DRAKE_NVP(display_name));
   }
 
   /** (Deprecated.) The default_label is no longer configurable. <br>
@@ -35,6 +37,18 @@ struct RenderEngineGlParams {
   /** Lights in the scene. More than five lights is an error. If no lights are
    defined, a single directional light, fixed to the camera frame, is used. */
   std::vector<render::LightParameter> lights;
+
+  /** The X display on which the engine creates its OpenGL context, in the form
+   accepted by `XOpenDisplay()` (e.g., ":1" or ":0.1"). The empty default
+   uses the display named by the `DISPLAY` environment variable.
+
+   On a machine with several GPUs, each GPU is typically driven by its own X
+   screen (or X server). Engines constructed with different displays render on
+   different GPUs and can render concurrently, so rendering throughput scales
+   with the number of GPUs. A clone of an engine shares the OpenGL objects of
+   the original engine and so always renders on the original engine's display;
+   to spread work across GPUs, construct one engine per display. */
+  std::string display_name;
 };
 
 }  // namespace geometry
@@ -1,9 +1,13 @@
 #include "drake/geometry/render_gl/internal_opengl_context.h"
 
+#include <cstdlib>
 #include <memory>
+#include <string>
 
 #include <gtest/gtest.h>
 
+#include "drake/common/test_utilities/expect_throws_message.h"
+
 namespace drake {
 namespace geometry {
 namespace render_gl {
@@ -142,6 +146,24 @@ GTEST_TEST(OpenGlContextTest, CloneSurvivesSourceDeath) {
   ASSERT_TRUE(glIsFramebuffer(buffer));
 }
 
+// Contexts can be created on an explicitly named display; a clone uses the
+// display of its source.
+GTEST_TEST(OpenGlContextTest, DisplaySelection) {
+  const char* display_name = std::getenv("DISPLAY");
+  ASSERT_NE(display_name, nullptr);
+  const OpenGlContext source(false, display_name);
+  const OpenGlContext clone(source);
+  source.MakeCurrent();
+  EXPECT_TRUE(source.IsCurrent());
+  clone.MakeCurrent();
+  EXPECT_TRUE(clone.IsCurrent());
+  OpenGlContext::ClearCurrent();
+  EXPECT_FALSE(clone.IsCurrent());
+
+  DRAKE_EXPECT_THROWS_MESSAGE(OpenGlContext(false, ":9876"),
+                              ".*unable to open the X display ':9876'.*");
+}
+
 }  // namespace
 }  // namespace internal
 }  // namespace render_gl
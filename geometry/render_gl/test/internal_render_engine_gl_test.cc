@@ -3,6 +3,7 @@
 #include <array>
 #include <cstring>
 #include <optional>
+#include <set>
 #include <unordered_map>
 
 #include <gflags/gflags.h>
@@ -1472,6 +1473,101 @@ TEST_F(RenderEngineGlTest, DifferentCameras) {
   }
 }
 
+// Tests that rendering a batch of images of several cameras, synchronously or
+// asynchronously, produces the same images as rendering each image on its own.
+TEST_F(RenderEngineGlTest, RenderImages) {
+  Init(X_WR_, true);
+  PopulateSphereTest(renderer_.get());
+
+  const DepthRenderCamera& depth_camera = depth_camera_;
+  const ColorRenderCamera color_camera(depth_camera.core(), FLAGS_show_window);
+  const int w = depth_camera.core().intrinsics().width();
+  const int h = depth_camera.core().intrinsics().height();
+  // A smaller camera, which uses different render targets.
+  const DepthRenderCamera small_depth_camera{
+      {depth_camera.core().renderer_name(),
+       {w / 2, h / 2, depth_camera.core().intrinsics().fov_y()},
+       depth_camera.core().clipping(),
+       depth_camera.core().sensor_pose_in_camera_body()},
+      depth_camera.depth_range()};
+  const ColorRenderCamera small_color_camera(small_depth_camera.core(),
+                                             FLAGS_show_window);
+  const RigidTransformd X_WR2 =
+      RigidTransformd(Vector3d(0.1, -0.05, 0.2)) * X_WR_;
+
+  struct Images {
+    ImageRgba8U color;
+    ImageDepth32F depth;
+    ImageLabel16I label;
+  };
+  std::vector<Images> expected{{{w, h}, {w, h}, {w, h}},
+                               {{w / 2, h / 2}, {w / 2, h / 2}, {w / 2, h / 2}},
+                               {{w, h}, {w, h}, {w, h}}};
+  std::vector<Images> batched = expected;
+  std::vector<RenderEngine::ImageRequest> requests(3);
+  requests[0].X_WC = X_WR_;
+  requests[1].X_WC = X_WR2;
+  requests[2].X_WC = X_WR2;
+  requests[0].color_camera = color_camera;
+  requests[1].color_camera = small_color_camera;
+  requests[2].color_camera = color_camera;
+  requests[0].depth_camera = depth_camera;
+  requests[1].depth_camera = small_depth_camera;
+  requests[2].depth_camera = depth_camera;
+  for (int i = 0; i < 3; ++i) {
+    renderer_->UpdateViewpoint(requests[i].X_WC);
+    renderer_->RenderColorImage(*requests[i].color_camera, &expected[i].color);
+    renderer_->RenderDepthImage(*requests[i].depth_camera, &expected[i].depth);
+    renderer_->RenderLabelImage(*requests[i].color_camera, &expected[i].label);
+    requests[i].color_image = &batched[i].color;
+    requests[i].depth_image = &batched[i].depth;
+    requests[i].label_image = &batched[i].label;
+  }
+  // The last request only renders the depth image.
+  requests[2].color_image = nullptr;
+  requests[2].label_image = nullptr;
+
+  renderer_->RenderImages(requests);
+  for (int i = 0; i < 3; ++i) {
+    SCOPED_TRACE(fmt::format("Request {}", i));
+    if (i < 2) {
+      EXPECT_EQ(batched[i].color, expected[i].color);
+      EXPECT_EQ(batched[i].label, expected[i].label);
+    }
+    EXPECT_EQ(batched[i].depth, expected[i].depth);
+  }
+  // The first two poses see different images.
+  EXPECT_FALSE(expected[0].depth == expected[2].depth);
+
+  // Rendering asynchronously produces the same images, once finished. Finishing
+  // twice is harmless.
+  std::vector<Images> started = expected;
+  for (int i = 0; i < 3; ++i) {
+    started[i].color.at(0, 0)[0] = 0;
+    started[i].depth.at(0, 0)[0] = 0;
+    requests[i].color_image = i < 2 ? &started[i].color : nullptr;
+    requests[i].depth_image = &started[i].depth;
+    requests[i].label_image = i < 2 ? &started[i].label : nullptr;
+  }
+  renderer_->StartRenderImages(requests);
+  renderer_->FinishRenderImages();
+  renderer_->FinishRenderImages();
+  for (int i = 0; i < 3; ++i) {
+    SCOPED_TRACE(fmt::format("Started request {}", i));
+    if (i < 2) {
+      EXPECT_EQ(started[i].color, expected[i].color);
+      EXPECT_EQ(started[i].label, expected[i].label);
+    }
+    EXPECT_EQ(started[i].depth, expected[i].depth);
+  }
+
+  // Starting another batch finishes the one in flight.
+  renderer_->StartRenderImages(requests);
+  renderer_->StartRenderImages(requests);
+  renderer_->FinishRenderImages();
+  EXPECT_EQ(started[0].color, expected[0].color);
+}
+
 // Tests that registered geometry without any explicitly set perception
 // properties renders without error.
 // TODO(SeanCurtis-TRI): When RenderEngineGl supports label and color images,
@@ -1681,6 +1777,45 @@ TEST_F(RenderEngineGlTest, MeshGeometryReuse) {
             second_geometry.index_buffer_size);
 }
 
+// Many instances of the same geometries, registered in interleaved order, are
+// all drawn with their own poses and labels (the engine groups the draws by
+// geometry).
+TEST_F(RenderEngineGlTest, RepeatedGeometry) {
+  Init(X_WR_, true);
+  std::set<int> expected_labels;
+  unordered_map<GeometryId, RigidTransformd> X_WV;
+  for (int i = 0; i < 10; ++i) {
+    const GeometryId id = GeometryId::get_new_id();
+    const RenderLabel label(100 + i);
+    PerceptionProperties material;
+    material.AddProperty("label", "id", label);
+    material.AddProperty("phong", "diffuse", kDefaultVisualColor);
+    // Alternate between boxes and spheres, in a 2x5 grid on the ground.
+    if (i % 2 == 0) {
+      renderer_->RegisterVisual(id, Box::MakeCube(0.2), material,
+                                RigidTransformd::Identity(), true);
+    } else {
+      renderer_->RegisterVisual(id, Sphere(0.1), material,
+                                RigidTransformd::Identity(), true);
+    }
+    X_WV.insert({id, RigidTransformd{Vector3d{-0.8 + 0.4 * (i / 2),
+                                              -0.2 + 0.4 * (i % 2), 0.1}}});
+    expected_labels.insert(100 + i);
+  }
+  renderer_->UpdatePoses(X_WV);
+
+  renderer_->RenderLabelImage(
+      ColorRenderCamera{depth_camera_.core(), FLAGS_show_window}, &label_);
+  std::set<int> labels;
+  for (int y = 0; y < kHeight; ++y) {
+    for (int x = 0; x < kWidth; ++x) {
+      const int value = label_.at(x, y)[0];
+      if (value >= 100) labels.insert(value);
+    }
+  }
+  EXPECT_EQ(labels, expected_labels);
+}
+
 // Confirm the properties of the fallback camera using the following
 // methodology:
 //
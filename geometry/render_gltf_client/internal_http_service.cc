@@ -5,6 +5,8 @@
 
 #include <fmt/format.h>
 
+#include "drake/common/drake_assert.h"
+
 namespace drake {
 namespace geometry {
 namespace render_gltf_client {
@@ -38,6 +40,30 @@ HttpResponse HttpService::PostForm(const std::string& temp_directory,
   return DoPostForm(temp_directory, url, data_fields, file_fields, verbose);
 }
 
+std::vector<HttpResponse> HttpService::PostForms(
+    const std::string& temp_directory, const std::string& url,
+    const std::vector<HttpForm>& forms, bool verbose) {
+  for (const HttpForm& form : forms) {
+    ThrowIfFilesMissing(form.file_fields);
+  }
+  std::vector<HttpResponse> responses =
+      DoPostForms(temp_directory, url, forms, verbose);
+  DRAKE_DEMAND(responses.size() == forms.size());
+  return responses;
+}
+
+std::vector<HttpResponse> HttpService::DoPostForms(
+    const std::string& temp_directory, const std::string& url,
+    const std::vector<HttpForm>& forms, bool verbose) {
+  std::vector<HttpResponse> responses;
+  responses.reserve(forms.size());
+  for (const HttpForm& form : forms) {
+    responses.push_back(DoPostForm(temp_directory, url, form.data_fields,
+                                   form.file_fields, verbose));
+  }
+  return responses;
+}
+
 }  // namespace internal
 }  // namespace render_gltf_client
 }  // namespace geometry
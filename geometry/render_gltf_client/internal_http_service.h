@@ -4,6 +4,7 @@
 #include <optional>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "drake/common/drake_copyable.h"
 
@@ -18,6 +19,12 @@ using FileFieldPayload = std::pair<std::string, std::optional<std::string>>;
 using FileFieldsMap =
     std::map<std::string, std::pair<std::string, std::optional<std::string>>>;
 
+/* The fields of one HTML `<form>` to post; see HttpService::PostForm(). */
+struct HttpForm {
+  DataFieldsMap data_fields;
+  FileFieldsMap file_fields;
+};
+
 /* A simple wrapper struct to encapsulate an HTTP server response. */
 struct HttpResponse {
   /* The HTTP response code from the server.  Note that in the special case of
@@ -193,6 +200,23 @@ class HttpService {
                         const DataFieldsMap& data_fields,
                         const FileFieldsMap& file_fields, bool verbose = false);
 
+  /* Posts each of the `forms` to the specified `url`, as if by PostForm(), and
+   returns their responses in the same order.
+
+   Implementations may have the posts in flight concurrently (e.g., over
+   several connections, or multiplexed over a single connection), so that the
+   whole batch costs about one round trip to the server instead of one round
+   trip per form. The server may therefore receive the forms in any order.
+
+   @throws std::exception if any of the `forms` has a file field whose file
+     does not exist; in that case, none of the forms is posted. Other failures
+     are reported in the responses, as for PostForm(). */
+  std::vector<HttpResponse> PostForms(const std::string& temp_directory,
+                                      const std::string& url,
+                                      const std::vector<HttpForm>& forms,
+                                      bool verbose = false);
+  //@}
+
  protected:
   /* The NVI-function for posting an HTML form to a render server. When
    PostForm calls this, it has already validated the existence of the files in
@@ -202,6 +226,13 @@ class HttpService {
                                   const DataFieldsMap& data_fields,
                                   const FileFieldsMap& file_fields,
                                   bool verbose) = 0;
+
+  /* The NVI-function for posting several forms. When PostForms calls this, it
+   has already validated the existence of the files in all of the `forms`. The
+   default implementation calls DoPostForm() for each form in turn. */
+  virtual std::vector<HttpResponse> DoPostForms(
+      const std::string& temp_directory, const std::string& url,
+      const std::vector<HttpForm>& forms, bool verbose);
 };
 
 }  // namespace internal
@@ -4,6 +4,7 @@
 #include <chrono>
 #include <filesystem>
 #include <fstream>
+#include <memory>
 #include <regex>
 #include <thread>
 #include <utility>
@@ -13,6 +14,7 @@
 #include <fmt/format.h>
 
 #include "drake/common/drake_assert.h"
+#include "drake/common/drake_copyable.h"
 #include "drake/common/fmt_ostream.h"
 #include "drake/common/never_destroyed.h"
 #include "drake/common/text_logging.h"
@@ -188,48 +190,49 @@ std::string NextTempFile() {
   return fmt::format("{:0>19}.curl", NextTempId());
 }
 
-}  // namespace
+/* One POST of a form, which owns all of its libcurl resources. */
+struct Transfer {
+  Transfer() = default;
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(Transfer);
 
-HttpServiceCurl::HttpServiceCurl() : HttpService() {
-  /* libcurl should be initialized exactly once per process, this initialization
-   is not thread-safe and must be done before potential threads using curl begin
-   (e.g., threaded renderings).  See also: MakeRenderEngineGltfClient
-   documentation in factory.h */
-  static CURLcode ignored =
-      curl_global_init(CURL_GLOBAL_ALL | CURL_GLOBAL_ACK_EINTR);
-  unused(ignored);
-}
-
-HttpServiceCurl::~HttpServiceCurl() {}
+  ~Transfer() {
+    if (multi != nullptr) curl_multi_remove_handle(multi, curl);
+    if (form != nullptr) curl_mime_free(form);
+    if (headerlist != nullptr) curl_slist_free_all(headerlist);
+    if (curl != nullptr) curl_easy_cleanup(curl);
+  }
 
-HttpResponse HttpServiceCurl::DoPostForm(const std::string& temp_directory,
-                                         const std::string& url,
-                                         const DataFieldsMap& data_fields,
-                                         const FileFieldsMap& file_fields,
-                                         bool verbose) {
-  // Create and fill out a <form> to POST.
   CURL* curl{nullptr};
-  CURLcode result;
-  curl = curl_easy_init();
-  DRAKE_DEMAND(curl != nullptr);
   curl_mime* form{nullptr};
   struct curl_slist* headerlist{nullptr};
-  form = curl_mime_init(curl);
-
-  /* Defined to make cleanup easier before throwing any possible exceptions.
-   Frees resources for `curl`, `form`, and `headerlist`. */
-  auto cleanup_curl = [](CURL* c, curl_mime* f, curl_slist* h_list) {
-    if (f != nullptr) curl_mime_free(f);
-    if (h_list != nullptr) curl_slist_free_all(h_list);
-    curl_easy_cleanup(c);
-  };
-
-  // Used when verbose, needed in scope for logging after curl_easy_perform.
+  // The multi handle that performs this transfer, once it has been added.
+  CURLM* multi{nullptr};
+  // The server's response is written directly to this file.
+  std::string bin_out_path;
+  std::ofstream bin_out;
+  // Used when verbose, for logging after the transfer is complete.
   DebugData debug_data;
+  CURLcode result{CURLE_OK};
+};
+
+/* Creates the transfer that posts the given form, and adds it to `multi`. */
+std::unique_ptr<Transfer> StartTransfer(CURLM* multi,
+                                        const std::string& temp_directory,
+                                        const std::string& url,
+                                        const DataFieldsMap& data_fields,
+                                        const FileFieldsMap& file_fields,
+                                        bool verbose) {
+  // Create and fill out a <form> to POST.
+  auto transfer = std::make_unique<Transfer>();
+  transfer->curl = curl_easy_init();
+  DRAKE_DEMAND(transfer->curl != nullptr);
+  CURL* curl = transfer->curl;
+  transfer->form = curl_mime_init(curl);
+
   if (verbose) {
     curl_easy_setopt(curl, CURLOPT_VERBOSE, 1L);
     curl_easy_setopt(curl, CURLOPT_DEBUGFUNCTION, &DebugCallback);
-    curl_easy_setopt(curl, CURLOPT_DEBUGDATA, &debug_data);
+    curl_easy_setopt(curl, CURLOPT_DEBUGDATA, &transfer->debug_data);
   }
 
   // Setup the POST url.
@@ -238,7 +241,7 @@ HttpResponse HttpServiceCurl::DoPostForm(const std::string& temp_directory,
 
   // Add all of the data fields.
   for (const auto& [field_name, field_data] : data_fields) {
-    curl_mimepart* field = curl_mime_addpart(form);
+    curl_mimepart* field = curl_mime_addpart(transfer->form);
     curl_mime_name(field, field_name.c_str());
     curl_mime_data(field, field_data.c_str(), CURL_ZERO_TERMINATED);
   }
@@ -247,7 +250,7 @@ HttpResponse HttpServiceCurl::DoPostForm(const std::string& temp_directory,
   for (const auto& [field_name, field_data_pair] : file_fields) {
     // Add the file to the form.
     const auto& file_path = field_data_pair.first;
-    curl_mimepart* field = curl_mime_addpart(form);
+    curl_mimepart* field = curl_mime_addpart(transfer->form);
     curl_mime_name(field, field_name.c_str());
     curl_mime_filedata(field, file_path.c_str());
 
@@ -258,61 +261,93 @@ HttpResponse HttpServiceCurl::DoPostForm(const std::string& temp_directory,
     }
   }
 
-  curl_easy_setopt(curl, CURLOPT_MIMEPOST, form);
+  curl_easy_setopt(curl, CURLOPT_MIMEPOST, transfer->form);
 
   // Disable 100-Continue.  See:
   // http://www.iandennismiller.com/posts/curl-http1-1-100-continue-and-multipartform-data-post.html
-  headerlist = curl_slist_append(headerlist, "Expect:");
-  curl_easy_setopt(curl, CURLOPT_HTTPHEADER, headerlist);
+  transfer->headerlist = curl_slist_append(transfer->headerlist, "Expect:");
+  curl_easy_setopt(curl, CURLOPT_HTTPHEADER, transfer->headerlist);
 
   /* We do not know if the server is going to respond with anything, and if it
    does it will be e.g., json or image file response.  Write directly to a file
    buffer within our temporary directory. */
   const auto temp_bin_out = fs::path(temp_directory) / NextTempFile();
-  const std::string bin_out_path{temp_bin_out.string()};
+  transfer->bin_out_path = temp_bin_out.string();
   if (fs::exists(temp_bin_out)) {
-    cleanup_curl(curl, form, headerlist);
     throw std::runtime_error(fmt::format(
         "RenderClient: refusing to overwrite temporary file '{}' that "
         "already exists, please cleanup temporary directory '{}'.",
-        bin_out_path, temp_directory));
+        transfer->bin_out_path, temp_directory));
   }
 
   // Open the file for writing, pass it off to curl.
-  std::ofstream bin_out(bin_out_path, std::ios::binary);
-  if (!bin_out.good()) {
-    cleanup_curl(curl, form, headerlist);
-    throw std::runtime_error(fmt::format(
-        "RenderClient: unable to open temporary file '{}'.", bin_out_path));
+  transfer->bin_out.open(transfer->bin_out_path, std::ios::binary);
+  if (!transfer->bin_out.good()) {
+    throw std::runtime_error(
+        fmt::format("RenderClient: unable to open temporary file '{}'.",
+                    transfer->bin_out_path));
   }
   curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, &WriteFileData);
-  curl_easy_setopt(curl, CURLOPT_WRITEDATA, &bin_out);
+  curl_easy_setopt(curl, CURLOPT_WRITEDATA, &transfer->bin_out);
 
-  // Perform the POST and drake::log() prior to any potential exceptions.
-  result = curl_easy_perform(curl);
-  if (!bin_out.good()) {
-    cleanup_curl(curl, form, headerlist);
-    throw std::runtime_error(fmt::format(
-        "RenderClient: unable to wtite temporary file '{}'.", bin_out_path));
+  DRAKE_DEMAND(curl_multi_add_handle(multi, curl) == CURLM_OK);
+  transfer->multi = multi;
+  return transfer;
+}
+
+/* Performs all of the transfers that have been added to `multi`, concurrently,
+ and records the result of each one. */
+void PerformTransfers(CURLM* multi,
+                      const std::vector<std::unique_ptr<Transfer>>& transfers) {
+  int still_running = 0;
+  do {
+    CURLMcode code = curl_multi_perform(multi, &still_running);
+    if (code == CURLM_OK && still_running > 0) {
+      code = curl_multi_poll(multi, nullptr, 0, 1000, nullptr);
+    }
+    if (code != CURLM_OK) {
+      throw std::runtime_error(
+          fmt::format("RenderClient: error performing the POST(s): {}",
+                      curl_multi_strerror(code)));
+    }
+  } while (still_running > 0);
+
+  int num_messages = 0;
+  while (CURLMsg* message = curl_multi_info_read(multi, &num_messages)) {
+    if (message->msg != CURLMSG_DONE) continue;
+    for (const auto& transfer : transfers) {
+      if (transfer->curl == message->easy_handle) {
+        transfer->result = message->data.result;
+      }
+    }
+  }
+}
+
+/* Releases the transfer's libcurl resources, and returns its response. */
+HttpResponse FinishTransfer(std::unique_ptr<Transfer> transfer, bool verbose) {
+  if (!transfer->bin_out.good()) {
+    throw std::runtime_error(
+        fmt::format("RenderClient: unable to wtite temporary file '{}'.",
+                    transfer->bin_out_path));
   }
   if (verbose) {
-    LogCurlDebugData(debug_data);
+    LogCurlDebugData(transfer->debug_data);
   }
 
   // Populate the wrapper return struct.
   HttpResponse ret;
-  curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &ret.http_code);
-  if (result != CURLE_OK) {
-    ret.service_error_message = std::string(curl_easy_strerror(result));
+  curl_easy_getinfo(transfer->curl, CURLINFO_RESPONSE_CODE, &ret.http_code);
+  if (transfer->result != CURLE_OK) {
+    ret.service_error_message =
+        std::string(curl_easy_strerror(transfer->result));
   }
 
-  // Cleanup the curl memory.
-  cleanup_curl(curl, form, headerlist);
-
   // Close the file after the write callback is complete. Delete the file if
   // it's empty.
-  bin_out.close();
-  const bool server_gave_data_response = fs::file_size(temp_bin_out) > 0;
+  const std::string bin_out_path = transfer->bin_out_path;
+  transfer->bin_out.close();
+  transfer.reset();
+  const bool server_gave_data_response = fs::file_size(bin_out_path) > 0;
   if (server_gave_data_response) {
     ret.data_path = bin_out_path;
   } else {
@@ -327,6 +362,56 @@ HttpResponse HttpServiceCurl::DoPostForm(const std::string& temp_directory,
   return ret;
 }
 
+}  // namespace
+
+HttpServiceCurl::HttpServiceCurl() : HttpService() {
+  /* libcurl should be initialized exactly once per process, this initialization
+   is not thread-safe and must be done before potential threads using curl begin
+   (e.g., threaded renderings).  See also: MakeRenderEngineGltfClient
+   documentation in factory.h */
+  static CURLcode ignored =
+      curl_global_init(CURL_GLOBAL_ALL | CURL_GLOBAL_ACK_EINTR);
+  unused(ignored);
+
+  multi_ = curl_multi_init();
+  DRAKE_DEMAND(multi_ != nullptr);
+  // Multiplex concurrent posts over a single connection where the server
+  // supports it (HTTP/2); otherwise, libcurl opens parallel connections.
+  curl_multi_setopt(multi_, CURLMOPT_PIPELINING, CURLPIPE_MULTIPLEX);
+}
+
+HttpServiceCurl::~HttpServiceCurl() {
+  curl_multi_cleanup(multi_);
+}
+
+HttpResponse HttpServiceCurl::DoPostForm(const std::string& temp_directory,
+                                         const std::string& url,
+                                         const DataFieldsMap& data_fields,
+                                         const FileFieldsMap& file_fields,
+                                         bool verbose) {
+  return DoPostForms(temp_directory, url, {HttpForm{data_fields, file_fields}},
+                     verbose)[0];
+}
+
+std::vector<HttpResponse> HttpServiceCurl::DoPostForms(
+    const std::string& temp_directory, const std::string& url,
+    const std::vector<HttpForm>& forms, bool verbose) {
+  // All transfers go through our one multi handle, so that its connections
+  // are kept alive and reused from one post (or batch of posts) to the next.
+  std::vector<std::unique_ptr<Transfer>> transfers;
+  for (const HttpForm& form : forms) {
+    transfers.push_back(StartTransfer(multi_, temp_directory, url,
+                                      form.data_fields, form.file_fields,
+                                      verbose));
+  }
+  PerformTransfers(multi_, transfers);
+  std::vector<HttpResponse> responses;
+  for (auto& transfer : transfers) {
+    responses.push_back(FinishTransfer(std::move(transfer), verbose));
+  }
+  return responses;
+}
+
 }  // namespace internal
 }  // namespace render_gltf_client
 }  // namespace geometry
@@ -4,6 +4,7 @@
 #include <optional>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "drake/geometry/render_gltf_client/internal_http_service.h"
 
@@ -26,6 +27,18 @@ class HttpServiceCurl : public HttpService {
                           const DataFieldsMap& data_fields,
                           const FileFieldsMap& file_fields,
                           bool verbose = false) override;
+
+  /* @see HttpService::DoPostForms. The forms are posted concurrently. */
+  std::vector<HttpResponse> DoPostForms(const std::string& temp_directory,
+                                        const std::string& url,
+                                        const std::vector<HttpForm>& forms,
+                                        bool verbose) override;
+
+ private:
+  // The libcurl multi handle (a CURLM*) that performs all of the posts. It
+  // keeps a pool of open connections to the server, so that consecutive posts
+  // don't pay for a new connection each time.
+  void* multi_{nullptr};
 };
 
 }  // namespace internal
@@ -18,6 +18,7 @@
 #include <vtkPNGReader.h>    // vtkIOImage
 #include <vtkTIFFReader.h>   // vtkIOImage
 
+#include "drake/common/ssize.h"
 #include "drake/common/temp_directory.h"
 #include "drake/common/text_logging.h"
 #include "drake/geometry/render_gltf_client/internal_http_service_curl.h"
@@ -173,19 +174,48 @@ std::string RenderClient::RenderOnServer(
     const RenderCameraCore& camera_core, RenderImageType image_type,
     const std::string& scene_path, const std::optional<std::string>& mime_type,
     const std::optional<DepthRange>& depth_range) const {
-  // Make sure depth_range is only provided for depth images.
-  const bool is_depth_type = (image_type == RenderImageType::kDepthDepth32F);
-  DRAKE_THROW_UNLESS(depth_range.has_value() == is_depth_type);
+  return RenderOnServer({RenderRequest{camera_core, image_type, scene_path,
+                                       mime_type, depth_range}})[0];
+}
+
+std::vector<std::string> RenderClient::RenderOnServer(
+    const std::vector<RenderRequest>& requests) const {
+  std::vector<std::string> scene_sha256s;
+  std::vector<HttpForm> forms;
+  for (const RenderRequest& request : requests) {
+    // Make sure depth_range is only provided for depth images.
+    const bool is_depth_type =
+        (request.image_type == RenderImageType::kDepthDepth32F);
+    DRAKE_THROW_UNLESS(request.depth_range.has_value() == is_depth_type);
+
+    scene_sha256s.push_back(ComputeSha256(request.scene_path));
+    forms.push_back(HttpForm{
+        MakeFormFields(request, scene_sha256s.back()),
+        {{"scene", {request.scene_path, request.mime_type}}}});
+  }
+
+  const std::string url = params_.GetUrl();
+  // Post the forms and validate the results.
+  const std::vector<HttpResponse> responses = http_service_->PostForms(
+      temp_directory_, url, forms, params_.verbose);
+  std::vector<std::string> image_paths;
+  for (int i = 0; i < ssize(requests); ++i) {
+    image_paths.push_back(
+        ProcessResponse(requests[i], scene_sha256s[i], url, responses[i]));
+  }
+  return image_paths;
+}
 
+DataFieldsMap RenderClient::MakeFormFields(const RenderRequest& request,
+                                           const std::string& scene_sha256) {
   // Add the fields to the form.
   DataFieldsMap field_map;
-  const std::string scene_sha256 = ComputeSha256(scene_path);
   AddField(&field_map, "scene_sha256", scene_sha256);
-  AddField(&field_map, "image_type", image_type);
-  const CameraInfo& intrinsics = camera_core.intrinsics();
+  AddField(&field_map, "image_type", request.image_type);
+  const CameraInfo& intrinsics = request.camera_core.intrinsics();
   AddField(&field_map, "width", intrinsics.width());
   AddField(&field_map, "height", intrinsics.height());
-  const ClippingRange& clipping = camera_core.clipping();
+  const ClippingRange& clipping = request.camera_core.clipping();
   AddField(&field_map, "near", clipping.near());
   AddField(&field_map, "far", clipping.far());
   AddField(&field_map, "focal_x", intrinsics.focal_x());
@@ -197,18 +227,20 @@ std::string RenderClient::RenderOnServer(
   // For depth images, an additional min_depth and max_depth are sent for the
   // depth range of the sensor (the range sensor's clipping range for valid
   // measurements, not the perspective clipping of the sensor's curvature).
-  if (is_depth_type) {
-    const DepthRange& range = depth_range.value();  // has_value checked above.
+  if (request.depth_range.has_value()) {
+    const DepthRange& range = request.depth_range.value();
     AddField(&field_map, "min_depth", range.min_depth());
     AddField(&field_map, "max_depth", range.max_depth());
   }
   AddField(&field_map, "submit", "Render");
 
-  const std::string url = params_.GetUrl();
-  // Post the form and validate the results.
-  const HttpResponse response = http_service_->PostForm(
-      temp_directory_, url, field_map, {{"scene", {scene_path, mime_type}}},
-      params_.verbose);
+  return field_map;
+}
+
+std::string RenderClient::ProcessResponse(const RenderRequest& request,
+                                          const std::string& scene_sha256,
+                                          const std::string& url,
+                                          const HttpResponse& response) {
   if (!response.Good()) {
     /* Server may have responded with meaningful text, try and load the file
      as a string. */
@@ -265,19 +297,19 @@ std::string RenderClient::RenderOnServer(
    this manual file type detection. */
   vtkNew<vtkPNGReader> png_reader;
   if (png_reader->CanReadFile(bin_out_path.c_str())) {
-    return RenameHttpServiceResponse(bin_out_path, scene_path, ".png");
+    return RenameHttpServiceResponse(bin_out_path, request.scene_path, ".png");
   }
 
   vtkNew<vtkTIFFReader> tiff_reader;
   if (tiff_reader->CanReadFile(bin_out_path.c_str())) {
-    return RenameHttpServiceResponse(bin_out_path, scene_path, ".tiff");
+    return RenameHttpServiceResponse(bin_out_path, request.scene_path, ".tiff");
   }
 
   throw std::runtime_error(fmt::format(
       "RenderClient: while trying to render the scene '{}' with a sha256 hash "
       "of '{}', the file returned by the server saved in '{}' is not "
       "understood as an image type that is supported, i.e., PNG or TIFF.",
-      scene_path, scene_sha256, bin_out_path));
+      request.scene_path, scene_sha256, bin_out_path));
 }
 
 std::string RenderClient::ComputeSha256(const std::string& path) {
@@ -3,6 +3,7 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <vector>
 
 #include "drake/common/drake_copyable.h"
 #include "drake/geometry/render/render_camera.h"
@@ -80,6 +81,24 @@ class RenderClient {
       const std::optional<render::DepthRange>& depth_range =
           std::nullopt) const;
 
+  /* The arguments of one RenderOnServer() call, for batched rendering. */
+  struct RenderRequest {
+    render::RenderCameraCore camera_core;
+    RenderImageType image_type{};
+    std::string scene_path;
+    std::optional<std::string> mime_type;
+    std::optional<render::DepthRange> depth_range;
+  };
+
+  /* Renders all of the `requests` on the server, as if by calling
+   RenderOnServer() for each of them in turn, and returns the paths to the
+   image files in the same order. The scene files are uploaded concurrently,
+   which hides most of the latency of the round trips to the server.
+   @throws std::exception under the same conditions as RenderOnServer(), for
+     any of the requests. */
+  std::vector<std::string> RenderOnServer(
+      const std::vector<RenderRequest>& requests) const;
+
   //@}
 
   /* @name Server communication helpers */
@@ -195,6 +214,18 @@ class RenderClient {
   void SetHttpService(std::unique_ptr<HttpService> service);
 
  private:
+  /* Returns the form fields that describe the given `request` to the server.
+   `scene_sha256` is the hash of the request's scene file. */
+  static DataFieldsMap MakeFormFields(const RenderRequest& request,
+                                      const std::string& scene_sha256);
+
+  /* Validates the server's `response` to the given `request`, and returns the
+   path to the image file that it downloaded. */
+  static std::string ProcessResponse(const RenderRequest& request,
+                                     const std::string& scene_sha256,
+                                     const std::string& url,
+                                     const HttpResponse& response);
+
   const std::string temp_directory_;
   const RenderEngineGltfClientParams params_;
   std::unique_ptr<HttpService> http_service_;
@@ -8,6 +8,7 @@
 #include <set>
 #include <string_view>
 #include <utility>
+#include <vector>
 
 // To ease build system upkeep, we annotate VTK includes with their deps.
 #include <vtkCamera.h>         // vtkRenderingCore
@@ -395,28 +396,10 @@ void RenderEngineGltfClient::UpdateViewpoint(
 
 void RenderEngineGltfClient::DoRenderColorImage(
     const ColorRenderCamera& camera, ImageRgba8U* color_image_out) const {
-  const int64_t color_scene_id = GetNextSceneId();
-  if (get_params().verbose) {
-    LogFrameStart(ImageType::kColor, color_scene_id);
-  }
-
-  const RenderingPipeline& color_pipeline =
-      get_mutable_pipeline(ImageType::kColor);
   // Update the VTK scene before exporting to glTF.
-  UpdateWindow(camera.core(), camera.show_window(), color_pipeline,
-               "Color Image");
-  PerformVtkUpdate(color_pipeline);
-
-  // Export and render the glTF scene.
-  SetGltfCameraPerspective(camera.core(),
-                           color_pipeline.renderer->GetActiveCamera());
-  const std::string scene_path =
-      fs::path(temp_directory()) /
-      GetSceneFileName(ImageType::kColor, color_scene_id);
-  ExportScene(scene_path, ImageType::kColor);
-  if (get_params().verbose) {
-    LogFrameGltfExportPath(ImageType::kColor, scene_path);
-  }
+  UpdateWindow(camera.core(), camera.show_window(),
+               get_mutable_pipeline(ImageType::kColor), "Color Image");
+  const std::string scene_path = ExportFrame(camera.core(), ImageType::kColor);
 
   const std::string image_path = render_client_->RenderOnServer(
       camera.core(), VtkToRenderImageType(ImageType::kColor), scene_path,
@@ -434,28 +417,9 @@ void RenderEngineGltfClient::DoRenderColorImage(
 
 void RenderEngineGltfClient::DoRenderDepthImage(
     const DepthRenderCamera& camera, ImageDepth32F* depth_image_out) const {
-  const int64_t depth_scene_id = GetNextSceneId();
-
-  if (get_params().verbose) {
-    LogFrameStart(ImageType::kDepth, depth_scene_id);
-  }
-
-  const RenderingPipeline& depth_pipeline =
-      get_mutable_pipeline(ImageType::kDepth);
   // Update the VTK scene before exporting to glTF.
-  UpdateWindow(camera, depth_pipeline);
-  PerformVtkUpdate(depth_pipeline);
-
-  // Export and render the glTF scene.
-  SetGltfCameraPerspective(camera.core(),
-                           depth_pipeline.renderer->GetActiveCamera());
-  const std::string scene_path =
-      fs::path(temp_directory()) /
-      GetSceneFileName(ImageType::kDepth, depth_scene_id);
-  ExportScene(scene_path, ImageType::kDepth);
-  if (get_params().verbose) {
-    LogFrameGltfExportPath(ImageType::kDepth, scene_path);
-  }
+  UpdateWindow(camera, get_mutable_pipeline(ImageType::kDepth));
+  const std::string scene_path = ExportFrame(camera.core(), ImageType::kDepth);
 
   const std::string image_path = render_client_->RenderOnServer(
       camera.core(), VtkToRenderImageType(ImageType::kDepth), scene_path,
@@ -473,38 +437,126 @@ void RenderEngineGltfClient::DoRenderDepthImage(
 
 void RenderEngineGltfClient::DoRenderLabelImage(
     const ColorRenderCamera& camera, ImageLabel16I* label_image_out) const {
-  const int64_t label_scene_id = GetNextSceneId();
+  // Update the VTK scene before exporting to glTF.
+  UpdateWindow(camera.core(), camera.show_window(),
+               get_mutable_pipeline(ImageType::kLabel), "Label Image");
+  const std::string scene_path = ExportFrame(camera.core(), ImageType::kLabel);
 
+  const std::string image_path = render_client_->RenderOnServer(
+      camera.core(), VtkToRenderImageType(ImageType::kLabel), scene_path,
+      MimeType());
   if (get_params().verbose) {
-    LogFrameStart(ImageType::kLabel, label_scene_id);
+    LogFrameServerResponsePath(ImageType::kLabel, image_path);
   }
 
-  const RenderingPipeline& label_pipeline =
-      get_mutable_pipeline(ImageType::kLabel);
-  // Update the VTK scene before exporting to glTF.
-  UpdateWindow(camera.core(), camera.show_window(), label_pipeline,
-               "Label Image");
-  PerformVtkUpdate(label_pipeline);
+  // Load the returned image back to the drake buffer.
+  LoadLabelImage(image_path, label_image_out);
+  if (get_params().cleanup) {
+    CleanupFrame(scene_path, image_path, get_params().verbose);
+  }
+}
 
-  // Export and render the glTF scene.
-  SetGltfCameraPerspective(camera.core(),
-                           label_pipeline.renderer->GetActiveCamera());
-  const std::string scene_path =
-      fs::path(temp_directory()) /
-      GetSceneFileName(ImageType::kLabel, label_scene_id);
-  ExportScene(scene_path, ImageType::kLabel);
+void RenderEngineGltfClient::DoRenderImages(
+    const std::vector<ImageRequest>& requests) {
+  // Export the scene files of all of the requested images first, so that they
+  // can be uploaded to the server together; the server then renders them
+  // while the remaining uploads and downloads are in flight.
+  struct Frame {
+    ImageType image_type;
+    std::string scene_path;
+    const ImageRequest* request;
+  };
+  std::vector<Frame> frames;
+  std::vector<RenderClient::RenderRequest> render_requests;
+  for (const ImageRequest& request : requests) {
+    UpdateViewpoint(request.X_WC);
+    if (request.color_image != nullptr) {
+      const ColorRenderCamera& camera = *request.color_camera;
+      UpdateWindow(camera.core(), camera.show_window(),
+                   get_mutable_pipeline(ImageType::kColor), "Color Image");
+      frames.push_back({ImageType::kColor,
+                        ExportFrame(camera.core(), ImageType::kColor),
+                        &request});
+      render_requests.push_back({camera.core(),
+                                 VtkToRenderImageType(ImageType::kColor),
+                                 frames.back().scene_path, MimeType(),
+                                 std::nullopt});
+    }
+    if (request.depth_image != nullptr) {
+      const DepthRenderCamera& camera = *request.depth_camera;
+      UpdateWindow(camera, get_mutable_pipeline(ImageType::kDepth));
+      frames.push_back({ImageType::kDepth,
+                        ExportFrame(camera.core(), ImageType::kDepth),
+                        &request});
+      render_requests.push_back({camera.core(),
+                                 VtkToRenderImageType(ImageType::kDepth),
+                                 frames.back().scene_path, MimeType(),
+                                 camera.depth_range()});
+    }
+    if (request.label_image != nullptr) {
+      const ColorRenderCamera& camera = *request.color_camera;
+      UpdateWindow(camera.core(), camera.show_window(),
+                   get_mutable_pipeline(ImageType::kLabel), "Label Image");
+      frames.push_back({ImageType::kLabel,
+                        ExportFrame(camera.core(), ImageType::kLabel),
+                        &request});
+      render_requests.push_back({camera.core(),
+                                 VtkToRenderImageType(ImageType::kLabel),
+                                 frames.back().scene_path, MimeType(),
+                                 std::nullopt});
+    }
+  }
+
+  const std::vector<std::string> image_paths =
+      render_client_->RenderOnServer(render_requests);
+
+  // Load the returned images back to the drake buffers.
+  for (int i = 0; i < ssize(frames); ++i) {
+    const Frame& frame = frames[i];
+    const std::string& image_path = image_paths[i];
+    if (get_params().verbose) {
+      LogFrameServerResponsePath(frame.image_type, image_path);
+    }
+    switch (frame.image_type) {
+      case ImageType::kColor:
+        render_client_->LoadColorImage(image_path, frame.request->color_image);
+        break;
+      case ImageType::kDepth:
+        render_client_->LoadDepthImage(image_path, frame.request->depth_image);
+        break;
+      case ImageType::kLabel:
+        LoadLabelImage(image_path, frame.request->label_image);
+        break;
+    }
+    if (get_params().cleanup) {
+      CleanupFrame(frame.scene_path, image_path, get_params().verbose);
+    }
+  }
+}
+
+std::string RenderEngineGltfClient::ExportFrame(
+    const RenderCameraCore& camera_core, ImageType image_type) const {
+  const int64_t scene_id = GetNextSceneId();
   if (get_params().verbose) {
-    LogFrameGltfExportPath(ImageType::kLabel, scene_path);
+    LogFrameStart(image_type, scene_id);
   }
 
-  const std::string image_path = render_client_->RenderOnServer(
-      camera.core(), VtkToRenderImageType(ImageType::kLabel), scene_path,
-      MimeType());
+  const RenderingPipeline& pipeline = get_mutable_pipeline(image_type);
+  PerformVtkUpdate(pipeline);
+
+  // Export the glTF scene.
+  SetGltfCameraPerspective(camera_core, pipeline.renderer->GetActiveCamera());
+  const std::string scene_path =
+      fs::path(temp_directory()) / GetSceneFileName(image_type, scene_id);
+  ExportScene(scene_path, image_type);
   if (get_params().verbose) {
-    LogFrameServerResponsePath(ImageType::kLabel, image_path);
+    LogFrameGltfExportPath(image_type, scene_path);
   }
+  return scene_path;
+}
 
-  // Load the returned image back to the drake buffer.
+void RenderEngineGltfClient::LoadLabelImage(
+    const std::string& image_path, ImageLabel16I* label_image_out) const {
   /* NOTE: The loaded image from `image_path` is expected to be a colored label
    image that will then be converted to an actual label image.  The server has
    no knowledge of the conversion formula, and thus, a colored label image is
@@ -529,10 +581,6 @@ void RenderEngineGltfClient::DoRenderLabelImage(
                                          : RenderEngine::LabelFromColor(color);
     }
   }
-
-  if (get_params().cleanup) {
-    CleanupFrame(scene_path, image_path, get_params().verbose);
-  }
 }
 
 void RenderEngineGltfClient::ExportScene(const std::string& export_path,
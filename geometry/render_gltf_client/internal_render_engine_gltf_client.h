@@ -4,6 +4,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include <nlohmann/json.hpp>
 
@@ -86,6 +87,21 @@ class DRAKE_NO_EXPORT RenderEngineGltfClient
       const render::ColorRenderCamera& camera,
       systems::sensors::ImageLabel16I* label_image_out) const override;
 
+  // @see RenderEngine::DoRenderImages(). All of the images are rendered by the
+  // server as a single batch of concurrent requests.
+  void DoRenderImages(const std::vector<ImageRequest>& requests) override;
+
+  /* Exports the VTK scene for `image_type`, as seen by `camera_core`, to a new
+   glTF file in temp_directory(), and returns the path to that file. The
+   pipeline's window must already have been updated for the camera. */
+  std::string ExportFrame(const render::RenderCameraCore& camera_core,
+                          render_vtk::internal::ImageType image_type) const;
+
+  /* Loads the colored label image returned by the server from `image_path`,
+   and converts it into `label_image_out`. */
+  void LoadLabelImage(const std::string& image_path,
+                      systems::sensors::ImageLabel16I* label_image_out) const;
+
   /* Exports the `RenderEngineVtk::pipelines_[image_type]` VTK scene to a
    glTF file given `export_path`. */
   void ExportScene(const std::string& export_path,
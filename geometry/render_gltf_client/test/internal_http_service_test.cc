@@ -2,6 +2,7 @@
 
 #include <filesystem>
 #include <fstream>
+#include <vector>
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
@@ -35,6 +36,29 @@ class EmptyService : public HttpService {
   }
 };
 
+// A concrete implementation of HttpService that counts its posts.
+class CountingService : public HttpService {
+ public:
+  CountingService() = default;
+
+  int num_posts() const { return num_posts_; }
+
+ protected:
+  HttpResponse DoPostForm(const std::string& /* temp_directory */,
+                          const std::string& /* url */,
+                          const DataFieldsMap& data_fields,
+                          const FileFieldsMap& /* file_fields */,
+                          bool /* verbose */ = false) override {
+    ++num_posts_;
+    HttpResponse ret;
+    ret.http_code = std::stoi(data_fields.at("code"));
+    return ret;
+  }
+
+ private:
+  int num_posts_{0};
+};
+
 class HttpServicePostFormTest : public ::testing::Test {
  public:
   HttpServicePostFormTest() {
@@ -105,6 +129,30 @@ TEST_F(HttpServicePostFormTest, MixedFiles) {
                          testing::HasSubstr("/no/such/file"))));
 }
 
+// By default, a batch of forms is posted one form at a time, and the responses
+// are returned in order.
+TEST_F(HttpServicePostFormTest, PostForms) {
+  CountingService service;
+  const std::string url = "http://127.0.0.1:8000/render";
+  const std::vector<HttpResponse> responses = service.PostForms(
+      temp_dir_, url,
+      {HttpForm{{{"code", "200"}}, {}},
+       HttpForm{{{"code", "404"}}, {{"text", {txt_path_, std::nullopt}}}}});
+  EXPECT_EQ(service.num_posts(), 2);
+  ASSERT_EQ(responses.size(), 2);
+  EXPECT_EQ(responses[0].http_code, 200);
+  EXPECT_EQ(responses[1].http_code, 404);
+
+  // A missing file in any of the forms is reported before anything is posted.
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      service.PostForms(
+          temp_dir_, url,
+          {HttpForm{{{"code", "200"}}, {}},
+           HttpForm{{}, {{"foo", {"/no/such/file", std::nullopt}}}}}),
+      ".*missing.*foo.*/no/such/file.*");
+  EXPECT_EQ(service.num_posts(), 2);
+}
+
 }  // namespace
 }  // namespace internal
 }  // namespace render_gltf_client
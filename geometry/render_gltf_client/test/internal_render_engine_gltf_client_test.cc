@@ -240,10 +240,14 @@ class FakeServer : public HttpService {
   HttpResponse DoPostForm(const std::string& temp_directory,
                           const std::string& /* url */,
                           const DataFieldsMap& data_fields,
-                          const FileFieldsMap& /* file_fields */,
+                          const FileFieldsMap& file_fields,
                           bool /* verbose */) override {
     const std::string image_type = data_fields.at("image_type");
-    const std::string data_path = fs::path(temp_directory) / "image.response";
+    // Name the response after the scene, so that the responses to a batch of
+    // posts don't collide.
+    const fs::path scene_path = file_fields.at("scene").first;
+    const std::string data_path =
+        fs::path(temp_directory) / (scene_path.stem().string() + ".response");
     std::string test_image_path;
     if (image_type == "color") {
       test_image_path = FindResourceOrThrow(
@@ -341,6 +345,41 @@ TEST_F(RenderEngineGltfClientTest, DoRenderLabelImage) {
   }
 }
 
+TEST_F(RenderEngineGltfClientTest, RenderImages) {
+  for (const bool cleanup : {true, false}) {
+    RenderEngineGltfClient engine{Params{.cleanup = cleanup}};
+    engine.SetHttpService(std::make_unique<FakeServer>());
+
+    // Two camera poses, each with all three image types, are rendered as a
+    // single batch.
+    std::vector<ImageRgba8U> color_images(
+        2, ImageRgba8U{kTestImageWidth, kTestImageHeight});
+    std::vector<ImageDepth32F> depth_images(
+        2, ImageDepth32F{kTestImageWidth, kTestImageHeight});
+    std::vector<ImageLabel16I> label_images(
+        2, ImageLabel16I{kTestImageWidth, kTestImageHeight});
+    std::vector<RenderEngine::ImageRequest> requests;
+    for (int i = 0; i < 2; ++i) {
+      requests.push_back({.X_WC = RigidTransformd(Vector3d(i, 0, 1)),
+                          .color_camera = color_camera_,
+                          .depth_camera = depth_camera_,
+                          .color_image = &color_images[i],
+                          .depth_image = &depth_images[i],
+                          .label_image = &label_images[i]});
+    }
+    DRAKE_EXPECT_NO_THROW(engine.RenderImages(requests));
+
+    // Each image has its own scene and response files.
+    EXPECT_EQ(FindRegularFiles(engine.temp_directory()).size(),
+              cleanup ? 0 : 12);
+    for (int i = 0; i < 2; ++i) {
+      EXPECT_EQ(color_images[i], CreateTestColorImage(false));
+      EXPECT_EQ(depth_images[i], CreateTestDepthImage());
+      EXPECT_EQ(label_images[i], CreateTestLabelImage());
+    }
+  }
+}
+
 class RenderEngineGltfClientGltfTest : public ::testing::Test {
  public:
   RenderEngineGltfClientGltfTest()
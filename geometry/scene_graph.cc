@@ -531,7 +531,7 @@ void SceneGraph<T>::CalcPoseUpdate(const Context<T>& context,
     }
   }
 
-  state.FinalizePoseUpdate(kinematics_data,
+  state.FinalizePoseUpdate(&kinematics_data,
                            &state.mutable_proximity_engine(),
                            state.GetMutableRenderEngines());
 }
@@ -825,11 +825,16 @@ class SceneGraph final : public systems::LeafSystem<T> {
    role; it will simply eliminate possibly necessary properties. To remove
    the role completely, call `RemoveRole()`.
 
-   @warning Currently, only __proximity__ and __illustration__ properties can be
-   updated via this mechanism. Updating illustration properties has limitations
+   Replacing properties doesn't re-register the geometry; e.g., replacing
+   proximity properties that only differ in their "material" group (such as
+   friction) does not rebuild the geometry's hydroelastic representation, and
+   replacing perception properties (such as a material) only re-registers the
+   geometry with the render engines. Doing so in a Context is the cheapest way
+   to randomize a scene between episodes.
+
+   @warning Updating illustration properties has limitations
    (see @ref AssignRole(SourceId,GeometryId,IllustrationProperties,RoleAssign)
-   "AssignRole(..., IllustrationProperties)" below). Attempting to update
-   perception will throw an exception (to be implemented in the near future).
+   "AssignRole(..., IllustrationProperties)" below).
 
    All invocations of `AssignRole()` will throw an exception if:
 
@@ -139,7 +139,7 @@ class GeometryStateTester {
   }
 
   void FinalizePoseUpdate() {
-    state_->FinalizePoseUpdate(state_->kinematics_data_,
+    state_->FinalizePoseUpdate(&state_->kinematics_data_,
                                &state_->mutable_proximity_engine(),
                                state_->GetMutableRenderEngines());
   }
@@ -1575,6 +1575,103 @@ TEST_F(GeometryStateTest, AddGeometryUpdatesX_WG) {
   }
 }
 
+// Confirms that a pose update only recomputes (and propagates to the engines)
+// the poses of geometries whose frames have moved.
+TEST_F(GeometryStateTest, PoseUpdateOnlyPropagatesMovedFrames) {
+  const SourceId s_id =
+      SetUpSingleSourceTree(Assign::kProximity | Assign::kPerception);
+  internal::KinematicsData<double>& kinematics_data =
+      gs_tester_.mutable_kinematics_data();
+  FramePoseVector<double> poses;
+  for (int f = 0; f < static_cast<int>(frames_.size()); ++f) {
+    poses.set_value(frames_[f], X_PFs_[f]);
+  }
+
+  // The first update computes the poses of all frames.
+  gs_tester_.SetFramePoses(s_id, poses, &kinematics_data);
+  EXPECT_THAT(kinematics_data.moved_geometries,
+              ::testing::UnorderedElementsAreArray(geometries_));
+  render_engine_->init_test_data();
+  gs_tester_.FinalizePoseUpdate();
+  EXPECT_TRUE(kinematics_data.moved_geometries.empty());
+  EXPECT_EQ(render_engine_->updated_ids().size(), geometries_.size());
+
+  // Setting the same poses moves nothing.
+  gs_tester_.SetFramePoses(s_id, poses, &kinematics_data);
+  EXPECT_TRUE(kinematics_data.moved_geometries.empty());
+  render_engine_->init_test_data();
+  gs_tester_.FinalizePoseUpdate();
+  EXPECT_TRUE(render_engine_->updated_ids().empty());
+
+  // Moving f1 moves its geometries and those of its child frame f2, but not
+  // those of f0.
+  const RigidTransformd X_PF1(Vector3d(100, 0, 0));
+  poses.set_value(frames_[1], X_PF1);
+  gs_tester_.SetFramePoses(s_id, poses, &kinematics_data);
+  const vector<GeometryId> f1_f2_geometries(geometries_.begin() + 2,
+                                            geometries_.end());
+  EXPECT_THAT(kinematics_data.moved_geometries,
+              ::testing::UnorderedElementsAreArray(f1_f2_geometries));
+  render_engine_->init_test_data();
+  gs_tester_.FinalizePoseUpdate();
+  EXPECT_EQ(render_engine_->updated_ids().size(), f1_f2_geometries.size());
+  for (int g = 0; g < static_cast<int>(geometries_.size()); ++g) {
+    const int f = g / kGeometryCount;
+    const RigidTransformd X_WF =
+        f == 0 ? X_WFs_[0] : (f == 1 ? X_PF1 : X_PF1 * X_PFs_[2]);
+    const RigidTransformd X_WG = X_WF * X_FGs_[g];
+    EXPECT_TRUE(CompareMatrices(
+        geometry_state_.get_pose_in_world(geometries_[g]).GetAsMatrix34(),
+        X_WG.GetAsMatrix34(), 1e-13));
+    // The proximity engine has the updated pose: the sphere (of radius 1)
+    // is centered on the origin of G.
+    bool found = false;
+    for (const auto& result : geometry_state_.ComputeSignedDistanceToPoint(
+             X_WG.translation(), 0.0)) {
+      if (result.id_G == geometries_[g]) {
+        EXPECT_NEAR(result.distance, -1.0, 1e-13);
+        found = true;
+      }
+    }
+    EXPECT_TRUE(found);
+  }
+}
+
+// Confirms that changing the pose of a dynamic geometry with ChangeShape()
+// causes the next pose update to recompute (and propagate) its world pose,
+// even though its frame hasn't moved.
+TEST_F(GeometryStateTest, ChangeShapePoseMarksFrameStale) {
+  const SourceId s_id = SetUpSingleSourceTree(Assign::kProximity);
+  internal::KinematicsData<double>& kinematics_data =
+      gs_tester_.mutable_kinematics_data();
+  FramePoseVector<double> poses;
+  for (int f = 0; f < static_cast<int>(frames_.size()); ++f) {
+    poses.set_value(frames_[f], X_PFs_[f]);
+  }
+  gs_tester_.SetFramePoses(s_id, poses, &kinematics_data);
+  gs_tester_.FinalizePoseUpdate();
+
+  const GeometryId g_id = geometries_[0];
+  const RigidTransformd X_FG2(Vector3d(1, 2, 3));
+  geometry_state_.ChangeShape(s_id, g_id, Sphere(1.0), X_FG2);
+  const RigidTransformd X_WG2 = X_WFs_[0] * X_FG2;
+  EXPECT_TRUE(CompareMatrices(
+      geometry_state_.get_pose_in_world(g_id).GetAsMatrix34(),
+      X_WG2.GetAsMatrix34(), 1e-13));
+
+  // The frame's poses are unchanged, but its geometries are still updated.
+  gs_tester_.SetFramePoses(s_id, poses, &kinematics_data);
+  EXPECT_THAT(kinematics_data.moved_geometries, ::testing::Contains(g_id));
+  gs_tester_.FinalizePoseUpdate();
+  EXPECT_TRUE(CompareMatrices(
+      geometry_state_.get_pose_in_world(g_id).GetAsMatrix34(),
+      X_WG2.GetAsMatrix34(), 1e-13));
+
+  // Only once.
+  gs_tester_.SetFramePoses(s_id, poses, &kinematics_data);
+  EXPECT_TRUE(kinematics_data.moved_geometries.empty());
+}
+
 // Confirms that registering two geometries with the same id causes failure.
 TEST_F(GeometryStateTest, RegisterDuplicateGeometry) {
   const SourceId s_id = NewSource();
@@ -3091,22 +3188,43 @@ TEST_F(GeometryStateTest, ModifyIllustrationProperties) {
   ASSERT_TRUE(props->HasProperty("group2", "value"));
 }
 
-// Test that attempting to reassign perception properties to a geometry that
-// already has the perception role fails.
+// Test that reassigning perception properties to a geometry that already has
+// the perception role re-registers it with the renderers, and only them.
 TEST_F(GeometryStateTest, ModifyPerceptionProperties) {
   SetUpSingleSourceTree();
+  const GeometryId id = geometries_[1];
 
-  // Case: confirm throw for perception properties.
   PerceptionProperties perception_props =
       render_engine_->accepting_properties();
   perception_props.AddProperty("label", "id", RenderLabel(10));
   EXPECT_NO_THROW(
-      geometry_state_.AssignRole(source_id_, geometries_[1], perception_props));
-  DRAKE_EXPECT_THROWS_MESSAGE(
-      geometry_state_.AssignRole(source_id_, geometries_[1], perception_props,
-                                 RoleAssign::kReplace),
-      "AssignRole\\(\\) with RoleAssign::kReplace does not work for perception "
-      "properties");
+      geometry_state_.AssignRole(source_id_, id, perception_props));
+  EXPECT_TRUE(render_engine_->is_registered(id));
+
+  // Case: the new properties are rejected by the renderer.
+  const GeometryVersion version = geometry_state_.geometry_version();
+  PerceptionProperties rejected_props = render_engine_->rejecting_properties();
+  rejected_props.AddProperty("label", "id", RenderLabel(11));
+  EXPECT_NO_THROW(geometry_state_.AssignRole(source_id_, id, rejected_props,
+                                             RoleAssign::kReplace));
+  EXPECT_FALSE(render_engine_->is_registered(id));
+  EXPECT_EQ(geometry_state_.GetPerceptionProperties(id)
+                ->GetProperty<RenderLabel>("label", "id"),
+            RenderLabel(11));
+
+  // Case: the new properties are accepted again.
+  EXPECT_NO_THROW(geometry_state_.AssignRole(source_id_, id, perception_props,
+                                             RoleAssign::kReplace));
+  EXPECT_TRUE(render_engine_->is_registered(id));
+  EXPECT_EQ(geometry_state_.GetPerceptionProperties(id)
+                ->GetProperty<RenderLabel>("label", "id"),
+            RenderLabel(10));
+
+  // Only the perception version changed.
+  const GeometryVersion& new_version = geometry_state_.geometry_version();
+  EXPECT_TRUE(version.IsSameAs(new_version, Role::kProximity));
+  EXPECT_TRUE(version.IsSameAs(new_version, Role::kIllustration));
+  EXPECT_FALSE(version.IsSameAs(new_version, Role::kPerception));
 }
 
 // Tests the various Get*Properties(GeometryId) methods.
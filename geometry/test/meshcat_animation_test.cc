@@ -122,6 +122,30 @@ GTEST_TEST(MeshcatAnimationTest, SetPropertyTest) {
       ".*already has a track.*");
 }
 
+// Keyframes may be set in any order, and setting a keyframe again replaces
+// its value.
+GTEST_TEST(MeshcatAnimationTest, KeyFrameOrderTest) {
+  MeshcatAnimation animation;
+  animation.SetProperty(10, "test", "position", {1.0, 2.0});
+  animation.SetProperty(2, "test", "position", {3.0, 4.0});
+  animation.SetProperty(5, "test", "position", {5.0, 6.0});
+  animation.SetProperty(10, "test", "position", {7.0, 8.0});
+  using Values = std::vector<double>;
+  EXPECT_EQ(animation.get_key_frame<Values>(2, "test", "position"),
+            Values({3.0, 4.0}));
+  EXPECT_EQ(animation.get_key_frame<Values>(5, "test", "position"),
+            Values({5.0, 6.0}));
+  EXPECT_EQ(animation.get_key_frame<Values>(10, "test", "position"),
+            Values({7.0, 8.0}));
+  EXPECT_FALSE(animation.get_key_frame<Values>(3, "test", "position"));
+  EXPECT_FALSE(animation.get_key_frame<Values>(11, "test", "position"));
+
+  // All values of a vector track must have the same size.
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      animation.SetProperty(1, "test", "position", {1.0, 2.0, 3.0}),
+      ".*values of size 2 != 3.*");
+}
+
 }  // namespace
 }  // namespace geometry
 }  // namespace drake
@@ -99,6 +99,39 @@ TEST_F(MeshcatPointCloudVisualizerTest, Delete) {
   EXPECT_TRUE(meshcat_->GetPackedObject("cloud").empty());
 }
 
+TEST_F(MeshcatPointCloudVisualizerTest, UnchangedCloudIsNotResent) {
+  SetUpDiagram();
+
+  diagram_->ForcedPublish(*context_);
+  EXPECT_FALSE(meshcat_->GetPackedObject("cloud").empty());
+
+  // Deleting behind the visualizer's back reveals that the unchanged cloud is
+  // not sent again.
+  meshcat_->Delete("cloud");
+  diagram_->ForcedPublish(*context_);
+  EXPECT_TRUE(meshcat_->GetPackedObject("cloud").empty());
+
+  // Deleting via the visualizer causes the next publish to send it again.
+  visualizer_->Delete();
+  diagram_->ForcedPublish(*context_);
+  EXPECT_FALSE(meshcat_->GetPackedObject("cloud").empty());
+}
+
+TEST_F(MeshcatPointCloudVisualizerTest, VoxelSize) {
+  SetUpDiagram();
+
+  diagram_->ForcedPublish(*context_);
+  const int full_size = meshcat_->GetPackedObject("cloud").size();
+
+  // A voxel that contains all five points sends a single point.
+  visualizer_->set_voxel_size(1000.0);
+  diagram_->ForcedPublish(*context_);
+  EXPECT_LT(meshcat_->GetPackedObject("cloud").size(), full_size);
+
+  DRAKE_EXPECT_THROWS_MESSAGE(visualizer_->set_voxel_size(-1.0),
+                              ".*voxel_size >= 0.*");
+}
+
 TEST_F(MeshcatPointCloudVisualizerTest, VisualizationParameters) {
   SetUpDiagram();
 
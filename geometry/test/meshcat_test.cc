@@ -501,6 +501,39 @@ GTEST_TEST(MeshcatTest, SetTransformWithMatrix) {
   EXPECT_TRUE(CompareMatrices(matrix, actual));
 }
 
+GTEST_TEST(MeshcatTest, SetTransforms) {
+  Meshcat meshcat;
+  const std::vector<std::string> paths{"frame1", "frame2"};
+  const std::vector<RigidTransformd> X_ParentPaths{
+      RigidTransformd(Vector3d(1, 2, 3)),
+      RigidTransformd(math::RollPitchYawd(0.1, 0.2, 0.3),
+                      Vector3d(-1, 0, 1))};
+  meshcat.SetTransforms(paths, X_ParentPaths);
+  // Setting the same poses again is a no-op.
+  meshcat.SetTransforms(paths, X_ParentPaths);
+
+  for (int i = 0; i < 2; ++i) {
+    EXPECT_TRUE(meshcat.HasPath(paths[i]));
+    std::string transform = meshcat.GetPackedTransform(paths[i]);
+    msgpack::object_handle oh =
+        msgpack::unpack(transform.data(), transform.size());
+    auto data = oh.get().as<internal::SetTransformData>();
+    EXPECT_EQ(data.type, "set_transform");
+    EXPECT_EQ(data.path, "/drake/" + paths[i]);
+    Eigen::Map<Eigen::Matrix4d> actual(data.matrix);
+    EXPECT_TRUE(CompareMatrices(X_ParentPaths[i].GetAsMatrix4(), actual));
+  }
+
+  // Pending poses do not bring back deleted paths.
+  meshcat.SetTransforms(paths, {RigidTransformd(), RigidTransformd()});
+  meshcat.Delete("frame1");
+  EXPECT_FALSE(meshcat.HasPath("frame1"));
+  EXPECT_TRUE(meshcat.HasPath("frame2"));
+
+  EXPECT_THROW(meshcat.SetTransforms(paths, {RigidTransformd()}),
+               std::exception);
+}
+
 GTEST_TEST(MeshcatTest, Delete) {
   Meshcat meshcat;
   // Ok to delete an empty tree.
@@ -934,7 +967,8 @@ GTEST_TEST(MeshcatTest, SetAnimation) {
   meshcat.SetAnimation(animation);
 
   // The animations will be in lexographical order by path since we're using a
-  // std::map with the path strings as the (sorted) keys.
+  // std::map with the path strings as the (sorted) keys. The unchanging
+  // quaternion keyframe at frame 20 is omitted.
   CheckWebsocketCommand(meshcat, {}, 1, R"""({
       "type": "set_animation",
       "animations": [{
@@ -945,16 +979,8 @@ GTEST_TEST(MeshcatTest, SetAnimation) {
               "tracks": [{
                   "name": ".visible",
                   "type": "boolean",
-                  "keys": [{
-                      "time": 0,
-                      "value": true
-                    },{
-                      "time": 20,
-                      "value": false
-                    },{
-                      "time": 40,
-                      "value": true
-                  }]
+                  "times": [0, 20, 40],
+                  "values": [true, false, true]
               }]
           }
       }, {
@@ -965,16 +991,8 @@ GTEST_TEST(MeshcatTest, SetAnimation) {
               "tracks": [{
                   "name": ".material.opacity",
                   "type": "number",
-                  "keys": [{
-                      "time": 0,
-                      "value": 0.0
-                    },{
-                      "time": 20,
-                      "value": 1.0
-                  },{
-                      "time": 40,
-                      "value": 0.0
-                  }]
+                  "times": [0, 20, 40],
+                  "values": [0.0, 1.0, 0.0]
               }]
           }
       }, {
@@ -985,29 +1003,13 @@ GTEST_TEST(MeshcatTest, SetAnimation) {
               "tracks": [{
                   "name": ".position",
                   "type": "vector3",
-                  "keys": [{
-                      "time": 0,
-                      "value": [0.0, 0.0, 0.0]
-                    },{
-                      "time": 20,
-                      "value": [0.0, 0.0, 1.0]
-                    },{
-                      "time": 40,
-                      "value": [0.0, 0.0, 0.0]
-                  }]
+                  "times": [0, 20, 40],
+                  "values": [0.0, 0.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0]
               }, {
                   "name": ".quaternion",
                   "type": "quaternion",
-                  "keys": [{
-                      "time": 0,
-                      "value": [0.0, 0.0, 0.0, 1.0]
-                    },{
-                      "time": 20,
-                      "value": [0.0, 0.0, 0.0, 1.0]
-                    },{
-                      "time": 40,
-                      "value": [0.0, 0.0, 0.0, 1.0]
-                  }]
+                  "times": [0, 40],
+                  "values": [0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0]
               }]
           }
       }],
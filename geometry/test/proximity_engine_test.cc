@@ -1,9 +1,12 @@
 #include "drake/geometry/proximity_engine.h"
 
+#include <algorithm>
 #include <cmath>
 #include <filesystem>
 #include <fstream>
+#include <string>
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -12,6 +15,7 @@
 #include <gtest/gtest.h>
 
 #include "drake/common/find_resource.h"
+#include "drake/common/ssize.h"
 #include "drake/common/temp_directory.h"
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
 #include "drake/common/test_utilities/expect_no_throw.h"
@@ -50,9 +54,9 @@ class ProximityEngineTester {
   ProximityEngineTester() = delete;
 
   template <typename T>
-  static bool IsDeepCopy(const ProximityEngine<T>& test_engine,
-                         const ProximityEngine<T>& ref_engine) {
-    return ref_engine.IsDeepCopy(test_engine);
+  static bool IsCopy(const ProximityEngine<T>& test_engine,
+                     const ProximityEngine<T>& ref_engine) {
+    return ref_engine.IsCopy(test_engine);
   }
 
   template <typename T>
@@ -697,6 +701,43 @@ GTEST_TEST(ProximityEngineTests, ReplaceProperties) {
   }
 }
 
+// Tests that replacing proximity properties only rebuilds the representations
+// of a geometry when the properties they depend on change.
+GTEST_TEST(ProximityEngineTests, ReplacePropertiesWithoutRebuild) {
+  using PET = ProximityEngineTester;
+  ProximityEngine<double> engine;
+  const double radius = 0.5;
+  InternalGeometry sphere(SourceId::get_new_id(), make_unique<Sphere>(radius),
+                          FrameId::get_new_id(), GeometryId::get_new_id(),
+                          "sphere", RigidTransformd());
+  ProximityProperties rigid_props;
+  AddRigidHydroelasticProperties(3 * radius, &rigid_props);
+  sphere.SetRole(rigid_props);
+
+  // We deliberately register the geometry with the engine *without* the
+  // hydroelastic properties recorded in `sphere`, so that we can observe
+  // whether the representation is rebuilt.
+  engine.AddDynamicGeometry(sphere.shape(), {}, sphere.id(),
+                            ProximityProperties());
+  ASSERT_EQ(PET::hydroelastic_type(sphere.id(), engine),
+            HydroelasticType::kUndefined);
+
+  // Case: only the material group changes; nothing is rebuilt.
+  ProximityProperties new_props(rigid_props);
+  new_props.AddProperty(kMaterialGroup, kHcDissipation, 1.5);
+  DRAKE_EXPECT_NO_THROW(
+      engine.UpdateRepresentationForNewProperties(sphere, new_props));
+  EXPECT_EQ(PET::hydroelastic_type(sphere.id(), engine),
+            HydroelasticType::kUndefined);
+
+  // Case: a hydroelastic property changes; the representation is rebuilt.
+  new_props.UpdateProperty(kHydroGroup, kRezHint, 2 * radius);
+  DRAKE_EXPECT_NO_THROW(
+      engine.UpdateRepresentationForNewProperties(sphere, new_props));
+  EXPECT_EQ(PET::hydroelastic_type(sphere.id(), engine),
+            HydroelasticType::kRigid);
+}
+
 // Removes geometry (dynamic and anchored) from the engine. The test creates
 // a _unique_ engine instance with all dynamic or all anchored geometries.
 // It is not necessary to create a mixed engine because the two geometry
@@ -797,8 +838,9 @@ GTEST_TEST(ProximityEngineTests, FailedParsing) {
 
 // Tests for copy/move semantics.  ---------------------------------------------
 
-// Tests the copy semantics of the ProximityEngine -- the copy is a complete,
-// deep copy. Every type of shape specification must be included in this test.
+// Tests the copy semantics of the ProximityEngine -- the copy has its own
+// collision objects, but shares their geometry. Every type of shape
+// specification must be included in this test.
 GTEST_TEST(ProximityEngineTests, CopySemantics) {
   ProximityEngine<double> ref_engine;
   Sphere sphere{0.5};
@@ -830,11 +872,11 @@ GTEST_TEST(ProximityEngineTests, CopySemantics) {
   ref_engine.AddDynamicGeometry(convex, pose, GeometryId::get_new_id());
 
   ProximityEngine<double> copy_construct(ref_engine);
-  ProximityEngineTester::IsDeepCopy(copy_construct, ref_engine);
+  EXPECT_TRUE(ProximityEngineTester::IsCopy(copy_construct, ref_engine));
 
   ProximityEngine<double> copy_assign;
   copy_assign = ref_engine;
-  ProximityEngineTester::IsDeepCopy(copy_assign, ref_engine);
+  EXPECT_TRUE(ProximityEngineTester::IsCopy(copy_assign, ref_engine));
 }
 
 // Tests the move semantics of the ProximityEngine -- the source is restored to
@@ -954,6 +996,49 @@ GTEST_TEST(ProximityEngineTests, SignedDistanceClosestPointsMaxDistance) {
   }
 }
 
+// Tests that evaluating the candidate pairs in parallel produces exactly the
+// same results (values and order) as the serial evaluation, including the
+// max_distance culling and interactions with anchored geometries.
+GTEST_TEST(ProximityEngineTests, SignedDistanceClosestPointsParallel) {
+  ProximityEngine<double> engine;
+  unordered_map<GeometryId, RigidTransformd> X_WGs;
+
+  const double radius = 0.25;
+  const Sphere sphere{radius};
+  const Box box{0.3, 0.4, 0.5};
+  for (int i = 0; i < 10; ++i) {
+    const GeometryId id = GeometryId::get_new_id();
+    X_WGs[id] = RigidTransformd{RollPitchYawd(0.1 * i, 0.2 * i, 0.3 * i),
+                                Vector3d(0.4 * i, 0.1 * (i % 3), 0.05 * i)};
+    if (i % 2 == 0) {
+      engine.AddDynamicGeometry(sphere, {}, id);
+    } else {
+      engine.AddDynamicGeometry(box, {}, id);
+    }
+  }
+  const GeometryId anchored_id = GeometryId::get_new_id();
+  X_WGs[anchored_id] = RigidTransformd{Vector3d(0, 0, -1)};
+  engine.AddAnchoredGeometry(Sphere(0.5), X_WGs.at(anchored_id), anchored_id);
+  engine.UpdateWorldPoses(X_WGs);
+
+  for (const double max_distance : {kInf, 0.5}) {
+    const auto serial = engine.ComputeSignedDistancePairwiseClosestPoints(
+        X_WGs, max_distance, Parallelism::None());
+    const auto parallel = engine.ComputeSignedDistancePairwiseClosestPoints(
+        X_WGs, max_distance, Parallelism(4));
+    ASSERT_GT(serial.size(), 0);
+    ASSERT_EQ(parallel.size(), serial.size());
+    for (int i = 0; i < ssize(serial); ++i) {
+      EXPECT_EQ(parallel[i].id_A, serial[i].id_A);
+      EXPECT_EQ(parallel[i].id_B, serial[i].id_B);
+      EXPECT_EQ(parallel[i].distance, serial[i].distance);
+      EXPECT_TRUE(CompareMatrices(parallel[i].p_ACa, serial[i].p_ACa));
+      EXPECT_TRUE(CompareMatrices(parallel[i].p_BCb, serial[i].p_BCb));
+      EXPECT_TRUE(CompareMatrices(parallel[i].nhat_BA_W, serial[i].nhat_BA_W));
+    }
+  }
+}
+
 // Tests the computation of signed distance for a single geometry pair. Confirms
 // successful case as well as failure case.
 GTEST_TEST(ProximityEngineTests, SignedDistancePairClosestPoint) {
@@ -1141,6 +1226,53 @@ GTEST_TEST(SignedDistanceToPointBroadphaseTest, MultipleThreshold) {
   EXPECT_EQ(2, results.size());
 }
 
+// Mesh and Convex geometries are ignored by ComputeSignedDistanceToPoint()
+// unless their proximity properties request a signed distance field, in which
+// case the field reports their distances.
+GTEST_TEST(SignedDistanceToPointBroadphaseTest, SignedDistanceField) {
+  // The file "quad_cube.obj" contains the cube [-1, 1]³.
+  const std::string filename =
+      drake::FindResourceOrThrow("drake/geometry/test/quad_cube.obj");
+  ProximityProperties sdf_properties;
+  AddSignedDistanceFieldProperties(0.25, &sdf_properties);
+  ProximityEngine<double> engine;
+  const GeometryId mesh_id = GeometryId::get_new_id();
+  const GeometryId convex_id = GeometryId::get_new_id();
+  const GeometryId plain_id = GeometryId::get_new_id();
+  const unordered_map<GeometryId, RigidTransformd> X_WGs{
+      {mesh_id, RigidTransformd(Vector3d(0, 0, 0))},
+      {convex_id, RigidTransformd(Vector3d(0, 5, 0))},
+      {plain_id, RigidTransformd(Vector3d(0, -5, 0))}};
+  engine.AddDynamicGeometry(Mesh(filename), {}, mesh_id, sdf_properties);
+  engine.AddAnchoredGeometry(Convex(filename), X_WGs.at(convex_id), convex_id,
+                             sdf_properties);
+  engine.AddDynamicGeometry(Mesh(filename), {}, plain_id);
+  engine.UpdateWorldPoses(X_WGs);
+
+  // The query point is equidistant from the nearest edges of the two field
+  // cubes; the third cube is ignored.
+  const Vector3d p_WQ(1.5, 2.5, 0.1);
+  std::vector<SignedDistanceToPoint<double>> results =
+      engine.ComputeSignedDistanceToPoint(p_WQ, X_WGs, kInf);
+  ASSERT_EQ(results.size(), 2u);
+  std::sort(results.begin(), results.end(),
+            [](const auto& a, const auto& b) { return a.id_G < b.id_G; });
+  EXPECT_EQ(results[0].id_G, mesh_id);
+  EXPECT_EQ(results[1].id_G, convex_id);
+  for (const SignedDistanceToPoint<double>& result : results) {
+    EXPECT_NEAR(result.distance, std::sqrt(0.5 * 0.5 + 1.5 * 1.5), 0.25);
+  }
+
+  // The threshold applies to field distances.
+  EXPECT_EQ(engine.ComputeSignedDistanceToPoint(p_WQ, X_WGs, 1.0).size(), 0u);
+
+  // Removing a geometry removes its field.
+  engine.RemoveGeometry(mesh_id, true);
+  results = engine.ComputeSignedDistanceToPoint(p_WQ, X_WGs, kInf);
+  ASSERT_EQ(results.size(), 1u);
+  EXPECT_EQ(results[0].id_G, convex_id);
+}
+
 // Test the narrow-phase part of ComputeSignedDistanceToPoint.
 
 // Parameter for the value-parameterized test fixture SignedDistanceToPointTest.
@@ -2025,6 +2157,35 @@ GTEST_TEST(ProximityEngineTests, PenetrationAsPointPairResultOrdering) {
   }
 }
 
+// Confirms that computing the point pair penetrations in parallel produces
+// exactly the same results (in the same order) as the serial computation.
+GTEST_TEST(ProximityEngineTests, ComputePointPairPenetrationParallel) {
+  ProximityEngine<double> engine;
+
+  const double r = 0.5;
+  unordered_map<GeometryId, RigidTransformd> poses = MakeCollidingRing(r, 8);
+  const Sphere sphere{r};
+  for (const auto& pair : poses) {
+    engine.AddDynamicGeometry(sphere, {}, pair.first);
+  }
+  engine.UpdateWorldPoses(poses);
+
+  const auto serial =
+      engine.ComputePointPairPenetration(poses, Parallelism::None());
+  const auto parallel =
+      engine.ComputePointPairPenetration(poses, Parallelism(4));
+  ASSERT_EQ(serial.size(), poses.size());
+  ASSERT_EQ(parallel.size(), serial.size());
+  for (size_t i = 0; i < serial.size(); ++i) {
+    EXPECT_EQ(parallel[i].id_A, serial[i].id_A);
+    EXPECT_EQ(parallel[i].id_B, serial[i].id_B);
+    EXPECT_EQ(parallel[i].depth, serial[i].depth);
+    EXPECT_TRUE(CompareMatrices(parallel[i].p_WCa, serial[i].p_WCa));
+    EXPECT_TRUE(CompareMatrices(parallel[i].p_WCb, serial[i].p_WCb));
+    EXPECT_TRUE(CompareMatrices(parallel[i].nhat_BA_W, serial[i].nhat_BA_W));
+  }
+}
+
 // Confirms that the FindCollisionCandidates() computation returns the
 // same results twice in a row. This test is explicitly required because it is
 // known that updating the pose in the FCL tree can lead to erratic ordering.
@@ -2053,6 +2214,55 @@ GTEST_TEST(ProximityEngineTests, FindCollisionCandidatesResultOrdering) {
   }
 }
 
+// Confirms that the subset variants of FindCollisionCandidates() and
+// HasCollisions() report exactly those pairs of the full query that include at
+// least one geometry of the subset, for every subset of a scene with both
+// dynamic and anchored geometries.
+GTEST_TEST(ProximityEngineTests, FindCollisionCandidatesSubset) {
+  ProximityEngine<double> engine;
+
+  const double r = 0.5;
+  unordered_map<GeometryId, RigidTransformd> poses = MakeCollidingRing(r, 4);
+  const Sphere sphere{r};
+  std::vector<GeometryId> ids;
+  for (const auto& [id, X_WG] : poses) {
+    engine.AddDynamicGeometry(sphere, {}, id);
+    ids.push_back(id);
+  }
+  // An anchored sphere that only collides with the first dynamic sphere.
+  const GeometryId anchored_id = GeometryId::get_new_id();
+  const RigidTransformd X_WA(poses.at(ids[0]).translation() +
+                             Vector3d(0, 0, 1.5 * r));
+  engine.AddAnchoredGeometry(sphere, X_WA, anchored_id);
+  ids.push_back(anchored_id);
+  engine.UpdateWorldPoses(poses);
+
+  const auto all_candidates = engine.FindCollisionCandidates();
+  // At least the four ring contacts and the anchored contact.
+  ASSERT_GE(all_candidates.size(), 5);
+
+  const int num_subsets = 1 << ids.size();
+  for (int mask = 0; mask < num_subsets; ++mask) {
+    std::unordered_set<GeometryId> subset;
+    for (int i = 0; i < ssize(ids); ++i) {
+      if (mask & (1 << i)) subset.insert(ids[i]);
+    }
+    std::vector<SortedPair<GeometryId>> expected;
+    for (const auto& pair : all_candidates) {
+      if (subset.contains(pair.first()) || subset.contains(pair.second())) {
+        expected.push_back(pair);
+      }
+    }
+    EXPECT_EQ(engine.FindCollisionCandidates(subset), expected);
+    EXPECT_EQ(engine.HasCollisions(subset), !expected.empty());
+  }
+
+  // Unregistered ids are ignored.
+  EXPECT_TRUE(engine.FindCollisionCandidates({GeometryId::get_new_id()})
+                  .empty());
+  EXPECT_FALSE(engine.HasCollisions({GeometryId::get_new_id()}));
+}
+
 // Confirms that the ComputeContactSurfaces() computation returns the
 // same results twice in a row. This test is explicitly required because it is
 // known that updating the pose in the FCL tree can lead to erratic ordering.
@@ -2110,6 +2320,25 @@ TEST_F(ProximityEngineHydro, ComputeContactSurfacesResultOrdering) {
   }
 }
 
+// Confirms that computing the contact surfaces in parallel produces exactly
+// the same results as the serial computation.
+TEST_F(ProximityEngineHydro, ComputeContactSurfacesParallel) {
+  engine_.UpdateWorldPoses(poses_);
+  for (const auto representation :
+       {HydroelasticContactRepresentation::kTriangle,
+        HydroelasticContactRepresentation::kPolygon}) {
+    const auto serial = engine_.ComputeContactSurfaces(
+        representation, poses_, Parallelism::None());
+    const auto parallel =
+        engine_.ComputeContactSurfaces(representation, poses_, Parallelism(4));
+    ASSERT_EQ(serial.size(), poses_.size());
+    ASSERT_EQ(parallel.size(), serial.size());
+    for (size_t i = 0; i < serial.size(); ++i) {
+      EXPECT_TRUE(parallel[i].Equal(serial[i]));
+    }
+  }
+}
+
 // Confirms that the ComputeContactSurfacesWithFallback() computation returns
 // the same results twice in a row. This test is explicitly required because it
 // is known that updating the pose in the FCL tree can lead to erratic ordering.
@@ -2196,6 +2425,40 @@ TEST_F(ProximityEngineHydroWithFallback,
   }
 }
 
+// Confirms that evaluating the pairs in parallel produces exactly the same
+// surfaces and point pairs as the serial computation.
+TEST_F(ProximityEngineHydroWithFallback,
+       ComputeContactSurfacesWithFallbackParallel) {
+  engine_.UpdateWorldPoses(poses_);
+  vector<ContactSurface<double>> serial_surfaces;
+  vector<PenetrationAsPointPair<double>> serial_points;
+  engine_.ComputeContactSurfacesWithFallback(
+      HydroelasticContactRepresentation::kTriangle, poses_, &serial_surfaces,
+      &serial_points, Parallelism::None());
+  vector<ContactSurface<double>> parallel_surfaces;
+  vector<PenetrationAsPointPair<double>> parallel_points;
+  engine_.ComputeContactSurfacesWithFallback(
+      HydroelasticContactRepresentation::kTriangle, poses_, &parallel_surfaces,
+      &parallel_points, Parallelism(4));
+
+  ASSERT_EQ(serial_surfaces.size(), N_ - 2);
+  ASSERT_EQ(parallel_surfaces.size(), serial_surfaces.size());
+  for (size_t i = 0; i < serial_surfaces.size(); ++i) {
+    EXPECT_TRUE(parallel_surfaces[i].Equal(serial_surfaces[i]));
+  }
+  ASSERT_EQ(serial_points.size(), 2);
+  ASSERT_EQ(parallel_points.size(), serial_points.size());
+  for (size_t i = 0; i < serial_points.size(); ++i) {
+    EXPECT_EQ(parallel_points[i].id_A, serial_points[i].id_A);
+    EXPECT_EQ(parallel_points[i].id_B, serial_points[i].id_B);
+    EXPECT_EQ(parallel_points[i].depth, serial_points[i].depth);
+    EXPECT_TRUE(CompareMatrices(parallel_points[i].p_WCa,
+                                serial_points[i].p_WCa));
+    EXPECT_TRUE(CompareMatrices(parallel_points[i].p_WCb,
+                                serial_points[i].p_WCb));
+  }
+}
+
 // These tests validate collisions/distance between spheres. This does *not*
 // test against other geometry types because we assume FCL works. This merely
 // confirms that the ProximityEngine functions provide the correct mapping.
@@ -1,10 +1,14 @@
 #include "drake/geometry/read_obj.h"
 
+#include <fstream>
+#include <string>
 #include <unordered_set>
 
 #include <gtest/gtest.h>
 
 #include "drake/common/find_resource.h"
+#include "drake/common/temp_directory.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
 
 namespace drake {
 namespace geometry {
@@ -135,6 +139,50 @@ GTEST_TEST(ReadObjFile, NonconvexMesh) {
     }
   }
 }
+
+void WriteFile(const std::string& filename, const std::string& contents) {
+  std::ofstream file(filename);
+  file << contents;
+}
+
+GTEST_TEST(ReadObjGeometry, Cache) {
+  const std::string filename = temp_directory() + "/cached.obj";
+  WriteFile(filename, "v 0 0 0\nv 1 0 0\nv 0 1 0\nv 1 1 0\nf 1 2 4 3\n");
+  std::string error;
+  const std::shared_ptr<const ObjGeometry> first =
+      ReadObjGeometry(filename, false /* triangulate */, &error);
+  ASSERT_NE(first, nullptr);
+  EXPECT_EQ(first->vertices.size(), 12);
+  ASSERT_EQ(first->shapes.size(), 1);
+  EXPECT_EQ(first->shapes[0].face_sizes, std::vector<int>({4}));
+  EXPECT_EQ(first->shapes[0].indices, std::vector<int>({0, 1, 3, 2}));
+
+  // Reading the same file again reuses the parsed data, but only for the same
+  // triangulation.
+  EXPECT_EQ(ReadObjGeometry(filename, false, &error), first);
+  const std::shared_ptr<const ObjGeometry> triangulated =
+      ReadObjGeometry(filename, true, &error);
+  ASSERT_NE(triangulated, nullptr);
+  EXPECT_NE(triangulated, first);
+  EXPECT_EQ(triangulated->shapes[0].face_sizes, std::vector<int>({3, 3}));
+
+  // Changing the file invalidates the parsed data.
+  WriteFile(filename, "v 0 0 0\nv 2 0 0\nv 0 2 0\nf 1 2 3\n");
+  const std::shared_ptr<const ObjGeometry> second =
+      ReadObjGeometry(filename, false, &error);
+  ASSERT_NE(second, nullptr);
+  EXPECT_EQ(second->vertices.size(), 9);
+  EXPECT_EQ(second->vertices[3], 2.0);
+  const auto [vertices, faces, num_faces] = ReadObjFile(filename, 0.5, false);
+  EXPECT_EQ((*vertices)[1], Eigen::Vector3d(1, 0, 0));
+  EXPECT_EQ(*faces, std::vector<int>({3, 0, 1, 2}));
+  EXPECT_EQ(num_faces, 1);
+
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      ReadObjGeometry(temp_directory() + "/missing.obj", false, &error),
+      "Cannot open file '.*missing.obj'");
+}
+
 }  // namespace
 }  // namespace internal
 }  // namespace geometry
@@ -1,8 +1,13 @@
 #include "drake/lcm/drake_lcm.h"
 
 #include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <cstdlib>
+#include <mutex>
 #include <stdexcept>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -36,7 +41,8 @@ class DrakeLcm::Impl {
   explicit Impl(const DrakeLcmParams& params)
       : requested_lcm_url_(params.lcm_url),
         deferred_initialization_(params.defer_initialization),
-        channel_suffix_(params.channel_suffix) {
+        channel_suffix_(params.channel_suffix),
+        in_background_(params.handle_subscriptions_in_background) {
     // This duplicates logic from external/lcm/lcm.c, but until LCM offers an
     // API for this it's the best we can do.
     lcm_url_ = requested_lcm_url_;
@@ -78,6 +84,44 @@ class DrakeLcm::Impl {
         subscriptions_.end());
   }
 
+  // Launches the background receive thread, if requested and not yet running.
+  void StartReceiveThreadIfNeeded() {
+    if (!in_background_ || receive_thread_.joinable()) {
+      return;
+    }
+    receive_thread_ = std::thread([this]() {
+      // Wake up periodically to check whether we've been asked to stop.
+      constexpr int kPollMillis = 50;
+      while (!stop_receive_thread_.load()) {
+        if (::lcm_handle_timeout(lcm_, kPollMillis) > 0) {
+          {
+            std::lock_guard<std::mutex> guard(mutex_);
+            ++num_received_;
+          }
+          received_.notify_all();
+        }
+      }
+    });
+  }
+
+  void StopReceiveThread() {
+    if (receive_thread_.joinable()) {
+      stop_receive_thread_ = true;
+      receive_thread_.join();
+    }
+  }
+
+  // Waits up to timeout_millis for the receive thread to have handled a
+  // message, and returns the number it handled since the prior call.
+  int WaitForReceived(int timeout_millis) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    received_.wait_for(lock, std::chrono::milliseconds(timeout_millis),
+                       [this]() {
+                         return num_received_ > 0;
+                       });
+    return std::exchange(num_received_, 0);
+  }
+
   const std::string requested_lcm_url_;
   std::string lcm_url_;
   bool deferred_initialization_{};
@@ -85,6 +129,16 @@ class DrakeLcm::Impl {
   std::unique_ptr<::lcm::LCM> lcm_cpp_;  // Typically nullptr.
   const std::string channel_suffix_;
   std::vector<std::weak_ptr<DrakeSubscription>> subscriptions_;
+  const bool in_background_;
+
+  // The background receive thread (when in_background_ is set) and its
+  // bookkeeping. The mutex guards num_received_ and the error message, since
+  // both are written by handlers on the receive thread.
+  std::thread receive_thread_;
+  std::atomic<bool> stop_receive_thread_{false};
+  std::mutex mutex_;
+  std::condition_variable received_;
+  int num_received_{0};
   std::string handle_subscriptions_error_message_;
 };
 
@@ -101,6 +155,7 @@ DrakeLcm::DrakeLcm(const DrakeLcmParams& params)
     // ThreadSanitizer builds may report false positives related to the
     // self-test happening concurrently with LCM publishing.
     ::lcm_get_fileno(impl_->lcm_);
+    impl_->StartReceiveThreadIfNeeded();
   }
 }
 
@@ -341,6 +396,20 @@ int DrakeLcm::HandleSubscriptions(int timeout_millis) {
     }
     impl_->deferred_initialization_ = false;
   }
+  if (impl_->in_background_) {
+    impl_->StartReceiveThreadIfNeeded();
+    const int total_messages = impl_->WaitForReceived(timeout_millis);
+    std::string message;
+    {
+      std::lock_guard<std::mutex> guard(impl_->mutex_);
+      message = std::move(impl_->handle_subscriptions_error_message_);
+      impl_->handle_subscriptions_error_message_ = {};
+    }
+    if (!message.empty()) {
+      throw std::runtime_error(std::move(message));
+    }
+    return total_messages;
+  }
   // Keep pumping handleTimeout until it's empty, but only pause for the
   // timeout on the first attempt.
   int total_messages = 0;
@@ -363,10 +432,13 @@ void DrakeLcm::OnHandleSubscriptionsError(const std::string& error_message) {
   // Stash the exception message for later.  This is "last one wins" if there
   // are multiple errors.  We can only throw one anyway, and doesn't matter
   // which one we throw.
+  std::lock_guard<std::mutex> guard(impl_->mutex_);
   impl_->handle_subscriptions_error_message_ = error_message;
 }
 
 DrakeLcm::~DrakeLcm() {
+  // No handler may be in flight while we tear down the subscriptions.
+  impl_->StopReceiveThread();
   // Invalidate our DrakeSubscription objects.
   for (const auto& weak_subscription : impl_->subscriptions_) {
     auto subscription = weak_subscription.lock();
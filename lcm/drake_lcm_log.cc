@@ -1,6 +1,8 @@
 #include "drake/lcm/drake_lcm_log.h"
 
+#include <algorithm>
 #include <chrono>
+#include <cstdio>
 #include <limits>
 #include <map>
 #include <stdexcept>
@@ -24,6 +26,36 @@ class DrakeLcmLog::Impl {
   std::vector<MultichannelHandlerFunction> multichannel_subscriptions_;
   std::unique_ptr<::lcm::LogFile> log_;
   const ::lcm::LogEvent* next_event_{nullptr};
+
+  // The timestamp and file offset of every event in the log, in file order.
+  // This is built on the first call to SeekToTime().
+  struct IndexEntry {
+    int64_t timestamp{};
+    int64_t offset{};
+  };
+  std::vector<IndexEntry> index_;
+  bool index_is_built_{false};
+
+  // Reads through the whole log once to build `index_`. Leaves the read
+  // position of the log unspecified.
+  void BuildIndexIfNeeded() {
+    if (index_is_built_) {
+      return;
+    }
+    FILE* const file = log_->getFilePtr();
+    if (fseeko(file, 0, SEEK_SET) != 0) {
+      throw std::runtime_error("Failed to seek in the log file.");
+    }
+    while (true) {
+      const int64_t offset = ftello(file);
+      const ::lcm::LogEvent* event = log_->readNextEvent();
+      if (event == nullptr) {
+        break;
+      }
+      index_.push_back({event->timestamp, offset});
+    }
+    index_is_built_ = true;
+  }
 };
 
 DrakeLcmLog::DrakeLcmLog(const std::string& file_name, bool is_write,
@@ -153,6 +185,29 @@ void DrakeLcmLog::DispatchMessageAndAdvanceLog(double current_time) {
   impl_->next_event_ = impl_->log_->readNextEvent();
 }
 
+void DrakeLcmLog::SeekToTime(double time_sec) {
+  if (is_write_) {
+    throw std::logic_error("SeekToTime is only available for log playback.");
+  }
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  impl_->BuildIndexIfNeeded();
+  const std::vector<Impl::IndexEntry>& index = impl_->index_;
+  const auto iter = std::lower_bound(
+      index.begin(), index.end(), time_sec,
+      [this](const Impl::IndexEntry& entry, double time) {
+        return timestamp_to_second(entry.timestamp) < time;
+      });
+  if (iter == index.end()) {
+    impl_->next_event_ = nullptr;
+    return;
+  }
+  if (fseeko(impl_->log_->getFilePtr(), iter->offset, SEEK_SET) != 0) {
+    throw std::runtime_error("Failed to seek in the log file.");
+  }
+  impl_->next_event_ = impl_->log_->readNextEvent();
+}
+
 void DrakeLcmLog::OnHandleSubscriptionsError(const std::string& error_message) {
   // We are not called via LCM C code, so it's safe to throw there.
   throw std::runtime_error(error_message);
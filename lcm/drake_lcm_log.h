@@ -117,6 +117,22 @@ class DrakeLcmLog : public DrakeLcmInterface {
    */
   void DispatchMessageAndAdvanceLog(double current_time);
 
+  /**
+   * Moves the log so that the next message is the first one whose time is
+   * greater than or equal to @p time_sec, or to the end of the log if there is
+   * no such message. This allows replaying a segment of a long log without
+   * dispatching everything before it. Seeking backwards is supported too.
+   *
+   * The first call reads through the whole log once to index the time and
+   * file position of each message; subsequent calls only look up that index.
+   *
+   * @pre The message times in the log are non-decreasing, as is the case for
+   * logs written by lcm-logger or by this class.
+   * @throws std::exception if this instance is not constructed in read-only
+   * mode.
+   */
+  void SeekToTime(double time_sec);
+
   /**
    * Returns true if this instance is constructed in write-only mode.
    */
@@ -17,6 +17,7 @@ struct DrakeLcmParams {
     a->Visit(DRAKE_NVP(lcm_url));
     a->Visit(DRAKE_NVP(channel_suffix));
     a->Visit(DRAKE_NVP(defer_initialization));
+    a->Visit(DRAKE_NVP(handle_subscriptions_in_background));
   }
 
   /** The URL for DrakeLcm communication. If empty, DrakeLcm will use the
@@ -48,6 +49,19 @@ struct DrakeLcmParams {
   configuration for new threads varies between the construction time and first
   use. */
   bool defer_initialization{false};
+
+  /** (Advanced) When true, DrakeLcm launches its own thread that receives
+  messages and calls the subscription handlers as soon as they arrive, so that
+  decoding happens off of the thread that calls DrakeLcm::HandleSubscriptions().
+  HandleSubscriptions() then only waits (up to its timeout) for at least one
+  message to have been handled since its prior call, and returns the number of
+  messages handled in the meantime.
+
+  All handlers must therefore be safe to call from the receive thread; the
+  handlers installed by systems::lcm::LcmSubscriberSystem are. Since each
+  subscription's queue capacity defaults to 1, a handler that falls behind
+  sees only the most recent message on its channel. */
+  bool handle_subscriptions_in_background{false};
 };
 
 }  // namespace lcm
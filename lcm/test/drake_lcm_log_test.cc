@@ -1,5 +1,6 @@
 #include "drake/lcm/drake_lcm_log.h"
 
+#include <limits>
 #include <memory>
 #include <utility>
 
@@ -65,6 +66,45 @@ GTEST_TEST(LcmLogTest, LcmLogTestSaveAndRead) {
   EXPECT_TRUE(multichannel_received);
 }
 
+// Plays back segments of a log out of order.
+GTEST_TEST(LcmLogTest, SeekToTime) {
+  auto w_log = std::make_unique<DrakeLcmLog>("seek_test.log", true);
+  lcmt_drake_signal msg{};
+  for (int i = 1; i <= 5; ++i) {
+    msg.timestamp = i;
+    Publish(w_log.get(), "channel", msg, 1.0 * i);
+  }
+  w_log.reset();
+
+  auto r_log = std::make_unique<DrakeLcmLog>("seek_test.log", false);
+  int64_t received = 0;
+  Subscribe(r_log.get(), "channel",
+            std::function{[&received](const lcmt_drake_signal& message) {
+              received = message.timestamp;
+            }});
+
+  r_log->SeekToTime(2.5);
+  EXPECT_EQ(r_log->GetNextMessageTime(), 3.0);
+  r_log->DispatchMessageAndAdvanceLog(3.0);
+  EXPECT_EQ(received, 3);
+  EXPECT_EQ(r_log->GetNextMessageTime(), 4.0);
+
+  // Seeking backwards, and to a time with a message.
+  r_log->SeekToTime(2.0);
+  r_log->DispatchMessageAndAdvanceLog(2.0);
+  EXPECT_EQ(received, 2);
+  r_log->SeekToTime(-1.0);
+  EXPECT_EQ(r_log->GetNextMessageTime(), 1.0);
+
+  // Seeking past the last message.
+  r_log->SeekToTime(5.5);
+  EXPECT_EQ(r_log->GetNextMessageTime(),
+            std::numeric_limits<double>::infinity());
+
+  auto w_only = std::make_unique<DrakeLcmLog>("seek_test.log", true);
+  EXPECT_THROW(w_only->SeekToTime(0.0), std::exception);
+}
+
 }  // namespace
 }  // namespace lcm
 }  // namespace drake
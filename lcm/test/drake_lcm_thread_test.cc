@@ -108,6 +108,32 @@ TEST_F(DrakeLcmThreadTest, PubSubTest) {
   });
 }
 
+// Tests that with handle_subscriptions_in_background the handlers are called
+// without anyone calling HandleSubscriptions(), which then reports the count.
+TEST_F(DrakeLcmThreadTest, BackgroundReceiveTest) {
+  const std::string channel_name = "DrakeLcmThreadTest.BackgroundReceiveTest";
+  DrakeLcm dut({.handle_subscriptions_in_background = true});
+  MessageMailbox mailbox;
+  dut.Subscribe(channel_name, [&mailbox](const void* data, int size) {
+    lcmt_drake_signal decoded{};
+    decoded.decode(data, 0, size);
+    mailbox.SetMessage(decoded);
+  });
+
+  // Try until we're either done, or we timeout (5 seconds).
+  const std::chrono::milliseconds kDelay(50);
+  const int kMaxCount = 100;
+  bool message_was_received = false;
+  for (int count = 0; !message_was_received && count < kMaxCount; ++count) {
+    Publish(&dut, channel_name, message_);
+    std::this_thread::sleep_for(kDelay);
+    message_was_received =
+        CompareLcmtDrakeSignalMessages(mailbox.GetMessage(), message_);
+  }
+  EXPECT_TRUE(message_was_received);
+  EXPECT_GT(dut.HandleSubscriptions(0), 0);
+}
+
 }  // namespace
 }  // namespace lcm
 }  // namespace drake
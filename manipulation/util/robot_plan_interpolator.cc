@@ -1,5 +1,6 @@
 #include "drake/manipulation/util/robot_plan_interpolator.h"
 
+#include <algorithm>
 #include <map>
 #include <memory>
 #include <set>
@@ -22,19 +23,38 @@ using multibody::BodyIndex;
 using multibody::JointIndex;
 using trajectories::PiecewisePolynomial;
 
-// TODO(sammy-tri) If we had version of Trajectory which supported
-// outputting the derivatives in value(), we could avoid keeping track
-// of multiple polynomials below.
 struct RobotPlanInterpolator::PlanData {
   PlanData() {}
 
   double start_time{0};
   std::vector<char> encoded_msg;
+  // Scratch space for encoding the input message, so that checking for a new
+  // message does not allocate once the buffer has grown to the message size.
+  std::vector<char> new_encoded_msg;
   PiecewisePolynomial<double> pp;
-  PiecewisePolynomial<double> pp_deriv;
-  PiecewisePolynomial<double> pp_double_deriv;
 };
 
+namespace {
+
+// Writes the `derivative_order` derivative of `pp` at `t` into `result`. This
+// matches pp.EvalDerivative(t, derivative_order) (including the clamping of
+// `t` to the time span of `pp`), but differentiates the segment polynomials
+// in place instead of allocating a matrix or a derivative trajectory.
+void EvalDerivativeInto(const PiecewisePolynomial<double>& pp, double t,
+                        int derivative_order,
+                        Eigen::Ref<VectorX<double>> result) {
+  DRAKE_DEMAND(result.size() == pp.rows());
+  t = std::clamp(t, pp.start_time(), pp.end_time());
+  const int segment_index = pp.get_segment_index(t);
+  const double segment_time = t - pp.start_time(segment_index);
+  for (int i = 0; i < result.size(); ++i) {
+    result[i] = pp.getPolynomial(segment_index, i, 0)
+                    .EvaluateUnivariate(segment_time, derivative_order);
+  }
+}
+
+}  // namespace
+
 RobotPlanInterpolator::RobotPlanInterpolator(const std::string& model_path,
                                              const InterpolatorType interp_type,
                                              double update_interval)
@@ -111,9 +131,10 @@ void RobotPlanInterpolator::OutputState(
   Eigen::VectorBlock<VectorX<double>> output_vec = output->get_mutable_value();
 
   const double current_plan_time = context.get_time() - plan.start_time;
-  output_vec.head(plant_.num_positions()) = plan.pp.value(current_plan_time);
-  output_vec.tail(plant_.num_velocities()) =
-      plan.pp_deriv.value(current_plan_time);
+  EvalDerivativeInto(plan.pp, current_plan_time, 0,
+                     output_vec.head(plant_.num_positions()));
+  EvalDerivativeInto(plan.pp, current_plan_time, 1,
+                     output_vec.tail(plant_.num_velocities()));
 }
 
 void RobotPlanInterpolator::OutputAccel(
@@ -127,11 +148,11 @@ void RobotPlanInterpolator::OutputAccel(
       output->get_mutable_value();
 
   const double current_plan_time = context.get_time() - plan.start_time;
-  output_acceleration_vec = plan.pp_double_deriv.value(current_plan_time);
-
   // Stop outputting accelerations at the end of the plan.
-  if (current_plan_time > plan.pp_double_deriv.end_time()) {
+  if (current_plan_time > plan.pp.end_time()) {
     output_acceleration_vec.fill(0);
+  } else {
+    EvalDerivativeInto(plan.pp, current_plan_time, 2, output_acceleration_vec);
   }
 }
 
@@ -146,8 +167,6 @@ void RobotPlanInterpolator::MakeFixedPlan(double plan_start_time,
   std::vector<double> times{0., 1.};
   plan.start_time = plan_start_time;
   plan.pp = PiecewisePolynomial<double>::ZeroOrderHold(times, knots);
-  plan.pp_deriv = plan.pp.derivative();
-  plan.pp_double_deriv = plan.pp_deriv.derivative();
   drake::log()->info("Generated fixed plan at {}", fmt_eigen(q0.transpose()));
 }
 
@@ -169,7 +188,8 @@ systems::EventStatus RobotPlanInterpolator::UpdatePlanOnNewMessage(
   // I (sammy-tri) wish I could think of a more effective way to
   // determine that a new message has arrived, but unfortunately
   // this is the best I've got.
-  std::vector<char> encoded_msg(plan_input.getEncodedSize());
+  std::vector<char>& encoded_msg = plan.new_encoded_msg;
+  encoded_msg.resize(plan_input.getEncodedSize());
   plan_input.encode(encoded_msg.data(), 0, encoded_msg.size());
   if (encoded_msg == plan.encoded_msg) {
     return systems::EventStatus::DidNothing();
@@ -224,8 +244,6 @@ systems::EventStatus RobotPlanInterpolator::UpdatePlanOnNewMessage(
                 input_time, knots, knot_dot, knot_dot);
         break;
     }
-    plan.pp_deriv = plan.pp.derivative();
-    plan.pp_double_deriv = plan.pp_deriv.derivative();
   }
 
   return systems::EventStatus::Succeeded();
@@ -3,6 +3,7 @@
 #include <gtest/gtest.h>
 
 #include "drake/common/find_resource.h"
+#include "drake/common/test_utilities/limit_malloc.h"
 #include "drake/lcmt_robot_plan.hpp"
 
 namespace drake {
@@ -152,6 +153,12 @@ void DoTrajectoryTest(InterpolatorType interp_type) {
   for (const TrajectoryTestCase& kase : cases) {
     context->SetTime(kase.time);
     dut.UpdatePlan(context.get());
+    {
+      // Evaluating the outputs should not have any dynamic allocations.
+      drake::test::LimitMalloc guard({.max_num_allocations = 0});
+      dut.get_state_output_port().Eval(*context);
+      dut.get_acceleration_output_port().Eval(*context);
+    }
     dut.CalcOutput(*context, output.get());
     const double position =
         output->get_vector_data(dut.get_state_output_port().get_index())
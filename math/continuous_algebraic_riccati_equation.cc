@@ -1,13 +1,73 @@
 #include "drake/math/continuous_algebraic_riccati_equation.h"
 
+#include <algorithm>
+#include <exception>
 #include <optional>
 
 #include "drake/common/drake_assert.h"
 #include "drake/common/is_approx_equal_abstol.h"
+#include "drake/common/parallel_for.h"
+#include "drake/math/continuous_lyapunov_equation.h"
 #include "drake/systems/primitives/linear_system_internal.h"
 
 namespace drake {
 namespace math {
+namespace {
+
+// Refines the guess S_guess of the stabilizing solution by Newton-Kleinman
+// iterations: for the gain K = R⁻¹BᵀS, each iteration solves the Lyapunov
+// equation (A − BK)ᵀS⁺ + S⁺(A − BK) + Q + KᵀRK = 0. Returns nullopt if the
+// initial gain does not stabilize (A, B), or if the iterations fail to
+// converge.
+std::optional<Eigen::MatrixXd> SolveByNewtonKleinman(
+    const Eigen::Ref<const Eigen::MatrixXd>& A,
+    const Eigen::Ref<const Eigen::MatrixXd>& B,
+    const Eigen::Ref<const Eigen::MatrixXd>& Q,
+    const Eigen::LLT<Eigen::MatrixXd>& R_cholesky,
+    const Eigen::MatrixXd& S_guess) {
+  // The iterations converge quadratically, so once an update is smaller than
+  // this tolerance, the updated iterate's error is negligible and there is no
+  // need to spend another Lyapunov solve confirming it.
+  const double tolerance = 1e-8;
+  const int max_iterations = 20;
+
+  Eigen::MatrixXd S = S_guess;
+  Eigen::MatrixXd BT_S = B.transpose() * S;
+  Eigen::MatrixXd K = R_cholesky.solve(BT_S);
+  Eigen::MatrixXd A_closed_loop = A - B * K;
+  // The iterates are only guaranteed to converge (to the stabilizing
+  // solution) if the initial gain is stabilizing.
+  Eigen::EigenSolver<Eigen::MatrixXd> eigen_solver(A_closed_loop, false);
+  if (eigen_solver.info() != Eigen::Success ||
+      !(eigen_solver.eigenvalues().real().array() < 0).all()) {
+    return std::nullopt;
+  }
+  for (int iteration = 0; iteration < max_iterations; ++iteration) {
+    Eigen::MatrixXd S_next;
+    try {
+      // Note that KᵀRK = (BᵀS)ᵀK.
+      const Eigen::MatrixXd rhs = Q + BT_S.transpose() * K;
+      S_next = RealContinuousLyapunovEquation(A_closed_loop,
+                                              0.5 * (rhs + rhs.transpose()));
+    } catch (const std::exception&) {
+      return std::nullopt;
+    }
+    const double change = (S_next - S).norm();
+    S = 0.5 * (S_next + S_next.transpose());
+    if (!S.allFinite()) {
+      return std::nullopt;
+    }
+    if (change <= tolerance * std::max(1.0, S.norm())) {
+      return S;
+    }
+    BT_S = B.transpose() * S;
+    K = R_cholesky.solve(BT_S);
+    A_closed_loop = A - B * K;
+  }
+  return std::nullopt;
+}
+
+}  // namespace
 
 Eigen::MatrixXd ContinuousAlgebraicRiccatiEquation(
     const Eigen::Ref<const Eigen::MatrixXd>& A,
@@ -114,5 +174,51 @@ Eigen::MatrixXd ContinuousAlgebraicRiccatiEquation(
   return ContinuousAlgebraicRiccatiEquation(A, B, Q, R_cholesky);
 }
 
+std::vector<Eigen::MatrixXd> ContinuousAlgebraicRiccatiEquation(
+    const std::vector<Eigen::MatrixXd>& A,
+    const std::vector<Eigen::MatrixXd>& B,
+    const Eigen::Ref<const Eigen::MatrixXd>& Q,
+    const Eigen::Ref<const Eigen::MatrixXd>& R,
+    Parallelism parallelism) {
+  DRAKE_THROW_UNLESS(A.size() == B.size());
+  DRAKE_DEMAND(is_approx_equal_abstol(R, R.transpose(), 1e-10));
+  Eigen::LLT<Eigen::MatrixXd> R_cholesky(R);
+  if (R_cholesky.info() != Eigen::Success)
+    throw std::runtime_error("R must be positive definite");
+
+  const int num_problems = A.size();
+  std::vector<Eigen::MatrixXd> S(num_problems);
+  if (num_problems == 0) {
+    return S;
+  }
+  for (int i = 0; i < num_problems; ++i) {
+    DRAKE_THROW_UNLESS(A[i].rows() == Q.rows() && A[i].cols() == Q.rows());
+    DRAKE_THROW_UNLESS(B[i].rows() == Q.rows() && B[i].cols() == R.rows());
+  }
+
+  // Each chunk is a contiguous range of problems, so that each warm start
+  // comes from the solution of the preceding problem.
+  const int num_chunks =
+      std::clamp(parallelism.num_threads(), 1, num_problems);
+  auto solve_chunk = [&](int chunk) {
+    const int begin = static_cast<int64_t>(num_problems) * chunk / num_chunks;
+    const int end =
+        static_cast<int64_t>(num_problems) * (chunk + 1) / num_chunks;
+    for (int i = begin; i < end; ++i) {
+      std::optional<Eigen::MatrixXd> warm_solution;
+      if (i > begin) {
+        warm_solution =
+            SolveByNewtonKleinman(A[i], B[i], Q, R_cholesky, S[i - 1]);
+      }
+      S[i] = warm_solution ? std::move(*warm_solution)
+                           : ContinuousAlgebraicRiccatiEquation(
+                                 A[i], B[i], Q, R_cholesky);
+    }
+  };
+  drake::internal::ParallelFor(Parallelism(num_chunks), num_chunks,
+                               solve_chunk);
+  return S;
+}
+
 }  // namespace math
 }  // namespace drake
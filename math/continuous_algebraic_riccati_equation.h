@@ -1,7 +1,11 @@
 #pragma once
 
+#include <vector>
+
 #include <Eigen/Dense>
 
+#include "drake/common/parallelism.h"
+
 namespace drake {
 namespace math {
 
@@ -41,5 +45,39 @@ Eigen::MatrixXd ContinuousAlgebraicRiccatiEquation(
     const Eigen::Ref<const Eigen::MatrixXd>& Q,
     const Eigen::LLT<Eigen::MatrixXd>& R_cholesky);
 
+/// Computes the unique stabilizing solution S[i] to the continuous-time
+/// algebraic Riccati equation
+///
+/// @f[
+/// S_i A_i + A_i' S_i - S_i B_i R^{-1} B_i' S_i + Q = 0
+/// @f]
+///
+/// for each pair (A[i], B[i]), with the same Q and R for every pair (e.g., to
+/// compute a gain schedule over many linearization points).
+///
+/// The problems are split into contiguous chunks, one per thread. The first
+/// problem of each chunk is solved by
+/// ContinuousAlgebraicRiccatiEquation(A, B, Q, R). Each subsequent problem is
+/// solved by Newton-Kleinman iterations (a sequence of Lyapunov equations)
+/// warm-started from the solution of its predecessor, which typically converge
+/// in a few iterations when neighboring problems are similar. When the
+/// predecessor's solution does not stabilize (A[i], B[i]), or the iterations
+/// do not converge, the problem is instead solved from scratch. Ordering the
+/// problems so that neighbors are similar (e.g., along a trajectory) makes the
+/// warm starts more effective.
+///
+/// @note The warm-started solves do not repeat the stabilizability and
+/// detectability checks of ContinuousAlgebraicRiccatiEquation(); instead,
+/// every Newton-Kleinman iterate is stabilizing by construction.
+/// @throws std::exception if A and B have different sizes, if any of the
+/// matrices have inconsistent dimensions, or under any of the conditions that
+/// ContinuousAlgebraicRiccatiEquation() throws.
+std::vector<Eigen::MatrixXd> ContinuousAlgebraicRiccatiEquation(
+    const std::vector<Eigen::MatrixXd>& A,
+    const std::vector<Eigen::MatrixXd>& B,
+    const Eigen::Ref<const Eigen::MatrixXd>& Q,
+    const Eigen::Ref<const Eigen::MatrixXd>& R,
+    Parallelism parallelism = Parallelism::Max());
+
 }  // namespace math
 }  // namespace drake
@@ -113,6 +113,17 @@ void ComposeXinvXNoAlias(const double* X_BA, const double* X_BC, double* X_AC) {
   p_AC[2] = col_x_col(&X_BA[6], p_AC_B);  // rather than rows.
 }
 
+/* @pre p_AoQ_A is disjoint in memory from the inputs, or is the same position
+vector as p_BoQ_B (elements are read before any element is written). */
+void TransformPointNoAlias(const double* X_AB, const double* p_BoQ_B,
+                           double* p_AoQ_A) {
+  const double* p_AB = X_AB + 9;  // Make a nice alias.
+  const double p[3] = {p_BoQ_B[0], p_BoQ_B[1], p_BoQ_B[2]};
+  p_AoQ_A[0] = p_AB[0] + row_x_col(&X_AB[0], p);
+  p_AoQ_A[1] = p_AB[1] + row_x_col(&X_AB[1], p);
+  p_AoQ_A[2] = p_AB[2] + row_x_col(&X_AB[2], p);
+}
+
 /* Reinterpret user-friendly class names to raw arrays of double. See note above
 as to why these reinterpret_casts are safe. */
 
@@ -148,12 +159,18 @@ class PoseCompositionFunctionsHelper {
       compose_rinvr_ = internal::ComposeRinvRAvx;
       compose_xx_ = internal::ComposeXXAvx;
       compose_xinvx_ = internal::ComposeXinvXAvx;
+      compose_xx_batch_ = internal::ComposeXXBatchAvx;
+      compose_xinvx_batch_ = internal::ComposeXinvXBatchAvx;
+      transform_points_ = internal::TransformPointsAvx;
       is_using_portable_functions_ = false;
     } else {
       compose_rr_ = internal::ComposeRRPortable;
       compose_rinvr_ = internal::ComposeRinvRPortable;
       compose_xx_ = internal::ComposeXXPortable;
       compose_xinvx_ = internal::ComposeXinvXPortable;
+      compose_xx_batch_ = internal::ComposeXXBatchPortable;
+      compose_xinvx_batch_ = internal::ComposeXinvXBatchPortable;
+      transform_points_ = internal::TransformPointsPortable;
       is_using_portable_functions_ = true;
     }
   }
@@ -182,6 +199,23 @@ class PoseCompositionFunctionsHelper {
     (*compose_xinvx_)(X_BA, X_BC, X_AC);
   }
 
+  void ComposeXXBatch(const RigidTransform<double>* X_AB,
+                      const RigidTransform<double>* X_BC, int n,
+                      RigidTransform<double>* X_AC) const {
+    (*compose_xx_batch_)(X_AB, X_BC, n, X_AC);
+  }
+
+  void ComposeXinvXBatch(const RigidTransform<double>* X_BA,
+                         const RigidTransform<double>* X_BC, int n,
+                         RigidTransform<double>* X_AC) const {
+    (*compose_xinvx_batch_)(X_BA, X_BC, n, X_AC);
+  }
+
+  void TransformPoints(const RigidTransform<double>& X_AB,
+                       const double* p_BoQ_B, int n, double* p_AoQ_A) const {
+    (*transform_points_)(X_AB, p_BoQ_B, n, p_AoQ_A);
+  }
+
   bool is_using_portable_functions() const {
     return is_using_portable_functions_;
   }
@@ -203,6 +237,17 @@ class PoseCompositionFunctionsHelper {
                          const RigidTransform<double>&,
                          RigidTransform<double>*) = nullptr;
 
+  void (*compose_xx_batch_)(const RigidTransform<double>*,
+                            const RigidTransform<double>*, int,
+                            RigidTransform<double>*) = nullptr;
+
+  void (*compose_xinvx_batch_)(const RigidTransform<double>*,
+                               const RigidTransform<double>*, int,
+                               RigidTransform<double>*) = nullptr;
+
+  void (*transform_points_)(const RigidTransform<double>&, const double*, int,
+                            double*) = nullptr;
+
   bool is_using_portable_functions_ = false;
 };
 
@@ -257,6 +302,50 @@ void ComposeXinvXPortable(const RigidTransform<double>& X_BA,
   std::copy(X_AC_temp, X_AC_temp + 12, GetMutableRawMatrixStart(X_AC));
 }
 
+/* Element-wise composition of arrays of transforms X_AC[i] = X_AB[i] * X_BC[i].
+Each transform is 12 consecutive doubles, so the i'th element of an array starts
+12*i doubles after the first. */
+void ComposeXXBatchPortable(const RigidTransform<double>* X_AB,
+                            const RigidTransform<double>* X_BC, int n,
+                            RigidTransform<double>* X_AC) {
+  assert(n == 0 || X_AC != nullptr);
+  const double* X_AB_raw = reinterpret_cast<const double*>(X_AB);
+  const double* X_BC_raw = reinterpret_cast<const double*>(X_BC);
+  double* X_AC_raw = reinterpret_cast<double*>(X_AC);
+  for (int i = 0; i < n; ++i) {
+    double X_AC_temp[12];  // Protect from overlap with inputs.
+    ComposeXXNoAlias(X_AB_raw + 12 * i, X_BC_raw + 12 * i, X_AC_temp);
+    std::copy(X_AC_temp, X_AC_temp + 12, X_AC_raw + 12 * i);
+  }
+}
+
+/* Element-wise composition of arrays of transforms X_AC[i] = X_BA[i]⁻¹ *
+X_BC[i]. Each transform is 12 consecutive doubles. */
+void ComposeXinvXBatchPortable(const RigidTransform<double>* X_BA,
+                               const RigidTransform<double>* X_BC, int n,
+                               RigidTransform<double>* X_AC) {
+  assert(n == 0 || X_AC != nullptr);
+  const double* X_BA_raw = reinterpret_cast<const double*>(X_BA);
+  const double* X_BC_raw = reinterpret_cast<const double*>(X_BC);
+  double* X_AC_raw = reinterpret_cast<double*>(X_AC);
+  for (int i = 0; i < n; ++i) {
+    double X_AC_temp[12];  // Protect from overlap with inputs.
+    ComposeXinvXNoAlias(X_BA_raw + 12 * i, X_BC_raw + 12 * i, X_AC_temp);
+    std::copy(X_AC_temp, X_AC_temp + 12, X_AC_raw + 12 * i);
+  }
+}
+
+/* Transformation of position vectors p_AoQ_A[i] = X_AB * p_BoQ_B[i]. The
+position vectors are 3n consecutive doubles, in column order. */
+void TransformPointsPortable(const RigidTransform<double>& X_AB,
+                             const double* p_BoQ_B, int n, double* p_AoQ_A) {
+  assert(n == 0 || (p_BoQ_B != nullptr && p_AoQ_A != nullptr));
+  const double* X_AB_raw = GetRawMatrixStart(X_AB);
+  for (int i = 0; i < n; ++i) {
+    TransformPointNoAlias(X_AB_raw, p_BoQ_B + 3 * i, p_AoQ_A + 3 * i);
+  }
+}
+
 bool IsUsingPortableCompositionFunctions() {
   return g_pose_composition_functions_helper.is_using_portable_functions();
 }
@@ -285,6 +374,24 @@ void ComposeXinvX(const RigidTransform<double>& X_BA,
   g_pose_composition_functions_helper.ComposeXinvX(X_BA, X_BC, X_AC);
 }
 
+void ComposeXXBatch(const RigidTransform<double>* X_AB,
+                    const RigidTransform<double>* X_BC, int n,
+                    RigidTransform<double>* X_AC) {
+  g_pose_composition_functions_helper.ComposeXXBatch(X_AB, X_BC, n, X_AC);
+}
+
+void ComposeXinvXBatch(const RigidTransform<double>* X_BA,
+                       const RigidTransform<double>* X_BC, int n,
+                       RigidTransform<double>* X_AC) {
+  g_pose_composition_functions_helper.ComposeXinvXBatch(X_BA, X_BC, n, X_AC);
+}
+
+void TransformPoints(const RigidTransform<double>& X_AB, const double* p_BoQ_B,
+                     int n, double* p_AoQ_A) {
+  g_pose_composition_functions_helper.TransformPoints(X_AB, p_BoQ_B, n,
+                                                      p_AoQ_A);
+}
+
 }  // namespace internal
 }  // namespace math
 }  // namespace drake
@@ -82,6 +82,38 @@ void ComposeXinvX(const RigidTransform<double>& X_BA,
                   const RigidTransform<double>& X_BC,
                   RigidTransform<double>* X_AC);
 
+/* Composes `n` pairs of drake::math::RigidTransform<double> objects stored in
+arrays, as quickly as possible. This is equivalent to calling ComposeXX() for
+each element, but avoids the per-element dispatch overhead.
+
+Here we calculate `X_AC[i] = X_AB[i] * X_BC[i]` for i ∈ [0, n). It is OK for
+X_AC to be the same array as one or both inputs, but the arrays must not
+otherwise overlap. */
+void ComposeXXBatch(const RigidTransform<double>* X_AB,
+                    const RigidTransform<double>* X_BC, int n,
+                    RigidTransform<double>* X_AC);
+
+/* Composes `n` pairs of drake::math::RigidTransform<double> objects stored in
+arrays as quickly as possible, where the first transform of each pair is
+inverted. This is equivalent to calling ComposeXinvX() for each element.
+
+Here we calculate `X_AC[i] = X_BA[i]⁻¹ * X_BC[i]` for i ∈ [0, n). It is OK for
+X_AC to be the same array as one or both inputs, but the arrays must not
+otherwise overlap. */
+void ComposeXinvXBatch(const RigidTransform<double>* X_BA,
+                       const RigidTransform<double>* X_BC, int n,
+                       RigidTransform<double>* X_AC);
+
+/* Applies a drake::math::RigidTransform<double> to `n` position vectors as
+quickly as possible. The position vectors are stored as a 3 x n column-ordered
+matrix in 3n consecutive doubles (i.e., the storage of an Eigen::Matrix3Xd).
+
+Here we calculate `p_AoQ_A[i] = X_AB * p_BoQ_B[i]` for i ∈ [0, n). It is OK for
+p_AoQ_A to be the same array as p_BoQ_B, but the arrays must not otherwise
+overlap. */
+void TransformPoints(const RigidTransform<double>& X_AB, const double* p_BoQ_B,
+                     int n, double* p_AoQ_A);
+
 /* Returns `true` if we are using the portable fallback implementations for
 the above functions. */
 bool IsUsingPortableCompositionFunctions();
@@ -104,6 +136,15 @@ void ComposeXinvXPortable(const RigidTransform<double>& X_BA,
                           const RigidTransform<double>& X_BC,
                           RigidTransform<double>* X_AC);
 
+void ComposeXXBatchPortable(const RigidTransform<double>* X_AB,
+                            const RigidTransform<double>* X_BC, int n,
+                            RigidTransform<double>* X_AC);
+void ComposeXinvXBatchPortable(const RigidTransform<double>* X_BA,
+                               const RigidTransform<double>* X_BC, int n,
+                               RigidTransform<double>* X_AC);
+void TransformPointsPortable(const RigidTransform<double>& X_AB,
+                             const double* p_BoQ_B, int n, double* p_AoQ_A);
+
 }  // namespace internal
 }  // namespace math
 }  // namespace drake
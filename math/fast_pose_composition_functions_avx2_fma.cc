@@ -574,6 +574,66 @@ void ComposeXinvXAvx(const double* X_BA, const double* X_BC, double* X_AC) {
   // The compiler will generate a vzeroupper instruction if needed.
 }
 
+/* Transformation of n position vectors p_AoQ_A = X_AB * p_BoQ_B.
+
+The transform is 12 consecutive doubles in column-major order and the position
+vectors are 3n consecutive doubles in column-major order.
+
+  X_AB = abcdefghixyz
+  p_BoQ_B = PQR (for one position vector)
+  p_AoQ_A = stu (for the same position vector)
+
+We want to perform this matrix multiply-accumulate for each position vector:
+
+    s     x     a d g     P
+    t  =  y  +  b e h  @  Q
+    u     z     c f i     R
+
+Strategy: the columns of X_AB are loaded into registers once and reused for
+every position vector, so that each vector costs a single broadcast per element
+and three fused-multiply-adds:
+
+  <stu_> =   <xyz_>
+           + <abc_> * <PPP_>
+           + <def_> * <QQQ_>
+           + <ghi_> * <RRR_>
+
+We must be careful not to load or store past the last element, nor to write
+into the next position vector (which might not have been read yet, when the
+output overlaps the input).
+
+It is OK if p_AoQ_A is the same array as p_BoQ_B. */
+void TransformPointsAvx(const double* X_AB, const double* p_BoQ_B, int n,
+                        double* p_AoQ_A) {
+  constexpr uint64_t yes = uint64_t(1ull << 63);
+  constexpr uint64_t no = uint64_t(0);
+  const __m256i mask = _mm256_setr_epi64x(yes, yes, yes, no);
+
+  // Load the transform.
+  const __m256d abc_ = _mm256_loadu_pd(X_AB);      // (d is loaded but unused)
+  const __m256d def_ = _mm256_loadu_pd(X_AB + 3);  // (g is loaded but unused)
+  const __m256d ghi_ = _mm256_loadu_pd(X_AB + 6);  // (x is loaded but unused)
+  const __m256d xyz_ = _mm256_maskload_pd(X_AB + 9, mask);
+
+  for (int i = 0; i < n; ++i) {
+    const double* p_BoQi_B = p_BoQ_B + 3 * i;
+    const double P = p_BoQi_B[0];
+    const double Q = p_BoQi_B[1];
+    const double R = p_BoQi_B[2];
+
+    // Column stu:                                    s   t   u   _  =
+    __m256d stu_ = xyz_;                          //  x   y   z   _
+    stu_ = _mm256_fmadd_pd(abc_, four(P), stu_);  // +aP +bP +cP  _
+    stu_ = _mm256_fmadd_pd(def_, four(Q), stu_);  // +dQ +eQ +fQ  _
+    stu_ = _mm256_fmadd_pd(ghi_, four(R), stu_);  // +gR +hR +iR  _
+
+    // 3-wide write to stay in bounds.
+    _mm256_maskstore_pd(p_AoQ_A + 3 * i, mask, stu_);
+  }
+
+  // The compiler will generate a vzeroupper instruction if needed.
+}
+
 }  // namespace
 
 // See note above as to why these reinterpret_casts are safe.
@@ -610,6 +670,37 @@ void ComposeXinvXAvx(const RigidTransform<double>& X_BA,
   ComposeXinvXAvx(GetRawMatrixStart(X_BA), GetRawMatrixStart(X_BC),
                   GetMutableRawMatrixStart(X_AC));
 }
+
+// For the array functions below, note that a RigidTransform<double> is exactly
+// twelve doubles, so the i'th element of an array starts 12*i doubles after
+// the first.
+
+void ComposeXXBatchAvx(const RigidTransform<double>* X_AB,
+                       const RigidTransform<double>* X_BC, int n,
+                       RigidTransform<double>* X_AC) {
+  const double* X_AB_raw = reinterpret_cast<const double*>(X_AB);
+  const double* X_BC_raw = reinterpret_cast<const double*>(X_BC);
+  double* X_AC_raw = reinterpret_cast<double*>(X_AC);
+  for (int i = 0; i < n; ++i) {
+    ComposeXXAvx(X_AB_raw + 12 * i, X_BC_raw + 12 * i, X_AC_raw + 12 * i);
+  }
+}
+
+void ComposeXinvXBatchAvx(const RigidTransform<double>* X_BA,
+                          const RigidTransform<double>* X_BC, int n,
+                          RigidTransform<double>* X_AC) {
+  const double* X_BA_raw = reinterpret_cast<const double*>(X_BA);
+  const double* X_BC_raw = reinterpret_cast<const double*>(X_BC);
+  double* X_AC_raw = reinterpret_cast<double*>(X_AC);
+  for (int i = 0; i < n; ++i) {
+    ComposeXinvXAvx(X_BA_raw + 12 * i, X_BC_raw + 12 * i, X_AC_raw + 12 * i);
+  }
+}
+
+void TransformPointsAvx(const RigidTransform<double>& X_AB,
+                        const double* p_BoQ_B, int n, double* p_AoQ_A) {
+  TransformPointsAvx(GetRawMatrixStart(X_AB), p_BoQ_B, n, p_AoQ_A);
+}
 #else
 namespace {
 void AbortNotEnabledInBuild(const char* func) {
@@ -641,6 +732,23 @@ void ComposeXinvXAvx(const RigidTransform<double>&,
                      const RigidTransform<double>&, RigidTransform<double>*) {
   AbortNotEnabledInBuild(__func__);
 }
+
+void ComposeXXBatchAvx(const RigidTransform<double>*,
+                       const RigidTransform<double>*, int,
+                       RigidTransform<double>*) {
+  AbortNotEnabledInBuild(__func__);
+}
+
+void ComposeXinvXBatchAvx(const RigidTransform<double>*,
+                          const RigidTransform<double>*, int,
+                          RigidTransform<double>*) {
+  AbortNotEnabledInBuild(__func__);
+}
+
+void TransformPointsAvx(const RigidTransform<double>&, const double*, int,
+                        double*) {
+  AbortNotEnabledInBuild(__func__);
+}
 #endif
 
 }  // namespace internal
@@ -94,6 +94,33 @@ void ComposeXinvXAvx(const RigidTransform<double>& X_BA,
                      const RigidTransform<double>& X_BC,
                      RigidTransform<double>* X_AC);
 
+/* Composes `n` pairs of drake::math::RigidTransform<double> objects stored in
+arrays, `X_AC[i] = X_AB[i] * X_BC[i]`. It is OK for X_AC to be the same array as
+one or both inputs, but the arrays must not otherwise overlap.
+
+Note: if AVX2 is not supported, calling this function will crash the program. */
+void ComposeXXBatchAvx(const RigidTransform<double>* X_AB,
+                       const RigidTransform<double>* X_BC, int n,
+                       RigidTransform<double>* X_AC);
+
+/* Composes `n` pairs of drake::math::RigidTransform<double> objects stored in
+arrays, `X_AC[i] = X_BA[i]⁻¹ * X_BC[i]`. It is OK for X_AC to be the same array
+as one or both inputs, but the arrays must not otherwise overlap.
+
+Note: if AVX2 is not supported, calling this function will crash the program. */
+void ComposeXinvXBatchAvx(const RigidTransform<double>* X_BA,
+                          const RigidTransform<double>* X_BC, int n,
+                          RigidTransform<double>* X_AC);
+
+/* Applies a drake::math::RigidTransform<double> to `n` position vectors stored
+as a 3 x n column-ordered matrix, `p_AoQ_A[i] = X_AB * p_BoQ_B[i]`. It is OK for
+p_AoQ_A to be the same array as p_BoQ_B, but the arrays must not otherwise
+overlap.
+
+Note: if AVX2 is not supported, calling this function will crash the program. */
+void TransformPointsAvx(const RigidTransform<double>& X_AB,
+                        const double* p_BoQ_B, int n, double* p_AoQ_A);
+
 }  // namespace internal
 }  // namespace math
 }  // namespace drake
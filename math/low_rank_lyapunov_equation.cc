@@ -0,0 +1,244 @@
+#include "drake/math/low_rank_lyapunov_equation.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include <Eigen/SVD>
+#include <Eigen/SparseLU>
+#include <fmt/format.h>
+
+namespace drake {
+namespace math {
+
+using Eigen::MatrixXd;
+using Eigen::SparseMatrix;
+using Eigen::VectorXd;
+
+namespace {
+
+void ThrowUnlessValidSizes(const char* func, const SparseMatrix<double>& A,
+                           const Eigen::Ref<const MatrixXd>& C,
+                           const LowRankLyapunovOptions& options) {
+  if (A.rows() != A.cols() || C.cols() != A.rows()) {
+    throw std::runtime_error(fmt::format(
+        "{}(): A must be square and C must have as many columns as A, but A is "
+        "{}x{} and C is {}x{}",
+        func, A.rows(), A.cols(), C.rows(), C.cols()));
+  }
+  if (!(options.relative_tolerance > 0) || options.max_iterations < 1) {
+    throw std::runtime_error(fmt::format(
+        "{}(): the relative_tolerance and max_iterations must be positive",
+        func));
+  }
+}
+
+// Accumulates the blocks of columns of a low-rank factor Z, and compresses
+// them to the numerical rank of Z whenever they grow large, so that the
+// memory use follows the rank of the solution rather than the number of
+// iterations.
+class LowRankFactor {
+ public:
+  explicit LowRankFactor(int rows) : rows_(rows) {}
+
+  void Append(const MatrixXd& block) {
+    blocks_.push_back(block);
+    num_cols_ += block.cols();
+    if (num_cols_ > std::max<int64_t>(2 * compressed_cols_, 64)) {
+      Compress();
+    }
+  }
+
+  MatrixXd Finish() {
+    Compress();
+    return blocks_.empty() ? MatrixXd(rows_, 0) : blocks_.front();
+  }
+
+ private:
+  // Replaces Z by U·Σ truncated to its numerical rank, where Z = UΣVᵀ, which
+  // leaves ZZᵀ = UΣ²Uᵀ unchanged up to round-off.
+  void Compress() {
+    if (blocks_.empty()) return;
+    MatrixXd Z(rows_, num_cols_);
+    int col = 0;
+    for (const MatrixXd& block : blocks_) {
+      Z.middleCols(col, block.cols()) = block;
+      col += block.cols();
+    }
+    const Eigen::BDCSVD<MatrixXd> svd(Z, Eigen::ComputeThinU);
+    const VectorXd& sigma = svd.singularValues();
+    const double threshold = std::numeric_limits<double>::epsilon() *
+                             std::max(Z.rows(), Z.cols()) *
+                             (sigma.size() > 0 ? sigma(0) : 0.0);
+    int rank = 0;
+    while (rank < sigma.size() && sigma(rank) > threshold) {
+      ++rank;
+    }
+    blocks_.clear();
+    blocks_.push_back(svd.matrixU().leftCols(rank) *
+                      sigma.head(rank).asDiagonal());
+    num_cols_ = rank;
+    compressed_cols_ = rank;
+  }
+
+  const int rows_;
+  std::vector<MatrixXd> blocks_;
+  int64_t num_cols_{0};
+  int64_t compressed_cols_{0};
+};
+
+// Returns ADI shifts spaced logarithmically between minus estimates of the
+// smallest and largest eigenvalue magnitudes of A.
+std::vector<double> MakeShifts(const SparseMatrix<double>& A,
+                               const Eigen::SparseLU<SparseMatrix<double>>& lu,
+                               int num_shifts) {
+  // The largest magnitude is bounded by the induced infinity norm.
+  const SparseMatrix<double> abs_A = A.cwiseAbs();
+  const double max_magnitude = (abs_A * VectorXd::Ones(A.cols())).maxCoeff();
+
+  // The smallest magnitude is estimated by power iteration on A⁻¹.
+  VectorXd v = VectorXd::Ones(A.rows()).normalized();
+  double inverse_magnitude = 0;
+  for (int i = 0; i < 20; ++i) {
+    VectorXd w = lu.solve(v);
+    inverse_magnitude = w.norm();
+    if (!(inverse_magnitude > 0) || !std::isfinite(inverse_magnitude)) break;
+    v = w / inverse_magnitude;
+  }
+  double min_magnitude = inverse_magnitude > 0 ? 1 / inverse_magnitude
+                                               : max_magnitude;
+  min_magnitude = std::min(min_magnitude, max_magnitude);
+
+  std::vector<double> shifts;
+  if (num_shifts == 1 || !(min_magnitude < max_magnitude)) {
+    shifts.push_back(-std::sqrt(min_magnitude * max_magnitude));
+    return shifts;
+  }
+  const double log_min = std::log(min_magnitude);
+  const double log_max = std::log(max_magnitude);
+  for (int k = 0; k < num_shifts; ++k) {
+    shifts.push_back(
+        -std::exp(log_min + (log_max - log_min) * k / (num_shifts - 1)));
+  }
+  return shifts;
+}
+
+}  // namespace
+
+MatrixXd RealContinuousLyapunovEquationLowRank(
+    const SparseMatrix<double>& A, const Eigen::Ref<const MatrixXd>& C,
+    const LowRankLyapunovOptions& options) {
+  const char* const func = "RealContinuousLyapunovEquationLowRank";
+  ThrowUnlessValidSizes(func, A, C, options);
+  if (options.num_shifts < 1) {
+    throw std::runtime_error(
+        fmt::format("{}(): num_shifts must be positive", func));
+  }
+  const int n = A.rows();
+  if (n == 0) {
+    return MatrixXd(0, 0);
+  }
+
+  // In the notation of [1], we solve FX + XFᵀ + BBᵀ = 0 with F = Aᵀ, B = Cᵀ.
+  SparseMatrix<double> F = A.transpose();
+  F.makeCompressed();
+  // Reject a structurally singular A (with an empty row or column) up front;
+  // SparseLU does not reliably report it.
+  const SparseMatrix<double> abs_F = F.cwiseAbs();
+  const VectorXd ones = VectorXd::Ones(n);
+  const bool structurally_singular =
+      (abs_F * ones).minCoeff() == 0 ||
+      (abs_F.transpose() * ones).minCoeff() == 0;
+  Eigen::SparseLU<SparseMatrix<double>> lu_F;
+  if (!structurally_singular) {
+    lu_F.compute(F);
+  }
+  if (structurally_singular || lu_F.info() != Eigen::Success) {
+    throw std::runtime_error(fmt::format(
+        "{}(): A is singular, so the solution is not unique", func));
+  }
+  const std::vector<double> shifts = MakeShifts(F, lu_F, options.num_shifts);
+
+  // Factor F + pI once for each shift.
+  SparseMatrix<double> identity(n, n);
+  identity.setIdentity();
+  std::vector<std::unique_ptr<Eigen::SparseLU<SparseMatrix<double>>>> lus;
+  for (const double p : shifts) {
+    SparseMatrix<double> shifted = F + p * identity;
+    shifted.makeCompressed();
+    auto& lu = lus.emplace_back(
+        std::make_unique<Eigen::SparseLU<SparseMatrix<double>>>(shifted));
+    if (lu->info() != Eigen::Success) {
+      throw std::runtime_error(fmt::format(
+          "{}(): failed to factor A + {}I; A may have an eigenvalue there",
+          func, p));
+    }
+  }
+
+  // The residual of the iterate is W·Wᵀ, whose Frobenius norm is that of the
+  // small matrix WᵀW.
+  MatrixXd W = C.transpose();
+  const double initial_residual = (W.transpose() * W).norm();
+  LowRankFactor Z(n);
+  if (initial_residual == 0) {
+    return Z.Finish();
+  }
+  for (int i = 0; i < options.max_iterations; ++i) {
+    const int k = i % shifts.size();
+    const double p = shifts[k];
+    const MatrixXd V = lus[k]->solve(W);
+    Z.Append(std::sqrt(-2 * p) * V);
+    W -= 2 * p * V;
+    const double residual = (W.transpose() * W).norm();
+    if (!std::isfinite(residual)) {
+      break;
+    }
+    if (residual <= options.relative_tolerance * initial_residual) {
+      return Z.Finish();
+    }
+  }
+  throw std::runtime_error(fmt::format(
+      "{}(): the iteration did not converge within {} iterations; A must be "
+      "stable",
+      func, options.max_iterations));
+}
+
+MatrixXd RealDiscreteLyapunovEquationLowRank(
+    const SparseMatrix<double>& A, const Eigen::Ref<const MatrixXd>& C,
+    const LowRankLyapunovOptions& options) {
+  const char* const func = "RealDiscreteLyapunovEquationLowRank";
+  ThrowUnlessValidSizes(func, A, C, options);
+  const int n = A.rows();
+  const SparseMatrix<double> A_transpose = A.transpose();
+
+  // The k'th term of X = ∑ₖ (Aᵀ)ᵏCᵀCAᵏ is W·Wᵀ with W = (Aᵀ)ᵏCᵀ.
+  MatrixXd W = C.transpose();
+  const double initial_term = (W.transpose() * W).norm();
+  LowRankFactor Z(n);
+  if (initial_term == 0) {
+    return Z.Finish();
+  }
+  Z.Append(W);
+  for (int i = 0; i < options.max_iterations; ++i) {
+    W = A_transpose * W;
+    const double term = (W.transpose() * W).norm();
+    if (!std::isfinite(term)) {
+      break;
+    }
+    if (term <= options.relative_tolerance * initial_term) {
+      return Z.Finish();
+    }
+    Z.Append(W);
+  }
+  throw std::runtime_error(fmt::format(
+      "{}(): the iteration did not converge within {} iterations; A must be "
+      "Schur stable",
+      func, options.max_iterations));
+}
+
+}  // namespace math
+}  // namespace drake
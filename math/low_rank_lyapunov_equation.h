@@ -0,0 +1,84 @@
+#pragma once
+
+#include <Eigen/Dense>
+#include <Eigen/SparseCore>
+
+namespace drake {
+namespace math {
+
+/**
+ * Options for RealContinuousLyapunovEquationLowRank() and
+ * RealDiscreteLyapunovEquationLowRank().
+ */
+struct LowRankLyapunovOptions {
+  /** The iteration stops once the Frobenius norm of the residual of the
+   * equation is at most `relative_tolerance` times ‖CᵀC‖_F. */
+  double relative_tolerance{1e-10};
+
+  /** The solvers throw if they have not converged after this many
+   * iterations. */
+  int max_iterations{100};
+
+  /** The number of distinct ADI shifts that
+   * RealContinuousLyapunovEquationLowRank() cycles through. Each one costs a
+   * sparse LU factorization of A + pI. */
+  int num_shifts{10};
+};
+
+/**
+ * Computes a low-rank factor Z of the solution X ≈ ZZᵀ of the continuous
+ * Lyapunov equation `AᵀX + XA + CᵀC = 0`, for a large, sparse, stable A (all
+ * eigenvalues have negative real part) and a C with few rows. Each row of C is
+ * one right-hand side; solving them together as one block shares all of the
+ * factorizations. For instance, the observability gramian of (A, C) is ZZᵀ,
+ * and the controllability gramian of (A, B) is obtained by passing Aᵀ and Bᵀ.
+ *
+ * Unlike RealContinuousLyapunovEquation(), whose cost is O(n³) or worse and
+ * which forms the dense n-by-n solution, this costs a few sparse LU
+ * factorizations plus O(n r) per iteration, where r is the number of rows of
+ * C, and returns Z with n rows and (typically) far fewer than n columns.
+ *
+ * The implementation is the low-rank alternating direction implicit (LR-ADI)
+ * iteration in its residual-based form [1], with `options.num_shifts` real
+ * shifts spaced logarithmically between estimates of the smallest and largest
+ * eigenvalue magnitudes of A. Real negative shifts converge for any stable A,
+ * though more slowly when A has strongly oscillatory eigenvalues. The columns
+ * of the result are compressed to its numerical rank.
+ *
+ * [1] P. Benner, P. Kürschner, and J. Saak, "An improved numerical method for
+ * balanced truncation for symmetric second-order systems," Mathematical and
+ * Computer Modelling of Dynamical Systems, 19(6), 2013.
+ *
+ * @throws std::exception if A is not square, if C does not have as many
+ * columns as A, if A is singular, or if the iteration does not converge within
+ * `options.max_iterations` (e.g., because A is not stable).
+ */
+Eigen::MatrixXd RealContinuousLyapunovEquationLowRank(
+    const Eigen::SparseMatrix<double>& A,
+    const Eigen::Ref<const Eigen::MatrixXd>& C,
+    const LowRankLyapunovOptions& options = {});
+
+/**
+ * Computes a low-rank factor Z of the solution X ≈ ZZᵀ of the discrete
+ * Lyapunov equation `AᵀXA - X + CᵀC = 0`, for a large, sparse, Schur-stable A
+ * (all eigenvalues have magnitude less than one) and a C with few rows, as in
+ * RealContinuousLyapunovEquationLowRank().
+ *
+ * The implementation is the low-rank Smith iteration, which accumulates the
+ * terms (Aᵀ)ᵏCᵀ of X = ∑ₖ (Aᵀ)ᵏCᵀCAᵏ until the Frobenius norm of the last
+ * term is at most `options.relative_tolerance` times ‖CᵀC‖_F. It only needs
+ * sparse products with A, but needs many iterations when the spectral radius
+ * of A is close to one. The columns of the result are compressed to its
+ * numerical rank as they accumulate.
+ *
+ * @throws std::exception if A is not square, if C does not have as many
+ * columns as A, or if the iteration does not converge within
+ * `options.max_iterations`.
+ */
+Eigen::MatrixXd RealDiscreteLyapunovEquationLowRank(
+    const Eigen::SparseMatrix<double>& A,
+    const Eigen::Ref<const Eigen::MatrixXd>& C,
+    const LowRankLyapunovOptions& options = {});
+
+}  // namespace math
+}  // namespace drake
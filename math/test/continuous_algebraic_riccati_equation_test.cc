@@ -1,5 +1,7 @@
 #include "drake/math/continuous_algebraic_riccati_equation.h"
 
+#include <vector>
+
 #include <gtest/gtest.h>
 
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
@@ -170,6 +172,44 @@ GTEST_TEST(Care, TestUnstabilizable) {
   B << 10, 4;
   SolveCAREandVerify(A, B, Q, R, true /* is_X_pd */);
 }
+
+// The batched solutions match the solutions of the individual problems, for
+// both serial and parallel solves.
+GTEST_TEST(Care, TestBatch) {
+  const int n = 4;
+  const int m = 2;
+  const int num_problems = 10;
+  const MatrixXd A_base = MatrixXd::Random(n, n);
+  const MatrixXd A_delta = MatrixXd::Random(n, n);
+  const MatrixXd B_base = MatrixXd::Random(n, m);
+  std::vector<MatrixXd> A, B;
+  for (int i = 0; i < num_problems; ++i) {
+    A.push_back(A_base + (0.1 * i) * A_delta);
+    B.push_back(B_base);
+  }
+  // Make one problem very different from its neighbors, so that its warm
+  // start does not stabilize it.
+  A[5] = A[5] + 10 * MatrixXd::Identity(n, n);
+  const MatrixXd Q = MatrixXd::Identity(n, n);
+  const MatrixXd R = MatrixXd::Identity(m, m);
+
+  for (const Parallelism parallelism : {Parallelism::None(), Parallelism(3)}) {
+    const std::vector<MatrixXd> S =
+        ContinuousAlgebraicRiccatiEquation(A, B, Q, R, parallelism);
+    ASSERT_EQ(S.size(), num_problems);
+    for (int i = 0; i < num_problems; ++i) {
+      EXPECT_TRUE(CompareMatrices(
+          S[i], ContinuousAlgebraicRiccatiEquation(A[i], B[i], Q, R), 1E-8,
+          MatrixCompareType::relative));
+    }
+  }
+
+  EXPECT_TRUE(ContinuousAlgebraicRiccatiEquation(std::vector<MatrixXd>{},
+                                                 std::vector<MatrixXd>{}, Q, R)
+                  .empty());
+  B.pop_back();
+  EXPECT_THROW(ContinuousAlgebraicRiccatiEquation(A, B, Q, R), std::exception);
+}
 }  // namespace
 }  // namespace math
 }  // namespace drake
@@ -1,6 +1,7 @@
 #include "drake/math/fast_pose_composition_functions.h"
 
 #include <limits>
+#include <vector>
 
 #include <Eigen/Dense>
 #include <gtest/gtest.h>
@@ -209,6 +210,126 @@ GTEST_TEST(TestFastPoseCompositionFunctions, TestXinvXPortable) {
   TestXxX(internal::ComposeXinvXPortable, true);
 }
 
+// Test the given batched RigidTransform composition function against the
+// single-element composition function, including when the output array is the
+// same as one of the input arrays.
+void TestXxXBatch(std::function<void(const RigidTransform<double>*,
+                                     const RigidTransform<double>*, int,
+                                     RigidTransform<double>*)>
+                      compose_XxX_batch,
+                  std::function<void(const RigidTransform<double>&,
+                                     const RigidTransform<double>&,
+                                     RigidTransform<double>*)>
+                      compose_XxX) {
+  // Note that M and N are not legitimate RigidTransform values. We are just
+  // testing that the correct matrix operations are performed.
+  constexpr int kNumPoses = 5;
+  std::vector<Matrix34d> M(kNumPoses), N(kNumPoses);
+  for (int i = 0; i < kNumPoses; ++i) {
+    M[i] = Matrix34d::NullaryExpr([i](int r, int c) {
+      return 1.0 + r + 3 * c + i;
+    });
+    N[i] = Matrix34d::NullaryExpr([i](int r, int c) {
+      return 13.0 + r + 3 * c - 2 * i;
+    });
+  }
+  const auto as_transforms = [](const std::vector<Matrix34d>& matrices) {
+    return reinterpret_cast<const RigidTransform<double>*>(matrices.data());
+  };
+  const auto as_mutable_transforms = [](std::vector<Matrix34d>* matrices) {
+    return reinterpret_cast<RigidTransform<double>*>(matrices->data());
+  };
+
+  std::vector<Matrix34d> MxN_expected(kNumPoses);
+  for (int i = 0; i < kNumPoses; ++i) {
+    compose_XxX(reinterpret_cast<const RigidTransform<double>&>(M[i]),
+                reinterpret_cast<const RigidTransform<double>&>(N[i]),
+                reinterpret_cast<RigidTransform<double>*>(&MxN_expected[i]));
+  }
+
+  // Should be a perfect match with integer elements.
+  std::vector<Matrix34d> MxN(kNumPoses);
+  compose_XxX_batch(as_transforms(M), as_transforms(N), kNumPoses,
+                    as_mutable_transforms(&MxN));
+  for (int i = 0; i < kNumPoses; ++i) {
+    EXPECT_TRUE(CompareMatrices(MxN[i], MxN_expected[i], 0));
+  }
+
+  // Now test in-place compositions.
+  std::vector<Matrix34d> Mwork = M, Nwork = N;
+  compose_XxX_batch(as_transforms(Mwork), as_transforms(Nwork), kNumPoses,
+                    as_mutable_transforms(&Mwork));
+  compose_XxX_batch(as_transforms(M), as_transforms(Nwork), kNumPoses,
+                    as_mutable_transforms(&Nwork));
+  for (int i = 0; i < kNumPoses; ++i) {
+    EXPECT_TRUE(CompareMatrices(Mwork[i], MxN_expected[i], 0));
+    EXPECT_TRUE(CompareMatrices(Nwork[i], MxN_expected[i], 0));
+  }
+
+  // An empty batch is a no-op.
+  compose_XxX_batch(nullptr, nullptr, 0, nullptr);
+}
+
+// Test the given point transformation function for correct functionality and
+// that it still works when the output is the same array as the input.
+void TestTransformPoints(
+    std::function<void(const RigidTransform<double>&, const double*, int,
+                       double*)>
+        transform_points) {
+  // Note that M is not a legitimate RigidTransform value. We are just testing
+  // that the correct matrix operations are performed.
+  Matrix34d M;
+  // clang-format off
+  M << 1, 4, 7, 10,
+       2, 5, 8, 11,
+       3, 6, 9, 12;
+  // clang-format on
+  const auto& X = reinterpret_cast<const RigidTransform<double>&>(M);
+  for (int num_points : {0, 1, 2, 7}) {
+    Eigen::Matrix3Xd p_B(3, num_points);
+    for (int i = 0; i < num_points; ++i) {
+      p_B.col(i) << i, -2 * i, 3 + i;
+    }
+    const Eigen::Matrix3Xd p_A_expected =
+        (M.leftCols(3) * p_B).colwise() + M.col(3);
+
+    // Should be a perfect match with integer elements.
+    Eigen::Matrix3Xd p_A(3, num_points);
+    transform_points(X, p_B.data(), num_points, p_A.data());
+    EXPECT_TRUE(CompareMatrices(p_A, p_A_expected, 0));
+
+    // Now test in-place transformation.
+    transform_points(X, p_B.data(), num_points, p_B.data());
+    EXPECT_TRUE(CompareMatrices(p_B, p_A_expected, 0));
+  }
+}
+
+GTEST_TEST(TestFastPoseCompositionFunctions, TestXXBatch) {
+  SCOPED_TRACE("testing ComposeXXBatch()");
+  TestXxXBatch(internal::ComposeXXBatch, internal::ComposeXXPortable);
+}
+GTEST_TEST(TestFastPoseCompositionFunctions, TestXinvXBatch) {
+  SCOPED_TRACE("testing ComposeXinvXBatch()");
+  TestXxXBatch(internal::ComposeXinvXBatch, internal::ComposeXinvXPortable);
+}
+GTEST_TEST(TestFastPoseCompositionFunctions, TestTransformPoints) {
+  SCOPED_TRACE("testing TransformPoints()");
+  TestTransformPoints(internal::TransformPoints);
+}
+GTEST_TEST(TestFastPoseCompositionFunctions, TestXXBatchPortable) {
+  SCOPED_TRACE("testing internal::ComposeXXBatchPortable()");
+  TestXxXBatch(internal::ComposeXXBatchPortable, internal::ComposeXXPortable);
+}
+GTEST_TEST(TestFastPoseCompositionFunctions, TestXinvXBatchPortable) {
+  SCOPED_TRACE("testing internal::ComposeXinvXBatchPortable()");
+  TestXxXBatch(internal::ComposeXinvXBatchPortable,
+               internal::ComposeXinvXPortable);
+}
+GTEST_TEST(TestFastPoseCompositionFunctions, TestTransformPointsPortable) {
+  SCOPED_TRACE("testing internal::TransformPointsPortable()");
+  TestTransformPoints(internal::TransformPointsPortable);
+}
+
 }  // namespace
 
 }  // namespace math
@@ -0,0 +1,120 @@
+#include "drake/math/low_rank_lyapunov_equation.h"
+
+#include <cmath>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
+#include "drake/math/continuous_lyapunov_equation.h"
+#include "drake/math/discrete_lyapunov_equation.h"
+
+namespace drake {
+namespace math {
+namespace {
+
+using Eigen::MatrixXd;
+using Eigen::SparseMatrix;
+
+// Returns the tridiagonal matrix of a discretized, slightly advected heat
+// equation, whose eigenvalues are real and negative, and span three orders of
+// magnitude.
+SparseMatrix<double> MakeHeatEquation(int n) {
+  std::vector<Eigen::Triplet<double>> triplets;
+  for (int i = 0; i < n; ++i) {
+    triplets.emplace_back(i, i, -2.0);
+    if (i + 1 < n) {
+      triplets.emplace_back(i, i + 1, 1.1);
+      triplets.emplace_back(i + 1, i, 0.9);
+    }
+  }
+  SparseMatrix<double> A(n, n);
+  A.setFromTriplets(triplets.begin(), triplets.end());
+  return A;
+}
+
+MatrixXd MakeC(int n) {
+  MatrixXd C(2, n);
+  for (int j = 0; j < n; ++j) {
+    C(0, j) = std::sin(j);
+    C(1, j) = (j % 3) - 1.0;
+  }
+  return C;
+}
+
+GTEST_TEST(RealContinuousLyapunovEquationLowRank, MatchesDense) {
+  const int n = 40;
+  const SparseMatrix<double> A = MakeHeatEquation(n);
+  const MatrixXd C = MakeC(n);
+  const MatrixXd expected = RealContinuousLyapunovEquation(
+      MatrixXd(A), C.transpose() * C);
+
+  const MatrixXd Z = RealContinuousLyapunovEquationLowRank(A, C);
+  EXPECT_EQ(Z.rows(), n);
+  EXPECT_LT(Z.cols(), n);
+  EXPECT_TRUE(CompareMatrices(Z * Z.transpose(), expected,
+                              1e-8 * expected.norm()));
+
+  // A single shift converges too, just more slowly.
+  LowRankLyapunovOptions options;
+  options.num_shifts = 1;
+  options.max_iterations = 1000;
+  const MatrixXd Z1 = RealContinuousLyapunovEquationLowRank(A, C, options);
+  EXPECT_TRUE(CompareMatrices(Z1 * Z1.transpose(), expected,
+                              1e-8 * expected.norm()));
+
+  // A zero right-hand side has a zero solution.
+  EXPECT_EQ(RealContinuousLyapunovEquationLowRank(A, 0 * C).cols(), 0);
+}
+
+GTEST_TEST(RealContinuousLyapunovEquationLowRank, Errors) {
+  const int n = 4;
+  const SparseMatrix<double> A = MakeHeatEquation(n);
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      RealContinuousLyapunovEquationLowRank(A, MatrixXd::Ones(1, n + 1)),
+      ".*A must be square and C must have as many columns as A.*");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      RealContinuousLyapunovEquationLowRank(SparseMatrix<double>(n, n),
+                                            MatrixXd::Ones(1, n)),
+      ".*A is singular.*");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      RealContinuousLyapunovEquationLowRank(-A, MatrixXd::Ones(1, n)),
+      ".*did not converge.*A must be stable.*");
+  LowRankLyapunovOptions options;
+  options.num_shifts = 0;
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      RealContinuousLyapunovEquationLowRank(A, MatrixXd::Ones(1, n), options),
+      ".*num_shifts must be positive.*");
+}
+
+GTEST_TEST(RealDiscreteLyapunovEquationLowRank, MatchesDense) {
+  const int n = 40;
+  SparseMatrix<double> A = 0.2 * MakeHeatEquation(n);
+  A.diagonal().array() += 0.5;
+  const MatrixXd C = MakeC(n);
+  const MatrixXd expected =
+      RealDiscreteLyapunovEquation(MatrixXd(A), C.transpose() * C);
+
+  const MatrixXd Z = RealDiscreteLyapunovEquationLowRank(A, C);
+  EXPECT_EQ(Z.rows(), n);
+  EXPECT_LT(Z.cols(), n);
+  EXPECT_TRUE(CompareMatrices(Z * Z.transpose(), expected,
+                              1e-8 * expected.norm()));
+}
+
+GTEST_TEST(RealDiscreteLyapunovEquationLowRank, Errors) {
+  const int n = 4;
+  SparseMatrix<double> A(n, n);
+  A.setIdentity();
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      RealDiscreteLyapunovEquationLowRank(A, MatrixXd::Ones(1, n + 1)),
+      ".*A must be square and C must have as many columns as A.*");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      RealDiscreteLyapunovEquationLowRank(A, MatrixXd::Ones(1, n)),
+      ".*did not converge.*A must be Schur stable.*");
+}
+
+}  // namespace
+}  // namespace math
+}  // namespace drake
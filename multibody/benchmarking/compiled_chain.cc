@@ -0,0 +1,125 @@
+// @file
+// Benchmarks for CompiledChain.
+//
+// This compares forward kinematics, Jacobians and inverse dynamics of an iiwa
+// arm evaluated by a CompiledChain against the same quantities evaluated by
+// the MultibodyPlant itself, as an inverse kinematics inner loop would.
+
+#include "drake/multibody/plant/compiled_chain.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "drake/common/find_resource.h"
+#include "drake/multibody/parsing/parser.h"
+#include "drake/tools/performance/fixture_common.h"
+
+namespace drake {
+namespace multibody {
+namespace {
+
+using Eigen::MatrixXd;
+using Eigen::Vector3d;
+using Eigen::VectorXd;
+using math::RigidTransformd;
+using systems::Context;
+
+class IiwaCompiledChainFixture : public benchmark::Fixture {
+ public:
+  void SetUp(::benchmark::State&) override {
+    tools::performance::AddMinMaxStatistics(this);
+
+    const std::string iiwa_path = FindResourceOrThrow(
+        "drake/manipulation/models/iiwa_description/sdf/"
+        "iiwa14_no_collision.sdf");
+    plant_ = std::make_unique<MultibodyPlant<double>>(0.0);
+    multibody::Parser parser{plant_.get()};
+    parser.AddModels(iiwa_path);
+    plant_->WeldFrames(plant_->world_frame(),
+                       plant_->GetFrameByName("iiwa_link_0"));
+    plant_->Finalize();
+    context_ = plant_->CreateDefaultContext();
+    chain_ = std::make_unique<CompiledChain<double>>(*plant_, *context_);
+    end_effector_ = &plant_->GetBodyByName("iiwa_link_7");
+
+    q_.resize(7);
+    q_ << 0.1, 0.2, 0.3, 0.4, -0.1, -0.2, -0.3;
+    v_ = VectorXd::Constant(7, 0.5);
+    vdot_ = VectorXd::Constant(7, -1.0);
+    J_.resize(6, 7);
+    tau_.resize(7);
+  }
+
+ protected:
+  std::unique_ptr<MultibodyPlant<double>> plant_{};
+  std::unique_ptr<Context<double>> context_{};
+  std::unique_ptr<CompiledChain<double>> chain_{};
+  const Body<double>* end_effector_{};
+  const Vector3d p_BP_{0, 0, 0.1};
+
+  VectorXd q_;
+  VectorXd v_;
+  VectorXd vdot_;
+  std::vector<RigidTransformd> X_WB_;
+  MatrixXd J_;
+  VectorXd tau_;
+};
+
+BENCHMARK_F(IiwaCompiledChainFixture, PoseAndJacobianPlant)
+// NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+(benchmark::State& state) {
+  for (auto _ : state) {
+    q_(0) += 0.01;  // avoid caching.
+    plant_->SetPositions(context_.get(), q_);
+    benchmark::DoNotOptimize(
+        plant_->EvalBodyPoseInWorld(*context_, *end_effector_));
+    plant_->CalcJacobianSpatialVelocity(
+        *context_, JacobianWrtVariable::kV, end_effector_->body_frame(), p_BP_,
+        plant_->world_frame(), plant_->world_frame(), &J_);
+  }
+}
+
+BENCHMARK_F(IiwaCompiledChainFixture, PoseAndJacobianCompiled)
+// NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+(benchmark::State& state) {
+  for (auto _ : state) {
+    q_(0) += 0.01;
+    chain_->CalcBodyPosesInWorld(q_, &X_WB_);
+    chain_->CalcJacobianSpatialVelocity(X_WB_, end_effector_->index(), p_BP_,
+                                        &J_);
+    benchmark::DoNotOptimize(J_);
+  }
+}
+
+BENCHMARK_F(IiwaCompiledChainFixture, InverseDynamicsPlant)
+// NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+(benchmark::State& state) {
+  MultibodyForces<double> forces(*plant_);
+  for (auto _ : state) {
+    q_(0) += 0.01;  // avoid caching.
+    plant_->SetPositions(context_.get(), q_);
+    plant_->SetVelocities(context_.get(), v_);
+    plant_->CalcForceElementsContribution(*context_, &forces);
+    benchmark::DoNotOptimize(
+        plant_->CalcInverseDynamics(*context_, vdot_, forces));
+  }
+}
+
+BENCHMARK_F(IiwaCompiledChainFixture, InverseDynamicsCompiled)
+// NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+(benchmark::State& state) {
+  for (auto _ : state) {
+    q_(0) += 0.01;
+    chain_->CalcInverseDynamics(q_, v_, vdot_, &tau_);
+    benchmark::DoNotOptimize(tau_);
+  }
+}
+
+}  // namespace
+}  // namespace multibody
+}  // namespace drake
+
+BENCHMARK_MAIN();
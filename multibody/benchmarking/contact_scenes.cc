@@ -0,0 +1,469 @@
+// @file
+// Benchmarks for the discrete step of a MultibodyPlant with contact.
+//
+// Each benchmark case steps one of a set of standard contact-rich scenes with
+// either the TAMSI or the SAP contact solver. Besides the full discrete step,
+// the cases below time the phases of the step on their own, so that a change
+// in the step time can be attributed to one of them:
+//
+//  - GeometryQueries: the SceneGraph queries for the scene's contact model.
+//  - ContactKinematics: the contact pairs and their Jacobians (includes the
+//    geometry queries).
+//  - FreeMotionDynamics: the mass matrix and the bias and force element terms
+//    that define the free-motion (contact-free) velocities.
+//  - ContactSolve: the contact solver results (includes all of the above).
+//  - Step: the full discrete update.
+//
+// The time spent in the contact solver alone is the ContactSolve time minus
+// the ContactKinematics and FreeMotionDynamics times.
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "drake/common/drake_assert.h"
+#include "drake/common/find_resource.h"
+#include "drake/geometry/proximity_properties.h"
+#include "drake/geometry/query_object.h"
+#include "drake/geometry/scene_graph.h"
+#include "drake/multibody/fem/deformable_body_config.h"
+#include "drake/multibody/parsing/parser.h"
+#include "drake/multibody/plant/deformable_model.h"
+#include "drake/multibody/plant/discrete_update_manager.h"
+#include "drake/multibody/plant/multibody_plant.h"
+#include "drake/multibody/plant/multibody_plant_config_functions.h"
+#include "drake/multibody/tree/prismatic_joint.h"
+#include "drake/multibody/tree/revolute_joint.h"
+#include "drake/systems/analysis/simulator.h"
+#include "drake/systems/framework/diagram.h"
+#include "drake/systems/framework/diagram_builder.h"
+#include "drake/tools/performance/fixture_common.h"
+#include "drake/tools/performance/fixture_memory.h"
+
+namespace drake {
+namespace multibody {
+
+// Provides access to the plant's discrete update manager, which evaluates the
+// intermediate results of the discrete step.
+class MultibodyPlantTester {
+ public:
+  static const internal::DiscreteUpdateManager<double>& manager(
+      const MultibodyPlant<double>& plant) {
+    DRAKE_DEMAND(plant.discrete_update_manager_ != nullptr);
+    return *plant.discrete_update_manager_;
+  }
+};
+
+namespace {
+
+using Eigen::Vector3d;
+using geometry::AddCompliantHydroelasticProperties;
+using geometry::AddContactMaterial;
+using geometry::AddRigidHydroelasticProperties;
+using geometry::Box;
+using geometry::Cylinder;
+using geometry::GeometryInstance;
+using geometry::ProximityProperties;
+using geometry::QueryObject;
+using geometry::Sphere;
+using math::RigidTransformd;
+using math::RollPitchYawd;
+using systems::Context;
+using systems::Diagram;
+using systems::DiagramBuilder;
+using systems::Simulator;
+
+// In the benchmark case instantiations at the bottom of this file, the first
+// "Arg" selects the scene and the second one the contact solver.
+enum Scene {
+  kClutterBin = 0,
+  kAllegroHand = 1,
+  kHydroelasticStack = 2,
+  kDeformableGripper = 3,
+};
+enum Solver {
+  kTamsi = 0,
+  kSap = 1,
+};
+
+constexpr double kTimeStep = 0.01;
+
+// The contact material shared by all of the scenes.
+const CoulombFriction<double> kFriction(1.0, 1.0);
+
+// Fixture that holds a diagram with one of the scenes and offers the phases of
+// the plant's discrete step to the benchmark cases.
+class ContactScenes : public benchmark::Fixture {
+ public:
+  ContactScenes() { tools::performance::AddMinMaxStatistics(this); }
+
+  void SetUp(benchmark::State& state) override {
+    MakeDiagram(static_cast<Scene>(state.range(0)),
+                static_cast<Solver>(state.range(1)));
+    Settle();
+    tools::performance::TareMemoryManager();
+  }
+
+ protected:
+  // Builds diagram_ with the given scene, for the given contact solver.
+  void MakeDiagram(Scene scene, Solver solver);
+
+  // Adds the scenes to the (unfinalized) plant_.
+  void AddClutterBin();
+  void AddAllegroHand();
+  void AddHydroelasticStack();
+  void AddDeformableGripper();
+
+  // Simulates the scene for a short while, so that the objects are in contact
+  // when the benchmark starts.
+  void Settle();
+
+  // Marks the plant's state as changed, so that the next evaluation of the
+  // discrete step recomputes everything.
+  void InvalidateState() { plant_context_->get_mutable_discrete_state(); }
+
+  // Performs the geometry queries for the scene's contact model.
+  void ComputeGeometryQueries();
+
+  std::unique_ptr<DiagramBuilder<double>> builder_;
+  MultibodyPlant<double>* plant_{};
+  geometry::SceneGraph<double>* scene_graph_{};
+  const DeformableModel<double>* deformable_model_{};
+  std::unique_ptr<Diagram<double>> diagram_;
+  std::unique_ptr<Context<double>> context_;
+  Context<double>* plant_context_{};
+};
+
+void ContactScenes::MakeDiagram(Scene scene, Solver solver) {
+  MultibodyPlantConfig config;
+  config.time_step = kTimeStep;
+  config.discrete_contact_solver = (solver == kSap) ? "sap" : "tamsi";
+  switch (scene) {
+    case kClutterBin:
+      config.contact_model = "point";
+      break;
+    case kHydroelasticStack:
+      config.contact_model = "hydroelastic";
+      break;
+    case kAllegroHand:
+    case kDeformableGripper:
+      config.contact_model = "hydroelastic_with_fallback";
+      break;
+  }
+
+  builder_ = std::make_unique<DiagramBuilder<double>>();
+  auto [plant, scene_graph] = AddMultibodyPlant(config, builder_.get());
+  plant_ = &plant;
+  scene_graph_ = &scene_graph;
+  deformable_model_ = nullptr;
+  switch (scene) {
+    case kClutterBin:
+      AddClutterBin();
+      break;
+    case kAllegroHand:
+      AddAllegroHand();
+      break;
+    case kHydroelasticStack:
+      AddHydroelasticStack();
+      break;
+    case kDeformableGripper:
+      AddDeformableGripper();
+      break;
+  }
+  plant_->Finalize();
+  if (deformable_model_ != nullptr) {
+    builder_->Connect(deformable_model_->vertex_positions_port(),
+                      scene_graph_->get_source_configuration_port(
+                          plant_->get_source_id().value()));
+  }
+  diagram_ = builder_->Build();
+  context_ = diagram_->CreateDefaultContext();
+  plant_context_ = &plant_->GetMyMutableContextFromRoot(context_.get());
+}
+
+// Twelve YCB objects dropped into a bin, with point contact.
+void ContactScenes::AddClutterBin() {
+  ProximityProperties bin_props;
+  AddContactMaterial({}, {}, kFriction, &bin_props);
+  const double kWidth = 0.4;
+  const double kThickness = 0.02;
+  const double kHeight = 0.3;
+  const auto add_wall = [&](const std::string& name, const Box& box,
+                            const Vector3d& p_WB) {
+    plant_->RegisterCollisionGeometry(plant_->world_body(),
+                                      RigidTransformd(p_WB), box, name,
+                                      bin_props);
+  };
+  add_wall("floor", Box(kWidth, kWidth, kThickness),
+           Vector3d(0, 0, -kThickness / 2));
+  add_wall("wall_xn", Box(kThickness, kWidth, kHeight),
+           Vector3d(-kWidth / 2, 0, kHeight / 2));
+  add_wall("wall_xp", Box(kThickness, kWidth, kHeight),
+           Vector3d(kWidth / 2, 0, kHeight / 2));
+  add_wall("wall_yn", Box(kWidth, kThickness, kHeight),
+           Vector3d(0, -kWidth / 2, kHeight / 2));
+  add_wall("wall_yp", Box(kWidth, kThickness, kHeight),
+           Vector3d(0, kWidth / 2, kHeight / 2));
+
+  const std::vector<std::string> objects{
+      "003_cracker_box",    "004_sugar_box",   "005_tomato_soup_can",
+      "006_mustard_bottle", "009_gelatin_box", "010_potted_meat_can"};
+  Parser parser(plant_);
+  parser.SetAutoRenaming(true);
+  for (int layer = 0; layer < 2; ++layer) {
+    for (int i = 0; i < static_cast<int>(objects.size()); ++i) {
+      const ModelInstanceIndex model_instance =
+          parser
+              .AddModelsFromUrl(fmt::format(
+                  "package://drake/manipulation/models/ycb/sdf/{}.sdf",
+                  objects[i]))
+              .at(0);
+      const Body<double>& body =
+          plant_->get_body(plant_->GetBodyIndices(model_instance).at(0));
+      // Arrange the objects on a 3 x 2 grid, with a different orientation in
+      // each layer so that they tumble into each other.
+      const Vector3d p_WB(-0.1 + 0.1 * (i % 3), -0.05 + 0.1 * (i / 3),
+                          0.1 + 0.2 * layer);
+      plant_->SetDefaultFreeBodyPose(
+          body, RigidTransformd(RollPitchYawd(0.3 * i, M_PI / 2 * layer, 0),
+                                p_WB));
+    }
+  }
+}
+
+// An actuated allegro hand (without gravity) closing around a cylinder.
+void ContactScenes::AddAllegroHand() {
+  Parser parser(plant_);
+  const ModelInstanceIndex hand = parser.AddModelsFromUrl(
+      "package://drake/manipulation/models/allegro_hand_description/sdf/"
+      "allegro_hand_description_right.sdf").at(0);
+  plant_->WeldFrames(plant_->world_frame(),
+                     plant_->GetFrameByName("hand_root", hand));
+  for (const JointIndex& joint_index : plant_->GetJointIndices(hand)) {
+    const Joint<double>& joint = plant_->get_joint(joint_index);
+    if (joint.type_name() == RevoluteJoint<double>::kTypeName) {
+      plant_->AddJointActuator(joint.name() + "_actuator", joint);
+    }
+  }
+  plant_->mutable_gravity_field().set_gravity_vector(Vector3d::Zero());
+
+  // A cylinder of roughly the size of a mug, in the middle of the fingers.
+  ProximityProperties props;
+  AddContactMaterial({}, {}, kFriction, &props);
+  AddRigidHydroelasticProperties(0.01, &props);
+  const double kRadius = 0.04;
+  const double kLength = 0.12;
+  const RigidBody<double>& object = plant_->AddRigidBody(
+      "object", SpatialInertia<double>::SolidCylinderWithMass(
+                    0.1, kRadius, kLength, Vector3d::UnitZ()));
+  plant_->RegisterCollisionGeometry(object, RigidTransformd(),
+                                    Cylinder(kRadius, kLength), "object",
+                                    props);
+  plant_->SetDefaultFreeBodyPose(
+      object, RigidTransformd(RollPitchYawd(M_PI / 2, 0, 0),
+                              Vector3d(0.095, 0.062, 0.095)));
+}
+
+// A stack of compliant hydroelastic boxes on a rigid ground.
+void ContactScenes::AddHydroelasticStack() {
+  ProximityProperties ground_props;
+  AddContactMaterial({}, {}, kFriction, &ground_props);
+  AddRigidHydroelasticProperties(&ground_props);
+  plant_->RegisterCollisionGeometry(plant_->world_body(),
+                                    RigidTransformd(Vector3d(0, 0, -0.05)),
+                                    Box(1.0, 1.0, 0.1), "ground", ground_props);
+
+  ProximityProperties box_props;
+  AddContactMaterial(0.1 /* dissipation */, {}, kFriction, &box_props);
+  AddCompliantHydroelasticProperties(0.02 /* resolution hint */,
+                                     1e6 /* hydroelastic modulus */,
+                                     &box_props);
+  const double kSize = 0.1;
+  const int kNumBoxes = 6;
+  for (int i = 0; i < kNumBoxes; ++i) {
+    const RigidBody<double>& box = plant_->AddRigidBody(
+        fmt::format("box{}", i),
+        SpatialInertia<double>::SolidCubeWithMass(0.5, kSize));
+    plant_->RegisterCollisionGeometry(box, RigidTransformd(),
+                                      Box(kSize, kSize, kSize),
+                                      fmt::format("box{}", i), box_props);
+    // Offset the boxes a little so that the stack is not perfectly aligned.
+    plant_->SetDefaultFreeBodyPose(
+        box, RigidTransformd(RollPitchYawd(0, 0, 0.1 * i),
+                             Vector3d(0.01 * (i % 2), 0, (i + 0.5) * kSize)));
+  }
+}
+
+// A deformable ball squeezed between the two fingers of a simple gripper.
+void ContactScenes::AddDeformableGripper() {
+  ProximityProperties rigid_props;
+  AddContactMaterial({}, {}, kFriction, &rigid_props);
+  // Rigid geometries need a resolution hint to interact with deformables.
+  rigid_props.AddProperty(geometry::internal::kHydroGroup,
+                          geometry::internal::kRezHint, 0.01);
+  plant_->RegisterCollisionGeometry(plant_->world_body(),
+                                    RigidTransformd(Vector3d(0, 0, -0.05)),
+                                    Box(1.0, 1.0, 0.1), "ground", rigid_props);
+
+  const double kRadius = 0.05;
+  const Vector3d finger_size(0.02, 0.08, 0.08);
+  for (const double side : {-1.0, 1.0}) {
+    const std::string name = side < 0 ? "left_finger" : "right_finger";
+    const RigidBody<double>& finger = plant_->AddRigidBody(
+        name, SpatialInertia<double>::SolidBoxWithMass(
+                  0.1, finger_size.x(), finger_size.y(), finger_size.z()));
+    plant_->RegisterCollisionGeometry(
+        finger, RigidTransformd(),
+        Box(finger_size.x(), finger_size.y(), finger_size.z()), name,
+        rigid_props);
+    const PrismaticJoint<double>& slider = plant_->AddJoint<PrismaticJoint>(
+        name + "_slider", plant_->world_body(),
+        RigidTransformd(Vector3d(side * (kRadius + finger_size.x() / 2), 0,
+                                 kRadius)),
+        finger, std::nullopt, Vector3d::UnitX());
+    plant_->AddJointActuator(name + "_actuator", slider);
+  }
+
+  auto deformable_model = std::make_unique<DeformableModel<double>>(plant_);
+  fem::DeformableBodyConfig<double> deformable_config;
+  deformable_config.set_youngs_modulus(1e5);
+  deformable_config.set_poissons_ratio(0.4);
+  deformable_config.set_mass_density(1e3);
+  auto ball = std::make_unique<GeometryInstance>(
+      RigidTransformd(Vector3d(0, 0, kRadius)), Sphere(kRadius), "ball");
+  ProximityProperties deformable_props;
+  AddContactMaterial({}, {}, kFriction, &deformable_props);
+  ball->set_proximity_properties(deformable_props);
+  deformable_model->RegisterDeformableBody(std::move(ball), deformable_config,
+                                           0.02 /* resolution hint */);
+  deformable_model_ = deformable_model.get();
+  plant_->AddPhysicalModel(std::move(deformable_model));
+}
+
+void ContactScenes::Settle() {
+  if (plant_->num_actuators() > 0) {
+    // Squeeze the fingers (or close the hand's joints) with a constant effort.
+    Eigen::VectorXd u = Eigen::VectorXd::Constant(plant_->num_actuators(), 0.1);
+    if (deformable_model_ != nullptr) {
+      // The left finger pushes towards +x, the right one towards -x.
+      u << 5.0, -5.0;
+    }
+    plant_->get_actuation_input_port().FixValue(plant_context_, u);
+  }
+  Simulator<double> simulator(*diagram_, std::move(context_));
+  simulator.AdvanceTo(0.2);
+  context_ = simulator.release_context();
+  plant_context_ = &plant_->GetMyMutableContextFromRoot(context_.get());
+}
+
+void ContactScenes::ComputeGeometryQueries() {
+  const auto& query_object =
+      plant_->get_geometry_query_input_port().Eval<QueryObject<double>>(
+          *plant_context_);
+  switch (plant_->get_contact_model()) {
+    case ContactModel::kPoint: {
+      benchmark::DoNotOptimize(query_object.ComputePointPairPenetration());
+      break;
+    }
+    case ContactModel::kHydroelastic: {
+      benchmark::DoNotOptimize(query_object.ComputeContactSurfaces(
+          plant_->get_contact_surface_representation()));
+      break;
+    }
+    case ContactModel::kHydroelasticWithFallback: {
+      std::vector<geometry::ContactSurface<double>> surfaces;
+      std::vector<geometry::PenetrationAsPointPair<double>> point_pairs;
+      query_object.ComputeContactSurfacesWithFallback(
+          plant_->get_contact_surface_representation(), &surfaces,
+          &point_pairs);
+      benchmark::DoNotOptimize(surfaces);
+      benchmark::DoNotOptimize(point_pairs);
+      break;
+    }
+  }
+  if (deformable_model_ != nullptr) {
+    geometry::internal::DeformableContact<double> deformable_contact;
+    query_object.ComputeDeformableContact(&deformable_contact);
+    benchmark::DoNotOptimize(deformable_contact);
+  }
+}
+
+BENCHMARK_DEFINE_F(ContactScenes, GeometryQueries)
+// NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+(benchmark::State& state) {
+  for (auto _ : state) {
+    InvalidateState();
+    ComputeGeometryQueries();
+  }
+}
+
+BENCHMARK_DEFINE_F(ContactScenes, ContactKinematics)
+// NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+(benchmark::State& state) {
+  const auto& manager = MultibodyPlantTester::manager(*plant_);
+  for (auto _ : state) {
+    InvalidateState();
+    benchmark::DoNotOptimize(manager.EvalContactKinematics(*plant_context_));
+  }
+}
+
+BENCHMARK_DEFINE_F(ContactScenes, FreeMotionDynamics)
+// NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+(benchmark::State& state) {
+  const int nv = plant_->num_velocities();
+  Eigen::MatrixXd M(nv, nv);
+  Eigen::VectorXd C(nv);
+  MultibodyForces<double> forces(*plant_);
+  for (auto _ : state) {
+    InvalidateState();
+    plant_->CalcMassMatrix(*plant_context_, &M);
+    plant_->CalcBiasTerm(*plant_context_, &C);
+    plant_->CalcForceElementsContribution(*plant_context_, &forces);
+  }
+}
+
+BENCHMARK_DEFINE_F(ContactScenes, ContactSolve)
+// NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+(benchmark::State& state) {
+  const auto& manager = MultibodyPlantTester::manager(*plant_);
+  for (auto _ : state) {
+    InvalidateState();
+    benchmark::DoNotOptimize(manager.EvalContactSolverResults(*plant_context_));
+  }
+}
+
+BENCHMARK_DEFINE_F(ContactScenes, Step)
+// NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+(benchmark::State& state) {
+  for (auto _ : state) {
+    InvalidateState();
+    benchmark::DoNotOptimize(
+        plant_->EvalUniquePeriodicDiscreteUpdate(*plant_context_));
+  }
+}
+
+// Registers the given case for every scene and solver. TAMSI does not support
+// deformable bodies, so the deformable gripper only runs with SAP.
+void RegisterScenes(benchmark::internal::Benchmark* b) {
+  b->Unit(benchmark::kMicrosecond);
+  for (const int scene : {kClutterBin, kAllegroHand, kHydroelasticStack}) {
+    b->Args({scene, kTamsi});
+    b->Args({scene, kSap});
+  }
+  b->Args({kDeformableGripper, kSap});
+}
+
+BENCHMARK_REGISTER_F(ContactScenes, GeometryQueries)->Apply(RegisterScenes);
+BENCHMARK_REGISTER_F(ContactScenes, ContactKinematics)->Apply(RegisterScenes);
+BENCHMARK_REGISTER_F(ContactScenes, FreeMotionDynamics)->Apply(RegisterScenes);
+BENCHMARK_REGISTER_F(ContactScenes, ContactSolve)->Apply(RegisterScenes);
+BENCHMARK_REGISTER_F(ContactScenes, Step)->Apply(RegisterScenes);
+
+}  // namespace
+}  // namespace multibody
+}  // namespace drake
+
+BENCHMARK_MAIN();
@@ -1,6 +1,9 @@
 // @file
 // Benchmark for GlobalInverseKinematics on the dual-arm TRI Homecart.
 
+#include <optional>
+#include <vector>
+
 #include "drake/common/find_resource.h"
 #include "drake/multibody/inverse_kinematics/global_inverse_kinematics.h"
 #include "drake/multibody/parsing/parser.h"
@@ -56,6 +59,46 @@ BENCHMARK_F(HomecartGlobalIkBenchmark, PostureCost)(benchmark::State& state) {
   }
 }
 
+// This benchmark solves for several poses of the left end effector, reusing
+// one program (and its relaxation of SO(3)) for all of them and warm-starting
+// each solve from the previous solution.
+BENCHMARK_F(HomecartGlobalIkBenchmark, PoseSweep)(benchmark::State& state) {  // NOLINT
+  multibody::MultibodyPlant<double> plant(0.0);
+  geometry::SceneGraph<double> scene_graph;
+  plant.RegisterAsSourceForSceneGraph(&scene_graph);
+  multibody::Parser parser(&plant);
+  parser.AddModels(
+      FindResourceOrThrow("drake/manipulation/models/tri_homecart/"
+                          "homecart_no_grippers.dmd.yaml"));
+  plant.Finalize();
+
+  Eigen::VectorXd q0(plant.num_positions());
+  q0 << 1.75, -1.04, 1.27, -1.79, -2.75, 0.25, -1.45, -2.5, -1.04, -1.32, 3.11,
+      0;
+  const Body<double>& ee = plant.GetBodyByName(
+      "ur_ee_link", plant.GetModelInstanceByName("ur3_left"));
+
+  // Targets reached by small perturbations of q0.
+  auto context = plant.CreateDefaultContext();
+  std::vector<math::RigidTransformd> X_WQ_targets;
+  for (int i = 0; i < 4; ++i) {
+    plant.SetPositions(context.get(),
+                       q0 + 0.05 * i * Eigen::VectorXd::Ones(q0.size()));
+    X_WQ_targets.push_back(plant.EvalBodyPoseInWorld(*context, ee));
+  }
+
+  GlobalInverseKinematicsSweepOptions options;
+  options.position_tolerance = 0.01;
+  options.orientation_tolerance = 0.05;
+  for (auto _ : state) {
+    const std::vector<std::optional<Eigen::VectorXd>> q =
+        SolveGlobalInverseKinematicsSweep(plant, ee.index(),
+                                          math::RigidTransformd(),
+                                          X_WQ_targets, options);
+    DRAKE_DEMAND(q.back().has_value());
+  }
+}
+
 }  // namespace
 }  // namespace inverse_kinematics
 }  // namespace multibody
@@ -0,0 +1,116 @@
+// @file
+// Benchmarks for the startup time of a MultibodyPlant.
+//
+// This measures the time from a parsed (but not finalized) plant to its first
+// discrete step: Finalize(), CreateDefaultContext(), and the first discrete
+// update. Programs that restart often (e.g., pools of simulation workers) pay
+// these costs every time.
+
+#include <memory>
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include "drake/common/find_resource.h"
+#include "drake/geometry/scene_graph.h"
+#include "drake/multibody/parsing/parser.h"
+#include "drake/multibody/plant/multibody_plant.h"
+#include "drake/systems/framework/diagram.h"
+#include "drake/systems/framework/diagram_builder.h"
+#include "drake/tools/performance/fixture_common.h"
+
+namespace drake {
+namespace multibody {
+namespace {
+
+using systems::Context;
+using systems::Diagram;
+using systems::DiagramBuilder;
+
+class PlantStartupFixture : public benchmark::Fixture {
+ public:
+  PlantStartupFixture() { tools::performance::AddMinMaxStatistics(this); }
+
+ protected:
+  // Builds (but does not finalize) a plant with `kNumIiwas` arms. The plant
+  // and scene graph are owned by `builder_`.
+  void AddModels() {
+    const int kNumIiwas = 20;
+    const std::string iiwa_path = FindResourceOrThrow(
+        "drake/manipulation/models/iiwa_description/sdf/"
+        "iiwa14_polytope_collision.sdf");
+
+    builder_ = std::make_unique<DiagramBuilder<double>>();
+    plant_ = &AddMultibodyPlantSceneGraph(builder_.get(), 0.001).plant;
+    Parser parser{plant_};
+    parser.SetAutoRenaming(true);
+    for (int i = 0; i < kNumIiwas; ++i) {
+      const ModelInstanceIndex model_instance =
+          parser.AddModels(iiwa_path).at(0);
+      plant_->WeldFrames(
+          plant_->world_frame(),
+          plant_->GetFrameByName("iiwa_link_0", model_instance),
+          math::RigidTransformd(Eigen::Vector3d(0, 0.5 * i, 0)));
+    }
+  }
+
+  // Finalizes the plant and builds the diagram.
+  void Build() {
+    plant_->Finalize();
+    diagram_ = builder_->Build();
+  }
+
+  std::unique_ptr<DiagramBuilder<double>> builder_;
+  MultibodyPlant<double>* plant_{};
+  std::unique_ptr<Diagram<double>> diagram_;
+};
+
+BENCHMARK_DEFINE_F(PlantStartupFixture, Finalize)
+// NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+(benchmark::State& state) {
+  for (auto _ : state) {
+    state.PauseTiming();
+    AddModels();
+    state.ResumeTiming();
+    Build();
+  }
+}
+BENCHMARK_REGISTER_F(PlantStartupFixture, Finalize)
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_DEFINE_F(PlantStartupFixture, CreateDefaultContext)
+// NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+(benchmark::State& state) {
+  AddModels();
+  Build();
+  for (auto _ : state) {
+    std::unique_ptr<Context<double>> context = diagram_->CreateDefaultContext();
+    benchmark::DoNotOptimize(context);
+  }
+}
+BENCHMARK_REGISTER_F(PlantStartupFixture, CreateDefaultContext)
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_DEFINE_F(PlantStartupFixture, TimeToFirstStep)
+// NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+(benchmark::State& state) {
+  for (auto _ : state) {
+    state.PauseTiming();
+    AddModels();
+    state.ResumeTiming();
+    Build();
+    std::unique_ptr<Context<double>> context = diagram_->CreateDefaultContext();
+    const Context<double>& plant_context =
+        plant_->GetMyContextFromRoot(*context);
+    benchmark::DoNotOptimize(
+        plant_->EvalUniquePeriodicDiscreteUpdate(plant_context));
+  }
+}
+BENCHMARK_REGISTER_F(PlantStartupFixture, TimeToFirstStep)
+    ->Unit(benchmark::kMillisecond);
+
+}  // namespace
+}  // namespace multibody
+}  // namespace drake
+
+BENCHMARK_MAIN();
@@ -1,9 +1,11 @@
 #include "drake/multibody/contact_solvers/block_sparse_cholesky_solver.h"
 
 #include <algorithm>
+#include <atomic>
 #include <utility>
 #include <vector>
 
+#include "drake/common/parallel_for.h"
 #include "drake/multibody/contact_solvers/minimum_degree_ordering.h"
 
 namespace drake {
@@ -23,6 +25,7 @@ void BlockSparseCholeskySolver<BlockType>::SetMatrix(const SymmetricMatrix& A) {
   BlockSparsityPattern L_block_pattern =
       SymbolicFactor(A, elimination_ordering);
   SetMatrixImpl(A, elimination_ordering, std::move(L_block_pattern));
+  schur_complement_analysis_.reset();
 }
 
 template <typename BlockType>
@@ -63,10 +66,35 @@ BlockSparseCholeskySolver<BlockType>::FactorAndCalcSchurComplement(
    associated with `eliminated_blocks` are eliminated first. There are
    many ordering that satisfy this requirement, and we look for one that reduces
    fill-in. */
-  const std::vector<int> elimination_ordering =
-      ComputeMinimumDegreeOrdering(A.sparsity_pattern(), eliminated_blocks);
-  SetMatrixImpl(A, elimination_ordering,
-                SymbolicFactor(A, elimination_ordering));
+  std::vector<int> sorted_eliminated_blocks(eliminated_blocks.begin(),
+                                            eliminated_blocks.end());
+  std::sort(sorted_eliminated_blocks.begin(), sorted_eliminated_blocks.end());
+  /* The ordering and the symbolic factorization only depend on the sparsity
+   pattern of A and on the eliminated blocks. When both are unchanged since the
+   last call (e.g., for successive tangent matrices of the same FEM model),
+   only the numeric values need to be updated. */
+  const bool reuse_analysis =
+      L_ != nullptr && schur_complement_analysis_.has_value() &&
+      schur_complement_analysis_->sorted_eliminated_blocks ==
+          sorted_eliminated_blocks &&
+      schur_complement_analysis_->A_block_sizes ==
+          A.sparsity_pattern().block_sizes() &&
+      schur_complement_analysis_->A_neighbors ==
+          A.sparsity_pattern().neighbors();
+  if (reuse_analysis) {
+    UpdateMatrix(A);
+  } else {
+    std::vector<int> ordering =
+        ComputeMinimumDegreeOrdering(A.sparsity_pattern(), eliminated_blocks);
+    SetMatrixImpl(A, ordering, SymbolicFactor(A, ordering));
+    schur_complement_analysis_ = SchurComplementAnalysis{
+        .A_block_sizes = A.sparsity_pattern().block_sizes(),
+        .A_neighbors = A.sparsity_pattern().neighbors(),
+        .sorted_eliminated_blocks = std::move(sorted_eliminated_blocks),
+        .elimination_ordering = std::move(ordering)};
+  }
+  const std::vector<int>& elimination_ordering =
+      schur_complement_analysis_->elimination_ordering;
 
   /* Reset solver mode and exit if factorization of the eliminated blocks fails.
    */
@@ -257,10 +285,38 @@ void BlockSparseCholeskySolver<BlockType>::SetMatrixImpl(
   /* Third documented responsibility: allocate for `L_` and `L_diag_`. */
   L_ = std::make_unique<LowerTriangularMatrix>(std::move(L_pattern));
   L_diag_.resize(A.block_cols());
-  /* Fourth documented responsibility: UpdateMatrix. */
+  /* Fourth documented responsibility: analyze the elimination tree. */
+  AnalyzeEliminationTree();
+  /* Fifth documented responsibility: UpdateMatrix. */
   UpdateMatrix(A);
 }
 
+template <typename BlockType>
+void BlockSparseCholeskySolver<BlockType>::AnalyzeEliminationTree() {
+  const int n = L_->block_cols();
+  row_structure_.assign(n, {});
+  std::vector<int> heights(n, 0);
+  int max_height = 0;
+  for (int k = 0; k < n; ++k) {
+    const std::vector<int>& row_blocks = L_->block_row_indices(k);
+    for (int flat = 1; flat < ssize(row_blocks); ++flat) {
+      row_structure_[row_blocks[flat]].emplace_back(k, flat);
+    }
+    /* The parent of k in the elimination tree is the first off-diagonal
+     nonzero block row of column k (see SymbolicCholeskyFactor()). Since the
+     parent comes after k, the height of k is final at this point. */
+    max_height = std::max(max_height, heights[k]);
+    if (ssize(row_blocks) > 1) {
+      int& parent_height = heights[row_blocks[1]];
+      parent_height = std::max(parent_height, heights[k] + 1);
+    }
+  }
+  etree_levels_.assign(n > 0 ? max_height + 1 : 0, {});
+  for (int k = 0; k < n; ++k) {
+    etree_levels_[heights[k]].push_back(k);
+  }
+}
+
 template <typename BlockType>
 void BlockSparseCholeskySolver<BlockType>::SetScalarPermutation(
     const SymmetricMatrix& A, const std::vector<int>& elimination_ordering) {
@@ -341,12 +397,23 @@ bool BlockSparseCholeskySolver<BlockType>::CalcPartialFactorization(
   DRAKE_DEMAND(starting_col_block >= 0 &&
                starting_col_block <= L_->block_cols());
   DRAKE_DEMAND(ending_col_block >= 0 && ending_col_block <= L_->block_cols());
-  for (int j = starting_col_block; j < ending_col_block; ++j) {
+  /* We use a left-looking factorization: each column j first applies the
+   updates from the columns it depends on, and then is factored. Those updates
+   are applied in the same order as the right-looking updates of a serial
+   factorization would be, so the result is the same bit for bit, but each
+   column only writes to itself, which allows the columns that don't depend
+   on each other to be processed concurrently. The columns before
+   `starting_col_block` have already applied their updates to all subsequent
+   columns (see below). */
+  std::atomic<bool> success{true};
+  auto factor_column = [&](int j) {
+    ApplyLeftLookingUpdates(j, starting_col_block, j);
     /* Update diagonal. */
     const BlockType& Ajj = L_->diagonal_block(j);
     L_diag_[j].compute(Ajj);
     if (L_diag_[j].info() != Eigen::Success) {
-      return false;
+      success = false;
+      return;
     }
     L_->SetBlockFlat(0, j, L_diag_[j].matrixL());
     /* Update L₂₁ column.
@@ -363,25 +430,52 @@ bool BlockSparseCholeskySolver<BlockType>::CalcPartialFactorization(
       BlockType Lij = Ljj.solve(Aij.transpose()).transpose();
       L_->SetBlockFlat(flat, j, std::move(Lij));
     }
-    /* Update L₂₂ according to L₂₂ = a₂₂ - L₂₁⋅L₂₁ᵀ. */
-    RightLookingSymmetricRank1Update(j);
+  };
+  std::vector<int> level_columns;
+  for (const std::vector<int>& level : etree_levels_) {
+    level_columns.clear();
+    for (int j : level) {
+      if (starting_col_block <= j && j < ending_col_block) {
+        level_columns.push_back(j);
+      }
+    }
+    drake::internal::ParallelFor(parallelism_, ssize(level_columns),
+                                 [&](int c) {
+                                   factor_column(level_columns[c]);
+                                 });
+    if (!success) {
+      return false;
+    }
   }
+  /* Apply the updates from the factored columns to the remaining columns, so
+   that they hold L₂₂ = a₂₂ - L₂₁⋅L₂₁ᵀ (e.g., the Schur complement of the
+   factored columns). */
+  const int num_remaining_cols = L_->block_cols() - ending_col_block;
+  drake::internal::ParallelFor(parallelism_, num_remaining_cols, [&](int c) {
+    ApplyLeftLookingUpdates(ending_col_block + c, starting_col_block,
+                            ending_col_block);
+  });
   return true;
 }
 
 template <typename BlockType>
-void BlockSparseCholeskySolver<BlockType>::RightLookingSymmetricRank1Update(
-    int j) {
-  const std::vector<int>& blocks_in_col_j = L_->block_row_indices(j);
-  const int n = blocks_in_col_j.size();
-  /* We start from k = 1 here to skip the j,j diagonal entry. */
-  for (int k = 1; k < n; ++k) {
-    const int col = blocks_in_col_j[k];
-    const BlockType& B = L_->block_flat(k, j);
-    for (int l = k; l < n; ++l) {
-      const int row = blocks_in_col_j[l];
-      const BlockType& A = L_->block_flat(l, j);
-      L_->AddToBlock(row, col, -A * B.transpose());
+void BlockSparseCholeskySolver<BlockType>::ApplyLeftLookingUpdates(int j,
+                                                                   int begin,
+                                                                   int end) {
+  for (const auto& [k, flat_jk] : row_structure_[j]) {
+    if (k < begin) {
+      continue;
+    }
+    if (k >= end) {
+      break;
+    }
+    const std::vector<int>& blocks_in_col_k = L_->block_row_indices(k);
+    const BlockType& B = L_->block_flat(flat_jk, k);
+    /* The blocks of column k in rows j and below. */
+    for (int l = flat_jk; l < ssize(blocks_in_col_k); ++l) {
+      const int row = blocks_in_col_k[l];
+      const BlockType& A = L_->block_flat(l, k);
+      L_->AddToBlock(row, j, -A * B.transpose());
     }
   }
 }
@@ -3,11 +3,13 @@
 #include <memory>
 #include <optional>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 #include "drake/common/copyable_unique_ptr.h"
 #include "drake/common/drake_copyable.h"
 #include "drake/common/eigen_types.h"
+#include "drake/common/parallelism.h"
 #include "drake/common/reset_after_move.h"
 #include "drake/multibody/contact_solvers/block_sparse_lower_triangular_or_symmetric_matrix.h"
 #include "drake/multibody/contact_solvers/sap/partial_permutation.h"
@@ -156,6 +158,11 @@ class BlockSparseCholeskySolver {
    If the fatorization of A is successful, returns the Schur complement
    S = C - BᵀD⁻¹B.
 
+   The elimination ordering and the symbolic factorization are reused from the
+   previous call to this function if neither the sparsity pattern of `A` nor
+   `eliminated_blocks` have changed (and SetMatrix() hasn't been called since),
+   so that repeated calls only pay for the numeric factorization.
+
    @pre `eliminated_blocks` has all its entries in [0, A.block_cols()).
    @post solver_mode() is SolverMode::kFactored if factorization is successful
    and is SolverMode::kEmpty otherwise. */
@@ -175,6 +182,17 @@ class BlockSparseCholeskySolver {
    @throws std::exception unless solver_mode() == SolverMode::kFactored. */
   void SolveInPlace(VectorX<double>* b) const;
 
+  /* Sets the number of threads used by Factor() and
+   FactorAndCalcSchurComplement(). Each block column of L is factored once all
+   the columns it depends on (its descendants in the elimination tree) are
+   factored, so that the columns in independent subtrees of the elimination
+   tree are factored concurrently. The factorization does not depend on the
+   number of threads. Defaults to Parallelism::None(). */
+  void set_parallelism(Parallelism parallelism) { parallelism_ = parallelism; }
+
+  /* Returns the parallelism set with set_parallelism(). */
+  Parallelism parallelism() const { return parallelism_; }
+
   /* Returns the current mode of the solver. See SolverMode. */
   SolverMode solver_mode() const { return solver_mode_; }
 
@@ -199,7 +217,9 @@ class BlockSparseCholeskySolver {
     1. sets `block_permutation_`;
     2. sets `scalar_permutation_`;
     3. allocates for `L_` and `L_diag_`;
-    4. calls UpdateMatrix(A) to copy the numeric values of A to L_.
+    4. sets `row_structure_` and `etree_levels_` from the sparsity pattern of
+       L_;
+    5. calls UpdateMatrix(A) to copy the numeric values of A to L_.
    @param[in] A                     The matrix to be factored.
    @param[in] elimination_ordering  Elimination ordering of the blocks of A.
                                     Must be a permutation of {0, 1, ...,
@@ -229,19 +249,28 @@ class BlockSparseCholeskySolver {
   BlockSparsityPattern SymbolicFactor(
       const SymmetricMatrix& A, const std::vector<int>& elimination_ordering);
 
+  /* Sets `row_structure_` and `etree_levels_` from the sparsity pattern of
+   L_. */
+  void AnalyzeEliminationTree();
+
   /* Factorizes matrix A but in particular only processes a range of columns.
    If the range of columns is [0, L_.block_cols()), then this method performs a
    full factorization of A. Otherwise, this leaves the underlying factorization
    in an intermediate state and therefore successive calls to this method
-   must be performed with care.
+   must be performed with care. In that intermediate state, the columns after
+   the range hold the Schur complement of the columns up to the range's end,
+   as they would after the corresponding steps of a right-looking
+   factorization.
    @note this function does not modify solver mode.
    @pre solver_mode() == kAnalyzed.
    @pre 0 <= starting_col_block <= ending_col_block <= L.block_cols(). */
   bool CalcPartialFactorization(int starting_col_block, int ending_col_block);
 
-  /* Performs L(j+1:, j+1:) -= L(j+1:, j) * L(j+1:, j).transpose().
-   @pre 0 <= j < L.block_cols(). */
-  void RightLookingSymmetricRank1Update(int j);
+  /* Performs L(j:, j) -= L(j:, k) * L(j, k).transpose() for each factored
+   column k in [begin, end) with a nonzero block L(j, k), in increasing order of
+   k. Only writes to the j-th block column of L_.
+   @pre 0 <= begin <= end <= j < L.block_cols(). */
+  void ApplyLeftLookingUpdates(int j, int begin, int end);
 
   /* Permutes the given matrix A with `block_permutation_` p and set L such that
    the lower triangular part of L satisfies L(p(i), p(j)) = A(i, j).
@@ -253,6 +282,17 @@ class BlockSparseCholeskySolver {
   copyable_unique_ptr<LowerTriangularMatrix> L_;
   std::vector<Eigen::LLT<BlockType>> L_diag_;
 
+  /* The nonzero blocks in each block row of L_ (excluding the diagonal): for
+   each j, the pairs (k, flat) for k < j with L(j, k) ≠ 0, where `flat` is the
+   flat index of L(j, k) in the k-th block column, in increasing order of k. */
+  std::vector<std::vector<std::pair<int, int>>> row_structure_;
+  /* The block columns of L_ grouped by their height in the elimination tree
+   (a leaf has height 0), in increasing order. A column only depends on its
+   descendants, which have smaller heights, so the columns of a group can be
+   factored independently of each other. */
+  std::vector<std::vector<int>> etree_levels_;
+  Parallelism parallelism_{Parallelism::None()};
+
   /* Block and scalar representations of the permutation matrix P (see
    CalcPermutationMatrix()). */
   /* Permutation for block indices, same size as A.block_cols(). For a given
@@ -264,6 +304,16 @@ class BlockSparseCholeskySolver {
    index into L_. */
   PartialPermutation scalar_permutation_;
 
+  /* The inputs and the elimination ordering of the last call to
+   FactorAndCalcSchurComplement() that required a symbolic factorization. */
+  struct SchurComplementAnalysis {
+    std::vector<int> A_block_sizes;
+    std::vector<std::vector<int>> A_neighbors;
+    std::vector<int> sorted_eliminated_blocks;
+    std::vector<int> elimination_ordering;
+  };
+  std::optional<SchurComplementAnalysis> schur_complement_analysis_;
+
   reset_after_move<SolverMode> solver_mode_{SolverMode::kEmpty};
 };
 
@@ -1,7 +1,10 @@
 #include "drake/multibody/contact_solvers/block_sparse_supernodal_solver.h"
 
+#include <array>
 #include <utility>
 
+#include "drake/common/parallel_for.h"
+
 using Eigen::MatrixXd;
 
 namespace drake {
@@ -35,19 +38,58 @@ bool MassMatrixPartitionEqualsJacobianPartition(
 
 BlockSparseSuperNodalSolver::BlockSparseSuperNodalSolver(
     int num_jacobian_row_blocks, std::vector<BlockTriplet> jacobian_blocks,
-    std::vector<Eigen::MatrixXd> mass_matrices)
-    : jacobian_blocks_(std::move(jacobian_blocks)),
-      mass_matrices_(std::move(mass_matrices)) {
+    std::vector<Eigen::MatrixXd> mass_matrices, Parallelism parallelism)
+    : parallelism_(parallelism) {
+  solver_.set_parallelism(parallelism);
+  H_ = std::make_unique<BlockSparseSymmetricMatrix>(SetJacobianAndMassMatrices(
+      num_jacobian_row_blocks, std::move(jacobian_blocks),
+      std::move(mass_matrices)));
+  /* The solver analyzes the sparsity pattern of the H_ (currently a zero
+   matrix) so that subsequent updates to the matrix can use UpdateMatrix()
+   that doesn't perform symbolic factorization and allocation. */
+  solver_.SetMatrix(*H_);
+}
+
+BlockSparseSuperNodalSolver::~BlockSparseSuperNodalSolver() = default;
+
+bool BlockSparseSuperNodalSolver::Reset(
+    int num_jacobian_row_blocks, std::vector<BlockTriplet> jacobian_blocks,
+    std::vector<Eigen::MatrixXd> mass_matrices) {
+  BlockSparsityPattern pattern = SetJacobianAndMassMatrices(
+      num_jacobian_row_blocks, std::move(jacobian_blocks),
+      std::move(mass_matrices));
+  InvalidateMatrixAndFactorization();
+  const BlockSparsityPattern& current_pattern = H_->sparsity_pattern();
+  if (pattern.block_sizes() == current_pattern.block_sizes() &&
+      pattern.neighbors() == current_pattern.neighbors()) {
+    /* The elimination ordering and the sparsity pattern of L computed for the
+     current H_ remain valid; DoSetWeightMatrix() only updates numeric values
+     with UpdateMatrix(). */
+    return true;
+  }
+  H_ = std::make_unique<BlockSparseSymmetricMatrix>(std::move(pattern));
+  solver_.SetMatrix(*H_);
+  return false;
+}
+
+BlockSparsityPattern BlockSparseSuperNodalSolver::SetJacobianAndMassMatrices(
+    int num_jacobian_row_blocks, std::vector<BlockTriplet> jacobian_blocks,
+    std::vector<Eigen::MatrixXd> mass_matrices) {
+  /* Verify the arguments before modifying any member, so that a failed
+   Reset() leaves the solver as it was. Throw an exception if verification
+   fails. */
   const std::vector<int> jacobian_column_block_size =
-      GetJacobianBlockSizesVerifyTriplets(jacobian_blocks_);
-  /* Throw an exception if verification fails. */
+      GetJacobianBlockSizesVerifyTriplets(jacobian_blocks);
   if (!MassMatrixPartitionEqualsJacobianPartition(jacobian_column_block_size,
-                                                  mass_matrices_)) {
+                                                  mass_matrices)) {
     throw std::runtime_error(
         "Mass matrices and constraint Jacobians are incompatible.");
   }
-  row_to_triplet_index_ =
-      GetRowToTripletMapping(num_jacobian_row_blocks, jacobian_blocks_);
+  std::vector<std::vector<int>> row_to_triplet_index =
+      GetRowToTripletMapping(num_jacobian_row_blocks, jacobian_blocks);
+  jacobian_blocks_ = std::move(jacobian_blocks);
+  mass_matrices_ = std::move(mass_matrices);
+  row_to_triplet_index_ = std::move(row_to_triplet_index);
 
   const int num_nodes = mass_matrices_.size();
   std::vector<int> block_sizes(num_nodes);
@@ -71,35 +113,21 @@ BlockSparseSuperNodalSolver::BlockSparseSuperNodalSolver(
       sparsity[j].emplace_back(i);
     }
   }
-  H_ = std::make_unique<BlockSparseSymmetricMatrix>(
-      BlockSparsityPattern(std::move(block_sizes), std::move(sparsity)));
-  /* The solver analyzes the sparsity pattern of the H_ (currently a zero
-   matrix) so that subsequent updates to the matrix can use UpdateMatrix()
-   that doesn't perform symbolic factorization and allocation. */
-  solver_.SetMatrix(*H_);
+  return BlockSparsityPattern(std::move(block_sizes), std::move(sparsity));
 }
 
-BlockSparseSuperNodalSolver::~BlockSparseSuperNodalSolver() = default;
-
 bool BlockSparseSuperNodalSolver::DoSetWeightMatrix(
     const std::vector<Eigen::MatrixXd>& weight_matrix) {
-  H_->SetZero();
-  /* Add mass matrices. */
-  const int block_cols = mass_matrices_.size();
-  for (int i = 0; i < block_cols; ++i) {
-    H_->SetBlock(i, i, mass_matrices_[i]);
-  }
-  /* Add in JᵀGJ terms. */
   const int num_constraints = row_to_triplet_index_.size();
   DRAKE_THROW_UNLESS(ssize(weight_matrix) >= num_constraints);
   // TODO(xuchenhan-tri): Getting the starting indices of G blocks as well as
   // checking partitions of G refines partitions of block rows of J should
   // happen in the base class.
   /* Recall that the partition of the weight matrix G is a refinement on the
-   partition of the block rows of J. Here we use `weight_start` and
-   `weight_end` to track the indices into `weight_matrix` that corresponds to
+   partition of the block rows of J. Here we record in `weight_start_[k]` and
+   `weight_start_[k + 1]` the indices into `weight_matrix` that correspond to
    the k-th block row of J. */
-  int weight_start = 0;
+  weight_start_.assign(num_constraints + 1, 0);
   int weight_end = 0;
   for (int k = 0; k < num_constraints; ++k) {
     const std::vector<int>& triplet_indices = row_to_triplet_index_[k];
@@ -113,22 +141,32 @@ bool BlockSparseSuperNodalSolver::DoSetWeightMatrix(
     if (G_rows != num_constraint_equations) {
       return false;
     }
+    weight_start_[k + 1] = weight_end;
+  }
 
+  /* The JᵀGJ terms of each block row of J are independent of each other; we
+   compute them (possibly in parallel) into per-row storage and then add them
+   into H in order, so that the result doesn't depend on the number of
+   threads. For the k-th block row with a single block Jⱼ, we store JⱼᵀGJⱼ in
+   JTGJ_[k][0]; for the k-th block row with blocks Jⱼ and Jᵢ (j < i), we store
+   JᵢᵀGJᵢ, JᵢᵀGJⱼ and JⱼᵀGJⱼ in JTGJ_[k][0], JTGJ_[k][1] and JTGJ_[k][2]. The
+   storage persists across calls, so that it is only reallocated when the
+   problem grows or its block sizes change. */
+  if (ssize(JTGJ_) < num_constraints) JTGJ_.resize(num_constraints);
+  auto calc_row = [&](int k) {
+    const std::vector<int>& triplet_indices = row_to_triplet_index_[k];
+    const int w_start = weight_start_[k];
+    const int w_end = weight_start_[k + 1] - 1;
     if (triplet_indices.size() == 1) {
       const MatrixBlock<double>& J = jacobian_blocks_[triplet_indices[0]].value;
-      const MatrixBlock<double> GJ = J.LeftMultiplyByBlockDiagonal(
-          weight_matrix, weight_start, weight_end - 1);
-      MatrixXd JTGJ = MatrixXd::Zero(J.cols(), J.cols());
+      const MatrixBlock<double> GJ =
+          J.LeftMultiplyByBlockDiagonal(weight_matrix, w_start, w_end);
+      JTGJ_[k][0].setZero(J.cols(), J.cols());
       // TODO(xuchenhan-tri): Consider adding a more specialized routine for
       // computing JᵢᵀGJⱼ to further exploit sparsity. */
-      J.TransposeAndMultiplyAndAddTo(GJ, &JTGJ);
-      const int c = jacobian_blocks_[triplet_indices[0]].col;
-      H_->AddToBlock(c, c, std::move(JTGJ));
+      J.TransposeAndMultiplyAndAddTo(GJ, &JTGJ_[k][0]);
     } else {
       DRAKE_DEMAND(triplet_indices.size() == 2);
-      const int j = jacobian_blocks_[triplet_indices[0]].col;
-      const int i = jacobian_blocks_[triplet_indices[1]].col;
-      DRAKE_DEMAND(j < i);
       const MatrixBlock<double>& Jj =
           jacobian_blocks_[triplet_indices[0]].value;
       const MatrixBlock<double>& Ji =
@@ -136,24 +174,42 @@ bool BlockSparseSuperNodalSolver::DoSetWeightMatrix(
 
       // TODO(xuchenhan-tri): Consider adding a more specialized routine for
       // computing JᵀGJ to further exploit sparsity. */
-      const MatrixBlock<double> GJj = Jj.LeftMultiplyByBlockDiagonal(
-          weight_matrix, weight_start, weight_end - 1);
-      const MatrixBlock<double> GJi = Ji.LeftMultiplyByBlockDiagonal(
-          weight_matrix, weight_start, weight_end - 1);
-
-      MatrixXd JiTGJi = MatrixXd::Zero(Ji.cols(), Ji.cols());
-      MatrixXd JiTGJj = MatrixXd::Zero(Ji.cols(), Jj.cols());
-      MatrixXd JjTGJj = MatrixXd::Zero(Jj.cols(), Jj.cols());
-
-      Ji.TransposeAndMultiplyAndAddTo(GJi, &JiTGJi);
-      Ji.TransposeAndMultiplyAndAddTo(GJj, &JiTGJj);
-      Jj.TransposeAndMultiplyAndAddTo(GJj, &JjTGJj);
-
-      H_->AddToBlock(i, i, JiTGJi);
-      H_->AddToBlock(i, j, JiTGJj);
-      H_->AddToBlock(j, j, JjTGJj);
+      const MatrixBlock<double> GJj =
+          Jj.LeftMultiplyByBlockDiagonal(weight_matrix, w_start, w_end);
+      const MatrixBlock<double> GJi =
+          Ji.LeftMultiplyByBlockDiagonal(weight_matrix, w_start, w_end);
+
+      JTGJ_[k][0].setZero(Ji.cols(), Ji.cols());
+      JTGJ_[k][1].setZero(Ji.cols(), Jj.cols());
+      JTGJ_[k][2].setZero(Jj.cols(), Jj.cols());
+
+      Ji.TransposeAndMultiplyAndAddTo(GJi, &JTGJ_[k][0]);
+      Ji.TransposeAndMultiplyAndAddTo(GJj, &JTGJ_[k][1]);
+      Jj.TransposeAndMultiplyAndAddTo(GJj, &JTGJ_[k][2]);
+    }
+  };
+  drake::internal::ParallelFor(parallelism_, num_constraints, calc_row);
+
+  H_->SetZero();
+  /* Add mass matrices. */
+  const int block_cols = mass_matrices_.size();
+  for (int i = 0; i < block_cols; ++i) {
+    H_->SetBlock(i, i, mass_matrices_[i]);
+  }
+  /* Add in JᵀGJ terms. */
+  for (int k = 0; k < num_constraints; ++k) {
+    const std::vector<int>& triplet_indices = row_to_triplet_index_[k];
+    if (triplet_indices.size() == 1) {
+      const int c = jacobian_blocks_[triplet_indices[0]].col;
+      H_->AddToBlock(c, c, JTGJ_[k][0]);
+    } else {
+      const int j = jacobian_blocks_[triplet_indices[0]].col;
+      const int i = jacobian_blocks_[triplet_indices[1]].col;
+      DRAKE_DEMAND(j < i);
+      H_->AddToBlock(i, i, JTGJ_[k][0]);
+      H_->AddToBlock(i, j, JTGJ_[k][1]);
+      H_->AddToBlock(j, j, JTGJ_[k][2]);
     }
-    weight_start = weight_end;
   }
   solver_.UpdateMatrix(*H_);
   return true;
@@ -1,11 +1,13 @@
 #pragma once
 
+#include <array>
 #include <memory>
 #include <vector>
 
 #include <Eigen/Dense>
 
 #include "drake/common/drake_copyable.h"
+#include "drake/common/parallelism.h"
 #include "drake/multibody/contact_solvers/block_sparse_cholesky_solver.h"
 #include "drake/multibody/contact_solvers/supernodal_solver.h"
 
@@ -36,14 +38,42 @@ class BlockSparseSuperNodalSolver final : public SuperNodalSolver {
      columns of the mass matrix and the block columns of the Jacobian J both
      induce a partition of the set {0, 1, ..., nᵥ - 1}, where nᵥ denotes the
      number of scalar variables. These two partitions must be the same,
-     otherwise an exception is thrown. */
+     otherwise an exception is thrown.
+   @param[in] parallelism
+     The number of threads used to compute the JᵀGJ terms of the block rows
+     of J when setting the weight matrix, and to factor the resulting matrix.
+     Neither the matrix nor its factorization depends on the number of
+     threads.
+   */
   BlockSparseSuperNodalSolver(int num_jacobian_row_blocks,
                               std::vector<BlockTriplet> jacobian_blocks,
-                              std::vector<Eigen::MatrixXd> mass_matrices);
+                              std::vector<Eigen::MatrixXd> mass_matrices,
+                              Parallelism parallelism = Parallelism::None());
 
   ~BlockSparseSuperNodalSolver() final;
 
+  /* Re-initializes this solver for a new Jacobian J and mass matrix M, with
+   the same semantics and requirements on the arguments as the constructor.
+   If the block sparsity pattern of H = M + JᵀGJ implied by the new J and M is
+   the same as the current one, the symbolic analysis of H (its elimination
+   ordering and the sparsity pattern of its Cholesky factor) and the memory
+   allocated for the factorization are reused. Otherwise, H is analyzed anew.
+   Either way, SetWeightMatrix() must be called before Factor().
+   @returns `true` iff the symbolic analysis was reused.
+   @throws std::exception if the arguments are invalid, in which case the
+   solver is left unchanged. */
+  bool Reset(int num_jacobian_row_blocks,
+             std::vector<BlockTriplet> jacobian_blocks,
+             std::vector<Eigen::MatrixXd> mass_matrices);
+
  private:
+  /* Sets `jacobian_blocks_`, `mass_matrices_` and `row_to_triplet_index_`
+   from the given arguments, verifying them as documented in the constructor,
+   and returns the block sparsity pattern of H = M + JᵀGJ they imply. */
+  BlockSparsityPattern SetJacobianAndMassMatrices(
+      int num_jacobian_row_blocks, std::vector<BlockTriplet> jacobian_blocks,
+      std::vector<Eigen::MatrixXd> mass_matrices);
+
   /* NVI implementations. */
   bool DoSetWeightMatrix(
       const std::vector<Eigen::MatrixXd>& block_diagonal_G) final;
@@ -66,6 +96,11 @@ class BlockSparseSuperNodalSolver final : public SuperNodalSolver {
   std::vector<BlockTriplet> jacobian_blocks_;
   /* Diagonal blocks of the block diagonal matrix M. */
   std::vector<Eigen::MatrixXd> mass_matrices_;
+  Parallelism parallelism_;
+  /* Scratch storage for DoSetWeightMatrix(), kept to avoid reallocating it
+   on every call. */
+  std::vector<int> weight_start_;
+  std::vector<std::array<Eigen::MatrixXd, 3>> JTGJ_;
 
   BlockSparseCholeskySolver<Eigen::MatrixXd> solver_;
 };
@@ -0,0 +1,126 @@
+#include "drake/multibody/contact_solvers/conjugate_gradient.h"
+
+#include <stdexcept>
+
+#include <fmt/format.h>
+
+namespace drake {
+namespace multibody {
+namespace contact_solvers {
+namespace internal {
+
+template <typename T>
+BlockJacobiPreconditioner<T>::BlockJacobiPreconditioner(
+    const std::string& name, const std::vector<MatrixX<T>>& diagonal_blocks)
+    : LinearOperator<T>(name) {
+  block_llts_.reserve(diagonal_blocks.size());
+  block_start_.reserve(diagonal_blocks.size());
+  for (int i = 0; i < ssize(diagonal_blocks); ++i) {
+    const MatrixX<T>& Di = diagonal_blocks[i];
+    if (Di.rows() != Di.cols()) {
+      throw std::runtime_error(fmt::format(
+          "BlockJacobiPreconditioner: block {} of size {}x{} is not square.", i,
+          Di.rows(), Di.cols()));
+    }
+    block_llts_.emplace_back(Di);
+    if (block_llts_.back().info() != Eigen::Success) {
+      throw std::runtime_error(fmt::format(
+          "BlockJacobiPreconditioner: the Cholesky factorization of block {} "
+          "failed. Is it positive definite?",
+          i));
+    }
+    block_start_.push_back(size_);
+    size_ += Di.rows();
+  }
+}
+
+template <typename T>
+BlockJacobiPreconditioner<T>::~BlockJacobiPreconditioner() = default;
+
+template <typename T>
+void BlockJacobiPreconditioner<T>::DoMultiply(
+    const Eigen::Ref<const Eigen::SparseVector<T>>& x,
+    Eigen::SparseVector<T>* y) const {
+  // The inverse of a block is generally dense and therefore we simply
+  // operate on dense vectors.
+  VectorX<T> y_dense(size_);
+  DoMultiply(VectorX<T>(x), &y_dense);
+  y->resize(size_);
+  y->setZero();
+  for (int i = 0; i < size_; ++i) {
+    if (y_dense(i) != 0.0) y->insert(i) = y_dense(i);
+  }
+}
+
+template <typename T>
+void BlockJacobiPreconditioner<T>::DoMultiply(
+    const Eigen::Ref<const VectorX<T>>& x, VectorX<T>* y) const {
+  for (int i = 0; i < ssize(block_llts_); ++i) {
+    const int start = block_start_[i];
+    const int size = block_llts_[i].rows();
+    y->segment(start, size) = block_llts_[i].solve(x.segment(start, size));
+  }
+}
+
+template <typename T>
+bool SolveWithPreconditionedConjugateGradient(
+    const LinearOperator<T>& A, const LinearOperator<T>& P,
+    const VectorX<T>& b, double relative_tolerance, int max_iterations,
+    VectorX<T>* x, int* num_iterations) {
+  DRAKE_DEMAND(x != nullptr);
+  DRAKE_DEMAND(relative_tolerance >= 0);
+  DRAKE_DEMAND(max_iterations >= 0);
+  const int n = b.size();
+  DRAKE_DEMAND(A.rows() == n && A.cols() == n);
+  DRAKE_DEMAND(P.rows() == n && P.cols() == n);
+
+  x->setZero(n);
+  // Residual r = b - A⋅x, preconditioned residual z = P⋅r and search
+  // direction p.
+  VectorX<T> r = b;
+  VectorX<T> z(n);
+  VectorX<T> Ap(n);
+  P.Multiply(r, &z);
+  VectorX<T> p = z;
+  T r_dot_z = r.dot(z);
+  const T tolerance = relative_tolerance * b.norm();
+
+  int k = 0;
+  bool converged = r.norm() <= tolerance;
+  for (; !converged && k < max_iterations; ++k) {
+    A.Multiply(p, &Ap);
+    const T p_dot_Ap = p.dot(Ap);
+    // This can only happen if A is not positive definite or due to round-off
+    // once the residual is already negligible. Either way, we cannot make
+    // progress.
+    if (!(p_dot_Ap > 0)) break;
+    const T alpha = r_dot_z / p_dot_Ap;
+    *x += alpha * p;
+    r -= alpha * Ap;
+    converged = r.norm() <= tolerance;
+    if (converged) {
+      ++k;
+      break;
+    }
+    P.Multiply(r, &z);
+    const T r_dot_z_next = r.dot(z);
+    const T beta = r_dot_z_next / r_dot_z;
+    r_dot_z = r_dot_z_next;
+    p = z + beta * p;
+  }
+
+  if (num_iterations != nullptr) *num_iterations = k;
+  return converged;
+}
+
+DRAKE_DEFINE_FUNCTION_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_NONSYMBOLIC_SCALARS(
+    (&SolveWithPreconditionedConjugateGradient<T>))
+
+}  // namespace internal
+}  // namespace contact_solvers
+}  // namespace multibody
+}  // namespace drake
+
+DRAKE_DEFINE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_NONSYMBOLIC_SCALARS(
+    class ::drake::multibody::contact_solvers::internal::
+        BlockJacobiPreconditioner)
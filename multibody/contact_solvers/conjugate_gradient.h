@@ -0,0 +1,109 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include <Eigen/Dense>
+
+#include "drake/common/default_scalars.h"
+#include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
+#include "drake/multibody/contact_solvers/linear_operator.h"
+
+namespace drake {
+namespace multibody {
+namespace contact_solvers {
+namespace internal {
+
+// A LinearOperator that applies the inverse of a block diagonal symmetric
+// positive definite matrix D = diag(D₀, D₁, ..., Dₙ₋₁), i.e. y = D⁻¹⋅x. The
+// blocks of D are factorized at construction. Typically used as a (block
+// Jacobi) preconditioner for SolveWithPreconditionedConjugateGradient(), with
+// D the block diagonal of the system matrix.
+//
+// @tparam_nonsymbolic_scalar
+template <typename T>
+class BlockJacobiPreconditioner final : public LinearOperator<T> {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(BlockJacobiPreconditioner)
+
+  // Constructs the inverse of the block diagonal matrix with the given
+  // `diagonal_blocks`.
+  // @throws std::exception if any of the blocks is not square or its Cholesky
+  // factorization fails (e.g. it is not positive definite).
+  BlockJacobiPreconditioner(const std::string& name,
+                            const std::vector<MatrixX<T>>& diagonal_blocks);
+
+  ~BlockJacobiPreconditioner() final;
+
+  int rows() const final { return size_; }
+  int cols() const final { return size_; }
+
+ private:
+  void DoMultiply(const Eigen::Ref<const Eigen::SparseVector<T>>& x,
+                  Eigen::SparseVector<T>* y) const final;
+
+  void DoMultiply(const Eigen::Ref<const VectorX<T>>& x,
+                  VectorX<T>* y) const final;
+
+  // D is symmetric and so is its inverse.
+  void DoMultiplyByTranspose(const Eigen::Ref<const VectorX<T>>& x,
+                             VectorX<T>* y) const final {
+    DoMultiply(x, y);
+  }
+
+  std::vector<Eigen::LLT<MatrixX<T>>> block_llts_;
+  // block_start_[i] is the index of the first row of the i-th block.
+  std::vector<int> block_start_;
+  int size_{0};
+};
+
+// Solves the linear system A⋅x = b with the preconditioned conjugate gradient
+// method, where A is a symmetric positive definite operator and P ≈ A⁻¹ is a
+// symmetric positive definite preconditioner, see e.g. Algorithm 5.3 in
+// [Nocedal and Wright, 2006]. Only products with A and P are needed, and
+// therefore the memory footprint is that of a few vectors of size b.size()
+// plus whatever the operators themselves store.
+//
+// Iterations stop when ‖A⋅x − b‖ ≤ relative_tolerance⋅‖b‖ or after
+// max_iterations. Since x is initialized to zero, an approximate solution
+// from any number of iterations (at least one) satisfies bᵀ⋅x > 0 for b ≠ 0.
+// This makes truncated solves suitable as search directions for descent
+// methods.
+//
+// Iterations also stop if a search direction p with pᵀ⋅A⋅p ≤ 0 is found,
+// which can only happen if A is not positive definite (or due to round-off).
+// If that happens on the first iteration, no progress at all was made: this
+// function returns false with x = 0 and zero iterations, and callers that need
+// a descent direction must resort to some other method.
+//
+// - [Nocedal and Wright, 2006] Nocedal, J. and Wright, S., 2006. Numerical
+//   Optimization. Springer Science & Business Media.
+//
+// @param[in] A The operator A. Must be square.
+// @param[in] P The preconditioner P ≈ A⁻¹, same size as A.
+// @param[in] b The right hand side.
+// @param[in] relative_tolerance The relative tolerance on the residual.
+// @param[in] max_iterations The maximum number of iterations.
+// @param[out] x On output, the approximate solution.
+// @param[out] num_iterations If not nullptr, on output the number of
+// iterations performed.
+// @returns true if the tolerance was reached within max_iterations. If b ≠ 0
+// and max_iterations > 0, false with *num_iterations == 0 means that the
+// method broke down on the first iteration, see above.
+// @pre x != nullptr.
+// @pre relative_tolerance >= 0 and max_iterations >= 0.
+template <typename T>
+bool SolveWithPreconditionedConjugateGradient(
+    const LinearOperator<T>& A, const LinearOperator<T>& P,
+    const VectorX<T>& b, double relative_tolerance, int max_iterations,
+    VectorX<T>* x, int* num_iterations = nullptr);
+
+}  // namespace internal
+}  // namespace contact_solvers
+}  // namespace multibody
+}  // namespace drake
+
+DRAKE_DECLARE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_NONSYMBOLIC_SCALARS(
+    class ::drake::multibody::contact_solvers::internal::
+        BlockJacobiPreconditioner)
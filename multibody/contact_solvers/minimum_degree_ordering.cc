@@ -1,10 +1,12 @@
 #include "drake/multibody/contact_solvers/minimum_degree_ordering.h"
 
 #include <algorithm>
+#include <cstdint>
 #include <functional>
 #include <set>
 #include <utility>
 
+#include "drake/common/parallel_for.h"
 #include "drake/multibody/contact_solvers/sap/partial_permutation.h"
 
 namespace drake {
@@ -20,51 +22,19 @@ std::vector<int> Union(const std::vector<int>& a, const std::vector<int>& b) {
   return result;
 }
 
-std::vector<int> SetDifference(const std::vector<int>& a,
-                               const std::vector<int>& b) {
-  std::vector<int> result;
-  result.reserve(a.size());
-  std::set_difference(a.begin(), a.end(), b.begin(), b.end(),
-                      std::back_inserter(result));
-  return result;
-}
-
-void RemoveValueFromSortedVector(int value, std::vector<int>* sorted_vector) {
-  auto it =
-      std::lower_bound(sorted_vector->begin(), sorted_vector->end(), value);
-  /* Check if the value was found and remove it. */
-  while (it != sorted_vector->end() && *it == value) {
-    it = sorted_vector->erase(it);
-  }
-}
-
-void InsertValueInSortedVector(int value, std::vector<int>* sorted_vector) {
-  auto it =
-      std::lower_bound(sorted_vector->begin(), sorted_vector->end(), value);
-  /* Check if the value doesn't already exist and insert it. */
-  if (it == sorted_vector->end() || *it != value) {
-    sorted_vector->insert(it, value);
-  }
-}
-
-void Node::UpdateExternalDegree(const std::vector<Node>& nodes) {
-  degree = 0;
-
-  /* Add in |Aᵢ \ i| term. */
+void Node::UpdateApproximateExternalDegree(
+    const std::vector<Node>& nodes, int p, int Lp_size,
+    const std::vector<int>& external_sizes) {
+  /* Add in |Aᵢ \ i| and |Lp \ i| terms. */
+  degree = Lp_size - size;
   for (int a : A) {
     degree += nodes[a].size;
   }
-
-  /* Add in |L \ i| term where L = ∪ₑLₑ and e ∈ Eᵢ. */
-  std::vector<int> L_union;
-  // TODO(xuchenhan-tri): This can be quadratic in the worst case and can be
-  // made more efficient by doing a K-way union if needed.
+  /* Add in |Lₑ \ Lp| for e ∈ Eᵢ \ p. */
   for (int e : E) {
-    L_union = Union(L_union, nodes[e].L);
-  }
-  RemoveValueFromSortedVector(index, &L_union);
-  for (int l : L_union) {
-    degree += nodes[l].size;
+    if (e != p) {
+      degree += external_sizes[e];
+    }
   }
 }
 
@@ -73,6 +43,21 @@ std::vector<int> ComputeMinimumDegreeOrdering(
   return ComputeMinimumDegreeOrdering(block_sparsity_pattern, {});
 }
 
+namespace {
+
+/* The life cycle of a node in the quotient graph. A variable either becomes an
+ element when it is eliminated, or is eliminated along with the element it is
+ adjacent to through mass elimination. An element is eventually absorbed into
+ a newer element. */
+enum class NodeStatus : uint8_t {
+  kVariable,
+  kElement,
+  kAbsorbed,
+  kMassEliminated,
+};
+
+}  // namespace
+
 std::vector<int> ComputeMinimumDegreeOrdering(
     const BlockSparsityPattern& block_sparsity_pattern,
     const std::unordered_set<int>& priority_elements) {
@@ -81,9 +66,14 @@ std::vector<int> ComputeMinimumDegreeOrdering(
   const std::vector<int>& block_sizes = block_sparsity_pattern.block_sizes();
   const int num_nodes = block_sizes.size();
   std::vector<Node> nodes(num_nodes);
+  std::vector<int> priorities(num_nodes);
+  /* The number of simple variables that have yet to be eliminated. */
+  int remaining_size = 0;
   for (int n = 0; n < num_nodes; ++n) {
     nodes[n].index = n;
     nodes[n].size = block_sizes[n];
+    priorities[n] = priority_elements.count(n) > 0 ? 0 : 1;
+    remaining_size += block_sizes[n];
   }
   for (int n = 0; n < num_nodes; ++n) {
     Node& node = nodes[n];
@@ -100,12 +90,6 @@ std::vector<int> ComputeMinimumDegreeOrdering(
       }
     }
   }
-  /* Maintain the invariance that A, E, L vectors in a node are all sorted. */
-  for (auto& node : nodes) {
-    std::vector<int>& A = node.A;
-    /* Only A is non-empty at this point. */
-    std::sort(A.begin(), A.end());
-  }
 
   /* The ideal data structure to use here is a priority queue implemeneted by a
    heap. However, the Minimum Degree algorithm requires updating neighboring
@@ -117,62 +101,145 @@ std::vector<int> ComputeMinimumDegreeOrdering(
   /* Keep the nodes sorted by degrees and break ties with indices. We use a
    striped down version of the node to keep only the necessary information
    (degree and index). */
+  auto simplified = [&](int n) {
+    return SimplifiedNode{.degree = nodes[n].degree,
+                          .index = n,
+                          .priority = priorities[n]};
+  };
   for (int n = 0; n < num_nodes; ++n) {
-    SimplifiedNode node = {
-        .degree = nodes[n].degree,
-        .index = nodes[n].index,
-        .priority = priority_elements.count(nodes[n].index) > 0 ? 0 : 1};
-    sorted_nodes.insert(node);
+    sorted_nodes.insert(simplified(n));
   }
 
+  std::vector<NodeStatus> status(num_nodes, NodeStatus::kVariable);
+  /* element_sizes[e] is |Lₑ| for each element e. */
+  std::vector<int> element_sizes(num_nodes, 0);
+  /* Workspaces that are valid during the elimination of the variable p only:
+   in_Lp[i] == p iff the variable i is in Lp, and external_sizes[e] is |Lₑ \ Lp|
+   iff has_external_size[e] == p. Tagging the entries with p avoids clearing
+   the workspaces between eliminations. */
+  std::vector<int> in_Lp(num_nodes, -1);
+  std::vector<int> has_external_size(num_nodes, -1);
+  std::vector<int> external_sizes(num_nodes, 0);
+  std::vector<int> mass_eliminated;
+
   /* The resulting elimination ordering. */
-  std::vector<int> result(num_nodes);
+  std::vector<int> result;
+  result.reserve(num_nodes);
   /* Begin elimination. */
-  for (int k = 0; k < num_nodes; ++k) {
-    DRAKE_DEMAND(ssize(sorted_nodes) == num_nodes - k);
+  while (!sorted_nodes.empty()) {
     const SimplifiedNode min_node =
         sorted_nodes.extract(sorted_nodes.begin()).value();
     /* p is the variable to be eliminated next. */
     const int p = min_node.index;
-    result[k] = p;
+    result.push_back(p);
     Node& node_p = nodes[p];
+    remaining_size -= node_p.size;
 
-    /* Turn node p from a variable to an element. */
-    node_p.L = node_p.A;
-    /* Absorb into Lp all variables adjacent to element e where e is adjacent to
-     p. Make sure to exclude p itself since p is turning from a variable into an
-     element. */
+    /* Turn node p from a variable to an element, with Lp the union of Ap and
+     of Lₑ for all elements e adjacent to p, excluding p itself. Those elements
+     are absorbed into p. */
+    std::vector<int>& Lp = node_p.L;
+    in_Lp[p] = p;
+    auto add_to_Lp = [&](int i) {
+      if (status[i] == NodeStatus::kVariable && in_Lp[i] != p) {
+        in_Lp[i] = p;
+        Lp.push_back(i);
+      }
+    };
+    for (int a : node_p.A) {
+      add_to_Lp(a);
+    }
     for (int e : node_p.E) {
-      node_p.L = Union(node_p.L, nodes[e].L);
+      if (status[e] == NodeStatus::kElement) {
+        for (int i : nodes[e].L) {
+          add_to_Lp(i);
+        }
+        status[e] = NodeStatus::kAbsorbed;
+        std::vector<int>().swap(nodes[e].L);
+      }
+    }
+    status[p] = NodeStatus::kElement;
+    std::vector<int>().swap(node_p.A);
+    std::vector<int>().swap(node_p.E);
+    int Lp_size = 0;
+    for (int i : Lp) {
+      Lp_size += nodes[i].size;
+    }
+
+    /* Compute |Lₑ \ Lp| for every element e adjacent to a variable in Lp, by
+     subtracting from |Lₑ| the sizes of the variables of Lp that are in Lₑ
+     (Algorithm 2 in [Amestoy 1996]). */
+    for (int i : Lp) {
+      for (int e : nodes[i].E) {
+        if (status[e] != NodeStatus::kElement) {
+          continue;
+        }
+        if (has_external_size[e] != p) {
+          has_external_size[e] = p;
+          external_sizes[e] = element_sizes[e];
+        }
+        external_sizes[e] -= nodes[i].size;
+      }
     }
-    RemoveValueFromSortedVector(p, &(node_p.L));
+
     /* Update all neighboring variables of p. */
-    for (int i : node_p.L) {
+    mass_eliminated.clear();
+    for (int i : Lp) {
       Node& node_i = nodes[i];
-      const SimplifiedNode old_node = {
-          .degree = node_i.degree,
-          .index = node_i.index,
-          .priority = priority_elements.count(node_i.index) > 0 ? 0 : 1};
-      /* Pruning. */
-      node_i.A = SetDifference(node_i.A, node_p.L);
-      /* Convert p from a variable to an element in node i. Note that Lp was
-       already updated prior to the loop, and therefore we can now safely
-       remove the absorbed elements in node i */
-      node_i.E = SetDifference(node_i.E, node_p.E);
-      RemoveValueFromSortedVector(p, &(node_i.A));
-      InsertValueInSortedVector(p, &(node_i.E));
-      /* Compute external degree. */
-      node_i.UpdateExternalDegree(nodes);
-      SimplifiedNode new_node = {.degree = node_i.degree,
-                                 .index = node_i.index,
-                                 .priority = old_node.priority};
-      sorted_nodes.erase(old_node);
-      sorted_nodes.insert(new_node);
+      sorted_nodes.erase(simplified(i));
+      /* Prune the elements absorbed into p. An element e with Lₑ ⊆ Lp is
+       absorbed into p as well (aggressive absorption), since p now implies all
+       of its fill. */
+      std::erase_if(node_i.E, [&](int e) {
+        if (status[e] == NodeStatus::kElement && external_sizes[e] == 0) {
+          status[e] = NodeStatus::kAbsorbed;
+          std::vector<int>().swap(nodes[e].L);
+        }
+        return status[e] != NodeStatus::kElement;
+      });
+      /* Prune the variables in Lp, which are now adjacent to i through p. */
+      std::erase_if(node_i.A, [&](int a) {
+        return status[a] != NodeStatus::kVariable || in_Lp[a] == p;
+      });
+      /* A variable that is only adjacent to p would not cause any fill beyond
+       what p causes, so it can be eliminated right away (mass elimination),
+       unless that would put it ahead of nodes of higher priority. */
+      if (node_i.A.empty() && node_i.E.empty() &&
+          priorities[i] == priorities[p]) {
+        status[i] = NodeStatus::kMassEliminated;
+        mass_eliminated.push_back(i);
+        remaining_size -= node_i.size;
+        Lp_size -= node_i.size;
+        continue;
+      }
+      node_i.E.push_back(p);
+    }
+    if (!mass_eliminated.empty()) {
+      /* Lp is in no particular order, so sort the mass eliminated variables to
+       keep ties in the natural order. */
+      std::sort(mass_eliminated.begin(), mass_eliminated.end());
+      result.insert(result.end(), mass_eliminated.begin(),
+                    mass_eliminated.end());
+      std::erase_if(Lp, [&](int i) {
+        return status[i] == NodeStatus::kMassEliminated;
+      });
+    }
+    element_sizes[p] = Lp_size;
+
+    /* Compute the approximate external degrees, further bounded by the number
+     of remaining variables and by the previous degree plus the fill caused by
+     p (equation (4.1) in [Amestoy 1996]). */
+    for (int i : Lp) {
+      Node& node_i = nodes[i];
+      const int old_degree = node_i.degree;
+      node_i.UpdateApproximateExternalDegree(nodes, p, Lp_size, external_sizes);
+      node_i.degree =
+          std::min({node_i.degree, remaining_size - node_i.size,
+                    old_degree + Lp_size - node_i.size});
+      sorted_nodes.insert(simplified(i));
     }
-    /* Convert node p from a supervariable to an element. */
-    node_p.A.clear();
-    node_p.E.clear();
   }
+  DRAKE_DEMAND(ssize(result) == num_nodes);
   return result;
 }
 
@@ -228,7 +295,7 @@ BlockSparsityPattern SymbolicCholeskyFactor(
 
 std::vector<int> CalcAndConcatenateMdOrderingWithinGroup(
     const BlockSparsityPattern& global_pattern,
-    const std::unordered_set<int>& v1) {
+    const std::unordered_set<int>& v1, Parallelism parallelism) {
   /* Sizes of v, v1, and v2. */
   const int n = global_pattern.block_sizes().size();
   const int n1 = v1.size();
@@ -282,10 +349,17 @@ std::vector<int> CalcAndConcatenateMdOrderingWithinGroup(
     }
   }
 
-  const std::vector<int> v1_ordering = ComputeMinimumDegreeOrdering(
-      BlockSparsityPattern(std::move(v1_block_sizes), std::move(G1)));
-  const std::vector<int> v2_ordering = ComputeMinimumDegreeOrdering(
-      BlockSparsityPattern(std::move(v2_block_sizes), std::move(G2)));
+  std::vector<int> v1_ordering;
+  std::vector<int> v2_ordering;
+  drake::internal::ParallelFor(parallelism, 2, [&](int group) {
+    if (group == 0) {
+      v1_ordering = ComputeMinimumDegreeOrdering(
+          BlockSparsityPattern(std::move(v1_block_sizes), std::move(G1)));
+    } else {
+      v2_ordering = ComputeMinimumDegreeOrdering(
+          BlockSparsityPattern(std::move(v2_block_sizes), std::move(G2)));
+    }
+  });
 
   std::vector<int> result;
   result.reserve(n);
@@ -7,6 +7,7 @@
 #include <unordered_set>
 #include <vector>
 
+#include "drake/common/parallelism.h"
 #include "drake/multibody/contact_solvers/block_sparse_lower_triangular_or_symmetric_matrix.h"
 
 namespace drake {
@@ -18,22 +19,8 @@ namespace internal {
  @pre a and b are sorted in increasing order. */
 std::vector<int> Union(const std::vector<int>& a, const std::vector<int>& b);
 
-/* Returns the set difference of a and b (a \ b) as a sorted vector.
- @pre a and b are sorted in increasing order. */
-std::vector<int> SetDifference(const std::vector<int>& a,
-                               const std::vector<int>& b);
-
-/* Removes `value` from `sorted_vector` if it exists.
- @pre `sorted_vector` is sorted in increasing order. */
-void RemoveValueFromSortedVector(int value, std::vector<int>* sorted_vector);
-
-/* Inserts `value` into `sorted_vector` if it doesn't already exists while
- preserving the order of `sorted_vector`.
- @pre `sorted_vector` is sorted in increasing order. */
-void InsertValueInSortedVector(int value, std::vector<int>* sorted_vector);
-
-/* Data structure for a node in an elimination graph as described in Algorithm 1
- in [Amestoy, 1996] and section 7.1 in [Davis 2006]. The algorithm is slightly
+/* Data structure for a node in a quotient graph as described in Algorithm 1 in
+ [Amestoy, 1996] and section 7.1 in [Davis 2006]. The algorithm is slightly
  modified such that the supervariables are prescribed and stored in A and L (see
  below) instead of detected using hash functions because the problem we are
  solving already comes in block form. In addition, each node is already a
@@ -46,9 +33,23 @@ void InsertValueInSortedVector(int value, std::vector<int>* sorted_vector);
  [Davis 2006] Davis, Timothy A. Direct methods for sparse linear systems.
  Society for Industrial and Applied Mathematics, 2006. */
 struct Node {
-  /* Computes and updates the external degree of `this` node given all nodes in
-   the graph. */
-  void UpdateExternalDegree(const std::vector<Node>& nodes);
+  /* Computes and updates the approximate external degree of `this` variable,
+   which must be adjacent to the element p that was just formed (i.e., `this`
+   node is in Lp). See [Amestoy 1996, §4]:
+     d̄ᵢ = |Aᵢ \ i| + |Lp \ i| + ∑ₑ |Lₑ \ Lp|,  e ∈ Eᵢ \ p,
+   where |⋅| counts simple variables. The sets Lₑ \ Lp may overlap, so d̄ᵢ is
+   an upper bound of the external degree which is exact when Eᵢ \ p has at most
+   one element.
+   @param nodes           All nodes in the graph.
+   @param p               The index of the element that was just formed.
+   @param Lp_size         |Lp|.
+   @param external_sizes  external_sizes[e] is |Lₑ \ Lp| for every element e in
+                          Eᵢ \ p.
+   @pre Aᵢ and Eᵢ have been pruned of the variables in Lp and of the absorbed
+   elements respectively. */
+  void UpdateApproximateExternalDegree(const std::vector<Node>& nodes, int p,
+                                       int Lp_size,
+                                       const std::vector<int>& external_sizes);
 
   /* See [Amestoy 1996] and [Davis 2006] for definitions of "supervariable",
    "element", "external degree", etc. */
@@ -59,14 +60,14 @@ struct Node {
   int size{0};    // The number of simple variables in a supervariable.
   int index{-1};  // The index of this node that can be used as an unique
                   // identifier of the node.
-  /* Invariant: A, E, L are sorted. We opt for a std::vector over std::set for
-   slightly lower overhead when performing union operations for these sets. */
+  /* A, E, L are in no particular order. The elimination marks the nodes of a
+   set in a workspace instead of keeping the sets sorted, so that each update
+   costs time proportional to the size of the sets involved rather than to the
+   number of nodes. */
   std::vector<int> A;  // Adjacent supervariables when `this` node is a
                        // variable; empty when this node is an element.
   std::vector<int> E;  // Adjacent elements when `this` node is a variable;
                        // empty when this node is an element due to absorption.
-  // TODO(xuchenhan-tri): We can reuse the storage of A for L as only one is
-  // non-empty at a given time.
   std::vector<int> L;  // Adjacent supervariables when `this` node is an
                        // element, empty otherwise.
 };
@@ -89,19 +90,24 @@ inline bool operator<(const SimplifiedNode& a, const SimplifiedNode& b) {
 }
 
 /* Computes the preferred elimination ordering of the matrix with the given
- `block_sparsity_pattern` according to the Minimum Degree algorithm. For
- example, a return value of [1, 3, 0, 2] first eliminates block 1, then 3,
- 0, and 2. In other words, this is a permutation mapping from new block indices
- to original block indices. */
+ `block_sparsity_pattern` according to the Approximate Minimum Degree (AMD)
+ algorithm of [Amestoy 1996], i.e., a minimum degree ordering where the
+ external degrees are replaced by their upper bounds d̄ (see Node), with element
+ absorption, aggressive absorption, and mass elimination. For example, a return
+ value of [1, 3, 0, 2] first eliminates block 1, then 3, 0, and 2. In other
+ words, this is a permutation mapping from new block indices to original block
+ indices. */
 std::vector<int> ComputeMinimumDegreeOrdering(
     const BlockSparsityPattern& block_sparsity_pattern);
 
 /* Similar to the one argument overload but eliminates elements in
 `priority_elements` first.
  Suppose the sparsity pattern has n nodes (which we denote as V) and m of those
- are in `priority_elements` (which we denote as P). Let D(v) be the degree of
- the node v. For k ∈ [0, m), the k-th eliminated node is argmin(D(v)) s.t.
- v ∈ P. For k ∈ [m, n), the k-th eliminated node is argmin(D(v)) s.t. v ∈ V\P.
+ are in `priority_elements` (which we denote as P). Let D(v) be the approximate
+ degree of the node v. For k ∈ [0, m), the k-th eliminated node is
+ argmin(D(v)) s.t. v ∈ P. For k ∈ [m, n), the k-th eliminated node is
+ argmin(D(v)) s.t. v ∈ V\P. (Mass elimination only eliminates a node ahead of
+ its turn when it has the same priority as the node just eliminated.)
  @pre all entries in `priority_elements` are in {0, 1, ..., n-1}. */
 std::vector<int> ComputeMinimumDegreeOrdering(
     const BlockSparsityPattern& block_sparsity_pattern,
@@ -131,11 +137,15 @@ BlockSparsityPattern SymbolicCholeskyFactor(
      in v₂.
  @param[in] global_pattern  The block sparsity pattern G.
  @param[in] v1              The vertices in the set v₁.
+ @param[in] parallelism     The orderings on G₁ and G₂ are independent, and
+                            are computed concurrently if this allows more than
+                            one thread.
  @returns  The elimination ordering obtained by following the algorithm
  described above. */
 std::vector<int> CalcAndConcatenateMdOrderingWithinGroup(
     const BlockSparsityPattern& global_pattern,
-    const std::unordered_set<int>& v1);
+    const std::unordered_set<int>& v1,
+    Parallelism parallelism = Parallelism::None());
 
 }  // namespace internal
 }  // namespace contact_solvers
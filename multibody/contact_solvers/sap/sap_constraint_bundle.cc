@@ -3,6 +3,7 @@
 #include <utility>
 
 #include "drake/common/default_scalars.h"
+#include "drake/common/parallel_for.h"
 #include "drake/common/ssize.h"
 #include "drake/multibody/contact_solvers/sap/contact_problem_graph.h"
 
@@ -13,7 +14,9 @@ namespace internal {
 
 template <typename T>
 SapConstraintBundle<T>::SapConstraintBundle(
-    const SapContactProblem<T>* problem, const VectorX<T>& delassus_diagonal) {
+    const SapContactProblem<T>* problem, const VectorX<T>& delassus_diagonal,
+    Parallelism parallelism)
+    : parallelism_(parallelism) {
   DRAKE_THROW_UNLESS(problem != nullptr);
   DRAKE_THROW_UNLESS(delassus_diagonal.size() ==
                      problem->num_constraint_equations());
@@ -23,13 +26,17 @@ SapConstraintBundle<T>::SapConstraintBundle(
   // the ContactProblemGraph, where constraints between the same
   // pair of cliques are "clustered" together.
   constraints_.reserve(problem->num_constraints());
+  constraint_start_.reserve(problem->num_constraints());
 
   // Store constraints in the order specified by the graph, i.e. by clusters.
+  int constraint_start = 0;
   for (const ContactProblemGraph::ConstraintCluster& e :
        problem->graph().clusters()) {
     for (int i : e.constraint_index()) {
       const SapConstraint<T>& c = problem->get_constraint(i);
       constraints_.push_back(&c);
+      constraint_start_.push_back(constraint_start);
+      constraint_start += c.num_constraint_equations();
     }
   }
 
@@ -46,6 +53,14 @@ int SapConstraintBundle<T>::num_constraint_equations() const {
   return J().rows();
 }
 
+template <typename T>
+template <typename Calc>
+void SapConstraintBundle<T>::ForEachConstraint(const Calc& calc) const {
+  drake::internal::ParallelFor(parallelism_, num_constraints(), [&](int i) {
+    calc(i, constraint_start_[i]);
+  });
+}
+
 template <typename T>
 void SapConstraintBundle<T>::MakeConstraintBundleJacobian(
     const SapContactProblem<T>& problem) {
@@ -131,15 +146,13 @@ void SapConstraintBundle<T>::CalcData(
     const VectorX<T>& vc, SapConstraintBundleData* bundle_data) const {
   DRAKE_DEMAND(bundle_data != nullptr);
   DRAKE_DEMAND(ssize(*bundle_data) == num_constraints());
-  int constraint_start = 0;
-  for (int i = 0; i < num_constraints(); ++i) {
+  ForEachConstraint([&](int i, int constraint_start) {
     const SapConstraint<T>& c = *constraints_[i];
     const int ni = c.num_constraint_equations();
     const auto vc_i = vc.segment(constraint_start, ni);
     AbstractValue& data = *(*bundle_data)[i];
     c.CalcData(vc_i, &data);
-    constraint_start += ni;
-  }
+  });
 }
 
 template <typename T>
@@ -147,10 +160,24 @@ T SapConstraintBundle<T>::CalcCost(
     const SapConstraintBundleData& bundle_data) const {
   DRAKE_DEMAND(ssize(bundle_data) == num_constraints());
   T cost = 0.0;
-  for (int i = 0; i < num_constraints(); ++i) {
+  if (parallelism_.num_threads() == 1) {
+    // This is a hot path within the line search; accumulate without
+    // allocating.
+    for (int i = 0; i < num_constraints(); ++i) {
+      cost += constraints_[i]->CalcCost(*bundle_data[i]);
+    }
+    return cost;
+  }
+  // Per-constraint costs are summed in the same order afterwards so that the
+  // result doesn't depend on the number of threads.
+  std::vector<T> costs(num_constraints());
+  ForEachConstraint([&](int i, int) {
     const SapConstraint<T>& c = *constraints_[i];
     const AbstractValue& data = *bundle_data[i];
-    cost += c.CalcCost(data);
+    costs[i] = c.CalcCost(data);
+  });
+  for (const T& cost_i : costs) {
+    cost += cost_i;
   }
   return cost;
 }
@@ -161,15 +188,13 @@ void SapConstraintBundle<T>::CalcImpulses(
   DRAKE_DEMAND(ssize(bundle_data) == num_constraints());
   DRAKE_DEMAND(gamma != nullptr);
   DRAKE_DEMAND(gamma->size() == num_constraint_equations());
-  int constraint_start = 0;
-  for (int i = 0; i < num_constraints(); ++i) {
+  ForEachConstraint([&](int i, int constraint_start) {
     const SapConstraint<T>& c = *constraints_[i];
     const int ni = c.num_constraint_equations();
     const AbstractValue& data = *bundle_data[i];
     auto gamma_i = gamma->segment(constraint_start, ni);
     c.CalcImpulse(data, &gamma_i);
-    constraint_start += ni;
-  }
+  });
 }
 
 template <typename T>
@@ -182,8 +207,7 @@ void SapConstraintBundle<T>::CalcImpulsesAndConstraintsHessian(
   DRAKE_DEMAND(ssize(*G) == num_constraints());
 
   // The regularizer Hessian is G = d²ℓ/dvc² = dP/dy⋅R⁻¹.
-  int constraint_start = 0;
-  for (int i = 0; i < num_constraints(); ++i) {
+  ForEachConstraint([&](int i, int constraint_start) {
     const SapConstraint<T>& c = *constraints_[i];
     const int ni = c.num_constraint_equations();
     const AbstractValue& data = *bundle_data[i];
@@ -191,8 +215,7 @@ void SapConstraintBundle<T>::CalcImpulsesAndConstraintsHessian(
     auto& Gi = (*G)[i];
     c.CalcImpulse(data, &gamma_i);
     c.CalcCostHessian(data, &Gi);
-    constraint_start += ni;
-  }
+  });
 }
 
 }  // namespace internal
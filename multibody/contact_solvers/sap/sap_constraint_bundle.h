@@ -5,6 +5,7 @@
 
 #include "drake/common/copyable_unique_ptr.h"
 #include "drake/common/drake_copyable.h"
+#include "drake/common/parallelism.h"
 #include "drake/multibody/contact_solvers/block_sparse_matrix.h"
 #include "drake/multibody/contact_solvers/sap/partial_permutation.h"
 #include "drake/multibody/contact_solvers/sap/sap_constraint.h"
@@ -65,13 +66,21 @@ class SapConstraintBundle {
    @param[in] delassus_diagonal It must have size problem.num_constraint() or an
    exception is thrown. The i-th entry stores the scaling parameter used for
    regularization estimation by the i-th constraint in `problem`, see
-   SapConstraint::CalcDiagonalRegularization(). */
+   SapConstraint::CalcDiagonalRegularization().
+   @param[in] parallelism The number of threads used to evaluate the
+   (independent) per-constraint computations of CalcData(), CalcCost(),
+   CalcImpulses() and CalcImpulsesAndConstraintsHessian(). Results do not
+   depend on the number of threads. */
   SapConstraintBundle(const SapContactProblem<T>* problem,
-                      const VectorX<T>& delassus_diagonal);
+                      const VectorX<T>& delassus_diagonal,
+                      Parallelism parallelism = Parallelism::None());
 
   /* Returns the number of constraints in this bundle. */
   int num_constraints() const;
 
+  /* Returns the parallelism supplied at construction. */
+  Parallelism parallelism() const { return parallelism_; }
+
   /* Returns the number of constraint equations in this bundle. This number
    equals the number of rows in the bundle's Jacobian. */
   int num_constraint_equations() const;
@@ -128,9 +137,21 @@ class SapConstraintBundle {
    refer to the documentation for the public accessor J(). */
   void MakeConstraintBundleJacobian(const SapContactProblem<T>& problem);
 
+  /* Invokes calc(i, constraint_start) for each constraint i in this bundle,
+   where constraint_start is the index of the first constraint equation of the
+   i-th constraint. Invocations for different constraints may run concurrently,
+   see parallelism(); each invocation must only write to data owned by its own
+   constraint. */
+  template <typename Calc>
+  void ForEachConstraint(const Calc& calc) const;
+
   BlockSparseMatrix<T> J_;
   // Constraint references in the order dictated by the ContactProblemGraph.
   std::vector<const SapConstraint<T>*> constraints_;
+  // constraint_start_[i] is the index of the first constraint equation of
+  // constraints_[i].
+  std::vector<int> constraint_start_;
+  Parallelism parallelism_;
 };
 
 }  // namespace internal
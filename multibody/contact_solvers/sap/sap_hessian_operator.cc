@@ -0,0 +1,95 @@
+#include "drake/multibody/contact_solvers/sap/sap_hessian_operator.h"
+
+namespace drake {
+namespace multibody {
+namespace contact_solvers {
+namespace internal {
+
+template <typename T>
+SapHessianOperator<T>::SapHessianOperator(const std::string& name,
+                                          const std::vector<MatrixX<T>>* A,
+                                          const BlockSparseMatrix<T>* J,
+                                          const std::vector<MatrixX<T>>* G)
+    : LinearOperator<T>(name), A_(A), J_(J), G_(G) {
+  DRAKE_DEMAND(A != nullptr);
+  DRAKE_DEMAND(J != nullptr);
+  DRAKE_DEMAND(G != nullptr);
+  DRAKE_DEMAND(ssize(*A) == J->block_cols());
+  for (int i = 0; i < J->block_cols(); ++i) {
+    DRAKE_DEMAND((*A)[i].rows() == J->block_col_size(i));
+    DRAKE_DEMAND((*A)[i].cols() == J->block_col_size(i));
+  }
+  G_block_start_.resize(J->block_rows() + 1, 0);
+  int k = 0;
+  for (int j = 0; j < J->block_rows(); ++j) {
+    int num_rows = 0;
+    while (num_rows < J->block_row_size(j)) {
+      DRAKE_DEMAND(k < ssize(*G));
+      num_rows += (*G)[k++].rows();
+    }
+    DRAKE_DEMAND(num_rows == J->block_row_size(j));
+    G_block_start_[j + 1] = k;
+  }
+  DRAKE_DEMAND(k == ssize(*G));
+}
+
+template <typename T>
+SapHessianOperator<T>::~SapHessianOperator() = default;
+
+template <typename T>
+std::vector<MatrixX<T>> SapHessianOperator<T>::CalcBlockDiagonal() const {
+  std::vector<MatrixX<T>> H_diagonal(*A_);
+  for (const auto& [j, i, Jji] : J_->get_blocks()) {
+    const MatrixBlock<T> GJ = Jji.LeftMultiplyByBlockDiagonal(
+        *G_, G_block_start_[j], G_block_start_[j + 1] - 1);
+    Jji.TransposeAndMultiplyAndAddTo(GJ, &H_diagonal[i]);
+  }
+  return H_diagonal;
+}
+
+template <typename T>
+void SapHessianOperator<T>::DoMultiply(
+    const Eigen::Ref<const Eigen::SparseVector<T>>& x,
+    Eigen::SparseVector<T>* y) const {
+  // H is generally dense within the blocks of its sparsity pattern and
+  // therefore we simply operate on dense vectors.
+  VectorX<T> y_dense(rows());
+  DoMultiply(VectorX<T>(x), &y_dense);
+  y->resize(rows());
+  y->setZero();
+  for (int i = 0; i < rows(); ++i) {
+    if (y_dense(i) != 0.0) y->insert(i) = y_dense(i);
+  }
+}
+
+template <typename T>
+void SapHessianOperator<T>::DoMultiply(const Eigen::Ref<const VectorX<T>>& x,
+                                       VectorX<T>* y) const {
+  // y = A⋅x.
+  for (int i = 0; i < J_->block_cols(); ++i) {
+    const int start = J_->col_start(i);
+    const int size = J_->block_col_size(i);
+    y->segment(start, size) = (*A_)[i] * x.segment(start, size);
+  }
+
+  // y += Jᵀ⋅G⋅J⋅x.
+  VectorX<T> vc(J_->rows());
+  J_->Multiply(x, &vc);
+  int offset = 0;
+  for (const MatrixX<T>& Gk : *G_) {
+    const int size = Gk.rows();
+    vc.segment(offset, size) = Gk * vc.segment(offset, size);
+    offset += size;
+  }
+  VectorX<T> JTGJx(cols());
+  J_->MultiplyByTranspose(vc, &JTGJx);
+  *y += JTGJx;
+}
+
+}  // namespace internal
+}  // namespace contact_solvers
+}  // namespace multibody
+}  // namespace drake
+
+DRAKE_DEFINE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_NONSYMBOLIC_SCALARS(
+    class ::drake::multibody::contact_solvers::internal::SapHessianOperator)
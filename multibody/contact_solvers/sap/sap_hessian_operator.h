@@ -0,0 +1,85 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "drake/common/default_scalars.h"
+#include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
+#include "drake/multibody/contact_solvers/block_sparse_matrix.h"
+#include "drake/multibody/contact_solvers/linear_operator.h"
+
+namespace drake {
+namespace multibody {
+namespace contact_solvers {
+namespace internal {
+
+/* A matrix-free LinearOperator for the Hessian H = A + Jᵀ⋅G⋅J of the SAP cost,
+ where A is the block diagonal dynamics matrix (one block per participating
+ clique), J is the constraints' Jacobian (one block row per cluster of
+ constraints, one block column per participating clique) and G is the block
+ diagonal Hessian of the constraints' cost (one block per constraint). See
+ SapModel for details.
+
+ Products with H are computed as A⋅x + Jᵀ⋅(G⋅(J⋅x)) and therefore H is never
+ assembled; the cost of a product and the memory it needs are linear in the
+ number of non-zeros of A, J and G.
+
+ This class keeps references to A, J and G and therefore they must outlive this
+ object.
+
+ @tparam_nonsymbolic_scalar */
+template <typename T>
+class SapHessianOperator final : public LinearOperator<T> {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(SapHessianOperator)
+
+  /* Constructs the operator H = A + Jᵀ⋅G⋅J.
+   @pre A, J and G are not nullptr.
+   @pre A has J->block_cols() square blocks, with the i-th block of the same
+        size as the i-th block column of J.
+   @pre The partition of the rows of J induced by G (with the i-th block of G
+        square) refines the partition induced by the block rows of J. */
+  SapHessianOperator(const std::string& name, const std::vector<MatrixX<T>>* A,
+                     const BlockSparseMatrix<T>* J,
+                     const std::vector<MatrixX<T>>* G);
+
+  ~SapHessianOperator() final;
+
+  int rows() const final { return J_->cols(); }
+  int cols() const final { return J_->cols(); }
+
+  /* Computes the diagonal blocks of H, one per participating clique, i.e. the
+   i-th block is Aᵢ + ∑ⱼ Jⱼᵢᵀ⋅Gⱼ⋅Jⱼᵢ where the sum is over the block rows j of
+   J with a non-zero block in the i-th block column and Gⱼ is the block of G for
+   the j-th block row. */
+  std::vector<MatrixX<T>> CalcBlockDiagonal() const;
+
+ private:
+  void DoMultiply(const Eigen::Ref<const Eigen::SparseVector<T>>& x,
+                  Eigen::SparseVector<T>* y) const final;
+
+  void DoMultiply(const Eigen::Ref<const VectorX<T>>& x,
+                  VectorX<T>* y) const final;
+
+  /* H is symmetric. */
+  void DoMultiplyByTranspose(const Eigen::Ref<const VectorX<T>>& x,
+                             VectorX<T>* y) const final {
+    DoMultiply(x, y);
+  }
+
+  const std::vector<MatrixX<T>>* A_{nullptr};
+  const BlockSparseMatrix<T>* J_{nullptr};
+  const std::vector<MatrixX<T>>* G_{nullptr};
+  /* The blocks of G for the j-th block row of J are G_[k] with
+   G_block_start_[j] <= k < G_block_start_[j + 1]. */
+  std::vector<int> G_block_start_;
+};
+
+}  // namespace internal
+}  // namespace contact_solvers
+}  // namespace multibody
+}  // namespace drake
+
+DRAKE_DECLARE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_NONSYMBOLIC_SCALARS(
+    class ::drake::multibody::contact_solvers::internal::SapHessianOperator)
@@ -16,7 +16,8 @@ namespace internal {
 using systems::Context;
 
 template <typename T>
-SapModel<T>::SapModel(const SapContactProblem<T>* problem_ptr)
+SapModel<T>::SapModel(const SapContactProblem<T>* problem_ptr,
+                      Parallelism parallelism)
     : problem_(problem_ptr) {
   // Graph to the original contact problem, including all cliques
   // (participating and non-participating).
@@ -56,7 +57,8 @@ SapModel<T>::SapModel(const SapContactProblem<T>* problem_ptr)
 
   // Create constraints bundle.
   std::unique_ptr<SapConstraintBundle<T>> constraints_bundle =
-      std::make_unique<SapConstraintBundle<T>>(&problem(), delassus_diagonal);
+      std::make_unique<SapConstraintBundle<T>>(&problem(), delassus_diagonal,
+                                               parallelism);
 
   // N.B. const_model_data_ is meant to be created once at construction and
   // remain const afterwards.
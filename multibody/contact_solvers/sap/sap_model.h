@@ -136,8 +136,10 @@ class SapModel {
   DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(SapModel);
 
   /* Constructs a model of `problem` optimized to be used by the SAP solver.
-   The input `problem` must outlive `this` model. */
-  explicit SapModel(const SapContactProblem<T>* problem);
+   The input `problem` must outlive `this` model. `parallelism` is forwarded to
+   the model's constraints bundle, see SapConstraintBundle. */
+  explicit SapModel(const SapContactProblem<T>* problem,
+                    Parallelism parallelism = Parallelism::None());
 
   /* Returns a reference to the contact problem being modeled by this class. */
   const SapContactProblem<T>& problem() const {
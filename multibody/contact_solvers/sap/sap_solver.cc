@@ -8,10 +8,14 @@
 
 #include "drake/common/default_scalars.h"
 #include "drake/common/extract_double.h"
+#include "drake/common/instrumentation.h"
+#include "drake/common/timer.h"
 #include "drake/math/linear_solve.h"
 #include "drake/multibody/contact_solvers/block_sparse_supernodal_solver.h"
 #include "drake/multibody/contact_solvers/conex_supernodal_solver.h"
+#include "drake/multibody/contact_solvers/conjugate_gradient.h"
 #include "drake/multibody/contact_solvers/newton_with_bisection.h"
+#include "drake/multibody/contact_solvers/sap/sap_hessian_operator.h"
 
 namespace drake {
 namespace multibody {
@@ -22,6 +26,12 @@ using drake::systems::Context;
 
 template <typename T>
 void SapSolver<T>::set_parameters(const SapSolverParameters& parameters) {
+  // The reusable solver was made with the previous parallelism.
+  if (!parameters.reuse_symbolic_factorization ||
+      parameters.parallelism.num_threads() !=
+          parameters_.parallelism.num_threads()) {
+    reusable_supernodal_solver_.reset();
+  }
   parameters_ = parameters;
 }
 
@@ -106,6 +116,7 @@ SapSolverStatus SapSolver<double>::SolveWithGuess(
     SapSolverResults<double>* results) {
   using std::abs;
   using std::max;
+  instrumentation::ScopedZone zone("SapSolver::SolveWithGuess");
 
   if (problem.num_constraints() == 0) {
     // In the absence of constraints the solution is trivially v = v*.
@@ -117,7 +128,8 @@ SapSolverStatus SapSolver<double>::SolveWithGuess(
   }
 
   // Make model for the given contact problem.
-  model_ = std::make_unique<SapModel<double>>(&problem);
+  model_ =
+      std::make_unique<SapModel<double>>(&problem, parameters_.parallelism);
   const int nv = model_->num_velocities();
   const int nk = model_->num_constraint_equations();
 
@@ -128,7 +140,8 @@ SapSolverStatus SapSolver<double>::SolveWithGuess(
   stats_ = SolverStats();
   // The supernodal solver is expensive to instantiate and therefore we only
   // instantiate when needed.
-  std::unique_ptr<SuperNodalSolver> supernodal_solver;
+  std::unique_ptr<SuperNodalSolver> owned_supernodal_solver;
+  SuperNodalSolver* supernodal_solver = nullptr;
 
   {
     // We limit the lifetime of this reference, v, to within this scope where we
@@ -139,6 +152,7 @@ SapSolverStatus SapSolver<double>::SolveWithGuess(
   }
 
   // Start Newton iterations.
+  SteadyTimer timer;
   int k = 0;
   double ell = model_->EvalCost(*context);
   double ell_previous = ell;
@@ -183,35 +197,64 @@ SapSolverStatus SapSolver<double>::SolveWithGuess(
       }
       if (parameters_.linear_solver_type !=
               SapSolverParameters::LinearSolverType::kDense &&
+          parameters_.linear_solver_type !=
+              SapSolverParameters::LinearSolverType::kConjugateGradient &&
           supernodal_solver == nullptr) {
         // Instantiate supernodal solver on the first iteration when needed. If
         // the stopping criteria is satisfied at k = 0 (good guess), then we
         // skip the expensive instantiation of the solver.
-        supernodal_solver = MakeSuperNodalSolver();
+        supernodal_solver = AcquireSuperNodalSolver(&owned_supernodal_solver);
       }
     }
 
-    // Exit if the maximum number of iterations is reached, but only after
-    // checking the convergence criteria, so that also the last iteration is
-    // considered.
-    if (k == parameters_.max_iterations) break;
+    // Exit if the iteration budget or the time budget is exhausted, but only
+    // after checking the convergence criteria, so that also the last iteration
+    // is considered.
+    if (k == parameters_.max_iterations ||
+        timer.Tick() > parameters_.max_solve_time) {
+      stats_.budget_exhausted = true;
+      break;
+    }
+
+    // Exit if the relative residual did not decrease enough over the last
+    // stall_window iterations.
+    const int window = parameters_.stall_window;
+    if (window > 0 && k >= window) {
+      const double relative_residual = momentum_residual / momentum_scale;
+      const double previous_relative_residual =
+          stats_.momentum_residual[k - window] /
+          stats_.momentum_scale[k - window];
+      if (relative_residual >
+          parameters_.stall_reduction_ratio * previous_relative_residual) {
+        stats_.stalled = true;
+        break;
+      }
+    }
 
     // This is the most expensive update: it performs the factorization of H to
     // solve for the search direction dv.
-    CalcSearchDirectionData(*context, supernodal_solver.get(),
-                            &search_direction_data);
+    {
+      instrumentation::ScopedZone search_direction_zone(
+          "SapSolver::CalcSearchDirectionData");
+      CalcSearchDirectionData(*context, supernodal_solver,
+                              &search_direction_data);
+    }
     const VectorX<double>& dv = search_direction_data.dv;
 
     // Perform line search.
-    switch (parameters_.line_search_type) {
-      case SapSolverParameters::LineSearchType::kBackTracking:
-        std::tie(alpha, num_line_search_iters) = PerformBackTrackingLineSearch(
-            *context, search_direction_data, scratch.get());
-        break;
-      case SapSolverParameters::LineSearchType::kExact:
-        std::tie(alpha, num_line_search_iters) = PerformExactLineSearch(
-            *context, search_direction_data, scratch.get());
-        break;
+    {
+      instrumentation::ScopedZone line_search_zone("SapSolver::LineSearch");
+      switch (parameters_.line_search_type) {
+        case SapSolverParameters::LineSearchType::kBackTracking:
+          std::tie(alpha, num_line_search_iters) =
+              PerformBackTrackingLineSearch(*context, search_direction_data,
+                                            scratch.get());
+          break;
+        case SapSolverParameters::LineSearchType::kExact:
+          std::tie(alpha, num_line_search_iters) = PerformExactLineSearch(
+              *context, search_direction_data, scratch.get());
+          break;
+      }
     }
     stats_.num_line_search_iters += num_line_search_iters;
 
@@ -237,7 +280,20 @@ SapSolverStatus SapSolver<double>::SolveWithGuess(
         alpha > 0.5;
   }
 
-  if (!converged) return SapSolverStatus::kFailure;
+  instrumentation::IncrementCounter("SapSolver::num_iterations", k);
+  instrumentation::IncrementCounter("SapSolver::num_line_search_iterations",
+                                    stats_.num_line_search_iters);
+  if (stats_.budget_exhausted) {
+    instrumentation::IncrementCounter("SapSolver::num_budget_exhaustions");
+  }
+  if (stats_.stalled) {
+    instrumentation::IncrementCounter("SapSolver::num_stalls");
+  }
+  if (!converged && !parameters_.accept_iterate_on_budget) {
+    instrumentation::IncrementCounter("SapSolver::num_failures");
+    return SapSolverStatus::kFailure;
+  }
+  instrumentation::RecordSample("SapSolver::iterations_per_solve", k);
 
   PackSapSolverResults(*context, results);
 
@@ -620,11 +676,13 @@ std::unique_ptr<SuperNodalSolver> SapSolver<T>::MakeSuperNodalSolver() const {
             J.block_rows(), J.get_blocks(), model_->dynamics_matrix());
       case SapSolverParameters::LinearSolverType::kBlockSparseCholesky:
         return std::make_unique<BlockSparseSuperNodalSolver>(
-            J.block_rows(), J.get_blocks(), model_->dynamics_matrix());
+            J.block_rows(), J.get_blocks(), model_->dynamics_matrix(),
+            parameters_.parallelism);
       case SapSolverParameters::LinearSolverType::kDense:
+      case SapSolverParameters::LinearSolverType::kConjugateGradient:
         throw std::logic_error(
             "Supernodal solver should only be constructed when the linear "
-            "solver type is not dense.");
+            "solver type is supernodal.");
     }
     DRAKE_UNREACHABLE();
   } else {
@@ -634,6 +692,64 @@ std::unique_ptr<SuperNodalSolver> SapSolver<T>::MakeSuperNodalSolver() const {
   }
 }
 
+template <typename T>
+SuperNodalSolver* SapSolver<T>::AcquireSuperNodalSolver(
+    std::unique_ptr<SuperNodalSolver>* owned) {
+  DRAKE_DEMAND(owned != nullptr);
+  if constexpr (std::is_same_v<T, double>) {
+    if (parameters_.reuse_symbolic_factorization &&
+        parameters_.linear_solver_type ==
+            SapSolverParameters::LinearSolverType::kBlockSparseCholesky) {
+      const BlockSparseMatrix<T>& J = model_->constraints_bundle().J();
+      if (reusable_supernodal_solver_ == nullptr) {
+        reusable_supernodal_solver_ =
+            std::make_unique<BlockSparseSuperNodalSolver>(
+                J.block_rows(), J.get_blocks(), model_->dynamics_matrix(),
+                parameters_.parallelism);
+      } else {
+        stats_.symbolic_factorization_reused =
+            reusable_supernodal_solver_->Reset(
+                J.block_rows(), J.get_blocks(), model_->dynamics_matrix());
+      }
+      return reusable_supernodal_solver_.get();
+    }
+  }
+  *owned = MakeSuperNodalSolver();
+  return owned->get();
+}
+
+template <typename T>
+void SapSolver<T>::CallConjugateGradientSolver(const Context<T>& context,
+                                               VectorX<T>* dv) const {
+  DRAKE_DEMAND(parameters_.conjugate_gradient.max_iterations > 0);
+  const std::vector<MatrixX<T>>& G = model_->EvalConstraintsHessian(context);
+  const SapHessianOperator<T> H("H", &model_->dynamics_matrix(),
+                                &model_->constraints_bundle().J(), &G);
+  const BlockJacobiPreconditioner<T> P("P", H.CalcBlockDiagonal());
+  const VectorX<T> rhs = -model_->EvalCostGradient(context);
+  int num_iterations = 0;
+  const bool converged = SolveWithPreconditionedConjugateGradient(
+      H, P, rhs, parameters_.conjugate_gradient.relative_tolerance,
+      parameters_.conjugate_gradient.max_iterations, dv, &num_iterations);
+  stats_.num_conjugate_gradient_iters += num_iterations;
+  if (!converged && num_iterations == 0) {
+    // The method broke down on the first iteration (pᵀ⋅H⋅p ≤ 0, which for the
+    // SPD H can only be due to round-off) and left dv = 0, which is not a
+    // descent direction. Fall back to a direct solve.
+    DRAKE_LOGGER_DEBUG(
+        "SapSolver: conjugate gradient broke down. Using the dense solver.");
+    CallDenseSolver(context, dv);
+    return;
+  }
+  // N.B. Even when not converged, dv is a descent direction and the line
+  // search still guarantees a decrease of the cost.
+  if (!converged) {
+    DRAKE_LOGGER_DEBUG(
+        "SapSolver: conjugate gradient did not converge in {} iterations.",
+        num_iterations);
+  }
+}
+
 template <typename T>
 void SapSolver<T>::CallDenseSolver(const Context<T>& context,
                                    VectorX<T>* dv) const {
@@ -701,14 +817,19 @@ template <typename T>
 void SapSolver<T>::CalcSearchDirectionData(
     const systems::Context<T>& context, SuperNodalSolver* supernodal_solver,
     SapSolver<T>::SearchDirectionData* data) const {
-  const bool use_dense_algebra = parameters_.linear_solver_type ==
-                                 SapSolverParameters::LinearSolverType::kDense;
-  DRAKE_DEMAND(use_dense_algebra || (supernodal_solver != nullptr));
   // Update search direction dv.
-  if (!use_dense_algebra) {
-    CallSuperNodalSolver(context, supernodal_solver, &data->dv);
-  } else {
-    CallDenseSolver(context, &data->dv);
+  switch (parameters_.linear_solver_type) {
+    case SapSolverParameters::LinearSolverType::kDense:
+      CallDenseSolver(context, &data->dv);
+      break;
+    case SapSolverParameters::LinearSolverType::kConjugateGradient:
+      CallConjugateGradientSolver(context, &data->dv);
+      break;
+    case SapSolverParameters::LinearSolverType::kConex:
+    case SapSolverParameters::LinearSolverType::kBlockSparseCholesky:
+      DRAKE_DEMAND(supernodal_solver != nullptr);
+      CallSuperNodalSolver(context, supernodal_solver, &data->dv);
+      break;
   }
 
   // Update Δp, Δvc and d²ellA/dα².
@@ -5,6 +5,8 @@
 #include <utility>
 #include <vector>
 
+#include "drake/common/parallelism.h"
+#include "drake/multibody/contact_solvers/block_sparse_supernodal_solver.h"
 #include "drake/multibody/contact_solvers/conex_supernodal_solver.h"
 #include "drake/multibody/contact_solvers/sap/sap_model.h"
 #include "drake/multibody/contact_solvers/sap/sap_solver_results.h"
@@ -62,6 +64,19 @@ struct SapSolverParameters {
     double alpha_max{1.5};
   };
 
+  // Parameters for the conjugate gradient linear solver.
+  // Ignored if linear_solver_type != LinearSolverType::kConjugateGradient.
+  struct ConjugateGradientParameters {
+    // Relative tolerance εᵣ on the residual of the Newton system. Conjugate
+    // gradient iterations stop when ‖H⋅Δv + ∇ℓ‖ ≤ εᵣ‖∇ℓ‖. Since any number of
+    // iterations leads to a descent direction, this trades accuracy of each
+    // Newton step for the cost to compute it.
+    double relative_tolerance{1.0e-6};
+    // Maximum number of conjugate gradient iterations per Newton iteration.
+    // Must be positive.
+    int max_iterations{1000};
+  };
+
   // The type of linear solver used for solving linear systems from the Newton
   // iterations.
   enum class LinearSolverType {
@@ -75,6 +90,16 @@ struct SapSolverParameters {
     kBlockSparseCholesky,
     // Dense algebra. Typically used for testing.
     kDense,
+    // Matrix-free preconditioned conjugate gradient. The Hessian H is never
+    // assembled nor factorized; only products with H are computed, see
+    // SapHessianOperator. The preconditioner is the inverse of the block
+    // diagonal of H, with one block per participating clique. Memory usage is
+    // linear in the size of the problem, making this a good choice for very
+    // large problems (e.g., with deformable bodies) for which factorizations
+    // are expensive. See SapSolverParameters::conjugate_gradient. If the
+    // method breaks down on the first iteration due to round-off, that Newton
+    // step falls back to kDense.
+    kConjugateGradient,
   };
 
   // Stopping Criteria:
@@ -179,6 +204,58 @@ struct SapSolverParameters {
   bool nonmonotonic_convergence_is_error{false};
 
   LinearSolverType linear_solver_type{LinearSolverType::kBlockSparseCholesky};
+
+  ConjugateGradientParameters conjugate_gradient;
+
+  // The number of threads used for the per-constraint evaluations of the
+  // constraint bundle (impulses, costs and constraint Hessians) and for the
+  // assembly of the Hessian of the block sparse supernodal solver (see
+  // LinearSolverType::kBlockSparseCholesky). Results do not depend on the
+  // number of threads.
+  Parallelism parallelism{Parallelism::None()};
+
+  // When true and linear_solver_type is LinearSolverType::kBlockSparseCholesky,
+  // the SapSolver keeps its supernodal solver across calls to SolveWithGuess()
+  // and reuses the symbolic analysis of the Hessian (elimination ordering and
+  // sparsity pattern of its Cholesky factor) whenever the block sparsity
+  // pattern of the Hessian is unchanged from the previous solve. This is the
+  // common case for consecutive time steps of a simulation when the set of
+  // constraints and the cliques they couple don't change. The solution does
+  // not depend on this option.
+  bool reuse_symbolic_factorization{false};
+
+  // Budget Criteria:
+  //   For applications with strict deadlines per time step (e.g.,
+  // hardware-in-the-loop simulations) the Newton iteration can also be ended
+  // early, trading contact accuracy for a bounded cost per step. The iteration
+  // ends early when it reaches max_iterations, when it exceeds max_solve_time,
+  // or when progress stalls (see stall_window). What happens then is decided
+  // by accept_iterate_on_budget.
+
+  // Maximum wall-clock time, in seconds, spent in the Newton iterations of a
+  // single call to SolveWithGuess(). It is checked once per Newton iteration,
+  // so a solve can overrun it by the cost of one iteration. The default,
+  // infinity, disables this budget.
+  double max_solve_time{std::numeric_limits<double>::infinity()};
+
+  // Stall detection: the Newton iteration is considered stalled when the
+  // relative momentum residual ‖∇ℓ‖/max(‖p‖,‖jc‖), see the optimality condition
+  // above, did not decrease at least by a factor of stall_reduction_ratio over
+  // the last stall_window iterations. This detects the slow linear convergence
+  // of ill-conditioned problems (e.g., near-rigid contact) in which further
+  // iterations are unlikely to pay off. A stall_window of zero (the default)
+  // disables this check.
+  int stall_window{0};
+  double stall_reduction_ratio{0.5};
+
+  // When false (the default), a Newton iteration that ends early reports
+  // SapSolverStatus::kFailure. When true, it reports SapSolverStatus::kSuccess
+  // with the last iterate, which is also the best one given that SAP's cost
+  // decreases monotonically. SolverStats::budget_exhausted and
+  // SolverStats::stalled report that this happened, and so do the
+  // instrumentation counters "SapSolver::num_budget_exhaustions" and
+  // "SapSolver::num_stalls" across solves.
+  bool accept_iterate_on_budget{false};
 };
 
 // This class implements the Semi-Analytic Primal (SAP) solver described in
@@ -218,8 +295,12 @@ class SapSolver {
     void Reset() {
       num_iters = 0;
       num_line_search_iters = 0;
+      num_conjugate_gradient_iters = 0;
       optimality_criterion_reached = false;
       cost_criterion_reached = false;
+      symbolic_factorization_reused = false;
+      budget_exhausted = false;
+      stalled = false;
       momentum_residual.clear();
       momentum_scale.clear();
       cost.clear();
@@ -227,6 +308,9 @@ class SapSolver {
     }
     int num_iters{0};              // Number of Newton iterations.
     int num_line_search_iters{0};  // Total number of line search iterations.
+    // Total number of conjugate gradient iterations. Only non-zero when
+    // using LinearSolverType::kConjugateGradient.
+    int num_conjugate_gradient_iters{0};
 
     // Indicates if the optimality condition was reached.
     bool optimality_criterion_reached{false};
@@ -234,6 +318,20 @@ class SapSolver {
     // Indicates if the cost condition was reached.
     bool cost_criterion_reached{false};
 
+    // Indicates if the symbolic analysis of the Hessian from a previous call
+    // to SolveWithGuess() was reused. See
+    // SapSolverParameters::reuse_symbolic_factorization.
+    bool symbolic_factorization_reused{false};
+
+    // Indicates if the Newton iteration ended because it reached
+    // SapSolverParameters::max_iterations or
+    // SapSolverParameters::max_solve_time before meeting the stopping criteria.
+    bool budget_exhausted{false};
+
+    // Indicates if the Newton iteration ended because progress stalled, see
+    // SapSolverParameters::stall_window.
+    bool stalled{false};
+
     // Cost at each SAP Newton iteration. cost[0] stores cost at the initial
     // guess.
     std::vector<double> cost;
@@ -390,6 +488,16 @@ class SapSolver {
   // Makes a new SuperNodalSolver compatible with the underlying SapModel.
   std::unique_ptr<SuperNodalSolver> MakeSuperNodalSolver() const;
 
+  // Returns a SuperNodalSolver compatible with the underlying SapModel. If
+  // parameters_.reuse_symbolic_factorization is true and the linear solver
+  // type is kBlockSparseCholesky, the returned solver is owned by `this` and
+  // persists across calls to SolveWithGuess() (see
+  // SapSolverParameters::reuse_symbolic_factorization). Otherwise, `owned`
+  // takes ownership of a new solver made with MakeSuperNodalSolver().
+  // @pre owned != nullptr.
+  SuperNodalSolver* AcquireSuperNodalSolver(
+      std::unique_ptr<SuperNodalSolver>* owned);
+
   // Evaluates the constraint's Hessian G(v) and updates `supernodal_solver`'s
   // weight matrix so that we can later on solve the Newton system with Hessian
   // H(v) = A + Jᵀ⋅G(v)⋅J.
@@ -404,6 +512,12 @@ class SapSolver {
                             SuperNodalSolver* supernodal_solver,
                             VectorX<T>* dv) const;
 
+  // Solves for dv with the conjugate gradient method, see
+  // LinearSolverType::kConjugateGradient.
+  // @pre context was created by the underlying SapModel.
+  void CallConjugateGradientSolver(const systems::Context<T>& context,
+                                   VectorX<T>* dv) const;
+
   // Solves for dv using dense algebra, for debugging.
   // @pre context was created by the underlying SapModel.
   // TODO(amcastro-tri): Add AutoDiffXd support.
@@ -414,19 +528,22 @@ class SapSolver {
   // of the primal cost ∇ℓₚ, the cost's Hessian H and solves for the velocity
   // search direction dv = −H⁻¹⋅∇ℓₚ. The result is stored in `data` along with
   // additional derived quantities from dv.
-  // @param supernodal_solver If nullptr, this method uses dense algebra to
-  // compute the Hessian and factorize it. Otherwise, this method uses the
-  // supernodal solver provided.
+  // @param supernodal_solver The supernodal solver used to factorize the
+  // Hessian. Unused (and can be nullptr) when parameters_.linear_solver_type
+  // is LinearSolverType::kDense or LinearSolverType::kConjugateGradient.
   // @pre context was created by the underlying SapModel.
   // @pre supernodal_solver must be a valid supernodal solver created with
-  // MakeSuperNodalSolver() when
-  // parameters_.linear_solver_type != LinearSolverType::kDense.
+  // MakeSuperNodalSolver() when parameters_.linear_solver_type uses one.
   void CalcSearchDirectionData(const systems::Context<T>& context,
                                SuperNodalSolver* supernodal_solver,
                                SearchDirectionData* data) const;
 
   std::unique_ptr<SapModel<T>> model_;
   SapSolverParameters parameters_;
+  // The supernodal solver kept across calls to SolveWithGuess() when
+  // parameters_.reuse_symbolic_factorization is true. See
+  // AcquireSuperNodalSolver().
+  std::unique_ptr<BlockSparseSuperNodalSolver> reusable_supernodal_solver_;
   // Stats are mutable so we can update them from within const methods (e.g.
   // Eval() methods). Nothing in stats is allowed to affect the computation; it
   // is purely a passive observer.
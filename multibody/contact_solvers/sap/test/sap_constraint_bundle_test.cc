@@ -226,6 +226,52 @@ TEST_F(SapConstraintBundleTest, VerifyGradients) {
   }
 }
 
+// Per-constraint computations may be evaluated concurrently. Results must be
+// identical to those of the serial evaluation.
+TEST_F(SapConstraintBundleTest, ParallelEvaluation) {
+  const SapConstraintBundle<AutoDiffXd> parallel_bundle(
+      problem_.get(), delassus_diagonal_, Parallelism(3));
+  EXPECT_EQ(parallel_bundle.parallelism().num_threads(), 3);
+  EXPECT_EQ(bundle_->parallelism().num_threads(), 1);
+
+  const AutoDiffXd time_step = 0.02;
+  const VectorXd vc = VectorXd::LinSpaced(17, -1.0, 2.5);  // Arbitrary values.
+  const VectorX<AutoDiffXd> vc_ad = drake::math::InitializeAutoDiff(vc);
+  SapConstraintBundleData serial_data =
+      bundle_->MakeData(time_step, delassus_diagonal_);
+  SapConstraintBundleData parallel_data =
+      parallel_bundle.MakeData(time_step, delassus_diagonal_);
+  bundle_->CalcData(vc_ad, &serial_data);
+  parallel_bundle.CalcData(vc_ad, &parallel_data);
+
+  const AutoDiffXd serial_cost = bundle_->CalcCost(serial_data);
+  const AutoDiffXd parallel_cost = parallel_bundle.CalcCost(parallel_data);
+  EXPECT_EQ(parallel_cost.value(), serial_cost.value());
+  EXPECT_EQ(parallel_cost.derivatives(), serial_cost.derivatives());
+
+  VectorX<AutoDiffXd> serial_gamma(vc.size());
+  VectorX<AutoDiffXd> parallel_gamma(vc.size());
+  std::vector<MatrixX<AutoDiffXd>> serial_G(problem_->num_constraints());
+  std::vector<MatrixX<AutoDiffXd>> parallel_G(problem_->num_constraints());
+  bundle_->CalcImpulsesAndConstraintsHessian(serial_data, &serial_gamma,
+                                             &serial_G);
+  parallel_bundle.CalcImpulsesAndConstraintsHessian(
+      parallel_data, &parallel_gamma, &parallel_G);
+  EXPECT_EQ(math::ExtractValue(parallel_gamma),
+            math::ExtractValue(serial_gamma));
+  EXPECT_EQ(math::ExtractGradient(parallel_gamma),
+            math::ExtractGradient(serial_gamma));
+  for (int k = 0; k < problem_->num_constraints(); ++k) {
+    EXPECT_EQ(math::ExtractValue(parallel_G[k]),
+              math::ExtractValue(serial_G[k]));
+  }
+
+  parallel_gamma.setZero();
+  parallel_bundle.CalcImpulses(parallel_data, &parallel_gamma);
+  EXPECT_EQ(math::ExtractValue(parallel_gamma),
+            math::ExtractValue(serial_gamma));
+}
+
 }  // namespace
 }  // namespace internal
 }  // namespace contact_solvers
@@ -0,0 +1,107 @@
+#include "drake/multibody/contact_solvers/sap/sap_hessian_operator.h"
+
+#include <limits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+
+using Eigen::MatrixXd;
+using Eigen::VectorXd;
+
+namespace drake {
+namespace multibody {
+namespace contact_solvers {
+namespace internal {
+namespace {
+
+constexpr double kEps = std::numeric_limits<double>::epsilon();
+
+// Makes an arbitrary SPD matrix of size n.
+MatrixXd MakeSpdMatrix(int n, double seed) {
+  const MatrixXd B =
+      MatrixXd::Constant(n, n, seed) + MatrixXd::Identity(n, n) * (1 + seed);
+  return B.transpose() * B + MatrixXd::Identity(n, n);
+}
+
+class SapHessianOperatorTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    // Three cliques with 2, 3 and 1 velocities.
+    A_ = {MakeSpdMatrix(2, 0.1), MakeSpdMatrix(3, 0.2), MakeSpdMatrix(1, 0.3)};
+
+    // Two clusters of constraints. The first couples cliques 0 and 1, with a
+    // single constraint of size 3. The second only involves clique 2, with two
+    // constraints of sizes 1 and 2.
+    J_dense_ = MatrixXd::Zero(6, 6);
+    J_dense_.block(0, 0, 3, 2) << 1, 2, 3, 4, 5, 6;
+    J_dense_.block(0, 2, 3, 3) << 1, -1, 0.5, 2, 0, -2, 0.3, 0.2, 0.1;
+    J_dense_.block(3, 5, 3, 1) << 0.5, -1, 2;
+    BlockSparseMatrixBuilder<double> builder(2, 3, 3);
+    builder.PushBlock(0, 0, MatrixBlock<double>(J_dense_.block(0, 0, 3, 2)));
+    builder.PushBlock(0, 1, MatrixBlock<double>(J_dense_.block(0, 2, 3, 3)));
+    builder.PushBlock(1, 2, MatrixBlock<double>(J_dense_.block(3, 5, 3, 1)));
+    J_ = builder.Build();
+
+    G_ = {MakeSpdMatrix(3, 0.4), MakeSpdMatrix(1, 0.5), MakeSpdMatrix(2, 0.6)};
+
+    MatrixXd A_dense = MatrixXd::Zero(6, 6);
+    A_dense.block(0, 0, 2, 2) = A_[0];
+    A_dense.block(2, 2, 3, 3) = A_[1];
+    A_dense.block(5, 5, 1, 1) = A_[2];
+    MatrixXd G_dense = MatrixXd::Zero(6, 6);
+    G_dense.block(0, 0, 3, 3) = G_[0];
+    G_dense.block(3, 3, 1, 1) = G_[1];
+    G_dense.block(4, 4, 2, 2) = G_[2];
+    H_expected_ = A_dense + J_dense_.transpose() * G_dense * J_dense_;
+  }
+
+  std::vector<MatrixXd> A_;
+  MatrixXd J_dense_;
+  BlockSparseMatrix<double> J_;
+  std::vector<MatrixXd> G_;
+  MatrixXd H_expected_;
+};
+
+TEST_F(SapHessianOperatorTest, Multiply) {
+  const SapHessianOperator<double> H("H", &A_, &J_, &G_);
+  EXPECT_EQ(H.name(), "H");
+  EXPECT_EQ(H.rows(), 6);
+  EXPECT_EQ(H.cols(), 6);
+
+  const VectorXd x = VectorXd::LinSpaced(6, -1.0, 2.0);
+  VectorXd y(6);
+  H.Multiply(x, &y);
+  EXPECT_TRUE(CompareMatrices(y, H_expected_ * x, 10 * kEps,
+                              MatrixCompareType::relative));
+
+  // H is symmetric.
+  VectorXd yt(6);
+  H.MultiplyByTranspose(x, &yt);
+  EXPECT_EQ(yt, y);
+
+  // The sparse signature agrees with the dense one.
+  const Eigen::SparseVector<double> x_sparse = x.sparseView();
+  Eigen::SparseVector<double> y_sparse(6);
+  H.Multiply(x_sparse, &y_sparse);
+  EXPECT_TRUE(CompareMatrices(VectorXd(y_sparse), y, 0));
+}
+
+TEST_F(SapHessianOperatorTest, CalcBlockDiagonal) {
+  const SapHessianOperator<double> H("H", &A_, &J_, &G_);
+  const std::vector<MatrixXd> H_diagonal = H.CalcBlockDiagonal();
+  ASSERT_EQ(H_diagonal.size(), 3);
+  EXPECT_TRUE(CompareMatrices(H_diagonal[0], H_expected_.block(0, 0, 2, 2),
+                              10 * kEps, MatrixCompareType::relative));
+  EXPECT_TRUE(CompareMatrices(H_diagonal[1], H_expected_.block(2, 2, 3, 3),
+                              10 * kEps, MatrixCompareType::relative));
+  EXPECT_TRUE(CompareMatrices(H_diagonal[2], H_expected_.block(5, 5, 1, 1),
+                              10 * kEps, MatrixCompareType::relative));
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace contact_solvers
+}  // namespace multibody
+}  // namespace drake
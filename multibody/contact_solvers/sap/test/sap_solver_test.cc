@@ -460,6 +460,17 @@ TEST_P(PizzaSaverTest, Stiction) {
   VerifyStictionSolution(params, relative_tolerance, cost_criterion_reached);
 }
 
+// Same as the Stiction test, but using the matrix-free conjugate gradient
+// linear solver.
+TEST_P(PizzaSaverTest, StictionWithConjugateGradient) {
+  SapSolverParameters params;  // Default set of parameters.
+  params.line_search_type = GetParam();
+  params.linear_solver_type =
+      SapSolverParameters::LinearSolverType::kConjugateGradient;
+  VerifyStictionSolution(params, params.rel_tolerance,
+                         false /* cost_criterion_reached */);
+}
+
 // We set a very tight optimality tolerance. The solver won't be able to reach
 // these tolerances. However, it will reach the optimal solution within
 // round-off errors. This is the best the solver could do. It makes sense that
@@ -638,6 +649,108 @@ TEST_P(PizzaSaverTest, NearRigidStiction) {
   }
 }
 
+// Verify that reusing the symbolic factorization across time steps doesn't
+// change the solution, and that it is reported in the solver statistics.
+TEST_P(PizzaSaverTest, ReuseSymbolicFactorization) {
+  PizzaSaverProblem problem = MakeStictionProblem();
+  const Vector4d tau(0.0, 0.0, -problem.mass() * problem.g(), 20.0);
+
+  SapSolverParameters params;  // Default set of parameters.
+  params.line_search_type = GetParam();
+  SapSolver<double> sap;
+  sap.set_parameters(params);
+  params.reuse_symbolic_factorization = true;
+  SapSolver<double> sap_reuse;
+  sap_reuse.set_parameters(params);
+
+  // Arbitrary non-zero guess so that Newton iterations are needed.
+  const Vector4d v_guess(1.0, 2.0, 3.0, 4.0);
+  VectorXd q = Vector4d(0.0, 0.0, 0.0, M_PI / 5);
+  VectorXd v = VectorXd::Zero(problem.kNumVelocities);
+  SapSolverResults<double> result;
+  SapSolverResults<double> result_reuse;
+  for (int i = 0; i < 5; ++i) {
+    const auto contact_problem =
+        problem.MakeContactProblem(q, v, tau, 1.0, kDefaultSigma);
+    ASSERT_EQ(sap.SolveWithGuess(*contact_problem, v_guess, &result),
+              SapSolverStatus::kSuccess);
+    ASSERT_EQ(
+        sap_reuse.SolveWithGuess(*contact_problem, v_guess, &result_reuse),
+        SapSolverStatus::kSuccess);
+    EXPECT_GT(sap_reuse.get_statistics().num_iters, 0);
+    EXPECT_FALSE(sap.get_statistics().symbolic_factorization_reused);
+    // The (single clique) sparsity pattern never changes and therefore the
+    // analysis is reused on all but the first solve.
+    EXPECT_EQ(sap_reuse.get_statistics().symbolic_factorization_reused,
+              i > 0);
+    EXPECT_EQ(result_reuse.v, result.v);
+    EXPECT_EQ(result_reuse.gamma, result.gamma);
+    v = result.v;
+    q += problem.time_step() * v;
+  }
+}
+
+// Verify that a Newton iteration ended early by the iteration budget, the time
+// budget or a stall is only accepted when requested, and that it is reported
+// in the solver statistics.
+TEST_P(PizzaSaverTest, Budget) {
+  PizzaSaverProblem problem = MakeStictionProblem();
+  const Vector4d tau(0.0, 0.0, -problem.mass() * problem.g(), 20.0);
+  const VectorXd q = Vector4d(0.0, 0.0, 0.0, M_PI / 5);
+  const VectorXd v = VectorXd::Zero(problem.kNumVelocities);
+  const auto contact_problem =
+      problem.MakeContactProblem(q, v, tau, 1.0, kDefaultSigma);
+  // Arbitrary non-zero guess so that Newton iterations are needed.
+  const Vector4d v_guess(1.0, 2.0, 3.0, 4.0);
+
+  SapSolverParameters params;  // Default set of parameters.
+  params.line_search_type = GetParam();
+  SapSolver<double> sap;
+  SapSolverResults<double> result;
+
+  // The iteration budget.
+  params.max_iterations = 1;
+  sap.set_parameters(params);
+  EXPECT_EQ(sap.SolveWithGuess(*contact_problem, v_guess, &result),
+            SapSolverStatus::kFailure);
+  EXPECT_TRUE(sap.get_statistics().budget_exhausted);
+  params.accept_iterate_on_budget = true;
+  sap.set_parameters(params);
+  ASSERT_EQ(sap.SolveWithGuess(*contact_problem, v_guess, &result),
+            SapSolverStatus::kSuccess);
+  const SapSolver<double>::SolverStats& stats = sap.get_statistics();
+  EXPECT_TRUE(stats.budget_exhausted);
+  EXPECT_FALSE(stats.stalled);
+  EXPECT_FALSE(stats.optimality_criterion_reached);
+  EXPECT_EQ(stats.num_iters, 1);
+  // The accepted iterate improves on the guess.
+  EXPECT_LT(stats.cost[1], stats.cost[0]);
+  EXPECT_NE(result.v, VectorXd(v_guess));
+
+  // A zero time budget is exhausted before the first Newton iteration, and
+  // the guess is returned.
+  params.max_iterations = 100;
+  params.max_solve_time = 0.0;
+  sap.set_parameters(params);
+  ASSERT_EQ(sap.SolveWithGuess(*contact_problem, v_guess, &result),
+            SapSolverStatus::kSuccess);
+  EXPECT_TRUE(stats.budget_exhausted);
+  EXPECT_EQ(stats.num_iters, 0);
+  EXPECT_EQ(result.v, VectorXd(v_guess));
+
+  // Requiring the residual to vanish within a single iteration stalls on the
+  // first one.
+  params.max_solve_time = std::numeric_limits<double>::infinity();
+  params.stall_window = 1;
+  params.stall_reduction_ratio = 0.0;
+  sap.set_parameters(params);
+  ASSERT_EQ(sap.SolveWithGuess(*contact_problem, v_guess, &result),
+            SapSolverStatus::kSuccess);
+  EXPECT_TRUE(stats.stalled);
+  EXPECT_FALSE(stats.budget_exhausted);
+  EXPECT_EQ(stats.num_iters, 1);
+}
+
 TEST_P(PizzaSaverTest, NoConstraints) {
   const double dt = 0.01;
   const double mu = NAN;    // not used in this problem.
@@ -1062,6 +1175,42 @@ TEST_P(SapNewtonIterationTest, GuessOutsideLimits) {
   CompareDenseAgainstSupernodal(v_guess);
 }
 
+// Verify the matrix-free conjugate gradient solver converges to the same
+// solution as dense algebra.
+TEST_P(SapNewtonIterationTest, ConjugateGradient) {
+  // Arbitrary initial guess outside the constraint bounds to force several
+  // Newton iterations.
+  VectorXd v_guess = v_star_;
+  v_guess.segment<3>(2) = Vector3d(1.2 * vl_(0), v_star_(1), 1.1 * vu_(2));
+
+  SapSolverParameters params;
+  params.line_search_type = GetParam();
+  params.abs_tolerance = 0;
+  params.rel_tolerance = 1.0e-12;
+  params.linear_solver_type =
+      SapSolverParameters::LinearSolverType::kConjugateGradient;
+  params.conjugate_gradient.relative_tolerance = 1.0e-14;
+  SapSolver<double> sap;
+  sap.set_parameters(params);
+  SapSolverResults<double> result;
+  EXPECT_EQ(sap.SolveWithGuess(*sap_problem_, v_guess, &result),
+            SapSolverStatus::kSuccess);
+  const SapSolver<double>::SolverStats& stats = sap.get_statistics();
+  EXPECT_GT(stats.num_iters, 1);
+  // For an n×n system, conjugate gradient converges in at most n iterations in
+  // exact arithmetic; we allow a few more for round-off errors.
+  EXPECT_GE(stats.num_conjugate_gradient_iters, stats.num_iters);
+  EXPECT_LE(stats.num_conjugate_gradient_iters,
+            2 * sap_problem_->num_velocities() * stats.num_iters);
+
+  SapSolverParameters params_dense = params;
+  params_dense.linear_solver_type =
+      SapSolverParameters::LinearSolverType::kDense;
+  const VectorXd v_dense = SolveWithGuess(params_dense, v_guess);
+  EXPECT_TRUE(CompareMatrices(result.v, v_dense, 1.0e-10,
+                              MatrixCompareType::relative));
+}
+
 INSTANTIATE_TEST_SUITE_P(
     TestLineSearchMethods, SapNewtonIterationTest,
     testing::Values(SapSolverParameters::LineSearchType::kBackTracking,
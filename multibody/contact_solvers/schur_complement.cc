@@ -14,10 +14,16 @@ SchurComplement::SchurComplement() = default;
 SchurComplement::~SchurComplement() = default;
 
 SchurComplement::SchurComplement(const Block3x3SparseSymmetricMatrix& A,
-                                 const std::unordered_set<int>& D_indices)
-    : D_indices_(D_indices.begin(), D_indices.end()) {
-  /* Keep D_indices_ sorted. */
+                                 const std::unordered_set<int>& D_indices) {
+  Update(A, D_indices);
+}
+
+void SchurComplement::Update(const Block3x3SparseSymmetricMatrix& A,
+                             const std::unordered_set<int>& D_indices) {
   DRAKE_THROW_UNLESS(ssize(D_indices) <= A.block_cols());
+  D_indices_.assign(D_indices.begin(), D_indices.end());
+  C_indices_.clear();
+  /* Keep D_indices_ sorted. */
   std::sort(D_indices_.begin(), D_indices_.end());
   /* If a block index doesn't belong to the D blocks, it belongs to the C
    blocks. We step through `D_indices_` to detect the gaps in order to fill in
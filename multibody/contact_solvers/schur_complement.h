@@ -96,6 +96,17 @@ class SchurComplement {
   SchurComplement(const Block3x3SparseSymmetricMatrix& A,
                   const std::unordered_set<int>& D_indices);
 
+  /* Recomputes `this` SchurComplement for the matrix A and the block indices
+   `D_indices`, with the same meaning as in the constructor. Compared to
+   constructing a new SchurComplement, this reuses the elimination ordering
+   and the symbolic factorization of the previous computation when the
+   sparsity pattern of A and `D_indices` are unchanged, e.g., for successive
+   tangent matrices of the same FEM model.
+   @throws std::exception if the factorization fails.
+   @pre D_indices is a subset of {0, ..., A.block_cols()-1}. */
+  void Update(const Block3x3SparseSymmetricMatrix& A,
+              const std::unordered_set<int>& D_indices);
+
   /* Returns the Schur complement for the block D of the matrix A,
    S = C - BᵀD⁻¹B. */
   const MatrixX<double>& get_D_complement() const { return S_; }
@@ -81,6 +81,14 @@ class SuperNodalSolver {
  protected:
   SuperNodalSolver() = default;
 
+  // Derived classes that change the underlying system in place (e.g. to
+  // solve a new system with a different Jacobian) call this so that
+  // SetWeightMatrix() is required again before Factor() or Solve().
+  void InvalidateMatrixAndFactorization() {
+    matrix_ready_ = false;
+    factorization_ready_ = false;
+  }
+
   // @group NVI implementations. Specific solvers must implement these
   // methods. Refer to the specific NVI documentation for details.
   // @{
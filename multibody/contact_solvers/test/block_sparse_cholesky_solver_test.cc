@@ -1,7 +1,9 @@
 #include "drake/multibody/contact_solvers/block_sparse_cholesky_solver.h"
 
+#include <algorithm>
 #include <memory>
 #include <numeric>
+#include <random>
 #include <utility>
 
 #include <gtest/gtest.h>
@@ -275,6 +277,82 @@ GTEST_TEST(BlockSparseCholeskySolverTest, FactorAndCalcSchurComplement) {
   }
 }
 
+/* Makes an SPD matrix with `num_blocks` 3x3 blocks, whose off-diagonal
+ nonzero blocks connect each block i > 0 to block (i - 1) / 2 (so that the
+ graph of the matrix is a binary tree) and to a few other random blocks. */
+BlockSparseSymmetricMatrix MakeLargeSparseSpdMatrix(int num_blocks) {
+  std::mt19937 generator(42);
+  std::uniform_int_distribution<int> random_block(0, num_blocks - 1);
+  std::vector<std::vector<int>> sparsity(num_blocks);
+  for (int i = 0; i < num_blocks; ++i) {
+    sparsity[i].push_back(i);
+  }
+  for (int i = 1; i < num_blocks; ++i) {
+    sparsity[(i - 1) / 2].push_back(i);
+    if (i % 5 == 0) {
+      const int j = random_block(generator);
+      if (j != i && j != (i - 1) / 2) {
+        sparsity[std::min(i, j)].push_back(std::max(i, j));
+      }
+    }
+  }
+  for (auto& neighbors : sparsity) {
+    std::sort(neighbors.begin(), neighbors.end());
+    neighbors.erase(std::unique(neighbors.begin(), neighbors.end()),
+                    neighbors.end());
+  }
+  BlockSparseSymmetricMatrix A(
+      BlockSparsityPattern(std::vector<int>(num_blocks, 3), sparsity));
+  std::uniform_real_distribution<double> random_value(-1.0, 1.0);
+  for (int j = 0; j < num_blocks; ++j) {
+    for (int i : sparsity[j]) {
+      if (i != j) {
+        const MatrixXd Aij = MatrixXd::NullaryExpr(3, 3, [&]() {
+          return random_value(generator);
+        });
+        A.AddToBlock(i, j, Aij);
+        /* Make the matrix diagonally dominant. */
+        A.AddToBlock(i, i, 3.0 * MatrixXd::Identity(3, 3));
+        A.AddToBlock(j, j, 3.0 * MatrixXd::Identity(3, 3));
+      }
+    }
+    A.AddToBlock(j, j, MatrixXd::Identity(3, 3));
+  }
+  return A;
+}
+
+/* The factorization, and hence the solution and the Schur complement, do not
+ depend on the number of threads. */
+GTEST_TEST(BlockSparseCholeskySolverTest, Parallelism) {
+  const BlockSparseSymmetricMatrix A = MakeLargeSparseSpdMatrix(100);
+  const MatrixXd dense_A = A.MakeDenseMatrix();
+  const VectorXd b = VectorXd::LinSpaced(A.cols(), -1.0, 1.0);
+  const std::unordered_set<int> eliminated_blocks = {0, 3, 10, 57, 71, 90};
+
+  BlockSparseCholeskySolver<MatrixXd> serial_solver;
+  EXPECT_EQ(serial_solver.parallelism().num_threads(), 1);
+  serial_solver.SetMatrix(A);
+  ASSERT_TRUE(serial_solver.Factor());
+  const VectorXd x = serial_solver.Solve(b);
+  EXPECT_TRUE(CompareMatrices(dense_A * x, b, 1e-12));
+  const MatrixXd L = serial_solver.L().MakeDenseMatrix();
+  const std::optional<MatrixXd> S =
+      serial_solver.FactorAndCalcSchurComplement(A, eliminated_blocks);
+  ASSERT_TRUE(S.has_value());
+
+  BlockSparseCholeskySolver<MatrixXd> parallel_solver;
+  parallel_solver.set_parallelism(Parallelism(4));
+  EXPECT_EQ(parallel_solver.parallelism().num_threads(), 4);
+  parallel_solver.SetMatrix(A);
+  ASSERT_TRUE(parallel_solver.Factor());
+  EXPECT_EQ(parallel_solver.L().MakeDenseMatrix(), L);
+  EXPECT_EQ(parallel_solver.Solve(b), x);
+  const std::optional<MatrixXd> parallel_S =
+      parallel_solver.FactorAndCalcSchurComplement(A, eliminated_blocks);
+  ASSERT_TRUE(parallel_S.has_value());
+  EXPECT_EQ(parallel_S.value(), S.value());
+}
+
 }  // namespace
 }  // namespace internal
 }  // namespace contact_solvers
@@ -0,0 +1,160 @@
+#include "drake/multibody/contact_solvers/conjugate_gradient.h"
+
+#include <limits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
+#include "drake/multibody/contact_solvers/sparse_linear_operator.h"
+
+using Eigen::MatrixXd;
+using Eigen::VectorXd;
+
+namespace drake {
+namespace multibody {
+namespace contact_solvers {
+namespace internal {
+namespace {
+
+constexpr double kEps = std::numeric_limits<double>::epsilon();
+
+// A block diagonal matrix with blocks of sizes 2 and 3.
+std::vector<MatrixXd> MakeBlocks() {
+  MatrixXd D0(2, 2);
+  D0 << 4, 1, 1, 3;
+  MatrixXd D1(3, 3);
+  D1 << 5, 1, 0, 1, 4, 1, 0, 1, 3;
+  return {D0, D1};
+}
+
+GTEST_TEST(BlockJacobiPreconditionerTest, Multiply) {
+  const std::vector<MatrixXd> blocks = MakeBlocks();
+  const BlockJacobiPreconditioner<double> P("P", blocks);
+  EXPECT_EQ(P.rows(), 5);
+  EXPECT_EQ(P.cols(), 5);
+  MatrixXd D = MatrixXd::Zero(5, 5);
+  D.block(0, 0, 2, 2) = blocks[0];
+  D.block(2, 2, 3, 3) = blocks[1];
+
+  const VectorXd x = VectorXd::LinSpaced(5, -1.0, 1.0);
+  VectorXd y(5);
+  P.Multiply(x, &y);
+  EXPECT_TRUE(CompareMatrices(y, D.inverse() * x, 10 * kEps,
+                              MatrixCompareType::relative));
+
+  VectorXd yt(5);
+  P.MultiplyByTranspose(x, &yt);
+  EXPECT_EQ(yt, y);
+
+  const Eigen::SparseVector<double> x_sparse = x.sparseView();
+  Eigen::SparseVector<double> y_sparse(5);
+  P.Multiply(x_sparse, &y_sparse);
+  EXPECT_TRUE(CompareMatrices(VectorXd(y_sparse), y, 0));
+}
+
+GTEST_TEST(BlockJacobiPreconditionerTest, BadBlocks) {
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      BlockJacobiPreconditioner<double>("P", {MatrixXd::Ones(2, 3)}),
+      ".*block 0 of size 2x3 is not square.");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      BlockJacobiPreconditioner<double>(
+          "P", {MatrixXd::Identity(2, 2), -MatrixXd::Identity(2, 2)}),
+      ".*factorization of block 1 failed.*");
+}
+
+class ConjugateGradientTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    // An arbitrary SPD matrix with a diagonally dominant block structure.
+    const int n = 5;
+    MatrixXd B = MatrixXd::Zero(n, n);
+    for (int i = 0; i < n; ++i) {
+      for (int j = 0; j < n; ++j) {
+        B(i, j) = 1.0 / (1.0 + i + 2 * j);
+      }
+    }
+    A_dense_ = B.transpose() * B + MatrixXd::Identity(n, n);
+    A_ = A_dense_.sparseView();
+    b_ = VectorXd::LinSpaced(n, 1.0, -2.0);
+  }
+
+  MatrixXd A_dense_;
+  Eigen::SparseMatrix<double> A_;
+  VectorXd b_;
+};
+
+TEST_F(ConjugateGradientTest, Solve) {
+  const SparseLinearOperator<double> A_op("A", &A_);
+  const std::vector<MatrixXd> diagonal_blocks = {A_dense_.block(0, 0, 2, 2),
+                                                 A_dense_.block(2, 2, 3, 3)};
+  const BlockJacobiPreconditioner<double> P("P", diagonal_blocks);
+
+  VectorXd x;
+  int num_iterations = -1;
+  EXPECT_TRUE(SolveWithPreconditionedConjugateGradient<double>(
+      A_op, P, b_, 1.0e-14, 100, &x, &num_iterations));
+  // In exact arithmetic, conjugate gradient converges in at most n
+  // iterations. We allow some slop for round-off errors.
+  EXPECT_GT(num_iterations, 0);
+  EXPECT_LE(num_iterations, 2 * b_.size());
+  const VectorXd x_expected = A_dense_.ldlt().solve(b_);
+  EXPECT_TRUE(CompareMatrices(x, x_expected, 1.0e-12,
+                              MatrixCompareType::relative));
+}
+
+TEST_F(ConjugateGradientTest, MaxIterations) {
+  const SparseLinearOperator<double> A_op("A", &A_);
+  const BlockJacobiPreconditioner<double> P(
+      "P", {A_dense_.block(0, 0, 2, 2), A_dense_.block(2, 2, 3, 3)});
+
+  VectorXd x;
+  int num_iterations = -1;
+  EXPECT_FALSE(SolveWithPreconditionedConjugateGradient<double>(
+      A_op, P, b_, 0.0, 1, &x, &num_iterations));
+  EXPECT_EQ(num_iterations, 1);
+  // A truncated solve is still a descent direction for ½xᵀAx − bᵀx.
+  EXPECT_GT(b_.dot(x), 0.0);
+}
+
+TEST_F(ConjugateGradientTest, ZeroRightHandSide) {
+  const SparseLinearOperator<double> A_op("A", &A_);
+  const BlockJacobiPreconditioner<double> P("P", {A_dense_});
+
+  VectorXd x;
+  int num_iterations = -1;
+  EXPECT_TRUE(SolveWithPreconditionedConjugateGradient<double>(
+      A_op, P, VectorXd::Zero(5), 1.0e-8, 100, &x, &num_iterations));
+  EXPECT_EQ(num_iterations, 0);
+  EXPECT_EQ(x, VectorXd::Zero(5));
+}
+
+// With an indefinite A, the very first search direction can have pᵀAp ≤ 0.
+// No progress is possible, and the failure is reported.
+GTEST_TEST(ConjugateGradientBreakdownTest, FirstIteration) {
+  Eigen::SparseMatrix<double> A(2, 2);
+  A.insert(0, 0) = 1.0;
+  A.insert(1, 1) = -1.0;
+  const SparseLinearOperator<double> A_op("A", &A);
+  const BlockJacobiPreconditioner<double> P("P", {MatrixXd::Identity(2, 2)});
+
+  VectorXd x;
+  int num_iterations = -1;
+  EXPECT_FALSE(SolveWithPreconditionedConjugateGradient<double>(
+      A_op, P, VectorXd::Unit(2, 1), 1.0e-8, 100, &x, &num_iterations));
+  EXPECT_EQ(num_iterations, 0);
+  EXPECT_EQ(x, VectorXd::Zero(2));
+
+  // Along a direction of positive curvature, the same A is solved.
+  EXPECT_TRUE(SolveWithPreconditionedConjugateGradient<double>(
+      A_op, P, VectorXd::Unit(2, 0), 1.0e-8, 100, &x, &num_iterations));
+  EXPECT_EQ(num_iterations, 1);
+  EXPECT_EQ(x, VectorXd(VectorXd::Unit(2, 0)));
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace contact_solvers
+}  // namespace multibody
+}  // namespace drake
@@ -1,6 +1,8 @@
 #include "drake/multibody/contact_solvers/minimum_degree_ordering.h"
 
+#include <algorithm>
 #include <memory>
+#include <numeric>
 #include <utility>
 
 #include <gtest/gtest.h>
@@ -19,32 +21,37 @@ GTEST_TEST(MinimumDegreeOrderingTest, Union) {
   EXPECT_EQ(result, expected);
 }
 
-GTEST_TEST(MinimumDegreeOrderingTest, SetDifference) {
-  const std::vector<int> a = {1, 2, 5, 8, 9};
-  const std::vector<int> b = {1, 3, 5, 7, 9, 11};
-  const std::vector<int> result = SetDifference(a, b);
-  const std::vector<int> expected = {2, 8};
-  EXPECT_EQ(result, expected);
-}
-
-GTEST_TEST(MinimumDegreeOrderingTest, RemoveValueFromSortedVector) {
-  const std::vector<int> input = {1, 2, 5, 8, 9};
-  std::vector<int> v = input;
-  RemoveValueFromSortedVector(3, &v);
-  EXPECT_EQ(input, v);
-  RemoveValueFromSortedVector(2, &v);
-  const std::vector<int> expected = {1, 5, 8, 9};
-  EXPECT_EQ(v, expected);
-}
-
-GTEST_TEST(MinimumDegreeOrderingTest, InsertValueInSortedVector) {
-  const std::vector<int> input = {1, 2, 5, 8, 9};
-  std::vector<int> v = input;
-  InsertValueInSortedVector(2, &v);
-  EXPECT_EQ(input, v);
-  InsertValueInSortedVector(3, &v);
-  const std::vector<int> expected = {1, 2, 3, 5, 8, 9};
-  EXPECT_EQ(v, expected);
+/* Returns the number of nonzero blocks in the Cholesky factor of the matrix
+ with the given lower triangular `sparsity` when its blocks are eliminated in
+ the given `ordering`. */
+int CountFactorBlocks(const std::vector<std::vector<int>>& sparsity,
+                      const std::vector<int>& block_sizes,
+                      const std::vector<int>& ordering) {
+  const int n = block_sizes.size();
+  std::vector<int> new_index(n);
+  for (int k = 0; k < n; ++k) {
+    new_index[ordering[k]] = k;
+  }
+  std::vector<std::vector<int>> permuted(n);
+  std::vector<int> permuted_sizes(n);
+  for (int j = 0; j < n; ++j) {
+    permuted_sizes[new_index[j]] = block_sizes[j];
+    for (int i : sparsity[j]) {
+      const int a = std::min(new_index[i], new_index[j]);
+      const int b = std::max(new_index[i], new_index[j]);
+      permuted[a].push_back(b);
+    }
+  }
+  for (auto& column : permuted) {
+    std::sort(column.begin(), column.end());
+  }
+  const BlockSparsityPattern L = SymbolicCholeskyFactor(
+      BlockSparsityPattern(std::move(permuted_sizes), std::move(permuted)));
+  int result = 0;
+  for (const auto& column : L.neighbors()) {
+    result += column.size();
+  }
+  return result;
 }
 
 /* This example is taken from G5 in figure 2 from [Amestoy 1996].
@@ -57,13 +64,15 @@ GTEST_TEST(MinimumDegreeOrderingTest, InsertValueInSortedVector) {
     |  \    \ /
    10---8----4
 
-  where nodes 4 and 5 are elements and all other nodes are variables. We call
-  update external degree on all variables to verify the results are as expected.
+  where nodes 4 and 5 are elements and all other nodes are variables. We
+  pretend that each of the elements was just formed and update the approximate
+  external degree of its variables to verify the results are as expected. Here
+  the elements overlap in a way that makes the approximate degrees exact.
 
   [Amestoy 1996] Amestoy, Patrick R., Timothy A. Davis, and Iain S. Duff. "An
  approximate minimum degree ordering algorithm." SIAM Journal on Matrix Analysis
  and Applications 17.4 (1996): 886-905. */
-GTEST_TEST(MinimumDegreeOrderingTest, UpdateExternalDegree) {
+GTEST_TEST(MinimumDegreeOrderingTest, UpdateApproximateExternalDegree) {
   Node n4{
       .degree = 0, .size = 40, .index = 4, .A = {}, .E = {}, .L = {6, 7, 8}};
   Node n5{
@@ -87,21 +96,29 @@ GTEST_TEST(MinimumDegreeOrderingTest, UpdateExternalDegree) {
   nodes.push_back(n9);
   nodes.push_back(n10);
 
-  n6.UpdateExternalDegree(nodes);
-  n7.UpdateExternalDegree(nodes);
-  n8.UpdateExternalDegree(nodes);
-  n9.UpdateExternalDegree(nodes);
-  n10.UpdateExternalDegree(nodes);
+  /* Element 5 was just formed: |L5| = 60 + 70 + 90 and |L4 \ L5| = |{8}|. */
+  std::vector<int> external_sizes(11, 0);
+  external_sizes[4] = 80;
+  n6.UpdateApproximateExternalDegree(nodes, 5, 220, external_sizes);
+  n7.UpdateApproximateExternalDegree(nodes, 5, 220, external_sizes);
+  n9.UpdateApproximateExternalDegree(nodes, 5, 220, external_sizes);
   /* Fill-ins are 7,8,9. */
   EXPECT_EQ(n6.degree, 240);
   /* Fill-ins are 6,8,9,10. */
   EXPECT_EQ(n7.degree, 330);
-  /* Fill-ins are 6,7,9,10. */
-  EXPECT_EQ(n8.degree, 320);
   /* Fill-ins are 6,7,8,10. */
   EXPECT_EQ(n9.degree, 310);
-  /* Fill-ins are 7,8,9. */
-  EXPECT_EQ(n10.degree, 240);
+
+  /* Element 4 was just formed: |L4| = 60 + 70 + 80 and |L5 \ L4| = |{9}|. */
+  external_sizes[4] = 0;
+  external_sizes[5] = 90;
+  n6.UpdateApproximateExternalDegree(nodes, 4, 210, external_sizes);
+  n7.UpdateApproximateExternalDegree(nodes, 4, 210, external_sizes);
+  n8.UpdateApproximateExternalDegree(nodes, 4, 210, external_sizes);
+  EXPECT_EQ(n6.degree, 240);
+  EXPECT_EQ(n7.degree, 330);
+  /* Fill-ins are 6,7,9,10. */
+  EXPECT_EQ(n8.degree, 320);
 }
 
 GTEST_TEST(MinimumDegreeOrderingTest, SimplifiedNodeComparator) {
@@ -154,7 +171,9 @@ GTEST_TEST(MinimumDegreeOrderingTest, ComputeMinimumDegreeOrdering) {
 
 /* Another test for minimum degree ordering. Here we take the example from
 Figure 1 and 2 in [Amestoy, 1996], where the minimum degree ordering is the
-natural ordering when the size of the blocks are the same for all nodes.
+natural ordering when the size of the blocks are the same for all nodes. Once 6
+is eliminated, 7, 8, and 9 are only adjacent to the element 6 and are mass
+eliminated along with it.
 
 [Amestoy 1996] Amestoy, Patrick R., Timothy A. Davis, and
 Iain S. Duff. "An approximate minimum degree ordering algorithm." SIAM Journal
@@ -201,6 +220,40 @@ GTEST_TEST(MinimumDegreeOrderingTest,
   EXPECT_EQ(result, std::vector<int>({0, 2, 4, 8, 6, 1, 3, 5, 7, 9}));
 }
 
+/* On a 2D grid graph, the natural (row by row) ordering causes fill within the
+ bandwidth of the matrix, whereas AMD approximates a nested dissection. */
+GTEST_TEST(MinimumDegreeOrderingTest, GridGraph) {
+  const int kSide = 12;
+  const int n = kSide * kSide;
+  std::vector<std::vector<int>> sparsity(n);
+  for (int r = 0; r < kSide; ++r) {
+    for (int c = 0; c < kSide; ++c) {
+      const int v = r * kSide + c;
+      sparsity[v].push_back(v);
+      if (c + 1 < kSide) {
+        sparsity[v].push_back(v + 1);
+      }
+      if (r + 1 < kSide) {
+        sparsity[v].push_back(v + kSide);
+      }
+    }
+  }
+  const std::vector<int> block_sizes(n, 3);
+  const std::vector<int> result =
+      ComputeMinimumDegreeOrdering(BlockSparsityPattern(block_sizes, sparsity));
+
+  /* The result is a permutation. */
+  std::vector<int> sorted_result = result;
+  std::sort(sorted_result.begin(), sorted_result.end());
+  std::vector<int> natural(n);
+  std::iota(natural.begin(), natural.end(), 0);
+  EXPECT_EQ(sorted_result, natural);
+
+  const int natural_fill = CountFactorBlocks(sparsity, block_sizes, natural);
+  const int amd_fill = CountFactorBlocks(sparsity, block_sizes, result);
+  EXPECT_LT(amd_fill, 0.75 * natural_fill);
+}
+
 GTEST_TEST(MinimumDegreeOrderingTest, SymbolicCholeskyFactor) {
   /*
   In this schematic (unlike the one in the previous test), an X corresponds to a
@@ -290,9 +343,11 @@ GTEST_TEST(BlockSparseCholeskySolverTest, ConcatenateMdOrderingWithinGroup) {
   std::vector<int> block_sizes = {2, 2, 3, 3, 4, 4, 3, 3};
   BlockSparsityPattern block_pattern(block_sizes, sparsity);
   const std::unordered_set<int> v1 = {1, 3, 5, 7};
-  const std::vector<int> result =
-      CalcAndConcatenateMdOrderingWithinGroup(block_pattern, v1);
-  EXPECT_EQ(result, std::vector<int>({1, 7, 5, 3, 0, 6, 4, 2}));
+  for (const int num_threads : {1, 2}) {
+    const std::vector<int> result = CalcAndConcatenateMdOrderingWithinGroup(
+        block_pattern, v1, Parallelism(num_threads));
+    EXPECT_EQ(result, std::vector<int>({1, 7, 5, 3, 0, 6, 4, 2}));
+  }
 }
 
 }  // namespace
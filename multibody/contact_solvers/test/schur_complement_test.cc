@@ -127,6 +127,29 @@ GTEST_TEST(SchurComplementTest, Solve) {
   EXPECT_TRUE(CompareMatrices(z, expected_z, kTolerance));
 }
 
+/* Updating a SchurComplement in place gives the same result as constructing a
+ new one, both when the analysis of the previous matrix is reused (same
+ sparsity pattern and D indices) and when it isn't. */
+GTEST_TEST(SchurComplementTest, Update) {
+  SchurComplement dut = MakeSchurComplement();
+  Block3x3SparseSymmetricMatrix A = MakeBlockSparseMatrix();
+  A.SetBlock(0, 0, 2.0 * A00());
+  A.SetBlock(1, 0, 0.5 * A10());
+  const VectorXd b = VectorXd::LinSpaced(9, 0.0, 12.0);
+  for (const std::unordered_set<int>& D_indices :
+       {std::unordered_set<int>{1}, std::unordered_set<int>{1},
+        std::unordered_set<int>{0, 2}}) {
+    dut.Update(A, D_indices);
+    const SchurComplement expected(A, D_indices);
+    EXPECT_TRUE(CompareMatrices(dut.get_D_complement(),
+                                expected.get_D_complement(), kTolerance));
+    const VectorXd y = VectorXd::LinSpaced(9 - 3 * D_indices.size(), 1, 2);
+    EXPECT_TRUE(
+        CompareMatrices(dut.SolveForX(y), expected.SolveForX(y), kTolerance));
+    EXPECT_TRUE(CompareMatrices(dut.Solve(b), expected.Solve(b), kTolerance));
+  }
+}
+
 }  // namespace
 }  // namespace internal
 }  // namespace contact_solvers
@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <tuple>
 
 #include <gtest/gtest.h>
@@ -668,6 +669,111 @@ TYPED_TEST(SuperNodalSolverTest, ColumnSizesDifferent) {
   EXPECT_NEAR((solver.MakeFullMatrix() - full_matrix_ref).norm(), 0, 1e-15);
 }
 
+// The block sparse solver can assemble the JᵀGJ terms with multiple threads.
+// The assembled matrix must be bitwise identical to the serial assembly.
+GTEST_TEST(BlockSparseSuperNodalSolverTest, ParallelAssembly) {
+  const int num_trees = 6;
+  const int num_patches = 40;
+  std::vector<MatrixXd> blocks_of_M(num_trees);
+  for (int t = 0; t < num_trees; ++t) {
+    blocks_of_M[t] = (t + 1.0) * MatrixXd::Identity(3, 3);
+  }
+  // Each patch couples one or two (distinct) trees with arbitrary blocks.
+  std::vector<BlockTriplet> Jtriplets;
+  std::vector<MatrixXd> blocks_of_G(num_patches);
+  for (int p = 0; p < num_patches; ++p) {
+    const int t0 = p % num_trees;
+    const int t1 = (3 * p + 1) % num_trees;
+    const MatrixXd Jp = MatrixXd::Constant(3, 3, 0.1 * p) +
+                        MatrixXd::Identity(3, 3);
+    Jtriplets.push_back({p, t0, MatrixBlock<double>(Jp)});
+    if (t1 != t0) {
+      Jtriplets.push_back({p, t1, MatrixBlock<double>(MatrixXd(-Jp))});
+    }
+    blocks_of_G[p] = (1.0 + 0.01 * p) * MatrixXd::Identity(3, 3);
+  }
+
+  BlockSparseSuperNodalSolver serial(num_patches, Jtriplets, blocks_of_M);
+  BlockSparseSuperNodalSolver parallel(num_patches, Jtriplets, blocks_of_M,
+                                       Parallelism(4));
+  serial.SetWeightMatrix(blocks_of_G);
+  parallel.SetWeightMatrix(blocks_of_G);
+  EXPECT_EQ(parallel.MakeFullMatrix(), serial.MakeFullMatrix());
+
+  // Both factorizations produce the same solution.
+  const VectorXd b = VectorXd::LinSpaced(3 * num_trees, -1, 1);
+  ASSERT_TRUE(serial.Factor());
+  ASSERT_TRUE(parallel.Factor());
+  EXPECT_EQ(parallel.Solve(b), serial.Solve(b));
+}
+
+// Resetting the solver with a new J and M solves the new system, reusing the
+// symbolic analysis of H only if its sparsity pattern didn't change.
+GTEST_TEST(BlockSparseSuperNodalSolverTest, Reset) {
+  const int num_trees = 4;
+  std::vector<MatrixXd> blocks_of_M(num_trees);
+  for (int t = 0; t < num_trees; ++t) {
+    blocks_of_M[t] = (t + 1.0) * MatrixXd::Identity(2, 2);
+  }
+  // Patch p couples tree p with tree (p + stride) % num_trees; the numeric
+  // values of the Jacobian blocks are scaled by `scale`.
+  auto make_triplets = [&](int num_patches, int stride, double scale) {
+    std::vector<BlockTriplet> triplets;
+    for (int p = 0; p < num_patches; ++p) {
+      const int t0 = std::min(p, (p + stride) % num_trees);
+      const int t1 = std::max(p, (p + stride) % num_trees);
+      const MatrixXd Jp = scale * (MatrixXd::Constant(2, 2, 0.1 * p) +
+                                   MatrixXd::Identity(2, 2));
+      triplets.push_back({p, t0, MatrixBlock<double>(Jp)});
+      triplets.push_back({p, t1, MatrixBlock<double>(MatrixXd(-Jp))});
+    }
+    return triplets;
+  };
+  const std::vector<MatrixXd> blocks_of_G(num_trees,
+                                          MatrixXd::Identity(2, 2));
+  const VectorXd b = VectorXd::LinSpaced(2 * num_trees, -1, 1);
+
+  BlockSparseSuperNodalSolver dut(num_trees, make_triplets(num_trees, 1, 1.0),
+                                  blocks_of_M);
+  dut.SetWeightMatrix(blocks_of_G);
+  ASSERT_TRUE(dut.Factor());
+
+  // Same sparsity pattern with different numeric values: the analysis is
+  // reused.
+  EXPECT_TRUE(
+      dut.Reset(num_trees, make_triplets(num_trees, 1, 2.0), blocks_of_M));
+  // The previous factorization is no longer available.
+  EXPECT_THROW(dut.Solve(b), std::exception);
+  dut.SetWeightMatrix(blocks_of_G);
+  BlockSparseSuperNodalSolver expected_same_pattern(
+      num_trees, make_triplets(num_trees, 1, 2.0), blocks_of_M);
+  expected_same_pattern.SetWeightMatrix(blocks_of_G);
+  EXPECT_EQ(dut.MakeFullMatrix(), expected_same_pattern.MakeFullMatrix());
+  ASSERT_TRUE(dut.Factor());
+  ASSERT_TRUE(expected_same_pattern.Factor());
+  EXPECT_EQ(dut.Solve(b), expected_same_pattern.Solve(b));
+
+  // Patches now couple different trees: the analysis is redone.
+  EXPECT_FALSE(
+      dut.Reset(num_trees, make_triplets(num_trees, 2, 1.0), blocks_of_M));
+  dut.SetWeightMatrix(blocks_of_G);
+  BlockSparseSuperNodalSolver expected_new_pattern(
+      num_trees, make_triplets(num_trees, 2, 1.0), blocks_of_M);
+  expected_new_pattern.SetWeightMatrix(blocks_of_G);
+  EXPECT_EQ(dut.MakeFullMatrix(), expected_new_pattern.MakeFullMatrix());
+  ASSERT_TRUE(dut.Factor());
+  ASSERT_TRUE(expected_new_pattern.Factor());
+  EXPECT_EQ(dut.Solve(b), expected_new_pattern.Solve(b));
+
+  // Incompatible arguments throw, as with the constructor.
+  EXPECT_THROW(dut.Reset(num_trees, make_triplets(num_trees, 1, 1.0),
+                         std::vector<MatrixXd>(num_trees,
+                                               MatrixXd::Identity(3, 3))),
+               std::exception);
+  // The failed Reset() left the previous system and its factorization intact.
+  EXPECT_EQ(dut.Solve(b), expected_new_pattern.Solve(b));
+}
+
 }  // namespace internal
 }  // namespace contact_solvers
 }  // namespace multibody
@@ -10,6 +10,7 @@
 
 #include "drake/common/default_scalars.h"
 #include "drake/common/eigen_types.h"
+#include "drake/common/parallelism.h"
 #include "drake/multibody/contact_solvers/block_sparse_lower_triangular_or_symmetric_matrix.h"
 #include "drake/multibody/fem/dirichlet_boundary_condition.h"
 #include "drake/multibody/fem/fem_plant_data.h"
@@ -200,6 +201,20 @@ class FemModel {
     return dirichlet_bc_;
   }
 
+  /** Sets the degree of parallelism used to evaluate the per-element
+   quantities of this model, i.e., the element data (deformation gradients and
+   constitutive model data), CalcResidual() and CalcTangentMatrix(), as well
+   as by FemSolver to factor the tangent matrix. The elements are only split
+   across threads when there are at least a few hundred of them per thread.
+   With more than one thread the element contributions are summed in a
+   different order, so the results may differ from the serial ones by
+   round-off (the factorization itself does not depend on the number of
+   threads). Defaults to Parallelism::None(). */
+  void set_parallelism(Parallelism parallelism) { parallelism_ = parallelism; }
+
+  /** Returns the degree of parallelism set with set_parallelism(). */
+  Parallelism parallelism() const { return parallelism_; }
+
   /** Returns true the equation G(x, v, a) = 0 (see class documentation)
    corresponding to this %FemModel is linear. */
   bool is_linear() const { return do_is_linear(); }
@@ -271,6 +286,7 @@ class FemModel {
   std::unique_ptr<internal::FemStateSystem<T>> fem_state_system_;
   /* The Dirichlet boundary condition that the model is subject to. */
   internal::DirichletBoundaryCondition<T> dirichlet_bc_;
+  Parallelism parallelism_{Parallelism::None()};
 };
 
 }  // namespace fem
@@ -10,6 +10,8 @@
 #include <vector>
 
 #include "drake/common/eigen_types.h"
+#include "drake/common/parallel_for.h"
+#include "drake/common/ssize.h"
 #include "drake/multibody/contact_solvers/block_sparse_lower_triangular_or_symmetric_matrix.h"
 #include "drake/multibody/fem/fem_element.h"
 #include "drake/multibody/fem/fem_indexes.h"
@@ -78,24 +80,42 @@ class FemModelImpl : public FemModel<typename Element::T> {
      the old data. */
     residual->setZero();
     constexpr int kDim = 3;
-    /* Scratch space to store the contribution to the residual from each
-     element. */
-    Vector<T, Element::num_dofs> element_residual;
     const std::vector<Data>& element_data =
         fem_state.template EvalElementData<Data>(element_data_index_);
-    for (int e = 0; e < num_elements(); ++e) {
-      /* residual = Ma-fₑ(x)-fᵥ(x, v)-fₑₓₜ. */
-      /* The Ma-fₑ(x)-fᵥ(x, v) term. */
-      elements_[e].CalcInverseDynamics(element_data[e], &element_residual);
-      /* The -fₑₓₜ term. */
-      elements_[e].AddScaledExternalForces(element_data[e], plant_data, -1.0,
-                                           &element_residual);
+    const bool parallel = NumThreads(num_elements()) > 1;
+    auto add_to_residual = [&](int e,
+                               const Vector<T, Element::num_dofs>& values) {
       const std::array<FemNodeIndex, Element::num_nodes>& element_node_indices =
           elements_[e].node_indices();
       for (int a = 0; a < Element::num_nodes; ++a) {
         const int global_node = element_node_indices[a];
         residual->template segment<kDim>(global_node * kDim) +=
-            element_residual.template segment<kDim>(a * kDim);
+            values.template segment<kDim>(a * kDim);
+      }
+    };
+    ForEachElementByColor([&](int e) {
+      /* Scratch space to store the contribution to the residual from each
+       element. */
+      Vector<T, Element::num_dofs> element_residual;
+      /* residual = Ma-fₑ(x)-fᵥ(x, v)-fₑₓₜ. */
+      /* The Ma-fₑ(x)-fᵥ(x, v) term. */
+      elements_[e].CalcInverseDynamics(element_data[e], &element_residual);
+      /* The -fₑₓₜ term. The force density fields are user code evaluated on
+       the plant context, which may not be safe to call concurrently, so in
+       parallel they are added in a separate serial pass below. */
+      if (!parallel) {
+        elements_[e].AddScaledExternalForces(element_data[e], plant_data, -1.0,
+                                             &element_residual);
+      }
+      add_to_residual(e, element_residual);
+    });
+    if (parallel) {
+      Vector<T, Element::num_dofs> element_residual;
+      for (int e = 0; e < num_elements(); ++e) {
+        element_residual.setZero();
+        elements_[e].AddScaledExternalForces(element_data[e], plant_data, -1.0,
+                                             &element_residual);
+        add_to_residual(e, element_residual);
       }
     }
   }
@@ -112,11 +132,11 @@ class FemModelImpl : public FemModel<typename Element::T> {
 
       const std::vector<Data>& element_data =
           fem_state.template EvalElementData<Data>(element_data_index_);
-      /* Scratch space to store the contribution to the tangent matrix from each
-       element. */
-      Eigen::Matrix<T, Element::num_dofs, Element::num_dofs>
-          element_tangent_matrix;
-      for (int e = 0; e < num_elements(); ++e) {
+      ForEachElementByColor([&](int e) {
+        /* Scratch space to store the contribution to the tangent matrix from
+         each element. */
+        Eigen::Matrix<T, Element::num_dofs, Element::num_dofs>
+            element_tangent_matrix;
         elements_[e].CalcTangentMatrix(element_data[e], weights,
                                        &element_tangent_matrix);
         const std::array<FemNodeIndex, Element::num_nodes>&
@@ -136,7 +156,7 @@ class FemModelImpl : public FemModel<typename Element::T> {
             }
           }
         }
-      }
+      });
     } else {
       unused(fem_state, weights, tangent_matrix);
       DRAKE_UNREACHABLE();
@@ -187,6 +207,9 @@ class FemModelImpl : public FemModel<typename Element::T> {
 
   void DeclareCacheEntries(
       internal::FemStateSystem<T>* fem_state_system) final {
+    /* This is called whenever elements are added, so it's also where the
+     element coloring is kept up to date. */
+    ColorElements();
     element_data_index_ =
         fem_state_system
             ->DeclareCacheEntry(
@@ -204,13 +227,89 @@ class FemModelImpl : public FemModel<typename Element::T> {
     DRAKE_DEMAND(data != nullptr);
     data->resize(num_elements());
     const FemState<T> fem_state(&(this->fem_state_system()), &context);
-    for (int i = 0; i < num_elements(); ++i) {
+    ForEachIndex(num_elements(), [&](int i) {
       (*data)[i] = elements_[i].ComputeData(fem_state);
+    });
+  }
+
+  /* Partitions the elements into colors such that no two elements of the same
+   color share a node, greedily in element order. */
+  void ColorElements() {
+    element_colors_.clear();
+    std::vector<std::vector<int>> node_colors(this->num_nodes());
+    for (int e = 0; e < num_elements(); ++e) {
+      const std::array<FemNodeIndex, Element::num_nodes>& element_node_indices =
+          elements_[e].node_indices();
+      auto is_free = [&](int color) {
+        for (const FemNodeIndex& node : element_node_indices) {
+          const std::vector<int>& colors = node_colors[node];
+          if (std::find(colors.begin(), colors.end(), color) != colors.end()) {
+            return false;
+          }
+        }
+        return true;
+      };
+      int color = 0;
+      while (!is_free(color)) ++color;
+      if (color == ssize(element_colors_)) element_colors_.emplace_back();
+      element_colors_[color].push_back(e);
+      for (const FemNodeIndex& node : element_node_indices) {
+        node_colors[node].push_back(color);
+      }
     }
   }
 
+  /* Returns the number of threads to split `count` independent element
+   computations across. */
+  int NumThreads(int count) const {
+    return std::max(1, std::min(this->parallelism().num_threads(),
+                                count / kMinElementsPerThread));
+  }
+
+  /* Calls `visit(i)` for each i in [0, count), across threads when
+   NumThreads(count) > 1. The calls must not read what other calls write. If
+   any of them throw, the exception of the first one (in serial order) is
+   rethrown. */
+  template <typename Visitor>
+  void ForEachIndex(int count, const Visitor& visit) const {
+    const int num_threads = NumThreads(count);
+    if (num_threads <= 1) {
+      for (int i = 0; i < count; ++i) {
+        visit(i);
+      }
+      return;
+    }
+    drake::internal::ParallelFor(Parallelism(num_threads), count, [&](int i) {
+      visit(i);
+    });
+  }
+
+  /* Calls `assemble(e)` for each element e, where `assemble` accumulates the
+   contribution of the element into the entries of its nodes. When serial, the
+   elements are visited in order. Otherwise, they are visited one color at a
+   time, so that the elements being assembled concurrently never share a
+   node, and thus never write to the same entries. */
+  template <typename Assembler>
+  void ForEachElementByColor(const Assembler& assemble) const {
+    if (NumThreads(num_elements()) <= 1) {
+      for (int e = 0; e < num_elements(); ++e) {
+        assemble(e);
+      }
+      return;
+    }
+    for (const std::vector<int>& color : element_colors_) {
+      ForEachIndex(ssize(color), [&](int k) { assemble(color[k]); });
+    }
+  }
+
+  /* The smallest number of elements given to each thread, since the work per
+   element is small compared to the cost of dispatching it. */
+  static constexpr int kMinElementsPerThread = 256;
+
   /* FemElements owned by this model. */
   std::vector<Element> elements_;
+  /* The indices of the elements of each color, see ColorElements(). */
+  std::vector<std::vector<int>> element_colors_;
   systems::CacheIndex element_data_index_;
 };
 
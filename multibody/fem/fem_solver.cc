@@ -105,6 +105,10 @@ int FemSolver<T>::SolveLinearModel(
     const std::unordered_set<int>& nonparticipating_vertices) {
   DRAKE_DEMAND(model_->is_linear());
   FemState<T>& state = *next_state_and_schur_complement_.state;
+  SchurComplement& schur_complement =
+      next_state_and_schur_complement_.schur_complement;
+  std::optional<std::unordered_set<int>>& schur_complement_vertices =
+      next_state_and_schur_complement_.linear_model_nonparticipating_vertices;
   VectorX<T>& b = scratch_.b;
   VectorX<T>& dz = scratch_.dz;
   Block3x3SparseSymmetricMatrix& tangent_matrix = *scratch_.tangent_matrix;
@@ -112,14 +116,20 @@ int FemSolver<T>::SolveLinearModel(
   model_->ApplyBoundaryCondition(&state);
   model_->CalcResidual(state, plant_data, &b);
   T residual_norm = b.norm();
-  model_->CalcTangentMatrix(state, integrator_->GetWeights(), &tangent_matrix);
-  next_state_and_schur_complement_.schur_complement =
-      contact_solvers::internal::SchurComplement(tangent_matrix,
-                                                 nonparticipating_vertices);
+  /* The tangent matrix of a linear model (with a fixed time step) is constant,
+   so the Schur complement, along with the factorization it holds, only needs
+   to be recomputed when the participating vertices change. */
+  if (schur_complement_vertices != nonparticipating_vertices) {
+    schur_complement_vertices.reset();
+    model_->CalcTangentMatrix(state, integrator_->GetWeights(),
+                              &tangent_matrix);
+    schur_complement.Update(tangent_matrix, nonparticipating_vertices);
+    schur_complement_vertices = nonparticipating_vertices;
+  }
   if (residual_norm < absolute_tolerance_) {
     return 0;
   }
-  dz = next_state_and_schur_complement_.schur_complement.Solve(-b);
+  dz = schur_complement.Solve(-b);
   integrator_->UpdateStateFromChangeInUnknowns(dz, &state);
   return 1;
 }
@@ -133,6 +143,7 @@ int FemSolver<T>::SolveNonlinearModel(
   VectorX<T>& dz = scratch_.dz;
   Block3x3SparseSymmetricMatrix& tangent_matrix = *scratch_.tangent_matrix;
   LinearSolver& linear_solver = scratch_.linear_solver;
+  linear_solver.set_parallelism(model_->parallelism());
   FemState<T>& state = *next_state_and_schur_complement_.state;
 
   model_->ApplyBoundaryCondition(&state);
@@ -170,11 +181,12 @@ int FemSolver<T>::SolveNonlinearModel(
     /* Solver failed to converge with max number of Newton iterations. */
     return -1;
   }
-  /* Build the Schur complement after the Newton iterations have converged. */
+  /* Build the Schur complement after the Newton iterations have converged.
+   Updating it in place reuses the symbolic factorization from the previous
+   time step when the nonparticipating vertices are unchanged. */
   model_->CalcTangentMatrix(state, integrator_->GetWeights(), &tangent_matrix);
-  next_state_and_schur_complement_.schur_complement =
-      contact_solvers::internal::SchurComplement(tangent_matrix,
-                                                 nonparticipating_vertices);
+  next_state_and_schur_complement_.schur_complement.Update(
+      tangent_matrix, nonparticipating_vertices);
   return iter;
 }
 
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <unordered_set>
 #include <utility>
 
@@ -126,11 +127,19 @@ class FemSolver {
       if (!model.is_compatible_with(*state)) {
         state = model.MakeFemState();
         schur_complement = contact_solvers::internal::SchurComplement{};
+        linear_model_nonparticipating_vertices.reset();
       }
     }
 
     copyable_unique_ptr<FemState<T>> state;
     contact_solvers::internal::SchurComplement schur_complement;
+    /* For linear models, the tangent matrix doesn't depend on the state and
+     `schur_complement` remains valid for as long as the nonparticipating
+     vertices don't change. Stores the nonparticipating vertices that
+     `schur_complement` was computed with in that case, and std::nullopt
+     otherwise. */
+    std::optional<std::unordered_set<int>>
+        linear_model_nonparticipating_vertices;
   };
 
   struct Scratch {
@@ -174,9 +183,9 @@ class FemSolver {
 
   /* For a linear FEM model, solves for the equilibrium FEM state z such that
    the residual is zero, i.e. b(z) = 0. In addition, computes the Schur
-   complement of the tangent matrix of the FEM model at that state z. The
-   results are written to the member variable
-   `next_state_and_schur_complement_`.
+   complement of the tangent matrix of the FEM model at that state z, unless
+   the one from the previous time step is still valid. The results are written
+   to the member variable `next_state_and_schur_complement_`.
    @param[in] plant_data
      Data from the MultibodyPlant that owns the FemModel associated with this
      FemSolver at construction.
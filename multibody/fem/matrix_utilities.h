@@ -47,7 +47,8 @@ double CalcConditionNumberOfInvertibleMatrix(
 
 /* Calculates the polar decomposition of a 3-by-3 matrix F = RS where R is a
  rotation matrix and S is a symmetric matrix. The decomposition is unique when F
- is non-singular.
+ is non-singular. For T = double and F with a positive determinant, this uses a
+ Newton iteration that is much cheaper than the SVD used otherwise.
  @tparam_nonsymbolic_scalar */
 template <typename T>
 void PolarDecompose(const Matrix3<T>& F, EigenPtr<Matrix3<T>> R,
@@ -4,6 +4,7 @@
 
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
 #include "drake/common/test_utilities/expect_throws_message.h"
+#include "drake/geometry/proximity/make_box_mesh.h"
 #include "drake/multibody/fem/linear_corotated_model.h"
 #include "drake/multibody/fem/linear_simplex_element.h"
 #include "drake/multibody/fem/simplex_gaussian_quadrature.h"
@@ -391,6 +392,82 @@ GTEST_TEST(FemModelTest, DirichletBoundaryCondition) {
   }
 }
 
+/* Verifies that the residual and the tangent matrix evaluated with more than
+ one thread match the serial ones, for a model large enough to be split. */
+GTEST_TEST(FemModelTest, Parallelism) {
+  constexpr int kNaturalDimension = 3;
+  constexpr int kSpatialDimension = 3;
+  constexpr int kQuadratureOrder = 1;
+  using QuadratureType =
+      fem::internal::SimplexGaussianQuadrature<kNaturalDimension,
+                                               kQuadratureOrder>;
+  constexpr int kNumQuads = QuadratureType::num_quadrature_points;
+  using IsoparametricElementType =
+      fem::internal::LinearSimplexElement<double, kNaturalDimension,
+                                          kSpatialDimension, kNumQuads>;
+  using ConstitutiveModelType =
+      fem::internal::LinearCorotatedModel<double, kNumQuads>;
+  using FemElementType =
+      fem::internal::VolumetricElement<IsoparametricElementType, QuadratureType,
+                                       ConstitutiveModelType>;
+  using FemModelType = fem::internal::VolumetricModel<FemElementType>;
+
+  const geometry::VolumeMesh<double> mesh =
+      geometry::internal::MakeBoxVolumeMesh<double>(geometry::Box(1, 1, 1),
+                                                    0.1);
+  auto make_model = [&mesh](Parallelism parallelism) {
+    auto model = make_unique<FemModelType>();
+    typename FemModelType::VolumetricBuilder builder(model.get());
+    builder.AddLinearTetrahedralElements(
+        mesh, ConstitutiveModelType(1e5, 0.4), 1000.0 /* density */,
+        DampingModel<double>(0.1, 0.01));
+    builder.Build();
+    model->set_parallelism(parallelism);
+    return model;
+  };
+  const unique_ptr<FemModelType> serial = make_model(Parallelism::None());
+  const unique_ptr<FemModelType> parallel = make_model(Parallelism(4));
+  ASSERT_GE(serial->num_elements(), 4 * 1000);
+  EXPECT_EQ(parallel->parallelism().num_threads(), 4);
+
+  /* An arbitrary deformed state. */
+  unique_ptr<FemState<double>> serial_state = serial->MakeFemState();
+  unique_ptr<FemState<double>> parallel_state = parallel->MakeFemState();
+  const int num_dofs = serial->num_dofs();
+  VectorXd q = serial_state->GetPositions();
+  for (int i = 0; i < num_dofs; ++i) {
+    q(i) += 0.01 * std::sin(i);
+  }
+  const VectorXd v = VectorXd::LinSpaced(num_dofs, -1.0, 1.0);
+  for (FemState<double>* state : {serial_state.get(), parallel_state.get()}) {
+    state->SetPositions(q);
+    state->SetVelocities(v);
+    state->SetAccelerations(-v);
+  }
+
+  const systems::LeafContext<double> dummy_context;
+  const FemPlantData<double> dummy_data{dummy_context, {}};
+  VectorXd serial_residual(num_dofs);
+  VectorXd parallel_residual(num_dofs);
+  serial->CalcResidual(*serial_state, dummy_data, &serial_residual);
+  parallel->CalcResidual(*parallel_state, dummy_data, &parallel_residual);
+  EXPECT_TRUE(CompareMatrices(parallel_residual, serial_residual,
+                              1e-12 * serial_residual.norm()));
+
+  const Vector3d weights(0.1, 0.2, 0.3);
+  auto serial_tangent = serial->MakeTangentMatrix();
+  auto parallel_tangent = parallel->MakeTangentMatrix();
+  serial->CalcTangentMatrix(*serial_state, weights, serial_tangent.get());
+  parallel->CalcTangentMatrix(*parallel_state, weights, parallel_tangent.get());
+  for (int j = 0; j < serial_tangent->block_cols(); ++j) {
+    for (int i : serial_tangent->block_row_indices(j)) {
+      const Eigen::Matrix3d& expected = serial_tangent->block(i, j);
+      EXPECT_TRUE(CompareMatrices(parallel_tangent->block(i, j), expected,
+                                  1e-12 * (1 + expected.norm())));
+    }
+  }
+}
+
 }  // namespace
 }  // namespace internal
 }  // namespace fem
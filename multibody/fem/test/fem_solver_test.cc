@@ -113,6 +113,24 @@ TYPED_TEST_P(FemSolverTest, AdvanceOneTimeStep) {
   EXPECT_TRUE(CompareMatrices(expected_schur_complement,
                               computed_schur_complement.get_D_complement(),
                               kTolerance, MatrixCompareType::relative));
+
+  /* The Schur complement from the previous time step may be reused (in part
+   or in full) by subsequent time steps. Verify that it stays up to date as
+   the nonparticipating vertices change. */
+  for (const std::unordered_set<int>& vertices :
+       {std::unordered_set<int>{0, 1}, std::unordered_set<int>{2},
+        std::unordered_set<int>{2}}) {
+    this->solver_.AdvanceOneTimeStep(*state0, dummy_data, vertices);
+    this->model_.CalcTangentMatrix(this->solver_.next_fem_state(),
+                                   this->integrator_.GetWeights(),
+                                   tangent_matrix.get());
+    const contact_solvers::internal::SchurComplement expected(*tangent_matrix,
+                                                              vertices);
+    EXPECT_TRUE(CompareMatrices(
+        expected.get_D_complement(),
+        this->solver_.next_schur_complement().get_D_complement(), kTolerance,
+        MatrixCompareType::relative));
+  }
 }
 
 /* Tests that AdvanceOneTimeStep for nonlinear models throws an error message if
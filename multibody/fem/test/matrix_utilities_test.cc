@@ -5,6 +5,7 @@
 #include "drake/common/eigen_types.h"
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
 #include "drake/math/autodiff_gradient.h"
+#include "drake/math/roll_pitch_yaw.h"
 #include "drake/math/rotation_matrix.h"
 
 namespace drake {
@@ -64,6 +65,44 @@ GTEST_TEST(MatrixUtilitiesTest, PolarDecompose) {
   EXPECT_TRUE(math::RotationMatrix<double>::IsValid(R, kTol));
 }
 
+/* For double, deformation gradients with positive determinant take the Newton
+ iteration path. Its results must agree with the SVD based decomposition used
+ for AutoDiffXd, and inverted deformation gradients must still produce a
+ proper rotation. */
+GTEST_TEST(MatrixUtilitiesTest, PolarDecomposeNewtonIteration) {
+  const Matrix3<double> R_expected =
+      math::RotationMatrix<double>(math::RollPitchYaw<double>(0.3, -0.2, 1.1))
+          .matrix();
+  Matrix3<double> S_expected;
+  // clang-format off
+  S_expected << 1.2, 0.1, -0.2,
+                0.1, 0.8,  0.05,
+               -0.2, 0.05, 1.5;
+  // clang-format on
+  const Matrix3<double> stretched = R_expected * S_expected;
+  const Matrix3<double> near_identity =
+      Matrix3<double>::Identity() + 1e-6 * MakeMatrix(3, 3);
+  Matrix3<double> inverted = stretched;
+  inverted.col(0) *= -1.0;
+
+  for (const Matrix3<double>& F : {stretched, near_identity, inverted}) {
+    Matrix3<double> R, S;
+    PolarDecompose<double>(F, &R, &S);
+    Matrix3<AutoDiffXd> R_svd, S_svd;
+    PolarDecompose<AutoDiffXd>(F.cast<AutoDiffXd>(), &R_svd, &S_svd);
+    const double tol = CalcTolerance(F);
+    EXPECT_TRUE(CompareMatrices(R, math::ExtractValue(R_svd), tol));
+    EXPECT_TRUE(CompareMatrices(S, math::ExtractValue(S_svd), tol));
+    EXPECT_TRUE(CompareMatrices(F, R * S, tol));
+    EXPECT_TRUE(math::RotationMatrix<double>::IsValid(R, kTol));
+  }
+
+  Matrix3<double> R, S;
+  PolarDecompose<double>(stretched, &R, &S);
+  EXPECT_TRUE(CompareMatrices(R, R_expected, CalcTolerance(stretched)));
+  EXPECT_TRUE(CompareMatrices(S, S_expected, CalcTolerance(stretched)));
+}
+
 GTEST_TEST(MatrixUtilitiesTest, AddScaledRotationalDerivative) {
   const Matrix3<AutoDiffXd> F = MakeAutoDiffMatrix(3, 3);
   Matrix3<AutoDiffXd> R, S;
@@ -23,7 +23,9 @@ DifferentialInverseKinematicsResult DoDifferentialInverseKinematics(
     const SpatialVelocity<double>& V_WE_desired,
     const DifferentialInverseKinematicsParameters& parameters,
     const std::optional<Eigen::Ref<const SparseMatrix<double>>>& N,
-    const std::optional<Eigen::Ref<const SparseMatrix<double>>>& Nplus) {
+    const std::optional<Eigen::Ref<const SparseMatrix<double>>>& Nplus,
+    DifferentialInverseKinematicsWorkspace* workspace) {
+  DRAKE_DEMAND(workspace != nullptr);
   const math::RotationMatrix<double> R_EW = X_WE.rotation().transpose();
   const SpatialVelocity<double> V_WE_E = R_EW * V_WE_desired;
 
@@ -46,13 +48,20 @@ DifferentialInverseKinematicsResult DoDifferentialInverseKinematics(
     }
   }
 
-  return DoDifferentialInverseKinematics(
+  return workspace->Solve(
       q_current, v_current, V_WE_E_with_flags.head(num_cart_constraints),
       J_WE_E_with_flags.topRows(num_cart_constraints), parameters, N, Nplus);
 }
 
 }  // namespace internal
 
+namespace {
+
+// The weight of the primary objective, 100*alpha.
+constexpr double kPrimaryObjectiveGain = 100;
+
+}  // namespace
+
 std::ostream& operator<<(std::ostream& os,
                          const DifferentialInverseKinematicsStatus value) {
   switch (value) {
@@ -123,6 +132,137 @@ DifferentialInverseKinematicsResult DoDifferentialInverseKinematics(
     const DifferentialInverseKinematicsParameters& parameters,
     const std::optional<Eigen::Ref<const SparseMatrix<double>>>& N,
     const std::optional<Eigen::Ref<const SparseMatrix<double>>>& Nplus) {
+  DifferentialInverseKinematicsWorkspace workspace;
+  return workspace.Solve(q_current, v_current, V, J, parameters, N, Nplus);
+}
+
+// The program solved by DifferentialInverseKinematicsWorkspace, along with the
+// costs and constraints whose coefficients change from one solve to the next.
+struct DifferentialInverseKinematicsWorkspace::Program {
+  // The properties of a problem that determine the structure of its program.
+  // Any change to these requires a new program.
+  struct Structure {
+    bool operator==(const Structure&) const = default;
+
+    int num_positions{};
+    int num_velocities{};
+    int num_cart_constraints{};
+    bool has_centering_cost{};
+    bool has_position_limits{};
+    bool has_N{};
+    bool has_velocity_limits{};
+    bool has_acceleration_limits{};
+    std::vector<const solvers::LinearConstraint*> linear_velocity_constraints;
+  };
+
+  explicit Program(const Structure& structure_in);
+
+  const Structure structure;
+  solvers::MathematicalProgram prog;
+  solvers::VectorXDecisionVariable v_next;
+  solvers::VectorDecisionVariable<1> alpha;
+  // These are null when the structure does not call for them.
+  std::shared_ptr<solvers::QuadraticCost> centering_cost;
+  std::shared_ptr<solvers::LinearEqualityConstraint> velocity_constraint;
+  std::shared_ptr<solvers::LinearConstraint> position_limits;
+  std::shared_ptr<solvers::BoundingBoxConstraint> velocity_limits;
+  std::shared_ptr<solvers::LinearConstraint> acceleration_limits;
+  // The solution of the most recent successful quadratic program.
+  std::optional<Eigen::VectorXd> warm_start;
+};
+
+DifferentialInverseKinematicsWorkspace::Program::Program(
+    const Structure& structure_in)
+    : structure(structure_in) {
+  // The coefficients and bounds are all placeholders, until Solve() updates
+  // them for each problem.
+  const int nq = structure.num_positions;
+  const int nv = structure.num_velocities;
+  const int num_cart = structure.num_cart_constraints;
+  v_next = prog.NewContinuousVariables(nv, "v_next");
+  alpha = prog.NewContinuousVariables<1>("alpha");
+
+  // 100*alpha
+  prog.AddLinearCost(-Vector1d{kPrimaryObjectiveGain}, 0.0, alpha);
+
+  // |P⋅(v_next - N⁺(q)⋅K⋅(q_nominal - q_current))|²
+  if (structure.has_centering_cost) {
+    centering_cost =
+        prog.AddQuadraticCost(Eigen::MatrixXd::Zero(nv, nv),
+                              Eigen::VectorXd::Zero(nv), 0.0, v_next, true)
+            .evaluator();
+  }
+
+  // J * v_next = alpha * V
+  if (num_cart > 0) {
+    velocity_constraint =
+        prog.AddLinearEqualityConstraint(
+                Eigen::MatrixXd::Zero(num_cart, nv + 1),
+                Eigen::VectorXd::Zero(num_cart), {v_next, alpha})
+            .evaluator();
+  }
+
+  // 0 <= alpha <= 1
+  prog.AddBoundingBoxConstraint(0, 1, alpha);
+
+  // joint_lim_min <= q_current + N⋅v_next⋅dt <= joint_lim_max
+  if (structure.has_position_limits) {
+    if (structure.has_N) {
+      // We cannot currently use prog.AddLinearConstraint with a SparseMatrix.
+      position_limits = std::make_shared<solvers::LinearConstraint>(
+          SparseMatrix<double>(nq, nv), Eigen::VectorXd::Zero(nq),
+          Eigen::VectorXd::Zero(nq));
+      prog.AddConstraint(position_limits, v_next);
+    } else {
+      position_limits =
+          prog.AddBoundingBoxConstraint(Eigen::VectorXd::Zero(nv),
+                                        Eigen::VectorXd::Zero(nv), v_next)
+              .evaluator();
+    }
+  }
+
+  // joint_vel_lim_min <= v_next <= joint_vel_lim_max
+  if (structure.has_velocity_limits) {
+    velocity_limits =
+        prog.AddBoundingBoxConstraint(Eigen::VectorXd::Zero(nv),
+                                      Eigen::VectorXd::Zero(nv), v_next)
+            .evaluator();
+  }
+
+  // joint_accel_lim_min <= (v_next - v_current)/dt <= joint_accel_lim_max
+  if (structure.has_acceleration_limits) {
+    acceleration_limits =
+        prog.AddLinearConstraint(Eigen::MatrixXd::Identity(nv, nv),
+                                 Eigen::VectorXd::Zero(nv),
+                                 Eigen::VectorXd::Zero(nv), v_next)
+            .evaluator();
+  }
+}
+
+DifferentialInverseKinematicsWorkspace::
+    DifferentialInverseKinematicsWorkspace() = default;
+
+DifferentialInverseKinematicsWorkspace::DifferentialInverseKinematicsWorkspace(
+    const DifferentialInverseKinematicsWorkspace&) {}
+
+DifferentialInverseKinematicsWorkspace&
+DifferentialInverseKinematicsWorkspace::operator=(
+    const DifferentialInverseKinematicsWorkspace&) {
+  program_.reset();
+  return *this;
+}
+
+DifferentialInverseKinematicsWorkspace::
+    ~DifferentialInverseKinematicsWorkspace() = default;
+
+DifferentialInverseKinematicsResult DifferentialInverseKinematicsWorkspace::
+    Solve(const Eigen::Ref<const VectorX<double>>& q_current,
+          const Eigen::Ref<const VectorX<double>>& v_current,
+          const Eigen::Ref<const VectorX<double>>& V,
+          const Eigen::Ref<const MatrixX<double>>& J,
+          const DifferentialInverseKinematicsParameters& parameters,
+          const std::optional<Eigen::Ref<const SparseMatrix<double>>>& N,
+          const std::optional<Eigen::Ref<const SparseMatrix<double>>>& Nplus) {
   const int num_positions = parameters.get_num_positions();
   const int num_velocities = parameters.get_num_velocities();
   const double dt = parameters.get_time_step();
@@ -131,112 +271,115 @@ DifferentialInverseKinematicsResult DoDifferentialInverseKinematics(
   DRAKE_DEMAND(v_current.size() == num_velocities);
   DRAKE_DEMAND(J.rows() == num_cart_constraints);
   DRAKE_DEMAND(J.cols() == num_velocities);
-  const auto identity_num_positions =
-      MatrixX<double>::Identity(num_positions, num_positions);
 
-  solvers::MathematicalProgram prog;
-  bool quadratic_cost = false;
-  solvers::VectorXDecisionVariable v_next =
-      prog.NewContinuousVariables(num_velocities, "v_next");
-  solvers::VectorDecisionVariable<1> alpha =
-      prog.NewContinuousVariables<1>("alpha");
-
-  // 100*alpha
-  const double kPrimaryObjectiveGain = 100;
-  prog.AddLinearCost(-Vector1d{kPrimaryObjectiveGain}, 0.0, alpha);
-
-  // |P⋅(v_next - N⁺(q)⋅K⋅(q_nominal - q_current))|²
+  // The secondary objective acts in the nullspace of J, which only exists when
+  // J is not full column rank.
   const Eigen::FullPivLU<MatrixX<double>> lu(J);
-  if (lu.rank() < num_velocities) {
-    const Eigen::MatrixXd P = lu.kernel().transpose();
+  const bool has_centering_cost = lu.rank() < num_velocities;
+  if (has_centering_cost) {
     if (Nplus) {
       DRAKE_DEMAND(Nplus->rows() == num_velocities);
       DRAKE_DEMAND(Nplus->cols() == num_positions);
-      prog.Add2NormSquaredCost(
-          P,
-          P * (*Nplus) * parameters.get_joint_centering_gain() *
-              (parameters.get_nominal_joint_position() - q_current),
-          v_next);
     } else if (num_positions != num_velocities) {
       throw std::runtime_error(
           "You must pass the Nplus matrix to DoDifferentialInverseKinematics "
           "when J is not full column rank and num_positions != "
           "num_velocities.");
-    } else {
-      prog.Add2NormSquaredCost(
-          P,
-          P * parameters.get_joint_centering_gain() *
-              (parameters.get_nominal_joint_position() - q_current),
-          v_next);
     }
-    quadratic_cost = true;
   }
-
-  // J * v_next = alpha * V
-  if (V.size() > 0) {
-    MatrixX<double> A(num_cart_constraints, num_velocities + 1);
-    A.leftCols(num_velocities) = J;
-    A.rightCols(1) = -V;
-    prog.AddLinearEqualityConstraint(
-        A, VectorX<double>::Zero(num_cart_constraints), {v_next, alpha});
-  }
-
-  // 0 <= alpha <= 1
-  prog.AddBoundingBoxConstraint(0, 1, alpha);
-
-  // joint_lim_min <= q_current + N⋅v_next⋅dt <= joint_lim_max
-  if (parameters.get_joint_position_limits()) {
-    const Eigen::VectorXd lb =
-        (parameters.get_joint_position_limits()->first - q_current) / dt;
-    const Eigen::VectorXd ub =
-        (parameters.get_joint_position_limits()->second - q_current) / dt;
+  const auto& position_limits = parameters.get_joint_position_limits();
+  if (position_limits) {
     if (N) {
       DRAKE_DEMAND(N->rows() == num_positions);
       DRAKE_DEMAND(N->cols() == num_velocities);
-      // We cannot currently use prog.AddLinearConstraint with a SparseMatrix.
-      prog.AddConstraint(
-          std::make_shared<solvers::LinearConstraint>(*N, lb, ub), v_next);
     } else if (num_positions != num_velocities) {
       throw std::runtime_error(
           "You must pass the N matrix to DoDifferentialInverseKinematics "
           "when you have joint position limits and num_positions != "
           "num_velocities.");
-    } else {
-      prog.AddBoundingBoxConstraint(lb, ub, v_next);
     }
   }
 
-  // joint_vel_lim_min <= v_next <= joint_vel_lim_max
+  Program::Structure structure{
+      .num_positions = num_positions,
+      .num_velocities = num_velocities,
+      .num_cart_constraints = num_cart_constraints,
+      .has_centering_cost = has_centering_cost,
+      .has_position_limits = position_limits.has_value(),
+      .has_N = position_limits.has_value() && N.has_value(),
+      .has_velocity_limits =
+          parameters.get_joint_velocity_limits().has_value(),
+      .has_acceleration_limits =
+          parameters.get_joint_acceleration_limits().has_value()};
+  for (const auto& constraint : parameters.get_linear_velocity_constraints()) {
+    structure.linear_velocity_constraints.push_back(constraint.get());
+  }
+  if (program_ == nullptr || program_->structure != structure) {
+    program_ = std::make_unique<Program>(structure);
+    // additional linear velocity constraints
+    for (const auto& constraint :
+         parameters.get_linear_velocity_constraints()) {
+      program_->prog.AddConstraint(solvers::Binding<solvers::LinearConstraint>(
+          constraint, program_->v_next));
+    }
+  }
+  Program& program = *program_;
+
+  // Update the coefficients of the program for this problem.
+  if (has_centering_cost) {
+    const Eigen::MatrixXd P = lu.kernel().transpose();
+    const Eigen::VectorXd b =
+        Nplus ? Eigen::VectorXd(
+                    P * (*Nplus) * parameters.get_joint_centering_gain() *
+                    (parameters.get_nominal_joint_position() - q_current))
+              : Eigen::VectorXd(
+                    P * parameters.get_joint_centering_gain() *
+                    (parameters.get_nominal_joint_position() - q_current));
+    // This is the expansion of |P⋅v_next - b|², as in Add2NormSquaredCost.
+    program.centering_cost->UpdateCoefficients(
+        2 * P.transpose() * P, -2 * P.transpose() * b, b.dot(b), true);
+  }
+  if (num_cart_constraints > 0) {
+    MatrixX<double> A(num_cart_constraints, num_velocities + 1);
+    A.leftCols(num_velocities) = J;
+    A.rightCols(1) = -V;
+    program.velocity_constraint->UpdateCoefficients(
+        A, VectorX<double>::Zero(num_cart_constraints));
+  }
+  if (position_limits) {
+    const Eigen::VectorXd lb = (position_limits->first - q_current) / dt;
+    const Eigen::VectorXd ub = (position_limits->second - q_current) / dt;
+    if (N) {
+      program.position_limits->UpdateCoefficients(SparseMatrix<double>(*N), lb,
+                                                  ub);
+    } else {
+      program.position_limits->set_bounds(lb, ub);
+    }
+  }
   if (parameters.get_joint_velocity_limits()) {
-    prog.AddBoundingBoxConstraint(
+    program.velocity_limits->set_bounds(
         parameters.get_joint_velocity_limits()->first,
-        parameters.get_joint_velocity_limits()->second, v_next);
+        parameters.get_joint_velocity_limits()->second);
   }
-
-  // joint_accel_lim_min <= (v_next - v_current)/dt <= joint_accel_lim_max
   if (parameters.get_joint_acceleration_limits()) {
-    prog.AddLinearConstraint(
-        identity_num_positions,
+    program.acceleration_limits->set_bounds(
         parameters.get_joint_acceleration_limits()->first * dt + v_current,
-        parameters.get_joint_acceleration_limits()->second * dt + v_current,
-        v_next);
-  }
-
-  // additional linear velocity constraints
-  for (const auto& constraint : parameters.get_linear_velocity_constraints()) {
-    prog.AddConstraint(
-        solvers::Binding<solvers::LinearConstraint>(constraint, v_next));
+        parameters.get_joint_acceleration_limits()->second * dt + v_current);
   }
 
   // Solve
   solvers::MathematicalProgramResult result;
-
-  if (quadratic_cost) {
+  if (has_centering_cost) {
     solvers::OsqpSolver solver;
-    result = solver.Solve(prog, {}, {});
+    solver.Solve(program.prog, program.warm_start, {}, &result);
+    if (result.is_success()) {
+      program.warm_start = result.get_x_val();
+    } else {
+      program.warm_start.reset();
+    }
   } else {
     solvers::ClpSolver solver;
-    result = solver.Solve(prog, {}, {});
+    solver.Solve(program.prog, {}, {}, &result);
   }
 
   if (!result.is_success()) {
@@ -244,23 +387,26 @@ DifferentialInverseKinematicsResult DoDifferentialInverseKinematics(
             DifferentialInverseKinematicsStatus::kNoSolutionFound};
   }
 
-  const double alpha_sol = result.GetSolution(alpha[0]);
+  const double alpha_sol = result.GetSolution(program.alpha[0]);
   if (alpha_sol < parameters.get_maximum_scaling_to_report_stuck()) {
     // The computed velocity is small compared to the desired.
-    return {result.GetSolution(v_next),
+    return {result.GetSolution(program.v_next),
             DifferentialInverseKinematicsStatus::kStuck};
   }
 
-  return {result.GetSolution(v_next),
+  return {result.GetSolution(program.v_next),
           DifferentialInverseKinematicsStatus::kSolutionFound};
 }
 
-DifferentialInverseKinematicsResult DoDifferentialInverseKinematics(
+namespace {
+
+DifferentialInverseKinematicsResult DoDifferentialInverseKinematicsImpl(
     const MultibodyPlant<double>& plant,
     const systems::Context<double>& context,
     const Vector6<double>& V_WE_desired,
     const Frame<double>& frame_E,
-    const DifferentialInverseKinematicsParameters& parameters) {
+    const DifferentialInverseKinematicsParameters& parameters,
+    DifferentialInverseKinematicsWorkspace* workspace) {
   const math::RigidTransform<double> X_WE =
       plant.CalcRelativeTransform(context, plant.world_frame(), frame_E);
   MatrixX<double> J_WE(6, plant.num_velocities());
@@ -280,7 +426,20 @@ DifferentialInverseKinematicsResult DoDifferentialInverseKinematics(
   }
   return internal::DoDifferentialInverseKinematics(
       plant.GetPositions(context), plant.GetVelocities(context), X_WE, J_WE,
-      SpatialVelocity<double>(V_WE_desired), parameters, N, Nplus);
+      SpatialVelocity<double>(V_WE_desired), parameters, N, Nplus, workspace);
+}
+
+}  // namespace
+
+DifferentialInverseKinematicsResult DoDifferentialInverseKinematics(
+    const MultibodyPlant<double>& plant,
+    const systems::Context<double>& context,
+    const Vector6<double>& V_WE_desired,
+    const Frame<double>& frame_E,
+    const DifferentialInverseKinematicsParameters& parameters) {
+  DifferentialInverseKinematicsWorkspace workspace;
+  return DoDifferentialInverseKinematicsImpl(plant, context, V_WE_desired,
+                                             frame_E, parameters, &workspace);
 }
 
 DifferentialInverseKinematicsResult DoDifferentialInverseKinematics(
@@ -289,6 +448,20 @@ DifferentialInverseKinematicsResult DoDifferentialInverseKinematics(
     const math::RigidTransform<double>& X_WE_desired,
     const Frame<double>& frame_E,
     const DifferentialInverseKinematicsParameters& parameters) {
+  DifferentialInverseKinematicsWorkspace workspace;
+  return internal::DoDifferentialInverseKinematics(
+      plant, context, X_WE_desired, frame_E, parameters, &workspace);
+}
+
+namespace internal {
+
+DifferentialInverseKinematicsResult DoDifferentialInverseKinematics(
+    const MultibodyPlant<double>& plant,
+    const systems::Context<double>& context,
+    const math::RigidTransform<double>& X_WE_desired,
+    const Frame<double>& frame_E,
+    const DifferentialInverseKinematicsParameters& parameters,
+    DifferentialInverseKinematicsWorkspace* workspace) {
   const math::RigidTransform<double> X_WE =
       plant.EvalBodyPoseInWorld(context, frame_E.body()) *
       frame_E.CalcPoseInBodyFrame(context);
@@ -311,9 +484,10 @@ DifferentialInverseKinematicsResult DoDifferentialInverseKinematics(
                 parameters.get_end_effector_translational_velocity_limits()
                     ->second);
   }
-  return DoDifferentialInverseKinematics(plant, context, V_WE_desired, frame_E,
-                                         parameters);
+  return DoDifferentialInverseKinematicsImpl(plant, context, V_WE_desired,
+                                             frame_E, parameters, workspace);
 }
 
+}  // namespace internal
 }  // namespace multibody
 }  // namespace drake
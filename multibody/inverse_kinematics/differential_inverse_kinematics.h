@@ -355,6 +355,55 @@ DifferentialInverseKinematicsResult DoDifferentialInverseKinematics(
     const std::optional<Eigen::Ref<const Eigen::SparseMatrix<double>>>& Nplus =
         std::nullopt);
 
+/**
+ * A persistent workspace for solving a sequence of differential inverse
+ * kinematics problems, e.g., one per period of a control loop.
+ *
+ * DoDifferentialInverseKinematics() builds (and discards) a new
+ * MathematicalProgram on every call. This workspace instead keeps the program
+ * between calls, and only updates the Jacobian, the desired velocity, the
+ * limits and the nominal-posture cost in place. Each quadratic program is also
+ * warm-started from the previous solution. The program is only rebuilt when
+ * its structure changes, i.e., when the problem sizes change, when a limit is
+ * set or cleared in the parameters, when the additional linear velocity
+ * constraints change, or when J gains or loses full column rank (which
+ * switches the secondary objective on or off).
+ *
+ * Copies of a workspace do not share (or copy) its program; each copy builds
+ * its own on first use.
+ *
+ * @ingroup planning_kinematics
+ */
+class DifferentialInverseKinematicsWorkspace {
+ public:
+  DifferentialInverseKinematicsWorkspace();
+  DifferentialInverseKinematicsWorkspace(
+      const DifferentialInverseKinematicsWorkspace&);
+  DifferentialInverseKinematicsWorkspace& operator=(
+      const DifferentialInverseKinematicsWorkspace&);
+  ~DifferentialInverseKinematicsWorkspace();
+
+  /**
+   * Solves the same problem as DoDifferentialInverseKinematics(q_current,
+   * v_current, V, J, parameters, N, Nplus), with the same requirements on the
+   * arguments.
+   */
+  DifferentialInverseKinematicsResult Solve(
+      const Eigen::Ref<const VectorX<double>>& q_current,
+      const Eigen::Ref<const VectorX<double>>& v_current,
+      const Eigen::Ref<const VectorX<double>>& V,
+      const Eigen::Ref<const MatrixX<double>>& J,
+      const DifferentialInverseKinematicsParameters& parameters,
+      const std::optional<Eigen::Ref<const Eigen::SparseMatrix<double>>>& N =
+          std::nullopt,
+      const std::optional<Eigen::Ref<const Eigen::SparseMatrix<double>>>&
+          Nplus = std::nullopt);
+
+ private:
+  struct Program;
+  std::unique_ptr<Program> program_;
+};
+
 // TODO(russt): V_WE_desired should be of type SpatialVelocity.
 /**
  * A wrapper over DoDifferentialInverseKinematics(q_current, v_current, V, J,
@@ -419,6 +468,16 @@ DifferentialInverseKinematicsResult DoDifferentialInverseKinematics(
         std::nullopt,
     const std::optional<Eigen::Ref<const MatrixX<double>>>& Nplus =
         std::nullopt);
+
+// Like the public DoDifferentialInverseKinematics() that tracks a pose, but
+// solves using the given `workspace`.
+DifferentialInverseKinematicsResult DoDifferentialInverseKinematics(
+    const MultibodyPlant<double>& robot,
+    const systems::Context<double>& context,
+    const math::RigidTransform<double>& X_WE_desired,
+    const Frame<double>& frame_E,
+    const DifferentialInverseKinematicsParameters& parameters,
+    DifferentialInverseKinematicsWorkspace* workspace);
 }  // namespace internal
 #endif
 
@@ -59,6 +59,14 @@ DifferentialInverseKinematicsIntegrator::
   robot_context_cache_entry_ = &this->DeclareCacheEntry(
       "robot context", *robot_context,
       &DifferentialInverseKinematicsIntegrator::UpdateRobotContext);
+
+  // We keep the differential IK program as scratch, so that each step only
+  // updates it rather than building a new one.
+  workspace_cache_entry_ = &this->DeclareCacheEntry(
+      "differential IK workspace",
+      systems::ValueProducer(DifferentialInverseKinematicsWorkspace(),
+                             &systems::ValueProducer::NoopCalc),
+      {this->nothing_ticket()});
 }
 
 void DifferentialInverseKinematicsIntegrator::SetPositions(
@@ -115,8 +123,13 @@ systems::EventStatus DifferentialInverseKinematicsIntegrator::Integrate(
 
   const Context<double>& robot_context =
       robot_context_cache_entry_->Eval<Context<double>>(context);
-  DifferentialInverseKinematicsResult result = DoDifferentialInverseKinematics(
-      robot_, robot_context, X_WE_desired, frame_E_, parameters_);
+  DifferentialInverseKinematicsWorkspace& workspace =
+      workspace_cache_entry_->get_mutable_cache_entry_value(context)
+          .GetMutableValueOrThrow<DifferentialInverseKinematicsWorkspace>();
+  DifferentialInverseKinematicsResult result =
+      internal::DoDifferentialInverseKinematics(robot_, robot_context,
+                                                X_WE_desired, frame_E_,
+                                                parameters_, &workspace);
 
   const auto& positions = robot_.GetPositions(robot_context);
   if (result.status == DifferentialInverseKinematicsStatus::kNoSolutionFound) {
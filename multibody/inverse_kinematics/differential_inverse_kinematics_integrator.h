@@ -124,6 +124,7 @@ class DifferentialInverseKinematicsIntegrator
   DifferentialInverseKinematicsParameters parameters_;
   const double time_step_{0.0};
   const systems::CacheEntry* robot_context_cache_entry_{};
+  const systems::CacheEntry* workspace_cache_entry_{};
   systems::InputPortIndex X_WE_desired_index_{};
   systems::InputPortIndex robot_state_index_{};
   systems::InputPortIndex use_robot_state_index_{};
@@ -1,15 +1,20 @@
 #include "drake/multibody/inverse_kinematics/global_inverse_kinematics.h"
 
+#include <algorithm>
 #include <array>
 #include <limits>
+#include <memory>
 #include <stack>
 #include <string>
 
 #include "drake/common/eigen_types.h"
+#include "drake/common/parallel_for.h"
 #include "drake/common/scope_exit.h"
+#include "drake/common/text_logging.h"
 #include "drake/math/roll_pitch_yaw.h"
 #include "drake/math/rotation_matrix.h"
 #include "drake/multibody/tree/revolute_joint.h"
+#include "drake/solvers/choose_best_solver.h"
 #include "drake/solvers/rotation_constraint.h"
 #include "drake/solvers/solve.h"
 
@@ -435,10 +440,42 @@ GlobalInverseKinematics::AddWorldOrientationConstraint(
   // trace(R_e) = 2 * cos(θ) + 1, where θ is the rotation angle between
   // desired orientation and the current orientation. Thus the constraint is
   // 2 * cos(angle_tol) + 1 <= trace(R_e) <= 3
-  Matrix3<Expression> rotation_matrix_err =
-      desired_orientation.toRotationMatrix() * R_WB_[body_idx].transpose();
-  double lb = angle_tol < M_PI ? 2 * cos(angle_tol) + 1 : -1;
-  return prog_.AddLinearConstraint(rotation_matrix_err.trace(), lb, 3);
+  // trace(R_e) = ∑ᵢⱼ R_desired(i, j) * R_WB(i, j), which is linear in the
+  // entries of R_WB. The constraint binds all nine of them (even those whose
+  // coefficient is zero), so that UpdateWorldOrientationConstraint() can swap
+  // in any other desired orientation.
+  const VectorDecisionVariable<9> R_WB_flat =
+      Eigen::Map<const VectorDecisionVariable<9>>(R_WB_[body_idx].data());
+  const auto binding = prog_.AddLinearConstraint(
+      Eigen::RowVectorXd::Zero(9), -1, 3, R_WB_flat);
+  UpdateWorldOrientationConstraint(binding, desired_orientation, angle_tol);
+  return binding;
+}
+
+void GlobalInverseKinematics::UpdateWorldOrientationConstraint(
+    const solvers::Binding<solvers::LinearConstraint>& binding,
+    const Eigen::Quaterniond& desired_orientation, double angle_tol) {
+  const bool binds_a_rotation_matrix = std::any_of(
+      R_WB_.begin() + 1, R_WB_.end(),
+      [&binding](const solvers::MatrixDecisionVariable<3, 3>& R_WB) {
+        return binding.variables().size() == 9 &&
+               std::equal(R_WB.data(), R_WB.data() + 9,
+                          binding.variables().data(),
+                          [](const symbolic::Variable& a,
+                             const symbolic::Variable& b) {
+                            return a.equal_to(b);
+                          });
+      });
+  if (!binds_a_rotation_matrix) {
+    throw std::runtime_error(
+        "UpdateWorldOrientationConstraint(): the binding was not returned by "
+        "AddWorldOrientationConstraint().");
+  }
+  const Matrix3d R_desired = desired_orientation.toRotationMatrix();
+  const double lb = angle_tol < M_PI ? 2 * cos(angle_tol) + 1 : -1;
+  binding.evaluator()->UpdateCoefficients(
+      Eigen::Map<const Eigen::RowVectorXd>(R_desired.data(), 9), Vector1d(lb),
+      Vector1d(3));
 }
 
 void GlobalInverseKinematics::AddPostureCost(
@@ -892,5 +929,113 @@ void GlobalInverseKinematics::SetInitialGuess(
   prog_.SetInitialGuessForAllVariables(result.GetSolution());
 }
 
+namespace {
+
+// One GlobalInverseKinematics program, whose target pose can be changed
+// between solves.
+class GlobalSweepProgram {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(GlobalSweepProgram)
+
+  GlobalSweepProgram(const MultibodyPlant<double>& plant, BodyIndex body_index,
+                     const RigidTransformd& X_BQ,
+                     const GlobalInverseKinematicsSweepOptions& options)
+      : global_ik_(plant, options.global_ik_options),
+        R_QB_(X_BQ.rotation().inverse()),
+        position_tolerance_(options.position_tolerance),
+        orientation_tolerance_(options.orientation_tolerance),
+        position_(global_ik_.AddWorldPositionConstraint(
+            body_index, X_BQ.translation(), Vector3d::Zero(),
+            Vector3d::Zero())),
+        orientation_(global_ik_.AddWorldOrientationConstraint(
+            body_index, Eigen::Quaterniond::Identity(),
+            orientation_tolerance_)) {}
+
+  const GlobalInverseKinematics& global_ik() const { return global_ik_; }
+
+  void SetTarget(const RigidTransformd& X_WQ) {
+    const Vector3d tolerance = Vector3d::Constant(position_tolerance_);
+    position_.evaluator()->set_bounds(X_WQ.translation() - tolerance,
+                                      X_WQ.translation() + tolerance);
+    global_ik_.UpdateWorldOrientationConstraint(
+        orientation_, (X_WQ.rotation() * R_QB_).ToQuaternion(),
+        orientation_tolerance_);
+  }
+
+ private:
+  GlobalInverseKinematics global_ik_;
+  const math::RotationMatrixd R_QB_;
+  const double position_tolerance_;
+  const double orientation_tolerance_;
+  const solvers::Binding<solvers::LinearConstraint> position_;
+  const solvers::Binding<solvers::LinearConstraint> orientation_;
+};
+
+}  // namespace
+
+std::vector<std::optional<Eigen::VectorXd>> SolveGlobalInverseKinematicsSweep(
+    const MultibodyPlant<double>& plant, BodyIndex body_index,
+    const RigidTransformd& X_BQ,
+    const std::vector<RigidTransformd>& X_WQ_targets,
+    const GlobalInverseKinematicsSweepOptions& options) {
+  DRAKE_THROW_UNLESS(body_index > 0 && body_index < plant.num_bodies());
+  DRAKE_THROW_UNLESS(options.position_tolerance >= 0);
+  DRAKE_THROW_UNLESS(options.orientation_tolerance >= 0);
+
+  const int num_targets = X_WQ_targets.size();
+  std::vector<std::optional<Eigen::VectorXd>> results(num_targets);
+  if (num_targets == 0) {
+    return results;
+  }
+
+  // The first chunk's program is built up front to choose the solver, which
+  // is the same for every chunk (only the bounds differ between targets).
+  auto first_program = std::make_unique<GlobalSweepProgram>(
+      plant, body_index, X_BQ, options);
+  const solvers::SolverId solver_id =
+      solvers::ChooseBestSolver(first_program->global_ik().prog());
+  const int num_chunks =
+      solvers::internal::IsThreadSafe(solver_id)
+          ? std::clamp(options.parallelism.num_threads(), 1, num_targets)
+          : 1;
+  drake::log()->debug(
+      "SolveGlobalInverseKinematicsSweep will solve {} targets with {} using "
+      "{} threads",
+      num_targets, solver_id, num_chunks);
+
+  // Each chunk is a contiguous range of targets, so that the warm start for
+  // each target is the solution of its predecessor.
+  auto solve_chunk = [&](int chunk) {
+    std::unique_ptr<GlobalSweepProgram> program =
+        (chunk == 0) ? std::move(first_program)
+                     : std::make_unique<GlobalSweepProgram>(
+                           plant, body_index, X_BQ, options);
+    std::unique_ptr<solvers::SolverInterface> solver =
+        solvers::MakeSolver(solver_id);
+    const int begin = static_cast<int64_t>(num_targets) * chunk / num_chunks;
+    const int end =
+        static_cast<int64_t>(num_targets) * (chunk + 1) / num_chunks;
+    std::optional<Eigen::VectorXd> initial_guess;
+    solvers::MathematicalProgramResult result;
+    for (int i = begin; i < end; ++i) {
+      program->SetTarget(X_WQ_targets[i]);
+      solver->Solve(program->global_ik().prog(), initial_guess,
+                    options.solver_options, &result);
+      initial_guess.reset();
+      if (result.is_success()) {
+        results[i] =
+            program->global_ik().ReconstructGeneralizedPositionSolution(
+                result);
+        if (options.warm_start) {
+          initial_guess = result.GetSolution();
+        }
+      }
+    }
+  };
+  drake::internal::ParallelFor(Parallelism(num_chunks), num_chunks,
+                               solve_chunk);
+  return results;
+}
+
 }  // namespace multibody
 }  // namespace drake
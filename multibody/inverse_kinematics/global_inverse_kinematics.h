@@ -1,14 +1,17 @@
 #pragma once
 
 #include <map>
+#include <optional>
 #include <unordered_set>
 #include <vector>
 
+#include "drake/common/parallelism.h"
 #include "drake/math/rigid_transform.h"
 #include "drake/multibody/plant/multibody_plant.h"
 #include "drake/solvers/mathematical_program.h"
 #include "drake/solvers/mathematical_program_result.h"
 #include "drake/solvers/mixed_integer_rotation_constraint.h"
+#include "drake/solvers/solver_options.h"
 
 namespace drake {
 namespace multibody {
@@ -23,6 +26,15 @@ namespace multibody {
  * Convex Optimization by Hongkai Dai, Gregory Izatt and Russ Tedrake,
  * International Journal of Robotics Research, 2019.
  *
+ * Most of the cost of building the program is in the constructor, which adds
+ * the mixed-integer relaxation of SO(3) for every body. To solve for many
+ * targets, construct the program once and change the targets in place between
+ * solves: update the bounds of the bindings returned by the position
+ * constraints, and call UpdateWorldOrientationConstraint() on those returned by
+ * AddWorldOrientationConstraint(). Passing the solution for one target as the
+ * initial guess for a nearby one warm-starts the mixed-integer solver. See also
+ * SolveGlobalInverseKinematicsSweep().
+ *
  * @ingroup planning_kinematics
  */
 class GlobalInverseKinematics {
@@ -211,6 +223,21 @@ class GlobalInverseKinematics {
       BodyIndex body_index, const Eigen::Quaterniond& desired_orientation,
       double angle_tol);
 
+  /**
+   * Changes the desired orientation and the angle tolerance of a constraint
+   * returned by AddWorldOrientationConstraint(), in place, so that the program
+   * can be solved again for a new target without being rebuilt.
+   * @param binding The constraint returned by AddWorldOrientationConstraint().
+   * @param desired_orientation The new desired orientation of the body.
+   * @param angle_tol The new tolerance on the angle between the body
+   * orientation and the desired orientation. Unit is radians.
+   * @throws std::exception if `binding` does not constrain the orientation of
+   * one of the bodies.
+   */
+  void UpdateWorldOrientationConstraint(
+      const solvers::Binding<solvers::LinearConstraint>& binding,
+      const Eigen::Quaterniond& desired_orientation, double angle_tol);
+
   /** Penalizes the deviation to the desired posture.
    *
    * For each body (except the world) in the kinematic tree, we add the cost
@@ -403,5 +430,62 @@ class GlobalInverseKinematics {
   // body, measured and expressed in the world frame.
   std::vector<solvers::VectorDecisionVariable<3>> p_WBo_;
 };
+
+/** Options for SolveGlobalInverseKinematicsSweep(). */
+struct GlobalInverseKinematicsSweepOptions {
+  /** The options for the relaxation of SO(3) in each program. */
+  GlobalInverseKinematics::Options global_ik_options;
+
+  /** The half-width of the box (in each axis of the world frame) that the
+  position of frame Q's origin must lie within, around the target position. */
+  double position_tolerance{1e-4};
+
+  /** The bound on the angle (in radians) between frame Q's orientation and
+  the target orientation. */
+  double orientation_tolerance{1e-3};
+
+  /** When true, each target after the first one solved by a thread is
+  initialized from the solution of its predecessor (if that solve succeeded),
+  including the binary variables of the relaxation. */
+  bool warm_start{true};
+
+  /** The options passed to the solver for every target. */
+  std::optional<solvers::SolverOptions> solver_options;
+
+  /** The maximum number of threads to solve with. */
+  Parallelism parallelism{Parallelism::Max()};
+};
+
+/** Solves a GlobalInverseKinematics problem for each of many target poses
+X_WQ of a frame Q, fixed to the body with index `body_index` at pose X_BQ.
+Each problem constrains Q's origin to lie within `options.position_tolerance`
+of the target position, and Q's orientation to lie within
+`options.orientation_tolerance` of the target orientation.
+
+This is a faster alternative to constructing a new GlobalInverseKinematics for
+every target (e.g., to select among many candidate grasps). Each thread
+constructs only a single program, and re-solves it after swapping in the bounds
+and orientation of each new target. The targets are split into contiguous
+chunks, one per thread, and (when `options.warm_start` is set) each solve
+starts from the solution of the previous target in its chunk.
+
+The solver is chosen by solvers::ChooseBestSolver(). If that solver is not
+thread-safe (e.g., Gurobi, whose instances all share one environment), all of
+the targets are solved on the calling thread.
+
+@returns the generalized positions reconstructed from the solution for each
+  target (see GlobalInverseKinematics::ReconstructGeneralizedPositionSolution),
+  in the same order as `X_WQ_targets`, or nullopt for each target whose solve
+  failed (e.g., because the target is not reachable).
+@throws std::exception if `body_index` is not a valid index of a body other
+  than the world, if either tolerance is negative, or if any of the solves
+  throws.
+@ingroup planning_kinematics */
+std::vector<std::optional<Eigen::VectorXd>> SolveGlobalInverseKinematicsSweep(
+    const MultibodyPlant<double>& plant, BodyIndex body_index,
+    const math::RigidTransformd& X_BQ,
+    const std::vector<math::RigidTransformd>& X_WQ_targets,
+    const GlobalInverseKinematicsSweepOptions& options = {});
+
 }  // namespace multibody
 }  // namespace drake
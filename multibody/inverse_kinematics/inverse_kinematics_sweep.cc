@@ -0,0 +1,124 @@
+#include "drake/multibody/inverse_kinematics/inverse_kinematics_sweep.h"
+
+#include <algorithm>
+#include <memory>
+
+#include "drake/common/parallel_for.h"
+#include "drake/common/text_logging.h"
+#include "drake/multibody/inverse_kinematics/inverse_kinematics.h"
+#include "drake/multibody/inverse_kinematics/orientation_constraint.h"
+#include "drake/multibody/inverse_kinematics/position_constraint.h"
+#include "drake/solvers/choose_best_solver.h"
+#include "drake/solvers/solve.h"
+
+namespace drake {
+namespace multibody {
+namespace {
+
+using Eigen::Vector3d;
+using Eigen::VectorXd;
+using math::RigidTransformd;
+using solvers::MathematicalProgramResult;
+
+// One InverseKinematics program, whose target pose can be changed between
+// solves.
+class SweepProgram {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(SweepProgram)
+
+  SweepProgram(const MultibodyPlant<double>& plant, const Frame<double>& frameA,
+               const Frame<double>& frameB, const RigidTransformd& X_BQ,
+               const InverseKinematicsSweepOptions& options)
+      : ik_(plant, options.with_joint_limits),
+        position_tolerance_(options.position_tolerance) {
+    const Vector3d zero = Vector3d::Zero();
+    position_ = std::make_shared<PositionConstraint>(
+        &plant, frameA, zero, zero, frameB, X_BQ.translation(),
+        ik_.get_mutable_context());
+    ik_.get_mutable_prog()->AddConstraint(position_, ik_.q());
+    orientation_ = std::make_shared<OrientationConstraint>(
+        &plant, frameA, math::RotationMatrixd(), frameB, X_BQ.rotation(),
+        options.orientation_tolerance, ik_.get_mutable_context());
+    ik_.get_mutable_prog()->AddConstraint(orientation_, ik_.q());
+  }
+
+  const solvers::MathematicalProgram& prog() const { return ik_.prog(); }
+
+  void SetTarget(const RigidTransformd& X_AQ) {
+    const Vector3d tolerance = Vector3d::Constant(position_tolerance_);
+    position_->set_bounds(X_AQ.translation() - tolerance,
+                          X_AQ.translation() + tolerance);
+    orientation_->set_R_AbarA(X_AQ.rotation());
+  }
+
+ private:
+  InverseKinematics ik_;
+  const double position_tolerance_;
+  std::shared_ptr<PositionConstraint> position_;
+  std::shared_ptr<OrientationConstraint> orientation_;
+};
+
+}  // namespace
+
+std::vector<MathematicalProgramResult> SolveInverseKinematicsSweep(
+    const MultibodyPlant<double>& plant, const Frame<double>& frameA,
+    const Frame<double>& frameB, const RigidTransformd& X_BQ,
+    const std::vector<RigidTransformd>& X_AQ_targets,
+    const InverseKinematicsSweepOptions& options) {
+  DRAKE_THROW_UNLESS(options.position_tolerance >= 0);
+  DRAKE_THROW_UNLESS(options.orientation_tolerance >= 0);
+  const VectorXd q_seed = options.q_seed.value_or(plant.GetDefaultPositions());
+  DRAKE_THROW_UNLESS(q_seed.size() == plant.num_positions());
+
+  const int num_targets = X_AQ_targets.size();
+  std::vector<MathematicalProgramResult> results(num_targets);
+  if (num_targets == 0) {
+    return results;
+  }
+
+  // The first chunk's program is built up front to choose the solver, which
+  // is the same for every chunk (only the bounds differ between targets).
+  auto first_program =
+      std::make_unique<SweepProgram>(plant, frameA, frameB, X_BQ, options);
+  const solvers::SolverId solver_id =
+      solvers::ChooseBestSolver(first_program->prog());
+  const int num_chunks =
+      solvers::internal::IsThreadSafe(solver_id)
+          ? std::clamp(options.parallelism.num_threads(), 1, num_targets)
+          : 1;
+  drake::log()->debug(
+      "SolveInverseKinematicsSweep will solve {} targets with {} using {} "
+      "threads",
+      num_targets, solver_id, num_chunks);
+
+  // Each chunk is a contiguous range of targets, so that the warm start for
+  // each target is the solution of its predecessor.
+  auto solve_chunk = [&](int chunk) {
+    std::unique_ptr<SweepProgram> program =
+        (chunk == 0) ? std::move(first_program)
+                     : std::make_unique<SweepProgram>(plant, frameA, frameB,
+                                                      X_BQ, options);
+    std::unique_ptr<solvers::SolverInterface> solver =
+        solvers::MakeSolver(solver_id);
+    const int begin = static_cast<int64_t>(num_targets) * chunk / num_chunks;
+    const int end =
+        static_cast<int64_t>(num_targets) * (chunk + 1) / num_chunks;
+    std::optional<VectorXd> initial_guess = q_seed;
+    for (int i = begin; i < end; ++i) {
+      program->SetTarget(X_AQ_targets[i]);
+      solver->Solve(program->prog(), initial_guess, options.solver_options,
+                    &results[i]);
+      if (options.warm_start && results[i].is_success()) {
+        initial_guess = results[i].GetSolution();
+      } else {
+        initial_guess = q_seed;
+      }
+    }
+  };
+  drake::internal::ParallelFor(Parallelism(num_chunks), num_chunks,
+                               solve_chunk);
+  return results;
+}
+
+}  // namespace multibody
+}  // namespace drake
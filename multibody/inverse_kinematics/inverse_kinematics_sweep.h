@@ -0,0 +1,75 @@
+#pragma once
+
+#include <optional>
+#include <vector>
+
+#include "drake/common/parallelism.h"
+#include "drake/math/rigid_transform.h"
+#include "drake/multibody/plant/multibody_plant.h"
+#include "drake/solvers/mathematical_program_result.h"
+#include "drake/solvers/solver_options.h"
+
+namespace drake {
+namespace multibody {
+
+/** Options for SolveInverseKinematicsSweep(). */
+struct InverseKinematicsSweepOptions {
+  /** The half-width of the box (in each axis of frame A) that the position of
+  frame Q's origin must lie within, around the target position. */
+  double position_tolerance{1e-4};
+
+  /** The bound on the angle (in radians) between frame Q's orientation and
+  the target orientation. */
+  double orientation_tolerance{1e-3};
+
+  /** The initial guess for the first target solved by each thread. When
+  not set, the plant's default positions are used. */
+  std::optional<Eigen::VectorXd> q_seed;
+
+  /** When true, each target after the first one solved by a thread is
+  initialized from the solution of its predecessor (if that solve succeeded),
+  rather than from `q_seed`. */
+  bool warm_start{true};
+
+  /** Whether to impose the plant's joint position limits. */
+  bool with_joint_limits{true};
+
+  /** The options passed to the solver for every target. */
+  std::optional<solvers::SolverOptions> solver_options;
+
+  /** The maximum number of threads to solve with. */
+  Parallelism parallelism{Parallelism::Max()};
+};
+
+/** Solves an InverseKinematics problem for each of many target poses X_AQ of a
+frame Q, fixed to frame B at pose X_BQ, measured in frame A. Each problem
+constrains Q's origin to lie within `options.position_tolerance` of the target
+position, and Q's orientation to lie within `options.orientation_tolerance` of
+the target orientation.
+
+This is a faster alternative to building and solving a new InverseKinematics
+for every target (e.g., for reachability maps over a grid of targets). Each
+thread builds only a single program, and re-solves it after swapping in the
+bounds and orientation of each new target. The targets are split into
+contiguous chunks, one per thread, and (when `options.warm_start` is set) each
+solve starts from the solution of the previous target in its chunk. Ordering
+the targets so that neighbors are close together (e.g., in grid order) makes
+the warm starts more effective.
+
+The solver is chosen by solvers::ChooseBestSolver(). If that solver is not
+thread-safe (e.g., IPOPT), all of the targets are solved on the calling thread.
+
+@returns the result for each target, in the same order as `X_AQ_targets`. The
+  solution for target `i` is `results[i].GetSolution()`, i.e., the decision
+  variables are exactly the plant's generalized positions.
+@throws std::exception if `options.q_seed` is set with the wrong size, if
+  either tolerance is negative, or if any of the solves throws.
+@ingroup planning_kinematics */
+std::vector<solvers::MathematicalProgramResult> SolveInverseKinematicsSweep(
+    const MultibodyPlant<double>& plant, const Frame<double>& frameA,
+    const Frame<double>& frameB, const math::RigidTransformd& X_BQ,
+    const std::vector<math::RigidTransformd>& X_AQ_targets,
+    const InverseKinematicsSweepOptions& options = {});
+
+}  // namespace multibody
+}  // namespace drake
@@ -82,6 +82,15 @@ class OrientationConstraint : public solvers::Constraint {
 
   ~OrientationConstraint() override {}
 
+  /**
+   * Changes the orientation `R_AbarA` of frame A measured in frame A̅, so that
+   * a program can be re-solved for a new target orientation without being
+   * rebuilt.
+   */
+  void set_R_AbarA(const math::RotationMatrix<double>& R_AbarA) {
+    R_AAbar_ = R_AbarA.inverse();
+  }
+
  private:
   void DoEval(const Eigen::Ref<const Eigen::VectorXd>& x,
               Eigen::VectorXd* y) const override;
@@ -101,7 +110,7 @@ class OrientationConstraint : public solvers::Constraint {
   const MultibodyPlant<double>* const plant_double_;
   const FrameIndex frameAbar_index_;
   const FrameIndex frameBbar_index_;
-  const math::RotationMatrix<double> R_AAbar_;
+  math::RotationMatrix<double> R_AAbar_;
   const math::RotationMatrix<double> R_BbarB_;
   systems::Context<double>* const context_double_;
 
@@ -507,6 +507,72 @@ GTEST_TEST(AdditionalDifferentialInverseKinematicsTests, QdotNeV3) {
       ".*You must pass the N matrix.*");
 }
 
+// Tests that a persistent workspace gives the same results as solving each
+// problem from scratch, including when the structure of the problem changes.
+GTEST_TEST(AdditionalDifferentialInverseKinematicsTests, Workspace) {
+  const int num_positions = 5;
+  DifferentialInverseKinematicsParameters parameters(num_positions);
+  parameters.set_time_step(0.01);
+  parameters.set_nominal_joint_position(VectorXd::Constant(num_positions, 0.2));
+  parameters.set_joint_centering_gain(
+      MatrixXd::Identity(num_positions, num_positions));
+  parameters.set_joint_position_limits(
+      std::pair(VectorXd::Constant(num_positions, -1.0),
+                VectorXd::Constant(num_positions, 1.0)));
+
+  DifferentialInverseKinematicsWorkspace workspace;
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> uniform(-1.0, 1.0);
+  auto random_matrix = [&](int rows, int cols) {
+    return MatrixXd::NullaryExpr(rows, cols, [&]() {
+      return uniform(generator);
+    });
+  };
+  auto check_step = [&](const MatrixXd& J) {
+    const VectorXd q = 0.5 * random_matrix(num_positions, 1);
+    const VectorXd v = random_matrix(num_positions, 1);
+    const VectorXd V = random_matrix(J.rows(), 1);
+    const DifferentialInverseKinematicsResult expected =
+        DoDifferentialInverseKinematics(q, v, V, J, parameters);
+    const DifferentialInverseKinematicsResult actual =
+        workspace.Solve(q, v, V, J, parameters);
+    EXPECT_EQ(actual.status, expected.status);
+    ASSERT_EQ(actual.joint_velocities.has_value(),
+              expected.joint_velocities.has_value());
+    if (expected.joint_velocities.has_value()) {
+      EXPECT_TRUE(CompareMatrices(*actual.joint_velocities,
+                                  *expected.joint_velocities, 1e-4));
+    }
+  };
+
+  // A redundant task, which is solved with a quadratic cost.
+  const MatrixXd J = random_matrix(3, num_positions);
+  for (int i = 0; i < 5; ++i) {
+    check_step(J);
+  }
+
+  // Adding a limit changes the structure.
+  parameters.set_joint_velocity_limits(
+      std::pair(VectorXd::Constant(num_positions, -2.0),
+                VectorXd::Constant(num_positions, 2.0)));
+  for (int i = 0; i < 3; ++i) {
+    check_step(J);
+  }
+
+  // A fully-constrained task, which is solved as a linear program.
+  const MatrixXd J_full = random_matrix(num_positions, num_positions);
+  for (int i = 0; i < 3; ++i) {
+    check_step(J_full);
+  }
+
+  // Copies of a workspace are independent.
+  DifferentialInverseKinematicsWorkspace copy(workspace);
+  const VectorXd q = VectorXd::Zero(num_positions);
+  const VectorXd V = VectorXd::Constant(3, 0.1);
+  EXPECT_EQ(copy.Solve(q, q, V, J, parameters).status,
+            workspace.Solve(q, q, V, J, parameters).status);
+}
+
 }  // namespace
 }  // namespace multibody
 }  // namespace drake
@@ -1,4 +1,5 @@
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
 #include "drake/multibody/inverse_kinematics/test/global_inverse_kinematics_test_util.h"
 #include "drake/solvers/gurobi_solver.h"
 
@@ -194,6 +195,89 @@ TEST_F(KukaTest, ReachableWithCost) {
   }
 }
 
+TEST_F(KukaTest, UpdateWorldOrientationConstraint) {
+  const Eigen::Quaterniond orientation(
+      Eigen::AngleAxisd(-M_PI / 2, Vector3d(0, 1, 0)));
+  const auto binding =
+      global_ik_.AddWorldOrientationConstraint(ee_idx_, orientation, 0.1);
+  // All nine entries of the rotation matrix are bound, even though some of
+  // their coefficients are zero.
+  ASSERT_EQ(binding.variables().size(), 9);
+  const Eigen::Matrix3d R_WB = math::RotationMatrixd::MakeXRotation(0.2)
+                                   .matrix();
+  const auto trace = [&](const Eigen::Quaterniond& desired) {
+    return (desired.toRotationMatrix() * R_WB.transpose()).trace();
+  };
+  const Eigen::Map<const Eigen::VectorXd> R_WB_flat(R_WB.data(), 9);
+  EXPECT_NEAR(binding.evaluator()->GetDenseA().row(0).dot(R_WB_flat),
+              trace(orientation), 1e-12);
+
+  const Eigen::Quaterniond new_orientation(
+      Eigen::AngleAxisd(0.3, Vector3d(1, 0, 0)));
+  global_ik_.UpdateWorldOrientationConstraint(binding, new_orientation, 0.2);
+  EXPECT_NEAR(binding.evaluator()->GetDenseA().row(0).dot(R_WB_flat),
+              trace(new_orientation), 1e-12);
+  EXPECT_NEAR(binding.evaluator()->lower_bound()(0), 2 * cos(0.2) + 1, 1e-12);
+  EXPECT_EQ(binding.evaluator()->upper_bound()(0), 3);
+
+  const auto position = global_ik_.AddWorldPositionConstraint(
+      ee_idx_, Vector3d::Zero(), Vector3d::Zero(), Vector3d::Zero());
+  EXPECT_THROW(global_ik_.UpdateWorldOrientationConstraint(
+                   position, new_orientation, 0.2),
+               std::exception);
+}
+
+TEST_F(KukaTest, Sweep) {
+  const RigidTransformd X_BQ(Vector3d(0, 0, 0.05));
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      SolveGlobalInverseKinematicsSweep(*plant_, BodyIndex(0), X_BQ,
+                                        {RigidTransformd()}),
+      ".*body_index.*");
+  if (!solvers::GurobiSolver::is_available()) {
+    return;
+  }
+
+  const auto& joint_lb = plant_->GetPositionLowerLimits();
+  const auto& joint_ub = plant_->GetPositionUpperLimits();
+  auto context = plant_->CreateDefaultContext();
+  const Frame<double>& ee_frame = plant_->get_body(ee_idx_).body_frame();
+
+  // Two reachable targets, from the kinematics of two postures within the
+  // joint limits, and one that is not reachable (see UnreachableTest).
+  std::vector<RigidTransformd> X_WQ_targets;
+  for (const double fraction : {0.1, 0.4}) {
+    const Eigen::VectorXd q = joint_lb + fraction * (joint_ub - joint_lb);
+    plant_->SetPositions(context.get(), q);
+    X_WQ_targets.push_back(plant_->CalcRelativeTransform(
+                               *context, plant_->world_frame(), ee_frame) *
+                           X_BQ);
+  }
+  X_WQ_targets.emplace_back(
+      math::RotationMatrixd(Eigen::AngleAxisd(-M_PI, Vector3d(0, 1, 0))),
+      Vector3d(0.8, 0, 0.7));
+
+  GlobalInverseKinematicsSweepOptions options;
+  options.position_tolerance = 1e-3;
+  options.orientation_tolerance = 0.01;
+  const std::vector<std::optional<Eigen::VectorXd>> q_sol =
+      SolveGlobalInverseKinematicsSweep(*plant_, ee_idx_, X_BQ, X_WQ_targets,
+                                        options);
+  ASSERT_EQ(q_sol.size(), 3);
+  for (int i = 0; i < 2; ++i) {
+    ASSERT_TRUE(q_sol[i].has_value());
+    plant_->SetPositions(context.get(), *q_sol[i]);
+    const RigidTransformd X_WQ =
+        plant_->CalcRelativeTransform(*context, plant_->world_frame(),
+                                      ee_frame) *
+        X_BQ;
+    // The reconstructed posture only approximately satisfies the constraints,
+    // as in ReachableTest.
+    EXPECT_TRUE(CompareMatrices(X_WQ.translation(),
+                                X_WQ_targets[i].translation(), 0.09));
+  }
+  EXPECT_FALSE(q_sol[2].has_value());
+}
+
 TEST_F(ToyTest, Test) {
   GlobalInverseKinematics::Options global_ik_options;
   GlobalInverseKinematics global_ik(*plant_, global_ik_options);
@@ -0,0 +1,121 @@
+#include "drake/multibody/inverse_kinematics/inverse_kinematics_sweep.h"
+
+#include <gtest/gtest.h>
+
+#include "drake/common/find_resource.h"
+#include "drake/multibody/inverse_kinematics/test/inverse_kinematics_test_utilities.h"
+
+namespace drake {
+namespace multibody {
+namespace {
+
+using Eigen::VectorXd;
+using math::RigidTransformd;
+
+class InverseKinematicsSweepTest : public ::testing::Test {
+ protected:
+  InverseKinematicsSweepTest()
+      : plant_(ConstructIiwaPlant(
+            FindResourceOrThrow("drake/manipulation/models/iiwa_description/"
+                                "sdf/iiwa14_no_collision.sdf"),
+            0.01)),
+        context_(plant_->CreateDefaultContext()),
+        frameA_(plant_->world_frame()),
+        frameB_(plant_->GetFrameByName("iiwa_link_7")),
+        X_BQ_(Eigen::Vector3d(0, 0, 0.1)) {
+    // The targets are reachable poses along a path through joint space, so
+    // that neighboring targets are close together.
+    const int num_targets = 8;
+    for (int i = 0; i < num_targets; ++i) {
+      VectorXd q(7);
+      q << 0.1, 0.4, 0.2, -1.2, 0.1, 0.6, 0.3;
+      q *= 1.0 + 0.5 * i / num_targets;
+      plant_->SetPositions(context_.get(), q);
+      targets_.push_back(CalcPose(frameB_, X_BQ_));
+    }
+  }
+
+  RigidTransformd CalcPose(const Frame<double>& frame,
+                           const RigidTransformd& X_FQ) const {
+    return plant_->CalcRelativeTransform(*context_, frameA_, frame) * X_FQ;
+  }
+
+  // Checks that each result reaches its target within the given tolerances.
+  void CheckResults(
+      const std::vector<solvers::MathematicalProgramResult>& results,
+      const InverseKinematicsSweepOptions& options) {
+    ASSERT_EQ(results.size(), targets_.size());
+    for (size_t i = 0; i < results.size(); ++i) {
+      ASSERT_TRUE(results[i].is_success());
+      plant_->SetPositions(context_.get(), results[i].GetSolution());
+      const RigidTransformd X_AQ = CalcPose(frameB_, X_BQ_);
+      const double kSolverTol = 1e-6;
+      EXPECT_LE((X_AQ.translation() - targets_[i].translation())
+                    .lpNorm<Eigen::Infinity>(),
+                options.position_tolerance + kSolverTol);
+      const double angle =
+          Eigen::AngleAxisd(
+              (X_AQ.rotation().inverse() * targets_[i].rotation()).matrix())
+              .angle();
+      EXPECT_LE(angle, options.orientation_tolerance + kSolverTol);
+    }
+  }
+
+  std::unique_ptr<MultibodyPlant<double>> plant_;
+  std::unique_ptr<systems::Context<double>> context_;
+  const Frame<double>& frameA_;
+  const Frame<double>& frameB_;
+  const RigidTransformd X_BQ_;
+  std::vector<RigidTransformd> targets_;
+};
+
+TEST_F(InverseKinematicsSweepTest, Serial) {
+  InverseKinematicsSweepOptions options;
+  options.parallelism = Parallelism::None();
+  CheckResults(SolveInverseKinematicsSweep(*plant_, frameA_, frameB_, X_BQ_,
+                                           targets_, options),
+               options);
+}
+
+TEST_F(InverseKinematicsSweepTest, Parallel) {
+  InverseKinematicsSweepOptions options;
+  options.parallelism = Parallelism(3);
+  options.position_tolerance = 1e-3;
+  options.orientation_tolerance = 0.01;
+  CheckResults(SolveInverseKinematicsSweep(*plant_, frameA_, frameB_, X_BQ_,
+                                           targets_, options),
+               options);
+}
+
+TEST_F(InverseKinematicsSweepTest, NoWarmStart) {
+  InverseKinematicsSweepOptions options;
+  options.warm_start = false;
+  options.q_seed = VectorXd::Constant(7, 0.2);
+  CheckResults(SolveInverseKinematicsSweep(*plant_, frameA_, frameB_, X_BQ_,
+                                           targets_, options),
+               options);
+}
+
+TEST_F(InverseKinematicsSweepTest, Empty) {
+  const std::vector<RigidTransformd> no_targets;
+  EXPECT_TRUE(
+      SolveInverseKinematicsSweep(*plant_, frameA_, frameB_, X_BQ_, no_targets)
+          .empty());
+}
+
+TEST_F(InverseKinematicsSweepTest, BadOptions) {
+  InverseKinematicsSweepOptions options;
+  options.q_seed = VectorXd::Zero(3);
+  EXPECT_THROW(SolveInverseKinematicsSweep(*plant_, frameA_, frameB_, X_BQ_,
+                                           targets_, options),
+               std::exception);
+  options = {};
+  options.orientation_tolerance = -1;
+  EXPECT_THROW(SolveInverseKinematicsSweep(*plant_, frameA_, frameB_, X_BQ_,
+                                           targets_, options),
+               std::exception);
+}
+
+}  // namespace
+}  // namespace multibody
+}  // namespace drake
@@ -0,0 +1,220 @@
+#include "drake/multibody/optimization/toppra_two_variable_lp.h"
+
+#include <cmath>
+#include <limits>
+#include <random>
+
+#include <gtest/gtest.h>
+
+#include "drake/solvers/mathematical_program.h"
+#include "drake/solvers/solve.h"
+
+namespace drake {
+namespace multibody {
+namespace internal {
+namespace {
+
+constexpr double kInf = std::numeric_limits<double>::infinity();
+
+GTEST_TEST(TwoVariableLpTest, Box) {
+  TwoVariableLp lp;
+  lp.AddConstraint(1, 0, 1, 3);
+  lp.AddConstraint(0, 1, -2, 5);
+  const auto x_range = lp.CalcXRange();
+  ASSERT_TRUE(x_range.has_value());
+  EXPECT_EQ(x_range->first, 1);
+  EXPECT_EQ(x_range->second, 3);
+  EXPECT_EQ(lp.CalcMaxU(2), 5);
+
+  // Clearing removes every constraint, so nothing bounds u anymore.
+  lp.Clear();
+  EXPECT_EQ(lp.CalcXRange(), std::make_pair(-kInf, kInf));
+  EXPECT_FALSE(lp.CalcMaxU(0).has_value());
+}
+
+GTEST_TEST(TwoVariableLpTest, Coupled) {
+  // 0 ≤ x ≤ 10 and x ≤ u ≤ 4 - x, so x ≤ 2 and u ≤ 4 - x.
+  TwoVariableLp lp;
+  lp.AddConstraint(1, 0, 0, 10);
+  lp.AddConstraint(-1, 1, 0, kInf);
+  lp.AddConstraint(1, 1, -kInf, 4);
+  const auto x_range = lp.CalcXRange();
+  ASSERT_TRUE(x_range.has_value());
+  EXPECT_EQ(x_range->first, 0);
+  EXPECT_EQ(x_range->second, 2);
+  EXPECT_EQ(lp.CalcMaxU(0.5), 3.5);
+  EXPECT_EQ(lp.CalcMaxU(2), 2);
+}
+
+GTEST_TEST(TwoVariableLpTest, Infeasible) {
+  // Contradictory bounds on x alone.
+  TwoVariableLp lp;
+  lp.AddConstraint(1, 0, 2, kInf);
+  lp.AddConstraint(1, 0, -kInf, 1);
+  EXPECT_FALSE(lp.CalcXRange().has_value());
+
+  // Bounds on u that only contradict each other for x ≥ 0: 1 + x ≤ u ≤ -x.
+  lp.Clear();
+  lp.AddConstraint(1, 0, 0, kInf);
+  lp.AddConstraint(-1, 1, 1, kInf);
+  lp.AddConstraint(1, 1, -kInf, 0);
+  EXPECT_FALSE(lp.CalcXRange().has_value());
+  EXPECT_FALSE(lp.CalcMaxU(0).has_value());
+
+  // A constraint 0 ≥ 1 that involves neither variable.
+  lp.Clear();
+  lp.AddConstraint(0, 0, 1, kInf);
+  EXPECT_FALSE(lp.CalcXRange().has_value());
+  EXPECT_FALSE(lp.CalcMaxU(0).has_value());
+
+  // The same with a satisfiable right-hand side is no constraint at all.
+  lp.Clear();
+  lp.AddConstraint(0, 0, -1, 1);
+  lp.AddConstraint(0, 1, -kInf, 1);
+  EXPECT_EQ(lp.CalcXRange(), std::make_pair(-kInf, kInf));
+  EXPECT_EQ(lp.CalcMaxU(0), 1);
+}
+
+GTEST_TEST(TwoVariableLpTest, Unbounded) {
+  // x is unbounded above, and u is bounded above only once x is bounded.
+  TwoVariableLp lp;
+  lp.AddConstraint(1, 0, 0, kInf);
+  lp.AddConstraint(-1, 1, -kInf, 0);
+  const auto x_range = lp.CalcXRange();
+  ASSERT_TRUE(x_range.has_value());
+  EXPECT_EQ(x_range->first, 0);
+  EXPECT_EQ(x_range->second, kInf);
+  EXPECT_EQ(lp.CalcMaxU(3), 3);
+
+  // With no upper bound on u, the forward pass's LP is unbounded.
+  lp.Clear();
+  lp.AddConstraint(1, 0, 0, 1);
+  lp.AddConstraint(0, 1, 0, kInf);
+  EXPECT_FALSE(lp.CalcMaxU(0.5).has_value());
+}
+
+GTEST_TEST(TwoVariableLpTest, ParallelAndRepeated) {
+  // x + u = 1 (as two parallel half-planes, given twice) within a box.
+  TwoVariableLp lp;
+  lp.AddConstraint(1, 0, 0, 2);
+  lp.AddConstraint(0, 1, -5, 5);
+  lp.AddConstraint(1, 1, 1, 1);
+  lp.AddConstraint(1, 1, 1, 1);
+  auto x_range = lp.CalcXRange();
+  ASSERT_TRUE(x_range.has_value());
+  EXPECT_EQ(x_range->first, 0);
+  EXPECT_EQ(x_range->second, 2);
+  EXPECT_EQ(lp.CalcMaxU(0.5), 0.5);
+
+  // Parallel half-planes with an empty strip between them.
+  lp.AddConstraint(2, 2, -kInf, 1);
+  EXPECT_FALSE(lp.CalcXRange().has_value());
+  EXPECT_FALSE(lp.CalcMaxU(0.5).has_value());
+
+  // Parallel half-planes u ≥ 2x and u ≤ 2x + 1 leave x unbounded.
+  lp.Clear();
+  lp.AddConstraint(-2, 1, 0, 1);
+  x_range = lp.CalcXRange();
+  ASSERT_TRUE(x_range.has_value());
+  EXPECT_EQ(x_range->first, -kInf);
+  EXPECT_EQ(x_range->second, kInf);
+  EXPECT_EQ(lp.CalcMaxU(1), 3);
+}
+
+GTEST_TEST(TwoVariableLpTest, Tolerance) {
+  const double tol = TwoVariableLp::kTol;
+
+  // Bounds on x that cross by less than the tolerance collapse to a point.
+  TwoVariableLp lp;
+  lp.AddConstraint(1, 0, 1, kInf);
+  lp.AddConstraint(1, 0, -kInf, 1 - 0.1 * tol);
+  auto x_range = lp.CalcXRange();
+  ASSERT_TRUE(x_range.has_value());
+  EXPECT_EQ(x_range->first, 1);
+  EXPECT_EQ(x_range->second, 1);
+
+  // Crossing by more than the tolerance is infeasible.
+  lp.Clear();
+  lp.AddConstraint(1, 0, 1, kInf);
+  lp.AddConstraint(1, 0, -kInf, 1 - 10 * tol);
+  EXPECT_FALSE(lp.CalcXRange().has_value());
+
+  // The same holds for the bounds on u with x fixed; the upper one wins.
+  lp.Clear();
+  lp.AddConstraint(0, 1, 1, kInf);
+  lp.AddConstraint(0, 1, -kInf, 1 - 0.1 * tol);
+  EXPECT_EQ(lp.CalcMaxU(0), 1 - 0.1 * tol);
+  lp.AddConstraint(0, 1, -kInf, 1 - 10 * tol);
+  EXPECT_FALSE(lp.CalcMaxU(0).has_value());
+
+  // The tolerance is relative to the magnitude of the bounds.
+  lp.Clear();
+  lp.AddConstraint(1, 0, 1e6, kInf);
+  lp.AddConstraint(1, 0, -kInf, 1e6 * (1 - 0.1 * tol));
+  EXPECT_TRUE(lp.CalcXRange().has_value());
+}
+
+GTEST_TEST(TwoVariableLpTest, NaN) {
+  TwoVariableLp lp;
+  lp.AddConstraint(1, 0, 0, 1);
+  lp.AddConstraint(std::nan(""), 1, 0, 1);
+  const auto x_range = lp.CalcXRange();
+  ASSERT_TRUE(x_range.has_value());
+  EXPECT_TRUE(std::isnan(x_range->first));
+  EXPECT_TRUE(std::isnan(x_range->second));
+}
+
+// Compares against the MathematicalProgram formulation that Toppra used to
+// solve with an LP solver, on random feasible instances shaped like Toppra's
+// (a nonnegative, bounded x and a few two-sided constraints on a⋅x + b⋅u).
+GTEST_TEST(TwoVariableLpTest, MatchesSolver) {
+  std::mt19937 generator(1234);
+  std::uniform_real_distribution<double> coefficient(-2.0, 2.0);
+  std::uniform_real_distribution<double> slack(0.0, 1.0);
+  std::uniform_real_distribution<double> point(0.0, 5.0);
+  for (int trial = 0; trial < 50; ++trial) {
+    const double x0 = point(generator);
+    const double u0 = point(generator) - 2.5;
+    TwoVariableLp lp;
+    solvers::MathematicalProgram prog;
+    const auto x = prog.NewContinuousVariables<1>()(0);
+    const auto u = prog.NewContinuousVariables<1>()(0);
+    auto add = [&](double a, double b, double lb, double ub) {
+      lp.AddConstraint(a, b, lb, ub);
+      prog.AddLinearConstraint(a * x + b * u, lb, ub);
+    };
+    add(1, 0, 0, 10);
+    add(0, 1, -10, 10);
+    for (int row = 0; row < 4; ++row) {
+      const double a = coefficient(generator);
+      const double b = coefficient(generator);
+      const double value = a * x0 + b * u0;
+      add(a, b, value - slack(generator), value + slack(generator));
+    }
+
+    const auto x_range = lp.CalcXRange();
+    ASSERT_TRUE(x_range.has_value());
+    auto cost = prog.AddLinearCost(x);
+    const auto min_result = solvers::Solve(prog);
+    ASSERT_TRUE(min_result.is_success());
+    EXPECT_NEAR(x_range->first, min_result.get_optimal_cost(), 1e-6);
+    cost.evaluator()->UpdateCoefficients(Vector1d(-1));
+    const auto max_result = solvers::Solve(prog);
+    ASSERT_TRUE(max_result.is_success());
+    EXPECT_NEAR(x_range->second, -max_result.get_optimal_cost(), 1e-6);
+
+    const std::optional<double> u_max = lp.CalcMaxU(x0);
+    ASSERT_TRUE(u_max.has_value());
+    cost.evaluator()->UpdateCoefficients(Vector1d(0));
+    prog.AddLinearCost(-u);
+    prog.AddBoundingBoxConstraint(x0, x0, x);
+    const auto u_result = solvers::Solve(prog);
+    ASSERT_TRUE(u_result.is_success());
+    EXPECT_NEAR(*u_max, u_result.GetSolution(u), 1e-6);
+  }
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace multibody
+}  // namespace drake
@@ -1,13 +1,14 @@
 #include "drake/multibody/optimization/toppra.h"
 
 #include <algorithm>
+#include <cmath>
 #include <forward_list>
 #include <limits>
+#include <optional>
+#include <utility>
+#include <vector>
 
-#include "drake/solvers/choose_best_solver.h"
-#include "drake/solvers/clp_solver.h"
-#include "drake/solvers/mathematical_program_result.h"
-#include "drake/solvers/mosek_solver.h"
+#include "drake/multibody/optimization/toppra_two_variable_lp.h"
 
 namespace drake {
 namespace multibody {
@@ -90,6 +91,16 @@ Toppra::Toppra(const Trajectory<double>& path,
       throw std::runtime_error("Gridpoints must be monotonically increasing.");
     }
   }
+  // Evaluate the path once at each gridpoint, for use by every constraint.
+  const int N = gridpoints.size() - 1;
+  path_qs_.resize(path.rows(), N);
+  path_qs_dot_.resize(path.rows(), N);
+  path_qs_ddot_.resize(path.rows(), N);
+  for (int knot = 0; knot < N; knot++) {
+    path_qs_.col(knot) = path.value(gridpoints(knot));
+    path_qs_dot_.col(knot) = path.EvalDerivative(gridpoints(knot), 1);
+    path_qs_ddot_.col(knot) = path.EvalDerivative(gridpoints(knot), 2);
+  }
   // Quaternions are not yet fully supported.
   for (BodyIndex body_idx{0}; body_idx < plant.num_bodies(); body_idx++) {
     if (plant.get_body(body_idx).has_quaternion_dofs()) {
@@ -116,7 +127,7 @@ Binding<BoundingBoxConstraint> Toppra::AddJointVelocityLimit(
   Eigen::VectorXd x_upper_bound(N);
 
   for (int knot = 0; knot < N; knot++) {
-    const Eigen::VectorXd qs_dot = path_.EvalDerivative(gridpoints_(knot), 1);
+    const Eigen::VectorXd qs_dot = path_qs_dot_.col(knot);
 
     double sd_max = std::numeric_limits<double>::infinity();
     double sd_min = -std::numeric_limits<double>::infinity();
@@ -155,8 +166,8 @@ Toppra::AddJointAccelerationLimit(
   Eigen::MatrixXd con_ub(n_con, N);
 
   for (int knot = 0; knot < N; knot++) {
-    const Eigen::VectorXd qs_dot = path_.EvalDerivative(gridpoints_(knot), 1);
-    const Eigen::VectorXd qs_ddot = path_.EvalDerivative(gridpoints_(knot), 2);
+    const Eigen::VectorXd qs_dot = path_qs_dot_.col(knot);
+    const Eigen::VectorXd qs_ddot = path_qs_ddot_.col(knot);
 
     con_A.block(0, 2 * knot, n_dof, 1) << qs_ddot;
     con_A.block(0, 2 * knot + 1, n_dof, 1) << qs_dot;
@@ -204,9 +215,9 @@ Toppra::AddJointTorqueLimit(
     // the constraint becomes
     // M * dq/ds * s̈ + ( M * d²q/ds² + C(q, dq/ds)) * ṡ² = g(q) + τ.
     // Toppra assumes q̇ = v and will have undefined behavior if it does not.
-    const Eigen::VectorXd qs = path_.value(gridpoints_(knot));
-    const Eigen::VectorXd qs_dot = path_.EvalDerivative(gridpoints_(knot), 1);
-    const Eigen::VectorXd qs_ddot = path_.EvalDerivative(gridpoints_(knot), 2);
+    const Eigen::VectorXd qs = path_qs_.col(knot);
+    const Eigen::VectorXd qs_dot = path_qs_dot_.col(knot);
+    const Eigen::VectorXd qs_ddot = path_qs_ddot_.col(knot);
 
     plant_.SetPositions(plant_context_.get(), qs);
     plant_.SetVelocities(plant_context_.get(), qs_dot);
@@ -245,8 +256,8 @@ Binding<BoundingBoxConstraint> Toppra::AddFrameVelocityLimit(
   Eigen::VectorXd velocity(6);
 
   for (int knot = 0; knot < N; knot++) {
-    const Eigen::VectorXd qs = path_.value(gridpoints_(knot));
-    const Eigen::VectorXd qs_dot = path_.EvalDerivative(gridpoints_(knot), 1);
+    const Eigen::VectorXd qs = path_qs_.col(knot);
+    const Eigen::VectorXd qs_dot = path_qs_dot_.col(knot);
 
     plant_.SetPositions(plant_context_.get(), qs);
     plant_.SetVelocities(plant_context_.get(), qs_dot);
@@ -327,8 +338,8 @@ Binding<BoundingBoxConstraint> Toppra::AddFrameTranslationalSpeedLimit(
 
   for (int knot = 0; knot < N; knot++) {
     const double t = gridpoints_(knot);
-    const Eigen::VectorXd qs = path_.value(t);
-    const Eigen::VectorXd qs_dot = path_.EvalDerivative(t, 1);
+    const Eigen::VectorXd qs = path_qs_.col(knot);
+    const Eigen::VectorXd qs_dot = path_qs_dot_.col(knot);
 
     plant_.SetPositions(plant_context_.get(), qs);
     plant_.SetVelocities(plant_context_.get(), qs_dot);
@@ -405,9 +416,9 @@ Toppra::AddFrameAccelerationLimit(const Frame<double>& constraint_frame,
     // Jv_WF * dq/ds * s̈ + (Jv_WF * d²q/ds² + J̇v_WF) * ṡ² = a_WF
     // Toppra assumes q̇ = v and will have undefined behavior if it does not.
     const double t = gridpoints_(knot);
-    const Eigen::VectorXd qs = path_.value(t);
-    const Eigen::VectorXd qs_dot = path_.EvalDerivative(t, 1);
-    const Eigen::VectorXd qs_ddot = path_.EvalDerivative(t, 2);
+    const Eigen::VectorXd qs = path_qs_.col(knot);
+    const Eigen::VectorXd qs_dot = path_qs_dot_.col(knot);
+    const Eigen::VectorXd qs_ddot = path_qs_ddot_.col(knot);
 
     plant_.SetPositions(plant_context_.get(), qs);
     plant_.SetVelocities(plant_context_.get(), qs_dot);
@@ -475,63 +486,45 @@ void Toppra::CalcInterpolationConstraint(Eigen::MatrixXd* A,
       << upper_bound->block(0, N - 1, n_con, 1);
 }
 
-std::optional<Eigen::Matrix2Xd> Toppra::ComputeBackwardPass(
-    double s_dot_0, double s_dot_N, const SolverInterface& solver) {
+std::optional<Eigen::Matrix2Xd> Toppra::ComputeBackwardPass(double s_dot_0,
+                                                            double s_dot_N) {
   DRAKE_DEMAND(s_dot_0 >= 0);
   DRAKE_DEMAND(s_dot_N >= 0);
-  const Eigen::Vector2d min_cost_A(1, 0);
-  const Eigen::Vector2d max_cost_A(-1, 0);
   const int N = gridpoints_.size() - 1;
 
   // Compute controllable set.
   Eigen::Matrix2Xd K(2, N + 1);
   K.col(N) << std::pow(s_dot_N, 2), std::pow(s_dot_N, 2);
-  // Setup and solve sequence of one-step problems
+  // Setup and solve sequence of one-step problems. Both the minimum and the
+  // maximum of x come from a single closed-form solve.
+  internal::TwoVariableLp lp;
   for (int knot = N - 1; knot > -1; knot--) {
-    // Setup constraints for both max & min
     const double delta = gridpoints_(knot + 1) - gridpoints_(knot);
-    backward_continuity_con_.evaluator()->UpdateCoefficients(
-        Eigen::Vector2d(1, 2 * delta).transpose(), Vector1d(K(0, knot + 1)),
-        Vector1d(K(1, knot + 1)));
-    for (auto& [constraint, bounds] : x_bounds_) {
-      constraint.evaluator()->set_bounds(Vector1d(bounds.lb(knot)),
-                                         Vector1d(bounds.ub(knot)));
-    }
-    for (auto& [constraint, coefficients] : backward_lin_constraint_) {
-      constraint.evaluator()->UpdateCoefficients(
-          coefficients.coeffs.middleCols<2>(2 * knot),
-          coefficients.lb.col(knot), coefficients.ub.col(knot));
+    lp.Clear();
+    lp.AddConstraint(1, 2 * delta, K(0, knot + 1), K(1, knot + 1));
+    // See the bounding box constraint on x added in the constructor.
+    lp.AddConstraint(1, 0, 0, 1e16);
+    for (const auto& [constraint, bounds] : x_bounds_) {
+      lp.AddConstraint(1, 0, bounds.lb(knot), bounds.ub(knot));
     }
-    // Solve minimum
-    {
-      backward_cost_.evaluator()->UpdateCoefficients(min_cost_A);
-      solvers::MathematicalProgramResult result;
-      solver.Solve(*backward_prog_, {}, {}, &result);
-      if (!result.is_success()) {
-        drake::log()->error(
-            fmt::format("Toppra failed to find lower bound of controllable set "
-                        "at knot {}/{}.",
-                        knot, N));
-        return std::nullopt;
-      } else {
-        K(0, knot) = result.GetSolution(backward_x_)(0);
+    for (const auto& [constraint, coefficients] : backward_lin_constraint_) {
+      for (int row = 0; row < coefficients.coeffs.rows(); ++row) {
+        lp.AddConstraint(
+            coefficients.coeffs(row, 2 * knot),
+            coefficients.coeffs(row, 2 * knot + 1), coefficients.lb(row, knot),
+            coefficients.ub(row, knot));
       }
     }
-    // Solve maximum
-    {
-      backward_cost_.evaluator()->UpdateCoefficients(max_cost_A);
-      solvers::MathematicalProgramResult result;
-      solver.Solve(*backward_prog_, {}, {}, &result);
-      if (!result.is_success()) {
-        drake::log()->error(
-            fmt::format("Toppra failed to find upper bound of controllable set "
-                        "at knot {}/{}.",
-                        knot, N));
-        return std::nullopt;
-      } else {
-        K(1, knot) = result.GetSolution(backward_x_)(0);
-      }
+    const std::optional<std::pair<double, double>> x_range = lp.CalcXRange();
+    if (!x_range) {
+      drake::log()->error(
+          fmt::format("Toppra failed to find the bounds of the controllable "
+                      "set at knot {}/{}.",
+                      knot, N));
+      return std::nullopt;
     }
+    K(0, knot) = x_range->first;
+    K(1, knot) = x_range->second;
 
     if (K.col(knot).hasNaN()) {
       drake::log()->error(
@@ -562,8 +555,7 @@ std::optional<Eigen::Matrix2Xd> Toppra::ComputeBackwardPass(
 
 std::optional<std::pair<Eigen::VectorXd, Eigen::VectorXd>>
 Toppra::ComputeForwardPass(double s_dot_0,
-                           const Eigen::Ref<const Eigen::Matrix2Xd>& K,
-                           const SolverInterface& solver) {
+                           const Eigen::Ref<const Eigen::Matrix2Xd>& K) {
   const int N = gridpoints_.size() - 1;
   DRAKE_DEMAND(s_dot_0 >= 0);
   DRAKE_DEMAND(K.cols() == N + 1);
@@ -572,29 +564,27 @@ Toppra::ComputeForwardPass(double s_dot_0,
   Eigen::VectorXd xstar(N + 1);
   Eigen::VectorXd ustar(N);
   xstar(0) = std::pow(s_dot_0, 2);
+  internal::TwoVariableLp lp;
   for (int knot = 0; knot < N; knot++) {
     const double delta = gridpoints_(knot + 1) - gridpoints_(knot);
-    forward_continuity_con_.evaluator()->UpdateCoefficients(
-        Vector1d(2 * delta), Vector1d(K(0, knot + 1) - xstar(knot)),
-        Vector1d(K(1, knot + 1) - xstar(knot)));
-    for (auto& [constraint, coefficients] : forward_lin_constraint_) {
-      constraint.evaluator()->UpdateCoefficients(
-          coefficients.coeffs.col(2 * knot + 1),
-          coefficients.lb.col(knot) -
-              xstar(knot) * coefficients.coeffs.col(2 * knot),
-          coefficients.ub.col(knot) -
-              xstar(knot) * coefficients.coeffs.col(2 * knot));
+    lp.Clear();
+    lp.AddConstraint(1, 2 * delta, K(0, knot + 1), K(1, knot + 1));
+    for (const auto& [constraint, coefficients] : forward_lin_constraint_) {
+      for (int row = 0; row < coefficients.coeffs.rows(); ++row) {
+        lp.AddConstraint(
+            coefficients.coeffs(row, 2 * knot),
+            coefficients.coeffs(row, 2 * knot + 1), coefficients.lb(row, knot),
+            coefficients.ub(row, knot));
+      }
     }
-    solvers::MathematicalProgramResult result;
-    solver.Solve(*forward_prog_, {}, {}, &result);
-    if (!result.is_success()) {
+    const std::optional<double> u_max = lp.CalcMaxU(xstar(knot));
+    if (!u_max) {
       drake::log()->error(
           "Toppra failed to find the maximum path acceleration at knot {}/{}.",
           knot, N);
       return std::nullopt;
-    } else {
-      ustar(knot) = result.GetSolution()(0);
     }
+    ustar(knot) = *u_max;
     double xnext = xstar(knot) + 2 * delta * ustar(knot);
     xstar(knot + 1) = std::max(K(0, knot + 1), std::min(K(1, knot + 1), xnext));
   }
@@ -606,17 +596,12 @@ std::optional<PiecewisePolynomial<double>> Toppra::SolvePathParameterization() {
   const double s_dot_0 = 0;
   const double s_dot_N = 0;
 
-  // Clp appears to outperform Mosek for these optimizations.
-  // TODO(mpetersen94) Add Gurobi in the correct ordering
-  auto solver = solvers::MakeFirstAvailableSolver(
-      {solvers::ClpSolver::id(), solvers::MosekSolver::id()});
-
   const std::optional<Eigen::Matrix2Xd> K =
-      ComputeBackwardPass(s_dot_0, s_dot_N, *solver);
+      ComputeBackwardPass(s_dot_0, s_dot_N);
   if (!K) {  // Error occurred in backpass, return nothing
     return std::nullopt;
   }
-  const auto forward_results = ComputeForwardPass(s_dot_0, K.value(), *solver);
+  const auto forward_results = ComputeForwardPass(s_dot_0, K.value());
   if (!forward_results) {  // Error occurred in forward pass, return nothing
     return std::nullopt;
   }
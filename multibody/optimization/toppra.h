@@ -105,13 +105,15 @@ class Toppra {
   static Eigen::VectorXd CalcGridPoints(const Trajectory<double>& path,
                                         const CalcGridPointsOptions& options);
 
-  // TODO(mpetersen94): Consider adding optional<Solver> argument.
   /**
    * Solves the TOPPRA optimization and returns the time optimized path
    * parameterization s(t). This can be used with the original path q(s) to
    * generate a time parameterized trajectory.
    * The path parameterization has the same start time as the original path's
    * starting break.
+   * The small linear programs at each gridpoint (in two variables for the
+   * backward pass and one for the forward pass) are solved in closed form,
+   * so no LP solver is required.
    */
   std::optional<PiecewisePolynomial<double>> SolvePathParameterization();
 
@@ -270,10 +272,9 @@ class Toppra {
    * and upper bound of the path velocity at grid point i.
    * @param s_dot_0 The path velocity at the beginning of the path.
    * @param s_dot_N The path velocity at the end of the path.
-   * @param solver The solver to use for the optimizations at each gridpoint.
    */
-  std::optional<Eigen::Matrix2Xd> ComputeBackwardPass(
-      double s_dot_0, double s_dot_N, const SolverInterface& solver);
+  std::optional<Eigen::Matrix2Xd> ComputeBackwardPass(double s_dot_0,
+                                                      double s_dot_N);
 
   /*
    * Performs the forward pass step of TOPPRA, computing the greediest
@@ -282,11 +283,9 @@ class Toppra {
    * @param K The controllable set that the path velocity must stay within at
    *          each gridpoint. K(0, i) and K(1, i) contain respectively the lower
    *          and upper bound of the path velocity at grid point i.
-   * @param solver The solver to use for the optimizations at each gridpoint.
    */
   std::optional<std::pair<Eigen::VectorXd, Eigen::VectorXd>> ComputeForwardPass(
-      double s_dot_0, const Eigen::Ref<const Eigen::Matrix2Xd>& K,
-      const SolverInterface& solver);
+      double s_dot_0, const Eigen::Ref<const Eigen::Matrix2Xd>& K);
 
   /*
    * Calculates the interpolation constraint coefficients for the forward
@@ -340,6 +339,12 @@ class Toppra {
   const MultibodyPlant<double>& plant_;
   const std::unique_ptr<systems::Context<double>> plant_context_;
   Eigen::VectorXd gridpoints_;
+  // The path q(s) and its first two derivatives, evaluated at each gridpoint
+  // (except the last) once and shared by all of the constraints. Column i
+  // holds the value at gridpoints_(i).
+  Eigen::MatrixXd path_qs_;
+  Eigen::MatrixXd path_qs_dot_;
+  Eigen::MatrixXd path_qs_ddot_;
   // x_bounds_ maps a Binding<BoundingBoxConstraint> to its bounds for the
   // backward pass. At the i'th grid point the linear constraint
   // x_bounds_.at(constraint).lb.col(i) <= x
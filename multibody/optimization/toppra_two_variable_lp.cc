@@ -0,0 +1,78 @@
+#include "drake/multibody/optimization/toppra_two_variable_lp.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace drake {
+namespace multibody {
+namespace internal {
+
+namespace {
+constexpr double kInf = std::numeric_limits<double>::infinity();
+}  // namespace
+
+std::optional<std::pair<double, double>> TwoVariableLp::CalcXRange() const {
+  double x_lo = -kInf;
+  double x_hi = kInf;
+  // Each constraint α⋅x ≥ β on x narrows the range.
+  auto narrow = [&](double alpha, double beta, double scale) {
+    if (alpha > 0) {
+      x_lo = std::max(x_lo, beta / alpha);
+    } else if (alpha < 0) {
+      x_hi = std::min(x_hi, beta / alpha);
+    } else if (beta > kTol * scale) {
+      return false;
+    }
+    return true;
+  };
+  for (const HalfPlane& p : half_planes_) {
+    if (std::isnan(p.a) || std::isnan(p.b) || std::isnan(p.c)) {
+      return std::make_pair(std::nan(""), std::nan(""));
+    }
+    if (p.b == 0 && !narrow(p.a, p.c, 1 + std::abs(p.c))) {
+      return std::nullopt;
+    }
+  }
+  // Every lower bound on u (b > 0) must lie below every upper bound on u
+  // (b < 0). Combining the pair with the positive weights -b_q and b_p
+  // eliminates u without dividing by either.
+  for (const HalfPlane& p : half_planes_) {
+    if (!(p.b > 0)) continue;
+    for (const HalfPlane& q : half_planes_) {
+      if (!(q.b < 0)) continue;
+      const double alpha = -q.b * p.a + p.b * q.a;
+      const double beta = -q.b * p.c + p.b * q.c;
+      const double scale = 1 + std::abs(q.b * p.c) + std::abs(p.b * q.c);
+      if (!narrow(alpha, beta, scale)) {
+        return std::nullopt;
+      }
+    }
+  }
+  if (x_lo > x_hi + kTol * (1 + std::abs(x_hi))) {
+    return std::nullopt;
+  }
+  return std::make_pair(x_lo, std::max(x_lo, x_hi));
+}
+
+std::optional<double> TwoVariableLp::CalcMaxU(double x) const {
+  double u_lo = -kInf;
+  double u_hi = kInf;
+  for (const HalfPlane& p : half_planes_) {
+    const double c = p.c - p.a * x;
+    if (p.b > 0) {
+      u_lo = std::max(u_lo, c / p.b);
+    } else if (p.b < 0) {
+      u_hi = std::min(u_hi, c / p.b);
+    } else if (!(c <= kTol * (1 + std::abs(p.c)))) {
+      return std::nullopt;
+    }
+  }
+  if (!(u_lo <= u_hi + kTol * (1 + std::abs(u_hi))) || u_hi == kInf) {
+    return std::nullopt;
+  }
+  return u_hi;
+}
+
+}  // namespace internal
+}  // namespace multibody
+}  // namespace drake
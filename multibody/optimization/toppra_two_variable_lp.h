@@ -0,0 +1,57 @@
+#pragma once
+
+#include <limits>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace drake {
+namespace multibody {
+namespace internal {
+
+// Solves TOPPRA's small linear programs in closed form. The feasible set is
+// the intersection of the half-planes a⋅x + b⋅u ≥ c in the (x, u) plane.
+// Eliminating u (Fourier–Motzkin) leaves an interval of x, whose endpoints
+// are the solutions of the backward pass's LPs; fixing x leaves an interval of
+// u, whose upper end is the solution of the forward pass's LP. With m
+// constraints this costs O(m²) flops, and allocates only when m grows.
+class TwoVariableLp {
+ public:
+  // Feasibility is checked up to this relative tolerance (comparable to the
+  // primal feasibility tolerances of the LP solvers used previously).
+  static constexpr double kTol = 1e-9;
+
+  void Clear() { half_planes_.clear(); }
+
+  // Adds the constraint lb ≤ a⋅x + b⋅u ≤ ub. Infinite bounds are ignored.
+  void AddConstraint(double a, double b, double lb, double ub) {
+    constexpr double kInf = std::numeric_limits<double>::infinity();
+    if (lb > -kInf) {
+      half_planes_.push_back({a, b, lb});
+    }
+    if (ub < kInf) {
+      half_planes_.push_back({-a, -b, -ub});
+    }
+  }
+
+  // Returns the minimum and maximum of x over the feasible set (which may be
+  // NaN if any coefficient is NaN), or nullopt if the set is empty.
+  std::optional<std::pair<double, double>> CalcXRange() const;
+
+  // Returns the maximum of u over the feasible set with x fixed to the given
+  // value, or nullopt if that set is empty or unbounded.
+  std::optional<double> CalcMaxU(double x) const;
+
+ private:
+  struct HalfPlane {
+    double a{};
+    double b{};
+    double c{};
+  };
+
+  std::vector<HalfPlane> half_planes_;
+};
+
+}  // namespace internal
+}  // namespace multibody
+}  // namespace drake
@@ -15,9 +15,10 @@ std::unique_ptr<CompositeParse> CompositeParse::MakeCompositeParse(
 
 CompositeParse::CompositeParse(Parser* parser)
     : resolver_(&parser->plant()),
-      options_({parser->GetAutoRenaming()}),
+      options_({parser->GetAutoRenaming(), parser->GetParallelism()}),
       workspace_(options_, parser->package_map(), parser->diagnostic_policy_,
-                 &parser->plant(), &resolver_, SelectParser) {}
+                 &parser->plant(), &resolver_, SelectParser,
+                 parser->mesh_cache_.get()) {}
 
 CompositeParse::~CompositeParse() {
   resolver_.Resolve(workspace_.diagnostic);
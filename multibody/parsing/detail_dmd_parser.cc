@@ -54,7 +54,7 @@ void ParseModelDirectivesImpl(
   drake::log()->debug("ParseModelDirectivesImpl(MultibodyPlant)");
   DRAKE_DEMAND(added_models != nullptr);
   auto& [options, package_map, diagnostic, plant,
-         collision_resolver, parser_selector] = workspace;
+         collision_resolver, parser_selector, mesh_cache] = workspace;
   DRAKE_DEMAND(plant != nullptr);
   auto get_scoped_frame = [plant = plant, &model_namespace](
                               const std::string& name) -> const Frame<double>& {
@@ -0,0 +1,125 @@
+#include "drake/multibody/parsing/detail_mesh_cache.h"
+
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <future>
+#include <optional>
+#include <sstream>
+#include <utility>
+
+#include "drake/common/drake_assert.h"
+#include "drake/common/ssize.h"
+#include "drake/multibody/tree/geometry_spatial_inertia.h"
+
+namespace drake {
+namespace multibody {
+namespace internal {
+namespace {
+
+// Returns the contents of the named file, or nullopt if it can't be read.
+std::optional<std::string> ReadFile(const std::string& filename) {
+  std::ifstream input(filename, std::ios::binary);
+  if (!input.is_open()) {
+    return std::nullopt;
+  }
+  std::stringstream contents;
+  contents << input.rdbuf();
+  if (input.bad()) {
+    return std::nullopt;
+  }
+  return std::move(contents).str();
+}
+
+}  // namespace
+
+MeshCache::MeshCache() = default;
+
+MeshCache::~MeshCache() = default;
+
+SpatialInertia<double> MeshCache::CalcSpatialInertia(
+    const geometry::Mesh& mesh, double density) {
+  return CalcSpatialInertias({mesh}, density, Parallelism::None())[0];
+}
+
+std::vector<SpatialInertia<double>> MeshCache::CalcSpatialInertias(
+    const std::vector<geometry::Mesh>& meshes, double density,
+    Parallelism parallelism) {
+  const int num_meshes = ssize(meshes);
+  std::vector<std::optional<Key>> keys(num_meshes);
+  std::vector<std::optional<SpatialInertia<double>>> results(num_meshes);
+
+  for (int i = 0; i < num_meshes; ++i) {
+    std::optional<std::string> contents = ReadFile(meshes[i].filename());
+    if (contents.has_value()) {
+      keys[i] = Key(std::move(*contents), meshes[i].scale(), density);
+    }
+  }
+
+  // Look up the meshes, and collect the distinct ones that are missing.
+  // Unreadable files have no key; computing them reports the error.
+  std::vector<int> missing;
+  std::map<Key, int> first_missing;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (int i = 0; i < num_meshes; ++i) {
+      if (!keys[i].has_value()) {
+        missing.push_back(i);
+        continue;
+      }
+      const auto iter = entries_.find(*keys[i]);
+      if (iter != entries_.end()) {
+        results[i] = iter->second;
+      } else if (first_missing.emplace(*keys[i], i).second) {
+        missing.push_back(i);
+      }
+    }
+  }
+
+  // Compute the missing meshes, each worker taking the next unclaimed one.
+  // The workers are joined (by the futures' destructors) before any of the
+  // locals they refer to go out of scope, even if one of them throws.
+  const int num_missing = ssize(missing);
+  std::atomic<int> next{0};
+  auto work = [&]() {
+    for (int k = next++; k < num_missing; k = next++) {
+      const int i = missing[k];
+      results[i] = multibody::CalcSpatialInertia(meshes[i], density);
+    }
+  };
+  const int num_threads =
+      std::min(parallelism.num_threads(), std::max(num_missing, 1));
+  std::vector<std::future<void>> workers;
+  for (int t = 1; t < num_threads; ++t) {
+    workers.push_back(std::async(std::launch::async, work));
+  }
+  work();
+  for (std::future<void>& worker : workers) {
+    worker.get();
+  }
+
+  std::vector<SpatialInertia<double>> inertias;
+  inertias.reserve(num_meshes);
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (int i = 0; i < num_meshes; ++i) {
+    if (!results[i].has_value()) {
+      // A duplicate of a mesh computed above.
+      DRAKE_DEMAND(keys[i].has_value());
+      results[i] = results[first_missing.at(*keys[i])];
+    } else if (keys[i].has_value() && first_missing.contains(*keys[i]) &&
+               first_missing.at(*keys[i]) == i) {
+      entries_.emplace(*keys[i], *results[i]);
+    }
+    inertias.push_back(*results[i]);
+  }
+  return inertias;
+}
+
+int MeshCache::num_entries() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return ssize(entries_);
+}
+
+}  // namespace internal
+}  // namespace multibody
+}  // namespace drake
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <map>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/parallelism.h"
+#include "drake/geometry/shape_specification.h"
+#include "drake/multibody/tree/spatial_inertia.h"
+
+namespace drake {
+namespace multibody {
+namespace internal {
+
+// Caches the spatial inertias computed from mesh files while parsing. Entries
+// are keyed on the contents of the files rather than on their names, so a
+// model that is added several times (e.g., by repeated add_model directives),
+// or several copies of the same mesh, only integrate each mesh once. A Parser
+// owns one cache, which is shared by all of its parses.
+//
+// This class is thread-safe.
+class MeshCache {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(MeshCache)
+
+  MeshCache();
+
+  ~MeshCache();
+
+  // Returns CalcSpatialInertia(mesh, density), computing it only if no mesh
+  // file with the same contents has been seen with the same scale and
+  // density.
+  // @throws std::exception as CalcSpatialInertia() does.
+  SpatialInertia<double> CalcSpatialInertia(const geometry::Mesh& mesh,
+                                            double density);
+
+  // Returns the CalcSpatialInertia() of each of the `meshes`. The ones that
+  // are not yet cached are computed concurrently, on up to
+  // `parallelism.num_threads()` threads.
+  // @throws std::exception as CalcSpatialInertia() does.
+  std::vector<SpatialInertia<double>> CalcSpatialInertias(
+      const std::vector<geometry::Mesh>& meshes, double density,
+      Parallelism parallelism);
+
+  // Returns the number of distinct meshes that have been integrated.
+  int num_entries() const;
+
+ private:
+  // The file contents, scale and density.
+  using Key = std::tuple<std::string, double, double>;
+
+  mutable std::mutex mutex_;
+  std::map<Key, SpatialInertia<double>> entries_;
+};
+
+}  // namespace internal
+}  // namespace multibody
+}  // namespace drake
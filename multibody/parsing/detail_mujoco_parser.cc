@@ -13,6 +13,7 @@
 #include <fmt/format.h>
 #include <tinyxml2.h>
 
+#include "drake/common/ssize.h"
 #include "drake/geometry/shape_specification.h"
 #include "drake/math/rigid_transform.h"
 #include "drake/math/rotation_matrix.h"
@@ -943,6 +944,7 @@ class MujocoParser {
       material_[name] = material_node;
     }
 
+    std::vector<std::string> mesh_names;
     for (XMLElement* mesh_node = node->FirstChildElement("mesh"); mesh_node;
          mesh_node = mesh_node->NextSiblingElement("mesh")) {
       WarnUnsupportedAttribute(*mesh_node, "class");
@@ -1016,7 +1018,7 @@ class MujocoParser {
 
         if (std::filesystem::exists(filename)) {
           mesh_[name] = std::make_unique<geometry::Mesh>(filename, scale[0]);
-          mesh_inertia_[name] = CalcSpatialInertia(*mesh_[name], 1);
+          mesh_names.push_back(name);
         } else if (std::filesystem::exists(original_filename)) {
           Warning(
               *node,
@@ -1056,6 +1058,25 @@ class MujocoParser {
       }
     }
 
+    // The inertias only depend on the mesh files, so we compute them all at
+    // once, possibly concurrently, and reuse those of files seen before.
+    std::vector<geometry::Mesh> meshes;
+    for (const std::string& name : mesh_names) {
+      meshes.push_back(*mesh_[name]);
+    }
+    std::vector<SpatialInertia<double>> inertias;
+    if (workspace_.mesh_cache != nullptr) {
+      inertias = workspace_.mesh_cache->CalcSpatialInertias(
+          meshes, 1.0 /* density */, workspace_.options.parallelism);
+    } else {
+      for (const geometry::Mesh& mesh : meshes) {
+        inertias.push_back(CalcSpatialInertia(mesh, 1.0 /* density */));
+      }
+    }
+    for (int i = 0; i < ssize(mesh_names); ++i) {
+      mesh_inertia_[mesh_names[i]] = inertias[i];
+    }
+
     WarnUnsupportedElement(*node, "texture");
     WarnUnsupportedElement(*node, "hfield");
     WarnUnsupportedElement(*node, "skin");
@@ -7,8 +7,10 @@
 #include "drake/common/diagnostic_policy.h"
 #include "drake/common/drake_assert.h"
 #include "drake/common/drake_copyable.h"
+#include "drake/common/parallelism.h"
 #include "drake/multibody/parsing/detail_collision_filter_group_resolver.h"
 #include "drake/multibody/parsing/detail_common.h"
+#include "drake/multibody/parsing/detail_mesh_cache.h"
 #include "drake/multibody/parsing/package_map.h"
 #include "drake/multibody/plant/multibody_plant.h"
 
@@ -119,6 +121,7 @@ using ParserSelector = std::function<ParserInterface&(
 
 struct ParsingOptions {
   bool enable_auto_renaming{false};
+  Parallelism parallelism{};
 };
 
 // ParsingWorkspace bundles the commonly-needed elements for parsing routines.
@@ -132,20 +135,22 @@ struct ParsingWorkspace {
   DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(ParsingWorkspace)
 
   // All parameters are aliased; they must have a lifetime greater than that of
-  // this struct.
+  // this struct. The mesh cache is optional.
   ParsingWorkspace(
       const ParsingOptions& options_in,
       const PackageMap& package_map_in,
       const drake::internal::DiagnosticPolicy& diagnostic_in,
       MultibodyPlant<double>* plant_in,
       internal::CollisionFilterGroupResolver* collision_resolver_in,
-      ParserSelector parser_selector_in)
+      ParserSelector parser_selector_in,
+      internal::MeshCache* mesh_cache_in = nullptr)
       : options(options_in),
         package_map(package_map_in),
         diagnostic(diagnostic_in),
         plant(plant_in),
         collision_resolver(collision_resolver_in),
-        parser_selector(parser_selector_in) {
+        parser_selector(parser_selector_in),
+        mesh_cache(mesh_cache_in) {
     DRAKE_DEMAND(plant != nullptr);
     DRAKE_DEMAND(collision_resolver != nullptr);
     DRAKE_DEMAND(parser_selector != nullptr);
@@ -157,6 +162,7 @@ struct ParsingWorkspace {
   MultibodyPlant<double>* const plant;
   internal::CollisionFilterGroupResolver* const collision_resolver;
   const ParserSelector parser_selector;
+  internal::MeshCache* const mesh_cache;
 };
 
 }  // namespace internal
@@ -1962,7 +1962,7 @@ sdf::InterfaceModelPtr ParseNestedInterfaceModel(
     const sdf::NestedInclude& include, sdf::Errors* errors) {
   const sdf::ParserConfig parser_config = MakeSdfParserConfig(workspace);
   auto& [options, package_map, diagnostic, plant,
-         collision_resolver, parser_selector] = workspace;
+         collision_resolver, parser_selector, mesh_cache] = workspace;
   const std::string resolved_filename{include.ResolvedFileName()};
 
   // Do not attempt to parse anything other than URDF and MuJoCo xml files.
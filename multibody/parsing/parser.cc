@@ -1,11 +1,13 @@
 #include "drake/multibody/parsing/parser.h"
 
+#include <memory>
 #include <optional>
 #include <set>
 
 #include "drake/multibody/parsing/detail_collision_filter_group_resolver.h"
 #include "drake/multibody/parsing/detail_common.h"
 #include "drake/multibody/parsing/detail_composite_parse.h"
+#include "drake/multibody/parsing/detail_mesh_cache.h"
 #include "drake/multibody/parsing/detail_parsing_workspace.h"
 #include "drake/multibody/parsing/detail_path_utils.h"
 #include "drake/multibody/parsing/detail_select_parser.h"
@@ -32,7 +34,7 @@ Parser::Parser(MultibodyPlant<double>* plant,
 Parser::Parser(MultibodyPlant<double>* plant,
                geometry::SceneGraph<double>* scene_graph,
                std::string_view model_name_prefix)
-    : plant_(plant) {
+    : mesh_cache_(std::make_shared<internal::MeshCache>()), plant_(plant) {
   DRAKE_THROW_UNLESS(plant != nullptr);
 
   if (!model_name_prefix.empty()) {
@@ -1,12 +1,14 @@
 #pragma once
 
 #include <filesystem>
+#include <memory>
 #include <optional>
 #include <string>
 #include <vector>
 
 #include "drake/common/diagnostic_policy.h"
 #include "drake/common/drake_deprecated.h"
+#include "drake/common/parallelism.h"
 #include "drake/multibody/parsing/package_map.h"
 #include "drake/multibody/plant/multibody_plant.h"
 #include "drake/multibody/tree/multibody_tree_indexes.h"
@@ -16,6 +18,7 @@ namespace multibody {
 
 namespace internal {
 class CompositeParse;
+class MeshCache;
 }  // namespace internal
 
 /// Parses model description input into a MultibodyPlant and (optionally) a
@@ -191,6 +194,19 @@ class Parser final {
   /// @see the Parser class documentation for more detail.
   bool GetAutoRenaming() const { return enable_auto_rename_; }
 
+  /// Sets how many threads subsequent Add*Model*() operations may use for
+  /// work that doesn't depend on the plant, such as computing the inertias of
+  /// the mesh assets of an MJCF file. The default is no parallelism.
+  ///
+  /// Regardless of this setting, the results of such work are cached (keyed
+  /// on the contents of the files involved) for the lifetime of this parser,
+  /// so adding the same model several times only does the work once.
+  void SetParallelism(Parallelism parallelism) { parallelism_ = parallelism; }
+
+  /// Gets the current parallelism.
+  /// @see SetParallelism().
+  Parallelism GetParallelism() const { return parallelism_; }
+
   /// Parses the input file named in @p file_name and adds all of its model(s)
   /// to @p plant.
   ///
@@ -257,6 +273,8 @@ class Parser final {
 
   bool is_strict_{false};
   bool enable_auto_rename_{false};
+  Parallelism parallelism_{};
+  std::shared_ptr<internal::MeshCache> mesh_cache_;
   PackageMap package_map_;
   drake::internal::DiagnosticPolicy diagnostic_policy_;
   MultibodyPlant<double>* const plant_;
@@ -0,0 +1,86 @@
+#include "drake/multibody/parsing/detail_mesh_cache.h"
+
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/find_resource.h"
+#include "drake/common/temp_directory.h"
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/multibody/tree/geometry_spatial_inertia.h"
+
+namespace drake {
+namespace multibody {
+namespace internal {
+namespace {
+
+using geometry::Mesh;
+
+void ExpectSameInertia(const SpatialInertia<double>& M1,
+                       const SpatialInertia<double>& M2) {
+  EXPECT_TRUE(CompareMatrices(M1.CopyToFullMatrix6(), M2.CopyToFullMatrix6()));
+}
+
+class MeshCacheTest : public ::testing::Test {
+ protected:
+  const std::string box_obj_ = FindResourceOrThrow(
+      "drake/multibody/parsing/test/box_package/meshes/box.obj");
+  // A box with different file contents.
+  const std::string other_obj_ =
+      FindResourceOrThrow("drake/geometry/render/test/meshes/box.obj");
+};
+
+TEST_F(MeshCacheTest, KeyedOnContents) {
+  MeshCache dut;
+  const SpatialInertia<double> M = dut.CalcSpatialInertia(Mesh(box_obj_), 2.0);
+  ExpectSameInertia(M, CalcSpatialInertia(Mesh(box_obj_), 2.0));
+  EXPECT_EQ(dut.num_entries(), 1);
+
+  // A copy of the same file, under another name, reuses the entry.
+  const std::string copy = temp_directory() + "/copy.obj";
+  std::filesystem::copy_file(box_obj_, copy);
+  ExpectSameInertia(dut.CalcSpatialInertia(Mesh(copy), 2.0), M);
+  EXPECT_EQ(dut.num_entries(), 1);
+
+  // A different scale, density or file needs a new entry.
+  ExpectSameInertia(dut.CalcSpatialInertia(Mesh(box_obj_, 1.5), 2.0),
+                    CalcSpatialInertia(Mesh(box_obj_, 1.5), 2.0));
+  ExpectSameInertia(dut.CalcSpatialInertia(Mesh(box_obj_), 3.0),
+                    CalcSpatialInertia(Mesh(box_obj_), 3.0));
+  ExpectSameInertia(dut.CalcSpatialInertia(Mesh(other_obj_), 2.0),
+                    CalcSpatialInertia(Mesh(other_obj_), 2.0));
+  EXPECT_EQ(dut.num_entries(), 4);
+
+  // Errors are reported, and not cached.
+  EXPECT_THROW(dut.CalcSpatialInertia(Mesh("no_such_file.obj"), 2.0),
+               std::exception);
+  EXPECT_EQ(dut.num_entries(), 4);
+}
+
+TEST_F(MeshCacheTest, Batch) {
+  const std::vector<Mesh> meshes{Mesh(box_obj_), Mesh(other_obj_),
+                                 Mesh(box_obj_), Mesh(other_obj_, 2.0)};
+  MeshCache dut;
+  const std::vector<SpatialInertia<double>> inertias =
+      dut.CalcSpatialInertias(meshes, 1.0, Parallelism(2));
+  ASSERT_EQ(inertias.size(), meshes.size());
+  for (int i = 0; i < 4; ++i) {
+    ExpectSameInertia(inertias[i], CalcSpatialInertia(meshes[i], 1.0));
+  }
+  EXPECT_EQ(dut.num_entries(), 3);
+
+  // Computing them again hits the cache.
+  const std::vector<SpatialInertia<double>> again =
+      dut.CalcSpatialInertias(meshes, 1.0, Parallelism::None());
+  for (int i = 0; i < 4; ++i) {
+    ExpectSameInertia(again[i], inertias[i]);
+  }
+  EXPECT_EQ(dut.num_entries(), 3);
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace multibody
+}  // namespace drake
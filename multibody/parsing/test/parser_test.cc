@@ -465,6 +465,24 @@ GTEST_TEST(FileParserTest, AutoRenaming) {
       ".*names must be unique.*");
 }
 
+GTEST_TEST(FileParserTest, Parallelism) {
+  const std::string mjcf_with_mesh = FindResourceOrThrow(
+      "drake/multibody/parsing/test/box_package/mjcfs/box.xml");
+  MultibodyPlant<double> plant(0.0);
+
+  Parser parser(&plant);
+  EXPECT_EQ(parser.GetParallelism().num_threads(), 1);
+  parser.SetParallelism(Parallelism(2));
+  EXPECT_EQ(parser.GetParallelism().num_threads(), 2);
+
+  // The second copy reuses the mesh inertia computed for the first one.
+  parser.SetAutoRenaming(true);
+  parser.AddModels(mjcf_with_mesh);
+  parser.AddModels(mjcf_with_mesh);
+  EXPECT_TRUE(plant.HasModelInstanceNamed("test"));
+  EXPECT_TRUE(plant.HasModelInstanceNamed("test_1"));
+}
+
 }  // namespace
 }  // namespace multibody
 }  // namespace drake
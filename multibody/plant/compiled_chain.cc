@@ -0,0 +1,289 @@
+#include "drake/multibody/plant/compiled_chain.h"
+
+#include <stdexcept>
+
+#include <fmt/format.h>
+
+#include "drake/common/drake_assert.h"
+#include "drake/common/drake_throw.h"
+#include "drake/multibody/tree/prismatic_joint.h"
+#include "drake/multibody/tree/revolute_joint.h"
+#include "drake/multibody/tree/weld_joint.h"
+
+namespace drake {
+namespace multibody {
+
+using math::RigidTransform;
+
+template <typename T>
+CompiledChain<T>::CompiledChain(const MultibodyPlant<T>& plant,
+                                const systems::Context<T>& context) {
+  DRAKE_THROW_UNLESS(plant.is_finalized());
+  plant.ValidateContext(context);
+  num_velocities_ = plant.num_velocities();
+  gravity_W_ = plant.gravity_field().gravity_vector().template cast<T>();
+
+  // The joint connecting each body to its parent.
+  std::vector<const Joint<T>*> inboard_joint(plant.num_bodies(), nullptr);
+  for (JointIndex i(0); i < plant.num_joints(); ++i) {
+    const Joint<T>& joint = plant.get_joint(i);
+    if (joint.type_name() != RevoluteJoint<T>::kTypeName &&
+        joint.type_name() != PrismaticJoint<T>::kTypeName &&
+        joint.type_name() != WeldJoint<T>::kTypeName) {
+      throw std::logic_error(fmt::format(
+          "CompiledChain(): joint '{}' is of type '{}'; only revolute, "
+          "prismatic and weld joints are supported.",
+          joint.name(), joint.type_name()));
+    }
+    inboard_joint[joint.child_body().index()] = &joint;
+  }
+  for (BodyIndex i(1); i < plant.num_bodies(); ++i) {
+    if (inboard_joint[i] == nullptr) {
+      throw std::logic_error(fmt::format(
+          "CompiledChain(): body '{}' is not the child of any joint; joints "
+          "that are reversed in the tree are not supported.",
+          plant.get_body(i).name()));
+    }
+  }
+
+  // Visit the bodies from the world outwards, so that each link comes after
+  // its parent.
+  link_of_body_.assign(plant.num_bodies(), -1);
+  std::vector<BodyIndex> queue{world_index()};
+  for (size_t next = 0; next < queue.size(); ++next) {
+    const BodyIndex parent_body = queue[next];
+    for (BodyIndex i(1); i < plant.num_bodies(); ++i) {
+      const Joint<T>& joint = *inboard_joint[i];
+      if (joint.parent_body().index() != parent_body) continue;
+      Link link;
+      link.body = i;
+      link.parent = link_of_body_[parent_body];
+      link.X_PF = joint.frame_on_parent().CalcPoseInBodyFrame(context);
+      const RigidTransform<T> X_BM =
+          joint.frame_on_child().CalcPoseInBodyFrame(context);
+      link.X_MB = X_BM.inverse();
+      if (joint.type_name() == RevoluteJoint<T>::kTypeName) {
+        link.kind = JointKind::kRevolute;
+        link.axis_F = dynamic_cast<const RevoluteJoint<T>&>(joint)
+                          .revolute_axis()
+                          .template cast<T>();
+      } else if (joint.type_name() == PrismaticJoint<T>::kTypeName) {
+        link.kind = JointKind::kPrismatic;
+        link.axis_F = dynamic_cast<const PrismaticJoint<T>&>(joint)
+                          .translation_axis()
+                          .template cast<T>();
+      } else {
+        link.kind = JointKind::kWeld;
+        const RigidTransform<double>& X_FM =
+            dynamic_cast<const WeldJoint<T>&>(joint).X_FM();
+        link.X_MB = X_FM.template cast<T>() * link.X_MB;
+      }
+      if (link.kind != JointKind::kWeld) {
+        link.velocity_index = joint.velocity_start();
+      }
+      link.M_BBo_B = plant.get_body(i).CalcSpatialInertiaInBodyFrame(context);
+      link.gravity_enabled =
+          plant.gravity_field().is_enabled(plant.get_body(i).model_instance());
+      link_of_body_[i] = static_cast<int>(links_.size());
+      links_.push_back(std::move(link));
+      queue.push_back(i);
+    }
+  }
+  // Bodies that are unreachable from the world form a loop.
+  DRAKE_THROW_UNLESS(static_cast<int>(links_.size()) ==
+                     plant.num_bodies() - 1);
+
+  for (JointActuatorIndex i(0); i < plant.num_actuators(); ++i) {
+    const JointActuator<T>& actuator = plant.get_joint_actuator(i);
+    const Joint<T>& joint = actuator.joint();
+    if (joint.num_velocities() == 1) {
+      links_[link_of_body_[joint.child_body().index()]].reflected_inertia =
+          actuator.calc_reflected_inertia(context);
+    }
+  }
+}
+
+template <typename T>
+void CompiledChain<T>::CalcLinkPose(const Link& link,
+                                    const Eigen::Ref<const VectorX<T>>& q,
+                                    const RigidTransform<T>& X_WP,
+                                    RigidTransform<T>* X_WF,
+                                    RigidTransform<T>* X_WB) const {
+  *X_WF = X_WP * link.X_PF;
+  switch (link.kind) {
+    case JointKind::kRevolute: {
+      const RigidTransform<T> X_FM(
+          Eigen::AngleAxis<T>(q[link.velocity_index], link.axis_F),
+          Vector3<T>::Zero());
+      *X_WB = *X_WF * X_FM * link.X_MB;
+      return;
+    }
+    case JointKind::kPrismatic: {
+      const RigidTransform<T> X_FM(link.axis_F * q[link.velocity_index]);
+      *X_WB = *X_WF * X_FM * link.X_MB;
+      return;
+    }
+    case JointKind::kWeld:
+      *X_WB = *X_WF * link.X_MB;
+      return;
+  }
+  DRAKE_UNREACHABLE();
+}
+
+template <typename T>
+void CompiledChain<T>::CalcBodyPosesInWorld(
+    const Eigen::Ref<const VectorX<T>>& q,
+    std::vector<RigidTransform<T>>* X_WB) const {
+  DRAKE_THROW_UNLESS(q.size() == num_velocities());
+  DRAKE_THROW_UNLESS(X_WB != nullptr);
+  X_WB->resize(num_bodies());
+  (*X_WB)[world_index()] = RigidTransform<T>::Identity();
+  RigidTransform<T> X_WF;
+  for (const Link& link : links_) {
+    const BodyIndex parent_body =
+        link.parent < 0 ? world_index() : links_[link.parent].body;
+    CalcLinkPose(link, q, (*X_WB)[parent_body], &X_WF, &(*X_WB)[link.body]);
+  }
+}
+
+template <typename T>
+void CompiledChain<T>::CalcJacobianSpatialVelocity(
+    const std::vector<RigidTransform<T>>& X_WB, BodyIndex body_B,
+    const Vector3<T>& p_BoBp_B, EigenPtr<MatrixX<T>> Js_V_WBp_W) const {
+  DRAKE_THROW_UNLESS(static_cast<int>(X_WB.size()) == num_bodies());
+  DRAKE_THROW_UNLESS(body_B.is_valid() && body_B < num_bodies());
+  DRAKE_THROW_UNLESS(Js_V_WBp_W != nullptr);
+  DRAKE_THROW_UNLESS(Js_V_WBp_W->rows() == 6 &&
+                     Js_V_WBp_W->cols() == num_velocities());
+  Js_V_WBp_W->setZero();
+  const Vector3<T> p_WBp = X_WB[body_B] * p_BoBp_B;
+  // Only the joints between B and the world move Bp.
+  for (int k = link_of_body_[body_B]; k >= 0; k = links_[k].parent) {
+    const Link& link = links_[k];
+    if (link.kind == JointKind::kWeld) continue;
+    const BodyIndex parent_body =
+        link.parent < 0 ? world_index() : links_[link.parent].body;
+    const RigidTransform<T> X_WF = X_WB[parent_body] * link.X_PF;
+    const Vector3<T> axis_W = X_WF.rotation() * link.axis_F;
+    auto J_k = Js_V_WBp_W->col(link.velocity_index);
+    if (link.kind == JointKind::kRevolute) {
+      J_k.template head<3>() = axis_W;
+      J_k.template tail<3>() = axis_W.cross(p_WBp - X_WF.translation());
+    } else {
+      J_k.template tail<3>() = axis_W;
+    }
+  }
+}
+
+template <typename T>
+void CompiledChain<T>::CalcInverseDynamics(
+    const Eigen::Ref<const VectorX<T>>& q,
+    const Eigen::Ref<const VectorX<T>>& v,
+    const Eigen::Ref<const VectorX<T>>& vdot, EigenPtr<VectorX<T>> tau) const {
+  DRAKE_THROW_UNLESS(q.size() == num_velocities());
+  DRAKE_THROW_UNLESS(v.size() == num_velocities());
+  DRAKE_THROW_UNLESS(vdot.size() == num_velocities());
+  DRAKE_THROW_UNLESS(tau != nullptr);
+  DRAKE_THROW_UNLESS(tau->size() == num_velocities());
+
+  // Per link kinematics, all expressed in W.
+  struct LinkKinematics {
+    RigidTransform<T> X_WF;
+    RigidTransform<T> X_WB;
+    Vector3<T> axis_W;
+    SpatialVelocity<T> V_WB;
+    SpatialAcceleration<T> A_WB;
+    SpatialForce<T> F_BBo_W;
+  };
+  std::vector<LinkKinematics> kinematics(links_.size());
+
+  // Base to tip: poses, velocities, accelerations and forces.
+  const RigidTransform<T> X_WW = RigidTransform<T>::Identity();
+  const SpatialVelocity<T> V_WW = SpatialVelocity<T>::Zero();
+  const SpatialAcceleration<T> A_WW = SpatialAcceleration<T>::Zero();
+  for (size_t k = 0; k < links_.size(); ++k) {
+    const Link& link = links_[k];
+    LinkKinematics& kin = kinematics[k];
+    const bool has_parent = link.parent >= 0;
+    const RigidTransform<T>& X_WP =
+        has_parent ? kinematics[link.parent].X_WB : X_WW;
+    const SpatialVelocity<T>& V_WP =
+        has_parent ? kinematics[link.parent].V_WB : V_WW;
+    const SpatialAcceleration<T>& A_WP =
+        has_parent ? kinematics[link.parent].A_WB : A_WW;
+    CalcLinkPose(link, q, X_WP, &kin.X_WF, &kin.X_WB);
+
+    // The velocity and acceleration of B in P.
+    SpatialVelocity<T> V_PB_W = SpatialVelocity<T>::Zero();
+    SpatialAcceleration<T> A_PB_W = SpatialAcceleration<T>::Zero();
+    if (link.kind != JointKind::kWeld) {
+      kin.axis_W = kin.X_WF.rotation() * link.axis_F;
+      const T& v_k = v[link.velocity_index];
+      const T& vdot_k = vdot[link.velocity_index];
+      if (link.kind == JointKind::kRevolute) {
+        const Vector3<T> p_FoBo_W = kin.X_WB.translation() -
+                                    kin.X_WF.translation();
+        const Vector3<T> w_PB_W = kin.axis_W * v_k;
+        V_PB_W.rotational() = w_PB_W;
+        V_PB_W.translational() = w_PB_W.cross(p_FoBo_W);
+        A_PB_W.rotational() = kin.axis_W * vdot_k;
+        A_PB_W.translational() =
+            A_PB_W.rotational().cross(p_FoBo_W) +
+            w_PB_W.cross(V_PB_W.translational());
+      } else {
+        V_PB_W.translational() = kin.axis_W * v_k;
+        A_PB_W.translational() = kin.axis_W * vdot_k;
+      }
+    }
+    const Vector3<T> p_PoBo_W = kin.X_WB.translation() - X_WP.translation();
+    kin.V_WB = V_WP.ComposeWithMovingFrameVelocity(p_PoBo_W, V_PB_W);
+    kin.A_WB = A_WP.ComposeWithMovingFrameAcceleration(
+        p_PoBo_W, V_WP.rotational(), V_PB_W, A_PB_W);
+
+    // The force on B, about Bo, that its joint must supply for this motion,
+    // given that gravity supplies part of it.
+    const SpatialInertia<T> M_BBo_W =
+        link.M_BBo_B.ReExpress(kin.X_WB.rotation());
+    const Vector3<T>& w_WB = kin.V_WB.rotational();
+    const Vector3<T> p_BoBcm_W = M_BBo_W.get_com();
+    const SpatialForce<T> Fb_BBo_W =
+        M_BBo_W.get_mass() *
+        SpatialForce<T>(w_WB.cross(M_BBo_W.get_unit_inertia() * w_WB),
+                        w_WB.cross(w_WB.cross(p_BoBcm_W)));
+    kin.F_BBo_W = M_BBo_W * kin.A_WB + Fb_BBo_W;
+    if (link.gravity_enabled) {
+      const Vector3<T> f_Bcm_W = M_BBo_W.get_mass() * gravity_W_;
+      kin.F_BBo_W -= SpatialForce<T>(p_BoBcm_W.cross(f_Bcm_W), f_Bcm_W);
+    }
+  }
+
+  // Tip to base: each link's force includes the forces transmitted by its
+  // children, and its joint absorbs the component along the joint axis.
+  for (int k = static_cast<int>(links_.size()) - 1; k >= 0; --k) {
+    const Link& link = links_[k];
+    LinkKinematics& kin = kinematics[k];
+    if (link.kind != JointKind::kWeld) {
+      const int i = link.velocity_index;
+      if (link.kind == JointKind::kRevolute) {
+        const Vector3<T> p_BoFo_W =
+            kin.X_WF.translation() - kin.X_WB.translation();
+        (*tau)[i] =
+            kin.axis_W.dot(kin.F_BBo_W.Shift(p_BoFo_W).rotational());
+      } else {
+        (*tau)[i] = kin.axis_W.dot(kin.F_BBo_W.translational());
+      }
+      (*tau)[i] += link.reflected_inertia * vdot[i];
+    }
+    if (link.parent >= 0) {
+      LinkKinematics& parent = kinematics[link.parent];
+      parent.F_BBo_W += kin.F_BBo_W.Shift(parent.X_WB.translation() -
+                                          kin.X_WB.translation());
+    }
+  }
+}
+
+}  // namespace multibody
+}  // namespace drake
+
+DRAKE_DEFINE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS(
+    class drake::multibody::CompiledChain)
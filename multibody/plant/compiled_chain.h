@@ -0,0 +1,125 @@
+#pragma once
+
+#include <vector>
+
+#include "drake/common/default_scalars.h"
+#include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
+#include "drake/math/rigid_transform.h"
+#include "drake/multibody/plant/multibody_plant.h"
+#include "drake/multibody/tree/spatial_inertia.h"
+#include "drake/systems/framework/context.h"
+
+namespace drake {
+namespace multibody {
+
+/// A flat, precomputed copy of the kinematics and inertias of a
+/// MultibodyPlant whose joints are all revolute, prismatic or weld joints,
+/// such as a fixed-base arm like the iiwa. It evaluates forward kinematics,
+/// spatial velocity Jacobians and inverse dynamics in tight loops over a
+/// contiguous array of links, with no virtual calls, no cache bookkeeping and
+/// no Context, which makes it considerably faster than the corresponding
+/// MultibodyPlant queries for small models. It is meant for inner loops, e.g.,
+/// of inverse kinematics, that evaluate the same model many times.
+///
+/// All quantities are captured from the plant and the context on
+/// construction. Later changes to the parameters in the context (e.g., masses
+/// or frame offsets) are not reflected; construct a new %CompiledChain
+/// instead. Since for these joints q̇ = v, the same vector is used for q̇ and
+/// v. Despite the name, the model may have several branches.
+///
+/// @tparam_default_scalar
+template <typename T>
+class CompiledChain {
+ public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(CompiledChain)
+
+  /// Captures the model in `plant` with the parameters in `context`.
+  /// @throws std::exception if `plant` is not finalized, or if it contains a
+  ///   joint of another type, including the floating joints of free bodies.
+  CompiledChain(const MultibodyPlant<T>& plant,
+                const systems::Context<T>& context);
+
+  /// Returns the number of bodies, including the world body, as in the
+  /// plant.
+  int num_bodies() const { return static_cast<int>(link_of_body_.size()); }
+
+  /// Returns the number of generalized positions, which is also the number of
+  /// generalized velocities.
+  int num_velocities() const { return num_velocities_; }
+
+  /// Computes the pose X_WB of each body B in the world frame W, indexed by
+  /// BodyIndex. `X_WB` is resized to num_bodies() if needed.
+  /// @throws std::exception if `q` does not have num_velocities() entries or
+  ///   if `X_WB` is nullptr.
+  void CalcBodyPosesInWorld(const Eigen::Ref<const VectorX<T>>& q,
+                            std::vector<math::RigidTransform<T>>* X_WB) const;
+
+  /// Computes the Jacobian Js_V_WBp_W of the spatial velocity of a point Bp
+  /// fixed to body B, measured and expressed in the world frame W, with
+  /// respect to v (equivalently q̇), as MultibodyPlant::
+  /// CalcJacobianSpatialVelocity() does for frames A = E = W.
+  /// @param X_WB The body poses computed by CalcBodyPosesInWorld().
+  /// @param body_B The index of body B.
+  /// @param p_BoBp_B The position of Bp in B.
+  /// @param[out] Js_V_WBp_W The 6 x num_velocities() Jacobian.
+  /// @throws std::exception if `X_WB` does not have num_bodies() entries, if
+  ///   `body_B` is not valid, or if `Js_V_WBp_W` is nullptr or of the wrong
+  ///   size.
+  void CalcJacobianSpatialVelocity(
+      const std::vector<math::RigidTransform<T>>& X_WB, BodyIndex body_B,
+      const Vector3<T>& p_BoBp_B, EigenPtr<MatrixX<T>> Js_V_WBp_W) const;
+
+  /// Computes the generalized forces tau needed to produce the generalized
+  /// accelerations `vdot` at state (q, v) under gravity, with the recursive
+  /// Newton-Euler algorithm. This equals M(q)⋅v̇ + C(q, v)⋅v - τ_g(q),
+  /// including the reflected inertia of the joint actuators. Other force
+  /// elements, as well as joint damping, are not included.
+  /// @throws std::exception if `q`, `v` or `vdot` do not have
+  ///   num_velocities() entries, or if `tau` is nullptr or of the wrong size.
+  void CalcInverseDynamics(const Eigen::Ref<const VectorX<T>>& q,
+                           const Eigen::Ref<const VectorX<T>>& v,
+                           const Eigen::Ref<const VectorX<T>>& vdot,
+                           EigenPtr<VectorX<T>> tau) const;
+
+ private:
+  enum class JointKind { kRevolute, kPrismatic, kWeld };
+
+  // A body B, connected to its parent body P by a joint with frames F (on P)
+  // and M (on B).
+  struct Link {
+    BodyIndex body;
+    // The index in links_ of the parent, or -1 for the world.
+    int parent{-1};
+    JointKind kind{JointKind::kWeld};
+    // The index of the joint velocity, unused for welds.
+    int velocity_index{-1};
+    math::RigidTransform<T> X_PF;
+    // The joint axis, unused for welds.
+    Vector3<T> axis_F;
+    // For welds, this includes the fixed pose of M in F.
+    math::RigidTransform<T> X_MB;
+    SpatialInertia<T> M_BBo_B;
+    bool gravity_enabled{true};
+    T reflected_inertia{0.0};
+  };
+
+  // Computes X_WF and X_WB of `link`, given the pose X_WP of its parent.
+  void CalcLinkPose(const Link& link, const Eigen::Ref<const VectorX<T>>& q,
+                    const math::RigidTransform<T>& X_WP,
+                    math::RigidTransform<T>* X_WF,
+                    math::RigidTransform<T>* X_WB) const;
+
+  // Links in base to tip order, so that parents come before their children.
+  std::vector<Link> links_;
+  // The index in links_ of each body, or -1 for the world.
+  std::vector<int> link_of_body_;
+  int num_velocities_{0};
+  Vector3<T> gravity_W_;
+};
+
+}  // namespace multibody
+}  // namespace drake
+
+DRAKE_DECLARE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS(
+    class drake::multibody::CompiledChain)
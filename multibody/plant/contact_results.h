@@ -25,8 +25,10 @@ class MultibodyPlant;
 /**
  A container class storing the contact results information for each contact
  pair for a given state of the simulation. Note that copying this data structure
- is expensive when `num_hydroelastic_contacts() > 0` because a deep copy is
- performed.
+ is expensive when `num_hydroelastic_contacts() > 0` because a deep copy of the
+ contact surfaces is performed. The hydroelastic quadrature point data is
+ shared rather than copied, and can be left out altogether with
+ MultibodyPlant::set_report_hydroelastic_quadrature_data().
 
  @tparam_default_scalar
  */
@@ -176,6 +176,15 @@ systems::DiscreteStateIndex DeformableModel<T>::GetDiscreteStateIndex(
   return discrete_state_indexes_.at(id);
 }
 
+template <typename T>
+void DeformableModel<T>::SetParallelism(Parallelism parallelism) {
+  this->ThrowIfSystemResourcesDeclared(__func__);
+  parallelism_ = parallelism;
+  for (auto& [id, fem_model] : fem_models_) {
+    fem_model->set_parallelism(parallelism);
+  }
+}
+
 template <typename T>
 void DeformableModel<T>::AddExternalForce(
     std::unique_ptr<ForceDensityField<T>> force_density) {
@@ -302,6 +311,7 @@ void DeformableModel<T>::BuildLinearVolumetricModelHelper(
   builder.AddLinearTetrahedralElements(mesh, constitutive_model,
                                        config.mass_density(), damping_model);
   builder.Build();
+  fem_model->set_parallelism(parallelism_);
 
   fem_models_.emplace(id, std::move(fem_model));
 }
@@ -8,6 +8,7 @@
 
 #include "drake/common/eigen_types.h"
 #include "drake/common/identifier.h"
+#include "drake/common/parallelism.h"
 #include "drake/multibody/fem/deformable_body_config.h"
 #include "drake/multibody/fem/fem_model.h"
 #include "drake/multibody/plant/constraint_specs.h"
@@ -159,6 +160,17 @@ class DeformableModel final : public multibody::PhysicalModel<T> {
   const std::vector<const ForceDensityField<T>*>& GetExternalForces(
       DeformableBodyId id) const;
 
+  /** Sets the degree of parallelism used to evaluate the FEM models of the
+   deformable bodies, both those already registered and those registered
+   later. See fem::FemModel::set_parallelism() for details. Defaults to
+   Parallelism::None().
+   @throws std::exception if Finalize() has been called on the multibody plant
+           owning this deformable model. */
+  void SetParallelism(Parallelism parallelism);
+
+  /** Returns the degree of parallelism set with SetParallelism(). */
+  Parallelism parallelism() const { return parallelism_; }
+
   /** Returns the FemModel for the body with `id`.
    @throws exception if no deformable body with `id` is registered with `this`
    %DeformableModel. */
@@ -294,6 +306,7 @@ class DeformableModel final : public multibody::PhysicalModel<T> {
   std::map<MultibodyConstraintId, internal::DeformableRigidFixedConstraintSpec>
       fixed_constraint_specs_;
   systems::OutputPortIndex vertex_positions_port_index_;
+  Parallelism parallelism_{Parallelism::None()};
 };
 
 }  // namespace multibody
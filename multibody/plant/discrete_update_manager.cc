@@ -156,6 +156,16 @@ void DiscreteUpdateManager<T>::DeclareCacheEntries() {
   cache_indexes_.hydroelastic_contact_info =
       hydroelastic_contact_info_cache_entry.cache_index();
 
+  // Cache the flattened faces of the hydroelastic contact surfaces.
+  const auto& contact_surface_faces_cache_entry = DeclareCacheEntry(
+      "Hydroelastic contact surface faces.",
+      systems::ValueProducer(
+          this, &DiscreteUpdateManager<T>::CalcContactSurfaceFaces),
+      {systems::System<T>::xd_ticket(),
+       systems::System<T>::all_parameters_ticket()});
+  cache_indexes_.contact_surface_faces =
+      contact_surface_faces_cache_entry.cache_index();
+
   if constexpr (std::is_same_v<T, double>) {
     if (deformable_driver_ != nullptr) {
       deformable_driver_->DeclareCacheEntries(this);
@@ -620,9 +630,12 @@ void DiscreteUpdateManager<T>::CalcHydroelasticContactInfo(
   std::vector<SpatialForce<T>> F_Ao_W_per_surface(num_surfaces,
                                                   SpatialForce<T>::Zero());
 
+  // The quadrature point data is only computed when the plant reports it.
+  const bool report_quadrature_data =
+      plant().get_report_hydroelastic_quadrature_data();
   std::vector<std::vector<HydroelasticQuadraturePointData<T>>> quadrature_data(
-      num_surfaces);
-  for (int isurface = 0; isurface < num_surfaces; ++isurface) {
+      report_quadrature_data ? num_surfaces : 0);
+  for (int isurface = 0; isurface < ssize(quadrature_data); ++isurface) {
     quadrature_data[isurface].reserve(all_surfaces[isurface].num_faces());
   }
 
@@ -658,6 +671,8 @@ void DiscreteUpdateManager<T>::CalcHydroelasticContactInfo(
     // Accumulate force for the corresponding contact surface.
     F_Ao_W_per_surface[surface_index] += Fq_Ao_W;
 
+    if (!report_quadrature_data) continue;
+
     // Velocity of Aq relative to Bq in the tangent direction.
     // N.B. DiscreteUpdateManager<T>::CalcContactKinematics() uses the
     // convention of computing J_AcBc_C and thus J_AcBc_C * v = v_AcBc_W (i.e.
@@ -700,9 +715,11 @@ void DiscreteUpdateManager<T>::CalcHydroelasticContactInfo(
          per_tree_unlocked_indices[treeA_index].size() != 0) ||
         (treeB_has_dofs &&
          per_tree_unlocked_indices[treeB_index].size() != 0)) {
-      contact_info->emplace_back(&all_surfaces[surface_index],
-                                 F_Ao_W_per_surface[surface_index],
-                                 std::move(quadrature_data[surface_index]));
+      contact_info->emplace_back(
+          &all_surfaces[surface_index], F_Ao_W_per_surface[surface_index],
+          report_quadrature_data
+              ? std::move(quadrature_data[surface_index])
+              : std::vector<HydroelasticQuadraturePointData<T>>());
     }
   }
 }
@@ -791,13 +808,10 @@ void DiscreteUpdateManager<T>::AppendContactKinematics(
     const std::vector<DiscreteContactPair<T>>& contact_pairs,
     DiscreteContactType type,
     DiscreteContactData<ContactPairKinematics<T>>* contact_kinematics) const {
-  // Scratch workspace variables.
-  const int nv = plant().num_velocities();
-  Matrix3X<T> Jv_WAc_W(3, nv);
-  Matrix3X<T> Jv_WBc_W(3, nv);
-  Matrix3X<T> Jv_AcBc_W(3, nv);
+  // Scratch workspace for the Jacobian of a contact point on one body, within
+  // that body's tree.
+  Matrix3X<T> Jv_WBc_W_tree;
 
-  const Frame<T>& frame_W = plant().world_frame();
   for (int icontact = 0; icontact < ssize(contact_pairs); ++icontact) {
     const auto& point_pair = contact_pairs[icontact];
 
@@ -821,17 +835,6 @@ void DiscreteUpdateManager<T>::AppendContactKinematics(
     const Vector3<T>& p_WB = X_WB.translation();
     const Vector3<T> p_BC_W = p_WC - p_WB;
 
-    // Since v_AcBc_W = v_WBc - v_WAc the relative velocity Jacobian will be:
-    //   J_AcBc_W = Jv_WBc_W - Jv_WAc_W.
-    // That is the relative velocity at C is v_AcBc_W = J_AcBc_W * v.
-    internal_tree().CalcJacobianTranslationalVelocity(
-        context, JacobianWrtVariable::kV, bodyA.body_frame(), frame_W, p_WC,
-        frame_W, frame_W, &Jv_WAc_W);
-    internal_tree().CalcJacobianTranslationalVelocity(
-        context, JacobianWrtVariable::kV, bodyB.body_frame(), frame_W, p_WC,
-        frame_W, frame_W, &Jv_WBc_W);
-    Jv_AcBc_W = Jv_WBc_W - Jv_WAc_W;
-
     // Define a contact frame C at the contact point such that the z-axis Cz
     // equals nhat_W. The tangent vectors are arbitrary, with the only
     // requirement being that they form a valid right handed basis with nhat_W.
@@ -848,6 +851,32 @@ void DiscreteUpdateManager<T>::AppendContactKinematics(
     // Sanity check at least one body is not World or anchored to World.
     DRAKE_DEMAND(treeA_has_dofs || treeB_has_dofs);
 
+    // Since v_AcBc_W = v_WBc - v_WAc the relative velocity Jacobian will be:
+    //   J_AcBc_W = Jv_WBc_W - Jv_WAc_W.
+    // That is the relative velocity at C is v_AcBc_W = J_AcBc_W * v. Only the
+    // columns for the trees of A and B can be nonzero, so we compute the
+    // Jacobian one tree at a time, which keeps the cost per contact
+    // independent of the total number of velocities.
+    auto calc_tree_block = [&](TreeIndex tree_index) {
+      const int tree_nv = tree_topology().num_tree_velocities(tree_index);
+      Matrix3X<T> Jv_AcBc_W = Matrix3X<T>::Zero(3, tree_nv);
+      Jv_WBc_W_tree.resize(3, tree_nv);
+      if (treeB_has_dofs && treeB_index == tree_index) {
+        internal_tree().CalcTreeJacobianTranslationalVelocityInWorld(
+            context, bodyB_index, p_WC, &Jv_WBc_W_tree);
+        Jv_AcBc_W += Jv_WBc_W_tree;
+      }
+      if (treeA_has_dofs && treeA_index == tree_index) {
+        internal_tree().CalcTreeJacobianTranslationalVelocityInWorld(
+            context, bodyA_index, p_WC, &Jv_WBc_W_tree);
+        Jv_AcBc_W -= Jv_WBc_W_tree;
+      }
+      // Expressed in the contact frame C.
+      Matrix3X<T> J = R_WC.matrix().transpose() * Jv_AcBc_W;
+      return typename ContactPairKinematics<T>::JacobianTreeBlock(
+          tree_index, MatrixBlock<T>(std::move(J)));
+    };
+
     // We have at most two blocks per contact.
     std::vector<typename ContactPairKinematics<T>::JacobianTreeBlock>
         jacobian_blocks;
@@ -855,24 +884,14 @@ void DiscreteUpdateManager<T>::AppendContactKinematics(
 
     // Tree A contribution to contact Jacobian Jv_W_AcBc_C.
     if (treeA_has_dofs) {
-      Matrix3X<T> J =
-          R_WC.matrix().transpose() *
-          Jv_AcBc_W.middleCols(
-              tree_topology().tree_velocities_start_in_v(treeA_index),
-              tree_topology().num_tree_velocities(treeA_index));
-      jacobian_blocks.emplace_back(treeA_index, MatrixBlock<T>(std::move(J)));
+      jacobian_blocks.push_back(calc_tree_block(treeA_index));
     }
 
     // Tree B contribution to contact Jacobian Jv_W_AcBc_C.
     // This contribution must be added only if B is different from A.
     if ((treeB_has_dofs && !treeA_has_dofs) ||
         (treeB_has_dofs && treeB_index != treeA_index)) {
-      Matrix3X<T> J =
-          R_WC.matrix().transpose() *
-          Jv_AcBc_W.middleCols(
-              tree_topology().tree_velocities_start_in_v(treeB_index),
-              tree_topology().num_tree_velocities(treeB_index));
-      jacobian_blocks.emplace_back(treeB_index, MatrixBlock<T>(std::move(J)));
+      jacobian_blocks.push_back(calc_tree_block(treeB_index));
     }
 
     ContactConfiguration<T> configuration{.objectA = bodyA_index,
@@ -1066,6 +1085,23 @@ void DiscreteUpdateManager<symbolic::Expression>::
                   NiceTypeName::Get<symbolic::Expression>()));
 }
 
+template <typename T>
+void DiscreteUpdateManager<T>::CalcContactSurfaceFaces(
+    const systems::Context<T>& context,
+    geometry::internal::ContactSurfaceFaces<T>* faces) const {
+  DRAKE_DEMAND(faces != nullptr);
+  faces->Set(EvalContactSurfaces(context));
+}
+
+template <typename T>
+const geometry::internal::ContactSurfaceFaces<T>&
+DiscreteUpdateManager<T>::EvalContactSurfaceFaces(
+    const systems::Context<T>& context) const {
+  return plant()
+      .get_cache_entry(cache_indexes_.contact_surface_faces)
+      .template Eval<geometry::internal::ContactSurfaceFaces<T>>(context);
+}
+
 template <typename T>
 void DiscreteUpdateManager<T>::AppendDiscreteContactPairsForHydroelasticContact(
     const systems::Context<T>& context,
@@ -1085,6 +1121,9 @@ void DiscreteUpdateManager<T>::AppendDiscreteContactPairsForHydroelasticContact(
   const geometry::SceneGraphInspector<T>& inspector = query_object.inspector();
   const std::vector<geometry::ContactSurface<T>>& surfaces =
       EvalContactSurfaces(context);
+  const geometry::internal::ContactSurfaceFaces<T>& faces =
+      EvalContactSurfaceFaces(context);
+  DRAKE_DEMAND(faces.num_surfaces() == ssize(surfaces));
 
   const std::vector<std::vector<int>>& per_tree_unlocked_indices =
       EvalJointLockingCache(context).unlocked_velocity_indices_per_tree;
@@ -1137,8 +1176,9 @@ void DiscreteUpdateManager<T>::AppendDiscreteContactPairsForHydroelasticContact(
       const T mu =
           GetCombinedDynamicCoulombFriction(s.id_M(), s.id_N(), inspector);
 
-      for (int face = 0; face < s.num_faces(); ++face) {
-        const T& Ae = s.area(face);  // Face element area.
+      for (int f = faces.surface_begin(surface_index);
+           f < faces.surface_begin(surface_index + 1); ++f) {
+        const T& Ae = faces.area(f);  // Face element area.
 
         // We found out that the hydroelastic query might report
         // infinitesimally small triangles (consider for instance an initial
@@ -1152,20 +1192,16 @@ void DiscreteUpdateManager<T>::AppendDiscreteContactPairsForHydroelasticContact(
         if (Ae > 1.0e-14) {
           // From ContactSurface's documentation: The normal of each face is
           // guaranteed to point "out of" N and "into" M.
-          const Vector3<T>& nhat_W = s.face_normal(face);
+          const Vector3<T>& nhat_W = faces.normal_W(f);
 
           // One dimensional pressure gradient (in Pa/m). Unlike [Masterjohn
           // 2022], for convenience we define both pressure gradients
-          // to be positive in the direction "into" the bodies. Therefore,
-          // we use the minus sign for gN.
+          // to be positive in the direction "into" the bodies. They are
+          // infinite for a rigid body.
           // [Masterjohn 2022] Velocity Level Approximation of Pressure
           // Field Contact Patches.
-          const T gM = M_is_compliant
-                           ? s.EvaluateGradE_M_W(face).dot(nhat_W)
-                           : T(std::numeric_limits<double>::infinity());
-          const T gN = N_is_compliant
-                           ? -s.EvaluateGradE_N_W(face).dot(nhat_W)
-                           : T(std::numeric_limits<double>::infinity());
+          const T& gM = faces.grad_eM_into_M(f);
+          const T& gN = faces.grad_eN_into_N(f);
 
           constexpr double kGradientEpsilon = 1.0e-14;
           if (gM < kGradientEpsilon || gN < kGradientEpsilon) {
@@ -1185,20 +1221,9 @@ void DiscreteUpdateManager<T>::AppendDiscreteContactPairsForHydroelasticContact(
 
           // Position of quadrature point Q in the world frame (since mesh_W
           // is measured and expressed in W).
-          const Vector3<T>& p_WQ = s.centroid(face);
-          // For a triangle, its centroid has the fixed barycentric
-          // coordinates independent of the shape of the triangle. Using
-          // barycentric coordinates to evaluate field value could be
-          // faster than using Cartesian coordinates, especially if the
-          // TriangleSurfaceMeshFieldLinear<> does not store gradients and
-          // has to solve linear equations to convert Cartesian to
-          // barycentric coordinates.
-          const Vector3<T> tri_centroid_barycentric(1 / 3., 1 / 3., 1 / 3.);
+          const Vector3<T>& p_WQ = faces.centroid_W(f);
           // Pressure at the quadrature point.
-          const T p0 =
-              s.is_triangle()
-                  ? s.tri_e_MN().Evaluate(face, tri_centroid_barycentric)
-                  : s.poly_e_MN().EvaluateCartesian(face, p_WQ);
+          const T& p0 = faces.pressure(f);
 
           // Force contribution by this quadrature point.
           const T fn0 = Ae * p0;
@@ -1226,7 +1251,7 @@ void DiscreteUpdateManager<T>::AppendDiscreteContactPairsForHydroelasticContact(
                                        tau,
                                        mu,
                                        surface_index,
-                                       face,
+                                       faces.face_index(f),
                                        {} /* no point pair index */});
           }
         }
@@ -11,6 +11,7 @@
 #include "drake/geometry/geometry_ids.h"
 #include "drake/geometry/query_object.h"
 #include "drake/geometry/query_results/contact_surface.h"
+#include "drake/geometry/query_results/contact_surface_faces.h"
 #include "drake/multibody/contact_solvers/contact_solver_results.h"
 #include "drake/multibody/plant/constraint_specs.h"
 #include "drake/multibody/plant/contact_jacobians.h"
@@ -411,6 +412,7 @@ class DiscreteUpdateManager : public ScalarConvertibleComponent<T> {
     systems::CacheIndex contact_kinematics;
     systems::CacheIndex discrete_contact_pairs;
     systems::CacheIndex hydroelastic_contact_info;
+    systems::CacheIndex contact_surface_faces;
     systems::CacheIndex actuation;
   };
 
@@ -485,6 +487,17 @@ class DiscreteUpdateManager : public ScalarConvertibleComponent<T> {
       const systems::Context<T>& context,
       DiscreteContactData<DiscreteContactPair<T>>* pairs) const;
 
+  /* Calc version of EvalContactSurfaceFaces(). The storage of `faces` is
+   reused from one evaluation to the next. */
+  void CalcContactSurfaceFaces(
+      const systems::Context<T>& context,
+      geometry::internal::ContactSurfaceFaces<T>* faces) const;
+
+  /* Returns the faces of EvalContactSurfaces(), flattened into contiguous
+   per-face arrays. */
+  const geometry::internal::ContactSurfaceFaces<T>& EvalContactSurfaceFaces(
+      const systems::Context<T>& context) const;
+
   /* Given the configuration stored in `context`, this method appends discrete
    pairs corresponding to hydroelastic contact into `pairs`.
    @pre pairs != nullptr. */
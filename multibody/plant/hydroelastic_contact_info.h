@@ -6,6 +6,7 @@
 #include <vector>
 
 #include "drake/common/default_scalars.h"
+#include "drake/common/drake_assert.h"
 #include "drake/common/drake_copyable.h"
 #include "drake/common/eigen_types.h"
 #include "drake/geometry/query_results/contact_surface.h"
@@ -74,7 +75,10 @@ class HydroelasticContactInfo {
       std::vector<HydroelasticQuadraturePointData<T>>&& quadrature_point_data)
       : contact_surface_(contact_surface),
         F_Ac_W_(F_Ac_W),
-        quadrature_point_data_(std::move(quadrature_point_data)) {
+        quadrature_point_data_(
+            std::make_shared<
+                const std::vector<HydroelasticQuadraturePointData<T>>>(
+                std::move(quadrature_point_data))) {
     DRAKE_DEMAND(contact_surface != nullptr);
   }
 
@@ -89,7 +93,10 @@ class HydroelasticContactInfo {
       std::vector<HydroelasticQuadraturePointData<T>>&& quadrature_point_data)
       : contact_surface_(std::move(contact_surface)),
         F_Ac_W_(F_Ac_W),
-        quadrature_point_data_(std::move(quadrature_point_data)) {
+        quadrature_point_data_(
+            std::make_shared<
+                const std::vector<HydroelasticQuadraturePointData<T>>>(
+                std::move(quadrature_point_data))) {
     DRAKE_DEMAND(std::get<std::unique_ptr<geometry::ContactSurface<T>>>(
                      contact_surface_) != nullptr);
   }
@@ -103,6 +110,9 @@ class HydroelasticContactInfo {
    @note The new object will contain a cloned ContactSurface even if the
          original was constructed using a raw pointer referencing an existing
          ContactSurface.
+   @note Since the quadrature point data can't be modified after
+         construction, the copy shares it with the original rather than
+         duplicating it.
    */
   HydroelasticContactInfo(const HydroelasticContactInfo& info) { *this = info; }
 
@@ -135,10 +145,13 @@ class HydroelasticContactInfo {
   }
 
   /// Gets the intermediate data, including tractions, computed by the
-  /// quadrature process.
+  /// quadrature process. This is empty when the producing MultibodyPlant does
+  /// not report quadrature point data, see
+  /// MultibodyPlant::set_report_hydroelastic_quadrature_data().
   const std::vector<HydroelasticQuadraturePointData<T>>& quadrature_point_data()
       const {
-    return quadrature_point_data_;
+    DRAKE_ASSERT(quadrature_point_data_ != nullptr);
+    return *quadrature_point_data_;
   }
 
   /// Gets the spatial force applied on body A, at the centroid point C of the
@@ -156,8 +169,10 @@ class HydroelasticContactInfo {
   // The spatial force applied at the centroid (Point C) of the surface mesh.
   SpatialForce<T> F_Ac_W_;
 
-  // The traction and slip velocity evaluated at each quadrature point.
-  std::vector<HydroelasticQuadraturePointData<T>> quadrature_point_data_;
+  // The traction and slip velocity evaluated at each quadrature point. This is
+  // immutable, and shared among copies to keep copying cheap.
+  std::shared_ptr<const std::vector<HydroelasticQuadraturePointData<T>>>
+      quadrature_point_data_;
 };
 
 }  // namespace multibody
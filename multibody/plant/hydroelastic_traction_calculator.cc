@@ -8,7 +8,6 @@
 
 #include "drake/math/rotation_matrix.h"
 #include "drake/multibody/triangle_quadrature/gaussian_triangle_quadrature_rule.h"
-#include "drake/multibody/triangle_quadrature/triangle_quadrature.h"
 
 namespace drake {
 
@@ -40,48 +39,66 @@ void HydroelasticTractionCalculator<T>::
   // model) might see benefit from a higher-order quadrature.
   const GaussianTriangleQuadratureRule gaussian(2 /* order */);
 
-  // We'll be accumulating force on body A at the surface centroid C,
-  // triangle-by-triangle.
-  F_Ac_W->SetZero();
+  const std::vector<Eigen::Vector2d>& rule_points =
+      gaussian.quadrature_points();
+  const std::vector<double>& rule_weights = gaussian.weights();
+  const int num_rule_points = static_cast<int>(rule_weights.size());
+  DRAKE_DEMAND(num_rule_points >= 1);
+
+  // Gather all of the quadrature points of the surface: the rule's points on
+  // each triangle, or the centroid of each polygon.
+  const ContactSurface<T>& surface = data.surface;
+  const int num_faces = surface.num_faces();
+  const int points_per_face = surface.is_triangle() ? num_rule_points : 1;
+  QuadraturePoints points(num_faces * points_per_face);
+  for (int i = 0; i < num_faces; ++i) {
+    // Contact surfaces are documented to have face normals that point *out
+    // of* N and *into* M.
+    const Vector3<T>& nhat_W = surface.face_normal(i);
+    if (surface.is_triangle()) {
+      for (int q = 0; q < num_rule_points; ++q) {
+        const typename TriangleSurfaceMesh<T>::template Barycentric<T>
+            Q_barycentric(rule_points[q][0], rule_points[q][1],
+                          T(1.0) - rule_points[q][0] - rule_points[q][1]);
+        points.Set(i * num_rule_points + q, i,
+                   surface.tri_mesh_W().CalcCartesianFromBarycentric(
+                       i, Q_barycentric),
+                   nhat_W, surface.tri_e_MN().Evaluate(i, Q_barycentric));
+      }
+    } else {
+      const Vector3<T>& p_WC = surface.centroid(i);
+      points.Set(i, i, p_WC, nhat_W,
+                 surface.poly_e_MN().EvaluateCartesian(i, p_WC));
+    }
+  }
 
-  // Reserve enough memory to keep from doing repeated heap allocations in the
-  // quadrature process.
+  // Compute the tractions at all of the points at once.
   traction_at_quadrature_points->clear();
-  traction_at_quadrature_points->reserve(data.surface.num_faces());
-
-  // Integrate the tractions over all triangles in the contact surface.
-  for (int i = 0; i < data.surface.num_faces(); ++i) {
-    // Construct the function to be integrated over triangle i.
-    // TODO(sherm1) Pull functor creation out of the loop (not a good idea to
-    //              create a new functor for every i).
-    if (data.surface.is_triangle()) {
-      std::function<SpatialForce<T>(const Vector3<T>&)> traction_Ac_W =
-          [this, &data, i, dissipation, mu_coulomb,
-           traction_at_quadrature_points](const Vector3<T>& Q_barycentric) {
-            traction_at_quadrature_points->emplace_back(CalcTractionAtPoint(
-                data, i, Q_barycentric, dissipation, mu_coulomb));
-            const HydroelasticQuadraturePointData<T>& traction_output =
-                traction_at_quadrature_points->back();
-            return ComputeSpatialTractionAtAcFromTractionAtAq(
-                data, traction_output.p_WQ, traction_output.traction_Aq_W);
-          };
+  traction_at_quadrature_points->resize(points.size());
+  CalcTractionsAtPoints(data, points, dissipation, mu_coulomb,
+                        traction_at_quadrature_points->data());
 
-      // Compute the integral over the triangle to get a force from the
-      // tractions (force/area) at the Gauss points (shifted to C).
-      const SpatialForce<T> Fi_Ac_W =  // Force from triangle i.
-          TriangleQuadrature<SpatialForce<T>, T>::Integrate(
-              traction_Ac_W, gaussian, data.surface.area(i));
-      // Update the spatial force at the centroid.
-      (*F_Ac_W) += Fi_Ac_W;
+  // Integrate the tractions over all faces of the contact surface,
+  // accumulating the force on body A at the surface centroid C.
+  F_Ac_W->SetZero();
+  for (int i = 0; i < num_faces; ++i) {
+    const HydroelasticQuadraturePointData<T>* face_tractions =
+        traction_at_quadrature_points->data() + i * points_per_face;
+    // The spatial traction at Ac due to the traction at the k'th point.
+    auto traction_Ac_W = [this, &data, face_tractions](int k) {
+      return ComputeSpatialTractionAtAcFromTractionAtAq(
+          data, face_tractions[k].p_WQ, face_tractions[k].traction_Aq_W);
+    };
+    if (surface.is_triangle()) {
+      // The weighted sum of the tractions at the Gauss points, times the area
+      // (as in TriangleQuadrature::Integrate()).
+      SpatialForce<T> Fi_Ac_W = traction_Ac_W(0) * rule_weights[0];
+      for (int q = 1; q < num_rule_points; ++q) {
+        Fi_Ac_W += traction_Ac_W(q) * rule_weights[q];
+      }
+      (*F_Ac_W) += Fi_Ac_W * surface.area(i);
     } else {
-      traction_at_quadrature_points->emplace_back(
-          CalcTractionAtCentroid(data, i, dissipation, mu_coulomb));
-      const HydroelasticQuadraturePointData<T>& traction_output =
-          traction_at_quadrature_points->back();
-      const SpatialForce<T> traction_Ac_W =
-          ComputeSpatialTractionAtAcFromTractionAtAq(
-              data, traction_output.p_WQ, traction_output.traction_Aq_W);
-      (*F_Ac_W) += data.surface.area(i) * traction_Ac_W;
+      (*F_Ac_W) += surface.area(i) * traction_Ac_W(0);
     }
   }
 }
@@ -135,31 +152,6 @@ HydroelasticTractionCalculator<T>::ComputeSpatialTractionAtAcFromTractionAtAq(
   return Ft_Ac_W;  // Still a traction (force/area).
 }
 
-// Method for computing traction at a point on a face of the contact surface.
-template <typename T>
-HydroelasticQuadraturePointData<T>
-HydroelasticTractionCalculator<T>::CalcTractionAtPoint(
-    const Data& data, int face_index,
-    // NOLINTNEXTLINE(runtime/references): "template Bar..." confuses cpplint.
-    const typename TriangleSurfaceMesh<T>::template Barycentric<T>&
-        Q_barycentric,
-    double dissipation, double mu_coulomb) const {
-  // Compute the point of contact in the world frame.
-  const Vector3<T> p_WQ =
-      data.surface.tri_mesh_W().CalcCartesianFromBarycentric(face_index,
-                                                             Q_barycentric);
-
-  const T e = data.surface.tri_e_MN().Evaluate(face_index, Q_barycentric);
-
-  // Contact surfaces are documented to have face normals that point *out of* N
-  // and *into* M -- which is the face normal of the contact surface (as
-  // documented).
-  const Vector3<T> nhat_W = data.surface.face_normal(face_index);
-
-  return CalcTractionAtQHelper(data, face_index, e, nhat_W, dissipation,
-                               mu_coulomb, p_WQ);
-}
-
 template <typename T>
 HydroelasticQuadraturePointData<T>
 HydroelasticTractionCalculator<T>::CalcTractionAtCentroid(
@@ -207,48 +199,72 @@ HydroelasticQuadraturePointData<T>
 HydroelasticTractionCalculator<T>::CalcTractionAtQHelper(
     const Data& data, int face_index, const T& e, const Vector3<T>& nhat_W,
     double dissipation, double mu_coulomb, const Vector3<T>& p_WQ) const {
+  QuadraturePoints points(1);
+  points.Set(0, face_index, p_WQ, nhat_W, e);
   HydroelasticQuadraturePointData<T> traction_data;
+  CalcTractionsAtPoints(data, points, dissipation, mu_coulomb, &traction_data);
+  return traction_data;
+}
 
-  // Set entries that do not require computation first.
-  traction_data.face_index = face_index;
-  traction_data.p_WQ = p_WQ;
-
-  // Get the relative spatial velocity at the point Q between the
-  // two bodies A and B (to which M and N are affixed, respectively) by
-  // subtracting the spatial velocity of a point (Bq) coincident with p_WQ on
-  // Body B from the spatial velocity of a point (Aq) coincident with p_WQ on
-  // Body A.
-
-  // First compute the spatial velocity of Body A at Aq.
-  const Vector3<T> p_AoAq_W = traction_data.p_WQ - data.X_WA.translation();
-  const SpatialVelocity<T> V_WAq = data.V_WA.Shift(p_AoAq_W);
-
-  // Next compute the spatial velocity of Body B at Bq.
-  const Vector3<T> p_BoBq_W = traction_data.p_WQ - data.X_WB.translation();
-  const SpatialVelocity<T> V_WBq = data.V_WB.Shift(p_BoBq_W);
-
-  // Finally compute the relative velocity of Frame Aq relative to Frame Bq,
-  // expressed in the world frame, and then the translational component of this
-  // velocity.
-  const SpatialVelocity<T> V_BqAq_W = V_WAq - V_WBq;
-  const Vector3<T>& v_BqAq_W = V_BqAq_W.translational();
+template <typename T>
+void HydroelasticTractionCalculator<T>::CalcTractionsAtPoints(
+    const Data& data, const QuadraturePoints& points, double dissipation,
+    double mu_coulomb, HydroelasticQuadraturePointData<T>* output) const {
+  using ArrayX = Eigen::Array<T, Eigen::Dynamic, 1>;
+  using Columns = Eigen::Matrix<T, Eigen::Dynamic, 3>;
+  const int num_points = points.size();
+  const Columns& p_WQ = points.p_WQ;
+  const Columns& nhat_W = points.nhat_W;
+  const auto e = points.e.array();
+
+  // Get the relative spatial velocity at each point Q between the two bodies
+  // A and B (to which M and N are affixed, respectively) by subtracting the
+  // velocity of a point (Bq) coincident with p_WQ on Body B from the velocity
+  // of a point (Aq) coincident with p_WQ on Body A. The velocity of the point
+  // of body F coincident with Q is v_WFo + w_WF × p_FoFq_W (see
+  // SpatialVelocity::Shift()).
+  auto calc_v_WFq = [&p_WQ, num_points](const math::RigidTransform<T>& X_WF,
+                                        const SpatialVelocity<T>& V_WF) {
+    const Vector3<T>& p_WFo = X_WF.translation();
+    const Vector3<T>& w = V_WF.rotational();
+    const Vector3<T>& v = V_WF.translational();
+    const ArrayX x = p_WQ.col(0).array() - p_WFo(0);
+    const ArrayX y = p_WQ.col(1).array() - p_WFo(1);
+    const ArrayX z = p_WQ.col(2).array() - p_WFo(2);
+    Columns v_WFq(num_points, 3);
+    v_WFq.col(0).array() = v(0) + (w(1) * z - w(2) * y);
+    v_WFq.col(1).array() = v(1) + (w(2) * x - w(0) * z);
+    v_WFq.col(2).array() = v(2) + (w(0) * y - w(1) * x);
+    return v_WFq;
+  };
+  const Columns v_BqAq_W =
+      calc_v_WFq(data.X_WA, data.V_WA) - calc_v_WFq(data.X_WB, data.V_WB);
 
   // Get the velocity along the normal to the contact surface. Note that a
   // positive value indicates that bodies are separating at Q while a negative
   // value indicates that bodies are approaching at Q.
-  const T vn_BqAq_W = v_BqAq_W.dot(nhat_W);
+  const ArrayX vn_BqAq_W =
+      v_BqAq_W.col(0).array() * nhat_W.col(0).array() +
+      v_BqAq_W.col(1).array() * nhat_W.col(1).array() +
+      v_BqAq_W.col(2).array() * nhat_W.col(2).array();
 
   // Get the damping value (c) from the compliant model dissipation (α).
   // Equation (16) from [Hunt 1975], but neglecting the 3/2 term used for
-  // Hertzian contact, yields c = α * e_mn with units of N⋅s/m³.
-  const T c = dissipation * e;
-
-  // Determine the normal traction at the point.
-  using std::max;
-  const T normal_traction = max(e - vn_BqAq_W * c, T(0));
-
-  // Get the slip velocity at the point.
-  traction_data.vt_BqAq_W = v_BqAq_W - nhat_W * vn_BqAq_W;
+  // Hertzian contact, yields c = α * e_mn with units of N⋅s/m³. The normal
+  // traction is then max(e - vn * c, 0).
+  const ArrayX damped_traction = e - vn_BqAq_W * (dissipation * e);
+
+  // Get the slip velocity at each point.
+  Columns vt_BqAq_W(num_points, 3);
+  for (int k = 0; k < 3; ++k) {
+    vt_BqAq_W.col(k).array() =
+        v_BqAq_W.col(k).array() - nhat_W.col(k).array() * vn_BqAq_W;
+  }
+  const double vs_squared = vslip_regularizer_ * vslip_regularizer_;
+  const ArrayX x_squared = (vt_BqAq_W.col(0).array().square() +
+                           vt_BqAq_W.col(1).array().square() +
+                           vt_BqAq_W.col(2).array().square()) /
+                          vs_squared;
 
   // We write our regularized model of friction as:
   //   fₜ = −μᵣ(‖vₜ‖) vₜ/‖vₜ‖ fₙ                                             (1)
@@ -272,18 +288,23 @@ HydroelasticTractionCalculator<T>::CalcTractionAtQHelper(
   // unique) and therefore we can write a custom implementation that avoids
   // division by zero at x = 0. This custom implementation is provided by
   // CalcAtanXOverXFromXSquared().
-  const Vector3<T>& vt_BqAq_W = traction_data.vt_BqAq_W;
-  const double vs_squared = vslip_regularizer_ * vslip_regularizer_;
-  const T x_squared = vt_BqAq_W.squaredNorm() / vs_squared;
-  const T regularized_friction = (2.0 / M_PI) * mu_coulomb * normal_traction *
-                                 CalcAtanXOverXFromXSquared(x_squared) /
-                                 vslip_regularizer_;  // [Ns/m].
-  const Vector3<T> ft_Aq_W = -regularized_friction * vt_BqAq_W;
-
-  // Compute the traction.
-  traction_data.traction_Aq_W = nhat_W * normal_traction + ft_Aq_W;
-
-  return traction_data;
+  using std::max;
+  for (int i = 0; i < num_points; ++i) {
+    HydroelasticQuadraturePointData<T>& traction_data = output[i];
+    traction_data.face_index = points.face_index[i];
+    traction_data.p_WQ = p_WQ.row(i).transpose();
+    traction_data.vt_BqAq_W = vt_BqAq_W.row(i).transpose();
+    const T normal_traction = max(damped_traction(i), T(0));
+    const T regularized_friction =
+        (2.0 / M_PI) * mu_coulomb * normal_traction *
+        CalcAtanXOverXFromXSquared(x_squared(i)) /
+        vslip_regularizer_;  // [Ns/m].
+    const Vector3<T> ft_Aq_W = -regularized_friction * traction_data.vt_BqAq_W;
+
+    // Compute the traction.
+    traction_data.traction_Aq_W =
+        nhat_W.row(i).transpose() * normal_traction + ft_Aq_W;
+  }
 }
 
 template <typename T>
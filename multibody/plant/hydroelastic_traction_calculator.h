@@ -141,11 +141,37 @@ class HydroelasticTractionCalculator {
   friend class HydroelasticReportingTests_LinearTraction_Test;
   friend class HydroelasticReportingTests_LinearSlipVelocity_Test;
 
-  HydroelasticQuadraturePointData<T> CalcTractionAtPoint(
-      const Data& data, int face_index,
-      const typename geometry::TriangleSurfaceMesh<T>::template Barycentric<T>&
-          Q_barycentric,
-      double dissipation, double mu_coulomb) const;
+  // The quadrature points of a contact surface, stored as a structure of
+  // arrays (one contiguous column per coordinate) so that the tractions at all
+  // of the points can be computed together with vectorized array operations.
+  struct QuadraturePoints {
+    explicit QuadraturePoints(int num_points)
+        : face_index(num_points),
+          p_WQ(num_points, 3),
+          nhat_W(num_points, 3),
+          e(num_points) {}
+
+    int size() const { return static_cast<int>(face_index.size()); }
+
+    void Set(int i, int face, const Vector3<T>& p_WQ_in,
+             const Vector3<T>& nhat_W_in, const T& e_in) {
+      face_index[i] = face;
+      p_WQ.row(i) = p_WQ_in.transpose();
+      nhat_W.row(i) = nhat_W_in.transpose();
+      e(i) = e_in;
+    }
+
+    std::vector<int> face_index;
+    Eigen::Matrix<T, Eigen::Dynamic, 3> p_WQ;
+    Eigen::Matrix<T, Eigen::Dynamic, 3> nhat_W;
+    VectorX<T> e;
+  };
+
+  // Computes the traction and slip velocity at each of the given points,
+  // writing the results to output[0, points.size()).
+  void CalcTractionsAtPoints(const Data& data, const QuadraturePoints& points,
+                             double dissipation, double mu_coulomb,
+                             HydroelasticQuadraturePointData<T>* output) const;
 
   HydroelasticQuadraturePointData<T> CalcTractionAtCentroid(
       const Data& data, int face_index, double dissipation,
@@ -414,6 +414,8 @@ MultibodyPlant<T>::MultibodyPlant(const MultibodyPlant<U>& other)
 
     adjacent_bodies_collision_filters_ =
         other.adjacent_bodies_collision_filters_;
+    report_hydroelastic_quadrature_data_ =
+        other.report_hydroelastic_quadrature_data_;
   }
 
   DeclareSceneGraphPorts();
@@ -1223,6 +1225,62 @@ MatrixX<T> MultibodyPlant<T>::MakeActuationMatrix() const {
   return B;
 }
 
+template <typename T>
+StateSelector MultibodyPlant<T>::MakeStateSelector(
+    const std::vector<ModelInstanceIndex>& model_instances) const {
+  DRAKE_MBP_THROW_IF_NOT_FINALIZED();
+  // Gathering from vectors whose entries are their own indices yields the
+  // indices of each model instance, in the order GetPositions() uses.
+  const VectorX<T> q_indices =
+      Eigen::VectorXd::LinSpaced(num_positions(), 0, num_positions() - 1)
+          .template cast<T>();
+  const VectorX<T> v_indices =
+      Eigen::VectorXd::LinSpaced(num_velocities(), 0, num_velocities() - 1)
+          .template cast<T>();
+  std::vector<int> position_indices;
+  std::vector<int> velocity_indices;
+  std::vector<bool> is_selected(num_model_instances(), false);
+  for (const ModelInstanceIndex model_instance : model_instances) {
+    DRAKE_THROW_UNLESS(model_instance.is_valid() &&
+                       model_instance < num_model_instances());
+    if (is_selected[model_instance]) {
+      throw std::logic_error(fmt::format(
+          "MakeStateSelector(): model instance '{}' is repeated",
+          GetModelInstanceName(model_instance)));
+    }
+    is_selected[model_instance] = true;
+    const VectorX<T> q = GetPositionsFromArray(model_instance, q_indices);
+    for (int i = 0; i < q.size(); ++i) {
+      position_indices.push_back(static_cast<int>(ExtractDoubleOrThrow(q[i])));
+    }
+    const VectorX<T> v = GetVelocitiesFromArray(model_instance, v_indices);
+    for (int i = 0; i < v.size(); ++i) {
+      velocity_indices.push_back(static_cast<int>(ExtractDoubleOrThrow(v[i])));
+    }
+  }
+  return StateSelector(num_positions(), num_velocities(), position_indices,
+                       velocity_indices);
+}
+
+template <typename T>
+StateSelector MultibodyPlant<T>::MakeStateSelector(
+    const std::vector<JointIndex>& joints) const {
+  DRAKE_MBP_THROW_IF_NOT_FINALIZED();
+  std::vector<int> position_indices;
+  std::vector<int> velocity_indices;
+  for (const JointIndex joint_index : joints) {
+    const Joint<T>& joint = get_joint(joint_index);
+    for (int i = 0; i < joint.num_positions(); ++i) {
+      position_indices.push_back(joint.position_start() + i);
+    }
+    for (int i = 0; i < joint.num_velocities(); ++i) {
+      velocity_indices.push_back(joint.velocity_start() + i);
+    }
+  }
+  return StateSelector(num_positions(), num_velocities(), position_indices,
+                       velocity_indices);
+}
+
 namespace {
 
 void ThrowForDisconnectedGeometryPort(std::string_view explanation) {
@@ -2054,7 +2112,6 @@ void MultibodyPlant<T>::CalcHydroelasticContactForces(
 
   std::vector<SpatialForce<T>>& F_BBo_W_array =
       contact_info_and_body_forces->F_BBo_W_array;
-  DRAKE_DEMAND(ssize(F_BBo_W_array) == num_bodies());
   std::vector<HydroelasticContactInfo<T>>& contact_info =
       contact_info_and_body_forces->contact_info;
 
@@ -2073,6 +2130,9 @@ void MultibodyPlant<T>::CalcHydroelasticContactForces(
   internal::HydroelasticTractionCalculator<T> traction_calculator(
       friction_model_.stiction_tolerance());
 
+  // Scratch storage for the quadrature point data, for when it is not reported.
+  std::vector<HydroelasticQuadraturePointData<T>> traction_output;
+
   const auto& query_object = EvalGeometryQueryInput(context, __func__);
   const geometry::SceneGraphInspector<T>& inspector = query_object.inspector();
 
@@ -2127,7 +2187,6 @@ void MultibodyPlant<T>::CalcHydroelasticContactForces(
         geometryM_id, geometryN_id, inspector);
 
     // Integrate the hydroelastic traction field over the contact surface.
-    std::vector<HydroelasticQuadraturePointData<T>> traction_output;
     SpatialForce<T> F_Ac_W;
     traction_calculator.ComputeSpatialForcesAtCentroidFromHydroelasticModel(
         data, dissipation, dynamic_friction, &traction_output, &F_Ac_W);
@@ -2146,7 +2205,12 @@ void MultibodyPlant<T>::CalcHydroelasticContactForces(
     }
 
     // Add the information for contact reporting.
-    contact_info.emplace_back(&surface, F_Ac_W, std::move(traction_output));
+    if (report_hydroelastic_quadrature_data_) {
+      contact_info.emplace_back(&surface, F_Ac_W, std::move(traction_output));
+    } else {
+      contact_info.emplace_back(
+          &surface, F_Ac_W, std::vector<HydroelasticQuadraturePointData<T>>());
+    }
   }
 }
 
@@ -2551,12 +2615,11 @@ void MultibodyPlant<T>::CalcGeneralizedContactForcesContinuous(
     const Context<T>& context, VectorX<T>* tau_contact) const {
   this->ValidateContext(context);
   DRAKE_DEMAND(tau_contact != nullptr);
-  DRAKE_DEMAND(tau_contact->size() == num_velocities());
   DRAKE_DEMAND(!is_discrete());
   const int nv = this->num_velocities();
 
   // Early exit if there are no contact forces.
-  tau_contact->setZero();
+  tau_contact->setZero(nv);
   if (num_collision_geometries() == 0) return;
 
   // We will alias this zero vector to serve both as zero-valued generalized
@@ -2592,12 +2655,10 @@ void MultibodyPlant<T>::CalcSpatialContactForcesContinuous(
     std::vector<SpatialForce<T>>* F_BBo_W_array) const {
   this->ValidateContext(context);
   DRAKE_DEMAND(F_BBo_W_array != nullptr);
-  DRAKE_DEMAND(ssize(*F_BBo_W_array) == num_bodies());
   DRAKE_DEMAND(!is_discrete());
 
   // Forces can accumulate into F_BBo_W_array; initialize it to zero first.
-  std::fill(F_BBo_W_array->begin(), F_BBo_W_array->end(),
-            SpatialForce<T>::Zero());
+  F_BBo_W_array->assign(num_bodies(), SpatialForce<T>::Zero());
 
   CalcAndAddSpatialContactForcesContinuous(context, F_BBo_W_array);
 }
@@ -2763,6 +2824,20 @@ void MultibodyPlant<T>::DeclareStateCacheAndPorts() {
   DeclareCacheEntries();
   DeclareParameters();
 
+  // The geometry_pose port is declared at construction, before the position
+  // kinematics cache entry exists, with the conservative configuration_ticket()
+  // as its prerequisite. Now that it exists, depend on it instead, so that the
+  // geometry poses are not invalidated by, e.g., changing the mass of a body.
+  {
+    const auto& leaf_port = dynamic_cast<const systems::LeafOutputPort<T>&>(
+        this->get_output_port(geometry_pose_port_));
+    std::set<systems::DependencyTicket>& prerequisites =
+        this->get_mutable_cache_entry(leaf_port.cache_entry().cache_index())
+            .mutable_prerequisites();
+    prerequisites.clear();
+    prerequisites.insert(this->position_kinematics_cache_entry().ticket());
+  }
+
   // State ticket.
   const systems::DependencyTicket state_ticket =
       is_discrete() ? this->xd_ticket() : this->kinematics_ticket();
@@ -2852,7 +2927,7 @@ void MultibodyPlant<T>::DeclareStateCacheAndPorts() {
       this->DeclareAbstractOutputPort(
               "body_poses", std::vector<math::RigidTransform<T>>(num_bodies()),
               &MultibodyPlant<T>::CalcBodyPosesOutput,
-              {this->configuration_ticket()})
+              {this->position_kinematics_cache_entry().ticket()})
           .get_index();
 
   // Declare the output port for the spatial velocities of all bodies in the
@@ -2862,7 +2937,7 @@ void MultibodyPlant<T>::DeclareStateCacheAndPorts() {
               "spatial_velocities",
               std::vector<SpatialVelocity<T>>(num_bodies()),
               &MultibodyPlant<T>::CalcBodySpatialVelocitiesOutput,
-              {this->kinematics_ticket()})
+              {this->velocity_kinematics_cache_entry().ticket()})
           .get_index();
 
   // Declare the output port for the spatial accelerations of all bodies in the
@@ -3021,9 +3096,18 @@ template <typename T>
 void MultibodyPlant<T>::DeclareCacheEntries() {
   DRAKE_DEMAND(this->is_finalized());
 
-  // TODO(joemasterjohn): Create more granular parameter tickets for finer
-  // control over cache dependencies on parameters. For example,
-  // all_rigid_body_parameters, etc.
+  // N.B. The contact queries below depend on the configuration through the
+  // geometry poses, which only depend on the position kinematics. Listing the
+  // position kinematics instead of configuration_ticket() means that changing
+  // the mass properties of a body (or any other parameter that does not affect
+  // kinematics) does not invalidate them.
+
+  // N.B. The per-body storage of the contact force entries below is sized by
+  // their Calc functions on first evaluation, rather than by their model
+  // values. That keeps creating (and cloning) contexts of large plants cheap,
+  // and never allocates the entries that a given plant does not use (e.g., the
+  // continuous contact forces of a discrete plant). The output ports keep
+  // their sized model values, since OutputPort::Allocate() is public API.
 
   // TODO(SeanCurtis-TRI): When SG caches the results of these queries itself,
   //  (https://github.com/RobotLocomotion/drake/issues/12767), remove these
@@ -3031,20 +3115,21 @@ void MultibodyPlant<T>::DeclareCacheEntries() {
   auto& hydro_point_cache_entry = this->DeclareCacheEntry(
       std::string("Hydroelastic contact with point-pair fallback"),
       &MultibodyPlant::CalcHydroelasticWithFallback,
-      {this->configuration_ticket()});
+      {this->position_kinematics_cache_entry().ticket()});
   cache_indexes_.hydro_fallback = hydro_point_cache_entry.cache_index();
 
   // Cache entry for point contact queries.
-  auto& point_pairs_cache_entry =
-      this->DeclareCacheEntry(std::string("Point pair penetrations."),
-                              &MultibodyPlant<T>::CalcPointPairPenetrations,
-                              {this->configuration_ticket()});
+  auto& point_pairs_cache_entry = this->DeclareCacheEntry(
+      std::string("Point pair penetrations."),
+      &MultibodyPlant<T>::CalcPointPairPenetrations,
+      {this->position_kinematics_cache_entry().ticket()});
   cache_indexes_.point_pairs = point_pairs_cache_entry.cache_index();
 
   // Cache entry for hydroelastic contact surfaces.
   auto& contact_surfaces_cache_entry = this->DeclareCacheEntry(
       std::string("Hydroelastic contact surfaces."),
-      &MultibodyPlant<T>::CalcContactSurfaces, {this->configuration_ticket()});
+      &MultibodyPlant<T>::CalcContactSurfaces,
+      {this->position_kinematics_cache_entry().ticket()});
   cache_indexes_.contact_surfaces = contact_surfaces_cache_entry.cache_index();
 
   // Cache entry for spatial forces and contact info due to hydroelastic
@@ -3056,8 +3141,7 @@ void MultibodyPlant<T>::DeclareCacheEntries() {
     auto& contact_info_and_body_spatial_forces_cache_entry =
         this->DeclareCacheEntry(
             std::string("Hydroelastic contact info and body spatial forces."),
-            internal::HydroelasticContactInfoAndBodySpatialForces<T>(
-                this->num_bodies()),
+            internal::HydroelasticContactInfoAndBodySpatialForces<T>(0),
             &MultibodyPlant<T>::CalcHydroelasticContactForces,
             // Compliant contact forces due to hydroelastics with Hunt &
             // Crosseley are function of the kinematic variables q & v only.
@@ -3088,8 +3172,7 @@ void MultibodyPlant<T>::DeclareCacheEntries() {
 
   // Cache spatial continuous contact forces.
   auto& spatial_contact_forces_continuous_cache_entry = this->DeclareCacheEntry(
-      "Spatial contact forces (continuous).",
-      std::vector<SpatialForce<T>>(num_bodies()),
+      "Spatial contact forces (continuous).", std::vector<SpatialForce<T>>(),
       &MultibodyPlant::CalcSpatialContactForcesContinuous,
       {this->kinematics_ticket(), this->all_parameters_ticket()});
   cache_indexes_.spatial_contact_forces_continuous =
@@ -3098,8 +3181,7 @@ void MultibodyPlant<T>::DeclareCacheEntries() {
   // Cache generalized continuous contact forces.
   auto& generalized_contact_forces_continuous_cache_entry =
       this->DeclareCacheEntry(
-          "Generalized contact forces (continuous).",
-          VectorX<T>(num_velocities()),
+          "Generalized contact forces (continuous).", VectorX<T>(),
           &MultibodyPlant::CalcGeneralizedContactForcesContinuous,
           {this->cache_entry_ticket(
                cache_indexes_.spatial_contact_forces_continuous),
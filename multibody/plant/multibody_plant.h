@@ -16,6 +16,7 @@
 
 #include "drake/common/default_scalars.h"
 #include "drake/common/nice_type_name.h"
+#include "drake/common/parallelism.h"
 #include "drake/common/random.h"
 #include "drake/geometry/scene_graph.h"
 #include "drake/math/rigid_transform.h"
@@ -26,10 +27,13 @@
 #include "drake/multibody/plant/discrete_update_manager.h"
 #include "drake/multibody/plant/multibody_plant_config.h"
 #include "drake/multibody/plant/physical_model.h"
+#include "drake/multibody/plant/state_selector.h"
 #include "drake/multibody/topology/multibody_graph.h"
 #include "drake/multibody/tree/force_element.h"
+#include "drake/multibody/tree/mass_matrix_factorization.h"
 #include "drake/multibody/tree/multibody_tree-inl.h"
 #include "drake/multibody/tree/multibody_tree_system.h"
+#include "drake/multibody/tree/multibody_workspace.h"
 #include "drake/multibody/tree/rigid_body.h"
 #include "drake/multibody/tree/weld_joint.h"
 #include "drake/systems/framework/diagram_builder.h"
@@ -2210,6 +2214,26 @@ class MultibodyPlant : public internal::MultibodyTreeSystem<T> {
     return adjacent_bodies_collision_filters_;
   }
 
+  /// Sets whether the HydroelasticContactInfo in the contact results reports
+  /// the data at each quadrature point of the contact surface, see
+  /// HydroelasticContactInfo::quadrature_point_data(). When `value` is false,
+  /// that data is left empty, and only the contact surface and the resultant
+  /// spatial force of each contact pair are reported. This saves computing,
+  /// storing and copying the per-point data for every evaluation of the
+  /// contact results, e.g., when these are only visualized. It is true by
+  /// default.
+  /// @throws std::exception iff called post-finalize.
+  void set_report_hydroelastic_quadrature_data(bool value) {
+    DRAKE_MBP_THROW_IF_FINALIZED();
+    report_hydroelastic_quadrature_data_ = value;
+  }
+
+  /// Returns whether the contact results report hydroelastic quadrature point
+  /// data. See set_report_hydroelastic_quadrature_data().
+  bool get_report_hydroelastic_quadrature_data() const {
+    return report_hydroelastic_quadrature_data_;
+  }
+
   /// For use only by advanced developers wanting to try out their custom time
   /// stepping strategies, including contact resolution.
   ///
@@ -2575,6 +2599,36 @@ class MultibodyPlant : public internal::MultibodyTreeSystem<T> {
     internal_tree().SetPositionsInArray(model_instance, q_instance, &q);
   }
 
+  /// (Advanced) Populates `q_out` with the generalized positions selected by
+  /// `selector` in a given Context.
+  /// @note This function is guaranteed to allocate no heap.
+  /// @throws std::exception if `context` does not correspond to the Context
+  /// for a multibody model, if `selector` was made for a plant with a
+  /// different number of positions, or if `q_out` is nullptr or does not have
+  /// `selector.num_positions()` entries.
+  void GetPositions(const systems::Context<T>& context,
+                    const StateSelector& selector,
+                    EigenPtr<VectorX<T>> q_out) const {
+    this->ValidateContext(context);
+    selector.GatherPositions<T>(internal_tree().get_positions(context), q_out);
+  }
+
+  /// Sets the generalized positions selected by `selector` in a given Context
+  /// from `q_selected`, with a single cache invalidation.
+  /// @note This function is guaranteed to allocate no heap.
+  /// @throws std::exception if `context` is nullptr, if `context` does not
+  /// correspond to the Context for a multibody model, if `selector` was made
+  /// for a plant with a different number of positions, or if the length of
+  /// `q_selected` is not equal to `selector.num_positions()`.
+  void SetPositions(systems::Context<T>* context, const StateSelector& selector,
+                    const Eigen::Ref<const VectorX<T>>& q_selected) const {
+    this->ValidateContext(context);
+    DRAKE_THROW_UNLESS(selector.plant_num_positions() == num_positions());
+    Eigen::VectorBlock<VectorX<T>> q =
+        internal_tree().GetMutablePositions(context);
+    selector.ScatterPositions<T>(q_selected, &q);
+  }
+
   /// Gets the default positions for the plant, which can be changed via
   /// SetDefaultPositions().
   /// @throws std::exception if the plant is not finalized.
@@ -2729,6 +2783,38 @@ class MultibodyPlant : public internal::MultibodyTreeSystem<T> {
     internal_tree().SetVelocitiesInArray(model_instance, v_instance, &v);
   }
 
+  /// (Advanced) Populates `v_out` with the generalized velocities selected by
+  /// `selector` in a given Context.
+  /// @note This function is guaranteed to allocate no heap.
+  /// @throws std::exception if `context` does not correspond to the Context
+  /// for a multibody model, if `selector` was made for a plant with a
+  /// different number of velocities, or if `v_out` is nullptr or does not
+  /// have `selector.num_velocities()` entries.
+  void GetVelocities(const systems::Context<T>& context,
+                     const StateSelector& selector,
+                     EigenPtr<VectorX<T>> v_out) const {
+    this->ValidateContext(context);
+    selector.GatherVelocities<T>(internal_tree().get_velocities(context),
+                                 v_out);
+  }
+
+  /// Sets the generalized velocities selected by `selector` in a given
+  /// Context from `v_selected`, with a single cache invalidation.
+  /// @note This function is guaranteed to allocate no heap.
+  /// @throws std::exception if `context` is nullptr, if `context` does not
+  /// correspond to the Context for a multibody model, if `selector` was made
+  /// for a plant with a different number of velocities, or if the length of
+  /// `v_selected` is not equal to `selector.num_velocities()`.
+  void SetVelocities(systems::Context<T>* context,
+                     const StateSelector& selector,
+                     const Eigen::Ref<const VectorX<T>>& v_selected) const {
+    this->ValidateContext(context);
+    DRAKE_THROW_UNLESS(selector.plant_num_velocities() == num_velocities());
+    Eigen::VectorBlock<VectorX<T>> v =
+        internal_tree().GetMutableVelocities(context);
+    selector.ScatterVelocities<T>(v_selected, &v);
+  }
+
   /// Sets `state` according to defaults set by the user for joints (e.g.
   /// RevoluteJoint::set_default_angle()) and free bodies
   /// (SetDefaultFreeBodyPose()). If the user does not specify defaults, the
@@ -3203,6 +3289,32 @@ class MultibodyPlant : public internal::MultibodyTreeSystem<T> {
   /// cache.
   /// @{
 
+  /// Sets the maximum parallelism of the recursive passes over the multibody
+  /// tree, e.g., the position, velocity, and articulated body inertia
+  /// kinematics, inverse dynamics, and the mass matrix. With the SAP discrete
+  /// solver, this includes the free-motion velocities and the per-tree linear
+  /// dynamics matrices of the contact problem. The bodies at the same depth in
+  /// the tree only depend on bodies at other depths, so when a depth has many
+  /// bodies (e.g., a scene with dozens of free bodies, or many robots welded
+  /// to the world), they are split across threads. Depths with fewer than 16
+  /// bodies are always computed serially, so models of a single robot are not
+  /// affected. Only the `double` scalar type is parallelized; the results
+  /// are identical to the serial results. The default is
+  /// Parallelism::None().
+  ///
+  /// @note The calls into the tree are made from within the computation of a
+  /// single cache entry, so this is compatible with evaluating distinct
+  /// Contexts on distinct threads, but it oversubscribes the machine in that
+  /// case.
+  void set_tree_parallelism(Parallelism parallelism) {
+    this->mutable_tree().set_tree_parallelism(parallelism);
+  }
+
+  /// Returns the parallelism set by set_tree_parallelism().
+  Parallelism get_tree_parallelism() const {
+    return internal_tree().get_tree_parallelism();
+  }
+
   /// Evaluate the pose `X_WB` of a body B in the world frame W.
   /// @param[in] context
   ///   The context storing the state of the model.
@@ -3218,6 +3330,37 @@ class MultibodyPlant : public internal::MultibodyTreeSystem<T> {
     return internal_tree().EvalBodyPoseInWorld(context, body_B);
   }
 
+  /// Computes the poses `X_WB` of all bodies in the world frame W for each of
+  /// the `N` configurations stored in the columns of `q_batch`, in a single
+  /// base-to-tip pass over the multibody topology. Unlike setting each
+  /// configuration into a Context and calling EvalBodyPoseInWorld(), this
+  /// method neither modifies nor invalidates the cache in `context`; only the
+  /// parameters in `context` are used (e.g., the poses of fixed offset
+  /// frames). The generalized positions stored in `context` are ignored.
+  ///
+  /// The results are stored body-major (structure-of-arrays): on output,
+  /// `(*X_WB_batch)[body_index][k]` is the pose of the body with index
+  /// `body_index` for the configuration `q_batch.col(k)`.
+  ///
+  /// @param[in] context
+  ///   The context storing the parameters of the model.
+  /// @param[in] q_batch
+  ///   A matrix of size num_positions() x N whose k-th column is the vector of
+  ///   generalized positions of the k-th configuration.
+  /// @param[out] X_WB_batch
+  ///   On output, a vector of size num_bodies() whose entries are each of size
+  ///   `N`. Storage in `X_WB_batch` is reused when the sizes already match.
+  /// @throws std::exception if Finalize() was not called on `this` model, if
+  ///   `X_WB_batch` is nullptr, or if `q_batch.rows()` is not
+  ///   num_positions().
+  void CalcAllBodyPosesInWorldBatch(
+      const systems::Context<T>& context,
+      const Eigen::Ref<const MatrixX<T>>& q_batch,
+      std::vector<std::vector<math::RigidTransform<T>>>* X_WB_batch) const {
+    this->ValidateContext(context);
+    internal_tree().CalcAllBodyPosesInWorldBatch(context, q_batch, X_WB_batch);
+  }
+
   /// Evaluates V_WB, body B's spatial velocity in the world frame W.
   /// @param[in] context The context storing the state of the model.
   /// @param[in] body_B  The body B for which the spatial velocity is requested.
@@ -3598,6 +3741,23 @@ class MultibodyPlant : public internal::MultibodyTreeSystem<T> {
                                                external_forces);
   }
 
+  /// (Advanced) Overload of CalcInverseDynamics() for real-time code. The
+  /// result is written to `tau`, and `workspace` provides all temporaries, so
+  /// that for `T = double` no heap memory is allocated once the cache entries
+  /// of `context` have been computed once. See MultibodyWorkspace.
+  /// @throws std::exception if `workspace` or `tau` is nullptr, or if
+  ///   `workspace`, `external_forces`, or `tau` does not have the sizes of
+  ///   this model.
+  void CalcInverseDynamics(const systems::Context<T>& context,
+                           const VectorX<T>& known_vdot,
+                           const MultibodyForces<T>& external_forces,
+                           MultibodyWorkspace<T>* workspace,
+                           EigenPtr<VectorX<T>> tau) const {
+    this->ValidateContext(context);
+    internal_tree().CalcInverseDynamics(context, known_vdot, external_forces,
+                                        workspace, tau);
+  }
+
 #ifdef DRAKE_DOXYGEN_CXX
   // MultibodyPlant uses the NVI implementation of
   // CalcImplicitTimeDerivativesResidual from
@@ -3670,6 +3830,85 @@ class MultibodyPlant : public internal::MultibodyTreeSystem<T> {
     return internal_tree().CalcGravityGeneralizedForces(context);
   }
 
+  /// Computes the partial derivatives of the inverse dynamics
+  /// <pre>
+  ///   tau = M(q)v̇ + C(q, v)v - tau_g(q)
+  /// </pre>
+  /// with respect to the generalized positions q and velocities v, evaluated
+  /// at the state stored in `context` and at the given generalized
+  /// accelerations `known_vdot`. The derivatives are computed analytically
+  /// with the recursive algorithm of [Carpentier 2018], at a cost comparable
+  /// to a few evaluations of CalcInverseDynamics(), which is much cheaper than
+  /// differentiating CalcInverseDynamics() with AutoDiffXd.
+  ///
+  /// Only the inertial terms and gravity (see CalcGravityGeneralizedForces())
+  /// are differentiated; the derivatives of force elements, joint damping,
+  /// actuation, and contact are not included.
+  ///
+  /// - [Carpentier 2018] Carpentier, J. and Mansard, N., 2018. Analytical
+  ///   derivatives of rigid body dynamics algorithms. Robotics: Science and
+  ///   Systems.
+  ///
+  /// @param[in] context
+  ///   The context storing the state of the model.
+  /// @param[in] known_vdot
+  ///   A vector with the generalized accelerations v̇ of size num_velocities().
+  /// @param[out] dtau_dq
+  ///   On output, the num_velocities() x num_positions() matrix ∂tau/∂q.
+  /// @param[out] dtau_dv
+  ///   On output, the num_velocities() x num_velocities() matrix ∂tau/∂v.
+  /// @throws std::exception if the model has any joint other than a
+  ///   RevoluteJoint, PrismaticJoint, ScrewJoint, or WeldJoint (for which
+  ///   q̇ = v), or if any of the arguments has the wrong size or is null.
+  void CalcInverseDynamicsDerivatives(const systems::Context<T>& context,
+                                      const VectorX<T>& known_vdot,
+                                      EigenPtr<MatrixX<T>> dtau_dq,
+                                      EigenPtr<MatrixX<T>> dtau_dv) const {
+    this->ValidateContext(context);
+    internal_tree().CalcInverseDynamicsDerivatives(context, known_vdot,
+                                                   dtau_dq, dtau_dv);
+  }
+
+  /// Computes the forward dynamics
+  /// <pre>
+  ///   v̇ = M(q)⁻¹(tau + tau_g(q) - C(q, v)v)
+  /// </pre>
+  /// at the state stored in `context` and for the given generalized forces
+  /// `tau`, along with its partial derivatives with respect to q, v, and tau.
+  /// Since tau is the inverse dynamics of v̇, the derivatives are
+  /// ∂v̇/∂q = -M⁻¹⋅∂tau/∂q, ∂v̇/∂v = -M⁻¹⋅∂tau/∂v, and ∂v̇/∂tau = M⁻¹, where
+  /// ∂tau/∂q and ∂tau/∂v are computed by CalcInverseDynamicsDerivatives().
+  /// The same restrictions apply; in particular, `tau` is the total of the
+  /// generalized forces other than gravity and is treated as an independent
+  /// input.
+  ///
+  /// @param[in] context
+  ///   The context storing the state of the model.
+  /// @param[in] tau
+  ///   A vector of generalized forces of size num_velocities().
+  /// @param[out] vdot
+  ///   On output, the generalized accelerations v̇.
+  /// @param[out] dvdot_dq
+  ///   On output, the num_velocities() x num_positions() matrix ∂v̇/∂q.
+  /// @param[out] dvdot_dv
+  ///   On output, the num_velocities() x num_velocities() matrix ∂v̇/∂v.
+  /// @param[out] dvdot_dtau
+  ///   On output, the num_velocities() x num_velocities() matrix ∂v̇/∂tau.
+  /// @throws std::exception for the same conditions as
+  ///   CalcInverseDynamicsDerivatives().
+  /// @throws std::exception if T is symbolic::Expression.
+  void CalcForwardDynamicsDerivatives(const systems::Context<T>& context,
+                                      const VectorX<T>& tau,
+                                      EigenPtr<VectorX<T>> vdot,
+                                      EigenPtr<MatrixX<T>> dvdot_dq,
+                                      EigenPtr<MatrixX<T>> dvdot_dv,
+                                      EigenPtr<MatrixX<T>> dvdot_dtau) const {
+    this->ValidateContext(context);
+    internal_tree().CalcForwardDynamicsDerivatives(context, tau, vdot,
+                                                   dvdot_dq, dvdot_dv,
+                                                   dvdot_dtau);
+  }
+
   /// Computes the generalized forces result of a set of MultibodyForces applied
   /// to this model.
   ///
@@ -3894,6 +4133,24 @@ class MultibodyPlant : public internal::MultibodyTreeSystem<T> {
     internal_tree().CalcMassMatrix(context, M);
   }
 
+  /// Computes the mass matrix `M(q)` (see CalcMassMatrix()) and factors it as
+  /// M = Lᵀ⋅D⋅L, exploiting the sparsity that the branches of the tree induce
+  /// in M. Use this in place of a dense factorization of M, e.g., to compute
+  /// M⁻¹⋅b for many right hand sides. Factoring and solving cost O(n⋅d²) and
+  /// O(n⋅d) respectively, where n is num_velocities() and d the depth of the
+  /// tree, measured in generalized velocities. See MassMatrixFactorization.
+  ///
+  /// @param[in] context
+  ///   The Context containing the state of the model from which generalized
+  ///   coordinates q are extracted.
+  /// @throws std::exception if the mass matrix is not positive definite, e.g.,
+  ///   if a body without mass or inertia terminates a branch of the tree.
+  MassMatrixFactorization<T> CalcMassMatrixFactorization(
+      const systems::Context<T>& context) const {
+    this->ValidateContext(context);
+    return internal_tree().CalcMassMatrixFactorization(context);
+  }
+
   /// Computes the bias term `C(q, v)v` containing Coriolis, centripetal, and
   /// gyroscopic effects in the multibody equations of motion: <pre>
   ///   M(q) v̇ + C(q, v) v = tau_app + ∑ (Jv_V_WBᵀ(q) ⋅ Fapp_Bo_W)
@@ -3922,6 +4179,19 @@ class MultibodyPlant : public internal::MultibodyTreeSystem<T> {
     internal_tree().CalcBiasTerm(context, Cv);
   }
 
+  /// (Advanced) Overload of CalcBiasTerm() for real-time code, which uses
+  /// `workspace` for all temporaries so that for `T = double` no heap memory
+  /// is allocated once the cache entries of `context` have been computed
+  /// once. See MultibodyWorkspace.
+  /// @throws std::exception if `workspace` or `Cv` is nullptr, or if either
+  ///   does not have the sizes of this model.
+  void CalcBiasTerm(const systems::Context<T>& context,
+                    MultibodyWorkspace<T>* workspace,
+                    EigenPtr<VectorX<T>> Cv) const {
+    this->ValidateContext(context);
+    internal_tree().CalcBiasTerm(context, workspace, Cv);
+  }
+
   /// For each point Bi affixed/welded to a frame B, calculates a𝑠Bias_ABi, Bi's
   /// translational acceleration bias in frame A with respect to "speeds" 𝑠,
   /// where 𝑠 is either q̇ (time-derivatives of generalized positions) or v
@@ -4064,6 +4334,67 @@ class MultibodyPlant : public internal::MultibodyTreeSystem<T> {
                                                 frame_E, Js_V_ABp_E);
   }
 
+  /// (Advanced) Overload of CalcJacobianSpatialVelocity() for real-time code,
+  /// which uses `workspace` for all temporaries so that for `T = double` no
+  /// heap memory is allocated once the cache entries of `context` have been
+  /// computed once. (The other overload only allocates when `frame_A` is not
+  /// attached to the world.) See MultibodyWorkspace.
+  /// @throws std::exception if `workspace` or `J𝑠_V_ABp_E` is nullptr, if
+  ///   `workspace` is not for this model, or if `J𝑠_V_ABp_E` is not sized
+  ///   `6 x n`.
+  void CalcJacobianSpatialVelocity(const systems::Context<T>& context,
+                                   JacobianWrtVariable with_respect_to,
+                                   const Frame<T>& frame_B,
+                                   const Eigen::Ref<const Vector3<T>>& p_BoBp_B,
+                                   const Frame<T>& frame_A,
+                                   const Frame<T>& frame_E,
+                                   MultibodyWorkspace<T>* workspace,
+                                   EigenPtr<MatrixX<T>> Js_V_ABp_E) const {
+    this->ValidateContext(context);
+    internal_tree().CalcJacobianSpatialVelocity(context, with_respect_to,
+                                                frame_B, p_BoBp_B, frame_A,
+                                                frame_E, workspace, Js_V_ABp_E);
+  }
+
+  /// For k points Bpᵢ, each fixed/welded to a frame Bᵢ, calculates their
+  /// spatial velocity Jacobians J𝑠_V_ABpᵢ in a frame A with respect to
+  /// "speeds" 𝑠, expressed in a frame E, stacked one above the other. Rows
+  /// 6i to 6i+5 of the result are the `6 x n` matrix J𝑠_V_ABpᵢ_E that
+  /// CalcJacobianSpatialVelocity() computes for `frames_B[i]` and
+  /// `p_BoBp_B.col(i)`.
+  ///
+  /// This is faster than one call to CalcJacobianSpatialVelocity() per point,
+  /// e.g., for a controller that tracks many task or contact frames, since
+  /// the work that does not depend on the point is shared. In particular, if
+  /// frame A is not the world frame, its Jacobian is computed once rather
+  /// than for each point.
+  ///
+  /// @param[in] context The state of the multibody system.
+  /// @param[in] with_respect_to Enum equal to JacobianWrtVariable::kQDot or
+  /// JacobianWrtVariable::kV, indicating whether the Jacobians are partial
+  /// derivatives with respect to 𝑠 = q̇ or with respect to 𝑠 = v.
+  /// @param[in] frames_B The k frames Bᵢ on which the points Bpᵢ are fixed.
+  /// A frame may appear more than once.
+  /// @param[in] p_BoBp_B A `3 x k` matrix whose column i is the position
+  /// vector from Bᵢo (frame Bᵢ's origin) to point Bpᵢ, expressed in Bᵢ.
+  /// @param[in] frame_A The frame that measures the velocities.
+  /// @param[in] frame_E The frame in which the Jacobians are expressed.
+  /// @param[out] J𝑠_V_ABp_E The stacked Jacobians, a `6k x n` matrix, where n
+  /// is the number of elements in 𝑠.
+  /// @throws std::exception if an entry of `frames_B` is nullptr, if
+  /// `p_BoBp_B` does not have k columns, or if `J𝑠_V_ABp_E` is nullptr or not
+  /// sized `6k x n`.
+  void CalcJacobiansSpatialVelocity(
+      const systems::Context<T>& context, JacobianWrtVariable with_respect_to,
+      const std::vector<const Frame<T>*>& frames_B,
+      const Eigen::Ref<const Matrix3X<T>>& p_BoBp_B, const Frame<T>& frame_A,
+      const Frame<T>& frame_E, EigenPtr<MatrixX<T>> Js_V_ABp_E) const {
+    this->ValidateContext(context);
+    internal_tree().CalcJacobiansSpatialVelocity(context, with_respect_to,
+                                                 frames_B, p_BoBp_B, frame_A,
+                                                 frame_E, Js_V_ABp_E);
+  }
+
   /// Calculates J𝑠_w_AB, a frame B's angular velocity Jacobian in a frame A
   /// with respect to "speeds" 𝑠.
   /// <pre>
@@ -4334,6 +4665,23 @@ class MultibodyPlant : public internal::MultibodyTreeSystem<T> {
     return internal_tree().MakeStateSelectorMatrix(user_to_joint_index_map);
   }
 
+  /// Makes a StateSelector of the generalized positions and velocities of
+  /// the given model instances, for use with GetPositions(), SetPositions(),
+  /// GetVelocities() and SetVelocities(). The selected entries of each model
+  /// instance are ordered as in GetPositions(context, model_instance) and
+  /// GetVelocities(context, model_instance), and the model instances follow
+  /// each other in the order given.
+  /// @throws std::exception if the plant is not finalized, or if any model
+  /// instance is invalid or repeated.
+  StateSelector MakeStateSelector(
+      const std::vector<ModelInstanceIndex>& model_instances) const;
+
+  /// Makes a StateSelector of the generalized positions and velocities of
+  /// the given joints, in the same order as MakeStateSelectorMatrix().
+  /// @throws std::exception if the plant is not finalized, if any joint is
+  /// invalid, or if a joint with positions or velocities is repeated.
+  StateSelector MakeStateSelector(const std::vector<JointIndex>& joints) const;
+
   /// This method allows user to map a vector `uₛ` containing the actuation
   /// for a set of selected actuators into the vector u containing the actuation
   /// values for `this` full model.
@@ -5804,6 +6152,9 @@ class MultibodyPlant : public internal::MultibodyTreeSystem<T> {
   // Whether to apply collsion filters to adjacent bodies at Finalize().
   bool adjacent_bodies_collision_filters_{
       MultibodyPlantConfig{}.adjacent_bodies_collision_filters};
+
+  // Whether contact results include hydroelastic quadrature point data.
+  bool report_hydroelastic_quadrature_data_{true};
 };
 
 /// @cond
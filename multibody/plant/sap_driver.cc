@@ -70,6 +70,9 @@ SapDriver<T>::SapDriver(const CompliantContactManager<T>* manager,
     const int nv = joint.num_velocities();
     joint_damping_.segment(velocity_start, nv) = joint.damping_vector();
   }
+  // Unless set otherwise, the solver kept in each context reuses the symbolic
+  // factorization of the Hessian across time steps; see SapSolverResultsCache.
+  sap_parameters_.reuse_symbolic_factorization = true;
 }
 
 template <typename T>
@@ -107,11 +110,11 @@ void SapDriver<T>::DeclareCacheEntries(
 }
 
 template <typename T>
-const SapSolverResults<T>& SapDriver<T>::EvalSapSolverResults(
+const SapSolverResultsCache<T>& SapDriver<T>::EvalSapSolverResultsCache(
     const systems::Context<T>& context) const {
   return plant()
       .get_cache_entry(sap_results_)
-      .template Eval<SapSolverResults<T>>(context);
+      .template Eval<SapSolverResultsCache<T>>(context);
 }
 
 template <typename T>
@@ -896,8 +899,8 @@ void SapDriver<T>::AddCliqueContribution(
 
 template <typename T>
 void SapDriver<T>::CalcSapSolverResults(
-    const systems::Context<T>& context,
-    SapSolverResults<T>* sap_results) const {
+    const systems::Context<T>& context, SapSolverResultsCache<T>* cache) const {
+  SapSolverResults<T>* sap_results = &cache->results;
   const ContactProblemCache<T>& contact_problem_cache =
       EvalContactProblemCache(context);
   const SapContactProblem<T>& sap_problem = *contact_problem_cache.sap_problem;
@@ -928,7 +931,7 @@ void SapDriver<T>::CalcSapSolverResults(
   }
 
   // Solve the reduced DOF locked problem.
-  SapSolver<T> sap;
+  SapSolver<T>& sap = *cache->solver;
   sap.set_parameters(sap_parameters_);
 
   SapSolverStatus status;
@@ -63,6 +63,31 @@ struct ContactProblemCache {
   contact_solvers::internal::ReducedMapping mapping;
 };
 
+// The value of the "SAP solver results" cache entry. Along with the results, it
+// keeps the SapSolver that computed them, so that consecutive solves in the
+// same Context reuse the solver's symbolic factorization of the Hessian (see
+// SapSolverParameters::reuse_symbolic_factorization). Since each Context has
+// its own cache, the solver is never shared between Contexts. A copy (e.g., in
+// a cloned Context) copies the results but starts with a fresh solver.
+template <typename T>
+struct SapSolverResultsCache {
+  SapSolverResultsCache()
+      : solver(std::make_unique<contact_solvers::internal::SapSolver<T>>()) {}
+
+  SapSolverResultsCache(const SapSolverResultsCache& other)
+      : results(other.results),
+        solver(std::make_unique<contact_solvers::internal::SapSolver<T>>()) {}
+
+  SapSolverResultsCache& operator=(const SapSolverResultsCache& other) {
+    results = other.results;
+    solver = std::make_unique<contact_solvers::internal::SapSolver<T>>();
+    return *this;
+  }
+
+  contact_solvers::internal::SapSolverResults<T> results;
+  std::unique_ptr<contact_solvers::internal::SapSolver<T>> solver;
+};
+
 // Performs the computations needed by CompliantContactManager for discrete
 // updates using the SAP solver. A const manager is provided at construction so
 // that the driver has access to the const model and computation services
@@ -267,17 +292,23 @@ class SapDriver {
   const ContactProblemCache<T>& EvalContactProblemCache(
       const systems::Context<T>& context) const;
 
-  // Computes the discrete update from the state stored in the context. The
-  // resulting next time step velocities and constraint impulses are stored in
-  // `sap_results`.
-  void CalcSapSolverResults(
-      const systems::Context<T>& context,
-      contact_solvers::internal::SapSolverResults<T>* sap_results) const;
+  // Computes the discrete update from the state stored in the context, with
+  // the solver kept in `cache` from the previous update in the same context.
+  // The resulting next time step velocities and constraint impulses are stored
+  // in `cache->results`.
+  void CalcSapSolverResults(const systems::Context<T>& context,
+                            SapSolverResultsCache<T>* cache) const;
 
-  // Eval version of  SapSolverResults().
-  const contact_solvers::internal::SapSolverResults<T>& EvalSapSolverResults(
+  // Eval version of CalcSapSolverResults().
+  const SapSolverResultsCache<T>& EvalSapSolverResultsCache(
       const systems::Context<T>& context) const;
 
+  // Returns the results of EvalSapSolverResultsCache().
+  const contact_solvers::internal::SapSolverResults<T>& EvalSapSolverResults(
+      const systems::Context<T>& context) const {
+    return EvalSapSolverResultsCache(context).results;
+  }
+
   // The driver only has mutable access at construction time, when it can
   // declare additional state, cache entries, ports, etc. After construction,
   // the driver only has const access to the manager.
@@ -0,0 +1,41 @@
+#include "drake/multibody/plant/state_selector.h"
+
+#include <stdexcept>
+
+#include <fmt/format.h>
+
+namespace drake {
+namespace multibody {
+
+StateSelector::StateSelector(int plant_num_positions, int plant_num_velocities,
+                             const std::vector<int>& position_indices,
+                             const std::vector<int>& velocity_indices)
+    : positions_(plant_num_positions, position_indices),
+      velocities_(plant_num_velocities, velocity_indices) {}
+
+StateSelector::Selection::Selection(int num_total,
+                                    const std::vector<int>& indices)
+    : num_total_(num_total), num_selected_(indices.size()) {
+  DRAKE_THROW_UNLESS(num_total >= 0);
+  std::vector<bool> is_selected(num_total, false);
+  for (const int index : indices) {
+    if (index < 0 || index >= num_total) {
+      throw std::logic_error(fmt::format(
+          "StateSelector: index {} is out of range for a vector of size {}",
+          index, num_total));
+    }
+    if (is_selected[index]) {
+      throw std::logic_error(
+          fmt::format("StateSelector: index {} is selected twice", index));
+    }
+    is_selected[index] = true;
+    if (!runs_.empty() && runs_.back().start + runs_.back().size == index) {
+      ++runs_.back().size;
+    } else {
+      runs_.push_back(Run{index, 1});
+    }
+  }
+}
+
+}  // namespace multibody
+}  // namespace drake
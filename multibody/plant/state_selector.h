@@ -0,0 +1,137 @@
+#pragma once
+
+#include <vector>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/drake_throw.h"
+#include "drake/common/eigen_types.h"
+
+namespace drake {
+namespace multibody {
+
+/// A precomputed selection of some of the generalized positions q and
+/// generalized velocities v of a MultibodyPlant, in a given order; e.g., those
+/// of a set of model instances or of joints. It is made once by
+/// MultibodyPlant::MakeStateSelector() and then used with the overloads of
+/// MultibodyPlant::GetPositions(), SetPositions(), GetVelocities() and
+/// SetVelocities() that take one, to copy all of the selected entries between
+/// a Context and a dense vector in a single call, with no heap allocation and
+/// a single cache invalidation. This is much cheaper than one call per model
+/// instance in, e.g., a control loop over many robots.
+///
+/// The selected entries are stored as runs of consecutive indices, which are
+/// copied as blocks. A selector only depends on the layout of q and v, so one
+/// made by a plant may also be used with its scalar-converted copies.
+class StateSelector {
+ public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(StateSelector)
+
+  /// Constructs a selector of the entries `position_indices` of q and
+  /// `velocity_indices` of v, in that order, for a plant with
+  /// `plant_num_positions` positions and `plant_num_velocities` velocities.
+  /// @throws std::exception if any index is out of range or repeated.
+  StateSelector(int plant_num_positions, int plant_num_velocities,
+                const std::vector<int>& position_indices,
+                const std::vector<int>& velocity_indices);
+
+  /// Returns the number of selected generalized positions.
+  int num_positions() const { return positions_.num_selected(); }
+
+  /// Returns the number of selected generalized velocities.
+  int num_velocities() const { return velocities_.num_selected(); }
+
+  /// Returns the number of generalized positions of the plant.
+  int plant_num_positions() const { return positions_.num_total(); }
+
+  /// Returns the number of generalized velocities of the plant.
+  int plant_num_velocities() const { return velocities_.num_total(); }
+
+  /// Copies the selected entries of the generalized positions `q` of the plant
+  /// into `q_selected`.
+  /// @throws std::exception if `q` does not have plant_num_positions()
+  /// entries, or `q_selected` is nullptr or does not have num_positions()
+  /// entries.
+  template <typename T>
+  void GatherPositions(const Eigen::Ref<const VectorX<T>>& q,
+                       EigenPtr<VectorX<T>> q_selected) const {
+    positions_.Gather<T>(q, q_selected);
+  }
+
+  /// Copies `q_selected` into the selected entries of the generalized
+  /// positions `q` of the plant, leaving the others unchanged.
+  /// @throws std::exception if `q_selected` does not have num_positions()
+  /// entries, or `q` is nullptr or does not have plant_num_positions()
+  /// entries.
+  template <typename T>
+  void ScatterPositions(const Eigen::Ref<const VectorX<T>>& q_selected,
+                        EigenPtr<VectorX<T>> q) const {
+    positions_.Scatter<T>(q_selected, q);
+  }
+
+  /// The analog of GatherPositions() for the generalized velocities.
+  template <typename T>
+  void GatherVelocities(const Eigen::Ref<const VectorX<T>>& v,
+                        EigenPtr<VectorX<T>> v_selected) const {
+    velocities_.Gather<T>(v, v_selected);
+  }
+
+  /// The analog of ScatterPositions() for the generalized velocities.
+  template <typename T>
+  void ScatterVelocities(const Eigen::Ref<const VectorX<T>>& v_selected,
+                         EigenPtr<VectorX<T>> v) const {
+    velocities_.Scatter<T>(v_selected, v);
+  }
+
+ private:
+  // The selection of some entries of a vector, as runs of consecutive
+  // indices.
+  class Selection {
+   public:
+    Selection(int num_total, const std::vector<int>& indices);
+
+    int num_total() const { return num_total_; }
+    int num_selected() const { return num_selected_; }
+
+    template <typename T>
+    void Gather(const Eigen::Ref<const VectorX<T>>& all,
+                EigenPtr<VectorX<T>> selected) const {
+      DRAKE_THROW_UNLESS(all.size() == num_total_);
+      DRAKE_THROW_UNLESS(selected != nullptr);
+      DRAKE_THROW_UNLESS(selected->size() == num_selected_);
+      int offset = 0;
+      for (const Run& run : runs_) {
+        selected->segment(offset, run.size) = all.segment(run.start, run.size);
+        offset += run.size;
+      }
+    }
+
+    template <typename T>
+    void Scatter(const Eigen::Ref<const VectorX<T>>& selected,
+                 EigenPtr<VectorX<T>> all) const {
+      DRAKE_THROW_UNLESS(selected.size() == num_selected_);
+      DRAKE_THROW_UNLESS(all != nullptr);
+      DRAKE_THROW_UNLESS(all->size() == num_total_);
+      int offset = 0;
+      for (const Run& run : runs_) {
+        all->segment(run.start, run.size) = selected.segment(offset, run.size);
+        offset += run.size;
+      }
+    }
+
+   private:
+    struct Run {
+      int start{};
+      int size{};
+    };
+
+    int num_total_{};
+    int num_selected_{};
+    std::vector<Run> runs_;
+  };
+
+  Selection positions_;
+  Selection velocities_;
+};
+
+}  // namespace multibody
+}  // namespace drake
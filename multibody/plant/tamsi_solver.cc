@@ -3,10 +3,13 @@
 #include <algorithm>
 #include <limits>
 #include <memory>
+#include <numeric>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
 #include "drake/common/extract_double.h"
+#include "drake/common/ssize.h"
 #include "drake/math/linear_solve.h"
 
 namespace drake {
@@ -283,6 +286,7 @@ void TamsiSolver<T>::SetOneWayCoupledProblemData(
   // Keep references to the problem data.
   problem_data_aliases_.SetOneWayCoupledData(M, Jn, Jt, p_star, fn, mu);
   variable_size_workspace_.ResizeIfNeeded(nc_, nv_);
+  CalcIslands();
 }
 
 template <typename T>
@@ -305,6 +309,236 @@ void TamsiSolver<T>::SetTwoWayCoupledProblemData(
   problem_data_aliases_.SetTwoWayCoupledData(M, Jn, Jt, p_star, fn0, stiffness,
                                              dissipation, mu);
   variable_size_workspace_.ResizeIfNeeded(nc_, nv_);
+  CalcIslands();
+}
+
+template <typename T>
+void TamsiSolver<T>::CalcIslands() {
+  const auto M = problem_data_aliases_.M();
+  const auto Jn = problem_data_aliases_.Jn();
+  const auto Jt = problem_data_aliases_.Jt();
+
+  // Only exact zeros decouple velocities. For scalar types other than double
+  // we conservatively treat every entry as nonzero, which makes the whole
+  // problem a single island.
+  auto is_nonzero = [](const T& x) {
+    if constexpr (std::is_same_v<T, double>) {
+      return x != 0.0;
+    } else {
+      return true;
+    }
+  };
+
+  // Union-find over the generalized velocities.
+  std::vector<int> parent(nv_);
+  std::iota(parent.begin(), parent.end(), 0);
+  auto find = [&parent](int i) {
+    while (parent[i] != i) {
+      parent[i] = parent[parent[i]];
+      i = parent[i];
+    }
+    return i;
+  };
+  auto unite = [&](int i, int j) {
+    i = find(i);
+    j = find(j);
+    if (i != j) parent[std::max(i, j)] = std::min(i, j);
+  };
+  for (int j = 0; j < nv_; ++j) {
+    for (int i = j + 1; i < nv_; ++i) {
+      if (is_nonzero(M(i, j))) unite(i, j);
+    }
+  }
+  // For each contact point, the first velocity in its rows of Jn and Jt, or
+  // -1 if these rows are zero.
+  std::vector<int> contact_velocity(nc_, -1);
+  for (int ic = 0; ic < nc_; ++ic) {
+    for (int iv = 0; iv < nv_; ++iv) {
+      if (is_nonzero(Jn(ic, iv)) || is_nonzero(Jt(2 * ic, iv)) ||
+          is_nonzero(Jt(2 * ic + 1, iv))) {
+        if (contact_velocity[ic] < 0) {
+          contact_velocity[ic] = iv;
+        } else {
+          unite(contact_velocity[ic], iv);
+        }
+      }
+    }
+  }
+
+  // Since each root is the smallest velocity of its set, islands are ordered
+  // by their smallest velocity.
+  islands_.clear();
+  std::vector<int> island_of_root(nv_, -1);
+  for (int iv = 0; iv < nv_; ++iv) {
+    const int root = find(iv);
+    if (island_of_root[root] < 0) {
+      island_of_root[root] = ssize(islands_);
+      islands_.emplace_back();
+    }
+    islands_[island_of_root[root]].velocities.push_back(iv);
+  }
+  // Contact points with zero Jacobians do not couple anything; we place them
+  // in the first island (which we create if nv = 0).
+  if (islands_.empty()) islands_.emplace_back();
+  for (int ic = 0; ic < nc_; ++ic) {
+    const int i = contact_velocity[ic] < 0
+                      ? 0
+                      : island_of_root[find(contact_velocity[ic])];
+    islands_[i].contacts.push_back(ic);
+  }
+
+  for (Island& island : islands_) {
+    const std::vector<int>& velocities = island.velocities;
+    const std::vector<int>& contacts = island.contacts;
+    const int nv = ssize(velocities);
+    const int nc = ssize(contacts);
+    island.M.resize(nv, nv);
+    island.Jn.resize(nc, nv);
+    island.Jt.resize(2 * nc, nv);
+    island.Gn.resize(nc, nv);
+    island.J.resize(nv, nv);
+    for (int j = 0; j < nv; ++j) {
+      for (int i = 0; i < nv; ++i) {
+        island.M(i, j) = M(velocities[i], velocities[j]);
+      }
+      for (int i = 0; i < nc; ++i) {
+        island.Jn(i, j) = Jn(contacts[i], velocities[j]);
+        island.Jt(2 * i, j) = Jt(2 * contacts[i], velocities[j]);
+        island.Jt(2 * i + 1, j) = Jt(2 * contacts[i] + 1, velocities[j]);
+      }
+    }
+  }
+}
+
+template <typename T>
+void TamsiSolver<T>::CalcContactVelocities(
+    const Eigen::Ref<const VectorX<T>>& v, EigenPtr<VectorX<T>> vn,
+    EigenPtr<VectorX<T>> vt) const {
+  for (const Island& island : islands_) {
+    const int nc = ssize(island.contacts);
+    if (nc == 0) continue;
+    VectorX<T> v_island(ssize(island.velocities));
+    for (int i = 0; i < v_island.size(); ++i) {
+      v_island(i) = v(island.velocities[i]);
+    }
+    const VectorX<T> vn_island = island.Jn * v_island;
+    const VectorX<T> vt_island = island.Jt * v_island;
+    for (int i = 0; i < nc; ++i) {
+      const int ic = island.contacts[i];
+      (*vn)(ic) = vn_island(i);
+      vt->template segment<2>(2 * ic) = vt_island.template segment<2>(2 * i);
+    }
+  }
+}
+
+template <typename T>
+void TamsiSolver<T>::CalcGeneralizedForces(
+    const Eigen::Ref<const VectorX<T>>& fn,
+    const Eigen::Ref<const VectorX<T>>& ft, EigenPtr<VectorX<T>> tau_f,
+    EigenPtr<VectorX<T>> tau) const {
+  tau_f->setZero();
+  tau->setZero();
+  for (const Island& island : islands_) {
+    const int nc = ssize(island.contacts);
+    if (nc == 0) continue;
+    VectorX<T> fn_island(nc);
+    VectorX<T> ft_island(2 * nc);
+    for (int i = 0; i < nc; ++i) {
+      const int ic = island.contacts[i];
+      fn_island(i) = fn(ic);
+      ft_island.template segment<2>(2 * i) = ft.template segment<2>(2 * ic);
+    }
+    const VectorX<T> tau_f_island = island.Jt.transpose() * ft_island;
+    const VectorX<T> tau_island =
+        tau_f_island + island.Jn.transpose() * fn_island;
+    for (int i = 0; i < ssize(island.velocities); ++i) {
+      (*tau_f)(island.velocities[i]) = tau_f_island(i);
+      (*tau)(island.velocities[i]) = tau_island(i);
+    }
+  }
+}
+
+template <typename T>
+bool TamsiSolver<T>::CalcNewtonUpdate(double dt, Island* island,
+                                      EigenPtr<VectorX<T>> Delta_v) const {
+  const std::vector<int>& velocities = island->velocities;
+  const std::vector<int>& contacts = island->contacts;
+  const int nv = ssize(velocities);
+  const int nc = ssize(contacts);
+  DRAKE_DEMAND(nc > 0);
+
+  const auto p_star = problem_data_aliases_.p_star();
+  const auto& v = fixed_size_workspace_.mutable_v();
+  const auto fn = variable_size_workspace_.fn();
+  const auto ft = variable_size_workspace_.ft();
+  const auto dfn_dvn = variable_size_workspace_.mutable_dfn_dvn();
+  const auto t_hat = variable_size_workspace_.mutable_t_hat();
+  const auto mu_vt = variable_size_workspace_.mutable_mu();
+  const std::vector<Matrix2<T>>& dft_dvt =
+      variable_size_workspace_.mutable_dft_dvt();
+
+  // Gather the island's entries of the current iterate.
+  VectorX<T> v_island(nv);
+  VectorX<T> p_star_island(nv);
+  for (int i = 0; i < nv; ++i) {
+    v_island(i) = v(velocities[i]);
+    p_star_island(i) = p_star(velocities[i]);
+  }
+  VectorX<T> fn_island(nc);
+  VectorX<T> dfn_dvn_island(nc);
+  VectorX<T> mu_vt_island(nc);
+  VectorX<T> ft_island(2 * nc);
+  VectorX<T> t_hat_island(2 * nc);
+  std::vector<Matrix2<T>> dft_dvt_island(nc);
+  for (int i = 0; i < nc; ++i) {
+    const int ic = contacts[i];
+    fn_island(i) = fn(ic);
+    dfn_dvn_island(i) = dfn_dvn(ic);
+    mu_vt_island(i) = mu_vt(ic);
+    ft_island.template segment<2>(2 * i) = ft.template segment<2>(2 * ic);
+    t_hat_island.template segment<2>(2 * i) =
+        t_hat.template segment<2>(2 * ic);
+    dft_dvt_island[i] = dft_dvt[ic];
+  }
+
+  // Newton-Raphson residual.
+  const VectorX<T> residual = island->M * v_island - p_star_island -
+                              dt * island->Jn.transpose() * fn_island -
+                              dt * island->Jt.transpose() * ft_island;
+
+  // Newton-Raphson Jacobian, J = ∇ᵥR, as a function of M, dft_dvt, Jt, dt.
+  // We use the chain rule to compute Gn = ∇ᵥfₙ. Since ∇ᵥvₙ = Jn, we have:
+  if (has_two_way_coupling()) {
+    island->Gn = dfn_dvn_island.asDiagonal() * island->Jn;
+  }
+  CalcJacobian(island->M, island->Jn, island->Jt, island->Gn, dft_dvt_island,
+               t_hat_island, mu_vt_island, dt, &island->J);
+
+  // TODO(amcastro-tri): Consider using a cheap iterative solver like CG.
+  // Since we are in a non-linear iteration, an approximate cheap solution
+  // is probably best.
+  // TODO(amcastro-tri): Consider using a matrix-free iterative method to
+  // avoid computing M and J. CG and the Krylov family can be matrix-free.
+  VectorX<T> Delta_v_island;
+  if (has_two_way_coupling()) {
+    // LU Factorization of the Newton-Raphson Jacobian J. Only used for
+    // two-way coupled problems with non-symmetric Jacobian.
+    const math::LinearSolver<Eigen::PartialPivLU, MatrixX<T>> J_lu(island->J);
+    Delta_v_island = J_lu.Solve(-residual);
+  } else {
+    // LDLT Factorization of the Newton-Raphson Jacobian J. Only used for
+    // one-way coupled problems with symmetric Jacobian.
+    const math::LinearSolver<Eigen::LDLT, MatrixX<T>> J_ldlt(island->J);
+    Delta_v_island = J_ldlt.Solve(-residual);
+    const auto& eigen_solver = J_ldlt.eigen_linear_solver();
+    if (eigen_solver.info() != Eigen::Success) {
+      return false;
+    }
+  }
+  for (int i = 0; i < nv; ++i) {
+    (*Delta_v)(velocities[i]) = Delta_v_island(i);
+  }
+  return true;
 }
 
 template <typename T>
@@ -465,17 +699,17 @@ void TamsiSolver<T>::CalcFrictionForcesGradient(
 
 template <typename T>
 void TamsiSolver<T>::CalcNormalForces(
-    const Eigen::Ref<const VectorX<T>>& vn,
-    const Eigen::Ref<const MatrixX<T>>& Jn, double dt,
-    // We change from fn/Gn in the header to fn_ptr, Gn_ptr here to avoid name
-    // clashes with local variables.
-    EigenPtr<VectorX<T>> fn_ptr, EigenPtr<MatrixX<T>> Gn_ptr) const {
+    const Eigen::Ref<const VectorX<T>>& vn, double dt,
+    // We change from fn/dfn_dvn in the header to fn_ptr, dfn_dvn_ptr here to
+    // avoid name clashes with local variables.
+    EigenPtr<VectorX<T>> fn_ptr, EigenPtr<VectorX<T>> dfn_dvn_ptr) const {
   using std::max;
   const int nc = nc_;  // Number of contact points.
 
   if (!has_two_way_coupling()) {
     // Copy the input normal force (i.e. it is fixed).
     *fn_ptr = problem_data_aliases_.fn();
+    dfn_dvn_ptr->setZero();
     return;
   }
 
@@ -514,13 +748,9 @@ void TamsiSolver<T>::CalcNormalForces(
   // function of vₙ (on a per contact basis, that's why the use of .array()
   // operations below). dfₙ/dvₙ = -d⋅H(1 − d vₙ)⋅(fₙ₀ − h k vₙ)₊  - h⋅k⋅(1 − d
   // vₙ)₊⋅H(fₙ₀ − h k vₙ) Note that dfₙ/dvₙ < 0 always.
-  const VectorX<T> dfn_dvn = -(
+  *dfn_dvn_ptr = -(
       dissipation.array() * H_damping_factor.array() * undamped_fn.array() +
       dt * stiffness.array() * damping_factor.array() * H_undamped_fn.array());
-
-  // We use the chain rule to compute Gn = ∇ᵥfₙ. Since ∇ᵥvₙ = Jn, we have:
-  auto& Gn = *Gn_ptr;
-  Gn = dfn_dvn.asDiagonal() * Jn;
 }
 
 template <typename T>
@@ -533,8 +763,8 @@ void TamsiSolver<T>::CalcJacobian(const Eigen::Ref<const MatrixX<T>>& M,
                                   const Eigen::Ref<const VectorX<T>>& mu_vt,
                                   double dt, EigenPtr<MatrixX<T>> J) const {
   // Problem sizes.
-  const int nv = nv_;  // Number of generalized velocities.
-  const int nc = nc_;  // Number of contact points.
+  const int nv = M.rows();  // Number of generalized velocities.
+  const int nc = Jn.rows();  // Number of contact points.
   // Size of the friction forces vector ft and tangential velocities vector vt.
   const int nf = 2 * nc;
 
@@ -646,16 +876,11 @@ TamsiSolverResult TamsiSolver<T>::SolveWithGuess(
       parameters_.relative_tolerance * parameters_.stiction_tolerance;
 
   // Convenient aliases to problem data.
-  const auto M = problem_data_aliases_.M();
-  const auto Jn = problem_data_aliases_.Jn();
-  const auto Jt = problem_data_aliases_.Jt();
   const auto p_star = problem_data_aliases_.p_star();
 
   // Convenient aliases to fixed size workspace variables.
   auto& v = fixed_size_workspace_.mutable_v();
   auto& Delta_v = fixed_size_workspace_.mutable_Delta_v();
-  auto& residual = fixed_size_workspace_.mutable_residual();
-  auto& J = fixed_size_workspace_.mutable_J();
   auto& tau_f = fixed_size_workspace_.mutable_tau_f();
   auto& tau = fixed_size_workspace_.mutable_tau();
 
@@ -667,7 +892,7 @@ TamsiSolverResult TamsiSolver<T>::SolveWithGuess(
   auto Delta_vn = variable_size_workspace_.mutable_Delta_vn();
   auto Delta_vt = variable_size_workspace_.mutable_Delta_vt();
   auto& dft_dvt = variable_size_workspace_.mutable_dft_dvt();
-  auto Gn = variable_size_workspace_.mutable_Gn();
+  auto dfn_dvn = variable_size_workspace_.mutable_dfn_dvn();
   auto mu_vt = variable_size_workspace_.mutable_mu();
   auto t_hat = variable_size_workspace_.mutable_t_hat();
   auto fn = variable_size_workspace_.mutable_fn();
@@ -681,12 +906,28 @@ TamsiSolverResult TamsiSolver<T>::SolveWithGuess(
   // Initialize iteration with the guess provided.
   v = v_guess;
 
+  // Velocities of islands without contact points satisfy M vˢ⁺¹ = p*, which
+  // we solve once here. Their Newton-Raphson updates are zero from then on.
+  Delta_v.setZero();
+  for (const Island& island : islands_) {
+    if (!island.contacts.empty()) continue;
+    const std::vector<int>& velocities = island.velocities;
+    VectorX<T> p_star_island(ssize(velocities));
+    for (int i = 0; i < ssize(velocities); ++i) {
+      p_star_island(i) = p_star(velocities[i]);
+    }
+    const math::LinearSolver<Eigen::LDLT, MatrixX<T>> M_ldlt(island.M);
+    const VectorX<T> v_island = M_ldlt.Solve(p_star_island);
+    for (int i = 0; i < ssize(velocities); ++i) {
+      v(velocities[i]) = v_island(i);
+    }
+  }
+
   for (int iter = 0; iter < max_iterations; ++iter) {
     // Update normal and tangential velocities.
-    vn = Jn * v;
-    vt = Jt * v;
+    CalcContactVelocities(v, &vn, &vt);
 
-    CalcNormalForces(vn, Jn, dt, &fn, &Gn);
+    CalcNormalForces(vn, dt, &fn, &dfn_dvn);
 
     // Update v_slip, t_hat, mus and ft as a function of vt and fn.
     CalcFrictionForces(vt, fn, &v_slip, &t_hat, &mu_vt, &ft);
@@ -696,39 +937,19 @@ TamsiSolverResult TamsiSolver<T>::SolveWithGuess(
     // Convergence is monitored in both tangential and normal directions.
     if (std::max(vt_error, vn_error) < v_contact_tolerance) {
       // Update generalized forces and return.
-      tau_f = Jt.transpose() * ft;
-      tau = tau_f + Jn.transpose() * fn;
+      CalcGeneralizedForces(fn, ft, &tau_f, &tau);
       return TamsiSolverResult::kSuccess;
     }
 
-    // Newton-Raphson residual.
-    residual =
-        M * v - p_star - dt * Jn.transpose() * fn - dt * Jt.transpose() * ft;
-
     // Compute gradient dft_dvt = ∇ᵥₜfₜ(vₜ) as a function of fn, mus,
     // t_hat and v_slip.
     CalcFrictionForcesGradient(fn, mu_vt, t_hat, v_slip, &dft_dvt);
 
-    // Newton-Raphson Jacobian, J = ∇ᵥR, as a function of M, dft_dvt, Jt, dt.
-    CalcJacobian(M, Jn, Jt, Gn, dft_dvt, t_hat, mu_vt, dt, &J);
-
-    // TODO(amcastro-tri): Consider using a cheap iterative solver like CG.
-    // Since we are in a non-linear iteration, an approximate cheap solution
-    // is probably best.
-    // TODO(amcastro-tri): Consider using a matrix-free iterative method to
-    // avoid computing M and J. CG and the Krylov family can be matrix-free.
-    if (has_two_way_coupling()) {
-      // LU Factorization of the Newton-Raphson Jacobian J. Only used for
-      // two-way coupled problems with non-symmetric Jacobian.
-      const math::LinearSolver<Eigen::PartialPivLU, MatrixX<T>> J_lu(J);
-      Delta_v = J_lu.Solve(-residual);
-    } else {
-      // LDLT Factorization of the Newton-Raphson Jacobian J. Only used for
-      // one-way coupled problems with symmetric Jacobian.
-      const math::LinearSolver<Eigen::LDLT, MatrixX<T>> J_ldlt(J);
-      Delta_v = J_ldlt.Solve(-residual);
-      const auto& eigen_solver = J_ldlt.eigen_linear_solver();
-      if (eigen_solver.info() != Eigen::Success) {
+    // Since the islands are decoupled, the Newton-Raphson system is solved
+    // one island at a time.
+    for (Island& island : islands_) {
+      if (island.contacts.empty()) continue;
+      if (!CalcNewtonUpdate(dt, &island, &Delta_v)) {
         return TamsiSolverResult::kLinearSolverFailed;
       }
     }
@@ -741,11 +962,9 @@ TamsiSolverResult TamsiSolver<T>::SolveWithGuess(
     // determine by limiting the maximum angle change between vₜᵏ and vₜᵏ⁺¹.
     // For multiple contact points, we choose the minimum α among all contact
     // points.
-    Delta_vt = Jt * Delta_v;
-
-    // Similarly to Δvₜᵏ above, we define the update in the normal velocities
-    // as Δvₙᵏ = Jₙ Δvᵏ.
-    Delta_vn = Jn * Delta_v;
+    // Similarly, we define the update in the normal velocities as
+    // Δvₙᵏ = Jₙ Δvᵏ.
+    CalcContactVelocities(Delta_v, &Delta_vn, &Delta_vt);
 
     // We monitor convergence in both normal and tangential velocities.
     vn_error = ExtractDoubleOrThrow(Delta_vn.norm());
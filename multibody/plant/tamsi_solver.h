@@ -493,6 +493,21 @@ expansion of `fₙ` with an order of approximation consistent with the
 first order scheme as needed. Therefore, it propagates into a `O(δt²)`
 term exactly as needed in Eq. (16).
 
+<h2>Exploiting sparsity</h2>
+
+Generalized velocities that are coupled neither by the mass matrix nor by a
+common contact point (e.g., those of two trees of a MultibodyPlant that are
+not in contact with each other) are independent in Eq. (3). When the problem
+data is set, the solver partitions the velocities into "islands" of coupled
+velocities, using the exact zeros of `M`, `Jₙ` and `Jₜ`, and stores the
+blocks of these matrices that correspond to each island. The Newton-Raphson
+Jacobian is then block diagonal (up to a permutation) and the solver forms
+and factorizes one small dense block per island instead of a single
+`nv x nv` matrix, with a cost that scales with the size of the largest island
+rather than with the size of the whole problem. Islands without contact
+points are solved once, up front. This partition is only done for
+`T = double`; for other scalar types the whole problem is a single island.
+
 <h2>References</h2>
 
 - @anchor castro_etal_2019 [Castro et al., 2019] Castro, A.M, Qu, A.,
@@ -745,6 +760,25 @@ class TamsiSolver {
   // Helper class for unit testing.
   friend class TamsiSolverTester;
 
+  // A set of generalized velocities coupled (directly or indirectly) through
+  // the mass matrix or the contact points, along with those contact points.
+  // The Newton-Raphson Jacobian has no entries coupling different islands.
+  struct Island {
+    // Indices of the island's generalized velocities, in increasing order.
+    std::vector<int> velocities;
+    // Indices of the island's contact points, in increasing order.
+    std::vector<int> contacts;
+    // The rows and columns of M, and the rows of Jn and Jt (two per contact
+    // point), of the island's velocities and contact points.
+    MatrixX<T> M;
+    MatrixX<T> Jn;
+    MatrixX<T> Jt;
+    // Storage for ∇ᵥfₙ and the Newton-Raphson Jacobian restricted to the
+    // island, reused by all iterations.
+    MatrixX<T> Gn;
+    MatrixX<T> J;
+  };
+
   // Contains all the references that define the problem to be solved.
   // These references must remain valid at least from the time they are set with
   // SetOneWayCoupledProblemData() and until SolveWithGuess() returns.
@@ -925,13 +959,11 @@ class TamsiSolver {
       v_.setZero(nv);
       residual_.setZero(nv);
       Delta_v_.setZero(nv);
-      J_.setZero(nv, nv);
       tau_f_.setZero(nv);
       tau_.setZero(nv);
     }
     VectorX<T>& mutable_v() { return v_; }
     VectorX<T>& mutable_residual() { return residual_; }
-    MatrixX<T>& mutable_J() { return J_; }
     VectorX<T>& mutable_Delta_v() { return Delta_v_; }
     VectorX<T>& mutable_tau_f() { return tau_f_; }
     VectorX<T>& mutable_tau() { return tau_; }
@@ -941,8 +973,6 @@ class TamsiSolver {
     VectorX<T> v_;
     // Newton-Raphson residual.
     VectorX<T> residual_;
-    // Newton-Raphson Jacobian, i.e. Jᵢⱼ = ∂Rᵢ/∂vⱼ.
-    MatrixX<T> J_;
     // Solution to Newton-Raphson update, i.e. Δv = −J⁻¹ R.
     VectorX<T> Delta_v_;
     // Vector of generalized forces due to friction.
@@ -983,7 +1013,7 @@ class TamsiSolver {
       v_slip_.resize(nc);
       mus_.resize(nc);
       dft_dv_.resize(nc);
-      Gn_.resize(nc, nv);
+      dfn_dvn_.resize(nc);
     }
 
     // Returns the size of TAMSI's workspace that was last allocated. It is
@@ -1065,9 +1095,12 @@ class TamsiSolver {
     // size nc.
     Eigen::VectorBlock<VectorX<T>> mutable_mu() { return mus_.segment(0, nc_); }
 
-    // Returns a mutable reference to the gradient Gn = ∇ᵥfₙ(xˢ⁺¹, vₙˢ⁺¹)
-    // with respect to the generalized velocites v.
-    Eigen::Block<MatrixX<T>> mutable_Gn() { return Gn_.block(0, 0, nc_, nv_); }
+    // Returns a mutable reference to the vector containing the derivative
+    // ∂fₙ/∂vₙ of the normal force with respect to the normal velocity at each
+    // contact point, of size nc.
+    Eigen::VectorBlock<VectorX<T>> mutable_dfn_dvn() {
+      return dfn_dvn_.segment(0, nc_);
+    }
 
     // Returns a mutable reference to the vector storing ∂fₜ/∂vₜ (in ℝ²ˣ²)
     // for each contact point, of size nc.
@@ -1087,7 +1120,7 @@ class TamsiSolver {
     VectorX<T> mus_;     // (modified) regularized friction, in ℝⁿᶜ.
     // Vector of size nc storing ∂fₜ/∂vₜ (in ℝ²ˣ²) for each contact point.
     std::vector<Matrix2<T>> dft_dv_;
-    MatrixX<T> Gn_;  // ∇ᵥfₙ(xˢ⁺¹, vₙˢ⁺¹), in ℝⁿᶜˣⁿᵛ
+    VectorX<T> dfn_dvn_;  // ∂fₙ/∂vₙ, in ℝⁿᶜ.
   };
 
   // Returns true if the solver is solving the two-way coupled problem.
@@ -1101,11 +1134,12 @@ class TamsiSolver {
   //       k(vₙ) = k (1 − d vₙ)₊
   // where `x₊` is max(x, 0) and k and d are the stiffness and
   // dissipation coefficients for a given contact point, respectively.
-  // In addition, this method also computes the gradient
-  // Gn = ∇ᵥfₙ(xˢ⁺¹, vₙˢ⁺¹).
-  void CalcNormalForces(const Eigen::Ref<const VectorX<T>>& vn,
-                        const Eigen::Ref<const MatrixX<T>>& Jn, double dt,
-                        EigenPtr<VectorX<T>> fn, EigenPtr<MatrixX<T>> Gn) const;
+  // In addition, this method also computes the derivative dfn_dvn = ∂fₙ/∂vₙ
+  // (zero for the one-way coupled problem), from which the gradient
+  // Gn = ∇ᵥfₙ(xˢ⁺¹, vₙˢ⁺¹) = diag(dfn_dvn) Jn.
+  void CalcNormalForces(const Eigen::Ref<const VectorX<T>>& vn, double dt,
+                        EigenPtr<VectorX<T>> fn,
+                        EigenPtr<VectorX<T>> dfn_dvn) const;
 
   // Helper to compute fₜ(vₜ) = −vₜ/‖vₜ‖ₛ μ(‖vₜ‖ₛ) fₙ, where ‖vₜ‖ₛ
   // is the "soft norm" of vₜ. In addition this method computes
@@ -1130,7 +1164,8 @@ class TamsiSolver {
                                   std::vector<Matrix2<T>>* dft_dvt) const;
 
   // Helper method to compute the Newton-Raphson Jacobian, J = ∇ᵥR, as a
-  // function of M, Jn, Jt, Gn, dft_dvt, t_hat, mu_vt and dt.
+  // function of M, Jn, Jt, Gn, dft_dvt, t_hat, mu_vt and dt. The arguments
+  // may be those of the whole problem or those restricted to an Island.
   void CalcJacobian(const Eigen::Ref<const MatrixX<T>>& M,
                     const Eigen::Ref<const MatrixX<T>>& Jn,
                     const Eigen::Ref<const MatrixX<T>>& Jt,
@@ -1140,6 +1175,27 @@ class TamsiSolver {
                     const Eigen::Ref<const VectorX<T>>& mu_vt, double dt,
                     EigenPtr<MatrixX<T>> J) const;
 
+  // Partitions the problem data last set into islands_.
+  void CalcIslands();
+
+  // Computes vn = Jn v and vt = Jt v, island by island.
+  void CalcContactVelocities(const Eigen::Ref<const VectorX<T>>& v,
+                             EigenPtr<VectorX<T>> vn,
+                             EigenPtr<VectorX<T>> vt) const;
+
+  // Computes the generalized friction forces tau_f = Jtᵀ ft and the total
+  // generalized contact forces tau = tau_f + Jnᵀ fn, island by island.
+  void CalcGeneralizedForces(const Eigen::Ref<const VectorX<T>>& fn,
+                             const Eigen::Ref<const VectorX<T>>& ft,
+                             EigenPtr<VectorX<T>> tau_f,
+                             EigenPtr<VectorX<T>> tau) const;
+
+  // Computes the Newton-Raphson update Δv = −J⁻¹ R for the velocities of
+  // `island`, which must have contact points, writing it into the island's
+  // entries of Delta_v. Returns false if the factorization of J failed.
+  bool CalcNewtonUpdate(double dt, Island* island,
+                        EigenPtr<VectorX<T>> Delta_v) const;
+
   // Limit the per-iteration angle change between vₜᵏ⁺¹ and vₜᵏ for
   // all contact points. The angle change θ is defined by the dot product
   // between vₜᵏ⁺¹ and vₜᵏ as: cos(θ) = vₜᵏ⁺¹⋅vₜᵏ/(‖vₜᵏ⁺¹‖‖vₜᵏ‖).
@@ -1189,6 +1245,11 @@ class TamsiSolver {
   // thread-unsafe integration elsewhere.
   mutable FixedSizeWorkspace fixed_size_workspace_;
   mutable VariableSizeWorkspace variable_size_workspace_;
+  // The islands of the problem data last set. Every contact point belongs to
+  // exactly one island.
+  // TODO(#15674): Adding mutability here is in part a consequence of
+  // thread-unsafe integration elsewhere.
+  mutable std::vector<Island> islands_;
 
   // Precomputed value of cos(theta_max), used by TalsLimiter.
   double cos_theta_max_{std::cos(parameters_.theta_max)};
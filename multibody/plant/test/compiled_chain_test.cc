@@ -0,0 +1,154 @@
+#include "drake/multibody/plant/compiled_chain.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
+#include "drake/math/autodiff.h"
+#include "drake/math/roll_pitch_yaw.h"
+#include "drake/multibody/tree/prismatic_joint.h"
+#include "drake/multibody/tree/revolute_joint.h"
+#include "drake/multibody/tree/weld_joint.h"
+
+namespace drake {
+namespace multibody {
+namespace {
+
+using Eigen::MatrixXd;
+using Eigen::Vector3d;
+using Eigen::VectorXd;
+using math::RigidTransformd;
+using math::RollPitchYawd;
+using systems::Context;
+
+constexpr double kTolerance = 1e-12;
+
+// A base welded to the world, carrying an arm with revolute, prismatic and
+// welded links, and a second branch with a single revolute link. All frame
+// offsets and inertias are arbitrary.
+class CompiledChainTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    auto add_body = [this](const std::string& name, double mass) {
+      return &plant_.AddRigidBody(
+          name, SpatialInertia<double>::SolidBoxWithMass(mass, 0.1, 0.2, 0.3));
+    };
+    const RigidBody<double>* base = add_body("base", 5.0);
+    const RigidBody<double>* link1 = add_body("link1", 2.0);
+    const RigidBody<double>* link2 = add_body("link2", 1.5);
+    const RigidBody<double>* link3 = add_body("link3", 1.0);
+    const RigidBody<double>* tool = add_body("tool", 0.5);
+    const RigidBody<double>* other = add_body("other", 0.8);
+    const RigidTransformd X_1(RollPitchYawd(0.1, 0.2, 0.3),
+                              Vector3d(0.1, 0, 0.2));
+    const RigidTransformd X_2(RollPitchYawd(-0.3, 0.1, 0.4),
+                              Vector3d(0, 0.05, 0.3));
+    plant_.AddJoint<WeldJoint>("weld", plant_.world_body(), X_1, *base,
+                               std::nullopt, X_2);
+    const auto& joint1 = plant_.AddJoint<RevoluteJoint>(
+        "joint1", *base, X_1, *link1, X_2, Vector3d(0, 0.6, 0.8));
+    plant_.AddJoint<PrismaticJoint>("joint2", *link1, X_2, *link2, X_1,
+                                    Vector3d(1, 0, 0));
+    plant_.AddJoint<RevoluteJoint>("joint3", *link2, X_1, *link3,
+                                   std::nullopt, Vector3d::UnitZ());
+    plant_.AddJoint<WeldJoint>("tool_weld", *link3, std::nullopt, *tool, X_2,
+                               X_1);
+    plant_.AddJoint<RevoluteJoint>("joint4", *base, X_2, *other, X_1,
+                                   Vector3d::UnitY());
+    JointActuator<double>& actuator = plant_.get_mutable_joint_actuator(
+        plant_.AddJointActuator("actuator1", joint1).index());
+    actuator.set_default_rotor_inertia(0.1);
+    actuator.set_default_gear_ratio(3.0);
+    plant_.Finalize();
+    tool_ = tool->index();
+    context_ = plant_.CreateDefaultContext();
+    plant_.SetPositions(context_.get(), VectorXd::LinSpaced(4, 0.3, -0.7));
+    plant_.SetVelocities(context_.get(), VectorXd::LinSpaced(4, -1.0, 2.0));
+  }
+
+  MultibodyPlant<double> plant_{0.0};
+  BodyIndex tool_;
+  std::unique_ptr<Context<double>> context_;
+};
+
+TEST_F(CompiledChainTest, Kinematics) {
+  const CompiledChain<double> dut(plant_, *context_);
+  EXPECT_EQ(dut.num_bodies(), 7);
+  EXPECT_EQ(dut.num_velocities(), 4);
+
+  std::vector<RigidTransformd> X_WB;
+  dut.CalcBodyPosesInWorld(plant_.GetPositions(*context_), &X_WB);
+  ASSERT_EQ(X_WB.size(), 7);
+  for (BodyIndex i(0); i < plant_.num_bodies(); ++i) {
+    EXPECT_TRUE(X_WB[i].IsNearlyEqualTo(
+        plant_.EvalBodyPoseInWorld(*context_, plant_.get_body(i)),
+        kTolerance));
+  }
+
+  const Vector3d p_BoBp_B(0.1, -0.2, 0.3);
+  for (BodyIndex i(0); i < plant_.num_bodies(); ++i) {
+    MatrixXd J(6, 4);
+    MatrixXd J_expected(6, 4);
+    dut.CalcJacobianSpatialVelocity(X_WB, i, p_BoBp_B, &J);
+    plant_.CalcJacobianSpatialVelocity(
+        *context_, JacobianWrtVariable::kV, plant_.get_body(i).body_frame(),
+        p_BoBp_B, plant_.world_frame(), plant_.world_frame(), &J_expected);
+    EXPECT_TRUE(CompareMatrices(J, J_expected, kTolerance));
+  }
+}
+
+TEST_F(CompiledChainTest, InverseDynamics) {
+  const CompiledChain<double> dut(plant_, *context_);
+  const VectorXd vdot = VectorXd::LinSpaced(4, 2.0, -1.0);
+  VectorXd tau(4);
+  dut.CalcInverseDynamics(plant_.GetPositions(*context_),
+                          plant_.GetVelocities(*context_), vdot, &tau);
+
+  MultibodyForces<double> forces(plant_);
+  plant_.CalcForceElementsContribution(*context_, &forces);
+  const VectorXd tau_expected =
+      plant_.CalcInverseDynamics(*context_, vdot, forces);
+  EXPECT_TRUE(CompareMatrices(tau, tau_expected, kTolerance));
+}
+
+// The compiled model supports the same scalar types as the plant.
+TEST_F(CompiledChainTest, AutoDiff) {
+  const auto plant_ad = systems::System<double>::ToAutoDiffXd(plant_);
+  auto context_ad = plant_ad->CreateDefaultContext();
+  context_ad->SetTimeStateAndParametersFrom(*context_);
+  const CompiledChain<AutoDiffXd> dut(*plant_ad, *context_ad);
+  std::vector<math::RigidTransform<AutoDiffXd>> X_WB;
+  dut.CalcBodyPosesInWorld(plant_ad->GetPositions(*context_ad), &X_WB);
+  EXPECT_TRUE(CompareMatrices(
+      math::ExtractValue(X_WB[tool_].GetAsMatrix34()),
+      plant_.EvalBodyPoseInWorld(*context_, plant_.get_body(tool_))
+          .GetAsMatrix34(),
+      kTolerance));
+}
+
+TEST_F(CompiledChainTest, Errors) {
+  const CompiledChain<double> dut(plant_, *context_);
+  std::vector<RigidTransformd> X_WB;
+  EXPECT_THROW(dut.CalcBodyPosesInWorld(VectorXd(3), &X_WB), std::exception);
+  dut.CalcBodyPosesInWorld(VectorXd::Zero(4), &X_WB);
+  MatrixXd J(6, 3);
+  EXPECT_THROW(dut.CalcJacobianSpatialVelocity(X_WB, tool_, Vector3d::Zero(),
+                                               &J),
+               std::exception);
+
+  MultibodyPlant<double> free_body_plant(0.0);
+  free_body_plant.AddRigidBody("free", SpatialInertia<double>::MakeUnitary());
+  free_body_plant.Finalize();
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      CompiledChain<double>(free_body_plant,
+                            *free_body_plant.CreateDefaultContext()),
+      ".*joint 'free'.*quaternion_floating.*");
+}
+
+}  // namespace
+}  // namespace multibody
+}  // namespace drake
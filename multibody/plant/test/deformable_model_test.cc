@@ -71,6 +71,26 @@ TEST_F(DeformableModelTest, RegisterDeformableBody) {
       ".*RegisterDeformableBody.*after system resources have been declared.*");
 }
 
+/* Verifies that the parallelism is applied to the FEM models of bodies
+ registered both before and after it is set. */
+TEST_F(DeformableModelTest, SetParallelism) {
+  constexpr double kRezHint = 0.5;
+  const DeformableBodyId body0 = RegisterSphere(kRezHint);
+  EXPECT_EQ(deformable_model_ptr_->parallelism().num_threads(), 1);
+  deformable_model_ptr_->SetParallelism(Parallelism(2));
+  EXPECT_EQ(deformable_model_ptr_->parallelism().num_threads(), 2);
+  const DeformableBodyId body1 = RegisterSphere(kRezHint);
+  EXPECT_EQ(
+      deformable_model_ptr_->GetFemModel(body0).parallelism().num_threads(), 2);
+  EXPECT_EQ(
+      deformable_model_ptr_->GetFemModel(body1).parallelism().num_threads(), 2);
+
+  plant_->Finalize();
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      deformable_model_ptr_->SetParallelism(Parallelism::None()),
+      ".*SetParallelism.*after system resources have been declared.*");
+}
+
 /* Coarsely tests that SetWallBoundaryCondition adds some sort of boundary
  condition. Showing that boundary conditions only get conditionally added (based
  on location of the boundary wall) is sufficient evidence to infer that the
@@ -6,9 +6,12 @@
 #include "drake/common/test_utilities/expect_no_throw.h"
 #include "drake/common/test_utilities/expect_throws_message.h"
 #include "drake/common/test_utilities/limit_malloc.h"
+#include "drake/math/autodiff_gradient.h"
 #include "drake/multibody/plant/multibody_plant.h"
 #include "drake/multibody/plant/test/kuka_iiwa_model_tests.h"
 #include "drake/multibody/tree/prismatic_joint.h"
+#include "drake/multibody/tree/revolute_joint.h"
+#include "drake/multibody/tree/screw_joint.h"
 #include "drake/systems/framework/context.h"
 #include "drake/systems/primitives/linear_system.h"
 
@@ -728,6 +731,106 @@ GTEST_TEST(JointLocking, FreebodyAccelerationTest) {
   }
 }
 
+// Builds a branched tree of boxes with revolute, prismatic, screw, and weld
+// joints, with joint frames offset from the body frames.
+std::unique_ptr<MultibodyPlant<double>> MakeBranchedTree() {
+  auto plant = std::make_unique<MultibodyPlant<double>>(0.0);
+  const RigidBody<double>& A = AddBoxLink(plant.get(), "A", 1.5, 0.4, 0.1, 0.2);
+  const RigidBody<double>& B = AddBoxLink(plant.get(), "B", 0.7, 0.3, 0.2, 0.1);
+  const RigidBody<double>& C = AddBoxLink(plant.get(), "C", 0.9, 0.5, 0.1, 0.1);
+  const RigidBody<double>& D = AddBoxLink(plant.get(), "D", 1.2, 0.2, 0.3, 0.1);
+  const RigidBody<double>& E = AddBoxLink(plant.get(), "E", 0.4, 0.1, 0.1, 0.3);
+  const RigidBody<double>& F = AddBoxLink(plant.get(), "F", 0.8, 0.2, 0.2, 0.2);
+  plant->AddJoint<RevoluteJoint>(
+      "world_A", plant->world_body(),
+      RigidTransformd(math::RollPitchYawd(0.1, 0.2, 0.3), Vector3d(0, 0, 1)),
+      A, {}, Vector3d::UnitZ());
+  plant->AddJoint<PrismaticJoint>(
+      "A_B", A, RigidTransformd(Vector3d(0.4, 0, 0)), B,
+      RigidTransformd(math::RollPitchYawd(0.3, -0.2, 0.5), Vector3d::Zero()),
+      Vector3d::UnitX());
+  plant->AddJoint<RevoluteJoint>(
+      "B_C", B, RigidTransformd(Vector3d(0.3, 0.1, 0)), C,
+      RigidTransformd(Vector3d(-0.05, 0, 0.02)),
+      Vector3d(1, 1, 0).normalized());
+  plant->AddJoint<ScrewJoint>(
+      "A_D", A, RigidTransformd(Vector3d(0, 0.1, -0.1)), D, {},
+      Vector3d(0, 1, 1).normalized(), 0.2, 0.0);
+  plant->WeldFrames(C.body_frame(), E.body_frame(),
+                    RigidTransformd(Vector3d(0.5, 0, 0.1)));
+  plant->AddJoint<RevoluteJoint>(
+      "E_F", E, RigidTransformd(Vector3d(0.1, 0.2, 0)), F, {},
+      Vector3d::UnitY());
+  plant->mutable_gravity_field().set_gravity_vector(Vector3d(0.5, -1.0, -9.8));
+  plant->Finalize();
+  return plant;
+}
+
+// Verifies the analytic inverse dynamics derivatives against the derivatives
+// computed with automatic differentiation.
+GTEST_TEST(DynamicsDerivativesTest, InverseDynamics) {
+  const std::unique_ptr<MultibodyPlant<double>> plant = MakeBranchedTree();
+  const int nq = plant->num_positions();
+  const int nv = plant->num_velocities();
+  ASSERT_EQ(nq, 5);
+  ASSERT_EQ(nv, 5);
+  auto context = plant->CreateDefaultContext();
+  VectorXd x(nq + nv);
+  x << 0.3, -0.2, 1.1, 0.7, -0.4, 1.2, -0.6, 0.9, 2.0, -1.5;
+  const VectorXd vdot = (VectorXd(nv) << 0.5, -1.3, 0.2, 2.1, -0.7).finished();
+  plant->SetPositionsAndVelocities(context.get(), x);
+
+  MatrixX<double> dtau_dq(nv, nq);
+  MatrixX<double> dtau_dv(nv, nv);
+  plant->CalcInverseDynamicsDerivatives(*context, vdot, &dtau_dq, &dtau_dv);
+
+  // The inverse dynamics include gravity, but no other forces.
+  const std::unique_ptr<MultibodyPlant<AutoDiffXd>> plant_ad =
+      systems::System<double>::ToAutoDiffXd(*plant);
+  auto context_ad = plant_ad->CreateDefaultContext();
+  plant_ad->SetPositionsAndVelocities(context_ad.get(),
+                                      math::InitializeAutoDiff(x));
+  MultibodyForces<AutoDiffXd> forces(*plant_ad);
+  plant_ad->CalcForceElementsContribution(*context_ad, &forces);
+  const VectorX<AutoDiffXd> tau_ad = plant_ad->CalcInverseDynamics(
+      *context_ad, vdot.cast<AutoDiffXd>(), forces);
+  const MatrixX<double> dtau_dx = math::ExtractGradient(tau_ad);
+  EXPECT_TRUE(CompareMatrices(dtau_dq, dtau_dx.leftCols(nq), 1e-12,
+                              MatrixCompareType::relative));
+  EXPECT_TRUE(CompareMatrices(dtau_dv, dtau_dx.rightCols(nv), 1e-12,
+                              MatrixCompareType::relative));
+
+  // The forward dynamics derivatives follow from the inverse dynamics ones.
+  const VectorXd tau = (VectorXd(nv) << 1.0, -2.0, 0.5, 0.3, -0.1).finished();
+  VectorXd vdot_fd(nv);
+  MatrixX<double> dvdot_dq(nv, nq);
+  MatrixX<double> dvdot_dv(nv, nv);
+  MatrixX<double> dvdot_dtau(nv, nv);
+  plant->CalcForwardDynamicsDerivatives(*context, tau, &vdot_fd, &dvdot_dq,
+                                        &dvdot_dv, &dvdot_dtau);
+  MatrixX<double> M(nv, nv);
+  plant->CalcMassMatrix(*context, &M);
+  MultibodyForces<double> forces_fd(*plant);
+  plant->CalcForceElementsContribution(*context, &forces_fd);
+  EXPECT_TRUE(CompareMatrices(
+      plant->CalcInverseDynamics(*context, vdot_fd, forces_fd), tau, 1e-12));
+  plant->CalcInverseDynamicsDerivatives(*context, vdot_fd, &dtau_dq, &dtau_dv);
+  EXPECT_TRUE(CompareMatrices(M * dvdot_dq, -dtau_dq, 1e-12));
+  EXPECT_TRUE(CompareMatrices(M * dvdot_dv, -dtau_dv, 1e-12));
+  EXPECT_TRUE(CompareMatrices(M * dvdot_dtau, MatrixX<double>::Identity(nv, nv),
+                              1e-12));
+}
+
+TEST_F(KukaIiwaModelForwardDynamicsTests, DynamicsDerivativesFloatingBase) {
+  const int nv = plant_->num_velocities();
+  MatrixX<double> dtau_dq(nv, plant_->num_positions());
+  MatrixX<double> dtau_dv(nv, nv);
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      plant_->CalcInverseDynamicsDerivatives(*context_, VectorXd::Zero(nv),
+                                             &dtau_dq, &dtau_dv),
+      ".*Only revolute, prismatic, screw, and weld joints.*");
+}
+
 }  // namespace
 }  // namespace multibody
 }  // namespace drake
@@ -18,7 +18,10 @@ namespace {
 
 class HydroelasticContactResultsOutputTester : public ::testing::Test {
  protected:
-  void SetUp() {
+  void SetUp() { MakePlant(0.0 /* time_step */, true); }
+
+  // (Re)builds the diagram with a plant of the given time step.
+  void MakePlant(double time_step, bool report_quadrature_data) {
     const double radius = 1.0;  // sphere radius (m).
 
     // The vertical location of the sphere. Since this value is smaller than the
@@ -38,7 +41,7 @@ class HydroelasticContactResultsOutputTester : public ::testing::Test {
 
     // Create the plant.
     systems::DiagramBuilder<double> builder;
-    plant_ = &AddMultibodyPlantSceneGraph(&builder, 0.0 /* time_step */).plant;
+    plant_ = &AddMultibodyPlantSceneGraph(&builder, time_step).plant;
 
     // TODO(SeanCurtis-TRI): This should _not_ be using code from the examples/
     //  directory. Examples code shouldn't feed back into other code.
@@ -46,6 +49,7 @@ class HydroelasticContactResultsOutputTester : public ::testing::Test {
         radius, mass, hydroelastic_modulus, dissipation, friction, gravity_W,
         false /* rigid_sphere */, false /* compliant_ground */, plant_);
     plant_->set_contact_model(ContactModel::kHydroelastic);
+    plant_->set_report_hydroelastic_quadrature_data(report_quadrature_data);
     plant_->Finalize();
 
     diagram_ = builder.Build();
@@ -217,6 +221,35 @@ TEST_F(HydroelasticContactResultsOutputTester, Traction) {
   }
 }
 
+// Checks that, when the plant does not report quadrature point data, the
+// contact results carry the same resultant force but no quadrature data.
+TEST_F(HydroelasticContactResultsOutputTester, QuadratureDataNotReported) {
+  for (const double time_step : {0.0, 1e-3}) {
+    MakePlant(time_step, true);
+    EXPECT_TRUE(plant_->get_report_hydroelastic_quadrature_data());
+    const SpatialForce<double> F_Ac_W = contact_results().F_Ac_W();
+    EXPECT_FALSE(contact_results().quadrature_point_data().empty());
+
+    MakePlant(time_step, false);
+    EXPECT_FALSE(plant_->get_report_hydroelastic_quadrature_data());
+    EXPECT_TRUE(contact_results().quadrature_point_data().empty());
+    EXPECT_TRUE(CompareMatrices(contact_results().F_Ac_W().get_coeffs(),
+                                F_Ac_W.get_coeffs()));
+  }
+}
+
+// Checks that copies of the contact results share the quadrature point data.
+TEST_F(HydroelasticContactResultsOutputTester, CopySharesQuadratureData) {
+  const ContactResults<double> copy =
+      plant_->get_contact_results_output_port().Eval<ContactResults<double>>(
+          *plant_context_);
+  const ContactResults<double> copy_of_copy = copy;
+  EXPECT_EQ(&copy.hydroelastic_contact_info(0).quadrature_point_data(),
+            &copy_of_copy.hydroelastic_contact_info(0).quadrature_point_data());
+  EXPECT_EQ(&copy.hydroelastic_contact_info(0).quadrature_point_data(),
+            &contact_results().quadrature_point_data());
+}
+
 // TODO(amcastro-tri): Replace this *suggestive* test with an alternative test
 //  that tests for actual derivative values. See the comments in PR 15219 for
 //  discussion:
@@ -1,5 +1,6 @@
 #include <limits>
 #include <memory>
+#include <vector>
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
@@ -262,6 +263,52 @@ TEST_F(KukaIiwaModelTests, CalcJacobianSpatialVelocity) {
                               MatrixCompareType::relative));
 }
 
+// Jacobians computed together equal those computed one point at a time.
+TEST_F(KukaIiwaModelTests, CalcJacobiansSpatialVelocity) {
+  SetArbitraryConfigurationAndMotion();
+  const Frame<double>& link3_frame =
+      plant_->GetBodyByName("iiwa_link_3").body_frame();
+  const Frame<double>* frame_H = frame_H_;
+  const Frame<double>* frame_W = &plant_->world_frame();
+  const std::vector<const Frame<double>*> frames_B{
+      &end_effector_link_->body_frame(), frame_H, &link3_frame,
+      frame_W, frame_H};
+  Matrix3X<double> p_BoBp_B(3, 5);
+  p_BoBp_B << 0.1, 0.0, -0.2, 0.3, 0.0,
+              0.2, 0.1, 0.0, -0.1, 0.0,
+              -0.1, 0.3, 0.1, 0.2, 0.0;
+
+  const double kTolerance = 64 * std::numeric_limits<double>::epsilon();
+  for (const JacobianWrtVariable wrt :
+       {JacobianWrtVariable::kV, JacobianWrtVariable::kQDot}) {
+    const int n = (wrt == JacobianWrtVariable::kV) ? plant_->num_velocities()
+                                                   : plant_->num_positions();
+    for (const Frame<double>* frame_A :
+         {frame_W, &link3_frame, frame_H}) {
+      for (const Frame<double>* frame_E : {frame_W, frame_H}) {
+        MatrixXd Js_V_ABp_E(6 * 5, n);
+        plant_->CalcJacobiansSpatialVelocity(*context_, wrt, frames_B,
+                                             p_BoBp_B, *frame_A, *frame_E,
+                                             &Js_V_ABp_E);
+        for (int i = 0; i < 5; ++i) {
+          MatrixXd Js_V_ABpi_E(6, n);
+          plant_->CalcJacobianSpatialVelocity(
+              *context_, wrt, *frames_B[i], p_BoBp_B.col(i), *frame_A,
+              *frame_E, &Js_V_ABpi_E);
+          EXPECT_TRUE(CompareMatrices(Js_V_ABp_E.middleRows(6 * i, 6),
+                                      Js_V_ABpi_E, kTolerance));
+        }
+      }
+    }
+  }
+
+  MatrixXd wrong_size(6 * 4, plant_->num_velocities());
+  EXPECT_THROW(plant_->CalcJacobiansSpatialVelocity(
+                   *context_, JacobianWrtVariable::kV, frames_B, p_BoBp_B,
+                   plant_->world_frame(), plant_->world_frame(), &wrong_size),
+               std::exception);
+}
+
 TEST_F(KukaIiwaModelTests, CalcJacobianTranslationalVelocityB) {
   // Form two position vectors, one for each point Ei (i = 1, 2).
   // Each point is regarded as fixed/welded to the end effector frame E.
@@ -804,7 +851,7 @@ TEST_F(KukaIiwaModelTests, CalcBiasSpatialAcceleration) {
                                           frame_E, p_EEp, frame_W, frame_W);
 
   // Numerical tolerance used to verify numerical results.
-  const double kTolerance = 16 * std::numeric_limits<double>::epsilon();
+  const double kTolerance = 64 * std::numeric_limits<double>::epsilon();
 
   // Verify computed bias translational acceleration numerical values and ensure
   // the results are stored in a matrix of size (6 x num_velocities).
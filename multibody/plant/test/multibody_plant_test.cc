@@ -4754,6 +4754,181 @@ GTEST_TEST(MultibodyPlantTest, RenameModelInstance) {
                               ".*finalized.*");
 }
 
+// A wide tree (many free bodies, each carrying a pendulum) is computed level
+// by level on several threads when asked to. The results must be identical to
+// the serial results.
+GTEST_TEST(MultibodyPlantTest, TreeParallelism) {
+  const int kNumBodies = 40;
+  MultibodyPlant<double> plant(0.0);
+  EXPECT_EQ(plant.get_tree_parallelism().num_threads(), 1);
+  for (int i = 0; i < kNumBodies; ++i) {
+    const RigidBody<double>& base = plant.AddRigidBody(
+        "base" + std::to_string(i), SpatialInertia<double>::MakeUnitary());
+    const RigidBody<double>& link = plant.AddRigidBody(
+        "link" + std::to_string(i),
+        SpatialInertia<double>::SolidBoxWithMass(0.5, 0.1, 0.2, 0.3));
+    plant.AddJoint<RevoluteJoint>("pin" + std::to_string(i), base,
+                                  RigidTransformd(Vector3d(0, 0, -0.1)), link,
+                                  {}, Vector3d(1, 2, 3).normalized());
+  }
+  plant.Finalize();
+
+  std::unique_ptr<Context<double>> context = plant.CreateDefaultContext();
+  for (int i = 0; i < kNumBodies; ++i) {
+    const std::string suffix = std::to_string(i);
+    plant.SetFreeBodyPose(
+        context.get(), plant.GetBodyByName("base" + suffix),
+        RigidTransformd(RollPitchYawd(0.1 * i, -0.2, 0.03 * i),
+                        Vector3d(i, 0.5, -0.1 * i)));
+    plant.GetJointByName<RevoluteJoint>("pin" + suffix)
+        .set_angle(context.get(), 0.05 * i);
+  }
+  const VectorXd v = VectorXd::LinSpaced(plant.num_velocities(), -1.0, 1.0);
+  plant.SetVelocities(context.get(), v);
+  const VectorXd vdot = VectorXd::LinSpaced(plant.num_velocities(), 2.0, -1.0);
+  const MultibodyForces<double> forces(plant);
+
+  auto compute = [&]() {
+    // Invalidate the cache, so that it is recomputed with the current
+    // parallelism.
+    plant.SetVelocities(context.get(), v);
+    std::vector<RigidTransformd> poses;
+    std::vector<SpatialVelocity<double>> velocities;
+    for (BodyIndex i(0); i < plant.num_bodies(); ++i) {
+      const Body<double>& body = plant.get_body(i);
+      poses.push_back(plant.EvalBodyPoseInWorld(*context, body));
+      velocities.push_back(
+          plant.EvalBodySpatialVelocityInWorld(*context, body));
+    }
+    const VectorXd xdot = plant.EvalTimeDerivatives(*context).CopyToVector();
+    const VectorXd tau = plant.CalcInverseDynamics(*context, vdot, forces);
+    MatrixX<double> M(plant.num_velocities(), plant.num_velocities());
+    plant.CalcMassMatrix(*context, &M);
+    return std::make_tuple(poses, velocities, xdot, tau, M);
+  };
+
+  const auto [poses, velocities, xdot, tau, M] = compute();
+  plant.set_tree_parallelism(Parallelism(4));
+  EXPECT_EQ(plant.get_tree_parallelism().num_threads(), 4);
+  const auto [poses_par, velocities_par, xdot_par, tau_par, M_par] =
+      compute();
+  for (int i = 0; i < plant.num_bodies(); ++i) {
+    EXPECT_TRUE(poses_par[i].IsExactlyEqualTo(poses[i]));
+    EXPECT_EQ(velocities_par[i].get_coeffs(), velocities[i].get_coeffs());
+  }
+  EXPECT_EQ(xdot_par, xdot);
+  EXPECT_EQ(tau_par, tau);
+  EXPECT_EQ(M_par, M);
+}
+
+// Changing the mass properties of a body invalidates the computations that
+// depend on them (e.g., the mass matrix), but not those that only depend on
+// the configuration (e.g., the body and geometry poses). Changing the pose of
+// a frame does invalidate the latter.
+GTEST_TEST(MultibodyPlantTest, MassPropertiesInvalidation) {
+  for (const double time_step : {0.0, 0.01}) {
+    MultibodyPlant<double> plant(time_step);
+    SceneGraph<double> scene_graph;
+    plant.RegisterAsSourceForSceneGraph(&scene_graph);
+    const RigidBody<double>& link = plant.AddRigidBody(
+        "link", SpatialInertia<double>::SolidBoxWithMass(1.0, 0.1, 0.2, 0.3));
+    plant.AddJoint<RevoluteJoint>("pin", plant.world_body(), {}, link,
+                                  RigidTransformd(Vector3d(0, 0, 0.5)),
+                                  Vector3d::UnitY());
+    plant.RegisterCollisionGeometry(link, {}, geometry::Sphere(0.1), "sphere",
+                                    CoulombFriction<double>());
+    const FixedOffsetFrame<double>& offset =
+        plant.AddFrame(std::make_unique<FixedOffsetFrame<double>>(
+            "offset", link, RigidTransformd(Vector3d(0, 0, 1))));
+    plant.Finalize();
+    std::unique_ptr<Context<double>> context = plant.CreateDefaultContext();
+
+    auto cache_entry = [](const systems::OutputPort<double>& port)
+        -> const systems::CacheEntry& {
+      return dynamic_cast<const systems::LeafOutputPort<double>&>(port)
+          .cache_entry();
+    };
+    const systems::CacheEntry& geometry_poses =
+        cache_entry(plant.get_geometry_poses_output_port());
+    const systems::CacheEntry& body_poses =
+        cache_entry(plant.get_body_poses_output_port());
+    plant.get_geometry_poses_output_port().Eval<FramePoseVector<double>>(
+        *context);
+    plant.get_body_poses_output_port()
+        .Eval<std::vector<RigidTransformd>>(*context);
+    MatrixX<double> M(1, 1);
+    plant.CalcMassMatrix(*context, &M);
+    EXPECT_NEAR(M(0, 0), 0.25 + 0.1 * 0.1 / 12 + 0.3 * 0.3 / 12, 1e-14);
+
+    link.SetMass(context.get(), 2.0);
+    EXPECT_FALSE(geometry_poses.is_out_of_date(*context));
+    EXPECT_FALSE(body_poses.is_out_of_date(*context));
+    plant.CalcMassMatrix(*context, &M);
+    EXPECT_NEAR(M(0, 0), 2.0 * (0.25 + 0.1 * 0.1 / 12 + 0.3 * 0.3 / 12),
+                1e-14);
+
+    offset.SetPoseInParentFrame(context.get(),
+                                RigidTransformd(Vector3d(0, 0, 2)));
+    EXPECT_TRUE(geometry_poses.is_out_of_date(*context));
+    EXPECT_TRUE(body_poses.is_out_of_date(*context));
+  }
+}
+
+// The sparse factorization of the mass matrix of a branched model solves the
+// same systems as a dense factorization.
+GTEST_TEST(MultibodyPlantTest, MassMatrixFactorization) {
+  MultibodyPlant<double> plant(0.0);
+  const SpatialInertia<double> M_BBo_B =
+      SpatialInertia<double>::SolidBoxWithMass(0.5, 0.1, 0.2, 0.3);
+  const RigidBody<double>& base = plant.AddRigidBody("base", M_BBo_B);
+  // A welded body between the base and the arms does not add velocities.
+  const RigidBody<double>& mount = plant.AddRigidBody("mount", M_BBo_B);
+  plant.WeldFrames(base.body_frame(), mount.body_frame(),
+                   RigidTransformd(Vector3d(0, 0, 0.1)));
+  std::vector<const RevoluteJoint<double>*> joints;
+  for (const std::string& arm : {"left", "right"}) {
+    const Body<double>* parent = &mount;
+    for (int i = 0; i < 3; ++i) {
+      const RigidBody<double>& link =
+          plant.AddRigidBody(arm + std::to_string(i), M_BBo_B);
+      joints.push_back(&plant.AddJoint<RevoluteJoint>(
+          arm + "_joint" + std::to_string(i), *parent,
+          RigidTransformd(Vector3d(0, 0.1, 0)), link, {},
+          Vector3d(1, 0, 1).normalized()));
+      parent = &link;
+    }
+  }
+  plant.Finalize();
+  const int nv = plant.num_velocities();
+  ASSERT_EQ(nv, 12);
+
+  std::unique_ptr<Context<double>> context = plant.CreateDefaultContext();
+  plant.SetFreeBodyPose(context.get(), base,
+                        RigidTransformd(RollPitchYawd(0.3, -0.2, 0.1),
+                                        Vector3d(0.5, 0, 0)));
+  double angle = -0.5;
+  for (const RevoluteJoint<double>* joint : joints) {
+    joint->set_angle(context.get(), angle);
+    angle += 0.2;
+  }
+  MatrixX<double> M(nv, nv);
+  plant.CalcMassMatrix(*context, &M);
+
+  const MassMatrixFactorization<double> M_ltdl =
+      plant.CalcMassMatrixFactorization(*context);
+  EXPECT_EQ(M_ltdl.size(), nv);
+  const MatrixX<double> L = M_ltdl.CalcL();
+  EXPECT_TRUE(CompareMatrices(L.transpose() * M_ltdl.CalcD().asDiagonal() * L,
+                              M, 1e-13));
+  // The velocities of the two arms do not couple in L.
+  EXPECT_EQ(M_ltdl.parents()[6], 5);
+  EXPECT_EQ(M_ltdl.parents()[9], 5);
+  EXPECT_TRUE(L.block(9, 6, 3, 3).isZero());
+
+  const MatrixX<double> b = MatrixX<double>::Identity(nv, nv);
+  EXPECT_TRUE(CompareMatrices(M_ltdl.Solve(b), M.ldlt().solve(b), 1e-12));
+}
+
 }  // namespace
 }  // namespace multibody
 }  // namespace drake
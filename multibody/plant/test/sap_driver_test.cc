@@ -1,5 +1,7 @@
 #include "drake/multibody/plant/sap_driver.h"
 
+#include <memory>
+
 #include <gtest/gtest.h>
 
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
@@ -65,6 +67,12 @@ class SapDriverTest {
     return A;
   }
 
+  static const contact_solvers::internal::SapSolver<double>::SolverStats&
+  EvalSapSolverStatistics(const SapDriver<double>& driver,
+                          const Context<double>& context) {
+    return driver.EvalSapSolverResultsCache(context).solver->get_statistics();
+  }
+
   static void PackContactSolverResults(
       const SapDriver<double>& driver, const Context<double>& context,
       const contact_solvers::internal::SapContactProblem<double>& problem,
@@ -343,6 +351,36 @@ TEST_F(SpheresStackTest, PackContactSolverResults) {
                               2.0 * kEps, MatrixCompareType::relative));
 }
 
+// The solver kept in the cache of a context reuses the symbolic factorization
+// of the Hessian from the previous step, as long as the sparsity pattern is
+// unchanged. A cloned context starts with a fresh solver.
+TEST_F(SpheresStackTest, ReuseSymbolicFactorization) {
+  SetupRigidGroundCompliantSphereAndNonHydroSphere();
+  ASSERT_GT(EvalDiscreteContactPairs(*plant_context_).size(), 0);
+  EXPECT_FALSE(
+      SapDriverTest::EvalSapSolverStatistics(sap_driver(), *plant_context_)
+          .symbolic_factorization_reused);
+
+  // Changing the velocities changes the problem, but not the contact pairs.
+  const VectorXd v0 = plant_->GetVelocities(*plant_context_);
+  const VectorXd v_results =
+      contact_manager_->EvalContactSolverResults(*plant_context_).v_next;
+  plant_->SetVelocities(plant_context_,
+                        v0 + VectorXd::Constant(v0.size(), 0.1));
+  EXPECT_TRUE(
+      SapDriverTest::EvalSapSolverStatistics(sap_driver(), *plant_context_)
+          .symbolic_factorization_reused);
+  EXPECT_NE(contact_manager_->EvalContactSolverResults(*plant_context_).v_next,
+            v_results);
+
+  std::unique_ptr<Context<double>> clone = plant_context_->Clone();
+  plant_->SetVelocities(clone.get(), v0);
+  EXPECT_FALSE(SapDriverTest::EvalSapSolverStatistics(sap_driver(), *clone)
+                   .symbolic_factorization_reused);
+  EXPECT_EQ(contact_manager_->EvalContactSolverResults(*clone).v_next,
+            v_results);
+}
+
 // Unit test that the manager throws an exception whenever SAP fails to
 // converge.
 TEST_F(SpheresStackTest, SapFailureException) {
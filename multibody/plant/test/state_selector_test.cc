@@ -0,0 +1,175 @@
+#include "drake/multibody/plant/state_selector.h"
+
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/expect_throws_message.h"
+#include "drake/multibody/plant/multibody_plant.h"
+#include "drake/multibody/tree/prismatic_joint.h"
+#include "drake/multibody/tree/revolute_joint.h"
+
+namespace drake {
+namespace multibody {
+namespace {
+
+using Eigen::Vector3d;
+using Eigen::VectorXd;
+using systems::Context;
+
+GTEST_TEST(StateSelectorTest, Runs) {
+  const StateSelector dut(6, 2, {4, 5, 0, 2, 3}, {1});
+  EXPECT_EQ(dut.num_positions(), 5);
+  EXPECT_EQ(dut.num_velocities(), 1);
+  EXPECT_EQ(dut.plant_num_positions(), 6);
+  EXPECT_EQ(dut.plant_num_velocities(), 2);
+
+  const VectorXd q = VectorXd::LinSpaced(6, 10, 15);
+  VectorXd q_selected(5);
+  dut.GatherPositions<double>(q, &q_selected);
+  EXPECT_EQ(q_selected, (VectorXd(5) << 14, 15, 10, 12, 13).finished());
+
+  VectorXd q_new = VectorXd::Zero(6);
+  dut.ScatterPositions<double>(q_selected, &q_new);
+  EXPECT_EQ(q_new, (VectorXd(6) << 10, 0, 12, 13, 14, 15).finished());
+
+  VectorXd v_selected(1);
+  dut.GatherVelocities<double>(Eigen::Vector2d(7, 8), &v_selected);
+  EXPECT_EQ(v_selected[0], 8);
+
+  VectorXd wrong_size(4);
+  EXPECT_THROW(dut.GatherPositions<double>(q, &wrong_size), std::exception);
+  EXPECT_THROW(dut.ScatterPositions<double>(wrong_size, &q_new),
+               std::exception);
+
+  DRAKE_EXPECT_THROWS_MESSAGE(StateSelector(3, 0, {0, 3}, {}),
+                              ".*index 3 is out of range.*size 3.*");
+  DRAKE_EXPECT_THROWS_MESSAGE(StateSelector(3, 1, {0}, {0, 0}),
+                              ".*index 0 is selected twice.*");
+}
+
+// Three robots in separate model instances: a floating box, a two-link arm,
+// and a slider.
+class PlantStateSelectorTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    const SpatialInertia<double> M =
+        SpatialInertia<double>::SolidBoxWithMass(1.0, 0.1, 0.2, 0.3);
+    box_ = plant_.AddModelInstance("box");
+    plant_.AddRigidBody("box", box_, M);
+    arm_ = plant_.AddModelInstance("arm");
+    const RigidBody<double>& link1 = plant_.AddRigidBody("link1", arm_, M);
+    const RigidBody<double>& link2 = plant_.AddRigidBody("link2", arm_, M);
+    shoulder_ = plant_
+                    .AddJoint<RevoluteJoint>("shoulder", plant_.world_body(),
+                                             {}, link1, {}, Vector3d::UnitZ())
+                    .index();
+    elbow_ = plant_
+                 .AddJoint<RevoluteJoint>("elbow", link1, {}, link2, {},
+                                          Vector3d::UnitY())
+                 .index();
+    slider_ = plant_.AddModelInstance("slider");
+    const RigidBody<double>& cart = plant_.AddRigidBody("cart", slider_, M);
+    rail_ = plant_
+                .AddJoint<PrismaticJoint>("rail", plant_.world_body(), {},
+                                          cart, {}, Vector3d::UnitX())
+                .index();
+    plant_.Finalize();
+    context_ = plant_.CreateDefaultContext();
+    plant_.SetPositions(
+        context_.get(),
+        VectorXd::LinSpaced(plant_.num_positions(), 1, plant_.num_positions()));
+    plant_.SetVelocities(context_.get(),
+                         VectorXd::LinSpaced(plant_.num_velocities(), -1,
+                                             -plant_.num_velocities()));
+  }
+
+  MultibodyPlant<double> plant_{0.0};
+  ModelInstanceIndex box_;
+  ModelInstanceIndex arm_;
+  ModelInstanceIndex slider_;
+  JointIndex shoulder_;
+  JointIndex elbow_;
+  JointIndex rail_;
+  std::unique_ptr<Context<double>> context_;
+};
+
+// Selecting model instances matches the per-instance accessors.
+TEST_F(PlantStateSelectorTest, ModelInstances) {
+  const std::vector<ModelInstanceIndex> instances{slider_, box_, arm_};
+  const StateSelector dut = plant_.MakeStateSelector(instances);
+  ASSERT_EQ(dut.num_positions(), 1 + 7 + 2);
+  ASSERT_EQ(dut.num_velocities(), 1 + 6 + 2);
+
+  VectorXd q(dut.num_positions());
+  plant_.GetPositions(*context_, dut, &q);
+  VectorXd q_expected(dut.num_positions());
+  q_expected << plant_.GetPositions(*context_, slider_),
+      plant_.GetPositions(*context_, box_),
+      plant_.GetPositions(*context_, arm_);
+  EXPECT_EQ(q, q_expected);
+
+  VectorXd v(dut.num_velocities());
+  plant_.GetVelocities(*context_, dut, &v);
+  VectorXd v_expected(dut.num_velocities());
+  v_expected << plant_.GetVelocities(*context_, slider_),
+      plant_.GetVelocities(*context_, box_),
+      plant_.GetVelocities(*context_, arm_);
+  EXPECT_EQ(v, v_expected);
+
+  // Setting through the selector matches setting each instance.
+  const VectorXd q_new = -q;
+  const VectorXd v_new = 2 * v;
+  plant_.SetPositions(context_.get(), dut, q_new);
+  plant_.SetVelocities(context_.get(), dut, v_new);
+  auto expected_context = plant_.CreateDefaultContext();
+  plant_.SetPositions(expected_context.get(), slider_, q_new.head(1));
+  plant_.SetPositions(expected_context.get(), box_, q_new.segment(1, 7));
+  plant_.SetPositions(expected_context.get(), arm_, q_new.tail(2));
+  plant_.SetVelocities(expected_context.get(), slider_, v_new.head(1));
+  plant_.SetVelocities(expected_context.get(), box_, v_new.segment(1, 6));
+  plant_.SetVelocities(expected_context.get(), arm_, v_new.tail(2));
+  EXPECT_EQ(plant_.GetPositionsAndVelocities(*context_),
+            plant_.GetPositionsAndVelocities(*expected_context));
+
+  const std::vector<ModelInstanceIndex> repeated{arm_, box_, arm_};
+  DRAKE_EXPECT_THROWS_MESSAGE(plant_.MakeStateSelector(repeated),
+                              ".*model instance 'arm' is repeated.*");
+}
+
+// Selecting joints matches MakeStateSelectorMatrix().
+TEST_F(PlantStateSelectorTest, Joints) {
+  const std::vector<JointIndex> joints{elbow_, rail_, shoulder_};
+  const StateSelector dut = plant_.MakeStateSelector(joints);
+  ASSERT_EQ(dut.num_positions(), 3);
+  ASSERT_EQ(dut.num_velocities(), 3);
+
+  VectorXd q(3);
+  VectorXd v(3);
+  plant_.GetPositions(*context_, dut, &q);
+  plant_.GetVelocities(*context_, dut, &v);
+  VectorXd x(6);
+  x << q, v;
+  EXPECT_EQ(x, plant_.MakeStateSelectorMatrix(joints) *
+                   plant_.GetPositionsAndVelocities(*context_));
+}
+
+// A selector made for one plant cannot be used with a different one.
+TEST_F(PlantStateSelectorTest, WrongPlant) {
+  const std::vector<ModelInstanceIndex> instances{default_model_instance()};
+  MultibodyPlant<double> other(0.0);
+  other.Finalize();
+  const StateSelector dut = other.MakeStateSelector(instances);
+  VectorXd empty(0);
+  EXPECT_THROW(plant_.GetPositions(*context_, dut, &empty), std::exception);
+  EXPECT_THROW(plant_.SetVelocities(context_.get(), dut, empty),
+               std::exception);
+
+  MultibodyPlant<double> unfinalized(0.0);
+  EXPECT_THROW(unfinalized.MakeStateSelector(instances), std::exception);
+}
+
+}  // namespace
+}  // namespace multibody
+}  // namespace drake
@@ -31,7 +31,7 @@ class TamsiSolverTester {
     auto vt = solver.variable_size_workspace_.mutable_vt();
     auto fn = solver.variable_size_workspace_.mutable_fn();
     auto ft = solver.variable_size_workspace_.mutable_ft();
-    auto Gn = solver.variable_size_workspace_.mutable_Gn();
+    auto dfn_dvn = solver.variable_size_workspace_.mutable_dfn_dvn();
     auto mus = solver.variable_size_workspace_.mutable_mu();
     auto t_hat = solver.variable_size_workspace_.mutable_t_hat();
     auto v_slip = solver.variable_size_workspace_.mutable_v_slip();
@@ -43,7 +43,8 @@ class TamsiSolverTester {
 
     // Computes friction forces fn and gradients Gn as a function of x, vn,
     // Jn and dt.
-    solver.CalcNormalForces(vn, Jn, dt, &fn, &Gn);
+    solver.CalcNormalForces(vn, dt, &fn, &dfn_dvn);
+    const MatrixX<double> Gn = dfn_dvn.asDiagonal() * Jn;
 
     // Tangential velocity.
     vt = Jt * v;
@@ -68,6 +69,10 @@ class TamsiSolverTester {
   static int get_capacity(const TamsiSolver<double>& solver) {
     return solver.variable_size_workspace_.capacity();
   }
+
+  static int num_islands(const TamsiSolver<double>& solver) {
+    return solver.islands_.size();
+  }
 };
 namespace {
 
@@ -1141,6 +1146,89 @@ TEST_F(RollingCylinder, SlidingAfterImpact) {
       CompareMatrices(J, J_expected, J_tolerance, MatrixCompareType::absolute));
 }
 
+// Three copies of the cylinder, the first two in contact with the ground (one
+// sticking and one sliding) and the third one in free flight, are solved
+// independently. The solution must match that of each cylinder solved on its
+// own.
+TEST_F(RollingCylinder, IndependentCylinders) {
+  const double kTolerance = 10 * std::numeric_limits<double>::epsilon();
+  const double dt = 1.0e-3;
+  const Vector3<double> tau(0.0, -m_ * g_, 0.0);
+  const double h0 = 0.5;
+  const double vy0 = -sqrt(2.0 * g_ * h0);
+  const std::vector<Vector3<double>> v0s = {
+      Vector3<double>(0.5, vy0, 0.0), Vector3<double>(1.0, vy0, 0.0),
+      Vector3<double>(1.0, vy0, 2.0)};
+  TamsiSolverParameters parameters;
+  parameters.stiction_tolerance = 1.0e-6;
+  solver_.set_solver_parameters(parameters);
+
+  // Solve the two cylinders in contact on their own.
+  std::vector<VectorX<double>> v_expected;
+  std::vector<VectorX<double>> tau_expected;
+  for (int i = 0; i < 2; ++i) {
+    SetImpactProblem(v0s[i], tau, mu_, h0, dt);
+    ASSERT_EQ(solver_.SolveWithGuess(dt, v0s[i]), TamsiSolverResult::kSuccess);
+    v_expected.push_back(solver_.get_generalized_velocities());
+    tau_expected.push_back(solver_.get_generalized_contact_forces());
+  }
+  // The cylinder in free flight.
+  v_expected.push_back(v0s[2] + dt * M_.inverse() * tau);
+  tau_expected.push_back(Vector3<double>::Zero());
+
+  // Assemble the problem with the three cylinders, with the free one in the
+  // middle.
+  const int nv = 3 * nv_;
+  const std::vector<int> cylinders = {0, 2, 1};
+  MatrixX<double> M = MatrixX<double>::Zero(nv, nv);
+  MatrixX<double> Jn = MatrixX<double>::Zero(2, nv);
+  MatrixX<double> Jt = MatrixX<double>::Zero(4, nv);
+  VectorX<double> p_star(nv);
+  VectorX<double> v0(nv);
+  for (int i = 0; i < 3; ++i) {
+    const int c = cylinders[i];
+    M.block(3 * i, 3 * i, 3, 3) = M_;
+    p_star.segment<3>(3 * i) = M_ * v0s[c] + dt * tau;
+    v0.segment<3>(3 * i) = v0s[c];
+    if (c < 2) {
+      Jn.block(c, 3 * i, 1, 3) = RowVector3<double>(0, 1, 0);
+      Jt.block(2 * c, 3 * i, 2, 3) = ComputeTangentialJacobian();
+    }
+  }
+  const VectorX<double> mu_vector = VectorX<double>::Constant(2, mu_);
+  const VectorX<double> fn0 = fn0_.replicate(2, 1);
+  const VectorX<double> stiffness = stiffness_.replicate(2, 1);
+  const VectorX<double> dissipation = dissipation_.replicate(2, 1);
+
+  TamsiSolver<double> solver(nv);
+  solver.set_solver_parameters(parameters);
+  solver.SetTwoWayCoupledProblemData(&M, &Jn, &Jt, &p_star, &fn0, &stiffness,
+                                     &dissipation, &mu_vector);
+  // One island per cylinder in contact, plus one per velocity of the free
+  // cylinder since its mass matrix is diagonal.
+  EXPECT_EQ(TamsiSolverTester::num_islands(solver), 5);
+  ASSERT_EQ(solver.SolveWithGuess(dt, v0), TamsiSolverResult::kSuccess);
+  for (int i = 0; i < 3; ++i) {
+    const int c = cylinders[i];
+    EXPECT_TRUE(CompareMatrices(
+        solver.get_generalized_velocities().segment<3>(3 * i), v_expected[c],
+        kTolerance));
+    EXPECT_TRUE(CompareMatrices(
+        solver.get_generalized_contact_forces().segment<3>(3 * i),
+        tau_expected[c], kTolerance));
+  }
+
+  // Coupling the cylinders in contact through the horizontal velocity of the
+  // free one merges the three into an island, leaving the free cylinder's
+  // other two velocities on their own.
+  M(0, 3) = M(3, 0) = 0.1;
+  M(3, 6) = M(6, 3) = 0.1;
+  solver.SetTwoWayCoupledProblemData(&M, &Jn, &Jt, &p_star, &fn0, &stiffness,
+                                     &dissipation, &mu_vector);
+  EXPECT_EQ(TamsiSolverTester::num_islands(solver), 3);
+  EXPECT_EQ(solver.SolveWithGuess(dt, v0), TamsiSolverResult::kSuccess);
+}
+
 GTEST_TEST(EmptyWorld, Solve) {
   const int nv = 0;
   TamsiSolver<double> solver{nv};
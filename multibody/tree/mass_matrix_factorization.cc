@@ -0,0 +1,92 @@
+#include "drake/multibody/tree/mass_matrix_factorization.h"
+
+#include <stdexcept>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include "drake/common/drake_throw.h"
+#include "drake/common/extract_double.h"
+
+namespace drake {
+namespace multibody {
+
+template <typename T>
+MassMatrixFactorization<T>::MassMatrixFactorization(MatrixX<T> M,
+                                                    std::vector<int> parents)
+    : LD_(std::move(M)), parents_(std::move(parents)) {
+  DRAKE_THROW_UNLESS(LD_.rows() == LD_.cols());
+  DRAKE_THROW_UNLESS(LD_.rows() == size());
+  for (int i = 0; i < size(); ++i) {
+    DRAKE_THROW_UNLESS(-1 <= parents_[i] && parents_[i] < i);
+  }
+
+  // This is the LTDL algorithm in [Featherstone 2008, Table 6.3]. Processing
+  // from the tips, each row k is scaled by its diagonal and eliminated from
+  // the rows of its ancestors, which only touches entries between ancestors.
+  for (int k = size() - 1; k >= 0; --k) {
+    const T& D_k = LD_(k, k);
+    if constexpr (scalar_predicate<T>::is_bool) {
+      if (!(D_k > 0)) {
+        throw std::logic_error(fmt::format(
+            "MassMatrixFactorization(): the matrix is not positive definite; "
+            "the pivot for velocity {} is {}.",
+            k, ExtractDoubleOrThrow(D_k)));
+      }
+    }
+    for (int i = parents_[k]; i >= 0; i = parents_[i]) {
+      const T a = LD_(k, i) / D_k;
+      for (int j = i; j >= 0; j = parents_[j]) {
+        LD_(i, j) -= a * LD_(k, j);
+      }
+      LD_(k, i) = a;
+    }
+  }
+}
+
+template <typename T>
+MatrixX<T> MassMatrixFactorization<T>::CalcL() const {
+  MatrixX<T> L = MatrixX<T>::Identity(size(), size());
+  for (int i = 0; i < size(); ++i) {
+    for (int j = parents_[i]; j >= 0; j = parents_[j]) {
+      L(i, j) = LD_(i, j);
+    }
+  }
+  return L;
+}
+
+template <typename T>
+void MassMatrixFactorization<T>::SolveInPlace(EigenPtr<MatrixX<T>> b) const {
+  DRAKE_THROW_UNLESS(b != nullptr);
+  DRAKE_THROW_UNLESS(b->rows() == size());
+  // Lᵀ⋅D⋅L⋅x = b is solved as b ← L⁻ᵀ⋅b, from the tips to the base, then
+  // b ← D⁻¹⋅b, and finally b ← L⁻¹⋅b, from the base to the tips.
+  for (int i = size() - 1; i >= 0; --i) {
+    for (int j = parents_[i]; j >= 0; j = parents_[j]) {
+      b->row(j) -= LD_(i, j) * b->row(i);
+    }
+  }
+  for (int i = 0; i < size(); ++i) {
+    b->row(i) /= LD_(i, i);
+  }
+  for (int i = 0; i < size(); ++i) {
+    for (int j = parents_[i]; j >= 0; j = parents_[j]) {
+      b->row(i) -= LD_(i, j) * b->row(j);
+    }
+  }
+}
+
+template <typename T>
+MatrixX<T> MassMatrixFactorization<T>::Solve(
+    const Eigen::Ref<const MatrixX<T>>& b) const {
+  DRAKE_THROW_UNLESS(b.rows() == size());
+  MatrixX<T> x = b;
+  SolveInPlace(&x);
+  return x;
+}
+
+}  // namespace multibody
+}  // namespace drake
+
+DRAKE_DEFINE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS(
+    class drake::multibody::MassMatrixFactorization)
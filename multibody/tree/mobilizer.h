@@ -405,6 +405,15 @@ class Mobilizer : public MultibodyElement<T> {
   virtual math::RigidTransform<T> CalcAcrossMobilizerTransform(
       const systems::Context<T>& context) const = 0;
 
+  // Computes the across-mobilizer transform `X_FM(q)` for the given vector `q`
+  // of generalized positions for `this` mobilizer, without reading (or
+  // requiring) a context. This allows batched kinematics computations (see
+  // MultibodyTree::CalcAllBodyPosesInWorldBatch()) to evaluate many
+  // configurations without writing each one into a Context.
+  // This method aborts in Debug builds if `q.size()` is not num_positions().
+  virtual math::RigidTransform<T> CalcAcrossMobilizerTransformGivenPositions(
+      const Eigen::Ref<const VectorX<T>>& q) const = 0;
+
   // Computes the across-mobilizer spatial velocity `V_FM(q, v)` of the
   // outboard frame M in the inboard frame F.
   // This method can be thought of as the application of the operator `H_FM(q)`
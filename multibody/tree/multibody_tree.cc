@@ -11,17 +11,25 @@
 #include "drake/common/drake_assert.h"
 #include "drake/common/drake_throw.h"
 #include "drake/common/eigen_types.h"
+#include "drake/common/nice_type_name.h"
+#include "drake/common/parallel_for.h"
+#include "drake/common/ssize.h"
 #include "drake/common/text_logging.h"
 #include "drake/common/unused.h"
+#include "drake/math/fast_pose_composition_functions.h"
 #include "drake/math/rigid_transform.h"
 #include "drake/math/rotation_matrix.h"
 #include "drake/multibody/tree/body_node_world.h"
 #include "drake/multibody/tree/multibody_tree-inl.h"
+#include "drake/multibody/tree/prismatic_mobilizer.h"
 #include "drake/multibody/tree/quaternion_floating_joint.h"
 #include "drake/multibody/tree/quaternion_floating_mobilizer.h"
+#include "drake/multibody/tree/revolute_mobilizer.h"
 #include "drake/multibody/tree/rigid_body.h"
+#include "drake/multibody/tree/screw_mobilizer.h"
 #include "drake/multibody/tree/spatial_inertia.h"
 #include "drake/multibody/tree/uniform_gravity_field_element.h"
+#include "drake/multibody/tree/weld_mobilizer.h"
 
 namespace drake {
 namespace multibody {
@@ -40,6 +48,16 @@ using math::RotationMatrix;
 // pre-finalize.
 #define DRAKE_MBT_THROW_IF_NOT_FINALIZED() ThrowIfNotFinalized(__func__)
 
+namespace {
+
+// The smallest number of body nodes in a level for which the level is split
+// across threads (see MultibodyPlant::set_tree_parallelism()). Each thread
+// gets at least half this many nodes, since the work per node is small
+// compared to the cost of dispatching it.
+constexpr int kMinParallelLevelSize = 16;
+
+}  // namespace
+
 template <typename T>
 class JointImplementationBuilder {
  public:
@@ -201,7 +219,14 @@ template <typename T, typename ElementIndex>
 bool HasElementNamed(
     const MultibodyTree<T>& tree, std::string_view name,
     std::optional<ModelInstanceIndex> model_instance,
-    const NameToIndex<ElementIndex>& name_to_index) {
+    const NameToIndex<ElementIndex>& name_to_index,
+    const ScopedNameToIndex<ElementIndex>& scoped_name_to_index) {
+  // Once the tree is finalized, a match in a model instance is found directly.
+  if (model_instance &&
+      scoped_name_to_index.count(std::make_pair(*model_instance, name)) > 0) {
+    return true;
+  }
+
   // Find all elements with a matching name.
   const auto [lower, upper] = name_to_index.equal_range(name);
 
@@ -248,7 +273,17 @@ template <typename T, typename ElementIndex>
 const auto& GetElementByName(
     const MultibodyTree<T>& tree, std::string_view name,
     std::optional<ModelInstanceIndex> model_instance,
-    const NameToIndex<ElementIndex>& name_to_index) {
+    const NameToIndex<ElementIndex>& name_to_index,
+    const ScopedNameToIndex<ElementIndex>& scoped_name_to_index) {
+  // Once the tree is finalized, a match in a model instance is found directly.
+  if (model_instance) {
+    const auto it =
+        scoped_name_to_index.find(std::make_pair(*model_instance, name));
+    if (it != scoped_name_to_index.end()) {
+      return GetElementByIndex(tree, it->second);
+    }
+  }
+
   // We fetch the model instance name as the first operation in this function
   // (even though we'll only need it for error messages) because it throws an
   // exception when the model_instance index is invalid.
@@ -312,6 +347,23 @@ const auto& GetElementByName(
   return GetElementByIndex(tree, lower->second);
 }
 
+// Fills `scoped_name_to_index` with the entries of `name_to_index`, keyed by
+// the model instance of their element as well.
+template <typename T, typename ElementIndex>
+void BuildScopedNameToIndex(
+    const MultibodyTree<T>& tree,
+    const NameToIndex<ElementIndex>& name_to_index,
+    ScopedNameToIndex<ElementIndex>* scoped_name_to_index) {
+  scoped_name_to_index->clear();
+  scoped_name_to_index->reserve(name_to_index.size());
+  for (const auto& [key, index] : name_to_index) {
+    const ModelInstanceIndex model_instance =
+        GetElementByIndex(tree, index).model_instance();
+    scoped_name_to_index->emplace(std::make_pair(model_instance, key.view()),
+                                  index);
+  }
+}
+
 }  // namespace
 
 template <typename T>
@@ -321,46 +373,54 @@ int MultibodyTree<T>::NumBodiesWithName(std::string_view name) const {
 
 template <typename T>
 bool MultibodyTree<T>::HasBodyNamed(std::string_view name) const {
-  return HasElementNamed(*this, name, std::nullopt, body_name_to_index_);
+  return HasElementNamed(*this, name, std::nullopt, body_name_to_index_,
+                         scoped_body_name_to_index_);
 }
 
 template <typename T>
 bool MultibodyTree<T>::HasBodyNamed(
     std::string_view name, ModelInstanceIndex model_instance) const {
-  return HasElementNamed(*this, name, model_instance, body_name_to_index_);
+  return HasElementNamed(*this, name, model_instance, body_name_to_index_,
+                         scoped_body_name_to_index_);
 }
 
 template <typename T>
 bool MultibodyTree<T>::HasFrameNamed(std::string_view name) const {
-  return HasElementNamed(*this, name, std::nullopt, frame_name_to_index_);
+  return HasElementNamed(*this, name, std::nullopt, frame_name_to_index_,
+                         scoped_frame_name_to_index_);
 }
 
 template <typename T>
 bool MultibodyTree<T>::HasFrameNamed(
     std::string_view name, ModelInstanceIndex model_instance) const {
-  return HasElementNamed(*this, name, model_instance, frame_name_to_index_);
+  return HasElementNamed(*this, name, model_instance, frame_name_to_index_,
+                         scoped_frame_name_to_index_);
 }
 
 template <typename T>
 bool MultibodyTree<T>::HasJointNamed(std::string_view name) const {
-  return HasElementNamed(*this, name, std::nullopt, joint_name_to_index_);
+  return HasElementNamed(*this, name, std::nullopt, joint_name_to_index_,
+                         scoped_joint_name_to_index_);
 }
 
 template <typename T>
 bool MultibodyTree<T>::HasJointNamed(
     std::string_view name, ModelInstanceIndex model_instance) const {
-  return HasElementNamed(*this, name, model_instance, joint_name_to_index_);
+  return HasElementNamed(*this, name, model_instance, joint_name_to_index_,
+                         scoped_joint_name_to_index_);
 }
 
 template <typename T>
 bool MultibodyTree<T>::HasJointActuatorNamed(std::string_view name) const {
-  return HasElementNamed(*this, name, std::nullopt, actuator_name_to_index_);
+  return HasElementNamed(*this, name, std::nullopt, actuator_name_to_index_,
+                         scoped_actuator_name_to_index_);
 }
 
 template <typename T>
 bool MultibodyTree<T>::HasJointActuatorNamed(
     std::string_view name, ModelInstanceIndex model_instance) const {
-  return HasElementNamed(*this, name, model_instance, actuator_name_to_index_);
+  return HasElementNamed(*this, name, model_instance, actuator_name_to_index_,
+                         scoped_actuator_name_to_index_);
 }
 
 template <typename T>
@@ -370,13 +430,15 @@ bool MultibodyTree<T>::HasModelInstanceNamed(std::string_view name) const {
 
 template <typename T>
 const Body<T>& MultibodyTree<T>::GetBodyByName(std::string_view name) const {
-  return GetElementByName(*this, name, std::nullopt, body_name_to_index_);
+  return GetElementByName(*this, name, std::nullopt, body_name_to_index_,
+                          scoped_body_name_to_index_);
 }
 
 template <typename T>
 const Body<T>& MultibodyTree<T>::GetBodyByName(
     std::string_view name, ModelInstanceIndex model_instance) const {
-  return GetElementByName(*this, name, model_instance, body_name_to_index_);
+  return GetElementByName(*this, name, model_instance, body_name_to_index_,
+                          scoped_body_name_to_index_);
 }
 
 template <typename T>
@@ -434,13 +496,15 @@ std::vector<FrameIndex> MultibodyTree<T>::GetFrameIndices(
 
 template <typename T>
 const Frame<T>& MultibodyTree<T>::GetFrameByName(std::string_view name) const {
-  return GetElementByName(*this, name, std::nullopt, frame_name_to_index_);
+  return GetElementByName(*this, name, std::nullopt, frame_name_to_index_,
+                          scoped_frame_name_to_index_);
 }
 
 template <typename T>
 const Frame<T>& MultibodyTree<T>::GetFrameByName(
     std::string_view name, ModelInstanceIndex model_instance) const {
-  return GetElementByName(*this, name, model_instance, frame_name_to_index_);
+  return GetElementByName(*this, name, model_instance, frame_name_to_index_,
+                          scoped_frame_name_to_index_);
 }
 
 template <typename T>
@@ -473,7 +537,8 @@ template <typename T>
 const Joint<T>& MultibodyTree<T>::GetJointByNameImpl(
     std::string_view name,
     std::optional<ModelInstanceIndex> model_instance) const {
-  return GetElementByName(*this, name, model_instance, joint_name_to_index_);
+  return GetElementByName(*this, name, model_instance, joint_name_to_index_,
+                          scoped_joint_name_to_index_);
 }
 
 template <typename T>
@@ -489,13 +554,15 @@ void MultibodyTree<T>::ThrowJointSubtypeMismatch(
 template <typename T>
 const JointActuator<T>& MultibodyTree<T>::GetJointActuatorByName(
     std::string_view name) const {
-  return GetElementByName(*this, name, std::nullopt, actuator_name_to_index_);
+  return GetElementByName(*this, name, std::nullopt, actuator_name_to_index_,
+                          scoped_actuator_name_to_index_);
 }
 
 template <typename T>
 const JointActuator<T>& MultibodyTree<T>::GetJointActuatorByName(
     std::string_view name, ModelInstanceIndex model_instance) const {
-  return GetElementByName(*this, name, model_instance, actuator_name_to_index_);
+  return GetElementByName(*this, name, model_instance, actuator_name_to_index_,
+                          scoped_actuator_name_to_index_);
 }
 
 template <typename T>
@@ -747,6 +814,15 @@ void MultibodyTree<T>::FinalizeInternals() {
 
   CreateModelInstances();
 
+  BuildScopedNameToIndex(*this, body_name_to_index_,
+                         &scoped_body_name_to_index_);
+  BuildScopedNameToIndex(*this, frame_name_to_index_,
+                         &scoped_frame_name_to_index_);
+  BuildScopedNameToIndex(*this, joint_name_to_index_,
+                         &scoped_joint_name_to_index_);
+  BuildScopedNameToIndex(*this, actuator_name_to_index_,
+                         &scoped_actuator_name_to_index_);
+
   // For all floating bodies, route their future default poses queries through
   // its joint representation.
   for (int i = 0; i < num_joints(); ++i) {
@@ -1068,6 +1144,67 @@ void MultibodyTree<T>::CalcAllBodyPosesInWorld(
   }
 }
 
+template <typename T>
+void MultibodyTree<T>::CalcAllBodyPosesInWorldBatch(
+    const systems::Context<T>& context,
+    const Eigen::Ref<const MatrixX<T>>& q_batch,
+    std::vector<std::vector<RigidTransform<T>>>* X_WB_batch) const {
+  DRAKE_MBT_THROW_IF_NOT_FINALIZED();
+  DRAKE_THROW_UNLESS(X_WB_batch != nullptr);
+  DRAKE_THROW_UNLESS(q_batch.rows() == num_positions());
+  const int num_configurations = q_batch.cols();
+
+  // The output is stored body-major (X_WB_batch[body_index][k]) so that the
+  // poses of one body across all configurations are contiguous in memory and
+  // the innermost loop below composes plain arrays of transforms.
+  X_WB_batch->resize(num_bodies());
+  for (std::vector<RigidTransform<T>>& X_WB : *X_WB_batch) {
+    X_WB.resize(num_configurations);
+  }
+  std::fill((*X_WB_batch)[world_index()].begin(),
+            (*X_WB_batch)[world_index()].end(), RigidTransform<T>::Identity());
+
+  // Perform a single base-to-tip pass over the topology. The parameter
+  // dependent poses X_PF and X_MB are evaluated once per node, while the
+  // configuration dependent X_FM(q) is evaluated for every configuration.
+  // This skips the world, level = 0.
+  for (int level = 1; level < tree_height(); ++level) {
+    for (BodyNodeIndex body_node_index : body_node_levels_[level]) {
+      const BodyNode<T>& node = *body_nodes_[body_node_index];
+      const BodyNodeTopology& node_topology = node.get_topology();
+      const Mobilizer<T>& mobilizer = node.get_mobilizer();
+      const RigidTransform<T> X_PF =
+          mobilizer.inboard_frame().CalcPoseInBodyFrame(context);
+      const RigidTransform<T> X_MB =
+          mobilizer.outboard_frame().CalcPoseInBodyFrame(context).inverse();
+      const int q_start = node_topology.mobilizer_positions_start;
+      const int nq = node_topology.num_mobilizer_positions;
+
+      const std::vector<RigidTransform<T>>& X_WP_batch =
+          (*X_WB_batch)[node.parent_body().index()];
+      std::vector<RigidTransform<T>>& X_WB_node_batch =
+          (*X_WB_batch)[node.body().index()];
+      // First store X_PB for each configuration into the output.
+      for (int k = 0; k < num_configurations; ++k) {
+        const RigidTransform<T> X_FM =
+            mobilizer.CalcAcrossMobilizerTransformGivenPositions(
+                q_batch.col(k).segment(q_start, nq));
+        X_WB_node_batch[k] = X_PF * (X_FM * X_MB);
+      }
+      // Then compose X_WB = X_WP * X_PB in place, across the whole batch.
+      if constexpr (std::is_same_v<T, double>) {
+        math::internal::ComposeXXBatch(
+            X_WP_batch.data(), X_WB_node_batch.data(), num_configurations,
+            X_WB_node_batch.data());
+      } else {
+        for (int k = 0; k < num_configurations; ++k) {
+          X_WB_node_batch[k] = X_WP_batch[k] * X_WB_node_batch[k];
+        }
+      }
+    }
+  }
+}
+
 template <typename T>
 void MultibodyTree<T>::CalcAllBodySpatialVelocitiesInWorld(
     const systems::Context<T>& context,
@@ -1083,6 +1220,34 @@ void MultibodyTree<T>::CalcAllBodySpatialVelocitiesInWorld(
   }
 }
 
+template <typename T>
+template <typename Visitor>
+void MultibodyTree<T>::ForEachBodyNodeInLevel(int level,
+                                              const Visitor& visit) const {
+  const std::vector<BodyNodeIndex>& nodes = body_node_levels_[level];
+  const int num_nodes = ssize(nodes);
+  // Only double is evaluated in parallel; the other scalar types are far too
+  // expensive per node for the levels of realistic models to be wide enough
+  // to matter, and symbolic::Expression is not safe to share across threads.
+  const int num_threads =
+      (std::is_same_v<T, double> && num_nodes >= kMinParallelLevelSize)
+          ? std::min(tree_parallelism_.num_threads(),
+                     num_nodes / (kMinParallelLevelSize / 2))
+          : 1;
+  if (num_threads <= 1) {
+    for (BodyNodeIndex body_node_index : nodes) {
+      visit(body_node_index);
+    }
+    return;
+  }
+  // The nodes within a level only depend on nodes in other levels, and each
+  // one only writes its own entries of the outputs. If any nodes throw, the
+  // exception of the first one (in serial order) is rethrown.
+  drake::internal::ParallelFor(Parallelism(num_threads), num_nodes, [&](int i) {
+    visit(nodes[i]);
+  });
+}
+
 template <typename T>
 void MultibodyTree<T>::CalcPositionKinematicsCache(
     const systems::Context<T>& context,
@@ -1094,7 +1259,7 @@ void MultibodyTree<T>::CalcPositionKinematicsCache(
   // recursion to update world positions and parent to child body transforms.
   // This skips the world, level = 0.
   for (int level = 1; level < tree_height(); ++level) {
-    for (BodyNodeIndex body_node_index : body_node_levels_[level]) {
+    ForEachBodyNodeInLevel(level, [&](BodyNodeIndex body_node_index) {
       const BodyNode<T>& node = *body_nodes_[body_node_index];
 
       DRAKE_ASSERT(node.get_topology().level == level);
@@ -1102,7 +1267,7 @@ void MultibodyTree<T>::CalcPositionKinematicsCache(
 
       // Update per-node kinematics.
       node.CalcPositionKinematicsCache_BaseToTip(context, pc);
-    }
+    });
   }
 }
 
@@ -1126,7 +1291,7 @@ void MultibodyTree<T>::CalcVelocityKinematicsCache(
   // Performs a base-to-tip recursion computing body velocities.
   // This skips the world, depth = 0.
   for (int depth = 1; depth < tree_height(); ++depth) {
-    for (BodyNodeIndex body_node_index : body_node_levels_[depth]) {
+    ForEachBodyNodeInLevel(depth, [&](BodyNodeIndex body_node_index) {
       const BodyNode<T>& node = *body_nodes_[body_node_index];
 
       DRAKE_ASSERT(node.get_topology().level == depth);
@@ -1143,7 +1308,7 @@ void MultibodyTree<T>::CalcVelocityKinematicsCache(
 
       // Update per-node kinematics.
       node.CalcVelocityKinematicsCache_BaseToTip(context, pc, H_PB_W, vc);
-    }
+    });
   }
 }
 
@@ -1202,7 +1367,7 @@ void MultibodyTree<T>::CalcCompositeBodyInertiasInWorld(
 
   // Perform tip-to-base recursion for each composite body, skipping the world.
   for (int depth = tree_height() - 1; depth > 0; --depth) {
-    for (BodyNodeIndex composite_node_index : body_node_levels_[depth]) {
+    ForEachBodyNodeInLevel(depth, [&](BodyNodeIndex composite_node_index) {
       // Node corresponding to the composite body C.
       const BodyNode<T>& composite_node = *body_nodes_[composite_node_index];
 
@@ -1215,7 +1380,7 @@ void MultibodyTree<T>::CalcCompositeBodyInertiasInWorld(
       SpatialInertia<T>& Mc_C_W = (*Mc_B_W_all)[composite_node_index];
       composite_node.CalcCompositeBodyInertia_TipToBase(M_C_W, pc, *Mc_B_W_all,
                                                         &Mc_C_W);
-    }
+    });
   }
 }
 
@@ -1349,7 +1514,7 @@ void MultibodyTree<T>::CalcSpatialAccelerationsFromVdot(
   // Performs a base-to-tip recursion computing body accelerations.
   // This skips the world, depth = 0.
   for (int depth = 1; depth < tree_height(); ++depth) {
-    for (BodyNodeIndex body_node_index : body_node_levels_[depth]) {
+    ForEachBodyNodeInLevel(depth, [&](BodyNodeIndex body_node_index) {
       const BodyNode<T>& node = *body_nodes_[body_node_index];
 
       DRAKE_ASSERT(node.get_topology().level == depth);
@@ -1358,7 +1523,7 @@ void MultibodyTree<T>::CalcSpatialAccelerationsFromVdot(
       // Update per-node kinematics.
       node.CalcSpatialAcceleration_BaseToTip(
           context, pc, vc, known_vdot, A_WB_array);
-    }
+    });
   }
 }
 
@@ -1393,6 +1558,22 @@ VectorX<T> MultibodyTree<T>::CalcInverseDynamics(
   return tau;
 }
 
+template <typename T>
+void MultibodyTree<T>::CalcInverseDynamics(
+    const systems::Context<T>& context, const VectorX<T>& known_vdot,
+    const MultibodyForces<T>& external_forces,
+    MultibodyWorkspace<T>* workspace, EigenPtr<VectorX<T>> tau) const {
+  DRAKE_THROW_UNLESS(workspace != nullptr);
+  DRAKE_THROW_UNLESS(workspace->CheckHasRightSizeForModel(*this));
+  DRAKE_THROW_UNLESS(external_forces.CheckHasRightSizeForModel(*this));
+  DRAKE_THROW_UNLESS(tau != nullptr);
+  DRAKE_THROW_UNLESS(tau->size() == num_velocities());
+  CalcInverseDynamics(
+      context, known_vdot,
+      external_forces.body_forces(), external_forces.generalized_forces(),
+      &workspace->A_WB_, &workspace->F_BMo_W_, tau);
+}
+
 template <typename T>
 void MultibodyTree<T>::CalcInverseDynamics(
     const systems::Context<T>& context, const VectorX<T>& known_vdot,
@@ -1437,14 +1618,6 @@ void MultibodyTree<T>::CalcInverseDynamics(
   CalcSpatialAccelerationsFromVdot(context, known_vdot, ignore_velocities,
                                    A_WB_array);
 
-  // Vector of generalized forces per mobilizer.
-  // It has zero size if no forces are applied.
-  VectorUpTo6<T> tau_applied_mobilizer(0);
-
-  // Spatial force applied on B at Bo.
-  // It is left initialized to zero if no forces are applied.
-  SpatialForce<T> Fapplied_Bo_W = SpatialForce<T>::Zero();
-
   const PositionKinematicsCache<T>& pc = EvalPositionKinematics(context);
 
   const VectorX<T>& reflected_inertia = EvalReflectedInertiaCache(context);
@@ -1463,12 +1636,20 @@ void MultibodyTree<T>::CalcInverseDynamics(
   // contains the total force of the bodies connected to the world by a
   // mobilizer.
   for (int depth = tree_height() - 1; depth >= 0; --depth) {
-    for (BodyNodeIndex body_node_index : body_node_levels_[depth]) {
+    ForEachBodyNodeInLevel(depth, [&](BodyNodeIndex body_node_index) {
       const BodyNode<T>& node = *body_nodes_[body_node_index];
 
       DRAKE_ASSERT(node.get_topology().level == depth);
       DRAKE_ASSERT(node.index() == body_node_index);
 
+      // Vector of generalized forces per mobilizer.
+      // It has zero size if no forces are applied.
+      VectorUpTo6<T> tau_applied_mobilizer(0);
+
+      // Spatial force applied on B at Bo.
+      // It is left initialized to zero if no forces are applied.
+      SpatialForce<T> Fapplied_Bo_W = SpatialForce<T>::Zero();
+
       // Make a copy to the total applied forces since the call to
       // CalcInverseDynamics_TipToBase() below could overwrite the entry for the
       // current body node if the input applied forces arrays are the same
@@ -1491,7 +1672,7 @@ void MultibodyTree<T>::CalcInverseDynamics(
           context, pc, spatial_inertia_in_world_cache, dynamic_bias_cache,
           *A_WB_array, Fapplied_Bo_W, tau_applied_mobilizer, F_BMo_W_array,
           tau_array);
-    }
+    });
   }
 
   // Add the effect of reflected inertias.
@@ -1714,13 +1895,16 @@ void MultibodyTree<T>::CalcMassMatrix(const systems::Context<T>& context,
   (*M) = reflected_inertia.asDiagonal();
 
   // Perform tip-to-base recursion for each composite body, skipping the world.
+  // Each composite body C only writes the blocks of M in C's columns and their
+  // symmetric blocks in C's rows, so the bodies in a level write disjoint
+  // entries.
   for (int depth = tree_height() - 1; depth > 0; --depth) {
-    for (BodyNodeIndex composite_node_index : body_node_levels_[depth]) {
+    ForEachBodyNodeInLevel(depth, [&](BodyNodeIndex composite_node_index) {
       // Node corresponding to the composite body C.
       const BodyNode<T>& composite_node = *body_nodes_[composite_node_index];
       const int cnv = composite_node.get_num_mobilizer_velocities();
 
-      if (cnv == 0) continue;  // Weld has no generalized coordinates, so skip.
+      if (cnv == 0) return;  // Weld has no generalized coordinates, so skip.
 
       // This node's 6x6 composite body inertia.
       const SpatialInertia<T>& Mc_C_W = Mc_B_W_cache[composite_node_index];
@@ -1800,8 +1984,42 @@ void MultibodyTree<T>::CalcMassMatrix(const systems::Context<T>& context,
         child_node = body_node;                      // Update child node Bc.
         body_node = child_node->parent_body_node();  // Update node B.
       }
+    });
+  }
+}
+
+template <typename T>
+MassMatrixFactorization<T> MultibodyTree<T>::CalcMassMatrixFactorization(
+    const systems::Context<T>& context) const {
+  DRAKE_MBT_THROW_IF_NOT_FINALIZED();
+  const int nv = num_velocities();
+  MatrixX<T> M(nv, nv);
+  CalcMassMatrix(context, &M);
+
+  // The parent of the first velocity of a mobilizer is the last velocity of
+  // the nearest inboard mobilizer that has velocities (skipping welds); the
+  // parent of each other velocity is the one before it.
+  std::vector<int> parents(nv, -1);
+  for (BodyNodeIndex node_index(1); node_index < num_bodies(); ++node_index) {
+    const BodyNodeTopology& node = topology_.get_body_node(node_index);
+    if (node.num_mobilizer_velocities == 0) continue;
+    const int start = node.mobilizer_velocities_start_in_v;
+    // The world is node 0, and has no mobilizer.
+    for (BodyNodeIndex inboard = node.parent_body_node;
+         inboard != BodyNodeIndex(0);) {
+      const BodyNodeTopology& inboard_node = topology_.get_body_node(inboard);
+      if (inboard_node.num_mobilizer_velocities > 0) {
+        parents[start] = inboard_node.mobilizer_velocities_start_in_v +
+                         inboard_node.num_mobilizer_velocities - 1;
+        break;
+      }
+      inboard = inboard_node.parent_body_node;
+    }
+    for (int i = 1; i < node.num_mobilizer_velocities; ++i) {
+      parents[start + i] = start + i - 1;
     }
   }
+  return MassMatrixFactorization<T>(std::move(M), std::move(parents));
 }
 
 template <typename T>
@@ -1820,6 +2038,19 @@ void MultibodyTree<T>::CalcBiasTerm(
                       &A_WB_array, &F_BMo_W_array, Cv);
 }
 
+template <typename T>
+void MultibodyTree<T>::CalcBiasTerm(const systems::Context<T>& context,
+                                    MultibodyWorkspace<T>* workspace,
+                                    EigenPtr<VectorX<T>> Cv) const {
+  DRAKE_THROW_UNLESS(workspace != nullptr);
+  DRAKE_THROW_UNLESS(workspace->CheckHasRightSizeForModel(*this));
+  DRAKE_THROW_UNLESS(Cv != nullptr);
+  DRAKE_THROW_UNLESS(Cv->size() == num_velocities());
+  // An empty std::vector and a zero-sized VectorX do not allocate.
+  CalcInverseDynamics(context, workspace->zero_vdot_, {}, VectorX<T>(),
+                      &workspace->A_WB_, &workspace->F_BMo_W_, Cv);
+}
+
 template <typename T>
 VectorX<T> MultibodyTree<T>::CalcGravityGeneralizedForces(
     const systems::Context<T>& context) const {
@@ -1830,6 +2061,248 @@ VectorX<T> MultibodyTree<T>::CalcGravityGeneralizedForces(
   return VectorX<T>::Zero(num_velocities());
 }
 
+namespace {
+
+// Returns the cross product m1 ×ₘ m2 of two spatial motion vectors (e.g.,
+// spatial velocities), with rotational components first.
+template <typename T>
+Vector6<T> CrossMotion(const Vector6<T>& m1, const Vector6<T>& m2) {
+  Vector6<T> result;
+  result << m1.template head<3>().cross(m2.template head<3>()),
+      m1.template head<3>().cross(m2.template tail<3>()) +
+          m1.template tail<3>().cross(m2.template head<3>());
+  return result;
+}
+
+// Returns the cross product m ×𝑓 f of a spatial motion vector m with a spatial
+// force f, with rotational components first.
+template <typename T>
+Vector6<T> CrossForce(const Vector6<T>& m, const Vector6<T>& f) {
+  Vector6<T> result;
+  result << m.template head<3>().cross(f.template head<3>()) +
+                m.template tail<3>().cross(f.template tail<3>()),
+      m.template head<3>().cross(f.template tail<3>());
+  return result;
+}
+
+}  // namespace
+
+template <typename T>
+void MultibodyTree<T>::CalcInverseDynamicsDerivatives(
+    const systems::Context<T>& context, const VectorX<T>& known_vdot,
+    EigenPtr<MatrixX<T>> dtau_dq, EigenPtr<MatrixX<T>> dtau_dv) const {
+  DRAKE_MBT_THROW_IF_NOT_FINALIZED();
+  DRAKE_THROW_UNLESS(known_vdot.size() == num_velocities());
+  DRAKE_THROW_UNLESS(dtau_dq != nullptr);
+  DRAKE_THROW_UNLESS(dtau_dq->rows() == num_velocities());
+  DRAKE_THROW_UNLESS(dtau_dq->cols() == num_positions());
+  DRAKE_THROW_UNLESS(dtau_dv != nullptr);
+  DRAKE_THROW_UNLESS(dtau_dv->rows() == num_velocities());
+  DRAKE_THROW_UNLESS(dtau_dv->cols() == num_velocities());
+
+  // This method implements the recursive derivatives of the Newton-Euler
+  // algorithm in [Carpentier 2018]. All spatial quantities are measured at the
+  // world origin Wo and expressed in the world frame W. With that choice, the
+  // motion subspace S_B (the 6 x 1 hinge matrix shifted to Wo) of each joint
+  // is fixed in its parent body, and so a change in the generalized position
+  // q_J of a joint J moves all the bodies and joints outboard of J rigidly
+  // with the spatial "velocity" S_J. For instance, ∂S_B/∂q_J = S_J ×ₘ S_B.
+  // This requires q̇ = v and a hinge matrix which is constant in the inboard
+  // frame, hence the restriction to the mobilizers below.
+  //
+  // - [Carpentier 2018] Carpentier, J. and Mansard, N., 2018. Analytical
+  //   derivatives of rigid body dynamics algorithms. Robotics: Science and
+  //   Systems.
+  const int num_nodes = num_bodies();
+  for (BodyNodeIndex i(1); i < num_nodes; ++i) {
+    const Mobilizer<T>& mobilizer = body_nodes_[i]->get_mobilizer();
+    if (dynamic_cast<const RevoluteMobilizer<T>*>(&mobilizer) == nullptr &&
+        dynamic_cast<const PrismaticMobilizer<T>*>(&mobilizer) == nullptr &&
+        dynamic_cast<const ScrewMobilizer<T>*>(&mobilizer) == nullptr &&
+        dynamic_cast<const WeldMobilizer<T>*>(&mobilizer) == nullptr) {
+      throw std::logic_error(fmt::format(
+          "CalcInverseDynamicsDerivatives(): Only revolute, prismatic, screw, "
+          "and weld joints are supported, but body '{}' is connected to its "
+          "parent with a {}.",
+          body_nodes_[i]->body().name(),
+          NiceTypeName::RemoveNamespaces(NiceTypeName::Get(mobilizer))));
+    }
+  }
+
+  const PositionKinematicsCache<T>& pc = EvalPositionKinematics(context);
+  const std::vector<SpatialInertia<T>>& M_B_W_cache =
+      EvalSpatialInertiaInWorldCache(context);
+  const std::vector<Vector6<T>>& H_PB_W_cache =
+      EvalAcrossNodeJacobianWrtVExpressedInWorld(context);
+  const auto v = get_velocities(context);
+  Vector3<T> g_W = Vector3<T>::Zero();
+  if (gravity_field_ != nullptr) {
+    g_W = gravity_field_->gravity_vector().template cast<T>();
+  }
+
+  // The nodes in base-to-tip order, skipping the world.
+  std::vector<BodyNodeIndex> nodes;
+  nodes.reserve(num_nodes - 1);
+  for (int depth = 1; depth < tree_height(); ++depth) {
+    nodes.insert(nodes.end(), body_node_levels_[depth].begin(),
+                 body_node_levels_[depth].end());
+  }
+
+  // Forward pass. The entries for the world node remain zero. S[i] is zero for
+  // welds, which have velocity_index[i] = -1.
+  std::vector<BodyNodeIndex> parent(num_nodes);
+  std::vector<int> velocity_index(num_nodes, -1);
+  std::vector<int> position_index(num_nodes, -1);
+  std::vector<Vector6<T>> S(num_nodes, Vector6<T>::Zero());
+  // Spatial inertia, velocity and acceleration of each body B.
+  std::vector<Matrix6<T>> M_BWo_W(num_nodes);
+  std::vector<Vector6<T>> V_WB(num_nodes, Vector6<T>::Zero());
+  std::vector<Vector6<T>> A_WB(num_nodes, Vector6<T>::Zero());
+  // B's center of mass and the force of gravity on B.
+  std::vector<Vector3<T>> p_WBcm(num_nodes);
+  std::vector<Vector6<T>> Fg_B(num_nodes, Vector6<T>::Zero());
+  // The total spatial force on the bodies outboard of (and including) B.
+  std::vector<Vector6<T>> F_B(num_nodes, Vector6<T>::Zero());
+  for (const BodyNodeIndex i : nodes) {
+    const BodyNode<T>& node = *body_nodes_[i];
+    parent[i] = node.parent_body_node()->index();
+    const Vector3<T>& p_WBo = pc.get_X_WB(i).translation();
+    const SpatialInertia<T> M_BWo = M_B_W_cache[i].Shift(-p_WBo);
+    M_BWo_W[i] = M_BWo.CopyToFullMatrix6();
+    p_WBcm[i] = M_BWo.get_com();
+    if (gravity_field_ != nullptr &&
+        gravity_field_->is_enabled(node.body().model_instance())) {
+      const Vector3<T> f_g = M_BWo.get_mass() * g_W;
+      Fg_B[i] << p_WBcm[i].cross(f_g), f_g;
+    }
+    V_WB[i] = V_WB[parent[i]];
+    A_WB[i] = A_WB[parent[i]];
+    if (node.get_num_mobilizer_velocities() == 1) {
+      const int iv = node.velocity_start_in_v();
+      velocity_index[i] = iv;
+      position_index[i] = node.get_mobilizer().position_start_in_q();
+      const Vector6<T>& H_PB_W = H_PB_W_cache[iv];
+      S[i] << H_PB_W.template head<3>(),
+          H_PB_W.template tail<3>() + p_WBo.cross(H_PB_W.template head<3>());
+      V_WB[i] += S[i] * v(iv);
+      A_WB[i] += S[i] * known_vdot(iv) + CrossMotion(V_WB[i], S[i]) * v(iv);
+    }
+    F_B[i] = M_BWo_W[i] * A_WB[i] +
+             CrossForce(V_WB[i], Vector6<T>(M_BWo_W[i] * V_WB[i])) - Fg_B[i];
+  }
+  for (auto it = nodes.rbegin(); it != nodes.rend(); ++it) {
+    F_B[parent[*it]] += F_B[*it];
+  }
+
+  // For each joint J, compute the derivatives of the spatial forces with
+  // respect to q_J and v_J, and project them onto the joints.
+  dtau_dq->setZero();
+  dtau_dv->setZero();
+  std::vector<bool> is_outboard(num_nodes);
+  std::vector<Vector6<T>> dF_dqJ(num_nodes);
+  std::vector<Vector6<T>> dF_dvJ(num_nodes);
+  for (const BodyNodeIndex j : nodes) {
+    if (velocity_index[j] < 0) continue;
+    const Vector6<T>& S_J = S[j];
+    const Vector6<T>& V_J = V_WB[j];
+    const Vector6<T>& A_J = A_WB[j];
+    const Vector6<T> S_J_x_V_J = CrossMotion(S_J, V_J);
+
+    std::fill(is_outboard.begin(), is_outboard.end(), false);
+    is_outboard[j] = true;
+    for (const BodyNodeIndex i : nodes) {
+      if (i != j && !is_outboard[parent[i]]) continue;
+      is_outboard[i] = true;
+      const Matrix6<T>& M_i = M_BWo_W[i];
+      const Vector6<T>& V_i = V_WB[i];
+      const Vector6<T>& A_i = A_WB[i];
+      const Vector6<T> h_i = M_i * V_i;
+      // Derivatives with respect to q_J, where ∂M/∂q_J x = S_J ×𝑓 (M x) -
+      // M (S_J ×ₘ x), and gravity does not rotate with the body.
+      const Vector6<T> dV = CrossMotion(S_J, Vector6<T>(V_i - V_J));
+      const Vector6<T> dA = CrossMotion(S_J, Vector6<T>(A_i - A_J)) -
+                            CrossMotion(S_J_x_V_J, Vector6<T>(V_i - V_J));
+      const Vector6<T> dM_A =
+          CrossForce(S_J, Vector6<T>(M_i * A_i)) - M_i * CrossMotion(S_J, A_i);
+      const Vector6<T> dM_V =
+          CrossForce(S_J, h_i) - M_i * CrossMotion(S_J, V_i);
+      Vector6<T> dFg = Vector6<T>::Zero();
+      dFg.template head<3>() =
+          (S_J.template head<3>().cross(p_WBcm[i]) + S_J.template tail<3>())
+              .cross(Fg_B[i].template tail<3>());
+      dF_dqJ[i] = dM_A + M_i * dA + CrossForce(dV, h_i) +
+                  CrossForce(V_i, dM_V) +
+                  CrossForce(V_i, Vector6<T>(M_i * dV)) - dFg;
+      // Derivatives with respect to v_J.
+      const Vector6<T> dA_dv = CrossMotion(S_J, Vector6<T>(V_i - V_J)) +
+                               CrossMotion(V_J, S_J);
+      dF_dvJ[i] = M_i * dA_dv + CrossForce(S_J, h_i) +
+                  CrossForce(V_i, Vector6<T>(M_i * S_J));
+    }
+    for (auto it = nodes.rbegin(); it != nodes.rend(); ++it) {
+      if (*it != j && is_outboard[*it]) {
+        dF_dqJ[parent[*it]] += dF_dqJ[*it];
+        dF_dvJ[parent[*it]] += dF_dvJ[*it];
+      }
+    }
+
+    // Joints outboard of J (including J) move with J.
+    const int qj = position_index[j];
+    const int vj = velocity_index[j];
+    for (const BodyNodeIndex k : nodes) {
+      if (!is_outboard[k] || velocity_index[k] < 0) continue;
+      const int vk = velocity_index[k];
+      (*dtau_dq)(vk, qj) =
+          CrossMotion(S_J, S[k]).dot(F_B[k]) + S[k].dot(dF_dqJ[k]);
+      (*dtau_dv)(vk, vj) = S[k].dot(dF_dvJ[k]);
+    }
+    // Joints inboard of J only see the change of the forces outboard of J.
+    for (BodyNodeIndex k = parent[j]; k != 0; k = parent[k]) {
+      if (velocity_index[k] < 0) continue;
+      const int vk = velocity_index[k];
+      (*dtau_dq)(vk, qj) = S[k].dot(dF_dqJ[j]);
+      (*dtau_dv)(vk, vj) = S[k].dot(dF_dvJ[j]);
+    }
+  }
+}
+
+template <typename T>
+void MultibodyTree<T>::CalcForwardDynamicsDerivatives(
+    const systems::Context<T>& context, const VectorX<T>& tau,
+    EigenPtr<VectorX<T>> vdot, EigenPtr<MatrixX<T>> dvdot_dq,
+    EigenPtr<MatrixX<T>> dvdot_dv, EigenPtr<MatrixX<T>> dvdot_dtau) const {
+  DRAKE_MBT_THROW_IF_NOT_FINALIZED();
+  const int nv = num_velocities();
+  DRAKE_THROW_UNLESS(tau.size() == nv);
+  DRAKE_THROW_UNLESS(vdot != nullptr && vdot->size() == nv);
+  DRAKE_THROW_UNLESS(dvdot_dtau != nullptr);
+  DRAKE_THROW_UNLESS(dvdot_dtau->rows() == nv && dvdot_dtau->cols() == nv);
+  if constexpr (scalar_predicate<T>::is_bool) {
+    const MassMatrixFactorization<T> M_ltdl =
+        CalcMassMatrixFactorization(context);
+    VectorX<T> Cv(nv);
+    CalcBiasTerm(context, &Cv);
+    *vdot = M_ltdl.Solve(tau + CalcGravityGeneralizedForces(context) - Cv);
+
+    // Since the inverse dynamics of v̇(q, v, tau) is tau, the derivatives of
+    // the forward dynamics are ∂v̇/∂q = -M⁻¹⋅∂tau/∂q, ∂v̇/∂v = -M⁻¹⋅∂tau/∂v,
+    // and ∂v̇/∂tau = M⁻¹.
+    MatrixX<T> dtau_dq(nv, num_positions());
+    MatrixX<T> dtau_dv(nv, nv);
+    CalcInverseDynamicsDerivatives(context, *vdot, &dtau_dq, &dtau_dv);
+    DRAKE_THROW_UNLESS(dvdot_dq != nullptr);
+    DRAKE_THROW_UNLESS(dvdot_dv != nullptr);
+    *dvdot_dq = -M_ltdl.Solve(dtau_dq);
+    *dvdot_dv = -M_ltdl.Solve(dtau_dv);
+    *dvdot_dtau = M_ltdl.Solve(MatrixX<T>::Identity(nv, nv));
+  } else {
+    unused(context, dvdot_dq, dvdot_dv);
+    throw std::logic_error(
+        "CalcForwardDynamicsDerivatives(): Not supported for T = "
+        "symbolic::Expression.");
+  }
+}
+
 template <typename T>
 RigidTransform<T> MultibodyTree<T>::CalcRelativeTransform(
     const systems::Context<T>& context,
@@ -2559,6 +3032,46 @@ void MultibodyTree<T>::CalcJacobianSpatialVelocity(
     const Frame<T>& frame_E,
     EigenPtr<MatrixX<T>> Js_V_ABp_E) const {
   DRAKE_THROW_UNLESS(Js_V_ABp_E != nullptr);
+  if (frame_A.body().index() == world_index()) {
+    CalcJacobianSpatialVelocityImpl(context, with_respect_to, frame_B, p_BP,
+                                    frame_A, frame_E, nullptr, Js_V_ABp_E);
+  } else {
+    MatrixX<T> Js_V_WAp_W(Js_V_ABp_E->rows(), Js_V_ABp_E->cols());
+    CalcJacobianSpatialVelocityImpl(context, with_respect_to, frame_B, p_BP,
+                                    frame_A, frame_E, &Js_V_WAp_W, Js_V_ABp_E);
+  }
+}
+
+template <typename T>
+void MultibodyTree<T>::CalcJacobianSpatialVelocity(
+    const systems::Context<T>& context,
+    const JacobianWrtVariable with_respect_to,
+    const Frame<T>& frame_B,
+    const Eigen::Ref<const Vector3<T>>& p_BP,
+    const Frame<T>& frame_A,
+    const Frame<T>& frame_E,
+    MultibodyWorkspace<T>* workspace,
+    EigenPtr<MatrixX<T>> Js_V_ABp_E) const {
+  DRAKE_THROW_UNLESS(workspace != nullptr);
+  DRAKE_THROW_UNLESS(workspace->CheckHasRightSizeForModel(*this));
+  DRAKE_THROW_UNLESS(Js_V_ABp_E != nullptr);
+  DRAKE_THROW_UNLESS(Js_V_ABp_E->cols() <= workspace->J_.cols());
+  auto Js_V_WAp_W = workspace->J_.leftCols(Js_V_ABp_E->cols());
+  CalcJacobianSpatialVelocityImpl(context, with_respect_to, frame_B, p_BP,
+                                  frame_A, frame_E, &Js_V_WAp_W, Js_V_ABp_E);
+}
+
+template <typename T>
+void MultibodyTree<T>::CalcJacobianSpatialVelocityImpl(
+    const systems::Context<T>& context,
+    const JacobianWrtVariable with_respect_to,
+    const Frame<T>& frame_B,
+    const Eigen::Ref<const Vector3<T>>& p_BP,
+    const Frame<T>& frame_A,
+    const Frame<T>& frame_E,
+    EigenPtr<MatrixX<T>> Js_V_WAp_W,
+    EigenPtr<MatrixX<T>> Js_V_ABp_E) const {
+  DRAKE_THROW_UNLESS(Js_V_ABp_E != nullptr);
   DRAKE_THROW_UNLESS(Js_V_ABp_E->rows() == 6);
 
   const int num_columns = (with_respect_to == JacobianWrtVariable::kQDot) ?
@@ -2578,39 +3091,118 @@ void MultibodyTree<T>::CalcJacobianSpatialVelocity(
   // Expressed in frame E, this becomes
   //   V_ABp_E = R_EW⋅(Js_V_WBp - Js_V_WAp) ⋅ s.
   // Thus, Js_V_ABp_E = R_EW⋅(Js_V_WBp - Js_V_WAp).
+  //
+  // Js_V_WBp is computed in place in Js_V_ABp_E, and none of the steps below
+  // allocate heap memory.
 
-  Vector3<T> p_WP;
-  CalcPointsPositions(context, frame_B, p_BP, /* From frame B */
-                      world_frame(), &p_WP);  /* To world frame W */
+  const Vector3<T> p_WP =
+      CalcRelativeTransform(context, world_frame(), frame_B) * p_BP;
 
   // TODO(amcastro-tri): When performance becomes an issue, implement this
   // method so that we only consider the kinematic path from A to B.
 
-  Matrix6X<T> Js_V_WAp(6, num_columns);
-  auto Js_w_WAp = Js_V_WAp.template topRows<3>();     // rotational part.
-  auto Js_v_WAp = Js_V_WAp.template bottomRows<3>();  // translational part.
-  CalcJacobianAngularAndOrTranslationalVelocityInWorld(context,
-      with_respect_to, frame_A,  p_WP,  &Js_w_WAp, &Js_v_WAp);
-
-  Matrix6X<T> Js_V_WBp(6, num_columns);
-  auto Js_w_WBp = Js_V_WBp.template topRows<3>();     // rotational part.
-  auto Js_v_WBp = Js_V_WBp.template bottomRows<3>();  // translational part.
+  auto Js_w_WBp = Js_V_ABp_E->template topRows<3>();     // rotational part.
+  auto Js_v_WBp = Js_V_ABp_E->template bottomRows<3>();  // translational part.
   CalcJacobianAngularAndOrTranslationalVelocityInWorld(context,
       with_respect_to, frame_B,  p_WP,  &Js_w_WBp, &Js_v_WBp);
 
-  // Jacobian Js_V_ABp_W when E is the world frame W.
-  Js_V_ABp_E->template topRows<3>() = Js_w_WBp - Js_w_WAp;
-  Js_V_ABp_E->template bottomRows<3>() = Js_v_WBp - Js_v_WAp;
+  // The Jacobian of a frame A attached to the world is zero.
+  if (frame_A.body().index() != world_index()) {
+    DRAKE_DEMAND(Js_V_WAp_W != nullptr);
+    DRAKE_DEMAND(Js_V_WAp_W->rows() == 6);
+    DRAKE_DEMAND(Js_V_WAp_W->cols() == num_columns);
+    auto Js_w_WAp = Js_V_WAp_W->template topRows<3>();     // rotational part.
+    auto Js_v_WAp = Js_V_WAp_W->template bottomRows<3>();  // translational.
+    CalcJacobianAngularAndOrTranslationalVelocityInWorld(context,
+        with_respect_to, frame_A,  p_WP,  &Js_w_WAp, &Js_v_WAp);
+    *Js_V_ABp_E -= *Js_V_WAp_W;
+  }
 
   // If the expressed-in frame E is not the world frame, we need to perform
-  // an additional operation.
+  // an additional operation. It is done one column at a time, since the
+  // product of R_EW with all of Js_V_ABp_E in place would need a temporary.
   if (frame_E.index() != world_frame().index()) {
     const RotationMatrix<T> R_EW =
         CalcRelativeRotationMatrix(context, frame_E, world_frame());
-    Js_V_ABp_E->template topRows<3>() =
-        R_EW * Js_V_ABp_E->template topRows<3>();
-    Js_V_ABp_E->template bottomRows<3>() =
-        R_EW * Js_V_ABp_E->template bottomRows<3>();
+    for (int j = 0; j < num_columns; ++j) {
+      auto Js_V_ABp_E_j = Js_V_ABp_E->col(j);
+      const Vector3<T> w = Js_V_ABp_E_j.template head<3>();
+      const Vector3<T> v = Js_V_ABp_E_j.template tail<3>();
+      Js_V_ABp_E_j.template head<3>() = R_EW * w;
+      Js_V_ABp_E_j.template tail<3>() = R_EW * v;
+    }
+  }
+}
+
+template <typename T>
+void MultibodyTree<T>::CalcJacobiansSpatialVelocity(
+    const systems::Context<T>& context,
+    const JacobianWrtVariable with_respect_to,
+    const std::vector<const Frame<T>*>& frames_B,
+    const Eigen::Ref<const Matrix3X<T>>& p_BoBp_B,
+    const Frame<T>& frame_A,
+    const Frame<T>& frame_E,
+    EigenPtr<MatrixX<T>> Js_V_ABp_E) const {
+  const int num_points = static_cast<int>(frames_B.size());
+  DRAKE_THROW_UNLESS(p_BoBp_B.cols() == num_points);
+  DRAKE_THROW_UNLESS(Js_V_ABp_E != nullptr);
+  DRAKE_THROW_UNLESS(Js_V_ABp_E->rows() == 6 * num_points);
+  const int num_columns = (with_respect_to == JacobianWrtVariable::kQDot) ?
+                           num_positions() : num_velocities();
+  DRAKE_THROW_UNLESS(Js_V_ABp_E->cols() == num_columns);
+  for (const Frame<T>* frame_B : frames_B) {
+    DRAKE_THROW_UNLESS(frame_B != nullptr);
+  }
+
+  // This is CalcJacobianSpatialVelocityImpl() for each point, except that the
+  // work that does not depend on the point is only done once. In particular,
+  // frame A's Jacobian is computed at Ao, and then shifted to each point Bp
+  // rather than recomputed for it: the Jacobian of the point Ap of A that
+  // coincides with Bp is Js_V_WAp = [Js_w_WA; Js_v_WAo + Js_w_WA × p_AoBp].
+  const bool is_A_world = frame_A.body().index() == world_index();
+  MatrixX<T> Js_V_WAo_W;
+  Vector3<T> p_WAo = Vector3<T>::Zero();
+  if (!is_A_world) {
+    p_WAo =
+        CalcRelativeTransform(context, world_frame(), frame_A).translation();
+    Js_V_WAo_W.resize(6, num_columns);
+    auto Js_w_WA = Js_V_WAo_W.template topRows<3>();
+    auto Js_v_WAo = Js_V_WAo_W.template bottomRows<3>();
+    CalcJacobianAngularAndOrTranslationalVelocityInWorld(context,
+        with_respect_to, frame_A, p_WAo, &Js_w_WA, &Js_v_WAo);
+  }
+  const bool is_E_world = frame_E.index() == world_frame().index();
+  const RotationMatrix<T> R_EW =
+      is_E_world ? RotationMatrix<T>()
+                 : CalcRelativeRotationMatrix(context, frame_E, world_frame());
+
+  for (int i = 0; i < num_points; ++i) {
+    const Frame<T>& frame_B = *frames_B[i];
+    const Vector3<T> p_WP =
+        CalcRelativeTransform(context, world_frame(), frame_B) *
+        p_BoBp_B.col(i);
+    auto Js_w_AB = Js_V_ABp_E->template block<3, Eigen::Dynamic>(
+        6 * i, 0, 3, num_columns);
+    auto Js_v_ABp = Js_V_ABp_E->template block<3, Eigen::Dynamic>(
+        6 * i + 3, 0, 3, num_columns);
+    CalcJacobianAngularAndOrTranslationalVelocityInWorld(context,
+        with_respect_to, frame_B, p_WP, &Js_w_AB, &Js_v_ABp);
+    const Vector3<T> p_AoBp_W = p_WP - p_WAo;
+    for (int j = 0; j < num_columns; ++j) {
+      Vector3<T> w = Js_w_AB.col(j);
+      Vector3<T> v = Js_v_ABp.col(j);
+      if (!is_A_world) {
+        const auto Js_w_WA_j = Js_V_WAo_W.col(j).template head<3>();
+        w -= Js_w_WA_j;
+        v -= Js_V_WAo_W.col(j).template tail<3>() + Js_w_WA_j.cross(p_AoBp_W);
+      }
+      if (!is_E_world) {
+        w = R_EW * w;
+        v = R_EW * v;
+      }
+      Js_w_AB.col(j) = w;
+      Js_v_ABp.col(j) = v;
+    }
   }
 }
 
@@ -2765,6 +3357,45 @@ void MultibodyTree<T>::CalcJacobianTranslationalVelocity(
   }
 }
 
+template <typename T>
+void MultibodyTree<T>::CalcTreeJacobianTranslationalVelocityInWorld(
+    const systems::Context<T>& context, BodyIndex body_B,
+    const Vector3<T>& p_WBp, EigenPtr<Matrix3X<T>> Jv_WBp_W_tree) const {
+  DRAKE_THROW_UNLESS(Jv_WBp_W_tree != nullptr);
+  const TreeIndex tree = topology_.body_to_tree_index(body_B);
+  DRAKE_DEMAND(topology_.tree_has_dofs(tree));
+  DRAKE_THROW_UNLESS(Jv_WBp_W_tree->cols() ==
+                     topology_.num_tree_velocities(tree));
+  const int tree_start_in_v = topology_.tree_velocities_start_in_v(tree);
+  Jv_WBp_W_tree->setZero();
+
+  const PositionKinematicsCache<T>& pc = EvalPositionKinematics(context);
+  const std::vector<Vector6<T>>& H_PB_W_cache =
+      EvalAcrossNodeJacobianWrtVExpressedInWorld(context);
+
+  // All the nodes inboard of B, but the world, belong to B's tree.
+  for (BodyNodeIndex body_node_index = get_body(body_B).node_index();
+       body_node_index != BodyNodeIndex(0);
+       body_node_index = body_nodes_[body_node_index]
+                             ->get_topology().parent_body_node) {
+    const BodyNode<T>& node = *body_nodes_[body_node_index];
+    const BodyNodeTopology& node_topology = node.get_topology();
+    const int num_velocities = node_topology.num_mobilizer_velocities;
+    if (num_velocities == 0) continue;
+    Eigen::Map<const MatrixUpTo6<T>> H_PB_W =
+        node.GetJacobianFromArray(H_PB_W_cache);
+    const Vector3<T> p_BoBp_W =
+        p_WBp - pc.get_X_WB(node.index()).translation();
+    const int start =
+        node_topology.mobilizer_velocities_start_in_v - tree_start_in_v;
+    for (int j = 0; j < num_velocities; ++j) {
+      Jv_WBp_W_tree->col(start + j) =
+          H_PB_W.col(j).template tail<3>() +
+          H_PB_W.col(j).template head<3>().cross(p_BoBp_W);
+    }
+  }
+}
+
 template <typename T>
 void MultibodyTree<T>::CalcJacobianAngularAndOrTranslationalVelocityInWorld(
     const systems::Context<T>& context,
@@ -2800,9 +3431,6 @@ void MultibodyTree<T>::CalcJacobianAngularAndOrTranslationalVelocityInWorld(
   // bodies, w_wF = Js_w_WF * v = 0  and  v_WFpi = Js_v_WFpi * v = 0.
   if (body_F.index() == world_index()) return;
 
-  // Form kinematic path from body_F to the world.
-  std::vector<BodyNodeIndex> path_to_world;
-  topology_.GetKinematicPathToWorld(body_F.node_index(), &path_to_world);
   const PositionKinematicsCache<T>& pc = EvalPositionKinematics(context);
 
   const std::vector<Vector6<T>>& H_PB_W_cache =
@@ -2811,11 +3439,14 @@ void MultibodyTree<T>::CalcJacobianAngularAndOrTranslationalVelocityInWorld(
   // A statically allocated matrix with a maximum number of rows and columns.
   Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic, 0, 6, 7> Nplus;
 
-  // For all bodies in the kinematic path from the world to body_F, compute
-  // each node's contribution to the Jacobians.
-  // Skip the world (ilevel = 0).
-  for (size_t ilevel = 1; ilevel < path_to_world.size(); ++ilevel) {
-    const BodyNodeIndex body_node_index = path_to_world[ilevel];
+  // For all bodies in the kinematic path from body_F to the world, compute
+  // each node's contribution to the Jacobians. Each node fills in its own
+  // columns, so we walk the path from body_F inwards rather than forming it
+  // in a std::vector, which would allocate. Skip the world (node 0).
+  for (BodyNodeIndex body_node_index = body_F.node_index();
+       body_node_index != BodyNodeIndex(0);
+       body_node_index = body_nodes_[body_node_index]
+                             ->get_topology().parent_body_node) {
     const BodyNode<T>& node = *body_nodes_[body_node_index];
     const BodyNodeTopology& node_topology = node.get_topology();
     const Mobilizer<T>& mobilizer = node.get_mobilizer();
@@ -2858,7 +3489,7 @@ void MultibodyTree<T>::CalcJacobianAngularAndOrTranslationalVelocityInWorld(
     // all these are points of (fixed/welded to) the same body_F.
     if (Js_w_WF_W) {
       // Get memory address in the output Jacobian angular velocity Js_w_WF_W
-      // corresponding to the contribution of the mobilities in level ilevel.
+      // corresponding to the contribution of the mobilities of this node.
       auto Js_w_PB_W = Js_w_WF_W->block(0, start_index, 3,
                                         mobilizer_jacobian_ncols);
       if (is_wrt_qdot) {
@@ -2871,7 +3502,7 @@ void MultibodyTree<T>::CalcJacobianAngularAndOrTranslationalVelocityInWorld(
     if (Js_v_WFpi_W) {
       // Get memory address in the output block Jacobian translational velocity
       // Js_v_PFpi_W corresponding to the contribution of the mobilities in
-      // level ilevel.  This address corresponds to point Fpi's Jacobian
+      // this node.  This address corresponds to point Fpi's Jacobian
       // translational velocity in the inboard (parent) body frame P, expressed
       // in world frame W.  That is, v_PFpi_W = Js_v_PFpi_W * v(B), where v(B)
       // are the mobilities that correspond to the current node.
@@ -2879,7 +3510,7 @@ void MultibodyTree<T>::CalcJacobianAngularAndOrTranslationalVelocityInWorld(
                                             mobilizer_jacobian_ncols);
 
       // Position from Wo (world origin) to Bo (origin of body associated with
-      // node at level ilevel), expressed in world frame W.
+      // this node), expressed in world frame W.
       const Vector3<T>& p_WoBo = pc.get_X_WB(node.index()).translation();
 
       for (int ipoint = 0; ipoint < num_points; ++ipoint) {
@@ -3301,7 +3932,7 @@ void MultibodyTree<T>::CalcArticulatedBodyInertiaCache(
 
   // Perform tip-to-base recursion, skipping the world.
   for (int depth = tree_height() - 1; depth > 0; --depth) {
-    for (BodyNodeIndex body_node_index : body_node_levels_[depth]) {
+    ForEachBodyNodeInLevel(depth, [&](BodyNodeIndex body_node_index) {
       const BodyNode<T>& node = *body_nodes_[body_node_index];
 
       // Get hinge matrix and spatial inertia for this node.
@@ -3312,7 +3943,7 @@ void MultibodyTree<T>::CalcArticulatedBodyInertiaCache(
 
       node.CalcArticulatedBodyInertiaCache_TipToBase(
           context, pc, H_PB_W, M_B_W, diagonal_inertias, abic);
-    }
+    });
   }
 }
 
@@ -3344,7 +3975,7 @@ void MultibodyTree<T>::CalcArticulatedBodyForceCache(
 
   // Perform tip-to-base recursion, skipping the world.
   for (int depth = tree_height() - 1; depth > 0; --depth) {
-    for (BodyNodeIndex body_node_index : body_node_levels_[depth]) {
+    ForEachBodyNodeInLevel(depth, [&](BodyNodeIndex body_node_index) {
       const BodyNode<T>& node = *body_nodes_[body_node_index];
 
       // Get generalized force and body force for this node.
@@ -3362,7 +3993,7 @@ void MultibodyTree<T>::CalcArticulatedBodyForceCache(
       node.CalcArticulatedBodyForceCache_TipToBase(
           context, pc, &vc, Fb_B_W, abic, Zb_Bo_W, Fapplied_Bo_W, tau_applied,
           H_PB_W, aba_force_cache);
-    }
+    });
   }
 }
 
@@ -3398,7 +4029,7 @@ void MultibodyTree<T>::CalcArticulatedBodyAccelerations(
 
   // Perform base-to-tip recursion, skipping the world.
   for (int depth = 1; depth < tree_height(); ++depth) {
-    for (BodyNodeIndex body_node_index : body_node_levels_[depth]) {
+    ForEachBodyNodeInLevel(depth, [&](BodyNodeIndex body_node_index) {
       const BodyNode<T>& node = *body_nodes_[body_node_index];
 
       const SpatialAcceleration<T>& Ab_WB = Ab_WB_cache[body_node_index];
@@ -3409,7 +4040,7 @@ void MultibodyTree<T>::CalcArticulatedBodyAccelerations(
 
       node.CalcArticulatedBodyAccelerations_BaseToTip(
           context, pc, abic, aba_force_cache, H_PB_W, Ab_WB, ac);
-    }
+    });
   }
 }
 
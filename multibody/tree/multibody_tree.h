@@ -18,6 +18,7 @@
 #include "drake/common/default_scalars.h"
 #include "drake/common/drake_copyable.h"
 #include "drake/common/drake_deprecated.h"
+#include "drake/common/parallelism.h"
 #include "drake/common/pointer_cast.h"
 #include "drake/common/random.h"
 #include "drake/math/rigid_transform.h"
@@ -25,9 +26,11 @@
 #include "drake/multibody/tree/acceleration_kinematics_cache.h"
 #include "drake/multibody/tree/articulated_body_force_cache.h"
 #include "drake/multibody/tree/articulated_body_inertia_cache.h"
+#include "drake/multibody/tree/mass_matrix_factorization.h"
 #include "drake/multibody/tree/multibody_forces.h"
 #include "drake/multibody/tree/multibody_tree_system.h"
 #include "drake/multibody/tree/multibody_tree_topology.h"
+#include "drake/multibody/tree/multibody_workspace.h"
 #include "drake/multibody/tree/position_kinematics_cache.h"
 #include "drake/multibody/tree/spatial_inertia.h"
 #include "drake/multibody/tree/string_view_map_key.h"
@@ -75,6 +78,23 @@ template <typename T> class ModelInstance;
 template <typename T> class Mobilizer;
 template <typename T> class QuaternionFloatingMobilizer;
 
+// Hashes the (model instance, name) keys of ScopedNameToIndex.
+struct ScopedNameHash {
+  size_t operator()(const std::pair<ModelInstanceIndex, std::string_view>& key)
+      const noexcept {
+    const size_t name_hash = std::hash<std::string_view>{}(key.second);
+    return name_hash ^ (std::hash<int>{}(key.first) + 0x9e3779b9 +
+                        (name_hash << 6) + (name_hash >> 2));
+  }
+};
+
+// Maps the model instance and name of each element (e.g., body) to its index.
+// The names are views of the keys of the owning name_to_index multimaps.
+template <typename ElementIndex>
+using ScopedNameToIndex =
+    std::unordered_map<std::pair<ModelInstanceIndex, std::string_view>,
+                       ElementIndex, ScopedNameHash>;
+
 // %MultibodyTree provides a representation for a physical system consisting of
 // a collection of interconnected rigid and deformable bodies. As such, it owns
 // and manages each of the elements that belong to this physical system.
@@ -651,6 +671,14 @@ class MultibodyTree {
     return topology_.forest_height();
   }
 
+  // See MultibodyPlant method.
+  void set_tree_parallelism(Parallelism parallelism) {
+    tree_parallelism_ = parallelism;
+  }
+
+  // See MultibodyPlant method.
+  Parallelism get_tree_parallelism() const { return tree_parallelism_; }
+
   // Returns a constant reference to the *world* body.
   const RigidBody<T>& world_body() const {
     // world_body_ is set in the constructor. So this assert is here only to
@@ -1164,6 +1192,12 @@ class MultibodyTree {
       const systems::Context<T>& context,
       std::vector<math::RigidTransform<T>>* X_WB) const;
 
+  // See MultibodyPlant method.
+  void CalcAllBodyPosesInWorldBatch(
+      const systems::Context<T>& context,
+      const Eigen::Ref<const MatrixX<T>>& q_batch,
+      std::vector<std::vector<math::RigidTransform<T>>>* X_WB_batch) const;
+
   // See MultibodyPlant method.
   void CalcAllBodySpatialVelocitiesInWorld(
       const systems::Context<T>& context,
@@ -1292,6 +1326,24 @@ class MultibodyTree {
       const Frame<T>& frame_A, const Frame<T>& frame_E,
       EigenPtr<MatrixX<T>> Js_V_ABp_E) const;
 
+  // See MultibodyPlant method.
+  void CalcJacobianSpatialVelocity(
+      const systems::Context<T>& context,
+      JacobianWrtVariable with_respect_to,
+      const Frame<T>& frame_B, const Eigen::Ref<const Vector3<T>>& p_BP,
+      const Frame<T>& frame_A, const Frame<T>& frame_E,
+      MultibodyWorkspace<T>* workspace,
+      EigenPtr<MatrixX<T>> Js_V_ABp_E) const;
+
+  // See MultibodyPlant method.
+  void CalcJacobiansSpatialVelocity(
+      const systems::Context<T>& context,
+      JacobianWrtVariable with_respect_to,
+      const std::vector<const Frame<T>*>& frames_B,
+      const Eigen::Ref<const Matrix3X<T>>& p_BoBp_B,
+      const Frame<T>& frame_A, const Frame<T>& frame_E,
+      EigenPtr<MatrixX<T>> Js_V_ABp_E) const;
+
   // See MultibodyPlant method.
   void CalcJacobianAngularVelocity(const systems::Context<T>& context,
                                    JacobianWrtVariable with_respect_to,
@@ -1345,6 +1397,22 @@ class MultibodyTree {
       const Frame<T>& frame_E,
       EigenPtr<MatrixX<T>> Js_v_ABi_E) const;
 
+  // For a point Bp fixed to body B, computes the block of Bp's translational
+  // velocity Jacobian Jv_WBp_W, with respect to v and expressed in the world
+  // frame, for the velocities of the tree that contains B. Those are the only
+  // columns of Jv_WBp_W that can be nonzero, so this costs O(depth of B)
+  // rather than the O(nv) of computing all of Jv_WBp_W, which matters for
+  // models with many trees and many contacts.
+  // @param[in] p_WBp The position of point Bp in the world frame.
+  // @param[out] Jv_WBp_W_tree The columns of Jv_WBp_W from the tree's first
+  //   velocity, see MultibodyTreeTopology::tree_velocities_start_in_v().
+  // @pre B is not anchored, i.e., its tree has velocities.
+  // @throws std::exception if `Jv_WBp_W_tree` is nullptr or not of size
+  //   3 x num_tree_velocities() for B's tree.
+  void CalcTreeJacobianTranslationalVelocityInWorld(
+      const systems::Context<T>& context, BodyIndex body_B,
+      const Vector3<T>& p_WBp, EigenPtr<Matrix3X<T>> Jv_WBp_W_tree) const;
+
   // See MultibodyPlant method.
   void CalcJacobianCenterOfMassTranslationalVelocity(
       const systems::Context<T>& context,
@@ -1536,6 +1604,12 @@ class MultibodyTree {
       const VectorX<T>& known_vdot,
       const MultibodyForces<T>& external_forces) const;
 
+  // See MultibodyPlant method.
+  void CalcInverseDynamics(
+      const systems::Context<T>& context, const VectorX<T>& known_vdot,
+      const MultibodyForces<T>& external_forces,
+      MultibodyWorkspace<T>* workspace, EigenPtr<VectorX<T>> tau) const;
+
   // (Advanced) Given the state of `this` %MultibodyTree in `context` and a
   // known vector of generalized accelerations `vdot`, this method computes the
   // set of generalized forces `tau` that would need to be applied at each
@@ -1697,14 +1771,37 @@ class MultibodyTree {
   void CalcMassMatrix(const systems::Context<T>& context,
                       EigenPtr<MatrixX<T>> M) const;
 
+  // See MultibodyPlant method.
+  MassMatrixFactorization<T> CalcMassMatrixFactorization(
+      const systems::Context<T>& context) const;
+
   // See MultibodyPlant method.
   void CalcBiasTerm(
       const systems::Context<T>& context, EigenPtr<VectorX<T>> Cv) const;
 
+  // See MultibodyPlant method.
+  void CalcBiasTerm(const systems::Context<T>& context,
+                    MultibodyWorkspace<T>* workspace,
+                    EigenPtr<VectorX<T>> Cv) const;
+
   // See MultibodyPlant method.
   VectorX<T> CalcGravityGeneralizedForces(
       const systems::Context<T>& context) const;
 
+  // See MultibodyPlant method.
+  void CalcInverseDynamicsDerivatives(const systems::Context<T>& context,
+                                      const VectorX<T>& known_vdot,
+                                      EigenPtr<MatrixX<T>> dtau_dq,
+                                      EigenPtr<MatrixX<T>> dtau_dv) const;
+
+  // See MultibodyPlant method.
+  void CalcForwardDynamicsDerivatives(const systems::Context<T>& context,
+                                      const VectorX<T>& tau,
+                                      EigenPtr<VectorX<T>> vdot,
+                                      EigenPtr<MatrixX<T>> dvdot_dq,
+                                      EigenPtr<MatrixX<T>> dvdot_dv,
+                                      EigenPtr<MatrixX<T>> dvdot_dtau) const;
+
   // See MultibodyPlant method.
   bool IsVelocityEqualToQDot() const;
 
@@ -2359,6 +2456,7 @@ class MultibodyTree {
     tree_clone->instance_index_to_name_ = this->instance_index_to_name_;
     tree_clone->joint_to_mobilizer_ = this->joint_to_mobilizer_;
     tree_clone->discrete_state_index_ = this->discrete_state_index_;
+    tree_clone->tree_parallelism_ = this->tree_parallelism_;
 
     // All other internals templated on T are created with the following call to
     // FinalizeInternals().
@@ -2893,6 +2991,17 @@ class MultibodyTree {
       EigenPtr<Matrix3X<T>> Js_w_WF_W,
       EigenPtr<MatrixX<T>> Js_v_WFpi_W) const;
 
+  // Implements both overloads of CalcJacobianSpatialVelocity(). `Js_V_WAp_W`
+  // is scratch space with the size of `Js_V_ABp_E`, for frame A's Jacobian;
+  // it may be nullptr if frame A is attached to the world body.
+  void CalcJacobianSpatialVelocityImpl(
+      const systems::Context<T>& context,
+      JacobianWrtVariable with_respect_to,
+      const Frame<T>& frame_B, const Eigen::Ref<const Vector3<T>>& p_BP,
+      const Frame<T>& frame_A, const Frame<T>& frame_E,
+      EigenPtr<MatrixX<T>> Js_V_WAp_W,
+      EigenPtr<MatrixX<T>> Js_V_ABp_E) const;
+
   // Helper method for CalcJacobianTranslationalVelocity().
   // @param[in] context The state of the multibody system.
   // @param[in] with_respect_to Enum equal to JacobianWrtVariable::kQDot or
@@ -2932,6 +3041,13 @@ class MultibodyTree {
 
   void CreateModelInstances();
 
+  // Calls `visit(body_node_index)` for every body node in the given level of
+  // the tree. When tree_parallelism_ allows it and the level is wide enough,
+  // the calls are spread across threads, so `visit` must only write data
+  // owned by its node.
+  template <typename Visitor>
+  void ForEachBodyNodeInLevel(int level, const Visitor& visit) const;
+
   // Helper method to create a clone of `frame` and add it to `this` tree.
   template <typename FromScalar>
   Frame<T>* CloneFrameAndAdd(const Frame<FromScalar>& frame);
@@ -3138,6 +3254,16 @@ class MultibodyTree {
   std::unordered_multimap<StringViewMapKey, JointActuatorIndex>
       actuator_name_to_index_;
 
+  // The scoped_xxx_name_to_index_ maps index the entries of the maps above by
+  // model instance as well, so that lookups by name within a given model
+  // instance take constant time no matter how many model instances share the
+  // name (e.g., many copies of the same robot). They are built by
+  // FinalizeInternals(); afterwards, no elements may be added.
+  ScopedNameToIndex<BodyIndex> scoped_body_name_to_index_;
+  ScopedNameToIndex<FrameIndex> scoped_frame_name_to_index_;
+  ScopedNameToIndex<JointIndex> scoped_joint_name_to_index_;
+  ScopedNameToIndex<JointActuatorIndex> scoped_actuator_name_to_index_;
+
   // Map used to find a model instance index by its model instance name.
   std::unordered_map<StringViewMapKey, ModelInstanceIndex>
       instance_name_to_index_;
@@ -3174,6 +3300,9 @@ class MultibodyTree {
 
   const MultibodyTreeSystem<T>* tree_system_{};
 
+  // The maximum parallelism of the level-by-level passes over the tree.
+  Parallelism tree_parallelism_{Parallelism::None()};
+
   // The discrete state index for the multibody state if the system is discrete.
   systems::DiscreteStateIndex discrete_state_index_;
 };
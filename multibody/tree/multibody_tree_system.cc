@@ -1,6 +1,7 @@
 #include "drake/multibody/tree/multibody_tree_system.h"
 
 #include <memory>
+#include <set>
 #include <utility>
 #include <vector>
 
@@ -143,43 +144,69 @@ MultibodyTree<T>& MultibodyTreeSystem<T>::mutable_tree() const {
 
 template <typename T>
 void MultibodyTreeSystem<T>::DeclareMultibodyElementParameters() {
-  // Mobilizers.
-  for (MobilizerIndex mobilizer_index(0);
-       mobilizer_index < tree_->num_mobilizers(); ++mobilizer_index) {
-    mutable_tree()
-        .get_mutable_mobilizer(mobilizer_index)
-        .DeclareParameters(this);
-  }
-  // Joints.
-  for (JointIndex joint_index(0); joint_index < tree_->num_joints();
-       ++joint_index) {
-    mutable_tree().get_mutable_joint(joint_index).DeclareParameters(this);
-  }
-  // JointActuators.
-  for (JointActuatorIndex joint_actuator_index(0);
-       joint_actuator_index < tree_->num_actuators(); ++joint_actuator_index) {
-    mutable_tree()
-        .get_mutable_joint_actuator(joint_actuator_index)
-        .DeclareParameters(this);
-  }
-  // Bodies.
-  for (BodyIndex body_index(0); body_index < tree_->num_bodies();
-       ++body_index) {
-    mutable_tree().get_mutable_body(body_index).DeclareParameters(this);
-  }
-  // Frames.
-  for (FrameIndex frame_index(0); frame_index < tree_->num_frames();
-       ++frame_index) {
-    mutable_tree().get_mutable_frame(frame_index).DeclareParameters(this);
-  }
-  // Force Elements.
-  for (ForceElementIndex force_element_index(0);
-       force_element_index < tree_->num_force_elements();
-       ++force_element_index) {
-    mutable_tree()
-        .get_mutable_force_element(force_element_index)
-        .DeclareParameters(this);
-  }
+  // Calls declare() and returns the tickets of the parameters it declared.
+  auto declare_and_collect_tickets = [this](const auto& declare) {
+    const int first_numeric = this->num_numeric_parameter_groups();
+    const int first_abstract = this->num_abstract_parameters();
+    declare();
+    std::set<systems::DependencyTicket> tickets;
+    for (int i = first_numeric; i < this->num_numeric_parameter_groups(); ++i) {
+      tickets.insert(
+          this->numeric_parameter_ticket(systems::NumericParameterIndex(i)));
+    }
+    for (int i = first_abstract; i < this->num_abstract_parameters(); ++i) {
+      tickets.insert(
+          this->abstract_parameter_ticket(systems::AbstractParameterIndex(i)));
+    }
+    return tickets;
+  };
+
+  parameter_tickets_.joints = declare_and_collect_tickets([this]() {
+    // Mobilizers.
+    for (MobilizerIndex mobilizer_index(0);
+         mobilizer_index < tree_->num_mobilizers(); ++mobilizer_index) {
+      mutable_tree()
+          .get_mutable_mobilizer(mobilizer_index)
+          .DeclareParameters(this);
+    }
+    // Joints.
+    for (JointIndex joint_index(0); joint_index < tree_->num_joints();
+         ++joint_index) {
+      mutable_tree().get_mutable_joint(joint_index).DeclareParameters(this);
+    }
+    // JointActuators.
+    for (JointActuatorIndex joint_actuator_index(0);
+         joint_actuator_index < tree_->num_actuators();
+         ++joint_actuator_index) {
+      mutable_tree()
+          .get_mutable_joint_actuator(joint_actuator_index)
+          .DeclareParameters(this);
+    }
+  });
+  parameter_tickets_.mass_properties = declare_and_collect_tickets([this]() {
+    // Bodies.
+    for (BodyIndex body_index(0); body_index < tree_->num_bodies();
+         ++body_index) {
+      mutable_tree().get_mutable_body(body_index).DeclareParameters(this);
+    }
+  });
+  parameter_tickets_.frames = declare_and_collect_tickets([this]() {
+    // Frames.
+    for (FrameIndex frame_index(0); frame_index < tree_->num_frames();
+         ++frame_index) {
+      mutable_tree().get_mutable_frame(frame_index).DeclareParameters(this);
+    }
+  });
+  parameter_tickets_.force_elements = declare_and_collect_tickets([this]() {
+    // Force Elements.
+    for (ForceElementIndex force_element_index(0);
+         force_element_index < tree_->num_force_elements();
+         ++force_element_index) {
+      mutable_tree()
+          .get_mutable_force_element(force_element_index)
+          .DeclareParameters(this);
+    }
+  });
 }
 
 template <typename T>
@@ -205,43 +232,63 @@ void MultibodyTreeSystem<T>::Finalize() {
                                  0 /* num_z */);
   }
 
-  // TODO(joemasterjohn): Create more granular parameter tickets for finer
-  // control over cache dependencies on parameters. For example,
-  // all_rigid_body_parameters, etc.
+  // Kinematics depends on the configuration, but not on the mass properties of
+  // the bodies nor on the force elements. Therefore, instead of
+  // configuration_ticket() (which includes all of the parameters), we list the
+  // state and the parameters of the joints and frames. (In discrete mode, q
+  // and v are part of the discrete state.)
+  std::set<systems::DependencyTicket> position_kinematics_prerequisites{
+      this->q_ticket(), this->xd_ticket(), this->xa_ticket(),
+      this->accuracy_ticket()};
+  position_kinematics_prerequisites.insert(parameter_tickets_.joints.begin(),
+                                           parameter_tickets_.joints.end());
+  position_kinematics_prerequisites.insert(parameter_tickets_.frames.begin(),
+                                           parameter_tickets_.frames.end());
 
   // Allocate position cache.
   cache_indexes_.position_kinematics = this->DeclareCacheEntry(
       std::string("position kinematics"),
       PositionKinematicsCache<T>(internal_tree().get_topology()),
       &MultibodyTreeSystem<T>::CalcPositionKinematicsCache,
-      {this->configuration_ticket()}).cache_index();
+      position_kinematics_prerequisites).cache_index();
+
+  // Computations that depend on the configuration and on the mass properties
+  // of the bodies.
+  std::set<systems::DependencyTicket> mass_properties_prerequisites =
+      parameter_tickets_.mass_properties;
+  mass_properties_prerequisites.insert(
+      position_kinematics_cache_entry().ticket());
 
   // Allocate cache entry to store spatial inertia M_B_W(q) for each body.
   cache_indexes_.spatial_inertia_in_world = this->DeclareCacheEntry(
       std::string("spatial inertia in world (M_B_W)"),
       std::vector<SpatialInertia<T>>(internal_tree().num_bodies()),
       &MultibodyTreeSystem<T>::CalcSpatialInertiasInWorld,
-      {position_kinematics_cache_entry().ticket()}).cache_index();
+      mass_properties_prerequisites).cache_index();
 
+  // The reflected inertia only depends on the joint actuator parameters.
   cache_indexes_.reflected_inertia = this->DeclareCacheEntry(
       std::string("reflected inertia"),
       VectorX<T>(internal_tree().num_velocities()),
       &MultibodyTreeSystem<T>::CalcReflectedInertia,
-      {this->all_parameters_ticket()}).cache_index();
+      parameter_tickets_.joints.empty()
+          ? std::set<systems::DependencyTicket>{this->nothing_ticket()}
+          : parameter_tickets_.joints).cache_index();
 
   // Allocate cache entry for composite-body inertias Mc_B_W(q) for each body.
   cache_indexes_.composite_body_inertia_in_world = this->DeclareCacheEntry(
       std::string("composite body inertia in world (Mc_B_W)"),
       std::vector<SpatialInertia<T>>(internal_tree().num_bodies()),
       &MultibodyTreeSystem<T>::CalcCompositeBodyInertiasInWorld,
-      {position_kinematics_cache_entry().ticket()}).cache_index();
+      mass_properties_prerequisites).cache_index();
 
   // Allocate velocity cache.
   cache_indexes_.velocity_kinematics = this->DeclareCacheEntry(
       std::string("velocity kinematics"),
       VelocityKinematicsCache<T>(internal_tree().get_topology()),
       &MultibodyTreeSystem<T>::CalcVelocityKinematicsCache,
-      {this->kinematics_ticket()}).cache_index();
+      {position_kinematics_cache_entry().ticket(), this->v_ticket()})
+      .cache_index();
 
 
   // Allocate cache entry to store Fb_Bo_W(q, v) for each body.
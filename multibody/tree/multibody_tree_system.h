@@ -246,6 +246,32 @@ class MultibodyTreeSystem : public systems::LeafSystem<T> {
     return this->get_cache_entry(cache_indexes_.acceleration_kinematics);
   }
 
+  /* Returns the tickets of the parameters that store the mass properties
+  (mass, center of mass and unit inertia) of the rigid bodies. Kinematics
+  does not depend on them. */
+  const std::set<systems::DependencyTicket>& mass_properties_parameter_tickets()
+      const {
+    return parameter_tickets_.mass_properties;
+  }
+
+  /* Returns the tickets of the parameters of the mobilizers, joints and joint
+  actuators. */
+  const std::set<systems::DependencyTicket>& joint_parameter_tickets() const {
+    return parameter_tickets_.joints;
+  }
+
+  /* Returns the tickets of the parameters of the frames, e.g., the fixed
+  poses of FixedOffsetFrame. These determine where geometry is placed. */
+  const std::set<systems::DependencyTicket>& frame_parameter_tickets() const {
+    return parameter_tickets_.frames;
+  }
+
+  /* Returns the tickets of the parameters of the force elements. */
+  const std::set<systems::DependencyTicket>& force_element_parameter_tickets()
+      const {
+    return parameter_tickets_.force_elements;
+  }
+
   /* Returns the DiscreteStateIndex for the one and only multibody discrete
   state if the system is discrete and finalized. Throws otherwise. */
   systems::DiscreteStateIndex GetDiscreteStateIndexOrThrow() const {
@@ -485,7 +511,8 @@ class MultibodyTreeSystem : public systems::LeafSystem<T> {
   }
 
   // This method is called during Finalize(). It tells each MultibodyElement
-  // owned by `this` system to declare their system parameters on `this`.
+  // owned by `this` system to declare their system parameters on `this`, and
+  // records the tickets of those parameters in parameter_tickets_.
   void DeclareMultibodyElementParameters();
 
   // Allow different specializations to access each other's private data for
@@ -512,6 +539,18 @@ class MultibodyTreeSystem : public systems::LeafSystem<T> {
     systems::CacheIndex reflected_inertia;
   };
 
+  // The tickets of the parameters declared by the multibody elements, grouped
+  // by kind of element. Cache entries that depend on only some of these kinds
+  // list them instead of all_parameters_ticket() (or configuration_ticket(),
+  // which includes all of the parameters), so that, e.g., changing the mass of
+  // a body does not invalidate kinematics or contact geometry.
+  struct ParameterTickets {
+    std::set<systems::DependencyTicket> mass_properties;
+    std::set<systems::DependencyTicket> joints;
+    std::set<systems::DependencyTicket> frames;
+    std::set<systems::DependencyTicket> force_elements;
+  };
+
   // This is the one real constructor. From the public API, a null tree is
   // illegal and gets an error message. From the protected API, a null tree
   // means we allocate an empty one and leave it un-finalized. In either case,
@@ -529,6 +568,9 @@ class MultibodyTreeSystem : public systems::LeafSystem<T> {
   // All MultibodyTreeSystem cache indexes are stored in cache_indexes_.
   CacheIndexes cache_indexes_;
 
+  // Set by DeclareMultibodyElementParameters().
+  ParameterTickets parameter_tickets_;
+
   // Used to enforce "finalize once" restriction for protected-API users.
   bool already_finalized_{false};
 };
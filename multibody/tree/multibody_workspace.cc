@@ -0,0 +1,38 @@
+#include "drake/multibody/tree/multibody_workspace.h"
+
+#include <algorithm>
+
+#include "drake/multibody/tree/multibody_tree.h"
+
+namespace drake {
+namespace multibody {
+
+template <typename T>
+MultibodyWorkspace<T>::MultibodyWorkspace(
+    const internal::MultibodyTree<T>& model)
+    : A_WB_(model.num_bodies()),
+      F_BMo_W_(model.num_bodies()),
+      zero_vdot_(VectorX<T>::Zero(model.num_velocities())),
+      J_(6, std::max(model.num_positions(), model.num_velocities())),
+      num_positions_(model.num_positions()) {
+  DRAKE_DEMAND(model.topology_is_valid());
+}
+
+template <typename T>
+MultibodyWorkspace<T>::MultibodyWorkspace(
+    const internal::MultibodyTreeSystem<T>& plant)
+    : MultibodyWorkspace(internal::GetInternalTree(plant)) {}
+
+template <typename T>
+bool MultibodyWorkspace<T>::CheckHasRightSizeForModel(
+    const internal::MultibodyTree<T>& model) const {
+  return num_bodies() == model.num_bodies() &&
+         num_velocities() == model.num_velocities() &&
+         num_positions_ == model.num_positions();
+}
+
+}  // namespace multibody
+}  // namespace drake
+
+DRAKE_DEFINE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS(
+    class drake::multibody::MultibodyWorkspace)
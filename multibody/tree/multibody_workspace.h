@@ -0,0 +1,75 @@
+#pragma once
+
+#include <vector>
+
+#include "drake/common/default_scalars.h"
+#include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
+#include "drake/multibody/math/spatial_algebra.h"
+
+namespace drake {
+namespace multibody {
+
+namespace internal {
+template <typename T> class MultibodyTree;
+template <typename T> class MultibodyTreeSystem;
+}  // namespace internal
+
+/// Preallocated temporary storage for the MultibodyPlant computations that
+/// would otherwise allocate it on the heap on each call. It is meant for
+/// real-time code, e.g., a controller running at a fixed high rate, and is
+/// accepted by overloads of MultibodyPlant::CalcInverseDynamics(),
+/// MultibodyPlant::CalcBiasTerm(), and
+/// MultibodyPlant::CalcJacobianSpatialVelocity(). Together with the
+/// allocation-free MultibodyPlant::CalcMassMatrix(), these evaluate the
+/// dynamics of a model without heap allocations for `T = double`, once the
+/// Context's cache entries have been computed for the first time.
+///
+/// A workspace holds no results, and its contents are meaningless between
+/// calls. It can be reused across Contexts of the same plant, but it must
+/// not be used by more than one thread at a time; create one per thread.
+///
+/// @tparam_default_scalar
+template <typename T>
+class MultibodyWorkspace {
+ public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(MultibodyWorkspace)
+
+  /// Constructs a workspace for the given `plant`, which must have been
+  /// finalized with MultibodyPlant::Finalize() or this constructor will
+  /// abort.
+  explicit MultibodyWorkspace(const internal::MultibodyTreeSystem<T>& plant);
+
+  /// (Advanced) Tree overload.
+  explicit MultibodyWorkspace(const internal::MultibodyTree<T>& model);
+
+  /// Returns the number of bodies of the model `this` workspace is for.
+  int num_bodies() const { return static_cast<int>(A_WB_.size()); }
+
+  /// Returns the number of generalized velocities of the model `this`
+  /// workspace is for.
+  int num_velocities() const { return static_cast<int>(zero_vdot_.size()); }
+
+  /// Returns true iff `this` workspace has the right sizes for `model`.
+  bool CheckHasRightSizeForModel(const internal::MultibodyTree<T>& model) const;
+
+ private:
+  friend class internal::MultibodyTree<T>;
+
+  // Spatial accelerations and spatial forces per body, in BodyNodeIndex
+  // order, for inverse dynamics.
+  std::vector<SpatialAcceleration<T>> A_WB_;
+  std::vector<SpatialForce<T>> F_BMo_W_;
+  // Zero generalized accelerations, for the bias term. Never modified.
+  VectorX<T> zero_vdot_;
+  // A Jacobian with max(nq, nv) columns, of which the leading nq or nv are
+  // used.
+  Matrix6X<T> J_;
+  int num_positions_{};
+};
+
+}  // namespace multibody
+}  // namespace drake
+
+DRAKE_DECLARE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS(
+    class drake::multibody::MultibodyWorkspace)
@@ -112,7 +112,14 @@ const PlanarMobilizer<T>& PlanarMobilizer<T>::set_angular_rate(
 template <typename T>
 math::RigidTransform<T> PlanarMobilizer<T>::CalcAcrossMobilizerTransform(
     const systems::Context<T>& context) const {
-  const auto& q = this->get_positions(context);
+  return CalcAcrossMobilizerTransformGivenPositions(
+      this->get_positions(context));
+}
+
+template <typename T>
+math::RigidTransform<T>
+PlanarMobilizer<T>::CalcAcrossMobilizerTransformGivenPositions(
+    const Eigen::Ref<const VectorX<T>>& q) const {
   DRAKE_ASSERT(q.size() == kNq);
   Vector3<T> X_FM_translation;
   X_FM_translation << q[0], q[1], 0.0;
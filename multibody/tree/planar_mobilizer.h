@@ -129,6 +129,11 @@ class PlanarMobilizer final : public MobilizerImpl<T, 3, 3> {
   math::RigidTransform<T> CalcAcrossMobilizerTransform(
       const systems::Context<T>& context) const override;
 
+  // Computes the across-mobilizer transform `X_FM(q)` for the given vector
+  // `q` of generalized positions for `this` mobilizer.
+  math::RigidTransform<T> CalcAcrossMobilizerTransformGivenPositions(
+      const Eigen::Ref<const VectorX<T>>& q) const override;
+
   /* Computes the across-mobilizer velocity `V_FM(q, v)` of the outboard frame
    M measured and expressed in frame F as a function of the configuration q
    stored in `context` and of the input velocity v, formatted as described in
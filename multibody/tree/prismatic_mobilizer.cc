@@ -69,6 +69,14 @@ math::RigidTransform<T> PrismaticMobilizer<T>::CalcAcrossMobilizerTransform(
       get_translation(context) * translation_axis());
 }
 
+template <typename T>
+math::RigidTransform<T>
+PrismaticMobilizer<T>::CalcAcrossMobilizerTransformGivenPositions(
+    const Eigen::Ref<const VectorX<T>>& q) const {
+  DRAKE_ASSERT(q.size() == kNq);
+  return math::RigidTransform<T>(q[0] * translation_axis());
+}
+
 template <typename T>
 SpatialVelocity<T> PrismaticMobilizer<T>::CalcAcrossMobilizerSpatialVelocity(
     const systems::Context<T>&,
@@ -110,6 +110,11 @@ class PrismaticMobilizer final : public MobilizerImpl<T, 1, 1> {
   math::RigidTransform<T> CalcAcrossMobilizerTransform(
       const systems::Context<T>& context) const final;
 
+  // Computes the across-mobilizer transform `X_FM(q)` for the given vector
+  // `q` of generalized positions for `this` mobilizer.
+  math::RigidTransform<T> CalcAcrossMobilizerTransformGivenPositions(
+      const Eigen::Ref<const VectorX<T>>& q) const final;
+
   // Computes the across-mobilizer velocity `V_FM(q, v)` of the outboard frame
   // M measured and expressed in frame F as a function of the translation taken
   // from `context` and input translational velocity `v` along this mobilizer's
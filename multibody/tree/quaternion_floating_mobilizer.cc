@@ -225,7 +225,14 @@ template <typename T>
 math::RigidTransform<T>
 QuaternionFloatingMobilizer<T>::CalcAcrossMobilizerTransform(
     const systems::Context<T>& context) const {
-  const auto& q = this->get_positions(context);
+  return CalcAcrossMobilizerTransformGivenPositions(
+      this->get_positions(context));
+}
+
+template <typename T>
+math::RigidTransform<T>
+QuaternionFloatingMobilizer<T>::CalcAcrossMobilizerTransformGivenPositions(
+    const Eigen::Ref<const VectorX<T>>& q) const {
   DRAKE_ASSERT(q.size() == kNq);
 
   // The first 4 elements in q contain a quaternion, ordered as w, x, y, z.
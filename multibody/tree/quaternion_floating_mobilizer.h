@@ -201,6 +201,11 @@ class QuaternionFloatingMobilizer final : public MobilizerImpl<T, 7, 6> {
   math::RigidTransform<T> CalcAcrossMobilizerTransform(
       const systems::Context<T>& context) const override;
 
+  // Computes the across-mobilizer transform `X_FM(q)` for the given vector
+  // `q` of generalized positions for `this` mobilizer.
+  math::RigidTransform<T> CalcAcrossMobilizerTransformGivenPositions(
+      const Eigen::Ref<const VectorX<T>>& q) const override;
+
   SpatialVelocity<T> CalcAcrossMobilizerSpatialVelocity(
       const systems::Context<T>& context,
       const Eigen::Ref<const VectorX<T>>& v) const override;
@@ -64,7 +64,14 @@ const RevoluteMobilizer<T>& RevoluteMobilizer<T>::set_angular_rate(
 template <typename T>
 math::RigidTransform<T> RevoluteMobilizer<T>::CalcAcrossMobilizerTransform(
     const systems::Context<T>& context) const {
-  const auto& q = this->get_positions(context);
+  return CalcAcrossMobilizerTransformGivenPositions(
+      this->get_positions(context));
+}
+
+template <typename T>
+math::RigidTransform<T>
+RevoluteMobilizer<T>::CalcAcrossMobilizerTransformGivenPositions(
+    const Eigen::Ref<const VectorX<T>>& q) const {
   DRAKE_ASSERT(q.size() == 1);
   const Eigen::AngleAxis<T> angle_axis(q[0], axis_F_);
   const math::RigidTransform<T> X_FM(angle_axis, Vector3<T>::Zero());
@@ -110,7 +110,14 @@ const ScrewMobilizer<T>& ScrewMobilizer<T>::set_angular_rate(
 template <typename T>
 math::RigidTransform<T> ScrewMobilizer<T>::CalcAcrossMobilizerTransform(
     const systems::Context<T>& context) const {
-  const auto& q = this->get_positions(context);
+  return CalcAcrossMobilizerTransformGivenPositions(
+      this->get_positions(context));
+}
+
+template <typename T>
+math::RigidTransform<T>
+ScrewMobilizer<T>::CalcAcrossMobilizerTransformGivenPositions(
+    const Eigen::Ref<const VectorX<T>>& q) const {
   DRAKE_ASSERT(q.size() == kNq);
   const Vector3<T> p_FM(axis_ *
       get_screw_translation_from_rotation(q[0], screw_pitch_));
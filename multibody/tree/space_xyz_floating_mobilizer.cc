@@ -98,9 +98,17 @@ template <typename T>
 math::RigidTransform<T>
 SpaceXYZFloatingMobilizer<T>::CalcAcrossMobilizerTransform(
     const systems::Context<T>& context) const {
-  const auto rpy = this->get_angles(context);
-  const auto p_FM = this->get_translation(context);
-  const math::RollPitchYaw<T> roll_pitch_yaw(rpy(0), rpy(1), rpy(2));
+  return CalcAcrossMobilizerTransformGivenPositions(
+      this->get_positions(context));
+}
+
+template <typename T>
+math::RigidTransform<T>
+SpaceXYZFloatingMobilizer<T>::CalcAcrossMobilizerTransformGivenPositions(
+    const Eigen::Ref<const VectorX<T>>& q) const {
+  DRAKE_ASSERT(q.size() == kNq);
+  const Vector3<T> p_FM = q.template tail<3>();
+  const math::RollPitchYaw<T> roll_pitch_yaw(q(0), q(1), q(2));
   return math::RigidTransform<T>(roll_pitch_yaw, p_FM);
 }
 
@@ -204,6 +204,11 @@ class SpaceXYZFloatingMobilizer final : public MobilizerImpl<T, 6, 6> {
   math::RigidTransform<T> CalcAcrossMobilizerTransform(
       const systems::Context<T>& context) const override;
 
+  // Computes the across-mobilizer transform `X_FM(q)` for the given vector
+  // `q` of generalized positions for `this` mobilizer.
+  math::RigidTransform<T> CalcAcrossMobilizerTransformGivenPositions(
+      const Eigen::Ref<const VectorX<T>>& q) const override;
+
   // Computes the across-mobilizer velocity `V_FM(q, v)` of the outboard frame M
   // measured and expressed in frame F as a function of the configuration stored
   // in `context` and of the input generalized velocity v, packed as documented
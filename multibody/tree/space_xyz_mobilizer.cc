@@ -91,7 +91,14 @@ const SpaceXYZMobilizer<T>& SpaceXYZMobilizer<T>::set_angular_velocity(
 template <typename T>
 math::RigidTransform<T> SpaceXYZMobilizer<T>::CalcAcrossMobilizerTransform(
     const systems::Context<T>& context) const {
-  const Eigen::Matrix<T, 3, 1>& rpy = this->get_positions(context);
+  return CalcAcrossMobilizerTransformGivenPositions(
+      this->get_positions(context));
+}
+
+template <typename T>
+math::RigidTransform<T>
+SpaceXYZMobilizer<T>::CalcAcrossMobilizerTransformGivenPositions(
+    const Eigen::Ref<const VectorX<T>>& rpy) const {
   DRAKE_ASSERT(rpy.size() == kNq);
   const math::RollPitchYaw<T> roll_pitch_yaw(rpy(0), rpy(1), rpy(2));
   math::RigidTransform<T> X_FM(roll_pitch_yaw, Vector3<T>::Zero());
@@ -0,0 +1,104 @@
+#include "drake/multibody/tree/mass_matrix_factorization.h"
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
+
+namespace drake {
+namespace multibody {
+namespace {
+
+using Eigen::MatrixXd;
+using Eigen::VectorXd;
+
+// A tree of 7 velocities with two branches off of velocity 1, and a third
+// tree rooted at velocity 6:
+//   0 ← 1 ← 2 ← 3
+//         ← 4 ← 5
+//   6
+const std::vector<int> kParents{-1, 0, 1, 2, 1, 4, -1};
+
+// Returns a unit lower triangular L with the sparsity of kParents.
+MatrixXd MakeL() {
+  const int n = kParents.size();
+  MatrixXd L = MatrixXd::Identity(n, n);
+  for (int i = 0; i < n; ++i) {
+    for (int j = kParents[i]; j >= 0; j = kParents[j]) {
+      L(i, j) = 0.1 * (i + 1) - 0.3 * j;
+    }
+  }
+  return L;
+}
+
+GTEST_TEST(MassMatrixFactorizationTest, Factor) {
+  const MatrixXd L = MakeL();
+  const VectorXd D = VectorXd::LinSpaced(L.rows(), 1.0, 3.0);
+  const MatrixXd M = L.transpose() * D.asDiagonal() * L;
+  // The branches of the tree do not couple.
+  EXPECT_EQ(M(5, 3), 0.0);
+  EXPECT_EQ(M(6, 0), 0.0);
+
+  const MassMatrixFactorization<double> dut(M, kParents);
+  EXPECT_EQ(dut.size(), 7);
+  EXPECT_EQ(dut.parents(), kParents);
+  const double kTol = 1e-13;
+  EXPECT_TRUE(CompareMatrices(dut.CalcL(), L, kTol));
+  EXPECT_TRUE(CompareMatrices(dut.CalcD(), D, kTol));
+
+  const MatrixXd b = MatrixXd::Random(7, 3);
+  const MatrixXd x = dut.Solve(b);
+  EXPECT_TRUE(CompareMatrices(M * x, b, kTol));
+  EXPECT_TRUE(CompareMatrices(x, M.ldlt().solve(b), kTol));
+
+  VectorXd b_vector = b.col(1);
+  dut.SolveInPlace(&b_vector);
+  EXPECT_TRUE(CompareMatrices(b_vector, x.col(1), kTol));
+}
+
+// Entries of M outside of the sparsity pattern, and above the diagonal, are
+// not read.
+GTEST_TEST(MassMatrixFactorizationTest, LowerTriangleOnly) {
+  const MatrixXd L = MakeL();
+  const MatrixXd M = L.transpose() * L;
+  MatrixXd M_lower = M.triangularView<Eigen::Lower>();
+  M_lower(5, 3) = 100.0;
+  const MassMatrixFactorization<double> dut(M_lower, kParents);
+  EXPECT_TRUE(CompareMatrices(dut.CalcL(), L, 1e-13));
+}
+
+GTEST_TEST(MassMatrixFactorizationTest, AutoDiff) {
+  const MatrixXd M = MakeL().transpose() * MakeL();
+  const MassMatrixFactorization<AutoDiffXd> dut(M.cast<AutoDiffXd>(),
+                                                kParents);
+  const VectorX<AutoDiffXd> b = VectorX<AutoDiffXd>::Ones(7);
+  const VectorX<AutoDiffXd> x = dut.Solve(b);
+  const VectorXd expected = M.ldlt().solve(VectorXd::Ones(7));
+  for (int i = 0; i < 7; ++i) {
+    EXPECT_NEAR(x(i).value(), expected(i), 1e-13);
+  }
+}
+
+GTEST_TEST(MassMatrixFactorizationTest, Errors) {
+  const MatrixXd M = MakeL().transpose() * MakeL();
+  EXPECT_THROW(MassMatrixFactorization<double>(M, {-1, 0}), std::exception);
+  EXPECT_THROW(MassMatrixFactorization<double>(M.leftCols(6), kParents),
+               std::exception);
+  EXPECT_THROW(
+      MassMatrixFactorization<double>(M, {-1, 0, 1, 2, 1, 5, -1}),
+      std::exception);
+  MatrixXd M_singular = M;
+  M_singular.row(3).setZero();
+  M_singular.col(3).setZero();
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      MassMatrixFactorization<double>(M_singular, kParents),
+      ".*not positive definite.*velocity 3.*");
+
+  const MassMatrixFactorization<double> dut(M, kParents);
+  EXPECT_THROW(dut.Solve(VectorXd::Ones(6)), std::exception);
+  EXPECT_THROW(dut.SolveInPlace(nullptr), std::exception);
+}
+
+}  // namespace
+}  // namespace multibody
+}  // namespace drake
@@ -6,6 +6,7 @@
 
 #include <gtest/gtest.h>
 
+#include "drake/common/ssize.h"
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
 #include "drake/common/test_utilities/expect_no_throw.h"
 #include "drake/common/test_utilities/expect_throws_message.h"
@@ -20,6 +21,7 @@
 #include "drake/multibody/tree/multibody_tree-inl.h"
 #include "drake/multibody/tree/multibody_tree_system.h"
 #include "drake/multibody/tree/prismatic_joint.h"
+#include "drake/multibody/tree/quaternion_floating_joint.h"
 #include "drake/multibody/tree/revolute_joint.h"
 #include "drake/multibody/tree/weld_joint.h"
 #include "drake/systems/framework/context.h"
@@ -311,6 +313,32 @@ GTEST_TEST(MultibodyTree, RetrievingAmbiguousNames) {
       model->GetBodyByName(link_name),
       ".*Body.*appears in multiple model instances.*disambiguate.*");
   EXPECT_NO_THROW(model->GetBodyByName(link_name, default_model_instance()));
+
+  // Scoped lookups resolve to the body in the requested model instance,
+  // without allocating.
+  {
+    drake::test::LimitMalloc guard;
+    EXPECT_TRUE(model->HasBodyNamed(link_name, other_model_instance));
+    EXPECT_EQ(model->GetBodyByName(link_name, other_model_instance)
+                  .model_instance(),
+              other_model_instance);
+    EXPECT_EQ(model->GetBodyByName(link_name, default_model_instance())
+                  .model_instance(),
+              default_model_instance());
+  }
+
+  // Scoped lookups of names that only exist elsewhere still report so.
+  EXPECT_FALSE(model->HasBodyNamed("iiwa_link_1", other_model_instance));
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      model->GetBodyByName("iiwa_link_1", other_model_instance),
+      ".*There is no Body.*but one does exist in other model instances.*");
+
+  // The scoped lookup tables survive scalar conversion.
+  std::unique_ptr<MultibodyTree<AutoDiffXd>> model_autodiff =
+      model->ToAutoDiffXd();
+  EXPECT_EQ(model_autodiff->GetBodyByName(link_name, other_model_instance)
+                .index(),
+            model->GetBodyByName(link_name, other_model_instance).index());
 }
 
 // MBPlant provides most of the testing for MBTreeSystem. Here we just want
@@ -679,6 +707,49 @@ TEST_F(KukaIiwaModelTests, StateAccess) {
       Eigen::VectorXd::Constant(7, std::numeric_limits<double>::infinity())));
 }
 
+// Verifies that the batched pose computation produces the same poses as the
+// context-based computation, one configuration at a time.
+TEST_F(KukaIiwaModelTests, CalcAllBodyPosesInWorldBatch) {
+  const double kTolerance = 16 * std::numeric_limits<double>::epsilon();
+  const int kNumConfigurations = 5;
+  VectorX<double> q0, v0;
+  GetArbitraryNonZeroJointAnglesAndRates(&q0, &v0);
+  MatrixX<double> q_batch(tree().num_positions(), kNumConfigurations);
+  for (int k = 0; k < kNumConfigurations; ++k) {
+    q_batch.col(k) = (k + 1) * 0.3 * q0;
+  }
+
+  std::vector<std::vector<math::RigidTransformd>> X_WB_batch;
+  tree().CalcAllBodyPosesInWorldBatch(*context_, q_batch, &X_WB_batch);
+  ASSERT_EQ(ssize(X_WB_batch), tree().num_bodies());
+
+  std::vector<math::RigidTransformd> X_WB_expected;
+  for (int k = 0; k < kNumConfigurations; ++k) {
+    tree().GetMutablePositions(context_.get()) = q_batch.col(k);
+    tree().CalcAllBodyPosesInWorld(*context_, &X_WB_expected);
+    for (BodyIndex body_index(0); body_index < tree().num_bodies();
+         ++body_index) {
+      ASSERT_EQ(ssize(X_WB_batch[body_index]), kNumConfigurations);
+      EXPECT_TRUE(X_WB_batch[body_index][k].IsNearlyEqualTo(
+          X_WB_expected[body_index], kTolerance));
+    }
+  }
+
+  // An empty batch is valid and produces empty per-body results.
+  tree().CalcAllBodyPosesInWorldBatch(
+      *context_, MatrixX<double>(tree().num_positions(), 0), &X_WB_batch);
+  ASSERT_EQ(ssize(X_WB_batch), tree().num_bodies());
+  EXPECT_TRUE(X_WB_batch[end_effector_link_->index()].empty());
+
+  // Mismatched number of rows.
+  EXPECT_THROW(tree().CalcAllBodyPosesInWorldBatch(
+                   *context_, MatrixX<double>(3, 2), &X_WB_batch),
+               std::exception);
+  EXPECT_THROW(
+      tree().CalcAllBodyPosesInWorldBatch(*context_, q_batch, nullptr),
+      std::exception);
+}
+
 // This test helps verify MultibodyTree::CalcJacobianTranslationalVelocity()
 // with two methods to calculate Jv_WEo_W, which is Eo's (end effector origin's)
 // translational velocity Jacobian with respect to v (generalized velocities)
@@ -1586,6 +1657,109 @@ TEST_F(WeldMobilizerTest, PositionKinematics) {
   EXPECT_TRUE(body_poses[body2_->index()].IsNearlyEqualTo(X_WB2_, kTolerance));
 }
 
+// Verifies that CalcTreeJacobianTranslationalVelocityInWorld() computes the
+// columns of a tree in the full Jacobian from
+// CalcJacobianTranslationalVelocity(), for points on frames of every body of a
+// model with several trees.
+GTEST_TEST(MultibodyTree, CalcTreeJacobianTranslationalVelocityInWorld) {
+  const SpatialInertia<double> M_B = SpatialInertia<double>::MakeUnitary();
+  auto model = std::make_unique<MultibodyTree<double>>();
+  const Body<double>& world = model->world_body();
+
+  // A chain with a weld in the middle, so that one node on the path to the
+  // world has no velocities.
+  const auto& A1 = model->AddBody<RigidBody>("A1", M_B);
+  const auto& A2 = model->AddBody<RigidBody>("A2", M_B);
+  const auto& A3 = model->AddBody<RigidBody>("A3", M_B);
+  const auto& A4 = model->AddBody<RigidBody>("A4", M_B);
+  const auto& joint_A1 = model->AddJoint<RevoluteJoint>(
+      "A1", world, RigidTransform<double>(Vector3d(0.1, 0.2, 0.3)), A1,
+      std::nullopt, Vector3d::UnitZ());
+  const auto& joint_A2 = model->AddJoint<PrismaticJoint>(
+      "A2", A1, RigidTransform<double>(Vector3d(0.5, 0, 0)), A2, std::nullopt,
+      Vector3d(1, 1, 0).normalized());
+  model->AddJoint<WeldJoint>(
+      "A3", A2, RigidTransform<double>(Vector3d(0, 0.4, 0)), A3, std::nullopt,
+      RigidTransform<double>(RollPitchYaw<double>(0.3, -0.2, 0.1),
+                             Vector3d(0, 0, 0.2)));
+  const auto& joint_A4 = model->AddJoint<RevoluteJoint>(
+      "A4", A3, RigidTransform<double>(Vector3d(0, 0, 0.3)), A4,
+      RigidTransform<double>(Vector3d(-0.1, 0, 0)), Vector3d::UnitY());
+
+  // A floating base with a child.
+  const auto& B1 = model->AddBody<RigidBody>("B1", M_B);
+  const auto& B2 = model->AddBody<RigidBody>("B2", M_B);
+  const auto& joint_B1 = model->AddJoint<QuaternionFloatingJoint>(
+      "B1", world, std::nullopt, B1, std::nullopt);
+  const auto& joint_B2 = model->AddJoint<RevoluteJoint>(
+      "B2", B1, RigidTransform<double>(Vector3d(0, 0, -0.5)), B2,
+      std::nullopt, Vector3d::UnitX());
+
+  // A body welded to the world has no tree velocities; it is skipped below.
+  const auto& C = model->AddBody<RigidBody>("C", M_B);
+  model->AddJoint<WeldJoint>("C", world, std::nullopt, C, std::nullopt,
+                             RigidTransform<double>(Vector3d(1, 0, 0)));
+
+  // Frames other than the body frames, at non-identity offsets.
+  const RigidTransform<double> X_BF(RollPitchYaw<double>(0.4, 0.5, -0.6),
+                                    Vector3d(0.05, -0.1, 0.2));
+  std::vector<const Frame<double>*> frames;
+  for (const RigidBody<double>* body : {&A1, &A2, &A3, &A4, &B1, &B2}) {
+    frames.push_back(&body->body_frame());
+    frames.push_back(
+        &model->AddFrame<FixedOffsetFrame>(body->name() + "_F", *body, X_BF));
+  }
+
+  MultibodyTreeSystem<double> system(std::move(model));
+  const MultibodyTree<double>& tree = GetInternalTree(system);
+  const MultibodyTreeTopology& topology = tree.get_topology();
+  ASSERT_EQ(topology.num_trees(), 2);
+  auto context = system.CreateDefaultContext();
+
+  const double kTolerance = 16 * std::numeric_limits<double>::epsilon();
+  auto check_all_frames = [&]() {
+    const Vector3d p_FoFp_F(0.3, -0.2, 0.1);
+    for (const Frame<double>* frame_F : frames) {
+      SCOPED_TRACE(frame_F->name());
+      const Frame<double>& frame_W = tree.world_frame();
+      MatrixXd Jv_WFp_W(3, tree.num_velocities());
+      tree.CalcJacobianTranslationalVelocity(
+          *context, JacobianWrtVariable::kV, *frame_F, *frame_F, p_FoFp_F,
+          frame_W, frame_W, &Jv_WFp_W);
+      Vector3d p_WFp;
+      tree.CalcPointsPositions(*context, *frame_F, p_FoFp_F, frame_W, &p_WFp);
+
+      const BodyIndex body_index = frame_F->body().index();
+      const TreeIndex tree_index = topology.body_to_tree_index(body_index);
+      const int start = topology.tree_velocities_start_in_v(tree_index);
+      const int num_tree_velocities = topology.num_tree_velocities(tree_index);
+      Matrix3X<double> Jv_WFp_W_tree(3, num_tree_velocities);
+      tree.CalcTreeJacobianTranslationalVelocityInWorld(
+          *context, body_index, p_WFp, &Jv_WFp_W_tree);
+      EXPECT_TRUE(CompareMatrices(
+          Jv_WFp_W_tree, Jv_WFp_W.middleCols(start, num_tree_velocities),
+          kTolerance, MatrixCompareType::absolute));
+
+      // The full Jacobian is zero outside of the tree's columns.
+      MatrixXd others = Jv_WFp_W;
+      others.middleCols(start, num_tree_velocities).setZero();
+      EXPECT_TRUE(others.isZero(0.0));
+    }
+  };
+
+  // The default configuration, then an arbitrary one.
+  check_all_frames();
+  joint_A1.set_angle(context.get(), 0.7);
+  joint_A2.set_translation(context.get(), -0.3);
+  joint_A4.set_angle(context.get(), -1.2);
+  joint_B1.set_quaternion(
+      context.get(), Eigen::Quaterniond(AngleAxisd(
+                         0.9, Vector3d(1, -2, 0.5).normalized())));
+  joint_B1.set_position(context.get(), Vector3d(-0.4, 1.1, 2.0));
+  joint_B2.set_angle(context.get(), 2.1);
+  check_all_frames();
+}
+
 }  // namespace
 }  // namespace multibody_model
 }  // namespace internal
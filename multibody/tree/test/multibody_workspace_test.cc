@@ -0,0 +1,206 @@
+#include "drake/multibody/tree/multibody_workspace.h"
+
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/common/test_utilities/limit_malloc.h"
+#include "drake/math/rigid_transform.h"
+#include "drake/math/roll_pitch_yaw.h"
+#include "drake/multibody/tree/multibody_tree-inl.h"
+#include "drake/multibody/tree/multibody_tree_system.h"
+#include "drake/multibody/tree/revolute_joint.h"
+#include "drake/multibody/tree/rigid_body.h"
+#include "drake/multibody/tree/spatial_inertia.h"
+#include "drake/systems/framework/context.h"
+
+namespace drake {
+namespace multibody {
+namespace internal {
+namespace {
+
+using drake::test::LimitMalloc;
+using Eigen::MatrixXd;
+using Eigen::Vector3d;
+using Eigen::VectorXd;
+using math::RigidTransformd;
+using math::RollPitchYawd;
+using systems::Context;
+
+// A free floating base with a chain of three links, so that both the
+// quaternion and the revolute mobilizers are exercised.
+class MultibodyWorkspaceTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    auto tree_owned = std::make_unique<MultibodyTree<double>>();
+    tree_ = tree_owned.get();
+    const SpatialInertia<double> M_BBo_B =
+        SpatialInertia<double>::SolidBoxWithMass(1.0, 0.1, 0.2, 0.3);
+    base_ = &tree_->AddBody<RigidBody>("base", M_BBo_B);
+    const Body<double>* parent = base_;
+    for (int i = 0; i < 3; ++i) {
+      const std::string suffix = std::to_string(i);
+      const RigidBody<double>& link =
+          tree_->AddBody<RigidBody>("link" + suffix, M_BBo_B);
+      joints_[i] = &tree_->AddJoint<RevoluteJoint>(
+          "joint" + suffix, *parent, RigidTransformd(Vector3d(0, 0, 0.1)),
+          link, {}, Vector3d(0, 1, 1).normalized());
+      parent = &link;
+    }
+    tip_ = parent;
+    system_ = std::make_unique<MultibodyTreeSystem<double>>(
+        std::move(tree_owned));
+    context_ = system_->CreateDefaultContext();
+    SetState(0);
+  }
+
+  // Sets an arbitrary state, which differs for each `tick`.
+  void SetState(int tick) {
+    const double s = 0.1 * (tick + 1);
+    tree_->SetFreeBodyPoseOrThrow(
+        *base_,
+        RigidTransformd(RollPitchYawd(s, -2 * s, 0.5), Vector3d(s, 0, 1)),
+        context_.get());
+    for (int i = 0; i < 3; ++i) {
+      joints_[i]->set_angle(context_.get(), s * (i + 1));
+    }
+    tree_->GetMutableVelocities(context_.get()) =
+        VectorXd::LinSpaced(tree_->num_velocities(), -s, 2 * s);
+  }
+
+  MultibodyTree<double>* tree_{};
+  const RigidBody<double>* base_{};
+  const RevoluteJoint<double>* joints_[3]{};
+  const Body<double>* tip_{};
+  std::unique_ptr<MultibodyTreeSystem<double>> system_;
+  std::unique_ptr<Context<double>> context_;
+};
+
+// The overloads that take a workspace compute the same results as the others.
+TEST_F(MultibodyWorkspaceTest, SameResults) {
+  MultibodyWorkspace<double> workspace(*system_);
+  EXPECT_EQ(workspace.num_bodies(), 5);
+  EXPECT_EQ(workspace.num_velocities(), 9);
+  EXPECT_TRUE(workspace.CheckHasRightSizeForModel(*tree_));
+
+  const int nv = tree_->num_velocities();
+  const VectorXd vdot = VectorXd::LinSpaced(nv, 1.0, -2.0);
+  MultibodyForces<double> forces(*tree_);
+  forces.mutable_generalized_forces().setConstant(0.5);
+  tree_->get_body(BodyIndex(2)).AddInForce(
+      *context_, Vector3d(0.1, 0, 0), SpatialForce<double>(
+          Vector3d(1, 2, 3), Vector3d(-1, 0, 1)),
+      tree_->world_frame(), &forces);
+
+  VectorXd tau(nv);
+  tree_->CalcInverseDynamics(*context_, vdot, forces, &workspace, &tau);
+  EXPECT_EQ(tau, tree_->CalcInverseDynamics(*context_, vdot, forces));
+
+  VectorXd Cv(nv);
+  VectorXd Cv_expected(nv);
+  tree_->CalcBiasTerm(*context_, &workspace, &Cv);
+  tree_->CalcBiasTerm(*context_, &Cv_expected);
+  EXPECT_EQ(Cv, Cv_expected);
+
+  const Frame<double>& frame_B = tip_->body_frame();
+  const Vector3d p_BP(0.1, -0.2, 0.3);
+  for (const JacobianWrtVariable wrt :
+       {JacobianWrtVariable::kV, JacobianWrtVariable::kQDot}) {
+    const int num_columns = (wrt == JacobianWrtVariable::kV)
+                                ? nv
+                                : tree_->num_positions();
+    for (const Frame<double>* frame_A :
+         {&tree_->world_frame(), &base_->body_frame()}) {
+      for (const Frame<double>* frame_E :
+           {&tree_->world_frame(), &joints_[0]->child_body().body_frame()}) {
+        MatrixXd J(6, num_columns);
+        MatrixXd J_expected(6, num_columns);
+        tree_->CalcJacobianSpatialVelocity(*context_, wrt, frame_B, p_BP,
+                                           *frame_A, *frame_E, &workspace,
+                                           &J);
+        tree_->CalcJacobianSpatialVelocity(*context_, wrt, frame_B, p_BP,
+                                           *frame_A, *frame_E, &J_expected);
+        EXPECT_TRUE(CompareMatrices(J, J_expected, 0));
+      }
+    }
+  }
+
+  // Check the spatial velocity of point P against the Jacobian.
+  MatrixXd J(6, nv);
+  tree_->CalcJacobianSpatialVelocity(
+      *context_, JacobianWrtVariable::kV, frame_B, p_BP, tree_->world_frame(),
+      tree_->world_frame(), &workspace, &J);
+  const SpatialVelocity<double> V_WP =
+      tree_->EvalBodySpatialVelocityInWorld(*context_, *tip_).Shift(
+          tree_->EvalBodyPoseInWorld(*context_, *tip_).rotation() * p_BP);
+  EXPECT_TRUE(CompareMatrices(J * tree_->get_velocities(*context_),
+                              V_WP.get_coeffs(), 1e-14));
+}
+
+// After the first evaluation, nothing allocates, even when the state changes
+// and the cache entries must be recomputed.
+TEST_F(MultibodyWorkspaceTest, NoAllocations) {
+  MultibodyWorkspace<double> workspace(*system_);
+  const int nv = tree_->num_velocities();
+  const int nq = tree_->num_positions();
+  const VectorXd vdot = VectorXd::LinSpaced(nv, 1.0, -2.0);
+  const MultibodyForces<double> forces(*tree_);
+  const Frame<double>& frame_B = tip_->body_frame();
+  const Frame<double>& frame_A = base_->body_frame();
+  const Frame<double>& frame_E = joints_[1]->child_body().body_frame();
+  const Vector3d p_BP(0.1, -0.2, 0.3);
+  MatrixXd M(nv, nv);
+  VectorXd Cv(nv);
+  VectorXd tau(nv);
+  MatrixXd Jv(6, nv);
+  MatrixXd Jq(6, nq);
+
+  auto evaluate = [&]() {
+    tree_->CalcMassMatrix(*context_, &M);
+    tree_->CalcBiasTerm(*context_, &workspace, &Cv);
+    tree_->CalcInverseDynamics(*context_, vdot, forces, &workspace, &tau);
+    tree_->CalcJacobianSpatialVelocity(*context_, JacobianWrtVariable::kV,
+                                       frame_B, p_BP, frame_A, frame_E,
+                                       &workspace, &Jv);
+    tree_->CalcJacobianSpatialVelocity(*context_, JacobianWrtVariable::kQDot,
+                                       frame_B, p_BP, frame_A, frame_E,
+                                       &workspace, &Jq);
+  };
+
+  evaluate();
+  for (int tick = 1; tick < 4; ++tick) {
+    SetState(tick);
+    LimitMalloc guard;
+    evaluate();
+  }
+}
+
+TEST_F(MultibodyWorkspaceTest, Errors) {
+  MultibodyTree<double> other;
+  other.AddBody<RigidBody>("body", SpatialInertia<double>::MakeUnitary());
+  other.Finalize();
+  MultibodyWorkspace<double> wrong(other);
+  EXPECT_EQ(wrong.num_bodies(), 2);
+  EXPECT_EQ(wrong.num_velocities(), 6);
+  EXPECT_FALSE(wrong.CheckHasRightSizeForModel(*tree_));
+
+  const int nv = tree_->num_velocities();
+  VectorXd Cv(nv);
+  EXPECT_THROW(tree_->CalcBiasTerm(*context_, &wrong, &Cv), std::exception);
+  EXPECT_THROW(tree_->CalcBiasTerm(*context_, nullptr, &Cv), std::exception);
+  MultibodyWorkspace<double> workspace(*tree_);
+  VectorXd too_short(nv - 1);
+  EXPECT_THROW(tree_->CalcBiasTerm(*context_, &workspace, &too_short),
+               std::exception);
+  EXPECT_THROW(
+      tree_->CalcInverseDynamics(*context_, VectorXd::Zero(nv),
+                                 MultibodyForces<double>(*tree_), &wrong, &Cv),
+      std::exception);
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace multibody
+}  // namespace drake
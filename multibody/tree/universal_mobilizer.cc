@@ -77,7 +77,14 @@ const UniversalMobilizer<T>& UniversalMobilizer<T>::set_angular_rates(
 template <typename T>
 math::RigidTransform<T> UniversalMobilizer<T>::CalcAcrossMobilizerTransform(
     const systems::Context<T>& context) const {
-  const auto& q = this->get_positions(context);
+  return CalcAcrossMobilizerTransformGivenPositions(
+      this->get_positions(context));
+}
+
+template <typename T>
+math::RigidTransform<T>
+UniversalMobilizer<T>::CalcAcrossMobilizerTransformGivenPositions(
+    const Eigen::Ref<const VectorX<T>>& q) const {
   DRAKE_ASSERT(q.size() == kNq);
   const T s1 = sin(q[0]);
   const T c1 = cos(q[0]);
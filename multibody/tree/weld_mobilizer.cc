@@ -12,6 +12,14 @@ template <typename T>
 math::RigidTransform<T> WeldMobilizer<T>::CalcAcrossMobilizerTransform(
     const systems::Context<T>&) const { return X_FM_.cast<T>(); }
 
+template <typename T>
+math::RigidTransform<T>
+WeldMobilizer<T>::CalcAcrossMobilizerTransformGivenPositions(
+    const Eigen::Ref<const VectorX<T>>& q) const {
+  DRAKE_ASSERT(q.size() == kNq);
+  return X_FM_.cast<T>();
+}
+
 template <typename T>
 SpatialVelocity<T> WeldMobilizer<T>::CalcAcrossMobilizerSpatialVelocity(
     const systems::Context<T>&,
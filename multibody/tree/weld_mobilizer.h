@@ -42,6 +42,11 @@ class WeldMobilizer final : public MobilizerImpl<T, 0, 0> {
   math::RigidTransform<T> CalcAcrossMobilizerTransform(
       const systems::Context<T>& context) const final;
 
+  // Computes the across-mobilizer transform `X_FM(q)` for the given vector
+  // `q` of generalized positions for `this` mobilizer.
+  math::RigidTransform<T> CalcAcrossMobilizerTransformGivenPositions(
+      const Eigen::Ref<const VectorX<T>>& q) const final;
+
   // Computes the across-mobilizer velocity `V_FM` which for this mobilizer is
   // always zero since the outboard frame M is fixed to the inboard frame F.
   SpatialVelocity<T> CalcAcrossMobilizerSpatialVelocity(
@@ -2,9 +2,11 @@
 
 #include <limits>
 #include <optional>
+#include <vector>
 
 #include "drake/common/drake_throw.h"
 #include "drake/common/never_destroyed.h"
+#include "drake/common/parallel_for.h"
 
 using Eigen::Matrix3Xf;
 using Eigen::Vector3f;
@@ -51,7 +53,7 @@ void DoConvert(const std::optional<pc_flags::BaseFieldT>& exact_base_fields,
                const RigidTransformd* const camera_pose,
                const Image<pixel_type>& depth_image,
                const ImageRgba8U* color_image, const float scale,
-               PointCloud* output) {
+               Parallelism parallelism, PointCloud* output) {
   if (exact_base_fields) {
     DRAKE_THROW_UNLESS(output->fields().base_fields() == *exact_base_fields);
   }
@@ -62,11 +64,12 @@ void DoConvert(const std::optional<pc_flags::BaseFieldT>& exact_base_fields,
     const bool skip_initialize = (output->fields().base_fields() == kXYZs);
     output->resize(depth_image.size(), skip_initialize);
   }
-  Eigen::Ref<Matrix3Xf> output_xyz = output->mutable_xyzs();
-  std::optional<Eigen::Ref<Matrix3X<uint8_t>>> output_rgb;
-  if (color_image) {
-    output_rgb = output->mutable_rgbs();
+  if (depth_image.size() == 0) {
+    return;
   }
+  float* const output_xyz = output->mutable_xyzs().data();
+  uint8_t* const output_rgb =
+      color_image ? output->mutable_rgbs().data() : nullptr;
 
   const int height = depth_image.height();
   const int width = depth_image.width();
@@ -76,38 +79,69 @@ void DoConvert(const std::optional<pc_flags::BaseFieldT>& exact_base_fields,
   const float fy_inv = 1.f / camera_info.focal_y();
   const math::RigidTransform<float> X_PC = (camera_pose != nullptr) ?
       camera_pose->cast<float>() : math::RigidTransform<float>::Identity();
+  const Eigen::Matrix3f& R_PC = X_PC.rotation().matrix();
+  const Vector3f& p_PC = X_PC.translation();
+  const bool is_identity = (camera_pose == nullptr);
+
+  // The point of pixel (u, v) at depth z is z * (xs[u], ys[v], 1) in the
+  // camera frame, so the per-column factor is computed once for all rows.
+  std::vector<float> xs(width);
+  for (int u = 0; u < width; ++u) {
+    xs[u] = (u - cx) * fx_inv;
+  }
 
-  for (int v = 0; v < height; ++v) {
-    for (int u = 0; u < width; ++u) {
-      const int col = v * width + u;
-      const auto z = depth_image.at(u, v)[0];
+  // Converts one row of pixels. The points are organized: the point of pixel
+  // (u, v) is at index v * width + u, whether or not its depth is valid.
+  auto convert_row = [&](int v) {
+    const float ys = (v - cy) * fy_inv;
+    // The direction R_PC * (xs[u], ys, 1) is dir_v + xs[u] * R_PC.col(0).
+    const Vector3f dir_v = ys * R_PC.col(1) + R_PC.col(2);
+    const auto* depth_row = depth_image.at(0, v);
+    float* xyz = output_xyz + 3 * v * width;
+    for (int u = 0; u < width; ++u, xyz += 3) {
+      const auto z = depth_row[u];
       if ((z == ImageTraits<pixel_type>::kTooClose) ||
           (z == ImageTraits<pixel_type>::kTooFar)) {
-        output_xyz.col(col).array() = std::numeric_limits<float>::infinity();
+        xyz[0] = xyz[1] = xyz[2] = std::numeric_limits<float>::infinity();
+        continue;
+      }
+      // N.B. This clause handles both true depths *and* NaNs.
+      const float depth = scale * z;
+      if (is_identity) {
+        xyz[0] = depth * xs[u];
+        xyz[1] = depth * ys;
+        xyz[2] = depth;
       } else {
-        // N.B. This clause handles both true depths *and* NaNs.
-        output_xyz.col(col) =
-            X_PC * Vector3f(scale * z * (u - cx) * fx_inv,
-                            scale * z * (v - cy) * fy_inv,
-                            scale * z);
+        for (int i = 0; i < 3; ++i) {
+          xyz[i] = depth * (dir_v[i] + xs[u] * R_PC(i, 0)) + p_PC[i];
+        }
       }
-      if (color_image) {
-        const auto color = color_image->at(u, v);
-        output_rgb->col(col) = Vector3<uint8_t>(color[0], color[1], color[2]);
+    }
+    if (output_rgb != nullptr) {
+      const uint8_t* color = color_image->at(0, v);
+      uint8_t* rgb = output_rgb + 3 * v * width;
+      for (int u = 0; u < width; ++u, rgb += 3, color += 4) {
+        rgb[0] = color[0];
+        rgb[1] = color[1];
+        rgb[2] = color[2];
       }
     }
-  }
+  };
+
+  // Rows are independent. Parallelizing only pays off for large images.
+  drake::internal::ParallelFor(parallelism, height, convert_row);
 }
 
 }  // namespace
 
 DepthImageToPointCloud::DepthImageToPointCloud(
     const CameraInfo& camera_info, PixelType depth_pixel_type, float scale,
-    const pc_flags::BaseFieldT fields)
+    const pc_flags::BaseFieldT fields, Parallelism parallelism)
     : camera_info_(camera_info),
       depth_pixel_type_(depth_pixel_type),
       scale_(scale),
-      fields_(fields) {
+      fields_(fields),
+      parallelism_(parallelism) {
   // Input port for depth image.
   depth_image_input_port_ =
       this->DeclareAbstractInputPort("depth_image",
@@ -137,10 +171,11 @@ void DepthImageToPointCloud::Convert(
     const std::optional<math::RigidTransformd>& camera_pose,
     const systems::sensors::ImageDepth32F& depth_image,
     const std::optional<systems::sensors::ImageRgba8U>& color_image,
-    const std::optional<float>& scale, PointCloud* output) {
+    const std::optional<float>& scale, PointCloud* output,
+    Parallelism parallelism) {
   DoConvert(std::nullopt, camera_info, camera_pose ? &*camera_pose : nullptr,
             depth_image, color_image ? &*color_image : nullptr,
-            scale.value_or(1.0f), output);
+            scale.value_or(1.0f), parallelism, output);
 }
 
 void DepthImageToPointCloud::Convert(
@@ -148,10 +183,11 @@ void DepthImageToPointCloud::Convert(
     const std::optional<math::RigidTransformd>& camera_pose,
     const systems::sensors::ImageDepth16U& depth_image,
     const std::optional<systems::sensors::ImageRgba8U>& color_image,
-    const std::optional<float>& scale, PointCloud* output) {
+    const std::optional<float>& scale, PointCloud* output,
+    Parallelism parallelism) {
   DoConvert(std::nullopt, camera_info, camera_pose ? &*camera_pose : nullptr,
             depth_image, color_image ? &*color_image : nullptr,
-            scale.value_or(1.0f), output);
+            scale.value_or(1.0f), parallelism, output);
 }
 
 void DepthImageToPointCloud::CalcOutput32F(
@@ -164,7 +200,7 @@ void DepthImageToPointCloud::CalcOutput32F(
       this->EvalInputValue<RigidTransformd>(context, camera_pose_input_port_);
   DRAKE_THROW_UNLESS(depth_image != nullptr);
   DoConvert(fields_, camera_info_, pose_or_null, *depth_image,
-            color_image_or_null, scale_, output);
+            color_image_or_null, scale_, parallelism_, output);
 }
 
 void DepthImageToPointCloud::CalcOutput16U(
@@ -177,7 +213,7 @@ void DepthImageToPointCloud::CalcOutput16U(
       this->EvalInputValue<RigidTransformd>(context, camera_pose_input_port_);
   DRAKE_THROW_UNLESS(depth_image != nullptr);
   DoConvert(fields_, camera_info_, pose_or_null, *depth_image,
-            color_image_or_null, scale_, output);
+            color_image_or_null, scale_, parallelism_, output);
 }
 
 }  // namespace perception
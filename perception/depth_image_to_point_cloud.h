@@ -6,6 +6,7 @@
 #include <vector>
 
 #include "drake/common/drake_copyable.h"
+#include "drake/common/parallelism.h"
 #include "drake/math/rigid_transform.h"
 #include "drake/perception/point_cloud.h"
 #include "drake/systems/framework/context.h"
@@ -44,6 +45,15 @@ namespace perception {
 /// will be (+Inf, +Inf, +Inf). Note that this matches the convention used by
 /// the Point Cloud Library (PCL).
 ///
+/// The point cloud is organized: it has one point for every pixel, in
+/// row-major order, i.e., the point of pixel (u, v) has index
+/// `v * width + u`, even when the pixel's depth is invalid. Downstream
+/// processing can use this to recover the image structure of the cloud.
+///
+/// Converting a large image can be parallelized over the rows of the image;
+/// see the `parallelism` arguments below. The output cloud's memory is reused
+/// when it already has the size of the image.
+///
 /// @ingroup perception_systems
 class DepthImageToPointCloud final : public systems::LeafSystem<double> {
  public:
@@ -58,11 +68,14 @@ class DepthImageToPointCloud final : public systems::LeafSystem<double> {
   ///   before projecting to a point cloud.  (This is useful for converting mm
   ///   to meters, etc.)
   /// @param[in] fields The fields the point cloud contains.
+  /// @param[in] parallelism The maximum parallelism to use when converting
+  ///   an image.
   explicit DepthImageToPointCloud(
       const systems::sensors::CameraInfo& camera_info,
       systems::sensors::PixelType depth_pixel_type =
           systems::sensors::PixelType::kDepth32F,
-      float scale = 1.0, pc_flags::BaseFieldT fields = pc_flags::kXYZs);
+      float scale = 1.0, pc_flags::BaseFieldT fields = pc_flags::kXYZs,
+      Parallelism parallelism = Parallelism::None());
 
   /// Returns the abstract valued input port that expects either an
   /// ImageDepth16U or ImageDepth32F (depending on the constructor argument).
@@ -96,12 +109,14 @@ class DepthImageToPointCloud final : public systems::LeafSystem<double> {
   /// @param[in,out] cloud Destination for point data; must not be nullptr.
   /// The `cloud` will be resized to match the size of the depth image.  The
   /// `cloud` must have the XYZ channel enabled.
+  /// @param[in] parallelism The maximum parallelism to use.
   static void Convert(
       const systems::sensors::CameraInfo& camera_info,
       const std::optional<math::RigidTransformd>& camera_pose,
       const systems::sensors::ImageDepth32F& depth_image,
       const std::optional<systems::sensors::ImageRgba8U>& color_image,
-      const std::optional<float>& scale, PointCloud* cloud);
+      const std::optional<float>& scale, PointCloud* cloud,
+      Parallelism parallelism = Parallelism::None());
 
   /// Converts a depth image to a point cloud using direct arguments instead of
   /// System input and output ports.  The semantics are the same as documented
@@ -110,12 +125,14 @@ class DepthImageToPointCloud final : public systems::LeafSystem<double> {
   /// @param[in,out] cloud Destination for point data; must not be nullptr.
   /// The `cloud` will be resized to match the size of the depth image.  The
   /// `cloud` must have the XYZ channel enabled.
+  /// @param[in] parallelism The maximum parallelism to use.
   static void Convert(
       const systems::sensors::CameraInfo& camera_info,
       const std::optional<math::RigidTransformd>& camera_pose,
       const systems::sensors::ImageDepth16U& depth_image,
       const std::optional<systems::sensors::ImageRgba8U>& color_image,
-      const std::optional<float>& scale, PointCloud* cloud);
+      const std::optional<float>& scale, PointCloud* cloud,
+      Parallelism parallelism = Parallelism::None());
 
  private:
   void CalcOutput16U(const systems::Context<double>&, PointCloud*) const;
@@ -125,6 +142,7 @@ class DepthImageToPointCloud final : public systems::LeafSystem<double> {
   const systems::sensors::PixelType depth_pixel_type_;
   const float scale_;
   const pc_flags::BaseFieldT fields_;
+  const Parallelism parallelism_;
 
   systems::InputPortIndex depth_image_input_port_{};
   systems::InputPortIndex color_image_input_port_{};
@@ -1,27 +1,24 @@
 #include "drake/perception/point_cloud.h"
 
 #include <algorithm>
+#include <array>
 #include <atomic>
+#include <cmath>
+#include <cstdint>
 #include <functional>
-#include <unordered_map>
+#include <limits>
 #include <utility>
 #include <vector>
 
-#include <common_robotics_utilities/dynamic_spatial_hashed_voxel_grid.hpp>
-#include <common_robotics_utilities/voxel_grid.hpp>
 #include <fmt/format.h>
 #include <nanoflann.hpp>
 
 #include "drake/common/drake_assert.h"
 #include "drake/common/drake_throw.h"
-#include "drake/common/unused.h"
+#include "drake/common/parallel_for.h"
 
 using Eigen::Map;
 using Eigen::NoChange;
-using common_robotics_utilities::voxel_grid::DSHVGSetType;
-using common_robotics_utilities::voxel_grid::DynamicSpatialHashedVoxelGrid;
-using common_robotics_utilities::voxel_grid::GridIndex;
-using common_robotics_utilities::voxel_grid::GridSizes;
 
 namespace drake {
 namespace perception {
@@ -33,6 +30,77 @@ typedef PointCloud::T T;
 typedef PointCloud::C C;
 typedef PointCloud::D D;
 
+// The integer coordinates of a voxel in a grid of cubic voxels.
+using VoxelKey = std::array<int64_t, 3>;
+
+// Maps the keys of the occupied voxels to consecutive indices (in the order in
+// which the keys are first inserted), using open addressing with linear probing
+// over a single flat table. This avoids the per-node allocations and pointer
+// chasing of std::unordered_map, which dominate the cost of binning large
+// clouds.
+class VoxelIndexMap {
+ public:
+  // Sizes the table for about `num_expected` keys, to limit rehashing.
+  explicit VoxelIndexMap(int num_expected) {
+    int capacity = 16;
+    while (capacity < 2 * num_expected) {
+      capacity *= 2;
+    }
+    slots_.resize(capacity, kEmpty);
+  }
+
+  int size() const { return static_cast<int>(keys_.size()); }
+
+  // Returns the index of `key`, adding it if necessary.
+  int FindOrInsert(const VoxelKey& key) {
+    if (2 * (size() + 1) > static_cast<int>(slots_.size())) {
+      Grow();
+    }
+    const size_t mask = slots_.size() - 1;
+    for (size_t slot = Hash(key) & mask;; slot = (slot + 1) & mask) {
+      const int index = slots_[slot];
+      if (index == kEmpty) {
+        slots_[slot] = size();
+        keys_.push_back(key);
+        return slots_[slot];
+      }
+      if (keys_[index] == key) {
+        return index;
+      }
+    }
+  }
+
+ private:
+  static constexpr int kEmpty = -1;
+
+  static size_t Hash(const VoxelKey& key) {
+    // Multiply by large odd constants, then mix the high bits into the low
+    // bits that select the slot.
+    uint64_t h = static_cast<uint64_t>(key[0]) * 0x9E3779B97F4A7C15ULL ^
+                 static_cast<uint64_t>(key[1]) * 0xC2B2AE3D27D4EB4FULL ^
+                 static_cast<uint64_t>(key[2]) * 0x165667B19E3779F9ULL;
+    h ^= h >> 32;
+    return static_cast<size_t>(h);
+  }
+
+  // Doubles the table and reinserts all of the keys.
+  void Grow() {
+    std::vector<int> slots(2 * slots_.size(), kEmpty);
+    const size_t mask = slots.size() - 1;
+    for (int index = 0; index < size(); ++index) {
+      size_t slot = Hash(keys_[index]) & mask;
+      while (slots[slot] != kEmpty) {
+        slot = (slot + 1) & mask;
+      }
+      slots[slot] = index;
+    }
+    slots_ = std::move(slots);
+  }
+
+  std::vector<int> slots_;
+  std::vector<VoxelKey> keys_;
+};
+
 }  // namespace
 
 /*
@@ -474,42 +542,56 @@ PointCloud PointCloud::VoxelizedDownSample(
   DRAKE_THROW_UNLESS(has_xyzs());
   DRAKE_THROW_UNLESS(voxel_size > 0);
 
-  // Create a dynamic-spatial-hashed voxel grid (DSHVG) to bin points. While a
-  // DSHVG usually has each dynamic "chunk" contain multiple voxels, by setting
-  // the chunk size to (voxel_size, 1, 1, 1) each chunk contains a single voxel
-  // and the whole DSHVG behaves as a sparse voxel grid.
-  const GridSizes chunk_sizes(voxel_size, INT64_C(1), INT64_C(1), INT64_C(1));
-  const std::vector<int> default_chunk_value;
-  // By providing an initial estimated number of chunks, we reduce reallocation
-  // and rehashing in the DSHVG.
-  const size_t num_expected_chunks = static_cast<size_t>(size() / 16);
-  DynamicSpatialHashedVoxelGrid<std::vector<int>> dynamic_voxel_grid(
-      chunk_sizes, default_chunk_value, num_expected_chunks);
-
+  // Compute the voxel of every point, in parallel; points with non-finite xyz
+  // values are marked as not being in any voxel.
   const auto& my_xyzs = storage_->xyzs();
+  constexpr int64_t kNoVoxel = std::numeric_limits<int64_t>::min();
+  std::vector<VoxelKey> point_keys(size());
+  drake::internal::ParallelFor(parallelize, size(), [&](int i) {
+    if (my_xyzs.col(i).array().isFinite().all()) {
+      for (int k = 0; k < 3; ++k) {
+        point_keys[i][k] = static_cast<int64_t>(
+            std::floor(static_cast<double>(my_xyzs(k, i)) / voxel_size));
+      }
+    } else {
+      point_keys[i][0] = kNoVoxel;
+    }
+  });
 
-  // Add points into the voxel grid.
+  // Number the occupied voxels, in the order of their first point.
+  VoxelIndexMap voxel_map(size() / 16);
+  std::vector<int> point_voxels(size(), -1);
   for (int i = 0; i < size(); ++i) {
-    if (my_xyzs.col(i).array().isFinite().all()) {
-      auto chunk_query = dynamic_voxel_grid.GetLocationMutable3d(
-          my_xyzs.col(i).cast<double>());
-      if (chunk_query) {
-        // If the containing chunk has already been allocated, add the current
-        // point index directly.
-        chunk_query.Value().emplace_back(i);
-      } else {
-        // If the containing chunk hasn't already been allocated, create a new
-        // chunk containing the current point index.
-        dynamic_voxel_grid.SetLocation3d(
-            my_xyzs.col(i).cast<double>(), DSHVGSetType::SET_CHUNK, {i});
+    if (point_keys[i][0] != kNoVoxel) {
+      point_voxels[i] = voxel_map.FindOrInsert(point_keys[i]);
+    }
+  }
+  const int num_voxels = voxel_map.size();
+
+  // Group the point indices by voxel (a counting sort, which keeps the points
+  // of each voxel in increasing order), so that voxel v owns the indices
+  // voxel_points[voxel_starts[v]] up to voxel_points[voxel_starts[v + 1]].
+  std::vector<int> voxel_starts(num_voxels + 1, 0);
+  for (int voxel : point_voxels) {
+    if (voxel >= 0) {
+      ++voxel_starts[voxel + 1];
+    }
+  }
+  for (int v = 0; v < num_voxels; ++v) {
+    voxel_starts[v + 1] += voxel_starts[v];
+  }
+  std::vector<int> voxel_points(voxel_starts.back());
+  {
+    std::vector<int> next(voxel_starts.begin(), voxel_starts.end() - 1);
+    for (int i = 0; i < size(); ++i) {
+      if (point_voxels[i] >= 0) {
+        voxel_points[next[point_voxels[i]]++] = i;
       }
     }
   }
 
   // Initialize downsampled cloud.
-  PointCloud down_sampled(
-      dynamic_voxel_grid.GetImmutableInternalChunks().size(),
-      storage_->fields());
+  PointCloud down_sampled(num_voxels, storage_->fields());
 
   const bool this_has_normals = has_normals();
   const bool this_has_rgbs = has_rgbs();
@@ -521,7 +603,9 @@ PointCloud PointCloud::VoxelizedDownSample(
   const auto process_voxel =
       [&storage, &down_sampled_storage, this_has_normals, this_has_rgbs,
        this_has_descriptors](
-           int index_in_down_sampled, const std::vector<int>& indices_in_this) {
+           int index_in_down_sampled, const int* indices_begin,
+           const int* indices_end) {
+    const int num_indices = static_cast<int>(indices_end - indices_begin);
     // Use doubles instead of floats for accumulators to avoid round-off errors.
     Eigen::Vector3d xyz{Eigen::Vector3d::Zero()};
     Eigen::Vector3d normal{Eigen::Vector3d::Zero()};
@@ -531,7 +615,8 @@ PointCloud PointCloud::VoxelizedDownSample(
     int num_normals{0};
     int num_descriptors{0};
 
-    for (int index_in_this : indices_in_this) {
+    for (const int* index = indices_begin; index != indices_end; ++index) {
+      const int index_in_this = *index;
       xyz += storage.xyzs().col(index_in_this).cast<double>();
       if (this_has_normals &&
           storage.normals().col(index_in_this).array().isFinite().all()) {
@@ -548,14 +633,14 @@ PointCloud PointCloud::VoxelizedDownSample(
       }
     }
     down_sampled_storage.xyzs().col(index_in_down_sampled) =
-        (xyz / indices_in_this.size()).cast<T>();
+        (xyz / num_indices).cast<T>();
     if (this_has_normals) {
       down_sampled_storage.normals().col(index_in_down_sampled) =
           (normal / num_normals).normalized().cast<T>();
     }
     if (this_has_rgbs) {
       down_sampled_storage.rgbs().col(index_in_down_sampled) =
-          (rgb / indices_in_this.size()).cast<C>();
+          (rgb / num_indices).cast<C>();
     }
     if (this_has_descriptors) {
       down_sampled_storage.descriptors().col(index_in_down_sampled) =
@@ -563,60 +648,17 @@ PointCloud PointCloud::VoxelizedDownSample(
     }
   };
 
-  // Since the parallel form imposes additional overhead, only use it when
-  // we are supposed to parallelize.
-  [[maybe_unused]] const int num_threads = parallelize.num_threads();
-#if defined(_OPENMP)
-  const bool operate_in_parallel = num_threads > 1;
-#else
-  constexpr bool operate_in_parallel = false;
-#endif
-
-  // Since we specify chunks contain a single voxel, a chunk's lone voxel can be
-  // retrieved with index (0, 0, 0).
-  const GridIndex kSingleVoxel(0, 0, 0);
-
-  // Populate the elements of the down_sampled cloud.
-  if (operate_in_parallel) {
-    // Flatten voxel cells to allow parallel processing.
-    std::vector<const std::vector<int>*> voxel_indices;
-    voxel_indices.reserve(
-        dynamic_voxel_grid.GetImmutableInternalChunks().size());
-    for (const auto& [chunk_region, chunk] :
-            dynamic_voxel_grid.GetImmutableInternalChunks()) {
-      unused(chunk_region);
-      const std::vector<int>& indices_in_this =
-          chunk.GetIndexImmutable(kSingleVoxel).Value();
-      voxel_indices.emplace_back(&indices_in_this);
-    }
-
-    // Process voxel cells in parallel.
-#if defined(_OPENMP)
-#pragma omp parallel for num_threads(num_threads)
-#endif
-    for (int index_in_down_sampled = 0;
-         index_in_down_sampled < static_cast<int>(voxel_indices.size());
-         ++index_in_down_sampled) {
-      process_voxel(
-          index_in_down_sampled, *voxel_indices[index_in_down_sampled]);
-    }
-  } else {
-    int index_in_down_sampled = 0;
-    for (const auto& [chunk_region, chunk] :
-            dynamic_voxel_grid.GetImmutableInternalChunks()) {
-      unused(chunk_region);
-      const std::vector<int>& indices_in_this =
-          chunk.GetIndexImmutable(kSingleVoxel).Value();
-      process_voxel(index_in_down_sampled, indices_in_this);
-      ++index_in_down_sampled;
-    }
-  }
+  // Populate the elements of the down_sampled cloud, in parallel.
+  drake::internal::ParallelFor(parallelize, num_voxels, [&](int v) {
+    process_voxel(v, voxel_points.data() + voxel_starts[v],
+                  voxel_points.data() + voxel_starts[v + 1]);
+  });
   return down_sampled;
 }
 
 bool PointCloud::EstimateNormals(
     const double radius, const int num_closest,
-    [[maybe_unused]] const Parallelism parallelize) {
+    const Parallelism parallelize) {
   DRAKE_DEMAND(radius > 0);
   DRAKE_DEMAND(num_closest >= 3);
   DRAKE_THROW_UNLESS(has_xyzs());
@@ -635,68 +677,72 @@ bool PointCloud::EstimateNormals(
   // Iterate through all points and compute their normals.
   std::atomic<bool> all_points_have_at_least_three_neighbors(true);
 
-#if defined(_OPENMP)
-#pragma omp parallel for num_threads(parallelize.num_threads())
-#endif
-  for (int i = 0; i < size(); ++i) {
+  // The points are handed out in chunks, each of which reuses its own query
+  // buffers for all of its points.
+  constexpr int kChunkSize = 256;
+  const int num_chunks = (size() + kChunkSize - 1) / kChunkSize;
+  drake::internal::ParallelFor(parallelize, num_chunks, [&](int chunk) {
     VectorX<Eigen::Index> indices(num_closest);
     Eigen::VectorXf distances(num_closest);
+    const int end = std::min(size(), (chunk + 1) * kChunkSize);
+    for (int i = chunk * kChunkSize; i < end; ++i) {
+      // nanoflann allows two types of queries:
+      // 1. search for the num_closest points, and then keep those within
+      //    radius
+      // 2. search for points within radius, and then keep the num_closest
+      // for dense clouds where the number of points within radius would be
+      // high, approach (1) is considerably faster.
+      const int num_neighbors = kd_tree.index_->knnSearch(
+          xyz(i).data(), num_closest, indices.data(), distances.data());
+
+      if (num_neighbors < 3) {
+        all_points_have_at_least_three_neighbors = false;
+      }
 
-    // nanoflann allows two types of queries:
-    // 1. search for the num_closest points, and then keep those within radius
-    // 2. search for points within radius, and then keep the num_closest
-    // for dense clouds where the number of points within radius would be high,
-    // approach (1) is considerably faster.
-    const int num_neighbors = kd_tree.index_->knnSearch(
-        xyz(i).data(), num_closest, indices.data(), distances.data());
-
-    if (num_neighbors < 3) {
-      all_points_have_at_least_three_neighbors = false;
-    }
-
-    if (num_neighbors < 2) {
-      mutable_normal(i) = Eigen::Vector3f::Constant(kNaN);
-      continue;
-    }
+      if (num_neighbors < 2) {
+        mutable_normal(i) = Eigen::Vector3f::Constant(kNaN);
+        continue;
+      }
 
-    // Compute the covariance matrix.
-    int count = 0;
-    Eigen::Vector3d mean = Eigen::Vector3d::Zero();
+      // Compute the covariance matrix.
+      int count = 0;
+      Eigen::Vector3d mean = Eigen::Vector3d::Zero();
 
-    for (int j = 0; j < num_neighbors; ++j) {
-      if (distances[j] <= squared_radius) {
-        ++count;
-        mean += xyz(indices[j]).cast<double>();
+      for (int j = 0; j < num_neighbors; ++j) {
+        if (distances[j] <= squared_radius) {
+          ++count;
+          mean += xyz(indices[j]).cast<double>();
+        }
       }
-    }
 
-    if (count < 3) {
-      all_points_have_at_least_three_neighbors = false;
-    }
+      if (count < 3) {
+        all_points_have_at_least_three_neighbors = false;
+      }
 
-    if (count < 2) {
-      mutable_normal(i) = Eigen::Vector3f::Constant(kNaN);
-      continue;
-    }
+      if (count < 2) {
+        mutable_normal(i) = Eigen::Vector3f::Constant(kNaN);
+        continue;
+      }
 
-    mean /= count;
+      mean /= count;
 
-    Eigen::Matrix3d covariance = Eigen::Matrix3d::Zero();
+      Eigen::Matrix3d covariance = Eigen::Matrix3d::Zero();
 
-    for (int j = 0; j < num_neighbors; ++j) {
-      if (distances[j] <= squared_radius) {
-        const Eigen::VectorXd x_minus_mean =
-            xyz(indices[j]).cast<double>() - mean;
-        covariance += x_minus_mean * x_minus_mean.transpose();
+      for (int j = 0; j < num_neighbors; ++j) {
+        if (distances[j] <= squared_radius) {
+          const Eigen::Vector3d x_minus_mean =
+              xyz(indices[j]).cast<double>() - mean;
+          covariance.noalias() += x_minus_mean * x_minus_mean.transpose();
+        }
       }
-    }
 
-    // TODO(russt): Open3d implements a "FastEigen3x3" for an optimized version
-    // of this. We probably should, too.
-    Eigen::SelfAdjointEigenSolver<Eigen::Matrix3d> solver;
-    solver.computeDirect(covariance, Eigen::ComputeEigenvectors);
-    mutable_normal(i) = solver.eigenvectors().col(0).cast<float>();
-  }
+      // TODO(russt): Open3d implements a "FastEigen3x3" for an optimized
+      // version of this. We probably should, too.
+      Eigen::SelfAdjointEigenSolver<Eigen::Matrix3d> solver;
+      solver.computeDirect(covariance, Eigen::ComputeEigenvectors);
+      mutable_normal(i) = solver.eigenvectors().col(0).cast<float>();
+    }
+  });
   return all_points_have_at_least_three_neighbors.load();
 }
 
@@ -337,7 +337,9 @@ class PointCloud final {
   /// corresponding to the centroid of the points in that voxel. Points with
   /// non-finite xyz values are ignored. All other fields (e.g. rgbs, normals,
   /// and descriptors) with finite values will also be averaged across the
-  /// points in a voxel. @p parallelize enables OpenMP parallelization.
+  /// points in a voxel. The voxels appear in the downsampled cloud in the order
+  /// of their first point in this cloud, independent of @p parallelize, which
+  /// enables parallelization.
   /// Equivalent to Open3d's voxel_down_sample or PCL's VoxelGrid filter.
   /// @throws std::exception if has_xyzs() is false.
   /// @throws std::exception if voxel_size <= 0.
@@ -352,7 +354,7 @@ class PointCloud final {
   /// points within the @p radius), will receive normal [NaN, NaN, NaN].
   /// Normals estimated from two closest points will be orthogonal to the
   /// vector between those points, but can be arbitrary in the last
-  /// dimension. @p parallelize enables OpenMP parallelization.
+  /// dimension. @p parallelize enables parallelization.
   ///
   /// @returns true iff all points were assigned normals by having at least
   /// *three* closest points within @p radius.
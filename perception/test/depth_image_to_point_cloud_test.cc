@@ -3,6 +3,7 @@
 #include <cmath>
 #include <limits>
 #include <stdexcept>
+#include <utility>
 
 #include <gtest/gtest.h>
 
@@ -482,6 +483,52 @@ TYPED_TEST(DepthImageToPointCloudTest, ResetStorage) {
   }
 }
 
+// Verifies that the cloud is organized like the image, and that converting
+// the rows in parallel gives the same cloud as converting them in serial.
+GTEST_TEST(DepthImageToPointCloudParallelTest, MatchesSerial) {
+  constexpr int kWidth = 64;
+  constexpr int kHeight = 48;
+  const CameraInfo camera(kWidth, kHeight, 100.0, 110.0, 31.5, 23.5);
+  systems::sensors::ImageDepth32F depth_image(kWidth, kHeight);
+  ImageRgba8U color_image(kWidth, kHeight);
+  for (int v = 0; v < kHeight; ++v) {
+    for (int u = 0; u < kWidth; ++u) {
+      *depth_image.at(u, v) = ((u + v) % 7 == 0)
+                                  ? kFloatInf
+                                  : 0.5f + 0.01f * u + 0.02f * v;
+      color_image.at(u, v)[0] = static_cast<uint8_t>(u);
+      color_image.at(u, v)[1] = static_cast<uint8_t>(v);
+      color_image.at(u, v)[2] = static_cast<uint8_t>(u + v);
+    }
+  }
+  const RigidTransformd X_PC(RollPitchYawd(0.1, -0.2, 0.3),
+                             Vector3d(1.1, -1.2, 1.3));
+  const float kScale = 0.5f;
+
+  const pc_flags::Fields fields = pc_flags::kXYZs | pc_flags::kRGBs;
+  PointCloud serial(0, fields);
+  DepthImageToPointCloud::Convert(camera, X_PC, depth_image, color_image,
+                                  kScale, &serial);
+  PointCloud parallel(0, fields);
+  DepthImageToPointCloud::Convert(camera, X_PC, depth_image, color_image,
+                                  kScale, &parallel, Parallelism(4));
+  EXPECT_EQ(serial.xyzs(), parallel.xyzs());
+  EXPECT_EQ(serial.rgbs(), parallel.rgbs());
+
+  // The point of pixel (u, v) is at index v * width + u.
+  ASSERT_EQ(serial.size(), kWidth * kHeight);
+  for (const auto& [u, v] : {std::pair{5, 3}, std::pair{63, 47}}) {
+    const int i = v * kWidth + u;
+    const double z = kScale * *depth_image.at(u, v);
+    const Vector3d p_CP(z * (u - 31.5) / 100.0, z * (v - 23.5) / 110.0, z);
+    EXPECT_TRUE(CompareMatrices(serial.xyz(i), (X_PC * p_CP).cast<float>(),
+                                1e-5));
+    EXPECT_EQ(serial.rgb(i), Vector3<uint8_t>(u, v, u + v));
+  }
+  // (0, 0) is invalid, but it still has its place in the cloud.
+  EXPECT_TRUE(std::isinf(serial.xyz(0)[0]));
+}
+
 }  // namespace
 }  // namespace perception
 }  // namespace drake
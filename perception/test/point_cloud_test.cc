@@ -1,6 +1,9 @@
 #include "drake/perception/point_cloud.h"
 
+#include <set>
 #include <stdexcept>
+#include <tuple>
+#include <vector>
 
 #include <common_robotics_utilities/openmp_helpers.hpp>
 #include <gtest/gtest.h>
@@ -628,6 +631,38 @@ GTEST_TEST(PointCloudTest, VoxelizedDownSample) {
   EXPECT_TRUE(found_match_for_cloud_0);
 }
 
+// Down-samples a larger cloud, and checks that the voxels are returned in the
+// order in which they are first occupied, regardless of parallelization.
+GTEST_TEST(PointCloudTest, VoxelizedDownSampleOrder) {
+  constexpr int num_points{20000};
+  PointCloud cloud(num_points, pc_flags::kXYZs | pc_flags::kNormals);
+  std::srand(4321);
+  cloud.mutable_xyzs().setRandom();
+  cloud.mutable_xyzs() *= 4.0f;
+  cloud.mutable_normals().setRandom();
+
+  // Compute the expected voxel of each output point.
+  std::vector<Eigen::Vector3i> expected_voxels;
+  std::set<std::tuple<int, int, int>> seen;
+  for (int i = 0; i < num_points; ++i) {
+    const Eigen::Vector3i voxel = cloud.xyz(i).array().floor().cast<int>();
+    if (seen.emplace(voxel.x(), voxel.y(), voxel.z()).second) {
+      expected_voxels.push_back(voxel);
+    }
+  }
+
+  const PointCloud serial = cloud.VoxelizedDownSample(1.0, false);
+  const PointCloud parallel =
+      cloud.VoxelizedDownSample(1.0, ENABLE_PARALLEL_OPS);
+  ASSERT_EQ(serial.size(), std::ssize(expected_voxels));
+  for (int i = 0; i < serial.size(); ++i) {
+    EXPECT_EQ(Eigen::Vector3i(serial.xyz(i).array().floor().cast<int>()),
+              expected_voxels[i]);
+  }
+  EXPECT_EQ(serial.xyzs(), parallel.xyzs());
+  EXPECT_TRUE(CompareMatrices(serial.normals(), parallel.normals()));
+}
+
 // Checks that normal has unit magnitude and that normal == expected up to a
 // sign flip.
 void CheckNormal(const Eigen::Ref<const Vector3f>& normal,
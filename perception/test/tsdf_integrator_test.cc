@@ -0,0 +1,92 @@
+#include "drake/perception/tsdf_integrator.h"
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/expect_throws_message.h"
+#include "drake/systems/analysis/simulator.h"
+
+namespace drake {
+namespace perception {
+namespace {
+
+using Eigen::Vector3d;
+using math::RigidTransformd;
+using systems::Simulator;
+using systems::sensors::CameraInfo;
+using systems::sensors::ImageDepth32F;
+
+const CameraInfo kCamera(64, 48, M_PI / 4);
+
+GTEST_TEST(TsdfIntegratorTest, Ports) {
+  const TsdfIntegrator dut({kCamera, kCamera}, 0.1, 0.02, 0.08);
+  EXPECT_EQ(dut.num_cameras(), 2);
+  EXPECT_EQ(dut.num_input_ports(), 4);
+  EXPECT_EQ(dut.depth_image_input_port(1).get_name(), "depth_image_1");
+  EXPECT_EQ(dut.camera_pose_input_port(1).get_name(), "camera_pose_1");
+  EXPECT_EQ(dut.tsdf_volume_output_port().get_name(), "tsdf_volume");
+  EXPECT_EQ(dut.point_cloud_output_port().get_name(), "point_cloud");
+  EXPECT_THROW(dut.depth_image_input_port(2), std::exception);
+
+  EXPECT_THROW(TsdfIntegrator({}, 0.1, 0.02, 0.08), std::exception);
+  EXPECT_THROW(TsdfIntegrator({kCamera}, 0, 0.02, 0.08), std::exception);
+  EXPECT_THROW(TsdfIntegrator({kCamera}, 0.1, 0, 0.08), std::exception);
+}
+
+GTEST_TEST(TsdfIntegratorTest, Integrate) {
+  // Two cameras look at walls on either side of the origin, along ±z. The
+  // second camera is not used at first.
+  const TsdfIntegrator dut({kCamera, kCamera}, 0.1, 0.02, 0.08);
+  Simulator<double> simulator(dut);
+  auto& context = simulator.get_mutable_context();
+  dut.depth_image_input_port(0).FixValue(
+      &context, ImageDepth32F(kCamera.width(), kCamera.height(), 1.0f));
+  dut.camera_pose_input_port(0).FixValue(&context, RigidTransformd());
+
+  EXPECT_EQ(dut.get_tsdf_volume(context).num_blocks(), 0);
+  EXPECT_EQ(dut.point_cloud_output_port().Eval<PointCloud>(context).size(), 0);
+
+  simulator.AdvanceTo(0.05);
+  const TsdfVolume& volume =
+      dut.tsdf_volume_output_port().Eval<TsdfVolume>(context);
+  EXPECT_EQ(volume.voxel_size(), 0.02);
+  EXPECT_NEAR(volume.GetSignedDistance(Vector3d(0, 0, 0.97)).value(), 0.03,
+              1e-6);
+  const PointCloud& cloud =
+      dut.point_cloud_output_port().Eval<PointCloud>(context);
+  ASSERT_GT(cloud.size(), 0);
+  for (int i = 0; i < cloud.size(); ++i) {
+    EXPECT_NEAR(cloud.xyz(i).z(), 1.0, 1e-5);
+  }
+  const int num_points = cloud.size();
+
+  // Connecting the second camera adds its wall.
+  const RigidTransformd X_WC1(math::RotationMatrixd::MakeXRotation(M_PI),
+                              Vector3d::Zero());
+  dut.depth_image_input_port(1).FixValue(
+      &context, ImageDepth32F(kCamera.width(), kCamera.height(), 0.5f));
+  dut.camera_pose_input_port(1).FixValue(&context, X_WC1);
+  simulator.AdvanceTo(0.15);
+  EXPECT_NEAR(dut.get_tsdf_volume(context)
+                  .GetSignedDistance(Vector3d(0, 0, -0.47))
+                  .value(),
+              0.03, 1e-6);
+  EXPECT_GT(dut.point_cloud_output_port().Eval<PointCloud>(context).size(),
+            num_points);
+
+  dut.get_mutable_tsdf_volume(&context).Clear();
+  EXPECT_EQ(dut.point_cloud_output_port().Eval<PointCloud>(context).size(), 0);
+}
+
+GTEST_TEST(TsdfIntegratorTest, MissingPose) {
+  const TsdfIntegrator dut({kCamera}, 0.1, 0.02, 0.08);
+  Simulator<double> simulator(dut);
+  dut.depth_image_input_port(0).FixValue(
+      &simulator.get_mutable_context(),
+      ImageDepth32F(kCamera.width(), kCamera.height(), 1.0f));
+  DRAKE_EXPECT_THROWS_MESSAGE(simulator.AdvanceTo(0.05),
+                              ".*camera_pose_0.*must be connected.*");
+}
+
+}  // namespace
+}  // namespace perception
+}  // namespace drake
@@ -0,0 +1,150 @@
+#include "drake/perception/tsdf_volume.h"
+
+#include <cmath>
+#include <limits>
+
+#include <gtest/gtest.h>
+
+#include "drake/math/roll_pitch_yaw.h"
+
+namespace drake {
+namespace perception {
+namespace {
+
+using Eigen::Vector3d;
+using math::RigidTransformd;
+using systems::sensors::CameraInfo;
+using systems::sensors::ImageDepth32F;
+
+constexpr double kVoxelSize = 0.02;
+constexpr double kTruncation = 0.08;
+
+const CameraInfo kCamera(64, 48, M_PI / 4);
+
+// An image of a wall that is `depth` in front of the camera.
+ImageDepth32F MakeWallImage(float depth) {
+  return ImageDepth32F(kCamera.width(), kCamera.height(), depth);
+}
+
+GTEST_TEST(TsdfVolumeTest, Wall) {
+  TsdfVolume dut(kVoxelSize, kTruncation);
+  EXPECT_EQ(dut.voxel_size(), kVoxelSize);
+  EXPECT_EQ(dut.truncation_distance(), kTruncation);
+  EXPECT_EQ(dut.num_blocks(), 0);
+
+  dut.Integrate(kCamera, RigidTransformd(), MakeWallImage(1.0));
+  EXPECT_GT(dut.num_blocks(), 0);
+  EXPECT_GT(dut.num_observed_voxels(), 0);
+
+  // The distance is measured along the optical axis, and truncated.
+  const double kTol = 1e-6;
+  EXPECT_NEAR(dut.GetSignedDistance(Vector3d(0, 0, 1.0)).value(), 0, kTol);
+  EXPECT_NEAR(dut.GetSignedDistance(Vector3d(0, 0, 0.97)).value(), 0.03,
+              kTol);
+  EXPECT_NEAR(dut.GetSignedDistance(Vector3d(0.1, 0, 1.03)).value(), -0.03,
+              kTol);
+  EXPECT_NEAR(dut.GetSignedDistance(Vector3d(0, 0, 0.9)).value(), kTruncation,
+              kTol);
+  // Far behind the wall, and far in front of it, nothing was stored.
+  EXPECT_FALSE(dut.GetSignedDistance(Vector3d(0, 0, 2.0)).has_value());
+  EXPECT_FALSE(dut.GetSignedDistance(Vector3d(0, 0, 0.1)).has_value());
+
+  // The surface points lie on the wall, and within the camera's view.
+  const PointCloud surface = dut.ExtractSurfacePoints();
+  ASSERT_GT(surface.size(), 0);
+  EXPECT_FALSE(surface.has_normals());
+  for (int i = 0; i < surface.size(); ++i) {
+    EXPECT_NEAR(surface.xyz(i).z(), 1.0, 1e-5);
+    EXPECT_LT(std::abs(surface.xyz(i).y()), 0.5);
+  }
+
+  // Fusing the same image again does not move the surface.
+  dut.Integrate(kCamera, RigidTransformd(), MakeWallImage(1.0));
+  EXPECT_NEAR(dut.GetSignedDistance(Vector3d(0, 0, 0.97)).value(), 0.03,
+              kTol);
+
+  // Fusing a closer wall moves the surface toward it.
+  dut.Integrate(kCamera, RigidTransformd(), MakeWallImage(0.98));
+  EXPECT_NEAR(dut.GetSignedDistance(Vector3d(0, 0, 0.97)).value(),
+              (2 * 0.03 + 0.01) / 3, kTol);
+
+  dut.Clear();
+  EXPECT_EQ(dut.num_blocks(), 0);
+}
+
+// The camera can be anywhere, with any orientation.
+GTEST_TEST(TsdfVolumeTest, CameraPose) {
+  TsdfVolume dut(kVoxelSize, kTruncation);
+  // The camera looks along -x in the world.
+  const RigidTransformd X_WC(math::RollPitchYawd(0, -M_PI / 2, 0),
+                             Vector3d(1.5, -0.3, 0.2));
+  dut.Integrate(kCamera, X_WC, MakeWallImage(1.0));
+  EXPECT_NEAR(dut.GetSignedDistance(Vector3d(0.5, -0.3, 0.2)).value(), 0,
+              1e-6);
+  EXPECT_NEAR(dut.GetSignedDistance(Vector3d(0.54, -0.3, 0.2)).value(), 0.04,
+              1e-6);
+  const PointCloud surface = dut.ExtractSurfacePoints();
+  ASSERT_GT(surface.size(), 0);
+  for (int i = 0; i < surface.size(); ++i) {
+    EXPECT_NEAR(surface.xyz(i).x(), 0.5, 1e-5);
+  }
+}
+
+// Copies of a volume are independent, even though they share storage.
+GTEST_TEST(TsdfVolumeTest, Copy) {
+  TsdfVolume original(kVoxelSize, kTruncation);
+  original.Integrate(kCamera, RigidTransformd(), MakeWallImage(1.0));
+
+  TsdfVolume copy = original;
+  copy.Integrate(kCamera, RigidTransformd(), MakeWallImage(0.98));
+  copy.Integrate(kCamera, RigidTransformd(), MakeWallImage(0.98));
+  EXPECT_NEAR(original.GetSignedDistance(Vector3d(0, 0, 1.0)).value(), 0,
+              1e-6);
+  EXPECT_LT(copy.GetSignedDistance(Vector3d(0, 0, 1.0)).value(), -0.01);
+}
+
+GTEST_TEST(TsdfVolumeTest, Parallel) {
+  TsdfVolume serial(kVoxelSize, kTruncation);
+  TsdfVolume parallel(kVoxelSize, kTruncation);
+  ImageDepth32F image = MakeWallImage(1.0);
+  for (int v = 0; v < image.height(); ++v) {
+    for (int u = 0; u < image.width(); ++u) {
+      *image.at(u, v) = 0.8 + 0.01 * u;
+    }
+  }
+  serial.Integrate(kCamera, RigidTransformd(), image);
+  parallel.Integrate(kCamera, RigidTransformd(), image, Parallelism(2));
+  EXPECT_EQ(serial.num_blocks(), parallel.num_blocks());
+  EXPECT_EQ(serial.num_observed_voxels(), parallel.num_observed_voxels());
+  EXPECT_EQ(serial.ExtractSurfacePoints().size(),
+            parallel.ExtractSurfacePoints(Parallelism(2)).size());
+  for (double x : {-0.2, 0.0, 0.2}) {
+    const Vector3d p(x, 0.01, 0.9);
+    EXPECT_EQ(serial.GetSignedDistance(p), parallel.GetSignedDistance(p));
+  }
+}
+
+GTEST_TEST(TsdfVolumeTest, InvalidPixels) {
+  TsdfVolume dut(kVoxelSize, kTruncation);
+  const float kNaN = std::numeric_limits<float>::quiet_NaN();
+  const float kInf = std::numeric_limits<float>::infinity();
+  dut.Integrate(kCamera, RigidTransformd(), MakeWallImage(kNaN));
+  dut.Integrate(kCamera, RigidTransformd(), MakeWallImage(kInf));
+  dut.Integrate(kCamera, RigidTransformd(), MakeWallImage(0.0));
+  EXPECT_EQ(dut.num_blocks(), 0);
+  EXPECT_EQ(dut.ExtractSurfacePoints().size(), 0);
+}
+
+GTEST_TEST(TsdfVolumeTest, Errors) {
+  EXPECT_THROW(TsdfVolume(0, kTruncation), std::exception);
+  EXPECT_THROW(TsdfVolume(kVoxelSize, -1), std::exception);
+  EXPECT_THROW(TsdfVolume(kVoxelSize, kTruncation, 0), std::exception);
+  TsdfVolume dut(kVoxelSize, kTruncation);
+  EXPECT_THROW(
+      dut.Integrate(kCamera, RigidTransformd(), ImageDepth32F(10, 10, 1.0f)),
+      std::exception);
+}
+
+}  // namespace
+}  // namespace perception
+}  // namespace drake
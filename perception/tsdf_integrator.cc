@@ -0,0 +1,100 @@
+#include "drake/perception/tsdf_integrator.h"
+
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include "drake/common/drake_throw.h"
+
+namespace drake {
+namespace perception {
+
+using math::RigidTransformd;
+using systems::Context;
+using systems::InputPort;
+using systems::State;
+using systems::sensors::CameraInfo;
+using systems::sensors::ImageDepth32F;
+
+TsdfIntegrator::TsdfIntegrator(std::vector<CameraInfo> camera_infos,
+                               double period_sec, double voxel_size,
+                               double truncation_distance,
+                               Parallelism parallelism)
+    : camera_infos_(std::move(camera_infos)), parallelism_(parallelism) {
+  DRAKE_THROW_UNLESS(!camera_infos_.empty());
+  DRAKE_THROW_UNLESS(period_sec > 0);
+
+  for (int i = 0; i < num_cameras(); ++i) {
+    const std::string suffix = std::to_string(i);
+    this->DeclareAbstractInputPort("depth_image_" + suffix,
+                                   Value<ImageDepth32F>{});
+    this->DeclareAbstractInputPort("camera_pose_" + suffix,
+                                   Value<RigidTransformd>{});
+  }
+
+  volume_index_ = this->DeclareAbstractState(
+      Value<TsdfVolume>(TsdfVolume(voxel_size, truncation_distance)));
+  this->DeclarePeriodicUnrestrictedUpdateEvent(period_sec, 0.0,
+                                               &TsdfIntegrator::Integrate);
+
+  this->DeclareStateOutputPort("tsdf_volume", volume_index_);
+  this->DeclareAbstractOutputPort("point_cloud", PointCloud{0},
+                                  &TsdfIntegrator::CalcPointCloud,
+                                  {this->abstract_state_ticket(volume_index_)});
+}
+
+const InputPort<double>& TsdfIntegrator::depth_image_input_port(
+    int camera_index) const {
+  DRAKE_THROW_UNLESS(0 <= camera_index && camera_index < num_cameras());
+  return this->get_input_port(2 * camera_index);
+}
+
+const InputPort<double>& TsdfIntegrator::camera_pose_input_port(
+    int camera_index) const {
+  DRAKE_THROW_UNLESS(0 <= camera_index && camera_index < num_cameras());
+  return this->get_input_port(2 * camera_index + 1);
+}
+
+const TsdfVolume& TsdfIntegrator::get_tsdf_volume(
+    const Context<double>& context) const {
+  this->ValidateContext(context);
+  return context.get_abstract_state<TsdfVolume>(volume_index_);
+}
+
+TsdfVolume& TsdfIntegrator::get_mutable_tsdf_volume(
+    Context<double>* context) const {
+  this->ValidateContext(context);
+  return context->get_mutable_abstract_state<TsdfVolume>(volume_index_);
+}
+
+void TsdfIntegrator::Integrate(const Context<double>& context,
+                               State<double>* state) const {
+  TsdfVolume& volume =
+      state->get_mutable_abstract_state<TsdfVolume>(volume_index_);
+  for (int i = 0; i < num_cameras(); ++i) {
+    const InputPort<double>& depth_port = depth_image_input_port(i);
+    if (!depth_port.HasValue(context)) {
+      continue;
+    }
+    const InputPort<double>& pose_port = camera_pose_input_port(i);
+    if (!pose_port.HasValue(context)) {
+      throw std::logic_error(fmt::format(
+          "TsdfIntegrator: the {} input port must be connected when the {} "
+          "input port is.",
+          pose_port.get_name(), depth_port.get_name()));
+    }
+    volume.Integrate(camera_infos_[i],
+                     pose_port.Eval<RigidTransformd>(context),
+                     depth_port.Eval<ImageDepth32F>(context), parallelism_);
+  }
+}
+
+void TsdfIntegrator::CalcPointCloud(const Context<double>& context,
+                                    PointCloud* output) const {
+  *output = get_tsdf_volume(context).ExtractSurfacePoints(parallelism_);
+}
+
+}  // namespace perception
+}  // namespace drake
@@ -0,0 +1,114 @@
+#pragma once
+
+#include <vector>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/parallelism.h"
+#include "drake/perception/point_cloud.h"
+#include "drake/perception/tsdf_volume.h"
+#include "drake/systems/framework/context.h"
+#include "drake/systems/framework/leaf_system.h"
+#include "drake/systems/sensors/camera_info.h"
+
+namespace drake {
+namespace perception {
+
+/// Fuses the depth images of one or more cameras, over time, into a TsdfVolume
+/// in the world frame.
+///
+/// @system
+/// name: TsdfIntegrator
+/// input_ports:
+/// - depth_image_0
+/// - camera_pose_0
+/// - ...
+/// - depth_image_N-1
+/// - camera_pose_N-1
+/// output_ports:
+/// - tsdf_volume
+/// - point_cloud
+/// @endsystem
+///
+/// For each camera i there is a depth_image_i input port, which expects an
+/// ImageDepth32F in meters, and a camera_pose_i input port, which expects the
+/// pose X_WC of the camera frame C in the world frame W as a RigidTransformd.
+/// Every `period_sec`, the image of each camera whose depth_image port is
+/// connected is integrated into the volume (see TsdfVolume::Integrate()); the
+/// camera_pose port of such a camera must be connected as well. Cameras whose
+/// depth_image port is not connected are skipped.
+///
+/// The volume is abstract state of the system, and is reported on the
+/// tsdf_volume output port, e.g., to query signed distances with
+/// TsdfVolume::GetSignedDistance(). The point_cloud output port reports the
+/// fused surfaces, see TsdfVolume::ExtractSurfacePoints(). Unlike repeatedly
+/// concatenating and down-sampling the clouds of every image, the cost of
+/// each update depends only on the size of the new images, and the output
+/// cloud does not grow with the number of images fused.
+///
+/// @ingroup perception_systems
+class TsdfIntegrator final : public systems::LeafSystem<double> {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(TsdfIntegrator)
+
+  /// Constructs the integrator.
+  ///
+  /// @param camera_infos The intrinsics of each camera; there is a pair of
+  ///   input ports for each.
+  /// @param period_sec The period of the integration updates.
+  /// @param voxel_size The edge length of the voxels, in meters.
+  /// @param truncation_distance The truncation distance of the volume, in
+  ///   meters.
+  /// @param parallelism The maximum parallelism to use in each update and
+  ///   when computing the point cloud.
+  /// @throws std::exception if `camera_infos` is empty, or if any of the
+  ///   numeric arguments is not positive.
+  TsdfIntegrator(std::vector<systems::sensors::CameraInfo> camera_infos,
+                 double period_sec, double voxel_size,
+                 double truncation_distance,
+                 Parallelism parallelism = Parallelism::None());
+
+  /// Returns the number of cameras.
+  int num_cameras() const { return static_cast<int>(camera_infos_.size()); }
+
+  /// Returns the abstract valued input port that expects the ImageDepth32F of
+  /// the camera with the given index.
+  const systems::InputPort<double>& depth_image_input_port(
+      int camera_index) const;
+
+  /// Returns the abstract valued input port that expects X_WC for the camera
+  /// with the given index, as a RigidTransformd.
+  const systems::InputPort<double>& camera_pose_input_port(
+      int camera_index) const;
+
+  /// Returns the abstract valued output port that provides the TsdfVolume.
+  const systems::OutputPort<double>& tsdf_volume_output_port() const {
+    return this->get_output_port(0);
+  }
+
+  /// Returns the abstract valued output port that provides a PointCloud of
+  /// the fused surfaces, in the world frame.
+  const systems::OutputPort<double>& point_cloud_output_port() const {
+    return this->get_output_port(1);
+  }
+
+  /// Returns the volume stored in `context`.
+  const TsdfVolume& get_tsdf_volume(
+      const systems::Context<double>& context) const;
+
+  /// Returns the volume stored in `context`, e.g., to clear it.
+  TsdfVolume& get_mutable_tsdf_volume(systems::Context<double>* context) const;
+
+ private:
+  void Integrate(const systems::Context<double>& context,
+                 systems::State<double>* state) const;
+
+  void CalcPointCloud(const systems::Context<double>& context,
+                      PointCloud* output) const;
+
+  const std::vector<systems::sensors::CameraInfo> camera_infos_;
+  const Parallelism parallelism_;
+  systems::AbstractStateIndex volume_index_{};
+};
+
+}  // namespace perception
+}  // namespace drake
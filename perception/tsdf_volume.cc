@@ -0,0 +1,319 @@
+#include "drake/perception/tsdf_volume.h"
+
+#include <algorithm>
+#include <cmath>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "drake/common/drake_throw.h"
+#include "drake/common/parallel_for.h"
+
+namespace drake {
+namespace perception {
+
+using Eigen::Vector3d;
+using Eigen::Vector3f;
+using math::RigidTransformd;
+using systems::sensors::CameraInfo;
+using systems::sensors::ImageDepth32F;
+using systems::sensors::ImageTraits;
+using systems::sensors::PixelType;
+
+namespace {
+
+// The number of voxels along each edge of a block.
+constexpr int kBlockDim = 8;
+constexpr int kBlockVoxels = kBlockDim * kBlockDim * kBlockDim;
+
+// Returns floor(a / kBlockDim), also for negative a.
+int FloorDivBlock(int a) {
+  return (a >= 0) ? (a / kBlockDim) : -((kBlockDim - 1 - a) / kBlockDim);
+}
+
+// Returns the index within its block of the voxel with the given (local)
+// coordinates.
+int LocalIndex(int x, int y, int z) {
+  return x + kBlockDim * (y + kBlockDim * z);
+}
+
+bool IsValidDepth(float depth) {
+  using Traits = ImageTraits<PixelType::kDepth32F>;
+  return std::isfinite(depth) && depth != Traits::kTooClose &&
+         depth != Traits::kTooFar && depth > 0;
+}
+
+}  // namespace
+
+// The voxels are stored as separate arrays of distances and weights, both
+// indexed by LocalIndex().
+struct TsdfVolume::Block {
+  std::array<float, kBlockVoxels> distances{};
+  std::array<float, kBlockVoxels> weights{};
+};
+
+size_t TsdfVolume::BlockKeyHash::operator()(const BlockKey& key) const {
+  const uint64_t h = static_cast<uint64_t>(key[0]) * 0x9E3779B97F4A7C15ULL ^
+                     static_cast<uint64_t>(key[1]) * 0xC2B2AE3D27D4EB4FULL ^
+                     static_cast<uint64_t>(key[2]) * 0x165667B19E3779F9ULL;
+  return static_cast<size_t>(h ^ (h >> 32));
+}
+
+TsdfVolume::TsdfVolume(double voxel_size, double truncation_distance,
+                       double max_weight)
+    : voxel_size_(voxel_size),
+      truncation_distance_(truncation_distance),
+      max_weight_(max_weight) {
+  DRAKE_THROW_UNLESS(voxel_size > 0);
+  DRAKE_THROW_UNLESS(truncation_distance > 0);
+  DRAKE_THROW_UNLESS(max_weight > 0);
+}
+
+TsdfVolume::~TsdfVolume() = default;
+
+int TsdfVolume::num_observed_voxels() const {
+  int result = 0;
+  for (const auto& [key, block] : blocks_) {
+    result += static_cast<int>(std::count_if(block->weights.begin(),
+                                             block->weights.end(),
+                                             [](float w) { return w > 0; }));
+  }
+  return result;
+}
+
+void TsdfVolume::Clear() {
+  blocks_.clear();
+}
+
+const TsdfVolume::Block* TsdfVolume::FindBlock(const BlockKey& key) const {
+  const auto iter = blocks_.find(key);
+  return (iter == blocks_.end()) ? nullptr : iter->second.get();
+}
+
+void TsdfVolume::Integrate(const CameraInfo& camera_info,
+                           const RigidTransformd& X_WC,
+                           const ImageDepth32F& depth_image,
+                           Parallelism parallelism) {
+  DRAKE_THROW_UNLESS(depth_image.width() == camera_info.width());
+  DRAKE_THROW_UNLESS(depth_image.height() == camera_info.height());
+  const int width = depth_image.width();
+  const int height = depth_image.height();
+  const double fx = camera_info.focal_x();
+  const double fy = camera_info.focal_y();
+  const double cx = camera_info.center_x();
+  const double cy = camera_info.center_y();
+  const double truncation = truncation_distance_;
+  const double block_size = kBlockDim * voxel_size_;
+
+  // Find the blocks within the truncation band of every measurement, by
+  // sampling each pixel's ray in that band at half-block intervals. Each
+  // chunk of rows collects its own blocks, which are merged afterwards.
+  const int num_chunks =
+      std::max(1, std::min(parallelism.num_threads(), height));
+  std::vector<std::unordered_set<BlockKey, BlockKeyHash>> chunk_touched(
+      num_chunks);
+  drake::internal::ParallelFor(
+      Parallelism(num_chunks), num_chunks, [&](int chunk) {
+        for (int v = chunk * height / num_chunks;
+             v < (chunk + 1) * height / num_chunks; ++v) {
+          const float* depth_row = depth_image.at(0, v);
+          for (int u = 0; u < width; ++u) {
+            const float depth = depth_row[u];
+            if (!IsValidDepth(depth)) {
+              continue;
+            }
+            // The ray through the pixel, scaled to unit depth.
+            const Vector3d ray_C((u - cx) / fx, (v - cy) / fy, 1.0);
+            const Vector3d ray_W = X_WC.rotation() * ray_C;
+            const double step = 0.5 * block_size / ray_C.norm();
+            const double z_min = std::max(depth - truncation, 0.0);
+            const double z_max = depth + truncation;
+            for (double z = z_min;; z = std::min(z + step, z_max)) {
+              const Vector3d p_W = X_WC.translation() + z * ray_W;
+              chunk_touched[chunk].insert(
+                  {static_cast<int>(std::floor(p_W.x() / block_size)),
+                   static_cast<int>(std::floor(p_W.y() / block_size)),
+                   static_cast<int>(std::floor(p_W.z() / block_size))});
+              if (z == z_max) {
+                break;
+              }
+            }
+          }
+        }
+      });
+  std::unordered_set<BlockKey, BlockKeyHash> touched;
+  for (const auto& chunk_blocks : chunk_touched) {
+    touched.insert(chunk_blocks.begin(), chunk_blocks.end());
+  }
+
+  // Allocate the new blocks, and take private copies of blocks shared with
+  // other volumes, so that the blocks below can be updated independently.
+  std::vector<std::pair<BlockKey, Block*>> to_update;
+  to_update.reserve(touched.size());
+  for (const BlockKey& key : touched) {
+    std::shared_ptr<Block>& block = blocks_[key];
+    if (block == nullptr) {
+      block = std::make_shared<Block>();
+    } else if (block.use_count() > 1) {
+      block = std::make_shared<Block>(*block);
+    }
+    to_update.emplace_back(key, block.get());
+  }
+
+  // Update every voxel of the touched blocks with the measurement of the
+  // pixel its center projects to.
+  const RigidTransformd X_CW = X_WC.inverse();
+  const float max_weight = static_cast<float>(max_weight_);
+  drake::internal::ParallelFor(parallelism, ssize(to_update), [&](int b) {
+    const BlockKey& key = to_update[b].first;
+    Block& block = *to_update[b].second;
+    for (int z = 0; z < kBlockDim; ++z) {
+      for (int y = 0; y < kBlockDim; ++y) {
+        for (int x = 0; x < kBlockDim; ++x) {
+          const Vector3d p_WV =
+              voxel_size_ * Vector3d(kBlockDim * key[0] + x + 0.5,
+                                     kBlockDim * key[1] + y + 0.5,
+                                     kBlockDim * key[2] + z + 0.5);
+          const Vector3d p_CV = X_CW * p_WV;
+          if (p_CV.z() <= 0) {
+            continue;
+          }
+          // The pixel coordinates, rounded to the nearest pixel below.
+          const double pixel_u = fx * p_CV.x() / p_CV.z() + cx;
+          const double pixel_v = fy * p_CV.y() / p_CV.z() + cy;
+          if (!(pixel_u > -0.5 && pixel_u < width - 0.5 && pixel_v > -0.5 &&
+                pixel_v < height - 0.5)) {
+            continue;
+          }
+          const int u = static_cast<int>(std::lround(pixel_u));
+          const int v = static_cast<int>(std::lround(pixel_v));
+          const float depth = *depth_image.at(u, v);
+          if (!IsValidDepth(depth)) {
+            continue;
+          }
+          const double distance = depth - p_CV.z();
+          if (distance < -truncation) {
+            continue;
+          }
+          const int i = LocalIndex(x, y, z);
+          const float weight = block.weights[i];
+          block.distances[i] =
+              (weight * block.distances[i] +
+               static_cast<float>(std::min(distance, truncation))) /
+              (weight + 1.0f);
+          block.weights[i] = std::min(weight + 1.0f, max_weight);
+        }
+      }
+    }
+  });
+}
+
+std::optional<double> TsdfVolume::GetSignedDistance(
+    const Eigen::Ref<const Vector3d>& p_WQ) const {
+  // The voxel centers are at (i + 0.5) * voxel_size, so shift by half a voxel
+  // to find the lower corner of the surrounding cube of centers.
+  const Vector3d q = p_WQ / voxel_size_ - Vector3d::Constant(0.5);
+  const Vector3d q_floor = q.array().floor();
+  const Vector3d t = q - q_floor;
+  const Eigen::Vector3i corner = q_floor.cast<int>();
+  double result = 0;
+  for (int corner_index = 0; corner_index < 8; ++corner_index) {
+    Eigen::Vector3i g = corner;
+    double coefficient = 1;
+    for (int k = 0; k < 3; ++k) {
+      if (corner_index & (1 << k)) {
+        g[k] += 1;
+        coefficient *= t[k];
+      } else {
+        coefficient *= 1 - t[k];
+      }
+    }
+    const BlockKey key{FloorDivBlock(g.x()), FloorDivBlock(g.y()),
+                       FloorDivBlock(g.z())};
+    const Block* block = FindBlock(key);
+    if (block == nullptr) {
+      return std::nullopt;
+    }
+    const int i = LocalIndex(g.x() - kBlockDim * key[0],
+                             g.y() - kBlockDim * key[1],
+                             g.z() - kBlockDim * key[2]);
+    if (!(block->weights[i] > 0)) {
+      return std::nullopt;
+    }
+    result += coefficient * block->distances[i];
+  }
+  return result;
+}
+
+PointCloud TsdfVolume::ExtractSurfacePoints(Parallelism parallelism) const {
+  std::vector<std::pair<BlockKey, const Block*>> blocks;
+  blocks.reserve(blocks_.size());
+  for (const auto& [key, block] : blocks_) {
+    blocks.emplace_back(key, block.get());
+  }
+
+  // Find the zero crossings from every observed voxel toward its neighbors in
+  // the +x, +y, and +z directions, one block at a time.
+  std::vector<std::vector<Vector3f>> block_points(blocks.size());
+  drake::internal::ParallelFor(parallelism, ssize(blocks), [&](int b) {
+    const BlockKey& key = blocks[b].first;
+    const Block& block = *blocks[b].second;
+    std::vector<Vector3f>& points = block_points[b];
+    for (int z = 0; z < kBlockDim; ++z) {
+      for (int y = 0; y < kBlockDim; ++y) {
+        for (int x = 0; x < kBlockDim; ++x) {
+          const int i = LocalIndex(x, y, z);
+          if (!(block.weights[i] > 0)) {
+            continue;
+          }
+          const float d0 = block.distances[i];
+          const Vector3d p_WV =
+              voxel_size_ * Vector3d(kBlockDim * key[0] + x + 0.5,
+                                     kBlockDim * key[1] + y + 0.5,
+                                     kBlockDim * key[2] + z + 0.5);
+          for (int k = 0; k < 3; ++k) {
+            std::array<int, 3> local{x, y, z};
+            ++local[k];
+            BlockKey neighbor_key = key;
+            const Block* neighbor = &block;
+            if (local[k] == kBlockDim) {
+              local[k] = 0;
+              ++neighbor_key[k];
+              neighbor = FindBlock(neighbor_key);
+              if (neighbor == nullptr) {
+                continue;
+              }
+            }
+            const int j = LocalIndex(local[0], local[1], local[2]);
+            if (!(neighbor->weights[j] > 0)) {
+              continue;
+            }
+            const float d1 = neighbor->distances[j];
+            if ((d0 >= 0) == (d1 >= 0)) {
+              continue;
+            }
+            Vector3d p_WS = p_WV;
+            p_WS[k] += voxel_size_ * d0 / (d0 - d1);
+            points.push_back(p_WS.cast<float>());
+          }
+        }
+      }
+    }
+  });
+
+  int num_points = 0;
+  for (const auto& points : block_points) {
+    num_points += static_cast<int>(points.size());
+  }
+  PointCloud result(num_points, pc_flags::kXYZs);
+  int index = 0;
+  for (const auto& points : block_points) {
+    for (const Vector3f& point : points) {
+      result.mutable_xyz(index++) = point;
+    }
+  }
+  return result;
+}
+
+}  // namespace perception
+}  // namespace drake
@@ -0,0 +1,124 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <unordered_map>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
+#include "drake/common/parallelism.h"
+#include "drake/math/rigid_transform.h"
+#include "drake/perception/point_cloud.h"
+#include "drake/systems/sensors/camera_info.h"
+#include "drake/systems/sensors/image.h"
+
+namespace drake {
+namespace perception {
+
+/// A truncated signed distance field (TSDF) that fuses many depth images into
+/// a persistent model of the observed surfaces, in a world frame W.
+///
+/// Space is divided into cubic voxels of edge length voxel_size(). Each voxel
+/// stores a weighted running average of the signed distance from its center
+/// to the observed surface, measured along the camera's optical axis:
+/// positive in front of the surface (in observed free space) and negative
+/// behind it. Distances are truncated to ±truncation_distance(), and voxels
+/// farther than truncation_distance() behind a surface are not updated.
+///
+/// Only the voxels near observed surfaces are stored: voxels are allocated in
+/// blocks of 8×8×8 as depth measurements reach them, and the blocks are kept
+/// in a hash map, so the memory grows with the observed surface area rather
+/// than with the extent of the scene. Copies of a volume share their blocks
+/// until either copy modifies them, so copying a volume (e.g., when it is
+/// stored in a Context) is cheap.
+///
+/// @see TsdfIntegrator for a System that maintains a volume over time.
+class TsdfVolume {
+ public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(TsdfVolume)
+
+  /// Constructs an empty volume.
+  /// @param voxel_size The edge length of the voxels, in meters.
+  /// @param truncation_distance The largest magnitude of stored distances, in
+  ///   meters. Typical values are a few voxel sizes.
+  /// @param max_weight The largest weight of a voxel's running average. Once
+  ///   a voxel reaches it, new measurements keep a fixed share of the average,
+  ///   so that the volume can follow changes in the scene.
+  /// @throws std::exception if any argument is not positive.
+  TsdfVolume(double voxel_size, double truncation_distance,
+             double max_weight = 64.0);
+
+  ~TsdfVolume();
+
+  double voxel_size() const { return voxel_size_; }
+
+  double truncation_distance() const { return truncation_distance_; }
+
+  double max_weight() const { return max_weight_; }
+
+  /// Returns the number of allocated blocks of 8×8×8 voxels.
+  int num_blocks() const { return static_cast<int>(blocks_.size()); }
+
+  /// Returns the number of voxels with at least one measurement.
+  int num_observed_voxels() const;
+
+  /// Removes all voxels.
+  void Clear();
+
+  /// Fuses a depth image into the volume.
+  ///
+  /// @param camera_info The intrinsics of the camera that took the image.
+  /// @param X_WC The pose of the camera frame C in the world frame W, where C
+  ///   is the camera frame used by DepthImageToPointCloud.
+  /// @param depth_image The depth image, in meters. Pixels that are NaN,
+  ///   kTooClose, or kTooFar are ignored.
+  /// @param parallelism The maximum parallelism to use.
+  /// @throws std::exception if the size of the image does not match
+  ///   `camera_info`.
+  void Integrate(const systems::sensors::CameraInfo& camera_info,
+                 const math::RigidTransformd& X_WC,
+                 const systems::sensors::ImageDepth32F& depth_image,
+                 Parallelism parallelism = Parallelism::None());
+
+  /// Returns the signed distance at the point `p_WQ`, trilinearly
+  /// interpolated from the centers of the surrounding voxels, or nullopt if
+  /// any of those voxels has not been observed.
+  std::optional<double> GetSignedDistance(
+      const Eigen::Ref<const Eigen::Vector3d>& p_WQ) const;
+
+  /// Returns points on the fused surfaces (i.e., the zero crossings of the
+  /// signed distance between neighboring observed voxels), expressed in the
+  /// world frame. The result has only the xyz field; at most three points are
+  /// produced per voxel, so the density of the cloud is on the order of the
+  /// voxel size, independent of how many images were fused.
+  PointCloud ExtractSurfacePoints(
+      Parallelism parallelism = Parallelism::None()) const;
+
+ private:
+  // The voxels of one block; defined in the .cc file.
+  struct Block;
+
+  // The integer coordinates of a block, i.e., of its voxel with the smallest
+  // coordinates divided by the number of voxels along a block's edge.
+  using BlockKey = std::array<int, 3>;
+
+  struct BlockKeyHash {
+    size_t operator()(const BlockKey& key) const;
+  };
+
+  // Returns the block with the given key, or nullptr if it is not allocated.
+  const Block* FindBlock(const BlockKey& key) const;
+
+  double voxel_size_{};
+  double truncation_distance_{};
+  double max_weight_{};
+
+  // The blocks are immutable while shared between copies of the volume; they
+  // are copied before they are modified, see Integrate().
+  std::unordered_map<BlockKey, std::shared_ptr<Block>, BlockKeyHash> blocks_;
+};
+
+}  // namespace perception
+}  // namespace drake
@@ -0,0 +1,321 @@
+// @file
+// Benchmarks for the throughput of the SceneGraphCollisionChecker.
+//
+// Each benchmark case checks a fixed batch of random configurations (or edges)
+// of one of a set of planning models, using a given number of threads. The
+// "items_per_second" counter reports the number of configurations (or edges)
+// checked per second, so that the scaling with the number of threads can be
+// read off directly. Cases named "Implicit" use the checker's implicit
+// contexts; cases named "Explicit" use one standalone context per std::thread,
+// as a user with their own thread pool would.
+
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "drake/common/drake_assert.h"
+#include "drake/common/parallel_for.h"
+#include "drake/common/random.h"
+#include "drake/geometry/proximity_properties.h"
+#include "drake/multibody/parsing/parser.h"
+#include "drake/multibody/tree/planar_joint.h"
+#include "drake/planning/robot_diagram_builder.h"
+#include "drake/planning/scene_graph_collision_checker.h"
+#include "drake/tools/performance/fixture_common.h"
+
+namespace drake {
+namespace planning {
+namespace {
+
+using Eigen::Vector3d;
+using Eigen::VectorXd;
+using geometry::Box;
+using math::RigidTransformd;
+using multibody::ModelInstanceIndex;
+using multibody::PlanarJoint;
+
+// In the benchmark case instantiations at the bottom of this file, the first
+// "Arg" selects the model and the second one the number of threads.
+enum Model {
+  kIiwa = 0,
+  kDualArm = 1,
+  kMobileManipulator = 2,
+};
+
+// The number of configurations (and edges) checked in each iteration.
+constexpr int kNumSamples = 1000;
+
+// The influence distance used for CalcRobotClearance().
+constexpr double kInfluenceDistance = 0.1;
+
+// Adds a few boxes around the origin to the world, as the environment of the
+// single-arm models.
+void AddShelves(multibody::MultibodyPlant<double>* plant) {
+  const auto add_box = [plant](const std::string& name, const Box& box,
+                               const Vector3d& p_WB) {
+    plant->RegisterCollisionGeometry(plant->world_body(),
+                                     RigidTransformd(p_WB), box, name,
+                                     geometry::ProximityProperties());
+  };
+  add_box("floor", Box(4.0, 4.0, 0.1), Vector3d(0, 0, -0.05));
+  add_box("shelf_bottom", Box(0.4, 0.8, 0.02), Vector3d(0.6, 0, 0.3));
+  add_box("shelf_middle", Box(0.4, 0.8, 0.02), Vector3d(0.6, 0, 0.6));
+  add_box("shelf_top", Box(0.4, 0.8, 0.02), Vector3d(0.6, 0, 0.9));
+  add_box("shelf_side", Box(0.4, 0.02, 0.9), Vector3d(0.6, 0.4, 0.45));
+  add_box("post", Box(0.1, 0.1, 1.2), Vector3d(-0.4, 0.5, 0.6));
+}
+
+// Returns the collision checker for the given model.
+std::unique_ptr<SceneGraphCollisionChecker> MakeChecker(Model model) {
+  auto builder = std::make_unique<RobotDiagramBuilder<double>>();
+  multibody::MultibodyPlant<double>& plant = builder->plant();
+  multibody::Parser& parser = builder->parser();
+  const std::string iiwa_url =
+      "package://drake/manipulation/models/iiwa_description/sdf/"
+      "iiwa14_polytope_collision.sdf";
+  std::vector<ModelInstanceIndex> robot_model_instances;
+  switch (model) {
+    case kIiwa: {
+      const ModelInstanceIndex iiwa = parser.AddModelsFromUrl(iiwa_url).at(0);
+      plant.WeldFrames(plant.world_frame(),
+                       plant.GetFrameByName("iiwa_link_0", iiwa));
+      AddShelves(&plant);
+      robot_model_instances.push_back(iiwa);
+      break;
+    }
+    case kDualArm: {
+      parser.AddModelsFromUrl(
+          "package://drake/manipulation/models/tri_homecart/"
+          "homecart_no_grippers.dmd.yaml");
+      for (const char* name : {"ur3_left", "ur3_right"}) {
+        robot_model_instances.push_back(plant.GetModelInstanceByName(name));
+      }
+      break;
+    }
+    case kMobileManipulator: {
+      // An iiwa on a base that moves in the plane (x, y, θ).
+      const ModelInstanceIndex iiwa = parser.AddModelsFromUrl(iiwa_url).at(0);
+      const multibody::RigidBody<double>& base = plant.AddRigidBody(
+          "mobile_base", iiwa,
+          multibody::SpatialInertia<double>::SolidBoxWithMass(50, 0.6, 0.6,
+                                                              0.3));
+      plant.RegisterCollisionGeometry(
+          base, RigidTransformd(Vector3d(0, 0, -0.15)), Box(0.6, 0.6, 0.3),
+          "mobile_base", geometry::ProximityProperties());
+      // The base floats just above the floor.
+      plant.AddJoint<PlanarJoint>(
+          "mobile_base_planar", plant.world_body(),
+          RigidTransformd(Vector3d(0, 0, 0.35)), base, std::nullopt,
+          Vector3d::Zero() /* damping */);
+      plant.WeldFrames(base.body_frame(),
+                       plant.GetFrameByName("iiwa_link_0", iiwa));
+      AddShelves(&plant);
+      robot_model_instances.push_back(iiwa);
+      break;
+    }
+  }
+  return std::make_unique<SceneGraphCollisionChecker>(CollisionCheckerParams{
+      .model = builder->Build(),
+      .robot_model_instances = std::move(robot_model_instances),
+      .edge_step_size = 0.05,
+      .env_collision_padding = 0.01,
+      .self_collision_padding = 0.01});
+}
+
+// Fixture that holds a collision checker and a batch of random configurations
+// and edges to check.
+class CollisionCheckerBenchmark : public benchmark::Fixture {
+ public:
+  CollisionCheckerBenchmark() { tools::performance::AddMinMaxStatistics(this); }
+
+  void SetUp(benchmark::State& state) override {
+    checker_ = MakeChecker(static_cast<Model>(state.range(0)));
+    num_threads_ = state.range(1);
+    SampleConfigurations();
+    for (int i = 0; i < num_threads_; ++i) {
+      standalone_contexts_.push_back(checker_->MakeStandaloneModelContext());
+    }
+  }
+
+  void TearDown(benchmark::State&) override {
+    standalone_contexts_.clear();
+    configs_.clear();
+    edges_.clear();
+    checker_.reset();
+  }
+
+ protected:
+  // Samples configs_ uniformly within the position limits (or within ±π where
+  // the limits are unbounded), and edges_ between each sample and a nearby
+  // configuration.
+  void SampleConfigurations() {
+    const multibody::MultibodyPlant<double>& plant = checker_->plant();
+    const VectorXd lower = plant.GetPositionLowerLimits().cwiseMax(-M_PI);
+    const VectorXd upper = plant.GetPositionUpperLimits().cwiseMin(M_PI);
+    RandomGenerator generator(1234);
+    std::uniform_real_distribution<double> uniform(0.0, 1.0);
+    const auto sample = [&]() {
+      VectorXd q(lower.size());
+      for (int i = 0; i < q.size(); ++i) {
+        q(i) = lower(i) + uniform(generator) * (upper(i) - lower(i));
+      }
+      return q;
+    };
+    for (int i = 0; i < kNumSamples; ++i) {
+      VectorXd q = sample();
+      // Edges are a small fraction of the way to another random sample, which
+      // is typical of the edges that sampling-based planners check.
+      const VectorXd q_end = q + 0.1 * (sample() - q);
+      edges_.emplace_back(q, q_end);
+      configs_.push_back(std::move(q));
+    }
+  }
+
+  // Calls `check(context, i)` for each sample index i, using num_threads_
+  // std::threads, each with its own standalone context.
+  template <typename Check>
+  void RunExplicit(const Check& check) {
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < num_threads_; ++thread) {
+      threads.emplace_back([this, thread, &check]() {
+        CollisionCheckerContext* context = standalone_contexts_[thread].get();
+        const int begin =
+            static_cast<int64_t>(kNumSamples) * thread / num_threads_;
+        const int end =
+            static_cast<int64_t>(kNumSamples) * (thread + 1) / num_threads_;
+        for (int i = begin; i < end; ++i) {
+          check(context, i);
+        }
+      });
+    }
+    for (std::thread& thread : threads) {
+      thread.join();
+    }
+  }
+
+  std::unique_ptr<SceneGraphCollisionChecker> checker_;
+  int num_threads_{};
+  std::vector<std::shared_ptr<CollisionCheckerContext>> standalone_contexts_;
+  std::vector<VectorXd> configs_;
+  std::vector<std::pair<VectorXd, VectorXd>> edges_;
+};
+
+BENCHMARK_DEFINE_F(CollisionCheckerBenchmark, ConfigsImplicit)
+// NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+(benchmark::State& state) {
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(checker_->CheckConfigsCollisionFree(
+        configs_, Parallelism(num_threads_)));
+  }
+  state.SetItemsProcessed(state.iterations() * kNumSamples);
+}
+
+BENCHMARK_DEFINE_F(CollisionCheckerBenchmark, ConfigsExplicit)
+// NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+(benchmark::State& state) {
+  std::vector<uint8_t> results(kNumSamples);
+  for (auto _ : state) {
+    RunExplicit([&](CollisionCheckerContext* context, int i) {
+      results[i] = checker_->CheckContextConfigCollisionFree(context,
+                                                             configs_[i]);
+    });
+    benchmark::DoNotOptimize(results);
+  }
+  state.SetItemsProcessed(state.iterations() * kNumSamples);
+}
+
+BENCHMARK_DEFINE_F(CollisionCheckerBenchmark, EdgesImplicit)
+// NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+(benchmark::State& state) {
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        checker_->CheckEdgesCollisionFree(edges_, Parallelism(num_threads_)));
+  }
+  state.SetItemsProcessed(state.iterations() * kNumSamples);
+}
+
+BENCHMARK_DEFINE_F(CollisionCheckerBenchmark, EdgesExplicit)
+// NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+(benchmark::State& state) {
+  std::vector<uint8_t> results(kNumSamples);
+  for (auto _ : state) {
+    RunExplicit([&](CollisionCheckerContext* context, int i) {
+      results[i] = checker_->CheckContextEdgeCollisionFree(
+          context, edges_[i].first, edges_[i].second);
+    });
+    benchmark::DoNotOptimize(results);
+  }
+  state.SetItemsProcessed(state.iterations() * kNumSamples);
+}
+
+BENCHMARK_DEFINE_F(CollisionCheckerBenchmark, ClearanceImplicit)
+// NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+(benchmark::State& state) {
+  // There is no batch version of CalcRobotClearance(), so the batch is split
+  // into one contiguous range per worker, each of which uses the implicit
+  // context with its worker number.
+  const int num_workers =
+      std::min(num_threads_, checker_->num_allocated_contexts());
+  for (auto _ : state) {
+    drake::internal::ParallelFor(
+        Parallelism(num_workers), num_workers, [&](int worker) {
+          const int begin =
+              static_cast<int64_t>(kNumSamples) * worker / num_workers;
+          const int end =
+              static_cast<int64_t>(kNumSamples) * (worker + 1) / num_workers;
+          for (int i = begin; i < end; ++i) {
+            benchmark::DoNotOptimize(checker_->CalcRobotClearance(
+                configs_[i], kInfluenceDistance, worker));
+          }
+        });
+  }
+  state.SetItemsProcessed(state.iterations() * kNumSamples);
+}
+
+BENCHMARK_DEFINE_F(CollisionCheckerBenchmark, ClearanceExplicit)
+// NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+(benchmark::State& state) {
+  for (auto _ : state) {
+    RunExplicit([&](CollisionCheckerContext* context, int i) {
+      benchmark::DoNotOptimize(checker_->CalcContextRobotClearance(
+          context, configs_[i], kInfluenceDistance));
+    });
+  }
+  state.SetItemsProcessed(state.iterations() * kNumSamples);
+}
+
+// Registers the given case for every model and number of threads.
+void RegisterModels(benchmark::internal::Benchmark* b) {
+  b->Unit(benchmark::kMillisecond);
+  b->UseRealTime();
+  for (const int model : {kIiwa, kDualArm, kMobileManipulator}) {
+    for (const int num_threads : {1, 2, 4, 8}) {
+      b->Args({model, num_threads});
+    }
+  }
+}
+
+BENCHMARK_REGISTER_F(CollisionCheckerBenchmark, ConfigsImplicit)
+    ->Apply(RegisterModels);
+BENCHMARK_REGISTER_F(CollisionCheckerBenchmark, ConfigsExplicit)
+    ->Apply(RegisterModels);
+BENCHMARK_REGISTER_F(CollisionCheckerBenchmark, EdgesImplicit)
+    ->Apply(RegisterModels);
+BENCHMARK_REGISTER_F(CollisionCheckerBenchmark, EdgesExplicit)
+    ->Apply(RegisterModels);
+BENCHMARK_REGISTER_F(CollisionCheckerBenchmark, ClearanceImplicit)
+    ->Apply(RegisterModels);
+BENCHMARK_REGISTER_F(CollisionCheckerBenchmark, ClearanceExplicit)
+    ->Apply(RegisterModels);
+
+}  // namespace
+}  // namespace planning
+}  // namespace drake
+
+BENCHMARK_MAIN();
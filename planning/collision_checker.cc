@@ -26,6 +26,7 @@ namespace planning {
 
 using common_robotics_utilities::openmp_helpers::GetContextOmpThreadNum;
 using common_robotics_utilities::parallelism::DegreeOfParallelism;
+using common_robotics_utilities::parallelism::DynamicParallelForIndexLoop;
 using common_robotics_utilities::parallelism::ParallelForBackend;
 using common_robotics_utilities::parallelism::StaticParallelForIndexLoop;
 using geometry::GeometryId;
@@ -211,6 +212,27 @@ std::vector<int> CalcUncontrolledDofsThatKinematicallyAffectTheRobot(
   return result;
 }
 
+// Returns the steps [0, num_steps) of an edge (i.e., the samples at ratios
+// step / num_steps) in bisection order: the start, then the midpoint, then the
+// quarter points, and so on. Edges in collision are usually in collision over
+// an interval rather than at a single sample, so checking in this order finds
+// a collision after fewer samples (on average) than walking the edge.
+std::vector<int> MakeBisectionStepOrder(int num_steps) {
+  std::vector<int> order;
+  order.reserve(num_steps);
+  order.push_back(0);
+  int stride = 1;
+  while (stride < num_steps) {
+    stride *= 2;
+  }
+  for (; stride > 1; stride /= 2) {
+    for (int step = stride / 2; step < num_steps; step += stride) {
+      order.push_back(step);
+    }
+  }
+  return order;
+}
+
 }  // namespace
 
 CollisionChecker::~CollisionChecker() = default;
@@ -263,26 +285,71 @@ bool CollisionChecker::AddCollisionShape(
 int CollisionChecker::AddCollisionShapes(
     const std::string& group_name,
     const std::vector<BodyShapeDescription>& descriptions) {
-  int added = 0;
-  for (const auto& body_shape : descriptions) {
-    if (AddCollisionShape(group_name, body_shape)) {
-      ++added;
-    }
-  }
-  return added;
+  return UpdateCollisionShapes({}, {{group_name, descriptions}}).at(group_name);
 }
 
 std::map<std::string, int> CollisionChecker::AddCollisionShapes(
     const std::map<std::string, std::vector<BodyShapeDescription>>&
         geometry_groups) {
+  return UpdateCollisionShapes({}, geometry_groups);
+}
+
+std::map<std::string, int> CollisionChecker::UpdateCollisionShapes(
+    const std::vector<std::string>& groups_to_remove,
+    const std::map<std::string, std::vector<BodyShapeDescription>>&
+        groups_to_add) {
+  // Remove the old shapes all at once.
+  std::vector<AddedShape> removed_shapes;
+  for (const std::string& group_name : groups_to_remove) {
+    auto iter = geometry_groups_.find(group_name);
+    if (iter != geometry_groups_.end()) {
+      drake::log()->debug("Removing geometries from group [{}].", group_name);
+      removed_shapes.insert(removed_shapes.end(), iter->second.begin(),
+                            iter->second.end());
+      geometry_groups_.erase(iter);
+    }
+  }
+  if (!removed_shapes.empty()) {
+    RemoveAddedGeometries(removed_shapes);
+  }
+
+  // Add the new shapes all at once.
+  std::vector<ShapeToAdd> shapes;
+  for (const auto& [group_name, descriptions] : groups_to_add) {
+    for (const BodyShapeDescription& description : descriptions) {
+      const Body<double>& body = plant().GetBodyByName(
+          description.body_name(),
+          plant().GetModelInstanceByName(description.model_instance_name()));
+      shapes.push_back(ShapeToAdd{group_name, body.index(), description});
+    }
+  }
   std::map<std::string, int> group_added_shapes;
-  for (const auto& [group_name, group_shapes] : geometry_groups) {
-    const int num_added_shapes = AddCollisionShapes(group_name, group_shapes);
-    group_added_shapes.emplace(group_name, num_added_shapes);
+  for (const auto& group : groups_to_add) {
+    group_added_shapes.emplace(group.first, 0);
+  }
+  if (shapes.empty()) {
+    return group_added_shapes;
+  }
+  const std::vector<std::optional<GeometryId>> geometry_ids =
+      DoAddCollisionShapesToBodies(shapes);
+  DRAKE_DEMAND(geometry_ids.size() == shapes.size());
+  for (size_t i = 0; i < shapes.size(); ++i) {
+    if (geometry_ids[i].has_value()) {
+      geometry_groups_[shapes[i].group_name].push_back(AddedShape{
+          *geometry_ids[i], shapes[i].body_index, shapes[i].description});
+      ++group_added_shapes[shapes[i].group_name];
+    }
   }
   return group_added_shapes;
 }
 
+int CollisionChecker::ReplaceCollisionShapes(
+    const std::string& group_name,
+    const std::vector<BodyShapeDescription>& descriptions) {
+  return UpdateCollisionShapes({group_name}, {{group_name, descriptions}})
+      .at(group_name);
+}
+
 bool CollisionChecker::AddCollisionShapeToFrame(
     const std::string& group_name, const Frame<double>& frameA,
     const Shape& shape, const RigidTransform<double>& X_AG) {
@@ -337,6 +404,19 @@ void CollisionChecker::RemoveAllAddedCollisionShapes() {
   geometry_groups_.clear();
 }
 
+std::vector<std::optional<GeometryId>>
+CollisionChecker::DoAddCollisionShapesToBodies(
+    const std::vector<ShapeToAdd>& shapes) {
+  std::vector<std::optional<GeometryId>> geometry_ids;
+  geometry_ids.reserve(shapes.size());
+  for (const ShapeToAdd& shape : shapes) {
+    geometry_ids.push_back(DoAddCollisionShapeToBody(
+        shape.group_name, get_body(shape.body_index),
+        shape.description.shape(), shape.description.pose_in_body()));
+  }
+  return geometry_ids;
+}
+
 std::optional<double> CollisionChecker::MaybeGetUniformRobotEnvironmentPadding()
     const {
   // TODO(SeanCurtis-TRI): We have three functions that walk a triangular
@@ -468,6 +548,7 @@ void CollisionChecker::SetPaddingAllRobotRobotPairs(const double padding) {
 
 void CollisionChecker::SetCollisionFilterMatrix(
     const Eigen::MatrixXi& filter_matrix) {
+  ThrowIfJointsLocked(__func__);
   // First confirm it is of appropriate *size*.
   if (filter_matrix.rows() != filtered_collisions_.rows() ||
       filter_matrix.cols() != filtered_collisions_.cols()) {
@@ -501,6 +582,7 @@ bool CollisionChecker::IsCollisionFilteredBetween(BodyIndex bodyA_index,
 void CollisionChecker::SetCollisionFilteredBetween(BodyIndex bodyA_index,
                                                    BodyIndex bodyB_index,
                                                    bool filter_collision) {
+  ThrowIfJointsLocked(__func__);
   const int N = filtered_collisions_.rows();
   DRAKE_THROW_UNLESS(bodyA_index >= 0 && bodyA_index < N);
   DRAKE_THROW_UNLESS(bodyB_index >= 0 && bodyB_index < N);
@@ -529,6 +611,7 @@ void CollisionChecker::SetCollisionFilteredBetween(BodyIndex bodyA_index,
 }
 
 void CollisionChecker::SetCollisionFilteredWithAllBodies(BodyIndex body_index) {
+  ThrowIfJointsLocked(__func__);
   DRAKE_THROW_UNLESS(body_index >= 0 &&
                      body_index < filtered_collisions_.rows());
   DRAKE_THROW_UNLESS(IsPartOfRobot(body_index));
@@ -544,6 +627,130 @@ void CollisionChecker::SetCollisionFilteredWithAllBodies(BodyIndex body_index) {
   }
 }
 
+void CollisionChecker::LockJoints(const std::vector<JointIndex>& joints,
+                                  const Eigen::VectorXd& q) {
+  DRAKE_THROW_UNLESS(q.size() == plant().num_positions());
+  UnlockJoints();
+  if (joints.empty()) {
+    return;
+  }
+
+  std::vector<bool> is_joint_locked(plant().num_joints(), false);
+  std::vector<int> position_indices;
+  for (const JointIndex& joint_index : joints) {
+    const Joint<double>& joint = plant().get_joint(joint_index);
+    is_joint_locked[joint_index] = true;
+    for (int i = 0; i < joint.num_positions(); ++i) {
+      position_indices.push_back(joint.position_start() + i);
+    }
+  }
+
+  // A body is locked if every joint with positions on its path to the world is
+  // locked. A body with no inboard joint is floating, and so is never locked.
+  const int num_bodies = plant().num_bodies();
+  std::vector<const Joint<double>*> inboard_joints(num_bodies, nullptr);
+  for (JointIndex j(0); j < plant().num_joints(); ++j) {
+    const Joint<double>& joint = plant().get_joint(j);
+    inboard_joints[joint.child_body().index()] = &joint;
+  }
+  std::vector<bool> is_body_locked(num_bodies, false);
+  for (BodyIndex b(0); b < num_bodies; ++b) {
+    bool locked = true;
+    for (BodyIndex current = b; current != multibody::world_index();) {
+      const Joint<double>* joint = inboard_joints[current];
+      if (joint == nullptr ||
+          (joint->num_positions() > 0 && !is_joint_locked[joint->index()])) {
+        locked = false;
+        break;
+      }
+      current = joint->parent_body().index();
+    }
+    is_body_locked[b] = locked;
+  }
+
+  // Split the unfiltered pairs into those between two locked bodies and the
+  // rest.
+  const Eigen::MatrixXi unlocked_filtered_collisions = filtered_collisions_;
+  Eigen::MatrixXi only_locked_pairs = unlocked_filtered_collisions;
+  Eigen::MatrixXi without_locked_pairs = unlocked_filtered_collisions;
+  int num_locked_pairs = 0;
+  for (int i = 0; i < num_bodies; ++i) {
+    for (int j = i + 1; j < num_bodies; ++j) {
+      if (unlocked_filtered_collisions(i, j) != 0) {
+        continue;
+      }
+      if (is_body_locked[i] && is_body_locked[j]) {
+        without_locked_pairs(i, j) = without_locked_pairs(j, i) = 1;
+        ++num_locked_pairs;
+      } else {
+        only_locked_pairs(i, j) = only_locked_pairs(j, i) = 1;
+      }
+    }
+  }
+
+  // Check the pairs of locked bodies once, with all other pairs filtered.
+  bool in_collision = false;
+  std::vector<RobotCollisionType> body_collisions(
+      num_bodies, RobotCollisionType::kNoCollision);
+  if (num_locked_pairs > 0) {
+    filtered_collisions_ = only_locked_pairs;
+    UpdateCollisionFilters();
+    try {
+      in_collision = !CheckConfigCollisionFree(q);
+      if (in_collision) {
+        body_collisions = ClassifyBodyCollisions(q);
+      }
+    } catch (...) {
+      filtered_collisions_ = unlocked_filtered_collisions;
+      UpdateCollisionFilters();
+      throw;
+    }
+    filtered_collisions_ = without_locked_pairs;
+    UpdateCollisionFilters();
+  }
+  drake::log()->debug(
+      "CollisionChecker::LockJoints(): {} of {} bodies locked; {} body pairs "
+      "cached ({})",
+      std::count(is_body_locked.begin(), is_body_locked.end(), true),
+      num_bodies, num_locked_pairs,
+      in_collision ? "in collision" : "collision free");
+
+  locked_joints_ = joints;
+  locked_position_indices_ = std::move(position_indices);
+  locked_positions_.resize(locked_position_indices_.size());
+  for (int i = 0; i < ssize(locked_position_indices_); ++i) {
+    locked_positions_(i) = q(locked_position_indices_[i]);
+  }
+  is_body_locked_ = std::move(is_body_locked);
+  unlocked_filtered_collisions_ = unlocked_filtered_collisions;
+  locked_bodies_in_collision_ = in_collision;
+  locked_body_collisions_ = std::move(body_collisions);
+}
+
+void CollisionChecker::UnlockJoints() {
+  if (locked_joints_.empty()) {
+    return;
+  }
+  const bool filters_changed =
+      (filtered_collisions_ != unlocked_filtered_collisions_);
+  filtered_collisions_ = unlocked_filtered_collisions_;
+  locked_joints_.clear();
+  locked_position_indices_.clear();
+  locked_positions_.resize(0);
+  is_body_locked_.clear();
+  unlocked_filtered_collisions_.resize(0, 0);
+  locked_bodies_in_collision_ = false;
+  locked_body_collisions_.clear();
+  if (filters_changed) {
+    UpdateCollisionFilters();
+  }
+}
+
+bool CollisionChecker::IsBodyLocked(BodyIndex body_index) const {
+  DRAKE_THROW_UNLESS(body_index >= 0 && body_index < plant().num_bodies());
+  return !is_body_locked_.empty() && is_body_locked_[body_index];
+}
+
 bool CollisionChecker::CheckConfigCollisionFree(
     const Eigen::VectorXd& q, const std::optional<int> context_number) const {
   return CheckContextConfigCollisionFree(&mutable_model_context(context_number),
@@ -554,6 +761,9 @@ bool CollisionChecker::CheckContextConfigCollisionFree(
     CollisionCheckerContext* model_context, const Eigen::VectorXd& q) const {
   DRAKE_THROW_UNLESS(model_context != nullptr);
   UpdateContextPositions(model_context, q);
+  if (locked_bodies_in_collision_) {
+    return false;
+  }
   return DoCheckContextConfigCollisionFree(*model_context);
 }
 
@@ -679,14 +889,7 @@ bool CollisionChecker::CheckContextEdgeCollisionFree(
     return false;
   }
 
-  const double distance = ComputeConfigurationDistance(q1, q2);
-  const int num_steps =
-      static_cast<int>(std::max(1.0, std::ceil(distance / edge_step_size())));
-  for (int step = 0; step < num_steps; ++step) {
-    const double ratio =
-        static_cast<double>(step) / static_cast<double>(num_steps);
-    const Eigen::VectorXd qinterp =
-        InterpolateBetweenConfigurations(q1, q2, ratio);
+  for (const Eigen::VectorXd& qinterp : MakeEdgeWaypoints(q1, q2)) {
     if (!CheckContextConfigCollisionFree(model_context, qinterp)) {
       return false;
     }
@@ -694,6 +897,21 @@ bool CollisionChecker::CheckContextEdgeCollisionFree(
   return true;
 }
 
+std::vector<Eigen::VectorXd> CollisionChecker::MakeEdgeWaypoints(
+    const Eigen::VectorXd& q1, const Eigen::VectorXd& q2) const {
+  const double distance = ComputeConfigurationDistance(q1, q2);
+  const int num_steps =
+      static_cast<int>(std::max(1.0, std::ceil(distance / edge_step_size())));
+  std::vector<double> ratios;
+  ratios.reserve(num_steps);
+  for (const int step : MakeBisectionStepOrder(num_steps)) {
+    ratios.push_back(static_cast<double>(step) /
+                     static_cast<double>(num_steps));
+  }
+  return distance_and_interpolation_provider_->InterpolateBetweenConfigurations(
+      q1, q2, ratios);
+}
+
 bool CollisionChecker::CheckEdgeCollisionFreeParallel(
     const Eigen::VectorXd& q1, const Eigen::VectorXd& q2,
     const Parallelism parallelize) const {
@@ -716,26 +934,22 @@ bool CollisionChecker::CheckEdgeCollisionFreeParallel(
       return false;
     }
 
-    const double distance = ComputeConfigurationDistance(q1, q2);
-    const int num_steps =
-        static_cast<int>(std::max(1.0, std::ceil(distance / edge_step_size())));
+    const std::vector<Eigen::VectorXd> waypoints = MakeEdgeWaypoints(q1, q2);
     std::atomic<bool> edge_valid(true);
 
-    const auto step_work = [&](const int thread_num, const int64_t step) {
+    // Threads take the waypoints in bisection order, so that a colliding
+    // interval is likely found before the finest samples are checked.
+    const auto step_work = [&](const int thread_num, const int64_t index) {
       if (edge_valid.load()) {
-        const double ratio =
-            static_cast<double>(step) / static_cast<double>(num_steps);
-        const Eigen::VectorXd qinterp =
-            InterpolateBetweenConfigurations(q1, q2, ratio);
-        if (!CheckConfigCollisionFree(qinterp, thread_num)) {
+        if (!CheckConfigCollisionFree(waypoints[index], thread_num)) {
           edge_valid.store(false);
         }
       }
     };
 
-    StaticParallelForIndexLoop(DegreeOfParallelism(number_of_threads), 0,
-                               num_steps, step_work,
-                               ParallelForBackend::BEST_AVAILABLE);
+    DynamicParallelForIndexLoop(DegreeOfParallelism(number_of_threads), 0,
+                                waypoints.size(), step_work,
+                                ParallelForBackend::BEST_AVAILABLE);
 
     return edge_valid.load();
   } else {
@@ -761,9 +975,11 @@ std::vector<uint8_t> CollisionChecker::CheckEdgesCollisionFree(
         CheckEdgeCollisionFree(edge.first, edge.second, thread_num);
   };
 
-  StaticParallelForIndexLoop(DegreeOfParallelism(number_of_threads), 0,
-                             edges.size(), edge_work,
-                             ParallelForBackend::BEST_AVAILABLE);
+  // Edges take very different amounts of work (colliding edges often exit
+  // early, long edges have many samples), so they are scheduled dynamically.
+  DynamicParallelForIndexLoop(DegreeOfParallelism(number_of_threads), 0,
+                              edges.size(), edge_work,
+                              ParallelForBackend::BEST_AVAILABLE);
 
   return collision_checks;
 }
@@ -864,9 +1080,10 @@ std::vector<EdgeMeasure> CollisionChecker::MeasureEdgesCollisionFree(
         MeasureEdgeCollisionFree(edge.first, edge.second, thread_num);
   };
 
-  StaticParallelForIndexLoop(DegreeOfParallelism(number_of_threads), 0,
-                             edges.size(), edge_work,
-                             ParallelForBackend::BEST_AVAILABLE);
+  // As in CheckEdgesCollisionFree(), edges are scheduled dynamically.
+  DynamicParallelForIndexLoop(DegreeOfParallelism(number_of_threads), 0,
+                              edges.size(), edge_work,
+                              ParallelForBackend::BEST_AVAILABLE);
 
   return collision_checks;
 }
@@ -878,6 +1095,60 @@ RobotClearance CollisionChecker::CalcRobotClearance(
                                    influence_distance);
 }
 
+std::vector<RobotClearance> CollisionChecker::CalcRobotClearances(
+    const std::vector<Eigen::VectorXd>& configs,
+    const double influence_distance, const Parallelism parallelize) const {
+  // Validate up front, rather than throwing from within the parallel loop.
+  DRAKE_THROW_UNLESS(influence_distance >= 0.0);
+  DRAKE_THROW_UNLESS(std::isfinite(influence_distance));
+
+  std::vector<RobotClearance> clearances(
+      configs.size(), RobotClearance(plant().num_positions()));
+
+  const int number_of_threads = GetNumberOfThreads(parallelize);
+  drake::log()->debug("CalcRobotClearances uses {} thread(s)",
+                      number_of_threads);
+
+  const auto config_work = [&](const int thread_num, const int64_t index) {
+    clearances.at(index) =
+        CalcRobotClearance(configs.at(index), influence_distance, thread_num);
+  };
+
+  StaticParallelForIndexLoop(DegreeOfParallelism(number_of_threads), 0,
+                             configs.size(), config_work,
+                             ParallelForBackend::BEST_AVAILABLE);
+
+  return clearances;
+}
+
+void CollisionChecker::CalcRobotClearances(
+    const std::vector<Eigen::VectorXd>& configs,
+    const double influence_distance, RobotClearance* clearances,
+    std::vector<int>* row_offsets, const Parallelism parallelize) const {
+  DRAKE_THROW_UNLESS(clearances != nullptr);
+  DRAKE_THROW_UNLESS(row_offsets != nullptr);
+  DRAKE_THROW_UNLESS(clearances->num_positions() == plant().num_positions());
+
+  const std::vector<RobotClearance> per_config =
+      CalcRobotClearances(configs, influence_distance, parallelize);
+
+  row_offsets->resize(configs.size() + 1);
+  (*row_offsets)[0] = 0;
+  for (int i = 0; i < ssize(per_config); ++i) {
+    (*row_offsets)[i + 1] = (*row_offsets)[i] + per_config[i].size();
+  }
+  clearances->Clear();
+  clearances->Reserve(row_offsets->back());
+  for (const RobotClearance& clearance : per_config) {
+    for (int row = 0; row < clearance.size(); ++row) {
+      clearances->Append(
+          clearance.robot_indices()[row], clearance.other_indices()[row],
+          clearance.collision_types()[row], clearance.distances()[row],
+          clearance.jacobians().row(row));
+    }
+  }
+}
+
 RobotClearance CollisionChecker::CalcContextRobotClearance(
     CollisionCheckerContext* model_context, const Eigen::VectorXd& q,
     const double influence_distance) const {
@@ -912,7 +1183,24 @@ std::vector<RobotCollisionType> CollisionChecker::ClassifyContextBodyCollisions(
     CollisionCheckerContext* model_context, const Eigen::VectorXd& q) const {
   DRAKE_THROW_UNLESS(model_context != nullptr);
   UpdateContextPositions(model_context, q);
-  return DoClassifyContextBodyCollisions(*model_context);
+  std::vector<RobotCollisionType> result =
+      DoClassifyContextBodyCollisions(*model_context);
+  // Merge in the cached collisions between locked bodies.
+  if (locked_bodies_in_collision_ &&
+      result.size() == locked_body_collisions_.size()) {
+    for (size_t i = 0; i < result.size(); ++i) {
+      const RobotCollisionType locked = locked_body_collisions_[i];
+      if (locked == RobotCollisionType::kSelfCollision ||
+          locked == RobotCollisionType::kEnvironmentAndSelfCollision) {
+        result[i] = SetInSelfCollision(result[i], true);
+      }
+      if (locked == RobotCollisionType::kEnvironmentCollision ||
+          locked == RobotCollisionType::kEnvironmentAndSelfCollision) {
+        result[i] = SetInEnvironmentCollision(result[i], true);
+      }
+    }
+  }
+  return result;
 }
 
 CollisionChecker::CollisionChecker(CollisionCheckerParams params,
@@ -1043,6 +1331,25 @@ CollisionCheckerContext& CollisionChecker::mutable_model_context(
   return owned_contexts_.get_mutable_model_context(context_index);
 }
 
+void CollisionChecker::ThrowIfJointsLocked(const char* func) const {
+  if (!locked_joints_.empty()) {
+    throw std::logic_error(fmt::format(
+        "CollisionChecker::{}(): collision filters cannot be changed while "
+        "joints are locked; call UnlockJoints() first.",
+        func));
+  }
+}
+
+Eigen::VectorXd CollisionChecker::WithLockedPositions(
+    const Eigen::VectorXd& q) const {
+  DRAKE_THROW_UNLESS(q.size() == plant().num_positions());
+  Eigen::VectorXd result = q;
+  for (int i = 0; i < ssize(locked_position_indices_); ++i) {
+    result(locked_position_indices_[i]) = locked_positions_(i);
+  }
+  return result;
+}
+
 void CollisionChecker::ValidateFilteredCollisionMatrix(
     const Eigen::MatrixXi& filtered, const char* func) const {
   DRAKE_THROW_UNLESS(filtered.rows() == filtered.cols());
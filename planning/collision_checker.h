@@ -291,7 +291,12 @@ class CollisionChecker {
   const systems::Context<double>& UpdateContextPositions(
       CollisionCheckerContext* model_context, const Eigen::VectorXd& q) const {
     DRAKE_THROW_UNLESS(model_context != nullptr);
-    plant().SetPositions(&model_context->mutable_plant_context(), q);
+    if (locked_joints_.empty()) {
+      plant().SetPositions(&model_context->mutable_plant_context(), q);
+    } else {
+      plant().SetPositions(&model_context->mutable_plant_context(),
+                           WithLockedPositions(q));
+    }
     DoUpdateContextPositions(model_context);
     return model_context->plant_context();
   }
@@ -381,6 +386,36 @@ class CollisionChecker {
       const std::map<std::string, std::vector<BodyShapeDescription>>&
           geometry_groups);
 
+  /** Applies a batch of changes to the checker geometries: first removes all
+   checker geometries that belong to any of the `groups_to_remove`, then
+   requests the addition of the (shape, body) pairs in `groups_to_add`. The
+   whole batch is handed to the derived checker at once, so that work which a
+   checker would otherwise repeat for every shape (e.g., updating every
+   per-thread context, or updating collision filters) is done only once. This
+   is the preferred way to make large changes to the environment, e.g., to
+   replace the obstacles derived from a sensor with fresh ones.
+
+   @param groups_to_remove  The named geometry groups to remove. Names without
+                            any added geometries are ignored.
+   @param groups_to_add     A map from a named geometry group to the
+                            (shape, body) pairs to add to that group.
+   @returns A map from each named geometry group in `groups_to_add` to the
+            *number* of geometries added to that group. */
+  std::map<std::string, int> UpdateCollisionShapes(
+      const std::vector<std::string>& groups_to_remove,
+      const std::map<std::string, std::vector<BodyShapeDescription>>&
+          groups_to_add);
+
+  /** Replaces all checker geometries in the named group with the (shape, body)
+   pairs in `descriptions`, as a single batch; see UpdateCollisionShapes().
+
+   @param group_name    The name of the group to replace.
+   @param descriptions  The descriptions of N (shape, body) pairs.
+   @returns The total number of shapes in `descriptions` that got added. */
+  int ReplaceCollisionShapes(
+      const std::string& group_name,
+      const std::vector<BodyShapeDescription>& descriptions);
+
   /** Requests the addition of `shape` to the frame A in the checker's model.
    The added `shape` will belong to the named geometry group.
 
@@ -703,6 +738,62 @@ class CollisionChecker {
 
   //@}
 
+  /** @name Locked joints
+
+   When planning for only part of a robot (e.g., one arm of a bimanual robot
+   whose other arm stays still), the joints that don't move can be *locked*.
+   While joints are locked, every query holds them at the positions given to
+   LockJoints(); their values in the configurations passed to the queries are
+   ignored.
+
+   A body is *locked* if its pose doesn't depend on any unlocked joint (i.e.,
+   every joint with positions between it and the world is locked). Whether a
+   pair of locked bodies is in collision can't change while the joints remain
+   locked, so LockJoints() checks those pairs once and then filters them from
+   subsequent queries. Only pairs involving a moving body are queried, which
+   cuts the cost of each query roughly in proportion to the fraction of locked
+   pairs.
+
+   While joints are locked:
+     - If any pair of locked bodies was found in collision, every
+       configuration (and therefore every edge) is reported to be in
+       collision.
+     - ClassifyBodyCollisions() includes the collisions among locked bodies
+       found by LockJoints().
+     - CalcRobotClearance() omits the distances between pairs of locked
+       bodies (their gradients with respect to the positions are zero).
+     - The filtered collision matrix reports the pairs of locked bodies as
+       filtered, and it can't be modified; the functions for configuring
+       collision filters throw.
+
+   Changes to padding or added shapes made while joints are locked don't
+   affect the cached results for pairs of locked bodies. Call LockJoints()
+   again to refresh them. */
+  //@{
+
+  /** Locks the given `joints` at their positions in `q`, replacing any joints
+   that are already locked.
+   @throws std::exception if any joint index is out of range, or if `q` is not
+                          the size of the plant's positions. */
+  void LockJoints(const std::vector<multibody::JointIndex>& joints,
+                  const Eigen::VectorXd& q);
+
+  /** Unlocks all joints, restoring the filtered collision matrix to its value
+   before LockJoints() was called. Does nothing if no joints are locked. */
+  void UnlockJoints();
+
+  /** Returns the locked joints; empty if no joints are locked. */
+  const std::vector<multibody::JointIndex>& GetLockedJoints() const {
+    return locked_joints_;
+  }
+
+  /** Reports whether the body is locked (see above). No body is locked when
+   no joints are locked.
+   @throws std::exception if `body_index` is out of range. */
+  bool IsBodyLocked(multibody::BodyIndex body_index) const;
+
+  //@}
+
   /** @name Configuration collision checking */
   //@{
 
@@ -957,6 +1048,11 @@ class CollisionChecker {
 
   /** Checks a single configuration-to-configuration edge for collision, using
    the current thread's associated context.
+
+   The end configuration `q2` is checked first, then the start configuration
+   `q1`, and then the rest of the samples (spaced by at most edge_step_size())
+   in bisection order (the midpoint, then the quarter points, and so on), so
+   that edges in collision are rejected after as few checks as possible.
    @param q1 Start configuration for edge.
    @param q2 End configuration for edge.
    @param context_number Optional implicit context number.
@@ -987,7 +1083,9 @@ class CollisionChecker {
 
   /** Checks multiple configuration-to-configuration edges for collision.
    Collision checks are parallelized via OpenMP when supported and enabled by
-   `parallelize`.
+   `parallelize`. Edges are scheduled dynamically across threads, so that a
+   few long (or collision free) edges do not leave the other threads idle.
+   Each edge is checked as by CheckEdgeCollisionFree().
    See @ref collision_checker_parallel_edge "function-level parallelism" for
    guidance on proper usage.
    @param edges        Edges to check, each in the form of pair<q1, q2>.
@@ -1085,6 +1183,39 @@ class CollisionChecker {
       CollisionCheckerContext* model_context, const Eigen::VectorXd& q,
       double influence_distance) const;
 
+  /** Calculates the robot clearance (see CalcRobotClearance()) for each of a
+   batch of configurations, evaluating in parallel when supported and enabled
+   by `parallelize` (see CheckConfigsCollisionFree() for the conditions).
+   See @ref collision_checker_parallel_edge "function-level parallelism" for
+   guidance on proper usage.
+   @param configs            Configurations to evaluate.
+   @param influence_distance As for CalcRobotClearance().
+   @param parallelize        How much should the evaluation be parallelized?
+   @returns one RobotClearance for each configuration in `configs`.
+   @throws std::exception if `influence_distance` is negative or not
+                          finite. */
+  std::vector<RobotClearance> CalcRobotClearances(
+      const std::vector<Eigen::VectorXd>& configs, double influence_distance,
+      Parallelism parallelize = Parallelism::Max()) const;
+
+  /** Variant of CalcRobotClearances() that writes the clearances of all of the
+   `configs` into the single table `clearances`, in compressed sparse row form:
+   the rows for `configs[i]` are those in the range
+   [`row_offsets[i]`, `row_offsets[i + 1]`). The storage of both outputs is
+   reused, so that calling this repeatedly (e.g., once per iteration of a
+   trajectory optimizer) does not reallocate them once they are large enough.
+   @param[out] clearances  Overwritten with the rows of every configuration.
+   @param[out] row_offsets Overwritten with `configs.size() + 1` row offsets.
+   @throws std::exception if `influence_distance` is negative or not finite,
+                          if either output is nullptr, or if
+                          `clearances->num_positions()` differs from the
+                          plant's number of positions. */
+  void CalcRobotClearances(const std::vector<Eigen::VectorXd>& configs,
+                           double influence_distance,
+                           RobotClearance* clearances,
+                           std::vector<int>* row_offsets,
+                           Parallelism parallelize = Parallelism::Max()) const;
+
   // TODO(calderpg-tri) Improve MaxNumDistances to use the prototype context
   // instead, and deprecate context-specific forms.
   /** Returns an upper bound on the number of distances returned by
@@ -1208,6 +1339,29 @@ class CollisionChecker {
     BodyShapeDescription description;
   };
 
+  /** Representation of a shape that is requested to be added to the model; see
+   DoAddCollisionShapesToBodies(). */
+  struct ShapeToAdd {
+    /** The name of the group the shape will belong to. */
+    std::string group_name;
+
+    /** The index of the body the shape should be affixed to. */
+    multibody::BodyIndex body_index;
+
+    /** The full body description, including the shape and its pose in the
+     body frame. */
+    BodyShapeDescription description;
+  };
+
+  /** Does the work of adding a batch of shapes, each to be rigidly affixed to
+   its body. Returns the id of each added geometry, or `nullopt` for each shape
+   that the checker ignored (see DoAddCollisionShapeToBody()), in the same order
+   as `shapes`. The default implementation calls DoAddCollisionShapeToBody()
+   for each shape in turn; derived checkers with significant per-call overhead
+   should override it to do that work once per batch. */
+  virtual std::vector<std::optional<geometry::GeometryId>>
+  DoAddCollisionShapesToBodies(const std::vector<ShapeToAdd>& shapes);
+
   /** Removes all of the given added shapes (if they exist) from the checker. */
   virtual void RemoveAddedGeometries(const std::vector<AddedShape>& shapes) = 0;
 
@@ -1267,6 +1421,20 @@ class CollisionChecker {
   void ValidateFilteredCollisionMatrix(const Eigen::MatrixXi& filtered,
                                        const char* func) const;
 
+  /* Throws if any joints are locked; the collision filters can't be changed
+   while they are. */
+  void ThrowIfJointsLocked(const char* func) const;
+
+  /* Returns a copy of `q` with the locked joints' positions overwritten by
+   their locked values. */
+  Eigen::VectorXd WithLockedPositions(const Eigen::VectorXd& q) const;
+
+  /* Returns the configurations that CheckEdgeCollisionFree() checks along the
+   edge from `q1` to `q2` (all but q2 itself), in bisection order, generated
+   with a single call to the distance and interpolation provider. */
+  std::vector<Eigen::VectorXd> MakeEdgeWaypoints(
+      const Eigen::VectorXd& q1, const Eigen::VectorXd& q2) const;
+
   /* The "nominal" collision matrix. This is intended to be called only upon
    construction.
 
@@ -1495,6 +1663,23 @@ class CollisionChecker {
    setup time. */
   Eigen::MatrixXi nominal_filtered_collisions_;
 
+  /* The state of LockJoints(). No joints are locked iff locked_joints_ is
+   empty, in which case the remaining members are empty, too. */
+  std::vector<multibody::JointIndex> locked_joints_;
+  /* The indices in q of the locked joints' positions, and their values. */
+  std::vector<int> locked_position_indices_;
+  Eigen::VectorXd locked_positions_;
+  /* Indexed by BodyIndex. */
+  std::vector<bool> is_body_locked_;
+  /* The filtered collision matrix before the pairs of locked bodies were
+   filtered; restored by UnlockJoints(). */
+  Eigen::MatrixXi unlocked_filtered_collisions_;
+  /* The cached result of checking the pairs of locked bodies: whether any of
+   them are in collision, and the per-body classification of those
+   collisions (indexed by BodyIndex). */
+  bool locked_bodies_in_collision_{false};
+  std::vector<RobotCollisionType> locked_body_collisions_;
+
   /* We maintain a "zero configuration" of the model. */
   Eigen::VectorXd zero_configuration_;
 
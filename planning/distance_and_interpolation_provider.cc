@@ -31,7 +31,37 @@ DistanceAndInterpolationProvider::InterpolateBetweenConfigurations(
   return interpolated;
 }
 
+std::vector<Eigen::VectorXd>
+DistanceAndInterpolationProvider::InterpolateBetweenConfigurations(
+    const Eigen::VectorXd& from, const Eigen::VectorXd& to,
+    const std::vector<double>& ratios) const {
+  DRAKE_THROW_UNLESS(from.size() == to.size());
+  for (const double ratio : ratios) {
+    DRAKE_THROW_UNLESS(ratio >= 0.0);
+    DRAKE_THROW_UNLESS(ratio <= 1.0);
+  }
+  std::vector<Eigen::VectorXd> interpolated =
+      DoInterpolateAtRatios(from, to, ratios);
+  DRAKE_THROW_UNLESS(interpolated.size() == ratios.size());
+  for (const Eigen::VectorXd& q : interpolated) {
+    DRAKE_THROW_UNLESS(from.size() == q.size());
+  }
+  return interpolated;
+}
+
 DistanceAndInterpolationProvider::DistanceAndInterpolationProvider() = default;
 
+std::vector<Eigen::VectorXd>
+DistanceAndInterpolationProvider::DoInterpolateAtRatios(
+    const Eigen::VectorXd& from, const Eigen::VectorXd& to,
+    const std::vector<double>& ratios) const {
+  std::vector<Eigen::VectorXd> interpolated;
+  interpolated.reserve(ratios.size());
+  for (const double ratio : ratios) {
+    interpolated.push_back(DoInterpolateBetweenConfigurations(from, to, ratio));
+  }
+  return interpolated;
+}
+
 }  // namespace planning
 }  // namespace drake
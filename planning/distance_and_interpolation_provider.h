@@ -1,5 +1,7 @@
 #pragma once
 
+#include <vector>
+
 #include <Eigen/Core>
 
 #include "drake/common/drake_copyable.h"
@@ -66,6 +68,16 @@ class DistanceAndInterpolationProvider {
                                                    const Eigen::VectorXd& to,
                                                    double ratio) const;
 
+  /** Returns the configurations interpolated between `from` and `to` at each
+  of the `ratios`, in the same order. This gives the same result as calling
+  InterpolateBetweenConfigurations() for each ratio, but lets derived providers
+  share the work across all of the waypoints of an edge.
+  @pre from.size() == to.size()
+  @pre every ratio in [0, 1] */
+  std::vector<Eigen::VectorXd> InterpolateBetweenConfigurations(
+      const Eigen::VectorXd& from, const Eigen::VectorXd& to,
+      const std::vector<double>& ratios) const;
+
  protected:
   DistanceAndInterpolationProvider();
 
@@ -83,6 +95,17 @@ class DistanceAndInterpolationProvider {
   virtual Eigen::VectorXd DoInterpolateBetweenConfigurations(
       const Eigen::VectorXd& from, const Eigen::VectorXd& to,
       double ratio) const = 0;
+
+  /** Derived distance and interpolation providers may override batched
+  interpolation, e.g., to precompute the quantities that do not depend on the
+  ratio. The returned configurations must be the same size as `from` and `to`,
+  and there must be one for each ratio. The default implementation calls
+  DoInterpolateBetweenConfigurations() for each ratio.
+  DistanceAndInterpolationProvider ensures that `from` and `to` are the same
+  size and that every ratio is in [0, 1]. */
+  virtual std::vector<Eigen::VectorXd> DoInterpolateAtRatios(
+      const Eigen::VectorXd& from, const Eigen::VectorXd& to,
+      const std::vector<double>& ratios) const;
 };
 
 }  // namespace planning
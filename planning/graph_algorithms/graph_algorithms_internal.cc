@@ -27,6 +27,48 @@ Eigen::SparseMatrix<bool> ComplementAdjacencyMatrix(
   return ret;
 }
 
+std::vector<VertexSet> MakeNeighborSets(
+    const Eigen::SparseMatrix<bool>& adjacency_matrix) {
+  const int n = adjacency_matrix.rows();
+  DRAKE_DEMAND(adjacency_matrix.cols() == n);
+  std::vector<VertexSet> neighbors(n, VertexSet(n));
+  for (int j = 0; j < adjacency_matrix.outerSize(); ++j) {
+    for (Eigen::SparseMatrix<bool>::InnerIterator it(adjacency_matrix, j); it;
+         ++it) {
+      if (it.value() && it.row() != it.col()) {
+        neighbors[it.col()].insert(it.row());
+      }
+    }
+  }
+  return neighbors;
+}
+
+std::vector<int> FindCliqueGreedily(const std::vector<VertexSet>& neighbors) {
+  const int n = neighbors.size();
+  std::vector<int> clique;
+  // The vertices that are adjacent to every vertex of the clique.
+  VertexSet candidates(n);
+  for (int i = 0; i < n; ++i) {
+    candidates.insert(i);
+  }
+  while (!candidates.empty()) {
+    int best_vertex = -1;
+    int best_degree = -1;
+    for (int v = 0; v < n; ++v) {
+      if (candidates.contains(v)) {
+        const int degree = neighbors[v].IntersectionSize(candidates);
+        if (degree > best_degree) {
+          best_vertex = v;
+          best_degree = degree;
+        }
+      }
+    }
+    clique.push_back(best_vertex);
+    candidates.Intersect(neighbors[best_vertex]);
+  }
+  return clique;
+}
+
 void SymmetrizeTripletList(
     std::vector<Eigen::Triplet<bool>>* expected_entries) {
   expected_entries->reserve(static_cast<int>(2 * expected_entries->size()));
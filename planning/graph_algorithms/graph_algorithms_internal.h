@@ -1,5 +1,7 @@
 #pragma once
 
+#include <bit>
+#include <cstdint>
 #include <memory>
 #include <vector>
 
@@ -22,6 +24,88 @@ Eigen::SparseMatrix<bool> ComplementAdjacencyMatrix(
 // This is useful when constructing adjacency matrices.
 void SymmetrizeTripletList(std::vector<Eigen::Triplet<bool>>* expected_entries);
 
+// A subset of the vertices {0, ..., n-1} of a graph, stored as one bit per
+// vertex. Intersections and cardinalities operate on 64 vertices at a time
+// (the latter using the hardware popcount instruction), which is what makes
+// the combinatorial max clique solvers fast on dense graphs.
+class VertexSet {
+ public:
+  // Constructs the empty subset of {0, ..., n-1}.
+  explicit VertexSet(int n) : words_((n + 63) / 64, 0) {}
+
+  void insert(int i) { words_[i / 64] |= Bit(i); }
+  void erase(int i) { words_[i / 64] &= ~Bit(i); }
+  bool contains(int i) const { return (words_[i / 64] & Bit(i)) != 0; }
+
+  // Returns the number of vertices in this set.
+  int size() const {
+    int result = 0;
+    for (const uint64_t word : words_) {
+      result += std::popcount(word);
+    }
+    return result;
+  }
+
+  bool empty() const {
+    for (const uint64_t word : words_) {
+      if (word != 0) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // Returns the smallest vertex in this set, or -1 if the set is empty.
+  int front() const {
+    for (int w = 0; w < static_cast<int>(words_.size()); ++w) {
+      if (words_[w] != 0) {
+        return 64 * w + std::countr_zero(words_[w]);
+      }
+    }
+    return -1;
+  }
+
+  // Removes from this set the vertices that are not in `other`.
+  void Intersect(const VertexSet& other) {
+    for (int w = 0; w < static_cast<int>(words_.size()); ++w) {
+      words_[w] &= other.words_[w];
+    }
+  }
+
+  // Removes from this set the vertices that are in `other`.
+  void Subtract(const VertexSet& other) {
+    for (int w = 0; w < static_cast<int>(words_.size()); ++w) {
+      words_[w] &= ~other.words_[w];
+    }
+  }
+
+  // Returns the number of vertices that are in both this set and `other`.
+  int IntersectionSize(const VertexSet& other) const {
+    int result = 0;
+    for (int w = 0; w < static_cast<int>(words_.size()); ++w) {
+      result += std::popcount(words_[w] & other.words_[w]);
+    }
+    return result;
+  }
+
+ private:
+  static uint64_t Bit(int i) { return uint64_t{1} << (i % 64); }
+
+  std::vector<uint64_t> words_;
+};
+
+// Given the adjacency matrix of a graph, returns the set of neighbors of each
+// vertex. Self-loops are ignored, i.e. a vertex is never its own neighbor.
+std::vector<VertexSet> MakeNeighborSets(
+    const Eigen::SparseMatrix<bool>& adjacency_matrix);
+
+// Finds a clique of the graph whose vertices have the given `neighbors` by
+// repeatedly adding the vertex (the lowest one among ties) that is adjacent to
+// the most vertices that could still extend the clique. The clique is maximal
+// but not necessarily maximum. Returns the vertices of the clique, in the order
+// they were added.
+std::vector<int> FindCliqueGreedily(const std::vector<VertexSet>& neighbors);
+
 }  // namespace internal
 }  // namespace graph_algorithms
 }  // namespace planning
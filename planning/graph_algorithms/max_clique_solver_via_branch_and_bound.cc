@@ -0,0 +1,173 @@
+#include "drake/planning/graph_algorithms/max_clique_solver_via_branch_and_bound.h"
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+#include "drake/common/parallel_for.h"
+#include "drake/common/ssize.h"
+#include "drake/planning/graph_algorithms/graph_algorithms_internal.h"
+
+namespace drake {
+namespace planning {
+namespace graph_algorithms {
+namespace {
+
+using internal::VertexSet;
+
+// The best clique found so far, shared by the threads that explore the root
+// branches of the search.
+class Incumbent {
+ public:
+  explicit Incumbent(std::vector<int> clique)
+      : size_(ssize(clique)), clique_(std::move(clique)) {}
+
+  int size() const { return size_.load(std::memory_order_relaxed); }
+
+  // Replaces the best clique by `clique` if the latter is larger.
+  void Offer(const std::vector<int>& clique) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (ssize(clique) > size_.load(std::memory_order_relaxed)) {
+      clique_ = clique;
+      size_.store(ssize(clique), std::memory_order_relaxed);
+    }
+  }
+
+  // Only safe to call once the search is over.
+  const std::vector<int>& clique() const { return clique_; }
+
+ private:
+  // Read without the lock to prune the search, so that the threads only
+  // contend when one of them finds a better clique.
+  std::atomic<int> size_;
+  std::mutex mutex_;
+  std::vector<int> clique_;
+};
+
+// Greedily colors the `candidates` so that adjacent vertices have different
+// colors. On return, `order` lists the candidates sorted by color and
+// `num_colors[k]` is the color (counting from 1) of `order[k]`, hence the
+// number of colors used by order[0], ..., order[k]. A clique within those
+// vertices has at most num_colors[k] vertices.
+void ColorCandidates(const std::vector<VertexSet>& neighbors,
+                     const VertexSet& candidates, std::vector<int>* order,
+                     std::vector<int>* num_colors) {
+  VertexSet uncolored = candidates;
+  for (int color = 1; !uncolored.empty(); ++color) {
+    // The uncolored vertices that are not adjacent to any vertex that was
+    // already given this color.
+    VertexSet available = uncolored;
+    for (int v = available.front(); v >= 0; v = available.front()) {
+      available.erase(v);
+      available.Subtract(neighbors[v]);
+      uncolored.erase(v);
+      order->push_back(v);
+      num_colors->push_back(color);
+    }
+  }
+}
+
+// Searches for cliques larger than the incumbent that extend `clique` with
+// some of the `candidates`, each of which is adjacent to every vertex of
+// `clique`.
+void Expand(const std::vector<VertexSet>& neighbors, VertexSet candidates,
+            std::vector<int>* clique, Incumbent* best) {
+  std::vector<int> order;
+  std::vector<int> num_colors;
+  ColorCandidates(neighbors, candidates, &order, &num_colors);
+  const int clique_size = ssize(*clique);
+  for (int k = ssize(order) - 1; k >= 0; --k) {
+    // The bound only decreases as k decreases, so no later branch can improve
+    // on the incumbent either.
+    if (clique_size + num_colors[k] <= best->size()) {
+      return;
+    }
+    const int v = order[k];
+    VertexSet next = candidates;
+    next.Intersect(neighbors[v]);
+    clique->push_back(v);
+    if (next.empty()) {
+      best->Offer(*clique);
+    } else {
+      Expand(neighbors, std::move(next), clique, best);
+    }
+    clique->pop_back();
+    candidates.erase(v);
+  }
+}
+
+}  // namespace
+
+VectorX<bool> MaxCliqueSolverViaBranchAndBound::DoSolveMaxClique(
+    const Eigen::SparseMatrix<bool>& adjacency_matrix) const {
+  const int n = adjacency_matrix.rows();
+  const std::vector<VertexSet> original_neighbors =
+      internal::MakeNeighborSets(adjacency_matrix);
+
+  // Relabel the vertices in order of decreasing degree, so that the coloring
+  // (which colors the lowest vertices first) gives tighter bounds.
+  std::vector<int> degrees(n);
+  for (int v = 0; v < n; ++v) {
+    degrees[v] = original_neighbors[v].size();
+  }
+  std::vector<int> original_vertex(n);
+  std::iota(original_vertex.begin(), original_vertex.end(), 0);
+  std::stable_sort(original_vertex.begin(), original_vertex.end(),
+                   [&degrees](int a, int b) {
+                     return degrees[a] > degrees[b];
+                   });
+  std::vector<VertexSet> neighbors(n, VertexSet(n));
+  for (int a = 0; a < n; ++a) {
+    for (int b = 0; b < n; ++b) {
+      if (original_neighbors[original_vertex[a]].contains(original_vertex[b])) {
+        neighbors[a].insert(b);
+      }
+    }
+  }
+
+  Incumbent best(internal::FindCliqueGreedily(neighbors));
+
+  // The root branches are those of Expand() for an empty clique, except that
+  // each is explored independently: the candidates of the branch of order[k]
+  // are its neighbors among order[0], ..., order[k-1].
+  VertexSet all_vertices(n);
+  for (int v = 0; v < n; ++v) {
+    all_vertices.insert(v);
+  }
+  std::vector<int> order;
+  std::vector<int> num_colors;
+  ColorCandidates(neighbors, all_vertices, &order, &num_colors);
+  // Hand out the branches with the largest bounds first, since they are the
+  // most likely to raise the incumbent and prune the rest.
+  drake::internal::ParallelFor(parallelism_, n, [&](int i) {
+    const int k = n - 1 - i;
+    if (num_colors[k] <= best.size()) {
+      return;
+    }
+    const int v = order[k];
+    VertexSet candidates(n);
+    for (int j = 0; j < k; ++j) {
+      candidates.insert(order[j]);
+    }
+    candidates.Intersect(neighbors[v]);
+    std::vector<int> clique{v};
+    if (candidates.empty()) {
+      best.Offer(clique);
+    } else {
+      Expand(neighbors, std::move(candidates), &clique, &best);
+    }
+  });
+
+  VectorX<bool> result = VectorX<bool>::Constant(n, false);
+  for (const int v : best.clique()) {
+    result(original_vertex[v]) = true;
+  }
+  return result;
+}
+
+}  // namespace graph_algorithms
+}  // namespace planning
+}  // namespace drake
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <Eigen/Sparse>
+
+#include "drake/common/parallelism.h"
+#include "drake/planning/graph_algorithms/max_clique_solver_base.h"
+
+namespace drake {
+namespace planning {
+namespace graph_algorithms {
+
+/**
+ * Solves the maximum clique problem to global optimality via a combinatorial
+ * branch and bound, without the need for a Mixed-Integer Programming solver.
+ *
+ * The search grows a clique one vertex at a time, keeping the set of candidate
+ * vertices that are adjacent to every vertex of the clique. Each branch is
+ * bounded by a greedy coloring of its candidates: vertices of the same color
+ * are pairwise non-adjacent, so a clique can contain at most one vertex of each
+ * color, and a branch whose clique plus number of colors is no larger than the
+ * best clique found so far is pruned. The vertex sets are stored as bitsets, so
+ * that the intersections and cardinalities at the heart of the search operate
+ * on 64 vertices per instruction. The best clique is initialized with the
+ * result of MaxCliqueSolverViaGreedy.
+ *
+ * The branches at the root of the search (one per vertex) are explored in
+ * parallel, sharing the size of the best clique found so far for the purpose of
+ * pruning. The size of the returned clique does not depend on the parallelism,
+ * but when the graph has several maximum cliques, which of them is returned may
+ * differ from one parallel solve to the next.
+ *
+ * Although this solver typically handles graphs with thousands of vertices, the
+ * problem is NP-complete and so its worst-case cost is exponential in the
+ * number of vertices.
+ */
+class MaxCliqueSolverViaBranchAndBound final : public MaxCliqueSolverBase {
+ public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(MaxCliqueSolverViaBranchAndBound);
+  MaxCliqueSolverViaBranchAndBound() = default;
+
+  /** Constructs the solver to use (at most) the given `parallelism`. */
+  explicit MaxCliqueSolverViaBranchAndBound(Parallelism parallelism)
+      : parallelism_{parallelism} {}
+
+  void SetParallelism(Parallelism parallelism) { parallelism_ = parallelism; }
+
+  [[nodiscard]] Parallelism GetParallelism() const { return parallelism_; }
+
+ private:
+  VectorX<bool> DoSolveMaxClique(
+      const Eigen::SparseMatrix<bool>& adjacency_matrix) const final;
+
+  /* The parallelism used to explore the root branches of the search. */
+  Parallelism parallelism_{Parallelism::Max()};
+};
+
+}  // namespace graph_algorithms
+}  // namespace planning
+}  // namespace drake
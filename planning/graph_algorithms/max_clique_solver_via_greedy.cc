@@ -0,0 +1,25 @@
+#include "drake/planning/graph_algorithms/max_clique_solver_via_greedy.h"
+
+#include <vector>
+
+#include "drake/planning/graph_algorithms/graph_algorithms_internal.h"
+
+namespace drake {
+namespace planning {
+namespace graph_algorithms {
+
+VectorX<bool> MaxCliqueSolverViaGreedy::DoSolveMaxClique(
+    const Eigen::SparseMatrix<bool>& adjacency_matrix) const {
+  const std::vector<int> clique = internal::FindCliqueGreedily(
+      internal::MakeNeighborSets(adjacency_matrix));
+  VectorX<bool> result =
+      VectorX<bool>::Constant(adjacency_matrix.rows(), false);
+  for (const int v : clique) {
+    result(v) = true;
+  }
+  return result;
+}
+
+}  // namespace graph_algorithms
+}  // namespace planning
+}  // namespace drake
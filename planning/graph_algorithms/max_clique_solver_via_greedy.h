@@ -0,0 +1,37 @@
+#pragma once
+
+#include <Eigen/Sparse>
+
+#include "drake/planning/graph_algorithms/max_clique_solver_base.h"
+
+namespace drake {
+namespace planning {
+namespace graph_algorithms {
+
+/**
+ * Approximately solves the maximum clique problem via a greedy heuristic.
+ *
+ * Starting from an empty clique, the solver repeatedly adds the vertex that is
+ * adjacent to the most vertices which could still extend the clique (i.e.,
+ * which are adjacent to every vertex added so far), until no such vertex
+ * remains. The returned clique is maximal (no vertex can be added to it), but
+ * is not necessarily a maximum clique.
+ *
+ * The cost is O(n²) set intersections of n-bit sets for a graph with n
+ * vertices, which makes this solver suitable for very large graphs, or as a
+ * fast first pass before an exact solver such as
+ * MaxCliqueSolverViaBranchAndBound.
+ */
+class MaxCliqueSolverViaGreedy final : public MaxCliqueSolverBase {
+ public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(MaxCliqueSolverViaGreedy);
+  MaxCliqueSolverViaGreedy() = default;
+
+ private:
+  VectorX<bool> DoSolveMaxClique(
+      const Eigen::SparseMatrix<bool>& adjacency_matrix) const final;
+};
+
+}  // namespace graph_algorithms
+}  // namespace planning
+}  // namespace drake
@@ -0,0 +1,226 @@
+#include "drake/planning/graph_algorithms/max_clique_solver_via_branch_and_bound.h"
+
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/planning/graph_algorithms/test/common_graphs.h"
+
+namespace drake {
+namespace planning {
+namespace graph_algorithms {
+namespace {
+
+using Eigen::Triplet;
+
+// Test maximum clique solved via branch and bound, both serially and in
+// parallel. Compare against the expected size of the solution and ensure that
+// the result is one of the true maximum cliques in the graph.
+void TestMaxCliqueViaBranchAndBound(
+    const Eigen::Ref<const Eigen::SparseMatrix<bool>>& adjacency_matrix,
+    const int expected_size,
+    const std::vector<VectorX<bool>>& possible_solutions) {
+  for (const int num_threads : {1, 4}) {
+    MaxCliqueSolverViaBranchAndBound solver{Parallelism(num_threads)};
+    VectorX<bool> max_clique_inds = solver.SolveMaxClique(adjacency_matrix);
+    EXPECT_EQ(max_clique_inds.cast<int>().sum(), expected_size);
+    bool solution_match_found = false;
+    for (const auto& possible_solution : possible_solutions) {
+      if (max_clique_inds.cast<int>() == possible_solution.cast<int>()) {
+        solution_match_found = true;
+        break;
+      }
+    }
+    EXPECT_TRUE(solution_match_found);
+  }
+}
+
+// Returns a random graph with n vertices, in which each edge is present with
+// the given probability.
+Eigen::SparseMatrix<bool> MakeRandomGraph(int n, double density,
+                                          std::mt19937* generator) {
+  std::bernoulli_distribution has_edge(density);
+  std::vector<Triplet<bool>> triplets;
+  for (int i = 0; i < n; ++i) {
+    for (int j = i + 1; j < n; ++j) {
+      if (has_edge(*generator)) {
+        triplets.emplace_back(i, j, true);
+        triplets.emplace_back(j, i, true);
+      }
+    }
+  }
+  Eigen::SparseMatrix<bool> graph(n, n);
+  graph.setFromTriplets(triplets.begin(), triplets.end());
+  return graph;
+}
+
+bool IsClique(const Eigen::SparseMatrix<bool>& graph,
+              const VectorX<bool>& vertices) {
+  for (int i = 0; i < vertices.size(); ++i) {
+    for (int j = i + 1; j < vertices.size(); ++j) {
+      if (vertices(i) && vertices(j) && !graph.coeff(i, j)) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+// Finds the size of the maximum clique by enumerating every subset of the
+// vertices.
+int BruteForceCliqueNumber(const Eigen::SparseMatrix<bool>& graph) {
+  const int n = graph.rows();
+  int result = 0;
+  for (int subset = 0; subset < (1 << n); ++subset) {
+    VectorX<bool> vertices(n);
+    for (int i = 0; i < n; ++i) {
+      vertices(i) = (subset >> i) & 1;
+    }
+    if (vertices.cast<int>().sum() > result && IsClique(graph, vertices)) {
+      result = vertices.cast<int>().sum();
+    }
+  }
+  return result;
+}
+
+GTEST_TEST(MaxCliqueSolverViaBranchAndBoundTest,
+           TestConstructorSettersAndGetters) {
+  MaxCliqueSolverViaBranchAndBound solver{};
+  EXPECT_EQ(solver.GetParallelism().num_threads(),
+            Parallelism::Max().num_threads());
+  solver.SetParallelism(Parallelism(3));
+  EXPECT_EQ(solver.GetParallelism().num_threads(), 3);
+
+  MaxCliqueSolverViaBranchAndBound solver2{Parallelism::None()};
+  EXPECT_EQ(solver2.GetParallelism().num_threads(), 1);
+}
+
+GTEST_TEST(MaxCliqueSolverViaBranchAndBoundTest, NoEdges) {
+  // Without edges, the maximum cliques are the single vertices.
+  std::vector<VectorX<bool>> possible_solutions;
+  for (int i = 0; i < 3; ++i) {
+    VectorX<bool> solution = VectorX<bool>::Constant(3, false);
+    solution(i) = true;
+    possible_solutions.push_back(solution);
+  }
+  TestMaxCliqueViaBranchAndBound(Eigen::SparseMatrix<bool>(3, 3), 1,
+                                 possible_solutions);
+}
+
+GTEST_TEST(MaxCliqueSolverViaBranchAndBoundTest, CompleteGraph) {
+  for (const auto n : {3, 8, 100}) {
+    // The entire graph forms a clique.
+    std::vector<VectorX<bool>> possible_solutions{
+        VectorX<bool>::Constant(n, true)};
+    Eigen::SparseMatrix<bool> graph = internal::MakeCompleteGraph(n);
+    TestMaxCliqueViaBranchAndBound(graph, n, possible_solutions);
+  }
+}
+
+GTEST_TEST(MaxCliqueSolverViaBranchAndBoundTest, BullGraph) {
+  VectorX<bool> solution(5);
+  // The largest clique is (1,2,3).
+  solution << false, true, true, true, false;
+  std::vector<VectorX<bool>> possible_solutions{solution};
+  TestMaxCliqueViaBranchAndBound(internal::BullGraph(), 3, possible_solutions);
+}
+
+GTEST_TEST(MaxCliqueSolverViaBranchAndBoundTest, ButterflyWithSelfLoops) {
+  // The max clique should not change if we allow self loops in the adjacency.
+  Eigen::SparseMatrix<bool> graph_no_loops = internal::ButterflyGraph();
+  std::vector<Triplet<bool>> triplets_identity;
+  for (int i = 0; i < graph_no_loops.rows(); ++i) {
+    triplets_identity.push_back(Triplet<bool>(i, i, 1));
+  }
+  Eigen::SparseMatrix<bool> identity(graph_no_loops.rows(),
+                                     graph_no_loops.rows());
+  identity.setFromTriplets(triplets_identity.begin(), triplets_identity.end());
+
+  VectorX<bool> solution1(5);
+  VectorX<bool> solution2(5);
+  // The largest cliques are (0,1,2) and (2,3,4).
+  solution1 << true, true, true, false, false;
+  solution2 << false, false, true, true, true;
+  std::vector<VectorX<bool>> possible_solutions{solution1, solution2};
+
+  TestMaxCliqueViaBranchAndBound(graph_no_loops, 3, possible_solutions);
+  TestMaxCliqueViaBranchAndBound(
+      (graph_no_loops + identity).template cast<bool>(), 3, possible_solutions);
+}
+
+GTEST_TEST(MaxCliqueSolverViaBranchAndBoundTest, PetersenGraph) {
+  // The Petersen graph has a clique number of size 2, so all edges are possible
+  // solutions.
+  Eigen::SparseMatrix<bool> graph = internal::PetersenGraph();
+  std::vector<VectorX<bool>> possible_solutions;
+  possible_solutions.reserve(graph.nonZeros());
+  for (int i = 0; i < graph.outerSize(); ++i) {
+    for (Eigen::SparseMatrix<bool>::InnerIterator it(graph, i); it; ++it) {
+      VectorX<bool> solution = VectorX<bool>::Constant(10, false);
+      solution(it.row()) = true;
+      solution(it.col()) = true;
+      possible_solutions.push_back(solution);
+    }
+  }
+  TestMaxCliqueViaBranchAndBound(graph, 2, possible_solutions);
+}
+
+// Compares against an exhaustive search on random graphs of various densities.
+GTEST_TEST(MaxCliqueSolverViaBranchAndBoundTest, RandomGraphs) {
+  std::mt19937 generator(1234);
+  for (const double density : {0.2, 0.5, 0.8}) {
+    for (int trial = 0; trial < 5; ++trial) {
+      const Eigen::SparseMatrix<bool> graph =
+          MakeRandomGraph(14, density, &generator);
+      const int expected_size = BruteForceCliqueNumber(graph);
+      for (const int num_threads : {1, 4}) {
+        MaxCliqueSolverViaBranchAndBound solver{Parallelism(num_threads)};
+        const VectorX<bool> clique = solver.SolveMaxClique(graph);
+        EXPECT_EQ(clique.cast<int>().sum(), expected_size);
+        EXPECT_TRUE(IsClique(graph, clique));
+      }
+    }
+  }
+}
+
+// A graph with more than 64 vertices (so that the vertex sets span several
+// words), with a planted clique that is much larger than the other cliques.
+GTEST_TEST(MaxCliqueSolverViaBranchAndBoundTest, PlantedClique) {
+  const int n = 150;
+  std::mt19937 generator(42);
+  Eigen::SparseMatrix<bool> graph = MakeRandomGraph(n, 0.3, &generator);
+  VectorX<bool> planted = VectorX<bool>::Constant(n, false);
+  for (int i = 3; i < n; i += 7) {
+    planted(i) = true;
+  }
+  for (int i = 0; i < n; ++i) {
+    for (int j = 0; j < n; ++j) {
+      if (i != j && planted(i) && planted(j)) {
+        graph.coeffRef(i, j) = true;
+      }
+    }
+  }
+  for (const int num_threads : {1, 4}) {
+    MaxCliqueSolverViaBranchAndBound solver{Parallelism(num_threads)};
+    const VectorX<bool> clique = solver.SolveMaxClique(graph);
+    EXPECT_EQ(clique.cast<int>(), planted.cast<int>());
+  }
+}
+
+GTEST_TEST(MaxCliqueSolverViaBranchAndBoundTest, AdjacencyNotSymmetric) {
+  std::vector<Triplet<bool>> triplets;
+  triplets.push_back(Triplet<bool>(0, 1, 1));
+  triplets.push_back(Triplet<bool>(0, 2, 1));
+  Eigen::SparseMatrix<bool> graph(3, 3);
+  graph.setFromTriplets(triplets.begin(), triplets.end());
+  MaxCliqueSolverViaBranchAndBound solver{};
+  // Cast to void due to since we expect it to throw, but SolveMaxClique is
+  // marked as nodiscard.
+  EXPECT_THROW((void)solver.SolveMaxClique(graph), std::runtime_error);
+}
+
+}  // namespace
+}  // namespace graph_algorithms
+}  // namespace planning
+}  // namespace drake
@@ -0,0 +1,102 @@
+#include "drake/planning/graph_algorithms/max_clique_solver_via_greedy.h"
+
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/planning/graph_algorithms/test/common_graphs.h"
+
+namespace drake {
+namespace planning {
+namespace graph_algorithms {
+namespace {
+
+using Eigen::Triplet;
+
+GTEST_TEST(MaxCliqueSolverViaGreedyTest, CompleteGraph) {
+  MaxCliqueSolverViaGreedy solver{};
+  for (const auto n : {3, 8, 100}) {
+    // The entire graph forms a clique.
+    const VectorX<bool> clique =
+        solver.SolveMaxClique(internal::MakeCompleteGraph(n));
+    EXPECT_EQ(clique.cast<int>(), VectorX<int>::Constant(n, 1));
+  }
+}
+
+GTEST_TEST(MaxCliqueSolverViaGreedyTest, BullGraph) {
+  // Vertices 1, 2 and 3 have the highest degrees, and form the largest clique.
+  VectorX<bool> solution(5);
+  solution << false, true, true, true, false;
+  MaxCliqueSolverViaGreedy solver{};
+  EXPECT_EQ(solver.SolveMaxClique(internal::BullGraph()).cast<int>(),
+            solution.cast<int>());
+}
+
+GTEST_TEST(MaxCliqueSolverViaGreedyTest, ButterflyWithSelfLoops) {
+  // Self loops do not change the degrees, so the result is the same.
+  Eigen::SparseMatrix<bool> graph = internal::ButterflyGraph();
+  for (int i = 0; i < graph.rows(); ++i) {
+    graph.coeffRef(i, i) = true;
+  }
+  // The center vertex 2 is chosen first, then the lowest of the ties.
+  VectorX<bool> solution(5);
+  solution << true, true, true, false, false;
+  MaxCliqueSolverViaGreedy solver{};
+  EXPECT_EQ(solver.SolveMaxClique(internal::ButterflyGraph()).cast<int>(),
+            solution.cast<int>());
+  EXPECT_EQ(solver.SolveMaxClique(graph).cast<int>(), solution.cast<int>());
+}
+
+// On random graphs, the result is always a maximal clique: every vertex is
+// adjacent to every other vertex of the clique, and every vertex outside of the
+// clique is not adjacent to at least one vertex of the clique.
+GTEST_TEST(MaxCliqueSolverViaGreedyTest, RandomGraphs) {
+  std::mt19937 generator(1234);
+  MaxCliqueSolverViaGreedy solver{};
+  for (const double density : {0.1, 0.5, 0.9}) {
+    const int n = 100;
+    std::bernoulli_distribution has_edge(density);
+    std::vector<Triplet<bool>> triplets;
+    for (int i = 0; i < n; ++i) {
+      for (int j = i + 1; j < n; ++j) {
+        if (has_edge(generator)) {
+          triplets.emplace_back(i, j, true);
+          triplets.emplace_back(j, i, true);
+        }
+      }
+    }
+    Eigen::SparseMatrix<bool> graph(n, n);
+    graph.setFromTriplets(triplets.begin(), triplets.end());
+
+    const VectorX<bool> clique = solver.SolveMaxClique(graph);
+    EXPECT_GE(clique.cast<int>().sum(), 1);
+    for (int i = 0; i < n; ++i) {
+      int num_adjacent = 0;
+      for (int j = 0; j < n; ++j) {
+        if (j != i && clique(j) && graph.coeff(i, j)) {
+          ++num_adjacent;
+        }
+      }
+      const int num_others = clique.cast<int>().sum() - (clique(i) ? 1 : 0);
+      EXPECT_EQ(num_adjacent == num_others, clique(i)) << i;
+    }
+  }
+}
+
+GTEST_TEST(MaxCliqueSolverViaGreedyTest, AdjacencyNotSymmetric) {
+  std::vector<Triplet<bool>> triplets;
+  triplets.push_back(Triplet<bool>(0, 1, 1));
+  triplets.push_back(Triplet<bool>(0, 2, 1));
+  Eigen::SparseMatrix<bool> graph(3, 3);
+  graph.setFromTriplets(triplets.begin(), triplets.end());
+  MaxCliqueSolverViaGreedy solver{};
+  // Cast to void due to since we expect it to throw, but SolveMaxClique is
+  // marked as nodiscard.
+  EXPECT_THROW((void)solver.SolveMaxClique(graph), std::runtime_error);
+}
+
+}  // namespace
+}  // namespace graph_algorithms
+}  // namespace planning
+}  // namespace drake
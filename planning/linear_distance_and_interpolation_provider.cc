@@ -1,5 +1,7 @@
 #include "drake/planning/linear_distance_and_interpolation_provider.h"
 
+#include <cmath>
+#include <limits>
 #include <stdexcept>
 
 #include <common_robotics_utilities/math.hpp>
@@ -192,5 +194,62 @@ LinearDistanceAndInterpolationProvider::DoInterpolateBetweenConfigurations(
   return interp;
 }
 
+std::vector<Eigen::VectorXd>
+LinearDistanceAndInterpolationProvider::DoInterpolateAtRatios(
+    const Eigen::VectorXd& from, const Eigen::VectorXd& to,
+    const std::vector<double>& ratios) const {
+  // The slerp between each pair of quaternions only depends on the ratio
+  // through the final weights, so compute its angle once for all of the
+  // ratios. This mirrors Eigen::QuaternionBase::slerp(), so that the results
+  // match DoInterpolateBetweenConfigurations() exactly.
+  struct QuaternionSlerp {
+    int start{};
+    Eigen::Vector4d from_coeffs;
+    Eigen::Vector4d to_coeffs;
+    bool nearly_parallel{};
+    double theta{};
+    double sin_theta{};
+  };
+  std::vector<QuaternionSlerp> slerps;
+  slerps.reserve(quaternion_dof_start_indices().size());
+  for (const int quat_dof_start_index : quaternion_dof_start_indices()) {
+    const Eigen::Quaterniond from_quat(from.segment<4>(quat_dof_start_index));
+    const Eigen::Quaterniond to_quat(to.segment<4>(quat_dof_start_index));
+    QuaternionSlerp& slerp = slerps.emplace_back();
+    slerp.start = quat_dof_start_index;
+    slerp.from_coeffs = from_quat.coeffs();
+    slerp.to_coeffs = to_quat.coeffs();
+    const double d = from_quat.dot(to_quat);
+    if (d < 0.0) {
+      slerp.to_coeffs = -slerp.to_coeffs;
+    }
+    const double abs_d = std::abs(d);
+    slerp.nearly_parallel =
+        abs_d >= 1.0 - std::numeric_limits<double>::epsilon();
+    if (!slerp.nearly_parallel) {
+      slerp.theta = std::acos(abs_d);
+      slerp.sin_theta = std::sin(slerp.theta);
+    }
+  }
+
+  std::vector<Eigen::VectorXd> interpolated;
+  interpolated.reserve(ratios.size());
+  for (const double ratio : ratios) {
+    Eigen::VectorXd& interp =
+        interpolated.emplace_back(InterpolateXd(from, to, ratio));
+    for (const QuaternionSlerp& slerp : slerps) {
+      double scale0 = 1.0 - ratio;
+      double scale1 = ratio;
+      if (!slerp.nearly_parallel) {
+        scale0 = std::sin((1.0 - ratio) * slerp.theta) / slerp.sin_theta;
+        scale1 = std::sin(ratio * slerp.theta) / slerp.sin_theta;
+      }
+      interp.segment<4>(slerp.start) =
+          scale0 * slerp.from_coeffs + scale1 * slerp.to_coeffs;
+    }
+  }
+  return interpolated;
+}
+
 }  // namespace planning
 }  // namespace drake
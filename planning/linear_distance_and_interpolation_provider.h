@@ -67,6 +67,10 @@ class LinearDistanceAndInterpolationProvider final
       const Eigen::VectorXd& from, const Eigen::VectorXd& to,
       double ratio) const final;
 
+  std::vector<Eigen::VectorXd> DoInterpolateAtRatios(
+      const Eigen::VectorXd& from, const Eigen::VectorXd& to,
+      const std::vector<double>& ratios) const final;
+
   const std::vector<int> quaternion_dof_start_indices_;
   const Eigen::VectorXd distance_weights_;
 };
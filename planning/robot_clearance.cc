@@ -9,6 +9,14 @@ using multibody::BodyIndex;
 
 RobotClearance::~RobotClearance() = default;
 
+void RobotClearance::Clear() {
+  robot_indices_.clear();
+  other_indices_.clear();
+  collision_types_.clear();
+  distances_.clear();
+  jacobians_.clear();
+}
+
 void RobotClearance::Reserve(int size) {
   robot_indices_.reserve(size);
   other_indices_.reserve(size);
@@ -116,6 +116,9 @@ class RobotClearance {
     return Eigen::Map<RowMatrixXd>(jacobians_.data(), size(), nq_);
   }
 
+  /** Removes all rows from this table, keeping its storage. */
+  void Clear();
+
   /** Ensures this object has storage for at least `size` rows. */
   void Reserve(int size);
 
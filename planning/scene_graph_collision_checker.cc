@@ -59,25 +59,29 @@ void SceneGraphCollisionChecker::DoUpdateContextPositions(
   // No additional actions are required to update positions.
 }
 
-std::optional<GeometryId> SceneGraphCollisionChecker::DoAddCollisionShapeToBody(
+GeometryInstance SceneGraphCollisionChecker::MakeAddedGeometryInstance(
     const std::string& group_name, const Body<double>& bodyA,
-    const Shape& shape, const RigidTransform<double>& X_AG) {
-  const FrameId body_frame_id = plant().GetBodyFrameIdOrThrow(bodyA.index());
-
-  const GeometrySet bodyA_geometries =
-      plant().CollectRegisteredGeometries(plant().GetBodiesWeldedTo(bodyA));
+    const Shape& shape, const RigidTransform<double>& X_AG) const {
   log()->debug("Adding shape (group: [{}]) to {} (FrameID {}) at X_AG =\n{}",
-               group_name, bodyA.scoped_name(), body_frame_id,
+               group_name, bodyA.scoped_name(),
+               plant().GetBodyFrameIdOrThrow(bodyA.index()),
                fmt_eigen(X_AG.GetAsMatrix4()));
 
-  // The geometry instance template which will be copied into each per-thread
-  // SceneGraph Context; the GeometryId will match across each thread this way.
   GeometryInstance geometry_template(X_AG, shape.Clone(), "temp");
   geometry_template.set_name(fmt::format("Added collision geometry on {} ({})",
                                          bodyA.scoped_name(),
                                          geometry_template.id()));
   // Set proximity properties in order for this geometry to actually collide.
   geometry_template.set_proximity_properties({});
+  return geometry_template;
+}
+
+std::optional<GeometryId> SceneGraphCollisionChecker::DoAddCollisionShapeToBody(
+    const std::string& group_name, const Body<double>& bodyA,
+    const Shape& shape, const RigidTransform<double>& X_AG) {
+  const FrameId body_frame_id = plant().GetBodyFrameIdOrThrow(bodyA.index());
+  const GeometryInstance geometry_template =
+      MakeAddedGeometryInstance(group_name, bodyA, shape, X_AG);
 
   const auto operation = [&](const RobotDiagram<double>& model,
                              CollisionCheckerContext* model_context) {
@@ -95,6 +99,44 @@ std::optional<GeometryId> SceneGraphCollisionChecker::DoAddCollisionShapeToBody(
   return geometry_template.id();
 }
 
+std::vector<std::optional<GeometryId>>
+SceneGraphCollisionChecker::DoAddCollisionShapesToBodies(
+    const std::vector<ShapeToAdd>& shapes) {
+  std::vector<FrameId> body_frame_ids;
+  std::vector<GeometryInstance> geometry_templates;
+  body_frame_ids.reserve(shapes.size());
+  geometry_templates.reserve(shapes.size());
+  for (const ShapeToAdd& shape : shapes) {
+    body_frame_ids.push_back(plant().GetBodyFrameIdOrThrow(shape.body_index));
+    geometry_templates.push_back(MakeAddedGeometryInstance(
+        shape.group_name, get_body(shape.body_index), shape.description.shape(),
+        shape.description.pose_in_body()));
+  }
+
+  // Visit each context once for the whole batch.
+  const auto operation = [&](const RobotDiagram<double>& model,
+                             CollisionCheckerContext* model_context) {
+    auto& sg_context = model_context->mutable_scene_graph_context();
+    for (size_t i = 0; i < geometry_templates.size(); ++i) {
+      model.scene_graph().RegisterGeometry(
+          &sg_context, model.plant().get_source_id().value(),
+          body_frame_ids[i],
+          std::make_unique<GeometryInstance>(geometry_templates[i]));
+    }
+  };
+  PerformOperationAgainstAllModelContexts(operation);
+
+  // Update the filters once for all of the new geometries.
+  ApplyCollisionFiltersToSceneGraph();
+
+  std::vector<std::optional<GeometryId>> geometry_ids;
+  geometry_ids.reserve(shapes.size());
+  for (const GeometryInstance& geometry_template : geometry_templates) {
+    geometry_ids.push_back(geometry_template.id());
+  }
+  return geometry_ids;
+}
+
 void SceneGraphCollisionChecker::RemoveAddedGeometries(
     const std::vector<CollisionChecker::AddedShape>& shapes) {
   const auto operation = [&shapes](const RobotDiagram<double>& model,
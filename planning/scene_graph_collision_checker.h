@@ -5,6 +5,7 @@
 #include <string>
 #include <vector>
 
+#include "drake/geometry/geometry_instance.h"
 #include "drake/planning/collision_checker.h"
 #include "drake/planning/collision_checker_params.h"
 
@@ -44,6 +45,9 @@ class SceneGraphCollisionChecker final : public CollisionChecker {
       const geometry::Shape& shape,
       const math::RigidTransform<double>& X_AG) final;
 
+  std::vector<std::optional<geometry::GeometryId>> DoAddCollisionShapesToBodies(
+      const std::vector<ShapeToAdd>& shapes) final;
+
   void RemoveAddedGeometries(
       const std::vector<CollisionChecker::AddedShape>& shapes) final;
 
@@ -59,6 +63,14 @@ class SceneGraphCollisionChecker final : public CollisionChecker {
   int DoMaxContextNumDistances(
       const CollisionCheckerContext& model_context) const final;
 
+  // Makes the template for a geometry to be added to `bodyA`, to be copied
+  // into each per-thread SceneGraph Context; the GeometryId will match across
+  // each thread this way.
+  geometry::GeometryInstance MakeAddedGeometryInstance(
+      const std::string& group_name, const multibody::Body<double>& bodyA,
+      const geometry::Shape& shape,
+      const math::RigidTransform<double>& X_AG) const;
+
   // Applies filters defined in the filtered collision matrix to SceneGraph.
   // This must be called in the constructor to ensure that additional filters
   // applied by CollisionChecker are present in SceneGraph, and after any
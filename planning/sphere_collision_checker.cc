@@ -0,0 +1,693 @@
+#include "drake/planning/sphere_collision_checker.h"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <map>
+#include <utility>
+
+#include "drake/common/drake_throw.h"
+#include "drake/common/text_logging.h"
+#include "drake/geometry/proximity/obj_to_surface_mesh.h"
+#include "drake/geometry/scene_graph.h"
+#include "drake/geometry/shape_specification.h"
+#include "drake/multibody/plant/multibody_plant.h"
+#include "drake/planning/robot_diagram.h"
+
+namespace drake {
+namespace planning {
+
+using Eigen::Matrix3Xd;
+using Eigen::Matrix4Xd;
+using Eigen::RowVectorXd;
+using Eigen::Vector3d;
+using Eigen::Vector3i;
+using Eigen::VectorXd;
+using geometry::Box;
+using geometry::Capsule;
+using geometry::Convex;
+using geometry::Cylinder;
+using geometry::Ellipsoid;
+using geometry::GeometryId;
+using geometry::Mesh;
+using geometry::QueryObject;
+using geometry::SceneGraphInspector;
+using geometry::Shape;
+using geometry::SignedDistanceToPoint;
+using geometry::Sphere;
+using math::RigidTransform;
+using multibody::Body;
+using multibody::BodyIndex;
+using multibody::Frame;
+using systems::Context;
+
+namespace {
+
+// Boxes are covered with at most this many spheres along each axis, so that
+// thin plates don't explode into a huge number of tiny spheres.
+constexpr int kMaxSpheresPerAxis = 10;
+
+// Covers a shape (in its geometry frame G) with spheres that enclose it.
+class SphereApproximator final : public geometry::ShapeReifier {
+ public:
+  SphereApproximator() = default;
+
+  void Approximate(const Shape& shape, Matrix3Xd* p_GS, VectorXd* radii) {
+    p_GS_ = p_GS;
+    radii_ = radii;
+    shape.Reify(this);
+  }
+
+ private:
+  using ShapeReifier::ImplementGeometry;
+
+  void ImplementGeometry(const Sphere& sphere, void*) final {
+    SetSpheres(Matrix3Xd::Zero(3, 1), VectorXd::Constant(1, sphere.radius()));
+  }
+
+  void ImplementGeometry(const Capsule& capsule, void*) final {
+    // Spheres of the capsule's radius, spaced no more than a radius apart
+    // along the axis from one cap's center to the other.
+    const double length = capsule.length();
+    const double radius = capsule.radius();
+    const int num_spheres =
+        1 + std::max(1, static_cast<int>(std::ceil(length / radius)));
+    Matrix3Xd p_GS = Matrix3Xd::Zero(3, num_spheres);
+    for (int i = 0; i < num_spheres; ++i) {
+      p_GS(2, i) = -length / 2 + length * i / (num_spheres - 1);
+    }
+    SetSpheres(std::move(p_GS), VectorXd::Constant(num_spheres, radius));
+  }
+
+  void ImplementGeometry(const Cylinder& cylinder, void*) final {
+    // Cut the cylinder into slices no thicker than its radius, and cover each
+    // slice with the sphere through its rims.
+    const double length = cylinder.length();
+    const double radius = cylinder.radius();
+    const int num_spheres =
+        std::max(1, static_cast<int>(std::ceil(length / radius)));
+    const double thickness = length / num_spheres;
+    Matrix3Xd p_GS = Matrix3Xd::Zero(3, num_spheres);
+    for (int i = 0; i < num_spheres; ++i) {
+      p_GS(2, i) = -length / 2 + thickness * (i + 0.5);
+    }
+    SetSpheres(std::move(p_GS),
+               VectorXd::Constant(num_spheres,
+                                  std::hypot(radius, thickness / 2)));
+  }
+
+  void ImplementGeometry(const Box& box, void*) final {
+    CoverBox(Vector3d::Zero(), box.size());
+  }
+
+  void ImplementGeometry(const Ellipsoid& ellipsoid, void*) final {
+    CoverBox(Vector3d::Zero(),
+             2 * Vector3d(ellipsoid.a(), ellipsoid.b(), ellipsoid.c()));
+  }
+
+  void ImplementGeometry(const Convex& convex, void*) final {
+    CoverMesh(convex.filename(), convex.scale(), "Convex");
+  }
+
+  void ImplementGeometry(const Mesh& mesh, void*) final {
+    CoverMesh(mesh.filename(), mesh.scale(), "Mesh");
+  }
+
+  // Covers the bounding box of a mesh's vertices.
+  void CoverMesh(const std::string& filename, double scale,
+                 const std::string& shape_name) {
+    const std::string extension =
+        filename.size() >= 4 ? filename.substr(filename.size() - 4) : "";
+    if (extension != ".obj" && extension != ".OBJ") {
+      throw std::logic_error(fmt::format(
+          "SphereCollisionChecker can only approximate {} shapes from .obj "
+          "files; {} is not supported",
+          shape_name, filename));
+    }
+    const geometry::TriangleSurfaceMesh<double> surface_mesh =
+        geometry::ReadObjToTriangleSurfaceMesh(filename, scale);
+    Eigen::AlignedBox3d bounds;
+    for (const Vector3d& p_GV : surface_mesh.vertices()) {
+      bounds.extend(p_GV);
+    }
+    CoverBox(bounds.center(), bounds.sizes());
+  }
+
+  // Covers a box of the given size centered at p_GC with a grid of cells that
+  // are as close to cubes as kMaxSpheresPerAxis allows, each of which is
+  // covered by the sphere through its corners.
+  void CoverBox(const Vector3d& p_GC, const Vector3d& size) {
+    const double cell_size =
+        std::max(size.minCoeff(), size.maxCoeff() / kMaxSpheresPerAxis);
+    Vector3i counts = Vector3i::Ones();
+    if (cell_size > 0) {
+      for (int k = 0; k < 3; ++k) {
+        counts[k] = std::clamp(static_cast<int>(std::ceil(size[k] / cell_size)),
+                               1, kMaxSpheresPerAxis);
+      }
+    }
+    const Vector3d cell = size.cwiseQuotient(counts.cast<double>());
+    const int num_spheres = counts.prod();
+    Matrix3Xd p_GS(3, num_spheres);
+    int s = 0;
+    for (int i = 0; i < counts[0]; ++i) {
+      for (int j = 0; j < counts[1]; ++j) {
+        for (int k = 0; k < counts[2]; ++k) {
+          p_GS.col(s++) =
+              p_GC - size / 2 +
+              cell.cwiseProduct(Vector3d(i + 0.5, j + 0.5, k + 0.5));
+        }
+      }
+    }
+    SetSpheres(std::move(p_GS), VectorXd::Constant(num_spheres,
+                                                   cell.norm() / 2));
+  }
+
+  void SetSpheres(Matrix3Xd p_GS, VectorXd radii) {
+    *p_GS_ = std::move(p_GS);
+    *radii_ = std::move(radii);
+  }
+
+  Matrix3Xd* p_GS_{};
+  VectorXd* radii_{};
+};
+
+// Returns the smallest signed distance between any sphere in A and any sphere
+// in B, along with the indices of the closest pair.
+double CalcSphereSetDistance(const Matrix3Xd& p_WA, const VectorXd& radii_A,
+                             const Matrix3Xd& p_WB, const VectorXd& radii_B,
+                             int* closest_a = nullptr,
+                             int* closest_b = nullptr) {
+  double result = std::numeric_limits<double>::infinity();
+  for (int a = 0; a < p_WA.cols(); ++a) {
+    int b;
+    const double distance =
+        ((p_WB.colwise() - p_WA.col(a)).colwise().norm().transpose() - radii_B)
+            .minCoeff(&b) -
+        radii_A(a);
+    if (distance < result) {
+      result = distance;
+      if (closest_a != nullptr) *closest_a = a;
+      if (closest_b != nullptr) *closest_b = b;
+    }
+  }
+  return result;
+}
+
+}  // namespace
+
+// The signed distance to (part of) the environment, sampled on the vertices of
+// a regular grid of voxels.
+class SphereCollisionChecker::DistanceField {
+ public:
+  // Samples the distance to the geometries that satisfy `include`.
+  DistanceField(const QueryObject<double>& query_object,
+                const std::function<bool(GeometryId)>& include,
+                const SphereCollisionCheckerOptions& options)
+      : origin_(options.workspace.min()), voxel_size_(options.voxel_size) {
+    const Vector3d sizes = options.workspace.sizes();
+    for (int k = 0; k < 3; ++k) {
+      dims_[k] =
+          std::max(2, 1 + static_cast<int>(std::ceil(sizes[k] / voxel_size_)));
+    }
+    distances_.resize(dims_.prod());
+    for (int k = 0; k < dims_[2]; ++k) {
+      for (int j = 0; j < dims_[1]; ++j) {
+        for (int i = 0; i < dims_[0]; ++i) {
+          const Vector3d p_WQ = origin_ + voxel_size_ * Vector3d(i, j, k);
+          double distance = options.max_field_distance;
+          for (const SignedDistanceToPoint<double>& result :
+               query_object.ComputeSignedDistanceToPoint(
+                   p_WQ, options.max_field_distance)) {
+            if (include(result.id_G)) {
+              distance = std::min(distance, result.distance);
+            }
+          }
+          distances_[GetIndex(i, j, k)] = static_cast<float>(distance);
+        }
+      }
+    }
+  }
+
+  // Returns a lower bound on the signed distance from Q to the environment,
+  // and optionally its gradient with respect to p_WQ.
+  double Eval(const Vector3d& p_WQ, Vector3d* grad_W = nullptr) const {
+    // Outside of the grid, extrapolate from the closest point on its boundary
+    // C; since signed distance has a Lipschitz constant of 1, the distance at
+    // Q is at least the distance at C minus |CQ|.
+    const Vector3d p_WC =
+        p_WQ.cwiseMax(origin_).cwiseMin(
+            origin_ + voxel_size_ * (dims_ - Vector3i::Ones()).cast<double>());
+    const Vector3d p_CQ = p_WQ - p_WC;
+    const double outside = p_CQ.norm();
+
+    // Trilinearly interpolate the voxel that holds C.
+    const Vector3d u = (p_WC - origin_) / voxel_size_;
+    Vector3i i0;
+    Vector3d t;
+    for (int k = 0; k < 3; ++k) {
+      i0[k] = std::min(static_cast<int>(std::floor(u[k])), dims_[k] - 2);
+      t[k] = u[k] - i0[k];
+    }
+    double value = 0;
+    Vector3d grad = Vector3d::Zero();
+    for (int corner = 0; corner < 8; ++corner) {
+      const Vector3i offset(corner & 1, (corner >> 1) & 1, (corner >> 2) & 1);
+      const Vector3i index = i0 + offset;
+      const double distance =
+          distances_[GetIndex(index[0], index[1], index[2])];
+      // The weight of each corner is the product of one factor per axis.
+      Vector3d factors;
+      Vector3d dfactors;
+      for (int k = 0; k < 3; ++k) {
+        factors[k] = offset[k] ? t[k] : 1 - t[k];
+        dfactors[k] = offset[k] ? 1 : -1;
+      }
+      value += factors.prod() * distance;
+      grad += distance * Vector3d(dfactors[0] * factors[1] * factors[2],
+                                  factors[0] * dfactors[1] * factors[2],
+                                  factors[0] * factors[1] * dfactors[2]);
+    }
+    grad /= voxel_size_;
+
+    if (grad_W != nullptr) {
+      *grad_W = outside > 0 ? Vector3d(grad - p_CQ / outside) : grad;
+    }
+    // The interpolant exceeds the true distance by at most the weighted mean
+    // distance to the voxel's corners, which is at most √3/2 voxel sizes.
+    return value - outside - std::sqrt(3.0) / 2 * voxel_size_;
+  }
+
+ private:
+  int GetIndex(int i, int j, int k) const {
+    return i + dims_[0] * (j + dims_[1] * k);
+  }
+
+  // The position of the first grid vertex.
+  Vector3d origin_;
+  double voxel_size_{};
+  // The number of grid vertices along each axis.
+  Vector3i dims_;
+  std::vector<float> distances_;
+};
+
+SphereCollisionChecker::SphereCollisionChecker(
+    CollisionCheckerParams params, SphereCollisionCheckerOptions options)
+    : CollisionChecker(std::move(params), true /* supports parallel */),
+      options_(std::move(options)) {
+  DRAKE_THROW_UNLESS(!options_.workspace.isEmpty());
+  DRAKE_THROW_UNLESS(options_.voxel_size > 0);
+  DRAKE_THROW_UNLESS(options_.max_field_distance > 0);
+  AllocateContexts();
+
+  const SceneGraphInspector<double>& inspector =
+      model_context().GetQueryObject().inspector();
+  SphereApproximator approximator;
+  body_spheres_.resize(plant().num_bodies());
+  for (BodyIndex i(0); i < plant().num_bodies(); ++i) {
+    const Body<double>& body = get_body(i);
+    for (const GeometryId id : plant().GetCollisionGeometriesForBody(body)) {
+      const Shape& shape = inspector.GetShape(id);
+      if (IsPartOfRobot(body)) {
+        SphereSet spheres{.id = id};
+        approximator.Approximate(shape, &spheres.p_BS, &spheres.radii);
+        spheres.p_BS = inspector.GetPoseInFrame(id) * spheres.p_BS;
+        body_spheres_[i].push_back(std::move(spheres));
+      } else if (dynamic_cast<const Mesh*>(&shape) != nullptr ||
+                 dynamic_cast<const Convex*>(&shape) != nullptr) {
+        log()->warn(
+            "SphereCollisionChecker ignores the environment geometry {} on {}, "
+            "since its signed distance field does not support meshes",
+            inspector.GetName(id), body.scoped_name());
+      }
+    }
+  }
+  log()->debug("Approximated the robot with {} spheres", num_robot_spheres());
+
+  UpdateBodyPairsAndDistanceFields();
+}
+
+SphereCollisionChecker::SphereCollisionChecker(const SphereCollisionChecker&) =
+    default;
+
+int SphereCollisionChecker::num_robot_spheres() const {
+  int result = 0;
+  for (const auto& sets : body_spheres_) {
+    for (const SphereSet& spheres : sets) {
+      result += spheres.radii.size();
+    }
+  }
+  return result;
+}
+
+Matrix4Xd SphereCollisionChecker::GetBodySpheres(
+    const Body<double>& body) const {
+  const std::vector<SphereSet>& sets = body_spheres_.at(body.index());
+  int num_spheres = 0;
+  for (const SphereSet& spheres : sets) {
+    num_spheres += spheres.radii.size();
+  }
+  Matrix4Xd result(4, num_spheres);
+  int col = 0;
+  for (const SphereSet& spheres : sets) {
+    const int n = spheres.radii.size();
+    result.block(0, col, 3, n) = spheres.p_BS;
+    result.block(3, col, 1, n) = spheres.radii.transpose();
+    col += n;
+  }
+  return result;
+}
+
+std::unique_ptr<CollisionChecker> SphereCollisionChecker::DoClone() const {
+  // N.B. We cannot use make_unique due to private-only access.
+  return std::unique_ptr<SphereCollisionChecker>(
+      new SphereCollisionChecker(*this));
+}
+
+void SphereCollisionChecker::DoUpdateContextPositions(
+    CollisionCheckerContext*) const {
+  // No additional actions are required to update positions.
+}
+
+std::optional<GeometryId> SphereCollisionChecker::DoAddCollisionShapeToBody(
+    const std::string& group_name, const Body<double>& bodyA,
+    const Shape& shape, const RigidTransform<double>& X_AG) {
+  if (!IsPartOfRobot(bodyA)) {
+    log()->debug(
+        "Ignoring shape (group: [{}]) on {}; SphereCollisionChecker does not "
+        "support adding shapes to the environment",
+        group_name, bodyA.scoped_name());
+    return std::nullopt;
+  }
+  SphereSet spheres{.id = GeometryId::get_new_id()};
+  SphereApproximator approximator;
+  approximator.Approximate(shape, &spheres.p_BS, &spheres.radii);
+  spheres.p_BS = X_AG * spheres.p_BS;
+  log()->debug("Adding shape (group: [{}]) to {} as {} spheres", group_name,
+               bodyA.scoped_name(), spheres.radii.size());
+  body_spheres_.at(bodyA.index()).push_back(std::move(spheres));
+  return body_spheres_.at(bodyA.index()).back().id;
+}
+
+void SphereCollisionChecker::RemoveAddedGeometries(
+    const std::vector<CollisionChecker::AddedShape>& shapes) {
+  for (const auto& checker_shape : shapes) {
+    log()->debug("  Removing geometry {}.", checker_shape.geometry_id);
+    std::vector<SphereSet>& sets = body_spheres_.at(checker_shape.body_index);
+    std::erase_if(sets, [&checker_shape](const SphereSet& spheres) {
+      return spheres.id == checker_shape.geometry_id;
+    });
+  }
+}
+
+void SphereCollisionChecker::UpdateCollisionFilters() {
+  UpdateBodyPairsAndDistanceFields();
+}
+
+void SphereCollisionChecker::UpdateBodyPairsAndDistanceFields() {
+  const int num_bodies = plant().num_bodies();
+
+  self_pairs_.clear();
+  for (BodyIndex i(0); i < num_bodies; ++i) {
+    if (!IsPartOfRobot(i)) continue;
+    for (BodyIndex j(i + 1); j < num_bodies; ++j) {
+      if (IsPartOfRobot(j) && !IsCollisionFilteredBetween(i, j)) {
+        self_pairs_.emplace_back(i, j);
+      }
+    }
+  }
+
+  // Only environment bodies with geometry make a difference to the field.
+  std::vector<std::vector<BodyIndex>> filtered_environment(num_bodies);
+  for (BodyIndex i(0); i < num_bodies; ++i) {
+    if (!IsPartOfRobot(i)) continue;
+    for (BodyIndex j(0); j < num_bodies; ++j) {
+      if (!IsPartOfRobot(j) && IsCollisionFilteredBetween(i, j) &&
+          !plant().GetCollisionGeometriesForBody(get_body(j)).empty()) {
+        filtered_environment[i].push_back(j);
+      }
+    }
+  }
+
+  // Reuse the fields we already have, and build any others.
+  std::map<std::vector<BodyIndex>, std::shared_ptr<const DistanceField>>
+      fields;
+  for (size_t i = 0; i < body_fields_.size(); ++i) {
+    if (body_fields_[i] != nullptr) {
+      fields.emplace(filtered_environment_[i], body_fields_[i]);
+    }
+  }
+  std::shared_ptr<CollisionCheckerContext> default_context;
+  std::vector<std::shared_ptr<const DistanceField>> body_fields(num_bodies);
+  for (BodyIndex i(0); i < num_bodies; ++i) {
+    if (!IsPartOfRobot(i)) continue;
+    std::shared_ptr<const DistanceField>& field =
+        fields[filtered_environment[i]];
+    if (field == nullptr) {
+      // Sample the environment in its default configuration.
+      if (default_context == nullptr) {
+        default_context = MakeStandaloneModelContext();
+      }
+      const QueryObject<double>& query_object =
+          default_context->GetQueryObject();
+      const std::vector<BodyIndex>& excluded = filtered_environment[i];
+      const auto include = [this, &query_object, &excluded](GeometryId id) {
+        const Body<double>* body = plant().GetBodyFromFrameId(
+            query_object.inspector().GetFrameId(id));
+        DRAKE_THROW_UNLESS(body != nullptr);
+        return !IsPartOfRobot(*body) &&
+               std::find(excluded.begin(), excluded.end(), body->index()) ==
+                   excluded.end();
+      };
+      log()->debug("Building a signed distance field of the environment");
+      field = std::make_shared<const DistanceField>(query_object, include,
+                                                    options_);
+    }
+    body_fields[i] = field;
+  }
+  filtered_environment_ = std::move(filtered_environment);
+  body_fields_ = std::move(body_fields);
+}
+
+double SphereCollisionChecker::GetEnvironmentPadding(
+    BodyIndex robot_index) const {
+  double result = 0.0;
+  bool found = false;
+  for (BodyIndex j(0); j < plant().num_bodies(); ++j) {
+    if (!IsPartOfRobot(j) && !IsCollisionFilteredBetween(robot_index, j)) {
+      const double padding = GetPaddingBetween(robot_index, j);
+      result = found ? std::max(result, padding) : padding;
+      found = true;
+    }
+  }
+  return result;
+}
+
+std::vector<std::vector<Matrix3Xd>>
+SphereCollisionChecker::CalcSphereCentersInWorld(
+    const CollisionCheckerContext& model_context) const {
+  const Context<double>& plant_context = model_context.plant_context();
+  std::vector<std::vector<Matrix3Xd>> result(body_spheres_.size());
+  for (size_t i = 0; i < body_spheres_.size(); ++i) {
+    if (body_spheres_[i].empty()) continue;
+    const RigidTransform<double>& X_WB =
+        plant().EvalBodyPoseInWorld(plant_context, get_body(BodyIndex(i)));
+    for (const SphereSet& spheres : body_spheres_[i]) {
+      result[i].push_back(X_WB * spheres.p_BS);
+    }
+  }
+  return result;
+}
+
+bool SphereCollisionChecker::DoCheckContextConfigCollisionFree(
+    const CollisionCheckerContext& model_context) const {
+  const std::vector<std::vector<Matrix3Xd>> p_WS =
+      CalcSphereCentersInWorld(model_context);
+
+  for (BodyIndex i(0); i < plant().num_bodies(); ++i) {
+    if (body_spheres_[i].empty()) continue;
+    const DistanceField& field = *body_fields_[i];
+    const double padding = GetEnvironmentPadding(i);
+    for (size_t k = 0; k < body_spheres_[i].size(); ++k) {
+      const VectorXd& radii = body_spheres_[i][k].radii;
+      for (int s = 0; s < radii.size(); ++s) {
+        if (field.Eval(p_WS[i][k].col(s)) - radii(s) <= padding) {
+          log()->trace("Environment collision of body [{}]",
+                       get_body(i).scoped_name());
+          return false;
+        }
+      }
+    }
+  }
+
+  for (const auto& [a, b] : self_pairs_) {
+    if (body_spheres_[a].empty() || body_spheres_[b].empty()) continue;
+    const double padding = GetPaddingBetween(a, b);
+    for (size_t k = 0; k < body_spheres_[a].size(); ++k) {
+      for (size_t m = 0; m < body_spheres_[b].size(); ++m) {
+        if (CalcSphereSetDistance(p_WS[a][k], body_spheres_[a][k].radii,
+                                  p_WS[b][m], body_spheres_[b][m].radii) <=
+            padding) {
+          log()->trace("Self collision between bodies [{}] and [{}]",
+                       get_body(a).scoped_name(), get_body(b).scoped_name());
+          return false;
+        }
+      }
+    }
+  }
+  // No relevant collisions found.
+  return true;
+}
+
+RobotClearance SphereCollisionChecker::DoCalcContextRobotClearance(
+    const CollisionCheckerContext& model_context,
+    const double influence_distance) const {
+  const Frame<double>& frame_W = plant().world_frame();
+  const Context<double>& plant_context = model_context.plant_context();
+  const std::vector<std::vector<Matrix3Xd>> p_WS =
+      CalcSphereCentersInWorld(model_context);
+
+  // For each measurement we're computing ϕ and ∂ϕ/∂qᵣ = ∂ϕ/∂p⋅∂p/∂qᵣ (as
+  // documented in RobotClearance), where p is the position of the closest
+  // sphere's center (or the difference of the two closest spheres' centers).
+  Matrix3X<double> dp_dq(3, plant().num_positions());
+  Matrix3X<double> partial_temp(3, plant().num_positions());
+  RowVectorXd ddist_dq(plant().num_positions());
+
+  RobotClearance result(plant().num_positions());
+  result.Reserve(DoMaxContextNumDistances(model_context));
+
+  // The closest sphere of each robot body to the environment.
+  const BodyIndex world_index = plant().world_body().index();
+  for (BodyIndex i(0); i < plant().num_bodies(); ++i) {
+    if (body_spheres_[i].empty()) continue;
+    const DistanceField& field = *body_fields_[i];
+    const double padding = GetEnvironmentPadding(i);
+    double distance = std::numeric_limits<double>::infinity();
+    Vector3d ddist_dp;
+    Vector3d p_BS;
+    for (size_t k = 0; k < body_spheres_[i].size(); ++k) {
+      const SphereSet& spheres = body_spheres_[i][k];
+      for (int s = 0; s < spheres.radii.size(); ++s) {
+        Vector3d grad_W;
+        const double sphere_distance =
+            field.Eval(p_WS[i][k].col(s), &grad_W) - spheres.radii(s) -
+            padding;
+        if (sphere_distance < distance) {
+          distance = sphere_distance;
+          ddist_dp = grad_W;
+          p_BS = spheres.p_BS.col(s);
+        }
+      }
+    }
+    if (distance > influence_distance) continue;
+    // As in SceneGraphCollisionChecker, we rely on the parent class to zero
+    // out the columns of non-robot positions.
+    plant().CalcJacobianPositionVector(plant_context, get_body(i).body_frame(),
+                                       p_BS, frame_W, frame_W, &dp_dq);
+    ddist_dq.noalias() = ddist_dp.transpose() * dp_dq;
+    result.Append(i, world_index, RobotCollisionType::kEnvironmentCollision,
+                  distance, ddist_dq);
+  }
+
+  // The closest pair of spheres of each pair of robot bodies.
+  for (const auto& [a, b] : self_pairs_) {
+    if (body_spheres_[a].empty() || body_spheres_[b].empty()) continue;
+    double distance = std::numeric_limits<double>::infinity();
+    Vector3d p_AS;
+    Vector3d p_BS;
+    Vector3d p_WS_BA;
+    for (size_t k = 0; k < body_spheres_[a].size(); ++k) {
+      for (size_t m = 0; m < body_spheres_[b].size(); ++m) {
+        int sa{};
+        int sb{};
+        const double pair_distance = CalcSphereSetDistance(
+            p_WS[a][k], body_spheres_[a][k].radii, p_WS[b][m],
+            body_spheres_[b][m].radii, &sa, &sb);
+        if (pair_distance < distance) {
+          distance = pair_distance;
+          p_AS = body_spheres_[a][k].p_BS.col(sa);
+          p_BS = body_spheres_[b][m].p_BS.col(sb);
+          p_WS_BA = p_WS[a][k].col(sa) - p_WS[b][m].col(sb);
+        }
+      }
+    }
+    distance -= GetPaddingBetween(a, b);
+    if (distance > influence_distance) continue;
+    const Vector3d ddist_dp = p_WS_BA.stableNormalized();
+    plant().CalcJacobianPositionVector(plant_context, get_body(a).body_frame(),
+                                       p_AS, frame_W, frame_W, &dp_dq);
+    plant().CalcJacobianPositionVector(plant_context, get_body(b).body_frame(),
+                                       p_BS, frame_W, frame_W, &partial_temp);
+    dp_dq -= partial_temp;
+    ddist_dq.noalias() = ddist_dp.transpose() * dp_dq;
+    result.Append(a, b, RobotCollisionType::kSelfCollision, distance,
+                  ddist_dq);
+  }
+  return result;
+}
+
+std::vector<RobotCollisionType>
+SphereCollisionChecker::DoClassifyContextBodyCollisions(
+    const CollisionCheckerContext& model_context) const {
+  const std::vector<std::vector<Matrix3Xd>> p_WS =
+      CalcSphereCentersInWorld(model_context);
+
+  std::vector<RobotCollisionType> robot_collision_types(
+      plant().num_bodies(), RobotCollisionType::kNoCollision);
+
+  for (BodyIndex i(0); i < plant().num_bodies(); ++i) {
+    if (body_spheres_[i].empty()) continue;
+    const DistanceField& field = *body_fields_[i];
+    const double padding = GetEnvironmentPadding(i);
+    bool in_collision = false;
+    for (size_t k = 0; k < body_spheres_[i].size() && !in_collision; ++k) {
+      const VectorXd& radii = body_spheres_[i][k].radii;
+      for (int s = 0; s < radii.size() && !in_collision; ++s) {
+        in_collision = field.Eval(p_WS[i][k].col(s)) - radii(s) <= padding;
+      }
+    }
+    robot_collision_types[i] =
+        SetInEnvironmentCollision(robot_collision_types[i], in_collision);
+  }
+
+  for (const auto& [a, b] : self_pairs_) {
+    if (body_spheres_[a].empty() || body_spheres_[b].empty()) continue;
+    const double padding = GetPaddingBetween(a, b);
+    bool in_collision = false;
+    for (size_t k = 0; k < body_spheres_[a].size() && !in_collision; ++k) {
+      for (size_t m = 0; m < body_spheres_[b].size() && !in_collision; ++m) {
+        in_collision =
+            CalcSphereSetDistance(p_WS[a][k], body_spheres_[a][k].radii,
+                                  p_WS[b][m], body_spheres_[b][m].radii) <=
+            padding;
+      }
+    }
+    if (in_collision) {
+      robot_collision_types[a] =
+          SetInSelfCollision(robot_collision_types[a], true);
+      robot_collision_types[b] =
+          SetInSelfCollision(robot_collision_types[b], true);
+    }
+  }
+
+  return robot_collision_types;
+}
+
+int SphereCollisionChecker::DoMaxContextNumDistances(
+    const CollisionCheckerContext&) const {
+  // One environment distance per robot body with spheres, plus one distance
+  // per pair of such bodies that is checked for self-collision.
+  int count = 0;
+  for (const auto& sets : body_spheres_) {
+    if (!sets.empty()) ++count;
+  }
+  for (const auto& [a, b] : self_pairs_) {
+    if (!body_spheres_[a].empty() && !body_spheres_[b].empty()) ++count;
+  }
+  return count;
+}
+
+}  // namespace planning
+}  // namespace drake
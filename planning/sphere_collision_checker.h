@@ -0,0 +1,178 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <Eigen/Core>
+#include <Eigen/Geometry>
+
+#include "drake/planning/collision_checker.h"
+#include "drake/planning/collision_checker_params.h"
+
+namespace drake {
+namespace planning {
+
+/** Options specific to SphereCollisionChecker.
+@ingroup planning_collision_checker */
+struct SphereCollisionCheckerOptions {
+  /** The axis-aligned box (in the world frame) covered by the environment's
+  distance field. It should enclose everything that the robot can reach; robot
+  spheres outside of it are checked against a conservative extrapolation of the
+  field, which quickly reports collision as the distance from the box grows. */
+  Eigen::AlignedBox3d workspace{Eigen::Vector3d::Constant(-1.0),
+                                Eigen::Vector3d::Constant(1.0)};
+
+  /** The edge length of the distance field's voxels. Must be positive. */
+  double voxel_size{0.02};
+
+  /** Distances larger than this are not resolved by the distance field; they
+  are reported as this value instead. Must be positive. Larger values make the
+  field slower to build, but make clearance gradients available farther from
+  the environment. */
+  double max_field_distance{0.5};
+};
+
+/** An implementation of CollisionChecker that approximates the robot's
+collision geometry with spheres and the environment's with a voxelized signed
+distance field, trading exactness for very cheap configuration checks that
+need no broadphase or narrowphase queries, just arithmetic on sphere centers
+and lookups into a grid. This suits planners that check very many
+configurations (e.g., via CheckConfigsCollisionFree()) in mostly open space.
+
+The robot's collision geometries (i.e., those of the bodies in the
+`robot_model_instances`, along with any shapes added to them later) are
+covered with spheres: spheres are used as-is, capsules and cylinders become
+a row of spheres along their axes, and boxes, ellipsoids, and meshes (via the
+bounding box of their vertices; only .obj meshes are supported) become a grid
+of spheres. Every approximation encloses the shape it replaces, so it can only
+report more collisions than the exact geometry would. Self-collisions are
+checked pairwise between the spheres of bodies whose collisions are not
+filtered, with the usual per-pair padding.
+
+The environment's collision geometries are sampled once at construction into a
+signed distance field that covers the SphereCollisionCheckerOptions::workspace,
+using SceneGraph's signed distance to point queries; geometries that those
+queries don't support (i.e., meshes and convex shapes) are ignored with a
+warning. The field is interpolated such that it never overestimates the
+distance to the environment (it may underestimate it by about √3 times the
+voxel size). Because a single field cannot tell environment bodies apart, the
+padding between a robot body and the environment is the largest padding
+between that robot body and any environment body, and environment bodies that
+are filtered against some robot body are left out of a separate field that is
+used for just those robot bodies.
+
+The environment is assumed to be static: non-robot bodies are sampled at the
+model's default configuration, and shapes can't be added to them (the request
+is ignored, see AddCollisionShapeToBody()). Collision clearance results report
+environment distances against the world body, since the field does not know
+which environment body is closest.
+
+@ingroup planning_collision_checker */
+class SphereCollisionChecker final : public CollisionChecker {
+ public:
+  /** @name     Does not allow copy, move, or assignment. */
+  /** @{ */
+  // N.B. The copy constructor is private for use in implementing Clone().
+  void operator=(const SphereCollisionChecker&) = delete;
+  /** @} */
+
+  /** Creates a new checker with the given params and options.
+  @throws std::exception if the options are invalid, or if a robot collision
+  geometry can't be approximated with spheres. */
+  SphereCollisionChecker(CollisionCheckerParams params,
+                         SphereCollisionCheckerOptions options = {});
+
+  /** Returns the options this checker was constructed with. */
+  const SphereCollisionCheckerOptions& options() const { return options_; }
+
+  /** Returns the total number of spheres that approximate the robot. */
+  int num_robot_spheres() const;
+
+  /** Returns the spheres that approximate `body`'s collision geometry, as a
+  4×N matrix whose columns are the position of each sphere's center in the
+  body frame followed by its radius. The result is empty for bodies that are
+  not part of the robot. */
+  Eigen::Matrix4Xd GetBodySpheres(const multibody::Body<double>& body) const;
+
+ private:
+  // The spheres that approximate one geometry on a robot body.
+  struct SphereSet {
+    geometry::GeometryId id;
+    // The positions of the spheres' centers in the body frame B.
+    Eigen::Matrix3Xd p_BS;
+    Eigen::VectorXd radii;
+  };
+
+  // A voxelized signed distance field of (part of) the environment; defined in
+  // the .cc file.
+  class DistanceField;
+
+  // To support Clone(), allow copying (but not move nor assign).
+  SphereCollisionChecker(const SphereCollisionChecker&);
+
+  std::unique_ptr<CollisionChecker> DoClone() const final;
+
+  void DoUpdateContextPositions(CollisionCheckerContext*) const final;
+
+  bool DoCheckContextConfigCollisionFree(
+      const CollisionCheckerContext& model_context) const final;
+
+  std::optional<geometry::GeometryId> DoAddCollisionShapeToBody(
+      const std::string& group_name, const multibody::Body<double>& bodyA,
+      const geometry::Shape& shape,
+      const math::RigidTransform<double>& X_AG) final;
+
+  void RemoveAddedGeometries(
+      const std::vector<CollisionChecker::AddedShape>& shapes) final;
+
+  void UpdateCollisionFilters() final;
+
+  RobotClearance DoCalcContextRobotClearance(
+      const CollisionCheckerContext& model_context,
+      double influence_distance) const final;
+
+  std::vector<RobotCollisionType> DoClassifyContextBodyCollisions(
+      const CollisionCheckerContext& model_context) const final;
+
+  int DoMaxContextNumDistances(
+      const CollisionCheckerContext& model_context) const final;
+
+  // Returns the padding between the robot body and the environment, i.e., the
+  // largest padding between it and any environment body whose collisions with
+  // it are not filtered.
+  double GetEnvironmentPadding(multibody::BodyIndex robot_index) const;
+
+  // Rebuilds the pairs of robot bodies that are checked for self-collision, and
+  // the distance fields (when the environment bodies filtered against any
+  // robot body changed).
+  void UpdateBodyPairsAndDistanceFields();
+
+  // Computes the positions of the sphere centers in the world frame for every
+  // robot body, indexed like body_spheres_.
+  std::vector<std::vector<Eigen::Matrix3Xd>> CalcSphereCentersInWorld(
+      const CollisionCheckerContext& model_context) const;
+
+  SphereCollisionCheckerOptions options_;
+
+  // The spheres on each body, indexed by BodyIndex (empty for environment
+  // bodies).
+  std::vector<std::vector<SphereSet>> body_spheres_;
+
+  // The robot bodies (with spheres) that are checked against each other.
+  std::vector<std::pair<multibody::BodyIndex, multibody::BodyIndex>>
+      self_pairs_;
+
+  // The environment bodies filtered against each body, which key the distance
+  // fields; indexed by BodyIndex (empty for environment bodies).
+  std::vector<std::vector<multibody::BodyIndex>> filtered_environment_;
+
+  // The distance field used for each body, indexed by BodyIndex (nullptr for
+  // environment bodies). Bodies with the same filtered environment bodies
+  // share a field; the fields are immutable, so clones share them too.
+  std::vector<std::shared_ptr<const DistanceField>> body_fields_;
+};
+
+}  // namespace planning
+}  // namespace drake
@@ -1,7 +1,9 @@
 #include "drake/planning/collision_checker.h"
 
+#include <atomic>
 #include <chrono>
 #include <map>
+#include <memory>
 #include <thread>
 #include <utility>
 #include <vector>
@@ -546,10 +548,48 @@ GTEST_TEST(CollisionCheckerTest, RobotClearance) {
     }
   }
 
+  // The batched variant produces one clearance per configuration.
+  const std::vector<RobotClearance> clearances =
+      checker->CalcRobotClearances({q, q, q}, 0);
+  ASSERT_EQ(clearances.size(), 3);
+  for (const RobotClearance& batch_clearance : clearances) {
+    ASSERT_EQ(batch_clearance.size(), 1);
+    EXPECT_TRUE(CompareMatrices(batch_clearance.jacobians(),
+                                clearance.jacobians()));
+  }
+
+  // The compressed sparse row variant concatenates the same rows.
+  RobotClearance concatenated(clearance.num_positions());
+  std::vector<int> row_offsets;
+  checker->CalcRobotClearances({q, q, q}, 0, &concatenated, &row_offsets);
+  EXPECT_EQ(row_offsets, std::vector<int>({0, 1, 2, 3}));
+  ASSERT_EQ(concatenated.size(), 3);
+  for (int row = 0; row < concatenated.size(); ++row) {
+    EXPECT_EQ(concatenated.distances()[row], clearance.distances()[0]);
+    EXPECT_TRUE(CompareMatrices(concatenated.jacobians().row(row),
+                                clearance.jacobians().row(0)));
+  }
+  // The outputs are overwritten by later calls.
+  checker->CalcRobotClearances({q}, 0, &concatenated, &row_offsets);
+  EXPECT_EQ(row_offsets, std::vector<int>({0, 1}));
+  EXPECT_EQ(concatenated.size(), 1);
+
   // Error conditions.
   EXPECT_THROW(checker->CalcRobotClearance(q, -1), std::exception);
   constexpr double kInf = std::numeric_limits<double>::infinity();
   EXPECT_THROW(checker->CalcRobotClearance(q, kInf), std::exception);
+  EXPECT_THROW(checker->CalcRobotClearances({q}, -1), std::exception);
+  EXPECT_THROW(checker->CalcRobotClearances({q}, kInf), std::exception);
+  EXPECT_THROW(
+      checker->CalcRobotClearances({q}, 0, nullptr, &row_offsets),
+      std::exception);
+  EXPECT_THROW(
+      checker->CalcRobotClearances({q}, 0, &concatenated, nullptr),
+      std::exception);
+  RobotClearance wrong_size(clearance.num_positions() + 1);
+  EXPECT_THROW(
+      checker->CalcRobotClearances({q}, 0, &wrong_size, &row_offsets),
+      std::exception);
 }
 
 // Testing framework for the collision checker such that the model contains
@@ -904,6 +944,36 @@ TEST_F(TrivialCollisionCheckerTest, Shapes) {
   }
 }
 
+// Batched updates remove and add whole groups at once.
+TEST_F(TrivialCollisionCheckerTest, UpdateShapes) {
+  const Sphere sphere(0.1);
+  const BodyShapeDescription body_shape{sphere, {}, "m3", "b0"};
+  dut_->SetCanAddCollisionShapes(true);
+  EXPECT_EQ(dut_->AddCollisionShapes("obstacles", {body_shape, body_shape}), 2);
+  EXPECT_EQ(dut_->AddCollisionShapes("grasp", {body_shape}), 1);
+
+  // Replacing a group discards its old shapes.
+  EXPECT_EQ(dut_->ReplaceCollisionShapes("obstacles", {body_shape}), 1);
+  EXPECT_EQ(dut_->GetAllAddedCollisionShapes().at("obstacles").size(), 1);
+  EXPECT_EQ(dut_->GetAllAddedCollisionShapes().at("grasp").size(), 1);
+
+  // Groups can be removed and added in one update; unknown names to remove
+  // are ignored, and groups with nothing to add are reported as such.
+  const std::map<std::string, int> added = dut_->UpdateCollisionShapes(
+      {"obstacles", "grasp", "unknown"},
+      {{"obstacles", {body_shape, body_shape, body_shape}}, {"empty", {}}});
+  EXPECT_EQ(added,
+            (std::map<std::string, int>{{"obstacles", 3}, {"empty", 0}}));
+  const auto all_shapes = dut_->GetAllAddedCollisionShapes();
+  EXPECT_EQ(all_shapes.size(), 1);
+  EXPECT_EQ(all_shapes.at("obstacles").size(), 3);
+
+  // Shapes the checker ignores are not counted.
+  dut_->SetCanAddCollisionShapes(false);
+  EXPECT_EQ(dut_->ReplaceCollisionShapes("obstacles", {body_shape}), 0);
+  EXPECT_EQ(dut_->GetAllAddedCollisionShapes().size(), 0);
+}
+
 TEST_F(TrivialCollisionCheckerTest, ReportParallelChecking) {
   for (bool parallel_supported : {true, false}) {
     auto [robot, robot_index] = MakeModel();
@@ -1687,6 +1757,9 @@ class MockEdgeChecker : public UnimplementedCollisionChecker {
     return std::accumulate(thread_signals_.begin(), thread_signals_.end(), 0);
   }
 
+  // Returns the number of configurations checked for collision.
+  int num_checks() const { return *num_checks_; }
+
   // Force five samples based on the given `step_size`.
   static ConfigurationDistanceFunction MakeEdgeDistance(double step_size) {
     return [step_size](const VectorXd& q1, const VectorXd& q2) {
@@ -1745,6 +1818,7 @@ class MockEdgeChecker : public UnimplementedCollisionChecker {
     const int thread_index =
         common_robotics_utilities::openmp_helpers::GetContextOmpThreadNum();
     thread_signals_[thread_index] = 1;
+    ++(*num_checks_);
     const auto q = plant().GetPositions(model_context.plant_context());
     const double s = q(2);
     const bool free = s <= q(0) || q(1) < s;
@@ -1757,6 +1831,11 @@ class MockEdgeChecker : public UnimplementedCollisionChecker {
   // A per-thread signal; if the code was exercised in thread i, the value
   // at the ith index is one, otherwise zero.
   mutable vector<int> thread_signals_;
+
+  // The number of configurations checked for collision (held by pointer so
+  // that the checker remains copyable).
+  std::shared_ptr<std::atomic<int>> num_checks_{
+      std::make_shared<std::atomic<int>>(0)};
 };
 
 std::vector<EdgeTestConfig> MakeEdgeTestCases() {
@@ -1924,6 +2003,27 @@ TEST_P(ParameterizedEdgeCheckTest, CheckEdgeCollisionFree) {
   }
 }
 
+// After the end points, the serial edge check samples the edge in bisection
+// order, so a collision in the middle of the edge is found without checking
+// the samples before it.
+GTEST_TEST(EdgeCheckTest, CheckEdgeInBisectionOrder) {
+  const double step_size = 0.25;
+  const int q_size = MockEdgeChecker::kQSize;
+  auto dut = MakeEdgeChecker<MockEdgeChecker>(
+      MockEdgeChecker::MakeEdgeDistance(step_size), step_size,
+      MockEdgeChecker::MakeEdgeInterpolation(), true /* welded */,
+      q_size + 1 /* num_bodies */);
+
+  // Start configuration values are simply ignored.
+  const VectorXd q1 = VectorXd::Constant(q_size, 0.75);
+  // Only the midpoint of the edge (α = 0.5) is in collision.
+  const VectorXd q2 = dut.EncodeConfiguration(q_size, 0.25, 0.5);
+  EXPECT_FALSE(dut.CheckEdgeCollisionFree(q1, q2));
+  // Walking the edge would check q2, q1 (α = 0), α = 0.25 and α = 0.5; the
+  // bisection order skips α = 0.25.
+  EXPECT_EQ(dut.num_checks(), 3);
+}
+
 // The test for MeasureEdgesCollisionFree() (plural) uses
 // MeasureEdgeCollisionFree() (singular) to test individual edges. For this
 // function, we only need to test:
@@ -104,6 +104,11 @@ GTEST_TEST(BrokenDistanceAndInterpolationProviderTest, Test) {
       provider.InterpolateBetweenConfigurations(Eigen::VectorXd::Zero(2),
                                                 Eigen::VectorXd::Zero(2), 1.0),
       ".* condition 'from\\.size\\(\\) == interpolated\\.size\\(\\)' failed.*");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      provider.InterpolateBetweenConfigurations(Eigen::VectorXd::Zero(2),
+                                                Eigen::VectorXd::Zero(2),
+                                                std::vector<double>{0.5}),
+      ".* condition 'from\\.size\\(\\) == q\\.size\\(\\)' failed.*");
 }
 
 GTEST_TEST(SimpleLinearDistanceAndInterpolationProviderTest, Test) {
@@ -152,6 +157,19 @@ GTEST_TEST(SimpleLinearDistanceAndInterpolationProviderTest, Test) {
       provider.InterpolateBetweenConfigurations(Eigen::VectorXd::Ones(2),
                                                 Eigen::VectorXd::Zero(2), 0.5),
       Eigen::VectorXd::Constant(2, 0.5)));
+
+  // Batched interpolation queries.
+  const std::vector<Eigen::VectorXd> waypoints =
+      provider.InterpolateBetweenConfigurations(
+          Eigen::VectorXd::Ones(2), Eigen::VectorXd::Zero(2), {0.0, 0.5, 1.0});
+  ASSERT_EQ(waypoints.size(), 3);
+  EXPECT_TRUE(CompareMatrices(waypoints[0], Eigen::VectorXd::Ones(2)));
+  EXPECT_TRUE(CompareMatrices(waypoints[1], Eigen::VectorXd::Constant(2, 0.5)));
+  EXPECT_TRUE(CompareMatrices(waypoints[2], Eigen::VectorXd::Zero(2)));
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      provider.InterpolateBetweenConfigurations(
+          Eigen::VectorXd::Zero(2), Eigen::VectorXd::Zero(2), {0.5, 1.1}),
+      ".* condition 'ratio <= 1\\.0' failed.*");
 }
 
 }  // namespace
@@ -1,6 +1,7 @@
 #include "drake/planning/linear_distance_and_interpolation_provider.h"
 
 #include <string>
+#include <vector>
 
 #include <common_robotics_utilities/math.hpp>
 #include <gtest/gtest.h>
@@ -167,6 +168,26 @@ void DoFloatingIiwaTest(const RobotDiagram<double>& model,
   EXPECT_TRUE(CompareMatrices(
       provider.InterpolateBetweenConfigurations(full_zero_q, full_test_q, 0.5),
       full_half_q, 1e-10));
+
+  // Batched interpolation matches the single queries exactly, including for
+  // quaternions whose dot product is negative.
+  const std::vector<double> ratios{0.0, 0.5, 0.25, 0.75, 1.0};
+  Eigen::VectorXd flipped_test_q = full_test_q;
+  flipped_test_q.head<4>() *= -1.0;
+  for (const Eigen::VectorXd& to_q : {full_test_q, flipped_test_q}) {
+    const std::vector<Eigen::VectorXd> waypoints =
+        provider.InterpolateBetweenConfigurations(full_zero_q, to_q, ratios);
+    ASSERT_EQ(waypoints.size(), ratios.size());
+    for (size_t i = 0; i < ratios.size(); ++i) {
+      EXPECT_TRUE(CompareMatrices(waypoints[i],
+                                  provider.InterpolateBetweenConfigurations(
+                                      full_zero_q, to_q, ratios[i])));
+    }
+  }
+  EXPECT_TRUE(CompareMatrices(
+      provider.InterpolateBetweenConfigurations(full_test_q, full_test_q,
+                                                ratios)[1],
+      full_test_q));
 }
 
 GTEST_TEST(FixedIiwaTest, Test) {
@@ -54,6 +54,12 @@ GTEST_TEST(RobotClearanceTest, AppendData) {
   EXPECT_NE(dut.jacobians()(0, 3), 0.0);
   dut.mutable_jacobians().col(3).setZero();
   EXPECT_EQ(dut.jacobians()(0, 3), 0.0);
+
+  // Clearing removes all rows.
+  dut.Clear();
+  EXPECT_EQ(dut.size(), 0);
+  EXPECT_EQ(dut.num_positions(), nq);
+  EXPECT_EQ(dut.jacobians().rows(), 0);
 }
 
 GTEST_TEST(RobotClearanceTest, AppendThrow) {
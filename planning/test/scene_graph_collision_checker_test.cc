@@ -503,6 +503,199 @@ directives:
   }
 }
 
+// Checks that batched updates of the environment take effect in every context
+// and keep the collision filters consistent.
+GTEST_TEST(SceneGraphCollisionCheckerTest, UpdateCollisionShapes) {
+  RobotDiagramBuilder<double> builder;
+  const std::string model_directives = R"""(
+directives:
+- add_model:
+    name: arm
+    file: package://drake/manipulation/models/iiwa_description/urdf/iiwa14_spheres_dense_collision.urdf
+- add_weld:
+    parent: world
+    child: arm::base
+)""";
+  builder.parser().AddModelsFromString(model_directives, "dmd.yaml");
+
+  const auto& plant = builder.plant();
+  CollisionCheckerParams params;
+  params.model = builder.Build();
+  params.robot_model_instances.push_back(plant.GetModelInstanceByName("arm"));
+  params.configuration_distance_function = [](const VectorXd& q1,
+                                              const VectorXd& q2) {
+    return (q1 - q2).norm();
+  };
+  params.edge_step_size = 0.05;
+  SceneGraphCollisionChecker dut(std::move(params));
+
+  const VectorXd q = plant.GetPositions(*plant.CreateDefaultContext());
+  const bool initially_free = dut.CheckConfigCollisionFree(q);
+  const math::RigidTransformd X_WL = plant.EvalBodyPoseInWorld(
+      dut.plant_context(), plant.GetBodyByName("iiwa_link_4"));
+
+  // A cloud of far away obstacles, plus one that engulfs a link.
+  const std::string world_model_instance =
+      plant.GetModelInstanceName(multibody::world_model_instance());
+  const std::string world_body = plant.world_body().name();
+  std::vector<BodyShapeDescription> obstacles;
+  for (int i = 0; i < 100; ++i) {
+    obstacles.emplace_back(geometry::Box(0.05, 0.05, 0.05),
+                           math::RigidTransformd(Vector3d(i, 10, 10)),
+                           world_model_instance, world_body);
+  }
+  std::vector<BodyShapeDescription> colliding_obstacles = obstacles;
+  colliding_obstacles.emplace_back(geometry::Sphere(0.3), X_WL,
+                                   world_model_instance, world_body);
+
+  EXPECT_EQ(dut.ReplaceCollisionShapes("voxels", colliding_obstacles), 101);
+  EXPECT_NO_THROW(EnforceCollisionFilterConsistency(dut));
+  EXPECT_FALSE(dut.CheckConfigCollisionFree(q));
+  EXPECT_THAT(dut.CheckConfigsCollisionFree({q, q, q, q}, Parallelism::Max()),
+              ElementsAre(0, 0, 0, 0));
+
+  // Swapping in the new set removes the colliding obstacle.
+  EXPECT_EQ(dut.ReplaceCollisionShapes("voxels", obstacles), 100);
+  EXPECT_EQ(dut.GetAllAddedCollisionShapes().at("voxels").size(), 100);
+  EXPECT_NO_THROW(EnforceCollisionFilterConsistency(dut));
+  EXPECT_EQ(dut.CheckConfigCollisionFree(q), initially_free);
+  const uint8_t expected = initially_free ? 1 : 0;
+  EXPECT_THAT(dut.CheckConfigsCollisionFree({q, q, q, q}, Parallelism::Max()),
+              ElementsAre(expected, expected, expected, expected));
+}
+
+GTEST_TEST(SceneGraphCollisionCheckerTest, LockJoints) {
+  // Three spheres slide along the world's x axis: "left" (q₀) and "right" (q₁)
+  // relative to the world, and "tip" (q₂) relative to "right". The environment
+  // is a 0.2 m cube centered at x = 3.
+  RobotDiagramBuilder<double> builder;
+  const std::string model_data = R"""(
+<?xml version='1.0'?>
+<sdf xmlns:drake='http://drake.mit.edu' version='1.9'>
+<world name='default'>
+  <model name='robot'>
+    <link name='left'>
+      <collision name='left_collision'>
+        <geometry><sphere><radius>0.25</radius></sphere></geometry>
+      </collision>
+    </link>
+    <joint name='left_joint' type='prismatic'>
+      <parent>world</parent>
+      <child>left</child>
+      <axis><xyz>1 0 0</xyz></axis>
+    </joint>
+    <link name='right'>
+      <collision name='right_collision'>
+        <geometry><sphere><radius>0.25</radius></sphere></geometry>
+      </collision>
+    </link>
+    <joint name='right_joint' type='prismatic'>
+      <parent>world</parent>
+      <child>right</child>
+      <axis><xyz>1 0 0</xyz></axis>
+    </joint>
+    <link name='tip'>
+      <collision name='tip_collision'>
+        <geometry><sphere><radius>0.1</radius></sphere></geometry>
+      </collision>
+    </link>
+    <joint name='tip_joint' type='prismatic'>
+      <parent>right</parent>
+      <child>tip</child>
+      <axis><xyz>1 0 0</xyz></axis>
+    </joint>
+  </model>
+  <model name='environment'>
+    <static>true</static>
+    <link name='wall'>
+      <pose>3 0 0 0 0 0</pose>
+      <collision name='wall_collision'>
+        <geometry><box><size>0.2 0.2 0.2</size></box></geometry>
+      </collision>
+    </link>
+  </model>
+</world>
+</sdf>
+)""";
+  builder.parser().AddModelsFromString(model_data, "sdf");
+
+  const auto& plant = builder.plant();
+  CollisionCheckerParams params;
+  params.model = builder.Build();
+  params.robot_model_instances.push_back(plant.GetModelInstanceByName("robot"));
+  params.configuration_distance_function = [](const VectorXd& q1,
+                                              const VectorXd& q2) {
+    return (q1 - q2).norm();
+  };
+  params.edge_step_size = 0.05;
+  SceneGraphCollisionChecker dut(std::move(params));
+
+  const BodyIndex left = plant.GetBodyByName("left").index();
+  const BodyIndex right = plant.GetBodyByName("right").index();
+  const BodyIndex tip = plant.GetBodyByName("tip").index();
+  const BodyIndex wall = plant.GetBodyByName("wall").index();
+  const multibody::JointIndex right_joint =
+      plant.GetJointByName("right_joint").index();
+  const multibody::JointIndex tip_joint =
+      plant.GetJointByName("tip_joint").index();
+  const Eigen::MatrixXi nominal_filters = dut.GetFilteredCollisionMatrix();
+  const double influence = 100.0;
+  const int num_distances =
+      dut.CalcRobotClearance(Vector3d::Zero(), influence).size();
+
+  // A body is locked only if every joint on its path to the world is locked.
+  dut.LockJoints({right_joint}, Vector3d(-1.5, 1.5, 0.0));
+  EXPECT_TRUE(dut.IsBodyLocked(right));
+  EXPECT_FALSE(dut.IsBodyLocked(tip));
+  EXPECT_FALSE(dut.IsBodyLocked(left));
+  EXPECT_TRUE(dut.IsBodyLocked(wall));
+
+  // Locking both joints of the chain replaces the lock. The locked bodies are
+  // clear of each other and the wall.
+  dut.LockJoints({right_joint, tip_joint}, Vector3d(-1.5, 1.5, 0.0));
+  EXPECT_THAT(dut.GetLockedJoints(), ElementsAre(right_joint, tip_joint));
+  EXPECT_TRUE(dut.IsBodyLocked(tip));
+  EXPECT_TRUE(dut.IsCollisionFilteredBetween(tip, wall));
+  EXPECT_FALSE(dut.IsCollisionFilteredBetween(left, wall));
+  EXPECT_FALSE(dut.IsCollisionFilteredBetween(left, right));
+  EXPECT_THROW(dut.SetCollisionFilteredBetween(left, right, true),
+               std::exception);
+  EXPECT_THROW(dut.SetCollisionFilterMatrix(nominal_filters), std::exception);
+
+  // The locked positions in q are ignored; without the lock, this would put
+  // the tip in the wall.
+  EXPECT_TRUE(dut.CheckConfigCollisionFree(Vector3d(-1.5, 3.0, 0.0)));
+  // Pairs with a moving body are still checked.
+  EXPECT_FALSE(dut.CheckConfigCollisionFree(Vector3d(1.4, 0.0, 0.0)));
+  EXPECT_THAT(dut.CheckConfigsCollisionFree(
+                  {Vector3d(-1.5, 3.0, 0.0), Vector3d(1.4, 0.0, 0.0)},
+                  Parallelism::Max()),
+              ElementsAre(1, 0));
+  // Only the three pairs with "left" are measured.
+  EXPECT_EQ(dut.CalcRobotClearance(Vector3d::Zero(), influence).size(), 3);
+
+  // If the locked bodies collide, every configuration collides.
+  dut.LockJoints({right_joint, tip_joint}, Vector3d(-1.5, 1.5, 1.4));
+  EXPECT_FALSE(dut.CheckConfigCollisionFree(Vector3d(-1.5, 0.0, 0.0)));
+  EXPECT_FALSE(dut.CheckEdgeCollisionFree(Vector3d(-1.5, 0.0, 0.0),
+                                          Vector3d(-1.0, 0.0, 0.0)));
+  const std::vector<RobotCollisionType> classified =
+      dut.ClassifyBodyCollisions(Vector3d(-1.5, 0.0, 0.0));
+  EXPECT_EQ(classified[tip], RobotCollisionType::kEnvironmentCollision);
+  EXPECT_EQ(classified[left], RobotCollisionType::kNoCollision);
+
+  // Unlocking restores the filters and the full configuration.
+  dut.UnlockJoints();
+  EXPECT_TRUE(dut.GetLockedJoints().empty());
+  EXPECT_FALSE(dut.IsBodyLocked(tip));
+  EXPECT_EQ(dut.GetFilteredCollisionMatrix(), nominal_filters);
+  EXPECT_NO_THROW(EnforceCollisionFilterConsistency(dut));
+  EXPECT_TRUE(dut.CheckConfigCollisionFree(Vector3d(-1.5, 0.0, 0.0)));
+  EXPECT_FALSE(dut.CheckConfigCollisionFree(Vector3d(-1.5, 1.5, 1.4)));
+  EXPECT_EQ(dut.CalcRobotClearance(Vector3d::Zero(), influence).size(),
+            num_distances);
+}
+
 }  // namespace test
 }  // namespace planning
 }  // namespace drake
@@ -0,0 +1,259 @@
+#include "drake/planning/sphere_collision_checker.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/planning/robot_diagram_builder.h"
+
+namespace drake {
+namespace planning {
+namespace {
+
+using Eigen::Matrix4Xd;
+using Eigen::MatrixXd;
+using Eigen::Vector2d;
+using Eigen::Vector3d;
+using Eigen::VectorXd;
+using math::RigidTransform;
+using multibody::BodyIndex;
+using testing::ElementsAre;
+
+// A robot with two bodies that slide along the world's x axis: a 0.2 m cube
+// ("slider", q₀) and a sphere of radius 0.1 m ("ball", q₁). The environment is
+// another 0.2 m cube centered at x = 1.
+constexpr char kModel[] = R"""(
+<?xml version='1.0'?>
+<sdf xmlns:drake='http://drake.mit.edu' version='1.9'>
+<world name='default'>
+  <model name='robot'>
+    <link name='slider'>
+      <collision name='slider_collision'>
+        <geometry><box><size>0.2 0.2 0.2</size></box></geometry>
+      </collision>
+    </link>
+    <joint name='slider_joint' type='prismatic'>
+      <parent>world</parent>
+      <child>slider</child>
+      <axis><xyz>1 0 0</xyz></axis>
+    </joint>
+    <link name='ball'>
+      <collision name='ball_collision'>
+        <geometry><sphere><radius>0.1</radius></sphere></geometry>
+      </collision>
+    </link>
+    <joint name='ball_joint' type='prismatic'>
+      <parent>world</parent>
+      <child>ball</child>
+      <axis><xyz>1 0 0</xyz></axis>
+    </joint>
+  </model>
+  <model name='environment'>
+    <static>true</static>
+    <link name='obstacle'>
+      <pose>1 0 0 0 0 0</pose>
+      <collision name='obstacle_collision'>
+        <geometry><box><size>0.2 0.2 0.2</size></box></geometry>
+      </collision>
+    </link>
+  </model>
+</world>
+</sdf>
+)""";
+
+constexpr double kVoxelSize = 0.05;
+
+class SphereCollisionCheckerTest : public ::testing::Test {
+ protected:
+  SphereCollisionCheckerTest() {
+    RobotDiagramBuilder<double> builder;
+    builder.parser().AddModelsFromString(kModel, "sdf");
+    const auto& plant = builder.plant();
+    slider_ = plant.GetBodyByName("slider").index();
+    ball_ = plant.GetBodyByName("ball").index();
+
+    CollisionCheckerParams params;
+    params.model = builder.Build();
+    params.robot_model_instances.push_back(
+        plant.GetModelInstanceByName("robot"));
+    params.configuration_distance_function = [](const VectorXd& q1,
+                                                const VectorXd& q2) {
+      return (q1 - q2).norm();
+    };
+    params.edge_step_size = 0.05;
+    SphereCollisionCheckerOptions options;
+    options.workspace = Eigen::AlignedBox3d(Vector3d(-1.0, -0.5, -0.5),
+                                            Vector3d(2.0, 0.5, 0.5));
+    options.voxel_size = kVoxelSize;
+    options.max_field_distance = 2.0;
+    dut_ = std::make_unique<SphereCollisionChecker>(std::move(params), options);
+  }
+
+  // Returns true iff every point in `points` (expressed in the frame of the
+  // spheres) lies within one of the `spheres` (as returned by GetBodySpheres).
+  static bool Covers(const Matrix4Xd& spheres, const MatrixXd& points) {
+    for (int i = 0; i < points.cols(); ++i) {
+      bool covered = false;
+      for (int s = 0; s < spheres.cols() && !covered; ++s) {
+        covered = (points.col(i) - spheres.block<3, 1>(0, s)).norm() <=
+                  spheres(3, s) + 1e-12;
+      }
+      if (!covered) return false;
+    }
+    return true;
+  }
+
+  std::unique_ptr<SphereCollisionChecker> dut_;
+  BodyIndex slider_;
+  BodyIndex ball_;
+};
+
+TEST_F(SphereCollisionCheckerTest, Spheres) {
+  // The cube is covered by its circumscribed sphere; the ball is exact.
+  const Matrix4Xd slider_spheres =
+      dut_->GetBodySpheres(dut_->get_body(slider_));
+  ASSERT_EQ(slider_spheres.cols(), 1);
+  EXPECT_TRUE(CompareMatrices(slider_spheres.col(0),
+                              Eigen::Vector4d(0, 0, 0, std::sqrt(3) * 0.1),
+                              1e-15));
+  const Matrix4Xd ball_spheres = dut_->GetBodySpheres(dut_->get_body(ball_));
+  EXPECT_TRUE(
+      CompareMatrices(ball_spheres, Eigen::Vector4d(0, 0, 0, 0.1), 1e-15));
+  EXPECT_EQ(dut_->num_robot_spheres(), 2);
+  EXPECT_EQ(dut_->GetBodySpheres(dut_->plant().world_body()).cols(), 0);
+}
+
+TEST_F(SphereCollisionCheckerTest, AddedShapesAreCovered) {
+  const auto& ball = dut_->get_body(ball_);
+  const RigidTransform<double> X_BG(Vector3d(0.0, 0.3, 0.0));
+
+  // A thin plate becomes a limited number of spheres covering its corners.
+  ASSERT_TRUE(dut_->AddCollisionShapeToBody(
+      "plate", ball, geometry::Box(1.0, 0.5, 0.01), X_BG));
+  const Matrix4Xd plate = dut_->GetBodySpheres(ball).rightCols(
+      dut_->GetBodySpheres(ball).cols() - 1);
+  EXPECT_LE(plate.cols(), 100);
+  MatrixXd corners(3, 8);
+  for (int i = 0; i < 8; ++i) {
+    corners.col(i) =
+        X_BG * Vector3d((i & 1 ? 0.5 : -0.5), (i & 2 ? 0.25 : -0.25),
+                        (i & 4 ? 0.005 : -0.005));
+  }
+  EXPECT_TRUE(Covers(plate, corners));
+  dut_->RemoveAllAddedCollisionShapes("plate");
+  EXPECT_EQ(dut_->GetBodySpheres(ball).cols(), 1);
+
+  // The rims of a cylinder and the tips of a capsule are covered.
+  ASSERT_TRUE(dut_->AddCollisionShapeToBody(
+      "cylinder", ball, geometry::Cylinder(0.05, 0.4), X_BG));
+  MatrixXd rims(3, 8);
+  for (int i = 0; i < 4; ++i) {
+    const Vector2d p_xy = 0.05 * Vector2d(std::cos(i), std::sin(i));
+    rims.col(2 * i) = X_BG * Vector3d(p_xy.x(), p_xy.y(), 0.2);
+    rims.col(2 * i + 1) = X_BG * Vector3d(p_xy.x(), p_xy.y(), -0.2);
+  }
+  EXPECT_TRUE(Covers(dut_->GetBodySpheres(ball).rightCols(8), rims));
+  dut_->RemoveAllAddedCollisionShapes();
+
+  ASSERT_TRUE(dut_->AddCollisionShapeToBody(
+      "capsule", ball, geometry::Capsule(0.05, 0.4), X_BG));
+  MatrixXd tips(3, 2);
+  tips.col(0) = X_BG * Vector3d(0, 0, 0.25);
+  tips.col(1) = X_BG * Vector3d(0, 0, -0.25);
+  EXPECT_TRUE(Covers(dut_->GetBodySpheres(ball), tips));
+  dut_->RemoveAllAddedCollisionShapes();
+
+  // Shapes can't be added to the environment.
+  EXPECT_FALSE(dut_->AddCollisionShapeToFrame(
+      "env", dut_->plant().world_frame(), geometry::Sphere(1.0),
+      RigidTransform<double>()));
+  EXPECT_EQ(dut_->num_robot_spheres(), 2);
+}
+
+TEST_F(SphereCollisionCheckerTest, CheckConfigs) {
+  // Both bodies are far from the obstacle and from each other.
+  const Vector2d free(0.5, -0.5);
+  // The slider's sphere reaches into the obstacle.
+  const Vector2d environment(0.8, -0.5);
+  // The slider's and ball's spheres overlap.
+  const Vector2d self(0.5, 0.3);
+
+  EXPECT_TRUE(dut_->CheckConfigCollisionFree(free));
+  EXPECT_FALSE(dut_->CheckConfigCollisionFree(environment));
+  EXPECT_FALSE(dut_->CheckConfigCollisionFree(self));
+
+  EXPECT_EQ(dut_->ClassifyBodyCollisions(environment)[slider_],
+            RobotCollisionType::kEnvironmentCollision);
+  EXPECT_EQ(dut_->ClassifyBodyCollisions(self)[ball_],
+            RobotCollisionType::kSelfCollision);
+  EXPECT_EQ(dut_->ClassifyBodyCollisions(free)[ball_],
+            RobotCollisionType::kNoCollision);
+
+  // Padding applies to the environment, too.
+  dut_->SetPaddingAllRobotEnvironmentPairs(0.2);
+  EXPECT_FALSE(dut_->CheckConfigCollisionFree(free));
+  dut_->SetPaddingAllRobotEnvironmentPairs(0.0);
+
+  // Filtering the self-collision removes it.
+  dut_->SetCollisionFilteredBetween(slider_, ball_, true);
+  EXPECT_TRUE(dut_->CheckConfigCollisionFree(self));
+  dut_->SetCollisionFilteredBetween(slider_, ball_, false);
+
+  // Batches (in parallel) and clones agree.
+  const std::vector<Eigen::VectorXd> configs{free, environment, self, free};
+  EXPECT_THAT(dut_->CheckConfigsCollisionFree(configs, Parallelism::Max()),
+              ElementsAre(1, 0, 0, 1));
+  const std::unique_ptr<CollisionChecker> clone = dut_->Clone();
+  EXPECT_THAT(clone->CheckConfigsCollisionFree(configs, Parallelism::None()),
+              ElementsAre(1, 0, 0, 1));
+}
+
+TEST_F(SphereCollisionCheckerTest, FilteredEnvironment) {
+  // The slider is in collision with the obstacle, until we filter that.
+  const Vector2d q(0.8, -0.5);
+  EXPECT_FALSE(dut_->CheckConfigCollisionFree(q));
+  const BodyIndex obstacle =
+      dut_->plant().GetBodyByName("obstacle").index();
+  dut_->SetCollisionFilteredBetween(slider_, obstacle, true);
+  EXPECT_TRUE(dut_->CheckConfigCollisionFree(q));
+  // The ball still sees the obstacle.
+  EXPECT_FALSE(dut_->CheckConfigCollisionFree(Vector2d(-0.5, 0.8)));
+}
+
+TEST_F(SphereCollisionCheckerTest, Clearance) {
+  const Vector2d q(0.5, -0.5);
+  const RobotClearance clearance = dut_->CalcRobotClearance(q, 10.0);
+  EXPECT_EQ(dut_->MaxNumDistances(), 3);
+  ASSERT_EQ(clearance.size(), 3);
+  const BodyIndex world = dut_->plant().world_body().index();
+  EXPECT_THAT(clearance.robot_indices(), ElementsAre(slider_, ball_, slider_));
+  EXPECT_THAT(clearance.other_indices(), ElementsAre(world, world, ball_));
+  EXPECT_THAT(clearance.collision_types(),
+              ElementsAre(RobotCollisionType::kEnvironmentCollision,
+                          RobotCollisionType::kEnvironmentCollision,
+                          RobotCollisionType::kSelfCollision));
+
+  // Both bodies are at grid vertices in front of the obstacle's face at
+  // x = 0.9, where the distance field is linear, so the field is exact except
+  // for its conservative allowance for interpolation error.
+  const double allowance = std::sqrt(3) / 2 * kVoxelSize;
+  const double slider_radius = std::sqrt(3) * 0.1;
+  const Vector3d expected_distances(0.4 - slider_radius - allowance,
+                                    1.4 - 0.1 - allowance,
+                                    1.0 - slider_radius - 0.1);
+  EXPECT_TRUE(CompareMatrices(clearance.distances(), expected_distances, 1e-6));
+  MatrixXd expected_jacobians(3, 2);
+  // clang-format off
+  expected_jacobians << -1,  0,
+                         0, -1,
+                         1, -1;
+  // clang-format on
+  EXPECT_TRUE(CompareMatrices(clearance.jacobians(), expected_jacobians, 1e-5));
+
+  // The influence distance limits the measurements.
+  EXPECT_EQ(dut_->CalcRobotClearance(q, 0.5).size(), 1);
+}
+
+}  // namespace
+}  // namespace planning
+}  // namespace drake
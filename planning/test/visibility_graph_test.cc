@@ -3,6 +3,7 @@
 #include <gtest/gtest.h>
 
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
 #include "drake/planning/robot_diagram_builder.h"
 #include "drake/planning/scene_graph_collision_checker.h"
 
@@ -147,6 +148,25 @@ GTEST_TEST(VisibilityGraphTest, BoxesInCorners) {
     A_expected.col(5).setZero();
     EXPECT_TRUE(
         CompareMatrices(A.toDense().cast<int>(), A_expected.cast<int>()));
+
+    // Limiting the distance drops the edges between opposite points (1, 3) and
+    // (2, 4), which are 2.6 apart; the others are at most 1.3 * √2 apart.
+    A = VisibilityGraph(*checker, points, parallelize, 2.0);
+    A_expected(1, 3) = A_expected(3, 1) = false;
+    A_expected(2, 4) = A_expected(4, 2) = false;
+    EXPECT_TRUE(
+        CompareMatrices(A.toDense().cast<int>(), A_expected.cast<int>()));
+
+    // With a zero distance, only the self edges remain.
+    A = VisibilityGraph(*checker, points, parallelize, 0.0);
+    A_expected = MatrixX<bool>::Identity(6, 6);
+    A_expected(5, 5) = false;
+    EXPECT_TRUE(
+        CompareMatrices(A.toDense().cast<int>(), A_expected.cast<int>()));
+
+    DRAKE_EXPECT_THROWS_MESSAGE(
+        VisibilityGraph(*checker, points, parallelize, -1.0),
+        ".*max_distance >= 0.*");
   }
 }
 
@@ -1,10 +1,13 @@
 #include "drake/planning/trajectory_optimization/direct_collocation.h"
 
+#include <algorithm>
 #include <cstddef>
+#include <cstdint>
 #include <stdexcept>
 #include <utility>
 #include <vector>
 
+#include "drake/common/parallel_for.h"
 #include "drake/math/autodiff.h"
 #include "drake/math/autodiff_gradient.h"
 
@@ -57,6 +60,42 @@ OwnedPair MakeAutoDiffXd(const systems::System<double>& system,
   return OwnedPair{std::move(system_ad), std::move(context_ad)};
 }
 
+// Calls func(worker, i) for each i in [0, n), using up to `num_workers`
+// threads. Each worker handles a contiguous range of i, so that it can use its
+// own workspace. If any calls throw, the exception of the first one (by i) is
+// rethrown.
+template <typename Func>
+void ForEachWithWorker(int num_workers, int n, const Func& func) {
+  DRAKE_DEMAND(num_workers >= 1);
+  drake::internal::ParallelFor(
+      Parallelism(num_workers), num_workers, [&](int worker) {
+        const int begin = static_cast<int64_t>(n) * worker / num_workers;
+        const int end = static_cast<int64_t>(n) * (worker + 1) / num_workers;
+        for (int i = begin; i < end; ++i) {
+          func(worker, i);
+        }
+      });
+}
+
+// Returns the indices of the DirectCollocationBulkConstraint decision variables
+// that the defects of segment `i` depend on, in the order { h[i], x[i],
+// x[i+1], u[i], u[i+1] }.
+std::vector<int> GetSegmentVariableIndices(int i, int num_time_samples,
+                                           int num_states, int num_inputs) {
+  const int x_start = num_time_samples - 1;
+  const int u_start = x_start + num_time_samples * num_states;
+  std::vector<int> result;
+  result.reserve(1 + 2 * num_states + 2 * num_inputs);
+  result.push_back(i);
+  for (int j = 0; j < 2 * num_states; ++j) {
+    result.push_back(x_start + i * num_states + j);
+  }
+  for (int j = 0; j < 2 * num_inputs; ++j) {
+    result.push_back(u_start + i * num_inputs + j);
+  }
+  return result;
+}
+
 }  // namespace
 
 DirectCollocationConstraint::DirectCollocationConstraint(
@@ -233,12 +272,229 @@ Binding<Constraint> AddDirectCollocationConstraint(
                              {time_step, state, next_state, input, next_input});
 }
 
+// The per-thread scratch for DirectCollocationBulkConstraint. The input port
+// values are fixed once, and then only their contents are updated.
+struct DirectCollocationBulkConstraint::Workspace {
+  std::unique_ptr<Context<double>> context;
+  FixedInputPortValue* input{nullptr};
+  std::unique_ptr<Context<AutoDiffXd>> context_ad;
+  FixedInputPortValue* input_ad{nullptr};
+};
+
+DirectCollocationBulkConstraint::DirectCollocationBulkConstraint(
+    const System<double>& system, const Context<double>& context,
+    int num_time_samples,
+    std::variant<InputPortSelection, InputPortIndex> input_port_index,
+    bool assume_non_continuous_states_are_fixed, Parallelism parallelism)
+    : Constraint(
+          (num_time_samples - 1) *
+              CheckAndReturnStates(context.num_continuous_states()),
+          (num_time_samples - 1) +
+              num_time_samples *
+                  (context.num_continuous_states() +
+                   (system.get_input_port_selection(input_port_index)
+                        ? system.get_input_port_selection(input_port_index)
+                              ->size()
+                        : 0)),
+          Eigen::VectorXd::Zero((num_time_samples - 1) *
+                                context.num_continuous_states()),
+          Eigen::VectorXd::Zero((num_time_samples - 1) *
+                                context.num_continuous_states())),
+      system_(system),
+      system_ad_(System<double>::ToAutoDiffXd(system)),
+      input_port_(system.get_input_port_selection(input_port_index)),
+      input_port_ad_(system_ad_->get_input_port_selection(input_port_index)),
+      num_time_samples_(num_time_samples),
+      num_states_(context.num_continuous_states()),
+      num_inputs_(input_port_ ? input_port_->size() : 0) {
+  system.ValidateContext(context);
+  DRAKE_THROW_UNLESS(num_time_samples >= 2);
+  if (!assume_non_continuous_states_are_fixed) {
+    DRAKE_THROW_UNLESS(context.has_only_continuous_state());
+  }
+  if (input_port_ &&
+      input_port_->get_data_type() == PortDataType::kAbstractValued) {
+    throw std::logic_error(
+        "The specified input port is abstract-valued, and this constraint "
+        "only supports vector-valued input ports.  Did you perhaps forget to "
+        "pass a non-default `input_port_index` argument?");
+  }
+
+  const int num_threads =
+      std::clamp(parallelism.num_threads(), 1, num_time_samples);
+  workspaces_.resize(num_threads);
+  for (auto& workspace : workspaces_) {
+    workspace = std::make_unique<Workspace>();
+    workspace->context = context.Clone();
+    workspace->context_ad = system_ad_->CreateDefaultContext();
+    workspace->context_ad->SetTimeStateAndParametersFrom(context);
+    system_ad_->FixInputPortsFrom(system, context,
+                                  workspace->context_ad.get());
+    if (input_port_) {
+      workspace->input = &input_port_->FixValue(
+          workspace->context.get(), Eigen::VectorXd::Zero(num_inputs_));
+      workspace->input_ad = &input_port_ad_->FixValue(
+          workspace->context_ad.get(), AutoDiffVecXd::Zero(num_inputs_));
+    }
+  }
+
+  std::vector<std::pair<int, int>> sparsity_pattern;
+  for (int i = 0; i < num_time_samples_ - 1; ++i) {
+    for (int col : GetSegmentVariableIndices(i, num_time_samples_,
+                                             num_states_, num_inputs_)) {
+      for (int row = i * num_states_; row < (i + 1) * num_states_; ++row) {
+        sparsity_pattern.emplace_back(row, col);
+      }
+    }
+  }
+  SetGradientSparsityPattern(sparsity_pattern);
+}
+
+DirectCollocationBulkConstraint::~DirectCollocationBulkConstraint() = default;
+
+void DirectCollocationBulkConstraint::CalcDynamics(
+    const Eigen::Ref<const VectorXd>& x, const Eigen::Ref<const VectorXd>& u,
+    Workspace* workspace, VectorXd* xdot, MatrixXd* dxdot_dxu) const {
+  if (dxdot_dxu == nullptr) {
+    if (input_port_) {
+      workspace->input->GetMutableVectorData<double>()->SetFromVector(u);
+    }
+    workspace->context->SetContinuousState(x);
+    *xdot = system_.EvalTimeDerivatives(*workspace->context).CopyToVector();
+    return;
+  }
+  // The derivatives are only with respect to this sample's x and u; the
+  // caller applies the chain rule.
+  const auto [x_with_dxu, u_with_dxu] =
+      InitializeAutoDiffTuple(VectorXd{x}, VectorXd{u});
+  if (input_port_ad_) {
+    workspace->input_ad->GetMutableVectorData<AutoDiffXd>()->SetFromVector(
+        u_with_dxu);
+  }
+  workspace->context_ad->SetContinuousState(x_with_dxu);
+  const AutoDiffVecXd xdot_with_dxu =
+      system_ad_->EvalTimeDerivatives(*workspace->context_ad).CopyToVector();
+  *xdot = ExtractValue(xdot_with_dxu);
+  *dxdot_dxu = ExtractGradient(xdot_with_dxu, num_states_ + num_inputs_);
+}
+
+void DirectCollocationBulkConstraint::CalcDefects(
+    const Eigen::Ref<const VectorXd>& vars, VectorXd* y,
+    Eigen::SparseMatrix<double>* dy_dvars) const {
+  DRAKE_DEMAND(vars.size() == num_vars());
+  const int N = num_time_samples_;
+  const int ns = num_states_;
+  const int nu = num_inputs_;
+  const int num_threads = workspaces_.size();
+  const bool with_gradient = (dy_dvars != nullptr);
+  const auto x = [&](int k) {
+    return vars.segment(N - 1 + k * ns, ns);
+  };
+  const auto u = [&](int k) {
+    return vars.segment(N - 1 + N * ns + k * nu, nu);
+  };
+
+  // The dynamics at every sample (and their Jacobians w.r.t. [x; u]).
+  std::vector<VectorXd> f(N);
+  std::vector<MatrixXd> df(N);
+  ForEachWithWorker(num_threads, N, [&](int worker, int k) {
+    CalcDynamics(x(k), u(k), workspaces_[worker].get(), &f[k],
+                 with_gradient ? &df[k] : nullptr);
+  });
+
+  // The defects at the collocation point of each segment, and their (dense)
+  // gradient w.r.t. { h[i], x[i], x[i+1], u[i], u[i+1] }.
+  y->resize(num_outputs());
+  std::vector<MatrixXd> dy(N - 1);
+  ForEachWithWorker(num_threads, N - 1, [&](int worker, int i) {
+    const double h = vars(i);
+    const auto x0 = x(i);
+    const auto x1 = x(i + 1);
+    const auto u0 = u(i);
+    const auto u1 = u(i + 1);
+    // Cubic interpolation to get xcol and xdotcol.
+    const VectorXd xcol = 0.5 * (x0 + x1) + h / 8 * (f[i] - f[i + 1]);
+    const VectorXd ucol = 0.5 * (u0 + u1);
+    const VectorXd xdotcol = -1.5 * (x0 - x1) / h - 0.25 * (f[i] + f[i + 1]);
+    VectorXd g;
+    MatrixXd dg;
+    CalcDynamics(xcol, ucol, workspaces_[worker].get(), &g,
+                 with_gradient ? &dg : nullptr);
+    y->segment(i * ns, ns) = xdotcol - g;
+    if (!with_gradient) {
+      return;
+    }
+    const auto A0 = df[i].leftCols(ns);
+    const auto B0 = df[i].rightCols(nu);
+    const auto A1 = df[i + 1].leftCols(ns);
+    const auto B1 = df[i + 1].rightCols(nu);
+    const auto Acol = dg.leftCols(ns);
+    const auto Bcol = dg.rightCols(nu);
+    const MatrixXd I = MatrixXd::Identity(ns, ns);
+    // dy = dxdotcol - Acol * dxcol - Bcol * ducol.
+    MatrixXd& J = dy[i];
+    J.resize(ns, 1 + 2 * ns + 2 * nu);
+    J.col(0) = 1.5 * (x0 - x1) / (h * h) - Acol * (f[i] - f[i + 1]) / 8;
+    J.middleCols(1, ns) =
+        -1.5 / h * I - 0.25 * A0 - Acol * (0.5 * I + h / 8 * A0);
+    J.middleCols(1 + ns, ns) =
+        1.5 / h * I - 0.25 * A1 - Acol * (0.5 * I - h / 8 * A1);
+    J.middleCols(1 + 2 * ns, nu) =
+        -0.25 * B0 - h / 8 * Acol * B0 - 0.5 * Bcol;
+    J.middleCols(1 + 2 * ns + nu, nu) =
+        -0.25 * B1 + h / 8 * Acol * B1 - 0.5 * Bcol;
+  });
+  if (!with_gradient) {
+    return;
+  }
+
+  std::vector<Eigen::Triplet<double>> triplets;
+  triplets.reserve((N - 1) * ns * (1 + 2 * ns + 2 * nu));
+  for (int i = 0; i < N - 1; ++i) {
+    const std::vector<int> cols = GetSegmentVariableIndices(i, N, ns, nu);
+    for (int j = 0; j < static_cast<int>(cols.size()); ++j) {
+      for (int r = 0; r < ns; ++r) {
+        triplets.emplace_back(i * ns + r, cols[j], dy[i](r, j));
+      }
+    }
+  }
+  dy_dvars->resize(num_outputs(), num_vars());
+  dy_dvars->setFromTriplets(triplets.begin(), triplets.end());
+}
+
+void DirectCollocationBulkConstraint::DoEval(
+    const Eigen::Ref<const Eigen::VectorXd>& x, Eigen::VectorXd* y) const {
+  CalcDefects(x, y, nullptr);
+}
+
+void DirectCollocationBulkConstraint::DoEval(
+    const Eigen::Ref<const AutoDiffVecXd>& x, AutoDiffVecXd* y) const {
+  VectorXd y_value;
+  Eigen::SparseMatrix<double> dy_dx;
+  CalcDefects(ExtractValue(x), &y_value, &dy_dx);
+  *y = InitializeAutoDiff(y_value, dy_dx * ExtractGradient(x));
+}
+
+void DirectCollocationBulkConstraint::DoEval(
+    const Eigen::Ref<const VectorX<symbolic::Variable>>&,
+    VectorX<symbolic::Expression>*) const {
+  throw std::logic_error(
+      "DirectCollocationBulkConstraint does not support symbolic evaluation.");
+}
+
+void DirectCollocationBulkConstraint::DoEvalWithSparseGradient(
+    const Eigen::Ref<const Eigen::VectorXd>& x, Eigen::VectorXd* y,
+    Eigen::SparseMatrix<double>* dydx) const {
+  CalcDefects(x, y, dydx);
+}
+
 DirectCollocation::DirectCollocation(
     const System<double>* system, const Context<double>& context,
     int num_time_samples, double minimum_time_step, double maximum_time_step,
     std::variant<InputPortSelection, InputPortIndex> input_port_index,
     bool assume_non_continuous_states_are_fixed,
-    solvers::MathematicalProgram* prog)
+    solvers::MathematicalProgram* prog,
+    std::optional<Parallelism> bulk_collocation_parallelism)
     : MultipleShooting(
           system->get_input_port_selection(input_port_index)
               ? system->get_input_port_selection(input_port_index)->size()
@@ -247,13 +503,23 @@ DirectCollocation::DirectCollocation(
           num_time_samples, minimum_time_step, maximum_time_step, prog),
       system_(system),
       context_(context.Clone()),
-      input_port_index_(input_port_index),
-      sample_contexts_(num_time_samples) {
+      input_port_index_(input_port_index) {
   system->ValidateContext(context);
   if (!assume_non_continuous_states_are_fixed) {
     DRAKE_DEMAND(context.has_only_continuous_state());
   }
 
+  if (bulk_collocation_parallelism.has_value()) {
+    auto constraint = std::make_shared<DirectCollocationBulkConstraint>(
+        *system, context, N(), input_port_index,
+        assume_non_continuous_states_are_fixed, *bulk_collocation_parallelism);
+    this->prog()
+        .AddConstraint(constraint, {h_vars(), x_vars(), u_vars()})
+        .evaluator()
+        ->set_description("collocation constraints");
+    return;
+  }
+
   auto system_and_context = MakeAutoDiffXd(*system, context);
   system_ad_ = std::move(system_and_context.first);
   context_ad_ = std::move(system_and_context.second);
@@ -262,6 +528,7 @@ DirectCollocation::DirectCollocation(
   // constraints in order to exploit caching (the dynamics at time k are
   // evaluated both in constraint k and k+1). Note that the constraints cannot
   // be evaluated in parallel.
+  sample_contexts_.resize(N());
   for (int i = 0; i < N(); ++i) {
     sample_contexts_[i] = context_ad_->Clone();
   }
@@ -1,11 +1,13 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <utility>
 #include <variant>
 #include <vector>
 
 #include "drake/common/drake_copyable.h"
+#include "drake/common/parallelism.h"
 #include "drake/planning/trajectory_optimization/multiple_shooting.h"
 #include "drake/solvers/constraint.h"
 #include "drake/systems/framework/context.h"
@@ -61,6 +63,13 @@ class DirectCollocation : public MultipleShooting {
   /// trajectory optimizations into a single program, coupled by a few
   /// constraints.  If nullptr, then a new MathematicalProgram will be
   /// allocated.
+  /// @param bulk_collocation_parallelism (optional). If set, then all of the
+  /// collocation constraints are added as a single
+  /// DirectCollocationBulkConstraint, which evaluates the dynamics at the
+  /// samples in parallel (using at most this many threads) and provides a
+  /// sparse gradient. This is much faster for long trajectories of large
+  /// systems. If unset, then one DirectCollocationConstraint is added for each
+  /// segment.
   /// @throws std::exception if `system` is not supported by this direct
   /// collocation method.
   DirectCollocation(
@@ -71,7 +80,8 @@ class DirectCollocation : public MultipleShooting {
           input_port_index =
               systems::InputPortSelection::kUseFirstInputIfItExists,
       bool assume_non_continuous_states_are_fixed = false,
-      solvers::MathematicalProgram* prog = nullptr);
+      solvers::MathematicalProgram* prog = nullptr,
+      std::optional<Parallelism> bulk_collocation_parallelism = std::nullopt);
 
   // NOTE: The fixed-time-step constructor, which would avoid adding h as
   // decision variables, has been (temporarily) removed since it complicates
@@ -207,6 +217,98 @@ solvers::Binding<solvers::Constraint> AddDirectCollocationConstraint(
     const Eigen::Ref<const solvers::VectorXDecisionVariable>& next_input,
     solvers::MathematicalProgram* prog);
 
+/// Implements the direct collocation constraints (as described in
+/// DirectCollocationConstraint) for all of the segments of a trajectory with
+/// `num_time_samples` samples, as a single constraint.
+///
+/// The decision variables are ordered as { time steps h[0..N-2], states
+/// x[0..N-1], inputs u[0..N-1] }, i.e., exactly as MultipleShooting::h_vars(),
+/// MultipleShooting::x_vars() and MultipleShooting::u_vars(). The constraint
+/// values are the collocation defects of each segment in turn.
+///
+/// Compared to binding one DirectCollocationConstraint per segment, this
+/// constraint:
+/// - evaluates the dynamics once per sample (plus once per collocation point),
+///   dividing the samples among up to `parallelism` threads, each with its
+///   own contexts;
+/// - evaluates the dynamics in `double` when no gradient is requested, and
+///   otherwise with AutoDiffXd derivatives with respect to only the state and
+///   input of that one sample, applying the chain rule in `double`; and
+/// - declares its block-sparse gradient sparsity pattern, and implements
+///   EvalWithSparseGradient() (each segment's defects depend only on h[i],
+///   x[i], x[i+1], u[i] and u[i+1]).
+///
+/// @ingroup solver_evaluators
+class DirectCollocationBulkConstraint final : public solvers::Constraint {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(DirectCollocationBulkConstraint)
+
+  /// @param system A dynamical system to be used in the dynamic constraints.
+  /// This system must support System::ToAutoDiffXd. Note that this is aliased
+  /// for the lifetime of this object.
+  /// @param num_time_samples The number of breakpoints in the trajectory.
+  /// @param parallelism The maximum number of threads used to evaluate the
+  /// dynamics.
+  /// @see DirectCollocation constructor for a description of the remaining
+  /// parameters.
+  /// @throws std::exception if `system` is not supported by this direct
+  /// collocation method, or if `num_time_samples < 2`.
+  DirectCollocationBulkConstraint(
+      const systems::System<double>& system,
+      const systems::Context<double>& context, int num_time_samples,
+      std::variant<systems::InputPortSelection, systems::InputPortIndex>
+          input_port_index =
+              systems::InputPortSelection::kUseFirstInputIfItExists,
+      bool assume_non_continuous_states_are_fixed = false,
+      Parallelism parallelism = Parallelism::None());
+
+  ~DirectCollocationBulkConstraint() override;
+
+  int num_states() const { return num_states_; }
+  int num_inputs() const { return num_inputs_; }
+  int num_time_samples() const { return num_time_samples_; }
+
+ private:
+  struct Workspace;
+
+  // Evaluates the defects of every segment, and (if `dy_dvars` is non-null)
+  // their gradient with respect to all of the decision variables.
+  void CalcDefects(const Eigen::Ref<const Eigen::VectorXd>& vars,
+                   Eigen::VectorXd* y,
+                   Eigen::SparseMatrix<double>* dy_dvars) const;
+
+  // Evaluates xdot = f(x, u) using the given workspace, and (if `dxdot_dxu` is
+  // non-null) its Jacobian with respect to [x; u].
+  void CalcDynamics(const Eigen::Ref<const Eigen::VectorXd>& x,
+                    const Eigen::Ref<const Eigen::VectorXd>& u,
+                    Workspace* workspace, Eigen::VectorXd* xdot,
+                    Eigen::MatrixXd* dxdot_dxu) const;
+
+  void DoEval(const Eigen::Ref<const Eigen::VectorXd>& x,
+              Eigen::VectorXd* y) const final;
+
+  void DoEval(const Eigen::Ref<const AutoDiffVecXd>& x,
+              AutoDiffVecXd* y) const final;
+
+  void DoEval(const Eigen::Ref<const VectorX<symbolic::Variable>>& x,
+              VectorX<symbolic::Expression>* y) const final;
+
+  void DoEvalWithSparseGradient(const Eigen::Ref<const Eigen::VectorXd>& x,
+                                Eigen::VectorXd* y,
+                                Eigen::SparseMatrix<double>* dydx) const final;
+
+  const systems::System<double>& system_;
+  const std::unique_ptr<systems::System<AutoDiffXd>> system_ad_;
+  const systems::InputPort<double>* const input_port_;
+  const systems::InputPort<AutoDiffXd>* const input_port_ad_;
+  const int num_time_samples_{0};
+  const int num_states_{0};
+  const int num_inputs_{0};
+
+  // One workspace per thread.
+  std::vector<std::unique_ptr<Workspace>> workspaces_;
+};
+
 }  // namespace trajectory_optimization
 }  // namespace planning
 }  // namespace drake
@@ -213,12 +213,20 @@ DirectTranscription::DirectTranscription(
   }
   ValidateSystem(*system, context, input_port_index);
 
+  // Impose x[i+1] = A(t) x[i] + B(t) u[i] as [I, -A(t), -B(t)] z = 0 with
+  // z = [x[i+1]; x[i]; u[i]], building the constraint matrix directly rather
+  // than parsing a symbolic formula.
+  const int num_states = this->num_states();
+  Eigen::MatrixXd Aeq(num_states, 2 * num_states + num_inputs());
+  Aeq.leftCols(num_states).setIdentity();
+  const Eigen::VectorXd beq = Eigen::VectorXd::Zero(num_states);
+  solvers::VectorXDecisionVariable vars(Aeq.cols());
   for (int i = 0; i < N() - 1; i++) {
     const double t = system->time_period() * i;
-    prog().AddLinearEqualityConstraint(
-        state(i + 1).cast<symbolic::Expression>() ==
-        system->A(t) * state(i).cast<symbolic::Expression>() +
-            system->B(t) * input(i).cast<symbolic::Expression>());
+    Aeq.middleCols(num_states, num_states) = -system->A(t);
+    Aeq.rightCols(num_inputs()) = -system->B(t);
+    vars << state(i + 1), state(i), input(i);
+    prog().AddLinearEqualityConstraint(Aeq, beq, vars);
   }
   ConstrainEqualInputAtFinalTwoTimesteps();
 }
@@ -307,6 +315,12 @@ bool DirectTranscription::AddSymbolicDynamicConstraints(
       *symbolic_system, fixed_time_step(), symbolic_context.get());
   integrator.Initialize();
   VectorX<Expression> next_state(num_states());
+  solvers::VectorXDecisionVariable vars(num_states() + num_inputs());
+  solvers::VectorXDecisionVariable all_vars(2 * num_states() + num_inputs());
+  Eigen::MatrixXd M(num_states(), vars.size());
+  Eigen::VectorXd v(num_states());
+  Eigen::MatrixXd Aeq(num_states(), all_vars.size());
+  Aeq.leftCols(num_states()).setIdentity();
 
   for (int i = 0; i < N() - 1; i++) {
     symbolic_context->SetTime(i * fixed_time_step());
@@ -331,10 +345,17 @@ bool DirectTranscription::AddSymbolicDynamicConstraints(
                             symbolic::Variables(prog().decision_variables()))) {
       // Note: only check on the first iteration, where we can return false
       // before adding any constraints to the program.  For i>0, the
-      // AddLinearEqualityConstraint call with throw.
+      // DecomposeAffineExpressions call will throw.
       return false;
     }
-    prog().AddLinearEqualityConstraint(state(i + 1) == next_state);
+    // Impose x[i+1] = M [x[i]; u[i]] + v as [I, -M] z = v with
+    // z = [x[i+1]; x[i]; u[i]]. Decomposing next_state directly is much
+    // cheaper than parsing the formula x[i+1] == next_state.
+    vars << state(i), input(i);
+    symbolic::DecomposeAffineExpressions(next_state, vars, &M, &v);
+    Aeq.rightCols(M.cols()) = -M;
+    all_vars << state(i + 1), vars;
+    prog().AddLinearEqualityConstraint(Aeq, v, all_vars);
   }
   return true;
 }
@@ -386,7 +407,14 @@ void DirectTranscription::AddAutodiffDynamicConstraints(
 
 void DirectTranscription::ConstrainEqualInputAtFinalTwoTimesteps() {
   if (num_inputs() > 0) {
-    prog().AddLinearEqualityConstraint(input(N() - 2) == input(N() - 1));
+    // Impose u[N-2] - u[N-1] = 0.
+    Eigen::MatrixXd Aeq(num_inputs(), 2 * num_inputs());
+    Aeq << Eigen::MatrixXd::Identity(num_inputs(), num_inputs()),
+        -Eigen::MatrixXd::Identity(num_inputs(), num_inputs());
+    solvers::VectorXDecisionVariable vars(2 * num_inputs());
+    vars << input(N() - 2), input(N() - 1);
+    prog().AddLinearEqualityConstraint(
+        Aeq, Eigen::VectorXd::Zero(num_inputs()), vars);
   }
 }
 
@@ -742,29 +742,47 @@ GcsTrajectoryOptimization::SolvePath(
   Vertex* dummy_target = nullptr;
 
   if (source.size() != 1) {
-    // Source subgraph has more than one region. Add a dummy source vertex.
-    dummy_source = gcs_.AddVertex(Point(empty_vector), "Dummy source");
-    source_vertex = dummy_source;
-    for (Vertex* v : source.vertices_) {
-      AddEdge(dummy_source, v);
+    // Source subgraph has more than one region. Add a dummy source vertex, or
+    // use the one kept by a previous call.
+    const auto kept = dummy_sources_.find(&source);
+    if (kept != dummy_sources_.end()) {
+      dummy_source = kept->second;
+    } else {
+      dummy_source = gcs_.AddVertex(Point(empty_vector), "Dummy source");
+      for (Vertex* v : source.vertices_) {
+        AddEdge(dummy_source, v);
+      }
+      if (options.reuse_program) {
+        dummy_sources_.emplace(&source, dummy_source);
+      }
     }
+    source_vertex = dummy_source;
   }
   const ScopeExit cleanup_dummy_source_before_returning([&]() {
-    if (dummy_source != nullptr) {
+    if (dummy_source != nullptr && !dummy_sources_.count(&source)) {
       gcs_.RemoveVertex(dummy_source);
     }
   });
 
   if (target.size() != 1) {
-    // Target subgraph has more than one region. Add a dummy target vertex.
-    dummy_target = gcs_.AddVertex(Point(empty_vector), "Dummy target");
-    target_vertex = dummy_target;
-    for (Vertex* v : target.vertices_) {
-      AddEdge(v, dummy_target);
+    // Target subgraph has more than one region. Add a dummy target vertex, or
+    // use the one kept by a previous call.
+    const auto kept = dummy_targets_.find(&target);
+    if (kept != dummy_targets_.end()) {
+      dummy_target = kept->second;
+    } else {
+      dummy_target = gcs_.AddVertex(Point(empty_vector), "Dummy target");
+      for (Vertex* v : target.vertices_) {
+        AddEdge(v, dummy_target);
+      }
+      if (options.reuse_program) {
+        dummy_targets_.emplace(&target, dummy_target);
+      }
     }
+    target_vertex = dummy_target;
   }
   const ScopeExit cleanup_dummy_target_before_returning([&]() {
-    if (dummy_target != nullptr) {
+    if (dummy_target != nullptr && !dummy_targets_.count(&target)) {
       gcs_.RemoveVertex(dummy_target);
     }
   });
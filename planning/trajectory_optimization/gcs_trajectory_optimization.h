@@ -439,6 +439,13 @@ class GcsTrajectoryOptimization final {
   - `options.max_rounded_paths = 5`,
   - `options.preprocessing = true`.
 
+  When `options.reuse_program` is set, the empty sets added for a source or
+  target subgraph with more than one region are kept in the graph for later
+  calls, so that repeated queries between the same subgraphs reuse the
+  program (and the preprocessing) formulated by the first one. Changes to the
+  coefficients of existing costs and constraints between the queries, e.g., to
+  move the start or goal, are written into the kept program in place.
+
   @see `geometry::optimization::GraphOfConvexSetsOptions` for further details.
   */
   std::pair<trajectories::CompositeTrajectory<double>,
@@ -492,6 +499,13 @@ class GcsTrajectoryOptimization final {
   std::vector<std::pair<Eigen::VectorXd, Eigen::VectorXd>>
       global_velocity_bounds_{};
   std::vector<int> global_continuity_constraints_{};
+
+  // The empty sets added by SolvePath() for multi-region source and target
+  // subgraphs that are kept for later calls when options.reuse_program is set.
+  std::map<const Subgraph*, geometry::optimization::GraphOfConvexSets::Vertex*>
+      dummy_sources_;
+  std::map<const Subgraph*, geometry::optimization::GraphOfConvexSets::Vertex*>
+      dummy_targets_;
 };
 
 }  // namespace trajectory_optimization
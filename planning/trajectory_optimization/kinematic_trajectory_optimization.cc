@@ -1,11 +1,14 @@
 #include "drake/planning/trajectory_optimization/kinematic_trajectory_optimization.h"
 
 #include <algorithm>
+#include <cmath>
 #include <limits>
 #include <string>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
+#include "drake/common/parallel_for.h"
 #include "drake/common/pointer_cast.h"
 #include "drake/common/symbolic/decompose.h"
 #include "drake/common/text_logging.h"
@@ -24,8 +27,6 @@ namespace trajectory_optimization {
 
 using math::BsplineBasis;
 using math::EigenToStdVector;
-using math::ExtractValue;
-using math::InitializeAutoDiff;
 using math::StdVectorToEigen;
 using solvers::Constraint;
 using solvers::MathematicalProgram;
@@ -51,22 +52,40 @@ class PathConstraint : public Constraint {
 
   void DoEval(const Eigen::Ref<const Eigen::VectorXd>& x,
               Eigen::VectorXd* y) const override {
-    AutoDiffVecXd y_t;
-    Eval(InitializeAutoDiff(x), &y_t);
-    *y = ExtractValue(y_t);
+    wrapped_constraint_->Eval(SumTerms(x), y);
   }
 
   void DoEval(const Eigen::Ref<const AutoDiffVecXd>& x,
               AutoDiffVecXd* y) const override {
-    AutoDiffVecXd x_sum = basis_function_values_[0] *
-                          x.segment(0, wrapped_constraint_->num_vars());
+    wrapped_constraint_->Eval(SumTerms(x), y);
+  }
+
+  // The wrapped constraint's gradient only has num_positions columns, and
+  // ∂y/∂x = [b₀ ∂y/∂x_sum, b₁ ∂y/∂x_sum, ...], so we avoid differentiating
+  // w.r.t. all of the control points.
+  void DoEvalWithSparseGradient(
+      const Eigen::Ref<const Eigen::VectorXd>& x, Eigen::VectorXd* y,
+      Eigen::SparseMatrix<double>* dydx) const override {
+    Eigen::SparseMatrix<double> dydx_sum;
+    wrapped_constraint_->EvalWithSparseGradient(SumTerms(x), y, &dydx_sum);
+    const int num_wrapped_vars = wrapped_constraint_->num_vars();
     const int num_terms = basis_function_values_.size();
-    for (int i = 1; i < num_terms; ++i) {
-      x_sum += basis_function_values_[i] *
-               x.segment(i * wrapped_constraint_->num_vars(),
-                         wrapped_constraint_->num_vars());
+    std::vector<Eigen::Triplet<double>> triplets;
+    triplets.reserve(num_terms * dydx_sum.nonZeros());
+    for (int i = 0; i < num_terms; ++i) {
+      if (basis_function_values_[i] == 0) {
+        continue;
+      }
+      for (int k = 0; k < dydx_sum.outerSize(); ++k) {
+        for (Eigen::SparseMatrix<double>::InnerIterator it(dydx_sum, k); it;
+             ++it) {
+          triplets.emplace_back(it.row(), i * num_wrapped_vars + it.col(),
+                                basis_function_values_[i] * it.value());
+        }
+      }
     }
-    wrapped_constraint_->Eval(x_sum, y);
+    dydx->resize(y->rows(), x.rows());
+    dydx->setFromTriplets(triplets.begin(), triplets.end());
   }
 
   void DoEval(const Eigen::Ref<const VectorX<symbolic::Variable>>&,
@@ -76,18 +95,165 @@ class PathConstraint : public Constraint {
   }
 
  private:
+  // Returns ∑ᵢ bᵢ xᵢ, where xᵢ is the i'th segment of x.
+  template <typename T>
+  VectorX<T> SumTerms(const Eigen::Ref<const VectorX<T>>& x) const {
+    const int num_wrapped_vars = wrapped_constraint_->num_vars();
+    VectorX<T> x_sum = basis_function_values_[0] * x.head(num_wrapped_vars);
+    const int num_terms = basis_function_values_.size();
+    for (int i = 1; i < num_terms; ++i) {
+      x_sum += basis_function_values_[i] *
+               x.segment(i * num_wrapped_vars, num_wrapped_vars);
+    }
+    return x_sum;
+  }
+
   std::shared_ptr<Constraint> wrapped_constraint_;
   std::vector<double> basis_function_values_;
 };
 
+/* Implements the constraints wrapped_constraints[i](r(sᵢ)) for many samples
+sᵢ as a single constraint. The decision variables are the control points that
+are active at any of the samples, and the outputs are the concatenated outputs
+of the wrapped constraints. The samples are evaluated concurrently. */
+class BatchedPathConstraint : public Constraint {
+ public:
+  // One of the samples: r(sᵢ) = ∑ⱼ bⱼ xⱼ, where xⱼ is the control point at
+  // position control_point_slots[j] in the decision variables, and
+  // bⱼ = basis_function_values[j].
+  struct Sample {
+    std::shared_ptr<Constraint> constraint;
+    std::vector<int> control_point_slots;
+    std::vector<double> basis_function_values;
+    int output_start{};
+  };
+
+  BatchedPathConstraint(std::vector<Sample> samples, int num_positions,
+                        int num_control_point_slots, const VectorXd& lb,
+                        const VectorXd& ub, Parallelism parallelism)
+      : Constraint(lb.size(), num_control_point_slots * num_positions, lb, ub),
+        samples_(std::move(samples)),
+        num_positions_(num_positions),
+        num_threads_(std::max(1, std::min<int>(parallelism.num_threads(),
+                                               samples_.size()))) {
+    // Each sample's outputs only depend on its active control points.
+    std::vector<std::pair<int, int>> sparsity_pattern;
+    for (const Sample& sample : samples_) {
+      for (int row = 0; row < sample.constraint->num_outputs(); ++row) {
+        for (const int slot : sample.control_point_slots) {
+          for (int k = 0; k < num_positions_; ++k) {
+            sparsity_pattern.emplace_back(sample.output_start + row,
+                                          slot * num_positions_ + k);
+          }
+        }
+      }
+    }
+    SetGradientSparsityPattern(sparsity_pattern);
+  }
+
+  void DoEval(const Eigen::Ref<const Eigen::VectorXd>& x,
+              Eigen::VectorXd* y) const override {
+    DoEvalGeneric(x, y);
+  }
+
+  void DoEval(const Eigen::Ref<const AutoDiffVecXd>& x,
+              AutoDiffVecXd* y) const override {
+    DoEvalGeneric(x, y);
+  }
+
+  void DoEvalWithSparseGradient(
+      const Eigen::Ref<const Eigen::VectorXd>& x, Eigen::VectorXd* y,
+      Eigen::SparseMatrix<double>* dydx) const override {
+    y->resize(num_outputs());
+    std::vector<Eigen::SparseMatrix<double>> dydx_samples(samples_.size());
+    ForEachSample([&](int i) {
+      const Sample& sample = samples_[i];
+      VectorXd y_sample;
+      sample.constraint->EvalWithSparseGradient(SumTerms(sample, x), &y_sample,
+                                                &dydx_samples[i]);
+      y->segment(sample.output_start, y_sample.size()) = y_sample;
+    });
+
+    // ∂yᵢ/∂xⱼ = bⱼ ∂yᵢ/∂r(sᵢ).
+    int num_nonzeros = 0;
+    for (size_t i = 0; i < samples_.size(); ++i) {
+      num_nonzeros += samples_[i].control_point_slots.size() *
+                      dydx_samples[i].nonZeros();
+    }
+    std::vector<Eigen::Triplet<double>> triplets;
+    triplets.reserve(num_nonzeros);
+    for (size_t i = 0; i < samples_.size(); ++i) {
+      const Sample& sample = samples_[i];
+      const Eigen::SparseMatrix<double>& dydr = dydx_samples[i];
+      for (size_t j = 0; j < sample.control_point_slots.size(); ++j) {
+        const double b = sample.basis_function_values[j];
+        if (b == 0) {
+          continue;
+        }
+        const int col_start = sample.control_point_slots[j] * num_positions_;
+        for (int k = 0; k < dydr.outerSize(); ++k) {
+          for (Eigen::SparseMatrix<double>::InnerIterator it(dydr, k); it;
+               ++it) {
+            triplets.emplace_back(sample.output_start + it.row(),
+                                  col_start + it.col(), b * it.value());
+          }
+        }
+      }
+    }
+    dydx->resize(num_outputs(), x.rows());
+    dydx->setFromTriplets(triplets.begin(), triplets.end());
+  }
+
+  void DoEval(const Eigen::Ref<const VectorX<symbolic::Variable>>&,
+              VectorX<symbolic::Expression>*) const override {
+    throw std::runtime_error(
+        "BatchedPathConstraint does not support evaluation with Expression.");
+  }
+
+ private:
+  template <typename T>
+  void DoEvalGeneric(const Eigen::Ref<const VectorX<T>>& x,
+                     VectorX<T>* y) const {
+    y->resize(num_outputs());
+    ForEachSample([&](int i) {
+      const Sample& sample = samples_[i];
+      VectorX<T> y_sample;
+      sample.constraint->Eval(SumTerms(sample, x), &y_sample);
+      y->segment(sample.output_start, y_sample.size()) = y_sample;
+    });
+  }
+
+  // Returns r(sᵢ) for the given sample.
+  template <typename T>
+  VectorX<T> SumTerms(const Sample& sample,
+                      const Eigen::Ref<const VectorX<T>>& x) const {
+    VectorX<T> r = VectorX<T>::Zero(num_positions_);
+    for (size_t j = 0; j < sample.control_point_slots.size(); ++j) {
+      r += sample.basis_function_values[j] *
+           x.segment(sample.control_point_slots[j] * num_positions_,
+                     num_positions_);
+    }
+    return r;
+  }
+
+  // Calls func(i) for each sample i, using up to num_threads_ threads. If any
+  // call throws, rethrows the first exception (by sample index).
+  template <typename Func>
+  void ForEachSample(const Func& func) const {
+    drake::internal::ParallelFor(Parallelism(num_threads_), ssize(samples_),
+                                 func);
+  }
+
+  std::vector<Sample> samples_;
+  int num_positions_{};
+  int num_threads_{};
+};
+
 /* Implements a constraint of the form
   wrapped_constraint([q, v]), where
   duration = x[0]
   q = M_pos * x[1:num_pos_vars+1]
   v = M_vel * x[-num_vel_vars:] / duration
-
-  TODO(russt): M_pos and M_vel are predictably sparse, and we could handle that
-  here if performance demands it.
 */
 class WrappedVelocityConstraint : public Constraint {
  public:
@@ -99,25 +265,57 @@ class WrappedVelocityConstraint : public Constraint {
                    wrapped_constraint->upper_bound()),
         wrapped_constraint_(wrapped_constraint),
         M_pos_{std::move(M_pos)},
-        M_vel_{std::move(M_vel)} {
+        M_vel_{std::move(M_vel)},
+        M_pos_sparse_{M_pos_.sparseView()},
+        M_vel_sparse_{M_vel_.sparseView()} {
     DRAKE_DEMAND(M_pos_.rows() + M_vel_.rows() ==
                  wrapped_constraint_->num_vars());
   }
 
   void DoEval(const Eigen::Ref<const Eigen::VectorXd>& x,
               Eigen::VectorXd* y) const override {
-    AutoDiffVecXd y_t;
-    Eval(InitializeAutoDiff(x), &y_t);
-    *y = ExtractValue(y_t);
+    wrapped_constraint_->Eval(CalcQv(x), y);
   }
 
   void DoEval(const Eigen::Ref<const AutoDiffVecXd>& x,
               AutoDiffVecXd* y) const override {
-    AutoDiffXd duration = x[0];
-    VectorX<AutoDiffXd> qv(wrapped_constraint_->num_vars());
-    qv << M_pos_ * x.segment(1, M_pos_.cols()),
-        M_vel_ * x.tail(M_vel_.cols()) / duration;
-    wrapped_constraint_->Eval(qv, y);
+    wrapped_constraint_->Eval(CalcQv(x), y);
+  }
+
+  // ∂y/∂x = ∂y/∂qv ∂qv/∂x, where ∂qv/∂x is assembled from the (sparse) M_pos
+  // and M_vel.
+  void DoEvalWithSparseGradient(
+      const Eigen::Ref<const Eigen::VectorXd>& x, Eigen::VectorXd* y,
+      Eigen::SparseMatrix<double>* dydx) const override {
+    Eigen::SparseMatrix<double> dydqv;
+    wrapped_constraint_->EvalWithSparseGradient(CalcQv(x), y, &dydqv);
+    const double duration = x[0];
+    const Eigen::VectorXd v_times_duration = M_vel_ * x.tail(M_vel_.cols());
+    std::vector<Eigen::Triplet<double>> triplets;
+    triplets.reserve(M_pos_sparse_.nonZeros() + M_vel_sparse_.nonZeros() +
+                     M_vel_.rows());
+    for (int k = 0; k < M_pos_sparse_.outerSize(); ++k) {
+      for (Eigen::SparseMatrix<double>::InnerIterator it(M_pos_sparse_, k); it;
+           ++it) {
+        triplets.emplace_back(it.row(), 1 + it.col(), it.value());
+      }
+    }
+    for (int i = 0; i < M_vel_.rows(); ++i) {
+      triplets.emplace_back(M_pos_.rows() + i, 0,
+                            -v_times_duration[i] / (duration * duration));
+    }
+    for (int k = 0; k < M_vel_sparse_.outerSize(); ++k) {
+      for (Eigen::SparseMatrix<double>::InnerIterator it(M_vel_sparse_, k); it;
+           ++it) {
+        triplets.emplace_back(M_pos_.rows() + it.row(),
+                              1 + M_pos_.cols() + it.col(),
+                              it.value() / duration);
+      }
+    }
+    Eigen::SparseMatrix<double> dqvdx(wrapped_constraint_->num_vars(),
+                                      x.rows());
+    dqvdx.setFromTriplets(triplets.begin(), triplets.end());
+    *dydx = dydqv * dqvdx;
   }
 
   void DoEval(const Eigen::Ref<const VectorX<symbolic::Variable>>&,
@@ -128,9 +326,20 @@ class WrappedVelocityConstraint : public Constraint {
   }
 
  private:
+  template <typename T>
+  VectorX<T> CalcQv(const Eigen::Ref<const VectorX<T>>& x) const {
+    const T& duration = x[0];
+    VectorX<T> qv(wrapped_constraint_->num_vars());
+    qv << M_pos_ * x.segment(1, M_pos_.cols()),
+        M_vel_ * x.tail(M_vel_.cols()) / duration;
+    return qv;
+  }
+
   std::shared_ptr<Constraint> wrapped_constraint_;
   const Eigen::MatrixXd M_pos_;
   const Eigen::MatrixXd M_vel_;
+  const Eigen::SparseMatrix<double> M_pos_sparse_;
+  const Eigen::SparseMatrix<double> M_vel_sparse_;
 };
 
 /* Implements a constraint of the form:
@@ -144,15 +353,37 @@ class DerivativeConstraint : public Constraint {
                        const Eigen::Ref<const VectorXd>& ub)
       : Constraint(M.rows(), M.cols() + 1, lb, ub),
         M_{M},
+        M_sparse_{M.sparseView()},
         derivative_order_{derivative_order} {
     DRAKE_DEMAND(derivative_order >= 1);
   }
 
   void DoEval(const Eigen::Ref<const Eigen::VectorXd>& x,
               Eigen::VectorXd* y) const override {
-    AutoDiffVecXd y_t;
-    Eval(InitializeAutoDiff(x), &y_t);
-    *y = ExtractValue(y_t);
+    const double duration = x[0];
+    *y = M_ * x.tail(M_.cols()) / std::pow(duration, derivative_order_);
+  }
+
+  // ∂y/∂x = [-order * y / duration, M / duration^order].
+  void DoEvalWithSparseGradient(
+      const Eigen::Ref<const Eigen::VectorXd>& x, Eigen::VectorXd* y,
+      Eigen::SparseMatrix<double>* dydx) const override {
+    DoEval(x, y);
+    const double duration = x[0];
+    const double scale = 1.0 / std::pow(duration, derivative_order_);
+    std::vector<Eigen::Triplet<double>> triplets;
+    triplets.reserve(M_.rows() + M_sparse_.nonZeros());
+    for (int i = 0; i < M_.rows(); ++i) {
+      triplets.emplace_back(i, 0, -derivative_order_ * (*y)[i] / duration);
+    }
+    for (int k = 0; k < M_sparse_.outerSize(); ++k) {
+      for (Eigen::SparseMatrix<double>::InnerIterator it(M_sparse_, k); it;
+           ++it) {
+        triplets.emplace_back(it.row(), 1 + it.col(), it.value() * scale);
+      }
+    }
+    dydx->resize(M_.rows(), x.rows());
+    dydx->setFromTriplets(triplets.begin(), triplets.end());
   }
 
   void DoEval(const Eigen::Ref<const AutoDiffVecXd>& x,
@@ -169,6 +400,7 @@ class DerivativeConstraint : public Constraint {
 
  private:
   const Eigen::MatrixXd M_;
+  const Eigen::SparseMatrix<double> M_sparse_;
   const int derivative_order_;
 };
 
@@ -249,8 +481,25 @@ void KinematicTrajectoryOptimization::AddPathPositionConstraint(
   DRAKE_DEMAND(lb.size() == num_positions());
   DRAKE_DEMAND(ub.size() == num_positions());
   DRAKE_DEMAND(0 <= s && s <= 1);
-  const VectorX<symbolic::Expression> sym_r_value = sym_r_->value(s);
-  prog_.AddLinearConstraint(lb <= sym_r_value && sym_r_value <= ub);
+  // r(s) is the sum of the active control points, weighted by their basis
+  // function values, so we build the constraint matrix directly rather than
+  // parsing the symbolic formula lb <= r(s) <= ub.
+  const std::vector<int> active_control_point_indices =
+      basis_.ComputeActiveBasisFunctionIndices(s);
+  const int num_active_control_points =
+      static_cast<int>(active_control_point_indices.size());
+  MatrixXd A(num_positions(), num_active_control_points * num_positions());
+  VectorXDecisionVariable var_vector(num_active_control_points *
+                                     num_positions());
+  for (int i = 0; i < num_active_control_points; ++i) {
+    const int control_point_index = active_control_point_indices[i];
+    A.middleCols(i * num_positions(), num_positions()) =
+        basis_.EvaluateBasisFunctionI(control_point_index, s) *
+        MatrixXd::Identity(num_positions(), num_positions());
+    var_vector.segment(i * num_positions(), num_positions()) =
+        control_points_.col(control_point_index);
+  }
+  prog_.AddLinearConstraint(A, lb, ub, var_vector);
 }
 
 void KinematicTrajectoryOptimization::AddPathPositionConstraint(
@@ -277,6 +526,65 @@ void KinematicTrajectoryOptimization::AddPathPositionConstraint(
       var_vector);
 }
 
+void KinematicTrajectoryOptimization::AddPathPositionConstraints(
+    const std::vector<std::shared_ptr<Constraint>>& constraints,
+    const std::vector<double>& s, Parallelism parallelism) {
+  DRAKE_THROW_UNLESS(constraints.size() == s.size());
+  if (constraints.empty()) {
+    return;
+  }
+  // The decision variables are the control points that are active at any of
+  // the samples, in increasing order.
+  std::vector<int> slot_of_control_point(num_control_points_, -1);
+  std::vector<BatchedPathConstraint::Sample> samples(s.size());
+  int num_outputs = 0;
+  for (size_t i = 0; i < s.size(); ++i) {
+    DRAKE_THROW_UNLESS(constraints[i] != nullptr);
+    DRAKE_THROW_UNLESS(constraints[i]->num_vars() == num_positions_);
+    DRAKE_THROW_UNLESS(0 <= s[i] && s[i] <= 1);
+    samples[i].constraint = constraints[i];
+    samples[i].output_start = num_outputs;
+    num_outputs += constraints[i]->num_outputs();
+    for (const int index : basis_.ComputeActiveBasisFunctionIndices(s[i])) {
+      slot_of_control_point[index] = 0;
+    }
+  }
+  int num_slots = 0;
+  for (int& slot : slot_of_control_point) {
+    if (slot == 0) {
+      slot = num_slots++;
+    }
+  }
+  VectorXDecisionVariable var_vector(num_slots * num_positions_);
+  for (int index = 0; index < num_control_points_; ++index) {
+    if (slot_of_control_point[index] >= 0) {
+      var_vector.segment(slot_of_control_point[index] * num_positions_,
+                         num_positions_) = control_points_.col(index);
+    }
+  }
+
+  VectorXd lb(num_outputs);
+  VectorXd ub(num_outputs);
+  for (size_t i = 0; i < s.size(); ++i) {
+    BatchedPathConstraint::Sample& sample = samples[i];
+    for (const int index : basis_.ComputeActiveBasisFunctionIndices(s[i])) {
+      sample.control_point_slots.push_back(slot_of_control_point[index]);
+      sample.basis_function_values.push_back(
+          basis_.EvaluateBasisFunctionI(index, s[i]));
+    }
+    const int num_sample_outputs = sample.constraint->num_outputs();
+    lb.segment(sample.output_start, num_sample_outputs) =
+        sample.constraint->lower_bound();
+    ub.segment(sample.output_start, num_sample_outputs) =
+        sample.constraint->upper_bound();
+  }
+  prog_.AddConstraint(
+      std::make_shared<BatchedPathConstraint>(std::move(samples),
+                                              num_positions_, num_slots, lb,
+                                              ub, parallelism),
+      var_vector);
+}
+
 void KinematicTrajectoryOptimization::AddPathVelocityConstraint(
     const Eigen::Ref<const Eigen::VectorXd>& lb,
     const Eigen::Ref<const Eigen::VectorXd>& ub, double s) {
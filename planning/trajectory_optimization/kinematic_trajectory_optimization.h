@@ -8,6 +8,7 @@
 #include <vector>
 
 #include "drake/common/copyable_unique_ptr.h"
+#include "drake/common/parallelism.h"
 #include "drake/common/trajectories/bspline_trajectory.h"
 #include "drake/solvers/binding.h"
 #include "drake/solvers/mathematical_program.h"
@@ -116,6 +117,31 @@ class KinematicTrajectoryOptimization {
   void AddPathPositionConstraint(
       const std::shared_ptr<solvers::Constraint>& constraint, double s);
 
+  /** Adds (generic) constraints on the path at many samples, where
+  `constraints[i]` will be evaluated as if it is bound with variables
+  corresponding to `r(s[i])`.
+
+  This is equivalent to calling AddPathPositionConstraint(constraints[i], s[i])
+  for each sample, but adds a single constraint to the program. Its samples are
+  evaluated concurrently (using at most `parallelism` threads), and its sparse
+  gradient is assembled from the samples' gradients. Use it for expensive
+  constraints that are imposed densely along the path, such as collision
+  avoidance (e.g., one MinimumDistanceLowerBoundConstraint per sample).
+
+  Because the samples may be evaluated concurrently, the constraints must not
+  share any mutable state. In particular, constraints that evaluate a
+  MultibodyPlant must each be constructed with their own Context (or
+  CollisionCheckerContext).
+
+  @throws std::exception if constraints.size() != s.size().
+  @throws std::exception if any constraint is nullptr, or has num_vars() !=
+  num_positions().
+  @throws std::exception unless 0 <= `s[i]` <= 1. */
+  void AddPathPositionConstraints(
+      const std::vector<std::shared_ptr<solvers::Constraint>>& constraints,
+      const std::vector<double>& s,
+      Parallelism parallelism = Parallelism::Max());
+
   /** Adds a linear constraint on the derivative of the path, `lb` ≤ ṙ(s) ≤
   `ub`. Note that this does NOT directly constrain q̇(t).
   @pre 0 <= `s` <= 1. */
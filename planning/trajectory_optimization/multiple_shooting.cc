@@ -178,8 +178,10 @@ MultipleShooting::AddEqualTimeIntervalsConstraints() {
   DRAKE_THROW_UNLESS(time_steps_are_decision_variables_);
   std::vector<solvers::Binding<solvers::LinearConstraint>> constraints;
   for (int i = 1; i < N_ - 1; i++) {
-    constraints.push_back(
-        prog_.AddLinearConstraint(h_vars_(i - 1) == h_vars_(i)));
+    // Impose h[i-1] - h[i] = 0.
+    constraints.push_back(prog_.AddLinearEqualityConstraint(
+        Eigen::RowVector2d(1, -1), Vector1d::Zero(),
+        Vector2<Variable>(h_vars_(i - 1), h_vars_(i))));
   }
   return constraints;
 }
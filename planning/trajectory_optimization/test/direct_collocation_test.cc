@@ -478,6 +478,115 @@ GTEST_TEST(DirectCollocation, InputPortSelection) {
   EXPECT_TRUE(result.is_success());
 }
 
+// The bulk constraint must match the per-segment constraints, in both value
+// and gradient.
+GTEST_TEST(DirectCollocationBulkConstraint, MatchesPerSegmentConstraints) {
+  const auto plant = multibody::benchmarks::pendulum::MakePendulumPlant();
+  auto context = plant->CreateDefaultContext();
+  const auto input_port_index = plant->get_actuation_input_port().get_index();
+  const DirectCollocationConstraint segment_constraint(*plant, *context,
+                                                       input_port_index);
+
+  const int kNumSamples = 4;
+  const int ns = 2;
+  const int nu = 1;
+  for (const Parallelism parallelism : {Parallelism::None(), Parallelism(2)}) {
+    const DirectCollocationBulkConstraint bulk_constraint(
+        *plant, *context, kNumSamples, input_port_index, false, parallelism);
+    EXPECT_EQ(bulk_constraint.num_states(), ns);
+    EXPECT_EQ(bulk_constraint.num_inputs(), nu);
+    EXPECT_EQ(bulk_constraint.num_time_samples(), kNumSamples);
+    ASSERT_EQ(bulk_constraint.num_vars(),
+              (kNumSamples - 1) + kNumSamples * (ns + nu));
+    ASSERT_EQ(bulk_constraint.num_constraints(), (kNumSamples - 1) * ns);
+
+    Eigen::VectorXd vars =
+        Eigen::VectorXd::LinSpaced(bulk_constraint.num_vars(), -1.0, 2.0);
+    vars.head(kNumSamples - 1) << 0.1, 0.2, 0.15;
+
+    Eigen::VectorXd y;
+    Eigen::SparseMatrix<double> dydx;
+    bulk_constraint.EvalWithSparseGradient(vars, &y, &dydx);
+    const Eigen::MatrixXd dydx_dense = dydx;
+
+    Eigen::VectorXd y_double;
+    bulk_constraint.Eval(vars, &y_double);
+    EXPECT_TRUE(CompareMatrices(y_double, y, 1e-14));
+
+    for (int i = 0; i < kNumSamples - 1; ++i) {
+      // The variables of segment i, in the order { h, x0, x1, u0, u1 }.
+      std::vector<int> indices{i};
+      for (int j = 0; j < 2 * ns; ++j) {
+        indices.push_back(kNumSamples - 1 + i * ns + j);
+      }
+      for (int j = 0; j < 2 * nu; ++j) {
+        indices.push_back(kNumSamples - 1 + kNumSamples * ns + i * nu + j);
+      }
+      Eigen::VectorXd segment_vars(indices.size());
+      for (int j = 0; j < static_cast<int>(indices.size()); ++j) {
+        segment_vars(j) = vars(indices[j]);
+      }
+      AutoDiffVecXd segment_y;
+      segment_constraint.Eval(math::InitializeAutoDiff(segment_vars),
+                              &segment_y);
+      EXPECT_TRUE(CompareMatrices(y.segment(i * ns, ns),
+                                  math::ExtractValue(segment_y), 1e-12));
+      const Eigen::MatrixXd segment_dydx = math::ExtractGradient(segment_y);
+      for (int j = 0; j < static_cast<int>(indices.size()); ++j) {
+        EXPECT_TRUE(CompareMatrices(dydx_dense.block(i * ns, indices[j], ns, 1),
+                                    segment_dydx.col(j), 1e-10));
+      }
+    }
+
+    // The gradient is block sparse.
+    EXPECT_EQ(dydx.nonZeros(), (kNumSamples - 1) * ns * (1 + 2 * ns + 2 * nu));
+    ASSERT_TRUE(bulk_constraint.gradient_sparsity_pattern().has_value());
+    EXPECT_EQ(bulk_constraint.gradient_sparsity_pattern()->size(),
+              dydx.nonZeros());
+
+    // AutoDiff evaluation applies the chain rule through the same gradient.
+    AutoDiffVecXd y_ad;
+    bulk_constraint.Eval(math::InitializeAutoDiff(vars), &y_ad);
+    EXPECT_TRUE(CompareMatrices(math::ExtractValue(y_ad), y, 1e-14));
+    EXPECT_TRUE(
+        CompareMatrices(math::ExtractGradient(y_ad), dydx_dense, 1e-14));
+  }
+}
+
+GTEST_TEST(DirectCollocation, BulkCollocationConstraint) {
+  const auto plant = multibody::benchmarks::pendulum::MakePendulumPlant();
+  auto context = plant->CreateDefaultContext();
+
+  const int kNumSamples = 5;
+  const double kMinStep = 0.05;
+  const double kMaxStep = 0.5;
+  DirectCollocation dircol(
+      plant.get(), *context, kNumSamples, kMinStep, kMaxStep,
+      plant->get_actuation_input_port().get_index(), false, nullptr,
+      Parallelism(2));
+  auto& prog = dircol.prog();
+
+  // All of the segments share a single collocation constraint.
+  ASSERT_EQ(prog.generic_constraints().size(), 1);
+  EXPECT_NE(dynamic_cast<const DirectCollocationBulkConstraint*>(
+                prog.generic_constraints()[0].evaluator().get()),
+            nullptr);
+
+  dircol.AddEqualTimeIntervalsConstraints();
+
+  Eigen::Vector2d initial_state{0.0, 0.1};
+  Eigen::Vector2d final_state{0.0, 0.0};
+
+  prog.AddConstraint(dircol.initial_state() == initial_state);
+  prog.AddConstraint(dircol.final_state() == final_state);
+
+  const auto& u = dircol.input();
+  dircol.AddRunningCost(10 * u[0] * u[0]);
+
+  const auto result = Solve(prog);
+  EXPECT_TRUE(result.is_success());
+}
+
 // Provide a helpful error if the user does *not* provide the
 // InputPortSelection.
 GTEST_TEST(DirectCollocation, InputPortSelectionError) {
@@ -963,6 +963,22 @@ TEST_F(SimpleEnv2D, MultiStartGoal) {
   EXPECT_TRUE(result.is_success());
   EXPECT_TRUE(CompareMatrices(traj.value(traj.start_time()), start2, 1e-6));
   EXPECT_TRUE(CompareMatrices(traj.value(traj.end_time()), goal2, 1e-6));
+
+  // Repeated queries that reuse the program keep the dummy source and target
+  // vertices in the graph, and give the same result.
+  const size_t num_vertices = gcs.graph_of_convex_sets().Vertices().size();
+  options.reuse_program = true;
+  for (int i = 0; i < 2; ++i) {
+    auto [reused_traj, reused_result] = gcs.SolvePath(source, target, options);
+    EXPECT_TRUE(reused_result.is_success());
+    EXPECT_NEAR(reused_result.get_optimal_cost(), result.get_optimal_cost(),
+                1e-6);
+    EXPECT_TRUE(CompareMatrices(reused_traj.value(reused_traj.start_time()),
+                                start2, 1e-6));
+    EXPECT_TRUE(CompareMatrices(reused_traj.value(reused_traj.end_time()),
+                                goal2, 1e-6));
+    EXPECT_EQ(gcs.graph_of_convex_sets().Vertices().size(), num_vertices + 2);
+  }
 }
 
 TEST_F(SimpleEnv2D, IntermediatePoint) {
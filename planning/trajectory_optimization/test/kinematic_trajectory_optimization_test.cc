@@ -8,6 +8,7 @@
 #include "drake/common/symbolic/expression.h"
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
 #include "drake/common/text_logging.h"
+#include "drake/math/autodiff_gradient.h"
 #include "drake/math/matrix_util.h"
 #include "drake/solvers/ipopt_solver.h"
 #include "drake/solvers/osqp_solver.h"
@@ -104,6 +105,70 @@ TEST_F(KinematicTrajectoryOptimizationTest, AddPathPositionConstraintGeneric) {
   EXPECT_LE(squared_norm, 1.0 + kTol);
 }
 
+// The constraints that wrap other constraints compute their sparse gradients
+// directly; they must match the AutoDiffXd gradients.
+TEST_F(KinematicTrajectoryOptimizationTest, EvalWithSparseGradient) {
+  trajopt_.AddPathPositionConstraint(
+      std::make_shared<SimplePositionConstraint>(), 0.2);
+  trajopt_.AddVelocityConstraintAtNormalizedTime(
+      std::make_shared<solvers::BoundingBoxConstraint>(VectorXd::Zero(6),
+                                                       VectorXd::Ones(6)),
+      0.3);
+  trajopt_.AddAccelerationBounds(-VectorXd::Ones(num_positions_),
+                                 VectorXd::Ones(num_positions_));
+  trajopt_.AddPathPositionConstraints(
+      {std::make_shared<SimplePositionConstraint>(),
+       std::make_shared<SimplePositionConstraint>()},
+      {0.1, 0.7});
+  EXPECT_GT(trajopt_.prog().generic_constraints().size(), 3);
+
+  for (const auto& binding : trajopt_.prog().generic_constraints()) {
+    const auto& evaluator = binding.evaluator();
+    // The first variable is the duration, when it is bound.
+    const VectorXd x = VectorXd::LinSpaced(evaluator->num_vars(), 0.5, 2.0);
+    VectorXd y;
+    Eigen::SparseMatrix<double> dydx;
+    evaluator->EvalWithSparseGradient(x, &y, &dydx);
+    AutoDiffVecXd y_autodiff;
+    evaluator->Eval(math::InitializeAutoDiff(x), &y_autodiff);
+    const double kTol = 1e-12;
+    EXPECT_TRUE(CompareMatrices(y, math::ExtractValue(y_autodiff), kTol));
+    EXPECT_TRUE(CompareMatrices(dydx.toDense(),
+                                math::ExtractGradient(y_autodiff), kTol));
+  }
+}
+
+// The batched constraint is equivalent to one constraint per sample.
+TEST_F(KinematicTrajectoryOptimizationTest, AddPathPositionConstraints) {
+  const std::vector<double> s{0.0, 0.15, 0.2, 0.55, 1.0};
+  std::vector<std::shared_ptr<solvers::Constraint>> constraints;
+  for (size_t i = 0; i < s.size(); ++i) {
+    constraints.push_back(std::make_shared<SimplePositionConstraint>());
+  }
+  trajopt_.AddPathPositionConstraints(constraints, s, Parallelism(2));
+  ASSERT_EQ(trajopt_.prog().generic_constraints().size(), 1);
+  const auto& batched = trajopt_.prog().generic_constraints()[0];
+  EXPECT_EQ(batched.evaluator()->num_outputs(), static_cast<int>(s.size()));
+  EXPECT_TRUE(batched.evaluator()->gradient_sparsity_pattern().has_value());
+
+  const BsplineTrajectory<double> guess(
+      trajopt_.basis(),
+      math::EigenToStdVector<double>(MatrixXd::NullaryExpr(
+          num_positions_, num_control_points_, [](Eigen::Index i) {
+            return 0.1 * i;
+          })));
+  trajopt_.SetInitialGuess(guess);
+  const VectorXd y = trajopt_.prog().EvalBindingAtInitialGuess(batched);
+  for (size_t i = 0; i < s.size(); ++i) {
+    // The guess is defined over s∈[0, 1], so it is also the path r(s).
+    EXPECT_NEAR(y(i), guess.value(s[i]).squaredNorm(), 1e-12);
+  }
+
+  // Mismatched arguments are rejected.
+  EXPECT_THROW(trajopt_.AddPathPositionConstraints(constraints, {0.5}),
+               std::exception);
+}
+
 TEST_F(KinematicTrajectoryOptimizationTest, AddPathVelocityConstraint) {
   EXPECT_EQ(trajopt_.prog().linear_constraints().size(), 0);
   VectorXd desired = VectorXd::Ones(num_positions_);
@@ -1,6 +1,7 @@
 #include "drake/planning/visibility_graph.h"
 
 #include <algorithm>
+#include <cmath>
 #include <iterator>
 #include <vector>
 
@@ -110,8 +111,9 @@ class EdgesIterator {
 Eigen::SparseMatrix<bool> VisibilityGraph(
     const CollisionChecker& checker,
     const Eigen::Ref<const Eigen::MatrixXd>& points,
-    const Parallelism parallelize) {
+    const Parallelism parallelize, const double max_distance) {
   DRAKE_THROW_UNLESS(checker.plant().num_positions() == points.rows());
+  DRAKE_THROW_UNLESS(max_distance >= 0.0);
 
   const int num_points = points.cols();
   const int num_threads_to_use =
@@ -122,13 +124,21 @@ Eigen::SparseMatrix<bool> VisibilityGraph(
   drake::log()->debug("Generating VisibilityGraph using {} threads",
                       num_threads_to_use);
 
+  // The checker takes VectorXd arguments, so copy each point once up front
+  // rather than once for every check that involves it.
+  std::vector<Eigen::VectorXd> qs(num_points);
+  for (int i = 0; i < num_points; ++i) {
+    qs[i] = points.col(i);
+  }
+  const bool limit_distance = std::isfinite(max_distance);
+
   // Choose std::vector<uint8_t> as a thread-safe data structure for the
   // parallel evaluations.
   std::vector<uint8_t> points_free(num_points, 0x00);
 
   const auto point_check_work = [&](const int thread_num, const int64_t i) {
     points_free[i] = static_cast<uint8_t>(
-        checker.CheckConfigCollisionFree(points.col(i), thread_num));
+        checker.CheckConfigCollisionFree(qs[i], thread_num));
   };
 
   StaticParallelForIndexLoop(DegreeOfParallelism(num_threads_to_use), 0,
@@ -139,14 +149,25 @@ Eigen::SparseMatrix<bool> VisibilityGraph(
   // evaluations.
   std::vector<std::vector<int>> edges(num_points);
 
+  // Each undirected edge is only checked once, as (i, j) with i < j. Row i
+  // has num_points - i - 1 candidates, so the rows are handed out dynamically
+  // to balance the load.
   const auto edge_check_work = [&](const int thread_num, const int64_t index) {
     const int i = static_cast<int>(index);
     if (points_free[i] > 0) {
       edges[i].push_back(i);
       for (int j = i + 1; j < num_points; ++j) {
-        if (points_free[j] > 0 &&
-            checker.CheckEdgeCollisionFree(points.col(i), points.col(j),
-                                           thread_num)) {
+        if (points_free[j] == 0) {
+          continue;
+        }
+        // The distance is far cheaper than even the first collision check of
+        // the edge.
+        if (limit_distance &&
+            !(checker.ComputeConfigurationDistance(qs[i], qs[j]) <=
+              max_distance)) {
+          continue;
+        }
+        if (checker.CheckEdgeCollisionFree(qs[i], qs[j], thread_num)) {
           edges[i].push_back(j);
         }
       }
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <limits>
+
 #include <Eigen/Sparse>
 
 #include "drake/common/parallelism.h"
@@ -21,6 +23,14 @@ LinearDistanceAndInterpolationProvider, which is the default), but some more
 complex spaces with non-linear interpolation (e.g. a Dubin's car) are not
 symmetric.
 
+When `max_distance` is finite, only pairs of points that are at most
+`max_distance` apart (as measured by
+CollisionChecker::ComputeConfigurationDistance()) are candidates for an edge;
+the edges of more distant pairs are not checked at all. For a dense sampling of
+the configuration space (e.g., to seed regions with a clique cover), most long
+edges are in collision anyway, so this can skip most of the collision checks.
+(Every point that is collision free still has an edge to itself.)
+
 If `parallelize` specifies more than one thread, then the
 CollisionCheckerParams::distance_and_interpolation_provider for `checker` must
 be implemented in C++, either by providing the C++ implementation directly
@@ -30,11 +40,13 @@ directly or by using the default provider.
 points.col(j). A is always symmetric.
 
 @pre points.rows() == total number of positions in the collision checker plant.
+@throws std::exception if `max_distance` is negative or NaN.
 */
 Eigen::SparseMatrix<bool> VisibilityGraph(
     const CollisionChecker& checker,
     const Eigen::Ref<const Eigen::MatrixXd>& points,
-    Parallelism parallelize = Parallelism::Max());
+    Parallelism parallelize = Parallelism::Max(),
+    double max_distance = std::numeric_limits<double>::infinity());
 
 }  // namespace planning
 }  // namespace drake
@@ -3,6 +3,7 @@
 #include <algorithm>
 #include <limits>
 #include <map>
+#include <vector>
 
 #include <fmt/format.h>
 
@@ -244,6 +245,28 @@ const Binding<QuadraticCost>* FindNonconvexQuadraticCost(
 }
 
 namespace internal {
+bool HasDuplicateVariables(const VectorX<symbolic::Variable>& vars) {
+  // Bindings usually have few variables, for which the quadratic loop beats
+  // sorting.
+  constexpr int kSortThreshold = 16;
+  if (vars.rows() <= kSortThreshold) {
+    for (int i = 1; i < vars.rows(); ++i) {
+      for (int j = 0; j < i; ++j) {
+        if (vars(i).get_id() == vars(j).get_id()) {
+          return true;
+        }
+      }
+    }
+    return false;
+  }
+  std::vector<symbolic::Variable::Id> ids(vars.rows());
+  for (int i = 0; i < vars.rows(); ++i) {
+    ids[i] = vars(i).get_id();
+  }
+  std::sort(ids.begin(), ids.end());
+  return std::adjacent_find(ids.begin(), ids.end()) != ids.end();
+}
+
 const Binding<QuadraticCost>* FindNonconvexQuadraticCost(
     const std::vector<Binding<QuadraticCost>>& quadratic_costs) {
   for (const auto& cost : quadratic_costs) {
@@ -450,7 +473,7 @@ void ParseQuadraticCosts(const MathematicalProgram& prog,
                          std::vector<Eigen::Triplet<double>>* P_upper_triplets,
                          std::vector<double>* c, double* constant) {
   for (const auto& cost : prog.quadratic_costs()) {
-    const auto var_indices = prog.FindDecisionVariableIndices(cost.variables());
+    const auto var_indices = prog.FindDecisionVariableIndices(cost);
     for (int j = 0; j < cost.evaluator()->Q().cols(); ++j) {
       for (int i = 0; i <= j; ++i) {
         if (cost.evaluator()->Q()(i, j) != 0) {
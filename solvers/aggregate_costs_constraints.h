@@ -94,6 +94,12 @@ void AggregateDuplicateVariables(const Eigen::SparseMatrix<double>& A,
                                  VectorX<symbolic::Variable>* vars_new);
 
 namespace internal {
+// Returns true if `vars` contains some variable more than once. This is much
+// cheaper than building a symbolic::Variables from `vars`, which matters when
+// the solvers convert many small bindings.
+[[nodiscard]] bool HasDuplicateVariables(
+    const VectorX<symbolic::Variable>& vars);
+
 // Returns the first non-convex quadratic cost among @p quadratic_costs. If all
 // quadratic costs are convex, then return a nullptr.
 [[nodiscard]] const Binding<QuadraticCost>* FindNonconvexQuadraticCost(
@@ -113,9 +113,58 @@ static void BenchmarkSosProgram3(benchmark::State& state) {  // NOLINT
   }
 }
 
+// Adds the constraints x[k+1] = A x[k] + B u[k] of a linear trajectory
+// optimization with state.range(0) knots, by parsing symbolic formulas.
+static void BenchmarkLinearDynamicsSymbolic(
+    benchmark::State& state) {  // NOLINT
+  const int num_knots = state.range(0);
+  const Eigen::MatrixXd A = Eigen::MatrixXd::Identity(12, 12) * 1.1;
+  const Eigen::MatrixXd B = Eigen::MatrixXd::Ones(12, 4);
+  for (auto _ : state) {
+    MathematicalProgram prog;
+    const auto x = prog.NewContinuousVariables(12, num_knots, "x");
+    const auto u = prog.NewContinuousVariables(4, num_knots, "u");
+    for (int k = 0; k < num_knots - 1; ++k) {
+      prog.AddLinearEqualityConstraint(
+          x.col(k + 1).cast<symbolic::Expression>() ==
+          A * x.col(k).cast<symbolic::Expression>() +
+              B * u.col(k).cast<symbolic::Expression>());
+    }
+  }
+}
+
+// Adds the same constraints as BenchmarkLinearDynamicsSymbolic, but builds
+// the constraint matrices directly.
+static void BenchmarkLinearDynamicsMatrix(benchmark::State& state) {  // NOLINT
+  const int num_knots = state.range(0);
+  const Eigen::MatrixXd A = Eigen::MatrixXd::Identity(12, 12) * 1.1;
+  const Eigen::MatrixXd B = Eigen::MatrixXd::Ones(12, 4);
+  Eigen::MatrixXd Aeq(12, 28);
+  Aeq << Eigen::MatrixXd::Identity(12, 12), -A, -B;
+  const Eigen::VectorXd beq = Eigen::VectorXd::Zero(12);
+  for (auto _ : state) {
+    MathematicalProgram prog;
+    const auto x = prog.NewContinuousVariables(12, num_knots, "x");
+    const auto u = prog.NewContinuousVariables(4, num_knots, "u");
+    VectorXDecisionVariable vars(28);
+    for (int k = 0; k < num_knots - 1; ++k) {
+      vars << x.col(k + 1), x.col(k), u.col(k);
+      prog.AddLinearEqualityConstraint(Aeq, beq, vars);
+    }
+  }
+}
+
 BENCHMARK(BenchmarkSosProgram1);
 BENCHMARK(BenchmarkSosProgram2);
 BENCHMARK(BenchmarkSosProgram3);
+BENCHMARK(BenchmarkLinearDynamicsSymbolic)
+    ->Arg(100)
+    ->Arg(1000)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BenchmarkLinearDynamicsMatrix)
+    ->Arg(100)
+    ->Arg(1000)
+    ->Unit(benchmark::kMillisecond);
 }  // namespace
 }  // namespace solvers
 }  // namespace drake
@@ -0,0 +1,295 @@
+/* @file
+Benchmarks a corpus of representative optimization programs against every
+available solver that accepts them. The programs are modeled after Drake
+workloads (trajectory optimization, graphs of convex sets, inverse kinematics,
+and SDP / SOS relaxations) and are regenerated deterministically from code, so
+that the same program is measured by every run and on every machine.
+
+For each program <case>, the following benchmarks are registered:
+- Construct/<case> times the construction of the MathematicalProgram.
+- Solve/<case>/<solver> times SolverInterface::Solve() for each solver that is
+  available, enabled, and whose capabilities cover the program.
+
+The Solve benchmarks report the counters
+- solver_ms, the time reported by the solver itself in its solver details, for
+  those solvers that report it (Clarabel, Gurobi, Mosek, OSQP and SCS), and
+- wrapper_ms, the remaining time spent in Drake's solver wrapper, i.e., mostly
+  the conversion of the program into the solver's own data structures and the
+  conversion of the solution back into a MathematicalProgramResult.
+Both are per-iteration averages in milliseconds. For solvers that do not report
+their own time, only the overall time is available.
+*/
+
+#include <cmath>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "drake/common/never_destroyed.h"
+#include "drake/common/symbolic/expression.h"
+#include "drake/common/timer.h"
+#include "drake/solvers/choose_best_solver.h"
+#include "drake/solvers/clarabel_solver.h"
+#include "drake/solvers/gurobi_solver.h"
+#include "drake/solvers/mathematical_program.h"
+#include "drake/solvers/mosek_solver.h"
+#include "drake/solvers/osqp_solver.h"
+#include "drake/solvers/scs_solver.h"
+#include "drake/tools/performance/fixture_common.h"
+
+namespace drake {
+namespace solvers {
+namespace {
+
+using Eigen::MatrixXd;
+using Eigen::VectorXd;
+using symbolic::Expression;
+
+// Direct transcription of a discretized double integrator in 3D, driven from
+// rest at the origin to rest at a goal while minimizing the control effort,
+// with bounds on the states and inputs. This is a QP.
+std::unique_ptr<MathematicalProgram> MakeTrajectoryQp() {
+  const int kNumKnots = 100;
+  const int kNumStates = 6;
+  const int kNumInputs = 3;
+  const double h = 0.05;
+  MatrixXd A = MatrixXd::Identity(kNumStates, kNumStates);
+  A.topRightCorner(3, 3) = h * MatrixXd::Identity(3, 3);
+  MatrixXd B = MatrixXd::Zero(kNumStates, kNumInputs);
+  B.topRows(3) = 0.5 * h * h * MatrixXd::Identity(3, 3);
+  B.bottomRows(3) = h * MatrixXd::Identity(3, 3);
+
+  auto prog = std::make_unique<MathematicalProgram>();
+  const auto x = prog->NewContinuousVariables(kNumStates, kNumKnots, "x");
+  const auto u = prog->NewContinuousVariables(kNumInputs, kNumKnots - 1, "u");
+  // [A, B, -I] [x[k]; u[k]; x[k+1]] = 0.
+  MatrixXd Aeq(kNumStates, 2 * kNumStates + kNumInputs);
+  Aeq << A, B, -MatrixXd::Identity(kNumStates, kNumStates);
+  for (int k = 0; k < kNumKnots - 1; ++k) {
+    prog->AddLinearEqualityConstraint(Aeq, VectorXd::Zero(kNumStates),
+                                      {x.col(k), u.col(k), x.col(k + 1)});
+    prog->AddBoundingBoxConstraint(-10, 10, u.col(k));
+    prog->AddQuadraticCost(MatrixXd::Identity(kNumInputs, kNumInputs),
+                           VectorXd::Zero(kNumInputs), u.col(k));
+  }
+  prog->AddBoundingBoxConstraint(-5, 5, x);
+  VectorXd goal = VectorXd::Zero(kNumStates);
+  goal.head(3) << 1.0, -2.0, 0.5;
+  prog->AddBoundingBoxConstraint(VectorXd::Zero(kNumStates),
+                                 VectorXd::Zero(kNumStates), x.col(0));
+  prog->AddBoundingBoxConstraint(goal, goal, x.col(kNumKnots - 1));
+  return prog;
+}
+
+// The convex relaxation of a shortest path through a sequence of overlapping
+// boxes in 3D, as solved on each edge of a graph of convex sets: each point
+// lies in its box, and the sum of the Euclidean distances between consecutive
+// points is minimized through Lorentz cone constraints. This is an SOCP.
+std::unique_ptr<MathematicalProgram> MakeGcsSocp() {
+  const int kNumBoxes = 50;
+  const int kDim = 3;
+  auto prog = std::make_unique<MathematicalProgram>();
+  const auto x = prog->NewContinuousVariables(kDim, kNumBoxes + 1, "x");
+  const auto t = prog->NewContinuousVariables(kNumBoxes, "t");
+  for (int i = 0; i < kNumBoxes; ++i) {
+    // Box i spans [i, i + 1.5] along the first axis and oscillates in the
+    // others, so that the next box overlaps it.
+    VectorXd center(kDim);
+    center << i + 0.75, std::sin(0.3 * i), std::cos(0.2 * i);
+    const VectorXd half_size = VectorXd::Constant(kDim, 0.75);
+    prog->AddBoundingBoxConstraint(center - half_size, center + half_size,
+                                   x.col(i + 1));
+    // t(i) >= |x[i + 1] - x[i]|.
+    VectorX<Expression> cone(kDim + 1);
+    cone << t(i), x.col(i + 1) - x.col(i);
+    prog->AddLorentzConeConstraint(cone);
+  }
+  prog->AddBoundingBoxConstraint(VectorXd::Zero(kDim), VectorXd::Zero(kDim),
+                                 x.col(0));
+  prog->AddLinearCost(VectorXd::Ones(kNumBoxes), t);
+  return prog;
+}
+
+// Inverse kinematics of a planar serial arm, whose end effector must reach a
+// target position while the joint angles stay close to a nominal posture.
+// The forward kinematics are written as symbolic expressions, so that the
+// position constraints are nonlinear.
+std::unique_ptr<MathematicalProgram> MakeIkNlp() {
+  const int kNumJoints = 7;
+  const double kLinkLength = 0.3;
+  auto prog = std::make_unique<MathematicalProgram>();
+  const auto q = prog->NewContinuousVariables(kNumJoints, "q");
+  Expression angle = 0;
+  Expression px = 0;
+  Expression py = 0;
+  for (int i = 0; i < kNumJoints; ++i) {
+    angle += q(i);
+    px += kLinkLength * cos(angle);
+    py += kLinkLength * sin(angle);
+  }
+  prog->AddConstraint(px == 1.2);
+  prog->AddConstraint(py == 0.9);
+  prog->AddBoundingBoxConstraint(-M_PI_2, M_PI_2, q);
+  const VectorXd q_nominal = VectorXd::Constant(kNumJoints, 0.2);
+  prog->AddQuadraticErrorCost(MatrixXd::Identity(kNumJoints, kNumJoints),
+                              q_nominal, q);
+  prog->SetInitialGuess(q, q_nominal);
+  return prog;
+}
+
+// The semidefinite relaxation of MAXCUT on a circulant graph: maximize
+// ∑ᵢⱼ wᵢⱼ (1 - Xᵢⱼ) / 4 over X ⪰ 0 with diag(X) = 1. This is an SDP.
+std::unique_ptr<MathematicalProgram> MakeMaxCutSdp() {
+  const int kNumNodes = 30;
+  auto prog = std::make_unique<MathematicalProgram>();
+  const auto X = prog->NewSymmetricContinuousVariables(kNumNodes, "X");
+  prog->AddPositiveSemidefiniteConstraint(X);
+  prog->AddBoundingBoxConstraint(1, 1, X.diagonal());
+  Expression cut = 0;
+  for (int i = 0; i < kNumNodes; ++i) {
+    for (int offset : {1, 2, 5}) {
+      const int j = (i + offset) % kNumNodes;
+      const double w = 1.0 + 0.1 * ((i * offset) % 7);
+      cut += w * (1 - X(i, j)) / 4;
+    }
+  }
+  prog->AddLinearCost(-cut);
+  return prog;
+}
+
+// The largest lower bound γ of a quartic polynomial p(x) of three variables,
+// certified by p(x) - γ being a sum of squares.
+std::unique_ptr<MathematicalProgram> MakeSosSdp() {
+  auto prog = std::make_unique<MathematicalProgram>();
+  const auto x = prog->NewIndeterminates<3>("x");
+  const auto gamma = prog->NewContinuousVariables<1>("gamma");
+  const Expression p = pow(x(0), 4) + pow(x(1), 4) + pow(x(2), 4) -
+                       2 * x(0) * x(1) * x(2) + x(0) * x(0) - x(1) * x(2) +
+                       0.5 * x(0) - x(2) + 1;
+  prog->AddSosConstraint(p - gamma(0));
+  prog->AddLinearCost(-gamma(0));
+  return prog;
+}
+
+struct CorpusCase {
+  std::string name;
+  std::function<std::unique_ptr<MathematicalProgram>()> make;
+};
+
+const std::vector<CorpusCase>& GetCorpus() {
+  static const never_destroyed<std::vector<CorpusCase>> corpus(
+      std::vector<CorpusCase>{{"TrajectoryQp", &MakeTrajectoryQp},
+                              {"GcsSocp", &MakeGcsSocp},
+                              {"IkNlp", &MakeIkNlp},
+                              {"MaxCutSdp", &MakeMaxCutSdp},
+                              {"SosSdp", &MakeSosSdp}});
+  return corpus.access();
+}
+
+// Returns the time in seconds spent inside the solver according to its own
+// solver details, for those solvers that report it.
+std::optional<double> GetSolverReportedTime(
+    const MathematicalProgramResult& result) {
+  const SolverId& id = result.get_solver_id();
+  if (id == ClarabelSolver::id()) {
+    return result.get_solver_details<ClarabelSolver>().solve_time;
+  }
+  if (id == GurobiSolver::id()) {
+    return result.get_solver_details<GurobiSolver>().optimizer_time;
+  }
+  if (id == MosekSolver::id()) {
+    return result.get_solver_details<MosekSolver>().optimizer_time;
+  }
+  if (id == OsqpSolver::id()) {
+    return result.get_solver_details<OsqpSolver>().run_time;
+  }
+  if (id == ScsSolver::id()) {
+    const auto& details = result.get_solver_details<ScsSolver>();
+    return (details.scs_setup_time + details.scs_solve_time) / 1000;
+  }
+  return std::nullopt;
+}
+
+void BenchmarkConstruct(benchmark::State& state,  // NOLINT
+                        const CorpusCase& corpus_case) {
+  std::unique_ptr<MathematicalProgram> prog;
+  for (auto _ : state) {
+    prog = corpus_case.make();
+  }
+  state.counters["num_vars"] = prog->num_vars();
+  state.counters["num_constraints"] = prog->GetAllConstraints().size();
+}
+
+void BenchmarkSolve(benchmark::State& state,  // NOLINT
+                    const CorpusCase& corpus_case, const SolverId& solver_id) {
+  const std::unique_ptr<MathematicalProgram> prog = corpus_case.make();
+  const std::unique_ptr<SolverInterface> solver = MakeSolver(solver_id);
+  MathematicalProgramResult result;
+  SteadyTimer timer;
+  double total_time = 0;
+  double solver_time = 0;
+  bool solver_reports_time = true;
+  for (auto _ : state) {
+    timer.Start();
+    solver->Solve(*prog, std::nullopt, std::nullopt, &result);
+    total_time += timer.Tick();
+    const std::optional<double> reported = GetSolverReportedTime(result);
+    solver_reports_time = solver_reports_time && reported.has_value();
+    solver_time += reported.value_or(0);
+  }
+  if (!result.is_success()) {
+    const std::string message =
+        fmt::format("{} failed with {}", solver_id.name(),
+                    to_string(result.get_solution_result()));
+    state.SkipWithError(message.c_str());
+    return;
+  }
+  if (solver_reports_time) {
+    state.counters["solver_ms"] = benchmark::Counter(
+        1000 * solver_time, benchmark::Counter::kAvgIterations);
+    state.counters["wrapper_ms"] =
+        benchmark::Counter(1000 * (total_time - solver_time),
+                           benchmark::Counter::kAvgIterations);
+  }
+}
+
+// Registers the benchmarks of each case of the corpus. The solvers are those
+// that can solve the case in this build and on this machine, so that the set
+// of Solve benchmarks depends on which solvers are available and enabled.
+bool RegisterCorpusBenchmarks() {
+  for (const CorpusCase& corpus_case : GetCorpus()) {
+    benchmark::RegisterBenchmark(
+        fmt::format("Construct/{}", corpus_case.name).c_str(),
+        [&corpus_case](benchmark::State& state) {
+          BenchmarkConstruct(state, corpus_case);
+        })
+        ->Unit(benchmark::kMillisecond);
+    const std::unique_ptr<MathematicalProgram> prog = corpus_case.make();
+    for (const SolverId& solver_id : GetKnownSolvers()) {
+      const std::unique_ptr<SolverInterface> solver = MakeSolver(solver_id);
+      if (!solver->available() || !solver->enabled() ||
+          !solver->AreProgramAttributesSatisfied(*prog)) {
+        continue;
+      }
+      benchmark::RegisterBenchmark(
+          fmt::format("Solve/{}/{}", corpus_case.name, solver_id.name())
+              .c_str(),
+          [&corpus_case, solver_id](benchmark::State& state) {
+            BenchmarkSolve(state, corpus_case, solver_id);
+          })
+          ->Unit(benchmark::kMillisecond);
+    }
+  }
+  return true;
+}
+
+[[maybe_unused]] const bool kCorpusBenchmarksRegistered =
+    RegisterCorpusBenchmarks();
+
+}  // namespace
+}  // namespace solvers
+}  // namespace drake
@@ -6,6 +6,7 @@
 #include <sstream>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "drake/common/drake_copyable.h"
 #include "drake/common/fmt_ostream.h"
@@ -15,6 +16,16 @@
 
 namespace drake {
 namespace solvers {
+
+class MathematicalProgram;
+template <typename C>
+class Binding;
+
+namespace internal {
+template <typename To, typename From>
+Binding<To> BindingDynamicCast(const Binding<From>& binding);
+}  // namespace internal
+
 /**
  * A binding on constraint type C is a mapping of the decision
  * variables onto the inputs of C.  This allows the constraint to operate
@@ -48,7 +59,10 @@ class Binding {
           typename std::enable_if_t<
               std::is_convertible_v<std::shared_ptr<U>, std::shared_ptr<C>>>* =
               nullptr)
-      : Binding(b.evaluator(), b.variables()) {}
+      : Binding(b.evaluator(), b.variables()) {
+    variable_indices_ = b.variable_indices_;
+    variable_indices_program_id_ = b.variable_indices_program_id_;
+  }
 
   [[nodiscard]] const std::shared_ptr<C>& evaluator() const {
     return evaluator_;
@@ -135,8 +149,21 @@ class Binding {
   }
 
  private:
+  template <typename>
+  friend class Binding;
+  friend class MathematicalProgram;
+  template <typename To, typename From>
+  friend Binding<To> internal::BindingDynamicCast(const Binding<From>&);
+
   std::shared_ptr<C> evaluator_;
   VectorXDecisionVariable vars_;
+  // The indices of vars_ among the decision variables of the program whose
+  // MathematicalProgram::program_id_ is variable_indices_program_id_, cached
+  // by that program when this binding is added to it. Copies of the binding
+  // share the (immutable) indices. The cache is not part of the binding's
+  // value, i.e., it is ignored by operator== and hash_append.
+  std::shared_ptr<const std::vector<int>> variable_indices_;
+  int64_t variable_indices_program_id_{0};
 };
 
 /**
@@ -165,7 +192,10 @@ template <typename To, typename From>
 [[nodiscard]] Binding<To> BindingDynamicCast(const Binding<From>& binding) {
   auto constraint = std::dynamic_pointer_cast<To>(binding.evaluator());
   DRAKE_DEMAND(constraint != nullptr);
-  return Binding<To>(constraint, binding.variables());
+  Binding<To> result(constraint, binding.variables());
+  result.variable_indices_ = binding.variable_indices_;
+  result.variable_indices_program_id_ = binding.variable_indices_program_id_;
+  return result;
 }
 
 }  // namespace internal
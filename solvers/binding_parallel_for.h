@@ -0,0 +1,53 @@
+#pragma once
+
+#include <functional>
+#include <vector>
+
+#include "drake/common/parallel_for.h"
+#include "drake/common/parallelism.h"
+#include "drake/common/ssize.h"
+#include "drake/solvers/binding.h"
+
+namespace drake {
+namespace solvers {
+namespace internal {
+
+/* Calls `func(i)` for every i in [0, bindings.size()). The bindings whose
+evaluator is_thread_safe() are spread across up to `parallelism.num_threads()`
+threads (see drake::internal::ParallelFor), after which the remaining bindings
+are done in order on the calling thread. With no parallelism, every binding is
+done in order on the calling thread.
+
+`func` must be safe to call concurrently for distinct thread-safe bindings,
+e.g., by writing the result of each binding to its own slice of the output. */
+template <typename C>
+void BindingParallelFor(Parallelism parallelism,
+                        const std::vector<Binding<C>>& bindings,
+                        const std::function<void(int)>& func) {
+  if (parallelism.num_threads() == 1) {
+    for (int i = 0; i < ssize(bindings); ++i) {
+      func(i);
+    }
+    return;
+  }
+  std::vector<int> thread_safe_bindings;
+  std::vector<int> other_bindings;
+  for (int i = 0; i < ssize(bindings); ++i) {
+    if (bindings[i].evaluator()->is_thread_safe()) {
+      thread_safe_bindings.push_back(i);
+    } else {
+      other_bindings.push_back(i);
+    }
+  }
+  drake::internal::ParallelFor(parallelism, ssize(thread_safe_bindings),
+                               [&](int k) {
+                                 func(thread_safe_bindings[k]);
+                               });
+  for (const int i : other_bindings) {
+    func(i);
+  }
+}
+
+}  // namespace internal
+}  // namespace solvers
+}  // namespace drake
@@ -6,10 +6,12 @@
 
 #include <fmt/format.h>
 
+#include "drake/common/parallel_for.h"
 #include "drake/common/unused.h"
 #include "drake/solvers/choose_best_solver.h"
 #include "drake/solvers/gurobi_solver.h"
 #include "drake/solvers/scs_solver.h"
+#include "drake/solvers/solve.h"
 
 namespace drake {
 namespace solvers {
@@ -315,6 +317,14 @@ void MixedIntegerBranchAndBoundNode::Branch(
   right_child_->FixBinaryVariable(binary_variable, 1);
   left_child_->parent_ = this;
   right_child_->parent_ = this;
+  // The children start from the solution of this node, for the solvers that
+  // can use it as a warm start.
+  if (solution_result_ == SolutionResult::kSolutionFound) {
+    const Eigen::VectorXd x_sol =
+        prog_result_->GetSolution(prog_->decision_variables());
+    left_child_->prog_->SetInitialGuessForAllVariables(x_sol);
+    right_child_->prog_->SetInitialGuessForAllVariables(x_sol);
+  }
   left_child_->solution_result_ =
       SolveProgramWithSolver(*left_child_->prog_, left_child_->solver_id_,
                              left_child_->prog_result_.get());
@@ -376,28 +386,42 @@ SolutionResult MixedIntegerBranchAndBound::Solve() {
       !root_->optimal_solution_is_integral()) {
     SearchIntegralSolutionByRounding(*root_);
   }
-  MixedIntegerBranchAndBoundNode* branching_node = PickBranchingNode();
-  while (branching_node) {
+  // The number of nodes branched in each round.
+  const int max_num_branching_nodes =
+      internal::IsThreadSafe(root_->solver_id())
+          ? std::max(options_.parallelism.num_threads(), 1)
+          : 1;
+  std::vector<MixedIntegerBranchAndBoundNode*> branching_nodes =
+      PickBranchingNodes(max_num_branching_nodes);
+  while (!branching_nodes.empty()) {
     // Each branch will create two new nodes. So if the current number of nodes
     // + 2 is larger than options_.max_explored_nodes, we don't branch
     // any more.
-    if (options_.max_explored_nodes >= 1 &&
-        root_->NumExploredNodesInSubtree() + 2 > options_.max_explored_nodes) {
-      return SolutionResult::kIterationLimit;
-    } else {
-      // Found a branching node, branch on this node. If no branching node is
-      // found, then every leaf node is fathomed, the branch-and-bound process
-      // should terminate.
-      // TODO(hongkai.dai) We might need to have a function that picks the
-      // branching node together with the branching variable simultaneously.
-      const symbolic::Variable* branching_variable =
-          PickBranchingVariable(*branching_node);
-      BranchAndUpdate(branching_node, *branching_variable);
-      if (HasConverged()) {
-        return SolutionResult::kSolutionFound;
+    if (options_.max_explored_nodes >= 1) {
+      const int num_allowed_branches =
+          (options_.max_explored_nodes - root_->NumExploredNodesInSubtree()) /
+          2;
+      if (num_allowed_branches < 1) {
+        return SolutionResult::kIterationLimit;
+      }
+      if (num_allowed_branches < static_cast<int>(branching_nodes.size())) {
+        branching_nodes.resize(num_allowed_branches);
       }
-      branching_node = PickBranchingNode();
     }
+    // Found branching nodes, branch on these nodes. If no branching node is
+    // found, then every leaf node is fathomed, the branch-and-bound process
+    // should terminate.
+    // TODO(hongkai.dai) We might need to have a function that picks the
+    // branching node together with the branching variable simultaneously.
+    std::vector<const symbolic::Variable*> branching_variables;
+    for (const MixedIntegerBranchAndBoundNode* node : branching_nodes) {
+      branching_variables.push_back(PickBranchingVariable(*node));
+    }
+    BranchAndUpdateInParallel(branching_nodes, branching_variables);
+    if (HasConverged()) {
+      return SolutionResult::kSolutionFound;
+    }
+    branching_nodes = PickBranchingNodes(max_num_branching_nodes);
   }
   // No node to branch.
   if (best_lower_bound_ == -std::numeric_limits<double>::infinity()) {
@@ -559,6 +583,25 @@ MixedIntegerBranchAndBoundNode* PickDepthFirstNodeInSubTree(
   }
 }
 
+// Appends the non-fathomed leaf nodes in the tree to `leaves`, from left to
+// right.
+void CollectNonFathomedLeafNodesInSubTree(
+    const MixedIntegerBranchAndBound& bnb,
+    const MixedIntegerBranchAndBoundNode& sub_tree_root,
+    std::vector<MixedIntegerBranchAndBoundNode*>* leaves) {
+  if (sub_tree_root.IsLeaf()) {
+    if (!bnb.IsLeafNodeFathomed(sub_tree_root)) {
+      leaves->push_back(
+          const_cast<MixedIntegerBranchAndBoundNode*>(&sub_tree_root));
+    }
+  } else {
+    CollectNonFathomedLeafNodesInSubTree(bnb, *(sub_tree_root.left_child()),
+                                         leaves);
+    CollectNonFathomedLeafNodesInSubTree(bnb, *(sub_tree_root.right_child()),
+                                         leaves);
+  }
+}
+
 double BestLowerBoundInSubTree(
     const MixedIntegerBranchAndBound& bnb,
     const MixedIntegerBranchAndBoundNode& sub_tree_root) {
@@ -636,6 +679,44 @@ MixedIntegerBranchAndBoundNode* MixedIntegerBranchAndBound::PickDepthFirstNode()
   return PickDepthFirstNodeInSubTree(*this, *root_);
 }
 
+std::vector<MixedIntegerBranchAndBoundNode*>
+MixedIntegerBranchAndBound::PickBranchingNodes(int max_num_nodes) const {
+  std::vector<MixedIntegerBranchAndBoundNode*> nodes;
+  MixedIntegerBranchAndBoundNode* first_node = PickBranchingNode();
+  if (first_node == nullptr) {
+    return nodes;
+  }
+  nodes.push_back(first_node);
+  if (max_num_nodes <= 1 ||
+      node_selection_method_ == NodeSelectionMethod::kUserDefined) {
+    return nodes;
+  }
+  std::vector<MixedIntegerBranchAndBoundNode*> leaves;
+  CollectNonFathomedLeafNodesInSubTree(*this, *root_, &leaves);
+  leaves.erase(std::remove(leaves.begin(), leaves.end(), first_node),
+               leaves.end());
+  if (node_selection_method_ == NodeSelectionMethod::kMinLowerBound) {
+    std::stable_sort(leaves.begin(), leaves.end(),
+                     [](const MixedIntegerBranchAndBoundNode* a,
+                        const MixedIntegerBranchAndBoundNode* b) {
+                       return a->prog_result()->get_optimal_cost() <
+                              b->prog_result()->get_optimal_cost();
+                     });
+  } else {
+    DRAKE_DEMAND(node_selection_method_ == NodeSelectionMethod::kDepthFirst);
+    std::stable_sort(leaves.begin(), leaves.end(),
+                     [](const MixedIntegerBranchAndBoundNode* a,
+                        const MixedIntegerBranchAndBoundNode* b) {
+                       return a->remaining_binary_variables().size() <
+                              b->remaining_binary_variables().size();
+                     });
+  }
+  const int num_other_nodes =
+      std::min(max_num_nodes - 1, static_cast<int>(leaves.size()));
+  nodes.insert(nodes.end(), leaves.begin(), leaves.begin() + num_other_nodes);
+  return nodes;
+}
+
 const symbolic::Variable* MixedIntegerBranchAndBound::PickBranchingVariable(
     const MixedIntegerBranchAndBoundNode& node) const {
   switch (variable_selection_method_) {
@@ -680,6 +761,24 @@ void MixedIntegerBranchAndBound::BranchAndUpdate(
     MixedIntegerBranchAndBoundNode* node,
     const symbolic::Variable& branching_variable) {
   node->Branch(branching_variable);
+  UpdateAfterBranch({node});
+}
+
+void MixedIntegerBranchAndBound::BranchAndUpdateInParallel(
+    const std::vector<MixedIntegerBranchAndBoundNode*>& nodes,
+    const std::vector<const symbolic::Variable*>& branching_variables) {
+  DRAKE_DEMAND(nodes.size() == branching_variables.size());
+  const int num_nodes = nodes.size();
+  // Each node owns the programs of its children, so the nodes can be branched
+  // concurrently.
+  drake::internal::ParallelFor(Parallelism(num_nodes), num_nodes, [&](int i) {
+    nodes[i]->Branch(*branching_variables[i]);
+  });
+  UpdateAfterBranch(nodes);
+}
+
+void MixedIntegerBranchAndBound::UpdateAfterBranch(
+    const std::vector<MixedIntegerBranchAndBoundNode*>& branched_nodes) {
   // Update the best lower and upper bounds.
   // The best lower bound is the minimal among all the optimal costs of the
   // non-fathomed leaf nodes.
@@ -687,19 +786,21 @@ void MixedIntegerBranchAndBound::BranchAndUpdate(
   // If either the left or the right children finds integral solution, then
   // we can potentially update the best upper bound, and insert the solutions
   // to the list solutions_;
-  for (auto& child : {node->left_child(), node->right_child()}) {
-    if (child->solution_result() == SolutionResult::kSolutionFound &&
-        child->optimal_solution_is_integral()) {
-      const double child_node_optimal_cost =
-          child->prog_result()->get_optimal_cost();
-      const Eigen::VectorXd x_sol = child->prog_result()->GetSolution(
-          child->prog()->decision_variables());
-      UpdateIntegralSolution(x_sol, child_node_optimal_cost);
-    }
-    if (search_integral_solution_by_rounding_) {
-      SearchIntegralSolutionByRounding(*child);
+  for (const MixedIntegerBranchAndBoundNode* node : branched_nodes) {
+    for (auto& child : {node->left_child(), node->right_child()}) {
+      if (child->solution_result() == SolutionResult::kSolutionFound &&
+          child->optimal_solution_is_integral()) {
+        const double child_node_optimal_cost =
+            child->prog_result()->get_optimal_cost();
+        const Eigen::VectorXd x_sol = child->prog_result()->GetSolution(
+            child->prog()->decision_variables());
+        UpdateIntegralSolution(x_sol, child_node_optimal_cost);
+      }
+      if (search_integral_solution_by_rounding_) {
+        SearchIntegralSolutionByRounding(*child);
+      }
+      NodeCallback(*child);
     }
-    NodeCallback(*child);
   }
 }
 
@@ -5,8 +5,10 @@
 #include <memory>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "drake/common/name_value.h"
+#include "drake/common/parallelism.h"
 #include "drake/solvers/mathematical_program.h"
 #include "drake/solvers/mathematical_program_result.h"
 
@@ -285,7 +287,8 @@ class MixedIntegerBranchAndBound {
     Options() {}
 
     /** Passes this object to an Archive.
-    Refer to @ref yaml_serialization "YAML Serialization" for background. */
+    Refer to @ref yaml_serialization "YAML Serialization" for background.
+    Note: This only serializes options that are YAML built-in types. */
     template <typename Archive>
     void Serialize(Archive* a) {
       a->Visit(DRAKE_NVP(max_explored_nodes));
@@ -296,6 +299,15 @@ class MixedIntegerBranchAndBound {
      * max_explored_nodes <= 0 means that we don't put an upper bound on the
      * number of explored nodes. */
     int max_explored_nodes{-1};
+
+    /** The maximal number of nodes branched concurrently. In each round of
+     * Solve(), up to this many un-fathomed leaf nodes are picked (in the
+     * order of the node selection method), and the programs of their child
+     * nodes are solved on separate threads; the bounds, the solutions and the
+     * node callbacks are then updated serially before the next round. A user
+     * defined node selection function picks only one node per round. If the
+     * solver is not thread-safe, the nodes are branched one at a time. */
+    Parallelism parallelism{Parallelism::None()};
   };
 
   /**
@@ -608,6 +620,15 @@ class MixedIntegerBranchAndBound {
    */
   [[nodiscard]] MixedIntegerBranchAndBoundNode* PickDepthFirstNode() const;
 
+  /**
+   * Pick up to `max_num_nodes` nodes to branch. The first one is the node
+   * returned by PickBranchingNode(), and the others are the next un-fathomed
+   * leaf nodes in the order of the node selection method. Returns an empty
+   * vector if no node can be branched.
+   */
+  [[nodiscard]] std::vector<MixedIntegerBranchAndBoundNode*> PickBranchingNodes(
+      int max_num_nodes) const;
+
   /**
    * Pick the branching variable in a node.
    */
@@ -623,6 +644,25 @@ class MixedIntegerBranchAndBound {
   void BranchAndUpdate(MixedIntegerBranchAndBoundNode* node,
                        const symbolic::Variable& branching_variable);
 
+  /**
+   * Branch on each of the nodes concurrently (solving the optimizations in the
+   * child nodes on separate threads), and then update the best lower and upper
+   * bounds.
+   * @param nodes. The nodes to be branched.
+   * @param branching_variables. Branch on branching_variables[i] in nodes[i].
+   */
+  void BranchAndUpdateInParallel(
+      const std::vector<MixedIntegerBranchAndBoundNode*>& nodes,
+      const std::vector<const symbolic::Variable*>& branching_variables);
+
+  /**
+   * Update the best lower and upper bounds, and call the node callback, after
+   * the nodes have been branched.
+   * @param branched_nodes. The nodes that were just branched.
+   */
+  void UpdateAfterBranch(
+      const std::vector<MixedIntegerBranchAndBoundNode*>& branched_nodes);
+
   /**
    * Update the solutions (solutions_) and the best upper bound, with an
    * integral solution and its cost.
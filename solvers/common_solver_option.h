@@ -27,6 +27,15 @@ enum class CommonSolverOption {
    * console.
    */
   kPrintToConsole,
+  /** Some solvers can evaluate the costs and constraints of a program
+   * concurrently, using up to this many threads (including the calling
+   * thread). The user can call SolverOptions::SetOption(kMaxThreads, n) where
+   * n is a positive int. Only the evaluators that report
+   * EvaluatorBase::is_thread_safe() are evaluated concurrently; the others are
+   * always evaluated on the calling thread. If the option is not set, the
+   * evaluation is serial.
+   */
+  kMaxThreads,
 };
 
 std::ostream& operator<<(std::ostream& os,
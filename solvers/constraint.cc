@@ -232,6 +232,7 @@ LorentzConeConstraint::LorentzConeConstraint(
       eval_type_{eval_type} {
   DRAKE_DEMAND(A_.rows() >= 2);
   DRAKE_ASSERT(A_.rows() == b_.rows());
+  set_is_thread_safe(true);
 }
 
 void LorentzConeConstraint::UpdateCoefficients(
@@ -399,6 +400,7 @@ LinearConstraint::LinearConstraint(const Eigen::Ref<const Eigen::MatrixXd>& A,
     : Constraint(A.rows(), A.cols(), lb, ub), A_(A) {
   DRAKE_DEMAND(A.rows() == lb.rows());
   DRAKE_DEMAND(A.array().isFinite().all());
+  set_is_thread_safe(true);
 }
 
 LinearConstraint::LinearConstraint(const Eigen::SparseMatrix<double>& A,
@@ -407,6 +409,7 @@ LinearConstraint::LinearConstraint(const Eigen::SparseMatrix<double>& A,
     : Constraint(A.rows(), A.cols(), lb, ub), A_(A) {
   DRAKE_DEMAND(A.rows() == lb.rows());
   DRAKE_DEMAND(A_.IsFinite());
+  set_is_thread_safe(true);
 }
 
 const Eigen::MatrixXd& LinearConstraint::GetDenseA() const {
@@ -495,6 +498,13 @@ void LinearConstraint::DoEval(
   DoEvalGeneric(x, y);
 }
 
+void LinearConstraint::DoEvalWithSparseGradient(
+    const Eigen::Ref<const Eigen::VectorXd>& x, Eigen::VectorXd* y,
+    Eigen::SparseMatrix<double>* dydx) const {
+  DoEvalGeneric(x, y);
+  *dydx = A_.get_as_sparse();
+}
+
 std::ostream& LinearConstraint::DoDisplay(
     std::ostream& os, const VectorX<symbolic::Variable>& vars) const {
   return DisplayConstraint(*this, os, "LinearConstraint", vars, false);
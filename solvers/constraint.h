@@ -235,6 +235,7 @@ class QuadraticConstraint : public Constraint {
     UpdateHessianType(hessian_type);
     DRAKE_ASSERT(Q_.rows() == Q_.cols());
     DRAKE_ASSERT(Q_.cols() == b_.rows());
+    set_is_thread_safe(true);
   }
 
   ~QuadraticConstraint() override {}
@@ -446,6 +447,7 @@ class RotatedLorentzConeConstraint : public Constraint {
         b_(b) {
     DRAKE_DEMAND(A_.rows() >= 3);
     DRAKE_ASSERT(A_.rows() == b_.rows());
+    set_is_thread_safe(true);
   }
 
   /** Getter for A. */
@@ -683,6 +685,11 @@ class LinearConstraint : public Constraint {
   void DoEval(const Eigen::Ref<const VectorX<symbolic::Variable>>& x,
               VectorX<symbolic::Expression>* y) const override;
 
+  // The gradient is A.
+  void DoEvalWithSparseGradient(
+      const Eigen::Ref<const Eigen::VectorXd>& x, Eigen::VectorXd* y,
+      Eigen::SparseMatrix<double>* dydx) const override;
+
   std::ostream& DoDisplay(std::ostream&,
                           const VectorX<symbolic::Variable>&) const override;
 
@@ -840,7 +847,9 @@ class LinearComplementarityConstraint : public Constraint {
   template <typename DerivedM, typename Derivedq>
   LinearComplementarityConstraint(const Eigen::MatrixBase<DerivedM>& M,
                                   const Eigen::MatrixBase<Derivedq>& q)
-      : Constraint(q.rows(), M.cols()), M_(M), q_(q) {}
+      : Constraint(q.rows(), M.cols()), M_(M), q_(q) {
+    set_is_thread_safe(true);
+  }
 
   ~LinearComplementarityConstraint() override {}
 
@@ -201,6 +201,7 @@ L2NormCost::L2NormCost(const Eigen::Ref<const Eigen::MatrixXd>& A,
                        const Eigen::Ref<const Eigen::VectorXd>& b)
     : Cost(A.cols()), A_(A), b_(b) {
   DRAKE_DEMAND(A_.rows() == b_.rows());
+  set_is_thread_safe(true);
 }
 
 void L2NormCost::UpdateCoefficients(
@@ -51,7 +51,9 @@ class LinearCost : public Cost {
    */
   // NOLINTNEXTLINE(runtime/explicit) This conversion is desirable.
   LinearCost(const Eigen::Ref<const Eigen::VectorXd>& a, double b = 0.)
-      : Cost(a.rows()), a_(a), b_(b) {}
+      : Cost(a.rows()), a_(a), b_(b) {
+    set_is_thread_safe(true);
+  }
 
   ~LinearCost() override {}
 
@@ -137,6 +139,7 @@ class QuadraticCost : public Cost {
     } else {
       is_convex_ = CheckHessianPsd();
     }
+    set_is_thread_safe(true);
   }
 
   ~QuadraticCost() override {}
@@ -52,6 +52,40 @@ std::ostream& EvaluatorBase::DoDisplay(
   return os;
 }
 
+void EvaluatorBase::DoEvalWithSparseGradient(
+    const Eigen::Ref<const Eigen::VectorXd>& x, Eigen::VectorXd* y,
+    Eigen::SparseMatrix<double>* dydx) const {
+  AutoDiffVecXd y_autodiff;
+  DoEval(math::InitializeAutoDiff(x), &y_autodiff);
+  *y = math::ExtractValue(y_autodiff);
+  // Outputs which don't depend on x have empty derivatives.
+  auto derivative = [&y_autodiff](int i, int j) {
+    return y_autodiff(i).derivatives().size() > 0
+               ? y_autodiff(i).derivatives()(j)
+               : 0.0;
+  };
+  std::vector<Eigen::Triplet<double>> triplets;
+  if (gradient_sparsity_pattern_.has_value()) {
+    triplets.reserve(gradient_sparsity_pattern_->size());
+    for (const auto& [i, j] : gradient_sparsity_pattern_.value()) {
+      triplets.emplace_back(i, j, derivative(i, j));
+    }
+  } else {
+    for (int i = 0; i < y_autodiff.rows(); ++i) {
+      if (y_autodiff(i).derivatives().size() == 0) {
+        continue;
+      }
+      for (int j = 0; j < x.rows(); ++j) {
+        if (derivative(i, j) != 0) {
+          triplets.emplace_back(i, j, derivative(i, j));
+        }
+      }
+    }
+  }
+  dydx->resize(y->rows(), x.rows());
+  dydx->setFromTriplets(triplets.begin(), triplets.end());
+}
+
 std::string EvaluatorBase::ToLatex(const VectorX<symbolic::Variable>& vars,
                                    int precision) const {
   const int num_vars = this->num_vars();
@@ -8,6 +8,7 @@
 #include <vector>
 
 #include <Eigen/Core>
+#include <Eigen/SparseCore>
 
 #include "drake/common/drake_assert.h"
 #include "drake/common/drake_copyable.h"
@@ -75,6 +76,26 @@ class EvaluatorBase {
     DRAKE_ASSERT(y->rows() == num_outputs_);
   }
 
+  /**
+   * Evaluates the expression and its gradient ∂y/∂x (the gradient of y w.r.t
+   * x) as a sparse matrix. For evaluators that compute their gradient in
+   * closed form (such as LinearConstraint) this is much cheaper than calling
+   * Eval() with AutoDiffXd, whose derivatives are dense.
+   * @param[in] x A `num_vars` x 1 input vector.
+   * @param[out] y A `num_outputs` x 1 output vector.
+   * @param[out] dydx A `num_outputs` x `num_vars` matrix. When
+   * gradient_sparsity_pattern() is set, all of its non-zero entries are in
+   * the pattern.
+   */
+  void EvalWithSparseGradient(const Eigen::Ref<const Eigen::VectorXd>& x,
+                              Eigen::VectorXd* y,
+                              Eigen::SparseMatrix<double>* dydx) const {
+    DRAKE_ASSERT(x.rows() == num_vars_ || num_vars_ == Eigen::Dynamic);
+    DoEvalWithSparseGradient(x, y, dydx);
+    DRAKE_ASSERT(y->rows() == num_outputs_);
+    DRAKE_ASSERT(dydx->rows() == num_outputs_ && dydx->cols() == x.rows());
+  }
+
   /**
    * Set a human-friendly description for the evaluator.
    */
@@ -143,6 +164,14 @@ class EvaluatorBase {
     return gradient_sparsity_pattern_;
   }
 
+  /**
+   * Returns whether it is safe to call Eval() (with any scalar type) and
+   * EvalWithSparseGradient() concurrently from multiple threads. This is false
+   * unless a subclass declares otherwise; solvers may evaluate thread-safe
+   * evaluators in parallel (see CommonSolverOption::kMaxThreads).
+   */
+  bool is_thread_safe() const { return is_thread_safe_; }
+
  protected:
   /**
    * Constructs a evaluator.
@@ -188,6 +217,23 @@ class EvaluatorBase {
   virtual void DoEval(const Eigen::Ref<const VectorX<symbolic::Variable>>& x,
                       VectorX<symbolic::Expression>* y) const = 0;
 
+  /**
+   * Implements EvalWithSparseGradient(). The default implementation evaluates
+   * the expression with AutoDiffXd, and keeps the entries of the gradient in
+   * gradient_sparsity_pattern() (or all of its non-zero entries, if no pattern
+   * was set). Subclasses whose gradient is cheap to compute directly should
+   * override this.
+   * @param[in] x Input vector.
+   * @param[out] y Output vector.
+   * @param[out] dydx The gradient ∂y/∂x.
+   * @pre x must be of size `num_vars` x 1.
+   * @post y will be of size `num_outputs` x 1, and dydx of size
+   * `num_outputs` x `num_vars`.
+   */
+  virtual void DoEvalWithSparseGradient(
+      const Eigen::Ref<const Eigen::VectorXd>& x, Eigen::VectorXd* y,
+      Eigen::SparseMatrix<double>* dydx) const;
+
   /**
    * NVI implementation of Display. The default implementation will report
    * the NiceTypeName, get_description, and list the bound variables.
@@ -207,10 +253,17 @@ class EvaluatorBase {
   // matrix in the linear constraint is resized.
   void set_num_outputs(int num_outputs) { num_outputs_ = num_outputs; }
 
+  // Setter for is_thread_safe(). Subclasses whose evaluation only reads
+  // immutable (or internally synchronized) data should set this to true.
+  void set_is_thread_safe(bool is_thread_safe) {
+    is_thread_safe_ = is_thread_safe;
+  }
+
  private:
   int num_vars_{};
   int num_outputs_{};
   std::string description_;
+  bool is_thread_safe_{false};
   // gradient_sparsity_pattern_ records the pair (row_index, col_index) that
   // contains the non-zero entries in the gradient of the Eval
   // function. Note that if the entry (row_index, col_index) *can* be non-zero
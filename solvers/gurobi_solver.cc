@@ -322,45 +322,58 @@ __attribute__((unused)) bool HasCorrectNumberOfVariables(
   return (num_vars == num_vars_expected);
 }
 
-// Adds a constraint of one of the following forms :
+// The rows of linear constraints waiting to be added to the Gurobi model,
+// stored in the Compressed Sparse Row (CSR) format of GRBaddconstrs(). Please
+// refer to https://www.gurobi.com/documentation/10.0/refman/c_addconstrs.html
+// for the meaning of these vectors. The non-zero entries in the i'th row are
+// stored in the chunk cind[cbeg[i]:cbeg[i+1]] and cval[cbeg[i]:cbeg[i+1]].
+// Collecting the rows of all the linear constraints and adding them with a
+// single call is much cheaper than one call per binding.
+struct GurobiLinearConstraintRows {
+  int num_rows() const { return static_cast<int>(sense.size()); }
+
+  std::vector<int> cbeg{0};
+  std::vector<int> cind;
+  std::vector<double> cval;
+  std::vector<char> sense;
+  std::vector<double> rhs;
+};
+
+// Appends to `rows` the rows of a constraint of one of the following forms :
 // lb ≤ A*x ≤ ub
 // or
 // A*x == lb
 //
 // @param is_equality True if the imposed constraint is
 // A*x == lb, false otherwise.
-// @param[in, out] num_gurobi_linear_constraints The number of linear
-// constraints stored in the gurobi model.
-// @return error as an integer. The full set of error values are
-// described here :
-// https://www.gurobi.com/documentation/10.0/refman/error_codes.html
-// This function assumes `vars` doesn't contain duplicate variables.
-int AddLinearConstraintNoDuplication(
-    const MathematicalProgram& prog, GRBmodel* model,
+// @param var_index The indices of the variables x in the program, which must
+// not contain duplicates.
+void AppendLinearConstraintRowsNoDuplication(
     const Eigen::SparseMatrix<double>& A, const Eigen::VectorXd& lb,
-    const Eigen::VectorXd& ub, const VectorXDecisionVariable& vars,
-    bool is_equality, int* num_gurobi_linear_constraints) {
-  Eigen::SparseMatrix<double, Eigen::RowMajor> A_row_major = A;
+    const Eigen::VectorXd& ub, const std::vector<int>& var_index,
+    bool is_equality, GurobiLinearConstraintRows* rows) {
+  const Eigen::SparseMatrix<double, Eigen::RowMajor> A_row_major = A;
 
-  const std::vector<int> var_index = prog.FindDecisionVariableIndices(vars);
+  // Add A_row_major.row(i) * vars ≥ bound (or ≤ bound, or = bound) to rows.
+  auto add_gurobi_row = [&A_row_major, &var_index, rows](int i, double bound,
+                                                         char row_sense) {
+    for (int j = *(A_row_major.outerIndexPtr() + i);
+         j < *(A_row_major.outerIndexPtr() + i + 1); ++j) {
+      rows->cind.push_back(var_index[*(A_row_major.innerIndexPtr() + j)]);
+      rows->cval.push_back(*(A_row_major.valuePtr() + j));
+    }
+    rows->cbeg.push_back(rows->cind.size());
+    rows->rhs.push_back(bound);
+    rows->sense.push_back(row_sense);
+  };
 
   // If this linear constraint is an equality constraint, we know that we can
   // pass in A * vars = lb directly to Gurobi.
   if (is_equality) {
-    std::vector<int> nonzero_col_index;
-    nonzero_col_index.reserve(A_row_major.nonZeros());
-    std::vector<char> sense(A.rows(), GRB_EQUAL);
-    for (int i = 0; i < A.nonZeros(); ++i) {
-      nonzero_col_index.push_back(
-          var_index[*(A_row_major.innerIndexPtr() + i)]);
+    for (int i = 0; i < A_row_major.rows(); ++i) {
+      add_gurobi_row(i, lb(i), GRB_EQUAL);
     }
-    *num_gurobi_linear_constraints += A.rows();
-    int error =
-        GRBaddconstrs(model, A_row_major.rows(), A_row_major.nonZeros(),
-                      A_row_major.outerIndexPtr(), nonzero_col_index.data(),
-                      A_row_major.valuePtr(), sense.data(),
-                      const_cast<double*>(lb.data()), nullptr);
-    return error;
+    return;
   }
 
   // Now handle the inequality constraints.
@@ -376,48 +389,6 @@ int AddLinearConstraintNoDuplication(
   // A.row(i).dot(vars) <= ub(i) to Gurobi.
   // 4. If both lb(i) and ub(i) are finite, then we add two constraints
   // A.row(i).dot(vars) >= lb(i) and A.row(i).dot(vars) <= ub(i) to Gurobi.
-  // As a result, we add the constraint A_gurobi * vars <= rhs to Gurobi.
-
-  // Each row of A introduces at most two constraints in Gurobi, so we reserve 2
-  // * A.rows().
-  std::vector<double> rhs;
-  rhs.reserve(A.rows() * 2);
-  std::vector<char> sense;
-  sense.reserve(A.rows() * 2);
-
-  // The matrix A_gurobi is stored in Compressed Sparse Row (CSR) format, using
-  // three vectors cbeg, cind and cval. Please refer to
-  // https://www.gurobi.com/documentation/10.0/refman/c_addconstrs.html for the
-  // meaning of these three vectors. The non-zero entries in the i'th row of
-  // A_gurobi is stored in the chunk cind[cbeg[i]:cbeg[i+1]] and
-  // cval[cbeg[i]:cbeg[i+1]]
-  std::vector<int> cbeg;
-  cbeg.reserve(A.rows() * 2 + 1);
-  cbeg.push_back(0);
-  std::vector<int> cind;
-  cind.reserve(A.nonZeros() * 2);
-  std::vector<double> cval;
-  cval.reserve(A.nonZeros() * 2);
-
-  int A_gurobi_rows = 0;
-
-  // Add A_row_major.row(i) * vars ≥ bound (or ≤ bound) to the CSR format cbeg,
-  // cind, cva, also update rhs, sense and A_gurobi_rows.
-  auto add_gurobi_row = [&A_row_major, &var_index, &cbeg, &rhs, &sense, &cind,
-                         &cval,
-                         &A_gurobi_rows](int i, double bound, char row_sense) {
-    cbeg.push_back(cbeg.back() + *(A_row_major.outerIndexPtr() + i + 1) -
-                   *(A_row_major.outerIndexPtr() + i));
-    rhs.push_back(bound);
-    sense.push_back(row_sense);
-    for (int j = *(A_row_major.outerIndexPtr() + i);
-         j < *(A_row_major.outerIndexPtr() + i + 1); ++j) {
-      cind.push_back(var_index[*(A_row_major.innerIndexPtr() + j)]);
-      cval.push_back(*(A_row_major.valuePtr() + j));
-    }
-    A_gurobi_rows++;
-  };
-
   for (int i = 0; i < A_row_major.rows(); ++i) {
     if (!std::isinf(lb(i))) {
       // Add A_row_major.row(i) * vars >= lb(i)
@@ -428,31 +399,25 @@ int AddLinearConstraintNoDuplication(
       add_gurobi_row(i, ub(i), GRB_LESS_EQUAL);
     }
   }
-  *num_gurobi_linear_constraints += A_gurobi_rows;
-  int error =
-      GRBaddconstrs(model, A_gurobi_rows, cbeg.back(), cbeg.data(), cind.data(),
-                    cval.data(), sense.data(), rhs.data(), nullptr);
-
-  return error;
 }
 
-int AddLinearConstraint(const MathematicalProgram& prog, GRBmodel* model,
-                        const Eigen::SparseMatrix<double>& A,
-                        const Eigen::VectorXd& lb, const Eigen::VectorXd& ub,
-                        const VectorXDecisionVariable& vars, bool is_equality,
-                        int* num_gurobi_linear_constraints) {
-  const symbolic::Variables vars_set(vars);
-  if (static_cast<int>(vars_set.size()) == vars.rows()) {
-    return AddLinearConstraintNoDuplication(prog, model, A, lb, ub, vars,
-                                            is_equality,
-                                            num_gurobi_linear_constraints);
+void AppendLinearConstraintRows(const MathematicalProgram& prog,
+                                const Eigen::SparseMatrix<double>& A,
+                                const Eigen::VectorXd& lb,
+                                const Eigen::VectorXd& ub,
+                                const VectorXDecisionVariable& vars,
+                                bool is_equality,
+                                GurobiLinearConstraintRows* rows) {
+  if (!internal::HasDuplicateVariables(vars)) {
+    AppendLinearConstraintRowsNoDuplication(
+        A, lb, ub, prog.FindDecisionVariableIndices(vars), is_equality, rows);
   } else {
     Eigen::SparseMatrix<double> A_new;
     VectorX<symbolic::Variable> vars_new;
     AggregateDuplicateVariables(A, vars, &A_new, &vars_new);
-    return AddLinearConstraintNoDuplication(prog, model, A_new, lb, ub,
-                                            vars_new, is_equality,
-                                            num_gurobi_linear_constraints);
+    AppendLinearConstraintRowsNoDuplication(
+        A_new, lb, ub, prog.FindDecisionVariableIndices(vars_new), is_equality,
+        rows);
   }
 }
 
@@ -718,36 +683,52 @@ int ProcessLinearConstraints(
     GRBmodel* model, const MathematicalProgram& prog,
     int* num_gurobi_linear_constraints,
     std::unordered_map<Binding<Constraint>, int>* constraint_dual_start_row) {
+  // Reserve enough space for all the rows. Each row of an inequality
+  // constraint introduces at most two rows in Gurobi.
+  GurobiLinearConstraintRows rows;
+  int max_rows = 0;
+  int max_nonzeros = 0;
   for (const auto& binding : prog.linear_equality_constraints()) {
-    const auto& constraint = binding.evaluator();
-
-    constraint_dual_start_row->emplace(binding, *num_gurobi_linear_constraints);
+    max_rows += binding.evaluator()->num_constraints();
+    max_nonzeros += binding.evaluator()->get_sparse_A().nonZeros();
+  }
+  for (const auto& binding : prog.linear_constraints()) {
+    max_rows += 2 * binding.evaluator()->num_constraints();
+    max_nonzeros += 2 * binding.evaluator()->get_sparse_A().nonZeros();
+  }
+  rows.cbeg.reserve(max_rows + 1);
+  rows.cind.reserve(max_nonzeros);
+  rows.cval.reserve(max_nonzeros);
+  rows.sense.reserve(max_rows);
+  rows.rhs.reserve(max_rows);
 
-    const int error = AddLinearConstraint(
-        prog, model, constraint->get_sparse_A(), constraint->lower_bound(),
-        constraint->upper_bound(), binding.variables(), true,
-        num_gurobi_linear_constraints);
-    if (error) {
-      return error;
-    }
+  for (const auto& binding : prog.linear_equality_constraints()) {
+    const auto& constraint = binding.evaluator();
+    constraint_dual_start_row->emplace(
+        binding, *num_gurobi_linear_constraints + rows.num_rows());
+    AppendLinearConstraintRows(prog, constraint->get_sparse_A(),
+                               constraint->lower_bound(),
+                               constraint->upper_bound(), binding.variables(),
+                               true, &rows);
   }
 
   for (const auto& binding : prog.linear_constraints()) {
     const auto& constraint = binding.evaluator();
-
-    constraint_dual_start_row->emplace(binding, *num_gurobi_linear_constraints);
-
-    const int error = AddLinearConstraint(
-        prog, model, constraint->get_sparse_A(), constraint->lower_bound(),
-        constraint->upper_bound(), binding.variables(), false,
-        num_gurobi_linear_constraints);
-    if (error) {
-      return error;
-    }
+    constraint_dual_start_row->emplace(
+        binding, *num_gurobi_linear_constraints + rows.num_rows());
+    AppendLinearConstraintRows(prog, constraint->get_sparse_A(),
+                               constraint->lower_bound(),
+                               constraint->upper_bound(), binding.variables(),
+                               false, &rows);
   }
 
-  // If loop completes, no errors exist so the value '0' must be returned.
-  return 0;
+  *num_gurobi_linear_constraints += rows.num_rows();
+  if (rows.num_rows() == 0) {
+    return 0;
+  }
+  return GRBaddconstrs(model, rows.num_rows(), rows.cind.size(),
+                       rows.cbeg.data(), rows.cind.data(), rows.cval.data(),
+                       rows.sense.data(), rows.rhs.data(), nullptr);
 }
 
 // For Lorentz and rotated Lorentz cone constraints
@@ -16,7 +16,9 @@
 #include "drake/common/never_destroyed.h"
 #include "drake/common/text_logging.h"
 #include "drake/common/unused.h"
+#include "drake/common/ssize.h"
 #include "drake/math/autodiff.h"
+#include "drake/solvers/binding_parallel_for.h"
 #include "drake/solvers/mathematical_program.h"
 
 using Ipopt::Index;
@@ -141,7 +143,11 @@ void SetAllConstraintDualSolution(
 /// @return number of constraints
 int GetNumGradients(const Constraint& c, int var_count, Index* num_grad) {
   const int num_constraints = c.num_constraints();
-  *num_grad = num_constraints * var_count;
+  if (c.gradient_sparsity_pattern().has_value()) {
+    *num_grad = c.gradient_sparsity_pattern()->size();
+  } else {
+    *num_grad = num_constraints * var_count;
+  }
   return num_constraints;
 }
 
@@ -157,17 +163,29 @@ int GetNumGradients(const Constraint& c, int var_count, Index* num_grad) {
 /// http://www.coin-or.org/Ipopt/documentation/node38.html#app.triplet
 ///
 /// @return the number of row/column pairs filled in.
-size_t GetGradientMatrix(
-    const MathematicalProgram& prog, const Constraint& c,
-    const Eigen::Ref<const VectorXDecisionVariable>& variables,
-    Index constraint_idx, Index* iRow, Index* jCol) {
+template <typename C>
+size_t GetGradientMatrix(const MathematicalProgram& prog,
+                         const Binding<C>& binding, Index constraint_idx,
+                         Index* iRow, Index* jCol) {
+  const Constraint& c = *binding.evaluator();
   const int m = c.num_constraints();
+  const std::vector<int> var_indices =
+      prog.FindDecisionVariableIndices(binding);
   size_t grad_index = 0;
 
+  if (c.gradient_sparsity_pattern().has_value()) {
+    for (const auto& [i, j] : c.gradient_sparsity_pattern().value()) {
+      iRow[grad_index] = constraint_idx + i;
+      jCol[grad_index] = var_indices[j];
+      grad_index++;
+    }
+    return grad_index;
+  }
+
   for (int i = 0; i < static_cast<int>(m); ++i) {
-    for (int j = 0; j < variables.rows(); ++j) {
+    for (int j = 0; j < ssize(var_indices); ++j) {
       iRow[grad_index] = constraint_idx + i;
-      jCol[grad_index] = prog.FindDecisionVariableIndex(variables(j));
+      jCol[grad_index] = var_indices[j];
       grad_index++;
     }
   }
@@ -204,9 +222,11 @@ size_t EvaluateConstraint(const MathematicalProgram& prog,
   // variables in the same order they appear in xvec), but this is not
   // currently done).
   int num_v_variables = binding.variables().rows();
+  const std::vector<int> var_indices =
+      prog.FindDecisionVariableIndices(binding);
   Eigen::VectorXd this_x(num_v_variables);
   for (int i = 0; i < num_v_variables; ++i) {
-    this_x(i) = xvec(prog.FindDecisionVariableIndex(binding.variables()(i)));
+    this_x(i) = xvec(var_indices[i]);
   }
 
   if (!grad) {
@@ -223,58 +243,31 @@ size_t EvaluateConstraint(const MathematicalProgram& prog,
     return 0;
   }
 
-  // Run the version which calculates gradients.
+  // Run the version which calculates gradients. Since IPOPT directly knows
+  // the bounds of the constraint, we don't need to apply any bounding
+  // information here.
+  Eigen::VectorXd ty(c->num_constraints());
+  Eigen::SparseMatrix<double> dty_dx;
+  c->EvalWithSparseGradient(this_x, &ty, &dty_dx);
+  for (int i = 0; i < c->num_constraints(); i++) {
+    result[i] = ty(i);
+  }
 
-  // Leverage the fact that the gradient is equal to the A matrix for linear
-  // constraints.
-  if constexpr (std::is_same_v<ConstraintType, LinearEqualityConstraint> ||
-                std::is_same_v<ConstraintType, LinearConstraint>) {
-    auto A = static_cast<ConstraintType*>(c)->get_sparse_A();
-    // Verify that A has the proper size.
-    DRAKE_ASSERT(A.rows() == c->num_constraints());
-    DRAKE_ASSERT(A.cols() == binding.variables().rows());
-    // Evaluate the constraint.
-    Eigen::VectorXd ty(c->num_constraints());
-    c->Eval(this_x, &ty);
-    // Set the result and the gradient.
-    size_t grad_idx = 0;
-    for (int i = 0; i < ty.rows(); i++) {
-      result[i] = ty(i);
-      for (int j = 0; j < binding.variables().rows(); j++) {
-        grad[grad_idx++] = A.coeff(i, j);
-      }
+  // Extract the gradient entries in the order of GetGradientMatrix.
+  size_t grad_idx = 0;
+  if (c->gradient_sparsity_pattern().has_value()) {
+    for (const auto& [i, j] : c->gradient_sparsity_pattern().value()) {
+      grad[grad_idx++] = dty_dx.coeff(i, j);
     }
-    return grad_idx;
   } else {
-    // Otherwise, use auto-diff.
-    AutoDiffVecXd ty(c->num_constraints());
-    c->Eval(math::InitializeAutoDiff(this_x), &ty);
-
-    // Store the results.  Since IPOPT directly knows the bounds of the
-    // constraint, we don't need to apply any bounding information here.
-    for (int i = 0; i < c->num_constraints(); i++) {
-      result[i] = ty(i).value();
-    }
-
-    // Extract the appropriate derivatives from our result into the
-    // gradient array.
-    size_t grad_idx = 0;
-
-    DRAKE_ASSERT(ty.rows() == c->num_constraints());
+    const Eigen::MatrixXd gradient = dty_dx;
     for (int i = 0; i < ty.rows(); i++) {
-      if (ty(i).derivatives().size() > 0) {
-        for (int j = 0; j < binding.variables().rows(); j++) {
-          grad[grad_idx++] = ty(i).derivatives()(j);
-        }
-      } else {
-        for (int j = 0; j < binding.variables().rows(); j++) {
-          grad[grad_idx++] = 0;
-        }
+      for (int j = 0; j < num_v_variables; j++) {
+        grad[grad_idx++] = gradient(i, j);
       }
     }
-
-    return grad_idx;
   }
+  return grad_idx;
 }
 
 // IPOPT uses separate callbacks to get the result and the gradients.  When
@@ -338,10 +331,13 @@ struct ResultCache {
 // the duration of the Solve() call.
 class IpoptSolver_NLP : public Ipopt::TNLP {
  public:
-  explicit IpoptSolver_NLP(const MathematicalProgram& problem,
-                           const Eigen::VectorXd& x_init,
-                           MathematicalProgramResult* result)
-      : problem_(&problem), x_init_{x_init}, result_(result) {}
+  IpoptSolver_NLP(const MathematicalProgram& problem,
+                  const Eigen::VectorXd& x_init, Parallelism parallelism,
+                  MathematicalProgramResult* result)
+      : problem_(&problem),
+        x_init_{x_init},
+        parallelism_(parallelism),
+        result_(result) {}
 
   virtual ~IpoptSolver_NLP() {}
 
@@ -407,9 +403,10 @@ class IpoptSolver_NLP : public Ipopt::TNLP {
       const auto& c = binding.evaluator();
       const auto& lower_bound = c->lower_bound();
       const auto& upper_bound = c->upper_bound();
+      const std::vector<int> var_indices =
+          problem_->FindDecisionVariableIndices(binding);
       for (int k = 0; k < static_cast<int>(binding.GetNumElements()); ++k) {
-        const int idx =
-            problem_->FindDecisionVariableIndex(binding.variables()(k));
+        const int idx = var_indices[k];
         x_l[idx] = std::max(lower_bound(k), x_l[idx]);
         x_u[idx] = std::min(upper_bound(k), x_u[idx]);
       }
@@ -421,9 +418,10 @@ class IpoptSolver_NLP : public Ipopt::TNLP {
           binding.evaluator()->num_constraints(), -1);
       std::vector<int> upper_dual_indices(
           binding.evaluator()->num_constraints(), -1);
+      const std::vector<int> var_indices =
+          problem_->FindDecisionVariableIndices(binding);
       for (int k = 0; k < static_cast<int>(binding.GetNumElements()); ++k) {
-        const int idx =
-            problem_->FindDecisionVariableIndex(binding.variables()(k));
+        const int idx = var_indices[k];
         if (x_l[idx] == binding.evaluator()->lower_bound()(k)) {
           lower_dual_indices[k] = idx;
         }
@@ -548,38 +546,38 @@ class IpoptSolver_NLP : public Ipopt::TNLP {
                                // GetGradientMatrix.
       for (const auto& c : problem_->generic_constraints()) {
         grad_idx +=
-            GetGradientMatrix(*problem_, *(c.evaluator()), c.variables(),
-                              constraint_idx, iRow + grad_idx, jCol + grad_idx);
+            GetGradientMatrix(*problem_, c, constraint_idx, iRow + grad_idx,
+                              jCol + grad_idx);
         constraint_idx += c.evaluator()->num_constraints();
       }
       for (const auto& c : problem_->quadratic_constraints()) {
         grad_idx +=
-            GetGradientMatrix(*problem_, *(c.evaluator()), c.variables(),
-                              constraint_idx, iRow + grad_idx, jCol + grad_idx);
+            GetGradientMatrix(*problem_, c, constraint_idx, iRow + grad_idx,
+                              jCol + grad_idx);
         constraint_idx += c.evaluator()->num_constraints();
       }
       for (const auto& c : problem_->lorentz_cone_constraints()) {
         grad_idx +=
-            GetGradientMatrix(*problem_, *(c.evaluator()), c.variables(),
-                              constraint_idx, iRow + grad_idx, jCol + grad_idx);
+            GetGradientMatrix(*problem_, c, constraint_idx, iRow + grad_idx,
+                              jCol + grad_idx);
         constraint_idx += c.evaluator()->num_constraints();
       }
       for (const auto& c : problem_->rotated_lorentz_cone_constraints()) {
         grad_idx +=
-            GetGradientMatrix(*problem_, *(c.evaluator()), c.variables(),
-                              constraint_idx, iRow + grad_idx, jCol + grad_idx);
+            GetGradientMatrix(*problem_, c, constraint_idx, iRow + grad_idx,
+                              jCol + grad_idx);
         constraint_idx += c.evaluator()->num_constraints();
       }
       for (const auto& c : problem_->linear_constraints()) {
         grad_idx +=
-            GetGradientMatrix(*problem_, *(c.evaluator()), c.variables(),
-                              constraint_idx, iRow + grad_idx, jCol + grad_idx);
+            GetGradientMatrix(*problem_, c, constraint_idx, iRow + grad_idx,
+                              jCol + grad_idx);
         constraint_idx += c.evaluator()->num_constraints();
       }
       for (const auto& c : problem_->linear_equality_constraints()) {
         grad_idx +=
-            GetGradientMatrix(*problem_, *(c.evaluator()), c.variables(),
-                              constraint_idx, iRow + grad_idx, jCol + grad_idx);
+            GetGradientMatrix(*problem_, c, constraint_idx, iRow + grad_idx,
+                              jCol + grad_idx);
         constraint_idx += c.evaluator()->num_constraints();
       }
       DRAKE_ASSERT(static_cast<Index>(grad_idx) == nele_jac);
@@ -670,39 +668,75 @@ class IpoptSolver_NLP : public Ipopt::TNLP {
 
     problem_->EvalVisualizationCallbacks(xvec);
 
-    AutoDiffVecXd ty(1);
-    Eigen::VectorXd this_x;
-
     cost_cache_->SetX(n, x);
     cost_cache_->result[0] = 0;
     cost_cache_->grad.assign(n, 0);
 
-    for (auto const& binding : problem_->GetAllCosts()) {
-      int num_v_variables = binding.GetNumElements();
-      this_x.resize(num_v_variables);
+    // The costs are evaluated concurrently (as allowed by parallelism_), but
+    // their values and gradients are summed in the order of the bindings.
+    const std::vector<Binding<Cost>> costs = problem_->GetAllCosts();
+    std::vector<AutoDiffXd> cost_values(costs.size());
+    internal::BindingParallelFor(parallelism_, costs, [&](int k) {
+      const Binding<Cost>& binding = costs[k];
+      const int num_v_variables = binding.GetNumElements();
+      const std::vector<int> var_indices =
+          problem_->FindDecisionVariableIndices(binding);
+      Eigen::VectorXd this_x(num_v_variables);
       for (int i = 0; i < num_v_variables; ++i) {
-        this_x(i) =
-            xvec(problem_->FindDecisionVariableIndex(binding.variables()(i)));
+        this_x(i) = xvec(var_indices[i]);
       }
 
+      AutoDiffVecXd ty(1);
       binding.evaluator()->Eval(math::InitializeAutoDiff(this_x), &ty);
-
-      cost_cache_->result[0] += ty(0).value();
-
-      if (ty(0).derivatives().size() > 0) {
-        for (int j = 0; j < num_v_variables; ++j) {
-          const size_t vj_index =
-              problem_->FindDecisionVariableIndex(binding.variables()(j));
-          cost_cache_->grad[vj_index] += ty(0).derivatives()(j);
+      cost_values[k] = ty(0);
+    });
+
+    for (int k = 0; k < ssize(costs); ++k) {
+      const Binding<Cost>& binding = costs[k];
+      cost_cache_->result[0] += cost_values[k].value();
+
+      if (cost_values[k].derivatives().size() > 0) {
+        const std::vector<int> var_indices =
+            problem_->FindDecisionVariableIndices(binding);
+        for (int j = 0; j < binding.variables().rows(); ++j) {
+          cost_cache_->grad[var_indices[j]] += cost_values[k].derivatives()(j);
         }
       }
       cost_cache_->grad_valid = true;
 
-      // We do not need to add code for ty(0).derivatives().size() == 0, since
+      // We do not need to add code for derivatives().size() == 0, since
       // cost_cache_->grad would be unchanged if the derivative has zero size.
     }
   }
 
+  // Evaluates the constraints in `bindings`, whose first value is stored at
+  // `*result` and whose first gradient entry is stored at `*grad` (if `*grad`
+  // is not null). Advances `*result` and `*grad` past the entries of
+  // `bindings`. Each binding writes to its own slices of the result and the
+  // gradient, hence the bindings can be evaluated concurrently.
+  template <typename C>
+  void EvaluateConstraintList(const std::vector<Binding<C>>& bindings,
+                              const Eigen::VectorXd& xvec, Number** result,
+                              Number** grad) {
+    std::vector<Number*> binding_result(bindings.size());
+    std::vector<Number*> binding_grad(bindings.size(), nullptr);
+    for (int k = 0; k < ssize(bindings); ++k) {
+      const Constraint& c = *bindings[k].evaluator();
+      binding_result[k] = *result;
+      *result += c.num_constraints();
+      if (*grad != nullptr) {
+        Index num_grad{};
+        GetNumGradients(c, bindings[k].variables().rows(), &num_grad);
+        binding_grad[k] = *grad;
+        *grad += num_grad;
+      }
+    }
+    internal::BindingParallelFor(parallelism_, bindings, [&](int k) {
+      EvaluateConstraint(*problem_, xvec, bindings[k], binding_result[k],
+                         binding_grad[k]);
+    });
+  }
+
   void EvaluateConstraints(Index n, const Number* x, bool eval_gradient) {
     const Eigen::VectorXd xvec = MakeEigenVector(n, x);
 
@@ -710,30 +744,18 @@ class IpoptSolver_NLP : public Ipopt::TNLP {
     Number* result = constraint_cache_->result.data();
     Number* grad = eval_gradient ? constraint_cache_->grad.data() : nullptr;
 
-    for (const auto& c : problem_->generic_constraints()) {
-      grad += EvaluateConstraint(*problem_, xvec, c, result, grad);
-      result += c.evaluator()->num_constraints();
-    }
-    for (const auto& c : problem_->quadratic_constraints()) {
-      grad += EvaluateConstraint(*problem_, xvec, c, result, grad);
-      result += c.evaluator()->num_constraints();
-    }
-    for (const auto& c : problem_->lorentz_cone_constraints()) {
-      grad += EvaluateConstraint(*problem_, xvec, c, result, grad);
-      result += c.evaluator()->num_constraints();
-    }
-    for (const auto& c : problem_->rotated_lorentz_cone_constraints()) {
-      grad += EvaluateConstraint(*problem_, xvec, c, result, grad);
-      result += c.evaluator()->num_constraints();
-    }
-    for (const auto& c : problem_->linear_constraints()) {
-      grad += EvaluateConstraint(*problem_, xvec, c, result, grad);
-      result += c.evaluator()->num_constraints();
-    }
-    for (const auto& c : problem_->linear_equality_constraints()) {
-      grad += EvaluateConstraint(*problem_, xvec, c, result, grad);
-      result += c.evaluator()->num_constraints();
-    }
+    EvaluateConstraintList(problem_->generic_constraints(), xvec, &result,
+                           &grad);
+    EvaluateConstraintList(problem_->quadratic_constraints(), xvec, &result,
+                           &grad);
+    EvaluateConstraintList(problem_->lorentz_cone_constraints(), xvec, &result,
+                           &grad);
+    EvaluateConstraintList(problem_->rotated_lorentz_cone_constraints(), xvec,
+                           &result, &grad);
+    EvaluateConstraintList(problem_->linear_constraints(), xvec, &result,
+                           &grad);
+    EvaluateConstraintList(problem_->linear_equality_constraints(), xvec,
+                           &result, &grad);
 
     if (eval_gradient) {
       constraint_cache_->grad_valid = true;
@@ -744,6 +766,7 @@ class IpoptSolver_NLP : public Ipopt::TNLP {
   std::unique_ptr<ResultCache> cost_cache_;
   std::unique_ptr<ResultCache> constraint_cache_;
   Eigen::VectorXd x_init_;
+  const Parallelism parallelism_;
   MathematicalProgramResult* const result_;
   // bb_con_dual_variable_indices_[constraint] maps the bounding box constraint
   // to the indices of its dual variables (one for lower bound and one for upper
@@ -890,8 +913,9 @@ void IpoptSolver::DoSolve(const MathematicalProgram& prog,
     return;
   }
 
+  const Parallelism parallelism(merged_options.get_max_threads().value_or(1));
   Ipopt::SmartPtr<IpoptSolver_NLP> nlp =
-      new IpoptSolver_NLP(prog, initial_guess, result);
+      new IpoptSolver_NLP(prog, initial_guess, parallelism, result);
   status = app->OptimizeTNLP(nlp);
 }
 
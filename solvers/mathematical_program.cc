@@ -1,7 +1,9 @@
 #include "drake/solvers/mathematical_program.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cstddef>
+#include <cstdint>
 #include <limits>
 #include <memory>
 #include <ostream>
@@ -55,14 +57,49 @@ using internal::CreateBinding;
 
 const double kInf = std::numeric_limits<double>::infinity();
 
-MathematicalProgram::MathematicalProgram() = default;
+namespace {
+// Returns a new identifier for a MathematicalProgram; see program_id_.
+int64_t GetNewProgramId() {
+  static std::atomic<int64_t> next_id{1};
+  return next_id++;
+}
+}  // namespace
+
+MathematicalProgram::MathematicalProgram() : program_id_(GetNewProgramId()) {}
 
 MathematicalProgram::MathematicalProgram(const MathematicalProgram&) = default;
 
 MathematicalProgram::~MathematicalProgram() = default;
 
 std::unique_ptr<MathematicalProgram> MathematicalProgram::Clone() const {
-  return std::unique_ptr<MathematicalProgram>(new MathematicalProgram(*this));
+  std::unique_ptr<MathematicalProgram> clone(new MathematicalProgram(*this));
+  // The clone has the same decision variables as this program, in the same
+  // order, so the variable indices cached by this program are valid for the
+  // clone too.
+  clone->program_id_ = GetNewProgramId();
+  auto adopt_indices = [this, &clone](auto* bindings) {
+    for (auto& binding : *bindings) {
+      if (binding.variable_indices_program_id_ == program_id_) {
+        binding.variable_indices_program_id_ = clone->program_id_;
+      }
+    }
+  };
+  adopt_indices(&clone->generic_costs_);
+  adopt_indices(&clone->quadratic_costs_);
+  adopt_indices(&clone->linear_costs_);
+  adopt_indices(&clone->l2norm_costs_);
+  adopt_indices(&clone->generic_constraints_);
+  adopt_indices(&clone->linear_constraints_);
+  adopt_indices(&clone->linear_equality_constraints_);
+  adopt_indices(&clone->bbox_constraints_);
+  adopt_indices(&clone->quadratic_constraints_);
+  adopt_indices(&clone->lorentz_cone_constraint_);
+  adopt_indices(&clone->rotated_lorentz_cone_constraint_);
+  adopt_indices(&clone->positive_semidefinite_constraint_);
+  adopt_indices(&clone->linear_matrix_inequality_constraint_);
+  adopt_indices(&clone->exponential_cone_constraints_);
+  adopt_indices(&clone->linear_complementarity_constraints_);
+  return clone;
 }
 
 string MathematicalProgram::to_string() const {
@@ -459,6 +496,7 @@ Binding<Cost> MathematicalProgram::AddCost(const Binding<Cost>& binding) {
     DRAKE_DEMAND(CheckBinding(binding));
     required_capabilities_.insert(ProgramAttribute::kGenericCost);
     generic_costs_.push_back(binding);
+    CacheDecisionVariableIndices(&generic_costs_.back());
     return generic_costs_.back();
   }
 }
@@ -468,6 +506,7 @@ Binding<LinearCost> MathematicalProgram::AddCost(
   DRAKE_DEMAND(CheckBinding(binding));
   required_capabilities_.insert(ProgramAttribute::kLinearCost);
   linear_costs_.push_back(binding);
+  CacheDecisionVariableIndices(&linear_costs_.back());
   return linear_costs_.back();
 }
 
@@ -490,6 +529,7 @@ Binding<QuadraticCost> MathematicalProgram::AddCost(
                binding.evaluator()->b().rows() ==
                    static_cast<int>(binding.GetNumElements()));
   quadratic_costs_.push_back(binding);
+  CacheDecisionVariableIndices(&quadratic_costs_.back());
   return quadratic_costs_.back();
 }
 
@@ -526,6 +566,7 @@ Binding<L2NormCost> MathematicalProgram::AddCost(
   DRAKE_DEMAND(CheckBinding(binding));
   required_capabilities_.insert(ProgramAttribute::kL2NormCost);
   l2norm_costs_.push_back(binding);
+  CacheDecisionVariableIndices(&l2norm_costs_.back());
   return l2norm_costs_.back();
 }
 
@@ -777,6 +818,7 @@ Binding<Constraint> MathematicalProgram::AddConstraint(
     }
     required_capabilities_.insert(ProgramAttribute::kGenericConstraint);
     generic_constraints_.push_back(binding);
+    CacheDecisionVariableIndices(&generic_constraints_.back());
     return generic_constraints_.back();
   }
 }
@@ -889,6 +931,7 @@ Binding<LinearConstraint> MathematicalProgram::AddConstraint(
     }
     required_capabilities_.insert(ProgramAttribute::kLinearConstraint);
     linear_constraints_.push_back(binding);
+    CacheDecisionVariableIndices(&linear_constraints_.back());
     return linear_constraints_.back();
   }
 }
@@ -918,6 +961,7 @@ Binding<LinearEqualityConstraint> MathematicalProgram::AddConstraint(
   }
   required_capabilities_.insert(ProgramAttribute::kLinearEqualityConstraint);
   linear_equality_constraints_.push_back(binding);
+  CacheDecisionVariableIndices(&linear_equality_constraints_.back());
   return linear_equality_constraints_.back();
 }
 
@@ -957,6 +1001,7 @@ Binding<BoundingBoxConstraint> MathematicalProgram::AddConstraint(
                static_cast<int>(binding.GetNumElements()));
   required_capabilities_.insert(ProgramAttribute::kLinearConstraint);
   bbox_constraints_.push_back(binding);
+  CacheDecisionVariableIndices(&bbox_constraints_.back());
   return bbox_constraints_.back();
 }
 
@@ -965,6 +1010,7 @@ Binding<LorentzConeConstraint> MathematicalProgram::AddConstraint(
   DRAKE_DEMAND(CheckBinding(binding));
   required_capabilities_.insert(ProgramAttribute::kLorentzConeConstraint);
   lorentz_cone_constraint_.push_back(binding);
+  CacheDecisionVariableIndices(&lorentz_cone_constraint_.back());
   return lorentz_cone_constraint_.back();
 }
 
@@ -997,6 +1043,7 @@ Binding<RotatedLorentzConeConstraint> MathematicalProgram::AddConstraint(
   required_capabilities_.insert(
       ProgramAttribute::kRotatedLorentzConeConstraint);
   rotated_lorentz_cone_constraint_.push_back(binding);
+  CacheDecisionVariableIndices(&rotated_lorentz_cone_constraint_.back());
   return rotated_lorentz_cone_constraint_.back();
 }
 
@@ -1058,6 +1105,7 @@ Binding<QuadraticConstraint> MathematicalProgram::AddConstraint(
   DRAKE_DEMAND(CheckBinding(binding));
   required_capabilities_.insert(ProgramAttribute::kQuadraticConstraint);
   quadratic_constraints_.push_back(binding);
+  CacheDecisionVariableIndices(&quadratic_constraints_.back());
   return quadratic_constraints_.back();
 }
 
@@ -1089,6 +1137,7 @@ Binding<LinearComplementarityConstraint> MathematicalProgram::AddConstraint(
       ProgramAttribute::kLinearComplementarityConstraint);
 
   linear_complementarity_constraints_.push_back(binding);
+  CacheDecisionVariableIndices(&linear_complementarity_constraints_.back());
   return linear_complementarity_constraints_.back();
 }
 
@@ -1128,6 +1177,7 @@ Binding<PositiveSemidefiniteConstraint> MathematicalProgram::AddConstraint(
   required_capabilities_.insert(
       ProgramAttribute::kPositiveSemidefiniteConstraint);
   positive_semidefinite_constraint_.push_back(binding);
+  CacheDecisionVariableIndices(&positive_semidefinite_constraint_.back());
   return positive_semidefinite_constraint_.back();
 }
 
@@ -1156,6 +1206,7 @@ Binding<LinearMatrixInequalityConstraint> MathematicalProgram::AddConstraint(
   required_capabilities_.insert(
       ProgramAttribute::kPositiveSemidefiniteConstraint);
   linear_matrix_inequality_constraint_.push_back(binding);
+  CacheDecisionVariableIndices(&linear_matrix_inequality_constraint_.back());
   return linear_matrix_inequality_constraint_.back();
 }
 
@@ -1522,6 +1573,7 @@ Binding<ExponentialConeConstraint> MathematicalProgram::AddConstraint(
   DRAKE_DEMAND(CheckBinding(binding));
   required_capabilities_.insert(ProgramAttribute::kExponentialConeConstraint);
   exponential_cone_constraints_.push_back(binding);
+  CacheDecisionVariableIndices(&exponential_cone_constraints_.back());
   return exponential_cone_constraints_.back();
 }
 
@@ -2108,6 +2160,16 @@ bool MathematicalProgram::CheckBinding(const Binding<C>& binding) const {
   return (binding.evaluator()->num_outputs() > 0);
 }
 
+template <typename C>
+void MathematicalProgram::CacheDecisionVariableIndices(
+    Binding<C>* binding) const {
+  if (binding->variable_indices_program_id_ != program_id_) {
+    binding->variable_indices_ = std::make_shared<const std::vector<int>>(
+        FindDecisionVariableIndices(binding->variables()));
+    binding->variable_indices_program_id_ = program_id_;
+  }
+}
+
 std::ostream& operator<<(std::ostream& os, const MathematicalProgram& prog) {
   if (prog.num_vars() > 0) {
     os << fmt::format("Decision variables: {}\n\n",
@@ -2,6 +2,7 @@
 
 #include <array>
 #include <cstddef>
+#include <cstdint>
 #include <limits>
 #include <list>
 #include <map>
@@ -3337,6 +3338,25 @@ class MathematicalProgram {
   [[nodiscard]] std::vector<int> FindDecisionVariableIndices(
       const Eigen::Ref<const VectorXDecisionVariable>& vars) const;
 
+  /**
+   * Returns the indices of the decision variables bound by @p binding, i.e.,
+   * the same as FindDecisionVariableIndices(binding.variables()). The indices
+   * of the bindings stored in this program (including copies of them, such as
+   * those returned by GetAllCosts() or GetAllConstraints()) are looked up once
+   * when the binding is added and cached, so that solvers need not look them
+   * up again on every solve.
+   * @pre{The variables of @p binding are decision variables in the
+   * mathematical program, otherwise this function throws a runtime error.}
+   */
+  template <typename C>
+  [[nodiscard]] std::vector<int> FindDecisionVariableIndices(
+      const Binding<C>& binding) const {
+    if (binding.variable_indices_program_id_ == program_id_) {
+      return *binding.variable_indices_;
+    }
+    return FindDecisionVariableIndices(binding.variables());
+  }
+
   /** Returns the index of the indeterminate. Internally a solver
    * thinks all indeterminates are stored in an array, and it accesses each
    * individual indeterminate using its index. This index is used when adding
@@ -3763,6 +3783,14 @@ class MathematicalProgram {
   template <typename C>
   [[nodiscard]] bool CheckBinding(const Binding<C>& binding) const;
 
+  /*
+   * Caches in @p binding the indices of its variables in this program, for
+   * FindDecisionVariableIndices(const Binding<C>&). Call this on the copy of a
+   * binding that is stored in this program, after CheckBinding().
+   */
+  template <typename C>
+  void CacheDecisionVariableIndices(Binding<C>* binding) const;
+
   /*
    * Adds new variables to MathematicalProgram.
    */
@@ -3809,6 +3837,11 @@ class MathematicalProgram {
   // in the optimization program.
   std::unordered_map<symbolic::Variable::Id, int> decision_variable_index_{};
 
+  // Identifies this program among all of the programs in this process, so
+  // that the variable indices cached in a Binding are only ever used by the
+  // program that cached them. Clone() gives the clone a new identifier.
+  int64_t program_id_;
+
   // Use std::vector here instead of Eigen::VectorX because std::vector performs
   // much better when pushing new variables into the container.
   std::vector<symbolic::Variable> decision_variables_;
@@ -100,93 +100,113 @@ MSKrescodee MosekSolverProgram::AddScalarTimesMatrixVariableEntryToMosek(
   return rescode;
 }
 
-// Determine the sense of each constraint. The sense can be equality constraint,
-// less than, greater than, or bounded on both side.
-MSKrescodee MosekSolverProgram::SetMosekLinearConstraintBound(
-    int linear_constraint_index, double lower, double upper,
-    LinearConstraintBoundType bound_type) {
-  MSKrescodee rescode{MSK_RES_OK};
+namespace {
+// Determine the sense of a constraint lower <= a(x) <= upper as the Mosek bound
+// key `key`, together with the Mosek bounds `bl` <= a(x) <= `bu`.
+void CalcMosekLinearConstraintBound(double lower, double upper,
+                                    LinearConstraintBoundType bound_type,
+                                    MSKboundkeye* key, MSKrealt* bl,
+                                    MSKrealt* bu) {
   switch (bound_type) {
     case LinearConstraintBoundType::kEquality: {
-      rescode = MSK_putconbound(task_, linear_constraint_index, MSK_BK_FX,
-                                lower, lower);
-      if (rescode != MSK_RES_OK) {
-        return rescode;
-      }
-      break;
+      *key = MSK_BK_FX;
+      *bl = lower;
+      *bu = lower;
+      return;
     }
     case LinearConstraintBoundType::kInequality: {
       if (std::isinf(lower) && std::isinf(upper)) {
         DRAKE_DEMAND(lower < 0 && upper > 0);
-        rescode = MSK_putconbound(task_, linear_constraint_index, MSK_BK_FR,
-                                  -MSK_INFINITY, MSK_INFINITY);
+        *key = MSK_BK_FR;
+        *bl = -MSK_INFINITY;
+        *bu = MSK_INFINITY;
       } else if (std::isinf(lower) && !std::isinf(upper)) {
-        rescode = MSK_putconbound(task_, linear_constraint_index, MSK_BK_UP,
-                                  -MSK_INFINITY, upper);
+        *key = MSK_BK_UP;
+        *bl = -MSK_INFINITY;
+        *bu = upper;
       } else if (!std::isinf(lower) && std::isinf(upper)) {
-        rescode = MSK_putconbound(task_, linear_constraint_index, MSK_BK_LO,
-                                  lower, MSK_INFINITY);
+        *key = MSK_BK_LO;
+        *bl = lower;
+        *bu = MSK_INFINITY;
       } else {
-        rescode = MSK_putconbound(task_, linear_constraint_index, MSK_BK_RA,
-                                  lower, upper);
+        *key = MSK_BK_RA;
+        *bl = lower;
+        *bu = upper;
       }
-      if (rescode != MSK_RES_OK) {
-        return rescode;
-      }
-      break;
+      return;
     }
   }
-  return rescode;
+  DRAKE_UNREACHABLE();
 }
+}  // namespace
 
-// Add the linear constraint lower <= A * decision_vars + B * slack_vars <=
-// upper.
-MSKrescodee MosekSolverProgram::AddLinearConstraintToMosek(
-    const MathematicalProgram& prog, const Eigen::SparseMatrix<double>& A,
-    const Eigen::SparseMatrix<double>& B, const Eigen::VectorXd& lower,
-    const Eigen::VectorXd& upper,
+// Determine the sense of each constraint. The sense can be equality constraint,
+// less than, greater than, or bounded on both side.
+MSKrescodee MosekSolverProgram::SetMosekLinearConstraintBound(
+    int linear_constraint_index, double lower, double upper,
+    LinearConstraintBoundType bound_type) {
+  MSKboundkeye key;
+  MSKrealt bl;
+  MSKrealt bu;
+  CalcMosekLinearConstraintBound(lower, upper, bound_type, &key, &bl, &bu);
+  return MSK_putconbound(task_, linear_constraint_index, key, bl, bu);
+}
+
+MSKrescodee MosekSolverProgram::SetMosekLinearConstraintBounds(
+    int first_linear_constraint_index, const Eigen::VectorXd& lower,
+    const Eigen::VectorXd& upper, LinearConstraintBoundType bound_type) {
+  DRAKE_ASSERT(lower.rows() == upper.rows());
+  const int num_rows = lower.rows();
+  if (num_rows == 0) {
+    return MSK_RES_OK;
+  }
+  std::vector<MSKboundkeye> keys(num_rows);
+  std::vector<MSKrealt> bl(num_rows);
+  std::vector<MSKrealt> bu(num_rows);
+  for (int i = 0; i < num_rows; ++i) {
+    CalcMosekLinearConstraintBound(lower(i), upper(i), bound_type, &keys[i],
+                                   &bl[i], &bu[i]);
+  }
+  return MSK_putconboundslice(task_, first_linear_constraint_index,
+                              first_linear_constraint_index + num_rows,
+                              keys.data(), bl.data(), bu.data());
+}
+
+MSKrescodee MosekSolverProgram::SetLinearConstraintRows(
+    const MathematicalProgram& prog, int first_linear_constraint_index,
+    const Eigen::SparseMatrix<double>& A, const Eigen::SparseMatrix<double>& B,
+    const Eigen::VectorXd& lower, const Eigen::VectorXd& upper,
     const VectorX<symbolic::Variable>& decision_vars,
     const std::vector<MSKint32t>& slack_vars_mosek_indices,
-    LinearConstraintBoundType bound_type) {
-  MSKrescodee rescode{MSK_RES_OK};
+    LinearConstraintBoundType bound_type, std::vector<MSKint32t>* Ax_subi,
+    std::vector<MSKint32t>* Ax_subj, std::vector<MSKrealt>* Ax_valij) {
   DRAKE_ASSERT(lower.rows() == upper.rows());
   DRAKE_ASSERT(A.rows() == lower.rows() && A.cols() == decision_vars.rows());
   DRAKE_ASSERT(B.rows() == lower.rows() &&
                B.cols() == static_cast<int>(slack_vars_mosek_indices.size()));
-  int num_mosek_constraint{};
-  rescode = MSK_getnumcon(task_, &num_mosek_constraint);
-  if (rescode != MSK_RES_OK) {
-    return rescode;
-  }
-  rescode = MSK_appendcons(task_, lower.rows());
+  // It is important that the order of the Mosek constraints is the same as in
+  // lower <= A * decision_vars + B * slack_vars <= upper. When we specify the
+  // dual variable indices, we rely on this order.
+  MSKrescodee rescode = SetMosekLinearConstraintBounds(
+      first_linear_constraint_index, lower, upper, bound_type);
   if (rescode != MSK_RES_OK) {
     return rescode;
   }
-  for (int i = 0; i < lower.rows(); ++i) {
-    // It is important that AddLinearConstraintToMosek keeps the order of the
-    // linear constraint the same as in lower <= A * decision_vars + B *
-    // slack_vars <= upper. When we specify the dual variable indices, we rely
-    // on this order.
-    rescode = SetMosekLinearConstraintBound(num_mosek_constraint + i, lower(i),
-                                            upper(i), bound_type);
-    if (rescode != MSK_RES_OK) {
-      return rescode;
-    }
-  }
   // (A * decision_vars + B * slack_var)(i) = (Aₓ * x)(i) + ∑ⱼ <A̅ᵢⱼ, X̅ⱼ>
   // where we decompose [decision_vars; slack_var] to Mosek nonmatrix variable
   // x and Mosek matrix variable X̅.
 
-  // Ax_subi, Ax_subj, Ax_valij are the triplets format of matrix Aₓ.
-  std::vector<MSKint32t> Ax_subi, Ax_subj;
-  std::vector<MSKrealt> Ax_valij;
+  // subi, subj, valij are the triplets format of matrix Aₓ, with the row
+  // indices relative to first_linear_constraint_index.
+  std::vector<MSKint32t> subi, subj;
+  std::vector<MSKrealt> valij;
   std::vector<std::unordered_map<
       MSKint64t, std::pair<std::vector<MSKint64t>, std::vector<MSKrealt>>>>
       bar_A;
 
   rescode =
       ParseLinearExpression(prog, A, B, decision_vars, slack_vars_mosek_indices,
-                            &Ax_subi, &Ax_subj, &Ax_valij, &bar_A);
+                            &subi, &subj, &valij, &bar_A);
   if (rescode != MSK_RES_OK) {
     return rescode;
   }
@@ -196,17 +216,50 @@ MSKrescodee MosekSolverProgram::AddLinearConstraintToMosek(
         // Now compute the matrix A̅ᵢⱼ.
         const std::vector<MSKint64t>& sub = sub_weights.first;
         const std::vector<MSKrealt>& weights = sub_weights.second;
-        rescode = MSK_putbaraij(task_, num_mosek_constraint + i, j, sub.size(),
-                                sub.data(), weights.data());
+        rescode =
+            MSK_putbaraij(task_, first_linear_constraint_index + i, j,
+                          sub.size(), sub.data(), weights.data());
         if (rescode != MSK_RES_OK) {
           return rescode;
         }
       }
     }
   }
-  // Add num_mosek_constraint to each entry of Ax_subi;
-  for (int i = 0; i < static_cast<int>(Ax_subi.size()); ++i) {
-    Ax_subi[i] += num_mosek_constraint;
+  for (int i = 0; i < static_cast<int>(subi.size()); ++i) {
+    Ax_subi->push_back(first_linear_constraint_index + subi[i]);
+  }
+  Ax_subj->insert(Ax_subj->end(), subj.begin(), subj.end());
+  Ax_valij->insert(Ax_valij->end(), valij.begin(), valij.end());
+  return rescode;
+}
+
+// Add the linear constraint lower <= A * decision_vars + B * slack_vars <=
+// upper.
+MSKrescodee MosekSolverProgram::AddLinearConstraintToMosek(
+    const MathematicalProgram& prog, const Eigen::SparseMatrix<double>& A,
+    const Eigen::SparseMatrix<double>& B, const Eigen::VectorXd& lower,
+    const Eigen::VectorXd& upper,
+    const VectorX<symbolic::Variable>& decision_vars,
+    const std::vector<MSKint32t>& slack_vars_mosek_indices,
+    LinearConstraintBoundType bound_type) {
+  MSKrescodee rescode{MSK_RES_OK};
+  int num_mosek_constraint{};
+  rescode = MSK_getnumcon(task_, &num_mosek_constraint);
+  if (rescode != MSK_RES_OK) {
+    return rescode;
+  }
+  rescode = MSK_appendcons(task_, lower.rows());
+  if (rescode != MSK_RES_OK) {
+    return rescode;
+  }
+  // Ax_subi, Ax_subj, Ax_valij are the triplets format of matrix Aₓ.
+  std::vector<MSKint32t> Ax_subi, Ax_subj;
+  std::vector<MSKrealt> Ax_valij;
+  rescode = SetLinearConstraintRows(
+      prog, num_mosek_constraint, A, B, lower, upper, decision_vars,
+      slack_vars_mosek_indices, bound_type, &Ax_subi, &Ax_subj, &Ax_valij);
+  if (rescode != MSK_RES_OK) {
+    return rescode;
   }
   rescode = MSK_putaijlist(task_, Ax_subi.size(), Ax_subi.data(),
                            Ax_subj.data(), Ax_valij.data());
@@ -236,8 +289,7 @@ MSKrescodee MosekSolverProgram::ParseLinearExpression(
   // First check if decision_vars contains duplication.
   // Since the duplication doesn't happen very often, we focus on improving the
   // speed of the no-duplication case.
-  const symbolic::Variables decision_vars_set(decision_vars);
-  if (static_cast<int>(decision_vars_set.size()) == decision_vars.rows()) {
+  if (!HasDuplicateVariables(decision_vars)) {
     return this->ParseLinearExpressionNoDuplication(
         prog, A, B, decision_vars, slack_vars_mosek_indices, F_subi, F_subj,
         F_valij, bar_F);
@@ -162,6 +162,31 @@ class MosekSolverProgram {
       int linear_constraint_index, double lower, double upper,
       LinearConstraintBoundType bound_type);
 
+  // Same as SetMosekLinearConstraintBound, but sets the bounds of the
+  // constraints first_linear_constraint_index + i for all the rows i of lower
+  // and upper in a single call.
+  MSKrescodee SetMosekLinearConstraintBounds(
+      int first_linear_constraint_index, const Eigen::VectorXd& lower,
+      const Eigen::VectorXd& upper, LinearConstraintBoundType bound_type);
+
+  // Set the rows first_linear_constraint_index, ...,
+  // first_linear_constraint_index + lower.rows() - 1 of the Mosek task, which
+  // must have been appended already, to the linear constraint
+  // lower <= A * decision_vars + B * slack_vars <= upper. The bounds and the
+  // matrix variable terms are set directly, while the triplets of the
+  // nonmatrix variable terms are appended to Ax_subi, Ax_subj and Ax_valij,
+  // such that the caller can add the triplets of many constraints with a single
+  // call to MSK_putaijlist.
+  MSKrescodee SetLinearConstraintRows(
+      const MathematicalProgram& prog, int first_linear_constraint_index,
+      const Eigen::SparseMatrix<double>& A,
+      const Eigen::SparseMatrix<double>& B, const Eigen::VectorXd& lower,
+      const Eigen::VectorXd& upper,
+      const VectorX<symbolic::Variable>& decision_vars,
+      const std::vector<MSKint32t>& slack_vars_mosek_indices,
+      LinearConstraintBoundType bound_type, std::vector<MSKint32t>* Ax_subi,
+      std::vector<MSKint32t>* Ax_subj, std::vector<MSKrealt>* Ax_valij);
+
   // Add the linear constraint lower <= A * decision_vars + B * slack_vars <=
   // upper.
   MSKrescodee AddLinearConstraintToMosek(
@@ -405,21 +430,38 @@ MSKrescodee MosekSolverProgram::AddLinearConstraintsFromBindings(
     const std::vector<Binding<C>>& constraint_list,
     LinearConstraintBoundType bound_type, const MathematicalProgram& prog,
     std::unordered_map<Binding<C>, ConstraintDualIndices>* dual_indices) {
-  MSKrescodee rescode{MSK_RES_OK};
+  // Append the rows of all the bindings at once, and then fill them in.
+  int num_linear_constraints{-1};
+  MSKrescodee rescode = MSK_getnumcon(task_, &num_linear_constraints);
+  if (rescode != MSK_RES_OK) {
+    return rescode;
+  }
+  int num_new_rows = 0;
+  int num_nonzeros = 0;
+  for (const auto& binding : constraint_list) {
+    num_new_rows += binding.evaluator()->num_constraints();
+    num_nonzeros += binding.evaluator()->get_sparse_A().nonZeros();
+  }
+  rescode = MSK_appendcons(task_, num_new_rows);
+  if (rescode != MSK_RES_OK) {
+    return rescode;
+  }
+  // Ax_subi, Ax_subj, Ax_valij are the triplets format of the nonmatrix
+  // variable terms of all the bindings.
+  std::vector<MSKint32t> Ax_subi, Ax_subj;
+  std::vector<MSKrealt> Ax_valij;
+  Ax_subi.reserve(num_nonzeros);
+  Ax_subj.reserve(num_nonzeros);
+  Ax_valij.reserve(num_nonzeros);
   for (const auto& binding : constraint_list) {
     const auto& constraint = binding.evaluator();
     const Eigen::SparseMatrix<double>& A = constraint->get_sparse_A();
     const Eigen::VectorXd& lb = constraint->lower_bound();
     const Eigen::VectorXd& ub = constraint->upper_bound();
-    Eigen::SparseMatrix<double> B_zero(A.rows(), 0);
-    B_zero.setZero();
-    int num_linear_constraints{-1};
-    rescode = MSK_getnumcon(task_, &num_linear_constraints);
-    if (rescode != MSK_RES_OK) {
-      return rescode;
-    }
-    rescode = AddLinearConstraintToMosek(prog, A, B_zero, lb, ub,
-                                         binding.variables(), {}, bound_type);
+    const Eigen::SparseMatrix<double> B_zero(A.rows(), 0);
+    rescode = SetLinearConstraintRows(
+        prog, num_linear_constraints, A, B_zero, lb, ub, binding.variables(),
+        {}, bound_type, &Ax_subi, &Ax_subj, &Ax_valij);
     if (rescode != MSK_RES_OK) {
       return rescode;
     }
@@ -429,8 +471,10 @@ MSKrescodee MosekSolverProgram::AddLinearConstraintsFromBindings(
       constraint_dual_indices[i].index = num_linear_constraints + i;
     }
     dual_indices->emplace(binding, constraint_dual_indices);
+    num_linear_constraints += lb.rows();
   }
-  return rescode;
+  return MSK_putaijlist(task_, Ax_subi.size(), Ax_subi.data(), Ax_subj.data(),
+                        Ax_valij.data());
 }
 
 template <typename C>
@@ -71,9 +71,11 @@ double EvaluateCosts(const std::vector<double>& x, std::vector<double>& grad,
 
   for (auto const& binding : prog->GetAllCosts()) {
     int num_vars = binding.GetNumElements();
+    const std::vector<int> var_indices =
+        prog->FindDecisionVariableIndices(binding);
     this_x.resize(num_vars);
     for (int i = 0; i < num_vars; ++i) {
-      this_x(i) = tx(prog->FindDecisionVariableIndex(binding.variables()(i)));
+      this_x(i) = tx(var_indices[i]);
     }
 
     binding.evaluator()->Eval(this_x, &ty);
@@ -82,8 +84,7 @@ double EvaluateCosts(const std::vector<double>& x, std::vector<double>& grad,
     if (!grad.empty()) {
       if (ty(0).derivatives().size() > 0) {
         for (int j = 0; j < num_vars; ++j) {
-          const size_t vj_index =
-              prog->FindDecisionVariableIndex(binding.variables()(j));
+          const size_t vj_index = var_indices[j];
           grad[vj_index] += ty(0).derivatives()(vj_index);
         }
       }
@@ -1,5 +1,7 @@
 #include "drake/solvers/osqp_solver.h"
 
+#include <algorithm>
+#include <memory>
 #include <optional>
 #include <unordered_map>
 #include <vector>
@@ -127,7 +129,7 @@ void ParseLinearConstraints(
   // Loop over the linear constraints, stack them to get l, u and A.
   for (const auto& constraint : linear_constraints) {
     const std::vector<int> x_indices =
-        prog.FindDecisionVariableIndices(constraint.variables());
+        prog.FindDecisionVariableIndices(constraint);
     const std::vector<Eigen::Triplet<double>> Ai_triplets =
         math::SparseMatrixToTriplets(constraint.evaluator()->get_sparse_A());
     const Binding<Constraint> constraint_cast =
@@ -319,8 +321,40 @@ void SetDualSolution(
                                    constraint.evaluator()->num_constraints()));
   }
 }
+
+// Returns true iff `a` and `b` (which must be compressed) have the same size
+// and the same nonzero entries.
+bool HaveSameSparsity(const Eigen::SparseMatrix<c_float>& a,
+                      const Eigen::SparseMatrix<c_float>& b) {
+  return a.rows() == b.rows() && a.cols() == b.cols() &&
+         a.nonZeros() == b.nonZeros() &&
+         std::equal(a.outerIndexPtr(), a.outerIndexPtr() + a.cols() + 1,
+                    b.outerIndexPtr()) &&
+         std::equal(a.innerIndexPtr(), a.innerIndexPtr() + a.nonZeros(),
+                    b.innerIndexPtr());
+}
+
+// Returns true iff `a` and `b`, which have the same sparsity, have the same
+// nonzero values.
+bool HaveSameValues(const Eigen::SparseMatrix<c_float>& a,
+                    const Eigen::SparseMatrix<c_float>& b) {
+  return std::equal(a.valuePtr(), a.valuePtr() + a.nonZeros(), b.valuePtr());
+}
 }  // namespace
 
+struct OsqpSolver::Workspace {
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(Workspace)
+
+  Workspace() = default;
+  ~Workspace() { osqp_cleanup(work); }
+
+  OSQPWorkspace* work{nullptr};
+  // The options that `work` was set up with, and the current P and A.
+  SolverOptions options;
+  Eigen::SparseMatrix<c_float> P;
+  Eigen::SparseMatrix<c_float> A;
+};
+
 bool OsqpSolver::is_available() {
   return true;
 }
@@ -354,39 +388,103 @@ void OsqpSolver::DoSolve(const MathematicalProgram& prog,
   std::vector<c_float> l, u;
   ParseAllLinearConstraints(prog, &A_sparse, &l, &u, &constraint_start_row);
 
-  // Now pass the constraint and cost to osqp data.
-  OSQPData* data = nullptr;
-
-  // Populate data.
-  data = static_cast<OSQPData*>(c_malloc(sizeof(OSQPData)));
-
-  data->n = prog.num_vars();
-  data->m = A_sparse.rows();
-  data->P = EigenSparseToCSC(P_sparse);
-  data->q = q.data();
-  data->A = EigenSparseToCSC(A_sparse);
-  data->l = l.data();
-  data->u = u.data();
-
-  // Define Solver settings as default.
-  // Problem settings
-  OSQPSettings* settings =
-      static_cast<OSQPSettings*>(c_malloc(sizeof(OSQPSettings)));
-  osqp_set_default_settings(settings);
-
-  SetOsqpSolverSettings(merged_options, settings);
-
   // If any step fails, it will set the solution_result and skip other steps.
   std::optional<SolutionResult> solution_result;
 
-  // Setup workspace.
-  OSQPWorkspace* work = nullptr;
-  if (!solution_result) {
-    const c_int osqp_setup_err = osqp_setup(&work, data, settings);
+  // While reusing the workspace, only one program is solved at a time.
+  std::unique_lock<std::mutex> workspace_lock(workspace_mutex_,
+                                              std::defer_lock);
+  if (reuse_workspace_) {
+    workspace_lock.lock();
+  }
+  std::shared_ptr<Workspace> workspace;
+  if (reuse_workspace_ && workspace_ != nullptr &&
+      workspace_->options == merged_options &&
+      HaveSameSparsity(workspace_->P, P_sparse) &&
+      HaveSameSparsity(workspace_->A, A_sparse)) {
+    // Update the existing workspace in place. OSQP stores the nonzero values
+    // of P and A in the same (compressed column) order as Eigen. Updating P
+    // or A refactorizes the KKT system, so we only do so when their values
+    // have changed; updating q, l and u is cheap.
+    workspace = workspace_;
+    solver_details.reused_workspace = true;
+    OSQPWorkspace* work = workspace->work;
+    const bool P_changed = !HaveSameValues(workspace->P, P_sparse);
+    const bool A_changed = !HaveSameValues(workspace->A, A_sparse);
+    c_int update_err = 0;
+    if (P_changed && A_changed) {
+      update_err = osqp_update_P_A(work, P_sparse.valuePtr(), OSQP_NULL,
+                                   P_sparse.nonZeros(), A_sparse.valuePtr(),
+                                   OSQP_NULL, A_sparse.nonZeros());
+    } else if (P_changed) {
+      update_err = osqp_update_P(work, P_sparse.valuePtr(), OSQP_NULL,
+                                 P_sparse.nonZeros());
+    } else if (A_changed) {
+      update_err = osqp_update_A(work, A_sparse.valuePtr(), OSQP_NULL,
+                                 A_sparse.nonZeros());
+    }
+    if (update_err != 0 || osqp_update_lin_cost(work, q.data()) != 0 ||
+        osqp_update_bounds(work, l.data(), u.data()) != 0) {
+      solution_result = SolutionResult::kInvalidInput;
+    }
+    if (P_changed) {
+      workspace->P = std::move(P_sparse);
+    }
+    if (A_changed) {
+      workspace->A = std::move(A_sparse);
+    }
+  } else {
+    workspace_.reset();
+    workspace = std::make_shared<Workspace>();
+
+    // Now pass the constraint and cost to osqp data.
+    OSQPData* data = nullptr;
+
+    // Populate data.
+    data = static_cast<OSQPData*>(c_malloc(sizeof(OSQPData)));
+
+    data->n = prog.num_vars();
+    data->m = A_sparse.rows();
+    data->P = EigenSparseToCSC(P_sparse);
+    data->q = q.data();
+    data->A = EigenSparseToCSC(A_sparse);
+    data->l = l.data();
+    data->u = u.data();
+
+    // Define Solver settings as default.
+    // Problem settings
+    OSQPSettings* settings =
+        static_cast<OSQPSettings*>(c_malloc(sizeof(OSQPSettings)));
+    osqp_set_default_settings(settings);
+
+    SetOsqpSolverSettings(merged_options, settings);
+
+    // Setup workspace. OSQP copies the data and settings into the workspace.
+    const c_int osqp_setup_err =
+        osqp_setup(&workspace->work, data, settings);
     if (osqp_setup_err != 0) {
       solution_result = SolutionResult::kInvalidInput;
     }
+
+    c_free(data->P->x);
+    c_free(data->P->i);
+    c_free(data->P->p);
+    c_free(data->P);
+    c_free(data->A->x);
+    c_free(data->A->i);
+    c_free(data->A->p);
+    c_free(data->A);
+    c_free(data);
+    c_free(settings);
+
+    if (reuse_workspace_ && !solution_result) {
+      workspace->options = merged_options;
+      workspace->P = std::move(P_sparse);
+      workspace->A = std::move(A_sparse);
+      workspace_ = workspace;
+    }
   }
+  OSQPWorkspace* work = workspace->work;
 
   if (!solution_result && initial_guess.array().isFinite().all()) {
     const c_int osqp_warm_err = osqp_warm_start_x(
@@ -471,19 +569,6 @@ void OsqpSolver::DoSolve(const MathematicalProgram& prog,
     }
   }
   result->set_solution_result(solution_result.value());
-
-  // Clean workspace.
-  osqp_cleanup(work);
-  c_free(data->P->x);
-  c_free(data->P->i);
-  c_free(data->P->p);
-  c_free(data->P);
-  c_free(data->A->x);
-  c_free(data->A->i);
-  c_free(data->A->p);
-  c_free(data->A);
-  c_free(data);
-  c_free(settings);
 }
 
 }  // namespace solvers
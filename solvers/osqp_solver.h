@@ -1,5 +1,7 @@
 #pragma once
 
+#include <memory>
+#include <mutex>
 #include <string>
 
 #include "drake/common/drake_copyable.h"
@@ -35,6 +37,9 @@ struct OsqpSolverDetails {
   /// the problem. Notice that the order of the linear constraints are linear
   /// inequality first, and then linear equality constraints.
   Eigen::VectorXd y{};
+  /// Whether the workspace from the previous solve was updated in place,
+  /// rather than set up again. See OsqpSolver::set_reuse_workspace().
+  bool reused_workspace{false};
 };
 
 class OsqpSolver final : public SolverBase {
@@ -59,9 +64,41 @@ class OsqpSolver final : public SolverBase {
   // A using-declaration adds these methods into our class's Doxygen.
   using SolverBase::Solve;
 
+  /// Sets whether this solver instance keeps its OSQP workspace between calls
+  /// to Solve(). When enabled, and a program has the same number of variables
+  /// and constraints, the same sparsity pattern in its quadratic cost and
+  /// linear constraint matrices, and the same solver options as the previous
+  /// program solved by this instance, the workspace is updated in place using
+  /// OSQP's update functions instead of being set up again. This avoids
+  /// reallocating memory and re-analyzing the problem when solving a sequence
+  /// of programs that differ only in their coefficients, e.g., in model
+  /// predictive control; programs can update their coefficients in place
+  /// using the evaluators' UpdateCoefficients() methods. The KKT system is
+  /// only refactorized when the values in the quadratic cost or linear
+  /// constraint matrices change, so updating only the linear cost or the
+  /// constraint bounds is much cheaper than a new solve. OSQP also warm
+  /// starts from the previous solution when the "warm_start" option is set
+  /// (which is its default).
+  ///
+  /// While enabled, calls to Solve() on this instance are serialized.
+  /// Disabled by default.
+  void set_reuse_workspace(bool reuse_workspace);
+
+  /// Returns whether this solver instance keeps its OSQP workspace between
+  /// calls to Solve(). See set_reuse_workspace().
+  bool reuse_workspace() const { return reuse_workspace_; }
+
  private:
+  // The OSQP workspace (and the data needed to check whether it can be reused)
+  // from the previous call to Solve(), when reuse_workspace_ is set.
+  struct Workspace;
+
   void DoSolve(const MathematicalProgram&, const Eigen::VectorXd&,
                const SolverOptions&, MathematicalProgramResult*) const final;
+
+  bool reuse_workspace_{false};
+  mutable std::mutex workspace_mutex_;
+  mutable std::shared_ptr<Workspace> workspace_;
 };
 }  // namespace solvers
 }  // namespace drake
@@ -1,6 +1,11 @@
 #include "drake/solvers/scs_solver.h"
 
+#include <algorithm>
+#include <memory>
+#include <mutex>
 #include <optional>
+#include <stdexcept>
+#include <string>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -15,7 +20,6 @@
 #include <util.h>
 // clang-format on
 
-#include "drake/common/scope_exit.h"
 #include "drake/common/text_logging.h"
 #include "drake/math/eigen_sparse_triplet.h"
 #include "drake/math/quadratic_form.h"
@@ -463,8 +467,57 @@ void SetDualSolution(
                               rotated_lorentz_cone_dual);
   }
 }
+
+// Returns true iff the SCS matrices `a` and `b` (either of which may be null)
+// are the same, including their sparsity.
+bool HaveSameMatrix(const ScsMatrix* a, const ScsMatrix* b) {
+  if (a == nullptr || b == nullptr) {
+    return a == b;
+  }
+  if (a->m != b->m || a->n != b->n) {
+    return false;
+  }
+  const scs_int nnz = a->p[a->n];
+  return b->p[b->n] == nnz && std::equal(a->p, a->p + a->n + 1, b->p) &&
+         std::equal(a->i, a->i + nnz, b->i) &&
+         std::equal(a->x, a->x + nnz, b->x);
+}
+
+// Returns true iff the cones `a` and `b`, as set up by DoSolve(), are the same.
+bool HaveSameCones(const ScsCone& a, const ScsCone& b) {
+  return a.z == b.z && a.l == b.l && a.qsize == b.qsize &&
+         std::equal(a.q, a.q + a.qsize, b.q) && a.ssize == b.ssize &&
+         std::equal(a.s, a.s + a.ssize, b.s) && a.ep == b.ep;
+}
 }  // namespace
 
+struct ScsSolver::Workspace {
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(Workspace)
+
+  Workspace() = default;
+  ~Workspace() {
+    if (work != nullptr) {
+      scs_finish(work);
+    }
+    SCS(free_sol)(sol);
+    SCS(free_cone)(cone);
+    SCS(free_data)(data);
+    scs_free(stgs);
+  }
+
+  // The problem that `work` was set up with. SCS only updates b and c in
+  // place, so A, P and the cones must match for the workspace to be reused.
+  ScsCone* cone{nullptr};
+  ScsData* data{nullptr};
+  ScsSettings* stgs{nullptr};
+  // The options that `work` was set up with.
+  SolverOptions options;
+  ScsWork* work{nullptr};
+  // The solution of the latest solve, from which the next solve is warm
+  // started.
+  ScsSolution* sol{nullptr};
+};
+
 void ScsSolver::DoSolve(const MathematicalProgram& prog,
                         const Eigen::VectorXd& initial_guess,
                         const SolverOptions& merged_options,
@@ -474,10 +527,6 @@ void ScsSolver::DoSolve(const MathematicalProgram& prog,
         "ScsSolver doesn't support the feature of variable scaling.");
   }
 
-  // TODO(hongkai.dai): allow warm starting SCS with initial guess on
-  // primal/dual variables and primal residues.
-  unused(initial_guess);
-  // The initial guess for SCS is unused.
   // SCS solves the problem in this form
   // min 0.5xᵀPx + cᵀx
   // s.t A x + s = b
@@ -528,19 +577,17 @@ void ScsSolver::DoSolve(const MathematicalProgram& prog,
   // symmetric Hessian.
   std::vector<Eigen::Triplet<double>> P_upper_triplets;
 
+  // The new workspace owns the cone, problem data and settings, and frees them
+  // (together with their instantiated members) when it is destroyed: upon
+  // return from the DoSolve function, unless it is kept for reuse.
+  auto new_workspace = std::make_shared<Workspace>();
   // cone stores all the cones K in the problem.
-  ScsCone* cone = static_cast<ScsCone*>(scs_calloc(1, sizeof(ScsCone)));
-  ScsData* scs_problem_data =
+  ScsCone* cone = new_workspace->cone =
+      static_cast<ScsCone*>(scs_calloc(1, sizeof(ScsCone)));
+  ScsData* scs_problem_data = new_workspace->data =
       static_cast<ScsData*>(scs_calloc(1, sizeof(ScsData)));
-  ScsSettings* scs_stgs =
+  ScsSettings* scs_stgs = new_workspace->stgs =
       static_cast<ScsSettings*>(scs_calloc(1, sizeof(ScsSettings)));
-  // This guard will free cone, scs_problem_data, and scs_stgs (together with
-  // their instantiated members) upon return from the DoSolve function.
-  ScopeExit scs_free_guard([&cone, &scs_problem_data, &scs_stgs]() {
-    SCS(free_cone)(cone);
-    SCS(free_data)(scs_problem_data);
-    scs_free(scs_stgs);
-  });
 
   // Set the parameters to default values.
   scs_set_default_settings(scs_stgs);
@@ -673,22 +720,73 @@ void ScsSolver::DoSolve(const MathematicalProgram& prog,
       merged_options.GetOptionsInt(id());
   std::unordered_map<std::string, double> input_solver_options_double =
       merged_options.GetOptionsDouble(id());
+  const auto warm_start_option = input_solver_options_int.find("warm_start");
+  const bool warm_start_enabled =
+      warm_start_option == input_solver_options_int.end() ||
+      warm_start_option->second != 0;
   SetScsSettings(&input_solver_options_int,
                  merged_options.get_print_to_console(), scs_stgs);
   SetScsSettings(&input_solver_options_double, scs_stgs);
 
-  ScsInfo scs_info{0};
-
-  ScsSolution* scs_sol =
-      static_cast<ScsSolution*>(scs_calloc(1, sizeof(ScsSolution)));
-  ScopeExit sol_guard([&scs_sol]() {
-    SCS(free_sol)(scs_sol);
-  });
-
   ScsSolverDetails& solver_details =
       result->SetSolverDetailsType<ScsSolverDetails>();
-  solver_details.scs_status =
-      scs(scs_problem_data, cone, scs_stgs, scs_sol, &scs_info);
+
+  // While reusing the workspace, only one program is solved at a time.
+  std::unique_lock<std::mutex> workspace_lock(workspace_mutex_,
+                                              std::defer_lock);
+  if (reuse_workspace_) {
+    workspace_lock.lock();
+  }
+  std::shared_ptr<Workspace> workspace;
+  bool warm_start = false;
+  if (reuse_workspace_ && workspace_ != nullptr &&
+      workspace_->options == merged_options &&
+      workspace_->data->m == scs_problem_data->m &&
+      workspace_->data->n == scs_problem_data->n &&
+      HaveSameMatrix(workspace_->data->A, scs_problem_data->A) &&
+      HaveSameMatrix(workspace_->data->P, scs_problem_data->P) &&
+      HaveSameCones(*workspace_->cone, *cone)) {
+    // Only b and c have changed, so SCS keeps its factorization of the KKT
+    // system and warm starts from the previous solution.
+    workspace = workspace_;
+    solver_details.reused_workspace = true;
+    std::copy(b.begin(), b.end(), workspace->data->b);
+    std::copy(c.begin(), c.end(), workspace->data->c);
+    scs_update(workspace->work, workspace->data->b, workspace->data->c);
+    warm_start = true;
+  } else {
+    workspace_.reset();
+    workspace = std::move(new_workspace);
+    workspace->work = scs_init(scs_problem_data, cone, scs_stgs);
+    if (workspace->work == nullptr) {
+      throw std::runtime_error(
+          "ScsSolver: SCS failed to set up the problem (scs_init).");
+    }
+    workspace->sol =
+        static_cast<ScsSolution*>(scs_calloc(1, sizeof(ScsSolution)));
+    workspace->sol->x =
+        static_cast<scs_float*>(scs_calloc(num_x, sizeof(scs_float)));
+    workspace->sol->y =
+        static_cast<scs_float*>(scs_calloc(A_row_count, sizeof(scs_float)));
+    workspace->sol->s =
+        static_cast<scs_float*>(scs_calloc(A_row_count, sizeof(scs_float)));
+    if (initial_guess.array().isFinite().all()) {
+      // Warm start the primal variables of `prog` (but not the slack
+      // variables appended to x) from the initial guess.
+      std::copy(initial_guess.data(), initial_guess.data() + prog.num_vars(),
+                workspace->sol->x);
+      warm_start = true;
+    }
+    if (reuse_workspace_) {
+      workspace->options = merged_options;
+      workspace_ = workspace;
+    }
+  }
+  ScsSolution* scs_sol = workspace->sol;
+
+  ScsInfo scs_info{0};
+  solver_details.scs_status = scs_solve(workspace->work, scs_sol, &scs_info,
+                                        warm_start && warm_start_enabled);
 
   solver_details.iter = scs_info.iter;
   solver_details.primal_objective = scs_info.pobj;
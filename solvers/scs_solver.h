@@ -1,5 +1,7 @@
 #pragma once
 
+#include <memory>
+#include <mutex>
 #include <string>
 
 #include "drake/common/drake_copyable.h"
@@ -57,6 +59,9 @@ struct ScsSolverDetails {
   /// The primal equality constraint slack, namely
   /// Ax + s = b where x is the primal variable.
   Eigen::VectorXd s;
+  /// Whether the workspace from the previous solve was updated in place,
+  /// rather than set up again. See ScsSolver::set_reuse_workspace().
+  bool reused_workspace{false};
 };
 
 class ScsSolver final : public SolverBase {
@@ -84,9 +89,40 @@ class ScsSolver final : public SolverBase {
   // A using-declaration adds these methods into our class's Doxygen.
   using SolverBase::Solve;
 
+  /// Sets whether this solver instance keeps its SCS workspace between calls
+  /// to Solve(). When enabled, and a program has the same cones, the same
+  /// constraint matrix A and quadratic cost matrix P (both their sparsity and
+  /// their values), and the same solver options as the previous program
+  /// solved by this instance, only the vectors b and c of the existing
+  /// workspace are updated. This skips the factorization of the KKT system,
+  /// which dominates the setup time of large programs, e.g., when solving a
+  /// sequence of programs that differ only in their linear costs or
+  /// constraint bounds. The solve is then warm started from the previous
+  /// primal, dual and slack solution.
+  ///
+  /// Independently of this setting, SCS is warm started from the initial guess
+  /// of the primal variables when all of its entries are finite. Setting the
+  /// SCS option "warm_start" to 0 disables both kinds of warm start.
+  ///
+  /// While enabled, calls to Solve() on this instance are serialized.
+  /// Disabled by default.
+  void set_reuse_workspace(bool reuse_workspace);
+
+  /// Returns whether this solver instance keeps its SCS workspace between
+  /// calls to Solve(). See set_reuse_workspace().
+  bool reuse_workspace() const { return reuse_workspace_; }
+
  private:
+  // The SCS workspace (and the data needed to check whether it can be reused)
+  // from the previous call to Solve(), when reuse_workspace_ is set.
+  struct Workspace;
+
   void DoSolve(const MathematicalProgram&, const Eigen::VectorXd&,
                const SolverOptions&, MathematicalProgramResult*) const final;
+
+  bool reuse_workspace_{false};
+  mutable std::mutex workspace_mutex_;
+  mutable std::shared_ptr<Workspace> workspace_;
 };
 
 }  // namespace solvers
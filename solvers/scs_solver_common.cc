@@ -15,6 +15,14 @@ ScsSolver::ScsSolver()
 
 ScsSolver::~ScsSolver() = default;
 
+void ScsSolver::set_reuse_workspace(bool reuse_workspace) {
+  std::lock_guard<std::mutex> lock(workspace_mutex_);
+  reuse_workspace_ = reuse_workspace;
+  if (!reuse_workspace_) {
+    workspace_.reset();
+  }
+}
+
 SolverId ScsSolver::id() {
   static const never_destroyed<SolverId> singleton{"SCS"};
   return singleton.access();
@@ -368,7 +368,7 @@ void SdpaFreeFormat::AddLinearConstraintsHelper(
     const Binding<Constraint>& linear_constraint, bool is_equality_constraint,
     int* linear_constraint_slack_entry_in_X_count) {
   const std::vector<int> var_indices =
-      prog.FindDecisionVariableIndices(linear_constraint.variables());
+      prog.FindDecisionVariableIndices(linear_constraint);
   // Go through each row of the constraint.
   for (int i = 0; i < linear_constraint.evaluator()->num_constraints(); ++i) {
     const bool does_lower_equal_upper_in_this_row =
@@ -465,7 +465,7 @@ void SdpaFreeFormat::AddLinearMatrixInequalityConstraints(
   for (const auto& lmi_constraint :
        prog.linear_matrix_inequality_constraints()) {
     const std::vector<int> var_indices =
-        prog.FindDecisionVariableIndices(lmi_constraint.variables());
+        prog.FindDecisionVariableIndices(lmi_constraint);
     // Add the constraint that F1 * x1 + ... + Fn * xn - X_slack = -F0 and
     // X_slack is psd.
     const std::vector<Eigen::MatrixXd>& F = lmi_constraint.evaluator()->F();
@@ -501,7 +501,7 @@ void SdpaFreeFormat::AddLorentzConeConstraints(
     const int num_block_rows = lorentz_cone_constraint.evaluator()->A().rows();
     const int num_decision_vars = lorentz_cone_constraint.variables().rows();
     const std::vector<int> prog_vars_indices =
-        prog.FindDecisionVariableIndices(lorentz_cone_constraint.variables());
+        prog.FindDecisionVariableIndices(lorentz_cone_constraint);
 
     // Add the linear constraint that all the diagonal terms of the new block
     // matrix equals to z0.
@@ -1,5 +1,6 @@
 #include "drake/solvers/semidefinite_relaxation.h"
 
+#include <algorithm>
 #include <initializer_list>
 #include <limits>
 #include <string>
@@ -24,6 +25,73 @@ namespace {
 
 const double kInf = std::numeric_limits<double>::infinity();
 
+// Returns the maximal cliques (each sorted in increasing order) of a chordal
+// extension of the graph with the symmetric adjacency matrix `adjacent`.
+// The extension is the elimination graph of a greedy minimum-degree ordering:
+// eliminating a node connects all of its remaining neighbors, and each node
+// together with its remaining neighbors forms a clique of the extension.
+// Every maximal clique of the extension is one of these.
+std::vector<std::vector<int>> FindChordalExtensionCliques(
+    std::vector<std::vector<bool>> adjacent) {
+  const int n = ssize(adjacent);
+  std::vector<int> degree(n, 0);
+  for (int i = 0; i < n; ++i) {
+    degree[i] = std::count(adjacent[i].begin(), adjacent[i].end(), true);
+  }
+  std::vector<bool> eliminated(n, false);
+  std::vector<std::vector<int>> cliques;
+  for (int step = 0; step < n; ++step) {
+    int v = -1;
+    for (int i = 0; i < n; ++i) {
+      if (!eliminated[i] && (v < 0 || degree[i] < degree[v])) {
+        v = i;
+      }
+    }
+    std::vector<int> clique{v};
+    for (int j = 0; j < n; ++j) {
+      if (!eliminated[j] && adjacent[v][j]) {
+        clique.push_back(j);
+        --degree[j];
+      }
+    }
+    // Add the fill-in edges between the remaining neighbors of v.
+    for (int a = 1; a < ssize(clique); ++a) {
+      for (int b = a + 1; b < ssize(clique); ++b) {
+        const int i = clique[a];
+        const int j = clique[b];
+        if (!adjacent[i][j]) {
+          adjacent[i][j] = adjacent[j][i] = true;
+          ++degree[i];
+          ++degree[j];
+        }
+      }
+    }
+    eliminated[v] = true;
+    std::sort(clique.begin(), clique.end());
+    cliques.push_back(std::move(clique));
+    if (ssize(cliques.back()) == n - step) {
+      // All of the remaining nodes are in this clique.
+      break;
+    }
+  }
+  // Drop the cliques that are contained in a larger one.
+  std::vector<std::vector<int>> maximal_cliques;
+  for (int k = 0; k < ssize(cliques); ++k) {
+    bool is_maximal = true;
+    for (int l = 0; l < ssize(cliques) && is_maximal; ++l) {
+      if (l != k && ssize(cliques[l]) > ssize(cliques[k]) &&
+          std::includes(cliques[l].begin(), cliques[l].end(),
+                        cliques[k].begin(), cliques[k].end())) {
+        is_maximal = false;
+      }
+    }
+    if (is_maximal) {
+      maximal_cliques.push_back(cliques[k]);
+    }
+  }
+  return maximal_cliques;
+}
+
 }  // namespace
 
 std::unique_ptr<MathematicalProgram> MakeSemidefiniteRelaxation(
@@ -157,7 +225,7 @@ std::unique_ptr<MathematicalProgram> MakeSemidefiniteRelaxation(
     int constraint_idx = 0;
     for (const auto& binding : prog.bounding_box_constraints()) {
       const std::vector<int> indices =
-          prog.FindDecisionVariableIndices(binding.variables());
+          prog.FindDecisionVariableIndices(binding);
       for (int i = 0; i < binding.evaluator()->num_constraints(); ++i) {
         if (std::isfinite(binding.evaluator()->lower_bound()[i])) {
           triplet_list.push_back(
@@ -174,7 +242,7 @@ std::unique_ptr<MathematicalProgram> MakeSemidefiniteRelaxation(
 
     for (const auto& binding : prog.linear_constraints()) {
       const std::vector<int> indices =
-          prog.FindDecisionVariableIndices(binding.variables());
+          prog.FindDecisionVariableIndices(binding);
       // TODO(hongkai-dai): Consider using the SparseMatrix iterators.
       for (int i = 0; i < binding.evaluator()->num_constraints(); ++i) {
         if (std::isfinite(binding.evaluator()->lower_bound()[i])) {
@@ -222,8 +290,7 @@ std::unique_ptr<MathematicalProgram> MakeSemidefiniteRelaxation(
   // Note that this contains Ay=b since x contains 1.
   for (const auto& binding : prog.linear_equality_constraints()) {
     const int N = binding.variables().size();
-    const std::vector<int> indices =
-        prog.FindDecisionVariableIndices(binding.variables());
+    const std::vector<int> indices = prog.FindDecisionVariableIndices(binding);
     VectorX<Variable> vars(N + 1);
     // Add the constraints one column at a time:
     // Ayx_j - bx_j = 0.
@@ -260,5 +327,61 @@ std::unique_ptr<MathematicalProgram> MakeSemidefiniteRelaxation(
   return relaxation;
 }
 
+int DecomposePsdConstraintsByChordalSparsity(MathematicalProgram* prog) {
+  DRAKE_THROW_UNLESS(prog != nullptr);
+  // The number of times that each decision variable appears in the costs and
+  // constraints. An off-diagonal entry of a PSD matrix that is used by nothing
+  // else appears exactly twice (as Xᵢⱼ and Xⱼᵢ).
+  std::vector<int> num_uses(prog->num_vars(), 0);
+  for (const auto& binding : prog->GetAllCosts()) {
+    for (const int index : prog->FindDecisionVariableIndices(binding)) {
+      ++num_uses[index];
+    }
+  }
+  for (const auto& binding : prog->GetAllConstraints()) {
+    for (const int index : prog->FindDecisionVariableIndices(binding)) {
+      ++num_uses[index];
+    }
+  }
+
+  // Copy the bindings, since the loop adds and removes PSD constraints.
+  const std::vector<Binding<PositiveSemidefiniteConstraint>> psd_constraints =
+      prog->positive_semidefinite_constraints();
+  int num_decomposed = 0;
+  for (const auto& binding : psd_constraints) {
+    const int n = binding.evaluator()->matrix_rows();
+    // The variables are flattened in column-major order.
+    const Eigen::Map<const MatrixX<Variable>> X(binding.variables().data(), n,
+                                                n);
+    const std::vector<int> indices = prog->FindDecisionVariableIndices(binding);
+    std::vector<std::vector<bool>> adjacent(n, std::vector<bool>(n, false));
+    for (int j = 0; j < n; ++j) {
+      for (int i = j + 1; i < n; ++i) {
+        const bool is_unused =
+            X(i, j).equal_to(X(j, i)) && num_uses[indices[i + n * j]] == 2;
+        adjacent[i][j] = adjacent[j][i] = !is_unused;
+      }
+    }
+    const std::vector<std::vector<int>> cliques =
+        FindChordalExtensionCliques(std::move(adjacent));
+    if (ssize(cliques) <= 1) {
+      continue;
+    }
+    prog->RemoveConstraint(binding);
+    for (const std::vector<int>& clique : cliques) {
+      const int m = ssize(clique);
+      MatrixX<Variable> X_clique(m, m);
+      for (int a = 0; a < m; ++a) {
+        for (int b = 0; b < m; ++b) {
+          X_clique(a, b) = X(clique[a], clique[b]);
+        }
+      }
+      prog->AddPositiveSemidefiniteConstraint(X_clique);
+    }
+    ++num_decomposed;
+  }
+  return num_decomposed;
+}
+
 }  // namespace solvers
 }  // namespace drake
@@ -31,5 +31,36 @@ namespace solvers {
 std::unique_ptr<MathematicalProgram> MakeSemidefiniteRelaxation(
     const MathematicalProgram& prog);
 
+/** Replaces each positive semidefinite constraint X ≽ 0 in `prog` by the
+ constraints X[Cₖ, Cₖ] ≽ 0 on the principal submatrices of a few cliques Cₖ,
+ whenever the sparsity of the program allows it. Large sparse SDPs (e.g., the
+ ones built by MakeSemidefiniteRelaxation()) are often much faster to solve in
+ this form, since the cost of the interior point solvers grows quickly with
+ the size of the PSD blocks.
+
+ The off-diagonal entry Xᵢⱼ is considered to be used by the program if its
+ decision variable appears in any cost or constraint other than X ≽ 0 itself.
+ The used entries form the edges of a graph on the rows of X; the cliques Cₖ
+ are the maximal cliques of a chordal extension of that graph (found with a
+ greedy minimum-degree elimination ordering). By the positive semidefinite
+ completion theorem (Grone et al., 1984), the values of the used entries admit
+ a completion X ≽ 0 if and only if X[Cₖ, Cₖ] ≽ 0 for every k, so the optimal
+ cost is unchanged.
+
+ The unused entries of X that lie outside of every clique then no longer
+ appear in any cost or constraint, so their values in the solution are
+ arbitrary (and the solution matrix X need not be positive semidefinite,
+ although a positive semidefinite completion of it exists). Constraints whose
+ sparsity graph is already complete are left as they are.
+
+ Note that this removes the original bindings from `prog`, so they can no
+ longer be passed to `prog.RemoveConstraint()` nor be used to query the dual
+ solution.
+
+ @returns The number of positive semidefinite constraints that were
+ decomposed.
+ @throws std::exception if `prog` is nullptr. */
+int DecomposePsdConstraintsByChordalSparsity(MathematicalProgram* prog);
+
 }  // namespace solvers
 }  // namespace drake
@@ -19,8 +19,10 @@
 #include "snopt.h"
 
 #include "drake/common/scope_exit.h"
+#include "drake/common/ssize.h"
 #include "drake/common/text_logging.h"
 #include "drake/math/autodiff.h"
+#include "drake/solvers/binding_parallel_for.h"
 #include "drake/solvers/mathematical_program.h"
 
 // TODO(jwnimmer-tri) Eventually resolve these warnings.
@@ -231,11 +233,16 @@ class SnoptUserFunInfo {
   // Pointers to the parameters ('prog' and 'nonlinear_cost_gradient_indices')
   // are retained internally, so the supplied objects must have lifetimes longer
   // than the SnoptUserFuncInfo object.
-  explicit SnoptUserFunInfo(const MathematicalProgram* prog)
-      : this_pointer_as_int_array_(MakeThisAsInts()), prog_(*prog) {}
+  SnoptUserFunInfo(const MathematicalProgram* prog, Parallelism parallelism)
+      : this_pointer_as_int_array_(MakeThisAsInts()),
+        prog_(*prog),
+        parallelism_(parallelism) {}
 
   const MathematicalProgram& mathematical_program() const { return prog_; }
 
+  // The parallelism used to evaluate the costs and constraints.
+  Parallelism parallelism() const { return parallelism_; }
+
   std::set<int>& nonlinear_cost_gradient_indices() {
     return nonlinear_cost_gradient_indices_;
   }
@@ -302,6 +309,7 @@ class SnoptUserFunInfo {
 
   const std::array<int, kIntCount> this_pointer_as_int_array_;
   const MathematicalProgram& prog_;
+  const Parallelism parallelism_;
   std::set<int> nonlinear_cost_gradient_indices_;
   // When evaluating the nonlinear costs/constraints, the Binding could contain
   // duplicated variables. We need to sum up the entries in the gradient vector
@@ -351,45 +359,53 @@ class WorkspaceStorage {
   const SnoptUserFunInfo* const user_info_;
 };
 
-// Return the number of rows in the nonlinear constraint.
+// Evaluate a single nonlinear constraints. For generic Constraint,
+// QuadraticConstraint, LorentzConeConstraint, RotatedLorentzConeConstraint, we
+// call EvalWithSparseGradient function of the constraint directly. For some
+// other constraint, such as LinearComplementaryConstraint, we will evaluate its
+// nonlinear constraint differently, than its Eval function.
 template <typename C>
-int SingleNonlinearConstraintSize(const C& constraint) {
-  return constraint.num_constraints();
+void EvaluateSingleNonlinearConstraint(
+    const C& constraint, const Eigen::Ref<const Eigen::VectorXd>& x,
+    Eigen::VectorXd* y, Eigen::SparseMatrix<double>* dydx) {
+  constraint.EvalWithSparseGradient(x, y, dydx);
 }
 
 template <>
-int SingleNonlinearConstraintSize<LinearComplementarityConstraint>(
-    const LinearComplementarityConstraint& constraint) {
-  return 1;
+void EvaluateSingleNonlinearConstraint<LinearComplementarityConstraint>(
+    const LinearComplementarityConstraint& constraint,
+    const Eigen::Ref<const Eigen::VectorXd>& x, Eigen::VectorXd* y,
+    Eigen::SparseMatrix<double>* dydx) {
+  // y = xᵀ(Mx + q), hence ∂y/∂x = (Mx + q)ᵀ + xᵀM.
+  const Eigen::VectorXd Mx_plus_q = constraint.M() * x + constraint.q();
+  *y = Vector1d(x.dot(Mx_plus_q));
+  const Eigen::MatrixXd gradient =
+      Mx_plus_q.transpose() + x.transpose() * constraint.M();
+  *dydx = gradient.sparseView();
 }
 
-// Evaluate a single nonlinear constraints. For generic Constraint,
-// QuadraticConstraint, LorentzConeConstraint, RotatedLorentzConeConstraint, we
-// call Eval function of the constraint directly. For some other constraint,
-// such as LinearComplementaryConstraint, we will evaluate its nonlinear
-// constraint differently, than its Eval function.
+// The number of rows that a nonlinear constraint adds to SNOPT. This is the
+// number of constraints, except for the LinearComplementarityConstraint, which
+// is imposed as the single nonlinear constraint xᵀ(Mx + q) = 0.
 template <typename C>
-void EvaluateSingleNonlinearConstraint(
-    const C& constraint, const Eigen::Ref<const AutoDiffVecXd>& tx,
-    AutoDiffVecXd* ty) {
-  ty->resize(SingleNonlinearConstraintSize(constraint));
-  constraint.Eval(tx, ty);
+int GetNumNonlinearConstraintRows(const C& constraint) {
+  return constraint.num_constraints();
 }
 
 template <>
-void EvaluateSingleNonlinearConstraint<LinearComplementarityConstraint>(
-    const LinearComplementarityConstraint& constraint,
-    const Eigen::Ref<const AutoDiffVecXd>& tx, AutoDiffVecXd* ty) {
-  ty->resize(1);
-  (*ty)(0) = tx.dot(constraint.M().cast<AutoDiffXd>() * tx +
-                    constraint.q().cast<AutoDiffXd>());
+int GetNumNonlinearConstraintRows<LinearComplementarityConstraint>(
+    const LinearComplementarityConstraint&) {
+  return 1;
 }
 
 /*
  * Evaluate the value and gradients of nonlinear constraints.
  * The template type Binding is supposed to be a
  * MathematicalProgram::Binding<Constraint> type.
+ * Each binding writes to its own slices of F and G_w_duplicate, hence the
+ * bindings can be evaluated concurrently.
  * @param constraint_list A list of Binding<Constraint>
+ * @param parallelism The parallelism used to evaluate the bindings.
  * @param F The value of the constraints
  * @param G The value of the non-zero entries in the gradient
  * @param constraint_index The starting index of the constraint_list(0) in the
@@ -401,67 +417,76 @@ void EvaluateSingleNonlinearConstraint<LinearComplementarityConstraint>(
 template <typename C>
 void EvaluateNonlinearConstraints(
     const MathematicalProgram& prog,
-    const std::vector<Binding<C>>& constraint_list, double F[],
-    std::vector<double>* G_w_duplicate, size_t* constraint_index,
+    const std::vector<Binding<C>>& constraint_list, Parallelism parallelism,
+    double F[], std::vector<double>* G_w_duplicate, size_t* constraint_index,
     size_t* grad_index, const Eigen::VectorXd& xvec) {
   const auto& scale_map = prog.GetVariableScaling();
-  Eigen::VectorXd this_x;
-  for (const auto& binding : constraint_list) {
+  // The index of the first row in F, and of the first entry in G_w_duplicate,
+  // of each binding.
+  std::vector<size_t> F_start(constraint_list.size());
+  std::vector<size_t> G_start(constraint_list.size());
+  for (int k = 0; k < ssize(constraint_list); ++k) {
+    const auto& c = constraint_list[k].evaluator();
+    const int num_constraints = GetNumNonlinearConstraintRows(*c);
+    F_start[k] = *constraint_index;
+    G_start[k] = *grad_index;
+    *constraint_index += num_constraints;
+    if (c->gradient_sparsity_pattern().has_value()) {
+      *grad_index += c->gradient_sparsity_pattern()->size();
+    } else {
+      *grad_index += num_constraints * constraint_list[k].GetNumElements();
+    }
+  }
+
+  internal::BindingParallelFor(parallelism, constraint_list, [&](int k) {
+    const auto& binding = constraint_list[k];
     const auto& c = binding.evaluator();
-    int num_constraints = SingleNonlinearConstraintSize(*c);
 
     const int num_variables = binding.GetNumElements();
-    this_x.resize(num_variables);
-    // binding_var_indices[i] is the index of binding.variables()(i) in prog's
-    // decision variables.
-    std::vector<int> binding_var_indices(num_variables);
+    const std::vector<int> var_indices =
+        prog.FindDecisionVariableIndices(binding);
+    Eigen::VectorXd this_x(num_variables);
+    Eigen::VectorXd scale = Eigen::VectorXd::Ones(num_variables);
     for (int i = 0; i < num_variables; ++i) {
-      binding_var_indices[i] =
-          prog.FindDecisionVariableIndex(binding.variables()(i));
-      this_x(i) = xvec(binding_var_indices[i]);
-    }
-
-    // Scale this_x
-    auto this_x_scaled = math::InitializeAutoDiff(this_x);
-    for (int i = 0; i < num_variables; i++) {
-      auto it = scale_map.find(binding_var_indices[i]);
+      const int var_index = var_indices[i];
+      this_x(i) = xvec(var_index);
+      auto it = scale_map.find(var_index);
       if (it != scale_map.end()) {
-        this_x_scaled(i) *= it->second;
+        scale(i) = it->second;
       }
     }
 
-    AutoDiffVecXd ty;
-    ty.resize(num_constraints);
-    EvaluateSingleNonlinearConstraint(*c, this_x_scaled, &ty);
-
+    // The constraint is evaluated at the scaled variables, so by the chain
+    // rule each column of its gradient is multiplied by the variable's scale.
+    Eigen::VectorXd ty;
+    Eigen::SparseMatrix<double> dty_dx;
+    EvaluateSingleNonlinearConstraint(*c, this_x.cwiseProduct(scale), &ty,
+                                      &dty_dx);
+    const int num_constraints = ty.rows();
+    DRAKE_ASSERT(num_constraints == GetNumNonlinearConstraintRows(*c));
     for (int i = 0; i < num_constraints; i++) {
-      F[(*constraint_index)++] = ty(i).value();
+      F[F_start[k] + i] = ty(i);
     }
 
+    size_t G_index = G_start[k];
     const std::optional<std::vector<std::pair<int, int>>>&
         gradient_sparsity_pattern =
             binding.evaluator()->gradient_sparsity_pattern();
     if (gradient_sparsity_pattern.has_value()) {
       for (const auto& nonzero_entry : gradient_sparsity_pattern.value()) {
-        (*G_w_duplicate)[(*grad_index)++] =
-            ty(nonzero_entry.first).derivatives().size() > 0
-                ? ty(nonzero_entry.first).derivatives()(nonzero_entry.second)
-                : 0.0;
+        (*G_w_duplicate)[G_index++] =
+            dty_dx.coeff(nonzero_entry.first, nonzero_entry.second) *
+            scale(nonzero_entry.second);
       }
     } else {
+      const Eigen::MatrixXd gradient = dty_dx * scale.asDiagonal();
       for (int i = 0; i < num_constraints; i++) {
-        if (ty(i).derivatives().size() > 0) {
-          for (int j = 0; j < num_variables; ++j) {
-            (*G_w_duplicate)[(*grad_index)++] = ty(i).derivatives()(j);
-          }
-        } else {
-          for (int j = 0; j < num_variables; ++j) {
-            (*G_w_duplicate)[(*grad_index)++] = 0.0;
-          }
+        for (int j = 0; j < num_variables; ++j) {
+          (*G_w_duplicate)[G_index++] = gradient(i, j);
         }
       }
     }
-  }
+  });
 }
 
 // Find the variables with non-zero gradient in @p costs, and add the indices of
@@ -471,9 +496,8 @@ void GetNonlinearCostNonzeroGradientIndices(
     const MathematicalProgram& prog, const std::vector<Binding<C>>& costs,
     std::set<int>* cost_gradient_indices) {
   for (const auto& cost : costs) {
-    for (int i = 0; i < static_cast<int>(cost.GetNumElements()); ++i) {
-      cost_gradient_indices->insert(
-          prog.FindDecisionVariableIndex(cost.variables()(i)));
+    for (const int var_index : prog.FindDecisionVariableIndices(cost)) {
+      cost_gradient_indices->insert(var_index);
     }
   }
 }
@@ -500,42 +524,51 @@ std::set<int> GetAllNonlinearCostNonzeroGradientIndices(
 /*
  * Evaluates all the nonlinear costs, adds the value of the costs to
  * @p total_cost, and also adds the gradients to @p nonlinear_cost_gradients.
+ * The bindings are evaluated concurrently (as allowed by @p parallelism), but
+ * their values and gradients are always summed in the order of the bindings.
  */
 template <typename C>
 void EvaluateAndAddNonlinearCosts(
     const MathematicalProgram& prog,
-    const std::vector<Binding<C>>& nonlinear_costs, const Eigen::VectorXd& x,
-    double* total_cost, std::vector<double>* nonlinear_cost_gradients) {
+    const std::vector<Binding<C>>& nonlinear_costs, Parallelism parallelism,
+    const Eigen::VectorXd& x, double* total_cost,
+    std::vector<double>* nonlinear_cost_gradients) {
   const auto& scale_map = prog.GetVariableScaling();
-  for (const auto& binding : nonlinear_costs) {
+  // costs[k] is the value (and gradient) of nonlinear_costs[k].
+  std::vector<AutoDiffXd> costs(nonlinear_costs.size());
+  // binding_var_indices[k][i] is the index of nonlinear_costs[k].variables()(i)
+  // in prog's decision variables.
+  std::vector<std::vector<int>> binding_var_indices(nonlinear_costs.size());
+  internal::BindingParallelFor(parallelism, nonlinear_costs, [&](int k) {
+    const auto& binding = nonlinear_costs[k];
     const auto& obj = binding.evaluator();
     const int num_variables = binding.GetNumElements();
 
     Eigen::VectorXd this_x(num_variables);
-    // binding_var_indices[i] is the index of binding.variables()(i) in prog's
-    // decision variables.
-    std::vector<int> binding_var_indices(num_variables);
+    std::vector<int>& var_indices = binding_var_indices[k];
+    var_indices = prog.FindDecisionVariableIndices(binding);
     for (int i = 0; i < num_variables; ++i) {
-      binding_var_indices[i] =
-          prog.FindDecisionVariableIndex(binding.variables()(i));
-      this_x(i) = x(binding_var_indices[i]);
+      this_x(i) = x(var_indices[i]);
     }
     AutoDiffVecXd ty(1);
     // Scale this_x
     auto this_x_scaled = math::InitializeAutoDiff(this_x);
     for (int i = 0; i < num_variables; i++) {
-      auto it = scale_map.find(binding_var_indices[i]);
+      auto it = scale_map.find(var_indices[i]);
       if (it != scale_map.end()) {
         this_x_scaled(i) *= it->second;
       }
     }
     obj->Eval(this_x_scaled, &ty);
+    costs[k] = ty(0);
+  });
 
-    *total_cost += ty(0).value();
-    if (ty(0).derivatives().size() > 0) {
-      for (int i = 0; i < num_variables; ++i) {
-        (*nonlinear_cost_gradients)[binding_var_indices[i]] +=
-            ty(0).derivatives()(i);
+  for (int k = 0; k < ssize(nonlinear_costs); ++k) {
+    *total_cost += costs[k].value();
+    if (costs[k].derivatives().size() > 0) {
+      for (int i = 0; i < ssize(binding_var_indices[k]); ++i) {
+        (*nonlinear_cost_gradients)[binding_var_indices[k][i]] +=
+            costs[k].derivatives()(i);
       }
     }
   }
@@ -546,19 +579,20 @@ void EvaluateAndAddNonlinearCosts(
 // in array G. After calling this function, G[0], G[1], ..., G[grad_index-1]
 // will store the nonzero gradient of the cost.
 void EvaluateAllNonlinearCosts(
-    const MathematicalProgram& prog, const Eigen::VectorXd& xvec,
+    const MathematicalProgram& prog, Parallelism parallelism,
+    const Eigen::VectorXd& xvec,
     const std::set<int>& nonlinear_cost_gradient_indices, double F[],
     std::vector<double>* G_w_duplicate, size_t* grad_index) {
   std::vector<double> cost_gradients(prog.num_vars(), 0);
   // Quadratic costs.
-  EvaluateAndAddNonlinearCosts(prog, prog.quadratic_costs(), xvec, &(F[0]),
-                               &cost_gradients);
+  EvaluateAndAddNonlinearCosts(prog, prog.quadratic_costs(), parallelism, xvec,
+                               &(F[0]), &cost_gradients);
   // L2Norm costs.
-  EvaluateAndAddNonlinearCosts(prog, prog.l2norm_costs(), xvec, &(F[0]),
-                               &cost_gradients);
+  EvaluateAndAddNonlinearCosts(prog, prog.l2norm_costs(), parallelism, xvec,
+                               &(F[0]), &cost_gradients);
   // Generic costs.
-  EvaluateAndAddNonlinearCosts(prog, prog.generic_costs(), xvec, &(F[0]),
-                               &cost_gradients);
+  EvaluateAndAddNonlinearCosts(prog, prog.generic_costs(), parallelism, xvec,
+                               &(F[0]), &cost_gradients);
 
   for (const int cost_gradient_index : nonlinear_cost_gradient_indices) {
     (*G_w_duplicate)[*grad_index] = cost_gradients[cost_gradient_index];
@@ -589,7 +623,7 @@ void EvaluateCostsConstraints(const SnoptUserFunInfo& info, int n, double x[],
   }
   current_problem.EvalVisualizationCallbacks(xvec_scaled);
 
-  EvaluateAllNonlinearCosts(current_problem, xvec,
+  EvaluateAllNonlinearCosts(current_problem, info.parallelism(), xvec,
                             info.nonlinear_cost_gradient_indices(), F,
                             &G_w_duplicate, &grad_index);
 
@@ -598,20 +632,25 @@ void EvaluateCostsConstraints(const SnoptUserFunInfo& info, int n, double x[],
   size_t constraint_index = 1;
   // The gradient_index also starts after the cost.
   EvaluateNonlinearConstraints(
-      current_problem, current_problem.generic_constraints(), F, &G_w_duplicate,
-      &constraint_index, &grad_index, xvec);
+      current_problem, current_problem.generic_constraints(),
+      info.parallelism(), F, &G_w_duplicate, &constraint_index, &grad_index,
+      xvec);
   EvaluateNonlinearConstraints(
-      current_problem, current_problem.quadratic_constraints(), F,
-      &G_w_duplicate, &constraint_index, &grad_index, xvec);
+      current_problem, current_problem.quadratic_constraints(),
+      info.parallelism(), F, &G_w_duplicate, &constraint_index, &grad_index,
+      xvec);
   EvaluateNonlinearConstraints(
-      current_problem, current_problem.lorentz_cone_constraints(), F,
-      &G_w_duplicate, &constraint_index, &grad_index, xvec);
+      current_problem, current_problem.lorentz_cone_constraints(),
+      info.parallelism(), F, &G_w_duplicate, &constraint_index, &grad_index,
+      xvec);
   EvaluateNonlinearConstraints(
-      current_problem, current_problem.rotated_lorentz_cone_constraints(), F,
-      &G_w_duplicate, &constraint_index, &grad_index, xvec);
+      current_problem, current_problem.rotated_lorentz_cone_constraints(),
+      info.parallelism(), F, &G_w_duplicate, &constraint_index, &grad_index,
+      xvec);
   EvaluateNonlinearConstraints(
-      current_problem, current_problem.linear_complementarity_constraints(), F,
-      &G_w_duplicate, &constraint_index, &grad_index, xvec);
+      current_problem, current_problem.linear_complementarity_constraints(),
+      info.parallelism(), F, &G_w_duplicate, &constraint_index, &grad_index,
+      xvec);
 
   for (int i = 0; i < static_cast<int>(info.duplicate_to_G_index_map().size());
        ++i) {
@@ -705,7 +744,7 @@ void UpdateConstraintBoundsAndGradients(
     }
 
     const std::vector<int> bound_var_indices_in_prog =
-        prog.FindDecisionVariableIndices(binding.variables());
+        prog.FindDecisionVariableIndices(binding);
 
     const std::optional<std::vector<std::pair<int, int>>>&
         gradient_sparsity_pattern =
@@ -845,13 +884,14 @@ void UpdateLinearConstraint(const MathematicalProgram& prog,
     int n = LinearConstraintSize(*c);
 
     const Eigen::SparseMatrix<double> A_constraint = LinearEvaluatorA(*c);
+    const std::vector<int> var_indices =
+        prog.FindDecisionVariableIndices(binding);
 
     for (int k = 0; k < static_cast<int>(binding.GetNumElements()); ++k) {
       for (Eigen::SparseMatrix<double>::InnerIterator it(A_constraint, k); it;
            ++it) {
-        tripletList->emplace_back(
-            *linear_constraint_index + it.row(),
-            prog.FindDecisionVariableIndex(binding.variables()(k)), it.value());
+        tripletList->emplace_back(*linear_constraint_index + it.row(),
+                                  var_indices[k], it.value());
       }
     }
 
@@ -878,10 +918,11 @@ void SetVariableBounds(
     const auto& c = binding.evaluator();
     const auto& lb = c->lower_bound();
     const auto& ub = c->upper_bound();
+    const std::vector<int> var_indices =
+        prog.FindDecisionVariableIndices(binding);
 
     for (int k = 0; k < static_cast<int>(binding.GetNumElements()); ++k) {
-      const size_t vk_index =
-          prog.FindDecisionVariableIndex(binding.variables()(k));
+      const size_t vk_index = var_indices[k];
       (*xlow)[vk_index] = std::max(lb(k), (*xlow)[vk_index]);
       (*xupp)[vk_index] = std::min(ub(k), (*xupp)[vk_index]);
     }
@@ -890,9 +931,7 @@ void SetVariableBounds(
   // 0 <= x ⊥ Mx + q >= 0
   // we add the bounding box constraint x >= 0
   for (const auto& binding : prog.linear_complementarity_constraints()) {
-    for (int k = 0; k < static_cast<int>(binding.GetNumElements()); ++k) {
-      const size_t vk_index =
-          prog.FindDecisionVariableIndex(binding.variables()(k));
+    for (const int vk_index : prog.FindDecisionVariableIndices(binding)) {
       (*xlow)[vk_index] = std::max((*xlow)[vk_index], 0.0);
     }
   }
@@ -901,8 +940,10 @@ void SetVariableBounds(
                                         -1);
     std::vector<int> upper_dual_indices(binding.evaluator()->num_constraints(),
                                         -1);
+    const std::vector<int> var_indices =
+        prog.FindDecisionVariableIndices(binding);
     for (int k = 0; k < static_cast<int>(binding.GetNumElements()); ++k) {
-      const int idx = prog.FindDecisionVariableIndex(binding.variables()(k));
+      const int idx = var_indices[k];
       if ((*xlow)[idx] == binding.evaluator()->lower_bound()(k)) {
         lower_dual_indices[k] = idx;
       }
@@ -1120,11 +1161,12 @@ void SolveWithGivenOptions(
     const std::unordered_map<std::string, std::string>& snopt_options_string,
     const std::unordered_map<std::string, int>& snopt_options_int,
     const std::unordered_map<std::string, double>& snopt_options_double,
-    const std::string& print_file_common, MathematicalProgramResult* result) {
+    const std::string& print_file_common, Parallelism parallelism,
+    MathematicalProgramResult* result) {
   SnoptSolverDetails& solver_details =
       result->SetSolverDetailsType<SnoptSolverDetails>();
 
-  SnoptUserFunInfo user_info(&prog);
+  SnoptUserFunInfo user_info(&prog, parallelism);
   WorkspaceStorage storage(&user_info);
   const auto& scale_map = prog.GetVariableScaling();
 
@@ -1424,9 +1466,11 @@ void SnoptSolver::DoSolve(const MathematicalProgram& prog,
     int_options[kTimingLevel] = 0;
   }
 
+  const Parallelism parallelism(merged_options.get_max_threads().value_or(1));
   SolveWithGivenOptions(prog, initial_guess, merged_options.GetOptionsStr(id()),
                         int_options, merged_options.GetOptionsDouble(id()),
-                        merged_options.get_print_file_name(), result);
+                        merged_options.get_print_file_name(), parallelism,
+                        result);
 }
 
 bool SnoptSolver::is_bounded_lp_broken() {
@@ -1,14 +1,38 @@
 #include "drake/solvers/solve.h"
 
+#include <algorithm>
 #include <memory>
+#include <mutex>
+#include <unordered_map>
 
 #include "drake/common/nice_type_name.h"
+#include "drake/common/parallel_for.h"
+#include "drake/common/scope_exit.h"
 #include "drake/common/text_logging.h"
 #include "drake/solvers/choose_best_solver.h"
+#include "drake/solvers/gurobi_solver.h"
+#include "drake/solvers/ipopt_solver.h"
 #include "drake/solvers/solver_interface.h"
 
 namespace drake {
 namespace solvers {
+namespace internal {
+
+bool IsThreadSafe(const SolverId& id) {
+  // IPOPT's MUMPS linear solver is not thread-safe. Every GurobiSolver shares
+  // a single Gurobi environment, which must not be used by more than one
+  // thread at a time.
+  return id != IpoptSolver::id() && id != GurobiSolver::id();
+}
+
+}  // namespace internal
+
+namespace {
+
+using internal::IsThreadSafe;
+
+}  // namespace
+
 MathematicalProgramResult Solve(
     const MathematicalProgram& prog,
     const std::optional<Eigen::VectorXd>& initial_guess,
@@ -31,5 +55,82 @@ MathematicalProgramResult Solve(
 MathematicalProgramResult Solve(const MathematicalProgram& prog) {
   return Solve(prog, {}, {});
 }
+
+std::vector<MathematicalProgramResult> SolveInParallel(
+    const std::vector<const MathematicalProgram*>& progs,
+    const std::vector<std::optional<Eigen::VectorXd>>& initial_guesses,
+    const std::optional<SolverOptions>& solver_options,
+    Parallelism parallelism) {
+  const int num_progs = progs.size();
+  DRAKE_THROW_UNLESS(initial_guesses.empty() ||
+                     static_cast<int>(initial_guesses.size()) == num_progs);
+  for (const MathematicalProgram* prog : progs) {
+    DRAKE_THROW_UNLESS(prog != nullptr);
+  }
+
+  // Choose the solver for each program up front, so that we know which
+  // programs must be solved serially.
+  std::vector<SolverId> solver_ids;
+  solver_ids.reserve(num_progs);
+  std::vector<int> parallel_progs;
+  std::vector<int> serial_progs;
+  for (int i = 0; i < num_progs; ++i) {
+    solver_ids.push_back(ChooseBestSolver(*progs[i]));
+    if (IsThreadSafe(solver_ids.back())) {
+      parallel_progs.push_back(i);
+    } else {
+      serial_progs.push_back(i);
+    }
+  }
+  const int num_threads =
+      std::max(1, std::min<int>(parallelism.num_threads(),
+                                parallel_progs.size()));
+  drake::log()->debug(
+      "solvers::SolveInParallel will solve {} programs using {} threads, and "
+      "{} programs serially",
+      parallel_progs.size(), num_threads, serial_progs.size());
+
+  // Each concurrent solve borrows one of num_threads solver caches, each of
+  // which makes at most one instance of each solver.
+  std::vector<std::unordered_map<SolverId, std::unique_ptr<SolverInterface>>>
+      solvers(num_threads);
+  std::vector<int> available_solvers(num_threads);
+  for (int j = 0; j < num_threads; ++j) {
+    available_solvers[j] = j;
+  }
+  std::mutex available_solvers_mutex;
+  std::vector<MathematicalProgramResult> results(num_progs);
+  auto solve = [&](int i) {
+    int cache_index;
+    {
+      std::lock_guard<std::mutex> lock(available_solvers_mutex);
+      DRAKE_DEMAND(!available_solvers.empty());
+      cache_index = available_solvers.back();
+      available_solvers.pop_back();
+    }
+    ScopeExit return_cache([&]() {
+      std::lock_guard<std::mutex> lock(available_solvers_mutex);
+      available_solvers.push_back(cache_index);
+    });
+    std::unique_ptr<SolverInterface>& solver =
+        solvers[cache_index][solver_ids[i]];
+    if (solver == nullptr) {
+      solver = MakeSolver(solver_ids[i]);
+    }
+    const std::optional<Eigen::VectorXd> initial_guess =
+        initial_guesses.empty() ? std::nullopt : initial_guesses[i];
+    solver->Solve(*progs[i], initial_guess, solver_options, &results[i]);
+  };
+  const int num_parallel_progs = parallel_progs.size();
+  drake::internal::ParallelFor(
+      Parallelism(num_threads), num_parallel_progs, [&](int k) {
+        solve(parallel_progs[k]);
+      });
+  for (const int i : serial_progs) {
+    solve(i);
+  }
+  return results;
+}
+
 }  // namespace solvers
 }  // namespace drake
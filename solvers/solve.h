@@ -4,6 +4,7 @@
 #include <string>
 #include <vector>
 
+#include "drake/common/parallelism.h"
 #include "drake/solvers/mathematical_program.h"
 #include "drake/solvers/mathematical_program_result.h"
 #include "drake/solvers/solver_base.h"
@@ -42,5 +43,45 @@ MathematicalProgramResult Solve(
     const Eigen::Ref<const Eigen::VectorXd>& initial_guess);
 
 MathematicalProgramResult Solve(const MathematicalProgram& prog);
+
+/**
+ * Solves many independent optimization programs, concurrently using up to the
+ * given `parallelism`. Each program is solved as if by calling Solve(progs[i],
+ * initial_guesses[i], solver_options); in particular, the best solver is
+ * chosen separately for each program, and the results are returned in the
+ * same order as `progs`.
+ *
+ * Programs whose chosen solver is not thread-safe (currently, IpoptSolver,
+ * whose MUMPS linear solver uses global state, and GurobiSolver, whose
+ * instances share one environment) are solved one at a time on the calling
+ * thread, after the other programs have been solved in parallel.
+ *
+ * The programs may be solved concurrently, so their costs and constraints
+ * must be safe to evaluate from multiple threads at once. In particular,
+ * programs must not share evaluators that have mutable state (such as
+ * ExpressionConstraint), or evaluators that call back into Python.
+ *
+ * @param progs The programs to solve. None may be nullptr.
+ * @param initial_guesses Either empty (no initial guesses), or the initial
+ * guess for each program.
+ * @param solver_options The options used for every program, in addition to
+ * those stored in each program.
+ * @param parallelism The maximum number of programs to solve concurrently.
+ * @throws std::exception if initial_guesses is neither empty nor the same size
+ * as progs, or if any of the solves throws.
+ */
+std::vector<MathematicalProgramResult> SolveInParallel(
+    const std::vector<const MathematicalProgram*>& progs,
+    const std::vector<std::optional<Eigen::VectorXd>>& initial_guesses = {},
+    const std::optional<SolverOptions>& solver_options = std::nullopt,
+    Parallelism parallelism = Parallelism::Max());
+
+namespace internal {
+
+/* Returns true iff the solver with the given `id` may be used to solve
+different programs concurrently. */
+bool IsThreadSafe(const SolverId& id);
+
+}  // namespace internal
 }  // namespace solvers
 }  // namespace drake
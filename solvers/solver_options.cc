@@ -62,6 +62,17 @@ void SolverOptions::SetOption(CommonSolverOption key, OptionValue value) {
       common_solver_options_[key] = std::move(value);
       return;
     }
+    case CommonSolverOption::kMaxThreads: {
+      if (!std::holds_alternative<int>(value)) {
+        throw std::runtime_error(fmt::format(
+            "SolverOptions::SetOption support {} only with int value.", key));
+      }
+      if (std::get<int>(value) <= 0) {
+        throw std::runtime_error(fmt::format("{} must be positive", key));
+      }
+      common_solver_options_[key] = std::move(value);
+      return;
+    }
   }
   DRAKE_UNREACHABLE();
 }
@@ -114,6 +125,16 @@ bool SolverOptions::get_print_to_console() const {
   return result;
 }
 
+std::optional<int> SolverOptions::get_max_threads() const {
+  // N.B. SetOption sanity checks the value; we don't need to re-check here.
+  std::optional<int> result;
+  auto iter = common_solver_options_.find(CommonSolverOption::kMaxThreads);
+  if (iter != common_solver_options_.end()) {
+    result = std::get<int>(iter->second);
+  }
+  return result;
+}
+
 std::unordered_set<SolverId> SolverOptions::GetSolverIds() const {
   std::unordered_set<SolverId> result;
   for (const auto& pair : solver_options_double_) {
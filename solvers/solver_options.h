@@ -1,5 +1,6 @@
 #pragma once
 
+#include <optional>
 #include <ostream>
 #include <string>
 #include <unordered_map>
@@ -119,6 +120,10 @@ class SolverOptions {
    * the option has not been set. */
   bool get_print_to_console() const;
 
+  /** Returns the kMaxThreads set via CommonSolverOption, or else nullopt if
+   * the option has not been set. */
+  std::optional<int> get_max_threads() const;
+
   template <typename T>
   const std::unordered_map<std::string, T>& GetOptions(
       const SolverId& solver_id) const {
@@ -1,9 +1,15 @@
 #include "drake/solvers/sos_basis_generator.h"
 
+#include <algorithm>
+#include <random>
+#include <unordered_set>
 #include <vector>
 
 #include <Eigen/Core>
 
+#include "drake/common/hash.h"
+#include "drake/common/parallel_for.h"
+#include "drake/common/ssize.h"
 #include "drake/solvers/integer_inequality_solver.h"
 namespace drake {
 namespace solvers {
@@ -45,42 +51,48 @@ ExponentList GetPolynomialExponents(const drake::symbolic::Polynomial& p) {
   return exponents;
 }
 
-ExponentList VerticalStack(const ExponentList& A, const ExponentList& B) {
-  DRAKE_ASSERT(A.cols() == B.cols());
-  if (A.rows() == 0) {
-    return B;
-  }
-  if (B.rows() == 0) {
-    return A;
-  }
-  ExponentList Y(A.rows() + B.rows(), B.cols());
-  Y << A, B;
-  return Y;
-}
+// A hash set of exponents, each stored as a pointer to its first element in
+// some contiguous (row-major) array. The set does not own the exponents, so
+// the arrays must outlive the set and must not be modified while the set is in
+// use.
+class ExponentSet {
+ public:
+  ExponentSet(int num_vars, int expected_size)
+      : set_(expected_size, Hash{num_vars}, Equal{num_vars}) {}
 
-ExponentList PairwiseSums(const ExponentList& exponents) {
-  int n = exponents.rows();
-  ExponentList sums((n * n - n) / 2, exponents.cols());
-  int cnt = 0;
-  for (int i = 0; i < n; i++) {
-    // Note: counter starts at i+1 to omit a+b when a = b.
-    for (int j = i + 1; j < n; j++) {
-      sums.row(cnt++) = exponents.row(i) + exponents.row(j);
-    }
+  // Adds `exponent`. Returns false if it was already in the set.
+  bool insert(const int* exponent) { return set_.insert(exponent).second; }
+
+  bool contains(const int* exponent) const {
+    return set_.find(exponent) != set_.end();
   }
-  return sums;
-}
 
-// Returns true if the first num_rows of A contains B.
-bool ContainsExponent(const ExponentList& A, int num_rows, const Exponent& B) {
-  DRAKE_ASSERT(B.rows() == 1 && B.cols() == A.cols());
-  DRAKE_ASSERT((num_rows >= 0) && (num_rows <= A.rows()));
-  for (int i = 0; i < num_rows; i++) {
-    if (A.row(i) == B) {
-      return true;
+ private:
+  struct Hash {
+    size_t operator()(const int* exponent) const {
+      DefaultHasher hasher;
+      hasher(exponent, num_vars * sizeof(int));
+      return static_cast<size_t>(hasher);
+    }
+    int num_vars{};
+  };
+  struct Equal {
+    bool operator()(const int* a, const int* b) const {
+      return std::equal(a, a + num_vars, b);
     }
+    int num_vars{};
+  };
+
+  std::unordered_set<const int*, Hash, Equal> set_;
+};
+
+// Returns the set of the rows of `exponents`.
+ExponentSet MakeExponentSet(const ExponentList& exponents) {
+  ExponentSet set(exponents.cols(), exponents.rows());
+  for (int i = 0; i < exponents.rows(); i++) {
+    set.insert(exponents.row(i).data());
   }
-  return false;
+  return set;
 }
 
 /* Intersection(A, B) removes duplicate rows from B and any row that doesn't
@@ -88,11 +100,17 @@ bool ContainsExponent(const ExponentList& A, int num_rows, const Exponent& B) {
  * 1, 1; 1, 1;], it overwrites B with [1, 0; 1, 1]. */
 void Intersection(const ExponentList& A, ExponentList* B) {
   DRAKE_ASSERT(A.cols() == B->cols());
+  const ExponentSet set_of_A = MakeExponentSet(A);
+  // The rows of B that have been kept so far. Rows are only ever copied
+  // backwards, so each kept row stays in place once it has been kept.
+  ExponentSet kept(B->cols(), B->rows());
   int index = 0;
   for (int i = 0; i < B->rows(); i++) {
-    if ((ContainsExponent(A, A.rows(), B->row(i))) &&
-        !(ContainsExponent(*B, index, B->row(i)))) {
-      B->row(index++) = B->row(i);
+    if (set_of_A.contains(B->row(i).data()) &&
+        !kept.contains(B->row(i).data())) {
+      B->row(index) = B->row(i);
+      kept.insert(B->row(index).data());
+      index++;
     }
   }
   B->conservativeResize(index, Eigen::NoChange);
@@ -105,20 +123,45 @@ void Intersection(const ExponentList& A, ExponentList* B) {
  * Sum-of-Squares Programs in Practice Johan Löfberg, IEEE Transactions on
  * Automatic Control, 2009." After execution, all exponents of inconsistent
  * monomials are removed from exponents_of_basis.
+ *
+ * Rather than forming all of the pairwise products of the basis, the square
+ * 2α of each basis exponent α is checked by looking up 2α - β in the basis for
+ * every other basis exponent β.
  */
 void RemoveDiagonallyInconsistentExponents(const ExponentList& exponents_of_p,
                                            ExponentList* exponents_of_basis) {
+  const int num_vars = exponents_of_basis->cols();
+  const ExponentSet set_of_p = MakeExponentSet(exponents_of_p);
+  Exponent square(num_vars);
+  Exponent other(num_vars);
   while (1) {
-    int num_exponents = exponents_of_basis->rows();
-
-    ExponentList valid_squares =
-        VerticalStack(PairwiseSums(*exponents_of_basis), exponents_of_p);
-
-    (*exponents_of_basis) = (*exponents_of_basis) * 2;
-    Intersection(valid_squares, exponents_of_basis);
-    (*exponents_of_basis) = (*exponents_of_basis) / 2;
+    const int num_exponents = exponents_of_basis->rows();
+    const ExponentSet set_of_basis = MakeExponentSet(*exponents_of_basis);
+    std::vector<bool> is_consistent(num_exponents, false);
+    for (int i = 0; i < num_exponents; i++) {
+      square = 2 * exponents_of_basis->row(i);
+      if (set_of_p.contains(square.data())) {
+        is_consistent[i] = true;
+        continue;
+      }
+      for (int j = 0; j < num_exponents && !is_consistent[i]; j++) {
+        if (j != i) {
+          other = square - exponents_of_basis->row(j);
+          is_consistent[i] = set_of_basis.contains(other.data());
+        }
+      }
+    }
+    // Only compact the basis after the checks, since set_of_basis refers to
+    // its rows.
+    int index = 0;
+    for (int i = 0; i < num_exponents; i++) {
+      if (is_consistent[i]) {
+        exponents_of_basis->row(index++) = exponents_of_basis->row(i);
+      }
+    }
+    exponents_of_basis->conservativeResize(index, Eigen::NoChange);
 
-    if (exponents_of_basis->rows() == num_exponents) {
+    if (index == num_exponents) {
       break;
     }
   }
@@ -277,5 +320,15 @@ MonomialVector ConstructMonomialBasis(const drake::symbolic::Polynomial& p) {
   auto monomial_basis = ExponentsToMonomials(basis_exponents, vars);
   return monomial_basis;
 }
+
+std::vector<MonomialVector> ConstructMonomialBasis(
+    const std::vector<symbolic::Polynomial>& polynomials,
+    Parallelism parallelism) {
+  std::vector<MonomialVector> bases(polynomials.size());
+  drake::internal::ParallelFor(parallelism, ssize(polynomials), [&](int i) {
+    bases[i] = ConstructMonomialBasis(polynomials[i]);
+  });
+  return bases;
+}
 }  // namespace solvers
 }  // namespace drake
@@ -4,6 +4,7 @@
 
 #include <Eigen/Core>
 
+#include "drake/common/parallelism.h"
 #include "drake/common/symbolic/polynomial.h"
 
 namespace drake {
@@ -21,5 +22,18 @@ namespace solvers {
  */
 [[nodiscard]] drake::VectorX<symbolic::Monomial> ConstructMonomialBasis(
     const drake::symbolic::Polynomial& p);
+
+/**
+ * Constructs the monomial basis of each of the given polynomials, as in
+ * ConstructMonomialBasis(p). The polynomials are processed in parallel, using
+ * up to `parallelism.num_threads()` threads.
+ * @param polynomials The polynomials.
+ * @param parallelism How many threads to use.
+ * @return The i'th entry is the monomial basis of polynomials[i].
+ */
+[[nodiscard]] std::vector<drake::VectorX<symbolic::Monomial>>
+ConstructMonomialBasis(const std::vector<symbolic::Polynomial>& polynomials,
+                       Parallelism parallelism = Parallelism::Max());
+
 }  // namespace solvers
 }  // namespace drake
@@ -350,6 +350,20 @@ TEST_F(TestAggregateCostsAndConstraints, AggregateDuplicateVariables) {
       A, Vector3<symbolic::Variable>(x_[1], x_[0], x_[1]));
 }
 
+GTEST_TEST(HasDuplicateVariables, Test) {
+  const VectorX<symbolic::Variable> x =
+      symbolic::MakeVectorContinuousVariable(20, "x");
+  EXPECT_FALSE(internal::HasDuplicateVariables(x.head<0>()));
+  EXPECT_FALSE(internal::HasDuplicateVariables(x.head<3>()));
+  EXPECT_TRUE(internal::HasDuplicateVariables(
+      Vector3<symbolic::Variable>(x(0), x(1), x(0))));
+  // Enough variables to take the sorting path.
+  EXPECT_FALSE(internal::HasDuplicateVariables(x));
+  VectorX<symbolic::Variable> y = x;
+  y(17) = x(3);
+  EXPECT_TRUE(internal::HasDuplicateVariables(y));
+}
+
 GTEST_TEST(TestFindNonconvexQuadraticCost, Test) {
   MathematicalProgram prog;
   auto x = prog.NewContinuousVariables<2>();
@@ -0,0 +1,82 @@
+#include "drake/solvers/binding_parallel_for.h"
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace drake {
+namespace solvers {
+namespace internal {
+namespace {
+
+// An evaluator y = x, whose thread-safety is given at construction.
+class IdentityEvaluator : public EvaluatorBase {
+ public:
+  explicit IdentityEvaluator(bool is_thread_safe) : EvaluatorBase(1, 1) {
+    set_is_thread_safe(is_thread_safe);
+  }
+
+ private:
+  void DoEval(const Eigen::Ref<const Eigen::VectorXd>& x,
+              Eigen::VectorXd* y) const override {
+    *y = x;
+  }
+
+  void DoEval(const Eigen::Ref<const AutoDiffVecXd>& x,
+              AutoDiffVecXd* y) const override {
+    *y = x;
+  }
+
+  void DoEval(const Eigen::Ref<const VectorX<symbolic::Variable>>& x,
+              VectorX<symbolic::Expression>* y) const override {
+    *y = x.cast<symbolic::Expression>();
+  }
+};
+
+// Returns 20 bindings, of which every third one is not thread-safe.
+std::vector<Binding<EvaluatorBase>> MakeBindings() {
+  const symbolic::Variable x("x");
+  std::vector<Binding<EvaluatorBase>> bindings;
+  for (int i = 0; i < 20; ++i) {
+    bindings.emplace_back(std::make_shared<IdentityEvaluator>(i % 3 != 0),
+                          Vector1<symbolic::Variable>(x));
+  }
+  return bindings;
+}
+
+GTEST_TEST(BindingParallelForTest, Serial) {
+  const std::vector<Binding<EvaluatorBase>> bindings = MakeBindings();
+  std::vector<int> order;
+  BindingParallelFor(Parallelism::None(), bindings, [&order](int i) {
+    order.push_back(i);
+  });
+  ASSERT_EQ(order.size(), bindings.size());
+  for (int i = 0; i < static_cast<int>(order.size()); ++i) {
+    EXPECT_EQ(order[i], i);
+  }
+}
+
+GTEST_TEST(BindingParallelForTest, Parallel) {
+  const std::vector<Binding<EvaluatorBase>> bindings = MakeBindings();
+  std::vector<std::atomic<int>> num_calls(bindings.size());
+  std::vector<std::thread::id> thread_ids(bindings.size());
+  BindingParallelFor(Parallelism(4), bindings, [&](int i) {
+    ++num_calls[i];
+    thread_ids[i] = std::this_thread::get_id();
+  });
+  for (int i = 0; i < static_cast<int>(bindings.size()); ++i) {
+    EXPECT_EQ(num_calls[i], 1) << i;
+    // The bindings that are not thread-safe are done on the calling thread.
+    if (!bindings[i].evaluator()->is_thread_safe()) {
+      EXPECT_EQ(thread_ids[i], std::this_thread::get_id()) << i;
+    }
+  }
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace solvers
+}  // namespace drake
@@ -948,6 +948,40 @@ GTEST_TEST(MixedIntegerBranchAndBoundTest, TestSolve2) {
   }
 }
 
+GTEST_TEST(MixedIntegerBranchAndBoundTest, TestSolve2InParallel) {
+  // Branches on several nodes at a time, and finds the same optimal solution
+  // as TestSolve2.
+  auto prog = ConstructMathematicalProgram2();
+  const VectorDecisionVariable<5> x = prog->decision_variables();
+
+  MixedIntegerBranchAndBound::Options options{};
+  options.parallelism = Parallelism(3);
+  for (auto pick_variable : NonUserDefinedPickVariableMethods()) {
+    for (auto pick_node : NonUserDefinedPickNodeMethods()) {
+      MixedIntegerBranchAndBoundTester dut(*prog, GurobiSolver::id(), options);
+      dut.bnb()->SetNodeSelectionMethod(pick_node);
+      dut.bnb()->SetVariableSelectionMethod(pick_variable);
+
+      const SolutionResult solution_result = dut.bnb()->Solve();
+      EXPECT_EQ(solution_result, SolutionResult::kSolutionFound);
+      const double tol{1E-3};
+      EXPECT_NEAR(dut.bnb()->GetOptimalCost(), -13.0 / 3, tol);
+      Eigen::Matrix<double, 5, 1> x_expected0;
+      x_expected0 << 1, 1.0 / 3.0, 1, 1, 0;
+      EXPECT_TRUE(CompareMatrices(dut.bnb()->GetSolution(x, 0), x_expected0,
+                                  tol, MatrixCompareType::absolute));
+      EXPECT_TRUE(dut.HasConverged());
+    }
+  }
+
+  // The number of nodes branched in a round is limited by max_explored_nodes.
+  options.max_explored_nodes = 4;
+  MixedIntegerBranchAndBoundTester dut(*prog, GurobiSolver::id(), options);
+  dut.bnb()->Solve();
+  EXPECT_LE(dut.bnb()->root()->NumExploredNodesInSubtree(),
+            options.max_explored_nodes);
+}
+
 GTEST_TEST(MixedIntegerBranchAndBoundTest, TestSolve3) {
   auto prog = ConstructMathematicalProgram3();
   const VectorDecisionVariable<4> x = prog->decision_variables();
@@ -55,6 +55,23 @@ GTEST_TEST(TestConstraint, BoundSizeCheck) {
       "bound of size 2 and upper bound of size 3.");
 }
 
+GTEST_TEST(TestConstraint, IsThreadSafe) {
+  const Eigen::Matrix3d A = Eigen::Matrix3d::Identity();
+  const Eigen::Vector3d b = Eigen::Vector3d::Zero();
+  EXPECT_TRUE(LinearConstraint(A, b, b).is_thread_safe());
+  EXPECT_TRUE(LinearEqualityConstraint(A, b).is_thread_safe());
+  EXPECT_TRUE(BoundingBoxConstraint(b, b).is_thread_safe());
+  EXPECT_TRUE(QuadraticConstraint(A, b, 0, 1).is_thread_safe());
+  EXPECT_TRUE(LorentzConeConstraint(A, b).is_thread_safe());
+  EXPECT_TRUE(RotatedLorentzConeConstraint(A, b).is_thread_safe());
+  EXPECT_TRUE(LinearComplementarityConstraint(A, b).is_thread_safe());
+
+  const Variable x("x");
+  EXPECT_FALSE(ExpressionConstraint(Vector1<Expression>(sin(x)), Vector1d(0),
+                                    Vector1d(1))
+                   .is_thread_safe());
+}
+
 GTEST_TEST(TestConstraint, LinearConstraintSparse) {
   // Construct LinearConstraint with sparse A matrix.
   std::vector<Eigen::Triplet<double>> A_triplets;
@@ -92,6 +109,15 @@ GTEST_TEST(TestConstraint, LinearConstraintSparse) {
   EXPECT_TRUE(CompareMatrices(dut.GetDenseA(), A_sparse_new.toDense()));
   EXPECT_TRUE(CompareMatrices(dut.lower_bound(), lb));
   EXPECT_TRUE(CompareMatrices(dut.upper_bound(), ub));
+
+  // The sparse gradient is A, with the same sparsity.
+  const Eigen::Vector3d x(1, 2, 3);
+  Eigen::VectorXd y;
+  Eigen::SparseMatrix<double> dydx;
+  dut.EvalWithSparseGradient(x, &y, &dydx);
+  EXPECT_TRUE(CompareMatrices(y, A_sparse_new * x));
+  EXPECT_EQ(dydx.nonZeros(), A_sparse_new.nonZeros());
+  EXPECT_TRUE(CompareMatrices(dydx.toDense(), A_sparse_new.toDense()));
 }
 
 GTEST_TEST(TestConstraint, LinearEqualityConstraintSparse) {
@@ -77,6 +77,17 @@ auto make_vector(std::initializer_list<T> items) {
   return vector<std::decay_t<T>>(items);
 }
 
+GTEST_TEST(testCost, IsThreadSafe) {
+  const Eigen::Matrix2d A = Eigen::Matrix2d::Identity();
+  const Eigen::Vector2d b = Eigen::Vector2d::Zero();
+  EXPECT_TRUE(LinearCost(b).is_thread_safe());
+  EXPECT_TRUE(QuadraticCost(A, b).is_thread_safe());
+  EXPECT_TRUE(L2NormCost(A, b).is_thread_safe());
+
+  const symbolic::Variable x("x");
+  EXPECT_FALSE(ExpressionCost(sin(x)).is_thread_safe());
+}
+
 GTEST_TEST(testCost, testLinearCost) {
   const double tol = numeric_limits<double>::epsilon();
 
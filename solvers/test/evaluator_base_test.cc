@@ -208,6 +208,8 @@ GTEST_TEST(EvaluatorBaseTest, SetGradientSparsityPattern) {
             "SimpleEvaluator with 3 decision variables $(0) $(1) $(2)\n");
   // The gradient sparsity pattern should be unset at evaluator construction.
   EXPECT_FALSE(evaluator.gradient_sparsity_pattern().has_value());
+  // Evaluators are not thread-safe unless they say so.
+  EXPECT_FALSE(evaluator.is_thread_safe());
   // Now set the gradient sparsity pattern.
   evaluator.SetGradientSparsityPattern(
       {{0, 0}, {0, 1}, {0, 2}, {1, 0}, {1, 1}, {1, 2}});
@@ -236,6 +238,30 @@ GTEST_TEST(EvaluatorBaseTest, SetGradientSparsityPattern) {
   }
 }
 
+GTEST_TEST(EvaluatorBaseTest, EvalWithSparseGradient) {
+  SimpleEvaluator evaluator;
+  const Eigen::Vector3d x(1, 2, 3);
+  MatrixXd c(2, 3);
+  c << 1, 2, 3, 4, 5, 6;
+  VectorXd y;
+  Eigen::SparseMatrix<double> dydx;
+  // Without a sparsity pattern, every entry of the gradient is kept.
+  evaluator.EvalWithSparseGradient(x, &y, &dydx);
+  EXPECT_TRUE(CompareMatrices(y, c * x));
+  EXPECT_EQ(dydx.nonZeros(), 6);
+  EXPECT_TRUE(CompareMatrices(dydx.toDense(), c));
+
+  // With a sparsity pattern, only the entries in the pattern are kept.
+  evaluator.SetGradientSparsityPattern({{0, 1}, {1, 2}});
+  evaluator.EvalWithSparseGradient(x, &y, &dydx);
+  EXPECT_TRUE(CompareMatrices(y, c * x));
+  EXPECT_EQ(dydx.nonZeros(), 2);
+  MatrixXd dydx_expected = MatrixXd::Zero(2, 3);
+  dydx_expected(0, 1) = c(0, 1);
+  dydx_expected(1, 2) = c(1, 2);
+  EXPECT_TRUE(CompareMatrices(dydx.toDense(), dydx_expected));
+}
+
 /**
  * An evaluator with dynamic sized input.
  */
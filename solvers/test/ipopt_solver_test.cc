@@ -240,6 +240,11 @@ GTEST_TEST(IpoptSolverTest, TestL2NormCost) {
   TestL2NormCost(solver, 1e-6);
 }
 
+GTEST_TEST(IpoptSolverTest, ParallelEvaluation) {
+  IpoptSolver solver;
+  TestParallelEvaluation(solver);
+}
+
 /* Tests the solver's processing of the verbosity options. With multiple ways
  to request verbosity (common options and solver-specific options), we simply
  apply a smoke test that none of the means causes runtime errors. Note, we
@@ -413,6 +413,49 @@ GTEST_TEST(TestAddDecisionVariables, AddDecisionVariables1) {
   }
 }
 
+GTEST_TEST(TestMathematicalProgram, FindDecisionVariableIndicesOfBinding) {
+  MathematicalProgram prog;
+  const auto x = prog.NewContinuousVariables<4>("x");
+  const auto cost = prog.AddLinearCost(Eigen::Vector2d(1, 2), 0,
+                                       Vector2<Variable>(x(3), x(1)));
+  const auto constraint = prog.AddBoundingBoxConstraint(
+      0, 1, Vector3<Variable>(x(2), x(0), x(3)));
+  const std::vector<int> cost_indices({3, 1});
+  const std::vector<int> constraint_indices({2, 0, 3});
+  EXPECT_EQ(prog.FindDecisionVariableIndices(cost), cost_indices);
+  EXPECT_EQ(prog.FindDecisionVariableIndices(constraint), constraint_indices);
+  // The copies of the stored bindings, including converted ones, give the same
+  // indices.
+  EXPECT_EQ(prog.FindDecisionVariableIndices(prog.GetAllCosts()[0]),
+            cost_indices);
+  EXPECT_EQ(prog.FindDecisionVariableIndices(prog.GetAllConstraints()[0]),
+            constraint_indices);
+  // So does a binding that was never added to the program.
+  const Binding<LinearCost> not_added(cost.evaluator(),
+                                      Vector2<Variable>(x(0), x(2)));
+  EXPECT_EQ(prog.FindDecisionVariableIndices(not_added),
+            std::vector<int>({0, 2}));
+
+  // The clone has the same indices.
+  const auto clone = prog.Clone();
+  EXPECT_EQ(clone->FindDecisionVariableIndices(clone->linear_costs()[0]),
+            cost_indices);
+  EXPECT_EQ(clone->FindDecisionVariableIndices(cost), cost_indices);
+
+  // The indices cached by one program are not used by another program, even
+  // when the other program has the same variables in a different order.
+  MathematicalProgram other;
+  other.AddDecisionVariables(Vector4<Variable>(x(3), x(2), x(1), x(0)));
+  EXPECT_EQ(other.FindDecisionVariableIndices(cost), std::vector<int>({0, 2}));
+  const auto other_cost = other.AddCost(cost);
+  EXPECT_EQ(other.FindDecisionVariableIndices(other_cost),
+            std::vector<int>({0, 2}));
+  EXPECT_EQ(prog.FindDecisionVariableIndices(other_cost), cost_indices);
+  MathematicalProgram empty;
+  EXPECT_THROW(unused(empty.FindDecisionVariableIndices(cost)),
+               std::exception);
+}
+
 GTEST_TEST(TestAddDecisionVariables, AddVariable2) {
   // Call AddDecisionVariables on a program that has some existing variables.
   MathematicalProgram prog;
@@ -1,5 +1,7 @@
 #include "drake/solvers/test/optimization_examples.h"
 
+#include <cmath>
+
 #include <gtest/gtest.h>
 
 #include "drake/common/drake_assert.h"
@@ -871,6 +873,43 @@ void TestL2NormCost(const SolverInterface& solver, double tol) {
   EXPECT_NEAR(result.GetSolution(x[1]), 0.2, tol);
 }
 
+void TestParallelEvaluation(const SolverInterface& solver) {
+  // Project each of the points x.col(i) onto the intersection of the unit disk
+  // with the half plane x(1, i)³ ≥ -0.125. The costs and the quadratic
+  // constraints are thread-safe, while the generic (ExpressionConstraint)
+  // constraints are not.
+  MathematicalProgram prog;
+  const int num_points = 20;
+  const auto x = prog.NewContinuousVariables(2, num_points, "x");
+  for (int i = 0; i < num_points; ++i) {
+    const double angle = 2 * M_PI * i / num_points;
+    const Vector2d target(2 * std::cos(angle), 2 * std::sin(angle));
+    prog.AddQuadraticCost(2 * Matrix2d::Identity(), -2 * target, x.col(i));
+    prog.AddQuadraticConstraint(2 * Matrix2d::Identity(), Vector2d::Zero(),
+                                -kInf, 1, x.col(i));
+    prog.AddConstraint(x(1, i) * x(1, i) * x(1, i) >= -0.125);
+  }
+  EXPECT_GT(prog.generic_constraints().size(), 0);
+
+  const Eigen::VectorXd x_init = Eigen::VectorXd::Constant(2 * num_points, 0.1);
+  MathematicalProgramResult serial_result;
+  solver.Solve(prog, x_init, std::nullopt, &serial_result);
+  ASSERT_TRUE(serial_result.is_success());
+
+  SolverOptions options;
+  options.SetOption(CommonSolverOption::kMaxThreads, 4);
+  MathematicalProgramResult parallel_result;
+  solver.Solve(prog, x_init, options, &parallel_result);
+  ASSERT_TRUE(parallel_result.is_success());
+  // Each binding is evaluated identically no matter which thread evaluates
+  // it, and the costs are summed in the same order, so the solver takes the
+  // same steps.
+  EXPECT_TRUE(CompareMatrices(parallel_result.get_x_val(),
+                              serial_result.get_x_val(), 0));
+  EXPECT_EQ(parallel_result.get_optimal_cost(),
+            serial_result.get_optimal_cost());
+}
+
 class DummyConstraint : public Constraint {
   // 0.5x² + 0.5*y² + z² = 1
  public:
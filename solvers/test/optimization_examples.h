@@ -948,6 +948,11 @@ class EmptyGradientProblem {
 
 void TestL2NormCost(const SolverInterface& solver, double tol);
 
+// Solves a program with many independent costs and constraints, some of which
+// are thread-safe, both serially and with CommonSolverOption::kMaxThreads.
+// Checks that the solutions are identical.
+void TestParallelEvaluation(const SolverInterface& solver);
+
 std::set<CostForm> linear_cost_form();
 
 std::set<CostForm> quadratic_cost_form();
@@ -1,5 +1,9 @@
 #include "drake/solvers/osqp_solver.h"
 
+#include <limits>
+#include <utility>
+#include <vector>
+
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
@@ -220,6 +224,63 @@ GTEST_TEST(OsqpSolverTest, WarmStartPrimalOnly) {
   }
 }
 
+GTEST_TEST(OsqpSolverTest, ReuseWorkspace) {
+  // min (x₀ - a)² + (x₁ - 1)²
+  // s.t. x₀ + x₁ ≤ c, x₀ ≥ 0.
+  const double kInf = std::numeric_limits<double>::infinity();
+  MathematicalProgram prog;
+  auto x = prog.NewContinuousVariables<2>();
+  auto cost = prog.AddQuadraticErrorCost(Eigen::Matrix2d::Identity(),
+                                         Eigen::Vector2d(1, 1), x);
+  auto constraint = prog.AddLinearConstraint(Eigen::RowVector2d(1, 1),
+                                             -kInf, 1.0, x);
+  prog.AddBoundingBoxConstraint(0, kInf, x(0));
+
+  OsqpSolver dut;
+  EXPECT_FALSE(dut.reuse_workspace());
+  dut.set_reuse_workspace(true);
+  EXPECT_TRUE(dut.reuse_workspace());
+  if (dut.available()) {
+    SolverOptions solver_options;
+    solver_options.SetOption(OsqpSolver::id(), "eps_abs", 1e-8);
+    solver_options.SetOption(OsqpSolver::id(), "eps_rel", 1e-8);
+    // Update the coefficients in place, and compare the results to those of a
+    // fresh solver.
+    for (const auto& [a, c] : std::vector<std::pair<double, double>>{
+             {1, 1}, {2, 1}, {-1, 3}, {0.5, -1}}) {
+      cost.evaluator()->UpdateCoefficients(2 * Eigen::Matrix2d::Identity(),
+                                           Eigen::Vector2d(-2 * a, -2));
+      constraint.evaluator()->UpdateUpperBound(Vector1d(c));
+      MathematicalProgramResult result;
+      dut.Solve(prog, {}, solver_options, &result);
+      EXPECT_EQ(result.get_solver_details<OsqpSolver>().reused_workspace,
+                a != 1);
+      MathematicalProgramResult expected;
+      OsqpSolver().Solve(prog, {}, solver_options, &expected);
+      EXPECT_EQ(result.get_solution_result(),
+                expected.get_solution_result());
+      EXPECT_TRUE(
+          CompareMatrices(result.GetSolution(x), expected.GetSolution(x),
+                          1e-6));
+      EXPECT_NEAR(result.get_optimal_cost(), expected.get_optimal_cost(),
+                  1e-6);
+    }
+
+    // Changing the structure of the program sets up the workspace again, as
+    // does changing the options.
+    prog.AddLinearEqualityConstraint(x(0) == x(1));
+    MathematicalProgramResult result;
+    dut.Solve(prog, {}, solver_options, &result);
+    EXPECT_FALSE(result.get_solver_details<OsqpSolver>().reused_workspace);
+    EXPECT_TRUE(result.is_success());
+    dut.Solve(prog, {}, {}, &result);
+    EXPECT_FALSE(result.get_solver_details<OsqpSolver>().reused_workspace);
+    dut.Solve(prog, {}, {}, &result);
+    EXPECT_TRUE(result.get_solver_details<OsqpSolver>().reused_workspace);
+    EXPECT_NEAR(result.GetSolution(x(0)), result.GetSolution(x(1)), 1e-6);
+  }
+}
+
 /* Tests the solver's processing of the verbosity options. With multiple ways
  to request verbosity (common options and solver-specific options), we simply
  apply a smoke test that none of the means causes runtime errors. Note, we
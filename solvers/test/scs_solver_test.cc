@@ -1,5 +1,9 @@
 #include "drake/solvers/scs_solver.h"
 
+#include <limits>
+#include <utility>
+#include <vector>
+
 #include <gtest/gtest.h>
 
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
@@ -482,6 +486,73 @@ GTEST_TEST(TestScs, TestNonconvexQP) {
   }
 }
 
+GTEST_TEST(TestScs, ReuseWorkspace) {
+  // min aᵀx
+  // s.t. ‖x‖₂ ≤ 1, x₀ ≥ c.
+  const double kInf = std::numeric_limits<double>::infinity();
+  MathematicalProgram prog;
+  auto x = prog.NewContinuousVariables<2>();
+  auto cost = prog.AddLinearCost(Eigen::Vector2d(1, 1), 0, x);
+  prog.AddLorentzConeConstraint(
+      Vector3<symbolic::Expression>(1, x(0), x(1)));
+  auto constraint = prog.AddLinearConstraint(Eigen::RowVector2d(1, 0), -1,
+                                             kInf, x);
+
+  ScsSolver dut;
+  EXPECT_FALSE(dut.reuse_workspace());
+  dut.set_reuse_workspace(true);
+  EXPECT_TRUE(dut.reuse_workspace());
+  if (dut.available()) {
+    // Update the coefficients in place, and compare the results to those of a
+    // fresh solver.
+    for (const auto& [a, c] :
+         std::vector<std::pair<Eigen::Vector2d, double>>{
+             {Eigen::Vector2d(1, 1), -1},
+             {Eigen::Vector2d(2, -1), -1},
+             {Eigen::Vector2d(-1, 1), -0.5},
+             {Eigen::Vector2d(1, 0), 0.2}}) {
+      cost.evaluator()->UpdateCoefficients(a);
+      constraint.evaluator()->UpdateLowerBound(Vector1d(c));
+      MathematicalProgramResult result;
+      dut.Solve(prog, {}, {}, &result);
+      EXPECT_EQ(result.get_solver_details<ScsSolver>().reused_workspace,
+                a != Eigen::Vector2d(1, 1));
+      MathematicalProgramResult expected;
+      ScsSolver().Solve(prog, {}, {}, &expected);
+      EXPECT_EQ(result.get_solution_result(),
+                expected.get_solution_result());
+      EXPECT_TRUE(
+          CompareMatrices(result.GetSolution(x), expected.GetSolution(x),
+                          kTol));
+      EXPECT_NEAR(result.get_optimal_cost(), expected.get_optimal_cost(),
+                  kTol);
+
+      // Warm starting a fresh solver from the solution gives the same
+      // solution.
+      MathematicalProgramResult warm_started;
+      ScsSolver().Solve(prog, expected.GetSolution(x), {}, &warm_started);
+      EXPECT_TRUE(warm_started.is_success());
+      EXPECT_TRUE(CompareMatrices(warm_started.GetSolution(x),
+                                  expected.GetSolution(x), kTol));
+    }
+
+    // Changing the structure of the program sets up the workspace again, as
+    // does changing the options.
+    prog.AddLinearEqualityConstraint(x(0) == x(1));
+    MathematicalProgramResult result;
+    dut.Solve(prog, {}, {}, &result);
+    EXPECT_FALSE(result.get_solver_details<ScsSolver>().reused_workspace);
+    EXPECT_TRUE(result.is_success());
+    SolverOptions solver_options;
+    solver_options.SetOption(ScsSolver::id(), "max_iters", 10000);
+    dut.Solve(prog, {}, solver_options, &result);
+    EXPECT_FALSE(result.get_solver_details<ScsSolver>().reused_workspace);
+    dut.Solve(prog, {}, solver_options, &result);
+    EXPECT_TRUE(result.get_solver_details<ScsSolver>().reused_workspace);
+    EXPECT_NEAR(result.GetSolution(x(0)), result.GetSolution(x(1)), kTol);
+  }
+}
+
 GTEST_TEST(TestScs, TestVerbose) {
   // This is a code coverage test, not a functional test. If the code that
   // handles verbosity options has a segfault or always throws an exception,
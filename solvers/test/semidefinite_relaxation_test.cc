@@ -1,5 +1,8 @@
 #include "drake/solvers/semidefinite_relaxation.h"
 
+#include <algorithm>
+#include <vector>
+
 #include <gtest/gtest.h>
 
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
@@ -308,6 +311,86 @@ GTEST_TEST(MakeSemidefiniteRelaxationTest, QuadraticConstraint2) {
             1.0);
 }
 
+namespace {
+// Returns the sizes of the PSD constraints of `prog`, in increasing order.
+std::vector<int> GetPsdConstraintSizes(const MathematicalProgram& prog) {
+  std::vector<int> sizes;
+  for (const auto& binding : prog.positive_semidefinite_constraints()) {
+    sizes.push_back(binding.evaluator()->matrix_rows());
+  }
+  std::sort(sizes.begin(), sizes.end());
+  return sizes;
+}
+}  // namespace
+
+GTEST_TEST(DecomposePsdConstraintsByChordalSparsityTest, Dense) {
+  MathematicalProgram prog;
+  const auto X = prog.NewSymmetricContinuousVariables<3>("X");
+  prog.AddPositiveSemidefiniteConstraint(X);
+  // Every entry is used by the cost.
+  prog.AddLinearCost(X.cast<symbolic::Expression>().sum());
+  EXPECT_EQ(DecomposePsdConstraintsByChordalSparsity(&prog), 0);
+  EXPECT_EQ(GetPsdConstraintSizes(prog), std::vector<int>({3}));
+}
+
+GTEST_TEST(DecomposePsdConstraintsByChordalSparsityTest, Tridiagonal) {
+  MathematicalProgram prog;
+  const auto X = prog.NewSymmetricContinuousVariables<5>("X");
+  prog.AddPositiveSemidefiniteConstraint(X);
+  prog.AddLinearCost(X.cast<symbolic::Expression>().trace());
+  for (int i = 0; i < 4; ++i) {
+    prog.AddBoundingBoxConstraint(-1, 1, X(i + 1, i));
+  }
+  EXPECT_EQ(DecomposePsdConstraintsByChordalSparsity(&prog), 1);
+  EXPECT_EQ(GetPsdConstraintSizes(prog), std::vector<int>({2, 2, 2, 2}));
+  // Every used entry is still constrained.
+  for (int i = 0; i < 4; ++i) {
+    bool found = false;
+    for (const auto& binding : prog.positive_semidefinite_constraints()) {
+      for (const Variable& var : binding.variables()) {
+        found = found || var.equal_to(X(i + 1, i));
+      }
+    }
+    EXPECT_TRUE(found) << i;
+  }
+  // Decomposing again does nothing.
+  EXPECT_EQ(DecomposePsdConstraintsByChordalSparsity(&prog), 0);
+}
+
+GTEST_TEST(DecomposePsdConstraintsByChordalSparsityTest, Cycle) {
+  // The sparsity graph is the cycle 0-1-2-3-0, whose chordal extension has
+  // one chord and two cliques of size 3.
+  MathematicalProgram prog;
+  const auto X = prog.NewSymmetricContinuousVariables<4>("X");
+  prog.AddPositiveSemidefiniteConstraint(X);
+  prog.AddLinearEqualityConstraint(X(0, 1) + X(1, 2) + X(2, 3) + X(3, 0) == 1);
+  EXPECT_EQ(DecomposePsdConstraintsByChordalSparsity(&prog), 1);
+  EXPECT_EQ(GetPsdConstraintSizes(prog), std::vector<int>({3, 3}));
+}
+
+GTEST_TEST(DecomposePsdConstraintsByChordalSparsityTest, SharedEntries) {
+  // The off-diagonal entries of X shared with Y are used, even though no cost
+  // nor other constraint touches them.
+  MathematicalProgram prog;
+  const auto X = prog.NewSymmetricContinuousVariables<3>("X");
+  prog.AddPositiveSemidefiniteConstraint(X);
+  MatrixX<Variable> Y = X;
+  Y(2, 2) = prog.NewContinuousVariables<1>("y")(0);
+  prog.AddPositiveSemidefiniteConstraint(Y);
+  EXPECT_EQ(DecomposePsdConstraintsByChordalSparsity(&prog), 0);
+  EXPECT_EQ(GetPsdConstraintSizes(prog), std::vector<int>({3, 3}));
+
+  // With no off-diagonal entry in use, each diagonal entry is a clique.
+  MathematicalProgram prog2;
+  const auto Z = prog2.NewSymmetricContinuousVariables<3>("Z");
+  prog2.AddPositiveSemidefiniteConstraint(Z);
+  EXPECT_EQ(DecomposePsdConstraintsByChordalSparsity(&prog2), 1);
+  EXPECT_EQ(GetPsdConstraintSizes(prog2), std::vector<int>({1, 1, 1}));
+
+  DRAKE_EXPECT_THROWS_MESSAGE(DecomposePsdConstraintsByChordalSparsity(nullptr),
+                              ".*prog != nullptr.*");
+}
+
 }  // namespace internal
 }  // namespace solvers
 }  // namespace drake
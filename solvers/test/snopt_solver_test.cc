@@ -584,6 +584,11 @@ GTEST_TEST(SnoptSolverTest, TestL2NormCost) {
   TestL2NormCost(solver, 1e-6);
 }
 
+GTEST_TEST(SnoptSolverTest, ParallelEvaluation) {
+  SnoptSolver solver;
+  TestParallelEvaluation(solver);
+}
+
 TEST_P(TestEllipsoidsSeparation, TestSOCP) {
   SnoptSolver snopt_solver;
   if (snopt_solver.available()) {
@@ -56,5 +56,60 @@ GTEST_TEST(SolveTest, TestInitialGuessAndOptions) {
     EXPECT_NEAR(result.GetSolution(x)(0), vars_init(0), 1E-6);
   }
 }
+
+GTEST_TEST(SolveTest, SolveInParallel) {
+  // A mix of programs: linear systems, quadratic programs, and nonlinear
+  // programs (which may be solved by IPOPT, and so serially).
+  std::vector<std::unique_ptr<MathematicalProgram>> progs;
+  std::vector<const MathematicalProgram*> prog_ptrs;
+  std::vector<std::optional<Eigen::VectorXd>> initial_guesses;
+  for (int i = 0; i < 30; ++i) {
+    auto prog = std::make_unique<MathematicalProgram>();
+    auto x = prog->NewContinuousVariables<2>();
+    switch (i % 3) {
+      case 0: {
+        prog->AddLinearEqualityConstraint(Eigen::Matrix2d::Identity(),
+                                          Eigen::Vector2d(i, 2), x);
+        break;
+      }
+      case 1: {
+        prog->AddQuadraticErrorCost(Eigen::Matrix2d::Identity(),
+                                    Eigen::Vector2d(i, 1), x);
+        prog->AddBoundingBoxConstraint(0, 10, x);
+        break;
+      }
+      case 2: {
+        prog->AddCost(pow(x(0) - i, 2) + pow(x(1) - 1, 2));
+        prog->AddConstraint(x(0) * x(1) >= 0.5);
+        break;
+      }
+    }
+    initial_guesses.push_back(Eigen::Vector2d(i, 1));
+    prog_ptrs.push_back(prog.get());
+    progs.push_back(std::move(prog));
+  }
+
+  // The results match those of Solve(), in serial and in parallel.
+  for (const Parallelism parallelism : {Parallelism::None(), Parallelism(2)}) {
+    const std::vector<MathematicalProgramResult> results =
+        SolveInParallel(prog_ptrs, initial_guesses, std::nullopt, parallelism);
+    ASSERT_EQ(results.size(), progs.size());
+    for (int i = 0; i < static_cast<int>(progs.size()); ++i) {
+      const MathematicalProgramResult expected =
+          Solve(*progs[i], initial_guesses[i], std::nullopt);
+      EXPECT_EQ(results[i].get_solver_id(), expected.get_solver_id());
+      EXPECT_EQ(results[i].is_success(), expected.is_success());
+      EXPECT_TRUE(
+          CompareMatrices(results[i].get_x_val(), expected.get_x_val(), 1e-6));
+    }
+  }
+
+  // Initial guesses are optional.
+  EXPECT_EQ(SolveInParallel(prog_ptrs).size(), progs.size());
+
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      SolveInParallel(prog_ptrs, {Eigen::Vector2d::Zero()}),
+      ".*initial_guesses.*");
+}
 }  // namespace solvers
 }  // namespace drake
@@ -12,6 +12,7 @@ GTEST_TEST(SolverOptionsTest, SetGetOption) {
   EXPECT_EQ(to_string(dut), "{SolverOptions empty}");
   EXPECT_EQ(dut.get_print_file_name(), "");
   EXPECT_EQ(dut.get_print_to_console(), false);
+  EXPECT_EQ(dut.get_max_threads(), std::nullopt);
 
   const SolverId id1("id1");
   const SolverId id2("id2");
@@ -25,9 +26,11 @@ GTEST_TEST(SolverOptionsTest, SetGetOption) {
 
   dut.SetOption(CommonSolverOption::kPrintFileName, "foo.txt");
   dut.SetOption(CommonSolverOption::kPrintToConsole, 1);
+  dut.SetOption(CommonSolverOption::kMaxThreads, 4);
 
   EXPECT_EQ(to_string(dut),
             "{SolverOptions,"
+            " CommonSolverOption::kMaxThreads=4,"
             " CommonSolverOption::kPrintFileName=foo.txt,"
             " CommonSolverOption::kPrintToConsole=1,"
             " id1:some_before=1.2,"
@@ -37,6 +40,7 @@ GTEST_TEST(SolverOptionsTest, SetGetOption) {
             " id2:some_string=foo}");
   EXPECT_EQ(dut.get_print_file_name(), "foo.txt");
   EXPECT_EQ(dut.get_print_to_console(), true);
+  EXPECT_EQ(dut.get_max_threads(), 4);
 
   const std::unordered_map<CommonSolverOption,
                            std::variant<double, int, std::string>>
@@ -147,6 +151,12 @@ GTEST_TEST(SolverOptionsTest, SetOptionError) {
   DRAKE_EXPECT_THROWS_MESSAGE(
       solver_options.SetOption(CommonSolverOption::kPrintToConsole, 2),
       "kPrintToConsole expects value either 0 or 1");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      solver_options.SetOption(CommonSolverOption::kMaxThreads, 1.0),
+      "SolverOptions::SetOption support kMaxThreads only with int value.");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      solver_options.SetOption(CommonSolverOption::kMaxThreads, 0),
+      "kMaxThreads must be positive");
 }
 }  // namespace solvers
 }  // namespace drake
@@ -1,5 +1,7 @@
 #include "drake/solvers/sos_basis_generator.h"
 
+#include <vector>
+
 #include <gtest/gtest.h>
 
 #include "drake/common/symbolic/monomial_util.h"
@@ -106,6 +108,26 @@ TEST_F(SosBasisGeneratorTest, Constant) {
   }
 }
 
+TEST_F(SosBasisGeneratorTest, ManyPolynomials) {
+  std::vector<symbolic::Polynomial> polys;
+  for (int k = 1; k <= 6; k++) {
+    polys.emplace_back(pow(1 + x_(0) * x_(1) + pow(x_(2), k), 2));
+    polys.emplace_back(pow(x_(0), 2 * k) + pow(x_(0) * x_(1), 2) + 1);
+  }
+  for (const Parallelism parallelism : {Parallelism(false), Parallelism(4)}) {
+    const std::vector<VectorX<Monomial>> bases =
+        ConstructMonomialBasis(polys, parallelism);
+    ASSERT_EQ(bases.size(), polys.size());
+    for (int i = 0; i < static_cast<int>(polys.size()); i++) {
+      EXPECT_EQ(VectorToSet(bases[i]), GetMonomialBasis(polys[i]));
+    }
+  }
+  // The basis of the square of a polynomial contains its monomials.
+  const MonomialSet basis = VectorToSet(ConstructMonomialBasis(polys)[10]);
+  EXPECT_EQ(basis.count(Monomial(x_(0) * x_(1))), 1);
+  EXPECT_EQ(basis.count(Monomial(pow(x_(2), 6))), 1);
+}
+
 }  // namespace
 }  // namespace solvers
 }  // namespace drake
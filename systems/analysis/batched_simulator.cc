@@ -0,0 +1,177 @@
+#include "drake/systems/analysis/batched_simulator.h"
+
+#include <cmath>
+#include <stdexcept>
+
+#include <fmt/format.h>
+
+#include "drake/common/drake_throw.h"
+#include "drake/common/parallel_for.h"
+
+namespace drake {
+namespace systems {
+namespace {
+
+// Returns the earliest time at or after `time` at which the periodic event
+// with the given timing triggers.
+double GetFirstSampleTimeAtOrAfter(const PeriodicEventData& timing,
+                                   double time) {
+  const double period = timing.period_sec();
+  const double offset = timing.offset_sec();
+  if (time <= offset) {
+    return offset;
+  }
+  return offset + std::ceil((time - offset) / period) * period;
+}
+
+}  // namespace
+
+template <typename Func>
+void BatchedSimulator::ForEachEnvironment(const Func& func) const {
+  drake::internal::ParallelFor(options_.parallelism, num_environments_, func);
+}
+
+BatchedSimulator::BatchedSimulator(const System<double>& system,
+                                   int num_environments,
+                                   const BatchedSimulatorOptions& options)
+    : system_(system),
+      num_environments_(num_environments),
+      options_(options) {
+  DRAKE_THROW_UNLESS(num_environments > 0);
+  if (!options_.use_batched_discrete_update) {
+    simulators_.reserve(num_environments);
+    for (int i = 0; i < num_environments; ++i) {
+      simulators_.push_back(std::make_unique<Simulator<double>>(system_));
+    }
+    return;
+  }
+
+  periodic_update_ = system_.GetUniquePeriodicDiscreteUpdateAttribute();
+  if (!periodic_update_.has_value() || system_.num_continuous_states() > 0 ||
+      system_.num_abstract_states() > 0) {
+    throw std::logic_error(fmt::format(
+        "BatchedSimulator: use_batched_discrete_update requires a System with "
+        "a unique periodic discrete update and no continuous or abstract "
+        "state, but {} {} a unique periodic discrete update, {} continuous "
+        "state(s) and {} abstract state(s).",
+        system_.GetSystemPathname(),
+        periodic_update_.has_value() ? "has" : "does not have",
+        system_.num_continuous_states(), system_.num_abstract_states()));
+  }
+  contexts_.reserve(num_environments);
+  for (int i = 0; i < num_environments; ++i) {
+    contexts_.push_back(system_.CreateDefaultContext());
+  }
+}
+
+BatchedSimulator::~BatchedSimulator() = default;
+
+const Context<double>& BatchedSimulator::get_context(int i) const {
+  DRAKE_THROW_UNLESS(0 <= i && i < num_environments_);
+  return contexts_.empty() ? simulators_[i]->get_context() : *contexts_[i];
+}
+
+Context<double>& BatchedSimulator::get_mutable_context(int i) {
+  DRAKE_THROW_UNLESS(0 <= i && i < num_environments_);
+  return contexts_.empty() ? simulators_[i]->get_mutable_context()
+                           : *contexts_[i];
+}
+
+void BatchedSimulator::Initialize() {
+  const double time = get_context(0).get_time();
+  for (int i = 1; i < num_environments_; ++i) {
+    if (get_context(i).get_time() != time) {
+      throw std::logic_error(fmt::format(
+          "BatchedSimulator::Initialize(): the time of environment {} ({}) "
+          "differs from the time of environment 0 ({}).",
+          i, get_context(i).get_time(), time));
+    }
+  }
+  if (contexts_.empty()) {
+    ForEachEnvironment([this](int i) {
+      simulators_[i]->Initialize();
+    });
+  } else {
+    ForEachEnvironment([this](int i) {
+      system_.ExecuteInitializationEvents(contexts_[i].get());
+    });
+    next_update_time_ = GetFirstSampleTimeAtOrAfter(*periodic_update_, time);
+  }
+  initialization_done_ = true;
+}
+
+void BatchedSimulator::AdvanceTo(double boundary_time) {
+  if (!initialization_done_) {
+    Initialize();
+  }
+  DRAKE_THROW_UNLESS(boundary_time >= get_time());
+  if (contexts_.empty()) {
+    ForEachEnvironment([this, boundary_time](int i) {
+      simulators_[i]->AdvanceTo(boundary_time);
+    });
+  } else {
+    AdvanceBatchedDiscreteUpdateTo(boundary_time);
+  }
+}
+
+void BatchedSimulator::AdvanceBatchedDiscreteUpdateTo(double boundary_time) {
+  const double period = periodic_update_->period_sec();
+  const double offset = periodic_update_->offset_sec();
+  while (next_update_time_ < boundary_time) {
+    const double update_time = next_update_time_;
+    ForEachEnvironment([this, update_time](int i) {
+      Context<double>& context = *contexts_[i];
+      context.SetTime(update_time);
+      // The update is computed into the context's cache, and then copied into
+      // its state.
+      context.SetDiscreteState(
+          system_.EvalUniquePeriodicDiscreteUpdate(context));
+    });
+    // Count the samples from the offset to avoid accumulating round-off.
+    const double k = std::round((update_time - offset) / period);
+    next_update_time_ = offset + (k + 1) * period;
+  }
+  ForEachEnvironment([this, boundary_time](int i) {
+    contexts_[i]->SetTime(boundary_time);
+  });
+}
+
+void BatchedSimulator::SetActions(
+    const InputPort<double>& port,
+    const Eigen::Ref<const Eigen::MatrixXd>& actions) {
+  DRAKE_THROW_UNLESS(&port.get_system() == &system_);
+  DRAKE_THROW_UNLESS(port.get_data_type() == kVectorValued);
+  DRAKE_THROW_UNLESS(actions.rows() == port.size());
+  DRAKE_THROW_UNLESS(actions.cols() == num_environments_);
+  ForEachEnvironment([this, &port, &actions](int i) {
+    Context<double>& context = get_mutable_context(i);
+    FixedInputPortValue* fixed =
+        context.MaybeGetMutableFixedInputPortValue(port.get_index());
+    if (fixed == nullptr) {
+      port.FixValue(&context, Eigen::VectorXd(actions.col(i)));
+    } else {
+      fixed->GetMutableVectorData<double>()->SetFromVector(actions.col(i));
+    }
+  });
+}
+
+void BatchedSimulator::CalcObservations(const OutputPort<double>& port,
+                                        Eigen::MatrixXd* observations) const {
+  DRAKE_THROW_UNLESS(observations != nullptr);
+  DRAKE_THROW_UNLESS(&port.get_system() == &system_);
+  DRAKE_THROW_UNLESS(port.get_data_type() == kVectorValued);
+  observations->resize(port.size(), num_environments_);
+  ForEachEnvironment([this, &port, observations](int i) {
+    observations->col(i) = port.Eval(get_context(i));
+  });
+}
+
+Eigen::MatrixXd BatchedSimulator::CalcObservations(
+    const OutputPort<double>& port) const {
+  Eigen::MatrixXd observations;
+  CalcObservations(port, &observations);
+  return observations;
+}
+
+}  // namespace systems
+}  // namespace drake
@@ -0,0 +1,162 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
+#include "drake/common/parallelism.h"
+#include "drake/systems/analysis/simulator.h"
+#include "drake/systems/framework/context.h"
+#include "drake/systems/framework/input_port.h"
+#include "drake/systems/framework/output_port.h"
+#include "drake/systems/framework/system.h"
+
+namespace drake {
+namespace systems {
+
+/// The options of a BatchedSimulator.
+struct BatchedSimulatorOptions {
+  /// The number of threads across which the environments are divided. Each
+  /// environment is always advanced by a single thread.
+  Parallelism parallelism{false};
+
+  /// When true, the BatchedSimulator does not use a Simulator at all. Instead
+  /// it applies the system's unique periodic discrete update (see
+  /// System::EvalUniquePeriodicDiscreteUpdate()) to all of the environments,
+  /// in one loop, at every update time. This removes the per-environment event
+  /// bookkeeping of the Simulator, which dominates the cost of advancing small
+  /// discrete systems (e.g., a discrete MultibodyPlant).
+  ///
+  /// This requires the system to have no continuous or abstract state and to
+  /// have a unique periodic discrete update timing. Any other event (per-step,
+  /// publish, unrestricted update, ...) is ignored, except that
+  /// initialization events are handled by Initialize().
+  bool use_batched_discrete_update{false};
+};
+
+/// A %BatchedSimulator advances many environments -- i.e., many Contexts of a
+/// single System<double> -- in lockstep. This is intended for workloads that
+/// simulate thousands of copies of the same small system, where advancing them
+/// one Simulator at a time (e.g., from Python) is far too slow.
+///
+/// All of the environments share a common time. The values of a vector-valued
+/// input port of the system (the "actions") and the values of a vector-valued
+/// output port (the "observations") are exchanged for all of the environments
+/// at once, as matrices with one column per environment.
+///
+/// By default, each environment is advanced by its own Simulator, with the
+/// default integrator. Alternatively, systems that are governed by a periodic
+/// discrete update can be advanced without any Simulator; see
+/// BatchedSimulatorOptions::use_batched_discrete_update.
+///
+/// When BatchedSimulatorOptions::parallelism asks for more than one thread,
+/// the environments are advanced concurrently. This requires the system's
+/// computations to be thread safe when each thread uses a distinct Context,
+/// as is the case for all Drake systems that do not call back into Python.
+///
+/// The System must outlive the %BatchedSimulator.
+class BatchedSimulator {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(BatchedSimulator)
+
+  /// Creates a %BatchedSimulator of `num_environments` environments of
+  /// `system`, each starting with a default Context.
+  /// @throws std::exception if `num_environments` is not positive.
+  /// @throws std::exception if options.use_batched_discrete_update is set but
+  /// `system` does not satisfy its requirements.
+  BatchedSimulator(const System<double>& system, int num_environments,
+                   const BatchedSimulatorOptions& options = {});
+
+  ~BatchedSimulator();
+
+  /// Returns the System that is simulated in every environment.
+  const System<double>& get_system() const { return system_; }
+
+  /// Returns the options of this %BatchedSimulator.
+  const BatchedSimulatorOptions& get_options() const { return options_; }
+
+  /// Returns the number of environments.
+  int num_environments() const { return num_environments_; }
+
+  /// Returns the Context of the environment with index `i`.
+  /// @throws std::exception if `i` is not in [0, num_environments()).
+  const Context<double>& get_context(int i) const;
+
+  /// Returns the mutable Context of the environment with index `i`. Like for
+  /// a Simulator, Initialize() must be called after changing the time of any
+  /// context.
+  /// @throws std::exception if `i` is not in [0, num_environments()).
+  Context<double>& get_mutable_context(int i);
+
+  /// Returns the (common) time of the environments.
+  double get_time() const { return get_context(0).get_time(); }
+
+  /// Prepares all of the environments for simulation, like
+  /// Simulator::Initialize(). All of the contexts must have the same time.
+  /// @throws std::exception if the times of the contexts differ.
+  void Initialize();
+
+  /// Advances all of the environments to `boundary_time`, like
+  /// Simulator::AdvanceTo(). Initialize() is called first if it has not been
+  /// called yet. In batched discrete update mode, the discrete update is
+  /// applied at every update time t with get_time() <= t < `boundary_time`;
+  /// an update at `boundary_time` itself is applied by the next call, just as
+  /// a Simulator would do.
+  /// @throws std::exception if `boundary_time` is less than get_time().
+  void AdvanceTo(double boundary_time);
+
+  /// Fixes the value of the vector-valued input `port` of get_system() in
+  /// every environment, to the column of `actions` with the environment's
+  /// index. Repeated calls for the same port reuse the fixed values already in
+  /// the contexts, without allocating.
+  /// @throws std::exception if `port` does not belong to get_system(), if it
+  /// is not vector-valued, or if `actions` is not of size `port.size()` by
+  /// num_environments().
+  void SetActions(const InputPort<double>& port,
+                  const Eigen::Ref<const Eigen::MatrixXd>& actions);
+
+  /// Evaluates the vector-valued output `port` of get_system() in every
+  /// environment, writing the value of environment `i` to column `i` of
+  /// `observations`, which is resized to `port.size()` by num_environments().
+  /// @throws std::exception if `port` does not belong to get_system() or if it
+  /// is not vector-valued.
+  void CalcObservations(const OutputPort<double>& port,
+                        Eigen::MatrixXd* observations) const;
+
+  /// Returns the observations of `port`, as described in the other overload.
+  Eigen::MatrixXd CalcObservations(const OutputPort<double>& port) const;
+
+ private:
+  // Calls func(i) for every environment i, in parallel as requested by
+  // options_.parallelism (see drake::internal::ParallelFor()).
+  template <typename Func>
+  void ForEachEnvironment(const Func& func) const;
+
+  // Applies the discrete update in every environment at each update time
+  // before `boundary_time`.
+  void AdvanceBatchedDiscreteUpdateTo(double boundary_time);
+
+  const System<double>& system_;
+  const int num_environments_;
+  const BatchedSimulatorOptions options_;
+
+  // One Simulator per environment, unless use_batched_discrete_update is set.
+  std::vector<std::unique_ptr<Simulator<double>>> simulators_;
+
+  // One Context per environment, iff use_batched_discrete_update is set.
+  std::vector<std::unique_ptr<Context<double>>> contexts_;
+
+  // The timing of the discrete update, iff use_batched_discrete_update is set.
+  std::optional<PeriodicEventData> periodic_update_;
+
+  // The time of the next discrete update to be applied, iff
+  // use_batched_discrete_update is set and Initialize() has been called.
+  double next_update_time_{};
+
+  bool initialization_done_{false};
+};
+
+}  // namespace systems
+}  // namespace drake
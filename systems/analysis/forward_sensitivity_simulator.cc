@@ -0,0 +1,239 @@
+#include "drake/systems/analysis/forward_sensitivity_simulator.h"
+
+#include <cmath>
+#include <stdexcept>
+
+#include <fmt/format.h>
+
+#include "drake/common/drake_throw.h"
+#include "drake/math/autodiff.h"
+#include "drake/math/autodiff_gradient.h"
+#include "drake/systems/analysis/runge_kutta3_integrator.h"
+
+namespace drake {
+namespace systems {
+namespace {
+
+using Eigen::MatrixXd;
+using Eigen::VectorXd;
+
+// Returns the earliest time at or after `time` at which the periodic event
+// with the given timing triggers.
+double GetFirstSampleTimeAtOrAfter(const PeriodicEventData& timing,
+                                   double time) {
+  const double period = timing.period_sec();
+  const double offset = timing.offset_sec();
+  if (time <= offset) {
+    return offset;
+  }
+  return offset + std::ceil((time - offset) / period) * period;
+}
+
+// Returns the AutoDiffXd vector with the given value and gradient.
+VectorX<AutoDiffXd> Seed(const Eigen::Ref<const VectorXd>& value,
+                         const Eigen::Ref<const MatrixXd>& gradient) {
+  VectorX<AutoDiffXd> result(value.size());
+  math::InitializeAutoDiff(value, gradient, &result);
+  return result;
+}
+
+// The augmented ODE of z = [x; vec(S)], where ẋ = f(t, x, p) are the time
+// derivatives of a system and Ṡ = ∂f/∂x S + ∂f/∂p Dp. Both are obtained from a
+// single evaluation of the time derivatives of the AutoDiffXd counterpart of
+// the system, whose context already holds the parameters seeded with Dp.
+class AugmentedSystem final : public LeafSystem<double> {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(AugmentedSystem);
+
+  AugmentedSystem(const System<AutoDiffXd>& autodiff_system,
+                  Context<AutoDiffXd>* autodiff_context,
+                  const VectorXd& initial_value, int num_directions)
+      : autodiff_system_(autodiff_system),
+        autodiff_context_(autodiff_context),
+        num_states_(autodiff_context->num_continuous_states()),
+        num_directions_(num_directions) {
+    this->DeclareContinuousState(BasicVector<double>(initial_value));
+  }
+
+ private:
+  void DoCalcTimeDerivatives(
+      const Context<double>& context,
+      ContinuousState<double>* derivatives) const final {
+    const VectorXd z = context.get_continuous_state_vector().CopyToVector();
+    const Eigen::Map<const MatrixXd> S(z.data() + num_states_, num_states_,
+                                       num_directions_);
+    autodiff_context_->SetTime(context.get_time());
+    autodiff_context_->SetContinuousState(Seed(z.head(num_states_), S));
+    const VectorX<AutoDiffXd> xdot =
+        autodiff_system_.EvalTimeDerivatives(*autodiff_context_)
+            .CopyToVector();
+    VectorXd zdot(z.size());
+    zdot.head(num_states_) = math::ExtractValue(xdot);
+    Eigen::Map<MatrixXd>(zdot.data() + num_states_, num_states_,
+                         num_directions_) =
+        math::ExtractGradient(xdot, num_directions_);
+    derivatives->SetFromVector(zdot);
+  }
+
+  const System<AutoDiffXd>& autodiff_system_;
+  // The context is only used as scratch space for the evaluations above.
+  Context<AutoDiffXd>* const autodiff_context_;
+  const int num_states_;
+  const int num_directions_;
+};
+
+int CountNumericParameters(const Context<double>& context) {
+  int result = 0;
+  for (int i = 0; i < context.num_numeric_parameter_groups(); ++i) {
+    result += context.get_numeric_parameter(i).size();
+  }
+  return result;
+}
+
+MatrixXd MakeInitialStateDirections(const Context<double>& context) {
+  const int num_states = context.num_continuous_states() > 0
+                             ? context.num_continuous_states()
+                             : context.num_discrete_state_groups() > 0
+                                   ? context.get_discrete_state(0).size()
+                                   : 0;
+  MatrixXd result =
+      MatrixXd::Zero(num_states + CountNumericParameters(context), num_states);
+  result.topRows(num_states).setIdentity();
+  return result;
+}
+
+}  // namespace
+
+ForwardSensitivitySimulator::ForwardSensitivitySimulator(
+    const System<double>& system, const Context<double>& context,
+    const Eigen::Ref<const MatrixXd>& directions)
+    : system_(system) {
+  system_.ValidateContext(context);
+  const int num_continuous_states = context.num_continuous_states();
+  const int num_discrete_state_groups = context.num_discrete_state_groups();
+  if (num_continuous_states > 0) {
+    if (num_discrete_state_groups > 0 || context.num_abstract_states() > 0) {
+      throw std::logic_error(fmt::format(
+          "ForwardSensitivitySimulator: a System with continuous state must "
+          "not have discrete or abstract state, but {} has {} discrete state "
+          "group(s) and {} abstract state(s).",
+          system_.GetSystemPathname(), num_discrete_state_groups,
+          context.num_abstract_states()));
+    }
+    num_states_ = num_continuous_states;
+  } else {
+    periodic_update_ = system_.GetUniquePeriodicDiscreteUpdateAttribute();
+    if (!periodic_update_.has_value() || num_discrete_state_groups != 1 ||
+        context.num_abstract_states() > 0) {
+      throw std::logic_error(fmt::format(
+          "ForwardSensitivitySimulator: a System without continuous state "
+          "requires a unique periodic discrete update, exactly one discrete "
+          "state group and no abstract state, but {} {} a unique periodic "
+          "discrete update, {} discrete state group(s) and {} abstract "
+          "state(s).",
+          system_.GetSystemPathname(),
+          periodic_update_.has_value() ? "has" : "does not have",
+          num_discrete_state_groups, context.num_abstract_states()));
+    }
+    num_states_ = context.get_discrete_state(0).size();
+  }
+  num_parameters_ = CountNumericParameters(context);
+  num_directions_ = directions.cols();
+  if (directions.rows() != num_states_ + num_parameters_) {
+    throw std::logic_error(fmt::format(
+        "ForwardSensitivitySimulator: the directions must have one row per "
+        "state and numeric parameter ({} + {}), but have {} rows.",
+        num_states_, num_parameters_, directions.rows()));
+  }
+
+  autodiff_system_ = system_.ToAutoDiffXd();
+  autodiff_context_ = autodiff_system_->CreateDefaultContext();
+  autodiff_context_->SetTimeStateAndParametersFrom(context);
+  autodiff_system_->FixInputPortsFrom(system_, context,
+                                      autodiff_context_.get());
+  int offset = num_states_;
+  for (int i = 0; i < context.num_numeric_parameter_groups(); ++i) {
+    const VectorXd& value = context.get_numeric_parameter(i).value();
+    autodiff_context_->get_mutable_numeric_parameter(i).SetFromVector(
+        Seed(value, directions.middleRows(offset, value.size())));
+    offset += value.size();
+  }
+
+  time_ = context.get_time();
+  sensitivities_ = directions.topRows(num_states_);
+  if (periodic_update_.has_value()) {
+    state_ = context.get_discrete_state(0).value();
+    next_update_time_ = GetFirstSampleTimeAtOrAfter(*periodic_update_, time_);
+    return;
+  }
+  state_ = context.get_continuous_state_vector().CopyToVector();
+  VectorXd initial_value(num_states_ * (1 + num_directions_));
+  initial_value << state_, sensitivities_.reshaped();
+  augmented_system_ = std::make_unique<AugmentedSystem>(
+      *autodiff_system_, autodiff_context_.get(), initial_value,
+      num_directions_);
+  augmented_context_ = augmented_system_->CreateDefaultContext();
+  augmented_context_->SetTime(time_);
+  integrator_ = std::make_unique<RungeKutta3Integrator<double>>(
+      *augmented_system_, augmented_context_.get());
+  integrator_->request_initial_step_size_target(1e-4);
+  integrator_->set_maximum_step_size(0.1);
+  integrator_->set_target_accuracy(1e-6);
+}
+
+ForwardSensitivitySimulator::ForwardSensitivitySimulator(
+    const System<double>& system, const Context<double>& context)
+    : ForwardSensitivitySimulator(system, context,
+                                  MakeInitialStateDirections(context)) {}
+
+ForwardSensitivitySimulator::~ForwardSensitivitySimulator() = default;
+
+IntegratorBase<double>& ForwardSensitivitySimulator::get_mutable_integrator() {
+  if (integrator_ == nullptr) {
+    throw std::logic_error(
+        "ForwardSensitivitySimulator::get_mutable_integrator(): a System "
+        "without continuous state has no integrator.");
+  }
+  return *integrator_;
+}
+
+void ForwardSensitivitySimulator::AdvanceTo(double boundary_time) {
+  DRAKE_THROW_UNLESS(boundary_time >= time_);
+  if (periodic_update_.has_value()) {
+    AdvanceDiscreteTo(boundary_time);
+    return;
+  }
+  if (boundary_time > time_) {
+    if (!integrator_->is_initialized()) {
+      integrator_->Initialize();
+    }
+    integrator_->IntegrateWithMultipleStepsToTime(boundary_time);
+  }
+  const VectorXd z =
+      augmented_context_->get_continuous_state_vector().CopyToVector();
+  time_ = augmented_context_->get_time();
+  state_ = z.head(num_states_);
+  sensitivities_ = z.tail(num_states_ * num_directions_)
+                       .reshaped(num_states_, num_directions_);
+}
+
+void ForwardSensitivitySimulator::AdvanceDiscreteTo(double boundary_time) {
+  const double period = periodic_update_->period_sec();
+  const double offset = periodic_update_->offset_sec();
+  while (next_update_time_ < boundary_time) {
+    autodiff_context_->SetTime(next_update_time_);
+    autodiff_context_->SetDiscreteState(Seed(state_, sensitivities_));
+    const VectorX<AutoDiffXd>& next =
+        autodiff_system_->EvalUniquePeriodicDiscreteUpdate(*autodiff_context_)
+            .value();
+    state_ = math::ExtractValue(next);
+    sensitivities_ = math::ExtractGradient(next, num_directions_);
+    // Count the samples from the offset to avoid accumulating round-off.
+    const double k = std::round((next_update_time_ - offset) / period);
+    next_update_time_ = offset + (k + 1) * period;
+  }
+  time_ = boundary_time;
+}
+
+}  // namespace systems
+}  // namespace drake
@@ -0,0 +1,137 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+
+#include "drake/common/autodiff.h"
+#include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
+#include "drake/systems/analysis/integrator_base.h"
+#include "drake/systems/framework/context.h"
+#include "drake/systems/framework/event.h"
+#include "drake/systems/framework/leaf_system.h"
+#include "drake/systems/framework/system.h"
+
+namespace drake {
+namespace systems {
+
+/// A %ForwardSensitivitySimulator advances the state x of a System<double>
+/// together with its forward sensitivities S = ∂x/∂θ, where θ = [x₀; p]
+/// stacks the initial state x₀ and the numeric parameters p of the system.
+///
+/// Obtaining such gradients by running a whole Simulator<AutoDiffXd> carries
+/// dense derivative vectors through every computation of the simulation,
+/// including the integrator's own bookkeeping. Here instead, the state and the
+/// sensitivities are double-valued, and automatic differentiation is confined
+/// to one evaluation of the dynamics per step, on the AutoDiffXd counterpart
+/// of the system:
+/// - For a system with continuous state, the augmented ODE
+///   ẋ = f(t, x, p), Ṡ = ∂f/∂x S + ∂f/∂p Dp is integrated by a
+///   double-valued integrator (RungeKutta3Integrator by default, with error
+///   control on both x and S).
+/// - For a system with a unique periodic discrete update
+///   xₙ₊₁ = g(tₙ, xₙ, p), the sensitivities are updated as
+///   Sₙ₊₁ = ∂g/∂x Sₙ + ∂g/∂p Dp at every update time, with the same update
+///   times as a Simulator would use.
+///
+/// The sensitivities are computed along k "directions", given as the columns
+/// of an (nx + np) × k matrix D = [S₀; Dp], so that S is nx × k. Each column
+/// is a directional derivative, and all k of them are computed by the same
+/// dynamics evaluation. The full Jacobian ∂x/∂θ is the special case D = I;
+/// when only a few parameters or a few combinations of them matter (e.g., in
+/// system identification), choosing fewer directions is proportionally
+/// cheaper.
+///
+/// The values of the input ports are fixed to those of the Context given at
+/// construction, and are not differentiated. Events other than the unique
+/// periodic discrete update (including initialization events) are ignored.
+///
+/// The System must support scalar conversion to AutoDiffXd, have no abstract
+/// state, and have either only continuous state or only one group of discrete
+/// state updated by a unique periodic discrete update. It must outlive the
+/// %ForwardSensitivitySimulator.
+class ForwardSensitivitySimulator {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(ForwardSensitivitySimulator)
+
+  /// Creates a %ForwardSensitivitySimulator of `system` starting at the time,
+  /// state, parameters and input values of `context`, with the sensitivity
+  /// directions `directions` described in the class documentation. The numeric
+  /// parameters are ordered by group, as in Context::get_numeric_parameter().
+  /// @throws std::exception if `system` does not meet the requirements above,
+  /// or if `directions` does not have num_states() + num_parameters() rows.
+  ForwardSensitivitySimulator(
+      const System<double>& system, const Context<double>& context,
+      const Eigen::Ref<const Eigen::MatrixXd>& directions);
+
+  /// Creates a %ForwardSensitivitySimulator that computes the sensitivities
+  /// ∂x/∂x₀ with respect to the initial state only, i.e., with directions
+  /// [I; 0].
+  ForwardSensitivitySimulator(const System<double>& system,
+                              const Context<double>& context);
+
+  ~ForwardSensitivitySimulator();
+
+  /// Returns the System whose state is advanced.
+  const System<double>& get_system() const { return system_; }
+
+  /// Returns the number nx of (continuous or discrete) states.
+  int num_states() const { return num_states_; }
+
+  /// Returns the number np of numeric parameters.
+  int num_parameters() const { return num_parameters_; }
+
+  /// Returns the number k of sensitivity directions.
+  int num_directions() const { return num_directions_; }
+
+  /// Returns the current time.
+  double get_time() const { return time_; }
+
+  /// Returns the current state x.
+  const Eigen::VectorXd& get_state() const { return state_; }
+
+  /// Returns the current nx × k sensitivities S.
+  const Eigen::MatrixXd& get_sensitivities() const { return sensitivities_; }
+
+  /// Advances the state and the sensitivities to `boundary_time`. For a
+  /// discrete system, the update is applied at every update time t with
+  /// get_time() <= t < `boundary_time`, as Simulator::AdvanceTo() would do.
+  /// @throws std::exception if `boundary_time` is less than get_time().
+  void AdvanceTo(double boundary_time);
+
+  /// Returns the integrator of the augmented ODE, so that its accuracy or
+  /// step size may be changed before the first call to AdvanceTo().
+  /// @throws std::exception if the system does not have continuous state.
+  IntegratorBase<double>& get_mutable_integrator();
+
+ private:
+  void AdvanceDiscreteTo(double boundary_time);
+
+  const System<double>& system_;
+  int num_states_{};
+  int num_parameters_{};
+  int num_directions_{};
+
+  double time_{};
+  Eigen::VectorXd state_;
+  Eigen::MatrixXd sensitivities_;
+
+  // The AutoDiffXd counterpart of system_ and its context, whose numeric
+  // parameters carry the parameter directions Dp as their gradients.
+  std::unique_ptr<System<AutoDiffXd>> autodiff_system_;
+  std::unique_ptr<Context<AutoDiffXd>> autodiff_context_;
+
+  // The augmented ODE of [x; vec(S)], its context and integrator, iff system_
+  // has continuous state.
+  std::unique_ptr<LeafSystem<double>> augmented_system_;
+  std::unique_ptr<Context<double>> augmented_context_;
+  std::unique_ptr<IntegratorBase<double>> integrator_;
+
+  // The timing of the discrete update and the time of the next one, iff
+  // system_ has discrete state.
+  std::optional<PeriodicEventData> periodic_update_;
+  double next_update_time_{};
+};
+
+}  // namespace systems
+}  // namespace drake
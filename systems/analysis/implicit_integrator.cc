@@ -1,13 +1,16 @@
 #include "drake/systems/analysis/implicit_integrator.h"
 
+#include <algorithm>
 #include <cmath>
 #include <stdexcept>
+#include <utility>
+#include <vector>
 
 #include "drake/common/autodiff.h"
 #include "drake/common/drake_assert.h"
 #include "drake/common/fmt_eigen.h"
+#include "drake/common/parallel_for.h"
 #include "drake/common/text_logging.h"
-#include "drake/math/autodiff_gradient.h"
 
 namespace drake {
 namespace systems {
@@ -23,62 +26,256 @@ void ImplicitIntegrator<T>::DoResetStatistics() {
 template <class T>
 void ImplicitIntegrator<T>::DoReset() {
   J_.resize(0, 0);
+  jacobian_pattern_.clear();
+  jacobian_column_groups_.clear();
+  jacobian_contexts_.clear();
+  autodiff_contexts_.clear();
   DoResetCachedJacobianRelatedMatrices();
   // Call any Reset() provided by child integrator classes.
   DoImplicitIntegratorReset();
 }
 
+namespace {
+
+// Makes the fixed input port values of `destination` equal to those of
+// `source`, a root Context of the same System.
+template <class T>
+void CopyFixedInputPortValues(const Context<T>& source,
+                              Context<T>* destination) {
+  for (int i = 0; i < source.num_input_ports(); ++i) {
+    const FixedInputPortValue* value = source.MaybeGetFixedInputPortValue(i);
+    if (value == nullptr) continue;
+    FixedInputPortValue* existing =
+        destination->MaybeGetMutableFixedInputPortValue(i);
+    if (existing == nullptr) {
+      destination->FixInputPort(i, value->get_value());
+      continue;
+    }
+    // Copy vectors element-wise, since AbstractValue::SetFrom() would clone
+    // the (non-copyable) BasicVector.
+    const BasicVector<T>* vector =
+        value->get_value().template maybe_get_value<BasicVector<T>>();
+    if (vector != nullptr) {
+      existing->GetMutableVectorData<T>()->SetFrom(*vector);
+    } else {
+      existing->GetMutableData()->SetFrom(value->get_value());
+    }
+  }
+}
+
+// Computes a good increment for a finite difference in the dimension with
+// value `xi`, using approximately 1/eps digits of precision. Note that if |xi|
+// is large, the increment will be large as well. If |xi| is small, the
+// increment will be no smaller than eps.
+template <class T>
+T CalcFiniteDifferenceIncrement(const T& xi, double eps) {
+  using std::abs;
+  const T abs_xi = abs(xi);
+  if (abs_xi <= 1) {
+    // When |xi| is small, increment will be eps.
+    return T(eps);
+  }
+  // |xi| not small; make increment a fraction of |xi|.
+  return eps * abs_xi;
+}
+
+}  // namespace
+
+template <class T>
+int ImplicitIntegrator<T>::num_jacobian_threads() const {
+  return jacobian_parallelism_.num_threads();
+}
+
+template <class T>
+const std::vector<std::vector<int>>&
+ImplicitIntegrator<T>::GetJacobianColumnGroups(int n) {
+  if (has_jacobian_pattern(n)) {
+    return jacobian_column_groups_;
+  }
+  if (static_cast<int>(jacobian_single_columns_.size()) != n) {
+    jacobian_single_columns_.resize(n);
+    for (int j = 0; j < n; ++j) {
+      jacobian_single_columns_[j] = {j};
+    }
+  }
+  return jacobian_single_columns_;
+}
+
+template <class T>
+void ImplicitIntegrator<T>::DetectJacobianSparsity(const MatrixX<T>& J) {
+  const int n = J.cols();
+  jacobian_pattern_.assign(n, {});
+  for (int j = 0; j < n; ++j) {
+    for (int r = 0; r < n; ++r) {
+      // The diagonal is always kept, since the iteration matrices add to it.
+      if (r == j || J(r, j) != 0.0) {
+        jacobian_pattern_[j].push_back(r);
+      }
+    }
+  }
+
+  // Greedily assign each column to the first group that does not yet use any
+  // of its rows.
+  jacobian_column_groups_.clear();
+  std::vector<std::vector<bool>> group_uses_row;
+  for (int j = 0; j < n; ++j) {
+    int group = 0;
+    for (; group < static_cast<int>(jacobian_column_groups_.size()); ++group) {
+      const std::vector<bool>& uses_row = group_uses_row[group];
+      if (std::none_of(jacobian_pattern_[j].begin(), jacobian_pattern_[j].end(),
+                       [&uses_row](int r) { return uses_row[r]; })) {
+        break;
+      }
+    }
+    if (group == static_cast<int>(jacobian_column_groups_.size())) {
+      jacobian_column_groups_.emplace_back();
+      group_uses_row.emplace_back(n, false);
+    }
+    jacobian_column_groups_[group].push_back(j);
+    for (int r : jacobian_pattern_[j]) {
+      group_uses_row[group][r] = true;
+    }
+  }
+  DRAKE_LOGGER_DEBUG(
+      "  ImplicitIntegrator detected {} Jacobian column groups for {} states",
+      jacobian_column_groups_.size(), n);
+}
+
+template <class T>
+template <typename Func>
+void ImplicitIntegrator<T>::ForEachJacobianColumnGroup(
+    int n, Context<T>* context, int evaluations_per_group, const Func& func) {
+  const std::vector<std::vector<int>>& groups = GetJacobianColumnGroups(n);
+  const int num_groups = static_cast<int>(groups.size());
+  const int num_workers = std::min(num_jacobian_threads(), num_groups);
+  // Each group's evaluations perturb the state, so none are cached.
+  this->add_derivative_evaluations(evaluations_per_group * num_groups);
+  if (num_workers <= 1) {
+    for (const std::vector<int>& group : groups) {
+      func(group, context);
+    }
+    return;
+  }
+
+  // Bring the workers' contexts up to date with the integrator's.
+  while (static_cast<int>(jacobian_contexts_.size()) < num_workers) {
+    jacobian_contexts_.push_back(context->Clone());
+  }
+  for (int w = 0; w < num_workers; ++w) {
+    jacobian_contexts_[w]->SetTimeStateAndParametersFrom(*context);
+    CopyFixedInputPortValues(*context, jacobian_contexts_[w].get());
+  }
+
+  // Worker w handles groups w, w + num_workers, w + 2 num_workers, etc.
+  drake::internal::ParallelFor(
+      Parallelism(num_workers), num_workers, [&](int w) {
+        for (int g = w; g < num_groups; g += num_workers) {
+          func(groups[g], jacobian_contexts_[w].get());
+        }
+      });
+}
+
 template <class T>
 void ImplicitIntegrator<T>::ComputeAutoDiffJacobian(
     const System<T>& system, const T& t, const VectorX<T>& xt,
     const Context<T>& context, MatrixX<T>* J) {
   DRAKE_LOGGER_DEBUG("  ImplicitIntegrator Compute Autodiff Jacobian t={}", t);
-  // TODO(antequ): Investigate how to refactor this method to use
-  // math::jacobian(), if possible.
-
-  // Create AutoDiff versions of the state vector.
-  // Set the size of the derivatives and prepare for Jacobian calculation.
-  VectorX<AutoDiffXd> a_xt = math::InitializeAutoDiff(xt);
-
-  // Get the system and the context in AutoDiffable format. Inputs must also
-  // be copied to the context used by the AutoDiff'd system (which is
-  // accomplished using FixInputPortsFrom()).
-  // TODO(edrumwri): Investigate means for moving as many of the operations
-  //                 below offline (or with lower frequency than once-per-
-  //                 Jacobian calculation) as is possible. These operations
-  //                 are likely to be expensive.
-  const auto adiff_system = system.ToAutoDiffXd();
-  std::unique_ptr<Context<AutoDiffXd>> adiff_context = adiff_system->
-      AllocateContext();
-  adiff_context->SetTimeStateAndParametersFrom(context);
-  adiff_system->FixInputPortsFrom(system, context, adiff_context.get());
-  adiff_context->SetTime(t);
-
-  // Set the continuous state in the context.
-  adiff_context->SetContinuousState(a_xt);
-
-  // Evaluate the derivatives at that state.
-  const VectorX<AutoDiffXd> result =
-      this->EvalTimeDerivatives(*adiff_system, *adiff_context).CopyToVector();
-
-  *J = math::ExtractGradient(result);
+  const int n = xt.size();
+
+  // Each derivative direction seeds a group of columns (a single column
+  // unless the sparsity pattern is known), and each evaluation of the time
+  // derivatives seeds a chunk of consecutive directions.
+  const std::vector<std::vector<int>>& groups = GetJacobianColumnGroups(n);
+  const bool use_pattern = has_jacobian_pattern(n);
+  const int num_directions = static_cast<int>(groups.size());
+  const int chunk_size =
+      autodiff_jacobian_chunk_size_ > 0
+          ? std::min(autodiff_jacobian_chunk_size_, num_directions)
+          : num_directions;
+  const int num_chunks =
+      chunk_size > 0 ? (num_directions + chunk_size - 1) / chunk_size : 0;
+  const int num_workers =
+      std::max(1, std::min(num_jacobian_threads(), num_chunks));
+
+  // Get the system and the contexts in AutoDiffable format. Inputs must also
+  // be copied to the contexts used by the AutoDiff'd system (which is
+  // accomplished using FixInputPortsFrom()). The system and contexts are
+  // only converted or allocated once.
+  if (autodiff_system_ == nullptr) {
+    autodiff_system_ = system.ToAutoDiffXd();
+  }
+  while (static_cast<int>(autodiff_contexts_.size()) < num_workers) {
+    autodiff_contexts_.push_back(autodiff_system_->AllocateContext());
+  }
+  for (int w = 0; w < num_workers; ++w) {
+    Context<AutoDiffXd>* adiff_context = autodiff_contexts_[w].get();
+    adiff_context->SetTimeStateAndParametersFrom(context);
+    autodiff_system_->FixInputPortsFrom(system, context, adiff_context);
+    adiff_context->SetTime(t);
+  }
 
   // Sometimes the system's derivatives f(t, x) do not depend on its states, for
   // example, when f(t, x) = constant or when f(t, x) depends only on t. In this
-  // case, make sure that the Jacobian isn't a n ✕ 0 matrix (this will cause a
-  // segfault when forming Newton iteration matrices); if it is, we set it equal
-  // to an n x n zero matrix.
-  if (J->cols() == 0) {
-    *J = MatrixX<T>::Zero(xt.size(), xt.size());
+  // case the derivatives of the result are empty, and the Jacobian entries are
+  // left at zero.
+  J->setZero(n, n);
+  auto evaluate_chunk = [&](int chunk, Context<AutoDiffXd>* adiff_context) {
+    const int first = chunk * chunk_size;
+    const int size = std::min(chunk_size, num_directions - first);
+
+    // Create AutoDiff versions of the state vector, seeding the chunk's
+    // directions, and evaluate the derivatives at that state.
+    VectorX<AutoDiffXd> a_xt(n);
+    for (int i = 0; i < n; ++i) {
+      a_xt(i).value() = xt(i);
+      a_xt(i).derivatives().setZero(size);
+    }
+    for (int d = 0; d < size; ++d) {
+      for (int j : groups[first + d]) {
+        a_xt(j).derivatives()(d) = 1.0;
+      }
+    }
+    adiff_context->SetContinuousState(a_xt);
+    const VectorBase<AutoDiffXd>& result =
+        autodiff_system_->EvalTimeDerivatives(*adiff_context).get_vector();
+
+    // Scatter the derivatives into the Jacobian.
+    for (int d = 0; d < size; ++d) {
+      for (int j : groups[first + d]) {
+        auto set_entry = [&](int r) {
+          const Eigen::VectorXd& derivatives = result[r].derivatives();
+          if (derivatives.size() > 0) {
+            (*J)(r, j) = derivatives(d);
+          }
+        };
+        if (use_pattern) {
+          for (int r : jacobian_pattern_[j]) set_entry(r);
+        } else {
+          for (int r = 0; r < n; ++r) set_entry(r);
+        }
+      }
+    }
+  };
+
+  this->add_derivative_evaluations(num_chunks);
+  if (num_workers == 1) {
+    for (int chunk = 0; chunk < num_chunks; ++chunk) {
+      evaluate_chunk(chunk, autodiff_contexts_[0].get());
+    }
+  } else {
+    drake::internal::ParallelFor(
+        Parallelism(num_workers), num_workers, [&](int w) {
+          for (int chunk = w; chunk < num_chunks; chunk += num_workers) {
+            evaluate_chunk(chunk, autodiff_contexts_[w].get());
+          }
+        });
   }
 }
 
 template <class T>
 void ImplicitIntegrator<T>::ComputeForwardDiffJacobian(
-    const System<T>&, const T& t, const VectorX<T>& xt, Context<T>* context,
-    MatrixX<T>* J) {
-  using std::abs;
-
+    const System<T>& system, const T& t, const VectorX<T>& xt,
+    Context<T>* context, MatrixX<T>* J) {
   // Set epsilon to the square root of machine precision.
   const double eps = std::sqrt(std::numeric_limits<double>::epsilon());
 
@@ -91,54 +288,49 @@ void ImplicitIntegrator<T>::ComputeForwardDiffJacobian(
       "  computing from state {}", fmt_eigen(xt.transpose()));
 
   // Initialize the Jacobian.
-  J->resize(n, n);
+  J->setZero(n, n);
 
   // Evaluate f(t,xt).
   context->SetTimeAndContinuousState(t, xt);
   const VectorX<T> f = this->EvalTimeDerivatives(*context).CopyToVector();
 
-  // Compute the Jacobian.
-  VectorX<T> xt_prime = xt;
-  for (int i = 0; i < n; ++i) {
-    // Compute a good increment to the dimension using approximately 1/eps
-    // digits of precision. Note that if |xt| is large, the increment will
-    // be large as well. If |xt| is small, the increment will be no smaller
-    // than eps.
-    const T abs_xi = abs(xt(i));
-    T dxi(abs_xi);
-    if (dxi <= 1) {
-      // When |xt[i]| is small, increment will be eps.
-      dxi = eps;
-    } else {
-      // |xt[i]| not small; make increment a fraction of |xt[i]|.
-      dxi = eps * abs_xi;
-    }
-
+  // Compute the Jacobian, one group of columns at a time.
+  const bool use_pattern = has_jacobian_pattern(n);
+  ForEachJacobianColumnGroup(n, context, 1, [&](const std::vector<int>& group,
+                                                Context<T>* group_context) {
     // Update xt', minimizing the effect of roundoff error by ensuring that
     // x and dx differ by an exactly representable number. See p. 192 of
     // Press, W., Teukolsky, S., Vetterling, W., and Flannery, P. Numerical
     //   Recipes in C++, 2nd Ed., Cambridge University Press, 2002.
-    xt_prime(i) = xt(i) + dxi;
-    dxi = xt_prime(i) - xt(i);
+    VectorX<T> xt_prime = xt;
+    for (int j : group) {
+      xt_prime(j) = xt(j) + CalcFiniteDifferenceIncrement(xt(j), eps);
+    }
 
     // TODO(sherm1) This is invalidating q, v, and z but we only changed one.
     //              Switch to a method that invalides just the relevant
     //              partition, and ideally modify only the one changed element.
-    // Compute f' and set the relevant column of the Jacobian matrix.
-    context->SetTimeAndContinuousState(t, xt_prime);
-    J->col(i) = (this->EvalTimeDerivatives(*context).CopyToVector() - f) / dxi;
-
-    // Reset xt' to xt.
-    xt_prime(i) = xt(i);
-  }
+    // Compute f' and set the relevant columns of the Jacobian matrix.
+    group_context->SetTimeAndContinuousState(t, xt_prime);
+    const VectorBase<T>& fprime =
+        system.EvalTimeDerivatives(*group_context).get_vector();
+    for (int j : group) {
+      const T dxj = xt_prime(j) - xt(j);
+      if (use_pattern) {
+        for (int r : jacobian_pattern_[j]) {
+          (*J)(r, j) = (fprime[r] - f(r)) / dxj;
+        }
+      } else {
+        J->col(j) = (fprime.CopyToVector() - f) / dxj;
+      }
+    }
+  });
 }
 
 template <class T>
 void ImplicitIntegrator<T>::ComputeCentralDiffJacobian(
-    const System<T>&, const T& t, const VectorX<T>& xt, Context<T>* context,
-    MatrixX<T>* J) {
-  using std::abs;
-
+    const System<T>& system, const T& t, const VectorX<T>& xt,
+    Context<T>* context, MatrixX<T>* J) {
   // Cube root of machine precision (indicated by theory) seems a bit coarse.
   // Pick power of eps halfway between 6/12 (i.e., 1/2) and 4/12 (i.e., 1/3).
   const double eps = std::pow(std::numeric_limits<double>::epsilon(), 5.0/12);
@@ -150,70 +342,101 @@ void ImplicitIntegrator<T>::ComputeCentralDiffJacobian(
       "  ImplicitIntegrator Compute Centraldiff {}-Jacobian t={}", n, t);
 
   // Initialize the Jacobian.
-  J->resize(n, n);
+  J->setZero(n, n);
 
   // Evaluate f(t,xt).
   context->SetTimeAndContinuousState(t, xt);
   const VectorX<T> f = this->EvalTimeDerivatives(*context).CopyToVector();
 
-  // Compute the Jacobian.
-  VectorX<T> xt_prime = xt;
-  for (int i = 0; i < n; ++i) {
-    // Compute a good increment to the dimension using approximately 1/eps
-    // digits of precision. Note that if |xt| is large, the increment will
-    // be large as well. If |xt| is small, the increment will be no smaller
-    // than eps.
-    const T abs_xi = abs(xt(i));
-    T dxi(abs_xi);
-    if (dxi <= 1) {
-      // When |xt[i]| is small, increment will be eps.
-      dxi = eps;
-    } else {
-      // |xt[i]| not small; make increment a fraction of |xt[i]|.
-      dxi = eps * abs_xi;
-    }
-
+  // Compute the Jacobian, one group of columns at a time.
+  const bool use_pattern = has_jacobian_pattern(n);
+  ForEachJacobianColumnGroup(n, context, 2, [&](const std::vector<int>& group,
+                                                Context<T>* group_context) {
     // Update xt', minimizing the effect of roundoff error, by ensuring that
     // x and dx differ by an exactly representable number. See p. 192 of
     // Press, W., Teukolsky, S., Vetterling, W., and Flannery, P. Numerical
     //   Recipes in C++, 2nd Ed., Cambridge University Press, 2002.
-    xt_prime(i) = xt(i) + dxi;
-    const T dxi_plus = xt_prime(i) - xt(i);
+    VectorX<T> xt_plus = xt;
+    VectorX<T> xt_minus = xt;
+    for (int j : group) {
+      const T dxj = CalcFiniteDifferenceIncrement(xt(j), eps);
+      xt_plus(j) = xt(j) + dxj;
+      xt_minus(j) = xt(j) - dxj;
+    }
 
     // TODO(sherm1) This is invalidating q, v, and z but we only changed one.
     //              Switch to a method that invalides just the relevant
     //              partition, and ideally modify only the one changed element.
-    // Compute f(x+dx).
-    context->SetContinuousState(xt_prime);
-    VectorX<T> fprime_plus = this->EvalTimeDerivatives(*context).CopyToVector();
-
-    // Update xt' again, minimizing the effect of roundoff error.
-    xt_prime(i) = xt(i) - dxi;
-    const T dxi_minus = xt(i) - xt_prime(i);
-
-    // Compute f(x-dx).
-    context->SetContinuousState(xt_prime);
-    VectorX<T> fprime_minus = this->EvalTimeDerivatives(
-        *context).CopyToVector();
-
-    // Set the Jacobian column.
-    J->col(i) = (fprime_plus - fprime_minus) / (dxi_plus + dxi_minus);
-
-    // Reset xt' to xt.
-    xt_prime(i) = xt(i);
-  }
+    // Compute f(x+dx) and f(x-dx).
+    group_context->SetTimeAndContinuousState(t, xt_plus);
+    const VectorX<T> fprime_plus =
+        system.EvalTimeDerivatives(*group_context).CopyToVector();
+    group_context->SetContinuousState(xt_minus);
+    const VectorX<T> fprime_minus =
+        system.EvalTimeDerivatives(*group_context).CopyToVector();
+
+    // Set the Jacobian columns.
+    for (int j : group) {
+      const T dxj_plus = xt_plus(j) - xt(j);
+      const T dxj_minus = xt(j) - xt_minus(j);
+      if (use_pattern) {
+        for (int r : jacobian_pattern_[j]) {
+          (*J)(r, j) = (fprime_plus(r) - fprime_minus(r)) /
+                       (dxj_plus + dxj_minus);
+        }
+      } else {
+        J->col(j) = (fprime_plus - fprime_minus) / (dxj_plus + dxj_minus);
+      }
+    }
+  });
 }
 
 template <class T>
 void ImplicitIntegrator<T>::IterationMatrix::SetAndFactorIterationMatrix(
     const MatrixX<T>& iteration_matrix) {
-  LU_.compute(iteration_matrix);
+  sparse_factored_ =
+      use_sparse_factorization_ && SparseFactor(iteration_matrix);
+  if (!sparse_factored_) {
+    LU_.compute(iteration_matrix);
+  }
   matrix_factored_ = true;
 }
 
+template <class T>
+bool ImplicitIntegrator<T>::IterationMatrix::SparseFactor(
+    const MatrixX<double>& iteration_matrix) {
+  Eigen::SparseMatrix<double> matrix = iteration_matrix.sparseView();
+  matrix.makeCompressed();
+
+  // The symbolic analysis only depends on the nonzero pattern, so it can be
+  // reused as long as the pattern does not change.
+  const bool same_pattern =
+      sparse_LU_ != nullptr && matrix.rows() == sparse_matrix_.rows() &&
+      matrix.nonZeros() == sparse_matrix_.nonZeros() &&
+      std::equal(matrix.outerIndexPtr(),
+                 matrix.outerIndexPtr() + matrix.outerSize() + 1,
+                 sparse_matrix_.outerIndexPtr()) &&
+      std::equal(matrix.innerIndexPtr(),
+                 matrix.innerIndexPtr() + matrix.nonZeros(),
+                 sparse_matrix_.innerIndexPtr());
+  sparse_matrix_ = std::move(matrix);
+  if (!same_pattern) {
+    if (sparse_LU_ == nullptr) {
+      sparse_LU_ =
+          std::make_unique<Eigen::SparseLU<Eigen::SparseMatrix<double>>>();
+    }
+    sparse_LU_->analyzePattern(sparse_matrix_);
+  }
+  sparse_LU_->factorize(sparse_matrix_);
+  return sparse_LU_->info() == Eigen::Success;
+}
+
 template <class T>
 VectorX<T> ImplicitIntegrator<T>::IterationMatrix::Solve(
     const VectorX<T>& b) const {
+  if (sparse_factored_) {
+    return sparse_LU_->solve(b);
+  }
   return LU_.solve(b);
 }
 
@@ -314,6 +537,12 @@ const MatrixX<T>& ImplicitIntegrator<T>::CalcJacobian(const T& t,
     }
   }();
 
+  // The first Jacobian computed while exploiting sparsity is dense; detect
+  // its sparsity pattern for the next ones.
+  if (use_jacobian_sparsity_ && !has_jacobian_pattern(x.size())) {
+    DetectJacobianSparsity(J_);
+  }
+
   // Use the new number of ODE evaluations to determine the number of Jacobian
   // evaluations.
   num_jacobian_function_evaluations_ += this->get_num_derivative_evaluations()
@@ -340,6 +569,7 @@ void ImplicitIntegrator<T>::FreshenMatricesIfFullNewton(
 
   // Return immediately if full-Newton is not in use.
   if (!get_use_full_newton()) return;
+  iteration_matrix->set_use_sparse_factorization(use_sparse_iteration_matrix_);
 
   // Compute the initial Jacobian and iteration matrices and factor them.
   MatrixX<T>& J = get_mutable_jacobian();
@@ -355,6 +585,10 @@ bool ImplicitIntegrator<T>::MaybeFreshenMatrices(
         typename ImplicitIntegrator<T>::IterationMatrix*)>&
         compute_and_factor_iteration_matrix,
     typename ImplicitIntegrator<T>::IterationMatrix* iteration_matrix) {
+  // Switching between dense and sparse factorization unfactors the iteration
+  // matrix, so that it is refactored below.
+  iteration_matrix->set_use_sparse_factorization(use_sparse_iteration_matrix_);
+
   // Compute the initial Jacobian and iteration matrices and factor them, if
   // necessary.
   MatrixX<T>& J = get_mutable_jacobian();
@@ -4,12 +4,16 @@
 #include <limits>
 #include <memory>
 #include <utility>
+#include <vector>
 
 #include <Eigen/LU>
+#include <Eigen/SparseCore>
+#include <Eigen/SparseLU>
 
 #include "drake/common/autodiff.h"
 #include "drake/common/default_scalars.h"
 #include "drake/common/drake_copyable.h"
+#include "drake/common/parallelism.h"
 #include "drake/systems/analysis/integrator_base.h"
 
 namespace drake {
@@ -114,6 +118,8 @@ class ImplicitIntegrator : public IntegratorBase<T> {
   void set_jacobian_computation_scheme(JacobianComputationScheme scheme) {
     if (jacobian_scheme_ != scheme) {
       J_.resize(0, 0);
+      jacobian_pattern_.clear();
+      jacobian_column_groups_.clear();
       // Reset the Jacobian and any matrices cached by child integrators.
       DoResetCachedJacobianRelatedMatrices();
     }
@@ -123,6 +129,94 @@ class ImplicitIntegrator : public IntegratorBase<T> {
   JacobianComputationScheme get_jacobian_computation_scheme() const {
     return jacobian_scheme_;
   }
+
+  /// Sets the parallelism with which Jacobian matrices are computed (default
+  /// is no parallelism). When more than one thread is requested, the columns
+  /// (or column groups, see set_use_jacobian_sparsity()) of the Jacobian are
+  /// divided among worker threads, each of which evaluates the time
+  /// derivatives in its own clone of the integrator's Context. This requires
+  /// the System's time derivative calculations to be thread safe when each
+  /// thread uses a distinct Context, which is the case for all Drake systems
+  /// that do not call back into Python. With kAutomatic, the parallelism is across AutoDiffXd evaluations
+  /// and thus only useful with set_autodiff_jacobian_chunk_size().
+  void set_jacobian_parallelism(Parallelism parallelism) {
+    jacobian_parallelism_ = parallelism;
+  }
+
+  /// Gets the parallelism with which Jacobian matrices are computed.
+  /// @see set_jacobian_parallelism()
+  Parallelism get_jacobian_parallelism() const {
+    return jacobian_parallelism_;
+  }
+
+  /// Sets whether the integrator exploits the sparsity of the Jacobian matrix
+  /// (default is `false`). When `true`, the first Jacobian after this setting
+  /// (or the Jacobian scheme) changes, or after Reset(), is computed densely,
+  /// and its nonzero entries are taken as the sparsity pattern of all
+  /// subsequent Jacobians. The columns are then grouped with a greedy graph
+  /// coloring such that no two columns of a group have a nonzero entry in the
+  /// same row. All of the columns of a group are perturbed at once, which
+  /// takes a single time derivative evaluation per group (two for central
+  /// differencing) rather than per column, or a single AutoDiffXd derivative
+  /// direction per group for kAutomatic.
+  ///
+  /// @warning An entry of the Jacobian that happens to be zero when the
+  /// pattern is detected is assumed to be zero forever after. Only use this
+  /// for systems whose structural sparsity shows at the state where
+  /// integration starts.
+  void set_use_jacobian_sparsity(bool flag) {
+    if (use_jacobian_sparsity_ != flag) {
+      use_jacobian_sparsity_ = flag;
+      jacobian_pattern_.clear();
+      jacobian_column_groups_.clear();
+    }
+  }
+
+  /// Gets whether the integrator exploits the sparsity of the Jacobian matrix.
+  /// @see set_use_jacobian_sparsity()
+  bool get_use_jacobian_sparsity() const { return use_jacobian_sparsity_; }
+
+  /// Sets the maximum number of derivative directions that are seeded in each
+  /// AutoDiffXd evaluation of the time derivatives when the Jacobian scheme is
+  /// kAutomatic. The default of zero seeds all of them (one per state, or one
+  /// per column group, see set_use_jacobian_sparsity()) in a single
+  /// evaluation. Smaller chunks keep the derivative vectors short, and allow
+  /// the chunks to be evaluated in parallel (see set_jacobian_parallelism()).
+  /// @throws std::exception if `chunk_size` is negative.
+  void set_autodiff_jacobian_chunk_size(int chunk_size) {
+    DRAKE_THROW_UNLESS(chunk_size >= 0);
+    autodiff_jacobian_chunk_size_ = chunk_size;
+  }
+
+  /// Gets the maximum number of derivative directions that are seeded in each
+  /// AutoDiffXd evaluation of the time derivatives.
+  /// @see set_autodiff_jacobian_chunk_size()
+  int get_autodiff_jacobian_chunk_size() const {
+    return autodiff_jacobian_chunk_size_;
+  }
+
+  /// Sets whether iteration matrices are factored with a sparse LU
+  /// factorization (default is `false`, i.e., a dense LU factorization). The
+  /// iteration matrix is still formed densely from the (dense) Jacobian, but
+  /// only its nonzero entries are factored, which is much cheaper than the
+  /// O(n³) dense factorization when the Jacobian is large and sparse (e.g.,
+  /// for chains of lumped elements or thermal networks). The symbolic analysis
+  /// (fill-reducing ordering) of the sparse factorization is reused for as
+  /// long as the nonzero pattern of the iteration matrix stays the same. This
+  /// setting pairs well with set_use_jacobian_sparsity(), which makes the
+  /// Jacobian computation cheaper as well. It is ignored when T is AutoDiffXd.
+  /// This function can be safely called at any time; iteration matrices that
+  /// were factored with the other setting are refactored when next used.
+  void set_use_sparse_iteration_matrix(bool flag) {
+    use_sparse_iteration_matrix_ = flag;
+  }
+
+  /// Gets whether iteration matrices are factored with a sparse LU
+  /// factorization.
+  /// @see set_use_sparse_iteration_matrix()
+  bool get_use_sparse_iteration_matrix() const {
+    return use_sparse_iteration_matrix_;
+  }
   /// @}
 
   /// @name Cumulative statistics functions.
@@ -230,8 +324,33 @@ class ImplicitIntegrator : public IntegratorBase<T> {
     /// Returns whether the iteration matrix has been set and factored.
     bool matrix_factored() const { return matrix_factored_; }
 
+    /// Sets whether SetAndFactorIterationMatrix() uses a sparse LU
+    /// factorization (only when T is double). Discards the current
+    /// factorization if the setting changes.
+    /// @see ImplicitIntegrator::set_use_sparse_iteration_matrix()
+    void set_use_sparse_factorization(bool flag) {
+      if (use_sparse_factorization_ != flag) {
+        use_sparse_factorization_ = flag;
+        matrix_factored_ = false;
+      }
+    }
+
+    /// Returns whether SetAndFactorIterationMatrix() uses a sparse LU
+    /// factorization.
+    bool use_sparse_factorization() const { return use_sparse_factorization_; }
+
    private:
+    // Factors the iteration matrix with sparse_LU_, reusing its symbolic
+    // analysis when the nonzero pattern is unchanged. Returns false if the
+    // factorization failed (e.g., because the matrix is structurally
+    // singular), in which case the dense factorization should be used.
+    bool SparseFactor(const MatrixX<double>& iteration_matrix);
+
     bool matrix_factored_{false};
+    bool use_sparse_factorization_{false};
+
+    // Whether the current factorization is sparse_LU_ (rather than LU_).
+    bool sparse_factored_{false};
 
     // A simple LU factorization is all that is needed for ImplicitIntegrator
     // templated on scalar type `double`; robustness in the solve
@@ -239,6 +358,14 @@ class ImplicitIntegrator : public IntegratorBase<T> {
     // serves to minimize heap allocations and deallocations.
     Eigen::PartialPivLU<MatrixX<double>> LU_;
 
+    // The sparse iteration matrix and its factorization, when
+    // use_sparse_factorization_ is set. The nonzero pattern whose symbolic
+    // analysis sparse_LU_ holds is that of sparse_matrix_. SparseLU can be
+    // neither copied nor moved, so it lives on the heap (and is allocated on
+    // first use).
+    Eigen::SparseMatrix<double> sparse_matrix_;
+    std::unique_ptr<Eigen::SparseLU<Eigen::SparseMatrix<double>>> sparse_LU_;
+
     // The only factorization supported by automatic differentiation in Eigen is
     // currently QR. When ImplicitIntegrator is templated on type AutoDiffXd,
     // this will be the factorization that is used.
@@ -497,9 +624,67 @@ class ImplicitIntegrator : public IntegratorBase<T> {
   JacobianComputationScheme jacobian_scheme_{
       JacobianComputationScheme::kForwardDifference};
 
+  // Calls func(group, context) for each group of columns that are perturbed
+  // together when computing the Jacobian around (t, xt), with a Context that
+  // func may modify. The calls are made in parallel per jacobian_parallelism_,
+  // using jacobian_contexts_ (synchronized with `context` first); otherwise
+  // they are made serially, using `context` itself. Since func cannot use
+  // IntegratorBase::EvalTimeDerivatives() concurrently, it evaluates the
+  // System directly, and this adds `evaluations_per_group` derivative
+  // evaluations per group to the statistics instead.
+  template <typename Func>
+  void ForEachJacobianColumnGroup(int n, Context<T>* context,
+                                  int evaluations_per_group, const Func& func);
+
+  // Returns the groups of columns that are perturbed together when computing
+  // an n ✕ n Jacobian: the column groups of the sparsity pattern if known, or
+  // else each column by itself.
+  const std::vector<std::vector<int>>& GetJacobianColumnGroups(int n);
+
+  // Returns true iff the sparsity pattern is known for an n ✕ n Jacobian.
+  bool has_jacobian_pattern(int n) const {
+    return use_jacobian_sparsity_ &&
+           static_cast<int>(jacobian_pattern_.size()) == n &&
+           !jacobian_column_groups_.empty();
+  }
+
+  // Records the nonzero entries of the (dense) Jacobian J as the sparsity
+  // pattern, and colors its columns into groups.
+  void DetectJacobianSparsity(const MatrixX<T>& J);
+
+  // Returns the number of threads to use for computing the Jacobian.
+  int num_jacobian_threads() const;
+
   // The last computed Jacobian matrix.
   MatrixX<T> J_;
 
+  // The settings for parallel and sparse Jacobian computation.
+  Parallelism jacobian_parallelism_;
+  bool use_jacobian_sparsity_{false};
+  int autodiff_jacobian_chunk_size_{0};
+
+  // Whether iteration matrices are factored with a sparse LU factorization.
+  bool use_sparse_iteration_matrix_{false};
+
+  // When use_jacobian_sparsity_ is set, the rows of the nonzero entries of
+  // each column of the Jacobian (jacobian_pattern_[j] for column j, sorted),
+  // and the groups of columns without nonzero rows in common. Empty until the
+  // pattern is detected.
+  std::vector<std::vector<int>> jacobian_pattern_;
+  std::vector<std::vector<int>> jacobian_column_groups_;
+
+  // Storage for GetJacobianColumnGroups() when the pattern is not known.
+  std::vector<std::vector<int>> jacobian_single_columns_;
+
+  // Clones of the integrator's Context for the worker threads computing
+  // finite difference Jacobians in parallel.
+  std::vector<std::unique_ptr<Context<T>>> jacobian_contexts_;
+
+  // The AutoDiffXd version of the system and Contexts for it (one per worker
+  // thread), used by ComputeAutoDiffJacobian(); only when T is double.
+  std::unique_ptr<System<AutoDiffXd>> autodiff_system_;
+  std::vector<std::unique_ptr<Context<AutoDiffXd>>> autodiff_contexts_;
+
   // Indicates whether the Jacobian matrix is fresh. We say the Jacobian is
   // "fresh" if it was last computed at a state (t0, x0) from the beginning of
   // the current step. This indicates to MaybeFreshenMatrices that it should
@@ -11,6 +11,7 @@
 #include "drake/common/drake_assert.h"
 #include "drake/common/drake_bool.h"
 #include "drake/common/drake_copyable.h"
+#include "drake/common/drake_throw.h"
 #include "drake/common/text_logging.h"
 #include "drake/common/trajectories/piecewise_polynomial.h"
 #include "drake/systems/framework/context.h"
@@ -937,6 +938,11 @@ class IntegratorBase {
     // Statistics no longer valid.
     ResetStatistics();
 
+    // Forget the step sizes of any previous integration, so that integrating
+    // from a re-initialized context behaves just like a fresh integration.
+    prev_step_size_ = nan();
+    ideal_next_step_size_ = nan();
+
     // Call the derived integrator initialization routine (if any)
     DoInitialize();
 
@@ -1285,6 +1291,35 @@ class IntegratorBase {
     }
     return std::move(dense_output_);
   }
+
+  /**
+   Bounds the history retained by the dense output to the most recent
+   `history_duration` seconds of integration, so that dense integration over a
+   long simulation (e.g., to evaluate the delayed states of a delay-differential
+   equation) uses bounded memory. Once set, the dense output always covers at
+   least the interval [t - history_duration, t] (or its entire extent, if
+   shorter), where t is the start time of the most recent integration step.
+   Older segments are discarded in batches, whenever they outnumber the
+   retained ones, so the dense output spans at most about twice
+   `history_duration` and the cost of discarding is amortized over the steps.
+
+   The setting applies to the current and any subsequent dense integration. By
+   default, the history is unbounded.
+   @throws std::exception if `history_duration` is not positive.
+   */
+  void set_dense_output_history_duration(const T& history_duration) {
+    DRAKE_THROW_UNLESS(history_duration > 0);
+    dense_output_history_duration_ = history_duration;
+  }
+
+  /**
+   Gets the duration of the dense output history retained by this integrator
+   (infinity if it is unbounded).
+   @see set_dense_output_history_duration()
+   */
+  const T& get_dense_output_history_duration() const {
+    return dense_output_history_duration_;
+  }
   // @}
 
   /**
@@ -1487,6 +1522,7 @@ class IntegratorBase {
     // calls to DoDenseStep().  And we hope that the caching in
     // EvalTimeDerivatives() avoids any cost for the easy case.
     const T start_time = context_->get_time();
+    DiscardStaleDenseOutput(start_time - dense_output_history_duration_);
     VectorX<T> start_state, start_derivatives;
     start_state = state.CopyToVector();
     start_derivatives = EvalTimeDerivatives(*context_).CopyToVector();
@@ -1601,6 +1637,24 @@ class IntegratorBase {
     return DoStep(h);
   }
 
+  // Discards the segments of the dense output that end at or before
+  // `history_start`, but only once they are at least as many as the remaining
+  // segments, so that each segment is copied a bounded number of times. The
+  // history is trimmed relative to the start of a step (rather than its end)
+  // so that it remains valid when the step is rolled back.
+  void DiscardStaleDenseOutput(const T& history_start) {
+    if (dense_output_->empty() ||
+        history_start <= dense_output_->start_time()) {
+      return;
+    }
+    const int num_segments = dense_output_->get_number_of_segments();
+    const int num_stale = dense_output_->get_segment_index(history_start);
+    if (num_stale > 0 && num_stale >= num_segments - num_stale) {
+      *dense_output_ =
+          dense_output_->slice(num_stale, num_segments - num_stale);
+    }
+  }
+
   // Reference to the system being simulated.
   const System<T>& system_;
 
@@ -1610,6 +1664,9 @@ class IntegratorBase {
   // Current dense output.
   std::unique_ptr<trajectories::PiecewisePolynomial<T>> dense_output_{nullptr};
 
+  // The duration of the dense output history to retain.
+  T dense_output_history_duration_{std::numeric_limits<double>::infinity()};
+
   // Runtime variables.
   // For variable step integrators, this is set at the end of each step to guide
   // the next one.
@@ -1,10 +1,13 @@
 #include "drake/systems/analysis/monte_carlo.h"
 
+#include <algorithm>
 #include <future>
 #include <list>
 #include <mutex>
+#include <optional>
 #include <thread>
 
+#include "drake/common/parallel_for.h"
 #include "drake/systems/analysis/simulator.h"
 #include "drake/systems/framework/system.h"
 
@@ -126,6 +129,61 @@ std::vector<RandomSimulationResult> MonteCarloSimulationParallel(
   return simulation_results;
 }
 
+// A Simulator that is reused across the samples run by one worker, along with
+// the time its context should be reset to before each sample.
+struct ReusableSimulator {
+  std::unique_ptr<Simulator<double>> simulator;
+  double initial_time{};
+};
+
+// The state shared by all the workers of the reusing implementation of
+// MonteCarloSimulation. The mutexes guard the generator (along with the
+// sample counter and the stop flag) and the result sink, respectively.
+struct ReusableSimulatorState {
+  std::mutex generator_mutex;
+  RandomGenerator* generator{};
+  int num_samples{};
+  int next_sample{};
+  bool stop{false};
+  std::mutex result_sink_mutex;
+};
+
+// Runs samples on `reusable` until all of them have been dispatched (or
+// another worker has failed).
+void RunSamplesWithReusedSimulator(
+    const ScalarSystemFunction& output, const double final_time,
+    const RandomSimulationResultSink& result_sink,
+    ReusableSimulatorState* shared, ReusableSimulator* reusable) {
+  Simulator<double>& simulator = *reusable->simulator;
+  const System<double>& system = simulator.get_system();
+  Context<double>& context = simulator.get_mutable_context();
+  try {
+    while (true) {
+      context.SetTime(reusable->initial_time);
+      int sample{};
+      std::optional<RandomSimulationResult> result;
+      {
+        std::lock_guard<std::mutex> lock(shared->generator_mutex);
+        if (shared->stop || shared->next_sample == shared->num_samples) {
+          return;
+        }
+        sample = shared->next_sample++;
+        result.emplace(*shared->generator);
+        system.SetRandomContext(&context, shared->generator);
+      }
+      simulator.Initialize();
+      simulator.AdvanceTo(final_time);
+      result->output = output(system, context);
+      std::lock_guard<std::mutex> lock(shared->result_sink_mutex);
+      result_sink(sample, *result);
+    }
+  } catch (...) {
+    std::lock_guard<std::mutex> lock(shared->generator_mutex);
+    shared->stop = true;
+    throw;
+  }
+}
+
 }  // namespace
 
 namespace internal {
@@ -197,6 +255,55 @@ std::vector<RandomSimulationResult> MonteCarloSimulation(
   }
 }
 
+void MonteCarloSimulation(const SimulatorFactory& make_simulator,
+                          const ScalarSystemFunction& output,
+                          const double final_time, const int num_samples,
+                          const RandomSimulationResultSink& result_sink,
+                          RandomGenerator* generator,
+                          const int num_parallel_executions) {
+  DRAKE_THROW_UNLESS(result_sink != nullptr);
+  DRAKE_THROW_UNLESS(num_samples >= 0);
+
+  // Create a generator if the user didn't provide one.
+  std::unique_ptr<RandomGenerator> owned_generator;
+  if (generator == nullptr) {
+    owned_generator = std::make_unique<RandomGenerator>();
+    generator = owned_generator.get();
+  }
+
+  // There is no point in making more simulators than there are samples.
+  const int num_threads = std::min(
+      internal::SelectNumberOfThreadsToUse(num_parallel_executions),
+      std::max(num_samples, 1));
+
+  // Make all of the simulators up front on this thread, so that any
+  // randomness drawn by the factory is drawn in a deterministic order.
+  std::vector<ReusableSimulator> reusables(num_threads);
+  for (ReusableSimulator& reusable : reusables) {
+    reusable.simulator = make_simulator(generator);
+    reusable.initial_time = reusable.simulator->get_context().get_time();
+  }
+
+  ReusableSimulatorState shared;
+  shared.generator = generator;
+  shared.num_samples = num_samples;
+
+  if (num_threads == 1) {
+    RunSamplesWithReusedSimulator(output, final_time, result_sink, &shared,
+                                  &reusables[0]);
+    return;
+  }
+
+  // Each simulator draws samples until there are none left, so if the shared
+  // pool has fewer threads free than requested, the other simulators simply
+  // run fewer samples (or none).
+  drake::internal::ParallelFor(
+      Parallelism(num_threads), num_threads, [&](int i) {
+        RunSamplesWithReusedSimulator(output, final_time, result_sink,
+                                      &shared, &reusables[i]);
+      });
+}
+
 }  // namespace analysis
 }  // namespace systems
 }  // namespace drake
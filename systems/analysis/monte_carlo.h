@@ -179,6 +179,74 @@ std::vector<RandomSimulationResult> MonteCarloSimulation(
     double final_time, int num_samples, RandomGenerator* generator = nullptr,
     int num_parallel_executions = kNoConcurrency);
 
+/**
+ * Defines a sink for the results of MonteCarloSimulation() when they are
+ * streamed instead of accumulated.  It is called exactly once for each sample
+ * with the index of the sample (in `[0, num_samples)`, i.e., its position in
+ * the sequence of samples drawn from the generator) and its result.
+ */
+typedef std::function<void(int sample, const RandomSimulationResult& result)>
+    RandomSimulationResultSink;
+
+/**
+ * Generates samples of a scalar random variable output by running many
+ * random simulations, like the overload above, but reusing one Simulator (and
+ * its Context) per worker thread across samples and streaming each result to
+ * @p result_sink instead of accumulating all of them.  This is intended for
+ * very large numbers of samples, where constructing a new System and
+ * Simulator for every sample would dominate the cost and keeping every
+ * result in memory is not an option.
+ *
+ * In pseudo-code, this algorithm implements:
+ * @code
+ *   for each worker
+ *     simulator = make_simulator(generator)
+ *     initial_time = simulator.get_context().get_time()
+ *   for i=1:num_samples, on any available worker
+ *     simulator.get_mutable_context().SetTime(initial_time)
+ *     const generator_snapshot = deepcopy(generator)
+ *     simulator.get_system().SetRandomContext(generator)
+ *     simulator.Initialize()
+ *     simulator.AdvanceTo(final_time)
+ *     result_sink(i, {generator_snapshot, output(simulator.get_context())})
+ * @endcode
+ *
+ * All of the simulators are created on the calling thread before any sample
+ * is run.  The samples are drawn from @p generator in order (under a lock),
+ * so the result for a given sample index does not depend on the scheduling
+ * of the worker threads.  Note that since the Simulator is reused, the System
+ * cannot be random (only its Context can be) and any state that
+ * SetRandomContext() does not reset (e.g., fixed input port values) carries
+ * over from one sample to the next.  If @p make_simulator does not draw from
+ * its generator, each `generator_snapshot` can be replayed with
+ * RandomSimulation() exactly as for the overload above.
+ *
+ * The worker threads come from Drake's process-wide thread pool, whose size
+ * is Parallelism::Max(). Hence fewer workers than requested may run samples,
+ * e.g., when this is called from within another parallel Drake algorithm.
+ *
+ * @see The overload above for details about the other parameters.
+ *
+ * @param result_sink Receives the result of each sample.  Calls are
+ * serialized (never concurrent), but when parallel execution is specified
+ * they are made from within the worker threads and not in the order of the
+ * samples.
+ *
+ * @throws std::exception if any simulation throws; the remaining workers stop
+ * after their current sample, and @p result_sink is called no more.
+ *
+ * @exclude_from_pydrake_mkdoc{Not bound in pydrake, since parallel execution
+ * of Python systems in multiple threads is not supported.}
+ *
+ * @ingroup analysis
+ */
+void MonteCarloSimulation(const SimulatorFactory& make_simulator,
+                          const ScalarSystemFunction& output, double final_time,
+                          int num_samples,
+                          const RandomSimulationResultSink& result_sink,
+                          RandomGenerator* generator = nullptr,
+                          int num_parallel_executions = kNoConcurrency);
+
 // The below functions are exposed for unit testing only.
 namespace internal {
 
@@ -0,0 +1,156 @@
+#include "drake/systems/analysis/multirate_simulator.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include "drake/common/drake_throw.h"
+#include "drake/common/parallel_for.h"
+
+namespace drake {
+namespace systems {
+template <typename Func>
+void MultirateSimulator::ForEachSubsimulator(const Func& func) {
+  drake::internal::ParallelFor(parallelism_, num_subsimulators(), [&](int i) {
+    func(subsimulators_[i].get());
+  });
+}
+
+MultirateSimulator::MultirateSimulator(double sync_period,
+                                       Parallelism parallelism)
+    : sync_period_(sync_period), parallelism_(parallelism) {
+  DRAKE_THROW_UNLESS(sync_period > 0);
+}
+
+MultirateSimulator::~MultirateSimulator() = default;
+
+int MultirateSimulator::AddSubsimulator(
+    std::unique_ptr<Simulator<double>> subsimulator) {
+  DRAKE_THROW_UNLESS(subsimulator != nullptr);
+  subsimulators_.push_back(std::move(subsimulator));
+  initialization_done_ = false;
+  return num_subsimulators() - 1;
+}
+
+const Simulator<double>& MultirateSimulator::get_subsimulator(int i) const {
+  DRAKE_THROW_UNLESS(0 <= i && i < num_subsimulators());
+  return *subsimulators_[i];
+}
+
+Simulator<double>& MultirateSimulator::get_mutable_subsimulator(int i) {
+  DRAKE_THROW_UNLESS(0 <= i && i < num_subsimulators());
+  return *subsimulators_[i];
+}
+
+int MultirateSimulator::FindSubsimulator(const System<double>& system) const {
+  for (int i = 0; i < num_subsimulators(); ++i) {
+    if (&subsimulators_[i]->get_system() == &system) {
+      return i;
+    }
+  }
+  throw std::logic_error(fmt::format(
+      "MultirateSimulator::Connect(): the system {} is not the system of any "
+      "subsimulator.",
+      system.GetSystemPathname()));
+}
+
+void MultirateSimulator::Connect(const OutputPort<double>& output,
+                                 const InputPort<double>& input) {
+  Connection connection;
+  connection.output = &output;
+  connection.output_subsimulator = FindSubsimulator(output.get_system());
+  connection.input = &input;
+  connection.input_subsimulator = FindSubsimulator(input.get_system());
+  for (const Connection& existing : connections_) {
+    if (existing.input == &input) {
+      throw std::logic_error(fmt::format(
+          "MultirateSimulator::Connect(): the input port {} is already "
+          "connected.",
+          input.GetFullDescription()));
+    }
+  }
+  connection.value = output.Allocate();
+  const std::unique_ptr<AbstractValue> input_value = input.Allocate();
+  const bool sizes_match = output.get_data_type() != kVectorValued ||
+                           output.size() == input.size();
+  if (output.get_data_type() != input.get_data_type() ||
+      connection.value->type_info() != input_value->type_info() ||
+      !sizes_match) {
+    throw std::logic_error(fmt::format(
+        "MultirateSimulator::Connect(): the output port {} (of type {}) cannot "
+        "be connected to the input port {} (of type {}).",
+        output.GetFullDescription(), connection.value->GetNiceTypeName(),
+        input.GetFullDescription(), input_value->GetNiceTypeName()));
+  }
+  connections_.push_back(std::move(connection));
+}
+
+void MultirateSimulator::ExchangePortValues() {
+  // Sample all of the outputs before changing any input, so that the result
+  // does not depend on the order of the connections.
+  for (Connection& connection : connections_) {
+    connection.value->SetFrom(connection.output->Eval<AbstractValue>(
+        subsimulators_[connection.output_subsimulator]->get_context()));
+  }
+  for (const Connection& connection : connections_) {
+    Context<double>& context =
+        subsimulators_[connection.input_subsimulator]->get_mutable_context();
+    const InputPortIndex index = connection.input->get_index();
+    FixedInputPortValue* fixed =
+        context.MaybeGetMutableFixedInputPortValue(index);
+    if (fixed == nullptr) {
+      context.FixInputPort(index, *connection.value);
+    } else {
+      fixed->GetMutableData()->SetFrom(*connection.value);
+    }
+  }
+}
+
+void MultirateSimulator::Initialize() {
+  const double time = get_time();
+  for (int i = 1; i < num_subsimulators(); ++i) {
+    const double time_i = subsimulators_[i]->get_context().get_time();
+    if (time_i != time) {
+      throw std::logic_error(fmt::format(
+          "MultirateSimulator::Initialize(): the time of subsimulator {} ({}) "
+          "differs from the time of subsimulator 0 ({}).",
+          i, time_i, time));
+    }
+  }
+  ExchangePortValues();
+  ForEachSubsimulator([](Simulator<double>* subsimulator) {
+    subsimulator->Initialize();
+  });
+  start_time_ = time;
+  num_syncs_ = 0;
+  initialization_done_ = true;
+}
+
+void MultirateSimulator::AdvanceTo(double boundary_time) {
+  if (!initialization_done_) {
+    Initialize();
+  }
+  DRAKE_THROW_UNLESS(boundary_time >= get_time());
+  while (true) {
+    // Count the synchronization points from the start time to avoid
+    // accumulating round-off.
+    const double sync_time = start_time_ + (num_syncs_ + 1) * sync_period_;
+    const double target_time = std::min(sync_time, boundary_time);
+    ForEachSubsimulator([target_time](Simulator<double>* subsimulator) {
+      subsimulator->AdvanceTo(target_time);
+    });
+    if (target_time < sync_time) {
+      return;
+    }
+    ++num_syncs_;
+    ExchangePortValues();
+    if (target_time == boundary_time) {
+      return;
+    }
+  }
+}
+
+}  // namespace systems
+}  // namespace drake
@@ -0,0 +1,159 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/parallelism.h"
+#include "drake/common/ssize.h"
+#include "drake/common/value.h"
+#include "drake/systems/analysis/simulator.h"
+#include "drake/systems/framework/input_port.h"
+#include "drake/systems/framework/output_port.h"
+
+namespace drake {
+namespace systems {
+
+/// A %MultirateSimulator co-simulates several systems, each advanced by its
+/// own Simulator (a "subsimulator"), which exchange port values only at
+/// synchronization points that are `sync_period` seconds apart. Between
+/// synchronization points, every subsimulator advances independently, with its
+/// own integrator and step sizes; the values of its connected input ports are
+/// held at the values sampled at the most recent synchronization point.
+///
+/// This is intended for models that combine subsystems of very different
+/// rates and costs, e.g., a 1 kHz discrete MultibodyPlant, a 30 Hz camera and
+/// a continuous thermal model. When they are simulated together in one
+/// Diagram, a single integrator advances all of them in lockstep to the
+/// nearest event of any of them, so the slowest or stiffest subsystem dictates
+/// the step sizes of all of them. Splitting them into subsimulators lets each
+/// one advance at its own rate, at the price of a delay of up to `sync_period`
+/// in the signals between them:
+/// @code
+/// MultirateSimulator simulator(1.0 / 30);
+/// simulator.AddSubsimulator(
+///     std::make_unique<Simulator<double>>(plant_diagram));
+/// const int thermal = simulator.AddSubsimulator(
+///     std::make_unique<Simulator<double>>(thermal_model));
+/// simulator.get_mutable_subsimulator(thermal)
+///     .get_mutable_integrator().set_maximum_step_size(0.1);
+/// simulator.Connect(plant_diagram.GetOutputPort("heat"),
+///                   thermal_model.GetInputPort("heat"));
+/// simulator.AdvanceTo(10.0);
+/// @endcode
+///
+/// At each synchronization point, the values of all of the connected output
+/// ports are evaluated first and then copied to their connected input ports (a
+/// "Jacobi" exchange), so that the result does not depend on the order in
+/// which the subsimulators or the connections were added. Hence each connected
+/// output port must be computable from its own subsimulator's context, e.g.,
+/// because it has no direct feedthrough from any connected input port. Input
+/// ports that are not connected must be given values (e.g., with
+/// InputPort::FixValue()) as for any Simulator.
+///
+/// When `parallelism` asks for more than one thread, the subsimulators are
+/// advanced concurrently between synchronization points. This requires their
+/// systems to be thread safe when each thread uses a distinct Context, as is
+/// the case for all Drake systems that do not call back into Python.
+class MultirateSimulator {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(MultirateSimulator)
+
+  /// Creates a %MultirateSimulator with no subsimulators, which synchronizes
+  /// them every `sync_period` seconds.
+  /// @throws std::exception if `sync_period` is not positive.
+  explicit MultirateSimulator(double sync_period,
+                              Parallelism parallelism = false);
+
+  ~MultirateSimulator();
+
+  /// Returns the period at which the subsimulators exchange port values.
+  double get_sync_period() const { return sync_period_; }
+
+  /// Adds `subsimulator`, whose integrator and other settings are left as
+  /// configured by the caller, and returns its index. Initialize() must be
+  /// called (again) after adding a subsimulator.
+  /// @throws std::exception if `subsimulator` is null.
+  int AddSubsimulator(std::unique_ptr<Simulator<double>> subsimulator);
+
+  /// Returns the number of subsimulators.
+  int num_subsimulators() const { return ssize(subsimulators_); }
+
+  /// Returns the subsimulator with index `i`.
+  /// @throws std::exception if `i` is not in [0, num_subsimulators()).
+  const Simulator<double>& get_subsimulator(int i) const;
+
+  /// Returns the mutable subsimulator with index `i`. Like for a Simulator,
+  /// Initialize() must be called after changing the time of its context.
+  /// @throws std::exception if `i` is not in [0, num_subsimulators()).
+  Simulator<double>& get_mutable_subsimulator(int i);
+
+  /// Connects `output`, a port of the system of one subsimulator, to `input`,
+  /// a port of the system of the same or another subsimulator. At every
+  /// synchronization point, the value of `output` is fixed as the value of
+  /// `input`.
+  /// @throws std::exception if either port does not belong to the system of a
+  /// subsimulator, if `input` is already connected, or if the ports differ in
+  /// data type or (for vector-valued ports) in size.
+  void Connect(const OutputPort<double>& output,
+               const InputPort<double>& input);
+
+  /// Returns the (common) time of the subsimulators.
+  /// @throws std::exception if there are no subsimulators.
+  double get_time() const {
+    return get_subsimulator(0).get_context().get_time();
+  }
+
+  /// Exchanges the port values and then initializes every subsimulator (see
+  /// Simulator::Initialize()). The first synchronization period starts at the
+  /// current time. All of the contexts must have the same time.
+  /// @throws std::exception if there are no subsimulators or if the times of
+  /// their contexts differ.
+  void Initialize();
+
+  /// Advances every subsimulator to `boundary_time`, exchanging the port
+  /// values at each synchronization point in (get_time(), `boundary_time`].
+  /// Initialize() is called first if it has not been called yet.
+  /// @throws std::exception if `boundary_time` is less than get_time().
+  void AdvanceTo(double boundary_time);
+
+ private:
+  struct Connection {
+    const OutputPort<double>* output{};
+    int output_subsimulator{};
+    const InputPort<double>* input{};
+    int input_subsimulator{};
+    // The value of `output` sampled at the latest synchronization point.
+    std::unique_ptr<AbstractValue> value;
+  };
+
+  // Calls func(subsimulator) for every subsimulator, in parallel as requested
+  // by parallelism_ (see drake::internal::ParallelFor()).
+  template <typename Func>
+  void ForEachSubsimulator(const Func& func);
+
+  // Returns the index of the subsimulator of `system`.
+  // @throws std::exception if there is no such subsimulator.
+  int FindSubsimulator(const System<double>& system) const;
+
+  // Samples every connected output port, then fixes every connected input port
+  // to its sampled value.
+  void ExchangePortValues();
+
+  const double sync_period_;
+  const Parallelism parallelism_;
+  std::vector<std::unique_ptr<Simulator<double>>> subsimulators_;
+  std::vector<Connection> connections_;
+
+  // The time at which Initialize() was called and the number of
+  // synchronization points since then, which determine the next one without
+  // accumulating round-off.
+  double start_time_{};
+  int64_t num_syncs_{};
+
+  bool initialization_done_{false};
+};
+
+}  // namespace systems
+}  // namespace drake
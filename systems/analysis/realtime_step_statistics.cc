@@ -0,0 +1,61 @@
+#include "drake/systems/analysis/realtime_step_statistics.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "drake/common/drake_throw.h"
+
+namespace drake {
+namespace systems {
+
+void RealtimeStepStatistics::Record(double duration, bool overran) {
+  ++histogram_[GetBin(duration)];
+  ++num_steps_;
+  if (overran) ++num_overruns_;
+  total_duration_ += duration;
+  max_duration_ = std::max(max_duration_, duration);
+}
+
+void RealtimeStepStatistics::Reset() {
+  *this = RealtimeStepStatistics();
+}
+
+double RealtimeStepStatistics::mean_duration() const {
+  return num_steps_ > 0 ? total_duration_ / num_steps_ : 0.0;
+}
+
+double RealtimeStepStatistics::CalcDurationQuantile(double q) const {
+  DRAKE_THROW_UNLESS(0.0 <= q && q <= 1.0);
+  if (num_steps_ == 0) return 0.0;
+  // The quantile is the duration of the k'th shortest step (counting from 1).
+  const int64_t k = std::max<int64_t>(
+      1, static_cast<int64_t>(std::ceil(q * static_cast<double>(num_steps_))));
+  int64_t count = 0;
+  for (int bin = 0; bin < kNumBins; ++bin) {
+    count += histogram_[bin];
+    if (count >= k) {
+      return std::min(GetBinUpperEdge(bin), max_duration_);
+    }
+  }
+  return max_duration_;
+}
+
+int RealtimeStepStatistics::GetBin(double duration) {
+  if (!(duration >= kMinBinnedDuration)) return 0;
+  if (duration >= kMaxBinnedDuration) return kNumBins - 1;
+  const int bin =
+      1 + static_cast<int>(std::floor(
+              kBinsPerDecade * std::log10(duration / kMinBinnedDuration)));
+  // Guard against round-off at the upper edge.
+  return std::min(bin, kNumBins - 2);
+}
+
+double RealtimeStepStatistics::GetBinUpperEdge(int bin) {
+  if (bin == kNumBins - 1) return std::numeric_limits<double>::infinity();
+  return kMinBinnedDuration *
+         std::pow(10.0, static_cast<double>(bin) / kBinsPerDecade);
+}
+
+}  // namespace systems
+}  // namespace drake
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+#include "drake/common/drake_copyable.h"
+
+namespace drake {
+namespace systems {
+
+/// Statistics of the wall clock time taken by the steps of a simulation,
+/// recorded by the Simulator when a step deadline is in effect (see
+/// Simulator::set_step_deadline()). They report the tail latency of the
+/// steps, e.g., for hardware-in-the-loop use, along with the number of steps
+/// that missed the deadline.
+///
+/// The durations are binned into a fixed histogram with logarithmically
+/// spaced bins (kBinsPerDecade per decade, from kMinBinnedDuration to
+/// kMaxBinnedDuration seconds), so that recording a step neither allocates nor
+/// takes time proportional to the number of steps. Consequently, quantiles are
+/// only accurate to within the width of a bin (about 12%); the maximum and mean
+/// are exact.
+class RealtimeStepStatistics {
+ public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(RealtimeStepStatistics)
+
+  /// The number of histogram bins per factor of ten of step duration.
+  static constexpr int kBinsPerDecade = 20;
+
+  /// Durations shorter than this (in seconds) are counted in the first bin.
+  static constexpr double kMinBinnedDuration = 1e-7;
+
+  /// Durations longer than this (in seconds) are counted in the last bin.
+  static constexpr double kMaxBinnedDuration = 1e3;
+
+  /// Constructs empty statistics.
+  RealtimeStepStatistics() = default;
+
+  /// Records a step that took `duration` seconds of wall clock time, and
+  /// whether that was longer than the deadline.
+  void Record(double duration, bool overran);
+
+  /// Discards all recorded steps.
+  void Reset();
+
+  /// Returns the number of recorded steps.
+  int64_t num_steps() const { return num_steps_; }
+
+  /// Returns the number of recorded steps that overran the deadline.
+  int64_t num_overruns() const { return num_overruns_; }
+
+  /// Returns the longest recorded step duration in seconds, or zero if no
+  /// steps were recorded.
+  double max_duration() const { return max_duration_; }
+
+  /// Returns the mean recorded step duration in seconds, or zero if no steps
+  /// were recorded.
+  double mean_duration() const;
+
+  /// Returns the (approximate) `q` quantile of the recorded step durations in
+  /// seconds, e.g., `q = 0.99` for the 99th percentile. This is the upper
+  /// edge of the histogram bin that holds the quantile, but no more than
+  /// max_duration(). Returns zero if no steps were recorded.
+  /// @throws std::exception if `q` is not in [0, 1].
+  double CalcDurationQuantile(double q) const;
+
+ private:
+  static constexpr int kNumBins = 10 * kBinsPerDecade + 2;
+
+  // Returns the histogram bin for a step of the given duration.
+  static int GetBin(double duration);
+
+  // Returns the upper edge of the given histogram bin.
+  static double GetBinUpperEdge(int bin);
+
+  std::array<int64_t, kNumBins> histogram_{};
+  int64_t num_steps_{0};
+  int64_t num_overruns_{0};
+  double total_duration_{0.0};
+  double max_duration_{0.0};
+};
+
+}  // namespace systems
+}  // namespace drake
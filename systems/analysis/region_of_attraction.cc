@@ -1,10 +1,13 @@
 #include "drake/systems/analysis/region_of_attraction.h"
 
 #include <algorithm>
+#include <future>
+#include <memory>
 
 #include "drake/math/continuous_lyapunov_equation.h"
 #include "drake/math/matrix_util.h"
 #include "drake/math/quadratic_form.h"
+#include "drake/solvers/choose_best_solver.h"
 #include "drake/solvers/mathematical_program.h"
 #include "drake/solvers/solve.h"
 #include "drake/systems/primitives/linear_system.h"
@@ -213,6 +216,13 @@ Expression RegionOfAttraction(const System<double>& system,
   const auto x_bar = prog.NewIndeterminates(num_states, "x");
 
   Expression V;
+  // Set iff the user-provided candidate is being certified positive definite.
+  std::future<bool> V_is_positive;
+  const auto check_V_is_positive = [&V_is_positive]() {
+    if (V_is_positive.valid()) {
+      DRAKE_THROW_UNLESS(V_is_positive.get());
+    }
+  };
   bool user_provided_lyapunov_candidate =
       !options.lyapunov_candidate.EqualTo(Expression::Zero());
 
@@ -237,10 +247,22 @@ Expression RegionOfAttraction(const System<double>& system,
     // Check that V has the right Variables.
     DRAKE_THROW_UNLESS(V.GetVariables().IsSubsetOf(Variables(x_bar)));
 
-    // Check that V is positive definite.
-    prog.AddSosConstraint(V);
-    const auto result = Solve(prog);
-    DRAKE_THROW_UNLESS(result.is_success());
+    // Check that V is positive definite. This does not depend on the
+    // level-set search below, so it may run concurrently with it.
+    auto positivity_prog = std::make_shared<MathematicalProgram>();
+    positivity_prog->AddIndeterminates(x_bar);
+    positivity_prog->AddSosConstraint(V);
+    const bool concurrent = options.parallelism.num_threads() > 1 &&
+                            solvers::internal::IsThreadSafe(
+                                solvers::ChooseBestSolver(*positivity_prog));
+    V_is_positive = std::async(
+        concurrent ? std::launch::async : std::launch::deferred,
+        [positivity_prog]() {
+          return Solve(*positivity_prog).is_success();
+        });
+    if (!concurrent) {
+      check_V_is_positive();
+    }
   } else {
     // Solve a Lyapunov equation to find a candidate.
     const auto linearized_system =
@@ -255,25 +277,32 @@ Expression RegionOfAttraction(const System<double>& system,
   // Evaluate the dynamics (in relative coordinates).
   symbolic_context->SetContinuousState(x0 + x_bar);
 
-  if (options.use_implicit_dynamics) {
-    const auto derivatives = symbolic_system->AllocateTimeDerivatives();
-    const solvers::VectorXIndeterminate xdot =
-        prog.NewIndeterminates(derivatives->size(), "xdot");
-    const Expression Vdot = V.Jacobian(x_bar).dot(xdot);
-    derivatives->SetFromVector(xdot.cast<Expression>());
-    VectorX<Expression> g(
-        symbolic_system->implicit_time_derivatives_residual_size());
-    symbolic_system->CalcImplicitTimeDerivativesResidual(*symbolic_context,
-                                                         *derivatives, &g);
-    V = FixedLyapunovConvexImplicit(x_bar, xdot, V, Vdot, g);
-  } else {
-    const VectorX<Expression> f =
-        symbolic_system->EvalTimeDerivatives(*symbolic_context)
-            .get_vector()
-            .CopyToVector();
-    const Expression Vdot = V.Jacobian(x_bar).dot(f);
-    V = FixedLyapunovConvex(x_bar, V, Vdot);
+  // If the level-set search fails, a failure to certify V takes precedence.
+  try {
+    if (options.use_implicit_dynamics) {
+      const auto derivatives = symbolic_system->AllocateTimeDerivatives();
+      const solvers::VectorXIndeterminate xdot =
+          prog.NewIndeterminates(derivatives->size(), "xdot");
+      const Expression Vdot = V.Jacobian(x_bar).dot(xdot);
+      derivatives->SetFromVector(xdot.cast<Expression>());
+      VectorX<Expression> g(
+          symbolic_system->implicit_time_derivatives_residual_size());
+      symbolic_system->CalcImplicitTimeDerivativesResidual(*symbolic_context,
+                                                           *derivatives, &g);
+      V = FixedLyapunovConvexImplicit(x_bar, xdot, V, Vdot, g);
+    } else {
+      const VectorX<Expression> f =
+          symbolic_system->EvalTimeDerivatives(*symbolic_context)
+              .get_vector()
+              .CopyToVector();
+      const Expression Vdot = V.Jacobian(x_bar).dot(f);
+      V = FixedLyapunovConvex(x_bar, V, Vdot);
+    }
+  } catch (...) {
+    check_V_is_positive();
+    throw;
   }
+  check_V_is_positive();
 
   // Put V back into global coordinates.
   Substitution subs;
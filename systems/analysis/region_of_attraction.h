@@ -1,5 +1,6 @@
 #pragma once
 
+#include "drake/common/parallelism.h"
 #include "drake/common/symbolic/expression.h"
 #include "drake/systems/framework/context.h"
 #include "drake/systems/framework/system.h"
@@ -39,6 +40,12 @@ struct RegionOfAttractionOptions {
    * details.
    */
   bool use_implicit_dynamics{false};
+
+  /** When a `lyapunov_candidate` is provided, the program that certifies it
+   * is positive definite is independent of the level-set program, and the two
+   * are solved concurrently if this allows more than one thread and the
+   * chosen solver is thread-safe. */
+  Parallelism parallelism{false};
 };
 
 /**
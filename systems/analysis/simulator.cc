@@ -317,6 +317,8 @@ SimulatorStatus Simulator<T>::AdvanceTo(const T& boundary_time) {
 
     // Delay to match target realtime rate if requested and possible.
     PauseIfTooFast();
+    const TimePoint step_start_realtime =
+        step_deadline_.has_value() ? Clock::now() : TimePoint{};
 
     // The general policy here is to do actions in decreasing order of
     // "violence" to the state, i.e. unrestricted -> discrete -> continuous ->
@@ -428,6 +430,9 @@ SimulatorStatus Simulator<T>::AdvanceTo(const T& boundary_time) {
       if (get_monitor())
         accumulated_event_status.KeepMoreSevere(get_monitor()(*context_));
 
+      // The step is over (in terms of latency).
+      RecordStepRealtime(step_start_realtime);
+
       // If any of the publish event handlers failed, stop now.
       if (HasEventFailureOrMaybeThrow(accumulated_event_status,
                                       true /*throw on failure*/,
@@ -529,6 +534,10 @@ std::optional<T> Simulator<T>::GetCurrentWitnessTimeIsolation() const {
 // trigger over [t0, t0 + ε], time (and corresponding state) will be advanced
 // to some tc in the open interval (t0, tf) such that no witnesses trigger
 // over [t0, tc]; in other words, we deem it "safe" to integrate to tc.
+// The trigger time is first located using a cubic Hermite interpolant of the
+// step over [t0, tf], so that the system is integrated from t0 only once (to
+// the located time) in the common case.
+// @param xdot0 the time derivative of the continuous state at t0.
 // @param[in,out] triggered_witnesses on entry, the set of witness functions
 //                that triggered over [t0, tf]; on exit, the set of witness
 //                functions that triggered over [t0, tw], where tw is some time
@@ -549,16 +558,12 @@ template <class T>
 void Simulator<T>::IsolateWitnessTriggers(
     const std::vector<const WitnessFunction<T>*>& witnesses,
     const VectorX<T>& w0,
-    const T& t0, const VectorX<T>& x0, const T& tf,
+    const T& t0, const VectorX<T>& x0, const VectorX<T>& xdot0, const T& tf,
     std::vector<const WitnessFunction<T>*>* triggered_witnesses) {
 
   // Verify that the vector of triggered witnesses is non-null.
   DRAKE_DEMAND(triggered_witnesses != nullptr);
 
-  // TODO(edrumwri): Speed this process using interpolation between states,
-  // more powerful root finding methods, and/or introducing the concept of
-  // a dead band.
-
   // Will need to alter the context repeatedly.
   Context<T>& context = get_mutable_context();
 
@@ -580,67 +585,118 @@ void Simulator<T>::IsolateWitnessTriggers(
       integrator_->IntegrateNoFurtherThanTime(inf, inf, t_des);
   };
 
-  // Starting from c = (t0 + tf)/2, look for a witness function triggering
-  // over the interval [t0, tc]. Assuming a witness does trigger, c will
-  // continue moving leftward as a witness function triggers until the length of
-  // the time interval is small. If a witness fails to trigger as c moves
-  // leftward, we return, indicating that no witnesses triggered over [t0, c].
-  DRAKE_LOGGER_DEBUG(
-      "Isolating witness functions using isolation window of {} over [{}, {}]",
-      witness_iso_len.value(), t0, tf);
+  // Mini function for setting the state to that of the cubic Hermite
+  // interpolant of the step over [t0, tf], which matches x and dx/dt at both
+  // ends. This costs no more than a few vector operations, whereas
+  // integrate_forward() re-integrates from t0 on every call.
+  const VectorX<T> xf = context.get_continuous_state().CopyToVector();
+  const VectorX<T> xdotf =
+      get_system().EvalTimeDerivatives(context).CopyToVector();
+  VectorX<T> xc(xf.size());
+  std::function<void(const T&)> interpolate =
+      [&t0, &x0, &xdot0, &tf, &xf, &xdotf, &xc, &context](const T& t_des) {
+    const T h = tf - t0;
+    const T s = (t_des - t0) / h;
+    const T s2 = s * s;
+    const T s3 = s2 * s;
+    xc = (2 * s3 - 3 * s2 + 1) * x0 + ((s3 - 2 * s2 + s) * h) * xdot0 +
+         (3 * s2 - 2 * s3) * xf + ((s3 - s2) * h) * xdotf;
+    context.SetTime(t_des);
+    context.SetContinuousState(xc);
+  };
+
+  // Evaluates the witness functions into wc and reports whether any of them
+  // triggered over [t0, tc], where tc is the current time.
   VectorX<T> wc(witnesses.size());
-  T a = t0;
-  T b = tf;
-  do {
-    // Compute the midpoint and evaluate the witness functions at it.
-    T c = (a + b) / 2;
-    DRAKE_LOGGER_DEBUG("Integrating forward to time {}", c);
-    integrate_forward(c);
-
-    // See whether any witness functions trigger.
-    bool trigger = false;
+  auto evaluate_and_check = [&witnesses, &w0, &wc, &context, this]() {
+    EvaluateWitnessFunctions(witnesses, context, &wc);
     for (size_t i = 0; i < witnesses.size(); ++i) {
-      wc[i] = get_system().CalcWitnessValue(context, *witnesses[i]);
       if (witnesses[i]->should_trigger(w0[i], wc[i]))
-        trigger = true;
+        return true;
     }
+    return false;
+  };
 
-    // If no witness function triggered, we can continue integrating forward.
-    if (!trigger) {
-      // NOTE: Since we're always checking that the sign changes over [t0,c],
-      // it's also feasible to replace the two lines below with "a = c" without
-      // violating Simulator's contract to only integrate once over the interval
-      // [a, c], for some c <= b before per-step events are handled (i.e., it's
-      // unacceptable to take two steps of (c - a)/2 without processing per-step
-      // events first). That change would avoid handling unnecessary per-step
-      // events- we know no other events are to be handled between t0 and tf-
-      // but the current logic appears easier to follow.
-      DRAKE_LOGGER_DEBUG("No witness functions triggered up to {}", c);
-      triggered_witnesses->clear();
-      return;  // Time is c.
-    } else {
+  // Starting from c = (t0 + b)/2, look for a witness function triggering
+  // over the interval [t0, tc], using `advance_to` to set the time and state
+  // at c. Assuming a witness does trigger, c will continue moving leftward as a
+  // witness function triggers until the length of the time interval is small.
+  // If a witness fails to trigger as c moves leftward, we return false,
+  // indicating that no witnesses triggered over [t0, c]. On return, the
+  // context is at time c in either case.
+  // NOTE: Since we're always checking that the sign changes over [t0,c],
+  // it's also feasible to move the left end of the interval to c when no
+  // witness triggers without violating Simulator's contract to only integrate
+  // once over the interval [a, c], for some c <= b before per-step events are
+  // handled (i.e., it's unacceptable to take two steps of (c - a)/2 without
+  // processing per-step events first). That change would avoid handling
+  // unnecessary per-step events- we know no other events are to be handled
+  // between t0 and tf- but the current logic appears easier to follow.
+  auto bisect = [&](const std::function<void(const T&)>& advance_to, T b) {
+    do {
+      const T c = (t0 + b) / 2;
+      advance_to(c);
+      if (!evaluate_and_check()) {
+        DRAKE_LOGGER_DEBUG("No witness functions triggered up to {}", c);
+        return false;
+      }
       b = c;
+    } while (b - t0 > witness_iso_len.value());
+    return true;
+  };
+
+  // Determines the set of triggered witnesses from wc.
+  auto collect_triggered = [&]() {
+    triggered_witnesses->clear();
+    for (size_t i = 0; i < witnesses.size(); ++i) {
+      if (witnesses[i]->should_trigger(w0[i], wc[i]))
+        triggered_witnesses->push_back(witnesses[i]);
     }
-  } while (b - a > witness_iso_len.value());
+  };
 
-  // Determine the set of triggered witnesses.
-  triggered_witnesses->clear();
-  for (size_t i = 0; i < witnesses.size(); ++i) {
-    if (witnesses[i]->should_trigger(w0[i], wc[i]))
-      triggered_witnesses->push_back(witnesses[i]);
+  // First locate the trigger time on the interpolant, then integrate once to
+  // that time and check the witnesses against the integrated state, which is
+  // what the contract above is stated in terms of.
+  DRAKE_LOGGER_DEBUG(
+      "Isolating witness functions using isolation window of {} over [{}, {}]",
+      witness_iso_len.value(), t0, tf);
+  bisect(interpolate, tf);
+  const T tc = context.get_time();
+  DRAKE_LOGGER_DEBUG("Integrating forward to time {}", tc);
+  integrate_forward(tc);
+  if (!evaluate_and_check()) {
+    DRAKE_LOGGER_DEBUG("No witness functions triggered up to {}", tc);
+    triggered_witnesses->clear();
+    return;  // Time is tc.
   }
+  if (tc - t0 <= witness_iso_len.value()) {
+    collect_triggered();
+    return;
+  }
+
+  // The interpolant missed a trigger over [t0, tc]; fall back to integrating
+  // to each midpoint over that interval.
+  DRAKE_LOGGER_DEBUG("Interpolation failed to isolate witnesses over [{}, {}]",
+      t0, tc);
+  if (!bisect(integrate_forward, tc)) {
+    triggered_witnesses->clear();
+    return;  // Time is c.
+  }
+  collect_triggered();
 }
 
 // Evaluates the given vector of witness functions.
+// The values are written into `weval`, which is only resized (and so only
+// allocates) when the number of witness functions changes.
 template <class T>
-VectorX<T> Simulator<T>::EvaluateWitnessFunctions(
+void Simulator<T>::EvaluateWitnessFunctions(
     const std::vector<const WitnessFunction<T>*>& witness_functions,
-    const Context<T>& context) const {
+    const Context<T>& context, VectorX<T>* weval) const {
+  DRAKE_ASSERT(weval != nullptr);
   const System<T>& system = get_system();
-  VectorX<T> weval(witness_functions.size());
+  weval->resize(witness_functions.size());
   for (size_t i = 0; i < witness_functions.size(); ++i)
-    weval[i] = system.CalcWitnessValue(context, *witness_functions[i]);
-  return weval;
+    (*weval)[i] = system.CalcWitnessValue(context, *witness_functions[i]);
 }
 
 // Determines whether at least one of a collection of witness functions
@@ -725,17 +781,23 @@ Simulator<T>::IntegrateContinuousState(
   DRAKE_ASSERT(witnessed_events != nullptr);
   witnessed_events->Clear();
 
-  // Save the time and current state.
-  const Context<T>& context = get_context();
-  const T t0 = context.get_time();
-  const VectorX<T> x0 = context.get_continuous_state().CopyToVector();
-
   // Get the set of witness functions active at the current state.
   RedetermineActiveWitnessFunctionsIfNecessary();
   const auto& witness_functions = *witness_functions_;
 
+  // Save the time and, if needed for witness isolation, the current state and
+  // its time derivative. (The integrator evaluates the derivative at the start
+  // of the step anyway, so this comes from the cache.)
+  const Context<T>& context = get_context();
+  const T t0 = context.get_time();
+  VectorX<T> x0, xdot0;
+  if (!witness_functions.empty()) {
+    x0 = context.get_continuous_state().CopyToVector();
+    xdot0 = get_system().EvalTimeDerivatives(context).CopyToVector();
+  }
+
   // Evaluate the witness functions.
-  w0_ = EvaluateWitnessFunctions(witness_functions, context);
+  EvaluateWitnessFunctions(witness_functions, context, &w0_);
 
   // Attempt to integrate. Updates and boundary times are consciously
   // distinguished between. See internal documentation for
@@ -746,7 +808,7 @@ Simulator<T>::IntegrateContinuousState(
   const T tf = context.get_time();
 
   // Evaluate the witness functions again.
-  wf_ = EvaluateWitnessFunctions(witness_functions, context);
+  EvaluateWitnessFunctions(witness_functions, context, &wf_);
 
   // Triggering requires isolating the witness function time.
   if (DidWitnessTrigger(witness_functions, w0_, wf_, &triggered_witnesses_)) {
@@ -755,7 +817,7 @@ Simulator<T>::IntegrateContinuousState(
     // events are only relevant iff at least one witness function is
     // successfully isolated (see IsolateWitnessTriggers() for details).
     IsolateWitnessTriggers(
-        witness_functions, w0_, t0, x0, tf, &triggered_witnesses_);
+        witness_functions, w0_, t0, x0, xdot0, tf, &triggered_witnesses_);
 
     // Store the state at x0 in the temporary continuous state. We only do this
     // if there are triggered witnesses (even though `witness_triggered` is
@@ -856,6 +918,26 @@ void Simulator<T>::PauseIfTooFast() const {
     std::this_thread::sleep_until(desired_realtime);
 }
 
+template <typename T>
+void Simulator<T>::RecordStepRealtime(const TimePoint& step_start_realtime) {
+  if (!step_deadline_.has_value()) return;
+  const double duration = (Clock::now() - step_start_realtime).count();
+  const bool overran = duration > *step_deadline_;
+  realtime_step_statistics_.Record(duration, overran);
+  if (overran && on_step_overrun_ != nullptr) {
+    on_step_overrun_(*context_, duration);
+  }
+}
+
+template <typename T>
+void Simulator<T>::set_step_deadline(
+    double deadline,
+    std::function<void(const Context<T>&, double)> on_overrun) {
+  DRAKE_THROW_UNLESS(deadline > 0);
+  step_deadline_ = deadline;
+  on_step_overrun_ = std::move(on_overrun);
+}
+
 template <typename T>
 double Simulator<T>::get_actual_realtime_rate() const {
   const double simtime_now = ExtractDoubleOrThrow(get_context().get_time());
@@ -872,6 +954,7 @@ void Simulator<T>::ResetStatistics() {
   num_discrete_updates_ = 0;
   num_unrestricted_updates_ = 0;
   num_publishes_ = 0;
+  realtime_step_statistics_.Reset();
 
   initial_simtime_ = ExtractDoubleOrThrow(get_context().get_time());
   initial_realtime_ = Clock::now();
@@ -2,6 +2,7 @@
 
 #include <algorithm>
 #include <chrono>
+#include <functional>
 #include <limits>
 #include <memory>
 #include <optional>
@@ -15,6 +16,7 @@
 #include "drake/common/extract_double.h"
 #include "drake/common/name_value.h"
 #include "drake/systems/analysis/integrator_base.h"
+#include "drake/systems/analysis/realtime_step_statistics.h"
 #include "drake/systems/analysis/simulator_config.h"
 #include "drake/systems/analysis/simulator_status.h"
 #include "drake/systems/framework/context.h"
@@ -533,6 +535,51 @@ class Simulator {
   /// @see set_target_realtime_rate()
   double get_actual_realtime_rate() const;
 
+  /// Sets a deadline on the wall clock time taken by each step of the
+  /// simulation, and starts recording the wall clock time of every step into
+  /// get_realtime_step_statistics(). This supports real-time (e.g.,
+  /// hardware-in-the-loop) use, where the tail latency of the steps matters
+  /// more than the average realtime rate.
+  ///
+  /// The time of a step is measured from the start of its update events (i.e.,
+  /// after any pause made to track the target realtime rate, which is not
+  /// part of the latency) through its publish events and monitor() call. A
+  /// step that takes longer than `deadline` overruns it: it is counted in the
+  /// statistics and, if `on_overrun` is given, `on_overrun` is called at the
+  /// end of the step with the step's final Context and its wall clock time
+  /// in seconds.
+  ///
+  /// @param deadline
+  ///   The deadline in seconds. It may be infinite, to record the step times
+  ///   without ever overrunning.
+  /// @param on_overrun
+  ///   An optional function called after each step that overran the deadline.
+  /// @throws std::exception if `deadline` is not positive.
+  /// @see clear_step_deadline(), get_realtime_step_statistics()
+  void set_step_deadline(
+      double deadline,
+      std::function<void(const Context<T>&, double)> on_overrun = nullptr);
+
+  /// Removes the step deadline (if any), which stops recording the wall clock
+  /// time of the steps. The statistics recorded so far are retained.
+  /// @see set_step_deadline()
+  void clear_step_deadline() {
+    step_deadline_.reset();
+    on_step_overrun_ = nullptr;
+  }
+
+  /// Returns the step deadline in seconds, if one is in effect.
+  /// @see set_step_deadline()
+  std::optional<double> get_step_deadline() const { return step_deadline_; }
+
+  /// Returns the statistics of the wall clock time of the steps taken while a
+  /// step deadline was in effect since the last Initialize() or
+  /// ResetStatistics() call. See PrintSimulatorStatistics() for a summary.
+  /// @see set_step_deadline()
+  const RealtimeStepStatistics& get_realtime_step_statistics() const {
+    return realtime_step_statistics_;
+  }
+
   /// (To be deprecated) Prefer using per-step publish events instead.
   ///
   /// Sets whether the simulation should trigger a forced-Publish event on the
@@ -783,7 +830,7 @@ class Simulator {
   void IsolateWitnessTriggers(
       const std::vector<const WitnessFunction<T>*>& witnesses,
       const VectorX<T>& w0,
-      const T& t0, const VectorX<T>& x0, const T& tf,
+      const T& t0, const VectorX<T>& x0, const VectorX<T>& xdot0, const T& tf,
       std::vector<const WitnessFunction<T>*>* triggered_witnesses);
   void PopulateEventDataForTriggeredWitness(
       const T& t0, const T& tf, const WitnessFunction<T>* witness,
@@ -793,9 +840,9 @@ class Simulator {
     const VectorX<T>& w0,
     const VectorX<T>& wf,
     std::vector<const WitnessFunction<T>*>* triggered_witnesses);
-  VectorX<T> EvaluateWitnessFunctions(
+  void EvaluateWitnessFunctions(
     const std::vector<const WitnessFunction<T>*>& witness_functions,
-    const Context<T>& context) const;
+    const Context<T>& context, VectorX<T>* weval) const;
   void RedetermineActiveWitnessFunctionsIfNecessary();
 
   // The steady_clock is immune to system clock changes so increases
@@ -808,6 +855,11 @@ class Simulator {
   // enough to let real time catch up (approximately).
   void PauseIfTooFast() const;
 
+  // If a step deadline is in effect, records the wall clock time of the step
+  // that started at `step_start_realtime` and just ended, and calls
+  // on_step_overrun_ if it overran the deadline.
+  void RecordStepRealtime(const TimePoint& step_start_realtime);
+
   // A pointer to the integrator.
   std::unique_ptr<IntegratorBase<T>> integrator_;
 
@@ -842,6 +894,13 @@ class Simulator {
   double initial_simtime_{nan()};  // Simulated time at start of period.
   TimePoint initial_realtime_;     // Real time at start of period.
 
+  // The deadline on the wall clock time of each step and the function to call
+  // when it is overrun (user settable), and the statistics of the wall clock
+  // time of the steps since the last statistics reset.
+  std::optional<double> step_deadline_;
+  std::function<void(const Context<T>&, double)> on_step_overrun_;
+  RealtimeStepStatistics realtime_step_statistics_;
+
   // The number of discrete updates since the last statistics reset.
   int64_t num_discrete_updates_{0};
 
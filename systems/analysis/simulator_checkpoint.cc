@@ -0,0 +1,311 @@
+#include "drake/systems/analysis/simulator_checkpoint.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include "drake/common/drake_throw.h"
+
+namespace drake {
+namespace systems {
+
+namespace {
+
+// Identifies a checkpoint file, and the version of its layout.
+constexpr char kMagic[8] = {'D', 'R', 'K', 'C', 'K', 'P', 'T', '\0'};
+constexpr std::uint32_t kVersion = 1;
+
+// Writes the fixed-size `value` verbatim.
+template <typename Scalar>
+void WriteScalar(const Scalar& value, std::ostream* out) {
+  out->write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+void WriteSize(std::int64_t size, std::ostream* out) {
+  WriteScalar(size, out);
+}
+
+void WriteVector(const Eigen::Ref<const Eigen::VectorXd>& value,
+                 std::ostream* out) {
+  WriteSize(value.size(), out);
+  out->write(reinterpret_cast<const char*>(value.data()),
+             value.size() * sizeof(double));
+}
+
+void WriteString(const std::string& value, std::ostream* out) {
+  WriteSize(value.size(), out);
+  out->write(value.data(), value.size());
+}
+
+// Writes the type name of `value` and its serialization, preceded by its
+// length so that the reader can check that it was consumed exactly.
+void WriteAbstract(const AbstractValue& value,
+                   const SimulatorCheckpointSerializers& serializers,
+                   std::ostream* out) {
+  std::ostringstream payload(std::ios::binary);
+  serializers.Write(value, &payload);
+  WriteString(value.GetNiceTypeName(), out);
+  WriteString(std::move(payload).str(), out);
+}
+
+// Reads the values written by the Write functions above from a checkpoint
+// file, throwing if the file ends early.
+class CheckpointReader {
+ public:
+  explicit CheckpointReader(const std::filesystem::path& filename)
+      : filename_(filename), in_(filename, std::ios::binary) {
+    if (!in_) {
+      throw std::runtime_error(
+          fmt::format("LoadSimulatorCheckpoint(): could not open '{}'",
+                      filename_.string()));
+    }
+  }
+
+  template <typename Scalar>
+  Scalar ReadScalar() {
+    Scalar value{};
+    ReadBytes(reinterpret_cast<char*>(&value), sizeof(value));
+    return value;
+  }
+
+  // Reads a size, and checks that it is `expected`; `what` names the value
+  // for the error message.
+  void ReadSize(int expected, const char* what) {
+    const std::int64_t size = ReadScalar<std::int64_t>();
+    if (size != expected) {
+      Fail(fmt::format("the {} has size {} but the Context has size {}", what,
+                       size, expected));
+    }
+  }
+
+  // Reads a vector, and checks that it has the `expected_size`.
+  Eigen::VectorXd ReadVector(int expected_size, const char* what) {
+    ReadSize(expected_size, what);
+    Eigen::VectorXd result(expected_size);
+    ReadBytes(reinterpret_cast<char*>(result.data()),
+              expected_size * sizeof(double));
+    return result;
+  }
+
+  std::string ReadString() {
+    const std::int64_t size = ReadScalar<std::int64_t>();
+    if (size < 0) Fail("the file is corrupt");
+    std::string result(size, '\0');
+    ReadBytes(result.data(), size);
+    return result;
+  }
+
+  void ReadAbstract(const char* what,
+                    const SimulatorCheckpointSerializers& serializers,
+                    AbstractValue* value) {
+    const std::string type_name = ReadString();
+    if (type_name != value->GetNiceTypeName()) {
+      Fail(fmt::format("the {} has type {} but the Context has type {}", what,
+                       type_name, value->GetNiceTypeName()));
+    }
+    std::istringstream payload(ReadString(), std::ios::binary);
+    serializers.Read(&payload, value);
+    if (!payload || payload.peek() != std::char_traits<char>::eof()) {
+      Fail(fmt::format("the serializer for {} did not read back exactly what "
+                       "it wrote",
+                       type_name));
+    }
+  }
+
+  // Checks that the whole file has been read.
+  void ExpectEnd() {
+    if (in_.peek() != std::char_traits<char>::eof()) {
+      Fail("it has unexpected trailing data");
+    }
+  }
+
+  [[noreturn]] void Fail(const std::string& message) const {
+    throw std::runtime_error(
+        fmt::format("LoadSimulatorCheckpoint(): cannot load '{}': {}",
+                    filename_.string(), message));
+  }
+
+ private:
+  void ReadBytes(char* data, std::int64_t size) {
+    in_.read(data, size);
+    if (!in_) Fail("the file ends early");
+  }
+
+  const std::filesystem::path filename_;
+  std::ifstream in_;
+};
+
+}  // namespace
+
+const SimulatorCheckpointSerializers::Entry&
+SimulatorCheckpointSerializers::GetEntry(const AbstractValue& value) const {
+  const auto iter = entries_.find(std::type_index(value.static_type_info()));
+  if (iter == entries_.end()) {
+    throw std::logic_error(fmt::format(
+        "SimulatorCheckpointSerializers: no serializer is registered for the "
+        "abstract value type {}",
+        value.GetNiceTypeName()));
+  }
+  return iter->second;
+}
+
+void SimulatorCheckpointSerializers::Write(const AbstractValue& value,
+                                           std::ostream* out) const {
+  GetEntry(value).write(value, out);
+}
+
+void SimulatorCheckpointSerializers::Read(std::istream* in,
+                                          AbstractValue* value) const {
+  GetEntry(*value).read(in, value);
+}
+
+void SaveSimulatorCheckpoint(
+    const Simulator<double>& simulator, const std::filesystem::path& filename,
+    const SimulatorCheckpointSerializers& serializers) {
+  const Context<double>& context = simulator.get_context();
+
+  // Serialize everything before touching the file, so that a missing
+  // serializer does not leave a partially written checkpoint behind.
+  std::ostringstream out(std::ios::binary);
+  out.write(kMagic, sizeof(kMagic));
+  WriteScalar(kVersion, &out);
+  WriteScalar(context.get_time(), &out);
+  const std::optional<double>& accuracy = context.get_accuracy();
+  WriteScalar<std::uint8_t>(accuracy.has_value(), &out);
+  WriteScalar(accuracy.value_or(0.0), &out);
+  WriteScalar(simulator.get_integrator().get_ideal_next_step_size(), &out);
+
+  WriteVector(context.get_continuous_state_vector().CopyToVector(), &out);
+  const DiscreteValues<double>& xd = context.get_discrete_state();
+  WriteSize(xd.num_groups(), &out);
+  for (int i = 0; i < xd.num_groups(); ++i) {
+    WriteVector(xd.value(i), &out);
+  }
+  const AbstractValues& xa = context.get_abstract_state();
+  WriteSize(xa.size(), &out);
+  for (int i = 0; i < xa.size(); ++i) {
+    WriteAbstract(xa.get_value(i), serializers, &out);
+  }
+  WriteSize(context.num_numeric_parameter_groups(), &out);
+  for (int i = 0; i < context.num_numeric_parameter_groups(); ++i) {
+    WriteVector(context.get_numeric_parameter(i).value(), &out);
+  }
+  WriteSize(context.num_abstract_parameters(), &out);
+  for (int i = 0; i < context.num_abstract_parameters(); ++i) {
+    WriteAbstract(context.get_abstract_parameter(i), serializers, &out);
+  }
+
+  // Write a temporary file next to the target and then rename it over the
+  // target, so that a crash or a full disk never leaves a truncated checkpoint
+  // in place of a good one.
+  std::filesystem::path temp_filename = filename;
+  temp_filename += ".tmp";
+  std::ofstream file(temp_filename, std::ios::binary | std::ios::trunc);
+  const bool created = file.is_open();
+  const std::string contents = std::move(out).str();
+  file.write(contents.data(), contents.size());
+  file.flush();
+  file.close();
+  if (!file) {
+    if (created) {
+      std::error_code ignored;
+      std::filesystem::remove(temp_filename, ignored);
+    }
+    throw std::runtime_error(
+        fmt::format("SaveSimulatorCheckpoint(): could not write '{}'",
+                    temp_filename.string()));
+  }
+  std::error_code error;
+  std::filesystem::rename(temp_filename, filename, error);
+  if (error) {
+    std::error_code ignored;
+    std::filesystem::remove(temp_filename, ignored);
+    throw std::runtime_error(fmt::format(
+        "SaveSimulatorCheckpoint(): could not rename '{}' to '{}': {}",
+        temp_filename.string(), filename.string(), error.message()));
+  }
+}
+
+SimulatorStatus LoadSimulatorCheckpoint(
+    const std::filesystem::path& filename, Simulator<double>* simulator,
+    const SimulatorCheckpointSerializers& serializers) {
+  DRAKE_THROW_UNLESS(simulator != nullptr);
+  CheckpointReader in(filename);
+
+  char magic[sizeof(kMagic)];
+  for (char& c : magic) c = in.ReadScalar<char>();
+  if (!std::equal(magic, magic + sizeof(magic), kMagic)) {
+    in.Fail("it is not a simulator checkpoint");
+  }
+  const auto version = in.ReadScalar<std::uint32_t>();
+  if (version != kVersion) {
+    in.Fail(fmt::format("unsupported version {}", version));
+  }
+
+  // Read the whole checkpoint into a copy of the Context first, so that a
+  // mismatched file leaves the simulator untouched.
+  std::unique_ptr<Context<double>> context = simulator->get_context().Clone();
+  context->SetTime(in.ReadScalar<double>());
+  const bool has_accuracy = in.ReadScalar<std::uint8_t>() != 0;
+  const double accuracy = in.ReadScalar<double>();
+  context->SetAccuracy(has_accuracy ? std::optional<double>(accuracy)
+                                    : std::nullopt);
+  const double next_step_size = in.ReadScalar<double>();
+
+  VectorBase<double>& xc = context->get_mutable_continuous_state_vector();
+  xc.SetFromVector(in.ReadVector(xc.size(), "continuous state"));
+  DiscreteValues<double>& xd = context->get_mutable_discrete_state();
+  in.ReadSize(xd.num_groups(), "number of discrete state groups");
+  for (int i = 0; i < xd.num_groups(); ++i) {
+    BasicVector<double>& group = xd.get_mutable_vector(i);
+    group.SetFromVector(in.ReadVector(group.size(), "discrete state group"));
+  }
+  AbstractValues& xa = context->get_mutable_abstract_state();
+  in.ReadSize(xa.size(), "number of abstract states");
+  for (int i = 0; i < xa.size(); ++i) {
+    in.ReadAbstract("abstract state", serializers, &xa.get_mutable_value(i));
+  }
+  in.ReadSize(context->num_numeric_parameter_groups(),
+              "number of numeric parameters");
+  for (int i = 0; i < context->num_numeric_parameter_groups(); ++i) {
+    BasicVector<double>& parameter = context->get_mutable_numeric_parameter(i);
+    parameter.SetFromVector(
+        in.ReadVector(parameter.size(), "numeric parameter"));
+  }
+  in.ReadSize(context->num_abstract_parameters(),
+              "number of abstract parameters");
+  for (int i = 0; i < context->num_abstract_parameters(); ++i) {
+    in.ReadAbstract("abstract parameter", serializers,
+                    &context->get_mutable_abstract_parameter(i));
+  }
+  in.ExpectEnd();
+
+  simulator->get_mutable_context().SetTimeStateAndParametersFrom(*context);
+
+  // Resume an error-controlled integrator from the step size it would have
+  // attempted next, rather than from a fresh estimate.
+  IntegratorBase<double>& integrator = simulator->get_mutable_integrator();
+  if (std::isfinite(next_step_size) && integrator.supports_error_estimation()) {
+    integrator.request_initial_step_size_target(
+        std::min(integrator.get_maximum_step_size(),
+                 std::max(integrator.get_requested_minimum_step_size(),
+                          next_step_size)));
+  }
+
+  // Initialize() recomputes the pending timed and periodic events from the
+  // restored time.
+  return simulator->Initialize({.suppress_initialization_events = true});
+}
+
+}  // namespace systems
+}  // namespace drake
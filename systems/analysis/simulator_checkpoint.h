@@ -0,0 +1,139 @@
+#pragma once
+
+#include <filesystem>
+#include <functional>
+#include <istream>
+#include <ostream>
+#include <type_traits>
+#include <typeindex>
+#include <unordered_map>
+#include <utility>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/value.h"
+#include "drake/systems/analysis/simulator.h"
+
+namespace drake {
+namespace systems {
+
+/// The functions that SaveSimulatorCheckpoint() and LoadSimulatorCheckpoint()
+/// use to write and read the abstract state and abstract parameters of a
+/// Context. Numeric values need no serializers; every abstract value in the
+/// Context must have the type of a registered serializer.
+/// @code
+/// SimulatorCheckpointSerializers serializers;
+/// serializers.RegisterTriviallyCopyable<int>();
+/// serializers.Register<std::string>(
+///     [](const std::string& value, std::ostream* out) {...},
+///     [](std::istream* in, std::string* value) {...});
+/// @endcode
+class SimulatorCheckpointSerializers {
+ public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(SimulatorCheckpointSerializers)
+
+  /// Writes `value` to the stream. The writer may write any number of bytes.
+  template <typename ValueType>
+  using Writer = std::function<void(const ValueType& value, std::ostream*)>;
+
+  /// Reads back into `value` what the matching Writer wrote. The reader must
+  /// consume exactly the bytes that the writer wrote.
+  template <typename ValueType>
+  using Reader = std::function<void(std::istream*, ValueType* value)>;
+
+  /// Creates an empty set of serializers.
+  SimulatorCheckpointSerializers() = default;
+
+  /// Registers the functions that write and read abstract values of type
+  /// `ValueType`, replacing any previously registered for that type.
+  template <typename ValueType>
+  void Register(Writer<ValueType> writer, Reader<ValueType> reader) {
+    Entry& entry = entries_[std::type_index(typeid(ValueType))];
+    entry.write = [writer = std::move(writer)](const AbstractValue& value,
+                                               std::ostream* out) {
+      writer(value.get_value<ValueType>(), out);
+    };
+    entry.read = [reader = std::move(reader)](std::istream* in,
+                                              AbstractValue* value) {
+      reader(in, &value->get_mutable_value<ValueType>());
+    };
+  }
+
+  /// Registers serializers for `ValueType` that copy its bytes verbatim.
+  template <typename ValueType>
+  void RegisterTriviallyCopyable() {
+    static_assert(std::is_trivially_copyable_v<ValueType>);
+    Register<ValueType>(
+        [](const ValueType& value, std::ostream* out) {
+          out->write(reinterpret_cast<const char*>(&value), sizeof(value));
+        },
+        [](std::istream* in, ValueType* value) {
+          in->read(reinterpret_cast<char*>(value), sizeof(*value));
+        });
+  }
+
+  /// (Internal use only) Writes `value` using the registered serializer.
+  /// @throws std::exception if none is registered for its type.
+  void Write(const AbstractValue& value, std::ostream* out) const;
+
+  /// (Internal use only) Reads into `value` using the registered serializer.
+  /// @throws std::exception if none is registered for its type.
+  void Read(std::istream* in, AbstractValue* value) const;
+
+ private:
+  struct Entry {
+    std::function<void(const AbstractValue&, std::ostream*)> write;
+    std::function<void(std::istream*, AbstractValue*)> read;
+  };
+
+  const Entry& GetEntry(const AbstractValue& value) const;
+
+  std::unordered_map<std::type_index, Entry> entries_;
+};
+
+/// Writes a binary checkpoint of `simulator` to `filename`, so that a long
+/// simulation can later be resumed, possibly in another process, with
+/// LoadSimulatorCheckpoint(). The checkpoint holds the time, accuracy, all
+/// state, and all parameters of the simulator's (root) Context, plus the
+/// integrator's next step size, so that a resumed error-controlled integrator
+/// takes the same steps as the original one would have.
+///
+/// Timed and periodic events are not stored: they are functions of time, so
+/// LoadSimulatorCheckpoint() recomputes them from the saved time. Fixed input
+/// port values are not stored, consistent with
+/// Context::SetTimeStateAndParametersFrom(); the loading code must fix them
+/// again, as it did for the original simulation.
+///
+/// The file format is a private detail; it is only meant to be read back by
+/// the same build of Drake, on a machine with the same byte order.
+///
+/// The checkpoint is first written to `filename` + ".tmp" and then renamed
+/// over `filename`, so an existing checkpoint there is only ever replaced by
+/// a complete one.
+///
+/// @pre Initialize() or AdvanceTo() has been called on `simulator`.
+/// @throws std::exception if any abstract value in the Context has no
+///   registered serializer, or if the file cannot be written.
+void SaveSimulatorCheckpoint(
+    const Simulator<double>& simulator, const std::filesystem::path& filename,
+    const SimulatorCheckpointSerializers& serializers = {});
+
+/// Restores the checkpoint in `filename` (written by SaveSimulatorCheckpoint())
+/// into the Context of `simulator`, and re-initializes `simulator` without
+/// dispatching initialization events, so that AdvanceTo() then continues
+/// exactly as the original simulation would have. Publish events that were
+/// due at the saved time are dispatched again by that re-initialization.
+///
+/// `simulator` must be for the same System as the one that was saved (or one
+/// with identically structured Contexts), with its integrator configured the
+/// same way.
+///
+/// @returns the status of the re-initialization (see Simulator::Initialize()).
+/// @throws std::exception if the file cannot be read, is not a checkpoint,
+///   does not match the structure of the simulator's Context, or holds an
+///   abstract value with no registered serializer.
+SimulatorStatus LoadSimulatorCheckpoint(
+    const std::filesystem::path& filename, Simulator<double>* simulator,
+    const SimulatorCheckpointSerializers& serializers = {});
+
+}  // namespace systems
+}  // namespace drake
@@ -9,6 +9,7 @@
 #include "drake/common/nice_type_name.h"
 #include "drake/systems/analysis/implicit_integrator.h"
 #include "drake/systems/analysis/integrator_base.h"
+#include "drake/systems/analysis/realtime_step_statistics.h"
 #include "drake/systems/analysis/simulator.h"
 
 namespace drake {
@@ -39,6 +40,28 @@ void PrintSimulatorStatistics(const Simulator<T>& simulator) {
   fmt::print("Number of \"unrestricted\" updates = {:d}\n",
       simulator.get_num_unrestricted_updates());
 
+  const RealtimeStepStatistics& realtime_stats =
+      simulator.get_realtime_step_statistics();
+  if (realtime_stats.num_steps() > 0) {
+    // Only the steps taken while a step deadline was in effect are timed.
+    fmt::print("\nStats regarding the wall clock time of {:d} steps:\n",
+               realtime_stats.num_steps());
+    if (simulator.get_step_deadline().has_value()) {
+      fmt::print("Step deadline = {:10.6g} s\n",
+                 *simulator.get_step_deadline());
+    }
+    fmt::print("Number of deadline overruns = {:d}\n",
+               realtime_stats.num_overruns());
+    fmt::print("Mean step time = {:10.6g} s\n",
+               realtime_stats.mean_duration());
+    fmt::print("Median (p50) step time = {:10.6g} s\n",
+               realtime_stats.CalcDurationQuantile(0.5));
+    fmt::print("p99 step time = {:10.6g} s\n",
+               realtime_stats.CalcDurationQuantile(0.99));
+    fmt::print("Largest step time = {:10.6g} s\n",
+               realtime_stats.max_duration());
+  }
+
   if (integrator.get_num_steps_taken() == 0) {
     fmt::print("\nNote: the following integrator took zero steps. The "
                "simulator exclusively used the discrete solver.\n");
@@ -0,0 +1,146 @@
+#include "drake/systems/analysis/batched_simulator.h"
+
+#include <memory>
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/expect_throws_message.h"
+#include "drake/systems/analysis/simulator.h"
+#include "drake/systems/primitives/linear_system.h"
+
+namespace drake {
+namespace systems {
+namespace {
+
+constexpr int kNumEnvironments = 5;
+
+// A damped oscillator xₙ₊₁ = A xₙ + B uₙ, y = xₙ, updated every 0.1 seconds
+// (or its continuous counterpart, when time_period is zero).
+std::unique_ptr<LinearSystem<double>> MakeOscillator(double time_period) {
+  Eigen::Matrix2d A;
+  A << 0.9, 0.2, -0.2, 0.9;
+  const Eigen::Vector2d B(0.0, 0.1);
+  return std::make_unique<LinearSystem<double>>(
+      A, B, Eigen::Matrix2d::Identity(), Eigen::Vector2d::Zero(), time_period);
+}
+
+void SetInitialState(int i, Context<double>* context) {
+  const Eigen::Vector2d x0(1.0 + i, -0.5 * i);
+  if (context->num_continuous_states() > 0) {
+    context->SetContinuousState(x0);
+  } else {
+    context->SetDiscreteState(x0);
+  }
+}
+
+Eigen::MatrixXd Actions(double scale) {
+  return scale * Eigen::RowVectorXd::LinSpaced(kNumEnvironments, -1.0, 1.0);
+}
+
+// Advances a separate Simulator for each environment, with the same initial
+// conditions and actions as the BatchedSimulator under test, through the same
+// sequence of boundary times, and returns the final outputs.
+Eigen::MatrixXd SimulateOneByOne(const LinearSystem<double>& system) {
+  Eigen::MatrixXd outputs(2, kNumEnvironments);
+  for (int i = 0; i < kNumEnvironments; ++i) {
+    Simulator<double> simulator(system);
+    Context<double>& context = simulator.get_mutable_context();
+    SetInitialState(i, &context);
+    system.get_input_port().FixValue(&context, Actions(1.0).col(i).eval());
+    simulator.AdvanceTo(0.55);
+    system.get_input_port().FixValue(&context, Actions(2.0).col(i).eval());
+    simulator.AdvanceTo(1.0);
+    simulator.AdvanceTo(1.32);
+    outputs.col(i) = system.get_output_port().Eval(context);
+  }
+  return outputs;
+}
+
+Eigen::MatrixXd SimulateBatched(const LinearSystem<double>& system,
+                                const BatchedSimulatorOptions& options) {
+  BatchedSimulator batched(system, kNumEnvironments, options);
+  EXPECT_EQ(&batched.get_system(), &system);
+  EXPECT_EQ(batched.num_environments(), kNumEnvironments);
+  for (int i = 0; i < kNumEnvironments; ++i) {
+    SetInitialState(i, &batched.get_mutable_context(i));
+  }
+  batched.SetActions(system.get_input_port(), Actions(1.0));
+  batched.AdvanceTo(0.55);
+  EXPECT_EQ(batched.get_time(), 0.55);
+  // Changing the actions reuses the already fixed input port values.
+  const FixedInputPortValue* fixed =
+      batched.get_context(0).MaybeGetFixedInputPortValue(0);
+  batched.SetActions(system.get_input_port(), Actions(2.0));
+  EXPECT_EQ(batched.get_context(0).MaybeGetFixedInputPortValue(0), fixed);
+  batched.AdvanceTo(1.0);
+  batched.AdvanceTo(1.32);
+  for (int i = 0; i < kNumEnvironments; ++i) {
+    EXPECT_EQ(batched.get_context(i).get_time(), 1.32);
+  }
+  return batched.CalcObservations(system.get_output_port());
+}
+
+// Every mode of the BatchedSimulator produces the same results as advancing
+// each environment with its own Simulator.
+GTEST_TEST(BatchedSimulatorTest, DiscreteMatchesSimulator) {
+  const auto system = MakeOscillator(0.1);
+  const Eigen::MatrixXd expected = SimulateOneByOne(*system);
+  for (const bool batched_update : {false, true}) {
+    for (const int num_threads : {1, 2}) {
+      SCOPED_TRACE(fmt::format("batched_update = {}, num_threads = {}",
+                               batched_update, num_threads));
+      BatchedSimulatorOptions options;
+      options.parallelism = Parallelism(num_threads);
+      options.use_batched_discrete_update = batched_update;
+      const Eigen::MatrixXd observations = SimulateBatched(*system, options);
+      ASSERT_EQ(observations.rows(), 2);
+      ASSERT_EQ(observations.cols(), kNumEnvironments);
+      EXPECT_TRUE(observations == expected);
+    }
+  }
+}
+
+GTEST_TEST(BatchedSimulatorTest, ContinuousMatchesSimulator) {
+  const auto system = MakeOscillator(0.0);
+  const Eigen::MatrixXd expected = SimulateOneByOne(*system);
+  for (const int num_threads : {1, 2}) {
+    BatchedSimulatorOptions options;
+    options.parallelism = Parallelism(num_threads);
+    EXPECT_TRUE(SimulateBatched(*system, options) == expected);
+  }
+}
+
+GTEST_TEST(BatchedSimulatorTest, Errors) {
+  const auto discrete = MakeOscillator(0.1);
+  const auto continuous = MakeOscillator(0.0);
+  EXPECT_THROW(BatchedSimulator(*discrete, 0), std::exception);
+
+  BatchedSimulatorOptions options;
+  options.use_batched_discrete_update = true;
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      BatchedSimulator(*continuous, kNumEnvironments, options),
+      ".*does not have a unique periodic discrete update, 2 continuous.*");
+
+  BatchedSimulator batched(*discrete, kNumEnvironments, options);
+  EXPECT_THROW(batched.get_context(kNumEnvironments), std::exception);
+  EXPECT_THROW(batched.SetActions(discrete->get_input_port(),
+                                  Eigen::MatrixXd::Zero(2, kNumEnvironments)),
+               std::exception);
+  EXPECT_THROW(batched.SetActions(continuous->get_input_port(),
+                                  Actions(1.0)),
+               std::exception);
+  EXPECT_THROW(batched.CalcObservations(continuous->get_output_port()),
+               std::exception);
+
+  batched.get_mutable_context(1).SetTime(0.5);
+  DRAKE_EXPECT_THROWS_MESSAGE(batched.Initialize(),
+                              ".*time of environment 1 .* differs.*");
+  batched.get_mutable_context(1).SetTime(0.0);
+  batched.AdvanceTo(0.5);
+  EXPECT_THROW(batched.AdvanceTo(0.25), std::exception);
+}
+
+}  // namespace
+}  // namespace systems
+}  // namespace drake
@@ -0,0 +1,169 @@
+#include "drake/systems/analysis/forward_sensitivity_simulator.h"
+
+#include <cmath>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
+#include "drake/systems/analysis/simulator.h"
+#include "drake/systems/framework/leaf_system.h"
+#include "drake/systems/primitives/linear_system.h"
+
+namespace drake {
+namespace systems {
+namespace {
+
+using Eigen::MatrixXd;
+using Eigen::Vector2d;
+using Eigen::VectorXd;
+
+// The decay ẋ = -a x + b of two states towards b / a, where the rate a and
+// the target b are numeric parameters in separate groups.
+template <typename T>
+class Decay final : public LeafSystem<T> {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(Decay);
+
+  Decay() : LeafSystem<T>(SystemTypeTag<Decay>{}) {
+    this->DeclareContinuousState(2);
+    this->DeclareNumericParameter(BasicVector<T>(Vector1<T>(0.5)));
+    this->DeclareNumericParameter(BasicVector<T>(Vector1<T>(0.2)));
+  }
+
+  template <typename U>
+  explicit Decay(const Decay<U>&) : Decay() {}
+
+ private:
+  void DoCalcTimeDerivatives(const Context<T>& context,
+                             ContinuousState<T>* derivatives) const final {
+    const T& a = context.get_numeric_parameter(0)[0];
+    const T& b = context.get_numeric_parameter(1)[0];
+    const VectorX<T> x = context.get_continuous_state_vector().CopyToVector();
+    derivatives->SetFromVector(-a * x + VectorX<T>::Constant(2, b));
+  }
+};
+
+GTEST_TEST(ForwardSensitivitySimulatorTest, Continuous) {
+  const Decay<double> system;
+  auto context = system.CreateDefaultContext();
+  const Vector2d x0(1.0, -2.0);
+  context->SetContinuousState(x0);
+  context->SetTime(0.5);
+
+  // The full Jacobian with respect to [x₀; a; b].
+  ForwardSensitivitySimulator dut(system, *context, MatrixXd::Identity(4, 4));
+  EXPECT_EQ(&dut.get_system(), &system);
+  EXPECT_EQ(dut.num_states(), 2);
+  EXPECT_EQ(dut.num_parameters(), 2);
+  EXPECT_EQ(dut.num_directions(), 4);
+  dut.AdvanceTo(0.5);
+  EXPECT_EQ(dut.get_time(), 0.5);
+  EXPECT_EQ(dut.get_state(), x0);
+  EXPECT_EQ(dut.get_sensitivities(), MatrixXd::Identity(2, 4));
+  dut.AdvanceTo(1.5);
+  dut.AdvanceTo(2.5);
+  EXPECT_EQ(dut.get_time(), 2.5);
+
+  const double a = 0.5;
+  const double b = 0.2;
+  const double t = 2.0;
+  const double e = std::exp(-a * t);
+  const Vector2d x_expected = (x0 - Vector2d::Constant(b / a)) * e +
+                              Vector2d::Constant(b / a);
+  MatrixXd S_expected(2, 4);
+  S_expected.leftCols(2) = e * Eigen::Matrix2d::Identity();
+  S_expected.col(2) = -b / (a * a) * (1 - e) * Vector2d::Ones() -
+                      t * (x0 - Vector2d::Constant(b / a)) * e;
+  S_expected.col(3) = (1 - e) / a * Vector2d::Ones();
+  const double kTolerance = 1e-5;
+  EXPECT_TRUE(CompareMatrices(dut.get_state(), x_expected, kTolerance));
+  EXPECT_TRUE(CompareMatrices(dut.get_sensitivities(), S_expected, kTolerance));
+
+  // A single direction gives the corresponding combination of the columns.
+  const Eigen::Vector4d direction(1.0, 0.0, -2.0, 3.0);
+  ForwardSensitivitySimulator single(system, *context, direction);
+  EXPECT_EQ(single.num_directions(), 1);
+  single.AdvanceTo(2.5);
+  EXPECT_TRUE(CompareMatrices(single.get_sensitivities(),
+                              S_expected * direction, kTolerance));
+
+  // The integrator can be tuned.
+  ForwardSensitivitySimulator tight(system, *context);
+  EXPECT_EQ(tight.num_directions(), 2);
+  tight.get_mutable_integrator().set_target_accuracy(1e-10);
+  tight.AdvanceTo(2.5);
+  EXPECT_TRUE(CompareMatrices(tight.get_sensitivities(),
+                              S_expected.leftCols(2), 1e-8));
+
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      ForwardSensitivitySimulator(system, *context, MatrixXd::Identity(3, 3)),
+      ".*one row per state and numeric parameter \\(2 \\+ 2\\), but have 3.*");
+  DRAKE_EXPECT_THROWS_MESSAGE(dut.AdvanceTo(2.0), ".*boundary_time >=.*");
+}
+
+// For a discrete linear system xₙ₊₁ = A xₙ + B u, the sensitivities with
+// respect to the initial state are Aⁿ after n updates.
+GTEST_TEST(ForwardSensitivitySimulatorTest, Discrete) {
+  Eigen::Matrix2d A;
+  A << 0.9, 0.2, -0.2, 0.9;
+  const LinearSystem<double> system(A, Vector2d(0.0, 0.1),
+                                    Eigen::Matrix2d::Identity(),
+                                    Vector2d::Zero(), 0.1);
+  Simulator<double> simulator(system);
+  Context<double>& context = simulator.get_mutable_context();
+  context.SetDiscreteState(Vector2d(1.0, -0.5));
+  system.get_input_port().FixValue(&context, Vector1d(2.0));
+
+  ForwardSensitivitySimulator dut(system, context);
+  EXPECT_EQ(dut.num_states(), 2);
+  EXPECT_EQ(dut.num_parameters(), 0);
+  EXPECT_THROW(dut.get_mutable_integrator(), std::exception);
+  dut.AdvanceTo(0.55);
+  dut.AdvanceTo(1.0);
+  simulator.AdvanceTo(1.0);
+  EXPECT_EQ(dut.get_time(), 1.0);
+
+  // The updates at 0, 0.1, ..., 0.9.
+  Eigen::Matrix2d A_n = Eigen::Matrix2d::Identity();
+  for (int n = 0; n < 10; ++n) {
+    A_n = A * A_n;
+  }
+  const double kTolerance = 1e-14;
+  EXPECT_TRUE(CompareMatrices(dut.get_state(),
+                              context.get_discrete_state_vector().value(),
+                              kTolerance));
+  EXPECT_TRUE(CompareMatrices(dut.get_sensitivities(), A_n, kTolerance));
+}
+
+// A system with both continuous and discrete state.
+class Mixed final : public LeafSystem<double> {
+ public:
+  Mixed() {
+    this->DeclareContinuousState(1);
+    this->DeclareDiscreteState(1);
+  }
+};
+
+// A system with discrete state that is never updated.
+class Frozen final : public LeafSystem<double> {
+ public:
+  Frozen() { this->DeclareDiscreteState(1); }
+};
+
+GTEST_TEST(ForwardSensitivitySimulatorTest, Unsupported) {
+  const Mixed mixed;
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      ForwardSensitivitySimulator(mixed, *mixed.CreateDefaultContext()),
+      ".*continuous state must not have discrete or abstract state.*1 "
+      "discrete state group.*");
+
+  const Frozen frozen;
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      ForwardSensitivitySimulator(frozen, *frozen.CreateDefaultContext()),
+      ".*requires a unique periodic discrete update.*does not have.*");
+}
+
+}  // namespace
+}  // namespace systems
+}  // namespace drake
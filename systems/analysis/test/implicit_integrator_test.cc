@@ -2,7 +2,9 @@
 
 #include <gtest/gtest.h>
 
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
 #include "drake/systems/analysis/test_utilities/spring_mass_system.h"
+#include "drake/systems/framework/leaf_system.h"
 
 using Eigen::VectorXd;
 
@@ -21,6 +23,7 @@ class DummyImplicitIntegrator final : public ImplicitIntegrator<double> {
   bool supports_error_estimation() const override { return false; }
   int get_error_estimate_order() const override { return 0; }
 
+  using ImplicitIntegrator<double>::CalcJacobian;
   using ImplicitIntegrator<double>::IsUpdateZero;
 
   // Returns whether DoResetCachedMatrices() has been called.
@@ -135,6 +138,121 @@ GTEST_TEST(ImplicitIntegratorTest, SetComputationSchemeResetsCachedMatrices) {
             ImplicitIntegrator<double>
             ::JacobianComputationScheme::kAutomatic);
 }
+
+// A set of uncoupled damped pendulums, whose Jacobian is block diagonal.
+template <typename T>
+class PendulumChain final : public LeafSystem<T> {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(PendulumChain)
+  explicit PendulumChain(int num_pendulums)
+      : LeafSystem<T>(SystemTypeTag<PendulumChain>{}),
+        num_pendulums_(num_pendulums) {
+    this->DeclareContinuousState(2 * num_pendulums);
+  }
+
+  template <typename U>
+  explicit PendulumChain(const PendulumChain<U>& other)
+      : PendulumChain(other.num_pendulums()) {}
+
+  int num_pendulums() const { return num_pendulums_; }
+
+ private:
+  void DoCalcTimeDerivatives(const Context<T>& context,
+                             ContinuousState<T>* derivatives) const final {
+    using std::sin;
+    const VectorX<T> x = context.get_continuous_state_vector().CopyToVector();
+    VectorX<T> xdot(x.size());
+    for (int i = 0; i < num_pendulums_; ++i) {
+      const T& theta = x(2 * i);
+      const T& omega = x(2 * i + 1);
+      xdot(2 * i) = omega;
+      xdot(2 * i + 1) = -(i + 1.0) * sin(theta) - 0.1 * omega;
+    }
+    derivatives->SetFromVector(xdot);
+  }
+
+  const int num_pendulums_;
+};
+
+// Checks that parallel, sparse and chunked Jacobians match the serial, dense
+// ones, and that exploiting sparsity takes fewer derivative evaluations.
+GTEST_TEST(ImplicitIntegratorTest, ParallelAndSparseJacobians) {
+  using Scheme = ImplicitIntegrator<double>::JacobianComputationScheme;
+  const int kNumPendulums = 4;
+  const int n = 2 * kNumPendulums;
+  PendulumChain<double> system(kNumPendulums);
+  std::unique_ptr<Context<double>> context = system.CreateDefaultContext();
+  const VectorXd x = VectorXd::LinSpaced(n, -1.0, 2.0);
+  context->SetContinuousState(x);
+
+  for (const Scheme scheme : {Scheme::kForwardDifference,
+                              Scheme::kCentralDifference, Scheme::kAutomatic}) {
+    const int evaluations_per_direction =
+        (scheme == Scheme::kCentralDifference) ? 2 : 1;
+    DummyImplicitIntegrator dense(system, context.get());
+    dense.set_jacobian_computation_scheme(scheme);
+    const MatrixX<double> expected = dense.CalcJacobian(0.0, x);
+    ASSERT_EQ(expected.rows(), n);
+    ASSERT_EQ(expected.cols(), n);
+
+    const double tolerance = (scheme == Scheme::kAutomatic) ? 0.0 : 1e-6;
+    for (const int num_threads : {1, 2}) {
+      for (const int chunk_size : {0, 3}) {
+        DummyImplicitIntegrator dut(system, context.get());
+        dut.set_jacobian_computation_scheme(scheme);
+        dut.set_jacobian_parallelism(Parallelism(num_threads));
+        dut.set_autodiff_jacobian_chunk_size(chunk_size);
+        dut.set_use_jacobian_sparsity(true);
+        EXPECT_EQ(dut.get_jacobian_parallelism().num_threads(), num_threads);
+        EXPECT_EQ(dut.get_autodiff_jacobian_chunk_size(), chunk_size);
+        EXPECT_TRUE(dut.get_use_jacobian_sparsity());
+
+        // The first Jacobian is dense, and reveals the sparsity pattern.
+        EXPECT_TRUE(CompareMatrices(dut.CalcJacobian(0.0, x), expected,
+                                    tolerance));
+        if (scheme != Scheme::kAutomatic) {
+          EXPECT_EQ(dut.get_num_derivative_evaluations_for_jacobian(),
+                    dense.get_num_derivative_evaluations_for_jacobian());
+        }
+
+        // The second one perturbs the θ's of all pendulums together, and then
+        // all of their ω's.
+        const int64_t before =
+            dut.get_num_derivative_evaluations_for_jacobian();
+        EXPECT_TRUE(CompareMatrices(dut.CalcJacobian(0.0, x), expected,
+                                    tolerance));
+        const int64_t evaluations =
+            dut.get_num_derivative_evaluations_for_jacobian() - before;
+        if (scheme == Scheme::kAutomatic) {
+          EXPECT_EQ(evaluations, 1);
+        } else {
+          EXPECT_EQ(evaluations, 1 + 2 * evaluations_per_direction);
+        }
+      }
+    }
+  }
+}
+
+GTEST_TEST(ImplicitIntegratorTest, AutoDiffJacobianChunks) {
+  PendulumChain<double> system(3);
+  std::unique_ptr<Context<double>> context = system.CreateDefaultContext();
+  const VectorXd x = VectorXd::LinSpaced(6, 0.5, 1.5);
+  DummyImplicitIntegrator dense(system, context.get());
+  dense.set_jacobian_computation_scheme(
+      ImplicitIntegrator<double>::JacobianComputationScheme::kAutomatic);
+  const MatrixX<double> expected = dense.CalcJacobian(0.0, x);
+  EXPECT_EQ(dense.get_num_derivative_evaluations_for_jacobian(), 1);
+
+  // Seeding four of the six directions at a time takes two evaluations.
+  DummyImplicitIntegrator dut(system, context.get());
+  dut.set_jacobian_computation_scheme(
+      ImplicitIntegrator<double>::JacobianComputationScheme::kAutomatic);
+  dut.set_autodiff_jacobian_chunk_size(4);
+  EXPECT_TRUE(CompareMatrices(dut.CalcJacobian(0.0, x), expected));
+  EXPECT_EQ(dut.get_num_derivative_evaluations_for_jacobian(), 2);
+  EXPECT_THROW(dut.set_autodiff_jacobian_chunk_size(-1), std::exception);
+}
+
 }  // namespace
 }  // namespace systems
 }  // namespace drake
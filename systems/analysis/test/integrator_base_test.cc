@@ -1,5 +1,8 @@
 #include "drake/systems/analysis/integrator_base.h"
 
+#include <algorithm>
+#include <limits>
+
 #include <gtest/gtest.h>
 
 #include "drake/common/test_utilities/expect_throws_message.h"
@@ -266,6 +269,36 @@ GTEST_TEST(IntegratorBaseTest, DenseOutputTest) {
       ".*ConcatenateInTime.*time_offset.*");
 }
 
+// Tests that bounding the dense output history bounds its size, while still
+// covering the requested duration.
+GTEST_TEST(IntegratorBaseTest, DenseOutputHistoryTest) {
+  SpringMassSystem<double> spring_mass(10.0, 1.0, false);
+  std::unique_ptr<Context<double>> context = spring_mass.CreateDefaultContext();
+  DummyIntegrator<double> integrator(spring_mass, context.get());
+  integrator.set_fixed_step_mode(true);
+  integrator.Initialize();
+
+  EXPECT_EQ(integrator.get_dense_output_history_duration(),
+            std::numeric_limits<double>::infinity());
+  DRAKE_EXPECT_THROWS_MESSAGE(integrator.set_dense_output_history_duration(0),
+                              ".*history_duration > 0.*");
+  const double history = 0.25;
+  integrator.set_dense_output_history_duration(history);
+  EXPECT_EQ(integrator.get_dense_output_history_duration(), history);
+
+  integrator.StartDenseIntegration();
+  const trajectories::PiecewisePolynomial<double>* dense_output =
+      integrator.get_dense_output();
+  const double h = 0.01;
+  for (int i = 1; i <= 1000; ++i) {
+    const double step_start = context->get_time();
+    ASSERT_TRUE(integrator.IntegrateWithSingleFixedStepToTime(i * h));
+    EXPECT_LE(dense_output->start_time(), std::max(0.0, step_start - history));
+    EXPECT_EQ(dense_output->end_time(), context->get_time());
+    EXPECT_LE(dense_output->get_number_of_segments(), 2 * (history / h + 2));
+  }
+}
+
 }  // namespace
 }  // namespace systems
 }  // namespace drake
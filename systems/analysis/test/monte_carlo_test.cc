@@ -1,7 +1,9 @@
 #include "drake/systems/analysis/monte_carlo.h"
 
 #include <cmath>
+#include <optional>
 #include <thread>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -272,6 +274,116 @@ GTEST_TEST(MonteCarloSimulationExceptionTest, BasicTest) {
       std::exception);
 }
 
+// Simple system with a continuous state x that decays as ẋ = −x from a random
+// initial value, and outputs x. Unlike RandomContextSystem, the final output
+// depends on the whole simulation, and therefore on the context having been
+// properly reset in between samples when the simulator is reused.
+class RandomDecaySystem : public VectorSystem<double> {
+ public:
+  RandomDecaySystem() : VectorSystem(0, 1) {
+    this->DeclareContinuousState(1);
+  }
+
+ private:
+  void SetRandomState(const Context<double>& context, State<double>* state,
+                      RandomGenerator* generator) const override {
+    std::uniform_real_distribution<> distribution(1.0, 2.0);
+    state->get_mutable_continuous_state().get_mutable_vector().SetAtIndex(
+        0, distribution(*generator));
+  }
+
+  void DoCalcVectorTimeDerivatives(
+      const Context<double>& context,
+      const Eigen::VectorBlock<const VectorX<double>>& input,
+      const Eigen::VectorBlock<const VectorX<double>>& state,
+      Eigen::VectorBlock<VectorX<double>>* derivatives) const override {
+    *derivatives = -state;
+  }
+
+  void DoCalcVectorOutput(
+      const Context<double>& context,
+      const Eigen::VectorBlock<const VectorX<double>>& input,
+      const Eigen::VectorBlock<const VectorX<double>>& state,
+      Eigen::VectorBlock<VectorX<double>>* output) const override {
+    *output = state;
+  }
+};
+
+// The streaming overload reuses one simulator per worker and produces the
+// same results as the accumulating one.
+GTEST_TEST(MonteCarloSimulationTest, ReusedSimulators) {
+  int num_simulators_made = 0;
+  const SimulatorFactory make_simulator =
+      [&num_simulators_made](RandomGenerator*) {
+        ++num_simulators_made;
+        return std::make_unique<Simulator<double>>(
+            std::make_unique<RandomDecaySystem>());
+      };
+  const double final_time = 0.5;
+  const int num_samples = 20;
+
+  RandomGenerator expected_generator;
+  const std::vector<RandomSimulationResult> expected = MonteCarloSimulation(
+      make_simulator, &GetScalarOutput, final_time, num_samples,
+      &expected_generator, kNoConcurrency);
+
+  for (const int num_parallel_executions : {kNoConcurrency, kTestConcurrency}) {
+    SCOPED_TRACE(fmt::format("num_parallel_executions = {}",
+                             num_parallel_executions));
+    num_simulators_made = 0;
+    RandomGenerator generator;
+    std::vector<std::optional<RandomSimulationResult>> results(num_samples);
+    MonteCarloSimulation(
+        make_simulator, &GetScalarOutput, final_time, num_samples,
+        [&results](int sample, const RandomSimulationResult& result) {
+          ASSERT_FALSE(results.at(sample).has_value());
+          results.at(sample) = result;
+        },
+        &generator, num_parallel_executions);
+    EXPECT_EQ(num_simulators_made, num_parallel_executions);
+    // The generator has advanced by exactly the same amount.
+    RandomGenerator expected_generator_copy(expected_generator);
+    EXPECT_EQ(generator(), expected_generator_copy());
+
+    for (int sample = 0; sample < num_samples; ++sample) {
+      ASSERT_TRUE(results[sample].has_value());
+      EXPECT_EQ(results[sample]->output, expected[sample].output);
+      EXPECT_LT(results[sample]->output, 2.0 * std::exp(-final_time));
+      RandomGenerator replay_generator(results[sample]->generator_snapshot);
+      EXPECT_EQ(RandomSimulation(make_simulator, &GetScalarOutput, final_time,
+                                 &replay_generator),
+                results[sample]->output);
+    }
+  }
+
+  // No samples is not an error; the sink is simply never called.
+  MonteCarloSimulation(
+      make_simulator, &GetScalarOutput, final_time, 0,
+      [](int, const RandomSimulationResult&) {
+        ADD_FAILURE();
+      },
+      nullptr, kTestConcurrency);
+}
+
+GTEST_TEST(MonteCarloSimulationExceptionTest, ReusedSimulators) {
+  const SimulatorFactory make_simulator = [](RandomGenerator* generator) {
+    auto system = std::make_unique<ThrowingRandomContextSystem>();
+    return std::make_unique<Simulator<double>>(std::move(system));
+  };
+  const double final_time = 0.1;
+  const int num_samples = 10;
+  const RandomSimulationResultSink result_sink =
+      [](int, const RandomSimulationResult&) {};
+
+  for (const int num_parallel_executions : {kNoConcurrency, kTestConcurrency}) {
+    RandomGenerator generator;
+    EXPECT_THROW(MonteCarloSimulation(make_simulator, &GetScalarOutput,
+                                      final_time, num_samples, result_sink,
+                                      &generator, num_parallel_executions),
+                 std::exception);
+  }
+}
+
 }  // namespace
 }  // namespace analysis
 }  // namespace systems
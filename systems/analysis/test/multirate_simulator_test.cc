@@ -0,0 +1,116 @@
+#include "drake/systems/analysis/multirate_simulator.h"
+
+#include <memory>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/expect_throws_message.h"
+#include "drake/systems/primitives/integrator.h"
+
+namespace drake {
+namespace systems {
+namespace {
+
+constexpr double kSyncPeriod = 0.1;
+
+// Two integrators a and b connected in a loop, ȧ = b and ḃ = a, with
+// a(0) = 1 and b(0) = 0, each simulated by its own subsimulator.
+class MultirateSimulatorTest : public ::testing::TestWithParam<int> {
+ protected:
+  MultirateSimulatorTest() : simulator_(kSyncPeriod, Parallelism(GetParam())) {
+    a_index_ = simulator_.AddSubsimulator(
+        std::make_unique<Simulator<double>>(a_));
+    b_index_ = simulator_.AddSubsimulator(
+        std::make_unique<Simulator<double>>(b_));
+    a_.set_integral_value(&simulator_.get_mutable_subsimulator(a_index_)
+                               .get_mutable_context(),
+                          Vector1d(1.0));
+    simulator_.Connect(a_.get_output_port(), b_.get_input_port());
+    simulator_.Connect(b_.get_output_port(), a_.get_input_port());
+  }
+
+  double a() const {
+    return a_.get_output_port().Eval(
+        simulator_.get_subsimulator(a_index_).get_context())[0];
+  }
+
+  double b() const {
+    return b_.get_output_port().Eval(
+        simulator_.get_subsimulator(b_index_).get_context())[0];
+  }
+
+  Integrator<double> a_{1};
+  Integrator<double> b_{1};
+  MultirateSimulator simulator_;
+  int a_index_{};
+  int b_index_{};
+};
+
+TEST_P(MultirateSimulatorTest, Exchange) {
+  EXPECT_EQ(simulator_.get_sync_period(), kSyncPeriod);
+  EXPECT_EQ(simulator_.num_subsimulators(), 2);
+
+  // The inputs are held between synchronization points, so each integrator
+  // advances linearly, with the slope sampled at the last synchronization
+  // point.
+  simulator_.AdvanceTo(0.1);
+  EXPECT_EQ(simulator_.get_time(), 0.1);
+  EXPECT_NEAR(a(), 1.0, 1e-14);
+  EXPECT_NEAR(b(), 0.1, 1e-14);
+
+  // Advancing to a time between synchronization points does not exchange any
+  // values.
+  simulator_.AdvanceTo(0.15);
+  EXPECT_NEAR(a(), 1.0 + 0.05 * 0.1, 1e-14);
+  EXPECT_NEAR(b(), 0.1 + 0.05 * 1.0, 1e-14);
+
+  simulator_.AdvanceTo(0.2);
+  EXPECT_NEAR(a(), 1.0 + 0.1 * 0.1, 1e-14);
+  EXPECT_NEAR(b(), 0.2, 1e-14);
+
+  // Several synchronization points in a single call.
+  simulator_.AdvanceTo(0.4);
+  double a_expected = 1.01;
+  double b_expected = 0.2;
+  for (int k = 0; k < 2; ++k) {
+    const double a_next = a_expected + kSyncPeriod * b_expected;
+    b_expected += kSyncPeriod * a_expected;
+    a_expected = a_next;
+  }
+  EXPECT_NEAR(a(), a_expected, 1e-14);
+  EXPECT_NEAR(b(), b_expected, 1e-14);
+
+  DRAKE_EXPECT_THROWS_MESSAGE(simulator_.AdvanceTo(0.3),
+                              ".*boundary_time >= get_time.*");
+}
+
+TEST_P(MultirateSimulatorTest, Errors) {
+  DRAKE_EXPECT_THROWS_MESSAGE(MultirateSimulator(0.0), ".*sync_period > 0.*");
+  DRAKE_EXPECT_THROWS_MESSAGE(simulator_.AddSubsimulator(nullptr),
+                              ".*subsimulator != nullptr.*");
+  DRAKE_EXPECT_THROWS_MESSAGE(simulator_.get_subsimulator(2), ".*i <.*");
+
+  Integrator<double> c(2);
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      simulator_.Connect(c.get_output_port(), a_.get_input_port()),
+      ".*not the system of any subsimulator.*");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      simulator_.Connect(a_.get_output_port(), a_.get_input_port()),
+      ".*already connected.*");
+
+  simulator_.AddSubsimulator(std::make_unique<Simulator<double>>(c));
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      simulator_.Connect(a_.get_output_port(), c.get_input_port()),
+      ".*cannot be connected.*");
+
+  simulator_.get_mutable_subsimulator(2).get_mutable_context().SetTime(1.0);
+  DRAKE_EXPECT_THROWS_MESSAGE(simulator_.Initialize(),
+                              ".*time of subsimulator 2.*differs.*");
+}
+
+INSTANTIATE_TEST_SUITE_P(Threads, MultirateSimulatorTest,
+                         ::testing::Values(1, 2));
+
+}  // namespace
+}  // namespace systems
+}  // namespace drake
@@ -0,0 +1,61 @@
+#include "drake/systems/analysis/realtime_step_statistics.h"
+
+#include <cmath>
+
+#include <gtest/gtest.h>
+
+namespace drake {
+namespace systems {
+namespace {
+
+GTEST_TEST(RealtimeStepStatisticsTest, Empty) {
+  const RealtimeStepStatistics dut;
+  EXPECT_EQ(dut.num_steps(), 0);
+  EXPECT_EQ(dut.num_overruns(), 0);
+  EXPECT_EQ(dut.max_duration(), 0.0);
+  EXPECT_EQ(dut.mean_duration(), 0.0);
+  EXPECT_EQ(dut.CalcDurationQuantile(0.5), 0.0);
+}
+
+GTEST_TEST(RealtimeStepStatisticsTest, Quantiles) {
+  RealtimeStepStatistics dut;
+  // 98 steps of 1 ms and two slow ones, which overran a deadline.
+  for (int i = 0; i < 98; ++i) {
+    dut.Record(1e-3, false);
+  }
+  dut.Record(0.05, true);
+  dut.Record(0.2, true);
+  EXPECT_EQ(dut.num_steps(), 100);
+  EXPECT_EQ(dut.num_overruns(), 2);
+  EXPECT_EQ(dut.max_duration(), 0.2);
+  EXPECT_NEAR(dut.mean_duration(), (0.098 + 0.25) / 100, 1e-15);
+
+  // The quantiles are accurate to within the width of a bin.
+  const double bin_ratio =
+      std::pow(10.0, 1.0 / RealtimeStepStatistics::kBinsPerDecade);
+  const double p50 = dut.CalcDurationQuantile(0.5);
+  EXPECT_GE(p50, 1e-3 / bin_ratio);
+  EXPECT_LE(p50, 1e-3 * bin_ratio);
+  const double p99 = dut.CalcDurationQuantile(0.99);
+  EXPECT_GE(p99, 0.05 / bin_ratio);
+  EXPECT_LE(p99, 0.05 * bin_ratio);
+  EXPECT_EQ(dut.CalcDurationQuantile(1.0), 0.2);
+  EXPECT_LE(dut.CalcDurationQuantile(0.0), 1e-3 * bin_ratio);
+  EXPECT_THROW(dut.CalcDurationQuantile(1.5), std::exception);
+
+  // Durations outside of the binned range are still counted.
+  dut.Record(0.0, false);
+  dut.Record(1e4, true);
+  EXPECT_EQ(dut.num_steps(), 102);
+  EXPECT_EQ(dut.CalcDurationQuantile(1.0), 1e4);
+  EXPECT_LE(dut.CalcDurationQuantile(0.0),
+            RealtimeStepStatistics::kMinBinnedDuration);
+
+  dut.Reset();
+  EXPECT_EQ(dut.num_steps(), 0);
+  EXPECT_EQ(dut.max_duration(), 0.0);
+}
+
+}  // namespace
+}  // namespace systems
+}  // namespace drake
@@ -92,6 +92,13 @@ GTEST_TEST(RegionOfAttractionTest, ParriloExample) {
   const Polynomial V_expected{(x * x + y * y) / gamma};
   EXPECT_TRUE(Polynomial(V).CoefficientsAlmostEqual(V_expected, 1e-5));
 
+  // Certifying the candidate concurrently with the level-set search gives the
+  // same result.
+  options.parallelism = Parallelism(2);
+  const Expression V_parallel = RegionOfAttraction(*system, *context, options);
+  EXPECT_TRUE(Polynomial(V_parallel).CoefficientsAlmostEqual(V_expected, 1e-5));
+  options.parallelism = Parallelism::None();
+
   // Run it again with the lyapunov candidate scaled by a large number to
   // test the "BalanceQuadraticForms" call (this scaling is the smallest
   // multiple of 10 that caused Mosek to fail without balancing).
@@ -119,6 +126,24 @@ GTEST_TEST(RegionOfAttractionTest, IndefiniteHessian) {
   EXPECT_TRUE(Polynomial(V).CoefficientsAlmostEqual(V_expected, 1e-6));
 }
 
+// A candidate that is not positive definite is rejected, whether or not it is
+// certified concurrently with the level-set search.
+GTEST_TEST(RegionOfAttractionTest, IndefiniteCandidate) {
+  Variable x("x");
+  const auto system =
+      SymbolicVectorSystemBuilder().state(x).dynamics(-x + pow(x, 3)).Build();
+  const auto context = system->CreateDefaultContext();
+
+  RegionOfAttractionOptions options;
+  options.lyapunov_candidate = -x * x;
+  options.state_variables = Vector1<Variable>(x);
+  for (const Parallelism parallelism : {Parallelism::None(), Parallelism(2)}) {
+    options.parallelism = parallelism;
+    EXPECT_THROW(RegionOfAttraction(*system, *context, options),
+                 std::exception);
+  }
+}
+
 // Another example from the underactuated lyapunov chapter.  U(x) is a
 // polynomial potential function, and xdot = (U-1)dUdx, which should have
 // U==1 as the true boundary of the RoA.
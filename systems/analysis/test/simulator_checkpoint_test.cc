@@ -0,0 +1,166 @@
+#include "drake/systems/analysis/simulator_checkpoint.h"
+
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/temp_directory.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
+#include "drake/systems/framework/leaf_system.h"
+
+namespace drake {
+namespace systems {
+namespace {
+
+// A system with no state.
+class Empty final : public LeafSystem<double> {};
+
+// A damped oscillator, a periodically updated discrete sample of it, and an
+// abstract count of the updates.
+class SampledOscillator final : public LeafSystem<double> {
+ public:
+  SampledOscillator() {
+    DeclareContinuousState(1, 1, 0);
+    DeclareDiscreteState(1);
+    DeclareAbstractState(Value<int>(0));
+    DeclareNumericParameter(BasicVector<double>(Eigen::Vector2d(4.0, 0.3)));
+    DeclarePeriodicUnrestrictedUpdateEvent(0.25, 0.0,
+                                           &SampledOscillator::Sample);
+  }
+
+ private:
+  void DoCalcTimeDerivatives(
+      const Context<double>& context,
+      ContinuousState<double>* derivatives) const final {
+    const Eigen::VectorXd x =
+        context.get_continuous_state_vector().CopyToVector();
+    const auto& p = context.get_numeric_parameter(0).value();
+    derivatives->SetFromVector(
+        Eigen::Vector2d(x[1], -p[0] * x[0] - p[1] * x[1]));
+  }
+
+  EventStatus Sample(const Context<double>& context,
+                     State<double>* state) const {
+    state->get_mutable_discrete_state().set_value(
+        Vector1d(context.get_continuous_state_vector()[0]));
+    ++state->get_mutable_abstract_state<int>(0);
+    return EventStatus::Succeeded();
+  }
+};
+
+class SimulatorCheckpointTest : public ::testing::Test {
+ protected:
+  std::unique_ptr<Simulator<double>> MakeSimulator() const {
+    auto simulator = std::make_unique<Simulator<double>>(system_);
+    simulator->get_mutable_context().SetContinuousState(
+        Eigen::Vector2d(1.0, 0.0));
+    simulator->get_mutable_integrator().set_target_accuracy(1e-6);
+    return simulator;
+  }
+
+  SimulatorCheckpointSerializers MakeSerializers() const {
+    SimulatorCheckpointSerializers result;
+    result.RegisterTriviallyCopyable<int>();
+    return result;
+  }
+
+  SampledOscillator system_;
+  const std::filesystem::path filename_ =
+      std::filesystem::path(temp_directory()) / "checkpoint.bin";
+};
+
+// A simulation that is saved, loaded into a new simulator, and resumed ends
+// exactly where an uninterrupted one does.
+TEST_F(SimulatorCheckpointTest, ResumeIsExact) {
+  auto expected = MakeSimulator();
+  expected->AdvanceTo(1.1);
+  expected->AdvanceTo(3.0);
+
+  auto original = MakeSimulator();
+  original->AdvanceTo(1.1);
+  SaveSimulatorCheckpoint(*original, filename_, MakeSerializers());
+
+  auto resumed = MakeSimulator();
+  resumed->get_mutable_context().get_mutable_numeric_parameter(0).SetZero();
+  LoadSimulatorCheckpoint(filename_, resumed.get(), MakeSerializers());
+  const Context<double>& context = resumed->get_context();
+  EXPECT_EQ(context.get_time(), 1.1);
+  EXPECT_EQ(context.get_abstract_state<int>(0), 5);
+  EXPECT_EQ(context.get_numeric_parameter(0).value(),
+            Eigen::Vector2d(4.0, 0.3));
+
+  resumed->AdvanceTo(3.0);
+  const Context<double>& expected_context = expected->get_context();
+  EXPECT_EQ(context.get_continuous_state_vector().CopyToVector(),
+            expected_context.get_continuous_state_vector().CopyToVector());
+  EXPECT_EQ(context.get_discrete_state_vector().value(),
+            expected_context.get_discrete_state_vector().value());
+  EXPECT_EQ(context.get_abstract_state<int>(0), 12);
+  EXPECT_EQ(resumed->get_num_unrestricted_updates(), 7);
+}
+
+TEST_F(SimulatorCheckpointTest, MissingSerializer) {
+  auto simulator = MakeSimulator();
+  simulator->Initialize();
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      SaveSimulatorCheckpoint(*simulator, filename_),
+      ".*no serializer is registered for the abstract value type int.*");
+}
+
+TEST_F(SimulatorCheckpointTest, BadFiles) {
+  auto simulator = MakeSimulator();
+  simulator->Initialize();
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      LoadSimulatorCheckpoint(filename_.string() + ".missing", simulator.get(),
+                              MakeSerializers()),
+      ".*could not open.*");
+
+  {
+    std::ofstream file(filename_, std::ios::binary);
+    file << "not a checkpoint";
+  }
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      LoadSimulatorCheckpoint(filename_, simulator.get(), MakeSerializers()),
+      ".*it is not a simulator checkpoint.*");
+
+  // A checkpoint of a system with a different structure.
+  const Empty empty;
+  Simulator<double> other(empty);
+  other.Initialize();
+  SaveSimulatorCheckpoint(other, filename_);
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      LoadSimulatorCheckpoint(filename_, simulator.get(), MakeSerializers()),
+      ".*the continuous state has size 0 but the Context has size 2.*");
+  // The failed load left the simulator's context unchanged.
+  EXPECT_EQ(simulator->get_context().get_continuous_state_vector()[0], 1.0);
+}
+
+// A failed save leaves an existing checkpoint intact, and a successful one
+// leaves no temporary file behind.
+TEST_F(SimulatorCheckpointTest, ReplaceIsAtomic) {
+  auto simulator = MakeSimulator();
+  simulator->AdvanceTo(1.1);
+  SaveSimulatorCheckpoint(*simulator, filename_, MakeSerializers());
+  std::filesystem::path temp_filename = filename_;
+  temp_filename += ".tmp";
+  EXPECT_FALSE(std::filesystem::exists(temp_filename));
+
+  // The temporary file can't be created where a directory is in the way.
+  std::filesystem::create_directory(temp_filename);
+  simulator->AdvanceTo(2.0);
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      SaveSimulatorCheckpoint(*simulator, filename_, MakeSerializers()),
+      ".*could not write.*checkpoint.bin.tmp.*");
+  std::filesystem::remove(temp_filename);
+
+  auto resumed = MakeSimulator();
+  LoadSimulatorCheckpoint(filename_, resumed.get(), MakeSerializers());
+  EXPECT_EQ(resumed->get_context().get_time(), 1.1);
+}
+
+}  // namespace
+}  // namespace systems
+}  // namespace drake
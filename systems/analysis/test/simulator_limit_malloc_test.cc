@@ -5,6 +5,17 @@
 #include "drake/systems/framework/diagram_builder.h"
 #include "drake/systems/framework/event.h"
 #include "drake/systems/framework/leaf_system.h"
+#include "drake/systems/primitives/adder.h"
+#include "drake/systems/primitives/constant_vector_source.h"
+#include "drake/systems/primitives/demultiplexer.h"
+#include "drake/systems/primitives/discrete_derivative.h"
+#include "drake/systems/primitives/discrete_time_delay.h"
+#include "drake/systems/primitives/gain.h"
+#include "drake/systems/primitives/linear_system.h"
+#include "drake/systems/primitives/multiplexer.h"
+#include "drake/systems/primitives/pass_through.h"
+#include "drake/systems/primitives/saturation.h"
+#include "drake/systems/primitives/zero_order_hold.h"
 
 namespace drake {
 namespace systems {
@@ -84,6 +95,108 @@ GTEST_TEST(SimulatorLimitMallocTest,
   }
 }
 
+// A discrete controller with a vector input and a state output. Its update
+// writes directly into the discrete values, as a heap-free system should.
+class DiscreteController final : public LeafSystem<double> {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(DiscreteController)
+
+  explicit DiscreteController(double period) {
+    DeclareVectorInputPort("u", 2);
+    const DiscreteStateIndex x = DeclareDiscreteState(2);
+    DeclareStateOutputPort("y", x);
+    DeclarePeriodicDiscreteUpdateEvent(period, 0.0,
+                                       &DiscreteController::Update);
+  }
+
+ private:
+  void Update(const Context<double>& context,
+              DiscreteValues<double>* next) const {
+    const auto& u = get_input_port().Eval(context);
+    next->get_mutable_value() =
+        0.9 * context.get_discrete_state(0).value() + 0.1 * u;
+  }
+};
+
+// A source of an abstract (non-vector) value.
+class AbstractSource final : public LeafSystem<double> {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(AbstractSource)
+
+  AbstractSource() { DeclareAbstractOutputPort("y", &AbstractSource::Calc); }
+
+ private:
+  void Calc(const Context<double>& context, Eigen::Vector3d* output) const {
+    *output = Eigen::Vector3d::Constant(context.get_time());
+  }
+};
+
+// Tests that a representative discrete-time control diagram built from
+// primitives simulates without heap allocations once the first step has been
+// taken. Each of these primitives was found to allocate on every step at
+// some point (e.g., VectorSystem feedthrough queries, copies of input port
+// values, and Eigen temporaries in AffineSystem).
+GTEST_TEST(SimulatorLimitMallocTest, NoHeapAllocsForDiscreteDiagram) {
+  const double kPeriod = 0.001;
+  DiagramBuilder<double> builder;
+  auto source = builder.AddSystem<ConstantVectorSource<double>>(
+      Eigen::Vector2d(1.0, 2.0));
+  auto adder = builder.AddSystem<Adder<double>>(2, 2);
+  auto controller = builder.AddSystem<DiscreteController>(kPeriod);
+  auto zoh = builder.AddSystem<ZeroOrderHold<double>>(kPeriod, 2);
+  auto delay = builder.AddSystem<DiscreteTimeDelay<double>>(kPeriod, 3, 2);
+  auto saturation = builder.AddSystem<Saturation<double>>(
+      Eigen::Vector2d::Constant(-1.0), Eigen::Vector2d::Constant(1.0));
+  auto mux = builder.AddSystem<Multiplexer<double>>(std::vector<int>{2, 2});
+  auto demux = builder.AddSystem<Demultiplexer<double>>(4, 2);
+  auto gain = builder.AddSystem<Gain<double>>(-0.5, 2);
+  builder.Connect(source->get_output_port(), adder->get_input_port(0));
+  builder.Connect(gain->get_output_port(), adder->get_input_port(1));
+  builder.Connect(adder->get_output_port(), controller->get_input_port());
+  builder.Connect(controller->get_output_port(), zoh->get_input_port());
+  builder.Connect(zoh->get_output_port(), delay->get_input_port());
+  builder.Connect(delay->get_output_port(), saturation->get_input_port());
+  builder.Connect(saturation->get_output_port(), mux->get_input_port(0));
+  builder.Connect(zoh->get_output_port(), mux->get_input_port(1));
+  builder.Connect(mux->get_output_port(0), demux->get_input_port(0));
+  builder.Connect(demux->get_output_port(0), gain->get_input_port());
+
+  Eigen::Matrix2d A;
+  A << 0.9, 0.1, 0.0, 0.8;
+  auto plant = builder.AddSystem<LinearSystem<double>>(
+      A, Eigen::Matrix2d::Identity(), Eigen::Matrix2d::Identity(),
+      Eigen::Matrix2d::Zero(), kPeriod);
+  auto derivative = builder.AddSystem<DiscreteDerivative<double>>(2, kPeriod);
+  auto pass_through = builder.AddSystem<PassThrough<double>>(2);
+  builder.Connect(zoh->get_output_port(), plant->get_input_port());
+  builder.Connect(plant->get_output_port(), derivative->get_input_port());
+  builder.Connect(derivative->get_output_port(),
+                  pass_through->get_input_port());
+
+  auto abstract_source = builder.AddSystem<AbstractSource>();
+  auto abstract_zoh = builder.AddSystem<ZeroOrderHold<double>>(
+      kPeriod, Value<Eigen::Vector3d>());
+  builder.Connect(abstract_source->get_output_port(),
+                  abstract_zoh->get_input_port());
+  // Export an output so that the diagram has something to evaluate.
+  builder.ExportOutput(pass_through->get_output_port());
+  auto diagram = builder.Build();
+
+  Simulator<double> simulator(*diagram);
+  simulator.set_publish_every_time_step(true);
+  simulator.Initialize();
+  // The first steps may still allocate, e.g., to size the storage underlying
+  // cache entries and event collections.
+  simulator.AdvanceTo(10 * kPeriod);
+  diagram->get_output_port().Eval(simulator.get_context());
+  {
+    test::LimitMalloc heap_alloc_checker({.max_num_allocations = 0});
+    simulator.AdvanceTo(100 * kPeriod);
+    diagram->get_output_port().Eval(simulator.get_context());
+  }
+  EXPECT_NEAR(simulator.get_context().get_time(), 100 * kPeriod, 1e-12);
+}
+
 }  // namespace
 }  // namespace systems
 }  // namespace drake
@@ -20,6 +20,11 @@ TYPED_TEST(SimulatorPrintStatsTest, Test) {
   simulator.AdvanceTo(2);
 
   PrintSimulatorStatistics(simulator);
+
+  // Also print the wall clock statistics of the steps.
+  simulator.set_step_deadline(1e-3);
+  simulator.AdvanceTo(3);
+  PrintSimulatorStatistics(simulator);
 }
 }  // namespace systems
 }  // namespace drake
@@ -448,6 +448,82 @@ GTEST_TEST(SimulatorTest, FixedStepIncreasingIsolationAccuracy) {
   }
 }
 
+// A system with dx/dt = -x and a witness function that triggers when x crosses
+// 0.6.
+class DecaySystem : public LeafSystem<double> {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(DecaySystem)
+
+  DecaySystem() {
+    this->DeclareContinuousState(1);
+    witness_ = this->MakeWitnessFunction(
+        "decay witness", WitnessFunctionDirection::kCrossesZero,
+        &DecaySystem::CalcWitness, &DecaySystem::RecordTrigger);
+  }
+
+  const std::vector<std::pair<double, double>>& triggers() const {
+    return triggers_;
+  }
+
+ protected:
+  void SetDefaultState(const Context<double>&,
+                       State<double>* state) const override {
+    state->get_mutable_continuous_state()[0] = 1.0;
+  }
+
+  void DoCalcTimeDerivatives(
+      const Context<double>& context,
+      ContinuousState<double>* derivatives) const override {
+    (*derivatives)[0] = -context.get_continuous_state()[0];
+  }
+
+  void DoGetWitnessFunctions(
+      const Context<double>&,
+      std::vector<const WitnessFunction<double>*>* w) const override {
+    w->push_back(witness_.get());
+  }
+
+ private:
+  double CalcWitness(const Context<double>& context) const {
+    return context.get_continuous_state()[0] - 0.6;
+  }
+
+  void RecordTrigger(const Context<double>& context,
+                     const PublishEvent<double>&) const {
+    triggers_.emplace_back(context.get_time(),
+                           context.get_continuous_state()[0]);
+  }
+
+  std::unique_ptr<WitnessFunction<double>> witness_;
+  mutable std::vector<std::pair<double, double>> triggers_;
+};
+
+// Tests isolation of a witness function that depends on the continuous state,
+// which the Simulator first locates on an interpolant of the integration step.
+GTEST_TEST(SimulatorTest, StatefulWitnessIsolation) {
+  DecaySystem system;
+  const double h = 1;
+  Simulator<double> simulator(system);
+  InitFixedStepIntegratorForWitnessTesting(&simulator, h);
+  Context<double>& context = simulator.get_mutable_context();
+  const double accuracy = 1e-6;
+  context.SetAccuracy(accuracy);
+  simulator.Initialize();
+  simulator.AdvanceTo(h);
+
+  ASSERT_EQ(system.triggers().size(), 1);
+  const auto& [tw, xw] = system.triggers().front();
+  const std::optional<double> iso_len =
+      simulator.GetCurrentWitnessTimeIsolation();
+  ASSERT_TRUE(iso_len.has_value());
+
+  // The witness triggered, and |dx/dt| < 1, so x was above 0.6 at the start of
+  // the isolation interval.
+  EXPECT_LE(xw, 0.6);
+  EXPECT_LE(0.6 - xw, iso_len.value());
+  EXPECT_NEAR(tw, std::log(1 / 0.6), 0.05);
+}
+
 // Tests ability of simulation to identify the witness function triggering
 // over an interval *where both witness functions change sign from the beginning
 // to the end of the interval.
@@ -978,6 +1054,52 @@ GTEST_TEST(SimulatorTest, RealtimeRate) {
   EXPECT_TRUE(simulator.get_actual_realtime_rate() <= 5.1);
 }
 
+// Tests that the wall clock time of the steps is recorded while a step
+// deadline is in effect, and that overruns are reported.
+GTEST_TEST(SimulatorTest, StepDeadline) {
+  analysis_test::MySpringMassSystem<double> spring_mass(1., 1., 0.);
+  Simulator<double> simulator(spring_mass);  // Use default Context.
+  simulator.get_mutable_integrator().set_maximum_step_size(0.001);
+  EXPECT_FALSE(simulator.get_step_deadline().has_value());
+  EXPECT_THROW(simulator.set_step_deadline(0.0), std::exception);
+
+  // No step overruns an infinite deadline, but all of them are recorded.
+  simulator.set_step_deadline(std::numeric_limits<double>::infinity());
+  simulator.Initialize();
+  simulator.AdvanceTo(0.1);
+  const RealtimeStepStatistics& stats =
+      simulator.get_realtime_step_statistics();
+  EXPECT_EQ(stats.num_steps(), simulator.get_num_steps_taken());
+  EXPECT_EQ(stats.num_overruns(), 0);
+  EXPECT_GT(stats.max_duration(), 0.0);
+  EXPECT_LE(stats.CalcDurationQuantile(0.5), stats.max_duration());
+
+  // Every step overruns a tiny deadline (unless the clock does not advance),
+  // and the callback is called for each overrun.
+  int num_overruns = 0;
+  simulator.set_step_deadline(
+      1e-300, [&num_overruns, &simulator](const Context<double>& context,
+                                          double duration) {
+        EXPECT_EQ(&context, &simulator.get_context());
+        EXPECT_GT(duration, 0.0);
+        ++num_overruns;
+      });
+  EXPECT_EQ(simulator.get_step_deadline(), 1e-300);
+  simulator.ResetStatistics();
+  EXPECT_EQ(stats.num_steps(), 0);
+  simulator.AdvanceTo(0.2);
+  EXPECT_EQ(stats.num_steps(), simulator.get_num_steps_taken());
+  EXPECT_EQ(stats.num_overruns(), num_overruns);
+  EXPECT_GT(num_overruns, 0);
+
+  // Without a deadline, the steps are not recorded.
+  simulator.clear_step_deadline();
+  EXPECT_FALSE(simulator.get_step_deadline().has_value());
+  simulator.ResetStatistics();
+  simulator.AdvanceTo(0.3);
+  EXPECT_EQ(stats.num_steps(), 0);
+}
+
 // Tests that if publishing every time step is disabled and publish on
 // initialization is enabled, publish only happens on initialization.
 GTEST_TEST(SimulatorTest, DisablePublishEveryTimestep) {
@@ -855,6 +855,44 @@ TYPED_TEST_P(ImplicitIntegratorTest, FullNewton) {
             integrator.get_num_newton_raphson_iterations());
 }
 
+// Tests that factoring the iteration matrices with a sparse LU factorization
+// gives the same solution as the (default) dense factorization.
+TYPED_TEST_P(ImplicitIntegratorTest, SparseIterationMatrix) {
+  std::unique_ptr<analysis::test::RobertsonSystem<double>> robertson =
+      std::make_unique<analysis::test::RobertsonSystem<double>>();
+  // Per the FullNewton test, this step size is small enough to converge.
+  const double h = 1e-5;
+
+  auto integrate = [&robertson, h](bool use_sparse) {
+    std::unique_ptr<Context<double>> context =
+        robertson->CreateDefaultContext();
+    using Integrator = TypeParam;
+    Integrator integrator(*robertson, context.get());
+    EXPECT_FALSE(integrator.get_use_sparse_iteration_matrix());
+    integrator.set_use_sparse_iteration_matrix(use_sparse);
+    EXPECT_EQ(integrator.get_use_sparse_iteration_matrix(), use_sparse);
+    if (integrator.supports_error_estimation()) {
+      integrator.request_initial_step_size_target(h);
+    } else {
+      integrator.set_maximum_step_size(h);
+    }
+    integrator.set_fixed_step_mode(true);
+    integrator.Initialize();
+    for (int i = 1; i <= 100; ++i) {
+      EXPECT_TRUE(integrator.IntegrateWithSingleFixedStepToTime(i * h));
+    }
+    EXPECT_GT(integrator.get_num_iteration_matrix_factorizations(), 0);
+    return context->get_continuous_state_vector().CopyToVector();
+  };
+
+  const VectorX<double> dense = integrate(false);
+  const VectorX<double> sparse = integrate(true);
+  ASSERT_EQ(sparse.size(), dense.size());
+  for (int i = 0; i < dense.size(); ++i) {
+    EXPECT_NEAR(sparse[i], dense[i], 1e-12);
+  }
+}
+
 // Tests the implicit integrator on a stationary system problem, which
 // stresses numerical differentiation (since the state does not change).
 // This test also verifies that integration with AutoDiff'd Jacobians
@@ -1138,14 +1176,15 @@ TYPED_TEST_P(ImplicitIntegratorTest, SpringMassStepAccuracyEffectsReuse) {
 }
 
 REGISTER_TYPED_TEST_SUITE_P(
-    ImplicitIntegratorTest, Reuse, FullNewton, MiscAPINoReuse, MiscAPIReuse,
-    Stationary, Robertson, FixedStepThrowsOnMultiStep, ContextAccess,
-    AccuracyEstAndErrorControl, LinearTest, DoubleSpringMassDamperNoReuse,
-    DoubleSpringMassDamperReuse, SpringMassDamperStiffNoReuse,
-    SpringMassDamperStiffReuse, DiscontinuousSpringMassDamperNoReuse,
-    DiscontinuousSpringMassDamperReuse, SpringMassStepNoReuse,
-    SpringMassStepReuse, ErrorEstimationNoReuse, ErrorEstimationReuse,
-    SpringMassStepAccuracyEffectsNoReuse, SpringMassStepAccuracyEffectsReuse);
+    ImplicitIntegratorTest, Reuse, FullNewton, SparseIterationMatrix,
+    MiscAPINoReuse, MiscAPIReuse, Stationary, Robertson,
+    FixedStepThrowsOnMultiStep, ContextAccess, AccuracyEstAndErrorControl,
+    LinearTest, DoubleSpringMassDamperNoReuse, DoubleSpringMassDamperReuse,
+    SpringMassDamperStiffNoReuse, SpringMassDamperStiffReuse,
+    DiscontinuousSpringMassDamperNoReuse, DiscontinuousSpringMassDamperReuse,
+    SpringMassStepNoReuse, SpringMassStepReuse, ErrorEstimationNoReuse,
+    ErrorEstimationReuse, SpringMassStepAccuracyEffectsNoReuse,
+    SpringMassStepAccuracyEffectsReuse);
 
 }  // namespace analysis_test
 }  // namespace systems
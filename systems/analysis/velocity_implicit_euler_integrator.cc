@@ -199,6 +199,11 @@ bool VelocityImplicitEulerIntegrator<T>::MaybeFreshenVelocityMatrices(
     MatrixX<T>* Jy) {
   DRAKE_DEMAND(Jy != nullptr);
   DRAKE_DEMAND(iteration_matrix != nullptr);
+  // Switching between dense and sparse factorization unfactors the iteration
+  // matrix, so that it is refactored below.
+  iteration_matrix->set_use_sparse_factorization(
+      this->get_use_sparse_iteration_matrix());
+
   // Compute the initial Jacobian and iteration matrices and factor them, if
   // necessary.
   if (!this->get_reuse() || Jy->rows() == 0 || this->IsBadJacobian(*Jy)) {
@@ -276,6 +281,8 @@ void VelocityImplicitEulerIntegrator<T>::FreshenVelocityMatricesIfFullNewton(
 
   // Return immediately if full-Newton is not in use.
   if (!this->get_use_full_newton()) return;
+  iteration_matrix->set_use_sparse_factorization(
+      this->get_use_sparse_iteration_matrix());
 
   // Compute the initial Jacobian and iteration matrices and factor them.
   CalcVelocityJacobian(t, h, y, qk, qn, Jy);
@@ -127,6 +127,25 @@ BENCHMARK_REGISTER_F(Mlp, OutputGradient)
     ->Args({128, 4, 64, 256})
     ->Args({128, 8, 64, 256});
 
+BENCHMARK_DEFINE_F(Mlp, PortEval)(benchmark::State& state) {  // NOLINT
+  // Evaluates the output port for one input at a time, as happens when the
+  // MLP is a policy inside a simulation. Each column of X is used in turn.
+  FixedInputPortValue& input =
+      mlp_->get_input_port().FixValue(context_.get(), X_.col(0));
+  int column = 0;
+  for (auto _ : state) {
+    input.GetMutableVectorData<double>()->SetFromVector(X_.col(column));
+    mlp_->get_output_port().Eval(*context_);
+    column = (column + 1) % X_.cols();
+  }
+}
+// The Args are { num_inputs, num_layers, width, batch_size }.
+BENCHMARK_REGISTER_F(Mlp, PortEval)
+    ->Args({10, 4, 64, 1})
+    ->Args({10, 4, 256, 1})
+    ->Args({128, 4, 64, 1})
+    ->Args({128, 8, 64, 1});
+
 }  // namespace
 }  // namespace systems
 }  // namespace drake
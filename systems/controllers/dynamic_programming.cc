@@ -1,14 +1,17 @@
 #include "drake/systems/controllers/dynamic_programming.h"
 
+#include <algorithm>
 #include <limits>
 #include <utility>
 #include <vector>
 
+#include "drake/common/parallel_for.h"
 #include "drake/common/text_logging.h"
 #include "drake/math/wrap_to.h"
 #include "drake/solvers/mathematical_program.h"
 #include "drake/solvers/solve.h"
 #include "drake/systems/analysis/simulator.h"
+#include "drake/systems/analysis/simulator_config_functions.h"
 
 namespace drake {
 namespace systems {
@@ -82,42 +85,68 @@ FittedValueIteration(
   std::vector<Eigen::RowVectorXd> cost(num_inputs);
 
   drake::log()->info("Computing transition and cost matrices.");
-  auto& sim_state = context.get_mutable_continuous_state_vector();
-
-  Eigen::VectorXd input_vec(input_mesh.get_input_size());
-  Eigen::VectorXd state_vec(state_mesh.get_input_size());
-
-  Eigen::VectorXi Tind_tmp(num_state_indices);
-  Eigen::VectorXd T_tmp(num_state_indices);
-
   for (int input = 0; input < num_inputs; input++) {
     Tind[input].resize(num_state_indices, num_states);
     T[input].resize(num_state_indices, num_states);
     cost[input].resize(num_states);
+  }
 
-    input_mesh.get_mesh_point(input, &input_vec);
-    input_port->FixValue(&context, input_vec);
+  // The mesh points are split into contiguous chunks, one per thread.  The
+  // first chunk uses the given simulator; every other chunk uses a Simulator
+  // with its own copy of the Context and the same configuration.
+  const int num_chunks =
+      std::clamp(options.parallelism.num_threads(), 1, num_states);
+  std::vector<std::unique_ptr<Simulator<double>>> chunk_simulators(num_chunks);
+  if (num_chunks > 1) {
+    const SimulatorConfig config = ExtractSimulatorConfig(*simulator);
+    for (int chunk = 1; chunk < num_chunks; ++chunk) {
+      chunk_simulators[chunk] =
+          std::make_unique<Simulator<double>>(system, context.Clone());
+      ApplySimulatorConfig(config, chunk_simulators[chunk].get());
+    }
+  }
 
-    for (int state = 0; state < num_states; state++) {
-      context.SetTime(0.0);
-      sim_state.SetFromVector(state_mesh.get_mesh_point(state));
-      simulator->Initialize();
+  auto compute_chunk = [&](int chunk) {
+    Simulator<double>* chunk_simulator =
+        (chunk == 0) ? simulator : chunk_simulators[chunk].get();
+    auto& chunk_context = chunk_simulator->get_mutable_context();
+    auto& sim_state = chunk_context.get_mutable_continuous_state_vector();
 
-      cost[input](state) = time_step * cost_function(context);
+    Eigen::VectorXd input_vec(input_mesh.get_input_size());
+    Eigen::VectorXd state_vec(state_mesh.get_input_size());
 
-      simulator->AdvanceTo(time_step);
-      state_vec = sim_state.CopyToVector();
+    Eigen::VectorXi Tind_tmp(num_state_indices);
+    Eigen::VectorXd T_tmp(num_state_indices);
 
-      for (const auto& b : options.periodic_boundary_conditions) {
-        state_vec[b.state_index] =
-            math::wrap_to(state_vec[b.state_index], b.low, b.high);
-      }
+    const int begin = static_cast<int64_t>(num_states) * chunk / num_chunks;
+    const int end = static_cast<int64_t>(num_states) * (chunk + 1) / num_chunks;
+    for (int input = 0; input < num_inputs; input++) {
+      input_mesh.get_mesh_point(input, &input_vec);
+      input_port->FixValue(&chunk_context, input_vec);
 
-      state_mesh.EvalBarycentricWeights(state_vec, &Tind_tmp, &T_tmp);
-      Tind[input].col(state) = Tind_tmp;
-      T[input].col(state) = T_tmp;
+      for (int state = begin; state < end; state++) {
+        chunk_context.SetTime(0.0);
+        sim_state.SetFromVector(state_mesh.get_mesh_point(state));
+        chunk_simulator->Initialize();
+
+        cost[input](state) = time_step * cost_function(chunk_context);
+
+        chunk_simulator->AdvanceTo(time_step);
+        state_vec = sim_state.CopyToVector();
+
+        for (const auto& b : options.periodic_boundary_conditions) {
+          state_vec[b.state_index] =
+              math::wrap_to(state_vec[b.state_index], b.low, b.high);
+        }
+
+        state_mesh.EvalBarycentricWeights(state_vec, &Tind_tmp, &T_tmp);
+        Tind[input].col(state) = Tind_tmp;
+        T[input].col(state) = T_tmp;
+      }
     }
-  }
+  };
+  drake::internal::ParallelFor(Parallelism(num_chunks), num_chunks,
+                               compute_chunk);
   drake::log()->info("Done computing transition and cost matrices.");
 
   // Perform value iteration loop.
@@ -129,26 +158,28 @@ FittedValueIteration(
   double max_diff = std::numeric_limits<double>::infinity();
   int iteration = 0;
   while (max_diff > options.convergence_tol) {
-    for (int state = 0; state < num_states; state++) {
-      Jnext(state) = std::numeric_limits<double>::infinity();
-
-      int best_input = 0;
-      for (int input = 0; input < num_inputs; input++) {
-        // Q(x,u) = g(x,u) + γ J(f(x,u)).
-        double Q = cost[input](state);
-        for (int index = 0; index < num_state_indices; index++) {
-          Q += options.discount_factor * T[input](index, state) *
-               J(Tind[input](index, state));
-        }
-        // Cost-to-go: J = minᵤ Q(x,u).
-        // Policy:  π(x) = argminᵤ Q(x,u).
-        if (Q < Jnext(state)) {
-          Jnext(state) = Q;
-          best_input = input;
-        }
-      }
-      Pi.col(state) = input_mesh.get_mesh_point(best_input);
-    }
+    // Each state's update only reads J, so the states are independent.
+    drake::internal::ParallelFor(
+        Parallelism(num_chunks), num_states, [&](int state) {
+          Jnext(state) = std::numeric_limits<double>::infinity();
+
+          int best_input = 0;
+          for (int input = 0; input < num_inputs; input++) {
+            // Q(x,u) = g(x,u) + γ J(f(x,u)).
+            double Q = cost[input](state);
+            for (int index = 0; index < num_state_indices; index++) {
+              Q += options.discount_factor * T[input](index, state) *
+                   J(Tind[input](index, state));
+            }
+            // Cost-to-go: J = minᵤ Q(x,u).
+            // Policy:  π(x) = argminᵤ Q(x,u).
+            if (Q < Jnext(state)) {
+              Jnext(state) = Q;
+              best_input = input;
+            }
+          }
+          Pi.col(state) = input_mesh.get_mesh_point(best_input);
+        });
     max_diff = (J - Jnext).lpNorm<Eigen::Infinity>();
     J = Jnext;
     iteration++;
@@ -6,6 +6,7 @@
 #include <utility>
 #include <variant>
 
+#include "drake/common/parallelism.h"
 #include "drake/common/symbolic/expression.h"
 #include "drake/math/barycentric.h"
 #include "drake/systems/analysis/simulator.h"
@@ -66,6 +67,14 @@ struct DynamicProgrammingOptions {
   /// the dynamics of the additional state variables cannot impact the dynamics
   /// of the continuous states.  @default false.
   bool assume_non_continuous_states_are_fixed{false};
+
+  /// For FittedValueIteration, the number of threads used to simulate from the
+  /// mesh points and to perform the value iteration update.  Each thread
+  /// simulates with its own copy of the Context (and integrator settings) of
+  /// the given Simulator, so the System and the cost function must be safe to
+  /// evaluate concurrently on distinct Contexts.  (Systems or cost functions
+  /// written in Python are not.)  @default Parallelism::None().
+  Parallelism parallelism{Parallelism::None()};
 };
 
 /// Implements Fitted Value Iteration on a (triangulated) Barycentric Mesh,
@@ -1,6 +1,7 @@
 #include "drake/systems/controllers/finite_horizon_linear_quadratic_regulator.h"
 
 #include <algorithm>
+#include <cmath>
 #include <limits>
 #include <memory>
 #include <utility>
@@ -103,28 +104,13 @@ class RiccatiSystem : public LeafSystem<double> {
 
     // Get (time-varying) linearization of the plant.
     const double system_time = -context.get_time();
-    context_->SetTime(system_time);
-    auto autodiff_args = math::InitializeAutoDiffTuple(x0_.value(system_time),
-                                                       u0_.value(system_time));
-    context_->SetContinuousState(std::get<0>(autodiff_args));
-    input_port_->FixValue(context_.get(), std::get<1>(autodiff_args));
-    const VectorX<AutoDiffXd> autodiff_xdot0 =
-        system_->EvalTimeDerivatives(*context_).CopyToVector();
-    const Eigen::MatrixXd AB = math::ExtractGradient(autodiff_xdot0);
-    const Eigen::Ref<const Eigen::MatrixXd>& A = AB.leftCols(num_states_);
-    const Eigen::Ref<const Eigen::MatrixXd>& B = AB.rightCols(num_inputs_);
-    const Eigen::VectorXd c =
-        math::ExtractValue(autodiff_xdot0) - x0_.EvalDerivative(system_time, 1);
+    Eigen::MatrixXd A, B;
+    Eigen::VectorXd c;
+    CalcLinearization(system_time, &A, &B, &c);
 
     // Desired trajectories relative to the nominal.
-    const Eigen::VectorXd xd0 =
-        options_.xd
-            ? (options_.xd->value(system_time) - x0_.value(system_time)).eval()
-            : Eigen::VectorXd::Zero(num_states_);
-    const Eigen::VectorXd ud0 =
-        options_.ud
-            ? (options_.ud->value(system_time) - u0_.value(system_time)).eval()
-            : Eigen::VectorXd::Zero(num_inputs_);
+    Eigen::VectorXd xd0, ud0;
+    CalcDesiredRelativeToNominal(system_time, &xd0, &ud0);
 
     // Compute the Riccati dynamics.
     Eigen::MatrixXd Sxx;
@@ -160,6 +146,90 @@ class RiccatiSystem : public LeafSystem<double> {
     derivatives->SetFromVector(minus_Sdot_vectorized);
   }
 
+  // Solves the discrete-time Riccati recursion for the explicit Euler
+  // discretization of the linearized dynamics, x[k+1] = Ad x[k] + Bd u[k] + cd
+  // with Ad = I + hA, Bd = hB, cd = hc, and running cost h times the
+  // continuous-time running cost, over a uniform time grid spanning [t0, tf]
+  // with spacing h ≤ time_step. Populates the (piecewise-linear) S, sx, and s0
+  // trajectories and the (piecewise-constant) K and k0 trajectories of
+  // `result`.
+  void SolveRiccatiRecursion(
+      double t0, double tf, double time_step,
+      FiniteHorizonLinearQuadraticRegulatorResult* result) const {
+    const int num_steps =
+        std::max(1, static_cast<int>(std::ceil((tf - t0) / time_step)));
+    const double h = (tf - t0) / num_steps;
+    std::vector<double> times(num_steps + 1);
+    for (int k = 0; k <= num_steps; ++k) {
+      times[k] = (k == num_steps) ? tf : t0 + k * h;
+    }
+    std::vector<Eigen::MatrixXd> S(num_steps + 1);
+    std::vector<Eigen::MatrixXd> sx(num_steps + 1);
+    std::vector<Eigen::MatrixXd> s0(num_steps + 1);
+    std::vector<Eigen::MatrixXd> K(num_steps + 1);
+    std::vector<Eigen::MatrixXd> k0(num_steps + 1);
+
+    // The final cost.
+    Eigen::VectorXd xd0, ud0;
+    CalcDesiredRelativeToNominal(tf, &xd0, &ud0);
+    S[num_steps] = options_.Qf
+                       ? *options_.Qf
+                       : Eigen::MatrixXd::Zero(num_states_, num_states_);
+    sx[num_steps] = -S[num_steps] * xd0;
+    s0[num_steps] = Vector1d(xd0.dot(S[num_steps] * xd0));
+
+    Eigen::MatrixXd A, B;
+    Eigen::VectorXd c;
+    for (int k = num_steps - 1; k >= 0; --k) {
+      CalcLinearization(times[k], &A, &B, &c);
+      CalcDesiredRelativeToNominal(times[k], &xd0, &ud0);
+      const Eigen::MatrixXd Ad =
+          Eigen::MatrixXd::Identity(num_states_, num_states_) + h * A;
+      const Eigen::MatrixXd Bd = h * B;
+      const Eigen::VectorXd cd = h * c;
+      const Eigen::MatrixXd& S_next = S[k + 1];
+      const Eigen::VectorXd S_cd_plus_sx = S_next * cd + sx[k + 1];
+
+      // The cost-to-go from step k, as a quadratic function of (x[k], u[k]).
+      const Eigen::MatrixXd S_Ad = S_next * Ad;
+      const Eigen::MatrixXd Qxx = h * Q_ + Ad.transpose() * S_Ad;
+      const Eigen::MatrixXd Quu = h * R_ + Bd.transpose() * S_next * Bd;
+      const Eigen::MatrixXd Qux = h * N_.transpose() + Bd.transpose() * S_Ad;
+      const Eigen::VectorXd qx =
+          -h * (Q_ * xd0 + N_ * ud0) + Ad.transpose() * S_cd_plus_sx;
+      const Eigen::VectorXd qu = -h * (R_ * ud0 + N_.transpose() * xd0) +
+                                 Bd.transpose() * S_cd_plus_sx;
+      const double q0 =
+          h * (xd0.dot(Q_ * xd0) + ud0.dot(R_ * ud0) + 2 * xd0.dot(N_ * ud0)) +
+          cd.dot(S_next * cd) + 2 * cd.dot(sx[k + 1].col(0)) + s0[k + 1](0);
+
+      // Minimize over u[k].
+      const Eigen::LLT<Eigen::MatrixXd> Quu_cholesky(Quu);
+      DRAKE_THROW_UNLESS(Quu_cholesky.info() == Eigen::Success);
+      K[k] = Quu_cholesky.solve(Qux);
+      const Eigen::VectorXd k0_k = Quu_cholesky.solve(qu);
+      const Eigen::MatrixXd S_k = Qxx - Qux.transpose() * K[k];
+      S[k] = 0.5 * (S_k + S_k.transpose());
+      sx[k] = qx - Qux.transpose() * k0_k;
+      s0[k] = Vector1d(q0 - qu.dot(k0_k));
+      k0[k] = k0_k;
+    }
+    // The gains are held over each time step, so the final sample is unused.
+    K[num_steps] = K[num_steps - 1];
+    k0[num_steps] = k0[num_steps - 1];
+
+    result->S = std::make_unique<PiecewisePolynomial<double>>(
+        PiecewisePolynomial<double>::FirstOrderHold(times, S));
+    result->sx = std::make_unique<PiecewisePolynomial<double>>(
+        PiecewisePolynomial<double>::FirstOrderHold(times, sx));
+    result->s0 = std::make_unique<PiecewisePolynomial<double>>(
+        PiecewisePolynomial<double>::FirstOrderHold(times, s0));
+    result->K = std::make_unique<PiecewisePolynomial<double>>(
+        PiecewisePolynomial<double>::ZeroOrderHold(times, K));
+    result->k0 = std::make_unique<PiecewisePolynomial<double>>(
+        PiecewisePolynomial<double>::ZeroOrderHold(times, k0));
+  }
+
   // TODO(russt): It would be more elegant to think of S and K as an output of
   // the RiccatiSystem, but we don't (yet) have a way to get the dense
   // integration results of an output port.
@@ -261,6 +331,32 @@ class RiccatiSystem : public LeafSystem<double> {
   }
 
  private:
+  // Computes the linearization ẋ - ẋ₀(t) ≈ A(x - x₀(t)) + B(u - u₀(t)) + c of
+  // the plant dynamics about the nominal trajectories at time t.
+  void CalcLinearization(double t, Eigen::MatrixXd* A, Eigen::MatrixXd* B,
+                         Eigen::VectorXd* c) const {
+    context_->SetTime(t);
+    auto autodiff_args =
+        math::InitializeAutoDiffTuple(x0_.value(t), u0_.value(t));
+    context_->SetContinuousState(std::get<0>(autodiff_args));
+    input_port_->FixValue(context_.get(), std::get<1>(autodiff_args));
+    const VectorX<AutoDiffXd> autodiff_xdot0 =
+        system_->EvalTimeDerivatives(*context_).CopyToVector();
+    const Eigen::MatrixXd AB = math::ExtractGradient(autodiff_xdot0);
+    *A = AB.leftCols(num_states_);
+    *B = AB.rightCols(num_inputs_);
+    *c = math::ExtractValue(autodiff_xdot0) - x0_.EvalDerivative(t, 1);
+  }
+
+  // Computes the desired trajectories relative to the nominal at time t.
+  void CalcDesiredRelativeToNominal(double t, Eigen::VectorXd* xd0,
+                                    Eigen::VectorXd* ud0) const {
+    *xd0 = options_.xd ? (options_.xd->value(t) - x0_.value(t)).eval()
+                       : Eigen::VectorXd::Zero(num_states_);
+    *ud0 = options_.ud ? (options_.ud->value(t) - u0_.value(t)).eval()
+                       : Eigen::VectorXd::Zero(num_inputs_);
+  }
+
   const std::unique_ptr<const System<AutoDiffXd>> system_;
   const InputPort<AutoDiffXd>* const input_port_;
 
@@ -308,6 +404,14 @@ FiniteHorizonLinearQuadraticRegulator(
     x0 = std::make_unique<PiecewisePolynomial<double>>(
         context.get_continuous_state_vector().CopyToVector());
   }
+  if (options.riccati_recursion_time_step) {
+    DRAKE_THROW_UNLESS(*options.riccati_recursion_time_step > 0);
+    if (options.use_square_root_method) {
+      throw std::logic_error(
+          "options.riccati_recursion_time_step cannot be combined with "
+          "options.use_square_root_method.");
+    }
+  }
   if (options.use_square_root_method && !options.Qf) {
     throw std::logic_error(
         "options.Qf is required when options.use_square_root_method is set to "
@@ -328,6 +432,22 @@ FiniteHorizonLinearQuadraticRegulator(
   RiccatiSystem riccati(system, context, Q, R, options.x0 ? *options.x0 : *x0,
                         options.u0 ? *options.u0 : *u0, options);
 
+  if (options.riccati_recursion_time_step) {
+    if (options.Qf) {
+      const double kSymmetryTolerance = 1e-8;
+      DRAKE_DEMAND(options.Qf->rows() == num_states &&
+                   options.Qf->cols() == num_states);
+      DRAKE_DEMAND(
+          math::IsPositiveDefinite(*options.Qf, 0.0, kSymmetryTolerance));
+    }
+    FiniteHorizonLinearQuadraticRegulatorResult result;
+    riccati.SolveRiccatiRecursion(t0, tf, *options.riccati_recursion_time_step,
+                                  &result);
+    result.x0 = options.x0 ? options.x0->Clone() : std::move(x0);
+    result.u0 = options.u0 ? options.u0->Clone() : std::move(u0);
+    return result;
+  }
+
   // Simulator doesn't support integrating backwards in time, so simulate the
   // time-reversed Riccati equation from -tf to -t0, and reverse it after the
   // fact.
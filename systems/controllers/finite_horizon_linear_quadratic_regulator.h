@@ -77,6 +77,20 @@ struct FiniteHorizonLinearQuadraticRegulatorOptions {
   struct. */
   bool use_square_root_method{false};
 
+  /**
+  When set, the Riccati equation is not integrated by the Simulator. Instead,
+  the linearized dynamics are discretized (by the explicit Euler method) on a
+  uniform time grid spanning [t0, tf], whose spacing is at most this time step,
+  and the solution is computed by the discrete-time Riccati recursion backwards
+  over the grid. This is typically much faster for long, time-varying
+  trajectories, since each grid point requires only one linearization of the
+  plant and a few dense matrix operations, at the cost of an O(time_step)
+  discretization error. The resulting S, sx, and s0 trajectories are
+  piecewise-linear and the K and k0 trajectories are piecewise-constant over
+  the grid. This cannot be combined with `use_square_root_method`, and the
+  `simulator_config` is ignored. */
+  std::optional<double> riccati_recursion_time_step;
+
   /**
   For continuous-time dynamical systems, the Riccati equation is solved by the
   Simulator (running backwards in time). Use this parameter to configure the
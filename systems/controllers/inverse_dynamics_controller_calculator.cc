@@ -0,0 +1,99 @@
+#include "drake/systems/controllers/inverse_dynamics_controller_calculator.h"
+
+namespace drake {
+namespace systems {
+namespace controllers {
+
+using multibody::MultibodyPlant;
+
+namespace {
+
+// Checks the constructor arguments before any members are built from them.
+template <typename T>
+const MultibodyPlant<T>& CheckArguments(const MultibodyPlant<T>& plant,
+                                        const VectorX<double>& kp,
+                                        const VectorX<double>& ki,
+                                        const VectorX<double>& kd) {
+  DRAKE_THROW_UNLESS(plant.is_finalized());
+  const int num_positions = plant.num_positions();
+  DRAKE_THROW_UNLESS(plant.num_velocities() == num_positions);
+  DRAKE_THROW_UNLESS(kp.size() == num_positions);
+  DRAKE_THROW_UNLESS(ki.size() == num_positions);
+  DRAKE_THROW_UNLESS(kd.size() == num_positions);
+  return plant;
+}
+
+}  // namespace
+
+template <typename T>
+InverseDynamicsControllerCalculator<T>::InverseDynamicsControllerCalculator(
+    const MultibodyPlant<T>& plant, const VectorX<double>& kp,
+    const VectorX<double>& ki, const VectorX<double>& kd)
+    : plant_(CheckArguments(plant, kp, ki, kd)),
+      kp_(kp.cast<T>()),
+      ki_(ki.cast<T>()),
+      kd_(kd.cast<T>()),
+      plant_context_(plant.CreateDefaultContext()),
+      applied_forces_(plant),
+      workspace_(plant),
+      vd_command_(plant.num_velocities()) {}
+
+template <typename T>
+InverseDynamicsControllerCalculator<T>::~InverseDynamicsControllerCalculator() =
+    default;
+
+template <typename T>
+void InverseDynamicsControllerCalculator<T>::CalcForce(
+    const Eigen::Ref<const VectorX<T>>& x,
+    const Eigen::Ref<const VectorX<T>>& x_d,
+    const Eigen::Ref<const VectorX<T>>& integral,
+    const Eigen::Ref<const VectorX<T>>& vd_d, EigenPtr<VectorX<T>> force) {
+  DRAKE_THROW_UNLESS(vd_d.size() == vd_command_.size());
+  CalcPidAcceleration(x, x_d, integral);
+  vd_command_ += vd_d;
+  CalcInverseDynamics(force);
+}
+
+template <typename T>
+void InverseDynamicsControllerCalculator<T>::CalcForce(
+    const Eigen::Ref<const VectorX<T>>& x,
+    const Eigen::Ref<const VectorX<T>>& x_d,
+    const Eigen::Ref<const VectorX<T>>& integral, EigenPtr<VectorX<T>> force) {
+  CalcPidAcceleration(x, x_d, integral);
+  CalcInverseDynamics(force);
+}
+
+template <typename T>
+void InverseDynamicsControllerCalculator<T>::CalcPidAcceleration(
+    const Eigen::Ref<const VectorX<T>>& x,
+    const Eigen::Ref<const VectorX<T>>& x_d,
+    const Eigen::Ref<const VectorX<T>>& integral) {
+  const int num_positions = plant_.num_positions();
+  DRAKE_THROW_UNLESS(x.size() == 2 * num_positions);
+  DRAKE_THROW_UNLESS(x_d.size() == 2 * num_positions);
+  DRAKE_THROW_UNLESS(integral.size() == num_positions);
+  plant_.SetPositionsAndVelocities(plant_context_.get(), x);
+  vd_command_ =
+      (kp_.array() * (x_d.head(num_positions) - x.head(num_positions)).array() +
+       kd_.array() * (x_d.tail(num_positions) - x.tail(num_positions)).array() +
+       ki_.array() * integral.array())
+          .matrix();
+}
+
+template <typename T>
+void InverseDynamicsControllerCalculator<T>::CalcInverseDynamics(
+    EigenPtr<VectorX<T>> force) {
+  DRAKE_THROW_UNLESS(force != nullptr);
+  // As in InverseDynamics, the forces of the plant's force elements (e.g.,
+  // gravity) are compensated for.
+  plant_.CalcForceElementsContribution(*plant_context_, &applied_forces_);
+  plant_.CalcInverseDynamics(*plant_context_, vd_command_, applied_forces_,
+                             &workspace_, force);
+}
+
+}  // namespace controllers
+}  // namespace systems
+}  // namespace drake
+
+DRAKE_DEFINE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS(
+    class ::drake::systems::controllers::InverseDynamicsControllerCalculator)
@@ -0,0 +1,126 @@
+#pragma once
+
+#include <memory>
+
+#include "drake/common/default_scalars.h"
+#include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
+#include "drake/multibody/plant/multibody_plant.h"
+#include "drake/multibody/tree/multibody_workspace.h"
+
+namespace drake {
+namespace systems {
+namespace controllers {
+
+/**
+ * Computes the control law of InverseDynamicsController directly, without a
+ * System, for real-time control loops. Given the estimated state (q, v), the
+ * desired state (q_d, v_d), the integral of the position error ∫(q_d − q),
+ * and (optionally) the desired acceleration vd_d, it computes
+ * <pre>
+ *   force = inverse_dynamics(q, v, vd_command), where
+ *   vd_command = kp(q_d - q) + kd(v_d - v) + ki int(q_d - q) + vd_d,
+ * </pre>
+ * which is the same output as InverseDynamicsController, in a single call.
+ *
+ * Evaluating an InverseDynamicsController (a Diagram of a PidController, an
+ * Adder, and InverseDynamics) on every tick of a high-rate loop pays for the
+ * port evaluations, the copies between subsystems, and the temporaries
+ * allocated by MultibodyPlant::CalcInverseDynamics(). Instead, this class
+ * keeps its own plant Context, a multibody::MultibodyForces, and a
+ * multibody::MultibodyWorkspace, so that for `T = double`, CalcForce() does
+ * not allocate any heap memory after its first call.
+ *
+ * Unlike the System, this class does not integrate the position error; the
+ * caller owns the integral term and passes it to CalcForce() (e.g., by
+ * accumulating `dt * (q_d - q)` each tick).
+ *
+ * An instance is not thread-safe, since CalcForce() uses its internal storage;
+ * create one per thread.
+ *
+ * @see InverseDynamicsController for the assumptions on the plant.
+ *
+ * @tparam_default_scalar
+ * @ingroup control
+ */
+template <typename T>
+class InverseDynamicsControllerCalculator {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(InverseDynamicsControllerCalculator)
+
+  /**
+   * Constructs the calculator for the given `plant`, which must outlive
+   * `this`. The plant parameters are taken from a default plant Context,
+   * which can be modified by get_mutable_plant_context().
+   * @param plant The model of the plant for control.
+   * @param kp Position gain.
+   * @param ki Integral gain.
+   * @param kd Velocity gain.
+   * @throws std::exception if
+   *  - The plant is not finalized (see MultibodyPlant::Finalize()).
+   *  - The number of generalized velocities is not equal to the number of
+   *    generalized positions.
+   *  - Vector kp, ki and kd do not all have the same size equal to the number
+   *    of generalized positions.
+   */
+  InverseDynamicsControllerCalculator(
+      const multibody::MultibodyPlant<T>& plant, const VectorX<double>& kp,
+      const VectorX<double>& ki, const VectorX<double>& kd);
+
+  ~InverseDynamicsControllerCalculator();
+
+  /**
+   * Computes the generalized force for the given estimated state `x` = (q, v),
+   * desired state `x_d` = (q_d, v_d), integral of the position error
+   * `integral` = ∫(q_d − q), and desired acceleration `vd_d`, and writes it to
+   * `force`.
+   * @throws std::exception if any argument has the wrong size, or if `force`
+   * is nullptr.
+   */
+  void CalcForce(const Eigen::Ref<const VectorX<T>>& x,
+                 const Eigen::Ref<const VectorX<T>>& x_d,
+                 const Eigen::Ref<const VectorX<T>>& integral,
+                 const Eigen::Ref<const VectorX<T>>& vd_d,
+                 EigenPtr<VectorX<T>> force);
+
+  /**
+   * Overload of CalcForce() for a zero desired acceleration `vd_d`.
+   */
+  void CalcForce(const Eigen::Ref<const VectorX<T>>& x,
+                 const Eigen::Ref<const VectorX<T>>& x_d,
+                 const Eigen::Ref<const VectorX<T>>& integral,
+                 EigenPtr<VectorX<T>> force);
+
+  /** Returns the plant used for control. */
+  const multibody::MultibodyPlant<T>& plant() const { return plant_; }
+
+  /** Returns the plant Context used by CalcForce(), e.g., to set the plant's
+   parameters. CalcForce() overwrites its state. */
+  Context<T>& get_mutable_plant_context() { return *plant_context_; }
+
+ private:
+  // Sets the plant state to `x` and vd_command_ to the PID terms of the
+  // acceleration command.
+  void CalcPidAcceleration(const Eigen::Ref<const VectorX<T>>& x,
+                           const Eigen::Ref<const VectorX<T>>& x_d,
+                           const Eigen::Ref<const VectorX<T>>& integral);
+
+  // Computes the inverse dynamics for vd_command_ into `force`.
+  void CalcInverseDynamics(EigenPtr<VectorX<T>> force);
+
+  const multibody::MultibodyPlant<T>& plant_;
+  const VectorX<T> kp_;
+  const VectorX<T> ki_;
+  const VectorX<T> kd_;
+  const std::unique_ptr<Context<T>> plant_context_;
+  multibody::MultibodyForces<T> applied_forces_;
+  multibody::MultibodyWorkspace<T> workspace_;
+  VectorX<T> vd_command_;
+};
+
+}  // namespace controllers
+}  // namespace systems
+}  // namespace drake
+
+DRAKE_DECLARE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS(
+    class ::drake::systems::controllers::InverseDynamicsControllerCalculator)
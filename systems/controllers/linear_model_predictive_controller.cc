@@ -5,15 +5,27 @@
 
 #include "drake/common/eigen_types.h"
 #include "drake/planning/trajectory_optimization/direct_transcription.h"
-#include "drake/solvers/solve.h"
+#include "drake/solvers/choose_best_solver.h"
+#include "drake/solvers/osqp_solver.h"
+#include "drake/solvers/solver_interface.h"
 
 namespace drake {
 namespace systems {
 namespace controllers {
 
 using planning::trajectory_optimization::DirectTranscription;
+using solvers::Binding;
+using solvers::BoundingBoxConstraint;
 using solvers::VectorXDecisionVariable;
 
+template <typename T>
+struct LinearModelPredictiveController<T>::Qp {
+  std::unique_ptr<DirectTranscription> dirtran;
+  // Constrains the initial state error of the trajectory.
+  Binding<BoundingBoxConstraint> initial_state_constraint;
+  std::unique_ptr<solvers::SolverInterface> solver;
+};
+
 template <typename T>
 LinearModelPredictiveController<T>::LinearModelPredictiveController(
     std::unique_ptr<systems::System<double>> model,
@@ -64,7 +76,7 @@ LinearModelPredictiveController<T>::LinearModelPredictiveController(
   }
 
   // TODO(jwnimmer-tri) This seems like a misunderstood attempt at implementing
-  // discrete dynamics. The intent *appears* to be that SetupAndSolveQp should
+  // discrete dynamics. The intent *appears* to be that SolveQp should
   // be run once every time_step. However, both because its result is NOT stored
   // as state and because the output is direct-feedthrough from the input, we do
   // not actually embody any kind of discrete dynamics. Anytime a user evaluates
@@ -76,16 +88,20 @@ LinearModelPredictiveController<T>::LinearModelPredictiveController(
 
   if (base_context_ != nullptr) {
     linear_model_ = Linearize(*model_, *base_context_);
+    SetupQp();
   }
 }
 
+template <typename T>
+LinearModelPredictiveController<T>::~LinearModelPredictiveController() =
+    default;
+
 template <typename T>
 void LinearModelPredictiveController<T>::CalcControl(
     const Context<T>& context, BasicVector<T>* control) const {
   const VectorX<T>& current_state = get_state_port().Eval(context);
 
-  const Eigen::VectorXd current_input =
-      SetupAndSolveQp(*base_context_, current_state);
+  const Eigen::VectorXd current_input = SolveQp(*base_context_, current_state);
 
   const VectorX<T> input_ref = model_->get_input_port().Eval(*base_context_);
 
@@ -102,32 +118,57 @@ LinearModelPredictiveController<T>::DoNothingButPretendItWasSomething(
 }
 
 template <typename T>
-VectorX<T> LinearModelPredictiveController<T>::SetupAndSolveQp(
-    const Context<T>& base_context, const VectorX<T>& current_state) const {
+void LinearModelPredictiveController<T>::SetupQp() {
   DRAKE_DEMAND(linear_model_ != nullptr);
 
   const int kNumSampleTimes =
       static_cast<int>(time_horizon_ / time_period_ + 0.5);
 
-  DirectTranscription dirtran(linear_model_.get(), *base_context_,
-                              kNumSampleTimes);
-  auto& prog = dirtran.prog();
+  auto dirtran = std::make_unique<DirectTranscription>(
+      linear_model_.get(), *base_context_, kNumSampleTimes);
+  auto& prog = dirtran->prog();
+
+  const auto state_error = dirtran->state();
+  const auto input_error = dirtran->input();
+
+  dirtran->AddRunningCost(state_error.transpose() * Q_ * state_error +
+                          input_error.transpose() * R_ * input_error);
 
-  const auto state_error = dirtran.state();
-  const auto input_error = dirtran.input();
+  // The bounds are set to the current state error by SolveQp().
+  const Eigen::VectorXd zero = Eigen::VectorXd::Zero(num_states_);
+  Binding<BoundingBoxConstraint> initial_state_constraint =
+      prog.AddBoundingBoxConstraint(zero, zero, dirtran->initial_state());
 
-  dirtran.AddRunningCost(state_error.transpose() * Q_ * state_error +
-                         input_error.transpose() * R_ * input_error);
+  // The structure of the program is fixed, so we only choose the solver once.
+  std::unique_ptr<solvers::SolverInterface> solver =
+      solvers::MakeSolver(solvers::ChooseBestSolver(prog));
+  if (auto* osqp = dynamic_cast<solvers::OsqpSolver*>(solver.get())) {
+    osqp->set_reuse_workspace(true);
+  }
+
+  qp_ = std::make_unique<Qp>(Qp{std::move(dirtran),
+                                std::move(initial_state_constraint),
+                                std::move(solver)});
+}
+
+template <typename T>
+VectorX<T> LinearModelPredictiveController<T>::SolveQp(
+    const Context<T>& base_context, const VectorX<T>& current_state) const {
+  DRAKE_DEMAND(qp_ != nullptr);
+  std::lock_guard<std::mutex> lock(qp_mutex_);
 
   const VectorX<T> state_ref =
       base_context.get_discrete_state().get_vector().CopyToVector();
-  prog.AddLinearConstraint(dirtran.initial_state() ==
-                           current_state - state_ref);
+  const VectorX<T> initial_state_error = current_state - state_ref;
+  qp_->initial_state_constraint.evaluator()->set_bounds(initial_state_error,
+                                                        initial_state_error);
 
-  const auto result = Solve(prog);
+  solvers::MathematicalProgramResult result;
+  qp_->solver->Solve(qp_->dirtran->prog(), std::nullopt, std::nullopt,
+                     &result);
   DRAKE_DEMAND(result.is_success());
 
-  return dirtran.GetInputSamples(result).col(0);
+  return qp_->dirtran->GetInputSamples(result).col(0);
 }
 
 template class LinearModelPredictiveController<double>;
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
 
 #include "drake/common/drake_copyable.h"
 #include "drake/common/trajectories/piecewise_polynomial.h"
@@ -23,9 +24,11 @@ namespace controllers {
 ///
 /// and subject to linear inequality constraints on the inputs and states, where
 /// N is the horizon length, Q and R are cost matrices, and xd and ud are the
-/// desired states and inputs, respectively.  Note that the present
-/// implementation solves the QP in whole at every time step, discarding any
-/// information between steps.
+/// desired states and inputs, respectively.  The QP is constructed once, and
+/// at every time step only the constraint on the initial state is updated
+/// before solving it again.  When the QP is solved by OSQP, the solver's
+/// workspace is also kept between time steps, and each solve is warm started
+/// from the previous solution.
 ///
 /// @system
 /// name: LinearModelPredictiveController
@@ -72,6 +75,8 @@ class LinearModelPredictiveController : public LeafSystem<T> {
       std::unique_ptr<systems::Context<double>> base_context,
       const Eigen::MatrixXd& Q, const Eigen::MatrixXd& R, double time_period,
       double time_horizon);
+
+  ~LinearModelPredictiveController() override;
     // TODO(jadecastro) Get time_period directly from the plant model.
 
   const InputPort<T>& get_state_port() const {
@@ -87,10 +92,16 @@ class LinearModelPredictiveController : public LeafSystem<T> {
   EventStatus DoNothingButPretendItWasSomething(const Context<T>&,
                                                 DiscreteValues<T>*) const;
 
-  // Sets up a DirectTranscription problem and solves for the current control
-  // input.
-  VectorX<T> SetupAndSolveQp(const Context<T>& base_context,
-                             const VectorX<T>& current_state) const;
+  // The DirectTranscription problem and the solver used by SolveQp().
+  struct Qp;
+
+  // Sets up the DirectTranscription problem solved by SolveQp().
+  void SetupQp();
+
+  // Updates the initial state of the DirectTranscription problem, and solves
+  // for the current control input.
+  VectorX<T> SolveQp(const Context<T>& base_context,
+                     const VectorX<T>& current_state) const;
 
   const int state_input_index_{-1};
   const int control_output_index_{-1};
@@ -110,6 +121,10 @@ class LinearModelPredictiveController : public LeafSystem<T> {
 
   // Description of the linearized plant model.
   std::unique_ptr<LinearSystem<double>> linear_model_;
+
+  // The QP is shared by all contexts, so it is only solved for one at a time.
+  mutable std::mutex qp_mutex_;
+  std::unique_ptr<Qp> qp_;
 };
 
 }  // namespace controllers
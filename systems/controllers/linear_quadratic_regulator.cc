@@ -1,6 +1,7 @@
 #include "drake/systems/controllers/linear_quadratic_regulator.h"
 
 #include <optional>
+#include <utility>
 
 #include <Eigen/QR>
 
@@ -116,6 +117,58 @@ LinearQuadraticRegulatorResult LinearQuadraticRegulator(
   return ret;
 }
 
+std::vector<LinearQuadraticRegulatorResult> LinearQuadraticRegulator(
+    const std::vector<Eigen::MatrixXd>& A,
+    const std::vector<Eigen::MatrixXd>& B,
+    const Eigen::Ref<const Eigen::MatrixXd>& Q,
+    const Eigen::Ref<const Eigen::MatrixXd>& R,
+    const Eigen::Ref<const Eigen::MatrixXd>& N, Parallelism parallelism) {
+  DRAKE_THROW_UNLESS(A.size() == B.size());
+  const int num_problems = A.size();
+  const Eigen::Index n = Q.rows(), m = R.rows();
+  DRAKE_THROW_UNLESS(n > 0 && m > 0);
+  DRAKE_THROW_UNLESS(Q.cols() == n && R.cols() == m);
+  for (int i = 0; i < num_problems; ++i) {
+    DRAKE_THROW_UNLESS(A[i].rows() == n && A[i].cols() == n);
+    DRAKE_THROW_UNLESS(B[i].rows() == n && B[i].cols() == m);
+  }
+  // N is default to Matrix<double, 0, 0>.
+  if (N.rows() != 0) {
+    DRAKE_THROW_UNLESS(N.rows() == n && N.cols() == m);
+  }
+  DRAKE_DEMAND(is_approx_equal_abstol(R, R.transpose(), 1e-10));
+
+  Eigen::LLT<Eigen::MatrixXd> R_cholesky(R);
+  if (R_cholesky.info() != Eigen::Success)
+    throw std::runtime_error("R must be positive definite");
+
+  std::vector<Eigen::MatrixXd> S;
+  if (N.rows() != 0) {
+    // As in the single-system case, this is equivalent to the LQR problem of
+    // the modified systems with Q₁=Q−NR⁻¹Nᵀ, A₁=A−BR⁻¹Nᵀ.
+    const Eigen::MatrixXd R_inv_NT = R_cholesky.solve(N.transpose());
+    const Eigen::MatrixXd Q1 = Q - N * R_inv_NT;
+    std::vector<Eigen::MatrixXd> A1(num_problems);
+    for (int i = 0; i < num_problems; ++i) {
+      A1[i] = A[i] - B[i] * R_inv_NT;
+    }
+    S = math::ContinuousAlgebraicRiccatiEquation(A1, B, Q1, R, parallelism);
+  } else {
+    S = math::ContinuousAlgebraicRiccatiEquation(A, B, Q, R, parallelism);
+  }
+
+  std::vector<LinearQuadraticRegulatorResult> results(num_problems);
+  for (int i = 0; i < num_problems; ++i) {
+    Eigen::MatrixXd BT_S_plus_NT = B[i].transpose() * S[i];
+    if (N.rows() != 0) {
+      BT_S_plus_NT += N.transpose();
+    }
+    results[i].K = R_cholesky.solve(BT_S_plus_NT);
+    results[i].S = std::move(S[i]);
+  }
+  return results;
+}
+
 LinearQuadraticRegulatorResult DiscreteTimeLinearQuadraticRegulator(
     const Eigen::Ref<const Eigen::MatrixXd>& A,
     const Eigen::Ref<const Eigen::MatrixXd>& B,
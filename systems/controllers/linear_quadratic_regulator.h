@@ -1,7 +1,9 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
+#include "drake/common/parallelism.h"
 #include "drake/systems/primitives/linear_system.h"
 
 namespace drake {
@@ -50,6 +52,31 @@ LinearQuadraticRegulatorResult LinearQuadraticRegulator(
     const Eigen::Ref<const Eigen::MatrixXd>& F =
         Eigen::Matrix<double, 0, 0>::Zero());
 
+/// Computes the optimal feedback controller and cost-to-go of
+/// LinearQuadraticRegulator(A[i], B[i], Q, R, N) for each pair (A[i], B[i]),
+/// with the same costs Q, R, and N for every pair (e.g., to compute a gain
+/// schedule over many linearization points).
+///
+/// The Riccati equations are solved in parallel by the batched
+/// math::ContinuousAlgebraicRiccatiEquation(), which warm-starts each solve
+/// from the solution of the preceding pair; ordering the pairs so that
+/// neighbors are similar (e.g., along a trajectory) makes it faster.
+///
+/// @param parallelism The maximum number of threads to solve with.
+/// @returns the result for each pair, in the same order as `A` and `B`.
+/// @throws std::exception if A and B have different sizes, if any of the
+/// matrices have inconsistent dimensions, or if R is not positive definite.
+/// @ingroup control
+/// @pydrake_mkdoc_identifier{batch}
+std::vector<LinearQuadraticRegulatorResult> LinearQuadraticRegulator(
+    const std::vector<Eigen::MatrixXd>& A,
+    const std::vector<Eigen::MatrixXd>& B,
+    const Eigen::Ref<const Eigen::MatrixXd>& Q,
+    const Eigen::Ref<const Eigen::MatrixXd>& R,
+    const Eigen::Ref<const Eigen::MatrixXd>& N =
+        Eigen::Matrix<double, 0, 0>::Zero(),
+    Parallelism parallelism = Parallelism::Max());
+
 // TODO(russt): Consider implementing the optional N argument as in the
 // continuous-time formulation.
 /// Computes the optimal feedback controller, u=-Kx, and the optimal
@@ -202,6 +202,59 @@ GTEST_TEST(FittedValueIteration, DoubleIntegrator) {
   }
 }
 
+// The parallel computation gives the same result as the serial one.
+GTEST_TEST(FittedValueIteration, Parallelism) {
+  Eigen::Matrix2d A;
+  A << 0., 1., 0., 0.;
+  const Eigen::Vector2d B{0., 1.};
+  LinearSystem<double> sys(A, B, Eigen::Matrix2d::Identity(),
+                           Eigen::Vector2d::Zero());
+
+  const auto cost_function = [&sys](const Context<double>& context) {
+    const Eigen::Vector2d x = context.get_continuous_state().CopyToVector();
+    const double u = sys.get_input_port().Eval(context)[0];
+    return x.dot(x) + u * u;
+  };
+
+  math::BarycentricMesh<double>::MeshGrid state_grid(2);
+  for (double x = -2.; x <= 2.; x += .5) {
+    state_grid[0].insert(x);
+    state_grid[1].insert(x);
+  }
+  math::BarycentricMesh<double>::MeshGrid input_grid(1);
+  for (double u = -2.; u <= 2.; u += .5) {
+    input_grid[0].insert(u);
+  }
+  const double time_step = .05;
+
+  DynamicProgrammingOptions options;
+  options.convergence_tol = 1e-6;
+
+  Simulator<double> serial_simulator(sys);
+  const auto [serial_policy, serial_J] =
+      FittedValueIteration(&serial_simulator, cost_function, state_grid,
+                           input_grid, time_step, options);
+
+  options.parallelism = Parallelism(2);
+  Simulator<double> parallel_simulator(sys);
+  const auto [parallel_policy, parallel_J] =
+      FittedValueIteration(&parallel_simulator, cost_function, state_grid,
+                           input_grid, time_step, options);
+
+  EXPECT_TRUE(CompareMatrices(parallel_J, serial_J, 1e-12));
+  const math::BarycentricMesh<double> state_mesh(state_grid);
+  for (int i = 0; i < state_mesh.get_num_mesh_points(); ++i) {
+    const Eigen::VectorXd x = state_mesh.get_mesh_point(i);
+    auto serial_context = serial_policy->CreateDefaultContext();
+    auto parallel_context = parallel_policy->CreateDefaultContext();
+    serial_policy->get_input_port().FixValue(serial_context.get(), x);
+    parallel_policy->get_input_port().FixValue(parallel_context.get(), x);
+    EXPECT_TRUE(CompareMatrices(
+        parallel_policy->get_output_port().Eval(*parallel_context),
+        serial_policy->get_output_port().Eval(*serial_context)));
+  }
+}
+
 // Ensure that FittedValueIteration can be called on a MultibodyPlant/SceneGraph
 // combo.
 GTEST_TEST(FittedValueIteration, MultibodyPlant) {
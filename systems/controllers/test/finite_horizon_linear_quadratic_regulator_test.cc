@@ -294,6 +294,69 @@ GTEST_TEST(FiniteHorizonLQRTest, AffineSystemTest) {
   EXPECT_TRUE(CompareMatrices(result.k0->value(t0), -udv, 1e-4));
 }
 
+// The Riccati recursion approximates the solution of the Riccati differential
+// equation, with an error that shrinks with the time step.
+GTEST_TEST(FiniteHorizonLQRTest, RiccatiRecursion) {
+  Eigen::Matrix2d A;
+  Eigen::Vector2d B;
+  Eigen::Vector2d c;
+  A << 0, 1, -1, -0.2;
+  B << 0, 1;
+  c << 0.1, -0.3;
+  AffineSystem<double> sys(A, B, c, Eigen::Matrix<double, 0, 2>(),
+                           Eigen::Matrix<double, 0, 1>(),
+                           Eigen::Matrix<double, 0, 1>());
+  auto context = sys.CreateDefaultContext();
+  sys.get_input_port().FixValue(context.get(), 0.0);
+
+  Eigen::Matrix2d Q;
+  Q << 1, 0.1, 0.1, 2;
+  const Vector1d R(0.5);
+  const double t0 = 0;
+  const double tf = 3.0;
+  FiniteHorizonLinearQuadraticRegulatorOptions options;
+  options.Qf = Eigen::Vector2d(3, 1).asDiagonal();
+  options.N = Eigen::Vector2d(0.1, 0.2);
+  const trajectories::PiecewisePolynomial<double> xd_traj(
+      Eigen::Vector2d(1, -0.5));
+  options.xd = &xd_traj;
+
+  const FiniteHorizonLinearQuadraticRegulatorResult expected =
+      FiniteHorizonLinearQuadraticRegulator(sys, *context, t0, tf, Q, R,
+                                            options);
+
+  options.riccati_recursion_time_step = 1e-3;
+  const FiniteHorizonLinearQuadraticRegulatorResult result =
+      FiniteHorizonLinearQuadraticRegulator(sys, *context, t0, tf, Q, R,
+                                            options);
+  EXPECT_EQ(result.x0->value(t0), expected.x0->value(t0));
+  EXPECT_EQ(result.u0->value(t0), expected.u0->value(t0));
+  for (const double t : {t0, 1.0, 2.5, tf}) {
+    const double tol = 1e-2;
+    EXPECT_TRUE(CompareMatrices(result.S->value(t), expected.S->value(t), tol));
+    EXPECT_TRUE(
+        CompareMatrices(result.sx->value(t), expected.sx->value(t), tol));
+    EXPECT_TRUE(
+        CompareMatrices(result.s0->value(t), expected.s0->value(t), tol));
+    if (t < tf) {
+      EXPECT_TRUE(
+          CompareMatrices(result.K->value(t), expected.K->value(t), tol));
+      EXPECT_TRUE(
+          CompareMatrices(result.k0->value(t), expected.k0->value(t), tol));
+    }
+  }
+
+  options.use_square_root_method = true;
+  EXPECT_THROW(FiniteHorizonLinearQuadraticRegulator(sys, *context, t0, tf, Q,
+                                                     R, options),
+               std::exception);
+  options.use_square_root_method = false;
+  options.riccati_recursion_time_step = 0.0;
+  EXPECT_THROW(FiniteHorizonLinearQuadraticRegulator(sys, *context, t0, tf, Q,
+                                                     R, options),
+               std::exception);
+}
+
 // Ensures that we can scalar convert the System version of the regulator.
 GTEST_TEST(FiniteHorizonLQRTest, ResultSystemIsScalarConvertible) {
   Eigen::Matrix2d A;
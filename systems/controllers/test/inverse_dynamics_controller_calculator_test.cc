@@ -0,0 +1,121 @@
+#include "drake/systems/controllers/inverse_dynamics_controller_calculator.h"
+
+#include <gtest/gtest.h>
+
+#include "drake/common/find_resource.h"
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/common/test_utilities/limit_malloc.h"
+#include "drake/multibody/parsing/parser.h"
+#include "drake/systems/controllers/inverse_dynamics_controller.h"
+
+using drake::multibody::MultibodyPlant;
+using Eigen::VectorXd;
+
+namespace drake {
+namespace systems {
+namespace controllers {
+namespace {
+
+class InverseDynamicsControllerCalculatorTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    plant_ = std::make_unique<MultibodyPlant<double>>(0.0);
+    multibody::Parser(plant_.get())
+        .AddModels(FindResourceOrThrow("drake/manipulation/models/"
+                                       "iiwa_description/sdf/"
+                                       "iiwa14_no_collision.sdf"));
+    plant_->WeldFrames(plant_->world_frame(),
+                       plant_->GetFrameByName("iiwa_link_0"));
+    plant_->Finalize();
+
+    const int dim = plant_->num_positions();
+    kp_ = VectorXd::LinSpaced(dim, 1, 7);
+    ki_ = kp_ / 10;
+    kd_ = kp_ / 2;
+  }
+
+  // Returns an arbitrary state, which differs for each `tick`.
+  VectorXd MakeState(int tick) const {
+    const int dim = plant_->num_positions();
+    const double s = 0.1 * (tick + 1);
+    VectorXd x(2 * dim);
+    x << VectorXd::LinSpaced(dim, -s, s), VectorXd::LinSpaced(dim, 2 * s, -s);
+    return x;
+  }
+
+  std::unique_ptr<MultibodyPlant<double>> plant_;
+  VectorXd kp_, ki_, kd_;
+};
+
+// The calculator computes the same force as the InverseDynamicsController.
+TEST_F(InverseDynamicsControllerCalculatorTest, MatchesSystem) {
+  const int dim = plant_->num_positions();
+  InverseDynamicsControllerCalculator<double> dut(*plant_, kp_, ki_, kd_);
+  EXPECT_EQ(&dut.plant(), plant_.get());
+
+  for (const bool has_reference_acceleration : {false, true}) {
+    const InverseDynamicsController<double> idc(*plant_, kp_, ki_, kd_,
+                                                has_reference_acceleration);
+    auto context = idc.CreateDefaultContext();
+    const VectorXd x = MakeState(0);
+    const VectorXd x_d = MakeState(3);
+    const VectorXd integral = VectorXd::LinSpaced(dim, -1, 1);
+    const VectorXd vd_d = VectorXd::LinSpaced(dim, 1, 7);
+    idc.get_input_port_estimated_state().FixValue(context.get(), x);
+    idc.get_input_port_desired_state().FixValue(context.get(), x_d);
+    idc.set_integral_value(context.get(), integral);
+
+    VectorXd force(dim);
+    if (has_reference_acceleration) {
+      idc.get_input_port_desired_acceleration().FixValue(context.get(), vd_d);
+      dut.CalcForce(x, x_d, integral, vd_d, &force);
+    } else {
+      dut.CalcForce(x, x_d, integral, &force);
+    }
+    EXPECT_TRUE(CompareMatrices(
+        force, idc.get_output_port_control().Eval(*context), 1e-10));
+  }
+}
+
+// After the first call, computing the force does not allocate.
+TEST_F(InverseDynamicsControllerCalculatorTest, NoAllocations) {
+  const int dim = plant_->num_positions();
+  InverseDynamicsControllerCalculator<double> dut(*plant_, kp_, ki_, kd_);
+  const VectorXd x_d = MakeState(10);
+  const VectorXd integral = VectorXd::Zero(dim);
+  const VectorXd vd_d = VectorXd::Ones(dim);
+  VectorXd force(dim);
+  dut.CalcForce(MakeState(0), x_d, integral, vd_d, &force);
+  for (int tick = 1; tick < 4; ++tick) {
+    const VectorXd x = MakeState(tick);
+    drake::test::LimitMalloc guard;
+    dut.CalcForce(x, x_d, integral, vd_d, &force);
+    dut.CalcForce(x, x_d, integral, &force);
+  }
+}
+
+TEST_F(InverseDynamicsControllerCalculatorTest, Errors) {
+  const int dim = plant_->num_positions();
+  EXPECT_THROW(InverseDynamicsControllerCalculator<double>(
+                   *plant_, VectorXd::Zero(dim - 1), ki_, kd_),
+               std::exception);
+  MultibodyPlant<double> unfinalized(0.0);
+  EXPECT_THROW(InverseDynamicsControllerCalculator<double>(
+                   unfinalized, VectorXd(), VectorXd(), VectorXd()),
+               std::exception);
+
+  InverseDynamicsControllerCalculator<double> dut(*plant_, kp_, ki_, kd_);
+  const VectorXd x = MakeState(0);
+  const VectorXd integral = VectorXd::Zero(dim);
+  VectorXd force(dim);
+  EXPECT_THROW(dut.CalcForce(x.head(dim), x, integral, &force),
+               std::exception);
+  EXPECT_THROW(dut.CalcForce(x, x, integral, VectorXd::Zero(1), &force),
+               std::exception);
+  EXPECT_THROW(dut.CalcForce(x, x, integral, nullptr), std::exception);
+}
+
+}  // namespace
+}  // namespace controllers
+}  // namespace systems
+}  // namespace drake
@@ -79,6 +79,14 @@ TEST_F(TestMpcWithDoubleIntegrator, TestAgainstInfiniteHorizonSolution) {
 
   EXPECT_TRUE(CompareMatrices(K * x0, output->get_vector_data(0)->get_value(),
                               kTolerance));
+
+  // The QP is reused for subsequent states.
+  for (const Eigen::Vector2d& x : {Eigen::Vector2d(-2, 0.5), x0}) {
+    dut_->get_input_port(0).FixValue(context.get(), x);
+    dut_->CalcOutput(*context, output.get());
+    EXPECT_TRUE(CompareMatrices(K * x, output->get_vector_data(0)->get_value(),
+                                kTolerance));
+  }
 }
 
 namespace {
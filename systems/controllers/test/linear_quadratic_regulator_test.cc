@@ -1,5 +1,7 @@
 #include "drake/systems/controllers/linear_quadratic_regulator.h"
 
+#include <vector>
+
 #include <gtest/gtest.h>
 
 #include "drake/common/find_resource.h"
@@ -219,6 +221,39 @@ GTEST_TEST(TestLqr, DoubleIntegrator) {
   TestLqrWithHjb(A, B, Q, R, N);
 }
 
+GTEST_TEST(TestLqr, Batch) {
+  // A family of spring-damper-like systems, with varying stiffness.
+  const int num_systems = 7;
+  std::vector<Eigen::MatrixXd> A, B;
+  for (int i = 0; i < num_systems; ++i) {
+    Eigen::Matrix2d A_i;
+    A_i << 0, 1, 0.5 * i - 1, -0.1;
+    A.push_back(A_i);
+    B.push_back(Eigen::Vector2d(0, 1));
+  }
+  const Eigen::Matrix2d Q = Eigen::Matrix2d::Identity();
+  const Vector1d R(2.0);
+  const Eigen::Vector2d N(0.3, 0.1);
+
+  const double tol = 1e-8;
+  for (const bool with_N : {false, true}) {
+    const std::vector<LinearQuadraticRegulatorResult> results =
+        with_N ? LinearQuadraticRegulator(A, B, Q, R, N, Parallelism(2))
+               : LinearQuadraticRegulator(A, B, Q, R);
+    ASSERT_EQ(results.size(), num_systems);
+    for (int i = 0; i < num_systems; ++i) {
+      const LinearQuadraticRegulatorResult expected =
+          with_N ? LinearQuadraticRegulator(A[i], B[i], Q, R, N)
+                 : LinearQuadraticRegulator(A[i], B[i], Q, R);
+      EXPECT_TRUE(CompareMatrices(results[i].K, expected.K, tol));
+      EXPECT_TRUE(CompareMatrices(results[i].S, expected.S, tol));
+    }
+  }
+
+  B.pop_back();
+  EXPECT_THROW(LinearQuadraticRegulator(A, B, Q, R), std::exception);
+}
+
 GTEST_TEST(TestLqr, ConstrainedLinearSystem) {
   // Test the LQR for a constrained system
   // ẋ = Ax+Bu
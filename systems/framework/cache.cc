@@ -13,6 +13,15 @@ std::string CacheEntryValue::GetPathDescription() const {
   return owning_subcontext_->GetSystemPathname() + ":" + description();
 }
 
+std::string CacheEntryValue::TakeRecomputationCause() {
+  const DependencyTracker* const source = invalidation_source_;
+  invalidation_source_ = nullptr;
+  if (source != nullptr && is_out_of_date()) {
+    return source->GetPathDescription();
+  }
+  return is_out_of_date() ? "<unspecified>" : "<caching disabled>";
+}
+
 void CacheEntryValue::ThrowIfBadCacheEntryValue(
     const internal::ContextMessageInterface* owning_subcontext) const {
   if (owning_subcontext_ == nullptr) {
@@ -120,11 +129,35 @@ void Cache::EnableCaching() {
     if (entry) entry->enable_caching();
 }
 
+Cache::Cache(const Cache& source)
+    : store_(source.store_),
+      dummy_(source.dummy_),
+      is_cache_frozen_(source.is_cache_frozen_),
+      is_profiling_enabled_(source.is_profiling_enabled_) {}
+
 void Cache::SetAllEntriesOutOfDate() {
   for (auto& entry : store_)
     if (entry) entry->mark_out_of_date();
 }
 
+void Cache::EnableProfiling() {
+  is_profiling_enabled_ = true;
+  for (auto& entry : store_)
+    if (entry) entry->set_profiling_enabled(true);
+}
+
+void Cache::DisableProfiling() {
+  is_profiling_enabled_ = false;
+  for (auto& entry : store_)
+    if (entry) entry->set_profiling_enabled(false);
+}
+
+void Cache::ResetProfiling() {
+  profile_events_.clear();
+  for (auto& entry : store_)
+    if (entry) entry->reset_statistics();
+}
+
 void Cache::RepairCachePointers(
     const internal::ContextMessageInterface* owning_subcontext) {
   DRAKE_DEMAND(owning_subcontext != nullptr);
@@ -4,7 +4,9 @@
 Declares CacheEntryValue and Cache, which is the container for cache entry
 values. */
 
+#include <chrono>
 #include <cstdint>
+#include <map>
 #include <memory>
 #include <set>
 #include <stdexcept>
@@ -22,6 +24,68 @@ namespace drake {
 namespace systems {
 
 class DependencyGraph;
+class DependencyTracker;
+
+//==============================================================================
+//                          CACHE ENTRY STATISTICS
+//==============================================================================
+/** (Advanced) Profiling counters and timers for a single CacheEntryValue. These
+are accumulated only while cache profiling is enabled for the owning Context;
+otherwise they remain unchanged.
+
+Times are wall-clock times measured around the entry's Calc() function. The
+"cumulative" time includes time spent computing any upstream cache entries
+that the Calc() function evaluated, while the "self" time excludes the time
+spent in such nested cache entry computations (as long as those are also being
+profiled). The self times are usually the better indicator of which
+computations dominate.
+
+@see ContextBase::EnableCacheProfiling() */
+struct CacheEntryStatistics {
+  /** The number of times the value was recomputed. */
+  int64_t num_computations{0};
+
+  /** The number of times the value was marked out of date due to a change in
+  one of its prerequisites. */
+  int64_t num_invalidations{0};
+
+  /** The total time spent recomputing the value, in seconds. */
+  double cumulative_time{0.0};
+
+  /** The total time spent recomputing the value, in seconds, excluding nested
+  cache entry computations. */
+  double self_time{0.0};
+
+  /** The number of recomputations, keyed by their cause. The cause is the
+  path description of the DependencyTracker whose value change first made
+  the entry out of date (e.g., `"::plant:q"` for a change to a subsystem's
+  generalized positions, or `"::controller:u0"` for a fixed input port value),
+  regardless of how many intermediate dependents the change went through.
+  Recomputations that happened only because caching is disabled are keyed as
+  `"<caching disabled>"`, and those that were not caused by a tracked value
+  change (e.g., the initial computation or one forced by
+  ContextBase::SetAllCacheEntriesOutOfDate()) are keyed as
+  `"<unspecified>"`. */
+  std::map<std::string, int64_t> num_computations_by_cause;
+};
+
+/** (Advanced) A record of a single profiled cache entry computation, suitable
+for producing a timeline (e.g., in Chrome's trace-event format).
+@see ContextBase::EnableCacheProfiling() */
+struct CacheProfileEvent {
+  /** The index of the computed cache entry within its subcontext. */
+  CacheIndex cache_index;
+
+  /** The time at which the computation began. */
+  std::chrono::steady_clock::time_point start;
+
+  /** The wall-clock duration of the computation, in seconds. */
+  double duration{0.0};
+
+  /** Why the computation was needed; see
+  CacheEntryStatistics::num_computations_by_cause. */
+  std::string cause;
+};
 
 //==============================================================================
 //                             CACHE ENTRY VALUE
@@ -450,6 +514,59 @@ class CacheEntryValue {
   }
   //@}
 
+  /** @name                  Profiling utilities
+  These are used to find which cache entry computations dominate the cost of
+  evaluating a System. Usually profiling is enabled for all entries at once
+  using ContextBase::EnableCacheProfiling(). */
+  //@{
+
+  /** (Advanced) Returns `true` if profiling statistics are being gathered for
+  this cache entry value. */
+  bool is_profiling_enabled() const { return is_profiling_enabled_; }
+
+  /** (Advanced) Enables or disables the gathering of profiling statistics for
+  this cache entry value. Previously gathered statistics are retained. */
+  void set_profiling_enabled(bool enabled) {
+    is_profiling_enabled_ = enabled;
+    invalidation_source_ = nullptr;
+  }
+
+  /** (Advanced) Returns the profiling statistics gathered so far. */
+  const CacheEntryStatistics& statistics() const { return statistics_; }
+
+  /** (Advanced) Clears the profiling statistics gathered so far. */
+  void reset_statistics() { statistics_ = {}; }
+
+  /** (Internal use only) Returns why the value currently needs to be
+  recomputed, and forgets the recorded invalidation source. See
+  CacheEntryStatistics::num_computations_by_cause. */
+  std::string TakeRecomputationCause();
+
+  /** (Internal use only) Records a computation of this value that took
+  `cumulative_time` seconds, `self_time` of which was spent outside of nested
+  cache entry computations, and that was needed because of `cause`. */
+  void note_computation(double cumulative_time, double self_time,
+                        const std::string& cause) {
+    ++statistics_.num_computations;
+    statistics_.cumulative_time += cumulative_time;
+    statistics_.self_time += self_time;
+    ++statistics_.num_computations_by_cause[cause];
+  }
+
+  /** (Internal use only) Marks the value out of date in response to a
+  prerequisite change that originated with the value change of `source`. If
+  profiling is enabled, the invalidation is counted and, if the value was up to
+  date until now, `source` is remembered as the cause of the next
+  recomputation. This is otherwise identical to mark_out_of_date(). */
+  void note_prerequisite_change(const DependencyTracker* source) {
+    if (is_profiling_enabled_) {
+      ++statistics_.num_invalidations;
+      if ((flags_ & kValueIsOutOfDate) == 0) invalidation_source_ = source;
+    }
+    mark_out_of_date();
+  }
+  //@}
+
  private:
   // So Cache and no one else can construct and copy CacheEntryValues.
   friend class Cache;
@@ -610,6 +727,14 @@ class CacheEntryValue {
   copyable_unique_ptr<AbstractValue> value_;
   int64_t serial_number_{0};
   int flags_{kValueIsOutOfDate};
+
+  // Profiling state; see ContextBase::EnableCacheProfiling(). The
+  // invalidation source is the tracker (in this Context tree) whose value
+  // change most recently made this value go out of date; it must not be
+  // copied since it would still refer to the source Context.
+  bool is_profiling_enabled_{false};
+  CacheEntryStatistics statistics_;
+  reset_on_copy<const DependencyTracker*> invalidation_source_;
 };
 
 //==============================================================================
@@ -732,6 +857,42 @@ class Cache {
   @see ContextBase::is_cache_frozen() for the user-facing API */
   bool is_cache_frozen() const { return is_cache_frozen_; }
 
+  /** (Advanced) Enables the gathering of profiling statistics for all entries
+  in this %Cache, and the recording of a CacheProfileEvent for each of their
+  computations. Previously gathered statistics and events are retained.
+  @see ContextBase::EnableCacheProfiling() for the user-facing API */
+  void EnableProfiling();
+
+  /** (Advanced) Stops gathering profiling statistics and events for all
+  entries in this %Cache. Previously gathered statistics and events are
+  retained.
+  @see ContextBase::DisableCacheProfiling() for the user-facing API */
+  void DisableProfiling();
+
+  /** (Advanced) Clears all profiling statistics and events gathered so far by
+  this %Cache. This has no effect on whether profiling is enabled.
+  @see ContextBase::ResetCacheProfiling() for the user-facing API */
+  void ResetProfiling();
+
+  /** (Advanced) Reports whether profiling is currently enabled for this
+  %Cache. */
+  bool is_profiling_enabled() const { return is_profiling_enabled_; }
+
+  /** (Advanced) Returns the computation events recorded while profiling was
+  enabled, in the order in which the computations finished. At most the first
+  million events are kept (the statistics keep counting past that); a copy of
+  this %Cache starts with no events. */
+  const std::vector<CacheProfileEvent>& profile_events() const {
+    return profile_events_;
+  }
+
+  /** (Internal use only) Records a profiled computation event. */
+  void add_profile_event(const CacheProfileEvent& event) {
+    if (static_cast<int>(profile_events_.size()) < kMaxProfileEvents) {
+      profile_events_.push_back(event);
+    }
+  }
+
   /** (Internal use only) Returns a mutable reference to a dummy CacheEntryValue
   that can serve as a /dev/null-like destination for throw-away writes. */
   CacheEntryValue& dummy_cache_entry_value() { return dummy_; }
@@ -741,11 +902,12 @@ class Cache {
   friend class ContextBase;
 
   // Copy constructor duplicates the source %Cache object, with identical
-  // contents but with the "owning subcontext" back pointers set to null. Those
-  // must be set properly using RepairCachePointers() once the new subcontext is
-  // available. This should only be invoked by ContextBase code as part of
-  // copying an entire Context tree.
-  Cache(const Cache& source) = default;
+  // contents but with the "owning subcontext" back pointers set to null and
+  // no recorded profile events. The pointers must be set properly using
+  // RepairCachePointers() once the new subcontext is available. This should
+  // only be invoked by ContextBase code as part of copying an entire Context
+  // tree.
+  Cache(const Cache& source);
 
   // Assumes `this` %Cache is a recent copy that does not yet have its pointers
   // to the system name-providing service of the new owning Context, and sets
@@ -774,6 +936,14 @@ class Cache {
 
   // Whether we are currently preventing mutable access to the cache.
   bool is_cache_frozen_{false};
+
+  // The most profile events we keep, so that a long profiled run can't
+  // exhaust memory.
+  static constexpr int kMaxProfileEvents = 1'000'000;
+
+  // Whether we are currently profiling, and the computations recorded so far.
+  bool is_profiling_enabled_{false};
+  std::vector<CacheProfileEvent> profile_events_;
 };
 
 }  // namespace systems
@@ -1,5 +1,6 @@
 #include "drake/systems/framework/cache_entry.h"
 
+#include <chrono>
 #include <exception>
 #include <memory>
 #include <typeinfo>
@@ -51,6 +52,39 @@ void CacheEntry::Calc(const ContextBase& context,
   value_producer_.Calc(context, value);
 }
 
+namespace {
+// The time spent in profiled cache entry computations that are nested inside
+// the profiled computation currently underway on this thread, in seconds. This
+// lets us report "self" times that exclude the cost of upstream computations.
+thread_local double nested_computation_time = 0.0;
+}  // namespace
+
+void CacheEntry::CalcWithProfiling(const ContextBase& context,
+                                   CacheEntryValue* cache_value,
+                                   AbstractValue* value) const {
+  using Clock = std::chrono::steady_clock;
+  std::string cause = cache_value->TakeRecomputationCause();
+  const double enclosing_nested_time = nested_computation_time;
+  nested_computation_time = 0.0;
+  const Clock::time_point start = Clock::now();
+  try {
+    Calc(context, value);
+  } catch (...) {
+    // The time spent in a failed Calc() is still charged to the enclosing
+    // computation, but is not recorded as a computation of this entry.
+    const std::chrono::duration<double> elapsed = Clock::now() - start;
+    nested_computation_time = enclosing_nested_time + elapsed.count();
+    throw;
+  }
+  const double elapsed =
+      std::chrono::duration<double>(Clock::now() - start).count();
+  cache_value->note_computation(elapsed, elapsed - nested_computation_time,
+                                cause);
+  context.get_mutable_cache().add_profile_event(
+      {cache_index_, start, elapsed, std::move(cause)});
+  nested_computation_time = enclosing_nested_time + elapsed;
+}
+
 void CacheEntry::CheckValidAbstractValue(const ContextBase& context,
                                          const AbstractValue& proposed) const {
   const CacheEntryValue& cache_value = get_cache_entry_value(context);
@@ -303,10 +303,20 @@ class CacheEntry {
         get_mutable_cache_entry_value(context);
     AbstractValue& value = mutable_cache_value.GetMutableAbstractValueOrThrow();
     // If Calc() throws a recoverable exception, the cache remains out of date.
-    Calc(context, &value);
+    if (mutable_cache_value.is_profiling_enabled()) {
+      CalcWithProfiling(context, &mutable_cache_value, &value);
+    } else {
+      Calc(context, &value);
+    }
     mutable_cache_value.mark_up_to_date();
   }
 
+  // Invokes Calc() while recording its wall-clock time in the statistics of
+  // the given cache entry value, and in the profile events of the Cache.
+  void CalcWithProfiling(const ContextBase& context,
+                         CacheEntryValue* cache_value,
+                         AbstractValue* value) const;
+
   // The value was unexpectedly out of date. Issue a helpful message.
   void ThrowOutOfDate(const char* api) const {
     throw std::logic_error(FormatName(api) + "value out of date.");
@@ -119,6 +119,42 @@ class ContextBase : public internal::ContextMessageInterface {
     return get_cache().is_cache_frozen();
   }
 
+  /** (Debugging) Enables cache profiling recursively for this context and all
+  its subcontexts. While enabled, each cache entry value accumulates
+  CacheEntryStatistics (computation and invalidation counts, wall-clock
+  compute times, and which upstream value change caused each recomputation)
+  and each computation is recorded as a CacheProfileEvent. This costs a few
+  clock reads and string operations per recomputation and a small amount of
+  memory per recorded event, so is best enabled for a bounded period.
+  Previously gathered statistics are retained; use ResetCacheProfiling() to
+  start over. Profiling is disabled by default.
+  @see Diagram::GetCacheProfilingReport() */
+  void EnableCacheProfiling() const {
+    PropagateCachingChange(*this, &Cache::EnableProfiling);
+  }
+
+  /** (Debugging) Disables cache profiling recursively for this context and all
+  its subcontexts. Statistics and events gathered so far are retained.
+  @see EnableCacheProfiling() */
+  void DisableCacheProfiling() const {
+    PropagateCachingChange(*this, &Cache::DisableProfiling);
+  }
+
+  /** (Debugging) Discards all cache profiling statistics and events gathered so
+  far, recursively for this context and all its subcontexts. This does not
+  change whether profiling is enabled.
+  @see EnableCacheProfiling() */
+  void ResetCacheProfiling() const {
+    PropagateCachingChange(*this, &Cache::ResetProfiling);
+  }
+
+  /** (Debugging) Reports whether cache profiling is currently enabled for this
+  %Context. This checks only locally; it is possible that parent, child, or
+  sibling subcontexts are in a different state than this one. */
+  bool is_cache_profiling_enabled() const {
+    return get_cache().is_profiling_enabled();
+  }
+
   /** Returns the local name of the subsystem for which this is the Context.
   This is intended primarily for error messages and logging.
   @see SystemBase::GetSystemName() for details.
@@ -0,0 +1,133 @@
+#include "drake/systems/framework/context_pool.h"
+
+#include <utility>
+
+#include "drake/common/drake_throw.h"
+
+namespace drake {
+namespace systems {
+namespace {
+
+// Returns true iff `context` has a fixed input port that is not fixed in
+// `prototype`. Such a port can't be reset, since a fixed input port can't be
+// unfixed.
+template <typename T>
+bool HasFixedInputNotInPrototype(const Context<T>& context,
+                                 const Context<T>& prototype) {
+  for (int i = 0; i < context.num_input_ports(); ++i) {
+    if (context.MaybeGetFixedInputPortValue(i) != nullptr &&
+        prototype.MaybeGetFixedInputPortValue(i) == nullptr) {
+      return true;
+    }
+  }
+  return false;
+}
+
+}  // namespace
+
+template <typename T>
+void ContextPool<T>::Returner::operator()(Context<T>* context) const {
+  if (pool_ == nullptr) {
+    delete context;
+    return;
+  }
+  pool_->Release(context);
+}
+
+template <typename T>
+ContextPool<T>::ContextPool(const Context<T>& prototype, int num_preallocated)
+    : prototype_([&prototype]() {
+        DRAKE_THROW_UNLESS(prototype.is_root_context());
+        return prototype.Clone();
+      }()) {
+  DRAKE_THROW_UNLESS(num_preallocated >= 0);
+  available_.reserve(num_preallocated);
+  for (int i = 0; i < num_preallocated; ++i) {
+    available_.push_back(prototype_->Clone());
+  }
+  num_allocated_ = num_preallocated;
+}
+
+template <typename T>
+ContextPool<T>::~ContextPool() = default;
+
+template <typename T>
+int ContextPool<T>::num_allocated() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return num_allocated_;
+}
+
+template <typename T>
+int ContextPool<T>::num_available() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return static_cast<int>(available_.size());
+}
+
+template <typename T>
+typename ContextPool<T>::LeasedContext ContextPool<T>::Acquire() {
+  std::unique_ptr<Context<T>> context;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (available_.empty()) {
+      ++num_allocated_;
+      // Make room for the new Context up front, so that Release() never needs
+      // to allocate.
+      available_.reserve(num_allocated_);
+    } else {
+      context = std::move(available_.back());
+      available_.pop_back();
+    }
+  }
+  // Clone or reset outside of the lock; neither touches the pool's state.
+  if (context == nullptr) {
+    context = prototype_->Clone();
+  } else {
+    ResetContext(context.get());
+  }
+  return LeasedContext(context.release(), Returner(this));
+}
+
+template <typename T>
+void ContextPool<T>::ResetContext(Context<T>* context) const {
+  DRAKE_DEMAND(context != nullptr);
+  DRAKE_THROW_UNLESS(!HasFixedInputNotInPrototype(*context, *prototype_));
+  context->SetTimeStateAndParametersFrom(*prototype_);
+  for (int i = 0; i < prototype_->num_input_ports(); ++i) {
+    const FixedInputPortValue* source =
+        prototype_->MaybeGetFixedInputPortValue(i);
+    if (source == nullptr) continue;
+    FixedInputPortValue* destination =
+        context->MaybeGetMutableFixedInputPortValue(i);
+    DRAKE_DEMAND(destination != nullptr);
+    // Copy vectors element-wise, since AbstractValue::SetFrom() would clone
+    // the (non-copyable) BasicVector.
+    const BasicVector<T>* source_vector =
+        source->get_value().template maybe_get_value<BasicVector<T>>();
+    if (source_vector != nullptr) {
+      destination->GetMutableVectorData<T>()->SetFrom(*source_vector);
+    } else {
+      destination->GetMutableData()->SetFrom(source->get_value());
+    }
+  }
+}
+
+template <typename T>
+void ContextPool<T>::Release(Context<T>* context) {
+  std::unique_ptr<Context<T>> owned(context);
+  // A Context with an input port that was fixed while it was leased can't be
+  // reset to the prototype, so it is discarded instead.
+  if (HasFixedInputNotInPrototype(*owned, *prototype_)) {
+    owned.reset();
+    std::lock_guard<std::mutex> lock(mutex_);
+    --num_allocated_;
+    return;
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  available_.push_back(std::move(owned));
+}
+
+}  // namespace systems
+}  // namespace drake
+
+DRAKE_DEFINE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS(
+    class ::drake::systems::ContextPool)
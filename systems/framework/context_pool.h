@@ -0,0 +1,121 @@
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "drake/common/default_scalars.h"
+#include "drake/common/drake_copyable.h"
+#include "drake/systems/framework/context.h"
+
+namespace drake {
+namespace systems {
+
+/** A thread-safe pool of Contexts that are all copies of a prototype, for code
+that would otherwise call System::CreateDefaultContext() or Context::Clone() in
+a hot loop. Allocating a Context for a large Diagram (e.g., a RobotDiagram) is
+expensive; resetting a previously allocated one is not.
+
+Contexts are leased with Acquire() and return to the pool automatically when
+the lease is destroyed. Every leased Context starts out equal to the prototype
+(see ResetContext() for exactly what that means). The pool only allocates
+(clones the prototype) when all of its Contexts are leased out at the same time,
+so after warming up, a steady-state loop of Acquire() calls does not allocate.
+@code
+  ContextPool<double> pool(*system.CreateDefaultContext());
+  for (...) {
+    ContextPool<double>::LeasedContext context = pool.Acquire();
+    context->SetDiscreteState(...);
+    ...
+  }  // The context returns to the pool here.
+@endcode
+
+Acquire() may be called concurrently from multiple threads. Leased Contexts
+must not outlive the pool.
+
+@tparam_default_scalar */
+template <typename T>
+class ContextPool {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(ContextPool)
+
+  /** Returns a leased Context to the pool it came from (or deletes it, if it
+  did not come from a pool). */
+  class Returner {
+   public:
+    Returner() = default;
+    void operator()(Context<T>* context) const;
+
+   private:
+    friend class ContextPool<T>;
+    explicit Returner(ContextPool<T>* pool) : pool_(pool) {}
+    ContextPool<T>* pool_{};
+  };
+
+  /** A Context leased from the pool, which returns to the pool on
+  destruction. */
+  using LeasedContext = std::unique_ptr<Context<T>, Returner>;
+
+  /** Creates a pool of copies of `prototype` (which is cloned; the pool does
+  not retain a reference to it), with `num_preallocated` of them allocated up
+  front.
+  @throws std::exception if `prototype` is not a root context.
+  @throws std::exception if `num_preallocated` is negative. */
+  explicit ContextPool(const Context<T>& prototype, int num_preallocated = 0);
+
+  ~ContextPool();
+
+  /** Returns the prototype that all leased Contexts are reset to. */
+  const Context<T>& prototype() const { return *prototype_; }
+
+  /** Returns the number of Contexts allocated by the pool that still exist,
+  both leased out and available. */
+  int num_allocated() const;
+
+  /** Returns the number of Contexts that are available in the pool, i.e., that
+  are not leased out. */
+  int num_available() const;
+
+  /** Leases a Context from the pool, which is equal to the prototype. It is
+  reset with ResetContext() if it was leased before, or cloned from the
+  prototype if no Context is available. */
+  LeasedContext Acquire();
+
+  /** Resets `context` to the prototype. This copies the time, the accuracy,
+  all state and all parameters of the prototype with
+  Context::SetTimeStateAndParametersFrom(), and then the value of each input
+  port of the root context that is fixed in the prototype. Values are copied
+  in place: the cache entries of `context` are not rebuilt (they are merely
+  marked out of date) and numeric values are copied without heap allocation.
+  Abstract values are copied with AbstractValue::SetFrom(), which allocates
+  only for types that are cloneable rather than copyable.
+
+  An input port that is fixed in `context` but not in the prototype can't be
+  unfixed, so such a `context` can't be reset. When a leased Context like that
+  is returned, the pool deletes it rather than leasing it out again.
+
+  Note that the prototype itself is never modified, so this may be called
+  concurrently for distinct contexts.
+  @pre `context` is a root context that was cloned from the prototype, so it
+  has the same structure.
+  @throws std::exception if `context` has an input port that is fixed but is
+  not fixed in the prototype. */
+  void ResetContext(Context<T>* context) const;
+
+ private:
+  void Release(Context<T>* context);
+
+  const std::unique_ptr<const Context<T>> prototype_;
+
+  mutable std::mutex mutex_;
+  // The Contexts available for leasing. Guarded by mutex_.
+  std::vector<std::unique_ptr<Context<T>>> available_;
+  // The number of Contexts allocated so far. Guarded by mutex_.
+  int num_allocated_{0};
+};
+
+}  // namespace systems
+}  // namespace drake
+
+DRAKE_DECLARE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS(
+    class ::drake::systems::ContextPool)
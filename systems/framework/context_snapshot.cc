@@ -0,0 +1,164 @@
+#include "drake/systems/framework/context_snapshot.h"
+
+#include <type_traits>
+
+#include "drake/common/drake_throw.h"
+
+namespace drake {
+namespace systems {
+
+namespace {
+
+// Returns true iff `saved` is known to equal `current` exactly. Only double
+// values are compared; for other scalar types (e.g., AutoDiffXd, whose
+// operator== ignores the derivatives) this conservatively returns false.
+template <typename T>
+bool IsUnchanged(const T& saved, const T& current) {
+  if constexpr (std::is_same_v<T, double>) {
+    return saved == current;
+  } else {
+    return false;
+  }
+}
+
+template <typename T>
+bool IsUnchanged(const VectorX<T>& saved, const VectorBase<T>& current) {
+  if constexpr (std::is_same_v<T, double>) {
+    if (saved.size() != current.size()) return false;
+    for (int i = 0; i < saved.size(); ++i) {
+      if (saved[i] != current[i]) return false;
+    }
+    return true;
+  } else {
+    return false;
+  }
+}
+
+// Copies the `count` values returned by `get_value(i)` into `dest`, reusing
+// the storage of `dest` when it already has `count` elements.
+template <typename GetValue>
+void CopyAbstractValues(int count, const GetValue& get_value,
+                        std::vector<copyable_unique_ptr<AbstractValue>>* dest) {
+  if (static_cast<int>(dest->size()) != count) {
+    dest->clear();
+    dest->reserve(count);
+    for (int i = 0; i < count; ++i) {
+      dest->emplace_back(get_value(i).Clone());
+    }
+    return;
+  }
+  for (int i = 0; i < count; ++i) {
+    (*dest)[i].get_mutable()->SetFrom(get_value(i));
+  }
+}
+
+}  // namespace
+
+template <typename T>
+ContextSnapshot<T>::ContextSnapshot(const Context<T>& context) {
+  Capture(context);
+}
+
+template <typename T>
+void ContextSnapshot<T>::Capture(const Context<T>& context) {
+  DRAKE_THROW_UNLESS(context.is_root_context());
+  time_ = context.get_time();
+  accuracy_ = context.get_accuracy();
+
+  const VectorBase<T>& xc = context.get_continuous_state_vector();
+  continuous_state_.resize(xc.size());
+  xc.CopyToPreSizedVector(&continuous_state_);
+
+  const DiscreteValues<T>& xd = context.get_discrete_state();
+  discrete_state_.resize(xd.num_groups());
+  for (int i = 0; i < xd.num_groups(); ++i) {
+    discrete_state_[i] = xd.value(i);
+  }
+
+  const int num_numeric = context.num_numeric_parameter_groups();
+  numeric_parameters_.resize(num_numeric);
+  for (int i = 0; i < num_numeric; ++i) {
+    numeric_parameters_[i] = context.get_numeric_parameter(i).value();
+  }
+
+  const AbstractValues& xa = context.get_abstract_state();
+  CopyAbstractValues(
+      xa.size(),
+      [&xa](int i) -> const AbstractValue& {
+        return xa.get_value(i);
+      },
+      &abstract_state_);
+  CopyAbstractValues(
+      context.num_abstract_parameters(),
+      [&context](int i) -> const AbstractValue& {
+        return context.get_abstract_parameter(i);
+      },
+      &abstract_parameters_);
+
+  captured_ = true;
+}
+
+template <typename T>
+void ContextSnapshot<T>::Restore(Context<T>* context) const {
+  DRAKE_THROW_UNLESS(context != nullptr);
+  DRAKE_THROW_UNLESS(captured_);
+  DRAKE_THROW_UNLESS(context->is_root_context());
+
+  if (!IsUnchanged(time_, context->get_time())) {
+    context->SetTime(time_);
+  }
+  if (accuracy_ != context->get_accuracy()) {
+    context->SetAccuracy(accuracy_);
+  }
+
+  const VectorBase<T>& xc = context->get_continuous_state_vector();
+  if (!IsUnchanged(continuous_state_, xc)) {
+    context->get_mutable_continuous_state_vector().SetFromVector(
+        continuous_state_);
+  }
+
+  // All discrete groups share a single notification, so only ask for mutable
+  // access if some group actually changed.
+  const int num_groups = static_cast<int>(discrete_state_.size());
+  DRAKE_DEMAND(context->num_discrete_state_groups() == num_groups);
+  for (int i = 0; i < num_groups; ++i) {
+    if (!IsUnchanged(discrete_state_[i], context->get_discrete_state(i))) {
+      DiscreteValues<T>& xd = context->get_mutable_discrete_state();
+      for (int j = i; j < num_groups; ++j) {
+        xd.get_mutable_vector(j).SetFromVector(discrete_state_[j]);
+      }
+      break;
+    }
+  }
+
+  if (!abstract_state_.empty()) {
+    AbstractValues& xa = context->get_mutable_abstract_state();
+    DRAKE_DEMAND(xa.size() == static_cast<int>(abstract_state_.size()));
+    for (int i = 0; i < xa.size(); ++i) {
+      xa.get_mutable_value(i).SetFrom(*abstract_state_[i]);
+    }
+  }
+
+  const int num_numeric = static_cast<int>(numeric_parameters_.size());
+  DRAKE_DEMAND(context->num_numeric_parameter_groups() == num_numeric);
+  for (int i = 0; i < num_numeric; ++i) {
+    if (!IsUnchanged(numeric_parameters_[i],
+                     context->get_numeric_parameter(i))) {
+      context->get_mutable_numeric_parameter(i).SetFromVector(
+          numeric_parameters_[i]);
+    }
+  }
+
+  const int num_abstract = static_cast<int>(abstract_parameters_.size());
+  DRAKE_DEMAND(context->num_abstract_parameters() == num_abstract);
+  for (int i = 0; i < num_abstract; ++i) {
+    context->get_mutable_abstract_parameter(i).SetFrom(
+        *abstract_parameters_[i]);
+  }
+}
+
+}  // namespace systems
+}  // namespace drake
+
+DRAKE_DEFINE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS(
+    class ::drake::systems::ContextSnapshot)
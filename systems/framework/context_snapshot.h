@@ -0,0 +1,96 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "drake/common/copyable_unique_ptr.h"
+#include "drake/common/default_scalars.h"
+#include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
+#include "drake/common/value.h"
+#include "drake/systems/framework/context.h"
+
+namespace drake {
+namespace systems {
+
+/** A saved copy of the time, accuracy, state, and parameters of a root
+Context, for code that repeatedly returns a Context to an earlier point, such
+as branching rollouts (MPPI, tree search) or checkpointing.
+@code
+  ContextSnapshot<double> checkpoint(simulator.get_context());
+  for (...) {
+    checkpoint.Restore(&simulator.get_mutable_context());
+    simulator.Initialize();
+    simulator.AdvanceTo(...);
+  }
+@endcode
+
+Capture() and Restore() copy the numeric values in place, so once a snapshot
+has been captured, recapturing from or restoring to a Context with the same
+structure does not allocate (abstract values are copied with
+AbstractValue::SetFrom(), which allocates only for types that are cloneable
+rather than copyable).
+
+Unlike Context::SetTimeStateAndParametersFrom(), Restore() only changes (and
+only sends out-of-date notifications for) the values that differ from the
+snapshot, so cache entries that depend only on unchanged values remain valid.
+For example, restoring a rollout that only advanced the continuous state keeps
+everything computed from the discrete state and the parameters. Numeric values
+are compared exactly, and only for the `double` scalar type; with other scalar
+types, and for abstract values (which cannot be compared), the values are
+always copied.
+
+Fixed input port values are not part of the snapshot, consistent with
+SetTimeStateAndParametersFrom().
+
+@tparam_default_scalar */
+template <typename T>
+class ContextSnapshot {
+ public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(ContextSnapshot)
+
+  /** Constructs an empty snapshot; call Capture() before Restore(). */
+  ContextSnapshot() = default;
+
+  /** Constructs a snapshot of `context`. See Capture(). */
+  explicit ContextSnapshot(const Context<T>& context);
+
+  /** Copies the time, accuracy, all state, and all parameters of `context`
+  into this snapshot, reusing this snapshot's storage when it already holds a
+  snapshot of a Context with the same structure.
+  @throws std::exception if `context` is not a root context. */
+  void Capture(const Context<T>& context);
+
+  /** Copies the saved time, accuracy, state, and parameters into `context`,
+  sending out-of-date notifications only for the kinds of values that
+  changed (see the class documentation).
+  @pre `context` has the same structure as the Context that was captured,
+       e.g., it is that Context or a clone of it.
+  @throws std::exception if nothing has been captured yet.
+  @throws std::exception if `context` is not a root context. */
+  void Restore(Context<T>* context) const;
+
+  /** Returns true iff nothing has been captured yet. */
+  bool empty() const { return !captured_; }
+
+  /** Returns the captured time.
+  @pre !empty() */
+  const T& time() const { return time_; }
+
+ private:
+  bool captured_{false};
+  T time_{};
+  std::optional<double> accuracy_;
+  VectorX<T> continuous_state_;
+  std::vector<VectorX<T>> discrete_state_;
+  std::vector<copyable_unique_ptr<AbstractValue>> abstract_state_;
+  std::vector<VectorX<T>> numeric_parameters_;
+  std::vector<copyable_unique_ptr<AbstractValue>> abstract_parameters_;
+};
+
+}  // namespace systems
+}  // namespace drake
+
+DRAKE_DECLARE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS(
+    class ::drake::systems::ContextSnapshot)
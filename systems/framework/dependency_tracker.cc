@@ -14,6 +14,11 @@ std::string Indent(int depth) {
   for (int i = 0; i < depth; ++i) s += "| ";
   return s;
 }
+
+// The tracker whose value change is currently being propagated on this thread,
+// if any. Invalidated cache entries record it as the cause of their next
+// recomputation when cache profiling is enabled.
+thread_local const DependencyTracker* change_source = nullptr;
 }  // namespace
 
 // Our associated value has initiated a change (e.g. the associated value is
@@ -33,7 +38,10 @@ void DependencyTracker::NoteValueChange(int64_t change_event) const {
     return;
   }
   last_change_event_ = change_event;
+  const DependencyTracker* const enclosing_change_source = change_source;
+  change_source = this;
   NotifySubscribers(change_event, 0);
+  change_source = enclosing_change_source;
 }
 
 // A prerequisite says it has changed. Short circuit if we've already heard
@@ -61,7 +69,8 @@ void DependencyTracker::NotePrerequisiteChange(
   }
   last_change_event_ = change_event;
   // Invalidate associated cache entry value if any.
-  cache_value_->mark_out_of_date();
+  cache_value_->note_prerequisite_change(
+      change_source != nullptr ? change_source : &prerequisite);
   // Follow up with downstream subscribers.
   NotifySubscribers(change_event, depth);
 }
@@ -255,6 +264,62 @@ void DependencyTracker::RepairTrackerPointers(
   ThrowIfBadDependencyTracker();
 }
 
+namespace {
+
+// The capacity of the first block of trackers of a graph that is built up one
+// tracker at a time. Each later block is at least as big as all of the
+// previous ones together.
+constexpr int kMinTrackerBlockCapacity = 32;
+
+}  // namespace
+
+DependencyGraph::DependencyGraph(const DependencyGraph& source)
+    : DependencyGraph() {
+  int num_trackers = 0;
+  for (const DependencyTracker* tracker : source.graph_) {
+    if (tracker != nullptr) ++num_trackers;
+  }
+  // Copy all of the trackers into a single block.
+  if (num_trackers > 0) ReserveTrackerMemory(num_trackers);
+  graph_.reserve(source.trackers_size());
+  for (const DependencyTracker* tracker : source.graph_) {
+    graph_.push_back(nullptr);
+    if (tracker != nullptr) {
+      graph_.back() = tracker->CloneWithoutPointers(AllocateTrackerMemory());
+    }
+  }
+}
+
+DependencyGraph::~DependencyGraph() {
+  for (DependencyTracker* tracker : graph_) {
+    if (tracker != nullptr) tracker->~DependencyTracker();
+  }
+}
+
+void DependencyGraph::ReserveTrackerMemory(int count) {
+  static_assert(alignof(DependencyTracker) <= alignof(std::max_align_t));
+  if (!tracker_blocks_.empty() &&
+      tracker_blocks_.back().capacity - tracker_blocks_.back().size >= count) {
+    return;
+  }
+  int total_capacity = 0;
+  for (const TrackerBlock& block : tracker_blocks_) {
+    total_capacity += block.capacity;
+  }
+  TrackerBlock block;
+  block.capacity = std::max({count, total_capacity, kMinTrackerBlockCapacity});
+  // Note that new[] of std::byte suitably aligns the memory for any object
+  // that fits, and (unlike make_unique) does not zero it.
+  block.memory.reset(new std::byte[block.capacity * sizeof(DependencyTracker)]);
+  tracker_blocks_.push_back(std::move(block));
+}
+
+void* DependencyGraph::AllocateTrackerMemory() {
+  ReserveTrackerMemory(1);
+  TrackerBlock& block = tracker_blocks_.back();
+  return block.memory.get() + (block.size++) * sizeof(DependencyTracker);
+}
+
 void DependencyGraph::AppendToTrackerPointerMap(
     const DependencyGraph& clone,
     DependencyTracker::PointerMap* tracker_map) const {
@@ -4,8 +4,10 @@
 Declares DependencyTracker and DependencyGraph which is the container for
 trackers. */
 
+#include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <new>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -339,13 +341,13 @@ class DependencyTracker {
             : "");
   }
 
-  // Copies the current tracker but with all pointers set to null, and all
-  // counters reset to their default-constructed values (0 for statistics, an
-  // unmatchable value for the last change event).
-  std::unique_ptr<DependencyTracker> CloneWithoutPointers() const {
-    // Can't use make_unique here because constructor is private.
-    std::unique_ptr<DependencyTracker> clone(
-        new DependencyTracker(ticket(), description(), nullptr, nullptr));
+  // Copies the current tracker into the uninitialized `memory` but with all
+  // pointers set to null, and all counters reset to their default-constructed
+  // values (0 for statistics, an unmatchable value for the last change event).
+  // Returns the address of the copy.
+  DependencyTracker* CloneWithoutPointers(void* memory) const {
+    DependencyTracker* clone = new (memory)
+        DependencyTracker(ticket(), description(), nullptr, nullptr);
     clone->has_associated_cache_entry_ = has_associated_cache_entry_;
     // The constructor sets cache_value_ to dummy by default, but that's wrong
     // if there is an associated cache entry. In that case we'll set it later.
@@ -465,7 +467,7 @@ class DependencyGraph {
   }
 
   /** Deletes all DependencyTracker objects; no notifications are issued. */
-  ~DependencyGraph() = default;
+  ~DependencyGraph();
 
   /** Allocates a new DependencyTracker with an already-known ticket number, the
   given description and an optional cache value to be invalidated. The new
@@ -483,9 +485,8 @@ class DependencyGraph {
       CacheEntryValue* cache_value = nullptr) {
     DRAKE_DEMAND(!has_tracker(known_ticket));
     if (known_ticket >= trackers_size()) graph_.resize(known_ticket + 1);
-    // Can't use make_unique here because constructor is private.
-    graph_[known_ticket].reset(new DependencyTracker(
-        known_ticket, std::move(description), owning_subcontext_, cache_value));
+    graph_[known_ticket] = new (AllocateTrackerMemory()) DependencyTracker(
+        known_ticket, std::move(description), owning_subcontext_, cache_value);
     return *graph_[known_ticket];
   }
 
@@ -537,16 +538,7 @@ class DependencyGraph {
   should only be invoked by Context code as part of copying an entire Context
   tree.
   @see AppendToTrackerPointerMap(), RepairTrackerPointers() */
-  DependencyGraph(const DependencyGraph& source) {
-    graph_.reserve(source.trackers_size());
-    for (DependencyTicket ticket(0); ticket < source.trackers_size();
-         ++ticket) {
-      graph_.emplace_back(
-          source.has_tracker(ticket)
-              ? source.get_tracker(ticket).CloneWithoutPointers()
-              : nullptr);
-    }
-  }
+  DependencyGraph(const DependencyGraph& source);
 
   /** (Internal use only) Create a mapping from the memory addresses of the
   trackers contained here to the corresponding ones in `clone`, which must have
@@ -572,11 +564,38 @@ class DependencyGraph {
       Cache* new_cache);
 
  private:
+  // A contiguous block of memory with room for `capacity` trackers, of which
+  // the first `size` slots have been handed out.
+  struct TrackerBlock {
+    std::unique_ptr<std::byte[]> memory;
+    int capacity{};
+    int size{};
+  };
+
+  // Creates an empty graph with no owning subcontext, for the copy constructor
+  // to delegate to (so that the trackers it has already copied are destroyed
+  // if a later copy throws).
+  DependencyGraph() = default;
+
+  // Ensures that the last block has room for at least `count` more trackers.
+  void ReserveTrackerMemory(int count);
+
+  // Returns uninitialized memory for one more tracker.
+  void* AllocateTrackerMemory();
+
   // The system name service of the subcontext that owns this subgraph.
   const internal::ContextMessageInterface* owning_subcontext_{};
 
-  // All value trackers, indexed by DependencyTicket.
-  std::vector<std::unique_ptr<DependencyTracker>> graph_;
+  // The trackers are constructed in a few blocks owned by this graph, rather
+  // than allocated individually, so that creating, copying and destroying a
+  // Context takes few allocations and the trackers that an invalidation sweep
+  // visits are close together in memory. Blocks are never reallocated, so the
+  // addresses of the trackers are stable.
+  std::vector<TrackerBlock> tracker_blocks_;
+
+  // All value trackers, indexed by DependencyTicket; null for unused tickets.
+  // The trackers are owned by (and destroyed along with) this graph.
+  std::vector<DependencyTracker*> graph_;
 };
 
 }  // namespace systems
@@ -1,10 +1,14 @@
 #include "drake/systems/framework/diagram.h"
 
+#include <algorithm>
+#include <chrono>
 #include <limits>
 #include <set>
 #include <stdexcept>
+#include <tuple>
 
 #include "drake/common/drake_assert.h"
+#include "drake/common/parallel_for.h"
 #include "drake/common/text_logging.h"
 #include "drake/systems/framework/abstract_value_cloner.h"
 #include "drake/systems/framework/subvector.h"
@@ -85,6 +89,148 @@ std::multimap<int, int> Diagram<T>::GetDirectFeedthroughs() const {
   return pairs;
 }
 
+namespace {
+// Appends `system` and its subcontext within `context`, followed by those of
+// all its subsystems (recursively) if it is a Diagram.
+template <typename T>
+void CollectSubsystemContexts(
+    const System<T>& system, const Context<T>& context,
+    std::vector<std::pair<const System<T>*, const Context<T>*>>* result) {
+  result->emplace_back(&system, &context);
+  if (const auto* diagram = dynamic_cast<const Diagram<T>*>(&system)) {
+    for (const System<T>* subsystem : diagram->GetSystems()) {
+      CollectSubsystemContexts(
+          *subsystem, diagram->GetSubsystemContext(*subsystem, context),
+          result);
+    }
+  }
+}
+
+// Returns `text` as a quoted JSON string.
+std::string QuoteJson(const std::string& text) {
+  std::string result = "\"";
+  for (const char c : text) {
+    switch (c) {
+      case '"': result += "\\\""; break;
+      case '\\': result += "\\\\"; break;
+      case '\n': result += "\\n"; break;
+      case '\t': result += "\\t"; break;
+      default:
+        if (static_cast<unsigned char>(c) < 0x20) {
+          result += fmt::format("\\u{:04x}", static_cast<int>(c));
+        } else {
+          result += c;
+        }
+    }
+  }
+  result += "\"";
+  return result;
+}
+}  // namespace
+
+template <typename T>
+std::string Diagram<T>::GetCacheProfilingReport(
+    const Context<T>& context) const {
+  this->ValidateContext(context);
+  struct Row {
+    std::string name;
+    CacheEntryStatistics statistics;
+  };
+  std::vector<Row> rows;
+  std::vector<std::pair<const System<T>*, const Context<T>*>> subsystems;
+  CollectSubsystemContexts<T>(*this, context, &subsystems);
+  for (const auto& [system, subcontext] : subsystems) {
+    const Cache& cache = subcontext->get_cache();
+    for (CacheIndex i(0); i < system->num_cache_entries(); ++i) {
+      if (!cache.has_cache_entry_value(i)) continue;
+      const CacheEntryStatistics& statistics =
+          cache.get_cache_entry_value(i).statistics();
+      if (statistics.num_computations == 0 &&
+          statistics.num_invalidations == 0) {
+        continue;
+      }
+      rows.push_back({system->GetSystemPathname() + ":" +
+                          system->get_cache_entry(i).description(),
+                      statistics});
+    }
+  }
+  std::stable_sort(rows.begin(), rows.end(), [](const Row& a, const Row& b) {
+    return a.statistics.self_time > b.statistics.self_time;
+  });
+
+  std::string result = fmt::format(
+      "{:>14} {:>16} {:>12} {:>13}  {}\n", "self [us]", "cumulative [us]",
+      "computations", "invalidations", "cache entry");
+  for (const Row& row : rows) {
+    result += fmt::format("{:>14.1f} {:>16.1f} {:>12} {:>13}  {}\n",
+                          row.statistics.self_time * 1e6,
+                          row.statistics.cumulative_time * 1e6,
+                          row.statistics.num_computations,
+                          row.statistics.num_invalidations, row.name);
+    // List the causes of the recomputations, most frequent first.
+    std::vector<std::pair<std::string, int64_t>> causes(
+        row.statistics.num_computations_by_cause.begin(),
+        row.statistics.num_computations_by_cause.end());
+    std::stable_sort(causes.begin(), causes.end(),
+                     [](const auto& a, const auto& b) {
+                       return a.second > b.second;
+                     });
+    for (const auto& [cause, count] : causes) {
+      result += fmt::format("{:>44} {:>12}    recomputed due to {}\n", "",
+                            count, cause);
+    }
+  }
+  return result;
+}
+
+template <typename T>
+std::string Diagram<T>::GetCacheProfilingTraceEvents(
+    const Context<T>& context) const {
+  this->ValidateContext(context);
+  struct Event {
+    const std::string* name;
+    const CacheProfileEvent* event;
+  };
+  // Cache entry names, indexed by subsystem (in the order visited) and then by
+  // CacheIndex.
+  std::vector<std::vector<std::string>> names;
+  std::vector<Event> events;
+  std::vector<std::pair<const System<T>*, const Context<T>*>> subsystems;
+  CollectSubsystemContexts<T>(*this, context, &subsystems);
+  names.reserve(subsystems.size());
+  for (const auto& [system, subcontext] : subsystems) {
+    std::vector<std::string>& system_names = names.emplace_back();
+    for (CacheIndex i(0); i < system->num_cache_entries(); ++i) {
+      system_names.push_back(system->GetSystemPathname() + ":" +
+                             system->get_cache_entry(i).description());
+    }
+    for (const CacheProfileEvent& event :
+         subcontext->get_cache().profile_events()) {
+      events.push_back({&system_names.at(event.cache_index), &event});
+    }
+  }
+  std::stable_sort(events.begin(), events.end(),
+                   [](const Event& a, const Event& b) {
+                     return a.event->start < b.event->start;
+                   });
+
+  std::string result = "{\"traceEvents\":[";
+  for (int k = 0; k < ssize(events); ++k) {
+    const CacheProfileEvent& event = *events[k].event;
+    const double start_us =
+        std::chrono::duration<double, std::micro>(
+            event.start - events.front().event->start)
+            .count();
+    result += fmt::format(
+        "{}\n{{\"name\":{},\"cat\":\"cache\",\"ph\":\"X\",\"ts\":{:.3f},"
+        "\"dur\":{:.3f},\"pid\":0,\"tid\":0,\"args\":{{\"cause\":{}}}}}",
+        k == 0 ? "" : ",", QuoteJson(*events[k].name), start_us,
+        event.duration * 1e6, QuoteJson(event.cause));
+  }
+  result += "\n],\"displayTimeUnit\":\"ms\"}\n";
+  return result;
+}
+
 template <typename T>
 std::unique_ptr<CompositeEventCollection<T>>
 Diagram<T>::DoAllocateCompositeEventCollection() const {
@@ -304,12 +450,37 @@ void Diagram<T>::DoCalcTimeDerivatives(const Context<T>& context,
   const int n = diagram_derivatives->num_substates();
   DRAKE_DEMAND(num_subsystems() == n);
 
-  // Evaluate the derivatives of each constituent system.
-  for (SubsystemIndex i(0); i < n; ++i) {
+  auto calc_subsystem_derivatives = [&](SubsystemIndex i) {
     const Context<T>& subcontext = diagram_context->GetSubsystemContext(i);
     ContinuousState<T>& subderivatives =
         diagram_derivatives->get_mutable_substate(i);
     registered_systems_[i]->CalcTimeDerivatives(subcontext, &subderivatives);
+  };
+
+  if (num_parallel_threads() == 1) {
+    // Evaluate the derivatives of each constituent system.
+    for (SubsystemIndex i(0); i < n; ++i) {
+      calc_subsystem_derivatives(i);
+    }
+    return;
+  }
+
+  // Only subsystems with continuous state take part in the parallel
+  // evaluation; the (typically trivial) derivatives of the rest are still
+  // evaluated serially, afterwards.
+  std::vector<SubsystemIndex> participants;
+  for (SubsystemIndex i(0); i < n; ++i) {
+    if (registered_systems_[i]->num_continuous_states() > 0) {
+      participants.push_back(i);
+    }
+  }
+  EvalSubsystemsInParallel(*diagram_context, participants,
+                           true /* parallel_tasks */,
+                           calc_subsystem_derivatives);
+  for (SubsystemIndex i(0); i < n; ++i) {
+    if (registered_systems_[i]->num_continuous_states() == 0) {
+      calc_subsystem_derivatives(i);
+    }
   }
 }
 
@@ -467,6 +638,7 @@ std::map<std::string, std::string> FilterGraphvizOptions(
   }
   return result;
 }
+
 }  // namespace
 
 template <typename T>
@@ -1224,20 +1396,35 @@ EventStatus Diagram<T>::DispatchPublishHandler(
       dynamic_cast<const DiagramEventCollection<PublishEvent<T>>&>(event_info);
 
   EventStatus overall_status = EventStatus::DidNothing();
+  auto publish_subsystem = [&](SubsystemIndex i) {
+    const Context<T>& subcontext = diagram_context->GetSubsystemContext(i);
+    const EventStatus per_subsystem_status = registered_systems_[i]->Publish(
+        subcontext, info.get_subevent_collection(i));
+    overall_status.KeepMoreSevere(per_subsystem_status);
+    // Unlike the discrete & unrestricted event policy, we don't stop handling
+    // publish events when one fails; we just report the first failure after
+    // all the publishes are done.
+  };
+
+  if (num_parallel_threads() == 1) {
+    for (SubsystemIndex i(0); i < num_subsystems(); ++i) {
+      if (info.get_subevent_collection(i).HasEvents()) {
+        publish_subsystem(i);
+      }
+    }
+    return overall_status;
+  }
+
+  // Only the evaluation of the publishers' inputs runs in parallel; the
+  // publish handlers themselves run serially, in subsystem order.
+  std::vector<SubsystemIndex> participants;
   for (SubsystemIndex i(0); i < num_subsystems(); ++i) {
-    const EventCollection<PublishEvent<T>>& subinfo =
-        info.get_subevent_collection(i);
-
-    if (subinfo.HasEvents()) {
-      const Context<T>& subcontext = diagram_context->GetSubsystemContext(i);
-      const EventStatus per_subsystem_status =
-          registered_systems_[i]->Publish(subcontext, subinfo);
-      overall_status.KeepMoreSevere(per_subsystem_status);
-      // Unlike the discrete & unrestricted event policy, we don't stop handling
-      // publish events when one fails; we just report the first failure after
-      // all the publishes are done.
+    if (info.get_subevent_collection(i).HasEvents()) {
+      participants.push_back(i);
     }
   }
+  EvalSubsystemsInParallel(*diagram_context, participants,
+                           false /* parallel_tasks */, publish_subsystem);
   return overall_status;
 }
 
@@ -1256,23 +1443,42 @@ EventStatus Diagram<T>::DispatchDiscreteVariableUpdateHandler(
       dynamic_cast<const DiagramEventCollection<DiscreteUpdateEvent<T>>&>(
           events);
 
-  EventStatus overall_status = EventStatus::DidNothing();
-  for (SubsystemIndex i(0); i < num_subsystems(); ++i) {
-    const EventCollection<DiscreteUpdateEvent<T>>& subevents =
-        diagram_events.get_subevent_collection(i);
+  auto update_subsystem = [&](SubsystemIndex i) {
+    const Context<T>& subcontext = diagram_context->GetSubsystemContext(i);
+    DiscreteValues<T>& subdiscrete =
+        diagram_discrete->get_mutable_subdiscrete(i);
+    return registered_systems_[i]->CalcDiscreteVariableUpdate(
+        subcontext, diagram_events.get_subevent_collection(i), &subdiscrete);
+  };
 
-    if (subevents.HasEvents()) {
-      const Context<T>& subcontext = diagram_context->GetSubsystemContext(i);
-      DiscreteValues<T>& subdiscrete =
-          diagram_discrete->get_mutable_subdiscrete(i);
+  EventStatus overall_status = EventStatus::DidNothing();
+  if (num_parallel_threads() == 1) {
+    for (SubsystemIndex i(0); i < num_subsystems(); ++i) {
+      if (diagram_events.get_subevent_collection(i).HasEvents()) {
+        overall_status.KeepMoreSevere(update_subsystem(i));
+        if (overall_status.failed()) break;  // Stop at the first disaster.
+      }
+    }
+    return overall_status;
+  }
 
-      const EventStatus per_subsystem_status =
-          registered_systems_[i]->CalcDiscreteVariableUpdate(
-          subcontext, subevents, &subdiscrete);
-      overall_status.KeepMoreSevere(per_subsystem_status);
-      if (overall_status.failed()) break;  // Stop at the first disaster.
+  std::vector<SubsystemIndex> participants;
+  for (SubsystemIndex i(0); i < num_subsystems(); ++i) {
+    if (diagram_events.get_subevent_collection(i).HasEvents()) {
+      participants.push_back(i);
     }
   }
+  std::vector<EventStatus> statuses(num_subsystems(),
+                                    EventStatus::DidNothing());
+  EvalSubsystemsInParallel(*diagram_context, participants,
+                           true /* parallel_tasks */, [&](SubsystemIndex i) {
+                             statuses[i] = update_subsystem(i);
+                           });
+  // Combine the statuses as the serial loop would have.
+  for (const SubsystemIndex& i : participants) {
+    overall_status.KeepMoreSevere(statuses[i]);
+    if (overall_status.failed()) break;
+  }
   return overall_status;
 }
 
@@ -1317,22 +1523,41 @@ EventStatus Diagram<T>::DispatchUnrestrictedUpdateHandler(
       dynamic_cast<const DiagramEventCollection<UnrestrictedUpdateEvent<T>>&>(
           events);
 
+  auto update_subsystem = [&](SubsystemIndex i) {
+    const Context<T>& subcontext = diagram_context->GetSubsystemContext(i);
+    State<T>& substate = diagram_state->get_mutable_substate(i);
+    return registered_systems_[i]->CalcUnrestrictedUpdate(
+        subcontext, diagram_events.get_subevent_collection(i), &substate);
+  };
+
   EventStatus overall_status = EventStatus::DidNothing();
-  for (SubsystemIndex i(0); i < num_subsystems(); ++i) {
-    const EventCollection<UnrestrictedUpdateEvent<T>>& subevents =
-        diagram_events.get_subevent_collection(i);
+  if (num_parallel_threads() == 1) {
+    for (SubsystemIndex i(0); i < num_subsystems(); ++i) {
+      if (diagram_events.get_subevent_collection(i).HasEvents()) {
+        overall_status.KeepMoreSevere(update_subsystem(i));
+        if (overall_status.failed()) break;  // Stop at the first disaster.
+      }
+    }
+    return overall_status;
+  }
 
-    if (subevents.HasEvents()) {
-      const Context<T>& subcontext = diagram_context->GetSubsystemContext(i);
-      State<T>& substate = diagram_state->get_mutable_substate(i);
-
-      const EventStatus per_subsystem_status =
-          registered_systems_[i]->CalcUnrestrictedUpdate(subcontext, subevents,
-                                                         &substate);
-      overall_status.KeepMoreSevere(per_subsystem_status);
-      if (overall_status.failed()) break;  // Stop at the first disaster.
+  std::vector<SubsystemIndex> participants;
+  for (SubsystemIndex i(0); i < num_subsystems(); ++i) {
+    if (diagram_events.get_subevent_collection(i).HasEvents()) {
+      participants.push_back(i);
     }
   }
+  std::vector<EventStatus> statuses(num_subsystems(),
+                                    EventStatus::DidNothing());
+  EvalSubsystemsInParallel(*diagram_context, participants,
+                           true /* parallel_tasks */, [&](SubsystemIndex i) {
+                             statuses[i] = update_subsystem(i);
+                           });
+  // Combine the statuses as the serial loop would have.
+  for (const SubsystemIndex& i : participants) {
+    overall_status.KeepMoreSevere(statuses[i]);
+    if (overall_status.failed()) break;
+  }
   return overall_status;
 }
 
@@ -1402,7 +1627,10 @@ template <typename NewType>
 std::unique_ptr<typename Diagram<NewType>::Blueprint>
 Diagram<T>::ConvertScalarType() const {
   internal::OwnedSystems<NewType> new_systems;
-  // Recursively convert all the subsystems.
+  // Recursively convert all the subsystems. This is always serial, even when
+  // this Diagram evaluates its subsystems in parallel: scalar converters are
+  // not required to be thread-safe (e.g., those of systems implemented in
+  // Python).
   std::map<const System<T>*, const System<NewType>*> old_to_new_map;
   for (const auto& old_system : registered_systems_) {
     // Convert old_system to new_system using the old_system's converter.
@@ -1456,6 +1684,7 @@ Diagram<T>::ConvertScalarType() const {
   }
   // Move the new systems into the blueprint.
   blueprint->systems = std::move(new_systems);
+  blueprint->parallelism = parallelism_;
 
   return blueprint;
 }
@@ -1577,6 +1806,7 @@ void Diagram<T>::Initialize(std::unique_ptr<Blueprint> blueprint) {
   connection_map_ = std::move(blueprint->connection_map);
   output_port_ids_ = std::move(blueprint->output_port_ids);
   registered_systems_ = std::move(blueprint->systems);
+  parallelism_ = blueprint->parallelism;
 
   // This cache entry just maintains temporary storage. It is only ever used
   // by DoCalcNextUpdateTime(). Since this declaration of the cache entry
@@ -1664,6 +1894,10 @@ void Diagram<T>::Initialize(std::unique_ptr<Blueprint> blueprint) {
     residual_size += system->implicit_time_derivatives_residual_size();
   }
   this->set_implicit_time_derivatives_residual_size(residual_size);
+
+  if (num_parallel_threads() > 1) {
+    MakeParallelSchedule();
+  }
 }
 
 template <typename T>
@@ -1778,6 +2012,192 @@ int Diagram<T>::num_subsystems() const {
   return static_cast<int>(registered_systems_.size());
 }
 
+template <typename T>
+int Diagram<T>::num_parallel_threads() const {
+  return parallelism_.num_threads();
+}
+
+template <typename T>
+void Diagram<T>::MakeParallelSchedule() {
+  const int n = num_subsystems();
+  std::vector<std::multimap<int, int>> feedthroughs(n);
+  for (SubsystemIndex i(0); i < n; ++i) {
+    feedthroughs[i] = registered_systems_[i]->GetDirectFeedthroughs();
+  }
+
+  // For each internally connected output port, the internally connected output
+  // ports on which it depends through direct feedthrough.
+  std::map<OutputPortLocator, std::vector<OutputPortLocator>> upstream;
+  for (const auto& [input, output] : connection_map_) {
+    upstream.emplace(output, std::vector<OutputPortLocator>{});
+  }
+  for (auto& [output, upstream_outputs] : upstream) {
+    const SubsystemIndex i = GetSystemIndexOrAbort(output.first);
+    for (const auto& [input_index, output_index] : feedthroughs[i]) {
+      if (output_index != output.second) continue;
+      const auto it = connection_map_.find(
+          InputPortLocator{output.first, InputPortIndex(input_index)});
+      if (it != connection_map_.end()) {
+        upstream_outputs.push_back(it->second);
+      }
+    }
+  }
+
+  // Levels, with memoization. DiagramBuilder has already rejected algebraic
+  // loops, so this recursion terminates.
+  std::map<OutputPortLocator, int> levels;
+  std::function<int(const OutputPortLocator&)> calc_level =
+      [&](const OutputPortLocator& output) {
+        const auto it = levels.find(output);
+        if (it != levels.end()) return it->second;
+        int level = 0;
+        for (const OutputPortLocator& upstream_output : upstream.at(output)) {
+          level = std::max(level, calc_level(upstream_output) + 1);
+        }
+        levels.emplace(output, level);
+        return level;
+      };
+
+  scheduled_outputs_.clear();
+  for (const auto& [output, _] : upstream) {
+    scheduled_outputs_.push_back(ScheduledOutput{
+        output, GetSystemIndexOrAbort(output.first), calc_level(output)});
+  }
+  std::sort(scheduled_outputs_.begin(), scheduled_outputs_.end(),
+            [](const ScheduledOutput& a, const ScheduledOutput& b) {
+              return std::tie(a.level, a.subsystem, a.locator.second) <
+                     std::tie(b.level, b.subsystem, b.locator.second);
+            });
+  std::map<OutputPortLocator, int> scheduled_index;
+  for (int k = 0; k < ssize(scheduled_outputs_); ++k) {
+    scheduled_index.emplace(scheduled_outputs_[k].locator, k);
+  }
+
+  output_group_start_.clear();
+  level_group_start_.clear();
+  for (int k = 0; k < ssize(scheduled_outputs_); ++k) {
+    const ScheduledOutput& current = scheduled_outputs_[k];
+    const bool new_level =
+        k == 0 || current.level != scheduled_outputs_[k - 1].level;
+    if (new_level || current.subsystem != scheduled_outputs_[k - 1].subsystem) {
+      if (new_level) level_group_start_.push_back(ssize(output_group_start_));
+      output_group_start_.push_back(k);
+    }
+  }
+  level_group_start_.push_back(ssize(output_group_start_));
+  output_group_start_.push_back(ssize(scheduled_outputs_));
+
+  // The transitive closure of the outputs upstream of each subsystem's inputs.
+  subsystem_prerequisite_outputs_.assign(n, {});
+  for (const auto& [input, output] : connection_map_) {
+    const SubsystemIndex i = GetSystemIndexOrAbort(input.first);
+    std::vector<int>& prerequisites = subsystem_prerequisite_outputs_[i];
+    std::vector<OutputPortLocator> stack{output};
+    while (!stack.empty()) {
+      const OutputPortLocator current = stack.back();
+      stack.pop_back();
+      const int k = scheduled_index.at(current);
+      if (std::find(prerequisites.begin(), prerequisites.end(), k) !=
+          prerequisites.end()) {
+        continue;
+      }
+      prerequisites.push_back(k);
+      const std::vector<OutputPortLocator>& next = upstream.at(current);
+      stack.insert(stack.end(), next.begin(), next.end());
+    }
+  }
+  for (std::vector<int>& prerequisites : subsystem_prerequisite_outputs_) {
+    std::sort(prerequisites.begin(), prerequisites.end());
+  }
+
+  // The exported inputs of this Diagram that each subsystem reads, either
+  // directly or through the direct feedthrough of a prerequisite output.
+  std::vector<std::vector<InputPortIndex>> exported_inputs(n);
+  for (const auto& [input, diagram_input] : input_port_map_) {
+    exported_inputs[GetSystemIndexOrAbort(input.first)].push_back(
+        diagram_input);
+  }
+  subsystem_prerequisite_inputs_.assign(n, {});
+  for (SubsystemIndex i(0); i < n; ++i) {
+    std::vector<InputPortIndex>& inputs = subsystem_prerequisite_inputs_[i];
+    inputs = exported_inputs[i];
+    for (const int k : subsystem_prerequisite_outputs_[i]) {
+      const ScheduledOutput& output = scheduled_outputs_[k];
+      for (const auto& [input_index, output_index] :
+           feedthroughs[output.subsystem]) {
+        if (output_index != output.locator.second) continue;
+        const auto it = input_port_map_.find(InputPortLocator{
+            output.locator.first, InputPortIndex(input_index)});
+        if (it != input_port_map_.end()) {
+          inputs.push_back(it->second);
+        }
+      }
+    }
+    std::sort(inputs.begin(), inputs.end());
+    inputs.erase(std::unique(inputs.begin(), inputs.end()), inputs.end());
+  }
+}
+
+template <typename T>
+template <typename Task>
+void Diagram<T>::EvalSubsystemsInParallel(
+    const DiagramContext<T>& context,
+    const std::vector<SubsystemIndex>& participants, bool parallel_tasks,
+    const Task& task) const {
+  DRAKE_DEMAND(num_parallel_threads() > 1);
+
+  // Phase 0: evaluate the exported inputs upstream of the participants on this
+  // thread. For a nested Diagram their values come from the parent Diagram's
+  // Context, whose cache entries the tasks below must not race to update.
+  std::vector<bool> needed_inputs(this->num_input_ports(), false);
+  for (const SubsystemIndex& i : participants) {
+    for (const InputPortIndex& j : subsystem_prerequisite_inputs_[i]) {
+      if (!needed_inputs[j]) {
+        needed_inputs[j] = true;
+        this->EvalAbstractInput(context, j);
+      }
+    }
+  }
+
+  // Phase 1: bring every output upstream of the participants up to date, one
+  // level at a time.
+  std::vector<bool> needed(scheduled_outputs_.size(), false);
+  for (const SubsystemIndex& i : participants) {
+    for (const int k : subsystem_prerequisite_outputs_[i]) {
+      needed[k] = true;
+    }
+  }
+  std::vector<int> groups;
+  for (int level = 0; level + 1 < ssize(level_group_start_); ++level) {
+    groups.clear();
+    for (int g = level_group_start_[level]; g < level_group_start_[level + 1];
+         ++g) {
+      for (int k = output_group_start_[g]; k < output_group_start_[g + 1];
+           ++k) {
+        if (needed[k]) {
+          groups.push_back(g);
+          break;
+        }
+      }
+    }
+    drake::internal::ParallelFor(parallelism_, ssize(groups), [&](int m) {
+      const int g = groups[m];
+      for (int k = output_group_start_[g]; k < output_group_start_[g + 1];
+           ++k) {
+        if (needed[k]) {
+          EvalSubsystemOutputPort(context, scheduled_outputs_[k].locator);
+        }
+      }
+    });
+  }
+
+  // Phase 2: the participants themselves.
+  drake::internal::ParallelFor(parallel_tasks ? parallelism_ : Parallelism(),
+                               ssize(participants), [&](int m) {
+                                 task(participants[m]);
+                               });
+}
+
 }  // namespace systems
 }  // namespace drake
 
@@ -12,6 +12,7 @@
 #include "drake/common/default_scalars.h"
 #include "drake/common/drake_copyable.h"
 #include "drake/common/drake_deprecated.h"
+#include "drake/common/parallelism.h"
 #include "drake/common/pointer_cast.h"
 #include "drake/systems/framework/diagram_context.h"
 #include "drake/systems/framework/diagram_continuous_state.h"
@@ -73,6 +74,42 @@ class DiagramBuilder;
 ///
 /// Each System in the Diagram must have a unique, non-empty name.
 ///
+/// @anchor Diagram_parallelism
+/// <h3>Parallel evaluation of subsystems (experimental)</h3>
+///
+/// By default, a Diagram evaluates its subsystems one after another on the
+/// calling thread. When built with DiagramBuilder::set_parallelism() asking for
+/// more than one thread, the Diagram instead evaluates independent immediate
+/// subsystems concurrently in CalcTimeDerivatives(),
+/// CalcDiscreteVariableUpdate(), CalcUnrestrictedUpdate() and Publish(), using
+/// Drake's process-wide pool of threads. (When the Diagram is itself evaluated
+/// by a parallel loop, e.g., by a BatchedSimulator, its subsystems are
+/// evaluated serially instead.) Each of those proceeds in two phases:
+///
+/// 1. All of the internally connected subsystem output ports upstream of the
+///    participating subsystems' input ports are evaluated, eagerly. Output
+///    ports are sorted into levels using the subsystems' direct feedthrough
+///    (which for a LeafSystem comes from its dependency tracking graph), so
+///    that every port in a level only depends on ports in earlier levels. The
+///    ports of a level are evaluated concurrently, one task per subsystem.
+/// 2. The participating subsystems (those with continuous state for
+///    derivatives, those with events otherwise) are evaluated concurrently,
+///    one task per subsystem. Publish events are always handled serially, in
+///    subsystem order, since their side effects are often order dependent.
+///
+/// Because all of a participating subsystem's inputs are up to date before the
+/// second phase starts, concurrent tasks only ever write to the cache of their
+/// own subcontext. This is only safe if the subsystems' calculations are
+/// thread safe in that sense. Notably, a system that lazily evaluates another
+/// system's cache through an abstract-valued input (a geometry::QueryObject,
+/// for example) is not, and must not be run concurrently with other readers of
+/// that cache. Caching must not be disabled. When an event handler fails or
+/// throws, the remaining handlers may nonetheless have run; the reported
+/// status or exception is the one serial evaluation would have produced.
+///
+/// Scalar conversion (and so System::Clone()) always converts the immediate
+/// subsystems serially; the converted Diagram keeps the parallelism.
+///
 /// @tparam_default_scalar
 template <typename T>
 class Diagram : public System<T>, internal::SystemParentServiceInterface {
@@ -117,6 +154,36 @@ class Diagram : public System<T>, internal::SystemParentServiceInterface {
 
   std::multimap<int, int> GetDirectFeedthroughs() const final;
 
+  /// Returns the parallelism with which this Diagram evaluates its immediate
+  /// subsystems. See @ref Diagram_parallelism "Parallel evaluation of
+  /// subsystems" and DiagramBuilder::set_parallelism().
+  Parallelism get_parallelism() const { return parallelism_; }
+
+  /// (Debugging) Returns a human-readable table of the cache profiling
+  /// statistics gathered in the given `context` for the cache entries of this
+  /// Diagram and all of its subsystems (recursively), with the entries having
+  /// the greatest self time first. Times are reported in microseconds. Entries
+  /// that were neither computed nor invalidated are omitted. Output port
+  /// values are included via the cache entries that hold them. Each entry is
+  /// followed by a breakdown of its recomputations by cause, i.e., by the
+  /// upstream value (time, state, parameter, input port, ...) whose change
+  /// made it out of date. See ContextBase::EnableCacheProfiling() and
+  /// CacheEntryStatistics.
+  /// @pre `context` is compatible with this Diagram.
+  std::string GetCacheProfilingReport(const Context<T>& context) const;
+
+  /// (Debugging) Returns the cache entry computations recorded in the given
+  /// `context` (for this Diagram and all of its subsystems, recursively) as a
+  /// JSON document in the Chrome trace-event format, suitable for viewing with
+  /// `chrome://tracing` or https://ui.perfetto.dev. Each computation is a
+  /// complete ("X") event named by its subsystem path and cache entry
+  /// description, with the cause of the recomputation as its "cause"
+  /// argument; nested computations appear nested on the timeline. Times
+  /// are measured from the earliest recorded computation. See
+  /// ContextBase::EnableCacheProfiling().
+  /// @pre `context` is compatible with this Diagram.
+  std::string GetCacheProfilingTraceEvents(const Context<T>& context) const;
+
   void SetDefaultState(const Context<T>& context,
                        State<T>* state) const override;
 
@@ -543,6 +610,8 @@ class Diagram : public System<T>, internal::SystemParentServiceInterface {
     std::map<InputPortLocator, OutputPortLocator> connection_map;
     // All of the systems to be included in the diagram.
     internal::OwnedSystems<T> systems;
+    // The parallelism with which to evaluate the systems.
+    Parallelism parallelism;
   };
 
   // Constructs a Diagram from the Blueprint that a DiagramBuilder produces.
@@ -593,6 +662,25 @@ class Diagram : public System<T>, internal::SystemParentServiceInterface {
 
   int num_subsystems() const;
 
+  // Returns the number of threads with which to evaluate the subsystems.
+  int num_parallel_threads() const;
+
+  // Populates the parallel schedule (scheduled_outputs_ and its friends) from
+  // the connection_map_ and the subsystems' direct feedthrough.
+  void MakeParallelSchedule();
+
+  // Evaluates, in parallel, all of the scheduled outputs needed by the input
+  // ports of the subsystems in `participants` (phase 1 in the class
+  // documentation). Then calls task(i) for each i in `participants`, in
+  // parallel iff `parallel_tasks` is true (phase 2). If any task throws, all
+  // of them run to completion and then the exception of the first one in
+  // `participants` is rethrown.
+  // @pre num_parallel_threads() > 1.
+  template <typename Task>
+  void EvalSubsystemsInParallel(const DiagramContext<T>& context,
+                                const std::vector<SubsystemIndex>& participants,
+                                bool parallel_tasks, const Task& task) const;
+
   // Sugar to bring SystemBase::GetGraphvizPortLabels() into scope.
   std::vector<std::string> GetGraphvizPortLabels(bool input) const;
 
@@ -618,6 +706,40 @@ class Diagram : public System<T>, internal::SystemParentServiceInterface {
   // allocated as a cache entry to avoid heap operations during simulation.
   CacheIndex event_times_buffer_cache_index_{};
 
+  // The parallelism with which to evaluate the subsystems. The members below
+  // are only populated when num_parallel_threads() > 1.
+  Parallelism parallelism_;
+
+  // An internally connected subsystem output port, i.e., one that is connected
+  // to some subsystem input port. The level is zero for ports without direct
+  // feedthrough from internally connected input ports; otherwise it is one more
+  // than the highest level among the ports upstream of those input ports.
+  struct ScheduledOutput {
+    OutputPortLocator locator;
+    SubsystemIndex subsystem;
+    int level{};
+  };
+
+  // All internally connected output ports, sorted by level and then subsystem.
+  std::vector<ScheduledOutput> scheduled_outputs_;
+
+  // The scheduled outputs of the same subsystem and level make up a group,
+  // evaluated by a single task. Group g comprises scheduled_outputs_[k] for
+  // output_group_start_[g] <= k < output_group_start_[g + 1], and the groups
+  // in level l are those with level_group_start_[l] <= g <
+  // level_group_start_[l + 1].
+  std::vector<int> output_group_start_;
+  std::vector<int> level_group_start_;
+
+  // For each subsystem, the indices of the scheduled outputs that are
+  // (transitively) upstream of its input ports, in increasing order.
+  std::vector<std::vector<int>> subsystem_prerequisite_outputs_;
+
+  // For each subsystem, the input ports of this Diagram that are upstream of
+  // its input ports, either directly or through direct feedthrough of its
+  // prerequisite outputs, in increasing order.
+  std::vector<std::vector<InputPortIndex>> subsystem_prerequisite_inputs_;
+
   // For all T, Diagram<T> considers DiagramBuilder<T> a friend, so that the
   // builder can set the internal state correctly.
   friend class DiagramBuilder<T>;
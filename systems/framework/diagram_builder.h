@@ -12,6 +12,7 @@
 #include "drake/common/default_scalars.h"
 #include "drake/common/drake_copyable.h"
 #include "drake/common/hash.h"
+#include "drake/common/parallelism.h"
 #include "drake/common/pointer_cast.h"
 #include "drake/systems/framework/diagram.h"
 #include "drake/systems/framework/system.h"
@@ -438,6 +439,25 @@ class DiagramBuilder {
       const OutputPort<T>& output,
       std::variant<std::string, UseDefaultName> name = kUseDefaultName);
 
+  /// (Experimental) Sets the parallelism with which the Diagram to be built
+  /// evaluates its immediate subsystems. The default is no parallelism. See
+  /// @ref Diagram_parallelism "Parallel evaluation of subsystems" for what is
+  /// evaluated concurrently and for the requirements that places on the
+  /// subsystems. The setting does not propagate to nested Diagrams; each
+  /// DiagramBuilder must opt in separately. In pydrake, the setting is reset
+  /// to no parallelism at Build() time when any subsystem, at any depth, is
+  /// implemented in Python, because such subsystems need the GIL.
+  void set_parallelism(Parallelism parallelism) {
+    ThrowIfAlreadyBuilt();
+    parallelism_ = parallelism;
+  }
+
+  /// Returns the parallelism set by set_parallelism().
+  Parallelism get_parallelism() const {
+    ThrowIfAlreadyBuilt();
+    return parallelism_;
+  }
+
   /// Builds the Diagram that has been described by the calls to Connect,
   /// ExportInput, and ExportOutput.
   /// @throws std::exception if the graph is not buildable.
@@ -502,6 +522,9 @@ class DiagramBuilder {
   // Whether or not Build() or BuildInto() has been called yet.
   bool already_built_{false};
 
+  // The parallelism to pass on to the Diagram.
+  Parallelism parallelism_;
+
   // The ordered inputs and outputs of the Diagram to be built.
   std::vector<InputPortLocator> input_port_ids_;
   std::vector<std::string> input_port_names_;
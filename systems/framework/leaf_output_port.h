@@ -18,13 +18,21 @@
 namespace drake {
 namespace systems {
 
-// TODO(sherm1) Output ports that simply expose existing Context objects
-// should not require a cache entry. Add provision for that to avoid the
-// unnecessary copying currently done by Eval() for those.
+template <typename T>
+class LeafSystem;
+
 /** (Advanced.) Implements an output port whose value is managed by a cache
 entry in the same LeafSystem as the port. This is intended for internal use in
 implementing the DeclareOutputPort() variants in LeafSystem.
 
+A port may instead be _aliased_ (see LeafSystem::AliasOutputPort()) to an
+object that already lives in the Context, such as an input port value or an
+abstract state. Eval() on an aliased port returns a reference to that object
+directly rather than copying it into the cache entry, and the port's
+dependency tracker subscribes to the alias' prerequisite so that downstream
+computations are invalidated exactly when the aliased object may change.
+Calc() still copies into the supplied storage.
+
 @tparam_default_scalar
 */
 template <typename T>
@@ -58,6 +66,13 @@ class LeafOutputPort final : public OutputPort<T> {
   using CalcVectorCallback =
   std::function<void(const Context<T>&, BasicVector<T>*)>;
 
+  /** Signature of a function that returns a reference to an existing object
+  in the given Context, suitable for use as the value of an aliased output
+  port. The returned object must be owned by the Context (or by the System)
+  and must not change unless the alias prerequisite is notified. */
+  using AliasCallback =
+  std::function<const AbstractValue&(const Context<T>&)>;
+
   /** Returns the cache entry associated with this output port. */
   const CacheEntry& cache_entry() const {
     DRAKE_ASSERT(cache_entry_ != nullptr);
@@ -73,8 +88,14 @@ class LeafOutputPort final : public OutputPort<T> {
     cache_entry_->disable_caching_by_default();
   }
 
+  /** Returns true if Eval() on this port returns a reference to an existing
+  Context object rather than a cached copy.
+  @see LeafSystem::AliasOutputPort() */
+  bool is_aliased() const { return alias_function_ != nullptr; }
+
  private:
   friend class internal::FrameworkFactory;
+  friend class LeafSystem<T>;
 
   // Constructs a cached output port. The `system` parameter must be the same
   // object as the `system_interface` parameter.
@@ -100,16 +121,36 @@ class LeafOutputPort final : public OutputPort<T> {
     cache_entry().Calc(context, value);
   }
 
-  // Invokes the cache entry's Eval() function.
+  // Returns the aliased object if there is one, otherwise invokes the cache
+  // entry's Eval() function.
   const AbstractValue& DoEval(const Context<T>& context) const final {
+    if (alias_function_ != nullptr) {
+      return alias_function_(context);
+    }
     return cache_entry().EvalAbstract(context);
   }
 
-  // Returns the cache entry's ticket and no subsystem.
+  // Returns the alias' ticket if aliased, otherwise the cache entry's ticket,
+  // and no subsystem.
   internal::OutputPortPrerequisite DoGetPrerequisite() const final {
+    if (alias_function_ != nullptr) {
+      return {std::nullopt, alias_prerequisite_};
+    }
     return {std::nullopt, cache_entry().ticket()};
   };
 
+  // Makes DoEval() return the result of `alias_function` rather than the
+  // cache entry value. Only LeafSystem may call this, and only during System
+  // construction, since the prerequisite is consumed when a Context is
+  // allocated.
+  void set_alias(AliasCallback alias_function,
+                 DependencyTicket alias_prerequisite) {
+    DRAKE_DEMAND(alias_function != nullptr);
+    DRAKE_DEMAND(alias_prerequisite.is_valid());
+    alias_function_ = std::move(alias_function);
+    alias_prerequisite_ = alias_prerequisite;
+  }
+
   // Check that an AbstractValue provided to Calc() is suitable for this port
   // by comparing it with the port's cache entry value type.
   void ThrowIfInvalidPortValueType(
@@ -117,6 +158,8 @@ class LeafOutputPort final : public OutputPort<T> {
       const AbstractValue& proposed_value) const final;
 
   CacheEntry* const cache_entry_;
+  AliasCallback alias_function_;
+  DependencyTicket alias_prerequisite_;
 };
 
 }  // namespace systems
@@ -1,5 +1,6 @@
 #include "drake/systems/framework/leaf_system.h"
 
+#include <algorithm>
 #include <cmath>
 #include <limits>
 
@@ -350,52 +351,64 @@ template <typename T>
 void LeafSystem<T>::DoCalcNextUpdateTime(
     const Context<T>& context,
     CompositeEventCollection<T>* events, T* time) const {
-  T min_time = std::numeric_limits<double>::infinity();
+  if (periodic_event_timings_.empty()) {
+    *time = std::numeric_limits<double>::infinity();
+    return;
+  }
 
-  if (!periodic_events_.HasEvents()) {
-    *time = min_time;
+  // When all of the periodic events share the same timing (the common case),
+  // they all fire next.
+  if (periodic_event_timings_.size() == 1) {
+    *time = GetNextSampleTime(periodic_event_timings_[0], context.get_time());
+    events->AddToEnd(periodic_events_);
     return;
   }
 
-  // Calculate which events to fire. Use an InlinedVector so that small-ish
-  // numbers of events can be processed without heap allocations. Our threshold
-  // for "small" is the same amount that would cause an EventCollection to
-  // grow beyond its pre-allocated size.
-  using NextEventsVector = absl::InlinedVector<
-      const Event<T>*, LeafEventCollection<PublishEvent<T>>::kDefaultCapacity>;
-  NextEventsVector next_events;
-
-  // Find the minimum next sample time across all declared periodic events,
-  // and store the set of declared events that will occur at that time.
-  // There are three lists to run through in a CompositeEventCollection.
-
-  // We give absl hidden visibility in Drake so can't capture the absl vector
-  // (otherwise we suffer a warning). Works as a parameter though.
-  auto scan_events = [&context, &min_time](const auto& typed_events,
-                                           NextEventsVector* event_list) {
+  // Find the minimum next sample time across all distinct timings. Use an
+  // InlinedVector so that small-ish numbers of timings can be processed
+  // without heap allocations.
+  absl::InlinedVector<T, 4> next_times;
+  T min_time = std::numeric_limits<double>::infinity();
+  for (const PeriodicEventData& timing : periodic_event_timings_) {
+    next_times.push_back(GetNextSampleTime(timing, context.get_time()));
+    if (next_times.back() < min_time) {
+      min_time = next_times.back();
+    }
+  }
+
+  // Write out the events that fire at min_time, in the same order as they
+  // appear in periodic_events_.
+  *time = min_time;
+  for (const auto& [event, timing_index] : periodic_event_timing_indices_) {
+    if (next_times[timing_index] == min_time) {
+      event->AddToComposite(events);
+    }
+  }
+}
+
+template <typename T>
+void LeafSystem<T>::UpdatePeriodicEventTimings() {
+  // Event storage may have been reallocated by the latest declaration, so we
+  // rebuild from scratch (this only happens at declaration time).
+  periodic_event_timings_.clear();
+  periodic_event_timing_indices_.clear();
+  auto add_events = [this](const auto& typed_events) {
     for (const auto* event : typed_events.get_events()) {
       const PeriodicEventData* event_data =
           event->template get_event_data<PeriodicEventData>();
       DRAKE_DEMAND(event_data != nullptr);
-      const T t = GetNextSampleTime(*event_data, context.get_time());
-      if (t < min_time) {
-        min_time = t;
-        *event_list = {event};
-      } else if (t == min_time) {
-        event_list->push_back(event);
+      auto iter = std::find(periodic_event_timings_.begin(),
+                            periodic_event_timings_.end(), *event_data);
+      if (iter == periodic_event_timings_.end()) {
+        iter = periodic_event_timings_.insert(iter, *event_data);
       }
+      periodic_event_timing_indices_.emplace_back(
+          event, iter - periodic_event_timings_.begin());
     }
   };
-
-  scan_events(periodic_events_.get_publish_events(), &next_events);
-  scan_events(periodic_events_.get_discrete_update_events(), &next_events);
-  scan_events(periodic_events_.get_unrestricted_update_events(), &next_events);
-
-  // Write out the events that fire at min_time.
-  *time = min_time;
-  for (const Event<T>* event : next_events) {
-    event->AddToComposite(events);
-  }
+  add_events(periodic_events_.get_publish_events());
+  add_events(periodic_events_.get_discrete_update_events());
+  add_events(periodic_events_.get_unrestricted_update_events());
 }
 
 #pragma GCC diagnostic push
@@ -706,7 +719,7 @@ LeafOutputPort<T>& LeafSystem<T>::DeclareStateOutputPort(
   DRAKE_THROW_UNLESS(state_index.is_valid());
   DRAKE_THROW_UNLESS(state_index >= 0);
   DRAKE_THROW_UNLESS(state_index < this->model_abstract_states_.size());
-  return DeclareAbstractOutputPort(
+  auto& port = DeclareAbstractOutputPort(
       std::move(name),
       [this, state_index]() {
         return this->model_abstract_states_.CloneModel(state_index);
@@ -715,6 +728,24 @@ LeafOutputPort<T>& LeafSystem<T>::DeclareStateOutputPort(
         output->SetFrom(context.get_abstract_state().get_value(state_index));
       },
       {this->abstract_state_ticket(state_index)});
+  AliasOutputPort(
+      &port,
+      [state_index](const Context<T>& context) -> const AbstractValue& {
+        return context.get_abstract_state().get_value(state_index);
+      },
+      this->abstract_state_ticket(state_index));
+  return port;
+}
+
+template <typename T>
+void LeafSystem<T>::AliasOutputPort(
+    LeafOutputPort<T>* port,
+    typename LeafOutputPort<T>::AliasCallback alias_function,
+    DependencyTicket prerequisite) {
+  DRAKE_THROW_UNLESS(port != nullptr);
+  DRAKE_THROW_UNLESS(&port->get_system() == this);
+  DRAKE_THROW_UNLESS(alias_function != nullptr);
+  port->set_alias(std::move(alias_function), prerequisite);
 }
 
 template <typename T>
@@ -497,6 +497,7 @@ class LeafSystem : public System<T> {
     event_copy->set_trigger_type(TriggerType::kPeriodic);
     event_copy->set_event_data(periodic_data);
     event_copy->AddToComposite(TriggerType::kPeriodic, &periodic_events_);
+    UpdatePeriodicEventTimings();
   }
 
   DRAKE_DEPRECATED(
@@ -1517,12 +1518,38 @@ class LeafSystem : public System<T> {
       DiscreteStateIndex state_index);
 
   /** Declares an abstract-valued output port whose value is the given abstract
-  state of this system.
+  state of this system. The port is aliased to the state (see
+  AliasOutputPort()), so evaluating it does not copy the state value.
   @pydrake_mkdoc_identifier{abstract} */
   LeafOutputPort<T>& DeclareStateOutputPort(
       std::variant<std::string, UseDefaultName> name,
       AbstractStateIndex state_index);
 
+  /** (Advanced) Makes an already-declared output port of this system an alias
+  for an object that already lives in the Context (typically an input port
+  value or an abstract state), so that OutputPort::Eval() returns a reference
+  to that object rather than a copy held in the port's cache entry. This
+  avoids copying large values (images, point clouds, contact results) through
+  primitives that merely forward them.
+
+  @param port an output port previously declared by this system.
+  @param alias_function returns the object to be used as the port's value.
+         The returned object must have the same type as the port's allocated
+         value, must outlive the Context, and may change only when
+         `prerequisite` is notified.
+  @param prerequisite the ticket upon whose change the aliased object may
+         change, e.g. input_port_ticket() or abstract_state_ticket().
+         Downstream computations are subscribed directly to it.
+
+  The port's cache entry is retained and is still used by
+  OutputPort::Calc(), which copies the aliased value as usual, and for
+  direct-feedthrough analysis, so the cache entry's prerequisites should be
+  consistent with `prerequisite`.
+  @throws std::exception if `port` does not belong to this system. */
+  void AliasOutputPort(LeafOutputPort<T>* port,
+                       typename LeafOutputPort<T>::AliasCallback alias_function,
+                       DependencyTicket prerequisite);
+
   /** Flags an already-declared output port as deprecated. The first attempt to
   use the port in a program will log a warning message. This function may be
   called at most once for any given port. */
@@ -2024,9 +2051,21 @@ class LeafSystem : public System<T> {
       const std::function<const VectorBase<T>&(const Context<T>&)>&
           get_vector_from_context);
 
+  // Recomputes periodic_event_timings_ and periodic_event_timing_indices_
+  // from periodic_events_.
+  void UpdatePeriodicEventTimings();
+
   // Periodic Update or Publish events declared by this system.
   LeafCompositeEventCollection<T> periodic_events_;
 
+  // The distinct timings of the periodic_events_, and for each of those events
+  // (the publish events, then the discrete update events, then the
+  // unrestricted update events) the index of its timing. This lets
+  // DoCalcNextUpdateTime() compute the next sample time once per timing rather
+  // than once per event.
+  std::vector<PeriodicEventData> periodic_event_timings_;
+  std::vector<std::pair<const Event<T>*, int>> periodic_event_timing_indices_;
+
   // Update or Publish events declared by this system for every simulator
   // major time step.
   LeafCompositeEventCollection<T> per_step_events_;
@@ -689,6 +689,92 @@ TEST_F(CacheEntryTest, InvalidationIsRecursive) {
   EXPECT_FALSE(vector_entry().is_out_of_date(context_));
 }
 
+// Check that cache profiling counts computations and invalidations only while
+// it is enabled, and records a timed event for each computation.
+TEST_F(CacheEntryTest, Profiling) {
+  const Cache& cache = context_.get_cache();
+  auto statistics = [this](const CacheEntry& entry) {
+    return entry.get_cache_entry_value(context_).statistics();
+  };
+  EXPECT_FALSE(context_.is_cache_profiling_enabled());
+  context_.EnableCacheProfiling();
+  EXPECT_TRUE(context_.is_cache_profiling_enabled());
+  EXPECT_TRUE(entry0().get_cache_entry_value(context_).is_profiling_enabled());
+  EXPECT_EQ(statistics(entry2()).num_computations, 0);
+  EXPECT_EQ(statistics(entry2()).num_invalidations, 0);
+
+  // Changing time invalidates every entry exactly once.
+  context_.get_tracker(system_.time_ticket()).NoteValueChange(99);
+  for (const CacheEntry* entry :
+       {&entry0(), &entry1(), &entry2(), &entry3(), &string_entry(),
+        &vector_entry()}) {
+    EXPECT_EQ(statistics(*entry).num_invalidations, 1);
+    EXPECT_EQ(statistics(*entry).num_computations, 0);
+  }
+
+  // Only the first Eval() computes, except for the disabled entry3.
+  entry2().Eval<int>(context_);
+  entry2().Eval<int>(context_);
+  entry3().Eval<int>(context_);
+  entry3().Eval<int>(context_);
+  EXPECT_EQ(statistics(entry2()).num_computations, 1);
+  EXPECT_EQ(statistics(entry3()).num_computations, 2);
+  EXPECT_EQ(statistics(entry0()).num_computations, 0);
+  EXPECT_GE(statistics(entry2()).cumulative_time, 0.0);
+  EXPECT_LE(statistics(entry2()).self_time,
+            statistics(entry2()).cumulative_time);
+  ASSERT_EQ(cache.profile_events().size(), 3);
+  EXPECT_EQ(cache.profile_events()[0].cache_index, index2_);
+  EXPECT_EQ(cache.profile_events()[1].cache_index, index3_);
+  EXPECT_EQ(cache.profile_events()[2].cache_index, index3_);
+  EXPECT_GE(cache.profile_events()[0].duration, 0.0);
+
+  // The recomputations are attributed to the change in time, which reached
+  // entry2 indirectly via all_sources and entry0, except for the one that was
+  // only needed because caching is disabled for entry3.
+  const std::string time_path = "::cache_entry_test_system:t";
+  EXPECT_EQ(cache.profile_events()[0].cause, time_path);
+  EXPECT_EQ(cache.profile_events()[1].cause, time_path);
+  EXPECT_EQ(cache.profile_events()[2].cause, "<caching disabled>");
+  EXPECT_EQ(statistics(entry2()).num_computations_by_cause,
+            (std::map<std::string, int64_t>{{time_path, 1}}));
+  EXPECT_EQ(statistics(entry3()).num_computations_by_cause,
+            (std::map<std::string, int64_t>{{time_path, 1},
+                                            {"<caching disabled>", 1}}));
+
+  // A forced invalidation of an up-to-date entry has no particular cause.
+  entry1().Eval<int>(context_);
+  context_.SetAllCacheEntriesOutOfDate();
+  entry1().Eval<int>(context_);
+  EXPECT_EQ(cache.profile_events().back().cause, "<unspecified>");
+
+  // A clone keeps profiling enabled but starts with no events.
+  {
+    auto clone = context_.Clone();
+    EXPECT_TRUE(clone->is_cache_profiling_enabled());
+    EXPECT_TRUE(clone->get_cache().profile_events().empty());
+    EXPECT_FALSE(cache.profile_events().empty());
+  }
+
+  // Resetting clears everything without disabling profiling.
+  context_.ResetCacheProfiling();
+  EXPECT_TRUE(context_.is_cache_profiling_enabled());
+  EXPECT_EQ(statistics(entry3()).num_computations, 0);
+  EXPECT_EQ(statistics(entry3()).num_invalidations, 0);
+  EXPECT_EQ(statistics(entry3()).cumulative_time, 0.0);
+  EXPECT_TRUE(statistics(entry3()).num_computations_by_cause.empty());
+  EXPECT_TRUE(cache.profile_events().empty());
+
+  // Once disabled, nothing more is gathered.
+  context_.DisableCacheProfiling();
+  EXPECT_FALSE(context_.is_cache_profiling_enabled());
+  context_.get_tracker(system_.time_ticket()).NoteValueChange(100);
+  entry2().Eval<int>(context_);
+  EXPECT_EQ(statistics(entry2()).num_computations, 0);
+  EXPECT_EQ(statistics(entry2()).num_invalidations, 0);
+  EXPECT_TRUE(cache.profile_events().empty());
+}
+
 TEST_F(CacheEntryTest, Copy) {
   // Create a clone of the cache and dependency graph.
   auto clone_context_ptr = context_.Clone();
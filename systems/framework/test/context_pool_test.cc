@@ -0,0 +1,199 @@
+#include "drake/systems/framework/context_pool.h"
+
+#include <future>
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/limit_malloc.h"
+#include "drake/systems/framework/diagram_builder.h"
+#include "drake/systems/framework/leaf_system.h"
+
+namespace drake {
+namespace systems {
+namespace {
+
+using Eigen::Vector2d;
+using Eigen::Vector3d;
+
+// A system with every kind of numeric context value that the pool resets.
+class PooledSystem final : public LeafSystem<double> {
+ public:
+  PooledSystem() {
+    DeclareContinuousState(2);
+    DeclareDiscreteState(3);
+    DeclareNumericParameter(BasicVector<double>(Vector2d(1.0, 2.0)));
+    DeclareVectorInputPort("u", 2);
+  }
+};
+
+class ContextPoolTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    prototype_ = system_.CreateDefaultContext();
+    prototype_->SetTime(1.5);
+    prototype_->SetAccuracy(1e-3);
+    prototype_->SetContinuousState(Vector2d(3.0, 4.0));
+    prototype_->SetDiscreteState(Vector3d(5.0, 6.0, 7.0));
+    system_.get_input_port().FixValue(prototype_.get(), Vector2d(8.0, 9.0));
+  }
+
+  // Changes everything that the pool resets in `context`.
+  void Scribble(Context<double>* context) const {
+    context->SetTime(10.0);
+    context->SetAccuracy(1e-6);
+    context->SetContinuousState(Vector2d::Constant(-1.0));
+    context->SetDiscreteState(Vector3d::Constant(-2.0));
+    context->get_mutable_numeric_parameter(0).SetFromVector(
+        Vector2d::Constant(-3.0));
+    context->MaybeGetMutableFixedInputPortValue(0)
+        ->GetMutableVectorData<double>()
+        ->SetFromVector(Vector2d::Constant(-4.0));
+  }
+
+  // Checks that `context` is equal to the prototype.
+  void ExpectPrototype(const Context<double>& context) const {
+    EXPECT_EQ(context.get_time(), 1.5);
+    EXPECT_EQ(context.get_accuracy(), 1e-3);
+    EXPECT_EQ(context.get_continuous_state_vector().CopyToVector(),
+              Vector2d(3.0, 4.0));
+    EXPECT_EQ(context.get_discrete_state_vector().CopyToVector(),
+              Vector3d(5.0, 6.0, 7.0));
+    EXPECT_EQ(context.get_numeric_parameter(0).CopyToVector(),
+              Vector2d(1.0, 2.0));
+    EXPECT_EQ(system_.get_input_port().Eval(context), Vector2d(8.0, 9.0));
+  }
+
+  PooledSystem system_;
+  std::unique_ptr<Context<double>> prototype_;
+};
+
+TEST_F(ContextPoolTest, Lifecycle) {
+  ContextPool<double> dut(*prototype_, 1);
+  EXPECT_EQ(dut.num_allocated(), 1);
+  EXPECT_EQ(dut.num_available(), 1);
+  ExpectPrototype(dut.prototype());
+
+  const Context<double>* first{};
+  {
+    ContextPool<double>::LeasedContext context = dut.Acquire();
+    first = context.get();
+    EXPECT_EQ(dut.num_available(), 0);
+    ExpectPrototype(*context);
+
+    // The pool allocates when it runs out of contexts.
+    ContextPool<double>::LeasedContext second = dut.Acquire();
+    EXPECT_NE(second.get(), first);
+    EXPECT_EQ(dut.num_allocated(), 2);
+    ExpectPrototype(*second);
+    Scribble(context.get());
+  }
+  EXPECT_EQ(dut.num_available(), 2);
+
+  // A returned context is reused, after having been reset.
+  ContextPool<double>::LeasedContext context = dut.Acquire();
+  ContextPool<double>::LeasedContext other = dut.Acquire();
+  EXPECT_TRUE(context.get() == first || other.get() == first);
+  EXPECT_EQ(dut.num_allocated(), 2);
+  ExpectPrototype(*context);
+  ExpectPrototype(*other);
+
+  // The pool keeps no reference to the original prototype.
+  prototype_.reset();
+  ExpectPrototype(dut.prototype());
+}
+
+TEST_F(ContextPoolTest, ResetDoesNotAllocate) {
+  ContextPool<double> dut(*prototype_, 1);
+  ContextPool<double>::LeasedContext context = dut.Acquire();
+  Scribble(context.get());
+  {
+    test::LimitMalloc guard({.max_num_allocations = 0});
+    dut.ResetContext(context.get());
+  }
+  ExpectPrototype(*context);
+
+  // Acquiring and returning does not allocate in steady state either.
+  context.reset();
+  {
+    test::LimitMalloc guard({.max_num_allocations = 0});
+    for (int i = 0; i < 10; ++i) {
+      ContextPool<double>::LeasedContext leased = dut.Acquire();
+      leased->SetTime(i);
+    }
+  }
+
+  // Returning contexts that the pool had to clone does not allocate.
+  ContextPool<double>::LeasedContext first = dut.Acquire();
+  ContextPool<double>::LeasedContext second = dut.Acquire();
+  ContextPool<double>::LeasedContext third = dut.Acquire();
+  EXPECT_EQ(dut.num_allocated(), 3);
+  {
+    test::LimitMalloc guard({.max_num_allocations = 0});
+    first.reset();
+    second.reset();
+    third.reset();
+  }
+  EXPECT_EQ(dut.num_available(), 3);
+}
+
+TEST_F(ContextPoolTest, InputFixedWhileLeased) {
+  // The input port is not fixed in this pool's prototype.
+  ContextPool<double> dut(*system_.CreateDefaultContext(), 1);
+  ContextPool<double>::LeasedContext context = dut.Acquire();
+  system_.get_input_port().FixValue(context.get(), Vector2d(1.0, 2.0));
+
+  // Such a context can't be reset to the prototype.
+  EXPECT_THROW(dut.ResetContext(context.get()), std::exception);
+
+  // When it is returned, the pool deletes it.
+  context.reset();
+  EXPECT_EQ(dut.num_allocated(), 0);
+  EXPECT_EQ(dut.num_available(), 0);
+
+  // So the next lease has the input port unfixed again.
+  context = dut.Acquire();
+  EXPECT_EQ(context->MaybeGetFixedInputPortValue(0), nullptr);
+  EXPECT_EQ(dut.num_allocated(), 1);
+}
+
+TEST_F(ContextPoolTest, ConcurrentAcquire) {
+  ContextPool<double> dut(*prototype_);
+  auto work = [this, &dut]() {
+    for (int i = 0; i < 100; ++i) {
+      ContextPool<double>::LeasedContext context = dut.Acquire();
+      ExpectPrototype(*context);
+      Scribble(context.get());
+    }
+  };
+  std::vector<std::future<void>> workers;
+  for (int i = 0; i < 2; ++i) {
+    workers.push_back(std::async(std::launch::async, work));
+  }
+  for (auto& worker : workers) {
+    worker.get();
+  }
+  EXPECT_LE(dut.num_allocated(), 2);
+  EXPECT_EQ(dut.num_available(), dut.num_allocated());
+}
+
+TEST_F(ContextPoolTest, BadArguments) {
+  DiagramBuilder<double> builder;
+  const auto* leaf = builder.AddSystem<PooledSystem>();
+  builder.ExportInput(leaf->get_input_port());
+  const auto diagram = builder.Build();
+  const auto diagram_context = diagram->CreateDefaultContext();
+  const Context<double>& leaf_context =
+      leaf->GetMyContextFromRoot(*diagram_context);
+  EXPECT_THROW(ContextPool<double>{leaf_context}, std::exception);
+  EXPECT_THROW(ContextPool<double>(*prototype_, -1), std::exception);
+
+  // A pool of diagram contexts is fine.
+  ContextPool<double> dut(*diagram_context);
+  EXPECT_EQ(dut.Acquire()->num_input_ports(), 1);
+}
+
+}  // namespace
+}  // namespace systems
+}  // namespace drake
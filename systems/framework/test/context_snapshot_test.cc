@@ -0,0 +1,160 @@
+#include "drake/systems/framework/context_snapshot.h"
+
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/limit_malloc.h"
+#include "drake/systems/framework/diagram_builder.h"
+#include "drake/systems/framework/leaf_system.h"
+
+namespace drake {
+namespace systems {
+namespace {
+
+using Eigen::Vector2d;
+using Eigen::Vector3d;
+
+// A system with every kind of value that a snapshot saves, and a cache entry
+// that depends only on the discrete state.
+class SnapshotSystem final : public LeafSystem<double> {
+ public:
+  SnapshotSystem() {
+    DeclareContinuousState(2);
+    DeclareDiscreteState(3);
+    DeclareAbstractState(Value<std::string>("a"));
+    DeclareNumericParameter(BasicVector<double>(Vector2d(1.0, 2.0)));
+    DeclareAbstractParameter(Value<int>(3));
+    discrete_sum_ = &DeclareCacheEntry(
+        "discrete sum", ValueProducer(this, &SnapshotSystem::CalcDiscreteSum),
+        {discrete_state_ticket(DiscreteStateIndex(0))});
+  }
+
+  const CacheEntry& discrete_sum() const { return *discrete_sum_; }
+  int num_calcs() const { return num_calcs_; }
+
+ private:
+  void CalcDiscreteSum(const Context<double>& context, double* sum) const {
+    ++num_calcs_;
+    *sum = context.get_discrete_state_vector().value().sum();
+  }
+
+  const CacheEntry* discrete_sum_{};
+  mutable int num_calcs_{0};
+};
+
+class ContextSnapshotTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    context_ = system_.CreateDefaultContext();
+    context_->SetTime(1.5);
+    context_->SetAccuracy(1e-3);
+    context_->SetContinuousState(Vector2d(3.0, 4.0));
+    context_->SetDiscreteState(Vector3d(5.0, 6.0, 7.0));
+    context_->SetAbstractState(0, std::string("b"));
+  }
+
+  // Checks that `context` has the values set in SetUp().
+  void ExpectOriginal(const Context<double>& context) const {
+    EXPECT_EQ(context.get_time(), 1.5);
+    EXPECT_EQ(context.get_accuracy(), 1e-3);
+    EXPECT_EQ(context.get_continuous_state_vector().CopyToVector(),
+              Vector2d(3.0, 4.0));
+    EXPECT_EQ(context.get_discrete_state_vector().CopyToVector(),
+              Vector3d(5.0, 6.0, 7.0));
+    EXPECT_EQ(context.get_abstract_state<std::string>(0), "b");
+    EXPECT_EQ(context.get_numeric_parameter(0).CopyToVector(),
+              Vector2d(1.0, 2.0));
+    EXPECT_EQ(context.get_abstract_parameter(0).get_value<int>(), 3);
+  }
+
+  SnapshotSystem system_;
+  std::unique_ptr<Context<double>> context_;
+};
+
+TEST_F(ContextSnapshotTest, CaptureAndRestore) {
+  ContextSnapshot<double> dut;
+  EXPECT_TRUE(dut.empty());
+  EXPECT_THROW(dut.Restore(context_.get()), std::exception);
+
+  dut.Capture(*context_);
+  EXPECT_FALSE(dut.empty());
+  EXPECT_EQ(dut.time(), 1.5);
+
+  context_->SetTime(10.0);
+  context_->SetAccuracy(1e-6);
+  context_->SetContinuousState(Vector2d::Constant(-1.0));
+  context_->SetDiscreteState(Vector3d::Constant(-2.0));
+  context_->SetAbstractState(0, std::string("c"));
+  context_->get_mutable_numeric_parameter(0).SetFromVector(
+      Vector2d::Constant(-3.0));
+  context_->get_mutable_abstract_parameter(0).set_value<int>(-4);
+  dut.Restore(context_.get());
+  ExpectOriginal(*context_);
+
+  // A snapshot may be restored into a clone of the captured context.
+  auto clone = system_.CreateDefaultContext();
+  dut.Restore(clone.get());
+  ExpectOriginal(*clone);
+}
+
+// Restoring keeps the cache entries that depend only on unchanged values.
+TEST_F(ContextSnapshotTest, KeepsValidCacheEntries) {
+  const ContextSnapshot<double> dut(*context_);
+  EXPECT_EQ(system_.discrete_sum().Eval<double>(*context_), 18.0);
+  EXPECT_EQ(system_.num_calcs(), 1);
+
+  // A rollout that only changes time and continuous state.
+  context_->SetTime(2.0);
+  context_->SetContinuousState(Vector2d::Zero());
+  dut.Restore(context_.get());
+  EXPECT_FALSE(system_.discrete_sum().is_out_of_date(*context_));
+  EXPECT_EQ(system_.discrete_sum().Eval<double>(*context_), 18.0);
+  EXPECT_EQ(system_.num_calcs(), 1);
+
+  // A rollout that changes the discrete state.
+  context_->SetDiscreteState(Vector3d::Zero());
+  EXPECT_EQ(system_.discrete_sum().Eval<double>(*context_), 0.0);
+  EXPECT_EQ(system_.num_calcs(), 2);
+  dut.Restore(context_.get());
+  EXPECT_TRUE(system_.discrete_sum().is_out_of_date(*context_));
+  EXPECT_EQ(system_.discrete_sum().Eval<double>(*context_), 18.0);
+  EXPECT_EQ(system_.num_calcs(), 3);
+}
+
+TEST_F(ContextSnapshotTest, RecaptureAndRestoreDoNotAllocate) {
+  ContextSnapshot<double> dut(*context_);
+  context_->SetContinuousState(Vector2d::Constant(-1.0));
+  {
+    test::LimitMalloc guard({.max_num_allocations = 0});
+    dut.Restore(context_.get());
+    dut.Capture(*context_);
+  }
+  ExpectOriginal(*context_);
+}
+
+TEST_F(ContextSnapshotTest, Diagram) {
+  DiagramBuilder<double> builder;
+  const auto* leaf = builder.AddSystem<SnapshotSystem>();
+  builder.AddSystem<SnapshotSystem>();
+  const auto diagram = builder.Build();
+  auto diagram_context = diagram->CreateDefaultContext();
+  Context<double>& leaf_context =
+      leaf->GetMyMutableContextFromRoot(diagram_context.get());
+  leaf_context.SetDiscreteState(Vector3d(5.0, 6.0, 7.0));
+
+  // Only root contexts may be captured or restored.
+  EXPECT_THROW(ContextSnapshot<double>{leaf_context}, std::exception);
+
+  const ContextSnapshot<double> dut(*diagram_context);
+  leaf_context.SetDiscreteState(Vector3d::Zero());
+  dut.Restore(diagram_context.get());
+  EXPECT_EQ(leaf_context.get_discrete_state_vector().CopyToVector(),
+            Vector3d(5.0, 6.0, 7.0));
+  EXPECT_THROW(dut.Restore(&leaf_context), std::exception);
+}
+
+}  // namespace
+}  // namespace systems
+}  // namespace drake
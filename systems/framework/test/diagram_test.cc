@@ -4065,6 +4065,332 @@ GTEST_TEST(ImplicitTimeDerivatives, DiagramProcessing) {
   EXPECT_EQ(residual, expected_result);
 }
 
+// Builds a Diagram with `num_branches` independent branches, each one
+// comprising a source, a cascade of two gains and an integrator whose output
+// is sampled by a zero-order hold and fed back into a third gain, which is
+// also exported. This gives the parallel schedule several levels and an
+// (algebraic-loop free) feedback cycle.
+std::unique_ptr<Diagram<double>> MakeIndependentBranchesDiagram(
+    int num_branches, Parallelism parallelism) {
+  DiagramBuilder<double> builder;
+  for (int k = 0; k < num_branches; ++k) {
+    auto source = builder.AddSystem<ConstantVectorSource<double>>(
+        Vector2d(1.0 + k, -2.0 * k));
+    auto gain1 = builder.AddSystem<Gain<double>>(0.5 + k, 2);
+    auto gain2 = builder.AddSystem<Gain<double>>(-1.5, 2);
+    auto adder = builder.AddSystem<Adder<double>>(2, 2);
+    auto integrator = builder.AddSystem<Integrator<double>>(2);
+    auto hold = builder.AddSystem<ZeroOrderHold<double>>(0.1, 2);
+    auto feedback = builder.AddSystem<Gain<double>>(-0.1, 2);
+    builder.Cascade(*source, *gain1);
+    builder.Cascade(*gain1, *gain2);
+    builder.Connect(gain2->get_output_port(), adder->get_input_port(0));
+    builder.Connect(feedback->get_output_port(), adder->get_input_port(1));
+    builder.Cascade(*adder, *integrator);
+    builder.Cascade(*integrator, *hold);
+    builder.Cascade(*hold, *feedback);
+    builder.ExportOutput(feedback->get_output_port());
+  }
+  builder.set_parallelism(parallelism);
+  EXPECT_EQ(builder.get_parallelism().num_threads(),
+            parallelism.num_threads());
+  return builder.Build();
+}
+
+// Sets an arbitrary, but deterministic, state on `context`.
+void SetArbitraryState(Context<double>* context) {
+  const int nc = context->num_continuous_states();
+  context->SetContinuousState(VectorXd::LinSpaced(nc, -1.0, 2.0));
+  for (int i = 0; i < context->num_discrete_state_groups(); ++i) {
+    const int size = context->get_discrete_state(i).size();
+    context->SetDiscreteState(i, VectorXd::Constant(size, 0.5 * i - 1.0));
+  }
+}
+
+// Concatenates all of the groups in `values`.
+VectorXd FlattenDiscreteValues(const DiscreteValues<double>& values) {
+  VectorXd result(0);
+  for (int i = 0; i < values.num_groups(); ++i) {
+    const VectorXd& group = values.value(i);
+    result.conservativeResize(result.size() + group.size());
+    result.tail(group.size()) = group;
+  }
+  return result;
+}
+
+// The parallel evaluation of derivatives, discrete updates and outputs agrees
+// with the serial one.
+GTEST_TEST(DiagramParallelismTest, SameResultsAsSerial) {
+  const int kNumBranches = 4;
+  const auto serial =
+      MakeIndependentBranchesDiagram(kNumBranches, Parallelism::None());
+  const auto parallel =
+      MakeIndependentBranchesDiagram(kNumBranches, Parallelism(2));
+  EXPECT_EQ(serial->get_parallelism().num_threads(), 1);
+  EXPECT_EQ(parallel->get_parallelism().num_threads(), 2);
+
+  auto serial_context = serial->CreateDefaultContext();
+  auto parallel_context = parallel->CreateDefaultContext();
+  SetArbitraryState(serial_context.get());
+  SetArbitraryState(parallel_context.get());
+
+  const VectorXd expected_derivatives =
+      serial->EvalTimeDerivatives(*serial_context).CopyToVector();
+  EXPECT_EQ(parallel->EvalTimeDerivatives(*parallel_context).CopyToVector(),
+            expected_derivatives);
+
+  const VectorXd expected_discrete = FlattenDiscreteValues(
+      serial->EvalUniquePeriodicDiscreteUpdate(*serial_context));
+  EXPECT_EQ(FlattenDiscreteValues(
+                parallel->EvalUniquePeriodicDiscreteUpdate(*parallel_context)),
+            expected_discrete);
+
+  auto serial_state = serial_context->CloneState();
+  auto parallel_state = parallel_context->CloneState();
+  serial->CalcForcedUnrestrictedUpdate(*serial_context, serial_state.get());
+  parallel->CalcForcedUnrestrictedUpdate(*parallel_context,
+                                         parallel_state.get());
+  EXPECT_EQ(FlattenDiscreteValues(parallel_state->get_discrete_state()),
+            FlattenDiscreteValues(serial_state->get_discrete_state()));
+
+  for (OutputPortIndex i(0); i < serial->num_output_ports(); ++i) {
+    EXPECT_EQ(parallel->get_output_port(i).Eval(*parallel_context),
+              serial->get_output_port(i).Eval(*serial_context));
+  }
+
+  // Scalar conversion preserves the parallelism.
+  EXPECT_EQ(
+      System<double>::ToAutoDiffXd(*parallel)->get_parallelism().num_threads(),
+      2);
+}
+
+// Publish handlers still run serially, in subsystem order, even though their
+// inputs are evaluated in parallel.
+GTEST_TEST(DiagramParallelismTest, Publish) {
+  std::vector<double> published;
+  DiagramBuilder<double> builder;
+  for (int k = 0; k < 3; ++k) {
+    auto source =
+        builder.AddSystem<ConstantVectorSource<double>>(Vector1d(2.0 * k));
+    auto gain = builder.AddSystem<Gain<double>>(3.0, 1);
+    auto publisher = builder.AddSystem<PublishingSystem>(
+        [&published](double v) { published.push_back(v); });
+    builder.Cascade(*source, *gain);
+    builder.Connect(gain->get_output_port(), publisher->get_input_port(0));
+  }
+  builder.set_parallelism(Parallelism(2));
+  const auto diagram = builder.Build();
+  auto context = diagram->CreateDefaultContext();
+  diagram->ForcedPublish(*context);
+  EXPECT_EQ(published, std::vector<double>({0.0, 6.0, 12.0}));
+}
+
+// A system with continuous state whose derivatives always throw.
+class ThrowingDerivativesSystem : public LeafSystem<double> {
+ public:
+  ThrowingDerivativesSystem() { this->DeclareContinuousState(1); }
+
+ private:
+  void DoCalcTimeDerivatives(const Context<double>&,
+                             ContinuousState<double>*) const final {
+    throw std::runtime_error(this->get_name() + " failed");
+  }
+};
+
+// The reported exception is the one the serial evaluation would have thrown.
+GTEST_TEST(DiagramParallelismTest, Exceptions) {
+  DiagramBuilder<double> builder;
+  builder.AddNamedSystem("first",
+                         std::make_unique<ThrowingDerivativesSystem>());
+  builder.AddNamedSystem("second",
+                         std::make_unique<ThrowingDerivativesSystem>());
+  builder.set_parallelism(Parallelism(2));
+  const auto diagram = builder.Build();
+  auto context = diagram->CreateDefaultContext();
+  auto derivatives = diagram->AllocateTimeDerivatives();
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      diagram->CalcTimeDerivatives(*context, derivatives.get()),
+      "first failed");
+}
+
+// A source whose output counts its own evaluations.
+class CountingSource : public LeafSystem<double> {
+ public:
+  CountingSource() {
+    this->DeclareVectorOutputPort("y", 1, &CountingSource::CalcOutput);
+  }
+
+  int num_calcs() const { return num_calcs_; }
+
+ private:
+  void CalcOutput(const Context<double>&, BasicVector<double>* output) const {
+    ++num_calcs_;
+    (*output)[0] = 3.0;
+  }
+
+  mutable int num_calcs_{0};
+};
+
+// In a nested Diagram, the exported inputs come from the parent Diagram's
+// Context; they are evaluated once, before the subsystems run in parallel.
+GTEST_TEST(DiagramParallelismTest, NestedExportedInputs) {
+  DiagramBuilder<double> inner_builder;
+  for (int k = 0; k < 4; ++k) {
+    auto integrator = inner_builder.AddSystem<Integrator<double>>(1);
+    if (k == 0) {
+      inner_builder.ExportInput(integrator->get_input_port(), "u");
+    } else {
+      inner_builder.ConnectInput("u", integrator->get_input_port());
+    }
+  }
+  inner_builder.set_parallelism(Parallelism(2));
+  DiagramBuilder<double> builder;
+  auto source = builder.AddSystem<CountingSource>();
+  auto inner = builder.AddSystem(inner_builder.Build());
+  builder.Connect(source->get_output_port(), inner->get_input_port());
+  const auto diagram = builder.Build();
+  auto context = diagram->CreateDefaultContext();
+
+  EXPECT_EQ(diagram->EvalTimeDerivatives(*context).CopyToVector(),
+            VectorXd::Constant(4, 3.0));
+  EXPECT_EQ(source->num_calcs(), 1);
+}
+
+// Scalar conversion and cloning of a Diagram that evaluates its subsystems in
+// parallel preserve the subsystems' order and the connections between them.
+GTEST_TEST(DiagramParallelismTest, ScalarConversion) {
+  DiagramBuilder<double> builder;
+  for (int k = 0; k < 4; ++k) {
+    auto source = builder.AddNamedSystem(
+        fmt::format("source{}", k),
+        std::make_unique<ConstantVectorSource<double>>(Vector1d(k)));
+    auto gain = builder.AddNamedSystem(fmt::format("gain{}", k),
+                                       std::make_unique<Gain<double>>(2.0, 1));
+    builder.Cascade(*source, *gain);
+    builder.ExportOutput(gain->get_output_port());
+  }
+  builder.set_parallelism(Parallelism(2));
+  const auto diagram = builder.Build();
+
+  const auto autodiff = diagram->ToAutoDiffXd();
+  const auto clone = System<double>::Clone(*diagram);
+  auto autodiff_context = autodiff->CreateDefaultContext();
+  auto clone_context = clone->CreateDefaultContext();
+  for (int k = 0; k < 4; ++k) {
+    EXPECT_EQ(autodiff->GetSystems()[2 * k]->get_name(),
+              fmt::format("source{}", k));
+    EXPECT_EQ(clone->GetSystems()[2 * k + 1]->get_name(),
+              fmt::format("gain{}", k));
+    EXPECT_EQ(
+        autodiff->get_output_port(k).Eval(*autodiff_context)[0].value(),
+        2.0 * k);
+    EXPECT_EQ(clone->get_output_port(k).Eval(*clone_context)[0], 2.0 * k);
+  }
+}
+
+// Cache profiling statistics and trace events are gathered from all
+// subcontexts, including those of nested diagrams.
+GTEST_TEST(DiagramCacheProfilingTest, ReportAndTraceEvents) {
+  DiagramBuilder<double> inner_builder;
+  auto source = inner_builder.AddNamedSystem(
+      "source", std::make_unique<ConstantVectorSource<double>>(1.0));
+  auto gain = inner_builder.AddNamedSystem(
+      "gain", std::make_unique<Gain<double>>(2.0, 1));
+  inner_builder.Connect(*source, *gain);
+  inner_builder.ExportOutput(gain->get_output_port());
+  DiagramBuilder<double> builder;
+  auto inner = builder.AddNamedSystem("inner", inner_builder.Build());
+  auto adder = builder.AddNamedSystem(
+      "adder", std::make_unique<Adder<double>>(1, 1));
+  builder.Connect(*inner, *adder);
+  builder.ExportOutput(adder->get_output_port());
+  const auto diagram = builder.Build();
+  diagram->set_name("outer");
+  auto context = diagram->CreateDefaultContext();
+  const Context<double>& gain_context =
+      gain->GetMyContextFromRoot(*context);
+  const Context<double>& adder_context =
+      adder->GetMyContextFromRoot(*context);
+  auto output_cache_value = [](const System<double>& system,
+                               const Context<double>& system_context)
+      -> const CacheEntryValue& {
+    const auto& port =
+        dynamic_cast<const LeafOutputPort<double>&>(system.get_output_port());
+    return port.cache_entry().get_cache_entry_value(system_context);
+  };
+  const CacheEntryValue& gain_value = output_cache_value(*gain, gain_context);
+  const CacheEntryValue& adder_value =
+      output_cache_value(*adder, adder_context);
+
+  // Nothing is gathered until profiling is enabled.
+  EXPECT_EQ(diagram->get_output_port().Eval(*context)[0], 2.0);
+  EXPECT_EQ(gain_value.statistics().num_computations, 0);
+  context->SetAllCacheEntriesOutOfDate();
+  context->EnableCacheProfiling();
+  EXPECT_TRUE(gain_context.is_cache_profiling_enabled());
+  EXPECT_EQ(diagram->get_output_port().Eval(*context)[0], 2.0);
+  EXPECT_EQ(diagram->get_output_port().Eval(*context)[0], 2.0);
+  EXPECT_EQ(gain_value.statistics().num_computations, 1);
+  EXPECT_EQ(adder_value.statistics().num_computations, 1);
+  // The adder's computation encloses the gain's.
+  EXPECT_GE(adder_value.statistics().cumulative_time,
+            gain_value.statistics().cumulative_time);
+  EXPECT_LE(adder_value.statistics().self_time,
+            adder_value.statistics().cumulative_time);
+
+  const std::string report = diagram->GetCacheProfilingReport(*context);
+  EXPECT_THAT(report, testing::HasSubstr("computations"));
+  EXPECT_THAT(report, testing::HasSubstr("::outer::inner::gain:output port"));
+  EXPECT_THAT(report, testing::HasSubstr("::outer::adder:output port"));
+
+  const std::string trace = diagram->GetCacheProfilingTraceEvents(*context);
+  EXPECT_THAT(trace, testing::StartsWith("{\"traceEvents\":["));
+  EXPECT_THAT(trace, testing::HasSubstr(
+                         "\"name\":\"::outer::inner::gain:output port"));
+  int num_events = 0;
+  for (size_t pos = trace.find("\"ph\":\"X\""); pos != std::string::npos;
+       pos = trace.find("\"ph\":\"X\"", pos + 1)) {
+    ++num_events;
+  }
+  int num_computations = 0;
+  for (const auto* system : std::vector<const System<double>*>{
+           diagram.get(), inner, source, gain, adder}) {
+    const Context<double>& subcontext = system->GetMyContextFromRoot(*context);
+    for (const CacheProfileEvent& event :
+         subcontext.get_cache().profile_events()) {
+      EXPECT_GE(event.duration, 0.0);
+      ++num_computations;
+    }
+  }
+  EXPECT_EQ(num_events, num_computations);
+  EXPECT_GE(num_events, 3);
+
+  // A parameter change upstream is reported as the cause of the recomputation
+  // of each of its dependents.
+  context->ResetCacheProfiling();
+  source->get_mutable_source_value(
+      &source->GetMyMutableContextFromRoot(context.get()));
+  diagram->get_output_port().Eval(*context);
+  const auto& causes = adder_value.statistics().num_computations_by_cause;
+  ASSERT_EQ(causes.size(), 1);
+  EXPECT_THAT(causes.begin()->first,
+              testing::StartsWith("::outer::inner::source:"));
+  EXPECT_EQ(causes, gain_value.statistics().num_computations_by_cause);
+  EXPECT_THAT(diagram->GetCacheProfilingReport(*context),
+              testing::HasSubstr("recomputed due to ::outer::inner::source:"));
+  EXPECT_THAT(
+      diagram->GetCacheProfilingTraceEvents(*context),
+      testing::HasSubstr("\"args\":{\"cause\":\"::outer::inner::source:"));
+
+  // After a reset, the report has only its header and the trace is empty.
+  context->ResetCacheProfiling();
+  EXPECT_EQ(gain_value.statistics().num_computations, 0);
+  EXPECT_THAT(diagram->GetCacheProfilingReport(*context),
+              testing::Not(testing::HasSubstr("::outer")));
+  EXPECT_THAT(diagram->GetCacheProfilingTraceEvents(*context),
+              testing::Not(testing::HasSubstr("\"ph\"")));
+}
+
 }  // namespace
 }  // namespace systems
 }  // namespace drake
@@ -734,6 +734,30 @@ TEST_F(LeafSystemTest, UpdateAndPublish) {
   }
 }
 
+// Tests that when periodic events with several different timings fire at the
+// same time, they are reported in the order in which they were declared.
+TEST_F(LeafSystemTest, PublishesWithSeveralTimings) {
+  system_.AddPublish(0.5);
+  system_.AddPublish(1.0);
+  system_.AddPublish(0.5);
+  auto get_periods = [this]() {
+    std::vector<double> result;
+    for (const auto* event : leaf_info_->get_publish_events().get_events()) {
+      result.push_back(
+          event->template get_event_data<PeriodicEventData>()->period_sec());
+    }
+    return result;
+  };
+
+  context_.SetTime(0.25);
+  EXPECT_EQ(CalcNextUpdateTime(), 0.5);
+  EXPECT_EQ(get_periods(), std::vector<double>({0.5, 0.5}));
+
+  context_.SetTime(0.75);
+  EXPECT_EQ(CalcNextUpdateTime(), 1.0);
+  EXPECT_EQ(get_periods(), std::vector<double>({0.5, 1.0, 0.5}));
+}
+
 // Tests that if the integrator has stopped on the k-th sample, and the current
 // time for that sample is slightly less than k * period due to floating point
 // rounding, the next sample time is (k + 1) * period.
@@ -1473,6 +1497,10 @@ GTEST_TEST(ModelLeafSystemTest, ModelAbstractState) {
   EXPECT_EQ(context->get_abstract_state<std::string>(1), "whoops");
   EXPECT_EQ(dut.get_output_port().Eval<std::string>(*context), "whoops");
 
+  // The output port is an alias for the state; no copy is made.
+  EXPECT_EQ(&dut.get_output_port().Eval<std::string>(*context),
+            &context->get_abstract_state<std::string>(1));
+
   // Ask it to reset to the defaults specified on system construction.
   dut.SetDefaultContext(context.get());
   EXPECT_EQ(context->get_abstract_state<int>(0), 1);
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <atomic>
 #include <memory>
 #include <optional>
 #include <set>
@@ -213,7 +214,7 @@ class VectorSystem : public LeafSystem<T> {
       if (is_symbolic && is_fixed_input) {
         should_eval_input = true;
       } else {
-        should_eval_input = this->HasAnyDirectFeedthrough();
+        should_eval_input = HasAnyDirectFeedthroughMemoized();
       }
     }
 
@@ -343,6 +344,23 @@ class VectorSystem : public LeafSystem<T> {
   // DoCalcVectorDiscreteVariableUpdates().
   EventStatus CalcDiscreteUpdate(const Context<T>& context,
                                  DiscreteValues<T>* discrete_state) const;
+
+  // Returns HasAnyDirectFeedthrough(), computing it only on the first call.
+  // The answer cannot change once the ports have been declared, and computing
+  // it allocates a whole Context, which we must not do on every output
+  // calculation. Concurrent first calls may both compute the (same) answer.
+  bool HasAnyDirectFeedthroughMemoized() const {
+    int memo = has_any_direct_feedthrough_.load(std::memory_order_relaxed);
+    if (memo < 0) {
+      memo = this->HasAnyDirectFeedthrough() ? 1 : 0;
+      has_any_direct_feedthrough_.store(memo, std::memory_order_relaxed);
+    }
+    return memo == 1;
+  }
+
+  // The memoized result of HasAnyDirectFeedthrough(), or -1 when not yet
+  // known.
+  mutable std::atomic<int> has_any_direct_feedthrough_{-1};
 };
 
 }  // namespace systems
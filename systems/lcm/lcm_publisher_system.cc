@@ -52,6 +52,15 @@ LcmPublisherSystem::LcmPublisherSystem(
 
   DeclareAbstractInputPort("lcm_message", *serializer_->CreateDefaultValue());
 
+  // Scratch space for the encoded message, so that its storage is reused from
+  // one publish to the next instead of being reallocated every time.
+  message_bytes_cache_index_ =
+      this->DeclareCacheEntry(
+              "message_bytes",
+              ValueProducer(std::vector<uint8_t>(), &ValueProducer::NoopCalc),
+              {this->nothing_ticket()})
+          .cache_index();
+
   set_name(make_name(channel_));
   if (publish_triggers.find(TriggerType::kPeriodic) != publish_triggers.end()) {
     DRAKE_THROW_UNLESS(publish_period > 0.0);
@@ -130,7 +139,10 @@ EventStatus LcmPublisherSystem::PublishInputAsLcmMessage(
 
   // Converts the input into LCM message bytes.
   const AbstractValue& input = get_input_port().Eval<AbstractValue>(context);
-  std::vector<uint8_t> message_bytes;
+  std::vector<uint8_t>& message_bytes =
+      this->get_cache_entry(message_bytes_cache_index_)
+          .get_mutable_cache_entry_value(context)
+          .GetMutableValueOrThrow<std::vector<uint8_t>>();
   serializer_->Serialize(input, &message_bytes);
 
   // Publishes onto the specified LCM channel.
@@ -276,6 +276,9 @@ class LcmPublisherSystem : public LeafSystem<double> {
 
   const double publish_period_;
   const double publish_offset_;
+
+  // Scratch storage for the encoded message bytes.
+  CacheIndex message_bytes_cache_index_;
 };
 
 }  // namespace lcm
@@ -161,11 +161,14 @@ void LcmSubscriberSystem::HandleMessage(const void* buffer, int size) {
   DRAKE_LOGGER_TRACE("Receiving LCM {} message", channel_);
   DRAKE_DEMAND(magic_number_ == kMagic);
 
+  // Copy the bytes into the spare buffer without holding the lock, so that
+  // the simulation thread is only blocked for the swap below. Both buffers
+  // keep their capacity, so steady-state traffic doesn't allocate.
   const uint8_t* const rbuf_begin = static_cast<const uint8_t*>(buffer);
   const uint8_t* const rbuf_end = rbuf_begin + size;
+  spare_received_message_.assign(rbuf_begin, rbuf_end);
   std::lock_guard<std::mutex> lock(received_message_mutex_);
-  received_message_.clear();
-  received_message_.insert(received_message_.begin(), rbuf_begin, rbuf_end);
+  received_message_.swap(spare_received_message_);
   received_message_count_++;
   received_message_condition_variable_.notify_all();
 }
@@ -182,6 +182,11 @@ class LcmSubscriberSystem : public LeafSystem<double> {
   // The bytes of the most recently received LCM message.
   std::vector<uint8_t> received_message_;
 
+  // The buffer that HandleMessage() fills before swapping it with
+  // received_message_. It is only accessed by HandleMessage() and thus isn't
+  // guarded by the mutex.
+  std::vector<uint8_t> spare_received_message_;
+
   // A message counter that's incremented every time the handler is called.
   int received_message_count_{0};
 
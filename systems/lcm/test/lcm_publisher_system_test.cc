@@ -115,6 +115,38 @@ GTEST_TEST(LcmPublisherSystemTest, SerializerTest) {
   EXPECT_TRUE(CompareLcmtDrakeSignalMessages(sub.message(), sample_data));
 }
 
+// The storage for the encoded bytes is reused across publishes; messages of
+// different sizes must still come out intact.
+GTEST_TEST(LcmPublisherSystemTest, MessagesOfChangingSize) {
+  lcm::DrakeLcm interface;
+  const std::string channel_name = "channel_name";
+  auto dut =
+      LcmPublisherSystem::Make<lcmt_drake_signal>(channel_name, &interface);
+  unique_ptr<Context<double>> context = dut->CreateDefaultContext();
+  Subscriber sub(&interface, channel_name);
+
+  // clang-format off
+  const lcmt_drake_signal long_data{
+    3,
+    { 1.0, 2.0, 3.0, },
+    { "x", "y", "z", },
+    12345,
+  };
+  const lcmt_drake_signal short_data{
+    1,
+    { 4.0, },
+    { "w", },
+    23456,
+  };
+  // clang-format on
+  for (const lcmt_drake_signal* data : {&long_data, &short_data, &long_data}) {
+    dut->get_input_port().FixValue(context.get(), *data);
+    dut->ForcedPublish(*context);
+    interface.HandleSubscriptions(0);
+    EXPECT_TRUE(CompareLcmtDrakeSignalMessages(sub.message(), *data));
+  }
+}
+
 // Tests that per-step publish generates the expected number of publishes.
 GTEST_TEST(LcmPublisherSystemTest, TestPerStepPublish) {
   lcm::DrakeLcm interface;
@@ -456,18 +456,20 @@ void AffineSystem<T>::CalcOutputY(const Context<T>& context,
   y = y0_;
 
   if (has_meaningful_C_) {
-    const VectorX<T>& x =
+    // N.B. Binding to `auto` (rather than `const VectorX<T>&`) avoids copying
+    // the state segment into a temporary.
+    const auto x =
         (this->time_period() == 0.0)
             ? dynamic_cast<const BasicVector<T>&>(
                   context.get_continuous_state_vector())
                   .get_value()
             : context.get_discrete_state().get_vector().get_value();
-    y += C_ * x;
+    y.noalias() += C_ * x;
   }
 
   if (has_meaningful_D_) {
     const auto& u = this->get_input_port().Eval(context);
-    y += D_ * u;
+    y.noalias() += D_ * u;
   }
 }
 
@@ -499,14 +501,17 @@ EventStatus AffineSystem<T>::CalcDiscreteUpdate(
 
   const auto& x = context.get_discrete_state(0).get_value();
 
-  VectorX<T> xnext = A_ * x + f0_;
+  // Compute directly into the updates so that no temporaries are needed; the
+  // updates never alias the state in the context.
+  auto xnext = updates->get_mutable_value();
+  xnext = f0_;
+  xnext.noalias() += A_ * x;
 
   if (this->num_inputs() > 0) {
     const auto& u = this->get_input_port().Eval(context);
 
-    xnext += B_ * u;
+    xnext.noalias() += B_ * u;
   }
-  updates->set_value(xnext);
   return EventStatus::Succeeded();
 }
 
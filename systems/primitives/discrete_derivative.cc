@@ -85,13 +85,25 @@ void DiscreteDerivative<T>::CalcOutput(
   const auto& x1 = context.get_discrete_state(1).get_value();
 
   // y(t) = (x₀[n]-x₁[n])/h
-  const auto& derivative = ((x0 - x1) / time_step_).eval();
-  if (!suppress_initial_transient_) {
-    output_vector->SetFromVector(derivative);
+  if constexpr (scalar_predicate<T>::is_bool) {
+    // When the predicate is a plain bool we can branch directly and write
+    // into the output without any temporaries.
+    auto y = output_vector->get_mutable_value();
+    if (suppress_initial_transient_ &&
+        !(context.get_discrete_state(2)[0] >= 2.0)) {
+      y.setZero();
+    } else {
+      y = (x0 - x1) / time_step_;
+    }
   } else {
-    const boolean<T> is_active = (context.get_discrete_state(2)[0] >= 2.0);
-    output_vector->SetFromVector(
-        if_then_else(is_active, derivative, VectorX<T>::Zero(n_).eval()));
+    const auto& derivative = ((x0 - x1) / time_step_).eval();
+    if (!suppress_initial_transient_) {
+      output_vector->SetFromVector(derivative);
+    } else {
+      const boolean<T> is_active = (context.get_discrete_state(2)[0] >= 2.0);
+      output_vector->SetFromVector(
+          if_then_else(is_active, derivative, VectorX<T>::Zero(n_).eval()));
+    }
   }
 }
 
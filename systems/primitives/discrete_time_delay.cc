@@ -35,7 +35,7 @@ DiscreteTimeDelay<T>::DiscreteTimeDelay(
     // TODO(mpetersen94): Remove value parameter from the constructor once
     // the equivalent of #3109 for abstract values is also resolved.
     this->DeclareAbstractInputPort("u", *abstract_model_value_);
-    this->DeclareAbstractOutputPort(
+    auto& output_port = this->DeclareAbstractOutputPort(
         "delayed_u",
         [this]() {
           return abstract_model_value_->Clone();
@@ -44,6 +44,13 @@ DiscreteTimeDelay<T>::DiscreteTimeDelay(
           this->CopyDelayedAbstractValue(context, out);
         },
         {this->xa_ticket()});
+    // Evaluating the output refers directly to the oldest buffered value.
+    this->AliasOutputPort(
+        &output_port,
+        [this](const Context<T>& context) -> const AbstractValue& {
+          return this->GetDelayedAbstractValue(context);
+        },
+        this->xa_ticket());
     for (int ii = 0; ii < delay_buffer_size_; ++ii) {
       this->DeclareAbstractState(*abstract_model_value_);
     }
@@ -90,14 +97,18 @@ void DiscreteTimeDelay<T>::SaveInputVectorToBuffer(
 }
 
 template <typename T>
-void DiscreteTimeDelay<T>::CopyDelayedAbstractValue(
-    const Context<T>& context, AbstractValue* output) const {
+const AbstractValue& DiscreteTimeDelay<T>::GetDelayedAbstractValue(
+    const Context<T>& context) const {
   DRAKE_ASSERT(is_abstract());
   const int& oldest_index =
       context.template get_abstract_state<int>(delay_buffer_size_);
-  const AbstractValue& state_value =
-      context.get_abstract_state().get_value(oldest_index);
-  output->SetFrom(state_value);
+  return context.get_abstract_state().get_value(oldest_index);
+}
+
+template <typename T>
+void DiscreteTimeDelay<T>::CopyDelayedAbstractValue(
+    const Context<T>& context, AbstractValue* output) const {
+  output->SetFrom(GetDelayedAbstractValue(context));
 }
 
 template <typename T>
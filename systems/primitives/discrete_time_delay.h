@@ -102,6 +102,10 @@ class DiscreteTimeDelay final : public LeafSystem<T> {
   void SaveInputVectorToBuffer(const Context<T>& context,
                                DiscreteValues<T>* discrete_state) const;
 
+  // Returns the properly delayed abstract value, which is the aliased value of
+  // the output port.
+  const AbstractValue& GetDelayedAbstractValue(const Context<T>& context) const;
+
   // Sets the output port value to the properly delayed abstract value.
   void CopyDelayedAbstractValue(const Context<T>& context,
                                 AbstractValue* output) const;
@@ -1,6 +1,7 @@
 #include "drake/systems/primitives/linear_system.h"
 
 #include <string>
+#include <tuple>
 #include <utility>
 
 #include <Eigen/Dense>
@@ -252,6 +253,139 @@ std::unique_ptr<AffineSystem<double>> FirstOrderTaylorApproximation(
                                          std::move(output_port_index));
 }
 
+FirstOrderTaylorApproximator::FirstOrderTaylorApproximator(
+    const System<double>& system,
+    std::variant<InputPortSelection, InputPortIndex> input_port_index,
+    std::variant<OutputPortSelection, OutputPortIndex> output_port_index)
+    : system_(system),
+      autodiff_system_(System<double>::ToAutoDiffXd(system)),
+      autodiff_context_(autodiff_system_->CreateDefaultContext()) {
+  const bool is_discrete_system =
+      system.IsDifferenceEquationSystem(&time_period_);
+  DRAKE_THROW_UNLESS(autodiff_context_->is_stateless() ||
+                     autodiff_context_->has_only_continuous_state() ||
+                     is_discrete_system);
+
+  input_port_ = autodiff_system_->get_input_port_selection(input_port_index);
+  output_port_ = autodiff_system_->get_output_port_selection(output_port_index);
+  if (input_port_ &&
+      input_port_->get_data_type() == PortDataType::kAbstractValued) {
+    throw std::logic_error(
+        "The specified input port is abstract-valued, but "
+        "FirstOrderTaylorApproximator only supports vector-valued input "
+        "ports.  Did you perhaps forget to pass a non-default "
+        "`input_port_index` argument?");
+  }
+
+  const int num_states =
+      autodiff_context_->is_stateless()
+          ? 0
+          : (autodiff_context_->has_only_continuous_state()
+                 ? autodiff_context_->num_continuous_states()
+                 : autodiff_context_->get_discrete_state(0).size());
+  const int num_inputs = input_port_ ? input_port_->size() : 0;
+  std::tie(x_, u_) = math::InitializeAutoDiffTuple(
+      Eigen::VectorXd::Zero(num_states), Eigen::VectorXd::Zero(num_inputs));
+  if (input_port_) {
+    fixed_input_ = &input_port_->FixValue(autodiff_context_.get(), u_);
+  }
+  if (autodiff_context_->has_only_continuous_state()) {
+    xdot_ = autodiff_system_->AllocateTimeDerivatives();
+  }
+}
+
+FirstOrderTaylorApproximator::~FirstOrderTaylorApproximator() = default;
+
+void FirstOrderTaylorApproximator::Calc(const Context<double>& context) {
+  system_.ValidateContext(context);
+  autodiff_context_->SetTimeStateAndParametersFrom(context);
+
+  // Copy the values of the other inputs, in place when they are vectors that
+  // were already fixed by a previous call.
+  for (InputPortIndex i{0}; i < system_.num_input_ports(); ++i) {
+    if (input_port_ && i == input_port_->get_index()) continue;
+    const InputPort<double>& port = system_.get_input_port(i);
+    if (!port.HasValue(context)) continue;
+    const InputPort<AutoDiffXd>& autodiff_port =
+        autodiff_system_->get_input_port(i);
+    if (port.get_data_type() == kAbstractValued) {
+      autodiff_port.FixValue(autodiff_context_.get(),
+                             port.Eval<AbstractValue>(context));
+      continue;
+    }
+    const VectorX<AutoDiffXd> value = port.Eval(context).cast<AutoDiffXd>();
+    FixedInputPortValue* fixed =
+        autodiff_context_->MaybeGetMutableFixedInputPortValue(i);
+    if (fixed != nullptr) {
+      fixed->GetMutableVectorData<AutoDiffXd>()->SetFromVector(value);
+    } else {
+      auto vector = autodiff_system_->AllocateInputVector(autodiff_port);
+      vector->SetFromVector(value);
+      autodiff_port.FixValue(autodiff_context_.get(), *vector);
+    }
+  }
+
+  // Only the values of the seeded state and input change; their gradients
+  // stay the identity.
+  const int num_states = x_.size();
+  const int num_inputs = u_.size();
+  const Eigen::VectorXd x0 =
+      context.is_stateless()
+          ? Eigen::VectorXd::Zero(0)
+          : ((context.has_only_continuous_state())
+                 ? context.get_continuous_state_vector().CopyToVector()
+                 : context.get_discrete_state(0).get_value());
+  for (int i = 0; i < num_states; ++i) {
+    x_[i].value() = x0[i];
+  }
+  Eigen::VectorXd u0 = Eigen::VectorXd::Zero(num_inputs);
+  if (input_port_) {
+    u0 = system_.get_input_port(input_port_->get_index()).Eval(context);
+    for (int i = 0; i < num_inputs; ++i) {
+      u_[i].value() = u0[i];
+    }
+    fixed_input_->GetMutableVectorData<AutoDiffXd>()->SetFromVector(u_);
+  }
+
+  const int num_derivatives = num_states + num_inputs;
+  if (num_states > 0) {
+    VectorX<AutoDiffXd> next;
+    if (xdot_ != nullptr) {
+      autodiff_context_->get_mutable_continuous_state_vector().SetFromVector(
+          x_);
+      autodiff_system_->CalcTimeDerivatives(*autodiff_context_, xdot_.get());
+      next = xdot_->CopyToVector();
+    } else {
+      autodiff_context_->get_mutable_discrete_state()
+          .get_mutable_vector()
+          .SetFromVector(x_);
+      next = autodiff_system_
+                 ->EvalUniquePeriodicDiscreteUpdate(*autodiff_context_)
+                 .get_value();
+    }
+    const Eigen::MatrixXd AB = math::ExtractGradient(next, num_derivatives);
+    A_ = AB.leftCols(num_states);
+    B_ = AB.rightCols(num_inputs);
+    f0_ = math::ExtractValue(next) - A_ * x0 - B_ * u0;
+  } else {
+    A_ = Eigen::MatrixXd(0, 0);
+    B_ = Eigen::MatrixXd(0, num_inputs);
+    f0_ = Eigen::VectorXd(0);
+  }
+
+  if (output_port_) {
+    const VectorX<AutoDiffXd>& y = output_port_->Eval(*autodiff_context_);
+    const Eigen::MatrixXd CD = math::ExtractGradient(y, num_derivatives);
+    C_ = CD.leftCols(num_states);
+    D_ = CD.rightCols(num_inputs);
+    y0_ = math::ExtractValue(y) - C_ * x0 - D_ * u0;
+  } else {
+    C_ = Eigen::MatrixXd(0, num_states);
+    D_ = Eigen::MatrixXd(0, num_inputs);
+    y0_ = Eigen::VectorXd(0);
+  }
+}
+
 Eigen::MatrixXd ControllabilityMatrix(const LinearSystem<double>& sys) {
   return internal::ControllabilityMatrix(sys.A(), sys.B());
 }
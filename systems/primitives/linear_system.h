@@ -257,6 +257,87 @@ std::unique_ptr<AffineSystem<double>> FirstOrderTaylorApproximation(
     std::variant<OutputPortSelection, OutputPortIndex> output_port_index =
         OutputPortSelection::kUseFirstOutputIfItExists);
 
+/// Computes the same first-order Taylor approximation of a @p system as
+/// FirstOrderTaylorApproximation(), repeatedly, around a sequence of operating
+/// points; e.g., once per step of an extended Kalman filter or of a
+/// fixed-lag smoother.
+///
+/// FirstOrderTaylorApproximation() converts the system to AutoDiffXd,
+/// allocates an AutoDiffXd context, and builds a new AffineSystem every time
+/// it is called. This class does the conversion and allocations once, when it
+/// is constructed. The AutoDiffXd state and input are seeded with their
+/// derivatives once as well; each call to Calc() only copies the values of the
+/// operating point into them, and stores the resulting coefficients in this
+/// object.
+///
+/// The same restrictions on the ports of the @p system apply as for
+/// FirstOrderTaylorApproximation(). Vector-valued input ports other than the
+/// selected one are treated as constants, fixed at their value in the context
+/// passed to Calc().
+///
+/// @ingroup primitive_systems
+class FirstOrderTaylorApproximator {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(FirstOrderTaylorApproximator)
+
+  /// Constructs an approximator of @p system, which is aliased and must
+  /// outlive this object.
+  /// @param input_port_index A valid input port index for @p system or
+  /// InputPortSelection. @default kUseFirstInputIfItExists.
+  /// @param output_port_index A valid output port index for @p system or
+  /// OutputPortSelection. @default kUseFirstOutputIfItExists.
+  /// @throws std::exception if @p system does not support scalar conversion to
+  /// AutoDiffXd, if the selected input port is abstract-valued, or if the
+  /// system is not (only) continuous or (only) discrete time with a single
+  /// periodic update.
+  explicit FirstOrderTaylorApproximator(
+      const System<double>& system,
+      std::variant<InputPortSelection, InputPortIndex> input_port_index =
+          InputPortSelection::kUseFirstInputIfItExists,
+      std::variant<OutputPortSelection, OutputPortIndex> output_port_index =
+          OutputPortSelection::kUseFirstOutputIfItExists);
+
+  ~FirstOrderTaylorApproximator();
+
+  /// Computes the coefficients of the approximation around the operating point
+  /// defined by @p context, with the same meaning as those of the AffineSystem
+  /// returned by FirstOrderTaylorApproximation().
+  /// @throws std::exception if @p context does not belong to the system, or if
+  /// any vector-valued inputs are unconnected.
+  void Calc(const Context<double>& context);
+
+  /// @name Accessors for the coefficients computed by the last call to Calc().
+  /// They are empty until Calc() is first called.
+  //@{
+  const Eigen::MatrixXd& A() const { return A_; }
+  const Eigen::MatrixXd& B() const { return B_; }
+  const Eigen::VectorXd& f0() const { return f0_; }
+  const Eigen::MatrixXd& C() const { return C_; }
+  const Eigen::MatrixXd& D() const { return D_; }
+  const Eigen::VectorXd& y0() const { return y0_; }
+  //@}
+
+  /// Returns the period of the discrete update of the system, or zero if the
+  /// system is continuous (or stateless).
+  double time_period() const { return time_period_; }
+
+ private:
+  const System<double>& system_;
+  std::unique_ptr<System<AutoDiffXd>> autodiff_system_;
+  std::unique_ptr<Context<AutoDiffXd>> autodiff_context_;
+  const InputPort<AutoDiffXd>* input_port_{};
+  const OutputPort<AutoDiffXd>* output_port_{};
+  // The fixed value of the selected input port in autodiff_context_.
+  FixedInputPortValue* fixed_input_{};
+  double time_period_{0.0};
+  // The state and input, whose gradients are seeded with respect to [x; u].
+  VectorX<AutoDiffXd> x_;
+  VectorX<AutoDiffXd> u_;
+  std::unique_ptr<ContinuousState<AutoDiffXd>> xdot_;
+  Eigen::MatrixXd A_, B_, C_, D_;
+  Eigen::VectorXd f0_, y0_;
+};
+
 /// Returns the controllability matrix:  R = [B, AB, ..., A^{n-1}B].
 /// @ingroup control_systems
 Eigen::MatrixXd ControllabilityMatrix(const LinearSystem<double>& sys);
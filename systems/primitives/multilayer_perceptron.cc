@@ -15,11 +15,9 @@ namespace internal {
 
 template <typename T>
 struct CalcLayersData {
-  explicit CalcLayersData(int n) : Wx(n), Wx_plus_b(n), Xn(n) {}
+  explicit CalcLayersData(int n) : Xn(n) {}
 
   MatrixX<T> input_features;
-  std::vector<VectorX<T>> Wx;
-  std::vector<VectorX<T>> Wx_plus_b;
   std::vector<VectorX<T>> Xn;
 };
 
@@ -43,53 +41,45 @@ const std::vector<int>& RejectEmpty(const std::vector<int>& arg) {
   return arg;
 }
 
+// The Xn are the layer outputs; each one also serves as the storage for the
+// layer's pre-activation values Wx+b, which are overwritten by the activation.
 template <typename T>
 struct BackPropData {
   explicit BackPropData(int n)
-      : Wx(n),
-        Wx_plus_b(n),
-        Xn(n),
-        dXn_dWx_plus_b(n),
-        dloss_dXn(n),
-        dloss_dWx_plus_b(n),
-        dloss_dW(n),
-        dloss_db(n) {}
-
-  std::vector<MatrixX<T>> Wx;
-  std::vector<MatrixX<T>> Wx_plus_b;
+      : Xn(n), dXn_dWx_plus_b(n), dloss_dXn(n), dloss_dWx_plus_b(n) {}
+
   std::vector<MatrixX<T>> Xn;
   std::vector<MatrixX<T>> dXn_dWx_plus_b;
   std::vector<MatrixX<T>> dloss_dXn;
   std::vector<MatrixX<T>> dloss_dWx_plus_b;
-  std::vector<MatrixX<T>> dloss_dW;
-  std::vector<VectorX<T>> dloss_db;
   MatrixX<T> input_features;
   MatrixX<T> dloss_dinput_features;
 };
 
+// Overwrites the pre-activation values `X` with the activation values Y = σ(X).
+// If `dYdX` is not null, it is set to the derivatives, which are computed from
+// Y (to avoid evaluating the activation function twice).
 template <typename T, int cols>
-void Activation(
-    PerceptronActivationType type,
-    const Eigen::Ref<const Eigen::Matrix<T, Eigen::Dynamic, cols>>& X,
-    Eigen::Matrix<T, Eigen::Dynamic, cols>* Y,
-    Eigen::Matrix<T, Eigen::Dynamic, cols>* dYdX = nullptr) {
-  Y->resize(X.rows(), X.cols());
+void ApplyActivation(PerceptronActivationType type,
+                     Eigen::Matrix<T, Eigen::Dynamic, cols>* X,
+                     Eigen::Matrix<T, Eigen::Dynamic, cols>* dYdX = nullptr) {
+  const Eigen::Matrix<T, Eigen::Dynamic, cols>& Y = *X;
   if (dYdX) {
-    dYdX->resize(X.rows(), X.cols());
+    dYdX->resize(X->rows(), X->cols());
   }
   if (type == kTanh) {
-    *Y = X.array().tanh().matrix();
+    X->array() = X->array().tanh();
     if (dYdX) {
-      dYdX->noalias() = (1.0 - X.array().tanh().square()).matrix();
+      dYdX->noalias() = (1.0 - Y.array().square()).matrix();
     }
   } else if (type == kReLU) {
-    *Y = X.array().max(0.0).matrix();
+    X->array() = X->array().max(0.0);
     if (dYdX) {
-      dYdX->noalias() = (X.array() <= 0).select(0 * X, 1);
+      // Y ≤ 0 exactly when X ≤ 0.
+      dYdX->noalias() = (Y.array() <= 0).select(0 * Y, 1);
     }
   } else {
     DRAKE_DEMAND(type == kIdentity);
-    *Y = X;
     if (dYdX) {
       dYdX->setConstant(1.0);
     }
@@ -145,8 +135,8 @@ MultilayerPerceptron<T>::MultilayerPerceptron(
                                 &MultilayerPerceptron<T>::CalcOutput);
 
   num_parameters_ = 0;
-  weight_indices_.reserve(num_weights_);
-  bias_indices_.reserve(num_weights_);
+  weight_indices_.resize(num_weights_);
+  bias_indices_.resize(num_weights_);
   for (int i = 0; i < num_weights_; ++i) {
     weight_indices_[i] = num_parameters_;
     num_parameters_ += layers_[i + 1] * layers_[i];
@@ -159,8 +149,6 @@ MultilayerPerceptron<T>::MultilayerPerceptron(
   // Declare cache entry for CalcOutput.
   internal::CalcLayersData<T> calc_layers_data(num_weights_);
   for (int i = 0; i < num_weights_; ++i) {
-    calc_layers_data.Wx[i] = VectorX<T>::Zero(layers_[i + 1]);
-    calc_layers_data.Wx_plus_b[i] = VectorX<T>::Zero(layers_[i + 1]);
     calc_layers_data.Xn[i] = VectorX<T>::Zero(layers_[i + 1]);
   }
   calc_layers_cache_ = &this->DeclareCacheEntry(
@@ -312,18 +300,18 @@ T MultilayerPerceptron<T>::Backpropagation(
   // Forward pass:
   if (has_input_features_) {
     CalcInputFeatures(X, &data.input_features);
-    data.Wx[0].noalias() = GetWeights(context, 0) * data.input_features;
+    data.Xn[0].noalias() = GetWeights(context, 0) * data.input_features;
   } else {
-    data.Wx[0].noalias() = GetWeights(context, 0) * X;
+    data.Xn[0].noalias() = GetWeights(context, 0) * X;
   }
-  data.Wx_plus_b[0].noalias() = data.Wx[0].colwise() + GetBiases(context, 0);
-  Activation<T, Eigen::Dynamic>(activation_types_[0], data.Wx_plus_b[0],
-                                &data.Xn[0], &data.dXn_dWx_plus_b[0]);
+  data.Xn[0].colwise() += GetBiases(context, 0);
+  ApplyActivation<T, Eigen::Dynamic>(activation_types_[0], &data.Xn[0],
+                                     &data.dXn_dWx_plus_b[0]);
   for (int i = 1; i < num_weights_; ++i) {
-    data.Wx[i].noalias() = GetWeights(context, i) * data.Xn[i - 1];
-    data.Wx_plus_b[i].noalias() = data.Wx[i].colwise() + GetBiases(context, i);
-    Activation<T, Eigen::Dynamic>(activation_types_[i], data.Wx_plus_b[i],
-                                  &data.Xn[i], &data.dXn_dWx_plus_b[i]);
+    data.Xn[i].noalias() = GetWeights(context, i) * data.Xn[i - 1];
+    data.Xn[i].colwise() += GetBiases(context, i);
+    ApplyActivation<T, Eigen::Dynamic>(activation_types_[i], &data.Xn[i],
+                                       &data.dXn_dWx_plus_b[i]);
   }
   data.dloss_dXn[num_weights_ - 1].resize(layers_[num_weights_], X.cols());
   data.dloss_dXn[num_weights_ - 1].setConstant(
@@ -334,23 +322,21 @@ T MultilayerPerceptron<T>::Backpropagation(
   for (int i = num_weights_ - 1; i >= 0; --i) {
     data.dloss_dWx_plus_b[i] =
         (data.dloss_dXn[i].array() * data.dXn_dWx_plus_b[i].array()).matrix();
-    data.dloss_dW[i].resize(layers_[i + 1], layers_[i]);
-    data.dloss_dW[i].setZero();
-    for (int j = 0; j < X.cols(); ++j) {
-      if (i > 0) {
-        data.dloss_dW[i].noalias() +=
-            data.dloss_dWx_plus_b[i].col(j) * data.Xn[i - 1].col(j).transpose();
-      } else if (has_input_features_) {
-        data.dloss_dW[i].noalias() += data.dloss_dWx_plus_b[i].col(j) *
-                                      data.input_features.col(j).transpose();
-      } else {
-        data.dloss_dW[i].noalias() +=
-            data.dloss_dWx_plus_b[i].col(j) * X.col(j).transpose();
-      }
+    // The gradients are summed over the batch by a single matrix product,
+    // written directly into dloss_dparams.
+    Eigen::Map<MatrixX<T>> dloss_dW(dloss_dparams->data() + weight_indices_[i],
+                                    layers_[i + 1], layers_[i]);
+    if (i > 0) {
+      dloss_dW.noalias() =
+          data.dloss_dWx_plus_b[i] * data.Xn[i - 1].transpose();
+    } else if (has_input_features_) {
+      dloss_dW.noalias() =
+          data.dloss_dWx_plus_b[i] * data.input_features.transpose();
+    } else {
+      dloss_dW.noalias() = data.dloss_dWx_plus_b[i] * X.transpose();
     }
-    SetWeights(dloss_dparams, i, data.dloss_dW[i]);
-    data.dloss_db[i] = data.dloss_dWx_plus_b[i].rowwise().sum();
-    SetBiases(dloss_dparams, i, data.dloss_db[i]);
+    dloss_dparams->segment(bias_indices_[i], layers_[i + 1]) =
+        data.dloss_dWx_plus_b[i].rowwise().sum();
     if (i > 0) {
       data.dloss_dXn[i - 1].noalias() =
           GetWeights(context, i).transpose() * data.dloss_dWx_plus_b[i];
@@ -398,19 +384,19 @@ void MultilayerPerceptron<T>::BatchOutput(const Context<T>& context,
   // Forward pass:
   if (has_input_features_) {
     CalcInputFeatures(X, &data.input_features);
-    data.Wx[0].noalias() = GetWeights(context, 0) * data.input_features;
+    data.Xn[0].noalias() = GetWeights(context, 0) * data.input_features;
   } else {
-    data.Wx[0].noalias() = GetWeights(context, 0) * X;
+    data.Xn[0].noalias() = GetWeights(context, 0) * X;
   }
-  data.Wx_plus_b[0].noalias() = data.Wx[0].colwise() + GetBiases(context, 0);
-  Activation<T, Eigen::Dynamic>(activation_types_[0], data.Wx_plus_b[0],
-                                &data.Xn[0],
-                                gradients ? &data.dXn_dWx_plus_b[0] : nullptr);
+  data.Xn[0].colwise() += GetBiases(context, 0);
+  ApplyActivation<T, Eigen::Dynamic>(
+      activation_types_[0], &data.Xn[0],
+      gradients ? &data.dXn_dWx_plus_b[0] : nullptr);
   for (int i = 1; i < num_weights_; ++i) {
-    data.Wx[i].noalias() = GetWeights(context, i) * data.Xn[i - 1];
-    data.Wx_plus_b[i].noalias() = data.Wx[i].colwise() + GetBiases(context, i);
-    Activation<T, Eigen::Dynamic>(
-        activation_types_[i], data.Wx_plus_b[i], &data.Xn[i],
+    data.Xn[i].noalias() = GetWeights(context, i) * data.Xn[i - 1];
+    data.Xn[i].colwise() += GetBiases(context, i);
+    ApplyActivation<T, Eigen::Dynamic>(
+        activation_types_[i], &data.Xn[i],
         gradients ? &data.dXn_dWx_plus_b[i] : nullptr);
   }
   *Y = data.Xn[num_weights_ - 1];
@@ -465,18 +451,17 @@ void MultilayerPerceptron<T>::CalcLayers(
   if (has_input_features_) {
     CalcInputFeatures(this->get_input_port().Eval(context),
                       &data->input_features);
-    data->Wx[0].noalias() = GetWeights(context, 0) * data->input_features;
+    data->Xn[0].noalias() = GetWeights(context, 0) * data->input_features;
   } else {
-    data->Wx[0].noalias() =
+    data->Xn[0].noalias() =
         GetWeights(context, 0) * this->get_input_port().Eval(context);
   }
-  data->Wx_plus_b[0].noalias() = data->Wx[0].colwise() + GetBiases(context, 0);
-  Activation<T, 1>(activation_types_[0], data->Wx_plus_b[0], &(data->Xn[0]));
+  data->Xn[0] += GetBiases(context, 0);
+  ApplyActivation<T, 1>(activation_types_[0], &(data->Xn[0]));
   for (int i = 1; i < num_weights_; ++i) {
-    data->Wx[i].noalias() = GetWeights(context, i) * data->Xn[i - 1];
-    data->Wx_plus_b[i].noalias() =
-        data->Wx[i].colwise() + GetBiases(context, i);
-    Activation<T, 1>(activation_types_[i], data->Wx_plus_b[i], &(data->Xn[i]));
+    data->Xn[i].noalias() = GetWeights(context, i) * data->Xn[i - 1];
+    data->Xn[i] += GetBiases(context, i);
+    ApplyActivation<T, 1>(activation_types_[i], &(data->Xn[i]));
   }
 }
 
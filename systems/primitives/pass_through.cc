@@ -15,21 +15,35 @@ PassThrough<T>::PassThrough(
   if (!is_abstract()) {
     input_port_ =
         &this->DeclareVectorInputPort("u", BasicVector<T>(model_vector));
-    this->DeclareVectorOutputPort("y", BasicVector<T>(model_vector),
-                                  &PassThrough::DoCalcVectorOutput,
-                                  {this->all_input_ports_ticket()});
+    default_output_ =
+        std::make_unique<Value<BasicVector<T>>>(BasicVector<T>(model_vector));
+    auto& output_port = this->DeclareVectorOutputPort(
+        "y", BasicVector<T>(model_vector), &PassThrough::DoCalcVectorOutput,
+        {this->all_input_ports_ticket()});
+    this->AliasOutputPort(
+        &output_port,
+        [this](const Context<T>& context) -> const AbstractValue& {
+          return EvalInputOrDefault(context);
+        },
+        input_port_->ticket());
   } else {
     DRAKE_DEMAND(model_vector.size() == 0);
     input_port_ = &this->DeclareAbstractInputPort("u", *abstract_model_value_);
 
     namespace sp = std::placeholders;
-    this->DeclareAbstractOutputPort(
+    auto& output_port = this->DeclareAbstractOutputPort(
         "y",
         [this]() {
           return abstract_model_value_->Clone();
         },
         std::bind(&PassThrough::DoCalcAbstractOutput, this, sp::_1, sp::_2),
         {this->all_input_ports_ticket()});
+    this->AliasOutputPort(
+        &output_port,
+        [this](const Context<T>& context) -> const AbstractValue& {
+          return EvalInputOrDefault(context);
+        },
+        input_port_->ticket());
   }
 }
 
@@ -40,6 +54,17 @@ PassThrough<T>::PassThrough(const PassThrough<U>& other)
                   other.is_abstract() ? other.abstract_model_value_->Clone()
                                       : nullptr) {}
 
+template <typename T>
+const AbstractValue& PassThrough<T>::EvalInputOrDefault(
+    const Context<T>& context) const {
+  const AbstractValue* const input =
+      this->EvalAbstractInput(context, input_port_->get_index());
+  if (input != nullptr) {
+    return *input;
+  }
+  return is_abstract() ? *abstract_model_value_ : *default_output_;
+}
+
 template <typename T>
 void PassThrough<T>::DoCalcVectorOutput(const Context<T>& context,
                                         BasicVector<T>* output) const {
@@ -12,7 +12,9 @@ namespace systems {
 /// A pass through system with input `u` and output `y = u`. This is
 /// mathematically equivalent to a Gain system with its gain equal to one.
 /// However this system incurs no computational cost. The input to this system
-/// directly feeds through to its output.
+/// directly feeds through to its output. Evaluating the output port returns a
+/// reference to the input value itself (see LeafSystem::AliasOutputPort()), so
+/// even large abstract values are not copied.
 ///
 /// The system can also be used to provide default values for a port in any
 /// diagram.  If the input port does not have a value, then the default value
@@ -94,11 +96,19 @@ class PassThrough final : public LeafSystem<T> {
   void DoCalcAbstractOutput(const Context<T>& context,
                             AbstractValue* output) const;
 
+  // Returns the input port value, or the model value when the input port is
+  // not connected. This is the aliased value of the output port.
+  const AbstractValue& EvalInputOrDefault(const Context<T>& context) const;
+
   bool is_abstract() const { return abstract_model_value_ != nullptr; }
 
   const Eigen::VectorXd model_vector_;
   const std::unique_ptr<const AbstractValue> abstract_model_value_;
 
+  // For vector-valued ports, the model vector as the port's value type; this
+  // is the output when no input is connected.
+  std::unique_ptr<const AbstractValue> default_output_;
+
   // We store our port pointer so that DoCalcVectorOutput's access to the
   // input_port_->Eval is inlined (without any port-count bounds checking).
   const InputPort<T>* input_port_{};
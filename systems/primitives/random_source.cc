@@ -1,8 +1,6 @@
 #include "drake/systems/primitives/random_source.h"
 
 #include <atomic>
-#include <random>
-#include <variant>
 
 #include "drake/common/default_scalars.h"
 #include "drake/common/never_destroyed.h"
@@ -13,26 +11,6 @@ namespace {
 
 using Seed = RandomSource<double>::Seed;
 
-// Stores exactly one of the three supported distribution objects.  Note that
-// the distribution objects hold computational state; they are not just pure
-// mathematical functions.
-using DistributionVariant = std::variant<std::uniform_real_distribution<double>,
-                                         std::normal_distribution<double>,
-                                         std::exponential_distribution<double>>;
-
-// Creates a distribution object from the distribution enumeration.
-DistributionVariant MakeDistributionVariant(RandomDistribution which) {
-  switch (which) {
-    case RandomDistribution::kUniform:
-      return std::uniform_real_distribution<double>();
-    case RandomDistribution::kGaussian:
-      return std::normal_distribution<double>();
-    case RandomDistribution::kExponential:
-      return std::exponential_distribution<double>();
-  }
-  DRAKE_UNREACHABLE();
-}
-
 // Generates real-valued (i.e., `double`) samples from some distribution.  This
 // serves as the abstract state of a RandomSource, which encompasses all of the
 // source's state *except* for the currently-sampled output values which are
@@ -43,28 +21,19 @@ class SampleGenerator {
 
   SampleGenerator() = default;
   SampleGenerator(Seed seed, RandomDistribution which)
-      : seed_(seed),
-        generator_(seed),
-        distribution_(MakeDistributionVariant(which)) {}
+      : seed_(seed), generator_(seed), distribution_(which) {}
 
   Seed seed() const { return seed_; }
 
-  double GenerateNext() {
-    switch (distribution_.index()) {
-      case 0:
-        return std::get<0>(distribution_)(generator_);
-      case 1:
-        return std::get<1>(distribution_)(generator_);
-      case 2:
-        return std::get<2>(distribution_)(generator_);
-    }
-    DRAKE_UNREACHABLE();
+  // Overwrites all of `samples` with the next samples, in bulk.
+  void GenerateNext(Eigen::VectorXd* samples) {
+    FillRandomSamples(distribution_, &generator_, samples);
   }
 
  private:
   Seed seed_{RandomGenerator::default_seed};
   RandomGenerator generator_;
-  DistributionVariant distribution_;
+  RandomDistribution distribution_{RandomDistribution::kUniform};
 };
 
 // Returns a monotonically increasing integer on each call.
@@ -136,8 +105,10 @@ template <typename T>
 void RandomSource<T>::UpdateSamples(const Context<T>&, State<T>* state) const {
   auto& source = state->template get_mutable_abstract_state<SampleGenerator>(0);
   auto& samples = state->get_mutable_discrete_state(0);
+  Eigen::VectorXd values(samples.size());
+  source.GenerateNext(&values);
   for (int i = 0; i < samples.size(); ++i) {
-    samples[i] = T(source.GenerateNext());
+    samples[i] = T(values[i]);
   }
 }
 
@@ -60,8 +60,10 @@ Saturation<T>::Saturation(const VectorX<T>& min_value,
 template <typename T>
 void Saturation<T>::CalcSaturatedOutput(const Context<T>& context,
                                         BasicVector<T>* output_vector) const {
-  // Initializes on the default values.
-  VectorX<T> u_min = min_value_, u_max = max_value_;
+  // Initializes on the default values. We refer to (rather than copy) the
+  // limits so that no heap allocation is needed here.
+  const VectorX<T>* u_min = &min_value_;
+  const VectorX<T>* u_max = &max_value_;
 
   // Extracts the min and/or max values if they are present in the input ports.
   if (min_max_ports_enabled_) {
@@ -72,13 +74,13 @@ void Saturation<T>::CalcSaturatedOutput(const Context<T>& context,
     DRAKE_THROW_UNLESS(has_min || has_max);
 
     if (has_min) {
-      u_min = get_min_value_port().Eval(context);
+      u_min = &get_min_value_port().Eval(context);
     }
     if (has_max) {
-      u_max = get_max_value_port().Eval(context);
+      u_max = &get_max_value_port().Eval(context);
     }
   }
-  DRAKE_THROW_UNLESS((u_min.array() <= u_max.array()).all());
+  DRAKE_THROW_UNLESS((u_min->array() <= u_max->array()).all());
 
   // Evaluates the input port.
   const auto& u = get_input_port().Eval(context);
@@ -87,9 +89,9 @@ void Saturation<T>::CalcSaturatedOutput(const Context<T>& context,
   auto y = output_vector->get_mutable_value();
 
   // Loop through and set the saturation values.
-  for (int i = 0; i < u_min.size(); ++i) {
+  for (int i = 0; i < u_min->size(); ++i) {
     using std::clamp;
-    y[i] = clamp(u[i], u_min[i], u_max[i]);
+    y[i] = clamp(u[i], (*u_min)[i], (*u_max)[i]);
   }
 }
 
@@ -0,0 +1,268 @@
+#include "drake/systems/primitives/sparse_affine_system.h"
+
+#include <cstdint>
+#include <initializer_list>
+#include <set>
+#include <type_traits>
+#include <utility>
+
+#include "drake/common/default_scalars.h"
+#include "drake/common/drake_assert.h"
+#include "drake/common/parallel_for.h"
+#include "drake/systems/framework/basic_vector.h"
+
+namespace drake {
+namespace systems {
+
+namespace {
+
+using SparseMatrixXd = Eigen::SparseMatrix<double, Eigen::RowMajor>;
+
+// Returns the size implied by the first non-empty argument, demanding that all
+// of the non-empty arguments agree.
+int CalcDimension(std::initializer_list<int> sizes_or_zero) {
+  int result = 0;
+  for (const int size : sizes_or_zero) {
+    if (size == 0) continue;
+    if (result == 0) {
+      result = size;
+    } else {
+      DRAKE_DEMAND(size == result);
+    }
+  }
+  return result;
+}
+
+// Returns `M` in row-major storage with explicit zeros removed, or an all-zero
+// matrix of the given size when `M` is empty.
+SparseMatrixXd MakeCoefficient(const Eigen::SparseMatrix<double>& M, int rows,
+                               int cols) {
+  if (M.size() == 0) {
+    return SparseMatrixXd(rows, cols);
+  }
+  DRAKE_DEMAND(M.rows() == rows && M.cols() == cols);
+  SparseMatrixXd result(M);
+  result.prune(0.0);
+  result.makeCompressed();
+  return result;
+}
+
+// Computes y += M * v one row at a time, dividing the rows into one contiguous
+// range for each of `num_threads` threads. The scalar type of `v` and `y` may
+// differ from the (double) coefficients of M.
+template <typename T, typename VDerived, typename YDerived>
+void AddSparseProduct(const SparseMatrixXd& M,
+                      const Eigen::MatrixBase<VDerived>& v, int num_threads,
+                      Eigen::MatrixBase<YDerived>* y) {
+  DRAKE_ASSERT(M.cols() == v.size() && M.rows() == y->size());
+  const int num_rows = M.outerSize();
+  auto add_rows = [&](int chunk) {
+    const int begin = static_cast<int64_t>(num_rows) * chunk / num_threads;
+    const int end = static_cast<int64_t>(num_rows) * (chunk + 1) / num_threads;
+    for (int row = begin; row < end; ++row) {
+      T sum(0.0);
+      for (SparseMatrixXd::InnerIterator it(M, row); it; ++it) {
+        sum += it.value() * v(it.index());
+      }
+      (*y)(row) += sum;
+    }
+  };
+  if (num_threads <= 1) {
+    add_rows(0);
+    return;
+  }
+  drake::internal::ParallelFor(Parallelism(num_threads), num_threads, add_rows);
+}
+
+}  // namespace
+
+template <typename T>
+SparseAffineSystem<T>::SparseAffineSystem(
+    const Eigen::SparseMatrix<double>& A, const Eigen::SparseMatrix<double>& B,
+    const Eigen::Ref<const Eigen::VectorXd>& f0,
+    const Eigen::SparseMatrix<double>& C, const Eigen::SparseMatrix<double>& D,
+    const Eigen::Ref<const Eigen::VectorXd>& y0, double time_period)
+    : SparseAffineSystem<T>(SystemTypeTag<SparseAffineSystem>{}, A, B, f0, C,
+                            D, y0, time_period) {}
+
+// Our protected constructor does all of the real work -- everything else
+// delegates to here.
+template <typename T>
+SparseAffineSystem<T>::SparseAffineSystem(
+    SystemScalarConverter converter, const Eigen::SparseMatrix<double>& A,
+    const Eigen::SparseMatrix<double>& B,
+    const Eigen::Ref<const Eigen::VectorXd>& f0,
+    const Eigen::SparseMatrix<double>& C, const Eigen::SparseMatrix<double>& D,
+    const Eigen::Ref<const Eigen::VectorXd>& y0, double time_period)
+    : TimeVaryingAffineSystem<T>(
+          std::move(converter),
+          CalcDimension({static_cast<int>(A.rows()),
+                         static_cast<int>(A.cols()),
+                         static_cast<int>(B.rows()),
+                         static_cast<int>(f0.size()),
+                         static_cast<int>(C.cols())}),
+          CalcDimension(
+              {static_cast<int>(B.cols()), static_cast<int>(D.cols())}),
+          CalcDimension({static_cast<int>(C.rows()),
+                         static_cast<int>(D.rows()),
+                         static_cast<int>(y0.size())}),
+          time_period),
+      A_(MakeCoefficient(A, this->num_states(), this->num_states())),
+      B_(MakeCoefficient(B, this->num_states(), this->num_inputs())),
+      f0_(f0.size() ? f0 : Eigen::VectorXd::Zero(this->num_states())),
+      C_(MakeCoefficient(C, this->num_outputs(), this->num_states())),
+      D_(MakeCoefficient(D, this->num_outputs(), this->num_inputs())),
+      y0_(y0.size() ? y0 : Eigen::VectorXd::Zero(this->num_outputs())) {
+  // As in AffineSystem, the output depends only on state (iff C is nonzero)
+  // and input (iff D is nonzero).
+  if (this->num_outputs() > 0) {
+    const OutputPort<T>& output_port = this->get_output_port();
+    const auto& leaf_port = dynamic_cast<const LeafOutputPort<T>&>(output_port);
+    const CacheIndex cache_index = leaf_port.cache_entry().cache_index();
+    CacheEntry& cache_entry = this->get_mutable_cache_entry(cache_index);
+    std::set<DependencyTicket>& prereqs = cache_entry.mutable_prerequisites();
+    prereqs.clear();
+    if (C_.nonZeros() > 0) {
+      prereqs.insert(this->all_state_ticket());
+    }
+    if (D_.nonZeros() > 0) {
+      prereqs.insert(this->all_input_ports_ticket());
+    }
+  }
+}
+
+template <typename T>
+template <typename U>
+SparseAffineSystem<T>::SparseAffineSystem(const SparseAffineSystem<U>& other)
+    : SparseAffineSystem(other.A(), other.B(), other.f0(), other.C(),
+                         other.D(), other.y0(), other.time_period()) {
+  this->ConfigureDefaultAndRandomStateFrom(other);
+  set_parallelism(other.get_parallelism());
+}
+
+template <typename T>
+MatrixX<T> SparseAffineSystem<T>::A(const T&) const {
+  return Eigen::MatrixXd(A_).template cast<T>();
+}
+
+template <typename T>
+MatrixX<T> SparseAffineSystem<T>::B(const T&) const {
+  return Eigen::MatrixXd(B_).template cast<T>();
+}
+
+template <typename T>
+MatrixX<T> SparseAffineSystem<T>::C(const T&) const {
+  return Eigen::MatrixXd(C_).template cast<T>();
+}
+
+template <typename T>
+MatrixX<T> SparseAffineSystem<T>::D(const T&) const {
+  return Eigen::MatrixXd(D_).template cast<T>();
+}
+
+template <typename T>
+int SparseAffineSystem<T>::num_threads() const {
+  // Only double arithmetic is known to be cheap and thread safe enough to be
+  // worth dividing among threads.
+  if constexpr (std::is_same_v<T, double>) {
+    return parallelism_.num_threads();
+  } else {
+    return 1;
+  }
+}
+
+template <typename T>
+void SparseAffineSystem<T>::CalcOutputY(const Context<T>& context,
+                                        BasicVector<T>* output_vector) const {
+  auto y = output_vector->get_mutable_value();
+  y = y0_.template cast<T>();
+
+  if (C_.nonZeros() > 0) {
+    const auto x =
+        (this->time_period() == 0.0)
+            ? dynamic_cast<const BasicVector<T>&>(
+                  context.get_continuous_state_vector())
+                  .get_value()
+            : context.get_discrete_state().get_vector().get_value();
+    AddSparseProduct<T>(C_, x, num_threads(), &y);
+  }
+
+  if (D_.nonZeros() > 0) {
+    const auto& u = this->get_input_port().Eval(context);
+    AddSparseProduct<T>(D_, u, num_threads(), &y);
+  }
+}
+
+template <typename T>
+void SparseAffineSystem<T>::DoCalcTimeDerivatives(
+    const Context<T>& context, ContinuousState<T>* derivatives) const {
+  if (this->num_states() == 0 || this->time_period() > 0.0) return;
+
+  const auto& x =
+      dynamic_cast<const BasicVector<T>&>(context.get_continuous_state_vector())
+          .get_value();
+
+  VectorX<T> xdot = f0_.template cast<T>();
+  AddSparseProduct<T>(A_, x, num_threads(), &xdot);
+
+  if (this->num_inputs() > 0) {
+    const auto& u = this->get_input_port().Eval(context);
+    AddSparseProduct<T>(B_, u, num_threads(), &xdot);
+  }
+  derivatives->SetFromVector(xdot);
+}
+
+template <typename T>
+EventStatus SparseAffineSystem<T>::CalcDiscreteUpdate(
+    const Context<T>& context, DiscreteValues<T>* updates) const {
+  if (this->num_states() == 0 || this->time_period() == 0.0)
+    return EventStatus::DidNothing();
+
+  const auto& x = context.get_discrete_state(0).get_value();
+
+  // Compute directly into the updates; the updates never alias the state in
+  // the context.
+  auto xnext = updates->get_mutable_value();
+  xnext = f0_.template cast<T>();
+  AddSparseProduct<T>(A_, x, num_threads(), &xnext);
+
+  if (this->num_inputs() > 0) {
+    const auto& u = this->get_input_port().Eval(context);
+    AddSparseProduct<T>(B_, u, num_threads(), &xnext);
+  }
+  return EventStatus::Succeeded();
+}
+
+template <typename T>
+SparseLinearSystem<T>::SparseLinearSystem(
+    const Eigen::SparseMatrix<double>& A, const Eigen::SparseMatrix<double>& B,
+    const Eigen::SparseMatrix<double>& C, const Eigen::SparseMatrix<double>& D,
+    double time_period)
+    : SparseLinearSystem<T>(SystemTypeTag<SparseLinearSystem>{}, A, B, C, D,
+                            time_period) {}
+
+template <typename T>
+template <typename U>
+SparseLinearSystem<T>::SparseLinearSystem(const SparseLinearSystem<U>& other)
+    : SparseLinearSystem<T>(other.A(), other.B(), other.C(), other.D(),
+                            other.time_period()) {
+  this->ConfigureDefaultAndRandomStateFrom(other);
+  this->set_parallelism(other.get_parallelism());
+}
+
+template <typename T>
+SparseLinearSystem<T>::SparseLinearSystem(
+    SystemScalarConverter converter, const Eigen::SparseMatrix<double>& A,
+    const Eigen::SparseMatrix<double>& B, const Eigen::SparseMatrix<double>& C,
+    const Eigen::SparseMatrix<double>& D, double time_period)
+    : SparseAffineSystem<T>(std::move(converter), A, B, Eigen::VectorXd(), C,
+                            D, Eigen::VectorXd(), time_period) {}
+
+}  // namespace systems
+}  // namespace drake
+
+DRAKE_DEFINE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS(
+    class ::drake::systems::SparseAffineSystem)
+
+DRAKE_DEFINE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS(
+    class ::drake::systems::SparseLinearSystem)
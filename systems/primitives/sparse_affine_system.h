@@ -0,0 +1,202 @@
+#pragma once
+
+#include <Eigen/SparseCore>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
+#include "drake/common/parallelism.h"
+#include "drake/systems/primitives/affine_system.h"
+
+namespace drake {
+namespace systems {
+
+/// A discrete OR continuous affine system with constant, sparse coefficient
+/// matrices.
+///
+/// @system
+/// name: SparseAffineSystem
+/// input_ports:
+/// - u0
+/// output_ports:
+/// - y0
+/// @endsystem
+///
+/// This is mathematically identical to AffineSystem, i.e.,
+///   @f[ x(t+h) = A x(t) + B u(t) + f_0 \quad\text{or}\quad
+///       \dot{x} = A x + B u + f_0, @f]
+///   @f[ y = C x + D u + y_0, @f]
+/// but stores `A`, `B`, `C`, and `D` as Eigen::SparseMatrix so that the
+/// per-step cost of the dynamics and output is proportional to the number of
+/// nonzero coefficients rather than to the product of the dimensions. This is
+/// the appropriate choice for large, weakly-coupled models such as discretized
+/// PDEs or lumped thermal networks.
+///
+/// The matrix-vector products can be divided among several threads by calling
+/// set_parallelism(); this only pays off for many thousands of nonzeros. When
+/// simulated with an implicit integrator, enable
+/// ImplicitIntegrator::set_use_jacobian_sparsity() so that the integrator's
+/// Jacobian and its factorization also exploit the sparsity of A.
+///
+/// The TimeVaryingAffineSystem accessors A(t), B(t), etc. return dense copies
+/// and are intended for analysis (e.g., linearization), not for simulation.
+///
+/// @tparam_default_scalar
+/// @ingroup primitive_systems
+///
+/// @see AffineSystem
+/// @see SparseLinearSystem
+template <typename T>
+class SparseAffineSystem : public TimeVaryingAffineSystem<T> {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(SparseAffineSystem)
+
+  /// The storage used for the coefficient matrices. Row-major storage lets
+  /// each output row be computed independently.
+  using SparseMatrix = Eigen::SparseMatrix<double, Eigen::RowMajor>;
+
+  /// Constructs a %SparseAffineSystem with the given coefficients. The
+  /// dimensions and the treatment of empty matrices (as zero matrices of the
+  /// appropriate size) are the same as for AffineSystem.
+  ///
+  /// @param time_period Defines the period of the discrete time system; use
+  /// time_period=0.0 to denote a continuous time system.  @default 0.0
+  ///
+  /// Subclasses must use the protected constructor, not this one.
+  explicit SparseAffineSystem(
+      const Eigen::SparseMatrix<double>& A = Eigen::SparseMatrix<double>(),
+      const Eigen::SparseMatrix<double>& B = Eigen::SparseMatrix<double>(),
+      const Eigen::Ref<const Eigen::VectorXd>& f0 = Eigen::VectorXd(),
+      const Eigen::SparseMatrix<double>& C = Eigen::SparseMatrix<double>(),
+      const Eigen::SparseMatrix<double>& D = Eigen::SparseMatrix<double>(),
+      const Eigen::Ref<const Eigen::VectorXd>& y0 = Eigen::VectorXd(),
+      double time_period = 0.0);
+
+  /// Scalar-converting copy constructor.  See @ref system_scalar_conversion.
+  template <typename U>
+  explicit SparseAffineSystem(const SparseAffineSystem<U>&);
+
+  /// @name Helper getter methods.
+  /// @{
+  const SparseMatrix& A() const { return A_; }
+  const SparseMatrix& B() const { return B_; }
+  const Eigen::VectorXd& f0() const { return f0_; }
+  const SparseMatrix& C() const { return C_; }
+  const SparseMatrix& D() const { return D_; }
+  const Eigen::VectorXd& y0() const { return y0_; }
+  /// @}
+
+  /// @name Implementations of TimeVaryingAffineSystem<T>'s pure virtual
+  /// methods. These return dense copies of the coefficients.
+  /// @{
+  MatrixX<T> A(const T&) const final;
+  MatrixX<T> B(const T&) const final;
+  VectorX<T> f0(const T&) const final { return VectorX<T>(f0_); }
+  MatrixX<T> C(const T&) const final;
+  MatrixX<T> D(const T&) const final;
+  VectorX<T> y0(const T&) const final { return VectorX<T>(y0_); }
+  /// @}
+
+  /// Sets the number of threads used for the sparse matrix-vector products
+  /// (default is no parallelism). Only the `double` scalar type is
+  /// parallelized; the setting is ignored for the other scalar types.
+  void set_parallelism(Parallelism parallelism) { parallelism_ = parallelism; }
+
+  /// Gets the parallelism of the sparse matrix-vector products.
+  /// @see set_parallelism()
+  Parallelism get_parallelism() const { return parallelism_; }
+
+ protected:
+  /// Constructor that specifies scalar-type conversion support.
+  /// @param converter scalar-type conversion support helper (i.e., AutoDiff,
+  /// etc.); pass a default-constructed object if such support is not desired.
+  /// See @ref system_scalar_conversion for detailed background and examples
+  /// related to scalar-type conversion support.
+  SparseAffineSystem(SystemScalarConverter converter,
+                     const Eigen::SparseMatrix<double>& A,
+                     const Eigen::SparseMatrix<double>& B,
+                     const Eigen::Ref<const Eigen::VectorXd>& f0,
+                     const Eigen::SparseMatrix<double>& C,
+                     const Eigen::SparseMatrix<double>& D,
+                     const Eigen::Ref<const Eigen::VectorXd>& y0,
+                     double time_period);
+
+ private:
+  void CalcOutputY(const Context<T>& context,
+                   BasicVector<T>* output_vector) const final;
+
+  void DoCalcTimeDerivatives(const Context<T>& context,
+                             ContinuousState<T>* derivatives) const final;
+
+  EventStatus CalcDiscreteUpdate(const Context<T>& context,
+                                 DiscreteValues<T>* updates) const final;
+
+  // The number of threads to use for the products with scalar type T.
+  int num_threads() const;
+
+  SparseMatrix A_;
+  SparseMatrix B_;
+  Eigen::VectorXd f0_;
+  SparseMatrix C_;
+  SparseMatrix D_;
+  Eigen::VectorXd y0_;
+  Parallelism parallelism_;
+};
+
+/// A discrete OR continuous linear system with constant, sparse coefficient
+/// matrices, i.e., a SparseAffineSystem with zero `f0` and `y0`.
+///
+/// @system
+/// name: SparseLinearSystem
+/// input_ports:
+/// - u0
+/// output_ports:
+/// - y0
+/// @endsystem
+///
+/// @tparam_default_scalar
+/// @ingroup primitive_systems
+///
+/// @see LinearSystem
+/// @see SparseAffineSystem
+template <typename T>
+class SparseLinearSystem : public SparseAffineSystem<T> {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(SparseLinearSystem)
+
+  /// Constructs a %SparseLinearSystem with the given coefficients; see
+  /// LinearSystem for the required dimensions.
+  ///
+  /// Subclasses must use the protected constructor, not this one.
+  explicit SparseLinearSystem(
+      const Eigen::SparseMatrix<double>& A = Eigen::SparseMatrix<double>(),
+      const Eigen::SparseMatrix<double>& B = Eigen::SparseMatrix<double>(),
+      const Eigen::SparseMatrix<double>& C = Eigen::SparseMatrix<double>(),
+      const Eigen::SparseMatrix<double>& D = Eigen::SparseMatrix<double>(),
+      double time_period = 0.0);
+
+  /// Scalar-converting copy constructor.  See @ref system_scalar_conversion.
+  template <typename U>
+  explicit SparseLinearSystem(const SparseLinearSystem<U>&);
+
+ protected:
+  /// Constructor that specifies scalar-type conversion support.
+  /// @param converter scalar-type conversion support helper (i.e., AutoDiff,
+  /// etc.); pass a default-constructed object if such support is not desired.
+  /// See @ref system_scalar_conversion for detailed background and examples
+  /// related to scalar-type conversion support.
+  SparseLinearSystem(SystemScalarConverter converter,
+                     const Eigen::SparseMatrix<double>& A,
+                     const Eigen::SparseMatrix<double>& B,
+                     const Eigen::SparseMatrix<double>& C,
+                     const Eigen::SparseMatrix<double>& D,
+                     double time_period);
+};
+
+}  // namespace systems
+}  // namespace drake
+
+DRAKE_DECLARE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS(
+    class ::drake::systems::SparseAffineSystem)
+
+DRAKE_DECLARE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS(
+    class ::drake::systems::SparseLinearSystem)
@@ -9,7 +9,6 @@ namespace drake {
 namespace systems {
 
 using Eigen::Ref;
-using symbolic::Environment;
 using symbolic::Expression;
 using symbolic::Jacobian;
 using symbolic::Substitution;
@@ -32,6 +31,19 @@ Expression FirstOrderTaylorExpand(const Expression& f, const Substitution& a) {
   return ret.Expand();
 }
 
+// Compiles @p expr, followed by the entries of its Jacobian with respect to
+// @p vars in column-major order, into one tape.
+symbolic::ExpressionTape MakeTapeWithJacobian(
+    const VectorX<Expression>& expr, const VectorX<Variable>& vars) {
+  if (expr.size() == 0) {
+    return symbolic::ExpressionTape(expr, vars);
+  }
+  const MatrixX<Expression> jacobian = Jacobian(expr, vars);
+  VectorX<Expression> stacked(expr.size() + jacobian.size());
+  stacked << expr, jacobian.reshaped();
+  return symbolic::ExpressionTape(stacked, vars);
+}
+
 // Checks if @p v is in @p variables.
 bool Includes(const Ref<const VectorX<Variable>>& variables,
               const Variable& v) {
@@ -147,19 +159,14 @@ SymbolicVectorSystem<T>::SymbolicVectorSystem(
                                   &SymbolicVectorSystem<T>::CalcOutput);
   }
 
-  // Initialize Jacobian matrices iff T == AutoDiffXd.
-  if (std::is_same_v<T, AutoDiffXd>) {
-    if (dynamics_.size() > 0) {
-      dynamics_jacobian_ = Jacobian(dynamics_, vars_vec);
-    }
-    if (output_.size() > 0) {
-      output_jacobian_ = Jacobian(output_, vars_vec);
-    }
-  }
-
-  // Allocate a symbolic::Environment once to be cloned/reused below.
-  for (const auto& v : all_vars) {
-    env_.insert(v, 0.0);
+  // Compile the expressions (and, iff T == AutoDiffXd, their Jacobians), to
+  // evaluate them without traversing the expression trees.
+  if constexpr (std::is_same_v<T, double>) {
+    dynamics_tape_ = symbolic::ExpressionTape(dynamics_, vars_vec);
+    output_tape_ = symbolic::ExpressionTape(output_, vars_vec);
+  } else if constexpr (std::is_same_v<T, AutoDiffXd>) {
+    dynamics_tape_ = MakeTapeWithJacobian(dynamics_, vars_vec);
+    output_tape_ = MakeTapeWithJacobian(output_, vars_vec);
   }
 }
 
@@ -214,26 +221,68 @@ void SymbolicVectorSystem<T>::PopulateFromContext(const Context<T>& context,
   }
 }
 
+template <typename T>
+void SymbolicVectorSystem<T>::ThrowIfEvaluateFails(
+    const VectorX<Expression>& expr, const Eigen::VectorXd& vars) const {
+  symbolic::Environment env;
+  int index = 0;
+  for (const auto* group : {&state_vars_, &input_vars_, &parameter_vars_}) {
+    for (int i = 0; i < group->size(); ++i) {
+      env[(*group)[i]] = vars[index++];
+    }
+  }
+  if (time_var_) {
+    env[*time_var_] = vars[index];
+  }
+  for (int i = 0; i < expr.size(); ++i) {
+    expr[i].Evaluate(env);
+  }
+}
+
 // TODO(eric.cousineau): Consider decoupling output from `VectorBase` and use
 // `EigenPtr` or something.
 
 template <>
 void SymbolicVectorSystem<double>::EvaluateWithContext(
     const Context<double>& context, const VectorX<Expression>& expr,
-    const MatrixX<symbolic::Expression>& jacobian, bool needs_inputs,
+    const symbolic::ExpressionTape& tape, bool needs_inputs,
     VectorBase<double>* out) const {
-  unused(jacobian);
-  Environment env = env_;
-  PopulateFromContext(context, needs_inputs, &env);
-  for (int i = 0; i < out->size(); i++) {
-    out->SetAtIndex(i, expr[i].Evaluate(env));
+  // The variables are ordered as state, input, parameter, and time.
+  Eigen::VectorXd vars = Eigen::VectorXd::Zero(tape.num_variables());
+  if (state_vars_.size() > 0) {
+    const VectorBase<double>& state =
+        (time_period_ > 0.0) ? context.get_discrete_state_vector()
+                             : context.get_continuous_state_vector();
+    vars.head(state_vars_.size()) = state.CopyToVector();
+  }
+  // Note: Invocations only require pre-analysis on the *input* dependency (as
+  // opposed to state, time, etc) because all other values come directly from
+  // the Context (and not from input ports whose *unnecessary* evaluation can
+  // lead to spurious algebraic loops).
+  if (input_vars_.size() > 0 && needs_inputs) {
+    vars.segment(state_vars_.size(), input_vars_.size()) =
+        this->get_input_port().Eval(context);
   }
+  if (parameter_vars_.size() > 0) {
+    vars.segment(state_vars_.size() + input_vars_.size(),
+                 parameter_vars_.size()) =
+        context.get_numeric_parameter(0).value();
+  }
+  if (time_var_) {
+    vars[vars.size() - 1] = context.get_time();
+  }
+  Eigen::VectorXd result;
+  tape.Eval(vars, &result);
+  if (result.hasNaN()) {
+    ThrowIfEvaluateFails(expr, vars);
+  }
+  out->SetFromVector(result);
 }
 
 template <>
 void SymbolicVectorSystem<AutoDiffXd>::EvaluateWithContext(
     const Context<AutoDiffXd>& context, const VectorX<Expression>& expr,
-    const MatrixX<symbolic::Expression>& jacobian, bool needs_inputs,
+    const symbolic::ExpressionTape& tape, bool needs_inputs,
     VectorBase<AutoDiffXd>* pout) const {
   VectorBase<AutoDiffXd>& out = *pout;
 
@@ -278,24 +327,25 @@ void SymbolicVectorSystem<AutoDiffXd>::EvaluateWithContext(
   }
   set_num_gradients(parameter);
 
-  Eigen::MatrixXd dvars = Eigen::MatrixXd::Zero(jacobian.cols(), num_gradients);
-  Environment env = env_;
+  const int num_vars = tape.num_variables();
+  Eigen::VectorXd vars = Eigen::VectorXd::Zero(num_vars);
+  Eigen::MatrixXd dvars = Eigen::MatrixXd::Zero(num_vars, num_gradients);
   if (time_var_) {
-    env[*time_var_] = time.value();
+    vars[num_vars - 1] = time.value();
     if (time.derivatives().size()) {
       dvars.bottomRows<1>() = time.derivatives();
     }
   }
-  size_t dvars_row_idx = 0;
+  int dvars_row_idx = 0;
   for (int i = 0; i < state_vars_.size(); i++, dvars_row_idx++) {
-    env[state_vars_[i]] = state[i].value();
+    vars[dvars_row_idx] = state[i].value();
     if (state[i].derivatives().size()) {
       dvars.row(dvars_row_idx) = state[i].derivatives();
     }
   }
   if (needs_inputs) {
     for (int i = 0; i < input_vars_.size(); i++, dvars_row_idx++) {
-      env[input_vars_[i]] = input[i].value();
+      vars[dvars_row_idx] = input[i].value();
       if (input[i].derivatives().size()) {
         dvars.row(dvars_row_idx) = input[i].derivatives();
       }
@@ -304,30 +354,33 @@ void SymbolicVectorSystem<AutoDiffXd>::EvaluateWithContext(
     dvars_row_idx += input_vars_.size();
   }
   for (int i = 0; i < parameter_vars_.size(); i++, dvars_row_idx++) {
-    env[parameter_vars_[i]] = parameter[i].value();
+    vars[dvars_row_idx] = parameter[i].value();
     if (parameter[i].derivatives().size()) {
       dvars.row(dvars_row_idx) = parameter[i].derivatives();
     }
   }
 
-  // Now actually compute the output values and derivatives.
-  Eigen::RowVectorXd dout_dvars(jacobian.cols());
+  // Now actually compute the output values and derivatives. The tape computes
+  // the values followed by the Jacobian in column-major order.
+  const int n = expr.size();
+  Eigen::VectorXd result;
+  tape.Eval(vars, &result);
+  if (result.head(n).hasNaN()) {
+    ThrowIfEvaluateFails(expr, vars);
+  }
+  const auto dout_dvars = result.tail(n * num_vars).reshaped(n, num_vars);
   for (int i = 0; i < out.size(); i++) {
-    out[i].value() = expr[i].Evaluate(env);
-
-    for (int j = 0; j < jacobian.cols(); j++) {
-      dout_dvars(j) = jacobian(i, j).Evaluate(env);
-    }
-    out[i].derivatives() = dout_dvars * dvars;
+    out[i].value() = result[i];
+    out[i].derivatives() = dout_dvars.row(i) * dvars;
   }
 }
 
 template <>
 void SymbolicVectorSystem<Expression>::EvaluateWithContext(
     const Context<Expression>& context, const VectorX<Expression>& expr,
-    const MatrixX<symbolic::Expression>& jacobian, bool needs_inputs,
+    const symbolic::ExpressionTape& tape, bool needs_inputs,
     VectorBase<Expression>* out) const {
-  unused(jacobian);
+  unused(tape);
   Substitution s;
   PopulateFromContext(context, needs_inputs, &s);
   for (int i = 0; i < out->size(); i++) {
@@ -339,7 +392,7 @@ template <typename T>
 void SymbolicVectorSystem<T>::CalcOutput(const Context<T>& context,
                                          BasicVector<T>* output_vector) const {
   DRAKE_DEMAND(output_.size() > 0);
-  EvaluateWithContext(context, output_, output_jacobian_, output_needs_inputs_,
+  EvaluateWithContext(context, output_, output_tape_, output_needs_inputs_,
                       output_vector);
 }
 
@@ -348,7 +401,7 @@ void SymbolicVectorSystem<T>::DoCalcTimeDerivatives(
     const Context<T>& context, ContinuousState<T>* derivatives) const {
   DRAKE_DEMAND(time_period_ == 0.0);
   DRAKE_DEMAND(dynamics_.size() > 0);
-  EvaluateWithContext(context, dynamics_, dynamics_jacobian_,
+  EvaluateWithContext(context, dynamics_, dynamics_tape_,
                       dynamics_needs_inputs_,
                       &derivatives->get_mutable_vector());
 }
@@ -359,7 +412,7 @@ EventStatus SymbolicVectorSystem<T>::CalcDiscreteUpdate(
     drake::systems::DiscreteValues<T>* updates) const {
   DRAKE_DEMAND(time_period_ > 0.0);
   DRAKE_DEMAND(dynamics_.size() > 0);
-  EvaluateWithContext(context, dynamics_, dynamics_jacobian_,
+  EvaluateWithContext(context, dynamics_, dynamics_tape_,
                       dynamics_needs_inputs_, &updates->get_mutable_vector());
   return EventStatus::Succeeded();
 }
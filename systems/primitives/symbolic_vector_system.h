@@ -10,6 +10,7 @@
 
 #include "drake/common/eigen_types.h"
 #include "drake/common/symbolic/expression.h"
+#include "drake/common/symbolic/expression_tape.h"
 #include "drake/systems/framework/leaf_system.h"
 
 namespace drake {
@@ -187,9 +188,17 @@ class SymbolicVectorSystem final : public LeafSystem<T> {
   // Evaluate context to a vector.
   void EvaluateWithContext(const Context<T>& context,
                            const VectorX<symbolic::Expression>& expr,
-                           const MatrixX<symbolic::Expression>& jacobian,
+                           const symbolic::ExpressionTape& tape,
                            bool needs_inputs, VectorBase<T>* out) const;
 
+  // Evaluates `expr` with Expression::Evaluate() at the values `vars` of the
+  // state, input, parameter, and time variables (in that order), discarding
+  // the result. The tapes produce a NaN where Expression::Evaluate() throws
+  // (e.g., for a division by zero), so this is used to throw the same
+  // exception whenever a tape's result has a NaN.
+  void ThrowIfEvaluateFails(const VectorX<symbolic::Expression>& expr,
+                            const Eigen::VectorXd& vars) const;
+
   void CalcOutput(const Context<T>& context,
                   BasicVector<T>* output_vector) const;
 
@@ -209,14 +218,16 @@ class SymbolicVectorSystem final : public LeafSystem<T> {
   const bool dynamics_needs_inputs_;
   const bool output_needs_inputs_;
 
-  symbolic::Environment env_{};
   const double time_period_{0.0};
 
   std::unordered_map<symbolic::Variable::Id, int> state_var_to_index_;
 
-  // Storage for Jacobians (empty unless T == AutoDiffXd).
-  MatrixX<symbolic::Expression> dynamics_jacobian_{};
-  MatrixX<symbolic::Expression> output_jacobian_{};
+  // The dynamics and output compiled as functions of the state, input,
+  // parameter, and time variables, in that order (empty if T == Expression).
+  // If T == AutoDiffXd, the tapes also compute the entries of the Jacobians
+  // of the expressions with respect to those variables, in column-major order.
+  symbolic::ExpressionTape dynamics_tape_;
+  symbolic::ExpressionTape output_tape_;
 
   template <typename U>
   friend class SymbolicVectorSystem;
@@ -427,21 +438,21 @@ class SymbolicVectorSystemBuilder {
 template <>
 void SymbolicVectorSystem<double>::EvaluateWithContext(
     const Context<double>& context, const VectorX<symbolic::Expression>& expr,
-    const MatrixX<symbolic::Expression>& jacobian, bool needs_inputs,
+    const symbolic::ExpressionTape& tape, bool needs_inputs,
     VectorBase<double>* out) const;
 
 template <>
 void SymbolicVectorSystem<AutoDiffXd>::EvaluateWithContext(
     const Context<AutoDiffXd>& context,
     const VectorX<symbolic::Expression>& expr,
-    const MatrixX<symbolic::Expression>& jacobian, bool needs_inputs,
+    const symbolic::ExpressionTape& tape, bool needs_inputs,
     VectorBase<AutoDiffXd>* out) const;
 
 template <>
 void SymbolicVectorSystem<symbolic::Expression>::EvaluateWithContext(
     const Context<symbolic::Expression>& context,
     const VectorX<symbolic::Expression>& expr,
-    const MatrixX<symbolic::Expression>& jacobian, bool needs_inputs,
+    const symbolic::ExpressionTape& tape, bool needs_inputs,
     VectorBase<symbolic::Expression>* out) const;
 #endif
 
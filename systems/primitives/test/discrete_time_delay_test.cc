@@ -132,9 +132,11 @@ TEST_P(DiscreteTimeDelayTest, Output) {
     SimpleAbstractType& next_value =
         context_->get_mutable_abstract_state<SimpleAbstractType>(oldest_index);
     next_value = SimpleAbstractType(state_value_override_);
-    output = delay_->get_output_port()
-                 .template Eval<SimpleAbstractType>(*context_)
-                 .value();
+    const SimpleAbstractType& output_value =
+        delay_->get_output_port().template Eval<SimpleAbstractType>(*context_);
+    // The abstract output refers to the buffered state; no copy is made.
+    EXPECT_EQ(&output_value, &next_value);
+    output = output_value.value();
   }
   EXPECT_EQ(output_expected, output);
 }
@@ -155,6 +157,14 @@ TEST_P(DiscreteTimeDelayTest, Update) {
     value = ConcatenateAbstractBufferToVector(context_.get());
   }
   EXPECT_EQ(value_expected, value);
+
+  // Fill the rest of the buffer.
+  for (int ii = 0; ii < kBuffer; ii++) {
+    delay_->SaveInputToBuffer(context_.get());
+  }
+  value = is_abstract_ ? ConcatenateAbstractBufferToVector(context_.get())
+                       : context_->get_discrete_state(0).CopyToVector();
+  EXPECT_EQ(value, input_value_.replicate(kBuffer + 1, 1));
 }
 
 TEST_P(DiscreteTimeDelayTest, ToAutoDiff) {
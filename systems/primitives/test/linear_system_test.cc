@@ -350,6 +350,39 @@ TEST_F(TestLinearizeFromAffine, DiscreteAtNonEquilibrium) {
   EXPECT_EQ(time_period_, affine_system->time_period());
 }
 
+// Test that FirstOrderTaylorApproximator recovers the original affine system
+// at every operating point, for both continuous and discrete time.
+TEST_F(TestLinearizeFromAffine, Approximator) {
+  const double tol = 1e-10;
+  for (const AffineSystem<double>* system :
+       {continuous_system_.get(), discrete_system_.get()}) {
+    auto context = system->CreateDefaultContext();
+    FirstOrderTaylorApproximator approximator(*system);
+    EXPECT_EQ(approximator.time_period(), system->time_period());
+    for (const double u0 : {u0_, -3.0}) {
+      system->get_input_port().FixValue(context.get(), u0);
+      if (system->time_period() == 0.0) {
+        context->get_mutable_continuous_state_vector().SetFromVector(x0_ * u0);
+      } else {
+        context->get_mutable_discrete_state_vector().SetFromVector(x0_ * u0);
+      }
+      approximator.Calc(*context);
+      EXPECT_TRUE(CompareMatrices(A_, approximator.A(), tol,
+                                  MatrixCompareType::absolute));
+      EXPECT_TRUE(CompareMatrices(B_, approximator.B(), tol,
+                                  MatrixCompareType::absolute));
+      EXPECT_TRUE(CompareMatrices(f0_, approximator.f0(), tol,
+                                  MatrixCompareType::absolute));
+      EXPECT_TRUE(CompareMatrices(C_, approximator.C(), tol,
+                                  MatrixCompareType::absolute));
+      EXPECT_TRUE(CompareMatrices(D_, approximator.D(), tol,
+                                  MatrixCompareType::absolute));
+      EXPECT_TRUE(CompareMatrices(y0_, approximator.y0(), tol,
+                                  MatrixCompareType::absolute));
+    }
+  }
+}
+
 // A trivial system with discrete state that is not bound to a periodic update
 // cycle.
 class TestNonPeriodicSystem : public LeafSystem<double> {
@@ -462,6 +495,29 @@ GTEST_TEST(TestLinearize, LinearizingWithMixedInputs) {
   DRAKE_EXPECT_NO_THROW(Linearize(system, *context));
 }
 
+// Test FirstOrderTaylorApproximator on the ports of the mixed-input system.
+GTEST_TEST(TestLinearize, ApproximatorPorts) {
+  EmptyStateSystemWithAbstractInput<double> abstract_system;
+  DRAKE_EXPECT_THROWS_MESSAGE(FirstOrderTaylorApproximator{abstract_system},
+                              ".*only supports vector-valued.*");
+
+  EmptyStateSystemWithMixedInputs<double> system;
+  auto context = system.CreateDefaultContext();
+  FirstOrderTaylorApproximator approximator(system);
+  DRAKE_EXPECT_THROWS_MESSAGE(approximator.Calc(*context),
+                              "InputPort.*is not connected");
+  system.get_input_port(0).FixValue(context.get(), 0.0);
+  DRAKE_EXPECT_NO_THROW(approximator.Calc(*context));
+  system.get_input_port(1).FixValue(context.get(), std::vector<double>());
+  DRAKE_EXPECT_NO_THROW(approximator.Calc(*context));
+  EXPECT_EQ(approximator.B().rows(), 0);
+  EXPECT_EQ(approximator.B().cols(), 1);
+
+  // The context must belong to the system.
+  auto other_context = abstract_system.CreateDefaultContext();
+  EXPECT_THROW(approximator.Calc(*other_context), std::exception);
+}
+
 // Test that Linearize throws when called on a discrete but non-periodic system.
 GTEST_TEST(TestLinearize, ThrowsWithNonPeriodicDiscreteSystem) {
   TestNonPeriodicSystem system;
@@ -747,6 +803,32 @@ TEST_F(LinearSystemTest, LinearizeSystemWithParameters) {
   EXPECT_TRUE(CompareMatrices(linearized_pendulum->D(), D, tol));
 }
 
+// Test that FirstOrderTaylorApproximator matches
+// FirstOrderTaylorApproximation() on a nonlinear system, across operating
+// points that change the state, the input, and the parameters.
+TEST_F(LinearSystemTest, ApproximatorMatchesFirstOrderTaylorApproximation) {
+  examples::pendulum::PendulumPlant<double> pendulum;
+  auto context = pendulum.CreateDefaultContext();
+  FirstOrderTaylorApproximator approximator(pendulum);
+  const double tol = 1e-12;
+  examples::pendulum::PendulumInput<double> input;
+  for (const double theta : {0.0, 0.4, 2.5}) {
+    input.set_tau(0.1 * theta + 0.2);
+    pendulum.get_input_port().FixValue(context.get(), input);
+    context->SetContinuousState(Eigen::Vector2d(theta, -theta));
+    context->get_mutable_numeric_parameter(0)[0] = 1.0 + theta;
+    approximator.Calc(*context);
+    std::unique_ptr<AffineSystem<double>> expected =
+        FirstOrderTaylorApproximation(pendulum, *context);
+    EXPECT_TRUE(CompareMatrices(approximator.A(), expected->A(), tol));
+    EXPECT_TRUE(CompareMatrices(approximator.B(), expected->B(), tol));
+    EXPECT_TRUE(CompareMatrices(approximator.f0(), expected->f0(), tol));
+    EXPECT_TRUE(CompareMatrices(approximator.C(), expected->C(), tol));
+    EXPECT_TRUE(CompareMatrices(approximator.D(), expected->D(), tol));
+    EXPECT_TRUE(CompareMatrices(approximator.y0(), expected->y0(), tol));
+  }
+}
+
 GTEST_TEST(LinearizeTest, NoState) {
   const double tol = 1e-6;
   const Eigen::Matrix<double, 0, 0> A;
@@ -9,6 +9,7 @@
 #include "drake/math/autodiff_gradient.h"
 #include "drake/systems/framework/basic_vector.h"
 #include "drake/systems/framework/fixed_input_port_value.h"
+#include "drake/systems/framework/leaf_output_port.h"
 #include "drake/systems/framework/test_utilities/scalar_conversion.h"
 
 using Eigen::VectorXd;
@@ -116,6 +117,48 @@ TEST_P(PassThroughTest, VectorThroughPassThroughSystem) {
   EXPECT_EQ(input_value_, output);
 }
 
+// Tests that the output port refers directly to the input value (no copy) and
+// is invalidated when the input changes.
+TEST_P(PassThroughTest, OutputAliasesInput) {
+  const auto& output_port = pass_through_->get_output_port(0);
+  const auto& leaf_output_port =
+      dynamic_cast<const LeafOutputPort<double>&>(output_port);
+  EXPECT_TRUE(leaf_output_port.is_aliased());
+
+  FixedInputPortValue* fixed = nullptr;
+  if (!is_abstract_) {
+    fixed = &pass_through_->get_input_port(0).FixValue(context_.get(),
+                                                       input_value_);
+  } else {
+    fixed = &pass_through_->get_input_port(0).FixValue(
+        context_.get(), SimpleAbstractType(input_value_));
+  }
+  EXPECT_EQ(&output_port.Eval<AbstractValue>(*context_),
+            &fixed->get_value());
+
+  // Changing the input value is visible through the output.
+  const Eigen::VectorXd new_value = 2 * input_value_;
+  Eigen::VectorXd output;
+  if (!is_abstract_) {
+    fixed->GetMutableVectorData<double>()->SetFromVector(new_value);
+    output = output_port.Eval(*context_);
+  } else {
+    fixed->GetMutableData()->set_value(SimpleAbstractType(new_value));
+    output = output_port.Eval<SimpleAbstractType>(*context_).value();
+  }
+  EXPECT_EQ(output, new_value);
+
+  // Calc() still produces an independent copy.
+  auto copy = output_port.Allocate();
+  output_port.Calc(*context_, copy.get());
+  EXPECT_NE(copy.get(), &fixed->get_value());
+  if (!is_abstract_) {
+    EXPECT_EQ(copy->get_value<BasicVector<double>>().value(), new_value);
+  } else {
+    EXPECT_EQ(copy->get_value<SimpleAbstractType>().value(), new_value);
+  }
+}
+
 // Tests that PassThrough allocates no state variables in the context_.
 TEST_P(PassThroughTest, PassThroughIsStateless) {
   EXPECT_EQ(0, context_->num_continuous_states());
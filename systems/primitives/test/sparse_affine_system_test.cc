@@ -0,0 +1,150 @@
+#include "drake/systems/primitives/sparse_affine_system.h"
+
+#include <memory>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/systems/framework/test_utilities/scalar_conversion.h"
+#include "drake/systems/primitives/affine_system.h"
+
+namespace drake {
+namespace systems {
+namespace {
+
+using Eigen::MatrixXd;
+using Eigen::VectorXd;
+
+// A tridiagonal (discretized 1-D heat equation) A, plus small B, C, D.
+class SparseAffineSystemTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    const int n = 6;
+    A_ = MatrixXd::Zero(n, n);
+    for (int i = 0; i < n; ++i) {
+      A_(i, i) = -2.0;
+      if (i > 0) A_(i, i - 1) = 1.0;
+      if (i < n - 1) A_(i, i + 1) = 1.0;
+    }
+    B_ = MatrixXd::Zero(n, 2);
+    B_(0, 0) = 1.0;
+    B_(n - 1, 1) = -0.5;
+    f0_ = VectorXd::LinSpaced(n, 0.1, 0.6);
+    C_ = MatrixXd::Zero(3, n);
+    C_(0, 1) = 2.0;
+    C_(2, 4) = -1.0;
+    D_ = MatrixXd::Zero(3, 2);
+    D_(1, 0) = 0.25;
+    y0_ = VectorXd::LinSpaced(3, -1.0, 1.0);
+    x_ = VectorXd::LinSpaced(n, 1.0, 2.0);
+    u_ = Eigen::Vector2d(3.0, -4.0);
+  }
+
+  MatrixXd A_, B_, C_, D_;
+  VectorXd f0_, y0_, x_, u_;
+};
+
+// Checks that the dynamics and output match those of the dense AffineSystem.
+void CheckMatchesDense(const SparseAffineSystem<double>& dut,
+                       const AffineSystem<double>& dense,
+                       const VectorXd& x, const VectorXd& u) {
+  auto context = dut.CreateDefaultContext();
+  auto dense_context = dense.CreateDefaultContext();
+  dut.get_input_port().FixValue(context.get(), u);
+  dense.get_input_port().FixValue(dense_context.get(), u);
+  if (dut.time_period() == 0.0) {
+    context->SetContinuousState(x);
+    dense_context->SetContinuousState(x);
+    EXPECT_TRUE(CompareMatrices(
+        dut.EvalTimeDerivatives(*context).CopyToVector(),
+        dense.EvalTimeDerivatives(*dense_context).CopyToVector(), 1e-14));
+  } else {
+    context->SetDiscreteState(x);
+    dense_context->SetDiscreteState(x);
+    EXPECT_TRUE(CompareMatrices(
+        dut.EvalUniquePeriodicDiscreteUpdate(*context).value(),
+        dense.EvalUniquePeriodicDiscreteUpdate(*dense_context).value(),
+        1e-14));
+  }
+  EXPECT_TRUE(CompareMatrices(dut.get_output_port().Eval(*context),
+                              dense.get_output_port().Eval(*dense_context),
+                              1e-14));
+}
+
+TEST_F(SparseAffineSystemTest, Construction) {
+  const SparseAffineSystem<double> dut(A_.sparseView(), B_.sparseView(), f0_,
+                                       C_.sparseView(), D_.sparseView(), y0_);
+  EXPECT_EQ(dut.num_states(), 6);
+  EXPECT_EQ(dut.num_inputs(), 2);
+  EXPECT_EQ(dut.num_outputs(), 3);
+  EXPECT_EQ(dut.A().nonZeros(), 16);
+  EXPECT_TRUE(CompareMatrices(dut.A(0.0), A_));
+  EXPECT_TRUE(CompareMatrices(dut.B(0.0), B_));
+  EXPECT_TRUE(CompareMatrices(dut.f0(0.0), f0_));
+  EXPECT_TRUE(CompareMatrices(dut.C(0.0), C_));
+  EXPECT_TRUE(CompareMatrices(dut.D(0.0), D_));
+  EXPECT_TRUE(CompareMatrices(dut.y0(0.0), y0_));
+}
+
+TEST_F(SparseAffineSystemTest, MatchesDenseContinuous) {
+  const SparseAffineSystem<double> dut(A_.sparseView(), B_.sparseView(), f0_,
+                                       C_.sparseView(), D_.sparseView(), y0_);
+  const AffineSystem<double> dense(A_, B_, f0_, C_, D_, y0_);
+  CheckMatchesDense(dut, dense, x_, u_);
+}
+
+TEST_F(SparseAffineSystemTest, MatchesDenseDiscrete) {
+  const double kTimePeriod = 0.1;
+  const SparseAffineSystem<double> dut(A_.sparseView(), B_.sparseView(), f0_,
+                                       C_.sparseView(), D_.sparseView(), y0_,
+                                       kTimePeriod);
+  const AffineSystem<double> dense(A_, B_, f0_, C_, D_, y0_, kTimePeriod);
+  CheckMatchesDense(dut, dense, x_, u_);
+}
+
+TEST_F(SparseAffineSystemTest, Parallelism) {
+  SparseAffineSystem<double> dut(A_.sparseView(), B_.sparseView(), f0_,
+                                 C_.sparseView(), D_.sparseView(), y0_);
+  dut.set_parallelism(Parallelism(2));
+  EXPECT_EQ(dut.get_parallelism().num_threads(), 2);
+  const AffineSystem<double> dense(A_, B_, f0_, C_, D_, y0_);
+  CheckMatchesDense(dut, dense, x_, u_);
+}
+
+// The output port depends only on what C and D make it depend on.
+TEST_F(SparseAffineSystemTest, DirectFeedthrough) {
+  const SparseAffineSystem<double> with_D(A_.sparseView(), B_.sparseView(),
+                                          f0_, C_.sparseView(),
+                                          D_.sparseView(), y0_);
+  EXPECT_TRUE(with_D.HasAnyDirectFeedthrough());
+  const SparseAffineSystem<double> without_D(
+      A_.sparseView(), B_.sparseView(), f0_, C_.sparseView(),
+      MatrixXd::Zero(3, 2).sparseView(), y0_);
+  EXPECT_FALSE(without_D.HasAnyDirectFeedthrough());
+}
+
+TEST_F(SparseAffineSystemTest, ScalarConversion) {
+  SparseAffineSystem<double> dut(A_.sparseView(), B_.sparseView(), f0_,
+                                 C_.sparseView(), D_.sparseView(), y0_);
+  dut.configure_default_state(x_);
+  EXPECT_TRUE(is_autodiffxd_convertible(dut, [&](const auto& converted) {
+    EXPECT_TRUE(CompareMatrices(MatrixXd(converted.A()), A_));
+    EXPECT_EQ(converted.get_default_state().size(), x_.size());
+  }));
+  EXPECT_TRUE(is_symbolic_convertible(dut));
+}
+
+TEST_F(SparseAffineSystemTest, SparseLinearSystem) {
+  const SparseLinearSystem<double> dut(A_.sparseView(), B_.sparseView(),
+                                       C_.sparseView(), D_.sparseView());
+  EXPECT_TRUE(dut.f0().isZero());
+  EXPECT_TRUE(dut.y0().isZero());
+  const AffineSystem<double> dense(A_, B_, VectorXd::Zero(6), C_, D_,
+                                   VectorXd::Zero(3));
+  CheckMatchesDense(dut, dense, x_, u_);
+  EXPECT_TRUE(is_autodiffxd_convertible(dut));
+}
+
+}  // namespace
+}  // namespace systems
+}  // namespace drake
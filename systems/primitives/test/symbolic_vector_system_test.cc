@@ -5,6 +5,7 @@
 #include <gtest/gtest.h>
 
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
 #include "drake/common/test_utilities/symbolic_test_util.h"
 #include "drake/math/autodiff.h"
 #include "drake/math/autodiff_gradient.h"
@@ -404,6 +405,38 @@ TEST_F(SymbolicVectorSystemTest, DiscreteStateOnly) {
                               Vector1d{-xval + xval * xval * xval}));
 }
 
+// Domain errors throw, as they do for Expression::Evaluate(), rather than
+// producing a NaN.
+TEST_F(SymbolicVectorSystemTest, DomainErrorThrows) {
+  const Variable& x{x_[0]};
+  const Variable& u{u_[0]};
+  const SymbolicVectorSystem<double> system(
+      {}, Vector1<Variable>{x}, Vector1<Variable>{u},
+      Vector1<Expression>{x / u}, Vector1<Expression>{sqrt(x)});
+  auto context = system.CreateDefaultContext();
+  context->SetContinuousState(Vector1d{-1.0});
+  system.get_input_port().FixValue(context.get(), Vector1d{0.0});
+  DRAKE_EXPECT_THROWS_MESSAGE(system.EvalTimeDerivatives(*context),
+                              "Division by zero.*");
+  DRAKE_EXPECT_THROWS_MESSAGE(system.get_output_port().Eval(*context),
+                              "sqrt.*numerical argument out of domain.*");
+
+  auto autodiff_system = system.ToAutoDiffXd();
+  auto autodiff_context = autodiff_system->CreateDefaultContext();
+  autodiff_context->SetTimeStateAndParametersFrom(*context);
+  autodiff_system->get_input_port(0).FixValue(autodiff_context.get(),
+                                              Vector1<AutoDiffXd>{0.0});
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      autodiff_system->get_output_port(0).Eval(*autodiff_context),
+      "sqrt.*numerical argument out of domain.*");
+
+  // Once the arguments are in the domain again, so are the results.
+  context->SetContinuousState(Vector1d{4.0});
+  system.get_input_port().FixValue(context.get(), Vector1d{2.0});
+  EXPECT_EQ(system.EvalTimeDerivatives(*context)[0], 2.0);
+  EXPECT_EQ(system.get_output_port().Eval(*context)[0], 2.0);
+}
+
 TEST_F(SymbolicVectorSystemTest, IntegratorNoFeedthrough) {
   const Variable& x{x_[0]};
   const Variable& u{u_[0]};
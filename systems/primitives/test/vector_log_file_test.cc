@@ -0,0 +1,145 @@
+#include "drake/systems/primitives/vector_log_file.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/temp_directory.h"
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
+
+namespace drake {
+namespace systems {
+namespace {
+
+using Eigen::VectorXd;
+
+class VectorLogFileTest : public ::testing::Test {
+ protected:
+  // Returns a log of `count` samples, whose values are distinct.
+  static VectorLog<double> MakeLog(int count, double offset = 0.0) {
+    VectorLog<double> log(2);
+    for (int k = 0; k < count; ++k) {
+      const double value = offset + k;
+      log.AddData(0.1 * value, Eigen::Vector2d(value, -value));
+    }
+    return log;
+  }
+
+  static void ExpectLogsEqual(const VectorLog<double>& actual,
+                              const VectorLog<double>& expected) {
+    EXPECT_EQ(actual.get_input_size(), expected.get_input_size());
+    EXPECT_EQ(actual.num_samples(), expected.num_samples());
+    EXPECT_TRUE(
+        CompareMatrices(actual.sample_times(), expected.sample_times()));
+    EXPECT_TRUE(CompareMatrices(actual.data(), expected.data()));
+  }
+
+  const std::filesystem::path filename_{
+      std::filesystem::path(temp_directory()) / "log.bin"};
+};
+
+TEST_F(VectorLogFileTest, AddData) {
+  const VectorLog<double> expected = MakeLog(10);
+  {
+    VectorLogFileWriter writer(filename_, 2, 3);
+    EXPECT_EQ(writer.get_input_size(), 2);
+    for (int k = 0; k < expected.num_samples(); ++k) {
+      writer.AddData(expected.sample_times()[k], expected.data().col(k));
+    }
+    EXPECT_EQ(writer.num_samples(), 10);
+  }
+
+  // The samples are read back in chunks of the requested size.
+  VectorLogFileReader reader(filename_);
+  EXPECT_EQ(reader.get_input_size(), 2);
+  EXPECT_EQ(reader.num_samples(), 10);
+  VectorLog<double> chunk(2);
+  for (int start : {0, 3, 6, 9}) {
+    ASSERT_TRUE(reader.ReadNextChunk(&chunk));
+    const int count = std::min(3, 10 - start);
+    ASSERT_EQ(chunk.num_samples(), count);
+    EXPECT_TRUE(CompareMatrices(chunk.sample_times(),
+                                expected.sample_times().segment(start, count)));
+    EXPECT_TRUE(CompareMatrices(chunk.data(),
+                                expected.data().middleCols(start, count)));
+  }
+  EXPECT_FALSE(reader.ReadNextChunk(&chunk));
+  EXPECT_EQ(chunk.num_samples(), 0);
+
+  reader.Rewind();
+  ASSERT_TRUE(reader.ReadNextChunk(&chunk));
+  EXPECT_EQ(chunk.sample_times()[0], 0.0);
+
+  ExpectLogsEqual(VectorLogFileReader::ReadAll(filename_), expected);
+}
+
+// Draining a log into the writer in pieces (as a VectorLogSink would be) still
+// produces full-size chunks.
+TEST_F(VectorLogFileTest, AppendLog) {
+  VectorLog<double> expected(2);
+  {
+    VectorLogFileWriter writer(filename_, 2, 4);
+    for (int count : {2, 9, 0, 1, 5}) {
+      const VectorLog<double> log = MakeLog(count, expected.num_samples());
+      writer.AppendLog(log);
+      expected.AddSamples(log.sample_times(), log.data());
+    }
+    EXPECT_EQ(writer.num_samples(), 17);
+
+    // Flushing makes the samples so far readable while the writer is open.
+    writer.Flush();
+    ExpectLogsEqual(VectorLogFileReader::ReadAll(filename_), expected);
+
+    writer.AddData(100.0, VectorXd::Constant(2, 1.0));
+    expected.AddData(100.0, VectorXd::Constant(2, 1.0));
+  }
+
+  VectorLogFileReader reader(filename_);
+  VectorLog<double> chunk(2);
+  std::vector<int> chunk_sizes;
+  while (reader.ReadNextChunk(&chunk)) {
+    chunk_sizes.push_back(chunk.num_samples());
+  }
+  EXPECT_EQ(chunk_sizes, std::vector<int>({4, 4, 4, 4, 1, 1}));
+  ExpectLogsEqual(VectorLogFileReader::ReadAll(filename_), expected);
+}
+
+TEST_F(VectorLogFileTest, Empty) {
+  { VectorLogFileWriter writer(filename_, 0); }
+  const VectorLog<double> log = VectorLogFileReader::ReadAll(filename_);
+  EXPECT_EQ(log.get_input_size(), 0);
+  EXPECT_EQ(log.num_samples(), 0);
+}
+
+TEST_F(VectorLogFileTest, Errors) {
+  DRAKE_EXPECT_THROWS_MESSAGE(VectorLogFileWriter(filename_, -1), ".*>= 0.*");
+  DRAKE_EXPECT_THROWS_MESSAGE(VectorLogFileWriter(filename_, 2, 0), ".*> 0.*");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      VectorLogFileWriter(filename_ / "no_such_dir" / "log.bin", 2),
+      "Could not open vector log file.*");
+
+  DRAKE_EXPECT_THROWS_MESSAGE(VectorLogFileReader(filename_.string() + "_bad"),
+                              ".*open.*");
+  {
+    std::ofstream(filename_) << "Not a vector log.";
+  }
+  DRAKE_EXPECT_THROWS_MESSAGE(VectorLogFileReader{filename_},
+                              ".*malformed.*not written by.*");
+
+  {
+    VectorLogFileWriter writer(filename_, 2, 3);
+    writer.AppendLog(MakeLog(5));
+  }
+  std::filesystem::resize_file(filename_,
+                               std::filesystem::file_size(filename_) - 8);
+  DRAKE_EXPECT_THROWS_MESSAGE(VectorLogFileReader{filename_},
+                              ".*malformed.*truncated.*");
+}
+
+}  // namespace
+}  // namespace systems
+}  // namespace drake
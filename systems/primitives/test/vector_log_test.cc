@@ -64,6 +64,28 @@ TYPED_TEST(VectorLogFixture, GrowLog) {
   EXPECT_EQ(log.data()(2, goal_size - 1), 3.3);
 }
 
+TYPED_TEST(VectorLogFixture, AddSamples) {
+  using T = TypeParam;
+  auto& log = this->log_;
+  auto& record = this->record_;
+  log.AddData(0.5, record);
+
+  // Add enough samples at once to need a bigger allocation than doubling.
+  const int64_t count = 3 * this->kDefaultCapacity;
+  VectorX<T> times(count);
+  MatrixX<T> samples(3, count);
+  for (int64_t k = 0; k < count; ++k) {
+    times(k) = 1.0 + k;
+    samples.col(k) = record * (1.0 + k);
+  }
+  log.AddSamples(times, samples);
+  EXPECT_EQ(log.num_samples(), 1 + count);
+  EXPECT_EQ(log.sample_times()[0], 0.5);
+  EXPECT_EQ(log.data()(0, 0), 1.1);
+  EXPECT_EQ(log.sample_times()[count], count);
+  EXPECT_EQ(log.data()(2, count), 3.3 * count);
+}
+
 }  // namespace
 }  // namespace systems
 }  // namespace drake
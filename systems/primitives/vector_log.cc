@@ -1,5 +1,7 @@
 #include "drake/systems/primitives/vector_log.h"
 
+#include <algorithm>
+
 #include "drake/common/default_scalars.h"
 #include "drake/common/drake_assert.h"
 
@@ -41,6 +43,22 @@ void VectorLog<T>::AddData(const T& time, const VectorX<T>& sample) {
   DRAKE_ASSERT_VOID(CheckInvariants());
 }
 
+template <typename T>
+void VectorLog<T>::AddSamples(const Eigen::Ref<const VectorX<T>>& times,
+                              const Eigen::Ref<const MatrixX<T>>& samples) {
+  DRAKE_ASSERT_VOID(CheckInvariants());
+  DRAKE_DEMAND(times.size() == samples.cols());
+  DRAKE_DEMAND(samples.rows() == data_.rows());
+  const int64_t count = times.size();
+  if (num_samples_ + count > sample_times_.size()) {
+    Reserve(std::max<int64_t>(sample_times_.size() * 2, num_samples_ + count));
+  }
+  sample_times_.segment(int64_t{num_samples_}, count) = times;
+  data_.middleCols(int64_t{num_samples_}, count) = samples;
+  num_samples_ = num_samples_ + count;
+  DRAKE_ASSERT_VOID(CheckInvariants());
+}
+
 template <typename T>
 void VectorLog<T>::CheckInvariants() const {
   DRAKE_DEMAND(sample_times_.size() == data_.cols());
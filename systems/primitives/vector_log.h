@@ -88,6 +88,18 @@ class VectorLog {
    */
   void AddData(const T& time, const VectorX<T>& sample);
 
+  /** Adds a batch of samples to the end of the log, as if by calling
+   AddData() for each column of `samples` in order, but copying the whole
+   block at once and growing the allocation (if needed) at most once.
+
+   @param times     The time values, one per sample.
+   @param samples   The samples, one per column.
+   @pre times.size() == samples.cols().
+   @pre samples.rows() == get_input_size().
+   */
+  void AddSamples(const Eigen::Ref<const VectorX<T>>& times,
+                  const Eigen::Ref<const MatrixX<T>>& samples);
+
  private:
   void CheckInvariants() const;
 
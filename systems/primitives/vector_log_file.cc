@@ -0,0 +1,216 @@
+#include "drake/systems/primitives/vector_log_file.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <string_view>
+
+#include <fmt/format.h>
+
+#include "drake/common/binary_io.h"
+#include "drake/common/drake_assert.h"
+#include "drake/common/drake_throw.h"
+#include "drake/common/text_logging.h"
+
+namespace drake {
+namespace systems {
+namespace {
+
+// The file begins with kMagic, then the int32 kVersion, then the int32 input
+// size. Each chunk is an int64 sample count `n`, then `n` doubles of times,
+// then `input_size * n` doubles of data. Every field is 8-byte aligned, so the
+// doubles in a memory-mapped file can be read in place.
+constexpr std::string_view kMagic{"DRAKEVLG"};
+constexpr int32_t kVersion = 1;
+constexpr size_t kHeaderSize = kMagic.size() + 2 * sizeof(int32_t);
+
+int ValidateInputSize(int input_size) {
+  DRAKE_THROW_UNLESS(input_size >= 0);
+  return input_size;
+}
+
+}  // namespace
+
+VectorLogFileWriter::VectorLogFileWriter(const std::filesystem::path& filename,
+                                         int input_size, int64_t chunk_size)
+    : filename_(filename),
+      chunk_size_(chunk_size),
+      chunk_(ValidateInputSize(input_size)) {
+  DRAKE_THROW_UNLESS(chunk_size > 0);
+  chunk_.Reserve(chunk_size);
+  output_.open(filename, std::ios::binary | std::ios::trunc);
+  if (!output_.is_open()) {
+    ThrowIfFailed("open");
+  }
+  const int32_t size = input_size;
+  output_.write(kMagic.data(), kMagic.size());
+  output_.write(reinterpret_cast<const char*>(&kVersion), sizeof(kVersion));
+  output_.write(reinterpret_cast<const char*>(&size), sizeof(size));
+  ThrowIfFailed("write");
+}
+
+VectorLogFileWriter::~VectorLogFileWriter() {
+  try {
+    Flush();
+  } catch (const std::exception& e) {
+    log()->error("VectorLogFileWriter: {}", e.what());
+  }
+}
+
+void VectorLogFileWriter::AddData(double time, const Eigen::VectorXd& sample) {
+  chunk_.AddData(time, sample);
+  if (chunk_.num_samples() == chunk_size_) {
+    WriteChunk(chunk_.sample_times(), chunk_.data());
+    chunk_.Clear();
+  }
+}
+
+void VectorLogFileWriter::AppendLog(const VectorLog<double>& log) {
+  DRAKE_DEMAND(log.get_input_size() == get_input_size());
+  int64_t start = 0;
+  while (start < log.num_samples()) {
+    const int64_t count = std::min<int64_t>(log.num_samples() - start,
+                                            chunk_size_ - chunk_.num_samples());
+    if (count == chunk_size_) {
+      // A whole chunk; there's no need to copy it into chunk_ first.
+      WriteChunk(log.sample_times().segment(start, count),
+                 log.data().middleCols(start, count));
+    } else {
+      chunk_.AddSamples(log.sample_times().segment(start, count),
+                        log.data().middleCols(start, count));
+      if (chunk_.num_samples() == chunk_size_) {
+        WriteChunk(chunk_.sample_times(), chunk_.data());
+        chunk_.Clear();
+      }
+    }
+    start += count;
+  }
+}
+
+void VectorLogFileWriter::Flush() {
+  if (chunk_.num_samples() > 0) {
+    WriteChunk(chunk_.sample_times(), chunk_.data());
+    chunk_.Clear();
+  }
+  output_.flush();
+  ThrowIfFailed("write");
+}
+
+void VectorLogFileWriter::WriteChunk(
+    const Eigen::Ref<const Eigen::VectorXd>& times,
+    const Eigen::Ref<const Eigen::MatrixXd>& data) {
+  const int64_t count = times.size();
+  output_.write(reinterpret_cast<const char*>(&count), sizeof(count));
+  output_.write(reinterpret_cast<const char*>(times.data()),
+                count * sizeof(double));
+  if (data.outerStride() == data.rows()) {
+    output_.write(reinterpret_cast<const char*>(data.data()),
+                  data.size() * sizeof(double));
+  } else {
+    for (int64_t i = 0; i < count; ++i) {
+      output_.write(reinterpret_cast<const char*>(data.col(i).data()),
+                    data.rows() * sizeof(double));
+    }
+  }
+  ThrowIfFailed("write");
+  num_written_ += count;
+}
+
+void VectorLogFileWriter::ThrowIfFailed(const char* action) const {
+  if (output_.fail()) {
+    throw std::runtime_error(
+        fmt::format("Could not {} vector log file '{}': {}", action,
+                    filename_.string(), std::strerror(errno)));
+  }
+}
+
+VectorLogFileReader::VectorLogFileReader(const std::filesystem::path& filename)
+    : file_(std::make_unique<internal::MappedFile>(filename.string())) {
+  const std::string_view contents = file_->contents();
+  auto throw_malformed = [&filename](std::string_view reason) {
+    throw std::runtime_error(
+        fmt::format("The vector log file '{}' is malformed: {}",
+                    filename.string(), reason));
+  };
+  if (contents.size() < kHeaderSize ||
+      contents.substr(0, kMagic.size()) != kMagic) {
+    throw_malformed("it was not written by VectorLogFileWriter");
+  }
+  int32_t version{}, input_size{};
+  std::memcpy(&version, contents.data() + kMagic.size(), sizeof(version));
+  std::memcpy(&input_size, contents.data() + kMagic.size() + sizeof(version),
+              sizeof(input_size));
+  if (version != kVersion) {
+    throw_malformed(fmt::format("unsupported version {}", version));
+  }
+  if (input_size < 0) {
+    throw_malformed(fmt::format("invalid input size {}", input_size));
+  }
+  input_size_ = input_size;
+
+  // Walk the chunk headers once, so that truncation is reported up front
+  // rather than partway through reading.
+  size_t offset = kHeaderSize;
+  while (offset < contents.size()) {
+    int64_t count{};
+    if (contents.size() - offset < sizeof(count)) {
+      throw_malformed("it is truncated");
+    }
+    std::memcpy(&count, contents.data() + offset, sizeof(count));
+    offset += sizeof(count);
+    const size_t remaining = (contents.size() - offset) / sizeof(double);
+    if (count < 0 ||
+        static_cast<size_t>(count) > remaining / (input_size_ + 1)) {
+      throw_malformed("it is truncated");
+    }
+    offset += count * (input_size_ + 1) * sizeof(double);
+    num_samples_ += count;
+  }
+  Rewind();
+}
+
+VectorLogFileReader::~VectorLogFileReader() = default;
+
+bool VectorLogFileReader::ReadNextChunk(VectorLog<double>* chunk) {
+  DRAKE_THROW_UNLESS(chunk != nullptr);
+  DRAKE_THROW_UNLESS(chunk->get_input_size() == input_size_);
+  chunk->Clear();
+  return AppendNextChunk(chunk);
+}
+
+bool VectorLogFileReader::AppendNextChunk(VectorLog<double>* log) {
+  const std::string_view contents = file_->contents();
+  if (offset_ >= contents.size()) {
+    return false;
+  }
+  int64_t count{};
+  std::memcpy(&count, contents.data() + offset_, sizeof(count));
+  offset_ += sizeof(count);
+  // The mapping is page aligned and every field is a multiple of 8 bytes, so
+  // the doubles are suitably aligned to be read in place.
+  const double* const times =
+      reinterpret_cast<const double*>(contents.data() + offset_);
+  const double* const data = times + count;
+  log->AddSamples(Eigen::Map<const Eigen::VectorXd>(times, count),
+                  Eigen::Map<const Eigen::MatrixXd>(data, input_size_, count));
+  offset_ += count * (input_size_ + 1) * sizeof(double);
+  return true;
+}
+
+void VectorLogFileReader::Rewind() {
+  offset_ = kHeaderSize;
+}
+
+VectorLog<double> VectorLogFileReader::ReadAll(
+    const std::filesystem::path& filename) {
+  VectorLogFileReader reader(filename);
+  VectorLog<double> result(reader.get_input_size());
+  result.Reserve(reader.num_samples());
+  while (reader.AppendNextChunk(&result)) {
+  }
+  return result;
+}
+
+}  // namespace systems
+}  // namespace drake
@@ -0,0 +1,152 @@
+#pragma once
+
+#include <filesystem>
+#include <fstream>
+#include <memory>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
+#include "drake/systems/primitives/vector_log.h"
+
+namespace drake {
+namespace internal {
+class MappedFile;
+}  // namespace internal
+
+namespace systems {
+
+/**
+ Writes time-dependent vector values to a file as they arrive, so that logs
+ much longer than the available memory can be recorded (e.g., from a
+ week-long simulation). Only a single chunk of samples is held in memory at a
+ time; once `chunk_size` samples have been added, they are appended to the file
+ and the in-memory chunk is reused.
+
+ The file holds a short header (a magic string, a format version, and the
+ input size) followed by a sequence of chunks. Each chunk stores its number of
+ samples `n`, then the `n` sample times, then the `input_size × n` data matrix
+ in column-major order, all in native byte order. Every chunk except possibly
+ the last one holds exactly `chunk_size` samples. Use VectorLogFileReader to
+ read the file back.
+
+ To keep the memory of a VectorLogSink bounded during a long simulation,
+ periodically drain its log into a writer:
+ @code
+ VectorLogFileWriter writer("/tmp/log.bin", sink.get_input_port().size());
+ while (simulator.get_context().get_time() < end_time) {
+   simulator.AdvanceTo(simulator.get_context().get_time() + 60.0);
+   VectorLog<double>& log =
+       sink.FindMutableLog(&simulator.get_mutable_context());
+   writer.AppendLog(log);
+   log.Clear();
+ }
+ @endcode
+
+ The written file is only portable between machines with the same byte order.
+ */
+class VectorLogFileWriter {
+ public:
+  /** The default number of samples per chunk. */
+  static constexpr int64_t kDefaultChunkSize = 1000;
+
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(VectorLogFileWriter)
+
+  /** Creates (or truncates) the file at `filename` and writes its header.
+   @param input_size   Dimension of the per-time step data set.
+   @param chunk_size   The number of samples per chunk.
+   @throws std::exception if input_size is negative or chunk_size is not
+     positive.
+   @throws std::exception if the file cannot be written. */
+  VectorLogFileWriter(const std::filesystem::path& filename, int input_size,
+                      int64_t chunk_size = kDefaultChunkSize);
+
+  /** Writes any buffered samples (see Flush()) and closes the file. Errors
+   while flushing are logged, not thrown; call Flush() first to detect them. */
+  ~VectorLogFileWriter();
+
+  /** Reports the size of the log's input vector. */
+  int64_t get_input_size() const { return chunk_.get_input_size(); }
+
+  /** Returns the number of samples added since construction, whether or not
+   they have been written to the file yet. */
+  int64_t num_samples() const { return num_written_ + chunk_.num_samples(); }
+
+  /** Adds a `sample` with the associated `time` value, as for
+   VectorLog::AddData(). When the current chunk becomes full, it is written to
+   the file.
+   @pre sample.size() == get_input_size().
+   @throws std::exception if the file cannot be written. */
+  void AddData(double time, const Eigen::VectorXd& sample);
+
+  /** Adds all of the samples in `log`, in order. Whole chunks are written
+   directly from the `log` without being copied.
+   @pre log.get_input_size() == get_input_size().
+   @throws std::exception if the file cannot be written. */
+  void AppendLog(const VectorLog<double>& log);
+
+  /** Writes the partially-filled current chunk (if any) to the file, and
+   flushes the file. Subsequent samples start a new chunk.
+   @throws std::exception if the file cannot be written. */
+  void Flush();
+
+ private:
+  void WriteChunk(const Eigen::Ref<const Eigen::VectorXd>& times,
+                  const Eigen::Ref<const Eigen::MatrixXd>& data);
+
+  void ThrowIfFailed(const char* action) const;
+
+  const std::filesystem::path filename_;
+  const int64_t chunk_size_;
+  std::ofstream output_;
+  VectorLog<double> chunk_;
+  int64_t num_written_{0};
+};
+
+/**
+ Reads a file written by VectorLogFileWriter, one chunk at a time. The file is
+ memory-mapped, so only the chunks being read are paged in, and reading a chunk
+ copies its samples once, directly from the page cache.
+ */
+class VectorLogFileReader {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(VectorLogFileReader)
+
+  /** Opens the file at `filename` and validates its layout.
+   @throws std::exception if the file cannot be read, or was not written by a
+     VectorLogFileWriter, or is truncated. */
+  explicit VectorLogFileReader(const std::filesystem::path& filename);
+
+  ~VectorLogFileReader();
+
+  /** Reports the size of the log's input vector. */
+  int64_t get_input_size() const { return input_size_; }
+
+  /** Returns the total number of samples in the file. */
+  int64_t num_samples() const { return num_samples_; }
+
+  /** Replaces the contents of `chunk` with the next chunk of samples in the
+   file. Returns false (and leaves `chunk` empty) once all of the chunks have
+   been read.
+   @pre chunk != nullptr.
+   @pre chunk->get_input_size() == get_input_size(). */
+  bool ReadNextChunk(VectorLog<double>* chunk);
+
+  /** Restarts reading from the first chunk. */
+  void Rewind();
+
+  /** Reads all of the samples in the file at `filename` into memory.
+   @throws std::exception as for the constructor. */
+  static VectorLog<double> ReadAll(const std::filesystem::path& filename);
+
+ private:
+  // Appends the next chunk of samples to `log`, without clearing it first.
+  bool AppendNextChunk(VectorLog<double>* log);
+
+  std::unique_ptr<const internal::MappedFile> file_;
+  int64_t input_size_{};
+  int64_t num_samples_{};
+  size_t offset_{};
+};
+
+}  // namespace systems
+}  // namespace drake
@@ -32,6 +32,10 @@ namespace systems {
 /// implementation to use `Publish()` as the event handler, rather than one of
 /// the state-modifying handlers.
 ///
+/// For very long simulations, the log can be periodically drained to disk
+/// with a VectorLogFileWriter (and then cleared), to keep memory bounded; see
+/// that class for an example.
+///
 /// By default, sampling is performed every time the Simulator completes a
 /// trajectory-advancing substep (that is, via a per-step Publish event), with
 /// the first sample occurring during Simulator::Initialize(). That means the
@@ -21,12 +21,45 @@ void ConvertDepthPixelwise(const InputImage& input, OutputImage* output,
   if (size == 0) {
     return;
   }
+  // N.B. This loop is written over plain pointers with a branch-free `func`
+  // so that the compiler can vectorize it.
   const typename InputImage::T* const in = input.at(0, 0);
   typename OutputImage::T* const out = output->at(0, 0);
   for (int i = 0; i < size; ++i) {
     out[i] = func(in[i]);
   }
 }
+
+/* Copies the first `kNumCopied` channels of each input pixel to the output
+pixels, setting any remaining output channels to `fill`. */
+template <int kNumCopied, typename InputImage, typename OutputImage>
+void ConvertChannels(const InputImage& input, OutputImage* output,
+                     typename OutputImage::T fill) {
+  constexpr int kIn = InputImage::kNumChannels;
+  constexpr int kOut = OutputImage::kNumChannels;
+  static_assert(kNumCopied <= kIn && kNumCopied <= kOut);
+  const int width = input.width();
+  const int height = input.height();
+  if (!(output->width() == width && output->height() == height)) {
+    output->resize(width, height);
+  }
+  const int num_pixels = width * height;
+  if (num_pixels == 0) {
+    return;
+  }
+  // With the channel counts known at compile time, the compiler can unroll the
+  // inner loop and vectorize the outer one.
+  const typename InputImage::T* const in = input.at(0, 0);
+  typename OutputImage::T* const out = output->at(0, 0);
+  for (int i = 0; i < num_pixels; ++i) {
+    for (int ch = 0; ch < kNumCopied; ++ch) {
+      out[i * kOut + ch] = in[i * kIn + ch];
+    }
+    for (int ch = kNumCopied; ch < kOut; ++ch) {
+      out[i * kOut + ch] = fill;
+    }
+  }
+}
 }  // namespace
 
 // N.B. The `output` images below are phrased as an output argument rather than
@@ -63,6 +96,16 @@ void ConvertDepth16UTo32F(const ImageDepth16U& input, ImageDepth32F* output) {
       });
 }
 
+void ConvertRgba8UToRgb8U(const ImageRgba8U& input, ImageRgb8U* output) {
+  DRAKE_THROW_UNLESS(output != nullptr);
+  ConvertChannels<3>(input, output, 0);
+}
+
+void ConvertRgb8UToRgba8U(const ImageRgb8U& input, ImageRgba8U* output) {
+  DRAKE_THROW_UNLESS(output != nullptr);
+  ConvertChannels<3>(input, output, 255);
+}
+
 }  // namespace sensors
 }  // namespace systems
 }  // namespace drake
@@ -183,6 +183,14 @@ void ConvertDepth32FTo16U(const ImageDepth32F& input, ImageDepth16U* output);
 /// meters.
 void ConvertDepth16UTo32F(const ImageDepth16U& input, ImageDepth32F* output);
 
+/// Converts a four channel RGBA image to a three channel RGB image by dropping
+/// the alpha channel.
+void ConvertRgba8UToRgb8U(const ImageRgba8U& input, ImageRgb8U* output);
+
+/// Converts a three channel RGB image to a four channel RGBA image with every
+/// pixel fully opaque (i.e., alpha of 255).
+void ConvertRgb8UToRgba8U(const ImageRgb8U& input, ImageRgba8U* output);
+
 }  // namespace sensors
 }  // namespace systems
 }  // namespace drake
@@ -1,9 +1,11 @@
 #include "drake/systems/sensors/image_to_lcm_image_array_t.h"
 
 #include <stdexcept>
+#include <vector>
 
 #include <zlib.h>
 
+#include "drake/common/parallel_for.h"
 #include "drake/lcmt_image.hpp"
 #include "drake/lcmt_image_array.hpp"
 #include "drake/systems/sensors/lcm_image_traits.h"
@@ -23,10 +25,9 @@ void Compress(const Image<kPixelType>& image, lcmt_image* msg) {
   msg->compression_method = lcmt_image::COMPRESSION_METHOD_ZLIB;
 
   const int source_size = image.width() * image.height() * image.kPixelSize;
-  // The destination buf_size must be slightly larger than the source size.
-  // http://refspecs.linuxbase.org/LSB_3.0.0/LSB-PDA/LSB-PDA/zlib-compress2-1.html
+  // The destination must be large enough for the worst case compressed size.
   std::vector<uint8_t>& dest = msg->data;
-  size_t dest_size = source_size * 1.001 + 12;
+  uLongf dest_size = compressBound(source_size);
   dest.resize(dest_size);
 
   auto compress_status = compress2(
@@ -197,17 +198,22 @@ void ImageToLcmImageArrayT::CalcImageArray(
   const int num_inputs = num_input_ports();
   msg->num_images = num_inputs;
   msg->images.resize(num_inputs);
+
+  // Evaluating the input ports uses the context's cache, which is not thread
+  // safe, so we evaluate them all here before packing them in parallel.
+  std::vector<const AbstractValue*> values(num_inputs);
   for (int i = 0; i < num_inputs; i++) {
+    values[i] = &this->get_input_port(i).template Eval<AbstractValue>(context);
+  }
+  drake::internal::ParallelFor(parallelism_, num_inputs, [&](int i) {
     const std::string& name = this->get_input_port(i).get_name();
     const PixelType& type = input_port_pixel_type_[i];
-    const auto& value =
-        this->get_input_port(i).template Eval<AbstractValue>(context);
     lcmt_image& packed = msg->images.at(i);
     packed.header = {};
     packed.header.utime = utime;
     packed.header.frame_name = name;
-    PackImageToLcmImageT(value, type, &packed, do_compress_);
-  }
+    PackImageToLcmImageT(*values[i], type, &packed, do_compress_);
+  });
 }
 
 }  // namespace sensors
@@ -4,6 +4,7 @@
 #include <vector>
 
 #include "drake/common/drake_copyable.h"
+#include "drake/common/parallelism.h"
 #include "drake/lcmt_image_array.hpp"
 #include "drake/systems/framework/leaf_system.h"
 #include "drake/systems/sensors/image.h"
@@ -36,6 +37,9 @@ namespace sensors {
 /// @endsystem
 ///
 /// @note The output message's header field `seq` is always zero.
+///
+/// When there are several input images, they can be packed (and, especially,
+/// compressed) concurrently; see set_parallelism().
 class ImageToLcmImageArrayT : public systems::LeafSystem<double> {
  public:
   DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(ImageToLcmImageArrayT)
@@ -73,6 +77,13 @@ class ImageToLcmImageArrayT : public systems::LeafSystem<double> {
   /// `Value<lcmt_image_array>`.
   const OutputPort<double>& image_array_t_msg_output_port() const;
 
+  /// Sets how many threads may pack the input images into the output message
+  /// concurrently, one image per thread. The default is no parallelism.
+  void set_parallelism(Parallelism parallelism) { parallelism_ = parallelism; }
+
+  /// Returns the parallelism passed to set_parallelism().
+  Parallelism get_parallelism() const { return parallelism_; }
+
   template <PixelType kPixelType>
   const InputPort<double>& DeclareImageInputPort(const std::string& name) {
     input_port_pixel_type_.push_back(kPixelType);
@@ -90,6 +101,7 @@ class ImageToLcmImageArrayT : public systems::LeafSystem<double> {
 
   std::vector<PixelType> input_port_pixel_type_{};
   const bool do_compress_;
+  Parallelism parallelism_{false};
 };
 
 }  // namespace sensors
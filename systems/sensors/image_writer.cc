@@ -2,9 +2,15 @@
 
 #include <unistd.h>
 
+#include <condition_variable>
+#include <deque>
+#include <exception>
 #include <filesystem>
+#include <functional>
+#include <mutex>
 #include <regex>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -14,8 +20,12 @@
 #include <vtkImageData.h>     // vtkCommonDataModel
 #include <vtkImageWriter.h>   // vtkIOImage
 #include <vtkNew.h>           // vtkCommonCore
+#include <vtkPNGWriter.h>     // vtkIOImage
 #include <vtkSmartPointer.h>  // vtkCommonCore
+#include <vtkTIFFWriter.h>    // vtkIOImage
 
+#include "drake/common/ssize.h"
+#include "drake/common/text_logging.h"
 #include "drake/systems/sensors/vtk_image_reader_writer.h"
 
 namespace drake {
@@ -23,9 +33,12 @@ namespace systems {
 namespace sensors {
 namespace {
 
+// Writes the image to the given path, using the given compression level (see
+// ImageWriter::set_compression_level()) or the writer's default.
 template <PixelType kPixelType>
 void SaveToFileHelper(const Image<kPixelType>& image,
-                      const std::string& file_path) {
+                      const std::string& file_path,
+                      std::optional<int> compression_level = std::nullopt) {
   const int width = image.width();
   const int height = image.height();
   const int num_channels = Image<kPixelType>::kNumChannels;
@@ -73,12 +86,150 @@ void SaveToFileHelper(const Image<kPixelType>& image,
     }
   }
 
+  if (compression_level.has_value()) {
+    if (auto* png_writer = vtkPNGWriter::SafeDownCast(writer)) {
+      png_writer->SetCompressionLevel(*compression_level);
+    } else if (auto* tiff_writer = vtkTIFFWriter::SafeDownCast(writer)) {
+      if (*compression_level == 0) {
+        tiff_writer->SetCompressionToNoCompression();
+      } else {
+        tiff_writer->SetCompressionToDeflate();
+      }
+    }
+  }
+
   writer->SetInputData(vtk_image.GetPointer());
   writer->Write();
 }
 
 }  // namespace
 
+class ImageWriter::AsyncWriter {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(AsyncWriter)
+
+  AsyncWriter(int num_threads, int max_queue_size, bool drop_when_full)
+      : max_queue_size_(max_queue_size), drop_when_full_(drop_when_full) {
+    for (int i = 0; i < num_threads; ++i) {
+      threads_.emplace_back([this]() {
+        Run();
+      });
+    }
+  }
+
+  // Writes all of the queued images, then stops the threads.
+  ~AsyncWriter() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stop_ = true;
+    }
+    work_ready_.notify_all();
+    for (std::thread& thread : threads_) {
+      thread.join();
+    }
+    if (error_ != nullptr) {
+      try {
+        std::rethrow_exception(error_);
+      } catch (const std::exception& e) {
+        log()->warn("ImageWriter: failed to write an image: {}", e.what());
+      }
+    }
+  }
+
+  // Queues the given write, waiting for room in the queue (or dropping the
+  // write) if the queue is full.
+  void Push(std::function<void()> write) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    ThrowIfError();
+    if (ssize(queue_) >= max_queue_size_) {
+      ++stats_.num_queue_full;
+      if (drop_when_full_) {
+        ++stats_.num_dropped;
+        return;
+      }
+      room_ready_.wait(lock, [this]() {
+        return ssize(queue_) < max_queue_size_;
+      });
+    }
+    queue_.push_back(std::move(write));
+    lock.unlock();
+    work_ready_.notify_one();
+  }
+
+  // Waits until the queue is empty and no writes are in progress.
+  void Flush() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    room_ready_.wait(lock, [this]() {
+      return queue_.empty() && num_busy_ == 0;
+    });
+    ThrowIfError();
+  }
+
+  AsyncStats stats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stats_;
+  }
+
+ private:
+  // Rethrows (and clears) the first error from a background write. The mutex
+  // must be held.
+  void ThrowIfError() {
+    if (error_ != nullptr) {
+      std::exception_ptr error = std::move(error_);
+      error_ = nullptr;
+      std::rethrow_exception(error);
+    }
+  }
+
+  // The body of each background thread.
+  void Run() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+      work_ready_.wait(lock, [this]() {
+        return stop_ || !queue_.empty();
+      });
+      if (queue_.empty()) {
+        return;
+      }
+      std::function<void()> write = std::move(queue_.front());
+      queue_.pop_front();
+      ++num_busy_;
+      lock.unlock();
+      std::exception_ptr error;
+      try {
+        write();
+      } catch (...) {
+        error = std::current_exception();
+      }
+      lock.lock();
+      --num_busy_;
+      if (error == nullptr) {
+        ++stats_.num_written;
+      } else if (error_ == nullptr) {
+        error_ = std::move(error);
+      }
+      room_ready_.notify_all();
+    }
+  }
+
+  const int max_queue_size_;
+  const bool drop_when_full_;
+
+  // Guards all of the members below.
+  mutable std::mutex mutex_;
+  // Signals the threads that there is a write to do, or that they must stop.
+  std::condition_variable work_ready_;
+  // Signals that the queue has room, or that a write has finished.
+  std::condition_variable room_ready_;
+  std::deque<std::function<void()>> queue_;
+  int num_busy_{0};
+  bool stop_{false};
+  std::exception_ptr error_;
+  AsyncStats stats_;
+
+  std::vector<std::thread> threads_;
+};
+
 void SaveToPng(const ImageRgba8U& image, const std::string& file_path) {
   SaveToFileHelper(image, file_path);
 }
@@ -117,6 +268,8 @@ ImageWriter::ImageWriter() {
   DeclareForcedPublishEvent(&ImageWriter::WriteAllImages);
 }
 
+ImageWriter::~ImageWriter() = default;
+
 template <PixelType kPixelType>
 const InputPort<double>& ImageWriter::DeclareImageInputPort(
     std::string port_name, std::string file_name_format, double publish_period,
@@ -242,14 +395,62 @@ void ImageWriter::ResetAllImageCounts() const {
   }
 }
 
+void ImageWriter::EnableAsyncWriting(int num_threads, int max_queue_size,
+                                     bool drop_when_full) {
+  if (num_threads <= 0 || max_queue_size <= 0) {
+    throw std::logic_error(fmt::format(
+        "ImageWriter: the number of threads ({}) and the maximum queue size "
+        "({}) for asynchronous writing must be positive",
+        num_threads, max_queue_size));
+  }
+  if (async_writer_ != nullptr) {
+    throw std::logic_error(
+        "ImageWriter: asynchronous writing has already been enabled");
+  }
+  async_writer_ = std::make_unique<AsyncWriter>(num_threads, max_queue_size,
+                                                drop_when_full);
+}
+
+void ImageWriter::Flush() const {
+  if (async_writer_ != nullptr) {
+    async_writer_->Flush();
+  }
+}
+
+ImageWriter::AsyncStats ImageWriter::get_async_stats() const {
+  if (async_writer_ == nullptr) {
+    return {};
+  }
+  return async_writer_->stats();
+}
+
+void ImageWriter::set_compression_level(int level) {
+  if (level < 0 || level > 9) {
+    throw std::logic_error(fmt::format(
+        "ImageWriter: the compression level must be in [0, 9]; given {}",
+        level));
+  }
+  compression_level_ = level;
+}
+
 template <PixelType kPixelType>
 void ImageWriter::WriteImage(const Context<double>& context, int index) const {
   const auto& port = get_input_port(index);
   const ImagePortInfo& data = port_info_[index];
   const Image<kPixelType>& image = port.Eval<Image<kPixelType>>(context);
-  SaveToFileHelper(
-      image, MakeFileName(data.format, data.pixel_type, context.get_time(),
-                          port.get_name(), data.count++));
+  std::string file_name = MakeFileName(data.format, data.pixel_type,
+                                       context.get_time(), port.get_name(),
+                                       data.count++);
+  if (async_writer_ == nullptr) {
+    SaveToFileHelper(image, file_name, compression_level_);
+    return;
+  }
+  // The background write needs its own copy of the image, since the port's
+  // value may change as soon as we return.
+  async_writer_->Push([image_copy = image, file_name = std::move(file_name),
+                       compression_level = compression_level_]() {
+    SaveToFileHelper(image_copy, file_name, compression_level);
+  });
 }
 
 EventStatus ImageWriter::WriteAllImages(const Context<double>& context) const {
@@ -6,6 +6,9 @@
  invoked in any context and a System that can be connected into a diagram to
  automatically capture images during simulation at a fixed frequency.  */
 
+#include <cstdint>
+#include <memory>
+#include <optional>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -98,6 +101,11 @@ void SaveToPng(const ImageGrey8U& image, const std::string& file_path);
  simultaneously to disk. Note that one can invoke a forced publish on this
  system using the same context multiple times, resulting in multiple
  write operations, with each operation overwriting the same file(s).
+
+ By default, images are encoded and written to disk within the publish event,
+ so that the simulation waits on the image compression and disk I/O. See
+ EnableAsyncWriting() to move that work to background threads instead, and
+ set_compression_level() to trade file size for encoding time.
  */
 class ImageWriter : public LeafSystem<double> {
  public:
@@ -106,6 +114,10 @@ class ImageWriter : public LeafSystem<double> {
   /** Constructs default instance with no image ports.  */
   ImageWriter();
 
+  /** Writes any images that are still queued for asynchronous writing (see
+   EnableAsyncWriting()) before destruction.  */
+  ~ImageWriter() override;
+
   /** Declares and configures a new image input port. A port is configured by
    providing:
 
@@ -226,12 +238,71 @@ class ImageWriter : public LeafSystem<double> {
   // Resets the saved image count for all declared input ports to zero.
   void ResetAllImageCounts() const;
 
+  /** @name     Asynchronous writing and compression  */
+  //@{
+
+  /** Statistics of the asynchronous writing of images. See
+   EnableAsyncWriting().  */
+  struct AsyncStats {
+    /** The number of images written by the background threads.  */
+    int64_t num_written{};
+    /** The number of images published while the queue was full.  */
+    int64_t num_queue_full{};
+    /** The number of images that were dropped, instead of written, because
+     the queue was full.  */
+    int64_t num_dropped{};
+  };
+
+  /** Configures this %ImageWriter to encode and write its images on a pool of
+   `num_threads` background threads. Publishing an image then only copies the
+   image into a queue of at most `max_queue_size` images, so that the
+   simulation doesn't wait on image compression and disk I/O.
+
+   When an image is published while the queue is full, the publish waits for
+   room in the queue, or, if `drop_when_full` is true, the image is dropped.
+   Either way, the occurrence is counted in get_async_stats(). The file name of
+   a dropped image is still consumed (e.g., the `count` format argument still
+   increments).
+
+   Call Flush() to wait until all of the published images have been written;
+   the queue is also flushed when this system is destroyed. If writing an image
+   fails on a background thread, the error is rethrown by the next publish or
+   call to Flush().
+
+   @throws std::exception if `num_threads` or `max_queue_size` is not positive,
+                          or if asynchronous writing was already enabled.  */
+  void EnableAsyncWriting(int num_threads, int max_queue_size,
+                          bool drop_when_full = false);
+
+  /** Waits until all of the images that have been published have been written
+   to disk. Does nothing if asynchronous writing is not enabled.
+   @throws std::exception if writing an image failed on a background thread.  */
+  void Flush() const;
+
+  /** Returns the statistics of the asynchronous writing. They are all zero if
+   asynchronous writing is not enabled.  */
+  AsyncStats get_async_stats() const;
+
+  /** Sets the (lossless) compression level of the images written by this
+   system, from 0 (no compression, the fastest to write) to 9 (the smallest
+   files). For PNG files, this is the zlib compression level. TIFF files are
+   written uncompressed when `level` is 0, and with deflate compression
+   otherwise. By default, PNG files use level 5 and TIFF files use PackBits
+   compression.
+   @throws std::exception if `level` is not in [0, 9].  */
+  void set_compression_level(int level);
+
+  //@}
+
  private:
 #ifndef DRAKE_DOXYGEN_CXX
   // Friend for facilitating unit testing.
   friend class ImageWriterTester;
 #endif
 
+  // The pool of background threads that writes images, when enabled.
+  class AsyncWriter;
+
   // Does the work of writing image indexed by `index` to the disk.
   template <PixelType kPixelType>
   void WriteImage(const Context<double>& context, int index) const;
@@ -284,6 +355,12 @@ class ImageWriter : public LeafSystem<double> {
 
   std::unordered_map<PixelType, std::string> labels_;
   std::unordered_map<PixelType, std::string> extensions_;
+
+  // The compression level of written images, or nullopt for the defaults.
+  std::optional<int> compression_level_;
+
+  // Non-null when asynchronous writing is enabled.
+  std::unique_ptr<AsyncWriter> async_writer_;
 };
 
 }  // namespace sensors
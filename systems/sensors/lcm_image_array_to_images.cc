@@ -165,15 +165,7 @@ void LcmImageArrayToImages::CalcColorImage(const Context<double>& context,
   } else {
     ImageRgb8U rgb_image;
     if (UnpackLcmImage(lcm_image, &rgb_image)) {
-      color_image->resize(lcm_image->width, lcm_image->height);
-      for (int x = 0; x < lcm_image->width; x++) {
-        for (int y = 0; y < lcm_image->height; y++) {
-          color_image->at(x, y)[0] = rgb_image.at(x, y)[0];
-          color_image->at(x, y)[1] = rgb_image.at(x, y)[1];
-          color_image->at(x, y)[2] = rgb_image.at(x, y)[2];
-          color_image->at(x, y)[3] = 0xff;
-        }
-      }
+      ConvertRgb8UToRgba8U(rgb_image, color_image);
     } else {
       *color_image = ImageRgba8U();
     }
@@ -1,12 +1,17 @@
 #include "drake/systems/sensors/rgbd_sensor_async.h"
 
+#include <condition_variable>
+#include <deque>
 #include <future>
 #include <limits>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <set>
 #include <string>
+#include <thread>
 #include <utility>
+#include <vector>
 
 #include "drake/systems/framework/diagram_builder.h"
 #include "drake/systems/sensors/rgbd_sensor.h"
@@ -32,7 +37,13 @@ class, the SnapshotSensor. The SnapshotSensor (itself a diagram) contains a
 QueryObjectChef and RgbdSensor connected in series. The Worker allocates a
 standalone SnapshotSensor Context and fixes the chef's input port(s) to be a
 copy of the scene graph's FramePoseVector input port(s), and uses the RgbdSensor
-to produce a rendered image on its output port. */
+to produce a rendered image on its output port.
+
+By default, the Worker runs each rendering task with std::async. When the
+sensor was given an RgbdSensorAsyncPool, the Worker instead queues its task on
+the pool's RenderPool, whose fixed set of threads bounds how many renders run at
+once. The RenderPool also remembers the most recent PoseSnapshot, so that all of
+the sensors that capture the same QueryObject at the same time share it. */
 
 namespace drake {
 namespace systems {
@@ -159,6 +170,128 @@ struct RenderedImages {
   std::shared_ptr<const ImageLabel16I> label;
 };
 
+/* The frame poses of a QueryObject, keyed by the name of the SnapshotSensor
+input port that they belong on. */
+using PoseSnapshot = std::map<std::string, FramePoseVector<double>>;
+
+/* Reads the frame poses from the QueryObject. Note that deformable geometry is
+not supported because this only propagates poses, not configurations. */
+// TODO(jwnimmer-tri) After the render engine API adds support for deformable
+// geometry, we should upgrade this sensor to support deformables as well.
+std::shared_ptr<const PoseSnapshot> CapturePoses(
+    const QueryObject<double>& query) {
+  auto poses = std::make_shared<PoseSnapshot>();
+  const SceneGraphInspector<double>& inspector = query.inspector();
+  for (bool first = true; const auto& source_id : inspector.GetAllSourceIds()) {
+    if (first) {
+      first = false;
+      // Skip the SceneGraph source that holds the "world" frame.
+      DRAKE_DEMAND(
+          inspector.BelongsToSource(inspector.world_frame_id(), source_id));
+      continue;
+    }
+    const std::string& source_name = inspector.GetName(source_id);
+    auto& source_poses = (*poses)[source_name + "_pose"];
+    for (const auto& frame_id : inspector.FramesForSource(source_id)) {
+      source_poses.set_value(frame_id, query.GetPoseInParent(frame_id));
+    }
+  }
+  return poses;
+}
+
+/* The implementation of RgbdSensorAsyncPool: a fixed set of threads that run
+rendering tasks in the order that they were submitted. */
+class RenderPool {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(RenderPool)
+
+  explicit RenderPool(int num_threads) {
+    for (int i = 0; i < num_threads; ++i) {
+      threads_.emplace_back([this]() {
+        Run();
+      });
+    }
+  }
+
+  /* Runs all of the queued tasks, then stops the threads. */
+  ~RenderPool() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stop_ = true;
+    }
+    work_ready_.notify_all();
+    for (std::thread& thread : threads_) {
+      thread.join();
+    }
+  }
+
+  /* Returns the poses of `query`, reusing the most recent result when it was
+  for this same `query` object at the same time and geometry version (i.e.,
+  when another sensor has already captured it during the same tick). */
+  std::shared_ptr<const PoseSnapshot> GetPoses(
+      double context_time, const QueryObject<double>& query) {
+    std::lock_guard<std::mutex> lock(poses_mutex_);
+    const GeometryVersion& version = query.inspector().geometry_version();
+    if (poses_ == nullptr || poses_query_ != &query ||
+        poses_time_ != context_time ||
+        !poses_version_.IsSameAs(version, Role::kPerception)) {
+      poses_ = CapturePoses(query);
+      poses_query_ = &query;
+      poses_time_ = context_time;
+      poses_version_ = version;
+    }
+    return poses_;
+  }
+
+  /* Queues the given task; the result (or exception) is reported through the
+  returned future. */
+  std::future<RenderedImages> Submit(std::function<RenderedImages()> task) {
+    std::packaged_task<RenderedImages()> packaged(std::move(task));
+    std::future<RenderedImages> result = packaged.get_future();
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      queue_.push_back(std::move(packaged));
+    }
+    work_ready_.notify_one();
+    return result;
+  }
+
+ private:
+  // The body of each background thread.
+  void Run() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+      work_ready_.wait(lock, [this]() {
+        return stop_ || !queue_.empty();
+      });
+      if (queue_.empty()) {
+        return;
+      }
+      std::packaged_task<RenderedImages()> task = std::move(queue_.front());
+      queue_.pop_front();
+      lock.unlock();
+      task();
+      lock.lock();
+    }
+  }
+
+  // Guards the queue and the stop flag.
+  std::mutex mutex_;
+  // Signals the threads that there is a task to run, or that they must stop.
+  std::condition_variable work_ready_;
+  std::deque<std::packaged_task<RenderedImages()>> queue_;
+  bool stop_{false};
+  std::vector<std::thread> threads_;
+
+  // Guards the most recent poses, which might be shared by sensors that are
+  // simulated on different threads.
+  std::mutex poses_mutex_;
+  std::shared_ptr<const PoseSnapshot> poses_;
+  const QueryObject<double>* poses_query_{};
+  double poses_time_{};
+  GeometryVersion poses_version_;
+};
+
 /* The worker is an object where Start() copies the pose input for camera
 rendering and launches an async task, and Finish() blocks for the task to
 complete. The expected workflow is to create a Worker and then repeatedly
@@ -169,16 +302,27 @@ class Worker {
  public:
   DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(Worker)
 
+  /* When `pool` is null, each task runs on its own std::async thread. */
   Worker(std::shared_ptr<const SnapshotSensor> sensor, bool color, bool depth,
-         bool label)
+         bool label, std::shared_ptr<RenderPool> pool)
       : sensor_{std::move(sensor)},
         color_{color},
         depth_{depth},
-        label_{label} {
+        label_{label},
+        pool_{std::move(pool)} {
     DRAKE_DEMAND(sensor_ != nullptr);
     sensor_context_ = sensor_->CreateDefaultContext();
   }
 
+  /* Unlike a std::async future, a pool's future does not wait for its task
+  when destroyed, so we must wait here for the task to stop using our members.
+  */
+  ~Worker() {
+    if (future_.valid()) {
+      future_.wait();
+    }
+  }
+
   /* Begins rendering the given geometry as an async task. */
   void Start(double context_time, const QueryObject<double>& query);
 
@@ -193,12 +337,26 @@ class Worker {
   const bool color_;
   const bool depth_;
   const bool label_;
+  const std::shared_ptr<RenderPool> pool_;
   std::unique_ptr<Context<double>> sensor_context_;
   std::future<RenderedImages> future_;
 };
 
 }  // namespace
 
+class RgbdSensorAsyncPool::Impl final : public RenderPool {
+ public:
+  using RenderPool::RenderPool;
+};
+
+RgbdSensorAsyncPool::RgbdSensorAsyncPool(int max_in_flight)
+    : max_in_flight_(max_in_flight) {
+  DRAKE_THROW_UNLESS(max_in_flight > 0);
+  impl_ = std::make_shared<Impl>(max_in_flight);
+}
+
+RgbdSensorAsyncPool::~RgbdSensorAsyncPool() = default;
+
 /* The abstract state for an RgbdSensorAsync. The `output` is what appears on
 RgbdSensorAsync output ports. The `worker` encapsulates the background task.
 
@@ -217,7 +375,8 @@ RgbdSensorAsync::RgbdSensorAsync(const SceneGraph<double>* scene_graph,
                                  double output_delay,
                                  std::optional<ColorRenderCamera> color_camera,
                                  std::optional<DepthRenderCamera> depth_camera,
-                                 bool render_label_image)
+                                 bool render_label_image,
+                                 std::shared_ptr<RgbdSensorAsyncPool> pool)
     : scene_graph_{scene_graph},
       parent_id_{parent_id},
       X_PB_{X_PB},
@@ -226,7 +385,8 @@ RgbdSensorAsync::RgbdSensorAsync(const SceneGraph<double>* scene_graph,
       output_delay_{output_delay},
       color_camera_{std::move(color_camera)},
       depth_camera_{std::move(depth_camera)},
-      render_label_image_{render_label_image} {
+      render_label_image_{render_label_image},
+      pool_{std::move(pool)} {
   DRAKE_THROW_UNLESS(scene_graph != nullptr);
   DRAKE_THROW_UNLESS(std::isfinite(fps) && (fps > 0));
   DRAKE_THROW_UNLESS(std::isfinite(capture_offset) && (capture_offset >= 0));
@@ -337,9 +497,9 @@ EventStatus RgbdSensorAsync::Initialize(const Context<double>& context,
   // output.
   auto sensor = std::make_shared<const SnapshotSensor>(
       scene_graph_, parent_id_, X_PB_, std::move(*color), std::move(*depth));
-  next_state.worker =
-      std::make_shared<Worker>(std::move(sensor), color_camera_.has_value(),
-                               depth_camera_.has_value(), render_label_image_);
+  next_state.worker = std::make_shared<Worker>(
+      std::move(sensor), color_camera_.has_value(), depth_camera_.has_value(),
+      render_label_image_, pool_ != nullptr ? pool_->impl_ : nullptr);
   next_state.output = {};
   return EventStatus::Succeeded();
 }
@@ -460,26 +620,10 @@ void Worker::Start(double context_time, const QueryObject<double>& query) {
         "to reset things before resuming the simulation.");
   }
 
-  // Read the frame poses from the QueryObject. Note that deformable geometry is
-  // not supported because this only propagates poses, not configurations.
-  // TODO(jwnimmer-tri) After the render engine API adds support for deformable
-  // geometry, we should upgrade this sensor to support deformables as well.
-  std::map<std::string, FramePoseVector<double>> poses;
-  const SceneGraphInspector<double>& inspector = query.inspector();
-  for (bool first = true; const auto& source_id : inspector.GetAllSourceIds()) {
-    if (first) {
-      first = false;
-      // Skip the SceneGraph source that holds the "world" frame.
-      DRAKE_DEMAND(
-          inspector.BelongsToSource(inspector.world_frame_id(), source_id));
-      continue;
-    }
-    const std::string& source_name = inspector.GetName(source_id);
-    auto& source_poses = poses[source_name + "_pose"];
-    for (const auto& frame_id : inspector.FramesForSource(source_id)) {
-      source_poses.set_value(frame_id, query.GetPoseInParent(frame_id));
-    }
-  }
+  // Read the frame poses from the QueryObject.
+  std::shared_ptr<const PoseSnapshot> poses =
+      (pool_ != nullptr) ? pool_->GetPoses(context_time, query)
+                         : CapturePoses(query);
 
   // Abandon our prior task (typically not necessary; valid() is usually false).
   if (future_.valid()) {
@@ -490,7 +634,7 @@ void Worker::Start(double context_time, const QueryObject<double>& query) {
   // Launch the rendering task.
   auto task = [this, context_time,
                poses = std::move(poses)]() -> RenderedImages {
-    for (const auto& [port_name, pose_vector] : poses) {
+    for (const auto& [port_name, pose_vector] : *poses) {
       const auto& input_port = sensor_->GetInputPort(port_name);
       input_port.FixValue(sensor_context_.get(), pose_vector);
     }
@@ -519,7 +663,11 @@ void Worker::Start(double context_time, const QueryObject<double>& query) {
     result.time = context_time;
     return result;
   };
-  future_ = std::async(std::launch::async, std::move(task));
+  if (pool_ != nullptr) {
+    future_ = pool_->Submit(std::move(task));
+  } else {
+    future_ = std::async(std::launch::async, std::move(task));
+  }
 }
 
 RenderedImages Worker::Finish() {
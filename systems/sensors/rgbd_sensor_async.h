@@ -1,5 +1,6 @@
 #pragma once
 
+#include <memory>
 #include <optional>
 
 #include "drake/common/drake_copyable.h"
@@ -16,6 +17,39 @@ namespace drake {
 namespace systems {
 namespace sensors {
 
+/** A fixed set of background threads that performs the rendering for any number
+of RgbdSensorAsync systems that share it (see the RgbdSensorAsync constructor).
+
+Without a pool, every RgbdSensorAsync launches its own background task for
+each capture, so with many sensors the renders all compete at once. With a
+shared pool, at most `max_in_flight` renders run at the same time and the rest
+wait their turn in a first-come first-served queue. Sensors that capture at
+the same time from the same `geometry_query` value also share a single copy of
+the frame poses, rather than each one copying them from the QueryObject.
+
+@experimental */
+class RgbdSensorAsyncPool final {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(RgbdSensorAsyncPool);
+
+  /** Starts `max_in_flight` background rendering threads.
+  @throws std::exception if `max_in_flight` is not positive. */
+  explicit RgbdSensorAsyncPool(int max_in_flight);
+
+  /** Finishes any queued renders, then stops the threads. */
+  ~RgbdSensorAsyncPool();
+
+  /** Returns the `max_in_flight` passed to the constructor. */
+  int max_in_flight() const { return max_in_flight_; }
+
+ private:
+  friend class RgbdSensorAsync;
+  class Impl;
+
+  const int max_in_flight_;
+  std::shared_ptr<Impl> impl_;
+};
+
 /** A sensor similar to RgbdSensorDiscrete but the rendering occurs on a
 background thread to offer improved performance.
 
@@ -74,7 +108,9 @@ network connection, etc.).
 The image rendering between the capture event and the output event happens on a
 background thread, allowing simulation time to continue to advance during the
 rendering's `output_delay`. This helps smooth over the runtime latency
-associated with rendering.
+associated with rendering. By default each sensor renders on its own background
+task; when many sensors are in use, they may instead share an
+RgbdSensorAsyncPool to bound the number of concurrent renders.
 
 See also RgbdSensorDiscrete for a simpler (unthreaded) discrete sensor model, or
 RgbdSensor for a continuous model.
@@ -115,14 +151,18 @@ class RgbdSensorAsync final : public LeafSystem<double> {
     When nullopt, there will be no such output ports.
     At least one of `color_camera` or `depth_camera` must be provided.
   @param render_label_image Whether to provide the `label_image` output port.
-    May be set to true only when a `color_camera` has also been provided. */
+    May be set to true only when a `color_camera` has also been provided.
+  @param pool The background threads to render with, which may be shared with
+    other sensors. When null, this sensor launches its own background task for
+    each capture. */
   RgbdSensorAsync(
       const geometry::SceneGraph<double>* scene_graph,
       geometry::FrameId parent_id, const math::RigidTransformd& X_PB,
       double fps, double capture_offset, double output_delay,
       std::optional<geometry::render::ColorRenderCamera> color_camera,
       std::optional<geometry::render::DepthRenderCamera> depth_camera = {},
-      bool render_label_image = false);
+      bool render_label_image = false,
+      std::shared_ptr<RgbdSensorAsyncPool> pool = nullptr);
 
   /** Returns the `parent_id` passed to the constructor. */
   geometry::FrameId parent_id() const { return parent_id_; }
@@ -151,6 +191,9 @@ class RgbdSensorAsync final : public LeafSystem<double> {
     return depth_camera_;
   }
 
+  /** Returns the `pool` passed to the constructor (possibly null). */
+  const std::shared_ptr<RgbdSensorAsyncPool>& pool() const { return pool_; }
+
   // TODO(jwnimmer-tri) Add an output port for the timestamp associated with
   // the other output ports (images, etc.) to make it easier for the user to
   // know when any given image was captured.
@@ -206,6 +249,7 @@ class RgbdSensorAsync final : public LeafSystem<double> {
   const std::optional<geometry::render::ColorRenderCamera> color_camera_;
   const std::optional<geometry::render::DepthRenderCamera> depth_camera_;
   const bool render_label_image_;
+  const std::shared_ptr<RgbdSensorAsyncPool> pool_;
 };
 
 }  // namespace sensors
@@ -295,6 +295,48 @@ GTEST_TEST(ImageTest, DepthImage16UTo32F) {
   EXPECT_EQ(image_out.height(), 0);
 }
 
+GTEST_TEST(ImageTest, Rgba8UAndRgb8U) {
+  ImageRgba8U rgba(3, 2);
+  for (int i = 0; i < rgba.size(); ++i) {
+    rgba.at(0, 0)[i] = i;
+  }
+
+  // Dropping the alpha channel.
+  ImageRgb8U rgb;
+  ConvertRgba8UToRgb8U(rgba, &rgb);
+  ASSERT_EQ(rgb.width(), 3);
+  ASSERT_EQ(rgb.height(), 2);
+  for (int v = 0; v < 2; ++v) {
+    for (int u = 0; u < 3; ++u) {
+      for (int ch = 0; ch < 3; ++ch) {
+        EXPECT_EQ(rgb.at(u, v)[ch], rgba.at(u, v)[ch]);
+      }
+    }
+  }
+
+  // Adding an opaque alpha channel.
+  ImageRgba8U opaque;
+  ConvertRgb8UToRgba8U(rgb, &opaque);
+  ASSERT_EQ(opaque.width(), 3);
+  ASSERT_EQ(opaque.height(), 2);
+  for (int v = 0; v < 2; ++v) {
+    for (int u = 0; u < 3; ++u) {
+      for (int ch = 0; ch < 3; ++ch) {
+        EXPECT_EQ(opaque.at(u, v)[ch], rgba.at(u, v)[ch]);
+      }
+      EXPECT_EQ(opaque.at(u, v)[3], 255);
+    }
+  }
+
+  // Empty images.
+  rgba.resize(0, 0);
+  ConvertRgba8UToRgb8U(rgba, &rgb);
+  EXPECT_EQ(rgb.size(), 0);
+  rgb.resize(0, 0);
+  ConvertRgb8UToRgba8U(rgb, &opaque);
+  EXPECT_EQ(opaque.size(), 0);
+}
+
 }  // namespace
 }  // namespace sensors
 }  // namespace systems
@@ -111,6 +111,35 @@ GTEST_TEST(ImageToLcmImageArrayT, ValidTest) {
          lcmt_image::COMPRESSION_METHOD_NOT_COMPRESSED);
 }
 
+// Packing the images in parallel produces the same message as packing them
+// serially.
+GTEST_TEST(ImageToLcmImageArrayT, Parallelism) {
+  ImageRgba8U color_image(kImageWidth, kImageHeight, 33);
+  ImageDepth32F depth_image(kImageWidth, kImageHeight, 1.5f);
+  ImageLabel16I label_image(kImageWidth, kImageHeight, 7);
+
+  ImageToLcmImageArrayT serial(kColorFrameName, kDepthFrameName,
+                               kLabelFrameName, true);
+  EXPECT_EQ(serial.get_parallelism().num_threads(), 1);
+  ImageToLcmImageArrayT parallel(kColorFrameName, kDepthFrameName,
+                                 kLabelFrameName, true);
+  parallel.set_parallelism(Parallelism(3));
+  EXPECT_EQ(parallel.get_parallelism().num_threads(), 3);
+
+  const lcmt_image_array expected =
+      SetUpInputAndOutput(&serial, color_image, depth_image, label_image);
+  const lcmt_image_array actual =
+      SetUpInputAndOutput(&parallel, color_image, depth_image, label_image);
+  ASSERT_EQ(actual.num_images, 3);
+  for (int i = 0; i < actual.num_images; ++i) {
+    EXPECT_EQ(actual.images[i].header.frame_name,
+              expected.images[i].header.frame_name);
+    EXPECT_EQ(actual.images[i].compression_method,
+              lcmt_image::COMPRESSION_METHOD_ZLIB);
+    EXPECT_EQ(actual.images[i].data, expected.images[i].data);
+  }
+}
+
 }  // namespace
 }  // namespace sensors
 }  // namespace systems
@@ -6,11 +6,13 @@
 #include <fstream>
 #include <set>
 #include <string>
+#include <vector>
 
 #include <gtest/gtest.h>
 
 #include "drake/common/drake_copyable.h"
 #include "drake/common/temp_directory.h"
+#include "drake/common/test_utilities/expect_no_throw.h"
 #include "drake/common/test_utilities/expect_throws_message.h"
 #include "drake/systems/framework/event_collection.h"
 #include "drake/systems/sensors/test_utilities/image_compare.h"
@@ -668,6 +670,85 @@ TEST_F(ImageWriterTest, WritesGreyImage) {
   TestWritingImageOnPort<PixelType::kGrey8U>();
 }
 
+// Images written on background threads are all written by Flush(), and are
+// the same as images written synchronously.
+TEST_F(ImageWriterTest, AsyncWriting) {
+  ImageWriter writer;
+  ImageWriterTester tester(writer);
+  EXPECT_EQ(writer.get_async_stats().num_written, 0);
+  writer.EnableAsyncWriting(2, 3);
+  DRAKE_EXPECT_THROWS_MESSAGE(writer.EnableAsyncWriting(2, 3),
+                              ".*already been enabled.*");
+
+  fs::path path(temp_dir());
+  path.append("async_{count:03}");
+  const Image<PixelType::kRgba8U> image = test_image<PixelType::kRgba8U>();
+  const auto& port = writer.DeclareImageInputPort<PixelType::kRgba8U>(
+      "port", path.string(), 0.1, 0.0);
+  auto context = writer.AllocateContext();
+  port.FixValue(context.get(), image);
+
+  const int kNumImages = 10;
+  std::vector<std::string> file_names;
+  for (int i = 0; i < kNumImages; ++i) {
+    file_names.push_back(tester.MakeFileName(
+        tester.port_format(port.get_index()), PixelType::kRgba8U,
+        context->get_time(), "port", tester.port_count(port.get_index())));
+    add_file_for_cleanup(file_names.back());
+    writer.ForcedPublish(*context);
+  }
+  writer.Flush();
+
+  const ImageWriter::AsyncStats stats = writer.get_async_stats();
+  EXPECT_EQ(stats.num_written, kNumImages);
+  EXPECT_EQ(stats.num_dropped, 0);
+  for (const std::string& file_name : file_names) {
+    Image<PixelType::kRgba8U> readback;
+    ASSERT_TRUE(LoadImage(file_name, &readback));
+    EXPECT_EQ(readback, image);
+  }
+}
+
+TEST_F(ImageWriterTest, AsyncWritingErrors) {
+  ImageWriter writer;
+  DRAKE_EXPECT_THROWS_MESSAGE(writer.EnableAsyncWriting(0, 3),
+                              ".*must be positive.*");
+  DRAKE_EXPECT_THROWS_MESSAGE(writer.EnableAsyncWriting(2, 0),
+                              ".*must be positive.*");
+  // Flushing is a no-op when writes are synchronous.
+  DRAKE_EXPECT_NO_THROW(writer.Flush());
+}
+
+// The compression level trades file size for speed, but the images are the
+// same.
+TEST_F(ImageWriterTest, CompressionLevel) {
+  DRAKE_EXPECT_THROWS_MESSAGE(ImageWriter().set_compression_level(10),
+                              ".*compression level.*");
+
+  // A uniform image compresses well.
+  Image<PixelType::kDepth16U> image(64, 64, 1000);
+  std::vector<std::uintmax_t> file_sizes;
+  for (const int level : {0, 9}) {
+    ImageWriter writer;
+    writer.set_compression_level(level);
+    fs::path path(temp_dir());
+    path.append("compression_" + std::to_string(level));
+    const auto& port = writer.DeclareImageInputPort<PixelType::kDepth16U>(
+        "port", path.string(), 0.1, 0.0);
+    auto context = writer.AllocateContext();
+    port.FixValue(context.get(), image);
+    writer.ForcedPublish(*context);
+
+    const std::string file_name = path.string() + ".png";
+    add_file_for_cleanup(file_name);
+    Image<PixelType::kDepth16U> readback;
+    ASSERT_TRUE(LoadImage(file_name, &readback));
+    EXPECT_EQ(readback, image);
+    file_sizes.push_back(fs::file_size(file_name));
+  }
+  EXPECT_GT(file_sizes[0], file_sizes[1]);
+}
+
 }  // namespace
 }  // namespace sensors
 }  // namespace systems
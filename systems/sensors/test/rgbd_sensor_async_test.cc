@@ -1,5 +1,8 @@
 #include "drake/systems/sensors/rgbd_sensor_async.h"
 
+#include <memory>
+#include <vector>
+
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
@@ -412,6 +415,42 @@ TEST_F(RgbdSensorAsyncTest, RenderBackgroundColor) {
                   .succeeded());
 }
 
+// Several sensors that share one pool (with fewer threads than sensors) all
+// produce their images on schedule.
+TEST_F(RgbdSensorAsyncTest, SharedPool) {
+  DRAKE_EXPECT_THROWS_MESSAGE(RgbdSensorAsyncPool(0), ".*max_in_flight > 0.*");
+
+  DiagramBuilder<double> builder;
+  auto [plant, scene_graph] = AddMultibodyPlantSceneGraph(&builder, 0);
+  scene_graph.AddRenderer(kRendererName,
+                          std::make_unique<SimpleRenderEngine>());
+  const auto pool = std::make_shared<RgbdSensorAsyncPool>(2);
+  EXPECT_EQ(pool->max_in_flight(), 2);
+  const FrameId parent_id = SceneGraph<double>::world_frame_id();
+  const double fps = 4;
+  const double capture_offset = 0.001;
+  const double output_delay = 0.200;
+  const bool render_label_image = true;
+  std::vector<const RgbdSensorAsync*> sensors;
+  for (int i = 0; i < 3; ++i) {
+    const auto* dut = builder.AddSystem<RgbdSensorAsync>(
+        &scene_graph, parent_id, RigidTransform<double>(), fps, capture_offset,
+        output_delay, color_camera_, depth_camera_, render_label_image, pool);
+    EXPECT_EQ(dut->pool(), pool);
+    builder.Connect(scene_graph.get_query_output_port(), dut->get_input_port());
+    sensors.push_back(dut);
+  }
+  plant.Finalize();
+  Simulator<double> simulator(builder.Build());
+
+  // The first capture at 1ms is output at 201ms.
+  simulator.AdvanceTo(0.202);
+  for (const RgbdSensorAsync* dut : sensors) {
+    ExpectClearImages(
+        *dut, dut->GetMyContextFromRoot(simulator.get_context()), 0.001);
+  }
+}
+
 }  // namespace
 }  // namespace sensors
 }  // namespace systems
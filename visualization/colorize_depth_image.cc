@@ -1,7 +1,7 @@
 #include "drake/visualization/colorize_depth_image.h"
 
 #include <array>
-#include <optional>
+#include <limits>
 
 namespace drake {
 namespace visualization {
@@ -31,28 +31,31 @@ void ColorizeDepthImage<T>::Calc(const ImageDepth32F& input,
     output->resize(input.width(), input.height());
   }
 
+  // N.B. The loops below run over plain pointers with branch-free bodies so
+  // that the compiler can vectorize them.
+  const int size = input.size();
+  if (size == 0) {
+    return;
+  }
+  const float* const in = input.at(0, 0);
+  uint8_t* const out = output->at(0, 0);
+
   // Find the min & max pixel values, excluding too-near and too-far values.
   const auto is_valid = [](float pixel) {
-    return (pixel > 0.0) && std::isfinite(pixel);
+    return (pixel > 0.0f) && (pixel < std::numeric_limits<float>::infinity());
   };
-  std::optional<double> min_pixel;
-  std::optional<double> max_pixel;
-  for (int i = 0; i < input.size(); ++i) {
-    const float pixel = input.at(0, 0)[i];
-    if (is_valid(pixel)) {
-      if (!min_pixel || pixel < *min_pixel) {
-        min_pixel = pixel;
-      }
-      if (!max_pixel || pixel > *max_pixel) {
-        max_pixel = pixel;
-      }
-    }
+  float min_pixel = std::numeric_limits<float>::infinity();
+  float max_pixel = -std::numeric_limits<float>::infinity();
+  for (int i = 0; i < size; ++i) {
+    const float pixel = in[i];
+    const bool valid = is_valid(pixel);
+    min_pixel = (valid && pixel < min_pixel) ? pixel : min_pixel;
+    max_pixel = (valid && pixel > max_pixel) ? pixel : max_pixel;
   }
-  if (!min_pixel.has_value()) {
+  if (min_pixel > max_pixel) {
+    // There were no valid pixels.
     min_pixel = 0;
     max_pixel = 0;
-  } else {
-    DRAKE_DEMAND(max_pixel.has_value());
   }
 
   // Convert the invalid color to bytes.
@@ -64,23 +67,21 @@ void ColorizeDepthImage<T>::Calc(const ImageDepth32F& input,
   };
 
   // Convert the depths to grayscale.
-  const double depth_scale = 1.0 / (*max_pixel - *min_pixel);
-  for (int v = 0; v < output->height(); ++v) {
-    for (int u = 0; u < output->width(); ++u) {
-      const float pixel = input.at(u, v)[0];
-      if (is_valid(pixel)) {
-        const double normalized_depth = (pixel - *min_pixel) * depth_scale;
-        const uint8_t byte = static_cast<uint8_t>(normalized_depth * 255);
-        for (int ch = 0; ch < 3; ++ch) {
-          output->at(u, v)[ch] = byte;
-        }
-        output->at(u, v)[3] = 255;
-      } else {
-        for (int ch = 0; ch < 4; ++ch) {
-          output->at(u, v)[ch] = invalid[ch];
-        }
-      }
-    }
+  const double min_depth = min_pixel;
+  const double depth_scale = 1.0 / (static_cast<double>(max_pixel) - min_depth);
+  for (int i = 0; i < size; ++i) {
+    const float pixel = in[i];
+    const bool valid = is_valid(pixel);
+    // Invalid pixels would produce a garbage byte here; clamping it to zero
+    // keeps the conversion well-defined without a branch.
+    const double normalized_depth =
+        valid ? (pixel - min_depth) * depth_scale : 0.0;
+    const uint8_t byte = static_cast<uint8_t>(normalized_depth * 255);
+    uint8_t* const rgba = out + 4 * i;
+    rgba[0] = valid ? byte : invalid[0];
+    rgba[1] = valid ? byte : invalid[1];
+    rgba[2] = valid ? byte : invalid[2];
+    rgba[3] = valid ? uint8_t{255} : invalid[3];
   }
 }
 
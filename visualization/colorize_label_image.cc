@@ -1,5 +1,6 @@
 #include "drake/visualization/colorize_label_image.h"
 
+#include <algorithm>
 #include <array>
 #include <vector>
 
@@ -60,16 +61,20 @@ void ColorizeLabelImage<T>::Calc(const ImageLabel16I& input,
       static_cast<uint8_t>(background_color_.a() * 255),
   };
   const std::vector<std::array<uint8_t, 4>>& palette = GetDefaultPalette();
-  for (int v = 0; v < output->height(); ++v) {
-    for (int u = 0; u < output->width(); ++u) {
-      const int16_t label = input.at(u, v)[0];
-      const bool is_reserved = label > RenderLabel::kMaxUnreserved;
-      const std::array<uint8_t, 4>& color =
-          is_reserved ? background : palette[label % palette.size()];
-      for (int ch = 0; ch < 4; ++ch) {
-        output->at(u, v)[ch] = color[ch];
-      }
-    }
+  const int size = input.size();
+  if (size == 0) {
+    return;
+  }
+  // N.B. Iterating over plain pointers (rather than calling at() per channel)
+  // lets the compiler keep the copy of each color to a single 32-bit store.
+  const int16_t* const in = input.at(0, 0);
+  uint8_t* const out = output->at(0, 0);
+  for (int i = 0; i < size; ++i) {
+    const int16_t label = in[i];
+    const bool is_reserved = label > RenderLabel::kMaxUnreserved;
+    const std::array<uint8_t, 4>& color =
+        is_reserved ? background : palette[label % palette.size()];
+    std::copy(color.begin(), color.end(), out + 4 * i);
   }
 }
 
@@ -1,5 +1,7 @@
 #include "drake/visualization/concatenate_images.h"
 
+#include <algorithm>
+
 namespace drake {
 namespace visualization {
 
@@ -58,12 +60,10 @@ void ConcatenateImages<T>::CalcOutput(const Context<T>& context,
       DRAKE_THROW_UNLESS(image.height() == cell_height);
       const int v_offset = row * cell_height;
       const int u_offset = col * cell_width;
-      for (int v = 0; v < cell_height; ++v) {
-        for (int u = 0; u < cell_width; ++u) {
-          for (int ch = 0; ch < kNumChannels; ++ch) {
-            output->at(u_offset + u, v_offset + v)[ch] = image.at(u, v)[ch];
-          }
-        }
+      // Each row of the cell is contiguous in both images, so copy it whole.
+      for (int v = 0; cell_width > 0 && v < cell_height; ++v) {
+        std::copy_n(image.at(0, v), cell_width * kNumChannels,
+                    output->at(u_offset, v_offset + v));
       }
     }
   }